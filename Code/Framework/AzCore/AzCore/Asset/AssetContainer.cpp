@@ -407,6 +407,12 @@ namespace AZ::Data
 
     void AssetContainer::RemoveFromWaitingPreloads(const AssetId& waiterId, const AssetId& preloadID)
     {
+        if (!m_hasPreloads.load(AZStd::memory_order_acquire))
+        {
+            // Same as not finding an entry on the preload list below
+            return;
+        }
+
         {
             AZStd::lock_guard<AZStd::recursive_mutex> preloadGuard(m_preloadMutex);
 
@@ -435,6 +441,11 @@ namespace AZ::Data
 
     void AssetContainer::RemoveFromAllWaitingPreloads(const AssetId& thisId)
     {
+        if (!m_hasPreloads.load(AZStd::memory_order_acquire))
+        {
+            return;
+        }
+
         AZStd::unordered_set<AssetId> checkList;
         {
             AZStd::lock_guard<AZStd::recursive_mutex> preloadGuard(m_preloadMutex);
@@ -590,6 +601,8 @@ namespace AZ::Data
             // This method can be entered as additional NoLoad dependency groups are loaded - the container could
             // be in the middle of loading so we need to grab both mutexes.
             AZStd::scoped_lock<AZStd::recursive_mutex, AZStd::recursive_mutex> lock(m_readyMutex, m_preloadMutex);
+            // Set before any entry is added, so a reader that still sees it unset behaves as if it locked before this update
+            m_hasPreloads.store(true, AZStd::memory_order_release);
 
             for (auto thisListPair = preloadList.begin(); thisListPair != preloadList.end();)
             {
@@ -676,6 +689,11 @@ namespace AZ::Data
 
     bool AssetContainer::HasPreloads(const AssetId& assetId) const
     {
+        if (!m_hasPreloads.load(AZStd::memory_order_acquire))
+        {
+            return false;
+        }
+
         AZStd::lock_guard<AZStd::recursive_mutex> preloadGuard(m_preloadMutex);
         auto preloadEntry = m_preloadList.find(assetId);
         if (preloadEntry != m_preloadList.end())
@@ -15,6 +15,7 @@
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/unordered_set.h>
 
 namespace AZ
 {
@@ -132,7 +133,7 @@ namespace AZ
             DependencyList m_dependencies;
 
             mutable AZStd::recursive_mutex m_readyMutex;
-            AZStd::set<AssetId> m_waitingAssets;
+            AZStd::unordered_set<AssetId> m_waitingAssets;
             AZStd::atomic_int m_waitingCount{0};
             AZStd::atomic_int m_invalidDependencies{ 0 };
             AZStd::unordered_set<AZ::Data::AssetId> m_unloadedDependencies;
@@ -140,6 +141,9 @@ namespace AZ
             AZStd::atomic_bool m_finalNotificationSent{false};
 
             mutable AZStd::recursive_mutex m_preloadMutex;
+            // Set once the first preload list entry is added, so containers without preload dependencies
+            // don't need to lock m_preloadMutex for every asset that becomes ready
+            AZStd::atomic_bool m_hasPreloads{ false };
             // AssetId -> List of assets it is still waiting on
             PreloadAssetListType m_preloadList;
 
@@ -14,6 +14,7 @@
 #include <AzCore/IO/IStreamer.h>
 #include <AzCore/Math/Crc.h>
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/parallel/thread.h>
@@ -57,9 +58,10 @@ namespace AZ::Data
         , public Job
     {
     public:
-        AssetDatabaseAsyncJob(JobContext* jobContext, bool deleteWhenDone, AssetManager* owner, const Asset<AssetData>& asset, AssetHandler* assetHandler)
+        AssetDatabaseAsyncJob(JobContext* jobContext, bool deleteWhenDone, AssetManager* owner, const Asset<AssetData>& asset, AssetHandler* assetHandler,
+            AZ::s8 jobPriority = 0)
             : AssetDatabaseJob(owner, asset, assetHandler)
-            , Job(deleteWhenDone, jobContext)
+            , Job(deleteWhenDone, jobContext, false, jobPriority)
         {
         }
 
@@ -127,8 +129,8 @@ namespace AZ::Data
 
         LoadAssetJob(AssetManager* owner, const Asset<AssetData>& asset,
             AZStd::shared_ptr<AssetDataStream> dataStream, bool isReload, AZ::IO::IStreamerTypes::RequestStatus requestState,
-            AssetHandler* handler, const AssetLoadParameters& loadParams, bool signalLoaded)
-            : AssetDatabaseAsyncJob(JobContext::GetGlobalContext(), true, owner, asset, handler)
+            AssetHandler* handler, const AssetLoadParameters& loadParams, bool signalLoaded, AZ::s8 jobPriority)
+            : AssetDatabaseAsyncJob(JobContext::GetGlobalContext(), true, owner, asset, handler, jobPriority)
             , m_dataStream(dataStream)
             , m_isReload(isReload)
             , m_requestState(requestState)
@@ -224,6 +226,10 @@ namespace AZ::Data
                     AssetHandler::LoadResult result =
                         m_assetHandler->LoadAssetDataFromStream(asset, m_dataStream, m_loadParams.m_assetLoadFilterCB);
                     loadedSuccessfully = (result == AssetHandler::LoadResult::LoadComplete);
+                    if (loadedSuccessfully)
+                    {
+                        m_owner->AddResidentAsset(asset, m_dataStream->GetLoadedSize());
+                    }
                 }
             }
 
@@ -590,6 +596,8 @@ namespace AZ::Data
             AssetBus::ExecuteQueuedEvents();
         }
         AssetManagerNotificationBus::Broadcast(&AssetManagerNotificationBus::Events::OnAssetEventsDispatchEnd);
+
+        EvictAssetsOverResidencyBudget();
     }
 
     //=========================================================================
@@ -627,6 +635,9 @@ namespace AZ::Data
     {
         m_cancelAllActiveJobs = true;
 
+        // Release the cached assets first, so the assets that nothing else references can be destroyed
+        ClearResidencyCaches();
+
         // We want to ensure that no active load jobs are in flight and
         // therefore we need to wait till all jobs have completed. Please note that jobs get deleted automatically once they complete.
         WaitForActiveJobsAndStreamerRequestsToFinish();
@@ -902,6 +913,17 @@ namespace AZ::Data
         return { deadline, priority };
     }
 
+    //! Maps the streamer priority of a load onto the priority of the job that processes its data once it's read, so that
+    //! high priority loads don't queue behind background loads for a loading thread. s_priorityMedium maps to the default
+    //! job priority of 0.
+    static AZ::s8 GetLoadJobPriority(AZ::IO::IStreamerTypes::Priority priority)
+    {
+        constexpr int minJobPriority = AZStd::numeric_limits<AZ::s8>::min();
+        constexpr int maxJobPriority = AZStd::numeric_limits<AZ::s8>::max();
+        const int jobPriority = static_cast<int>(priority) - AZ::IO::IStreamerTypes::s_priorityMedium;
+        return aznumeric_cast<AZ::s8>(AZStd::clamp(jobPriority, minJobPriority, maxJobPriority));
+    }
+
     //=========================================================================
     // GetAsset
     // [6/19/2012]
@@ -1093,6 +1115,12 @@ namespace AZ::Data
             }
         }
 
+        if (assetData)
+        {
+            // Requesting a cached asset makes it the most recent one in the residency cache of its type
+            TouchResidentAsset(assetInfo.m_assetId, assetInfo.m_assetType);
+        }
+
         if (!assetInfo.m_relativePath.empty())
         {
             asset.m_assetHint = assetInfo.m_relativePath;
@@ -1793,9 +1821,11 @@ namespace AZ::Data
                 }
 
                 // The callback from AZ Streamer blocks the streaming thread until this function completes. To minimize the overhead,
-                // do the majority of the work in a separate job.
+                // do the majority of the work in a separate job, which runs with the same priority the data was read with.
+                const AZ::IO::IStreamerTypes::Priority priority =
+                    GetEffectiveDeadlineAndPriority(*handler, loadingAsset.GetType(), loadParams).second;
                 auto loadJob = aznew LoadAssetJob(this, loadingAsset,
-                    dataStream, isReload, status, handler, loadParams, signalLoaded);
+                    dataStream, isReload, status, handler, loadParams, signalLoaded, GetLoadJobPriority(priority));
 
                 bool jobQueued = false;
 
@@ -1845,6 +1875,12 @@ namespace AZ::Data
 
         auto&& [deadline, priority] = GetEffectiveDeadlineAndPriority(*handler, asset.GetType(), loadParams);
 
+        if (!isReload)
+        {
+            AssetManagerNotificationBus::Broadcast(&AssetManagerNotificationBus::Events::OnAssetLoadQueued,
+                asset.GetId(), asset.GetType(), streamInfo.m_streamName, streamInfo.m_dataOffset, streamInfo.m_dataLen);
+        }
+
         // Track the load request and queue the asset data stream load.
         AddActiveStreamerRequest(asset.GetId(), dataStream);
         dataStream->Open(
@@ -2037,6 +2073,149 @@ namespace AZ::Data
         return (!(m_activeJobs.empty() && m_activeAssetDataStreamRequests.empty()));
     }
 
+    //=========================================================================
+    // SetAssetResidencyBudget
+    //=========================================================================
+    void AssetManager::SetAssetResidencyBudget(const AssetType& assetType, size_t budgetBytes)
+    {
+        ResidencyCache::EntryList releasedEntries;
+        {
+            AZStd::scoped_lock<AZStd::mutex> residencyLock(m_residencyMutex);
+            if (budgetBytes > 0)
+            {
+                m_residencyCaches[assetType].m_budget = budgetBytes;
+            }
+            else if (auto cacheIt = m_residencyCaches.find(assetType); cacheIt != m_residencyCaches.end())
+            {
+                releasedEntries = AZStd::move(cacheIt->second.m_entries);
+                m_residencyCaches.erase(cacheIt);
+            }
+            m_hasResidencyBudgets = !m_residencyCaches.empty();
+        }
+
+        // The cached references are released outside of the residency lock, as releasing an asset locks the asset map
+        releasedEntries.clear();
+
+        EvictAssetsOverResidencyBudget();
+    }
+
+    size_t AssetManager::GetAssetResidencyBudget(const AssetType& assetType) const
+    {
+        AZStd::scoped_lock<AZStd::mutex> residencyLock(m_residencyMutex);
+        auto cacheIt = m_residencyCaches.find(assetType);
+        return cacheIt != m_residencyCaches.end() ? cacheIt->second.m_budget : 0;
+    }
+
+    size_t AssetManager::GetAssetResidentSize(const AssetType& assetType) const
+    {
+        AZStd::scoped_lock<AZStd::mutex> residencyLock(m_residencyMutex);
+        auto cacheIt = m_residencyCaches.find(assetType);
+        return cacheIt != m_residencyCaches.end() ? cacheIt->second.m_residentSize : 0;
+    }
+
+    void AssetManager::EvictAssetsOverResidencyBudget()
+    {
+        if (!m_hasResidencyBudgets)
+        {
+            return;
+        }
+
+        AZStd::vector<ResidencyCache::Entry> evictedEntries;
+        {
+            AZStd::scoped_lock<AZStd::mutex> residencyLock(m_residencyMutex);
+            for (auto& [assetType, cache] : m_residencyCaches)
+            {
+                // Walk from the least recently requested asset, skipping assets that are referenced outside of the cache
+                auto entryIt = cache.m_entries.end();
+                while (cache.m_residentSize > cache.m_budget && entryIt != cache.m_entries.begin())
+                {
+                    --entryIt;
+                    if (entryIt->m_asset->GetUseCount() == 1)
+                    {
+                        cache.m_residentSize -= entryIt->m_size;
+                        cache.m_lookup.erase(entryIt->m_asset.GetId());
+                        evictedEntries.push_back(AZStd::move(*entryIt));
+                        entryIt = cache.m_entries.erase(entryIt);
+                    }
+                }
+            }
+        }
+
+        for (ResidencyCache::Entry& evictedEntry : evictedEntries)
+        {
+            const AssetId assetId = evictedEntry.m_asset.GetId();
+            const AssetType assetType = evictedEntry.m_asset.GetType();
+            evictedEntry.m_asset.Reset();
+            AssetManagerNotificationBus::Broadcast(
+                &AssetManagerNotificationBus::Events::OnAssetEvicted, assetId, assetType, evictedEntry.m_size);
+        }
+    }
+
+    void AssetManager::AddResidentAsset(const Asset<AssetData>& asset, size_t loadedSize)
+    {
+        // Assets that aren't shared can't be requested again, so there's no point in caching them
+        if (!m_hasResidencyBudgets || !asset || !asset->IsRegisterReadonlyAndShareable())
+        {
+            return;
+        }
+
+        AZStd::scoped_lock<AZStd::mutex> residencyLock(m_residencyMutex);
+        auto cacheIt = m_residencyCaches.find(asset.GetType());
+        if (cacheIt == m_residencyCaches.end())
+        {
+            return;
+        }
+
+        ResidencyCache& cache = cacheIt->second;
+        if (auto lookupIt = cache.m_lookup.find(asset.GetId()); lookupIt != cache.m_lookup.end())
+        {
+            // The asset was reloaded, so hold on to the new data instead of the old one and account for its size
+            cache.m_residentSize -= lookupIt->second->m_size;
+            lookupIt->second->m_asset = asset;
+            lookupIt->second->m_size = loadedSize;
+            cache.m_entries.splice(cache.m_entries.begin(), cache.m_entries, lookupIt->second);
+        }
+        else
+        {
+            cache.m_entries.push_front({ asset, loadedSize });
+            cache.m_lookup.emplace(asset.GetId(), cache.m_entries.begin());
+        }
+        cache.m_residentSize += loadedSize;
+    }
+
+    void AssetManager::TouchResidentAsset(const AssetId& assetId, const AssetType& assetType)
+    {
+        if (!m_hasResidencyBudgets)
+        {
+            return;
+        }
+
+        AZStd::scoped_lock<AZStd::mutex> residencyLock(m_residencyMutex);
+        if (auto cacheIt = m_residencyCaches.find(assetType); cacheIt != m_residencyCaches.end())
+        {
+            ResidencyCache& cache = cacheIt->second;
+            if (auto lookupIt = cache.m_lookup.find(assetId); lookupIt != cache.m_lookup.end())
+            {
+                cache.m_entries.splice(cache.m_entries.begin(), cache.m_entries, lookupIt->second);
+            }
+        }
+    }
+
+    void AssetManager::ClearResidencyCaches()
+    {
+        ResidencyCache::EntryList releasedEntries;
+        {
+            AZStd::scoped_lock<AZStd::mutex> residencyLock(m_residencyMutex);
+            for (auto& [assetType, cache] : m_residencyCaches)
+            {
+                releasedEntries.splice(releasedEntries.end(), cache.m_entries);
+                cache.m_lookup.clear();
+                cache.m_residentSize = 0;
+            }
+        }
+        releasedEntries.clear();
+    }
+
     //=========================================================================
     // AddBlockingRequest
     //=========================================================================
@@ -17,8 +17,10 @@
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/containers/flat_hash_map.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/intrusive_list.h>
+#include <AzCore/std/containers/list.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/std/smart_ptr/weak_ptr.h>
 
@@ -150,8 +152,9 @@ namespace AZ
                 Descriptor() = default;
             };
 
-            typedef AZStd::unordered_map<AssetType, AssetHandler*> AssetHandlerMap;
-            typedef AZStd::unordered_map<AssetType, AssetCatalog*> AssetCatalogMap;
+            // Looked up for every asset request and rarely modified, so they are stored in flat hash tables
+            typedef AZStd::flat_hash_map<AssetType, AssetHandler*> AssetHandlerMap;
+            typedef AZStd::flat_hash_map<AssetType, AssetCatalog*> AssetCatalogMap;
             typedef AZStd::unordered_map<AssetId, AssetData*> AssetMap;
             typedef AZStd::unordered_map<AssetContainerKey, AZStd::weak_ptr<AssetContainer>> WeakAssetContainerMap;
             typedef AZStd::unordered_map<AssetContainer*, AZStd::shared_ptr<AssetContainer>> OwnedAssetContainerMap;
@@ -324,6 +327,28 @@ namespace AZ
             */
             bool HasActiveJobsOrStreamerRequests();
 
+            /**
+            * Sets a memory budget for the loaded assets of a type, measured by the size of their loaded data.
+            * Assets of the type stay cached after their last reference is released, which keeps them ready for the next request.
+            * When the assets of the type exceed the budget, DispatchEvents evicts the least recently requested ones that aren't
+            * referenced outside of the cache and signals AssetManagerNotifications::OnAssetEvicted for each of them.
+            * Assets that are still referenced count against the budget but are never evicted.
+            * A budget of 0 removes the budget and releases the cached assets of the type.
+            */
+            void SetAssetResidencyBudget(const AssetType& assetType, size_t budgetBytes);
+            size_t GetAssetResidencyBudget(const AssetType& assetType) const;
+
+            /**
+            * Returns the loaded data size of the assets of a type that are tracked by its residency budget.
+            */
+            size_t GetAssetResidentSize(const AssetType& assetType) const;
+
+            /**
+            * Evicts unreferenced assets from the residency caches that are over their budget.
+            * This is called by DispatchEvents.
+            */
+            void EvictAssetsOverResidencyBudget();
+
         protected:
             AssetManager(const Descriptor& desc);
             virtual ~AssetManager();
@@ -378,6 +403,14 @@ namespace AZ
             **/
             void ReleaseAssetContainersForAsset(AssetData* asset);
 
+            //! Adds a loaded asset to the residency cache of its type if the type has a budget,
+            //! or moves it to the front if it's already cached.
+            void AddResidentAsset(const Asset<AssetData>& asset, size_t loadedSize);
+            //! Moves a cached asset to the front of the residency cache of its type.
+            void TouchResidentAsset(const AssetId& assetId, const AssetType& assetType);
+            //! Releases the cached assets of every residency cache.
+            void ClearResidencyCaches();
+
             /**
             * Clears all references to the owned asset container.
             **/
@@ -422,6 +455,25 @@ namespace AZ
             typedef AZStd::unordered_map<AssetId, Asset<AssetData> > ReloadMap;
             ReloadMap               m_reloads;          // book-keeping and reference-holding for asset reloads
 
+            //! Loaded assets of a type that has a residency budget, most recently requested first.
+            struct ResidencyCache
+            {
+                struct Entry
+                {
+                    Asset<AssetData> m_asset;
+                    size_t m_size = 0;
+                };
+                using EntryList = AZStd::list<Entry>;
+
+                size_t m_budget = 0;
+                size_t m_residentSize = 0;
+                EntryList m_entries;
+                AZStd::unordered_map<AssetId, EntryList::iterator> m_lookup;
+            };
+            AZStd::unordered_map<AssetType, ResidencyCache> m_residencyCaches;
+            mutable AZStd::mutex    m_residencyMutex;   // lock when accessing the residency caches
+            AZStd::atomic_bool      m_hasResidencyBudgets{ false };
+
             typedef AZStd::intrusive_list<AssetDatabaseJob, AZStd::list_base_hook<AssetDatabaseJob> > ActiveJobList;
             ActiveJobList           m_activeJobs;
 
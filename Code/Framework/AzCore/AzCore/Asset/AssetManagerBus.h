@@ -292,6 +292,14 @@ namespace AZ
             virtual void OnAssetEventsDispatchBegin() {}
             /// Notify listeners that all asset events have finished dispatching
             virtual void OnAssetEventsDispatchEnd() {}
+            /// Notify listeners that the data of an asset was queued to be read from a stream, which isn't sent for reloads
+            /// This is sent from the thread that requested the load, in the order the loads were queued
+            virtual void OnAssetLoadQueued([[maybe_unused]] const AssetId& assetId, [[maybe_unused]] const AssetType& assetType,
+                [[maybe_unused]] AZStd::string_view streamName, [[maybe_unused]] u64 dataOffset, [[maybe_unused]] u64 dataLength) {}
+            /// Notify listeners that an asset was evicted from the residency cache of its type to stay within the budget
+            /// The asset is unloaded unless it was requested again while it was being evicted
+            virtual void OnAssetEvicted([[maybe_unused]] const AssetId& assetId, [[maybe_unused]] const AssetType& assetType,
+                [[maybe_unused]] size_t residentSize) {}
         };
         typedef EBus<AssetManagerNotifications> AssetManagerNotificationBus;
 
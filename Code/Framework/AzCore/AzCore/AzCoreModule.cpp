@@ -20,6 +20,7 @@
 #include <AzCore/UserSettings/UserSettingsComponent.h>
 #include <AzCore/Console/LoggerSystemComponent.h>
 #include <AzCore/EBus/EventSchedulerSystemComponent.h>
+#include <AzCore/Metrics/MetricsExporterSystemComponent.h>
 #include <AzCore/Task/TaskGraphSystemComponent.h>
 #include <AzCore/Statistics/StatisticalProfilerProxySystemComponent.h>
 
@@ -39,6 +40,7 @@ namespace AZ
             SliceMetadataInfoComponent::CreateDescriptor(),
             LoggerSystemComponent::CreateDescriptor(),
             EventSchedulerSystemComponent::CreateDescriptor(),
+            Metrics::MetricsExporterSystemComponent::CreateDescriptor(),
             TaskGraphSystemComponent::CreateDescriptor(),
 
 #if !defined(_RELEASE)
@@ -57,6 +59,7 @@ namespace AZ
         {
             azrtti_typeid<LoggerSystemComponent>(),
             azrtti_typeid<EventSchedulerSystemComponent>(),
+            azrtti_typeid<Metrics::MetricsExporterSystemComponent>(),
             azrtti_typeid<TaskGraphSystemComponent>(),
 
 #if !defined(_RELEASE)
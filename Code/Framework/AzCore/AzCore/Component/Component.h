@@ -266,6 +266,7 @@ namespace AZ
     template<class Comp, class Void> friend class AZ::HasComponentDependentServices;                                                    \
     template<class Comp, class Void> friend class AZ::HasComponentRequiredServices;                                                     \
     template<class Comp, class Void> friend class AZ::HasComponentIncompatibleServices;                                                 \
+    template<class Comp, class Void> friend class AZ::HasComponentInitThreadSafe;                                                       \
     static AZ::ComponentDescriptor* CreateDescriptor()                                                                                  \
     { \
         static const char* s_typeName = _ComponentClass::RTTI_TypeName(); \
@@ -295,6 +296,7 @@ namespace AZ
     template<class Comp, class Void> friend class AZ::HasComponentDependentServices; \
     template<class Comp, class Void> friend class AZ::HasComponentRequiredServices; \
     template<class Comp, class Void> friend class AZ::HasComponentIncompatibleServices; \
+    template<class Comp, class Void> friend class AZ::HasComponentInitThreadSafe; \
     static AZ::ComponentDescriptor* CreateDescriptor();
 
     #define AZ_COMPONENT_BASE_IMPL_0(_ComponentClass, _Inline, _TemplateParamsParen) \
@@ -584,6 +586,13 @@ namespace AZ
          */
         virtual void GetWarnings([[maybe_unused]] StringWarningArray& warnings, [[maybe_unused]] const Component* instance) const { }
 
+        /**
+         * Specifies whether the Init function of the component can run on a worker thread, in parallel with the Init of components
+         * of other entities. Such components can only use their own data and thread safe systems during Init.
+         * @return True if Init is thread safe, false (the default) if it has to run on the thread that initializes the entity.
+         */
+        virtual bool IsInitThreadSafe() const { return false; }
+
         /**
          * Gets the current descriptor.
          * @param instance The current descriptor.
@@ -678,6 +687,7 @@ namespace AZ
     AZ_HAS_STATIC_MEMBER(ComponentDependentServices, GetDependentServices, void, (ComponentDescriptor::DependencyArrayType &));
     AZ_HAS_STATIC_MEMBER(ComponentRequiredServices, GetRequiredServices, void, (ComponentDescriptor::DependencyArrayType &));
     AZ_HAS_STATIC_MEMBER(ComponentIncompatibleServices, GetIncompatibleServices, void, (ComponentDescriptor::DependencyArrayType &));
+    AZ_HAS_STATIC_MEMBER(ComponentInitThreadSafe, IsInitThreadSafe, bool, ());
     /// @endcond
 
     /**
@@ -750,6 +760,15 @@ namespace AZ
             CallIncompatibleServices(incompatible, typename HasComponentIncompatibleServices<ComponentClass>::type());
         }
 
+        /**
+         * Calls the static function IsInitThreadSafe, if the user provided it.
+         * @return True if the Init function of the component is thread safe.
+         */
+        bool IsInitThreadSafe() const override
+        {
+            return CallInitThreadSafe(typename HasComponentInitThreadSafe<ComponentClass>::type());
+        }
+
     private:
 
         void CallReflect(ReflectContext* reflection, const AZStd::true_type&) const
@@ -796,6 +815,16 @@ namespace AZ
         void CallIncompatibleServices(ComponentDescriptor::DependencyArrayType&, const AZStd::false_type&) const
         {
         }
+
+        bool CallInitThreadSafe(const AZStd::true_type&) const
+        {
+            return ComponentClass::IsInitThreadSafe();
+        }
+
+        bool CallInitThreadSafe(const AZStd::false_type&) const
+        {
+            return false;
+        }
     };
 }
 
@@ -21,8 +21,10 @@
 #include <AzCore/Memory/AllocationRecords.h>
 
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 
 #include <AzCore/Metrics/EventLoggerFactoryImpl.h>
+#include <AzCore/Metrics/MetricsRegistryImpl.h>
 #include <AzCore/Metrics/JsonTraceEventLogger.h>
 #include <AzCore/Metrics/EventLoggerUtils.h>
 
@@ -475,6 +477,7 @@ namespace AZ
         InitializeSettingsRegistry(componentAppSettings);
 
         InitializeEventLoggerFactory();
+        InitializeMetricsRegistry();
 
         InitializeLifecyleEvents(*m_settingsRegistry);
 
@@ -547,6 +550,14 @@ namespace AZ
 
         m_eventLoggerFactory.reset();
 
+        // Unregister the Metrics Registry with the AZ Interface if it is registered
+        if (AZ::Metrics::MetricsRegistry::Get() == m_metricsRegistry.get())
+        {
+            AZ::Metrics::MetricsRegistry::Unregister(m_metricsRegistry.get());
+        }
+
+        m_metricsRegistry.reset();
+
         // Set AZ::CommandLine to an empty object to clear out allocated memory before the allocators
         // are destroyed
         m_commandLine = {};
@@ -618,6 +629,16 @@ namespace AZ
         }
     }
 
+    void ComponentApplication::InitializeMetricsRegistry()
+    {
+        // Create the MetricsRegistry before the modules, so gems can register their metrics while they are activated
+        m_metricsRegistry = AZStd::make_unique<AZ::Metrics::MetricsRegistryImpl>();
+        if (AZ::Metrics::MetricsRegistry::Get() == nullptr)
+        {
+            AZ::Metrics::MetricsRegistry::Register(m_metricsRegistry.get());
+        }
+    }
+
     void ComponentApplication::InitializeLifecyleEvents(AZ::SettingsRegistryInterface& settingsRegistry)
     {
         // The /O3DE/Application/LifecycleEvents array contains a valid set of lifecycle events
@@ -998,6 +1019,24 @@ namespace AZ
             SettingsRegistryMergeUtils::MergeSettingsToRegistry_AddRuntimeFilePaths(registry);
         }
 
+        // A settings registry snapshot already holds the merged content of all the registry folders below,
+        // so they don't need to be enumerated and parsed again
+        if (AZ::IO::FixedMaxPath snapshotPath;
+            registry.Get(snapshotPath.Native(), SettingsRegistryMergeUtils::SnapshotPathKey) && !snapshotPath.empty())
+        {
+            if (auto mergeResult = SettingsRegistryMergeUtils::MergeSettingsToRegistry_Snapshot(registry, snapshotPath.Native());
+                mergeResult)
+            {
+                return;
+            }
+            else
+            {
+                AZ_Warning("ComponentApplication", false,
+                    R"(Unable to merge settings registry snapshot "%s", merging the registry folders instead.)" "\n"
+                    "Error message is %s", snapshotPath.c_str(), mergeResult.GetMessages().c_str());
+            }
+        }
+
         //! Retrieves the list gem targets that the project has load dependencies on
         //! This populates the /Amazon/Gems/<GemName> field entries which is required
         //! by the MergeSettingsToRegistry_GemRegistry() function below to locate the gem's root folder
@@ -1301,6 +1340,23 @@ namespace AZ
         ReflectionEnvironment::GetReflectionManager()->AddReflectContext<SerializeContext>();
         ReflectionEnvironment::GetReflectionManager()->AddReflectContext<BehaviorContext>();
         ReflectionEnvironment::GetReflectionManager()->AddReflectContext<JsonRegistrationContext>();
+        // Modules that opt in with AZ::Module::IsReflectionDeferrable only reflect into the BehaviorContext once it is needed
+        ReflectionEnvironment::GetReflectionManager()->SetReflectContextLazy<BehaviorContext>();
+
+        // Size the contexts up front with the counts recorded at build time, if available
+        AZ::u64 serializeClassCount = 0;
+        if (m_settingsRegistry->Get(serializeClassCount, ReflectionCapacityHints::SerializeContextClassCountKey))
+        {
+            GetSerializeContext()->ReserveClassData(aznumeric_cast<size_t>(serializeClassCount));
+        }
+        AZ::u64 behaviorClassCount = 0;
+        AZ::u64 behaviorEBusCount = 0;
+        const bool hasBehaviorClassCount = m_settingsRegistry->Get(behaviorClassCount, ReflectionCapacityHints::BehaviorContextClassCountKey);
+        const bool hasBehaviorEBusCount = m_settingsRegistry->Get(behaviorEBusCount, ReflectionCapacityHints::BehaviorContextEBusCountKey);
+        if (hasBehaviorClassCount || hasBehaviorEBusCount)
+        {
+            GetBehaviorContext()->ReserveCapacity(aznumeric_cast<size_t>(behaviorClassCount), aznumeric_cast<size_t>(behaviorEBusCount));
+        }
     }
 
     //=========================================================================
@@ -1511,6 +1567,12 @@ namespace AZ
             m_lastTickTime = currentMonotonicTime;
         }
 
+        // Start a new frame for the transient frame allocations, if anything has used the frame arena allocator.
+        if (auto frameArena = Environment::FindVariable<FrameArenaAllocator>(AzTypeInfo<FrameArenaAllocator>::Name()); frameArena)
+        {
+            frameArena->NextFrame();
+        }
+
         {
             AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:ExecuteQueuedEvents");
             TickBus::ExecuteQueuedEvents();
@@ -42,6 +42,7 @@ namespace AZ
 namespace AZ::Metrics
 {
     class IEventLoggerFactory;
+    class IMetricsRegistry;
 
     enum class EventLoggerId : AZ::u32;
 
@@ -71,6 +72,15 @@ namespace AZ
 
     };
 
+    //! Settings registry keys of the number of reflected types, used to size the reflect contexts before any module reflects.
+    //! The 'dumpreflectionhints' action of SerializeContextTools writes them to a .setreg file at build time.
+    namespace ReflectionCapacityHints
+    {
+        inline constexpr AZStd::string_view SerializeContextClassCountKey = "/O3DE/Reflection/CapacityHints/SerializeContext/ClassCount";
+        inline constexpr AZStd::string_view BehaviorContextClassCountKey = "/O3DE/Reflection/CapacityHints/BehaviorContext/ClassCount";
+        inline constexpr AZStd::string_view BehaviorContextEBusCountKey = "/O3DE/Reflection/CapacityHints/BehaviorContext/EBusCount";
+    } // namespace ReflectionCapacityHints
+
     //! Settings used to customize the constructor calls for the ComponentApplications
     //! This differs from the ComponentApplication::StartupParameters and ComponentApplication::Descriptor structs
     //! These settings are only used at construction time of the ComponentApplication and not in ComponentApplication::Create()
@@ -291,6 +301,7 @@ namespace AZ
         //! after creation
         void InitializeSettingsRegistry(const ComponentApplicationSettings& componentAppSettings);
         void InitializeEventLoggerFactory();
+        void InitializeMetricsRegistry();
         void InitializeLifecyleEvents(SettingsRegistryInterface& settingsRegistry);
         void InitializeConsole(SettingsRegistryInterface& settingsRegistry);
 
@@ -406,6 +417,7 @@ namespace AZ
         AZStd::unique_ptr<AZ::Entity>               m_systemEntity; ///< Track the system entity to ensure we free it on shutdown.
 
         AZStd::unique_ptr<AZ::Metrics::IEventLoggerFactory> m_eventLoggerFactory;
+        AZStd::unique_ptr<AZ::Metrics::IMetricsRegistry> m_metricsRegistry;
 
         using TickTimepoint = AZStd::chrono::steady_clock::time_point;
         TickTimepoint m_lastTickTime{};
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+
+namespace AZ
+{
+    //! Keeps data of a single type for many components in contiguous arrays, so systems can iterate the data of all components
+    //! without going through the individually allocated component objects.
+    //! A component adds its data when it activates, keeps the returned handle, and writes to the data through the handle while
+    //! it's active. Removing an element moves the last element into its place, so the arrays always stay packed but the order
+    //! of the elements changes.
+    //! Handles hold a generation, so a handle to an element that was removed, or to a storage that was cleared, is ignored.
+    //! The storage isn't thread safe.
+    template<typename T>
+    class DenseComponentStorage
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(DenseComponentStorage, SystemAllocator);
+
+        static constexpr uint32_t InvalidIndex = AZStd::numeric_limits<uint32_t>::max();
+
+        struct Handle
+        {
+            bool IsValid() const { return m_slot != InvalidIndex; }
+
+            uint32_t m_slot = InvalidIndex;
+            uint32_t m_generation = 0;
+        };
+
+        //! Adds the data of the component on an entity and returns the handle to it.
+        Handle Add(EntityId entityId, const T& data);
+        //! Removes the data the handle points to. Returns false if the handle is no longer valid.
+        bool Remove(Handle handle);
+        //! Removes all data and invalidates all handles.
+        void Clear();
+
+        //! Returns the data the handle points to, or nullptr if the handle is no longer valid.
+        T* Find(Handle handle);
+        const T* Find(Handle handle) const;
+
+        size_t GetSize() const { return m_data.size(); }
+        bool IsEmpty() const { return m_data.empty(); }
+
+        //! The data of all components. The data at an index belongs to the entity at the same index in GetEntityIds().
+        AZStd::span<T> GetData() { return m_data; }
+        AZStd::span<const T> GetData() const { return m_data; }
+        AZStd::span<const EntityId> GetEntityIds() const { return m_entityIds; }
+
+    private:
+        struct Slot
+        {
+            uint32_t m_dataIndex = InvalidIndex; //!< Index in the data arrays, or InvalidIndex if the slot is free.
+            uint32_t m_generation = 0;
+        };
+
+        const Slot* FindSlot(Handle handle) const;
+
+        AZStd::vector<T> m_data;
+        AZStd::vector<EntityId> m_entityIds;
+        AZStd::vector<uint32_t> m_dataSlots; //!< The slot of the data at the same index.
+        AZStd::vector<Slot> m_slots;
+        AZStd::vector<uint32_t> m_freeSlots;
+    };
+
+    template<typename T>
+    auto DenseComponentStorage<T>::Add(EntityId entityId, const T& data) -> Handle
+    {
+        uint32_t slotIndex;
+        if (!m_freeSlots.empty())
+        {
+            slotIndex = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        else
+        {
+            slotIndex = aznumeric_caster(m_slots.size());
+            m_slots.emplace_back();
+        }
+
+        Slot& slot = m_slots[slotIndex];
+        slot.m_dataIndex = aznumeric_caster(m_data.size());
+        m_data.push_back(data);
+        m_entityIds.push_back(entityId);
+        m_dataSlots.push_back(slotIndex);
+
+        return Handle{ slotIndex, slot.m_generation };
+    }
+
+    template<typename T>
+    bool DenseComponentStorage<T>::Remove(Handle handle)
+    {
+        if (!FindSlot(handle))
+        {
+            return false;
+        }
+
+        Slot& slot = m_slots[handle.m_slot];
+        const uint32_t lastIndex = aznumeric_caster(m_data.size() - 1);
+        if (slot.m_dataIndex != lastIndex)
+        {
+            m_data[slot.m_dataIndex] = AZStd::move(m_data[lastIndex]);
+            m_entityIds[slot.m_dataIndex] = m_entityIds[lastIndex];
+            m_dataSlots[slot.m_dataIndex] = m_dataSlots[lastIndex];
+            m_slots[m_dataSlots[slot.m_dataIndex]].m_dataIndex = slot.m_dataIndex;
+        }
+        m_data.pop_back();
+        m_entityIds.pop_back();
+        m_dataSlots.pop_back();
+
+        slot.m_dataIndex = InvalidIndex;
+        ++slot.m_generation;
+        m_freeSlots.push_back(handle.m_slot);
+        return true;
+    }
+
+    template<typename T>
+    void DenseComponentStorage<T>::Clear()
+    {
+        for (uint32_t slotIndex : m_dataSlots)
+        {
+            Slot& slot = m_slots[slotIndex];
+            slot.m_dataIndex = InvalidIndex;
+            ++slot.m_generation;
+            m_freeSlots.push_back(slotIndex);
+        }
+        m_data.clear();
+        m_entityIds.clear();
+        m_dataSlots.clear();
+    }
+
+    template<typename T>
+    T* DenseComponentStorage<T>::Find(Handle handle)
+    {
+        const Slot* slot = FindSlot(handle);
+        return slot ? &m_data[slot->m_dataIndex] : nullptr;
+    }
+
+    template<typename T>
+    const T* DenseComponentStorage<T>::Find(Handle handle) const
+    {
+        const Slot* slot = FindSlot(handle);
+        return slot ? &m_data[slot->m_dataIndex] : nullptr;
+    }
+
+    template<typename T>
+    auto DenseComponentStorage<T>::FindSlot(Handle handle) const -> const Slot*
+    {
+        if (handle.m_slot < m_slots.size())
+        {
+            const Slot& slot = m_slots[handle.m_slot];
+            if (slot.m_generation == handle.m_generation && slot.m_dataIndex != InvalidIndex)
+            {
+                return &slot;
+            }
+        }
+        return nullptr;
+    }
+} // namespace AZ
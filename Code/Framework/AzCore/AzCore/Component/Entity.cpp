@@ -41,6 +41,16 @@ DECLARE_EBUS_INSTANTIATION(TransformHierarchyInformation);
 
 namespace AZ
 {
+    namespace EntityInternal
+    {
+        bool IsComponentInitThreadSafe(const Component* component)
+        {
+            ComponentDescriptor* descriptor = nullptr;
+            ComponentDescriptorBus::EventResult(descriptor, component->RTTI_GetType(), &ComponentDescriptorBus::Events::GetDescriptor);
+            return descriptor && descriptor->IsInitThreadSafe();
+        }
+    } // namespace EntityInternal
+
     class SerializeEntityFactory
         : public SerializeContext::IObjectFactory
     {
@@ -95,6 +105,7 @@ namespace AZ
         , m_state(State::Constructed)
         , m_isDependencyReady(false)
         , m_isRuntimeActiveByDefault(true)
+        , m_areThreadSafeComponentsInitialized(false)
     {
     }
 
@@ -178,7 +189,10 @@ namespace AZ
             if (component)
             {
                 component->SetEntity(this);
-                component->Init();
+                if (!m_areThreadSafeComponentsInitialized || !EntityInternal::IsComponentInitThreadSafe(component))
+                {
+                    component->Init();
+                }
                 ++it;
             }
             else
@@ -186,6 +200,7 @@ namespace AZ
                 it = m_components.erase(it);
             }
         }
+        m_areThreadSafeComponentsInitialized = false;
 
         SetState(State::Init);
 
@@ -193,6 +208,25 @@ namespace AZ
         EntitySystemBus::Broadcast(&EntitySystemBus::Events::OnEntityInitialized, m_id);
     }
 
+    void Entity::InitThreadSafeComponents()
+    {
+        AZ_Assert(m_state == State::Constructed, "Entity should be in Constructed state to initialize its thread safe components!");
+        if (m_state != State::Constructed || m_areThreadSafeComponentsInitialized)
+        {
+            return;
+        }
+
+        for (Component* component : m_components)
+        {
+            if (component && EntityInternal::IsComponentInitThreadSafe(component))
+            {
+                component->SetEntity(this);
+                component->Init();
+                m_areThreadSafeComponentsInitialized = true;
+            }
+        }
+    }
+
     void Entity::Activate()
     {
         AZ_PROFILE_FUNCTION(AzCore);
@@ -345,7 +379,8 @@ namespace AZ
 
         m_components.push_back(component);
 
-        if (m_state == State::Init)
+        if (m_state == State::Init ||
+            (m_areThreadSafeComponentsInitialized && EntityInternal::IsComponentInitThreadSafe(component)))
         {
             component->Init();
         }
@@ -159,6 +159,12 @@ namespace AZ
         //! to each component.
         virtual void Init();
 
+        //! Initializes the components whose descriptor reports that their Init is thread safe, see
+        //! ComponentDescriptor::IsInitThreadSafe. This can run on any thread while the entity is in the Constructed state and nothing
+        //! else accesses it, so the thread safe components of many entities can be initialized in parallel. Init() initializes the
+        //! remaining components afterwards, and thread safe components that are added in between are initialized when they're added.
+        void InitThreadSafeComponents();
+
         //! Activates the entity and its components.
         //! This function can be called multiple times throughout the lifetime of an 
         //! entity. Before activating the components, this function verifies that all 
@@ -430,6 +436,7 @@ namespace AZ
         //! such as AZStd::bit_set<>. With just a couple flags, AZStd::bit_set's word-size of 32-bits will actually waste space.
         bool m_isDependencyReady;           ///< Indicates the component dependencies have been evaluated and sorting was completed successfully.
         bool m_isRuntimeActiveByDefault;    ///< Indicates the entity should be activated on initial creation.
+        bool m_areThreadSafeComponentsInitialized; ///< Indicates InitThreadSafeComponents initialized at least one component.
     };
 
     template<class ComponentType, typename... Args>
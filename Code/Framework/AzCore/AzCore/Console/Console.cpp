@@ -215,10 +215,7 @@ namespace AZ
 
     ConsoleFunctorBase* Console::FindCommand(AZStd::string_view command, ConsoleFunctorFlags ignoreAnyFlags)
     {
-        CVarFixedString lowerName(command);
-        AZStd::to_lower(lowerName.begin(), lowerName.end());
-
-        CommandMap::iterator iter = m_commands.find(lowerName);
+        CommandMap::iterator iter = m_commands.find(command);
         if (iter != m_commands.end())
         {
             for (ConsoleFunctorBase* curr : iter->second)
@@ -317,9 +314,8 @@ namespace AZ
             return;
         }
 
-        CVarFixedString lowerName = functor->GetName();
-        AZStd::to_lower(lowerName.begin(), lowerName.end());
-        CommandMap::iterator iter = m_commands.find(lowerName);
+        const AZStd::string_view name = functor->GetName();
+        CommandMap::iterator iter = m_commands.find(name);
         if (iter != m_commands.end())
         {
             // Validate we haven't already added this cvar
@@ -347,7 +343,11 @@ namespace AZ
                 }
             }
         }
-        m_commands[lowerName].emplace_back(functor);
+        if (iter == m_commands.end())
+        {
+            iter = m_commands.emplace(CVarFixedString(name), AZStd::vector<ConsoleFunctorBase*>{}).first;
+        }
+        iter->second.emplace_back(functor);
         functor->Link(m_head);
         functor->m_console = this;
     }
@@ -360,9 +360,7 @@ namespace AZ
             return;
         }
 
-        CVarFixedString lowerName = functor->GetName();
-        AZStd::to_lower(lowerName.begin(), lowerName.end());
-        CommandMap::iterator iter = m_commands.find(lowerName);
+        CommandMap::iterator iter = m_commands.find(AZStd::string_view(functor->GetName()));
         if (iter != m_commands.end())
         {
             AZStd::vector<ConsoleFunctorBase*>::iterator iter2 = AZStd::find(iter->second.begin(), iter->second.end(), functor);
@@ -441,10 +439,7 @@ namespace AZ
         bool result = false;
         ConsoleFunctorFlags flags = ConsoleFunctorFlags::Null;
 
-        CVarFixedString lowerName(command);
-        AZStd::to_lower(lowerName.begin(), lowerName.end());
-
-        CommandMap::iterator iter = m_commands.find(lowerName);
+        CommandMap::iterator iter = m_commands.find(command);
         if (iter != m_commands.end())
         {
             for (ConsoleFunctorBase* curr : iter->second)
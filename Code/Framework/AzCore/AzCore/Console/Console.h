@@ -74,8 +74,56 @@ namespace AZ
         void RegisterCommandInvokerWithSettingsRegistry(AZ::SettingsRegistryInterface& settingsRegistry) override;
         //! @}
 
+        //! Hashes a command name the way the console compares command names, which ignores the case of ASCII letters.
+        //! Commands are looked up with this hash directly from the name, without making a lowercase copy of it first.
+        static constexpr size_t HashCommandName(AZStd::string_view name)
+        {
+            // 64-bit FNV-1a
+            AZ::u64 hash = 14695981039346656037ull;
+            for (char element : name)
+            {
+                hash ^= static_cast<AZ::u8>(ToLowerAscii(element));
+                hash *= 1099511628211ull;
+            }
+            return static_cast<size_t>(hash);
+        }
+
     private:
 
+        static constexpr char ToLowerAscii(char element)
+        {
+            return (element >= 'A' && element <= 'Z') ? static_cast<char>(element - 'A' + 'a') : element;
+        }
+
+        //! Transparent hash and equality of command names, so the command map can be searched with a string_view.
+        struct CommandNameHash
+        {
+            using is_transparent = void;
+            size_t operator()(AZStd::string_view name) const
+            {
+                return HashCommandName(name);
+            }
+        };
+        struct CommandNameEqual
+        {
+            using is_transparent = void;
+            bool operator()(AZStd::string_view lhs, AZStd::string_view rhs) const
+            {
+                if (lhs.size() != rhs.size())
+                {
+                    return false;
+                }
+                for (size_t index = 0; index < lhs.size(); ++index)
+                {
+                    if (ToLowerAscii(lhs[index]) != ToLowerAscii(rhs[index]))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+        };
+
         void MoveFunctorsToDeferredHead(ConsoleFunctorBase*& deferredHead);
 
         //! Invokes a single console command, optionally returning the command output.
@@ -99,7 +147,7 @@ namespace AZ
         AZ_DISABLE_COPY_MOVE(Console);
 
         ConsoleFunctorBase* m_head;
-        using CommandMap = AZStd::unordered_map<CVarFixedString, AZStd::vector<ConsoleFunctorBase*>>;
+        using CommandMap = AZStd::unordered_map<CVarFixedString, AZStd::vector<ConsoleFunctorBase*>, CommandNameHash, CommandNameEqual>;
         CommandMap m_commands;
         AZ::SettingsRegistryInterface::NotifyEventHandler m_consoleCommandKeyHandler;
         struct DeferredCommand
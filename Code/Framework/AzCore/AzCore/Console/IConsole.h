@@ -206,7 +206,7 @@ template <typename _TYPE, typename = void>
 static constexpr AZ::ThreadSafety ConsoleThreadSafety = AZ::ThreadSafety::RequiresLock;
 
 template <typename _TYPE>
-static constexpr AZ::ThreadSafety ConsoleThreadSafety<_TYPE, std::enable_if_t<std::is_arithmetic_v<_TYPE>>> = AZ::ThreadSafety::UseStdAtomic;
+static constexpr AZ::ThreadSafety ConsoleThreadSafety<_TYPE, std::enable_if_t<std::is_arithmetic_v<_TYPE> || std::is_enum_v<_TYPE>>> = AZ::ThreadSafety::UseStdAtomic;
 
 //! Standard cvar macro.
 //! @param _TYPE the data type of the cvar
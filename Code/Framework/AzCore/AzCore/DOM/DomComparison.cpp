@@ -46,12 +46,14 @@ namespace AZ::Dom
         {
             desiredKeys.clear();
             Path subPath = path;
+            const Object::ContainerType& beforeMembers = before.GetObject();
             for (auto it = after.MemberBegin(); it != after.MemberEnd(); ++it)
             {
                 desiredKeys.insert(it->first.GetHash());
                 subPath.Push(it->first);
-                auto beforeIt = before.FindMember(it->first);
-                if (beforeIt == before.MemberEnd())
+                // Most edits leave the member order alone, so check the member at the same position before searching
+                auto beforeIt = Utils::FindMemberWithHint(beforeMembers, it->first, static_cast<size_t>(it - after.MemberBegin()));
+                if (beforeIt == beforeMembers.end())
                 {
                     AddPatch(PatchOperation::AddOperation(subPath, it->second), PatchOperation::RemoveOperation(subPath));
                 }
@@ -225,6 +225,20 @@ namespace AZ::Dom::Utils
         return result;
     }
 
+    Object::ConstIterator FindMemberWithHint(const Object::ContainerType& container, const KeyType& key, size_t indexHint)
+    {
+        if (indexHint < container.size() && container[indexHint].first == key)
+        {
+            return container.begin() + indexHint;
+        }
+        return AZStd::find_if(
+            container.begin(), container.end(),
+            [&key](const Object::EntryType& entry)
+            {
+                return entry.first == key;
+            });
+    }
+
     bool DeepCompareIsEqual(const Value& lhs, const Value& rhs, const ComparisonParameters& parameters)
     {
         const Value::ValueType& lhsValue = lhs.GetInternalValue();
@@ -268,8 +282,8 @@ namespace AZ::Dom::Utils
                     for (size_t i = 0; i < ourValues.size(); ++i)
                     {
                         const Object::EntryType& lhsChild = ourValues[i];
-                        auto rhsIt = rhs.FindMember(lhsChild.first);
-                        if (rhsIt == rhs.MemberEnd() || !DeepCompareIsEqual(lhsChild.second, rhsIt->second, parameters))
+                        auto rhsIt = FindMemberWithHint(theirValues, lhsChild.first, i);
+                        if (rhsIt == theirValues.end() || !DeepCompareIsEqual(lhsChild.second, rhsIt->second, parameters))
                         {
                             return false;
                         }
@@ -335,8 +349,8 @@ namespace AZ::Dom::Utils
                     for (size_t i = 0; i < ourProperties.size(); ++i)
                     {
                         const Object::EntryType& lhsChild = ourProperties[i];
-                        auto rhsIt = rhs.FindMember(lhsChild.first);
-                        if (rhsIt == rhs.MemberEnd() || !DeepCompareIsEqual(lhsChild.second, rhsIt->second, parameters))
+                        auto rhsIt = FindMemberWithHint(theirProperties, lhsChild.first, i);
+                        if (rhsIt == theirProperties.end() || !DeepCompareIsEqual(lhsChild.second, rhsIt->second, parameters))
                         {
                             return false;
                         }
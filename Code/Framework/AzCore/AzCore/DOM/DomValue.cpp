@@ -68,6 +68,195 @@ namespace AZ::Dom
         return Internal::ExtractTypeArgs<Value::ValueType>::GetTypeIndex<T>();
     }
 
+    namespace Internal
+    {
+        static thread_local ValueArena* s_currentArena = nullptr;
+    } // namespace Internal
+
+    struct ValueArena::Block
+    {
+        Block* m_next;
+        size_t m_size;
+
+        char* GetData()
+        {
+            return reinterpret_cast<char*>(this + 1);
+        }
+    };
+
+    ValueArena::ValueArena(size_t blockSize)
+        : m_blockSize(AZStd::max(blockSize, sizeof(Block) * 2))
+    {
+    }
+
+    ValueArena::~ValueArena()
+    {
+        while (m_blocks)
+        {
+            Block* next = m_blocks->m_next;
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().deallocate(m_blocks, sizeof(Block) + m_blocks->m_size, alignof(Block));
+            m_blocks = next;
+        }
+    }
+
+    void* ValueArena::Allocate(size_t byteSize, size_t alignment)
+    {
+        alignment = AZStd::max<size_t>(alignment, 1);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        char* result = reinterpret_cast<char*>(AZ::PointerAlignUp(m_current, alignment));
+        if (m_current == nullptr || result + byteSize > m_end)
+        {
+            // Large allocations get a block of their own so they don't waste the remainder of the current block
+            const bool dedicatedBlock = byteSize > m_blockSize / 2;
+            const size_t dataSize = dedicatedBlock ? byteSize + alignment : m_blockSize;
+            Block* block = reinterpret_cast<Block*>(
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Get().allocate(sizeof(Block) + dataSize, alignof(Block)));
+            block->m_next = m_blocks;
+            block->m_size = dataSize;
+            m_blocks = block;
+            m_reservedBytes += dataSize;
+
+            result = reinterpret_cast<char*>(AZ::PointerAlignUp(block->GetData(), alignment));
+            if (dedicatedBlock)
+            {
+                return result;
+            }
+            m_end = block->GetData() + dataSize;
+        }
+
+        m_current = result + byteSize;
+        m_lastAllocation = result;
+        return result;
+    }
+
+    void ValueArena::Deallocate(void* ptr, [[maybe_unused]] size_t byteSize)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (ptr != nullptr && ptr == m_lastAllocation)
+        {
+            m_current = m_lastAllocation;
+            m_lastAllocation = nullptr;
+        }
+    }
+
+    size_t ValueArena::GetReservedBytes() const
+    {
+        return m_reservedBytes;
+    }
+
+    StdValueAllocator::StdValueAllocator()
+        : m_arena(Internal::s_currentArena)
+    {
+    }
+
+    StdValueAllocator::StdValueAllocator(ValueArenaPtr arena)
+        : m_arena(AZStd::move(arena))
+    {
+    }
+
+    StdValueAllocator::StdValueAllocator(const StdValueAllocator& other)
+        : m_arena(other.m_arena)
+    {
+    }
+
+    // Moves leave the source with its arena, since containers may keep deallocating through a moved from allocator
+    StdValueAllocator::StdValueAllocator(StdValueAllocator&& other)
+        : m_arena(other.m_arena)
+    {
+    }
+
+    StdValueAllocator& StdValueAllocator::operator=(const StdValueAllocator& other)
+    {
+        m_arena = other.m_arena;
+        return *this;
+    }
+
+    StdValueAllocator& StdValueAllocator::operator=(StdValueAllocator&& other)
+    {
+        m_arena = other.m_arena;
+        return *this;
+    }
+
+    auto StdValueAllocator::allocate(size_type byteSize, align_type alignment) -> pointer
+    {
+        if (m_arena)
+        {
+            return m_arena->Allocate(byteSize, alignment);
+        }
+        return AZ::AllocatorInstance<AZ::SystemAllocator>::Get().allocate(byteSize, alignment);
+    }
+
+    void StdValueAllocator::deallocate(pointer ptr, size_type byteSize, align_type alignment)
+    {
+        if (m_arena)
+        {
+            m_arena->Deallocate(ptr, byteSize);
+            return;
+        }
+        AZ::AllocatorInstance<AZ::SystemAllocator>::Get().deallocate(ptr, byteSize, alignment);
+    }
+
+    auto StdValueAllocator::reallocate(pointer ptr, size_type newSize, align_type alignment) -> pointer
+    {
+        if (m_arena)
+        {
+            // Arena allocations don't know their size, so they can't be moved. Only used to detect support, as the AZStd
+            // containers allocate and copy when they grow.
+            return ptr == nullptr ? m_arena->Allocate(newSize, alignment) : nullptr;
+        }
+        return AZ::AllocatorInstance<AZ::SystemAllocator>::Get().reallocate(ptr, newSize, alignment);
+    }
+
+    auto StdValueAllocator::get_allocated_size(pointer ptr, align_type alignment) const -> size_type
+    {
+        return m_arena ? 0 : AZ::AllocatorInstance<AZ::SystemAllocator>::Get().get_allocated_size(ptr, alignment);
+    }
+
+    ValueArena* StdValueAllocator::GetArena() const
+    {
+        return m_arena.get();
+    }
+
+    bool operator==(const StdValueAllocator& lhs, const StdValueAllocator& rhs)
+    {
+        return lhs.GetArena() == rhs.GetArena();
+    }
+
+    bool operator!=(const StdValueAllocator& lhs, const StdValueAllocator& rhs)
+    {
+        return lhs.GetArena() != rhs.GetArena();
+    }
+
+    ValueArenaScope::ValueArenaScope(size_t blockSize)
+        : ValueArenaScope(aznew ValueArena(blockSize))
+    {
+    }
+
+    ValueArenaScope::ValueArenaScope(ValueArenaPtr arena)
+        : m_arena(AZStd::move(arena))
+        , m_previousArena(Internal::s_currentArena)
+    {
+        AZ_Assert(m_arena, "ValueArenaScope requires an arena");
+        Internal::s_currentArena = m_arena.get();
+    }
+
+    ValueArenaScope::~ValueArenaScope()
+    {
+        AZ_Assert(Internal::s_currentArena == m_arena.get(), "ValueArenaScopes must be destroyed in the reverse order of their creation");
+        Internal::s_currentArena = m_previousArena;
+    }
+
+    ValueArena& ValueArenaScope::GetArena() const
+    {
+        return *m_arena;
+    }
+
+    ValueArena* ValueArenaScope::GetCurrentArena()
+    {
+        return Internal::s_currentArena;
+    }
+
     const Array::ContainerType& Array::GetValues() const
     {
         return m_values;
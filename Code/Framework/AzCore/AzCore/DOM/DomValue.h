@@ -19,6 +19,10 @@
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/intrusive_ptr.h>
+#include <AzCore/std/smart_ptr/intrusive_refcount.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/utility/to_underlying.h>
 
@@ -47,7 +51,92 @@ namespace AZ::Dom
     //! Value heap allocates shared_ptrs for its container storage (Array / Object / Node) alongside
     AZ_ALLOCATOR_DEFAULT_GLOBAL_WRAPPER(ValueAllocator, AZ::SystemAllocator, "{5BC8B389-72C7-459E-B502-12E74D61869F}")
 
-    using StdValueAllocator = ValueAllocator;
+    //! A memory arena that the containers of a whole document can be allocated from, see ValueArenaScope.
+    //! Memory is handed out from large blocks and is only returned when the arena is destroyed, which happens once no
+    //! allocator referencing it is left. Only the most recent allocation is given back on deallocation, which lets
+    //! a container that is being filled reuse its previous storage.
+    class ValueArena final : public AZStd::intrusive_refcount<AZStd::atomic_uint>
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ValueArena, ValueAllocator);
+
+        static constexpr size_t DefaultBlockSize = 64 * 1024;
+
+        explicit ValueArena(size_t blockSize = DefaultBlockSize);
+        ~ValueArena() override;
+
+        void* Allocate(size_t byteSize, size_t alignment);
+        void Deallocate(void* ptr, size_t byteSize);
+
+        //! Returns the size of all the blocks that were allocated for the arena.
+        size_t GetReservedBytes() const;
+
+    private:
+        struct Block;
+
+        AZStd::mutex m_mutex; //!< Values that share storage with the document can grow its containers from other threads.
+        Block* m_blocks = nullptr;
+        char* m_current = nullptr;
+        char* m_end = nullptr;
+        char* m_lastAllocation = nullptr;
+        size_t m_blockSize;
+        size_t m_reservedBytes = 0;
+    };
+
+    using ValueArenaPtr = AZStd::intrusive_ptr<ValueArena>;
+
+    //! The allocator for the container storage of Value.
+    //! A default constructed allocator allocates from the ValueArena of the thread's current ValueArenaScope, or from
+    //! ValueAllocator when there's no arena. Copies of the allocator keep their arena, so the storage of a container
+    //! stays valid when it outlives the scope.
+    class StdValueAllocator : public IAllocator
+    {
+    public:
+        StdValueAllocator();
+        explicit StdValueAllocator(ValueArenaPtr arena);
+        StdValueAllocator(const StdValueAllocator& other);
+        StdValueAllocator(StdValueAllocator&& other);
+        StdValueAllocator& operator=(const StdValueAllocator& other);
+        StdValueAllocator& operator=(StdValueAllocator&& other);
+        ~StdValueAllocator() override = default;
+
+        pointer allocate(size_type byteSize, align_type alignment = 1) override;
+        void deallocate(pointer ptr, size_type byteSize = 0, align_type alignment = 0) override;
+        pointer reallocate(pointer ptr, size_type newSize, align_type alignment = 1) override;
+        size_type get_allocated_size(pointer ptr, align_type alignment = 1) const override;
+
+        //! Returns the arena this allocator allocates from, nullptr if it uses ValueAllocator.
+        ValueArena* GetArena() const;
+
+    private:
+        ValueArenaPtr m_arena;
+    };
+
+    bool operator==(const StdValueAllocator& lhs, const StdValueAllocator& rhs);
+    bool operator!=(const StdValueAllocator& lhs, const StdValueAllocator& rhs);
+
+    //! While a ValueArenaScope is alive, the containers of Values created on the same thread are allocated from its arena,
+    //! along with the reference counts of shared strings. This is meant for building or loading a whole document, whose storage is then released at once when
+    //! the last Value using it is destroyed instead of container by container. Scopes can be nested.
+    //! \note Memory that is freed within an arena is not reused, so documents that keep changing after they were built
+    //! should be created without an arena.
+    class ValueArenaScope final
+    {
+    public:
+        explicit ValueArenaScope(size_t blockSize = ValueArena::DefaultBlockSize);
+        explicit ValueArenaScope(ValueArenaPtr arena);
+        ~ValueArenaScope();
+        AZ_DISABLE_COPY_MOVE(ValueArenaScope);
+
+        ValueArena& GetArena() const;
+
+        //! Returns the arena of the innermost scope on this thread, nullptr if there is none.
+        static ValueArena* GetCurrentArena();
+
+    private:
+        ValueArenaPtr m_arena;
+        ValueArena* m_previousArena;
+    };
 
     class Value;
 
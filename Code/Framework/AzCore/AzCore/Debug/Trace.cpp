@@ -11,6 +11,7 @@
 #include <AzCore/base.h>
 
 #include <AzCore/Debug/StackTracer.h>
+#include <AzCore/Debug/TraceAsyncOutput.h>
 #include <AzCore/Debug/TraceMessageBus.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Settings/SettingsRegistry.h>
@@ -120,6 +121,20 @@ namespace AZ::Debug
         " Defaults to the stdout FILE stream."
         " Valid values are 0 = stdout, 1 = stderr, 2 = redirect to NUL");
 
+    // Warnings and printfs can be dispatched on a background thread, see TraceAsyncOutput
+    static void DispatchAsyncMessage(
+        TraceAsyncOutput::MessageType type, const char* fileName, int line, const char* funcName, const char* window, char* message);
+    static TraceAsyncOutput s_asyncOutput(&DispatchAsyncMessage);
+
+    static void AsyncOutputChanged(const bool& enable)
+    {
+        Debug::ITrace::Instance().SetAsyncOutputEnabled(enable);
+    }
+
+    AZ_CVAR_SCOPED(bool, bg_traceAsyncOutput, false, &AsyncOutputChanged, ConsoleFunctorFlags::Null,
+        "Dispatch trace warnings and printfs to the trace listeners on a background thread, so the threads emitting them don't wait on the output."
+        " Errors and asserts are still dispatched on the emitting thread, after the messages queued before them."
+        " Repeated messages are rate limited by bg_traceAsyncRepeatLimit.");
 
     /**
      * If any listener returns true, store the result so we don't outputs detailed information.
@@ -176,11 +191,22 @@ namespace AZ::Debug
 
             AZ::Environment::CreateVariable<FILE*>(fileStreamIdentifier, redirectStream);
         }
+
+        if (auto console = AZ::Interface<AZ::IConsole>::Get(); console != nullptr)
+        {
+            if (bool asyncOutput = false;
+                console->GetCvarValue("bg_traceAsyncOutput", asyncOutput) == AZ::GetValueResult::Success)
+            {
+                SetAsyncOutputEnabled(asyncOutput);
+            }
+        }
     }
 
     // clean up the ignored assert container
     void Trace::Destroy()
     {
+        s_asyncOutput.Stop();
+
         g_ignoredAsserts = AZ::Environment::FindVariable<AZStd::unordered_set<size_t>>(ignoredAssertUID);
         if (g_ignoredAsserts)
         {
@@ -191,6 +217,29 @@ namespace AZ::Debug
         }
     }
 
+    //=========================================================================
+    Trace::~Trace()
+    {
+        s_asyncOutput.Stop();
+    }
+
+    void Trace::SetAsyncOutputEnabled(bool enable)
+    {
+        if (enable)
+        {
+            s_asyncOutput.Start();
+        }
+        else
+        {
+            s_asyncOutput.Stop();
+        }
+    }
+
+    void Trace::FlushAsyncOutput()
+    {
+        s_asyncOutput.Flush();
+    }
+
     //=========================================================================
     const char* Trace::GetDefaultSystemWindow()
     {
@@ -330,6 +379,9 @@ namespace AZ::Debug
 
         g_alreadyHandlingAssertOrFatal = true;
 
+        // Output the messages that are queued for asynchronous output first, as they likely lead up to the assert
+        s_asyncOutput.Flush();
+
         va_list mark;
         va_start(mark, format);
         azvsnprintf(message, g_maxMessageLength - 1, format, mark); // -1 to make room for the "/n" that will be appended below
@@ -463,6 +515,9 @@ namespace AZ::Debug
         }
         g_alreadyHandlingAssertOrFatal = true;
 
+        // Output the messages that are queued for asynchronous output first, as they likely lead up to the error
+        s_asyncOutput.Flush();
+
         va_list mark;
         va_start(mark, format);
         azvsnprintf(message, g_maxMessageLength - 1, format, mark); // -1 to make room for the "/n" that will be appended below
@@ -504,13 +559,24 @@ namespace AZ::Debug
         }
 
         char message[g_maxMessageLength];
-        char header[g_maxMessageLength];
 
         va_list mark;
         va_start(mark, format);
         azvsnprintf(message, g_maxMessageLength - 1, format, mark); // -1 to make room for the "/n" that will be appended below
         va_end(mark);
 
+        if (s_asyncOutput.Enqueue(TraceAsyncOutput::MessageType::Warning, fileName, line, funcName, window, message))
+        {
+            return;
+        }
+
+        DispatchWarning(fileName, line, funcName, window, message);
+    }
+
+    void Trace::DispatchWarning(const char* fileName, int line, const char* funcName, const char* window, char* message)
+    {
+        char header[g_maxMessageLength];
+
         TraceMessageResult result;
         TraceMessageBus::BroadcastResult(result, &TraceMessageBus::Events::OnPreWarning, window, fileName, line, funcName, message);
         if (result.m_value)
@@ -518,14 +584,14 @@ namespace AZ::Debug
             return;
         }
 
-        Output(window, "\n==================================================================\n");
+        Instance().Output(window, "\n==================================================================\n");
         azsnprintf(header, g_maxMessageLength, "Trace::Warning\n %s(%d): '%s'\n", fileName, line, funcName);
-        Output(window, header);
-        azstrcat(message, g_maxMessageLength, "\n");
-        Output(window, message);
+        Instance().Output(window, header);
+        azstrcat(message, strlen(message) + 2, "\n");
+        Instance().Output(window, message);
 
         TraceMessageBus::BroadcastResult(result, &TraceMessageBus::Events::OnWarning, window, message);
-        Output(window, "==================================================================\n");
+        Instance().Output(window, "==================================================================\n");
     }
 
     //=========================================================================
@@ -546,6 +612,16 @@ namespace AZ::Debug
         azvsnprintf(message, g_maxMessageLength, format, mark);
         va_end(mark);
 
+        if (s_asyncOutput.Enqueue(TraceAsyncOutput::MessageType::Printf, nullptr, 0, nullptr, window, message))
+        {
+            return;
+        }
+
+        DispatchPrintf(window, message);
+    }
+
+    void Trace::DispatchPrintf(const char* window, const char* message)
+    {
         TraceMessageResult result;
         TraceMessageBus::BroadcastResult(result, &TraceMessageBus::Events::OnPrintf, window, message);
         if (result.m_value)
@@ -553,7 +629,20 @@ namespace AZ::Debug
             return;
         }
 
-        Output(window, message);
+        Instance().Output(window, message);
+    }
+
+    static void DispatchAsyncMessage(
+        TraceAsyncOutput::MessageType type, const char* fileName, int line, const char* funcName, const char* window, char* message)
+    {
+        if (type == TraceAsyncOutput::MessageType::Warning)
+        {
+            Trace::DispatchWarning(fileName, line, funcName, window, message);
+        }
+        else
+        {
+            Trace::DispatchPrintf(window, message);
+        }
     }
 
     //=========================================================================
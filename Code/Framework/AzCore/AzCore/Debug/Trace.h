@@ -127,6 +127,11 @@ namespace AZ
 
             virtual void PrintCallstack(const char* /*window*/, unsigned int /*suppressCount*/ = 0, void* /*nativeContext*/ = nullptr) {}
 
+            /// Dispatches warnings and printfs to the trace listeners on a background thread when enabled, see bg_traceAsyncOutput
+            virtual void SetAsyncOutputEnabled(bool /*enable*/) {}
+            /// Blocks until the warnings and printfs queued for asynchronous output have been dispatched
+            virtual void FlushAsyncOutput() {}
+
             // Catch the cases when an explicit nullptr has been passed in to the Trace window parameter
             // A valid c-string parameter must at least be passed in
             void Error(const char* fileName, int line, const char* funcName, std::nullptr_t window, const char* format, ...) = delete;
@@ -149,6 +154,8 @@ namespace AZ
         {
         public:
             // Declare Trace init for assert tracking initializations, and get/setters for verbosity level
+            ~Trace() override;
+
             void Init() override;
             void Destroy() override;
             static int GetAssertVerbosityLevel();
@@ -192,8 +199,16 @@ namespace AZ
 
             void PrintCallstack(const char* window, unsigned int suppressCount = 0, void* nativeContext = nullptr) override;
 
+            void SetAsyncOutputEnabled(bool enable) override;
+            void FlushAsyncOutput() override;
+
             /// PEXCEPTION_POINTERS on Windows, always NULL on other platforms
             static void* GetNativeExceptionInfo();
+
+            /// Sends a formatted warning to the trace listeners and the output, the message must have room to append a newline
+            static void DispatchWarning(const char* fileName, int line, const char* funcName, const char* window, char* message);
+            /// Sends a formatted printf to the trace listeners and the output
+            static void DispatchPrintf(const char* window, const char* message);
         };
     }
 }
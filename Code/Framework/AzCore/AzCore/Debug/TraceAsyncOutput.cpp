@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/TraceAsyncOutput.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ::Debug
+{
+    AZ_CVAR(int, bg_traceAsyncRepeatLimit, 20, nullptr, ConsoleFunctorFlags::Null,
+        "The number of times the same message is output per second when trace output is asynchronous, further repeats are only counted."
+        " 0 disables the limit.");
+    AZ_CVAR(int, bg_traceAsyncMaxPending, 16384, nullptr, ConsoleFunctorFlags::Null,
+        "The maximum number of messages waiting to be output when trace output is asynchronous, further messages are dropped.");
+
+    // All strings are stored after the record in a single allocation
+    struct TraceAsyncOutput::Record
+    {
+        Record* m_next{};
+        size_t m_allocationSize{};
+        const char* m_fileName{};
+        const char* m_funcName{};
+        const char* m_window{};
+        char* m_message{};
+        int m_line{};
+        MessageType m_type{};
+    };
+
+    namespace TraceAsyncOutputInternal
+    {
+        constexpr auto RepeatPeriod = AZStd::chrono::seconds(1);
+        constexpr auto WakeInterval = AZStd::chrono::milliseconds(100);
+
+        struct RepeatState
+        {
+            AZStd::chrono::steady_clock::time_point m_periodStart;
+            AZ::u32 m_count{};
+            AZ::u32 m_suppressedCount{};
+            char m_window[64]{};
+            char m_preview[128]{}; //!< The start of the message, to tell which message was suppressed
+        };
+        using RepeatMap = AZStd::unordered_map<size_t, RepeatState, AZStd::hash<size_t>, AZStd::equal_to<size_t>, AZ::OSStdAllocator>;
+
+        static char* CopyString(char*& storage, AZStd::string_view source, size_t extraCapacity = 0)
+        {
+            char* destination = storage;
+            memcpy(destination, source.data(), source.size());
+            destination[source.size()] = '\0';
+            storage += source.size() + 1 + extraCapacity;
+            return destination;
+        }
+    } // namespace TraceAsyncOutputInternal
+
+    TraceAsyncOutput::TraceAsyncOutput(DispatchFunction dispatchFunction)
+        : m_dispatchFunction(dispatchFunction)
+    {
+    }
+
+    TraceAsyncOutput::~TraceAsyncOutput()
+    {
+        Stop();
+    }
+
+    void TraceAsyncOutput::Start()
+    {
+        AZStd::scoped_lock lock(m_controlMutex);
+        if (m_running)
+        {
+            return;
+        }
+
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "TraceAsyncOutput";
+        m_thread = AZStd::thread(threadDesc, [this]() { Run(); });
+        m_writerThreadId = m_thread.get_id();
+        m_running = true;
+    }
+
+    void TraceAsyncOutput::Stop()
+    {
+        AZStd::scoped_lock lock(m_controlMutex);
+        if (!m_running.exchange(false))
+        {
+            return;
+        }
+
+        // Threads that saw the writer running before it was stopped may still be pushing a record
+        while (m_activeProducers.load() != 0)
+        {
+            AZStd::this_thread::yield();
+        }
+
+        // The writer dispatches everything that's pending before it exits
+        m_stopRequested = true;
+        m_wakeEvent.release();
+        m_thread.join();
+        m_stopRequested = false;
+    }
+
+    bool TraceAsyncOutput::IsRunning() const
+    {
+        return m_running;
+    }
+
+    bool TraceAsyncOutput::Enqueue(
+        MessageType type, const char* fileName, int line, const char* funcName, const char* window, const char* message)
+    {
+        m_activeProducers.fetch_add(1);
+        if (!m_running || AZStd::this_thread::get_id() == m_writerThreadId)
+        {
+            m_activeProducers.fetch_sub(1);
+            return false;
+        }
+
+        if (const int maxPending = bg_traceAsyncMaxPending;
+            maxPending > 0 && m_enqueuedCount.load() - m_dispatchedCount.load() >= static_cast<AZ::u64>(maxPending))
+        {
+            m_droppedCount.fetch_add(1);
+            m_activeProducers.fetch_sub(1);
+            return true;
+        }
+
+        const AZStd::string_view fileNameView = fileName ? fileName : "";
+        const AZStd::string_view funcNameView = funcName ? funcName : "";
+        const AZStd::string_view windowView = window;
+        const AZStd::string_view messageView = message;
+        // Leave room in the message for the newline the dispatch function appends
+        const size_t allocationSize =
+            sizeof(Record) + fileNameView.size() + funcNameView.size() + windowView.size() + messageView.size() + 5;
+
+        void* allocation = AZ::AllocatorInstance<AZ::OSAllocator>::Get().allocate(allocationSize, alignof(Record));
+        Record* record = new (allocation) Record;
+        record->m_allocationSize = allocationSize;
+        record->m_line = line;
+        record->m_type = type;
+
+        char* storage = reinterpret_cast<char*>(record + 1);
+        record->m_fileName = TraceAsyncOutputInternal::CopyString(storage, fileNameView);
+        record->m_funcName = TraceAsyncOutputInternal::CopyString(storage, funcNameView);
+        record->m_window = TraceAsyncOutputInternal::CopyString(storage, windowView);
+        record->m_message = TraceAsyncOutputInternal::CopyString(storage, messageView, 1);
+
+        m_enqueuedCount.fetch_add(1);
+        Record* head = m_pendingHead.load(AZStd::memory_order_relaxed);
+        do
+        {
+            record->m_next = head;
+        } while (!m_pendingHead.compare_exchange_weak(head, record, AZStd::memory_order_release, AZStd::memory_order_relaxed));
+
+        // Only wake the writer when the list was empty, it takes every record pushed since then at once
+        if (head == nullptr)
+        {
+            m_wakeEvent.release();
+        }
+
+        m_activeProducers.fetch_sub(1);
+        return true;
+    }
+
+    void TraceAsyncOutput::Flush()
+    {
+        if (!m_running || AZStd::this_thread::get_id() == m_writerThreadId)
+        {
+            return;
+        }
+
+        const AZ::u64 enqueuedCount = m_enqueuedCount.load();
+        m_wakeEvent.release();
+        while (m_dispatchedCount.load() < enqueuedCount && m_running)
+        {
+            AZStd::this_thread::yield();
+        }
+    }
+
+    void TraceAsyncOutput::Run()
+    {
+        using namespace TraceAsyncOutputInternal;
+
+        RepeatMap repeats;
+        char summary[256];
+
+        for (bool stopping = false; !stopping;)
+        {
+            m_wakeEvent.try_acquire_for(WakeInterval);
+            stopping = m_stopRequested;
+
+            // Take every pending record at once and reverse the list so the records are dispatched in the order they were pushed
+            Record* records = nullptr;
+            for (Record* record = m_pendingHead.exchange(nullptr, AZStd::memory_order_acquire); record != nullptr;)
+            {
+                Record* next = record->m_next;
+                record->m_next = records;
+                records = record;
+                record = next;
+            }
+
+            const int repeatLimit = bg_traceAsyncRepeatLimit;
+            const auto now = AZStd::chrono::steady_clock::now();
+            while (records != nullptr)
+            {
+                Record* record = records;
+                records = record->m_next;
+
+                bool dispatch = true;
+                if (repeatLimit > 0)
+                {
+                    size_t key = AZStd::hash<AZStd::string_view>{}(record->m_message);
+                    AZStd::hash_combine(key, AZStd::string_view(record->m_window), AZStd::string_view(record->m_fileName), record->m_line);
+
+                    RepeatState& repeat = repeats[key];
+                    if (repeat.m_count == 0)
+                    {
+                        repeat.m_periodStart = now;
+                        azstrncpy(repeat.m_window, AZ_ARRAY_SIZE(repeat.m_window), record->m_window, AZ_ARRAY_SIZE(repeat.m_window) - 1);
+                        azstrncpy(repeat.m_preview, AZ_ARRAY_SIZE(repeat.m_preview), record->m_message, AZ_ARRAY_SIZE(repeat.m_preview) - 1);
+                        if (const size_t previewLength = strlen(repeat.m_preview);
+                            previewLength > 0 && repeat.m_preview[previewLength - 1] == '\n')
+                        {
+                            repeat.m_preview[previewLength - 1] = '\0';
+                        }
+                    }
+                    dispatch = ++repeat.m_count <= static_cast<AZ::u32>(repeatLimit);
+                    repeat.m_suppressedCount += dispatch ? 0 : 1;
+                }
+
+                if (dispatch)
+                {
+                    m_dispatchFunction(
+                        record->m_type, record->m_fileName, record->m_line, record->m_funcName, record->m_window, record->m_message);
+                }
+                FreeRecord(record);
+                m_dispatchedCount.fetch_add(1);
+            }
+
+            // Report the repeats that were suppressed once their period is over, and forget the messages that didn't repeat
+            for (auto repeatIt = repeats.begin(); repeatIt != repeats.end();)
+            {
+                RepeatState& repeat = repeatIt->second;
+                if (!stopping && now - repeat.m_periodStart < RepeatPeriod)
+                {
+                    ++repeatIt;
+                    continue;
+                }
+
+                if (repeat.m_suppressedCount > 0)
+                {
+                    azsnprintf(summary, AZ_ARRAY_SIZE(summary) - 1, "Suppressed %u repeats of \"%s\"\n", repeat.m_suppressedCount, repeat.m_preview);
+                    m_dispatchFunction(MessageType::Printf, "", 0, "", repeat.m_window, summary);
+                }
+                repeatIt = repeats.erase(repeatIt);
+            }
+
+            if (const AZ::u64 droppedCount = m_droppedCount.exchange(0); droppedCount > 0)
+            {
+                azsnprintf(summary, AZ_ARRAY_SIZE(summary) - 1, "Dropped %llu trace messages because more than bg_traceAsyncMaxPending were waiting\n",
+                    static_cast<unsigned long long>(droppedCount));
+                m_dispatchFunction(MessageType::Printf, "", 0, "", "", summary);
+            }
+        }
+    }
+
+    void TraceAsyncOutput::FreeRecord(Record* record)
+    {
+        const size_t allocationSize = record->m_allocationSize;
+        record->~Record();
+        AZ::AllocatorInstance<AZ::OSAllocator>::Get().deallocate(record, allocationSize, alignof(Record));
+    }
+} // namespace AZ::Debug
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ::Debug
+{
+    //! Dispatches trace warnings and printfs on a background thread, so the threads emitting them
+    //! don't wait on the TraceMessageBus listeners that write them to files and consoles.
+    //! Emitting a message copies it into a compact record that is pushed onto a lock-free list, the writer thread
+    //! takes the whole list at once and dispatches the records in the order they were pushed.
+    //! The writer thread also rate limits messages: repeats of the same message beyond bg_traceAsyncRepeatLimit
+    //! per second are counted instead of dispatched, and the count is reported once the second is over.
+    class TraceAsyncOutput
+    {
+    public:
+        enum class MessageType : AZ::u8
+        {
+            Warning,
+            Printf
+        };
+
+        //! Called on the writer thread for every message that passes the rate limit.
+        //! The message buffer has room to append a newline.
+        using DispatchFunction = void (*)(MessageType type, const char* fileName, int line, const char* funcName, const char* window, char* message);
+
+        explicit TraceAsyncOutput(DispatchFunction dispatchFunction);
+        ~TraceAsyncOutput();
+
+        TraceAsyncOutput(const TraceAsyncOutput&) = delete;
+        TraceAsyncOutput& operator=(const TraceAsyncOutput&) = delete;
+
+        //! Starts the writer thread.
+        void Start();
+        //! Dispatches the queued messages and stops the writer thread.
+        void Stop();
+
+        bool IsRunning() const;
+
+        //! Queues the message for the writer thread. This is safe to call from any thread.
+        //! @return false if the message wasn't queued and should be dispatched on the calling thread, which is
+        //! the case when the writer isn't running or when it's called from the writer thread (e.g. by a listener).
+        bool Enqueue(MessageType type, const char* fileName, int line, const char* funcName, const char* window, const char* message);
+
+        //! Blocks until every message queued before the call has been dispatched.
+        //! Used before dispatching errors and asserts on the calling thread, so they appear after the warnings that led to them.
+        void Flush();
+
+    private:
+        struct Record;
+
+        void Run();
+        void Dispatch(Record* records);
+        static void FreeRecord(Record* record);
+
+        DispatchFunction m_dispatchFunction;
+
+        AZStd::atomic<Record*> m_pendingHead{ nullptr }; //!< Lock-free list of records, the most recently pushed record first
+        AZStd::atomic<AZ::u64> m_enqueuedCount{ 0 };
+        AZStd::atomic<AZ::u64> m_dispatchedCount{ 0 };
+        AZStd::atomic<AZ::u64> m_droppedCount{ 0 }; //!< Messages that were dropped because too many were pending
+        AZStd::atomic<AZ::u32> m_activeProducers{ 0 }; //!< Threads inside Enqueue, Stop waits for them before stopping the writer
+        AZStd::atomic_bool m_running{ false };
+        AZStd::atomic_bool m_stopRequested{ false };
+
+        AZStd::binary_semaphore m_wakeEvent;
+        AZStd::mutex m_controlMutex; //!< Serializes Start and Stop
+        AZStd::thread m_thread;
+        AZStd::thread::id m_writerThreadId;
+    };
+} // namespace AZ::Debug
@@ -58,6 +58,8 @@ namespace AZ
         TickBus::Handler::BusDisconnect();
 
         // Clear all of these on Deactivate() so that they're properly deallocated before reaching the destructor.
+        m_timingWheel.Clear();
+        m_pendingQueue = {};
         m_ownedEvents.clear();
         m_freeEvents.clear();
         m_handles.clear();
@@ -69,16 +71,12 @@ namespace AZ
         TimeMs startTime = AZ::GetElapsedTimeMs();
         bool usingTimeslice = bg_maxScheduledEventProcessTimeMs != TimeMs{ 0 };
 
-        while (!m_queue.empty())
+        m_timingWheel.Advance(startTime, m_expiredHandles);
+        for (ScheduledEventHandle* handle : m_expiredHandles)
         {
-            ScheduledEventHandle* handle = m_queue.top();
-            if (handle->GetExecuteTimeMs() > startTime)
-            {
-                break;
-            }
-            m_queue.pop();
             m_pendingQueue.push(handle);
         }
+        m_expiredHandles.clear();
 
         while (!m_pendingQueue.empty())
         {
@@ -117,7 +115,7 @@ namespace AZ
         const bool ownsScheduledEvent = false;
         timedEvent->m_handle = new (timedEvent->m_handle) ScheduledEventHandle(TimeMs(currentMilliseconds + durationMs), durationMs, timedEvent, ownsScheduledEvent);
         timedEvent->m_timeInserted = currentMilliseconds;
-        m_queue.push(timedEvent->m_handle);
+        m_timingWheel.Insert(timedEvent->m_handle, currentMilliseconds);
         return timedEvent->m_handle;
     }
 
@@ -133,7 +131,7 @@ namespace AZ
         const bool ownsScheduledEvent = true;
         timedEvent->m_handle = new (timedEvent->m_handle) ScheduledEventHandle(TimeMs(currentMilliseconds + durationMs), durationMs, timedEvent, ownsScheduledEvent);
         timedEvent->m_timeInserted = currentMilliseconds;
-        m_queue.push(timedEvent->m_handle);
+        m_timingWheel.Insert(timedEvent->m_handle, currentMilliseconds);
     }
 
     AZStd::size_t EventSchedulerSystemComponent::GetHandleCount() const
@@ -148,7 +146,7 @@ namespace AZ
 
     AZStd::size_t EventSchedulerSystemComponent::GetQueueSize() const
     {
-        return m_queue.size();
+        return m_timingWheel.GetSize();
     }
 
     void EventSchedulerSystemComponent::DumpStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
@@ -13,22 +13,13 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/EBus/ScheduledEventHandle.h>
 #include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/EBus/ScheduledEventTimingWheel.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/queue.h>
 
 namespace AZ
 {
-    //! @struct CompareScheduledEventPtrs
-    //! Comparison of scheduled events to add in the priority queue.
-    struct CompareScheduledEventPtrs
-    {
-        bool operator() (const ScheduledEventHandle* lhs, const ScheduledEventHandle* rhs) const
-        {
-            return (*lhs) > (*rhs);
-        }
-    };
-
     //! @struct PrioritizeScheduledEventPtrs
     //! Prioritization operator for scheduled events to add in the priority queue.
     struct PrioritizeScheduledEventPtrs
@@ -96,8 +87,9 @@ namespace AZ
         // Bind the DumpStats member function to the console as 'EventSchedulerSystemComponent.DumpStats'
         AZ_CONSOLEFUNC(EventSchedulerSystemComponent, DumpStats, AZ::ConsoleFunctorFlags::Null, "Dump EventSchedulerSystemComponent stats to the console window");
 
-        // Priority queues of scheduled events sorted by execution time
-        AZStd::priority_queue<ScheduledEventHandle*, AZStd::vector<ScheduledEventHandle*>, CompareScheduledEventPtrs> m_queue;
+        // Scheduled events waiting for their execution time, and the events that are due sorted by priority
+        ScheduledEventTimingWheel m_timingWheel;
+        AZStd::vector<ScheduledEventHandle*> m_expiredHandles;
         AZStd::priority_queue<ScheduledEventHandle*, AZStd::vector<ScheduledEventHandle*>, PrioritizeScheduledEventPtrs> m_pendingQueue;
         AZStd::deque<ScheduledEvent> m_ownedEvents;
         AZStd::vector<ScheduledEvent*> m_freeEvents;
@@ -16,6 +16,7 @@
 // Includes for the event queue.
 #include <AzCore/std/functional.h>
 #include <AzCore/std/function/invoke.h>
+#include <AzCore/std/function/move_only_function.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/intrusive_set.h>
 #include <AzCore/std/parallel/scoped_lock.h>
@@ -236,7 +237,10 @@ namespace AZ
     template <class Bus, class MutexType>
     struct EBusQueuePolicy<true, Bus, MutexType>
     {
-        typedef AZStd::function<void()> BusMessageCall;
+        //! Queued calls are never copied, so they are stored in a move-only function that keeps the typical capture
+        //! (a member function pointer and a few arguments) inline, instead of allocating for every queued call.
+        static constexpr size_t QueuedCallInlineCapacity = 64;
+        typedef AZStd::move_only_function<void(), QueuedCallInlineCapacity, typename Bus::AllocatorType> BusMessageCall;
 
         typedef AZStd::deque<BusMessageCall, typename Bus::AllocatorType> DequeType;
         typedef AZStd::queue<BusMessageCall, DequeType > MessageQueueType;
@@ -262,7 +266,7 @@ namespace AZ
             // Execute the queue functions safely now that are owned by the function
             while (!localMessages.empty())
             {
-                const BusMessageCall& localMessage = localMessages.front();
+                BusMessageCall& localMessage = localMessages.front();
                 localMessage();
                 localMessages.pop();
             }
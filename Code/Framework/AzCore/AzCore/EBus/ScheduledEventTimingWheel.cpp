@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/EBus/ScheduledEventTimingWheel.h>
+#include <AzCore/EBus/ScheduledEventHandle.h>
+#include <AzCore/Math/MathIntrinsics.h>
+
+namespace AZ
+{
+    namespace
+    {
+        constexpr uint64_t SlotMask = ScheduledEventTimingWheel::SlotCount - 1;
+
+        uint64_t ToTick(TimeMs timeMs)
+        {
+            return timeMs > TimeMs{ 0 } ? aznumeric_cast<uint64_t>(static_cast<int64_t>(timeMs)) : 0;
+        }
+    }
+
+    void ScheduledEventTimingWheel::Insert(ScheduledEventHandle* handle, TimeMs currentTimeMs)
+    {
+        // With nothing scheduled there are no slots to keep in order, so skip the time that passed since the last handle expired
+        if (m_size == 0)
+        {
+            m_currentTick = AZStd::max(m_currentTick, ToTick(currentTimeMs));
+        }
+        Place(handle);
+    }
+
+    void ScheduledEventTimingWheel::Advance(TimeMs currentTimeMs, AZStd::vector<ScheduledEventHandle*>& expiredHandles)
+    {
+        // Handles scheduled for a time that has already been advanced past are the earliest ones
+        if (!m_dueHandles.empty())
+        {
+            expiredHandles.insert(expiredHandles.end(), m_dueHandles.begin(), m_dueHandles.end());
+            m_size -= m_dueHandles.size();
+            m_dueHandles.clear();
+        }
+
+        const uint64_t endTick = ToTick(currentTimeMs) + 1;
+        while (m_size > 0 && m_currentTick < endTick)
+        {
+            if ((m_currentTick & SlotMask) == 0)
+            {
+                // Entering a new revolution of the first level, move the handles of the slots that were just reached
+                // down a level, starting from the highest level so the handles can keep falling through the levels below.
+                // The overflow list acts as the level above the highest one.
+                uint32_t reachedLevel = 1;
+                while (reachedLevel < LevelCount && (m_currentTick & ((uint64_t{ 1 } << (SlotBits * (reachedLevel + 1))) - 1)) == 0)
+                {
+                    ++reachedLevel;
+                }
+                if (reachedLevel == LevelCount && !m_overflow.empty())
+                {
+                    AZStd::vector<ScheduledEventHandle*> overflow = AZStd::move(m_overflow);
+                    m_overflow.clear();
+                    m_size -= overflow.size();
+                    for (ScheduledEventHandle* handle : overflow)
+                    {
+                        Place(handle);
+                    }
+                }
+                for (uint32_t level = AZStd::min(reachedLevel, LevelCount - 1); level > 0; --level)
+                {
+                    Cascade(level);
+                }
+            }
+
+            const uint64_t slot = m_currentTick & SlotMask;
+            AZStd::vector<ScheduledEventHandle*>& slotHandles = m_slots[0][slot];
+            if (!slotHandles.empty())
+            {
+                expiredHandles.insert(expiredHandles.end(), slotHandles.begin(), slotHandles.end());
+                m_size -= slotHandles.size();
+                slotHandles.clear();
+                m_occupiedSlots[0] &= ~(uint64_t{ 1 } << slot);
+            }
+
+            // Skip the empty slots up to the next occupied one, or to the start of the next revolution
+            const uint64_t nextSlot = slot + 1;
+            const uint64_t occupiedAfter = nextSlot < SlotCount ? m_occupiedSlots[0] >> nextSlot : 0;
+            const uint64_t nextTick = occupiedAfter != 0
+                ? m_currentTick + 1 + az_ctz_u64(occupiedAfter)
+                : (m_currentTick | SlotMask) + 1;
+            m_currentTick = AZStd::min(nextTick, endTick);
+        }
+        m_currentTick = AZStd::max(m_currentTick, endTick);
+    }
+
+    void ScheduledEventTimingWheel::Clear()
+    {
+        for (uint32_t level = 0; level < LevelCount; ++level)
+        {
+            for (AZStd::vector<ScheduledEventHandle*>& slotHandles : m_slots[level])
+            {
+                slotHandles.clear();
+            }
+            m_occupiedSlots[level] = 0;
+        }
+        m_overflow.clear();
+        m_dueHandles.clear();
+        m_size = 0;
+    }
+
+    AZStd::size_t ScheduledEventTimingWheel::GetSize() const
+    {
+        return m_size;
+    }
+
+    void ScheduledEventTimingWheel::Place(ScheduledEventHandle* handle)
+    {
+        ++m_size;
+
+        const uint64_t executeTick = ToTick(handle->GetExecuteTimeMs());
+        if (executeTick < m_currentTick)
+        {
+            m_dueHandles.push_back(handle);
+            return;
+        }
+
+        const uint64_t differentBits = executeTick ^ m_currentTick;
+        for (uint32_t level = 0; level < LevelCount; ++level)
+        {
+            if ((differentBits >> (SlotBits * (level + 1))) == 0)
+            {
+                const uint64_t slot = (executeTick >> (SlotBits * level)) & SlotMask;
+                m_slots[level][slot].push_back(handle);
+                m_occupiedSlots[level] |= uint64_t{ 1 } << slot;
+                return;
+            }
+        }
+        m_overflow.push_back(handle);
+    }
+
+    void ScheduledEventTimingWheel::Cascade(uint32_t level)
+    {
+        const uint64_t slot = (m_currentTick >> (SlotBits * level)) & SlotMask;
+        if ((m_occupiedSlots[level] & (uint64_t{ 1 } << slot)) == 0)
+        {
+            return;
+        }
+
+        AZStd::vector<ScheduledEventHandle*> slotHandles;
+        slotHandles.swap(m_slots[level][slot]);
+        m_occupiedSlots[level] &= ~(uint64_t{ 1 } << slot);
+        m_size -= slotHandles.size();
+        for (ScheduledEventHandle* handle : slotHandles)
+        {
+            Place(handle);
+        }
+
+        // Hand the storage back, so the slot doesn't allocate again the next time it is used
+        slotHandles.clear();
+        m_slots[level][slot].swap(slotHandles);
+    }
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    class ScheduledEventHandle;
+
+    //! @class ScheduledEventTimingWheel
+    //! A hierarchical timing wheel that holds scheduled event handles until their execute time.
+    //! The first level has a slot per millisecond, and every slot of the next level covers a whole revolution of the level below.
+    //! A handle is stored in the lowest level whose slots are fine enough to tell its execute time apart from the current time,
+    //! and moves down a level each time the level above reaches its slot. Inserting is O(1), and advancing costs a step per
+    //! occupied millisecond plus a step per revolution of the first level, regardless of how many handles are scheduled.
+    //! Handles that are cancelled stay in the wheel until they expire, just like in a priority queue.
+    class ScheduledEventTimingWheel
+    {
+    public:
+        static constexpr uint32_t SlotBits = 6;
+        static constexpr uint32_t SlotCount = 1 << SlotBits;
+        //! Four levels cover 2^24 ms (about 4.6 hours), handles further out wait in an overflow list.
+        static constexpr uint32_t LevelCount = 4;
+
+        //! Adds a handle that expires at its execute time. Handles that are already due expire on the next call to Advance.
+        //! @param handle the handle to schedule
+        //! @param currentTimeMs the current elapsed time, used to skip ahead when the wheel is empty
+        void Insert(ScheduledEventHandle* handle, TimeMs currentTimeMs);
+
+        //! Moves every handle whose execute time is at or before currentTimeMs into expiredHandles, in execute time order.
+        //! @param currentTimeMs the current elapsed time
+        //! @param expiredHandles receives the handles that expired
+        void Advance(TimeMs currentTimeMs, AZStd::vector<ScheduledEventHandle*>& expiredHandles);
+
+        //! Removes all the handles without expiring them.
+        void Clear();
+
+        //! Returns the number of handles in the wheel.
+        AZStd::size_t GetSize() const;
+
+    private:
+        //! Stores a handle in the slot for its execute time, relative to m_currentTick.
+        void Place(ScheduledEventHandle* handle);
+
+        //! Takes all the handles of a slot and places them again, which moves them to lower levels.
+        void Cascade(uint32_t level);
+
+        AZStd::vector<ScheduledEventHandle*> m_slots[LevelCount][SlotCount];
+        uint64_t m_occupiedSlots[LevelCount] = {}; //< A bit per slot that holds handles
+        AZStd::vector<ScheduledEventHandle*> m_overflow; //< Handles that are too far out for the highest level
+        AZStd::vector<ScheduledEventHandle*> m_dueHandles; //< Handles scheduled for a time the wheel has already advanced past
+        uint64_t m_currentTick = 0; //< The next millisecond to expire handles for
+        AZStd::size_t m_size = 0;
+    };
+}
@@ -19,6 +19,7 @@ namespace AZ::IO
     {
         m_decompressor = AZStd::move(rhs.m_decompressor);
         m_archiveFilename = AZStd::move(rhs.m_archiveFilename);
+        m_blocks = AZStd::move(rhs.m_blocks);
         m_compressionTag = rhs.m_compressionTag;
         m_offset = rhs.m_offset;
         m_compressedSize = rhs.m_compressedSize;
@@ -10,6 +10,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/string/string_view.h>
@@ -31,6 +32,19 @@ namespace AZ
             UseArchiveOnly
         };
 
+        //! Description of a block inside a compressed file that can be decompressed independently from the other blocks.
+        struct CompressedBlock
+        {
+            //! Offset of the compressed block relative to the start of the compressed file.
+            size_t m_compressedOffset = 0;
+            //! On disk size of the compressed block.
+            size_t m_compressedSize = 0;
+            //! Offset of the block in the decompressed file.
+            size_t m_uncompressedOffset = 0;
+            //! Size of the block after it has been decompressed.
+            size_t m_uncompressedSize = 0;
+        };
+
         struct CompressionInfo;
         using DecompressionFunc = AZStd::function<bool(const CompressionInfo& info, const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize)>;
 
@@ -47,6 +61,10 @@ namespace AZ
             RequestPath m_archiveFilename;
             //< The function to use to decompress the data.
             DecompressionFunc m_decompressor;
+            //! Optional list of independently compressed blocks, ordered by offset. If blocks are provided the decompressor will
+            //! be called for each block separately, which allows blocks to be decompressed in parallel and partial reads to only
+            //! read and decompress the blocks that overlap with the requested range. The blocks need to cover the entire file.
+            AZStd::vector<CompressedBlock> m_blocks;
             //< Tag that uniquely identifies the compressor responsible for decompressing the referenced data.
             CompressionTag m_compressionTag{ 0 };
             //! Offset into the archive file for the found file.
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/MemoryMappedFile.h>
+
+namespace AZ::IO
+{
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        Close();
+    }
+
+    bool MemoryMappedFile::Open(const char* filePath)
+    {
+        Close();
+        if (filePath == nullptr || filePath[0] == 0)
+        {
+            return false;
+        }
+        return PlatformOpen(filePath);
+    }
+
+    void MemoryMappedFile::Close()
+    {
+        if (m_data)
+        {
+            PlatformClose();
+            m_data = nullptr;
+            m_size = 0;
+        }
+    }
+
+    bool MemoryMappedFile::IsOpen() const
+    {
+        return m_data != nullptr;
+    }
+
+    u64 MemoryMappedFile::GetSize() const
+    {
+        return m_size;
+    }
+
+    const void* MemoryMappedFile::GetData() const
+    {
+        return m_data;
+    }
+
+    void* MemoryMappedFile::GetData()
+    {
+        return m_data;
+    }
+
+    AZStd::span<const AZStd::byte> MemoryMappedFile::GetView(u64 offset, u64 size) const
+    {
+        if (!m_data || offset > m_size || size > m_size - offset)
+        {
+            return {};
+        }
+        return AZStd::span<const AZStd::byte>(reinterpret_cast<const AZStd::byte*>(m_data) + offset, aznumeric_cast<size_t>(size));
+    }
+} // namespace AZ::IO
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/span.h>
+
+namespace AZ::IO
+{
+    //! Maps an entire file into the address space of the process.
+    //! The view is mapped copy-on-write: it's backed by the OS file cache, so multiple processes mapping the
+    //! same file share the same physical pages, and writes to the view are private to the process and never
+    //! reach the file on disk.
+    class MemoryMappedFile
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(MemoryMappedFile, AZ::SystemAllocator);
+
+        MemoryMappedFile() = default;
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        //! Maps the file at the given path. Any previously mapped file is unmapped first.
+        //! Returns false if the file couldn't be opened or mapped, or if the file is empty.
+        bool Open(const char* filePath);
+        //! Unmaps the file. Pointers and spans previously returned are no longer valid after this call.
+        void Close();
+
+        bool IsOpen() const;
+        u64 GetSize() const;
+
+        const void* GetData() const;
+        void* GetData();
+
+        //! Returns a span covering the requested range of the file, or an empty span if the range
+        //! isn't fully contained in the mapped file.
+        AZStd::span<const AZStd::byte> GetView(u64 offset, u64 size) const;
+
+    private:
+        bool PlatformOpen(const char* filePath);
+        void PlatformClose();
+
+        void* m_data{ nullptr };
+        u64 m_size{ 0 };
+    };
+} // namespace AZ::IO
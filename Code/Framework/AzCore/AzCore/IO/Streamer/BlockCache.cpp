@@ -10,6 +10,7 @@
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/IO/Streamer/BlockCache.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/SharedBlockCache.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/algorithm.h>
@@ -45,8 +46,23 @@ namespace AZ::IO
             cacheSize = aznumeric_caster(blockSize * 2);
         }
 
+        AZStd::unique_ptr<SharedBlockCache> sharedCache;
+        if (m_sharedCacheSizeMib > 0)
+        {
+#if AZ_TRAIT_SUPPORT_IPC
+            sharedCache = AZStd::make_unique<SharedBlockCache>(m_sharedCacheName.c_str(), m_sharedCacheSizeMib * 1_mib, aznumeric_cast<u32>(blockSize));
+            if (!sharedCache->IsReady())
+            {
+                sharedCache.reset();
+            }
+#else
+            AZ_Warning("Streamer", false, "A shared block cache was requested, but shared memory isn't supported on this platform.");
+#endif
+        }
+
         auto stackEntry = AZStd::make_shared<BlockCache>(
-            cacheSize, aznumeric_cast<AZ::u32>(blockSize), aznumeric_cast<AZ::u32>(hardware.m_maxPhysicalSectorSize), false);
+            cacheSize, aznumeric_cast<AZ::u32>(blockSize), aznumeric_cast<AZ::u32>(hardware.m_maxPhysicalSectorSize), false,
+            AZStd::move(sharedCache));
         stackEntry->SetNext(AZStd::move(parent));
         return stackEntry;
     }
@@ -64,11 +80,14 @@ namespace AZ::IO
             serializeContext->Class<BlockCacheConfig, IStreamerStackConfig>()
                 ->Version(1)
                 ->Field("CacheSizeMib", &BlockCacheConfig::m_cacheSizeMib)
-                ->Field("BlockSize", &BlockCacheConfig::m_blockSize);
+                ->Field("BlockSize", &BlockCacheConfig::m_blockSize)
+                ->Field("SharedCacheSizeMib", &BlockCacheConfig::m_sharedCacheSizeMib)
+                ->Field("SharedCacheName", &BlockCacheConfig::m_sharedCacheName);
         }
     }
 
     static constexpr char CacheHitRateName[] = "Cache hit rate";
+    static constexpr char SharedCacheHitRateName[] = "Shared cache hit rate";
     static constexpr char CacheableName[] = "Cacheable";
 
     void BlockCache::Section::Prefix(const Section& section)
@@ -99,13 +118,16 @@ namespace AZ::IO
         m_blockOffset = 0; // Two merged sections do not support caching.
     }
 
-    BlockCache::BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites)
+    BlockCache::BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites,
+        AZStd::unique_ptr<SharedBlockCache> sharedCache)
         : StreamStackEntry("Block cache")
+        , m_sharedCache(AZStd::move(sharedCache))
         , m_alignment(alignment)
         , m_onlyEpilogWrites(onlyEpilogWrites)
     {
         AZ_Assert(IStreamerTypes::IsPowerOf2(alignment), "Alignment needs to be a power of 2.");
         AZ_Assert(IStreamerTypes::IsAlignedTo(blockSize, alignment), "Block size needs to be a multiple of the alignment.");
+        AZ_Assert(!m_sharedCache || m_sharedCache->GetBlockSize() == blockSize, "The shared cache needs to use the same block size as the block cache.");
 
         m_numBlocks = aznumeric_caster(cacheSize / blockSize);
         m_cacheSize = cacheSize - (cacheSize % blockSize); // Only use the amount needed for the cache.
@@ -364,6 +386,10 @@ namespace AZ::IO
 
     void BlockCache::FlushCache(const RequestPath& filePath)
     {
+        if (m_sharedCache)
+        {
+            m_sharedCache->Flush(filePath);
+        }
         for (u32 i = 0; i < m_numBlocks; ++i)
         {
             if (m_cachedPaths[i] == filePath)
@@ -375,6 +401,10 @@ namespace AZ::IO
 
     void BlockCache::FlushEntireCache()
     {
+        if (m_sharedCache)
+        {
+            m_sharedCache->FlushAll();
+        }
         ResetCache();
     }
 
@@ -385,6 +415,13 @@ namespace AZ::IO
             "The percentage of requests that could be (partially) serviced with cached data. When running from loose files a lower value "
             "is better as it indicate full file reads. When running from archives higher values are better as it indicates better "
             "scheduling efficiency and/or better archive layouts."));
+        if (m_sharedCache)
+        {
+            statistics.push_back(Statistic::CreatePercentage(
+                m_name, SharedCacheHitRateName, CalculateSharedHitRatePercentage(),
+                "The percentage of blocks missing from this process's cache that were found in the cache shared with other "
+                "processes and therefore didn't have to be read from disk."));
+        }
         statistics.push_back(Statistic::CreatePercentage(
             m_name, CacheableName, CalculateCacheableRatePercentage(),
             "The percentage of requests that were candidates for caching. The percentage of requests that could be (partially) serviced "
@@ -403,6 +440,11 @@ namespace AZ::IO
         return m_hitRateStat.GetAverage();
     }
 
+    double BlockCache::CalculateSharedHitRatePercentage() const
+    {
+        return m_sharedHitRateStat.GetAverage();
+    }
+
     double BlockCache::CalculateCacheableRatePercentage() const
     {
         return m_cacheableStat.GetAverage();
@@ -461,6 +503,22 @@ namespace AZ::IO
 
             section.m_parent = request;
             cacheLocation = RecycleOldestBlock(filePath, section.m_readOffset);
+            if (cacheLocation != s_fileNotCached && m_sharedCache)
+            {
+                // Another process may have already read this block, in which case it can be copied instead of read from disk.
+                bool sharedHit = m_sharedCache->Read(filePath, section.m_readOffset, GetCacheBlockData(cacheLocation), section.m_readSize);
+                m_sharedHitRateStat.PushSample(sharedHit ? 1.0 : 0.0);
+                Statistic::PlotImmediate(m_name, SharedCacheHitRateName, m_sharedHitRateStat.GetMostRecentSample());
+                if (sharedHit)
+                {
+                    if (section.m_wait)
+                    {
+                        m_context->MarkRequestAsCompleted(section.m_wait);
+                        section.m_wait = nullptr;
+                    }
+                    return ReadFromCache(request, section, cacheLocation);
+                }
+            }
             if (cacheLocation != s_fileNotCached)
             {
                 FileRequest* readRequest = m_context->GetNewInternalRequest();
@@ -547,6 +605,12 @@ namespace AZ::IO
         {
             TouchBlock(cacheBlockIndex);
             m_inFlightRequests[cacheBlockIndex] = nullptr;
+            if (m_sharedCache)
+            {
+                auto& readData = AZStd::get<Requests::ReadData>(request.GetCommand());
+                m_sharedCache->Store(m_cachedPaths[cacheBlockIndex], m_cachedOffsets[cacheBlockIndex],
+                    GetCacheBlockData(cacheBlockIndex), readData.m_size);
+            }
         }
         else
         {
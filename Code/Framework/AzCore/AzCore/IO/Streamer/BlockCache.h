@@ -17,11 +17,13 @@
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/string/string.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace AZ::IO
 {
     class RequestPath;
+    class SharedBlockCache;
     namespace Requests
     {
         struct ReadData;
@@ -55,13 +57,21 @@ namespace AZ::IO
         u32 m_cacheSizeMib{ 8 };
         //! The size of the individual blocks inside the cache.
         BlockSize m_blockSize{ BlockSize::MemoryAlignment };
+        //! The size in megabytes of an optional cache in shared memory that's used by all processes on the machine that use
+        //! the same shared cache name. Blocks missing from the process's own cache are looked up in the shared cache before
+        //! they're read from disk. Set to 0 to disable the shared cache.
+        u32 m_sharedCacheSizeMib{ 0 };
+        //! The name of the shared memory used for the shared cache. Processes need to use the same name, cache size and
+        //! block size to share the cache.
+        AZStd::string m_sharedCacheName{ "StreamerBlockCache" };
     };
 
     class BlockCache
         : public StreamStackEntry
     {
     public:
-        BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites);
+        BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites,
+            AZStd::unique_ptr<SharedBlockCache> sharedCache = {});
         BlockCache(BlockCache&& rhs) = delete;
         BlockCache(const BlockCache& rhs) = delete;
         ~BlockCache() override;
@@ -84,6 +94,7 @@ namespace AZ::IO
         void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
 
         double CalculateHitRatePercentage() const;
+        double CalculateSharedHitRatePercentage() const;
         double CalculateCacheableRatePercentage() const;
         s32 CalculateAvailableRequestSlots() const;
 
@@ -141,8 +152,12 @@ namespace AZ::IO
         AZStd::deque<Section> m_delayedSections;
 
         AZ::Statistics::RunningStatistic m_hitRateStat;
+        AZ::Statistics::RunningStatistic m_sharedHitRateStat;
         AZ::Statistics::RunningStatistic m_cacheableStat;
 
+        //! Optional cache shared with other processes which is checked before reading blocks from disk.
+        AZStd::unique_ptr<SharedBlockCache> m_sharedCache;
+
         u8* m_cache;
         u64 m_cacheSize;
         u32 m_blockSize;
@@ -366,6 +366,46 @@ namespace AZ::IO
         StreamStackEntry::CollectStatistics(statistics);
     }
 
+    auto FullFileDecompressor::CalculateArchiveSection(const Requests::CompressedReadData& data) const -> ArchiveSection
+    {
+        const CompressionInfo& info = data.m_compressionInfo;
+
+        ArchiveSection section;
+        section.m_offset = info.m_offset;
+        section.m_size = info.m_compressedSize;
+
+        if (!info.m_blocks.empty())
+        {
+            // Only the blocks that overlap with the requested range need to be read.
+            const AZStd::vector<CompressedBlock>& blocks = info.m_blocks;
+            size_t readEnd = data.m_readOffset + data.m_readSize;
+            u32 numBlocks = aznumeric_cast<u32>(blocks.size());
+            u32 first = 0;
+            while (first < numBlocks - 1 && blocks[first].m_uncompressedOffset + blocks[first].m_uncompressedSize <= data.m_readOffset)
+            {
+                ++first;
+            }
+            u32 end = first + 1;
+            while (end < numBlocks && blocks[end].m_uncompressedOffset < readEnd)
+            {
+                ++end;
+            }
+
+            section.m_firstBlock = first;
+            section.m_endBlock = end;
+            section.m_offset = info.m_offset + blocks[first].m_compressedOffset;
+            section.m_size = (blocks[end - 1].m_compressedOffset + blocks[end - 1].m_compressedSize) - blocks[first].m_compressedOffset;
+        }
+
+        // The buffer is aligned down but the offset is not corrected. If the offset was adjusted it would mean the same data is read
+        // multiple times and negates the block cache's ability to detect these cases. By still adjusting it means that the reads between
+        // the BlockCache's prolog and epilog are read into aligned buffers.
+        size_t offsetAdjustment = section.m_offset - AZ_SIZE_ALIGN_DOWN(section.m_offset, aznumeric_cast<size_t>(m_alignment));
+        section.m_alignmentOffset = aznumeric_cast<u32>(offsetAdjustment);
+        section.m_bufferSize = AZ_SIZE_ALIGN_UP((section.m_size + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+        return section;
+    }
+
     bool FullFileDecompressor::IsIdle() const
     {
         return
@@ -528,18 +568,14 @@ namespace AZ::IO
                 CompressionInfo& info = data->m_compressionInfo;
                 AZ_Assert(info.m_decompressor, "FullFileDecompressor is planning to a queue a request for reading but couldn't find a decompressor.");
 
-                // The buffer is aligned down but the offset is not corrected. If the offset was adjusted it would mean the same data is read
-                // multiple times and negates the block cache's ability to detect these cases. By still adjusting it means that the reads between
-                // the BlockCache's prolog and epilog are read into aligned buffers.
-                size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
-                size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+                ArchiveSection section = CalculateArchiveSection(*data);
                 m_readBuffers[i] = reinterpret_cast<Buffer>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
-                    bufferSize, m_alignment));
-                m_memoryUsage += bufferSize;
+                    section.m_bufferSize, m_alignment));
+                m_memoryUsage += section.m_bufferSize;
 
                 FileRequest* archiveReadRequest = m_context->GetNewInternalRequest();
-                archiveReadRequest->CreateRead(compressedReadRequest, m_readBuffers[i] + offsetAdjustment, bufferSize, info.m_archiveFilename,
-                    info.m_offset, info.m_compressedSize, info.m_isSharedPak);
+                archiveReadRequest->CreateRead(compressedReadRequest, m_readBuffers[i] + section.m_alignmentOffset, section.m_bufferSize,
+                    info.m_archiveFilename, section.m_offset, section.m_size, info.m_isSharedPak);
                 archiveReadRequest->SetCompletionCallback(
                     [this, readSlot = i](FileRequest& request)
                     {
@@ -584,9 +620,7 @@ namespace AZ::IO
         {
             auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
             AZ_Assert(data, "Compressed request in FullFileDecompressor that finished unsuccessfully didn't contain compression read data.");
-            CompressionInfo& info = data->m_compressionInfo;
-            size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
-            size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+            size_t bufferSize = CalculateArchiveSection(*data).m_bufferSize;
             m_memoryUsage -= bufferSize;
 
             if (m_readBuffers[readSlot] != nullptr)
@@ -647,29 +681,64 @@ namespace AZ::IO
                 AZ_Assert(data, "Compressed request in FullFileDecompressor that's starting decompression didn't contain compression read data.");
                 AZ_Assert(data->m_compressionInfo.m_decompressor, "FullFileDecompressor is queuing a decompression job but couldn't find a decompressor.");
 
-                info.m_alignmentOffset = aznumeric_caster(data->m_compressionInfo.m_offset -
-                    AZ_SIZE_ALIGN_DOWN(data->m_compressionInfo.m_offset, aznumeric_cast<size_t>(m_alignment)));
+                info.m_section = CalculateArchiveSection(*data);
+                info.m_temporaryMemory = 0;
 
-                if (data->m_readOffset == 0 && data->m_readSize == data->m_compressionInfo.m_uncompressedSize)
+                --m_numPendingDecompression;
+                ++m_numRunningJobs;
+
+                if (!data->m_compressionInfo.m_blocks.empty())
                 {
-                    auto job = [this, &info]()
+                    // Each block is decompressed in its own job so the blocks of a single file can be spread over all the
+                    // available decompression threads.
+                    const AZStd::vector<CompressedBlock>& blocks = data->m_compressionInfo.m_blocks;
+                    size_t readEnd = data->m_readOffset + data->m_readSize;
+                    for (u32 block = info.m_section.m_firstBlock; block < info.m_section.m_endBlock; ++block)
                     {
-                        FullDecompression(m_context, info);
-                    };
-                    decompressionJob = AZ::CreateJobFunction(job, true, m_decompressionjobContext.get());
+                        // Blocks that are only partially requested need to be decompressed into a temporary buffer first.
+                        if (blocks[block].m_uncompressedOffset < data->m_readOffset ||
+                            blocks[block].m_uncompressedOffset + blocks[block].m_uncompressedSize > readEnd)
+                        {
+                            info.m_temporaryMemory += blocks[block].m_uncompressedSize;
+                        }
+                    }
+                    m_memoryUsage += info.m_temporaryMemory;
+
+                    info.m_jobStarted = false;
+                    info.m_blockFailed = false;
+                    info.m_pendingBlocks = info.m_section.m_endBlock - info.m_section.m_firstBlock;
+                    for (u32 block = info.m_section.m_firstBlock; block < info.m_section.m_endBlock; ++block)
+                    {
+                        auto job = [this, &info, block]()
+                        {
+                            BlockDecompression(m_context, info, block);
+                        };
+                        decompressionJob = AZ::CreateJobFunction(job, true, m_decompressionjobContext.get());
+                        decompressionJob->Start();
+                    }
                 }
                 else
                 {
-                    m_memoryUsage += data->m_compressionInfo.m_uncompressedSize;
-                    auto job = [this, &info]()
+                    if (data->m_readOffset == 0 && data->m_readSize == data->m_compressionInfo.m_uncompressedSize)
                     {
-                        PartialDecompression(m_context, info);
-                    };
-                    decompressionJob = AZ::CreateJobFunction(job, true, m_decompressionjobContext.get());
+                        auto job = [this, &info]()
+                        {
+                            FullDecompression(m_context, info);
+                        };
+                        decompressionJob = AZ::CreateJobFunction(job, true, m_decompressionjobContext.get());
+                    }
+                    else
+                    {
+                        info.m_temporaryMemory = data->m_compressionInfo.m_uncompressedSize;
+                        m_memoryUsage += info.m_temporaryMemory;
+                        auto job = [this, &info]()
+                        {
+                            PartialDecompression(m_context, info);
+                        };
+                        decompressionJob = AZ::CreateJobFunction(job, true, m_decompressionjobContext.get());
+                    }
+                    decompressionJob->Start();
                 }
-                --m_numPendingDecompression;
-                ++m_numRunningJobs;
-                decompressionJob->Start();
 
                 m_readRequests[readSlot] = nullptr;
                 m_readBufferStatus[readSlot] = ReadBufferStatus::Unused;
@@ -697,22 +766,18 @@ namespace AZ::IO
 
         FileRequest* compressedRequest = jobInfo.m_waitRequest->GetParent();
         AZ_Assert(compressedRequest, "A wait request attached to FullFileDecompressor was completed but didn't have a parent compressed request.");
-        auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
+        [[maybe_unused]] auto data = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
         AZ_Assert(data, "Compressed request in FullFileDecompressor that completed decompression didn't contain compression read data.");
-        CompressionInfo& info = data->m_compressionInfo;
-        size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
-        size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+        size_t bufferSize = jobInfo.m_section.m_bufferSize;
         m_memoryUsage -= bufferSize;
-        if (data->m_readOffset != 0 || data->m_readSize != data->m_compressionInfo.m_uncompressedSize)
-        {
-            m_memoryUsage -= data->m_compressionInfo.m_uncompressedSize;
-        }
+        m_memoryUsage -= jobInfo.m_temporaryMemory;
+        jobInfo.m_temporaryMemory = 0;
 
         m_decompressionJobDelayMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
             jobInfo.m_jobStartTime - jobInfo.m_queueStartTime).count());
         m_decompressionDurationMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
             endTime - jobInfo.m_jobStartTime).count());
-        m_bytesDecompressed.PushEntry(data->m_compressionInfo.m_compressedSize);
+        m_bytesDecompressed.PushEntry(jobInfo.m_section.m_size);
 
         AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(jobInfo.m_compressedData, bufferSize, m_alignment);
         jobInfo.m_compressedData = nullptr;
@@ -738,7 +803,7 @@ namespace AZ::IO
             "FullFileDecompressor is doing a full decompression, but the target buffer size (%llu) doesn't match the decompressed size (%zu).",
             request->m_readSize, compressionInfo.m_uncompressedSize);
 
-        bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
+        bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_section.m_alignmentOffset,
             compressionInfo.m_compressedSize, request->m_output, compressionInfo.m_uncompressedSize);
         info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
 
@@ -758,7 +823,7 @@ namespace AZ::IO
         AZ_Assert(compressionInfo.m_decompressor, "Partial decompressor job started, but there's no decompressor callback assigned.");
 
         AZStd::unique_ptr<u8[]> decompressionBuffer = AZStd::unique_ptr<u8[]>(new u8[compressionInfo.m_uncompressedSize]);
-        bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
+        bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_section.m_alignmentOffset,
             compressionInfo.m_compressedSize, decompressionBuffer.get(), compressionInfo.m_uncompressedSize);
         info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
 
@@ -768,6 +833,63 @@ namespace AZ::IO
         context->WakeUpSchedulingThread();
     }
 
+    void FullFileDecompressor::BlockDecompression(StreamerContext* context, DecompressionInformation& info, u32 blockIndex)
+    {
+        if (!info.m_jobStarted.exchange(true))
+        {
+            info.m_jobStartTime = AZStd::chrono::steady_clock::now();
+        }
+
+        FileRequest* compressedRequest = info.m_waitRequest->GetParent();
+        AZ_Assert(compressedRequest, "A wait request attached to FullFileDecompressor was completed but didn't have a parent compressed request.");
+        auto request = AZStd::get_if<Requests::CompressedReadData>(&compressedRequest->GetCommand());
+        AZ_Assert(request, "Compressed request in FullFileDecompressor that's running block decompression didn't contain compression read data.");
+        CompressionInfo& compressionInfo = request->m_compressionInfo;
+        AZ_Assert(compressionInfo.m_decompressor, "Block decompressor job started, but there's no decompressor callback assigned.");
+
+        const CompressedBlock& block = compressionInfo.m_blocks[blockIndex];
+        const CompressedBlock& firstBlock = compressionInfo.m_blocks[info.m_section.m_firstBlock];
+        const u8* compressed = info.m_compressedData + info.m_section.m_alignmentOffset + (block.m_compressedOffset - firstBlock.m_compressedOffset);
+
+        size_t readEnd = request->m_readOffset + request->m_readSize;
+        size_t blockEnd = block.m_uncompressedOffset + block.m_uncompressedSize;
+        u8* output = reinterpret_cast<u8*>(request->m_output);
+        bool success;
+        if (block.m_uncompressedOffset >= request->m_readOffset && blockEnd <= readEnd)
+        {
+            // The entire block is requested, so decompress directly into the output buffer.
+            success = compressionInfo.m_decompressor(compressionInfo, compressed, block.m_compressedSize,
+                output + (block.m_uncompressedOffset - request->m_readOffset), block.m_uncompressedSize);
+        }
+        else
+        {
+            AZStd::unique_ptr<u8[]> decompressionBuffer = AZStd::unique_ptr<u8[]>(new u8[block.m_uncompressedSize]);
+            success = compressionInfo.m_decompressor(compressionInfo, compressed, block.m_compressedSize,
+                decompressionBuffer.get(), block.m_uncompressedSize);
+            if (success)
+            {
+                u64 copyStart = AZStd::max<u64>(block.m_uncompressedOffset, request->m_readOffset);
+                u64 copyEnd = AZStd::min<u64>(blockEnd, readEnd);
+                memcpy(output + (copyStart - request->m_readOffset), decompressionBuffer.get() + (copyStart - block.m_uncompressedOffset),
+                    copyEnd - copyStart);
+            }
+        }
+
+        if (!success)
+        {
+            info.m_blockFailed = true;
+        }
+
+        // The last block to finish completes the request.
+        if (info.m_pendingBlocks.fetch_sub(1) == 1)
+        {
+            info.m_waitRequest->SetStatus(
+                info.m_blockFailed ? IStreamerTypes::RequestStatus::Failed : IStreamerTypes::RequestStatus::Completed);
+            context->MarkRequestAsCompleted(info.m_waitRequest);
+            context->WakeUpSchedulingThread();
+        }
+    }
+
     void FullFileDecompressor::Report(const Requests::ReportData& data) const
     {
         switch (data.m_reportType)
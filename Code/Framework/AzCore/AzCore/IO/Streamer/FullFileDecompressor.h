@@ -16,6 +16,7 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/Statistics/RunningStatistic.h>
 
@@ -23,6 +24,7 @@ namespace AZ::IO
 {
     namespace Requests
     {
+        struct CompressedReadData;
         struct ReadRequestData;
         struct ReportData;
     }
@@ -53,6 +55,9 @@ namespace AZ::IO
     //! Finally, the lack of an upper limit also means that the duration of the decompression job
     //! can vary largely so a dedicated job system is used to decompress on to avoid blocking
     //! the main job system from working.
+    //! Files that are stored as a series of independently compressed blocks (see CompressionInfo::m_blocks) are
+    //! decompressed with a job per block so large files can use all decompression threads. For partial reads of these
+    //! files only the blocks that overlap with the requested range are read and decompressed.
     class FullFileDecompressor
         : public StreamStackEntry
     {
@@ -80,19 +85,44 @@ namespace AZ::IO
             PendingDecompression
         };
 
+        //! The section of the archive that needs to be read to fulfill a compressed read.
+        struct ArchiveSection
+        {
+            //! Offset in the archive where reading starts.
+            size_t m_offset{ 0 };
+            //! The number of bytes to read from the archive.
+            size_t m_size{ 0 };
+            //! The size of the buffer needed to read the section into, including the padding needed for alignment.
+            size_t m_bufferSize{ 0 };
+            //! The offset into the buffer where the data of the section starts.
+            u32 m_alignmentOffset{ 0 };
+            //! The first block in CompressionInfo::m_blocks that's included in the section. Not used if the file isn't stored as blocks.
+            u32 m_firstBlock{ 0 };
+            //! One past the last block in CompressionInfo::m_blocks that's included in the section.
+            u32 m_endBlock{ 0 };
+        };
+
         struct DecompressionInformation
         {
             bool IsProcessing() const;
 
             AZStd::chrono::steady_clock::time_point m_queueStartTime;
             AZStd::chrono::steady_clock::time_point m_jobStartTime;
+            ArchiveSection m_section;
             Buffer m_compressedData{ nullptr };
             FileRequest* m_waitRequest{ nullptr };
-            u32 m_alignmentOffset{ 0 };
+            //! The amount of temporary memory the decompression needs in addition to the read buffer.
+            size_t m_temporaryMemory{ 0 };
+            //! The number of block decompression jobs that haven't completed yet.
+            AZStd::atomic<u32> m_pendingBlocks{ 0 };
+            AZStd::atomic_bool m_jobStarted{ false };
+            AZStd::atomic_bool m_blockFailed{ false };
         };
 
         bool IsIdle() const;
 
+        ArchiveSection CalculateArchiveSection(const Requests::CompressedReadData& data) const;
+
         void PrepareReadRequest(FileRequest* request, Requests::ReadRequestData& data);
         void PrepareDedicatedCache(FileRequest* request, const RequestPath& path);
         void FileExistsCheck(FileRequest* checkRequest);
@@ -107,6 +137,7 @@ namespace AZ::IO
 
         static void FullDecompression(StreamerContext* context, DecompressionInformation& info);
         static void PartialDecompression(StreamerContext* context, DecompressionInformation& info);
+        static void BlockDecompression(StreamerContext* context, DecompressionInformation& info, u32 blockIndex);
 
         void Report(const Requests::ReportData& data) const;
 
@@ -0,0 +1,406 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/ReadAhead.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> ReadAheadConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        u64 maxReadSize = AZ_SIZE_ALIGN_UP(m_maxReadSizeKib * 1_kib, aznumeric_cast<u64>(hardware.m_maxPhysicalSectorSize));
+        auto stackEntry = AZStd::make_shared<ReadAhead>(
+            AZStd::max(m_maxTrackedFiles, 1u), AZStd::max(m_maxNumReads, 1u), maxReadSize, m_depth,
+            aznumeric_cast<u32>(hardware.m_maxPhysicalSectorSize));
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void ReadAheadConfig::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<ReadAheadConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxTrackedFiles", &ReadAheadConfig::m_maxTrackedFiles)
+                ->Field("MaxNumReads", &ReadAheadConfig::m_maxNumReads)
+                ->Field("MaxReadSizeKib", &ReadAheadConfig::m_maxReadSizeKib)
+                ->Field("Depth", &ReadAheadConfig::m_depth);
+        }
+    }
+
+    static constexpr char HitRateName[] = "Read ahead hit rate";
+    // The number of times the same gap between requests needs to be seen before it's considered a pattern.
+    static constexpr u32 s_requiredConfirmations = 1;
+
+    ReadAhead::ReadAhead(u32 maxTrackedFiles, u32 maxNumReads, u64 maxReadSize, u32 depth, u32 alignment)
+        : StreamStackEntry("Read ahead")
+        , m_maxReadSize(maxReadSize)
+        , m_maxTrackedFiles(maxTrackedFiles)
+        , m_depth(depth)
+        , m_alignment(alignment)
+    {
+        AZ_Assert(IStreamerTypes::IsPowerOf2(alignment), "Alignment needs to be a power of 2.");
+        AZ_Assert(IStreamerTypes::IsAlignedTo(maxReadSize, alignment), "Maximum read size needs to be a multiple of the alignment.");
+
+        m_patterns.reserve(maxTrackedFiles);
+        m_readSlots.resize(maxNumReads);
+        m_buffer = reinterpret_cast<u8*>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
+            m_maxReadSize * maxNumReads, alignment));
+    }
+
+    ReadAhead::~ReadAhead()
+    {
+        AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(m_buffer, m_maxReadSize * m_readSlots.size(), m_alignment);
+    }
+
+    void ReadAhead::QueueRequest(FileRequest* request)
+    {
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                ReadFile(request, args);
+                return;
+            }
+            else
+            {
+                if constexpr (AZStd::is_same_v<Command, Requests::FlushData>)
+                {
+                    Flush(args.m_path);
+                }
+                else if constexpr (AZStd::is_same_v<Command, Requests::FlushAllData>)
+                {
+                    FlushAll();
+                }
+                else if constexpr (AZStd::is_same_v<Command, Requests::ReportData>)
+                {
+                    Report(args);
+                }
+                StreamStackEntry::QueueRequest(request);
+            }
+        }, request->GetCommand());
+    }
+
+    bool ReadAhead::ExecuteRequests()
+    {
+        bool nextResult = StreamStackEntry::ExecuteRequests();
+        bool readAheadIssued = IssuePendingReads();
+        return nextResult || readAheadIssued;
+    }
+
+    void ReadAhead::UpdateStatus(Status& status) const
+    {
+        // Speculative reads only use the slots that are left over, so this entry doesn't limit the number of available slots.
+        status.m_isIdle = status.m_isIdle &&
+            m_numInFlightReads == 0 &&
+            m_pendingReads.empty();
+        StreamStackEntry::UpdateStatus(status);
+    }
+
+    void ReadAhead::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        statistics.push_back(Statistic::CreatePercentage(
+            m_name, HitRateName, CalculateHitRatePercentage(),
+            "The percentage of requests that matched the offset predicted from the access pattern of the file. A low value means "
+            "files are read randomly and the speculative reads are wasted bandwidth."));
+        statistics.push_back(Statistic::CreateInteger(
+            m_name, "Speculative reads", aznumeric_caster(m_numSpeculativeReads),
+            "The total number of reads that were issued ahead of time based on the detected access patterns."));
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    double ReadAhead::CalculateHitRatePercentage() const
+    {
+        return m_hitRateStat.GetAverage();
+    }
+
+    void ReadAhead::ReadFile(FileRequest* request, Requests::ReadData& data)
+    {
+        if (m_next)
+        {
+            FilePattern& pattern = FindOrCreatePattern(data.m_path);
+            bool isNewPattern = pattern.m_lastUsed == 0;
+            pattern.m_lastUsed = ++m_clock;
+            if (isNewPattern)
+            {
+                pattern.m_lastOffset = data.m_offset;
+                pattern.m_lastSize = data.m_size;
+            }
+            else
+            {
+                UpdatePattern(pattern, data.m_offset, data.m_size);
+            }
+        }
+        // Always forward the original request first so it gets ahead of any speculative reads it triggers.
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    void ReadAhead::UpdatePattern(FilePattern& pattern, u64 offset, u64 size)
+    {
+        if (pattern.m_hasPrediction)
+        {
+            m_hitRateStat.PushSample(pattern.m_expectedOffset == offset ? 1.0 : 0.0);
+            Statistic::PlotImmediate(m_name, HitRateName, m_hitRateStat.GetMostRecentSample());
+        }
+
+        s64 gap = aznumeric_cast<s64>(offset) - aznumeric_cast<s64>(pattern.m_lastOffset + pattern.m_lastSize);
+        if (pattern.m_gapKnown && pattern.m_gap == gap)
+        {
+            ++pattern.m_confirmations;
+        }
+        else
+        {
+            pattern.m_gap = gap;
+            pattern.m_gapKnown = true;
+            pattern.m_confirmations = 0;
+            pattern.m_readAheadOffset = offset;
+        }
+        pattern.m_lastOffset = offset;
+        pattern.m_lastSize = size;
+
+        // The step is the distance between the start of this request and the start of the next request.
+        s64 step = aznumeric_cast<s64>(size) + gap;
+        pattern.m_hasPrediction = pattern.m_confirmations >= s_requiredConfirmations && step != 0 &&
+            aznumeric_cast<s64>(offset) + step >= 0;
+        if (pattern.m_hasPrediction)
+        {
+            pattern.m_expectedOffset = aznumeric_cast<u64>(aznumeric_cast<s64>(offset) + step);
+            if (size <= m_maxReadSize)
+            {
+                QueueReadAhead(pattern, step);
+            }
+        }
+    }
+
+    void ReadAhead::QueueReadAhead(FilePattern& pattern, s64 step)
+    {
+        for (u32 i = 1; i <= m_depth; ++i)
+        {
+            s64 predicted = aznumeric_cast<s64>(pattern.m_lastOffset) + (step * i);
+            if (predicted < 0)
+            {
+                break;
+            }
+            u64 offset = aznumeric_cast<u64>(predicted);
+            if (pattern.m_fileSizeKnown && offset >= pattern.m_fileSize)
+            {
+                break;
+            }
+            // Skip the parts that previous requests already read ahead.
+            bool alreadyQueued = step > 0 ? (offset <= pattern.m_readAheadOffset) : (offset >= pattern.m_readAheadOffset);
+            if (!alreadyQueued)
+            {
+                m_pendingReads.push_back(PendingRead{ pattern.m_path, offset, pattern.m_lastSize });
+                pattern.m_readAheadOffset = offset;
+            }
+        }
+
+        // Speculative reads go stale quickly, so only keep the most recent predictions.
+        size_t maxPendingReads = m_readSlots.size() * AZStd::max(m_depth, 1u);
+        while (m_pendingReads.size() > maxPendingReads)
+        {
+            m_pendingReads.pop_front();
+        }
+    }
+
+    void ReadAhead::RequestFileSize(FilePattern& pattern, size_t slot)
+    {
+        ReadSlot& readSlot = m_readSlots[slot];
+        readSlot.m_path = pattern.m_path;
+        pattern.m_fileSizeRequested = true;
+
+        auto fileSizeRetrieved = [this, slot](FileRequest& fileSizeRequest)
+        {
+            AZ_PROFILE_FUNCTION(AzCore);
+            AZ_Assert(m_numInFlightReads > 0, "More speculative reads completed than were issued.");
+            ReadSlot& readSlot = m_readSlots[slot];
+            // The pattern could have been replaced if many other files were read in the meantime.
+            if (FilePattern* pattern = FindPattern(readSlot.m_path); pattern != nullptr)
+            {
+                auto& requestInfo = AZStd::get<Requests::FileMetaDataRetrievalData>(fileSizeRequest.GetCommand());
+                bool found = fileSizeRequest.GetStatus() == IStreamerTypes::RequestStatus::Completed && requestInfo.m_found;
+                // If the size can't be retrieved, use a size of 0 so no speculative reads are issued for the file.
+                pattern->m_fileSize = found ? requestInfo.m_fileSize : 0;
+                pattern->m_fileSizeKnown = true;
+            }
+            readSlot.m_request = nullptr;
+            m_numInFlightReads--;
+        };
+        FileRequest* fileSizeRequest = m_context->GetNewInternalRequest();
+        fileSizeRequest->CreateFileMetaDataRetrieval(readSlot.m_path);
+        fileSizeRequest->SetCompletionCallback(AZStd::move(fileSizeRetrieved));
+        readSlot.m_request = fileSizeRequest;
+        m_numInFlightReads++;
+        m_next->QueueRequest(fileSizeRequest);
+    }
+
+    bool ReadAhead::IssuePendingReads()
+    {
+        bool issued = false;
+        while (m_next && !m_pendingReads.empty())
+        {
+            size_t slot = FindFreeReadSlot();
+            if (slot == s_fileNotFound)
+            {
+                break;
+            }
+
+            // Speculative reads should never delay actual requests, so only issue them if there's room in the stack.
+            Status status;
+            m_next->UpdateStatus(status);
+            if (status.m_numAvailableSlots <= 0)
+            {
+                break;
+            }
+
+            PendingRead& pending = m_pendingReads.front();
+            FilePattern* pattern = FindPattern(pending.m_path);
+            if (!pattern)
+            {
+                m_pendingReads.pop_front();
+                continue;
+            }
+            if (!pattern->m_fileSizeKnown)
+            {
+                // Reading past the end of the file is not allowed, so the file size needs to be known before reading ahead.
+                if (!pattern->m_fileSizeRequested)
+                {
+                    RequestFileSize(*pattern, slot);
+                    issued = true;
+                }
+                break;
+            }
+            if (pending.m_offset >= pattern->m_fileSize)
+            {
+                m_pendingReads.pop_front();
+                continue;
+            }
+
+            ReadSlot& readSlot = m_readSlots[slot];
+            readSlot.m_path = pending.m_path;
+            u64 size = AZStd::min(pending.m_size, pattern->m_fileSize - pending.m_offset);
+            FileRequest* readRequest = m_context->GetNewInternalRequest();
+            readRequest->CreateRead(nullptr, m_buffer + (slot * m_maxReadSize), m_maxReadSize, readSlot.m_path, pending.m_offset, size);
+            readRequest->SetCompletionCallback([this, slot](FileRequest&)
+                {
+                    AZ_Assert(m_numInFlightReads > 0, "More speculative reads completed than were issued.");
+                    m_readSlots[slot].m_request = nullptr;
+                    m_numInFlightReads--;
+                });
+            readSlot.m_request = readRequest;
+            m_numInFlightReads++;
+            m_numSpeculativeReads++;
+            m_pendingReads.pop_front();
+
+            m_next->QueueRequest(readRequest);
+            issued = true;
+        }
+        return issued;
+    }
+
+    auto ReadAhead::FindOrCreatePattern(const RequestPath& filePath) -> FilePattern&
+    {
+        if (FilePattern* pattern = FindPattern(filePath); pattern != nullptr)
+        {
+            return *pattern;
+        }
+
+        if (m_patterns.size() < m_maxTrackedFiles)
+        {
+            FilePattern& pattern = m_patterns.emplace_back();
+            pattern.m_path = filePath;
+            return pattern;
+        }
+
+        // Replace the pattern that hasn't been used the longest.
+        FilePattern* oldest = &m_patterns[0];
+        for (FilePattern& pattern : m_patterns)
+        {
+            if (pattern.m_lastUsed < oldest->m_lastUsed)
+            {
+                oldest = &pattern;
+            }
+        }
+        *oldest = FilePattern{};
+        oldest->m_path = filePath;
+        return *oldest;
+    }
+
+    auto ReadAhead::FindPattern(const RequestPath& filePath) -> FilePattern*
+    {
+        for (FilePattern& pattern : m_patterns)
+        {
+            if (pattern.m_path == filePath)
+            {
+                return &pattern;
+            }
+        }
+        return nullptr;
+    }
+
+    size_t ReadAhead::FindFreeReadSlot() const
+    {
+        size_t count = m_readSlots.size();
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (m_readSlots[i].m_request == nullptr)
+            {
+                return i;
+            }
+        }
+        return s_fileNotFound;
+    }
+
+    void ReadAhead::Flush(const RequestPath& filePath)
+    {
+        AZStd::erase_if(m_patterns, [&filePath](const FilePattern& pattern) { return pattern.m_path == filePath; });
+        AZStd::erase_if(m_pendingReads, [&filePath](const PendingRead& pending) { return pending.m_path == filePath; });
+    }
+
+    void ReadAhead::FlushAll()
+    {
+        m_patterns.clear();
+        m_pendingReads.clear();
+    }
+
+    void ReadAhead::Report(const Requests::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case IStreamerTypes::ReportType::Config:
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max tracked files", m_maxTrackedFiles,
+                "The maximum number of files for which the access pattern is tracked at the same time."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max num reads", aznumeric_caster(m_readSlots.size()),
+                "The maximum number of speculative reads that can be in flight at the same time."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Max read size", m_maxReadSize,
+                "Requests larger than this size don't trigger speculative reads. Use the block size of the cache that follows this node "
+                "as a guide."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Depth", m_depth,
+                "The number of requests that are read ahead once a sequential or strided access pattern has been detected."));
+            data.m_output.push_back(Statistic::CreateReferenceString(
+                m_name, "Next node", m_next ? AZStd::string_view(m_next->GetName()) : AZStd::string_view("<None>"),
+                "The name of the node that follows this node or none."));
+            break;
+        };
+    }
+} // namespace AZ::IO
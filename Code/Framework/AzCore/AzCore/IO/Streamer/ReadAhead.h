@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ::IO
+{
+    namespace Requests
+    {
+        struct ReadData;
+        struct ReportData;
+    } // namespace Requests
+
+    struct ReadAheadConfig final :
+        public IStreamerStackConfig
+    {
+        AZ_RTTI(AZ::IO::ReadAheadConfig, "{6C0F4E52-3C43-4B8C-9B7D-2B1B6E1F8A37}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(ReadAheadConfig, AZ::SystemAllocator);
+
+        ~ReadAheadConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! The maximum number of files for which the access pattern is tracked at the same time.
+        u32 m_maxTrackedFiles{ 16 };
+        //! The maximum number of speculative reads that can be in flight at the same time.
+        u32 m_maxNumReads{ 2 };
+        //! Requests larger than this size in kilobytes will not trigger speculative reads as they would not benefit from the cache.
+        u32 m_maxReadSizeKib{ 64 };
+        //! The number of requests to read ahead once a sequential or strided access pattern has been detected.
+        u32 m_depth{ 2 };
+    };
+
+    //! Stream stack entry that tracks the access pattern of reads per file. When a file is read sequentially or with a
+    //! fixed stride, speculative reads are issued for the predicted next requests. These speculative reads are intended
+    //! to be placed above a cache such as the BlockCache so that by the time the actual request arrives, the data is
+    //! already cached or in-flight.
+    class ReadAhead
+        : public StreamStackEntry
+    {
+    public:
+        ReadAhead(u32 maxTrackedFiles, u32 maxNumReads, u64 maxReadSize, u32 depth, u32 alignment);
+        ReadAhead(ReadAhead&& rhs) = delete;
+        ReadAhead(const ReadAhead& rhs) = delete;
+        ~ReadAhead() override;
+
+        ReadAhead& operator=(ReadAhead&& rhs) = delete;
+        ReadAhead& operator=(const ReadAhead& rhs) = delete;
+
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+        double CalculateHitRatePercentage() const;
+
+    private:
+        //! The access pattern for a single file.
+        struct FilePattern
+        {
+            RequestPath m_path;
+            u64 m_fileSize{ 0 };
+            u64 m_lastOffset{ 0 };
+            u64 m_lastSize{ 0 };
+            //! The furthest offset (in the direction the file is read in) for which a speculative read was issued.
+            u64 m_readAheadOffset{ 0 };
+            //! The offset the next request is expected to read from. Only valid if m_hasPrediction is set.
+            u64 m_expectedOffset{ 0 };
+            //! Used to determine which pattern to replace if the maximum number of tracked files has been reached.
+            u64 m_lastUsed{ 0 };
+            //! The distance between the end of the previous request and the start of the next request. For sequential reads this is 0.
+            s64 m_gap{ 0 };
+            //! The number of consecutive requests that were separated by the same gap.
+            u32 m_confirmations{ 0 };
+            bool m_gapKnown{ false };
+            bool m_hasPrediction{ false };
+            bool m_fileSizeKnown{ false };
+            bool m_fileSizeRequested{ false };
+        };
+
+        //! A speculative read that has been predicted, but hasn't been sent to the next entry in the stack yet.
+        struct PendingRead
+        {
+            RequestPath m_path;
+            u64 m_offset;
+            u64 m_size;
+        };
+
+        //! A slot for a speculative read or the retrieval of the file size needed for it. Requests only store a reference to the
+        //! path, so the slot keeps a copy of the path alive for as long as the request is in flight.
+        struct ReadSlot
+        {
+            RequestPath m_path;
+            FileRequest* m_request{ nullptr };
+        };
+
+        void ReadFile(FileRequest* request, Requests::ReadData& data);
+        void UpdatePattern(FilePattern& pattern, u64 offset, u64 size);
+        void QueueReadAhead(FilePattern& pattern, s64 step);
+        void RequestFileSize(FilePattern& pattern, size_t slot);
+        bool IssuePendingReads();
+
+        FilePattern& FindOrCreatePattern(const RequestPath& filePath);
+        FilePattern* FindPattern(const RequestPath& filePath);
+        size_t FindFreeReadSlot() const;
+
+        void Flush(const RequestPath& filePath);
+        void FlushAll();
+
+        void Report(const Requests::ReportData& data) const;
+
+        AZStd::vector<FilePattern> m_patterns;
+        AZStd::deque<PendingRead> m_pendingReads;
+        //! The speculative reads that are currently in flight. A slot without a request means the associated buffer is available.
+        AZStd::vector<ReadSlot> m_readSlots;
+
+        AZ::Statistics::RunningStatistic m_hitRateStat;
+
+        u8* m_buffer;
+        u64 m_maxReadSize;
+        u64 m_numSpeculativeReads{ 0 };
+        u64 m_clock{ 0 };
+        u32 m_maxTrackedFiles;
+        u32 m_depth;
+        u32 m_alignment;
+        s32 m_numInFlightReads{ 0 };
+    };
+} // namespace AZ::IO
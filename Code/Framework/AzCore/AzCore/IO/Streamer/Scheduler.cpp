@@ -186,6 +186,16 @@ namespace AZ::IO
         recommendations = m_recommendations;
     }
 
+    bool Scheduler::StartTraceRecording(AZStd::string_view filePath)
+    {
+        return m_traceRecorder.Start(filePath);
+    }
+
+    bool Scheduler::StopTraceRecording()
+    {
+        return m_traceRecorder.Stop();
+    }
+
     void Scheduler::Thread_MainLoop()
     {
         m_threadData.m_streamStack->SetContext(m_context);
@@ -427,6 +437,17 @@ namespace AZ::IO
             FileRequest* requestPtr = &request->m_request;
             FileRequest* linkRequest = m_context.GetNewInternalRequest();
             linkRequest->CreateRequestLink(AZStd::move(request));
+            if (m_traceRecorder.IsRecording())
+            {
+                if (auto readRequest = AZStd::get_if<Requests::ReadRequestData>(&requestPtr->GetCommand()); readRequest != nullptr)
+                {
+                    StreamerTraceRecorder::Token token = m_traceRecorder.RecordRead(*readRequest, AZStd::chrono::steady_clock::now());
+                    linkRequest->SetCompletionCallback([this, token](FileRequest& link)
+                        {
+                            m_traceRecorder.RecordCompletion(token, link.GetStatus(), AZStd::chrono::steady_clock::now());
+                        });
+                }
+            }
             requestPtr->SetStatus(IStreamerTypes::RequestStatus::Queued);
             m_threadData.m_streamStack->PrepareRequest(requestPtr);
         }
@@ -13,6 +13,7 @@
 #include <AzCore/IO/Streamer/Statistics.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
 #include <AzCore/IO/Streamer/StreamStackEntry.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/atomic.h>
@@ -64,6 +65,12 @@ namespace AZ::IO
 
         void GetRecommendations(IStreamerTypes::Recommendations& recommendations) const;
 
+        //! Starts recording all read requests that are received into a trace file that can be used to replay the requests.
+        //! If a recording was already in progress it will be stopped and stored first.
+        bool StartTraceRecording(AZStd::string_view filePath);
+        //! Stops an active trace recording and stores the recorded requests.
+        bool StopTraceRecording();
+
     private:
         inline static constexpr u32 ProfilerColor = 0x0080ffff; //!< A lite shade of blue. (See https://www.color-hex.com/color/0080ff).
 
@@ -119,6 +126,8 @@ namespace AZ::IO
         AZ::Statistics::RunningStatistic m_immediateReadsPercentageStat;
 #endif
 
+        StreamerTraceRecorder m_traceRecorder;
+
         AZStd::mutex m_pendingRequestsLock;
         AZStd::vector<FileRequestPtr> m_pendingRequests;
 
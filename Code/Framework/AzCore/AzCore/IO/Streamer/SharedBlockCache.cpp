@@ -0,0 +1,428 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/SharedBlockCache.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/limits.h>
+
+namespace AZ::IO
+{
+    struct SharedBlockCache::Header
+    {
+        // Used to detect if the shared memory has been set up and if it was set up by a compatible version.
+        static constexpr u32 s_signature = 0x53424332; // "SBC2"
+
+        u32 m_signature;
+        u32 m_blockSize;
+        u32 m_numBlocks;
+        u32 m_indexSize;
+        //! The most recently used block.
+        u32 m_lruHead;
+        //! The least recently used block, which is the next one to be recycled.
+        u32 m_lruTail;
+    };
+
+    struct SharedBlockCache::BlockInfo
+    {
+        static constexpr u64 s_emptyKey = 0;
+
+        u64 m_pathKey;
+        u64 m_fileKey;
+        u64 m_offset;
+        u64 m_size;
+        u32 m_prev;
+        u32 m_next;
+    };
+
+    static constexpr u32 s_sharedBlockNotFound = static_cast<u32>(-1);
+
+    namespace SharedBlockCacheInternal
+    {
+        // Keys are stored in shared memory, so they need to be computed the same way in every process.
+        static u64 Mix(u64 value)
+        {
+            value ^= value >> 33;
+            value *= 0xff51afd7ed558ccdull;
+            value ^= value >> 33;
+            value *= 0xc4ceb9fe1a85ec53ull;
+            value ^= value >> 33;
+            return value;
+        }
+
+        static u32 GetIndexSize(u64 numBlocks)
+        {
+            // Keep the index at most half full so probe sequences stay short.
+            u64 indexSize = 2;
+            while (indexSize < numBlocks * 2)
+            {
+                indexSize *= 2;
+            }
+            return aznumeric_cast<u32>(indexSize);
+        }
+    } // namespace SharedBlockCacheInternal
+
+    SharedBlockCache::SharedBlockCache(const char* name, u64 cacheSize, u32 blockSize)
+    {
+        AZ_Assert(blockSize > 0, "The block size for the shared block cache needs to be larger than zero.");
+
+        u64 numBlocks = cacheSize / blockSize;
+        if (numBlocks == 0 || numBlocks >= AZStd::numeric_limits<u32>::max() / 2)
+        {
+            AZ_Warning("Streamer", false, "Unable to create shared block cache '%s' of %llu bytes with blocks of %u bytes.",
+                name, cacheSize, blockSize);
+            return;
+        }
+
+        u32 indexSize = SharedBlockCacheInternal::GetIndexSize(numBlocks);
+        u64 totalSize = sizeof(Header) + numBlocks * (sizeof(BlockInfo) + blockSize) + indexSize * sizeof(u32);
+        if (totalSize > AZStd::numeric_limits<unsigned int>::max())
+        {
+            AZ_Warning("Streamer", false, "Unable to create shared block cache '%s' of %llu bytes with blocks of %u bytes.",
+                name, cacheSize, blockSize);
+            return;
+        }
+
+        if (m_memory.Create(name, aznumeric_cast<unsigned int>(totalSize), true) == SharedMemory::CreateFailed)
+        {
+            AZ_Warning("Streamer", false, "Unable to create or open the shared memory for shared block cache '%s'.", name);
+            return;
+        }
+        if (!m_memory.Map() || m_memory.DataSize() < totalSize)
+        {
+            AZ_Warning("Streamer", false, "Unable to map the shared memory for shared block cache '%s'.", name);
+            m_memory.Close();
+            return;
+        }
+
+        SharedMemory::MemoryGuard lock(m_memory);
+        Header* header = reinterpret_cast<Header*>(m_memory.Data());
+        BlockInfo* blocks = reinterpret_cast<BlockInfo*>(header + 1);
+        u32* index = reinterpret_cast<u32*>(blocks + numBlocks);
+        if (header->m_signature != 0 &&
+            (header->m_signature != Header::s_signature || header->m_blockSize != blockSize || header->m_numBlocks != numBlocks ||
+             header->m_indexSize != indexSize))
+        {
+            AZ_Warning("Streamer", false, "Shared block cache '%s' was created by another process with a different configuration "
+                "(%u blocks of %u bytes instead of %llu blocks of %u bytes). The shared cache will not be used.",
+                name, header->m_numBlocks, header->m_blockSize, numBlocks, blockSize);
+            return;
+        }
+
+        m_header = header;
+        m_blocks = blocks;
+        m_index = index;
+        m_data = reinterpret_cast<u8*>(index + indexSize);
+        m_numBlocks = aznumeric_cast<u32>(numBlocks);
+        m_indexSlotMask = indexSize - 1;
+        m_blockSize = blockSize;
+
+        if (header->m_signature == 0)
+        {
+            // The memory is cleared to zero when it's first created, so this process is the first to use it.
+            header->m_blockSize = blockSize;
+            header->m_numBlocks = m_numBlocks;
+            header->m_indexSize = indexSize;
+            ResetBlocks();
+            header->m_signature = Header::s_signature;
+        }
+    }
+
+    SharedBlockCache::~SharedBlockCache()
+    {
+        m_header = nullptr;
+        m_blocks = nullptr;
+        m_index = nullptr;
+        m_data = nullptr;
+        m_memory.UnMap();
+        m_memory.Close();
+    }
+
+    bool SharedBlockCache::IsReady() const
+    {
+        return m_header != nullptr;
+    }
+
+    bool SharedBlockCache::Read(const RequestPath& filePath, u64 offset, void* output, u64 size)
+    {
+        if (!m_header || size > m_blockSize)
+        {
+            return false;
+        }
+
+        // Look up the file key before taking the lock as it may need to query the file system.
+        u64 fileKey = GetFileKey(filePath, GetPathKey(filePath));
+        if (!m_memory.try_lock())
+        {
+            return false;
+        }
+
+        bool found = false;
+        u32 index = FindBlock(fileKey, offset);
+        if (index != s_sharedBlockNotFound && m_blocks[index].m_size == size)
+        {
+            memcpy(output, m_data + (aznumeric_cast<size_t>(index) * m_blockSize), size);
+            UnlinkBlock(index);
+            LinkBlockAtHead(index);
+            found = true;
+        }
+        m_memory.unlock();
+        return found;
+    }
+
+    void SharedBlockCache::Store(const RequestPath& filePath, u64 offset, const void* data, u64 size)
+    {
+        if (!m_header || size > m_blockSize)
+        {
+            return;
+        }
+
+        u64 pathKey = GetPathKey(filePath);
+        u64 fileKey = GetFileKey(filePath, pathKey);
+        if (!m_memory.try_lock())
+        {
+            return;
+        }
+
+        u32 index = FindBlock(fileKey, offset);
+        if (index == s_sharedBlockNotFound)
+        {
+            // Recycle the least recently used block. Cleared blocks are moved to the end of the list so they're picked first.
+            index = m_header->m_lruTail;
+            if (m_blocks[index].m_fileKey != BlockInfo::s_emptyKey)
+            {
+                RemoveFromIndex(index);
+            }
+
+            BlockInfo& block = m_blocks[index];
+            block.m_pathKey = pathKey;
+            block.m_fileKey = fileKey;
+            block.m_offset = offset;
+            InsertIntoIndex(index);
+        }
+
+        memcpy(m_data + (aznumeric_cast<size_t>(index) * m_blockSize), data, size);
+        m_blocks[index].m_size = size;
+        UnlinkBlock(index);
+        LinkBlockAtHead(index);
+        m_memory.unlock();
+    }
+
+    void SharedBlockCache::Flush(const RequestPath& filePath)
+    {
+        if (!m_header)
+        {
+            return;
+        }
+
+        // The file may have changed, so look up its size and modification time again on the next access.
+        u64 pathKey = GetPathKey(filePath);
+        m_fileKeys.erase(pathKey);
+
+        // Flushing can't be skipped like reads and stores as that could leave stale data behind, so wait for the lock.
+        // Blocks of all versions of the file are removed, so this is the only operation that needs to visit every block.
+        SharedMemory::MemoryGuard lock(m_memory);
+        for (u32 i = 0; i < m_numBlocks; ++i)
+        {
+            if (m_blocks[i].m_fileKey != BlockInfo::s_emptyKey && m_blocks[i].m_pathKey == pathKey)
+            {
+                ClearBlock(i);
+            }
+        }
+    }
+
+    void SharedBlockCache::FlushAll()
+    {
+        if (!m_header)
+        {
+            return;
+        }
+
+        m_fileKeys.clear();
+
+        SharedMemory::MemoryGuard lock(m_memory);
+        ResetBlocks();
+    }
+
+    u32 SharedBlockCache::GetNumBlocks() const
+    {
+        return m_numBlocks;
+    }
+
+    u32 SharedBlockCache::GetBlockSize() const
+    {
+        return m_blockSize;
+    }
+
+    u64 SharedBlockCache::GetPathKey(const RequestPath& filePath)
+    {
+        // The hash of the path is stable across processes.
+        return aznumeric_cast<u64>(filePath.GetHash());
+    }
+
+    u64 SharedBlockCache::GetFileKey(const RequestPath& filePath, u64 pathKey)
+    {
+        auto it = m_fileKeys.find(pathKey);
+        if (it != m_fileKeys.end())
+        {
+            return it->second;
+        }
+
+        const char* absolutePath = filePath.GetAbsolutePathCStr();
+        u64 fileSize = aznumeric_cast<u64>(SystemFile::Length(absolutePath));
+        u64 modificationTime = SystemFile::ModificationTime(absolutePath);
+
+        using SharedBlockCacheInternal::Mix;
+        u64 fileKey = Mix(pathKey ^ Mix(fileSize ^ Mix(modificationTime)));
+        // Zero is reserved for empty blocks.
+        fileKey = fileKey != BlockInfo::s_emptyKey ? fileKey : 1;
+        m_fileKeys.emplace(pathKey, fileKey);
+        return fileKey;
+    }
+
+    u32 SharedBlockCache::GetIndexSlot(u64 fileKey, u64 offset) const
+    {
+        return aznumeric_cast<u32>(SharedBlockCacheInternal::Mix(fileKey ^ SharedBlockCacheInternal::Mix(offset)) & m_indexSlotMask);
+    }
+
+    u32 SharedBlockCache::FindBlock(u64 fileKey, u64 offset) const
+    {
+        // The index is never more than half full, so there's always an empty slot to end the search.
+        for (u32 slot = GetIndexSlot(fileKey, offset); m_index[slot] != 0; slot = (slot + 1) & m_indexSlotMask)
+        {
+            const u32 blockIndex = m_index[slot] - 1;
+            if (m_blocks[blockIndex].m_fileKey == fileKey && m_blocks[blockIndex].m_offset == offset)
+            {
+                return blockIndex;
+            }
+        }
+        return s_sharedBlockNotFound;
+    }
+
+    void SharedBlockCache::InsertIntoIndex(u32 blockIndex)
+    {
+        const BlockInfo& block = m_blocks[blockIndex];
+        u32 slot = GetIndexSlot(block.m_fileKey, block.m_offset);
+        while (m_index[slot] != 0)
+        {
+            slot = (slot + 1) & m_indexSlotMask;
+        }
+        m_index[slot] = blockIndex + 1;
+    }
+
+    void SharedBlockCache::RemoveFromIndex(u32 blockIndex)
+    {
+        const BlockInfo& block = m_blocks[blockIndex];
+        u32 hole = GetIndexSlot(block.m_fileKey, block.m_offset);
+        while (m_index[hole] != blockIndex + 1)
+        {
+            AZ_Assert(m_index[hole] != 0, "Block %u is missing from the shared block cache index.", blockIndex);
+            hole = (hole + 1) & m_indexSlotMask;
+        }
+
+        // Shift later entries of the probe sequence back into the hole so lookups don't stop early.
+        for (u32 slot = (hole + 1) & m_indexSlotMask; m_index[slot] != 0; slot = (slot + 1) & m_indexSlotMask)
+        {
+            const BlockInfo& movedBlock = m_blocks[m_index[slot] - 1];
+            const u32 home = GetIndexSlot(movedBlock.m_fileKey, movedBlock.m_offset);
+            if (((slot - home) & m_indexSlotMask) >= ((slot - hole) & m_indexSlotMask))
+            {
+                m_index[hole] = m_index[slot];
+                hole = slot;
+            }
+        }
+        m_index[hole] = 0;
+    }
+
+    void SharedBlockCache::UnlinkBlock(u32 blockIndex)
+    {
+        BlockInfo& block = m_blocks[blockIndex];
+        if (block.m_prev != s_sharedBlockNotFound)
+        {
+            m_blocks[block.m_prev].m_next = block.m_next;
+        }
+        else
+        {
+            m_header->m_lruHead = block.m_next;
+        }
+
+        if (block.m_next != s_sharedBlockNotFound)
+        {
+            m_blocks[block.m_next].m_prev = block.m_prev;
+        }
+        else
+        {
+            m_header->m_lruTail = block.m_prev;
+        }
+        block.m_prev = s_sharedBlockNotFound;
+        block.m_next = s_sharedBlockNotFound;
+    }
+
+    void SharedBlockCache::LinkBlockAtHead(u32 blockIndex)
+    {
+        BlockInfo& block = m_blocks[blockIndex];
+        block.m_prev = s_sharedBlockNotFound;
+        block.m_next = m_header->m_lruHead;
+        if (m_header->m_lruHead != s_sharedBlockNotFound)
+        {
+            m_blocks[m_header->m_lruHead].m_prev = blockIndex;
+        }
+        else
+        {
+            m_header->m_lruTail = blockIndex;
+        }
+        m_header->m_lruHead = blockIndex;
+    }
+
+    void SharedBlockCache::LinkBlockAtTail(u32 blockIndex)
+    {
+        BlockInfo& block = m_blocks[blockIndex];
+        block.m_next = s_sharedBlockNotFound;
+        block.m_prev = m_header->m_lruTail;
+        if (m_header->m_lruTail != s_sharedBlockNotFound)
+        {
+            m_blocks[m_header->m_lruTail].m_next = blockIndex;
+        }
+        else
+        {
+            m_header->m_lruHead = blockIndex;
+        }
+        m_header->m_lruTail = blockIndex;
+    }
+
+    void SharedBlockCache::ClearBlock(u32 blockIndex)
+    {
+        RemoveFromIndex(blockIndex);
+
+        BlockInfo& block = m_blocks[blockIndex];
+        block.m_pathKey = 0;
+        block.m_fileKey = BlockInfo::s_emptyKey;
+        block.m_offset = 0;
+        block.m_size = 0;
+        UnlinkBlock(blockIndex);
+        LinkBlockAtTail(blockIndex);
+    }
+
+    void SharedBlockCache::ResetBlocks()
+    {
+        memset(m_index, 0, (aznumeric_cast<size_t>(m_indexSlotMask) + 1) * sizeof(u32));
+        for (u32 i = 0; i < m_numBlocks; ++i)
+        {
+            BlockInfo& block = m_blocks[i];
+            block.m_pathKey = 0;
+            block.m_fileKey = BlockInfo::s_emptyKey;
+            block.m_offset = 0;
+            block.m_size = 0;
+            block.m_prev = i > 0 ? i - 1 : s_sharedBlockNotFound;
+            block.m_next = i + 1 < m_numBlocks ? i + 1 : s_sharedBlockNotFound;
+        }
+        m_header->m_lruHead = 0;
+        m_header->m_lruTail = m_numBlocks - 1;
+    }
+} // namespace AZ::IO
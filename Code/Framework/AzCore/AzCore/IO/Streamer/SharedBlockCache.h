@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IPC/SharedMemory.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+
+namespace AZ::IO
+{
+    class RequestPath;
+
+    //! Cache of file blocks that lives in shared memory so processes on the same machine can reuse blocks that
+    //! were read from disk by any of them. Blocks are identified by the hash of the absolute file path, the size and
+    //! modification time of the file, and the offset of the block in the file. Including the file's identity means a
+    //! process never reads blocks that another process cached for an older version of the file. Each process looks up
+    //! the identity of a file once and keeps it until the file is flushed from the cache.
+    //! Blocks are found through a hash index and recycled through a least recently used list, both in the shared memory,
+    //! so no operation except flushing scans all blocks while holding the lock.
+    //! The cache is guarded by the inter-process lock of the shared memory, but it's only ever try-locked so the
+    //! streamer thread never has to wait for another process. If the lock is taken, the cache is treated as a
+    //! miss or the block isn't stored.
+    class SharedBlockCache
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SharedBlockCache, AZ::SystemAllocator);
+
+        //! Creates or opens the shared cache with the given name. All processes that open the same cache need to use
+        //! the same block size and cache size, otherwise the cache will be disabled in the processes that don't match.
+        SharedBlockCache(const char* name, u64 cacheSize, u32 blockSize);
+        ~SharedBlockCache();
+
+        SharedBlockCache(const SharedBlockCache&) = delete;
+        SharedBlockCache& operator=(const SharedBlockCache&) = delete;
+
+        //! Returns true if the shared memory could be set up and is compatible with this cache.
+        bool IsReady() const;
+
+        //! Copies the block at the given offset into the output buffer if the cache has it stored with exactly the requested size.
+        bool Read(const RequestPath& filePath, u64 offset, void* output, u64 size);
+        //! Stores a block in the cache, recycling the least recently used block if the block isn't already cached.
+        void Store(const RequestPath& filePath, u64 offset, const void* data, u64 size);
+        //! Removes all blocks that belong to the given file.
+        void Flush(const RequestPath& filePath);
+        //! Removes all blocks from the cache.
+        void FlushAll();
+
+        u32 GetNumBlocks() const;
+        u32 GetBlockSize() const;
+
+    private:
+        struct Header;
+        struct BlockInfo;
+
+        static u64 GetPathKey(const RequestPath& filePath);
+        //! Returns the key of the file's current version, looking up its size and modification time the first time.
+        u64 GetFileKey(const RequestPath& filePath, u64 pathKey);
+        u32 GetIndexSlot(u64 fileKey, u64 offset) const;
+
+        u32 FindBlock(u64 fileKey, u64 offset) const;
+        void InsertIntoIndex(u32 blockIndex);
+        void RemoveFromIndex(u32 blockIndex);
+
+        void UnlinkBlock(u32 blockIndex);
+        void LinkBlockAtHead(u32 blockIndex);
+        void LinkBlockAtTail(u32 blockIndex);
+        //! Clears the block and moves it to the end of the recycle list so it's reused first.
+        void ClearBlock(u32 blockIndex);
+        //! Clears all blocks and the index. The lock needs to be held, or the memory not yet shared.
+        void ResetBlocks();
+
+        //! The file keys of the files used by this process. Only accessed from the streamer thread.
+        AZStd::unordered_map<u64, u64> m_fileKeys;
+
+        SharedMemory m_memory;
+        Header* m_header{ nullptr };
+        BlockInfo* m_blocks{ nullptr };
+        //! Open addressing hash table with linear probing. Each slot stores a block index plus one, or zero if it's empty.
+        u32* m_index{ nullptr };
+        u8* m_data{ nullptr };
+        u32 m_numBlocks{ 0 };
+        u32 m_indexSlotMask{ 0 };
+        u32 m_blockSize{ 0 };
+    };
+} // namespace AZ::IO
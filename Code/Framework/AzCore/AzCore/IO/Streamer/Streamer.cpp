@@ -252,6 +252,16 @@ namespace AZ::IO
         return m_streamStack->IsSuspended();
     }
 
+    bool Streamer::StartTraceRecording(AZStd::string_view filePath)
+    {
+        return m_streamStack->StartTraceRecording(filePath);
+    }
+
+    bool Streamer::StopTraceRecording()
+    {
+        return m_streamStack->StopTraceRecording();
+    }
+
     void Streamer::RecordStatistics()
     {
         AZStd::vector<Statistic> statistics;
@@ -199,6 +199,11 @@ namespace AZ::IO
         //! Records the statistics to a profiler.
         void RecordStatistics();
 
+        //! Starts recording all read requests into a trace file. See StreamerTrace for details.
+        bool StartTraceRecording(AZStd::string_view filePath);
+        //! Stops recording read requests and stores the trace to the file provided to StartTraceRecording.
+        bool StopTraceRecording();
+
         Streamer(const AZStd::thread_desc& threadDesc, AZStd::unique_ptr<Scheduler> streamStack);
         ~Streamer() override;
 
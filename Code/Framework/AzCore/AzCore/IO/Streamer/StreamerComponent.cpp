@@ -10,11 +10,14 @@
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/ProfilerBus.h>
 #include <AzCore/Math/Crc.h>
+#include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/IStreamer.h>
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/Streamer/BlockCache.h>
 #include <AzCore/IO/Streamer/DedicatedCache.h>
 #include <AzCore/IO/Streamer/FullFileDecompressor.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/ReadAhead.h>
 #include <AzCore/IO/Streamer/Scheduler.h>
 #include <AzCore/IO/Streamer/StreamerComponent.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
@@ -199,6 +202,7 @@ namespace AZ
         DedicatedCacheConfig::Reflect(context);
         IStreamerStackConfig::Reflect(context);
         FullFileDecompressorConfig::Reflect(context);
+        ReadAheadConfig::Reflect(context);
         ReadSplitterConfig::Reflect(context);
         StorageDriveConfig::Reflect(context);
         StreamerConfig::Reflect(context);
@@ -241,4 +245,37 @@ namespace AZ
             m_streamer->QueueRequest(m_streamer->FlushCaches());
         }
     }
+
+    void StreamerComponent::StartStreamerTrace(const AZ::ConsoleCommandContainer& someStrings)
+    {
+        if (m_streamer)
+        {
+            if (someStrings.empty())
+            {
+                AZ_Printf("Streamer", "StartStreamerTrace requires the path to the file to store the trace in.\n");
+                return;
+            }
+            AZ::IO::FixedMaxPath path;
+            if (!AZ::IO::FileIOBase::GetInstance() ||
+                !AZ::IO::FileIOBase::GetInstance()->ResolvePath(path, AZ::IO::PathView(someStrings.front())))
+            {
+                path = someStrings.front();
+            }
+            if (m_streamer->StartTraceRecording(path.Native()))
+            {
+                AZ_Printf("Streamer", "Started recording Streamer trace to '%s'.\n", path.c_str());
+            }
+        }
+    }
+
+    void StreamerComponent::StopStreamerTrace(const AZ::ConsoleCommandContainer&)
+    {
+        if (m_streamer)
+        {
+            if (!m_streamer->StopTraceRecording())
+            {
+                AZ_Printf("Streamer", "No Streamer trace was being recorded or the trace couldn't be stored.\n");
+            }
+        }
+    }
 } // namespace AZ
@@ -49,11 +49,17 @@ namespace AZ
 
         void ReportFileLocks(const AZ::ConsoleCommandContainer& someStrings);
         void FlushCaches(const AZ::ConsoleCommandContainer& someStrings);
+        void StartStreamerTrace(const AZ::ConsoleCommandContainer& someStrings);
+        void StopStreamerTrace(const AZ::ConsoleCommandContainer& someStrings);
 
         AZ_CONSOLEFUNC(StreamerComponent, ReportFileLocks, AZ::ConsoleFunctorFlags::Null,
             "Reports the files currently locked by AZ::IO::Streamer");
         AZ_CONSOLEFUNC(StreamerComponent, FlushCaches, AZ::ConsoleFunctorFlags::Null,
             "Flushes all caches used inside AZ::IO::Streamer");
+        AZ_CONSOLEFUNC(StreamerComponent, StartStreamerTrace, AZ::ConsoleFunctorFlags::Null,
+            "Starts recording all read requests to AZ::IO::Streamer to the provided file");
+        AZ_CONSOLEFUNC(StreamerComponent, StopStreamerTrace, AZ::ConsoleFunctorFlags::Null,
+            "Stops recording read requests to AZ::IO::Streamer and stores the trace");
         
         AZStd::unique_ptr<AZ::IO::Streamer> m_streamer;
         int m_deviceThreadCpuId;
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/limits.h>
+
+namespace AZ::IO
+{
+    namespace StreamerTraceInternal
+    {
+        static constexpr u32 Signature = 0x5453415A; // "ZAST"
+        static constexpr u32 Version = 1;
+        // Stored in place of the deadline if a request didn't have a deadline.
+        static constexpr s64 NoDeadline = -1;
+
+#pragma pack(push, 1)
+        struct Header
+        {
+            u32 m_signature;
+            u32 m_version;
+            u32 m_pathCount;
+            u32 m_readCount;
+        };
+
+        struct ReadRecord
+        {
+            s64 m_issueTimeUs;
+            s64 m_completionTimeUs;
+            s64 m_deadlineUs;
+            u64 m_offset;
+            u64 m_size;
+            u32 m_pathIndex;
+            u8 m_priority;
+            u8 m_status;
+        };
+#pragma pack(pop)
+        static_assert(sizeof(ReadRecord) == 46, "StreamerTrace read records are expected to be tightly packed.");
+
+        template<typename T>
+        void Append(AZStd::vector<u8>& buffer, const T& value)
+        {
+            const u8* bytes = reinterpret_cast<const u8*>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        template<typename T>
+        bool Extract(const AZStd::vector<u8>& buffer, size_t& offset, T& value)
+        {
+            if (offset + sizeof(T) > buffer.size())
+            {
+                return false;
+            }
+            memcpy(&value, buffer.data() + offset, sizeof(T));
+            offset += sizeof(T);
+            return true;
+        }
+    } // namespace StreamerTraceInternal
+
+    //
+    // StreamerTrace
+    //
+
+    bool StreamerTrace::Load(const char* filePath)
+    {
+        using namespace StreamerTraceInternal;
+
+        m_paths.clear();
+        m_reads.clear();
+
+        SystemFile file;
+        if (!file.Open(filePath, SystemFile::SF_OPEN_READ_ONLY))
+        {
+            AZ_Warning("Streamer", false, "Unable to open Streamer trace '%s'.", filePath);
+            return false;
+        }
+        AZStd::vector<u8> buffer;
+        buffer.resize_no_construct(file.Length());
+        if (file.Read(buffer.size(), buffer.data()) != buffer.size())
+        {
+            AZ_Warning("Streamer", false, "Unable to read Streamer trace '%s'.", filePath);
+            return false;
+        }
+        file.Close();
+
+        size_t offset = 0;
+        Header header;
+        if (!Extract(buffer, offset, header) || header.m_signature != Signature || header.m_version != Version)
+        {
+            AZ_Warning("Streamer", false, "File '%s' is not a Streamer trace or was recorded with an unsupported version.", filePath);
+            return false;
+        }
+
+        m_paths.reserve(header.m_pathCount);
+        for (u32 i = 0; i < header.m_pathCount; ++i)
+        {
+            u16 length;
+            if (!Extract(buffer, offset, length) || offset + length > buffer.size())
+            {
+                AZ_Warning("Streamer", false, "Streamer trace '%s' is truncated.", filePath);
+                return false;
+            }
+            m_paths.emplace_back(reinterpret_cast<const char*>(buffer.data() + offset), length);
+            offset += length;
+        }
+
+        m_reads.reserve(header.m_readCount);
+        for (u32 i = 0; i < header.m_readCount; ++i)
+        {
+            ReadRecord record;
+            if (!Extract(buffer, offset, record) || record.m_pathIndex >= m_paths.size())
+            {
+                AZ_Warning("Streamer", false, "Streamer trace '%s' is truncated or corrupted.", filePath);
+                return false;
+            }
+
+            Read& read = m_reads.emplace_back();
+            read.m_issueTime = AZStd::chrono::microseconds(record.m_issueTimeUs);
+            read.m_completionTime = AZStd::chrono::microseconds(record.m_completionTimeUs);
+            read.m_deadline = record.m_deadlineUs == NoDeadline ? IStreamerTypes::s_noDeadline : IStreamerTypes::Deadline(record.m_deadlineUs);
+            read.m_offset = record.m_offset;
+            read.m_size = record.m_size;
+            read.m_pathIndex = record.m_pathIndex;
+            read.m_priority = record.m_priority;
+            read.m_status = static_cast<IStreamerTypes::RequestStatus>(record.m_status);
+        }
+        return true;
+    }
+
+    bool StreamerTrace::Save(const char* filePath) const
+    {
+        using namespace StreamerTraceInternal;
+
+        AZStd::vector<u8> buffer;
+        buffer.reserve(sizeof(Header) + m_reads.size() * sizeof(ReadRecord));
+
+        Header header;
+        header.m_signature = Signature;
+        header.m_version = Version;
+        header.m_pathCount = aznumeric_cast<u32>(m_paths.size());
+        header.m_readCount = aznumeric_cast<u32>(m_reads.size());
+        Append(buffer, header);
+
+        for (const AZStd::string& path : m_paths)
+        {
+            AZ_Assert(path.size() <= AZStd::numeric_limits<u16>::max(), "Path '%s' is too long to be stored in a Streamer trace.", path.c_str());
+            u16 length = aznumeric_cast<u16>(path.size());
+            Append(buffer, length);
+            buffer.insert(buffer.end(), path.begin(), path.end());
+        }
+
+        for (const Read& read : m_reads)
+        {
+            ReadRecord record;
+            record.m_issueTimeUs = read.m_issueTime.count();
+            record.m_completionTimeUs = read.m_completionTime.count();
+            record.m_deadlineUs = read.m_deadline == IStreamerTypes::s_noDeadline ? NoDeadline : read.m_deadline.count();
+            record.m_offset = read.m_offset;
+            record.m_size = read.m_size;
+            record.m_pathIndex = read.m_pathIndex;
+            record.m_priority = read.m_priority;
+            record.m_status = aznumeric_cast<u8>(read.m_status);
+            Append(buffer, record);
+        }
+
+        SystemFile file;
+        if (!file.Open(filePath, SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH | SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Streamer", false, "Unable to create Streamer trace '%s'.", filePath);
+            return false;
+        }
+        bool result = file.Write(buffer.data(), buffer.size()) == buffer.size();
+        AZ_Warning("Streamer", result, "Unable to write all data to Streamer trace '%s'.", filePath);
+        file.Close();
+        return result;
+    }
+
+    //
+    // StreamerTraceRecorder
+    //
+
+    bool StreamerTraceRecorder::Start(AZStd::string_view filePath)
+    {
+        if (filePath.empty())
+        {
+            return false;
+        }
+
+        Stop();
+
+        AZStd::scoped_lock lock(m_lock);
+        m_filePath = filePath;
+        m_trace = StreamerTrace{};
+        m_pathIndices.clear();
+        m_startTime = AZStd::chrono::steady_clock::now();
+        // The session is stored in the upper half of the token and never 0 so tokens can't be equal to s_invalidToken.
+        if (++m_session == 0)
+        {
+            m_session = 1;
+        }
+        m_isRecording = true;
+        return true;
+    }
+
+    bool StreamerTraceRecorder::Stop()
+    {
+        AZStd::scoped_lock lock(m_lock);
+        if (!m_isRecording)
+        {
+            return false;
+        }
+        m_isRecording = false;
+
+        bool result = m_trace.Save(m_filePath.c_str());
+        AZ_TracePrintf("Streamer", "Stored %zu read requests in Streamer trace '%s'.\n", m_trace.m_reads.size(), m_filePath.c_str());
+
+        m_trace = StreamerTrace{};
+        m_pathIndices.clear();
+        return result;
+    }
+
+    bool StreamerTraceRecorder::IsRecording() const
+    {
+        return m_isRecording;
+    }
+
+    auto StreamerTraceRecorder::RecordRead(const Requests::ReadRequestData& request, AZStd::chrono::steady_clock::time_point now) -> Token
+    {
+        AZStd::scoped_lock lock(m_lock);
+        if (!m_isRecording)
+        {
+            return s_invalidToken;
+        }
+
+        // Use the absolute path so the trace can be replayed without needing to have the same aliases set up.
+        AZStd::string path(request.m_path.GetAbsolutePath().Native());
+        auto [pathIt, inserted] = m_pathIndices.try_emplace(AZStd::move(path), aznumeric_cast<u32>(m_trace.m_paths.size()));
+        if (inserted)
+        {
+            m_trace.m_paths.push_back(pathIt->first);
+        }
+
+        StreamerTrace::Read& read = m_trace.m_reads.emplace_back();
+        read.m_issueTime = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(now - m_startTime);
+        if (request.m_deadline != AZStd::chrono::steady_clock::time_point::max())
+        {
+            read.m_deadline = request.m_deadline > now
+                ? AZStd::chrono::duration_cast<IStreamerTypes::Deadline>(request.m_deadline - now)
+                : IStreamerTypes::s_deadlineNow;
+        }
+        read.m_offset = request.m_offset;
+        read.m_size = request.m_size;
+        read.m_pathIndex = pathIt->second;
+        read.m_priority = request.m_priority;
+
+        // The index is stored with an offset of one so the token can never be s_invalidToken.
+        return (aznumeric_cast<u64>(m_session) << 32) | aznumeric_cast<u64>(m_trace.m_reads.size());
+    }
+
+    void StreamerTraceRecorder::RecordCompletion(Token token, IStreamerTypes::RequestStatus status,
+        AZStd::chrono::steady_clock::time_point now)
+    {
+        AZStd::scoped_lock lock(m_lock);
+        u32 session = aznumeric_cast<u32>(token >> 32);
+        size_t index = aznumeric_cast<size_t>(token & 0xffffffff);
+        if (m_isRecording && session == m_session && index > 0 && index <= m_trace.m_reads.size())
+        {
+            StreamerTrace::Read& read = m_trace.m_reads[index - 1];
+            read.m_completionTime = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(now - m_startTime);
+            read.m_status = status;
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ::IO
+{
+    namespace Requests
+    {
+        struct ReadRequestData;
+    } // namespace Requests
+
+    //! A captured sequence of read requests issued to AZ::IO::Streamer. Traces can be recorded with StreamerTraceRecorder and
+    //! stored as a compact binary file, which can be used to replay the exact same requests against different stream stack
+    //! configurations.
+    struct StreamerTrace
+    {
+        struct Read
+        {
+            //! The time the request was received by the scheduler, relative to the start of the recording.
+            AZStd::chrono::microseconds m_issueTime{ 0 };
+            //! The time the request completed, relative to the start of the recording. Zero if the request didn't complete
+            //! before the recording was stopped.
+            AZStd::chrono::microseconds m_completionTime{ 0 };
+            //! The deadline relative to the issue time or IStreamerTypes::s_noDeadline if the request had no deadline.
+            IStreamerTypes::Deadline m_deadline{ IStreamerTypes::s_noDeadline };
+            u64 m_offset{ 0 };
+            u64 m_size{ 0 };
+            //! Index into StreamerTrace::m_paths.
+            u32 m_pathIndex{ 0 };
+            IStreamerTypes::Priority m_priority{ IStreamerTypes::s_priorityMedium };
+            IStreamerTypes::RequestStatus m_status{ IStreamerTypes::RequestStatus::Pending };
+        };
+
+        //! Loads a trace previously stored with Save. Returns false if the file couldn't be read or isn't a valid trace.
+        bool Load(const char* filePath);
+        //! Stores the trace as a binary file.
+        bool Save(const char* filePath) const;
+
+        AZStd::vector<AZStd::string> m_paths;
+        AZStd::vector<Read> m_reads;
+    };
+
+    //! Records the read requests that are received by the scheduler. Starting and stopping can be done from any thread, but
+    //! recording requests is expected to be done only by the scheduler thread.
+    class StreamerTraceRecorder
+    {
+    public:
+        //! Token that's used to associate a completion with the recorded request.
+        using Token = u64;
+        inline static constexpr Token s_invalidToken = 0;
+
+        //! Starts a new recording. If a recording was already in progress, it's stopped and stored first.
+        bool Start(AZStd::string_view filePath);
+        //! Stops the recording and stores the captured trace to the file provided to Start.
+        bool Stop();
+        bool IsRecording() const;
+
+        //! Records a new read request. The returned token should be passed to RecordCompletion once the request completes.
+        Token RecordRead(const Requests::ReadRequestData& request, AZStd::chrono::steady_clock::time_point now);
+        //! Records the completion of a previously recorded read request. Completions for recordings that have
+        //! already been stopped are ignored.
+        void RecordCompletion(Token token, IStreamerTypes::RequestStatus status, AZStd::chrono::steady_clock::time_point now);
+
+    private:
+        AZStd::mutex m_lock;
+        StreamerTrace m_trace;
+        AZStd::unordered_map<AZStd::string, u32> m_pathIndices;
+        AZStd::string m_filePath;
+        AZStd::chrono::steady_clock::time_point m_startTime;
+        //! Incremented for every recording so completions from previous recordings can be detected.
+        u32 m_session{ 0 };
+        AZStd::atomic_bool m_isRecording{ false };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Task/TaskCoroutine.h>
+
+#if defined(AZ_TASK_COROUTINES_SUPPORTED)
+
+#include <AzCore/IO/IStreamer.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+
+namespace AZ::IO
+{
+    //! Awaiting this queues the request with the streamer and suspends the coroutine until the request completes. The
+    //! coroutine is resumed on the given task executor rather than the streamer thread, so it can do further processing
+    //! without holding up other requests. The result of co_await is the final status of the request.
+    //! The request must not have been queued yet and must not have a completion callback set.
+    //!
+    //!     AZ::TaskCoroutine LoadFile(AZ::IO::IStreamer& streamer, AZ::IO::FileRequestPtr request)
+    //!     {
+    //!         AZ::IO::IStreamerTypes::RequestStatus status = co_await AZ::IO::QueueAndAwait(streamer, request);
+    //!         ...
+    //!     }
+    class StreamerRequestAwaiter final
+    {
+    public:
+        StreamerRequestAwaiter(IStreamer& streamer, FileRequestPtr request, TaskExecutor& resumeOn)
+            : m_streamer{ streamer }
+            , m_request{ AZStd::move(request) }
+            , m_executor{ resumeOn }
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            m_streamer.SetRequestCompleteCallback(
+                m_request,
+                [handle, executor = &m_executor](FileRequestHandle)
+                {
+                    AZ::Internal::ResumeCoroutineOnExecutor(*executor, AZ::Internal::ResumeCoroutineTaskDescriptor, handle);
+                });
+            m_streamer.QueueRequest(m_request);
+        }
+        IStreamerTypes::RequestStatus await_resume() const
+        {
+            return m_streamer.GetRequestStatus(m_request);
+        }
+
+    private:
+        IStreamer& m_streamer;
+        FileRequestPtr m_request;
+        TaskExecutor& m_executor;
+    };
+
+    inline StreamerRequestAwaiter QueueAndAwait(
+        IStreamer& streamer, FileRequestPtr request, TaskExecutor& resumeOn = TaskExecutor::Instance())
+    {
+        return { streamer, AZStd::move(request), resumeOn };
+    }
+} // namespace AZ::IO
+
+#endif // defined(AZ_TASK_COROUTINES_SUPPORTED)
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ::IO
+{
+    //! Implements the rapidjson::Stream concept for reading.
+    //! The stream is read in blocks of the cache size, so rapidjson can parse a document while it's being read instead of
+    //! needing the whole text in memory next to the document that's being built.
+    class RapidJSONStreamReader final
+    {
+    public:
+        using Ch = char;    //!< Character type. Only support char.
+
+        explicit RapidJSONStreamReader(AZ::IO::GenericStream* stream, size_t readCacheSize = 64 * 1024)
+            : m_stream(stream)
+        {
+            // One extra character for the null terminator rapidjson expects at the end of the stream
+            m_cache.resize_no_construct(AZStd::max<size_t>(readCacheSize, 1) + 1);
+            FillCache();
+        }
+
+        RapidJSONStreamReader(const RapidJSONStreamReader&) = delete;
+        RapidJSONStreamReader& operator=(const RapidJSONStreamReader&) = delete;
+
+        char Peek() const
+        {
+            return m_cache[m_cachePosition];
+        }
+
+        char Take()
+        {
+            char c = m_cache[m_cachePosition];
+            // Once the end of the stream is reached the position stays on the null terminator
+            if (m_cachePosition < m_cacheSize)
+            {
+                ++m_cachePosition;
+                if (m_cachePosition == m_cacheSize && !m_endOfStream)
+                {
+                    FillCache();
+                }
+            }
+            return c;
+        }
+
+        size_t Tell() const
+        {
+            return m_cacheOffset + m_cachePosition;
+        }
+
+        //! Returns the 1-based line of a character that was read from the stream, such as the error offset of a failed parse.
+        //! Offsets before the last block that was read return the first line of that block.
+        size_t GetLineNumber(size_t offset) const
+        {
+            const size_t cacheEnd = offset > m_cacheOffset ? AZStd::min(offset - m_cacheOffset, m_cacheSize) : 0;
+            return m_lineCount + 1 + CountLineBreaks(cacheEnd);
+        }
+
+        // Not implemented
+        void Put(char)
+        {
+            AZ_Assert(false, "RapidJSONStreamReader Put not supported.");
+        }
+        void Flush()
+        {
+            AZ_Assert(false, "RapidJSONStreamReader Flush not supported.");
+        }
+        char* PutBegin()
+        {
+            AZ_Assert(false, "RapidJSONStreamReader PutBegin not supported.");
+            return nullptr;
+        }
+        size_t PutEnd(char*)
+        {
+            AZ_Assert(false, "RapidJSONStreamReader PutEnd not supported.");
+            return 0;
+        }
+
+    private:
+        size_t CountLineBreaks(size_t cacheEnd) const
+        {
+            return AZStd::count_if(m_cache.begin(), m_cache.begin() + cacheEnd, [](char c) { return c == '\n'; });
+        }
+
+        void FillCache()
+        {
+            m_lineCount += CountLineBreaks(m_cacheSize);
+            m_cacheOffset += m_cacheSize;
+            m_cachePosition = 0;
+
+            const size_t readSize = m_cache.size() - 1;
+            m_cacheSize = static_cast<size_t>(m_stream->Read(readSize, m_cache.data()));
+            if (m_cacheSize < readSize)
+            {
+                // Peeking past the end of the stream returns the null terminator
+                m_cache[m_cacheSize] = 0;
+                m_endOfStream = true;
+            }
+        }
+
+        AZ::IO::GenericStream* m_stream;
+        AZStd::vector<char> m_cache;
+        size_t m_cacheSize = 0; //!< Number of characters read into the cache
+        size_t m_cachePosition = 0;
+        size_t m_cacheOffset = 0; //!< Stream offset of the first character in the cache
+        size_t m_lineCount = 0; //!< Number of line breaks before the cache
+        bool m_endOfStream = false;
+    };
+}   // namespace AZ::IO
@@ -253,4 +253,151 @@ namespace AZ
             IntersectThreePlanes(GetPlane(Far), GetPlane(Bottom), GetPlane(Right), corners[FarBottomRight])
             ;
     }
+
+    namespace Internal
+    {
+        // A frustum plane splatted across registers, along with which box extents give the closest and furthest corners.
+        struct FrustumBatchPlane
+        {
+            Simd::Vec4::FloatType m_normalX;
+            Simd::Vec4::FloatType m_normalY;
+            Simd::Vec4::FloatType m_normalZ;
+            Simd::Vec4::FloatType m_distance;
+            Simd::Vec4::Int32Type m_planeBit;
+            bool m_positiveX;
+            bool m_positiveY;
+            bool m_positiveZ;
+        };
+    }
+
+    uint32_t Frustum::IntersectAabbs(
+        const AabbBatch& aabbs,
+        AZStd::span<uint32_t> outVisibility,
+        uint32_t planeMask,
+        AZStd::span<uint8_t> outInteriorPlaneMasks) const
+    {
+        const size_t count = aabbs.m_minX.size();
+        AZ_MATH_ASSERT(
+            aabbs.m_minY.size() == count && aabbs.m_minZ.size() == count && aabbs.m_maxX.size() == count &&
+                aabbs.m_maxY.size() == count && aabbs.m_maxZ.size() == count,
+            "All Aabb component spans must have the same size");
+        AZ_MATH_ASSERT(outVisibility.size() >= (count + 31) / 32, "Visibility output span is too small for the number of Aabbs");
+        AZ_MATH_ASSERT(
+            outInteriorPlaneMasks.empty() || outInteriorPlaneMasks.size() == count,
+            "Interior plane mask output span must be empty or have one element per Aabb");
+
+        constexpr size_t GroupSize = Simd::Vec4::ElementCount;
+        AZStd::fill(outVisibility.begin(), outVisibility.begin() + (count + 31) / 32, 0u);
+
+        Internal::FrustumBatchPlane planes[PlaneId::MAX];
+        uint32_t testedPlaneCount = 0;
+        for (PlaneId i = PlaneId::Near; i < PlaneId::MAX; ++i)
+        {
+            if ((planeMask & (1u << i)) == 0)
+            {
+                continue;
+            }
+            const Vector4 plane(m_planes[i]);
+            Internal::FrustumBatchPlane& batchPlane = planes[testedPlaneCount++];
+            batchPlane.m_normalX = Simd::Vec4::Splat(plane.GetX());
+            batchPlane.m_normalY = Simd::Vec4::Splat(plane.GetY());
+            batchPlane.m_normalZ = Simd::Vec4::Splat(plane.GetZ());
+            batchPlane.m_distance = Simd::Vec4::Splat(plane.GetW());
+            batchPlane.m_planeBit = Simd::Vec4::Splat(static_cast<int32_t>(1u << i));
+            batchPlane.m_positiveX = plane.GetX() > 0.0f;
+            batchPlane.m_positiveY = plane.GetY() > 0.0f;
+            batchPlane.m_positiveZ = plane.GetZ() > 0.0f;
+        }
+
+        const Simd::Vec4::FloatType zero = Simd::Vec4::ZeroFloat();
+        const Simd::Vec4::FloatType one = Simd::Vec4::Splat(1.0f);
+        uint32_t coherentPlane = 0;
+        uint32_t visibleCount = 0;
+
+        for (size_t groupStart = 0; groupStart < count; groupStart += GroupSize)
+        {
+            Simd::Vec4::FloatType minX, minY, minZ, maxX, maxY, maxZ;
+            const size_t groupCount = AZStd::min(GroupSize, count - groupStart);
+            if (groupCount == GroupSize)
+            {
+                minX = Simd::Vec4::LoadUnaligned(aabbs.m_minX.data() + groupStart);
+                minY = Simd::Vec4::LoadUnaligned(aabbs.m_minY.data() + groupStart);
+                minZ = Simd::Vec4::LoadUnaligned(aabbs.m_minZ.data() + groupStart);
+                maxX = Simd::Vec4::LoadUnaligned(aabbs.m_maxX.data() + groupStart);
+                maxY = Simd::Vec4::LoadUnaligned(aabbs.m_maxY.data() + groupStart);
+                maxZ = Simd::Vec4::LoadUnaligned(aabbs.m_maxZ.data() + groupStart);
+            }
+            else
+            {
+                // Pad the last group by repeating its last box, the results for the padding are discarded
+                float padded[6][GroupSize];
+                for (size_t lane = 0; lane < GroupSize; ++lane)
+                {
+                    const size_t index = groupStart + AZStd::min(lane, groupCount - 1);
+                    padded[0][lane] = aabbs.m_minX[index];
+                    padded[1][lane] = aabbs.m_minY[index];
+                    padded[2][lane] = aabbs.m_minZ[index];
+                    padded[3][lane] = aabbs.m_maxX[index];
+                    padded[4][lane] = aabbs.m_maxY[index];
+                    padded[5][lane] = aabbs.m_maxZ[index];
+                }
+                minX = Simd::Vec4::LoadUnaligned(padded[0]);
+                minY = Simd::Vec4::LoadUnaligned(padded[1]);
+                minZ = Simd::Vec4::LoadUnaligned(padded[2]);
+                maxX = Simd::Vec4::LoadUnaligned(padded[3]);
+                maxY = Simd::Vec4::LoadUnaligned(padded[4]);
+                maxZ = Simd::Vec4::LoadUnaligned(padded[5]);
+            }
+
+            Simd::Vec4::FloatType exterior = zero;
+            Simd::Vec4::Int32Type interiorPlanes = Simd::Vec4::ZeroInt();
+            for (uint32_t planeOffset = 0; planeOffset < testedPlaneCount; ++planeOffset)
+            {
+                const uint32_t planeIndex = (coherentPlane + planeOffset) % testedPlaneCount;
+                const Internal::FrustumBatchPlane& plane = planes[planeIndex];
+
+                // Same as IntersectAabb, the corner furthest along the plane normal decides whether the box is outside the plane,
+                // and the closest corner whether it's fully inside the plane. The normal is the same for every box, so the
+                // corners can be picked per plane instead of per box.
+                Simd::Vec4::FloatType furthest = Simd::Vec4::Madd(plane.m_positiveX ? maxX : minX, plane.m_normalX, plane.m_distance);
+                furthest = Simd::Vec4::Madd(plane.m_positiveY ? maxY : minY, plane.m_normalY, furthest);
+                furthest = Simd::Vec4::Madd(plane.m_positiveZ ? maxZ : minZ, plane.m_normalZ, furthest);
+
+                Simd::Vec4::FloatType closest = Simd::Vec4::Madd(plane.m_positiveX ? minX : maxX, plane.m_normalX, plane.m_distance);
+                closest = Simd::Vec4::Madd(plane.m_positiveY ? minY : maxY, plane.m_normalY, closest);
+                closest = Simd::Vec4::Madd(plane.m_positiveZ ? minZ : maxZ, plane.m_normalZ, closest);
+
+                exterior = Simd::Vec4::Or(exterior, Simd::Vec4::CmpLt(furthest, zero));
+                const Simd::Vec4::Int32Type interior = Simd::Vec4::CastToInt(Simd::Vec4::CmpGtEq(closest, zero));
+                interiorPlanes = Simd::Vec4::Or(interiorPlanes, Simd::Vec4::And(interior, plane.m_planeBit));
+
+                // Early out once every box in the group is rejected, and start with this plane for the next group
+                if (Simd::Vec4::CmpAllEq(Simd::Vec4::And(exterior, one), one))
+                {
+                    coherentPlane = planeIndex;
+                    break;
+                }
+            }
+
+            alignas(16) int32_t exteriorLanes[GroupSize];
+            alignas(16) int32_t interiorPlaneLanes[GroupSize];
+            Simd::Vec4::StoreAligned(exteriorLanes, Simd::Vec4::CastToInt(exterior));
+            Simd::Vec4::StoreAligned(interiorPlaneLanes, interiorPlanes);
+            for (size_t lane = 0; lane < groupCount; ++lane)
+            {
+                const size_t index = groupStart + lane;
+                if (exteriorLanes[lane] == 0)
+                {
+                    outVisibility[index / 32] |= 1u << (index % 32);
+                    ++visibleCount;
+                }
+                if (!outInteriorPlaneMasks.empty())
+                {
+                    outInteriorPlaneMasks[index] = static_cast<uint8_t>(interiorPlaneLanes[lane]);
+                }
+            }
+        }
+
+        return visibleCount;
+    }
 } // namespace AZ
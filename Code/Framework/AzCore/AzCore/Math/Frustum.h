@@ -15,6 +15,7 @@
 #include <AzCore/Math/Plane.h>
 #include <AzCore/Math/SimdMath.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/span.h>
 
 namespace AZ
 {
@@ -79,6 +80,21 @@ namespace AZ
 
         using CornerVertexArray = AZStd::array<AZ::Vector3, CornerIndices::Count>;
 
+        //! Plane mask with one bit set for every PlaneId, see IntersectAabbs.
+        static constexpr uint32_t AllPlanesMask = (1u << PlaneId::MAX) - 1;
+
+        //! A batch of axis-aligned bounding boxes stored as a structure of arrays, one span per component.
+        //! All spans must have the same size.
+        struct AabbBatch
+        {
+            AZStd::span<const float> m_minX;
+            AZStd::span<const float> m_minY;
+            AZStd::span<const float> m_minZ;
+            AZStd::span<const float> m_maxX;
+            AZStd::span<const float> m_maxY;
+            AZStd::span<const float> m_maxZ;
+        };
+
         //! AzCore Reflection.
         //! @param context reflection context
         static void Reflect(ReflectContext* context);
@@ -151,6 +167,27 @@ namespace AZ
         //! @return the intersection result of the Aabb against the frustum
         IntersectResult IntersectAabb(const Aabb& aabb) const;
 
+        //! Intersects a batch of axis-aligned bounding boxes against the frustum, several boxes at a time.
+        //! This matches calling IntersectAabb for every box, up to rounding for boxes touching a plane, but is considerably
+        //! faster for large batches.
+        //! The plane that rejected the last group of boxes is tested first for the next group, as neighboring boxes tend to be
+        //! culled by the same plane, and a group stops testing planes as soon as all of its boxes are rejected.
+        //!
+        //! @param aabbs the boxes to test against
+        //! @param outVisibility bit (i % 32) of element (i / 32) is set if box i is not Exterior, bits past the last box are cleared.
+        //!        Must hold at least (aabbs.m_minX.size() + 31) / 32 elements.
+        //! @param planeMask the planes to test against, one bit per PlaneId. When culling a hierarchy the planes that a parent node
+        //!        is fully inside of can be left out for its children.
+        //! @param outInteriorPlaneMasks optional, receives for every visible box the subset of planeMask that the box is fully
+        //!        inside of. A box is Interior if this equals planeMask. Must be empty or hold one element per box.
+        //!
+        //! @return the number of boxes that are not Exterior
+        uint32_t IntersectAabbs(
+            const AabbBatch& aabbs,
+            AZStd::span<uint32_t> outVisibility,
+            uint32_t planeMask = AllPlanesMask,
+            AZStd::span<uint8_t> outInteriorPlaneMasks = {}) const;
+
         //! Returns true if the current frustum and provided frustum are close to identical.
         //! @param rhs the frustum to compare against for closeness
         bool IsClose(const Frustum& rhs, float tolerance = Constants::Tolerance) const;
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/MathBatch.h>
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+
+namespace AZ::MathBatch
+{
+    void TransformPoints(const Matrix3x4& matrix, AZStd::span<const Vector3> points, AZStd::span<Vector3> outPoints)
+    {
+        AZ_MATH_ASSERT(points.size() == outPoints.size(), "Input and output spans must have the same size");
+
+        const Simd::Vec3::FloatType col0 = matrix.GetColumn(0).GetSimdValue();
+        const Simd::Vec3::FloatType col1 = matrix.GetColumn(1).GetSimdValue();
+        const Simd::Vec3::FloatType col2 = matrix.GetColumn(2).GetSimdValue();
+        const Simd::Vec3::FloatType col3 = matrix.GetColumn(3).GetSimdValue();
+
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            const Simd::Vec3::FloatType point = points[i].GetSimdValue();
+            Simd::Vec3::FloatType result = Simd::Vec3::Madd(Simd::Vec3::SplatIndex0(point), col0, col3);
+            result = Simd::Vec3::Madd(Simd::Vec3::SplatIndex1(point), col1, result);
+            result = Simd::Vec3::Madd(Simd::Vec3::SplatIndex2(point), col2, result);
+            outPoints[i] = Vector3(result);
+        }
+    }
+
+    void TransformPoints(const Transform& transform, AZStd::span<const Vector3> points, AZStd::span<Vector3> outPoints)
+    {
+        TransformPoints(Matrix3x4::CreateFromTransform(transform), points, outPoints);
+    }
+
+    void TransformPoints(
+        const Matrix3x4& matrix,
+        AZStd::span<const float> x,
+        AZStd::span<const float> y,
+        AZStd::span<const float> z,
+        AZStd::span<float> outX,
+        AZStd::span<float> outY,
+        AZStd::span<float> outZ)
+    {
+        const size_t count = x.size();
+        AZ_MATH_ASSERT(y.size() == count && z.size() == count, "Input component spans must have the same size");
+        AZ_MATH_ASSERT(
+            outX.size() == count && outY.size() == count && outZ.size() == count, "Input and output spans must have the same size");
+
+        // Each matrix element is splat across a register, so every lane computes one point.
+        // Vec8 is native on AVX2 builds and a pair of Vec4's everywhere else
+        Simd::Vec8::FloatType elements[3][4];
+        for (int32_t row = 0; row < 3; ++row)
+        {
+            for (int32_t col = 0; col < 4; ++col)
+            {
+                elements[row][col] = Simd::Vec8::Splat(matrix.GetElement(row, col));
+            }
+        }
+
+        size_t i = 0;
+        for (; i + Simd::Vec8::ElementCount <= count; i += Simd::Vec8::ElementCount)
+        {
+            const Simd::Vec8::FloatType px = Simd::Vec8::LoadUnaligned(x.data() + i);
+            const Simd::Vec8::FloatType py = Simd::Vec8::LoadUnaligned(y.data() + i);
+            const Simd::Vec8::FloatType pz = Simd::Vec8::LoadUnaligned(z.data() + i);
+
+            Simd::Vec8::FloatType results[3];
+            for (int32_t row = 0; row < 3; ++row)
+            {
+                Simd::Vec8::FloatType result = Simd::Vec8::Madd(px, elements[row][0], elements[row][3]);
+                result = Simd::Vec8::Madd(py, elements[row][1], result);
+                results[row] = Simd::Vec8::Madd(pz, elements[row][2], result);
+            }
+
+            Simd::Vec8::StoreUnaligned(outX.data() + i, results[0]);
+            Simd::Vec8::StoreUnaligned(outY.data() + i, results[1]);
+            Simd::Vec8::StoreUnaligned(outZ.data() + i, results[2]);
+        }
+
+        // Remaining points that don't fill a register
+        for (; i < count; ++i)
+        {
+            const Vector3 result = matrix.TransformPoint(Vector3(x[i], y[i], z[i]));
+            outX[i] = result.GetX();
+            outY[i] = result.GetY();
+            outZ[i] = result.GetZ();
+        }
+    }
+
+    void TransformAabbs(const Matrix3x4& matrix, AZStd::span<const Aabb> aabbs, AZStd::span<Aabb> outAabbs)
+    {
+        AZ_MATH_ASSERT(aabbs.size() == outAabbs.size(), "Input and output spans must have the same size");
+
+        // Transform the center and use the absolute matrix to find the new extents, this gives the same
+        // result as projecting the extreme points like Aabb::ApplyMatrix3x4 does, without the per axis loop.
+        const Simd::Vec3::FloatType col0 = matrix.GetColumn(0).GetSimdValue();
+        const Simd::Vec3::FloatType col1 = matrix.GetColumn(1).GetSimdValue();
+        const Simd::Vec3::FloatType col2 = matrix.GetColumn(2).GetSimdValue();
+        const Simd::Vec3::FloatType col3 = matrix.GetColumn(3).GetSimdValue();
+        const Simd::Vec3::FloatType absCol0 = Simd::Vec3::Abs(col0);
+        const Simd::Vec3::FloatType absCol1 = Simd::Vec3::Abs(col1);
+        const Simd::Vec3::FloatType absCol2 = Simd::Vec3::Abs(col2);
+        const Simd::Vec3::FloatType half = Simd::Vec3::Splat(0.5f);
+
+        for (size_t i = 0; i < aabbs.size(); ++i)
+        {
+            const Simd::Vec3::FloatType min = aabbs[i].GetMin().GetSimdValue();
+            const Simd::Vec3::FloatType max = aabbs[i].GetMax().GetSimdValue();
+            const Simd::Vec3::FloatType center = Simd::Vec3::Mul(Simd::Vec3::Add(min, max), half);
+            const Simd::Vec3::FloatType extents = Simd::Vec3::Mul(Simd::Vec3::Sub(max, min), half);
+
+            Simd::Vec3::FloatType newCenter = Simd::Vec3::Madd(Simd::Vec3::SplatIndex0(center), col0, col3);
+            newCenter = Simd::Vec3::Madd(Simd::Vec3::SplatIndex1(center), col1, newCenter);
+            newCenter = Simd::Vec3::Madd(Simd::Vec3::SplatIndex2(center), col2, newCenter);
+
+            Simd::Vec3::FloatType newExtents = Simd::Vec3::Mul(Simd::Vec3::SplatIndex0(extents), absCol0);
+            newExtents = Simd::Vec3::Madd(Simd::Vec3::SplatIndex1(extents), absCol1, newExtents);
+            newExtents = Simd::Vec3::Madd(Simd::Vec3::SplatIndex2(extents), absCol2, newExtents);
+
+            outAabbs[i] = Aabb::CreateFromMinMax(
+                Vector3(Simd::Vec3::Sub(newCenter, newExtents)), Vector3(Simd::Vec3::Add(newCenter, newExtents)));
+        }
+    }
+
+    void SlerpQuaternions(
+        AZStd::span<const Quaternion> from,
+        AZStd::span<const Quaternion> to,
+        AZStd::span<const float> t,
+        AZStd::span<Quaternion> outQuaternions)
+    {
+        const size_t count = from.size();
+        AZ_MATH_ASSERT(
+            to.size() == count && t.size() == count && outQuaternions.size() == count,
+            "Input and output spans must have the same size");
+
+        const Simd::Vec4::FloatType one = Simd::Vec4::Splat(1.0f);
+        const Simd::Vec4::FloatType zero = Simd::Vec4::ZeroFloat();
+        const Simd::Vec4::FloatType lerpThreshold = Simd::Vec4::Splat(0.9999f);
+
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            // Transpose four quaternions so that each register holds one component of all of them
+            Simd::Vec4::FloatType a[4] = { from[i].GetSimdValue(), from[i + 1].GetSimdValue(), from[i + 2].GetSimdValue(),
+                                           from[i + 3].GetSimdValue() };
+            Simd::Vec4::FloatType b[4] = { to[i].GetSimdValue(), to[i + 1].GetSimdValue(), to[i + 2].GetSimdValue(),
+                                           to[i + 3].GetSimdValue() };
+            Simd::Vec4::FloatType aSoa[4];
+            Simd::Vec4::FloatType bSoa[4];
+            Simd::Vec4::Mat4x4Transpose(a, aSoa);
+            Simd::Vec4::Mat4x4Transpose(b, bSoa);
+
+            const Simd::Vec4::FloatType factor = Simd::Vec4::LoadUnaligned(t.data() + i);
+
+            // Same math as Quaternion::Slerp, for four quaternions at once
+            Simd::Vec4::FloatType dot = Simd::Vec4::Mul(aSoa[0], bSoa[0]);
+            dot = Simd::Vec4::Madd(aSoa[1], bSoa[1], dot);
+            dot = Simd::Vec4::Madd(aSoa[2], bSoa[2], dot);
+            dot = Simd::Vec4::Madd(aSoa[3], bSoa[3], dot);
+            const Simd::Vec4::FloatType cosom = Simd::Vec4::Abs(dot);
+
+            const Simd::Vec4::FloatType omega = Simd::Vec4::Acos(Simd::Vec4::Min(cosom, one));
+            const Simd::Vec4::FloatType sinom = Simd::Vec4::Sin(omega);
+            const Simd::Vec4::FloatType sinA = Simd::Vec4::Sin(Simd::Vec4::Mul(Simd::Vec4::Sub(one, factor), omega));
+            const Simd::Vec4::FloatType sinB = Simd::Vec4::Sin(Simd::Vec4::Mul(factor, omega));
+
+            // Fall back to a lerp where the quaternions are very close, this also avoids dividing by a sin of 0
+            const Simd::Vec4::FloatType useSlerp = Simd::Vec4::CmpLt(cosom, lerpThreshold);
+            const Simd::Vec4::FloatType safeSinom = Simd::Vec4::Select(sinom, one, useSlerp);
+            const Simd::Vec4::FloatType invSinom = Simd::Vec4::Reciprocal(safeSinom);
+            Simd::Vec4::FloatType sclA = Simd::Vec4::Select(Simd::Vec4::Mul(sinA, invSinom), Simd::Vec4::Sub(one, factor), useSlerp);
+            const Simd::Vec4::FloatType sclB = Simd::Vec4::Select(Simd::Vec4::Mul(sinB, invSinom), factor, useSlerp);
+
+            // Take the short way around
+            sclA = Simd::Vec4::Select(Simd::Vec4::Sub(zero, sclA), sclA, Simd::Vec4::CmpLt(dot, zero));
+
+            Simd::Vec4::FloatType resultSoa[4];
+            for (int32_t component = 0; component < 4; ++component)
+            {
+                resultSoa[component] = Simd::Vec4::Madd(aSoa[component], sclA, Simd::Vec4::Mul(bSoa[component], sclB));
+            }
+
+            Simd::Vec4::FloatType result[4];
+            Simd::Vec4::Mat4x4Transpose(resultSoa, result);
+            for (size_t lane = 0; lane < 4; ++lane)
+            {
+                outQuaternions[i + lane] = Quaternion(result[lane]);
+            }
+        }
+
+        // Remaining quaternions that don't fill a register
+        for (; i < count; ++i)
+        {
+            outQuaternions[i] = from[i].Slerp(to[i], t[i]);
+        }
+    }
+} // namespace AZ::MathBatch
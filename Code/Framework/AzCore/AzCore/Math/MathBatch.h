@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/span.h>
+
+namespace AZ
+{
+    class Aabb;
+    class Matrix3x4;
+    class Quaternion;
+    class Transform;
+    class Vector3;
+
+    //! Batch versions of common math operations, for code that processes thousands of elements per call
+    //! such as culling, skinning preparation or gradient sampling.
+    //! The matrix is only decomposed once per batch and the loops are written against the AZ::Simd::Vec4
+    //! interface, so they use the same SSE, NEON or scalar backend as the rest of the math library.
+    //! Input and output spans must have the same size. Outputs may alias the inputs as long as they
+    //! alias them exactly (in-place operation), partially overlapping spans are not supported.
+    namespace MathBatch
+    {
+        //! Transforms each point by the matrix, equivalent to outPoints[i] = matrix.TransformPoint(points[i]).
+        void TransformPoints(const Matrix3x4& matrix, AZStd::span<const Vector3> points, AZStd::span<Vector3> outPoints);
+
+        //! Transforms each point by the transform, equivalent to outPoints[i] = transform.TransformPoint(points[i]).
+        void TransformPoints(const Transform& transform, AZStd::span<const Vector3> points, AZStd::span<Vector3> outPoints);
+
+        //! Transforms points stored as a structure of arrays, one array per component.
+        //! Four points are transformed per iteration, which avoids the shuffles needed by the Vector3 version.
+        void TransformPoints(
+            const Matrix3x4& matrix,
+            AZStd::span<const float> x,
+            AZStd::span<const float> y,
+            AZStd::span<const float> z,
+            AZStd::span<float> outX,
+            AZStd::span<float> outY,
+            AZStd::span<float> outZ);
+
+        //! Transforms each Aabb by the matrix, equivalent to outAabbs[i] = aabbs[i].GetTransformedAabb(matrix).
+        void TransformAabbs(const Matrix3x4& matrix, AZStd::span<const Aabb> aabbs, AZStd::span<Aabb> outAabbs);
+
+        //! Spherically interpolates each pair of quaternions, equivalent to outQuaternions[i] = from[i].Slerp(to[i], t[i]).
+        //! Four interpolations are done per iteration, including the trigonometry.
+        void SlerpQuaternions(
+            AZStd::span<const Quaternion> from,
+            AZStd::span<const Quaternion> to,
+            AZStd::span<const float> t,
+            AZStd::span<Quaternion> outQuaternions);
+    } // namespace MathBatch
+} // namespace AZ
@@ -21,6 +21,15 @@
 #   endif
 #endif
 
+// The 8 wide Vec8 maps to native 256-bit registers when the build targets AVX2, otherwise it's emulated with two Vec4's
+#if !defined(AZ_TRAIT_USE_PLATFORM_SIMD_AVX2)
+#   if AZ_TRAIT_USE_PLATFORM_SIMD_SSE && defined(__AVX2__)
+#       define AZ_TRAIT_USE_PLATFORM_SIMD_AVX2 1
+#   else
+#       define AZ_TRAIT_USE_PLATFORM_SIMD_AVX2 0
+#   endif
+#endif
+
 namespace AZ
 {
     namespace Simd
@@ -50,6 +59,7 @@ namespace AZ
 #include <AzCore/Math/SimdMathVec2.h>
 #include <AzCore/Math/SimdMathVec3.h>
 #include <AzCore/Math/SimdMathVec4.h>
+#include <AzCore/Math/SimdMathVec8.h>
 
 namespace AZ
 {
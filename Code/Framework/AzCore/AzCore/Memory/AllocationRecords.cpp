@@ -9,7 +9,10 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/AllocationRecords.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Metrics/IEventLogger.h>
 
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/math.h>
 #include <AzCore/std/time.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/scoped_lock.h>
@@ -21,6 +24,62 @@ namespace AZ::Debug
     // Many PC tools break with alloc/free size mismatches when the memory guard is enabled.  Disable for now
     //#define ENABLE_MEMORY_GUARD
 
+    namespace AllocationRecordsInternal
+    {
+        // Sampling state of the calling thread. It's shared between all allocators so that each allocated byte has the same
+        // chance of being sampled.
+        struct SamplingState
+        {
+            size_t m_bytesUntilSample = 0;
+            size_t m_samplingInterval = 0;
+            AZ::u64 m_randomState = 0;
+        };
+        static thread_local SamplingState t_samplingState;
+
+        // Picks the number of bytes until the next sample from an exponential distribution, which makes the samples a Poisson
+        // process over the allocated bytes.
+        static size_t GetNextSampleDistance(SamplingState& state, size_t samplingInterval)
+        {
+            if (state.m_randomState == 0)
+            {
+                state.m_randomState = (reinterpret_cast<uintptr_t>(&state) ^ AZStd::GetTimeNowMicroSecond()) | 1;
+            }
+            // xorshift64*
+            state.m_randomState ^= state.m_randomState >> 12;
+            state.m_randomState ^= state.m_randomState << 25;
+            state.m_randomState ^= state.m_randomState >> 27;
+            const AZ::u64 random = state.m_randomState * 0x2545F4914F6CDD1DULL;
+            // Uniform value in (0, 1].
+            const double uniform = static_cast<double>((random >> 11) + 1) * (1.0 / 9007199254740992.0);
+            const double distance = -AZStd::log(uniform) * static_cast<double>(samplingInterval);
+            return static_cast<size_t>(AZStd::GetMin(distance, static_cast<double>(samplingInterval) * 64.0)) + 1;
+        }
+
+        static size_t HashStack(const StackFrame* frames, unsigned char numFrames)
+        {
+            size_t hash = 0;
+            for (unsigned char i = 0; i < numFrames; ++i)
+            {
+                AZStd::hash_combine(hash, frames[i].m_programCounter);
+            }
+            return hash;
+        }
+
+        // Upper bound of the number of frames written per stack by ExportSampledAllocations.
+        static constexpr unsigned char MaxExportedStackFrames = 32;
+    } // namespace AllocationRecordsInternal
+
+    struct AllocationRecords::SampledStack
+    {
+        size_t m_hash;
+        size_t m_refCount;
+
+        StackFrame* GetFrames()
+        {
+            return reinterpret_cast<StackFrame*>(this + 1);
+        }
+    };
+
     //=========================================================================
     // AllocationRecords
     // [9/16/2009]
@@ -41,10 +100,16 @@ namespace AZ::Debug
         , m_requestedAllocs(0)
         , m_requestedBytes(0)
         , m_requestedBytesPeak(0)
+        , m_samplingInterval(AllocatorManager::Instance().GetDefaultSamplingInterval())
         , m_allocatorName(allocatorName)
     {
     }
 
+    AllocationRecords::~AllocationRecords()
+    {
+        ReleaseAllSampledStacks();
+    }
+
     //=========================================================================
     // lock
     // [9/16/2009]
@@ -105,6 +170,12 @@ namespace AZ::Debug
             new (reinterpret_cast<char*>(address) + byteSize) Debug::GuardValue();
         }
 
+        size_t sampledBytes = 0;
+        if (m_samplingInterval != 0 && !ShouldSample(byteSize, sampledBytes))
+        {
+            return nullptr;
+        }
+
         Debug::AllocationRecordsType::pair_iter_bool iterBool;
         {
             AZStd::scoped_lock lock(m_recordsMutex);
@@ -127,9 +198,24 @@ namespace AZ::Debug
         ai.m_namesBlockSize = 0;
         ai.m_lineNum = 0;
         ai.m_timeStamp = AZStd::GetTimeNowMicroSecond();
+        ai.m_sampledBytes = sampledBytes;
 
         // if we don't have a fileName,lineNum record the stack or if the user requested it.
-        if (m_mode == RECORD_STACK_IF_NO_FILE_LINE || m_mode == RECORD_FULL)
+        if (sampledBytes != 0)
+        {
+            ai.m_stackFrames = nullptr;
+            ai.m_stackFramesCount = 0;
+            if (m_numStackLevels && (m_mode == RECORD_STACK_IF_NO_FILE_LINE || m_mode == RECORD_FULL))
+            {
+                // Sampled records share their stacks, so capture to a temporary first and only keep unique stacks.
+                Debug::StackFrame frames[AZStd::numeric_limits<unsigned char>::max()];
+                Debug::StackRecorder::Record(frames, m_numStackLevels, stackSuppressCount + 1);
+                AZStd::scoped_lock lock(m_recordsMutex);
+                ai.m_stackFrames = AcquireSampledStack(frames);
+                ai.m_stackFramesCount = m_numStackLevels;
+            }
+        }
+        else if (m_mode == RECORD_STACK_IF_NO_FILE_LINE || m_mode == RECORD_FULL)
         {
             ai.m_stackFrames = m_numStackLevels ? reinterpret_cast<AZ::Debug::StackFrame*>(m_records.get_allocator().allocate(
                                                       sizeof(AZ::Debug::StackFrame) * m_numStackLevels, 1))
@@ -215,6 +301,11 @@ namespace AZ::Debug
             }
             allocationInfo = iter->second;
             m_records.erase(iter);
+            if (allocationInfo.m_sampledBytes != 0 && allocationInfo.m_stackFrames)
+            {
+                ReleaseSampledStack(allocationInfo.m_stackFrames);
+                allocationInfo.m_stackFrames = nullptr;
+            }
 
             // try to be more aggressive and keep the memory footprint low.
             // \todo store the load factor at the last rehash to avoid unnecessary rehash
@@ -305,6 +396,11 @@ namespace AZ::Debug
         {
             AZStd::scoped_lock lock(m_recordsMutex);
             Debug::AllocationRecordsType::iterator iter = m_records.find(address);
+            if (m_samplingInterval != 0 && iter == m_records.end())
+            {
+                // Allocation wasn't sampled.
+                return;
+            }
             AZ_Assert(iter != m_records.end(), "Could not find address 0x%p in the allocator!", address);
             allocationInfo = &iter->second;
         }
@@ -364,9 +460,14 @@ namespace AZ::Debug
         {
             return;
         }
-        if (!address)
+        if (!address || m_samplingInterval != 0)
         {
-            RegisterAllocation(newAddress, byteSize, alignment, stackSuppressCount);
+            // Sampled reallocations are treated as a new allocation, so the chance of them being recorded depends on the new size.
+            if (address)
+            {
+                UnregisterAllocation(address, 0, 0, nullptr);
+            }
+            RegisterAllocation(newAddress, byteSize, alignment, stackSuppressCount + 1);
             return;
         }
 
@@ -466,6 +567,7 @@ namespace AZ::Debug
             {
                 AZStd::scoped_lock lock(m_recordsMutex);
                 m_records.clear();
+                ReleaseAllSampledStacks();
             }
             m_requestedBytes = 0;
             m_requestedBytesPeak = 0;
@@ -474,6 +576,174 @@ namespace AZ::Debug
         m_mode = mode;
     }
 
+    void AllocationRecords::SetSamplingInterval(size_t samplingInterval)
+    {
+        if (samplingInterval != m_samplingInterval)
+        {
+            // Records from before the change were made with different rules, so start over.
+            {
+                AZStd::scoped_lock lock(m_recordsMutex);
+                m_records.clear();
+                ReleaseAllSampledStacks();
+            }
+            m_requestedBytes = 0;
+            m_requestedBytesPeak = 0;
+            m_requestedAllocs = 0;
+            m_samplingInterval = samplingInterval;
+        }
+    }
+
+    bool AllocationRecords::ShouldSample(size_t byteSize, size_t& sampledBytes) const
+    {
+        AllocationRecordsInternal::SamplingState& state = AllocationRecordsInternal::t_samplingState;
+        if (state.m_samplingInterval != m_samplingInterval)
+        {
+            state.m_samplingInterval = m_samplingInterval;
+            state.m_bytesUntilSample = AllocationRecordsInternal::GetNextSampleDistance(state, m_samplingInterval);
+        }
+        if (byteSize < state.m_bytesUntilSample)
+        {
+            state.m_bytesUntilSample -= byteSize;
+            return false;
+        }
+        state.m_bytesUntilSample = AllocationRecordsInternal::GetNextSampleDistance(state, m_samplingInterval);
+
+        // The chance of an allocation being sampled is 1 - e^(-size/interval), so dividing the size by it gives an unbiased estimate.
+        const double probability = -AZStd::expm1(-static_cast<double>(byteSize) / static_cast<double>(m_samplingInterval));
+        sampledBytes = AZStd::GetMax<size_t>(static_cast<size_t>(static_cast<double>(byteSize) / probability), 1);
+        return true;
+    }
+
+    StackFrame* AllocationRecords::AcquireSampledStack(const StackFrame* frames)
+    {
+        const size_t hash = AllocationRecordsInternal::HashStack(frames, m_numStackLevels);
+        const size_t framesSize = sizeof(StackFrame) * m_numStackLevels;
+        auto range = m_sampledStacks.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (memcmp(it->second->GetFrames(), frames, framesSize) == 0)
+            {
+                ++it->second->m_refCount;
+                return it->second->GetFrames();
+            }
+        }
+
+        void* memory = m_sampledStacks.get_allocator().allocate(sizeof(SampledStack) + framesSize, alignof(SampledStack));
+        if (!memory)
+        {
+            return nullptr;
+        }
+        SampledStack* stack = new (memory) SampledStack{ hash, 1 };
+        memcpy(stack->GetFrames(), frames, framesSize);
+        m_sampledStacks.emplace(hash, stack);
+        return stack->GetFrames();
+    }
+
+    void AllocationRecords::ReleaseSampledStack(StackFrame* frames)
+    {
+        SampledStack* stack = reinterpret_cast<SampledStack*>(frames) - 1;
+        if (--stack->m_refCount > 0)
+        {
+            return;
+        }
+
+        auto range = m_sampledStacks.equal_range(stack->m_hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second == stack)
+            {
+                m_sampledStacks.erase(it);
+                break;
+            }
+        }
+        m_sampledStacks.get_allocator().deallocate(stack, sizeof(SampledStack) + sizeof(StackFrame) * m_numStackLevels, alignof(SampledStack));
+    }
+
+    void AllocationRecords::ReleaseAllSampledStacks()
+    {
+        for (auto& [hash, stack] : m_sampledStacks)
+        {
+            m_sampledStacks.get_allocator().deallocate(stack, sizeof(SampledStack) + sizeof(StackFrame) * m_numStackLevels, alignof(SampledStack));
+        }
+        m_sampledStacks.clear();
+    }
+
+    void AllocationRecords::ExportSampledAllocations(Metrics::IEventLogger& eventLogger) const
+    {
+        using namespace AllocationRecordsInternal;
+
+        // Aggregate the live samples by stack. This copies the stacks while locked, so they can be decoded and written without
+        // holding the lock, which would otherwise deadlock if the event logger allocates from this allocator.
+        struct StackSamples
+        {
+            size_t m_sampledBytes = 0;
+            size_t m_sampleCount = 0;
+            AZStd::fixed_vector<StackFrame, MaxExportedStackFrames> m_frames;
+        };
+        using StackSamplesMap = AZStd::unordered_map<const StackFrame*, StackSamples, AZStd::hash<const StackFrame*>,
+            AZStd::equal_to<const StackFrame*>, AZStd::stateless_allocator>;
+        StackSamplesMap stackSamples;
+        {
+            AZStd::scoped_lock lock(m_recordsMutex);
+            for (const auto& [address, info] : m_records)
+            {
+                if (info.m_sampledBytes == 0)
+                {
+                    continue;
+                }
+                auto insertResult = stackSamples.try_emplace(info.m_stackFrames);
+                StackSamples& samples = insertResult.first->second;
+                if (insertResult.second && info.m_stackFrames)
+                {
+                    const unsigned char numFrames = AZStd::GetMin(m_numStackLevels, MaxExportedStackFrames);
+                    samples.m_frames.assign(info.m_stackFrames, info.m_stackFrames + numFrames);
+                }
+                samples.m_sampledBytes += info.m_sampledBytes;
+                ++samples.m_sampleCount;
+            }
+        }
+
+        size_t totalSampledBytes = 0;
+        for (const auto& [stackFrames, samples] : stackSamples)
+        {
+            SymbolStorage::StackLine lines[MaxExportedStackFrames];
+            AZStd::fixed_vector<Metrics::EventValue, MaxExportedStackFrames> stackValues;
+            if (!samples.m_frames.empty())
+            {
+                SymbolStorage::DecodeFrames(samples.m_frames.data(), static_cast<unsigned int>(samples.m_frames.size()), lines);
+                for (size_t i = 0; i < samples.m_frames.size(); ++i)
+                {
+                    if (samples.m_frames[i].IsValid())
+                    {
+                        stackValues.emplace_back(AZStd::string_view(lines[i]));
+                    }
+                }
+            }
+
+            Metrics::EventObjectStorage args;
+            args.emplace_back("estimatedBytes", static_cast<AZ::u64>(samples.m_sampledBytes));
+            args.emplace_back("samples", static_cast<AZ::u64>(samples.m_sampleCount));
+            args.emplace_back("stack", Metrics::EventArray(stackValues));
+
+            Metrics::InstantArgs instantArgs;
+            instantArgs.m_name = m_allocatorName;
+            instantArgs.m_cat = "AllocationSamples";
+            instantArgs.m_args = args;
+            instantArgs.m_scope = Metrics::InstantEventScope::Process;
+            eventLogger.RecordInstantEvent(instantArgs);
+
+            totalSampledBytes += samples.m_sampledBytes;
+        }
+
+        Metrics::EventObjectStorage counterArgs;
+        counterArgs.emplace_back("estimatedLiveBytes", static_cast<AZ::u64>(totalSampledBytes));
+        Metrics::CounterArgs counter;
+        counter.m_name = m_allocatorName;
+        counter.m_cat = "AllocationSamples";
+        counter.m_args = counterArgs;
+        eventLogger.RecordCounterEvent(counter);
+    }
+
     //=========================================================================
     // EnumerateAllocations
     // [9/29/2009]
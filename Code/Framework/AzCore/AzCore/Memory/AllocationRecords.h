@@ -18,6 +18,11 @@
 
 namespace AZ
 {
+    namespace Metrics
+    {
+        class IEventLogger;
+    }
+
     namespace Debug
     {
         struct StackFrame;
@@ -39,6 +44,10 @@ namespace AZ
             unsigned int m_stackFramesCount{};
 
             AZ::u64         m_timeStamp{}; ///< Timestamp for sorting/tracking allocations
+
+            /// Estimated number of bytes this record represents when it was recorded by sampling, 0 for non sampled records.
+            /// The stack frames of sampled records are shared between all records with the same stack.
+            size_t          m_sampledBytes{};
         };
 
         // We use OSAllocator which uses system calls to allocate memory, they are not recorded or tracked!
@@ -109,6 +118,7 @@ namespace AZ
              */
 
             AllocationRecords(unsigned char stackRecordLevels, bool isMemoryGuard, bool isMarkUnallocatedMemory, const char* allocatorName);
+            ~AllocationRecords();
 
             unsigned int  MemoryGuardSize() const               { return m_memoryGuardSize; }
 
@@ -125,6 +135,17 @@ namespace AZ
             void    SetSaveNames(bool saveNames)                { m_saveNames = saveNames; }
             void    SetDecodeImmediately(bool decodeImmediately) { m_decodeImmediately = decodeImmediately; }
 
+            /// Enables sampling, which only records on average one allocation per samplingInterval allocated bytes. The chance of an
+            /// allocation being recorded is proportional to its size (Poisson sampling), so the estimated number of bytes of each
+            /// record (\ref AllocationInfo::m_sampledBytes) is unbiased. Stacks of sampled records are deduplicated.
+            /// This is cheap enough to leave enabled in production. Use 0 to record all allocations (default).
+            void    SetSamplingInterval(size_t samplingInterval);
+            size_t  GetSamplingInterval() const                 { return m_samplingInterval; }
+
+            /// Writes the sampled allocations that are still alive to the event logger. One instant event is written per unique
+            /// stack with the estimated live bytes and the decoded stack, followed by a counter event with the estimated total.
+            void    ExportSampledAllocations(Metrics::IEventLogger& eventLogger) const;
+
             /// Returns number of stack levels that will captured for each allocation when requested (depending on the \ref Mode)
             unsigned char   GetNumStackLevels() const           { return m_numStackLevels; }
 
@@ -165,7 +186,17 @@ namespace AZ
             // @}
 
         protected:
+            struct SampledStack;
+            bool    ShouldSample(size_t byteSize, size_t& sampledBytes) const;
+            /// Returns the shared copy of the stack, must be called with the lock locked.
+            StackFrame* AcquireSampledStack(const StackFrame* frames);
+            /// Releases a stack returned by AcquireSampledStack, must be called with the lock locked.
+            void    ReleaseSampledStack(StackFrame* frames);
+            void    ReleaseAllSampledStacks();
+
             Debug::AllocationRecordsType    m_records;
+            /// Unique stacks of the sampled records, keyed by the hash of the stack frames.
+            AZStd::unordered_multimap<size_t, SampledStack*, AZStd::hash<size_t>, AZStd::equal_to<size_t>, AZStd::stateless_allocator> m_sampledStacks;
             mutable AZStd::spin_mutex       m_recordsMutex;
             Mode                            m_mode;
             bool                            m_isAutoIntegrityCheck;
@@ -177,6 +208,7 @@ namespace AZ
             AZStd::atomic<size_t>           m_requestedAllocs;
             AZStd::atomic<size_t>           m_requestedBytes;
             AZStd::atomic<size_t>           m_requestedBytesPeak;
+            size_t                          m_samplingInterval;
 
             const char*                     m_allocatorName;
         };
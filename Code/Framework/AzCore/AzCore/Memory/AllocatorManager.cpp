@@ -6,7 +6,9 @@
  *
  */
 
+#include <AzCore/Console/ConsoleTypeHelpers.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/GenericStreams.h>
 #include <AzCore/Math/Crc.h>
 #include <AzCore/Memory/AllocatorManager.h>
 #include <AzCore/Memory/Memory.h>
@@ -14,6 +16,7 @@
 
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Metrics/JsonTraceEventLogger.h>
 
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -28,6 +31,65 @@ static void sys_DumpAllocators([[maybe_unused]] const AZ::ConsoleCommandContaine
 }
 AZ_CONSOLEFREEFUNC(sys_DumpAllocators, AZ::ConsoleFunctorFlags::Null, "Print memory allocator statistics.");
 
+static void sys_StartAllocationSampling(const AZ::ConsoleCommandContainer& arguments)
+{
+    // Default to the same average sampling interval as tcmalloc.
+    size_t samplingInterval = 2 * 1024 * 1024;
+    if (!arguments.empty() && (!ConsoleTypeHelpers::StringToValue(samplingInterval, arguments.front()) || samplingInterval == 0))
+    {
+        AZ_Error("Memory", false, "Invalid sampling interval '%.*s'.", AZ_STRING_ARG(arguments.front()));
+        return;
+    }
+
+    AllocatorManager& allocatorManager = AllocatorManager::Instance();
+    allocatorManager.SetDefaultSamplingInterval(samplingInterval);
+    allocatorManager.SetSamplingInterval(samplingInterval);
+    allocatorManager.SetDefaultTrackingMode(Debug::AllocationRecords::RECORD_FULL);
+    allocatorManager.SetTrackingMode(Debug::AllocationRecords::RECORD_FULL);
+    allocatorManager.SetDefaultProfilingState(true);
+    allocatorManager.EnterProfilingMode();
+    AZ_Printf("Memory", "Sampling one allocation per %zu allocated bytes.\n", samplingInterval);
+}
+AZ_CONSOLEFREEFUNC(sys_StartAllocationSampling, AZ::ConsoleFunctorFlags::Null,
+    "Start recording a sample of the allocations with their stacks. Takes the average number of bytes between samples (default 2MB).");
+
+static void sys_StopAllocationSampling([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+{
+    AllocatorManager& allocatorManager = AllocatorManager::Instance();
+    allocatorManager.SetDefaultProfilingState(false);
+    allocatorManager.ExitProfilingMode();
+    allocatorManager.SetDefaultTrackingMode(Debug::AllocationRecords::RECORD_NO_RECORDS);
+    allocatorManager.SetTrackingMode(Debug::AllocationRecords::RECORD_NO_RECORDS);
+    allocatorManager.SetDefaultSamplingInterval(0);
+    allocatorManager.SetSamplingInterval(0);
+}
+AZ_CONSOLEFREEFUNC(sys_StopAllocationSampling, AZ::ConsoleFunctorFlags::Null, "Stop recording allocation samples and discard them.");
+
+static void sys_ExportAllocationSamples(const AZ::ConsoleCommandContainer& arguments)
+{
+    if (arguments.empty())
+    {
+        AZ_Error("Memory", false, "sys_ExportAllocationSamples requires the path of the file to write to.");
+        return;
+    }
+
+    const AZStd::string filePath(arguments.front());
+    auto stream = AZStd::make_unique<IO::SystemFileStream>(filePath.c_str(), IO::OpenMode::ModeWrite);
+    if (!stream->IsOpen())
+    {
+        AZ_Error("Memory", false, "Unable to open '%s' to export the allocation samples to.", filePath.c_str());
+        return;
+    }
+    // The logger can be activated in release builds through the "/O3DE/Metrics/AllocationSamples/Active" setting.
+    Metrics::JsonTraceEventLoggerConfig config{ "AllocationSamples" };
+    Metrics::JsonTraceEventLogger eventLogger(AZStd::move(stream), config);
+    AllocatorManager::Instance().ExportSampledAllocations(eventLogger);
+    eventLogger.Flush();
+    AZ_Printf("Memory", "Exported allocation samples to '%s'.\n", filePath.c_str());
+}
+AZ_CONSOLEFREEFUNC(sys_ExportAllocationSamples, AZ::ConsoleFunctorFlags::Null,
+    "Write the allocation samples recorded since sys_StartAllocationSampling to a json trace event file.");
+
 static EnvironmentVariable<AllocatorManager>& GetAllocatorManagerEnvVar()
 {
     static EnvironmentVariable<AllocatorManager> s_allocManager;
@@ -235,6 +297,34 @@ AllocatorManager::SetTrackingMode(Debug::AllocationRecords::Mode mode)
     }
 }
 
+void
+AllocatorManager::SetSamplingInterval(size_t samplingInterval)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_allocatorListMutex);
+    for (int i = 0; i < m_numAllocators; ++i)
+    {
+        Debug::AllocationRecords* records = m_allocators[i]->GetRecords();
+        if (records)
+        {
+            records->SetSamplingInterval(samplingInterval);
+        }
+    }
+}
+
+void
+AllocatorManager::ExportSampledAllocations(Metrics::IEventLogger& eventLogger)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_allocatorListMutex);
+    for (int i = 0; i < m_numAllocators; ++i)
+    {
+        const Debug::AllocationRecords* records = m_allocators[i]->GetRecords();
+        if (records && records->GetSamplingInterval() != 0)
+        {
+            records->ExportSampledAllocations(eventLogger);
+        }
+    }
+}
+
 void
 AllocatorManager::EnterProfilingMode()
 {
@@ -286,6 +376,14 @@ AllocatorManager::DumpAllocators()
         m_dumpInfo[i].m_reserved = reservedBytes;
         m_dumpInfo[i].m_consumed = consumedBytes;
         AZ_Printf(TAG, "%d,%s,%.2f,%.2f,%.2f\n", i, name, usedBytes / 1024.0f, reservedBytes / 1024.0f, consumedBytes / 1024.0f);
+
+        if (const AllocatorThreadCacheStats threadCacheStats = allocator->GetThreadCacheStats(); threadCacheStats.m_threadCount > 0)
+        {
+            AZ_Printf(TAG, "%d,%s thread caches,threads %u,cached kb %.2f,hits %llu,refills %llu,flushes %llu\n", i, name,
+                threadCacheStats.m_threadCount, threadCacheStats.m_cachedBytes / 1024.0f,
+                static_cast<unsigned long long>(threadCacheStats.m_hits), static_cast<unsigned long long>(threadCacheStats.m_refills),
+                static_cast<unsigned long long>(threadCacheStats.m_flushes));
+        }
     }
 
     AZ_Printf(TAG, "-,Totals,%.2f,%.2f,%.2f\n", totalUsedBytes / 1024.0f, totalReservedBytes / 1024.0f, totalConsumedBytes / 1024.0f);
@@ -310,7 +408,8 @@ void AllocatorManager::GetAllocatorStats(size_t& allocatedBytes, size_t& capacit
             outStats->emplace(outStats->end(),
                 allocator->GetName(),
                 allocator->NumAllocatedBytes(),
-                allocator->Capacity());
+                allocator->Capacity(),
+                allocator->GetThreadCacheStats());
         }
     }
 }
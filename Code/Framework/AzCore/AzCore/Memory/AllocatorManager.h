@@ -79,6 +79,16 @@ namespace AZ
         /// Set memory track mode for all allocators already created.
         void    SetTrackingMode(AZ::Debug::AllocationRecords::Mode mode);
 
+        /// Set the default allocation sampling interval (see \ref AllocationRecords::SetSamplingInterval) for all allocators created after this point.
+        void    SetDefaultSamplingInterval(size_t samplingInterval) { m_defaultSamplingInterval = samplingInterval; }
+        size_t  GetDefaultSamplingInterval() const                  { return m_defaultSamplingInterval; }
+
+        /// Set the allocation sampling interval for all allocators already created. 0 records every allocation.
+        void    SetSamplingInterval(size_t samplingInterval);
+
+        /// Writes the sampled allocations of all allocators to the event logger.
+        void    ExportSampledAllocations(Metrics::IEventLogger& eventLogger);
+
         /// Especially for great code and engines...
         void    SetAllocatorLeaking(bool allowLeaking)  { m_isAllocatorLeaking = allowLeaking; }
 
@@ -104,15 +114,17 @@ namespace AZ
 
         struct AllocatorStats
         {
-            AllocatorStats(const char* name, size_t allocatedBytes, size_t capacityBytes)
+            AllocatorStats(const char* name, size_t allocatedBytes, size_t capacityBytes, const AllocatorThreadCacheStats& threadCacheStats = {})
                 : m_name(name)
                 , m_allocatedBytes(allocatedBytes)
                 , m_capacityBytes(capacityBytes)
+                , m_threadCacheStats(threadCacheStats)
             {}
 
             AZStd::string m_name;
             size_t m_allocatedBytes;
             size_t m_capacityBytes;
+            AllocatorThreadCacheStats m_threadCacheStats;
         };
 
         void GetAllocatorStats(size_t& usedBytes, size_t& reservedBytes, AZStd::vector<AllocatorStats>* outStats = nullptr);
@@ -164,6 +176,7 @@ namespace AZ
         AZStd::atomic<int>  m_profilingRefcount;
 
         AZ::Debug::AllocationRecords::Mode m_defaultTrackingRecordMode;
+        size_t              m_defaultSamplingInterval = 0;
 
         static AllocatorManager g_allocMgr;    ///< The single instance of the allocator manager
     };
@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    namespace FrameArenaInternal
+    {
+        // Single entry cache of the arena the calling thread used last. Threads typically only use a single frame arena
+        // allocator, so this avoids having to look up the arena on every allocation.
+        struct ThreadArenaCache
+        {
+            const void* m_allocator = nullptr;
+            u64 m_instanceId = 0;
+            void* m_arena = nullptr;
+        };
+        static thread_local ThreadArenaCache t_arenaCache;
+
+        static AZStd::atomic<u64> s_nextInstanceId{ 1 };
+
+#if defined(AZ_DEBUG_BUILD)
+        // Memory is filled with this pattern when an arena is reset to make use of memory from a previous frame easier to detect.
+        static constexpr int ResetFillPattern = 0xcd;
+#endif
+    } // namespace FrameArenaInternal
+
+    struct FrameArenaAllocator::Block
+    {
+        Block* m_next = nullptr;
+        size_t m_dataSize = 0;
+
+        char* GetData()
+        {
+            return reinterpret_cast<char*>(this + 1);
+        }
+        char* GetEnd()
+        {
+            return GetData() + m_dataSize;
+        }
+    };
+
+    struct FrameArenaAllocator::ThreadArena
+    {
+        ThreadArena* m_next = nullptr;
+        AZStd::thread_id m_threadId;
+        u64 m_frame = 0;
+        //! Regular sized blocks, m_currentBlock is the block that's being allocated from.
+        Block* m_blocks = nullptr;
+        Block* m_currentBlock = nullptr;
+        //! Dedicated blocks for large allocations, these are released when the arena is reset.
+        Block* m_largeBlocks = nullptr;
+        char* m_current = nullptr;
+        char* m_end = nullptr;
+        //! The most recent allocation, which is the only one that can be returned or resized.
+        char* m_lastAllocation = nullptr;
+    };
+
+    FrameArenaAllocator::FrameArenaAllocator()
+        : FrameArenaAllocator(Descriptor{})
+    {
+    }
+
+    FrameArenaAllocator::FrameArenaAllocator(const Descriptor& desc)
+        : m_desc(desc)
+        , m_instanceId(FrameArenaInternal::s_nextInstanceId++)
+    {
+        AZ_Assert(m_desc.m_blockSize > sizeof(Block), "Frame arena block size of %zu bytes is too small.", m_desc.m_blockSize);
+        PostCreate();
+    }
+
+    FrameArenaAllocator::~FrameArenaAllocator()
+    {
+        PreDestroy();
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenaMutex);
+        while (m_arenas)
+        {
+            ThreadArena* arena = m_arenas;
+            m_arenas = arena->m_next;
+
+            for (Block* blocks : { arena->m_blocks, arena->m_largeBlocks })
+            {
+                while (blocks)
+                {
+                    Block* next = blocks->m_next;
+                    FreeBlock(blocks);
+                    blocks = next;
+                }
+            }
+            arena->~ThreadArena();
+            AllocatorInstance<SystemAllocator>::Get().deallocate(arena, sizeof(ThreadArena), alignof(ThreadArena));
+        }
+    }
+
+    FrameArenaAllocator::pointer FrameArenaAllocator::allocate(size_type byteSize, size_type alignment)
+    {
+        if (byteSize == 0)
+        {
+            return nullptr;
+        }
+        AZ_Assert((alignment & (alignment - 1)) == 0, "Alignment must be power of 2!");
+        alignment = AZStd::max<size_type>(alignment, 1);
+
+        ThreadArena* arena = GetThreadArena(true);
+        if (!arena)
+        {
+            return nullptr;
+        }
+        const u64 frame = m_frame.load(AZStd::memory_order_relaxed);
+        if (arena->m_frame != frame)
+        {
+            ResetArena(*arena, frame);
+        }
+
+        char* address = arena->m_current ? AZ::PointerAlignUp(arena->m_current, alignment) : nullptr;
+        if (!address || address > arena->m_end || byteSize > static_cast<size_t>(arena->m_end - address))
+        {
+            return AllocateSlow(*arena, byteSize, alignment);
+        }
+        arena->m_current = address + byteSize;
+        arena->m_lastAllocation = address;
+        return address;
+    }
+
+    void FrameArenaAllocator::deallocate(pointer ptr, [[maybe_unused]] size_type byteSize, [[maybe_unused]] size_type alignment)
+    {
+        if (!ptr)
+        {
+            return;
+        }
+        // Memory is reclaimed when the arena is reset, only the last allocation is returned immediately so it can be reused.
+        ThreadArena* arena = GetThreadArena(false);
+        if (arena && arena->m_lastAllocation == ptr && arena->m_frame == m_frame.load(AZStd::memory_order_relaxed))
+        {
+            arena->m_current = arena->m_lastAllocation;
+            arena->m_lastAllocation = nullptr;
+        }
+    }
+
+    FrameArenaAllocator::pointer FrameArenaAllocator::reallocate(pointer ptr, size_type newSize, size_type newAlignment)
+    {
+        if (!ptr)
+        {
+            return allocate(newSize, newAlignment);
+        }
+        if (newSize == 0)
+        {
+            deallocate(ptr);
+            return nullptr;
+        }
+
+        ThreadArena* arena = GetThreadArena(false);
+        if (!arena || arena->m_lastAllocation != ptr || arena->m_frame != m_frame.load(AZStd::memory_order_relaxed))
+        {
+            AZ_Assert(false, "FrameArenaAllocator can only reallocate the most recent allocation of the calling thread.");
+            return nullptr;
+        }
+
+        char* address = static_cast<char*>(ptr);
+        if (AZ::PointerAlignUp(address, AZStd::max<size_type>(newAlignment, 1)) == address &&
+            newSize <= static_cast<size_t>(arena->m_end - address))
+        {
+            arena->m_current = address + newSize;
+            return ptr;
+        }
+
+        const size_t oldSize = arena->m_current - address;
+        pointer newAddress = allocate(newSize, newAlignment);
+        if (newAddress)
+        {
+            memcpy(newAddress, ptr, AZStd::min(oldSize, newSize));
+        }
+        return newAddress;
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::get_allocated_size(
+        [[maybe_unused]] pointer ptr, [[maybe_unused]] align_type alignment) const
+    {
+        return 0;
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::NumAllocatedBytes() const
+    {
+        return m_numAllocatedBytes;
+    }
+
+    void FrameArenaAllocator::GarbageCollect()
+    {
+        ThreadArena* arena = GetThreadArena(false);
+        if (!arena)
+        {
+            return;
+        }
+        if (const u64 frame = m_frame.load(AZStd::memory_order_relaxed); arena->m_frame != frame)
+        {
+            ResetArena(*arena, frame);
+        }
+
+        Block* unused = nullptr;
+        if (arena->m_currentBlock)
+        {
+            unused = arena->m_currentBlock->m_next;
+            arena->m_currentBlock->m_next = nullptr;
+        }
+        else
+        {
+            unused = arena->m_blocks;
+            arena->m_blocks = nullptr;
+        }
+        while (unused)
+        {
+            Block* next = unused->m_next;
+            FreeBlock(unused);
+            unused = next;
+        }
+    }
+
+    void FrameArenaAllocator::NextFrame()
+    {
+        m_frame.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+
+    u64 FrameArenaAllocator::GetFrame() const
+    {
+        return m_frame.load(AZStd::memory_order_relaxed);
+    }
+
+    auto FrameArenaAllocator::GetThreadArena(bool create) -> ThreadArena*
+    {
+        FrameArenaInternal::ThreadArenaCache& cache = FrameArenaInternal::t_arenaCache;
+        if (cache.m_allocator == this && cache.m_instanceId == m_instanceId)
+        {
+            return static_cast<ThreadArena*>(cache.m_arena);
+        }
+
+        const AZStd::thread_id threadId = AZStd::this_thread::get_id();
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenaMutex);
+        ThreadArena* arena = m_arenas;
+        while (arena && arena->m_threadId != threadId)
+        {
+            arena = arena->m_next;
+        }
+        if (!arena)
+        {
+            if (!create)
+            {
+                return nullptr;
+            }
+            void* memory = AllocatorInstance<SystemAllocator>::Get().allocate(sizeof(ThreadArena), alignof(ThreadArena));
+            if (!memory)
+            {
+                return nullptr;
+            }
+            arena = new (memory) ThreadArena;
+            arena->m_threadId = threadId;
+            arena->m_frame = m_frame.load(AZStd::memory_order_relaxed);
+            arena->m_next = m_arenas;
+            m_arenas = arena;
+        }
+
+        cache.m_allocator = this;
+        cache.m_instanceId = m_instanceId;
+        cache.m_arena = arena;
+        return arena;
+    }
+
+    void FrameArenaAllocator::ResetArena(ThreadArena& arena, u64 frame)
+    {
+        while (arena.m_largeBlocks)
+        {
+            Block* next = arena.m_largeBlocks->m_next;
+            FreeBlock(arena.m_largeBlocks);
+            arena.m_largeBlocks = next;
+        }
+
+        // Keep the first blocks around for the next frame, they're typically needed again.
+        size_t retainedBlocks = 0;
+        [[maybe_unused]] bool wasUsed = arena.m_currentBlock != nullptr;
+        Block** link = &arena.m_blocks;
+        while (*link)
+        {
+            Block* block = *link;
+            if (retainedBlocks < m_desc.m_maxRetainedBlocks)
+            {
+#if defined(AZ_DEBUG_BUILD)
+                if (wasUsed)
+                {
+                    memset(block->GetData(), FrameArenaInternal::ResetFillPattern, block->m_dataSize);
+                    wasUsed = block != arena.m_currentBlock;
+                }
+#endif
+                ++retainedBlocks;
+                link = &block->m_next;
+            }
+            else
+            {
+                *link = block->m_next;
+                FreeBlock(block);
+            }
+        }
+
+        arena.m_currentBlock = nullptr;
+        arena.m_current = nullptr;
+        arena.m_end = nullptr;
+        arena.m_lastAllocation = nullptr;
+        arena.m_frame = frame;
+    }
+
+    void* FrameArenaAllocator::AllocateSlow(ThreadArena& arena, size_t byteSize, size_t alignment)
+    {
+        const size_t blockDataSize = m_desc.m_blockSize - sizeof(Block);
+        if (byteSize + alignment > blockDataSize / 2)
+        {
+            // Large allocations get their own block so they don't waste the remainder of a regular block.
+            Block* block = AllocateBlock(byteSize + alignment);
+            if (!block)
+            {
+                return nullptr;
+            }
+            block->m_next = arena.m_largeBlocks;
+            arena.m_largeBlocks = block;
+            return AZ::PointerAlignUp(block->GetData(), alignment);
+        }
+
+        Block* block = arena.m_currentBlock ? arena.m_currentBlock->m_next : arena.m_blocks;
+        if (!block)
+        {
+            block = AllocateBlock(blockDataSize);
+            if (!block)
+            {
+                return nullptr;
+            }
+            if (arena.m_currentBlock)
+            {
+                arena.m_currentBlock->m_next = block;
+            }
+            else
+            {
+                arena.m_blocks = block;
+            }
+        }
+
+        arena.m_currentBlock = block;
+        char* address = AZ::PointerAlignUp(block->GetData(), alignment);
+        arena.m_current = address + byteSize;
+        arena.m_end = block->GetEnd();
+        arena.m_lastAllocation = address;
+        return address;
+    }
+
+    auto FrameArenaAllocator::AllocateBlock(size_t dataSize) -> Block*
+    {
+        const size_t blockSize = sizeof(Block) + dataSize;
+        void* memory = AllocatorInstance<SystemAllocator>::Get().allocate(blockSize, alignof(Block));
+        if (!memory)
+        {
+            return nullptr;
+        }
+        m_numAllocatedBytes += blockSize;
+        Block* block = new (memory) Block;
+        block->m_dataSize = dataSize;
+        return block;
+    }
+
+    void FrameArenaAllocator::FreeBlock(Block* block)
+    {
+        const size_t blockSize = sizeof(Block) + block->m_dataSize;
+        m_numAllocatedBytes -= blockSize;
+        block->~Block();
+        AllocatorInstance<SystemAllocator>::Get().deallocate(block, blockSize, alignof(Block));
+    }
+} // namespace AZ
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    /**
+     * Frame arena allocator
+     * Linear (bump pointer) allocator for transient CPU memory that only needs to live until the end of the current frame.
+     * Every thread allocates from its own arena, so allocations don't need any synchronization and deallocations are free.
+     * Only the most recent allocation of a thread is actually returned to its arena, which allows containers that grow
+     * to reuse their previous memory.
+     * All arenas are reset when NextFrame is called. ComponentApplication does this at the start of every tick, before
+     * the TickBus events are sent. Arenas are reset lazily by their own thread the next time it allocates, so NextFrame
+     * itself is cheap.
+     * IMPORTANT: Memory from this allocator is invalid after the frame it was allocated in. Containers using
+     * FrameArenaStdAllocator must be destroyed or cleared before the next tick.
+     */
+    class FrameArenaAllocator
+        : public AllocatorBase
+    {
+    public:
+        AZ_RTTI(FrameArenaAllocator, "{3516CDC3-C9C3-450A-A54F-2476B0A6F5C9}", AllocatorBase)
+
+        struct Descriptor
+        {
+            /// Size of the blocks the arenas get from the SystemAllocator. Allocations larger than half a block get a
+            /// dedicated block that is released when the arena is reset.
+            size_t m_blockSize = 256 * 1024;
+            /// Number of blocks an arena keeps between frames. Blocks beyond this are returned to the SystemAllocator.
+            size_t m_maxRetainedBlocks = 4;
+        };
+
+        FrameArenaAllocator();
+        explicit FrameArenaAllocator(const Descriptor& desc);
+        FrameArenaAllocator(const FrameArenaAllocator&) = delete;
+        FrameArenaAllocator& operator=(const FrameArenaAllocator&) = delete;
+        ~FrameArenaAllocator() override;
+
+        //////////////////////////////////////////////////////////////////////////
+        // IAllocator
+        pointer         allocate(size_type byteSize, size_type alignment) override;
+        void            deallocate(pointer ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        /// Only the most recent allocation of the calling thread can be resized.
+        pointer         reallocate(pointer ptr, size_type newSize, size_type newAlignment) override;
+        /// The arenas don't keep track of the size of individual allocations, so this always returns 0.
+        size_type       get_allocated_size(pointer ptr, align_type alignment = 1) const override;
+        /// Returns the size of all the blocks held by the arenas.
+        size_type       NumAllocatedBytes() const override;
+        /// Returns the unused blocks of the calling thread's arena to the SystemAllocator.
+        void            GarbageCollect() override;
+        //////////////////////////////////////////////////////////////////////////
+
+        /// Starts a new frame. All memory allocated from the arenas before this call is invalid afterwards.
+        void NextFrame();
+        /// Returns the number of frames that have been started with NextFrame.
+        u64 GetFrame() const;
+
+    private:
+        struct Block;
+        struct ThreadArena;
+
+        ThreadArena* GetThreadArena(bool create);
+        void ResetArena(ThreadArena& arena, u64 frame);
+        void* AllocateSlow(ThreadArena& arena, size_t byteSize, size_t alignment);
+        Block* AllocateBlock(size_t dataSize);
+        void FreeBlock(Block* block);
+
+        Descriptor m_desc;
+        //! Used together with the address to identify this instance in the per-thread lookup.
+        u64 m_instanceId;
+        AZStd::atomic<u64> m_frame{ 0 };
+        AZStd::atomic<size_t> m_numAllocatedBytes{ 0 };
+        //! Guards the list of arenas, which is only changed when a thread uses this allocator for the first time.
+        AZStd::mutex m_arenaMutex;
+        ThreadArena* m_arenas = nullptr;
+    };
+
+    using FrameArenaStdAllocator = AZStdAlloc<FrameArenaAllocator>;
+} // namespace AZ
@@ -12,6 +12,7 @@
 
 #include <AzCore/Math/Random.h>
 #include <AzCore/Memory/OSAllocator.h> // required by certain platforms
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/containers/intrusive_list.h>
@@ -66,6 +67,68 @@ namespace AZ
 
     //////////////////////////////////////////////////////////////////////////
 
+    namespace HphaInternal
+    {
+        using ThreadCacheReleaseFunction = void (*)(void* cache);
+
+        struct ThreadCacheSlot
+        {
+            const void* m_owner = nullptr;
+            void* m_cache = nullptr;
+            ThreadCacheReleaseFunction m_release = nullptr;
+        };
+
+        // The thread caches of all the HPHA allocators a thread has used. Only a handful of allocators are based on HPHA,
+        // so a small fixed table is enough. Allocators that don't fit in the table bypass the thread cache on that thread.
+        struct ThreadCacheTable
+        {
+            static constexpr size_t MaxSlots = 8;
+
+            ~ThreadCacheTable()
+            {
+                m_destroyed = true;
+                for (ThreadCacheSlot& slot : m_slots)
+                {
+                    if (slot.m_cache)
+                    {
+                        slot.m_release(slot.m_cache);
+                    }
+                    slot = {};
+                }
+            }
+
+            ThreadCacheSlot m_slots[MaxSlots];
+            // Allocations made by other thread_local destructors after this table has been destroyed bypass the thread cache.
+            bool m_destroyed = false;
+        };
+
+        static thread_local ThreadCacheTable t_threadCaches;
+
+        // Guards the registration of thread caches with their allocator. This is only taken when a thread cache is created or
+        // released, when an allocator is destroyed and when statistics are collected, never on the allocation path itself.
+        static AZStd::mutex& GetThreadCacheMutex()
+        {
+            static AZStd::mutex s_threadCacheMutex;
+            return s_threadCacheMutex;
+        }
+
+        // The counters of a thread cache are only written by the owning thread, so relaxed loads and stores are enough and
+        // avoid the cost of atomic read-modify-write operations. Other threads only read them for statistics.
+        template<typename T>
+        inline void RelaxedAdd(AZStd::atomic<T>& counter, T value)
+        {
+            counter.store(counter.load(AZStd::memory_order_relaxed) + value, AZStd::memory_order_relaxed);
+        }
+
+        template<typename T>
+        inline void RelaxedSubtract(AZStd::atomic<T>& counter, T value)
+        {
+            counter.store(counter.load(AZStd::memory_order_relaxed) - value, AZStd::memory_order_relaxed);
+        }
+    } // namespace HphaInternal
+
+    //////////////////////////////////////////////////////////////////////////
+
     template<bool DebugAllocatorEnable>
     class HphaSchemaBase<DebugAllocatorEnable>::HpAllocator
         : public IAllocator
@@ -337,6 +400,43 @@ namespace AZ
         size_t bucket_get_unused_memory(bool isPrint) const;
         void bucket_purge();
 
+        // per-thread cache of free blocks for the small buckets. Every bucket gets a magazine, a stack of free blocks that can
+        // be handed out and taken back by the owning thread without taking the bucket lock. Magazines are refilled from and
+        // flushed to the buckets in batches, so the bucket lock is taken once for a series of allocations or deallocations.
+        struct thread_cache
+            : public AZStd::list_base_hook<thread_cache>::node_type
+        {
+            struct magazine
+            {
+                free_link* mHead = nullptr;
+                unsigned mCount = 0;
+            };
+            magazine mMagazines[NUM_BUCKETS];
+            // the allocator this cache belongs to, set to null when the allocator is destroyed before the thread exits
+            HpAllocator* mOwner = nullptr;
+            AZStd::atomic<size_t> mCachedBytes{ 0 };
+            AZStd::atomic<AZ::u64> mHits{ 0 };
+            AZStd::atomic<AZ::u64> mRefills{ 0 };
+            AZStd::atomic<AZ::u64> mFlushes{ 0 };
+        };
+        using thread_cache_list = AZStd::intrusive_list<thread_cache, AZStd::list_base_hook<thread_cache>>;
+
+        inline bool uses_thread_cache(unsigned bi) const
+        {
+            return bi < mThreadCacheBuckets;
+        }
+        // returns the cache of the calling thread or null if the thread can't use a cache
+        thread_cache* get_thread_cache(bool create);
+        thread_cache* create_thread_cache(HphaInternal::ThreadCacheSlot& slot);
+        static void release_thread_cache(void* cache);
+        void* thread_cache_alloc(thread_cache& cache, unsigned bi);
+        void thread_cache_free(thread_cache& cache, void* ptr, unsigned bi);
+        bool thread_cache_refill(thread_cache& cache, unsigned bi);
+        void thread_cache_flush(thread_cache& cache, unsigned bi, unsigned count);
+        void thread_cache_flush_all(thread_cache& cache);
+        // flushes and detaches the caches of all threads, only safe when no other thread uses the allocator
+        void thread_cache_release_all();
+
         // locate the page information from a pointer
         inline page* ptr_get_page(void* ptr) const
         {
@@ -593,8 +693,14 @@ namespace AZ
         // threads through that lock
         size_t mTotalAllocatedSizeTree = 0;
         size_t mTotalCapacitySizeTree = 0;
+
+        // Thread cache configuration, buckets with an index lower than mThreadCacheBuckets are served by the thread caches.
+        // The list of caches is guarded by HphaInternal::GetThreadCacheMutex().
+        unsigned mThreadCacheBuckets = 0;
+        unsigned mMagazineCapacity = 0;
+        thread_cache_list mThreadCaches;
     public:
-        HpAllocator();
+        explicit HpAllocator(const ThreadCacheConfig& threadCacheConfig);
         ~HpAllocator() override;
 
         pointer allocate(size_type byteSize, align_type alignment = 1) override;
@@ -932,6 +1038,11 @@ namespace AZ
         // in all cases memory is never automatically returned to the OS
         void purge()
         {
+            // Return the blocks cached by this thread so their pages can be released
+            if (thread_cache* cache = get_thread_cache(false))
+            {
+                thread_cache_flush_all(*cache);
+            }
             // Purge buckets first since they use tree pages
             bucket_purge();
             tree_purge();
@@ -944,11 +1055,18 @@ namespace AZ
         void check();
 
         // return the total number of allocated memory
+        // blocks held by thread caches are allocated from the buckets, but are not in use so they're excluded
         inline size_t allocated() const
         {
-            return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree;
+            const size_t cachedSize = mThreadCacheBuckets > 0 ? thread_cache_stats().m_cachedBytes : 0;
+            const size_t allocatedSize = mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree;
+            // the counters of the thread caches are updated without synchronization, so clamp in case of a stale value
+            return allocatedSize > cachedSize ? allocatedSize - cachedSize : 0;
         }
 
+        // return the combined statistics of all thread caches
+        AllocatorThreadCacheStats thread_cache_stats() const;
+
         /// returns allocation size for the pointer if it belongs to the allocator. result is undefined if the pointer doesn't belong to the allocator.
         size_t  AllocationSize(void* ptr);
         size_t  GetMaxAllocationSize() const;
@@ -1013,7 +1131,7 @@ namespace AZ
 
     //////////////////////////////////////////////////////////////////////////
     template<bool DebugAllocatorEnable>
-    HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::HpAllocator()
+    HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::HpAllocator(const ThreadCacheConfig& threadCacheConfig)
         // We will use the os for direct allocations if memoryBlock == NULL
         // If m_systemChunkSize is specified, use that size for allocating tree blocks from the OS
         // m_treePageAlignment should be OS_VIRTUAL_PAGE_SIZE in all cases with this trait as we work
@@ -1030,6 +1148,15 @@ namespace AZ
         mTotalAllocatedSizeBuckets = 0;
         mTotalAllocatedSizeTree = 0;
 
+        if (threadCacheConfig.m_maxCachedSize > 0 && threadCacheConfig.m_magazineCapacity > 0)
+        {
+            const size_t maxCachedSize = threadCacheConfig.m_maxCachedSize < MAX_SMALL_ALLOCATION
+                ? threadCacheConfig.m_maxCachedSize
+                : MAX_SMALL_ALLOCATION;
+            mThreadCacheBuckets = bucket_spacing_function(maxCachedSize) + 1;
+            mMagazineCapacity = threadCacheConfig.m_magazineCapacity;
+        }
+
 #if AZ_TRAIT_OS_HAS_CRITICAL_SECTION_SPIN_COUNT
 #if defined(MULTITHREADED)
         // For some platforms we can use an actual spin lock, test and profile. We don't expect much contention there
@@ -1057,6 +1184,7 @@ namespace AZ
             check();
         }
 
+        thread_cache_release_all();
         purge();
 
         if constexpr (DebugAllocatorEnable)
@@ -1207,6 +1335,13 @@ namespace AZ
         HPPA_ASSERT(size <= MAX_SMALL_ALLOCATION);
         unsigned bi = bucket_spacing_function(size);
         HPPA_ASSERT(bi < NUM_BUCKETS);
+        if (uses_thread_cache(bi))
+        {
+            if (thread_cache* cache = get_thread_cache(true))
+            {
+                return thread_cache_alloc(*cache, bi);
+            }
+        }
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1236,6 +1371,13 @@ namespace AZ
     void* HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::bucket_alloc_direct(unsigned bi)
     {
         HPPA_ASSERT(bi < NUM_BUCKETS);
+        if (uses_thread_cache(bi))
+        {
+            if (thread_cache* cache = get_thread_cache(true))
+            {
+                return thread_cache_alloc(*cache, bi);
+            }
+        }
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1306,6 +1448,13 @@ namespace AZ
         page* p = ptr_get_page(ptr);
         unsigned bi = p->bucket_index();
         HPPA_ASSERT(bi < NUM_BUCKETS);
+        if (uses_thread_cache(bi))
+        {
+            if (thread_cache* cache = get_thread_cache(true))
+            {
+                return thread_cache_free(*cache, ptr, bi);
+            }
+        }
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1325,6 +1474,13 @@ namespace AZ
         // if this asserts, the free size doesn't match the allocated size
         // most likely a class needs a base virtual destructor
         HPPA_ASSERT(bi == p->bucket_index());
+        if (uses_thread_cache(bi))
+        {
+            if (thread_cache* cache = get_thread_cache(true))
+            {
+                return thread_cache_free(*cache, ptr, bi);
+            }
+        }
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1336,6 +1492,248 @@ namespace AZ
         mBuckets[bi].free(p, ptr);
     }
 
+    template<bool DebugAllocatorEnable>
+    auto HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::get_thread_cache(bool create) -> thread_cache*
+    {
+        HphaInternal::ThreadCacheTable& table = HphaInternal::t_threadCaches;
+        if (table.m_destroyed)
+        {
+            return nullptr;
+        }
+
+        for (HphaInternal::ThreadCacheSlot& slot : table.m_slots)
+        {
+            if (slot.m_owner == this)
+            {
+                // the cache is null while it's being created, allocations made during its creation bypass the cache
+                thread_cache* cache = static_cast<thread_cache*>(slot.m_cache);
+                if (!cache || cache->mOwner == this)
+                {
+                    return cache;
+                }
+                // the cache belonged to a destroyed allocator that was located at the same address
+                break;
+            }
+        }
+
+        if (!create)
+        {
+            return nullptr;
+        }
+
+        // find a slot that isn't used or that holds a cache of an allocator that has been destroyed
+        for (HphaInternal::ThreadCacheSlot& slot : table.m_slots)
+        {
+            bool isAvailable = slot.m_owner == nullptr;
+            if (!isAvailable && slot.m_cache)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(HphaInternal::GetThreadCacheMutex());
+                isAvailable = static_cast<thread_cache*>(slot.m_cache)->mOwner == nullptr;
+            }
+            if (isAvailable)
+            {
+                if (slot.m_cache)
+                {
+                    slot.m_release(slot.m_cache);
+                    slot = {};
+                }
+                return create_thread_cache(slot);
+            }
+        }
+        return nullptr;
+    }
+
+    template<bool DebugAllocatorEnable>
+    auto HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::create_thread_cache(HphaInternal::ThreadCacheSlot& slot) -> thread_cache*
+    {
+        // reserve the slot first, in case the OS allocation ends up in this allocator
+        slot.m_owner = this;
+        slot.m_cache = nullptr;
+        slot.m_release = &release_thread_cache;
+
+        void* memory = AZ_OS_MALLOC(sizeof(thread_cache), alignof(thread_cache));
+        if (!memory)
+        {
+            slot = {};
+            return nullptr;
+        }
+        thread_cache* cache = new (memory) thread_cache();
+        cache->mOwner = this;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(HphaInternal::GetThreadCacheMutex());
+            mThreadCaches.push_back(*cache);
+        }
+        slot.m_cache = cache;
+        return cache;
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::release_thread_cache(void* cachePtr)
+    {
+        thread_cache* cache = static_cast<thread_cache*>(cachePtr);
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(HphaInternal::GetThreadCacheMutex());
+            if (HpAllocator* owner = cache->mOwner)
+            {
+                owner->thread_cache_flush_all(*cache);
+                owner->mThreadCaches.erase(*cache);
+                cache->mOwner = nullptr;
+            }
+        }
+        cache->~thread_cache();
+        AZ_OS_FREE(cache);
+    }
+
+    template<bool DebugAllocatorEnable>
+    void* HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_alloc(thread_cache& cache, unsigned bi)
+    {
+        typename thread_cache::magazine& mag = cache.mMagazines[bi];
+        if (mag.mHead)
+        {
+            HphaInternal::RelaxedAdd<AZ::u64>(cache.mHits, 1);
+        }
+        else if (!thread_cache_refill(cache, bi))
+        {
+            return nullptr;
+        }
+
+        free_link* link = mag.mHead;
+        mag.mHead = link->mNext;
+        --mag.mCount;
+        HphaInternal::RelaxedSubtract(cache.mCachedBytes, bucket_spacing_function_inverse(bi));
+        return link;
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_free(thread_cache& cache, void* ptr, unsigned bi)
+    {
+        typename thread_cache::magazine& mag = cache.mMagazines[bi];
+        if (mag.mCount >= mMagazineCapacity)
+        {
+            // keep half of the magazine so alternating allocations and deallocations don't flush and refill every time
+            thread_cache_flush(cache, bi, mag.mCount - mMagazineCapacity / 2);
+        }
+        else
+        {
+            HphaInternal::RelaxedAdd<AZ::u64>(cache.mHits, 1);
+        }
+
+        free_link* link = static_cast<free_link*>(ptr);
+        link->mNext = mag.mHead;
+        mag.mHead = link;
+        ++mag.mCount;
+        HphaInternal::RelaxedAdd(cache.mCachedBytes, bucket_spacing_function_inverse(bi));
+    }
+
+    template<bool DebugAllocatorEnable>
+    bool HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_refill(thread_cache& cache, unsigned bi)
+    {
+        typename thread_cache::magazine& mag = cache.mMagazines[bi];
+        const unsigned batchSize = AZStd::GetMax(mMagazineCapacity / 2, 1u);
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        unsigned count = 0;
+        {
+#ifdef MULTITHREADED
+#if defined(USE_MUTEX_PER_BUCKET)
+            AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+#else
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+#endif
+#endif
+            for (; count < batchSize; ++count)
+            {
+                page* p = mBuckets[bi].get_free_page();
+                if (!p)
+                {
+                    p = bucket_grow(elemSize, mBuckets[bi].marker());
+                    if (!p)
+                    {
+                        break;
+                    }
+                    mBuckets[bi].add_free_page(p);
+                }
+                free_link* link = static_cast<free_link*>(mBuckets[bi].alloc(p));
+                link->mNext = mag.mHead;
+                mag.mHead = link;
+            }
+            mTotalAllocatedSizeBuckets += count * elemSize;
+        }
+        mag.mCount += count;
+        HphaInternal::RelaxedAdd(cache.mCachedBytes, count * elemSize);
+        HphaInternal::RelaxedAdd<AZ::u64>(cache.mRefills, 1);
+        return count > 0;
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_flush(thread_cache& cache, unsigned bi, unsigned count)
+    {
+        typename thread_cache::magazine& mag = cache.mMagazines[bi];
+        HPPA_ASSERT(count <= mag.mCount);
+        if (count == 0)
+        {
+            return;
+        }
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        {
+#ifdef MULTITHREADED
+#if defined(USE_MUTEX_PER_BUCKET)
+            AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+#else
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+#endif
+#endif
+            for (unsigned i = 0; i < count; ++i)
+            {
+                free_link* link = mag.mHead;
+                mag.mHead = link->mNext;
+                mBuckets[bi].free(ptr_get_page(link), link);
+            }
+            mTotalAllocatedSizeBuckets -= count * elemSize;
+        }
+        mag.mCount -= count;
+        HphaInternal::RelaxedSubtract(cache.mCachedBytes, count * elemSize);
+        HphaInternal::RelaxedAdd<AZ::u64>(cache.mFlushes, 1);
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_flush_all(thread_cache& cache)
+    {
+        for (unsigned bi = 0; bi < NUM_BUCKETS; ++bi)
+        {
+            thread_cache_flush(cache, bi, cache.mMagazines[bi].mCount);
+        }
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_release_all()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(HphaInternal::GetThreadCacheMutex());
+        while (!mThreadCaches.empty())
+        {
+            // the memory of the cache is released by the thread that owns it
+            thread_cache& cache = mThreadCaches.front();
+            thread_cache_flush_all(cache);
+            mThreadCaches.pop_front();
+            cache.mOwner = nullptr;
+        }
+    }
+
+    template<bool DebugAllocatorEnable>
+    AllocatorThreadCacheStats HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_stats() const
+    {
+        AllocatorThreadCacheStats stats;
+        AZStd::lock_guard<AZStd::mutex> lock(HphaInternal::GetThreadCacheMutex());
+        for (const thread_cache& cache : mThreadCaches)
+        {
+            stats.m_cachedBytes += cache.mCachedBytes.load(AZStd::memory_order_relaxed);
+            stats.m_hits += cache.mHits.load(AZStd::memory_order_relaxed);
+            stats.m_refills += cache.mRefills.load(AZStd::memory_order_relaxed);
+            stats.m_flushes += cache.mFlushes.load(AZStd::memory_order_relaxed);
+            ++stats.m_threadCount;
+        }
+        return stats;
+    }
+
     template<bool DebugAllocatorEnable>
     size_t HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::bucket_ptr_size(void* ptr) const
     {
@@ -2454,9 +2852,15 @@ namespace AZ
     //=========================================================================
     template<bool DebugAllocator>
     HphaSchemaBase<DebugAllocator>::HphaSchemaBase()
+        : HphaSchemaBase(ThreadCacheConfig{})
+    {
+    }
+
+    template<bool DebugAllocator>
+    HphaSchemaBase<DebugAllocator>::HphaSchemaBase(const ThreadCacheConfig& threadCacheConfig)
     {
         static_assert(sizeof(HpAllocator) <= sizeof(m_hpAllocatorBuffer), "Increase the m_hpAllocatorBuffer, it needs to be at least the sizeof(HpAllocator)");
-        m_allocator = new (&m_hpAllocatorBuffer) HpAllocator();
+        m_allocator = new (&m_hpAllocatorBuffer) HpAllocator(threadCacheConfig);
     }
 
     //=========================================================================
@@ -2548,6 +2952,15 @@ namespace AZ
         return m_allocator->allocated();
     }
 
+    //=========================================================================
+    // GetThreadCacheStats
+    //=========================================================================
+    template<bool DebugAllocator>
+    AllocatorThreadCacheStats HphaSchemaBase<DebugAllocator>::GetThreadCacheStats() const
+    {
+        return m_allocator->thread_cache_stats();
+    }
+
     //=========================================================================
     // GarbageCollect
     // [2/22/2011]
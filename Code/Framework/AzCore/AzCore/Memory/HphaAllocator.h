@@ -27,7 +27,24 @@ namespace AZ
         * provide arena (memory block) with pre-allocated memory.
         */
 
+        /**
+        * Configuration of the optional per-thread caches in front of the small allocation buckets. With thread caches
+        * enabled, every thread keeps a small stack ("magazine") of free blocks per size class so most small allocations
+        * and deallocations don't need to take the bucket locks. Magazines are refilled from and returned to the buckets
+        * in batches. This trades a bounded amount of memory per thread for less lock contention on machines with many cores.
+        */
+        struct ThreadCacheConfig
+        {
+            /// Allocations up to this size are served from the thread caches. 0 disables the thread caches. Values larger
+            /// than the maximum small allocation size (512 bytes) are clamped.
+            size_t m_maxCachedSize = 0;
+            /// The maximum number of free blocks a thread keeps per size class. When a magazine is full half of it is
+            /// returned to the shared buckets.
+            AZ::u32 m_magazineCapacity = 32;
+        };
+
         HphaSchemaBase();
+        explicit HphaSchemaBase(const ThreadCacheConfig& threadCacheConfig);
         virtual ~HphaSchemaBase();
 
         pointer         allocate(size_type byteSize, size_type alignment) override;
@@ -36,8 +53,11 @@ namespace AZ
         size_type get_allocated_size(pointer ptr, align_type alignment = 1) const override;
 
         size_type       NumAllocatedBytes() const override;
+        AllocatorThreadCacheStats GetThreadCacheStats() const override;
 
         /// Return unused memory to the OS. Don't call this unless you really need free memory, it is slow.
+        /// The thread cache of the calling thread is returned to the shared buckets first. Caches of other threads are
+        /// bounded by the ThreadCacheConfig and are returned when those threads exit or the allocator is destroyed.
         void            GarbageCollect() override;
 
         static size_t GetMemoryGuardSize();
@@ -56,6 +56,18 @@ namespace AZ
         bool m_marksUnallocatedMemory = false;
     };
 
+    /**
+    * Statistics for allocators that keep per-thread caches of free memory in front of their shared state.
+    */
+    struct AllocatorThreadCacheStats
+    {
+        size_t m_cachedBytes = 0;   ///< Bytes held by thread caches that are free for new allocations.
+        u64 m_hits = 0;             ///< Number of allocations and deallocations handled by a thread cache without locking.
+        u64 m_refills = 0;          ///< Number of times a thread cache had to be refilled from the shared state.
+        u64 m_flushes = 0;          ///< Number of times a thread cache returned memory to the shared state.
+        u32 m_threadCount = 0;      ///< Number of threads that currently have a cache for the allocator.
+    };
+
     /**
      * Allocator interface base class
      */
@@ -194,6 +206,9 @@ namespace AZ
             return 0;
         }
 
+        /// Returns the statistics of the per-thread caches of this allocator. All values are 0 if the allocator doesn't have thread caches.
+        virtual AllocatorThreadCacheStats GetThreadCacheStats() const { return {}; }
+
         /// Returns the debug configuration for this allocator.
         virtual AllocatorDebugConfig GetDebugConfig() { return {}; }
 
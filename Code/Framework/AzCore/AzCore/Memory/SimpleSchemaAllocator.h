@@ -134,6 +134,11 @@ namespace AZ
             return m_schema->NumAllocatedBytes();
         }
 
+        AllocatorThreadCacheStats GetThreadCacheStats() const override
+        {
+            return m_schema->GetThreadCacheStats();
+        }
+
     protected:
         IAllocator* m_schema{};
     private:
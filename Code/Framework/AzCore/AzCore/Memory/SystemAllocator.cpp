@@ -15,7 +15,9 @@
 #include <AzCore/std/functional.h>
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Utils/Utils.h>
 #include <memory>
+#include <stdlib.h>
 
 #define AZCORE_SYSTEM_ALLOCATOR_HPHA 1
 #define AZCORE_SYSTEM_ALLOCATOR_MALLOC 2
@@ -48,9 +50,33 @@ namespace AZ
     // ~Create
     // [9/2/2009]
     //=========================================================================
+    namespace SystemAllocatorInternal
+    {
+        // The system allocator is created before any settings are available, so its thread caches are configured through the
+        // O3DE_SYSTEM_ALLOCATOR_THREAD_CACHE environment variable. The value is the largest allocation size in bytes that's served
+        // from the thread caches, optionally followed by a comma and the number of free blocks each thread keeps per size class.
+        // For instance "256,64".
+        static HphaSchema::ThreadCacheConfig GetThreadCacheConfig()
+        {
+            HphaSchema::ThreadCacheConfig config;
+            char buffer[64]{};
+            if (auto value = AZ::Utils::GetEnv(AZStd::span(buffer, sizeof(buffer) - 1), "O3DE_SYSTEM_ALLOCATOR_THREAD_CACHE");
+                value.IsSuccess())
+            {
+                char* end = nullptr;
+                config.m_maxCachedSize = static_cast<size_t>(strtoull(buffer, &end, 10));
+                if (end && *end == ',')
+                {
+                    config.m_magazineCapacity = static_cast<AZ::u32>(strtoul(end + 1, nullptr, 10));
+                }
+            }
+            return config;
+        }
+    } // namespace SystemAllocatorInternal
+
     bool SystemAllocator::Create()
     {
-        m_subAllocator = AZStd::make_unique<HphaSchema>();
+        m_subAllocator = AZStd::make_unique<HphaSchema>(SystemAllocatorInternal::GetThreadCacheConfig());
         return true;
     }
 
@@ -49,6 +49,7 @@ namespace AZ
         void            GarbageCollect() override                 { m_subAllocator->GarbageCollect(); }
 
         size_type       NumAllocatedBytes() const override       { return m_subAllocator->NumAllocatedBytes(); }
+        AllocatorThreadCacheStats GetThreadCacheStats() const override { return m_subAllocator->GetThreadCacheStats(); }
 
         //////////////////////////////////////////////////////////////////////////
 
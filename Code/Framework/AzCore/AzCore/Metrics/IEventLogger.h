@@ -274,6 +274,11 @@ namespace AZ::Metrics
         AZStd::string_view m_cat;
         //! Arguments used to fill the "args" field for each trace event
         AZStd::span<EventField> m_args;
+        //! (Optional) Timestamp of the event in microseconds since the UTC epoch
+        //! Defaults to the time the event is recorded. Set this when recording events that occurred earlier
+        AZStd::optional<AZStd::chrono::microseconds> m_ts;
+        //! (Optional) Thread the event occurred on. Defaults to the thread recording the event
+        AZStd::optional<AZStd::thread::id> m_tid;
     };
 
     //! Structure which represents arguments associated with the duration trace events
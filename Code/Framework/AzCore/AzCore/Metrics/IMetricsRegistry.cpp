@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Metrics/IMetricsRegistry.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/string/fixed_string.h>
+
+namespace AZ::Metrics
+{
+    namespace
+    {
+        // Atomic add of doubles, which the atomics don't provide before C++20
+        void AtomicAdd(AZStd::atomic<double>& target, double value)
+        {
+            double expected = target.load(AZStd::memory_order_relaxed);
+            while (!target.compare_exchange_weak(expected, expected + value, AZStd::memory_order_relaxed))
+            {
+            }
+        }
+
+        // Threads are assigned to the shards of the counters in turn
+        size_t GetThreadShardIndex(size_t shardCount)
+        {
+            static AZStd::atomic<size_t> s_nextThreadIndex{ 0 };
+            thread_local const size_t threadIndex = s_nextThreadIndex.fetch_add(1, AZStd::memory_order_relaxed);
+            return threadIndex % shardCount;
+        }
+    } // namespace
+
+    // --- Metric ---
+
+    Metric::Metric(MetricType type, AZStd::string_view name, AZStd::string_view help)
+        : m_type(type)
+        , m_name(name)
+        , m_help(help)
+    {
+    }
+
+    MetricType Metric::GetType() const
+    {
+        return m_type;
+    }
+
+    AZStd::string_view Metric::GetName() const
+    {
+        return m_name;
+    }
+
+    AZStd::string_view Metric::GetHelp() const
+    {
+        return m_help;
+    }
+
+    // --- Counter ---
+
+    Counter::Counter(AZStd::string_view name, AZStd::string_view help)
+        : Metric(MetricType::Counter, name, help)
+    {
+    }
+
+    void Counter::Increment(AZ::u64 value)
+    {
+        m_shards[GetThreadShardIndex(ShardCount)].m_value.fetch_add(value, AZStd::memory_order_relaxed);
+    }
+
+    AZ::u64 Counter::GetValue() const
+    {
+        AZ::u64 value = 0;
+        for (const Shard& shard : m_shards)
+        {
+            value += shard.m_value.load(AZStd::memory_order_relaxed);
+        }
+        return value;
+    }
+
+    // --- Gauge ---
+
+    Gauge::Gauge(AZStd::string_view name, AZStd::string_view help)
+        : Metric(MetricType::Gauge, name, help)
+    {
+    }
+
+    void Gauge::Set(double value)
+    {
+        m_value.store(value, AZStd::memory_order_relaxed);
+    }
+
+    void Gauge::Add(double value)
+    {
+        AtomicAdd(m_value, value);
+    }
+
+    double Gauge::GetValue() const
+    {
+        return m_value.load(AZStd::memory_order_relaxed);
+    }
+
+    // --- Histogram ---
+
+    Histogram::Histogram(AZStd::string_view name, AZStd::string_view help, AZStd::span<const double> bucketBounds)
+        : Metric(MetricType::Histogram, name, help)
+        , m_bucketBounds(bucketBounds.begin(), bucketBounds.end())
+        , m_bucketCounts(new AZStd::atomic<AZ::u64>[bucketBounds.size() + 1])
+    {
+        AZ_Assert(AZStd::is_sorted(m_bucketBounds.begin(), m_bucketBounds.end()),
+            "The bucket bounds of histogram '%.*s' must be in increasing order", AZ_STRING_ARG(name));
+        for (size_t bucketIndex = 0; bucketIndex <= m_bucketBounds.size(); ++bucketIndex)
+        {
+            m_bucketCounts[bucketIndex].store(0, AZStd::memory_order_relaxed);
+        }
+    }
+
+    void Histogram::Observe(double value)
+    {
+        const auto bucketIt = AZStd::lower_bound(m_bucketBounds.begin(), m_bucketBounds.end(), value);
+        m_bucketCounts[AZStd::distance(m_bucketBounds.begin(), bucketIt)].fetch_add(1, AZStd::memory_order_relaxed);
+        m_count.fetch_add(1, AZStd::memory_order_relaxed);
+        AtomicAdd(m_sum, value);
+    }
+
+    AZStd::span<const double> Histogram::GetBucketBounds() const
+    {
+        return m_bucketBounds;
+    }
+
+    AZStd::vector<AZ::u64> Histogram::GetBucketCounts() const
+    {
+        AZStd::vector<AZ::u64> bucketCounts(m_bucketBounds.size() + 1);
+        for (size_t bucketIndex = 0; bucketIndex < bucketCounts.size(); ++bucketIndex)
+        {
+            bucketCounts[bucketIndex] = m_bucketCounts[bucketIndex].load(AZStd::memory_order_relaxed);
+        }
+        return bucketCounts;
+    }
+
+    AZ::u64 Histogram::GetCount() const
+    {
+        return m_count.load(AZStd::memory_order_relaxed);
+    }
+
+    double Histogram::GetSum() const
+    {
+        return m_sum.load(AZStd::memory_order_relaxed);
+    }
+
+    // --- Prometheus export ---
+
+    bool IsValidMetricName(AZStd::string_view name)
+    {
+        auto isNameChar = [](char element)
+        {
+            return (element >= 'a' && element <= 'z') || (element >= 'A' && element <= 'Z') || element == '_' || element == ':'
+                || (element >= '0' && element <= '9');
+        };
+        return !name.empty() && !(name.front() >= '0' && name.front() <= '9') && AZStd::all_of(name.begin(), name.end(), isNameChar);
+    }
+
+    static void AppendPrometheusValue(AZStd::string& output, double value)
+    {
+        if (value != value)
+        {
+            output += "NaN";
+        }
+        else if (value == AZStd::numeric_limits<double>::infinity())
+        {
+            output += "+Inf";
+        }
+        else if (value == -AZStd::numeric_limits<double>::infinity())
+        {
+            output += "-Inf";
+        }
+        else
+        {
+            output += AZStd::fixed_string<32>::format("%.17g", value).c_str();
+        }
+    }
+
+    static void AppendPrometheusHeader(AZStd::string& output, const Metric& metric, AZStd::string_view typeName)
+    {
+        output += "# HELP ";
+        output += metric.GetName();
+        output += ' ';
+        // Backslashes and line feeds are escaped in help texts
+        for (char element : metric.GetHelp())
+        {
+            if (element == '\\')
+            {
+                output += "\\\\";
+            }
+            else if (element == '\n')
+            {
+                output += "\\n";
+            }
+            else
+            {
+                output += element;
+            }
+        }
+        output += "\n# TYPE ";
+        output += metric.GetName();
+        output += ' ';
+        output += typeName;
+        output += '\n';
+    }
+
+    void WritePrometheusText(const IMetricsRegistry& metricsRegistry, AZStd::string& output)
+    {
+        metricsRegistry.VisitMetrics([&output](const Metric& metric)
+        {
+            switch (metric.GetType())
+            {
+            case MetricType::Counter:
+                AppendPrometheusHeader(output, metric, "counter");
+                output += metric.GetName();
+                output += AZStd::fixed_string<32>::format(" %llu\n", static_cast<unsigned long long>(static_cast<const Counter&>(metric).GetValue())).c_str();
+                break;
+            case MetricType::Gauge:
+                AppendPrometheusHeader(output, metric, "gauge");
+                output += metric.GetName();
+                output += ' ';
+                AppendPrometheusValue(output, static_cast<const Gauge&>(metric).GetValue());
+                output += '\n';
+                break;
+            case MetricType::Histogram:
+            {
+                const auto& histogram = static_cast<const Histogram&>(metric);
+                AppendPrometheusHeader(output, metric, "histogram");
+
+                // The buckets of the Prometheus histograms are cumulative
+                const AZStd::span<const double> bucketBounds = histogram.GetBucketBounds();
+                const AZStd::vector<AZ::u64> bucketCounts = histogram.GetBucketCounts();
+                AZ::u64 cumulativeCount = 0;
+                for (size_t bucketIndex = 0; bucketIndex < bucketCounts.size(); ++bucketIndex)
+                {
+                    cumulativeCount += bucketCounts[bucketIndex];
+                    output += metric.GetName();
+                    output += "_bucket{le=\"";
+                    AppendPrometheusValue(output,
+                        bucketIndex < bucketBounds.size() ? bucketBounds[bucketIndex] : AZStd::numeric_limits<double>::infinity());
+                    output += AZStd::fixed_string<32>::format("\"} %llu\n", static_cast<unsigned long long>(cumulativeCount)).c_str();
+                }
+                output += metric.GetName();
+                output += "_sum ";
+                AppendPrometheusValue(output, histogram.GetSum());
+                output += '\n';
+                output += metric.GetName();
+                // The count is the one of the +Inf bucket, so the buckets and the count are consistent while values are observed
+                output += AZStd::fixed_string<32>::format("_count %llu\n", static_cast<unsigned long long>(cumulativeCount)).c_str();
+                break;
+            }
+            }
+            return true;
+        });
+    }
+} // namespace AZ::Metrics
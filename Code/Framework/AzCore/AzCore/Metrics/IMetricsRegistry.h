@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_fwd.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::Metrics
+{
+    enum class MetricType
+    {
+        Counter,
+        Gauge,
+        Histogram
+    };
+
+    //! Named metric of the metrics registry, whose name and help text follow the conventions of Prometheus.
+    //! Metrics are updated lock-free from any thread.
+    class Metric
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(Metric, AZ::SystemAllocator);
+
+        Metric(MetricType type, AZStd::string_view name, AZStd::string_view help);
+        virtual ~Metric() = default;
+
+        MetricType GetType() const;
+        AZStd::string_view GetName() const;
+        AZStd::string_view GetHelp() const;
+
+    private:
+        MetricType m_type;
+        AZStd::string m_name;
+        AZStd::string m_help;
+    };
+
+    //! Monotonically increasing count, for example of sent bytes.
+    //! Increments are accumulated in per-thread shards, so threads incrementing the same counter don't contend on a cache line.
+    class Counter final
+        : public Metric
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(Counter, AZ::SystemAllocator);
+
+        Counter(AZStd::string_view name, AZStd::string_view help);
+
+        void Increment(AZ::u64 value = 1);
+
+        //! Returns the sum of the shards, which may miss the increments made concurrently with the call
+        AZ::u64 GetValue() const;
+
+    private:
+        static constexpr size_t ShardCount = 16;
+        struct alignas(64) Shard
+        {
+            AZStd::atomic<AZ::u64> m_value{ 0 };
+        };
+        AZStd::array<Shard, ShardCount> m_shards;
+    };
+
+    //! Value which can go up and down, for example the number of entities.
+    class Gauge final
+        : public Metric
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(Gauge, AZ::SystemAllocator);
+
+        Gauge(AZStd::string_view name, AZStd::string_view help);
+
+        void Set(double value);
+        void Add(double value);
+        double GetValue() const;
+
+    private:
+        AZStd::atomic<double> m_value{ 0.0 };
+    };
+
+    //! Distribution of observed values, for example of tick times, counted in buckets with fixed upper bounds.
+    class Histogram final
+        : public Metric
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(Histogram, AZ::SystemAllocator);
+
+        //! @param bucketBounds Inclusive upper bounds of the buckets in increasing order.
+        //! Values larger than the last bound are counted in an implicit +Inf bucket.
+        Histogram(AZStd::string_view name, AZStd::string_view help, AZStd::span<const double> bucketBounds);
+
+        void Observe(double value);
+
+        AZStd::span<const double> GetBucketBounds() const;
+        //! Returns the number of values observed in each bucket, not cumulated, with the +Inf bucket last
+        AZStd::vector<AZ::u64> GetBucketCounts() const;
+        AZ::u64 GetCount() const;
+        double GetSum() const;
+
+    private:
+        AZStd::vector<double> m_bucketBounds;
+        AZStd::unique_ptr<AZStd::atomic<AZ::u64>[]> m_bucketCounts;
+        AZStd::atomic<AZ::u64> m_count{ 0 };
+        AZStd::atomic<double> m_sum{ 0.0 };
+    };
+
+    //! Central registry of the named counters, gauges and histograms of the engine and gems, which are exported without
+    //! ImGui, for example by the MetricsExporterSystemComponent to the monitoring of dedicated servers.
+    class IMetricsRegistry
+    {
+    public:
+        AZ_RTTI(IMetricsRegistry, "{5A3E4A77-1D6B-4C39-9F0E-6C2B8E1D7A40}");
+        virtual ~IMetricsRegistry() = default;
+
+        //! Registers a metric, or returns the metric already registered with the name if it is of the same type.
+        //! The metric is owned by the registry, and the returned pointer stays valid until the metric is unregistered.
+        //! @param name Name of the metric, made of letters, digits, underscores and colons, which doesn't start with a digit
+        //! @return pointer to the metric, or nullptr if the name is invalid or registered with another type
+        virtual Counter* RegisterCounter(AZStd::string_view name, AZStd::string_view help) = 0;
+        virtual Gauge* RegisterGauge(AZStd::string_view name, AZStd::string_view help) = 0;
+        virtual Histogram* RegisterHistogram(AZStd::string_view name, AZStd::string_view help, AZStd::span<const double> bucketBounds) = 0;
+
+        //! Unregisters and destroys the metric with the specified name
+        //! @return true if a metric was registered with the name
+        virtual bool UnregisterMetric(AZStd::string_view name) = 0;
+
+        //! Find the metric registered with the specified name
+        [[nodiscard]] virtual Metric* FindMetric(AZStd::string_view name) const = 0;
+
+        //! Callback function that is invoked for every registered metric, in the order of their names
+        //! return true to continue visiting
+        using VisitMetricCallback = AZStd::function<bool(const Metric&)>;
+        //! Invokes the supplied visitor for each metric, while preventing metrics from being registered or unregistered
+        virtual void VisitMetrics(const VisitMetricCallback&) const = 0;
+    };
+
+    using MetricsRegistry = AZ::Interface<IMetricsRegistry>;
+
+    //! Returns true if the name is a valid Prometheus metric name
+    bool IsValidMetricName(AZStd::string_view name);
+
+    //! Appends the metrics of the registry to the output in the Prometheus text exposition format
+    void WritePrometheusText(const IMetricsRegistry& metricsRegistry, AZStd::string& output);
+} // namespace AZ::Metrics
@@ -39,6 +39,21 @@ namespace AZ::Metrics
     constexpr int32_t IndentStep = 2;
     constexpr size_t StackAllocatorSize = 2048;
 
+    // Events are attributed to the recording thread at the time of recording, unless the arguments specify otherwise
+    static void SetThreadAndTimestamp(EventDesc& eventDesc, const EventArgs& eventArgs)
+    {
+        eventDesc.SetThreadId(eventArgs.m_tid ? *eventArgs.m_tid : AZStd::this_thread::get_id());
+        if (eventArgs.m_ts)
+        {
+            eventDesc.SetTimestamp(*eventArgs.m_ts);
+        }
+        else
+        {
+            auto utcTimestamp = AZStd::chrono::utc_clock::now();
+            eventDesc.SetTimestamp(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(utcTimestamp.time_since_epoch()));
+        }
+    }
+
     using EventJsonWriter = rapidjson::Writer<AZ::IO::RapidJSONWriteStreamUnbuffered, rapidjson::UTF8<char>, rapidjson::UTF8<char>,
         AZ::Json::RapidjsonStackAllocator<StackAllocatorSize>>;
 
@@ -210,9 +225,7 @@ namespace AZ::Metrics
         eventDesc.SetCategory(durationArgs.m_cat);
         eventDesc.SetEventPhase(EventPhase::DurationBegin);
         eventDesc.SetProcessId(AZ::Platform::GetCurrentProcessId());
-        eventDesc.SetThreadId(AZStd::this_thread::get_id());
-        auto utcTimestamp = AZStd::chrono::utc_clock::now();
-        eventDesc.SetTimestamp(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(utcTimestamp.time_since_epoch()));
+        SetThreadAndTimestamp(eventDesc, durationArgs);
         eventDesc.SetArgs(durationArgs.m_args);
 
         // The "id" field is optional for a duration event
@@ -245,9 +258,7 @@ namespace AZ::Metrics
         eventDesc.SetCategory(durationArgs.m_cat);
         eventDesc.SetEventPhase(EventPhase::DurationEnd);
         eventDesc.SetProcessId(AZ::Platform::GetCurrentProcessId());
-        eventDesc.SetThreadId(AZStd::this_thread::get_id());
-        auto utcTimestamp = AZStd::chrono::utc_clock::now();
-        eventDesc.SetTimestamp(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(utcTimestamp.time_since_epoch()));
+        SetThreadAndTimestamp(eventDesc, durationArgs);
         eventDesc.SetArgs(durationArgs.m_args);
 
         // The "id" field is optional for a duration event
@@ -279,9 +290,7 @@ namespace AZ::Metrics
         eventDesc.SetCategory(completeArgs.m_cat);
         eventDesc.SetEventPhase(EventPhase::Complete);
         eventDesc.SetProcessId(AZ::Platform::GetCurrentProcessId());
-        eventDesc.SetThreadId(AZStd::this_thread::get_id());
-        auto utcTimestamp = AZStd::chrono::utc_clock::now();
-        eventDesc.SetTimestamp(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(utcTimestamp.time_since_epoch()));
+        SetThreadAndTimestamp(eventDesc, completeArgs);
         eventDesc.SetArgs(completeArgs.m_args);
 
         // The "id" field is optional for a complete event
@@ -326,9 +335,7 @@ namespace AZ::Metrics
         eventDesc.SetCategory(instantArgs.m_cat);
         eventDesc.SetEventPhase(EventPhase::Instant);
         eventDesc.SetProcessId(AZ::Platform::GetCurrentProcessId());
-        eventDesc.SetThreadId(AZStd::this_thread::get_id());
-        auto utcTimestamp = AZStd::chrono::utc_clock::now();
-        eventDesc.SetTimestamp(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(utcTimestamp.time_since_epoch()));
+        SetThreadAndTimestamp(eventDesc, instantArgs);
         eventDesc.SetArgs(instantArgs.m_args);
 
         // The "id" field is optional for an instant event
@@ -369,9 +376,7 @@ namespace AZ::Metrics
         eventDesc.SetCategory(counterArgs.m_cat);
         eventDesc.SetEventPhase(EventPhase::Counter);
         eventDesc.SetProcessId(AZ::Platform::GetCurrentProcessId());
-        eventDesc.SetThreadId(AZStd::this_thread::get_id());
-        auto utcTimestamp = AZStd::chrono::utc_clock::now();
-        eventDesc.SetTimestamp(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(utcTimestamp.time_since_epoch()));
+        SetThreadAndTimestamp(eventDesc, counterArgs);
         eventDesc.SetArgs(counterArgs.m_args);
 
         // The "id" field is optional for a counter event
@@ -403,9 +408,7 @@ namespace AZ::Metrics
         eventDesc.SetCategory(asyncArgs.m_cat);
         eventDesc.SetEventPhase(EventPhase::AsyncStart);
         eventDesc.SetProcessId(AZ::Platform::GetCurrentProcessId());
-        eventDesc.SetThreadId(AZStd::this_thread::get_id());
-        auto utcTimestamp = AZStd::chrono::utc_clock::now();
-        eventDesc.SetTimestamp(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(utcTimestamp.time_since_epoch()));
+        SetThreadAndTimestamp(eventDesc, asyncArgs);
         eventDesc.SetArgs(asyncArgs.m_args);
 
         // The "id" field is required for an async event
@@ -448,9 +451,7 @@ namespace AZ::Metrics
         eventDesc.SetCategory(asyncArgs.m_cat);
         eventDesc.SetEventPhase(EventPhase::AsyncInstant);
         eventDesc.SetProcessId(AZ::Platform::GetCurrentProcessId());
-        eventDesc.SetThreadId(AZStd::this_thread::get_id());
-        auto utcTimestamp = AZStd::chrono::utc_clock::now();
-        eventDesc.SetTimestamp(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(utcTimestamp.time_since_epoch()));
+        SetThreadAndTimestamp(eventDesc, asyncArgs);
         eventDesc.SetArgs(asyncArgs.m_args);
 
         // The "id" field is required for an async event
@@ -493,9 +494,7 @@ namespace AZ::Metrics
         eventDesc.SetCategory(asyncArgs.m_cat);
         eventDesc.SetEventPhase(EventPhase::AsyncEnd);
         eventDesc.SetProcessId(AZ::Platform::GetCurrentProcessId());
-        eventDesc.SetThreadId(AZStd::this_thread::get_id());
-        auto utcTimestamp = AZStd::chrono::utc_clock::now();
-        eventDesc.SetTimestamp(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(utcTimestamp.time_since_epoch()));
+        SetThreadAndTimestamp(eventDesc, asyncArgs);
         eventDesc.SetArgs(asyncArgs.m_args);
 
         // The "id" field is required for an async event
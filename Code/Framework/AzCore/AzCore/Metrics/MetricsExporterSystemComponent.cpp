@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Metrics/IMetricsRegistry.h>
+#include <AzCore/Metrics/MetricsExporterSystemComponent.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Time/ITime.h>
+
+namespace AZ::Metrics
+{
+    AZ_CVAR(AZ::CVarFixedString, metrics_prometheusFile, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "File the metrics are periodically written to in the Prometheus text exposition format, for example"
+        " <node_exporter textfile directory>/o3de.prom. Empty disables the export.");
+    AZ_CVAR(AZ::TimeMs, metrics_exportPeriodMs, AZ::TimeMs{ 10000 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "How often the metrics are written to metrics_prometheusFile. Read when the MetricsExporterSystemComponent is activated.");
+
+    void MetricsExporterSystemComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<MetricsExporterSystemComponent, AZ::Component>()
+                ->Version(1);
+        }
+    }
+
+    void MetricsExporterSystemComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("MetricsExporterService"));
+    }
+
+    void MetricsExporterSystemComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("MetricsExporterService"));
+    }
+
+    void MetricsExporterSystemComponent::GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent)
+    {
+        dependent.push_back(AZ_CRC_CE("EventSchedulerService"));
+    }
+
+    void MetricsExporterSystemComponent::Activate()
+    {
+        m_exportEvent.Enqueue(metrics_exportPeriodMs, true);
+    }
+
+    void MetricsExporterSystemComponent::Deactivate()
+    {
+        m_exportEvent.RemoveFromQueue();
+    }
+
+    void MetricsExporterSystemComponent::ExportMetrics()
+    {
+        const AZ::CVarFixedString prometheusFile = metrics_prometheusFile;
+        auto* metricsRegistry = MetricsRegistry::Get();
+        if (prometheusFile.empty() || metricsRegistry == nullptr)
+        {
+            return;
+        }
+
+        AZ::IO::FixedMaxPath filePath;
+        if (!AZ::IO::FileIOBase::GetInstance() || !AZ::IO::FileIOBase::GetInstance()->ResolvePath(filePath, AZ::IO::PathView(prometheusFile)))
+        {
+            filePath = prometheusFile;
+        }
+
+        AZStd::string output;
+        WritePrometheusText(*metricsRegistry, output);
+
+        // Writes to a temporary file which replaces the exported file, since the collectors may read the file at any time
+        AZ::IO::FixedMaxPath tempFilePath = filePath;
+        tempFilePath.ReplaceExtension(".prom.tmp");
+        AZ::IO::SystemFile tempFile;
+        if (!tempFile.Open(tempFilePath.c_str(),
+                AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("MetricsExporter", false, "Unable to open '%s' to export the metrics to", tempFilePath.c_str());
+            return;
+        }
+        tempFile.Write(output.data(), output.size());
+        tempFile.Close();
+
+        if (!AZ::IO::SystemFile::Rename(tempFilePath.c_str(), filePath.c_str(), true))
+        {
+            AZ_Warning("MetricsExporter", false, "Unable to replace '%s' with the exported metrics", filePath.c_str());
+        }
+    }
+
+    void MetricsExporterSystemComponent::DumpMetrics([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (auto* metricsRegistry = MetricsRegistry::Get())
+        {
+            AZStd::string output;
+            WritePrometheusText(*metricsRegistry, output);
+            AZ_Printf("MetricsExporter", "%s", output.c_str());
+        }
+    }
+} // namespace AZ::Metrics
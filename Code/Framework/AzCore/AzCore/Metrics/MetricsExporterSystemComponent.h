@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/Name/Name.h>
+
+namespace AZ::Metrics
+{
+    //! Periodically writes the metrics of the MetricsRegistry in the Prometheus text exposition format to the file of the
+    //! metrics_prometheusFile cvar, for example for the textfile collector of the Prometheus node exporter on dedicated servers.
+    //! The file is replaced atomically, so the collector never reads a partially written file.
+    class MetricsExporterSystemComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(MetricsExporterSystemComponent, "{B3F2E6A1-7C4D-4E9B-8A15-D6C0F9E2A378}");
+
+        static void Reflect(AZ::ReflectContext* context);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+        static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent);
+
+        MetricsExporterSystemComponent() = default;
+        ~MetricsExporterSystemComponent() override = default;
+
+    protected:
+        // AZ::Component overrides
+        void Activate() override;
+        void Deactivate() override;
+
+    private:
+        void ExportMetrics();
+
+        void DumpMetrics(const AZ::ConsoleCommandContainer& arguments);
+        AZ_CONSOLEFUNC(MetricsExporterSystemComponent, DumpMetrics, AZ::ConsoleFunctorFlags::Null,
+            "Prints the metrics of the MetricsRegistry in the Prometheus text exposition format");
+
+        AZ::ScheduledEvent m_exportEvent{ [this]()
+                                          {
+                                              ExportMetrics();
+                                          },
+                                          AZ::Name("MetricsExporter") };
+    };
+} // namespace AZ::Metrics
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Metrics/MetricsRegistryImpl.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+
+namespace AZ::Metrics
+{
+    MetricsRegistryImpl::MetricsRegistryImpl() = default;
+    MetricsRegistryImpl::~MetricsRegistryImpl() = default;
+
+    template<class MetricT, class MetricFactory>
+    MetricT* MetricsRegistryImpl::RegisterMetric(MetricType type, AZStd::string_view name, MetricFactory&& metricFactory)
+    {
+        if (!IsValidMetricName(name))
+        {
+            AZ_Error("MetricsRegistry", false, "'%.*s' is not a valid metric name. Metric names are made of letters, digits,"
+                " underscores and colons, and don't start with a digit", AZ_STRING_ARG(name));
+            return nullptr;
+        }
+
+        AZStd::scoped_lock lock(m_metricsMutex);
+        if (auto metricIt = m_metrics.find(name); metricIt != m_metrics.end())
+        {
+            if (metricIt->second->GetType() != type)
+            {
+                AZ_Error("MetricsRegistry", false, "Metric '%.*s' is already registered with another type", AZ_STRING_ARG(name));
+                return nullptr;
+            }
+            return static_cast<MetricT*>(metricIt->second.get());
+        }
+
+        auto metric = metricFactory();
+        MetricT* metricPtr = metric.get();
+        m_metrics.emplace(AZStd::string(name), AZStd::move(metric));
+        return metricPtr;
+    }
+
+    Counter* MetricsRegistryImpl::RegisterCounter(AZStd::string_view name, AZStd::string_view help)
+    {
+        return RegisterMetric<Counter>(MetricType::Counter, name, [name, help]()
+        {
+            return AZStd::make_unique<Counter>(name, help);
+        });
+    }
+
+    Gauge* MetricsRegistryImpl::RegisterGauge(AZStd::string_view name, AZStd::string_view help)
+    {
+        return RegisterMetric<Gauge>(MetricType::Gauge, name, [name, help]()
+        {
+            return AZStd::make_unique<Gauge>(name, help);
+        });
+    }
+
+    Histogram* MetricsRegistryImpl::RegisterHistogram(AZStd::string_view name, AZStd::string_view help, AZStd::span<const double> bucketBounds)
+    {
+        return RegisterMetric<Histogram>(MetricType::Histogram, name, [name, help, bucketBounds]()
+        {
+            return AZStd::make_unique<Histogram>(name, help, bucketBounds);
+        });
+    }
+
+    bool MetricsRegistryImpl::UnregisterMetric(AZStd::string_view name)
+    {
+        AZStd::scoped_lock lock(m_metricsMutex);
+        if (auto metricIt = m_metrics.find(name); metricIt != m_metrics.end())
+        {
+            m_metrics.erase(metricIt);
+            return true;
+        }
+        return false;
+    }
+
+    Metric* MetricsRegistryImpl::FindMetric(AZStd::string_view name) const
+    {
+        AZStd::scoped_lock lock(m_metricsMutex);
+        auto metricIt = m_metrics.find(name);
+        return metricIt != m_metrics.end() ? metricIt->second.get() : nullptr;
+    }
+
+    void MetricsRegistryImpl::VisitMetrics(const VisitMetricCallback& visitor) const
+    {
+        AZStd::scoped_lock lock(m_metricsMutex);
+        for (const auto& [name, metric] : m_metrics)
+        {
+            if (!visitor(*metric))
+            {
+                break;
+            }
+        }
+    }
+} // namespace AZ::Metrics
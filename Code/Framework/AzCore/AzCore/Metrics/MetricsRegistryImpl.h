@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Metrics/IMetricsRegistry.h>
+#include <AzCore/std/containers/map.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ::Metrics
+{
+    class MetricsRegistryImpl final
+        : public IMetricsRegistry
+    {
+    public:
+        AZ_RTTI(MetricsRegistryImpl, "{0E7C1D3B-8F6A-4C52-B1D9-2A7E5F3C9B64}", IMetricsRegistry);
+        AZ_CLASS_ALLOCATOR(MetricsRegistryImpl, AZ::SystemAllocator);
+
+        MetricsRegistryImpl();
+        ~MetricsRegistryImpl();
+
+        Counter* RegisterCounter(AZStd::string_view name, AZStd::string_view help) override;
+        Gauge* RegisterGauge(AZStd::string_view name, AZStd::string_view help) override;
+        Histogram* RegisterHistogram(AZStd::string_view name, AZStd::string_view help, AZStd::span<const double> bucketBounds) override;
+
+        bool UnregisterMetric(AZStd::string_view name) override;
+
+        [[nodiscard]] Metric* FindMetric(AZStd::string_view name) const override;
+
+        void VisitMetrics(const VisitMetricCallback&) const override;
+
+    private:
+        //! Returns the metric registered with the name if it has the type, otherwise registers the metric made by the factory
+        //! if no metric is registered with the name
+        template<class MetricT, class MetricFactory>
+        MetricT* RegisterMetric(MetricType type, AZStd::string_view name, MetricFactory&& metricFactory);
+
+        // Ordered by name, so the exported metrics are in a stable order
+        using MetricMap = AZStd::map<AZStd::string, AZStd::unique_ptr<Metric>, AZStd::less<>>;
+        MetricMap m_metrics;
+        mutable AZStd::mutex m_metricsMutex;
+    };
+} // namespace AZ::Metrics
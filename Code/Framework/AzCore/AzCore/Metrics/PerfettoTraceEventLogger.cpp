@@ -0,0 +1,628 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Metrics/PerfettoTraceEventLogger.h>
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/Platform.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ::Metrics
+{
+    // Field numbers of the messages of the Perfetto trace format, see https://perfetto.dev/docs/reference/trace-packet-proto
+    namespace PerfettoFields
+    {
+        constexpr uint32_t TracePacket = 1; // Trace.packet
+
+        constexpr uint32_t PacketTimestamp = 8;
+        constexpr uint32_t PacketSequenceId = 10; // trusted_packet_sequence_id
+        constexpr uint32_t PacketTrackEvent = 11;
+        constexpr uint32_t PacketInternedData = 12;
+        constexpr uint32_t PacketSequenceFlags = 13;
+        constexpr uint32_t PacketTrackDescriptor = 60;
+
+        constexpr uint32_t TrackDescriptorUuid = 1;
+        constexpr uint32_t TrackDescriptorName = 2;
+        constexpr uint32_t TrackDescriptorProcess = 3;
+        constexpr uint32_t TrackDescriptorThread = 4;
+        constexpr uint32_t TrackDescriptorParentUuid = 5;
+        constexpr uint32_t TrackDescriptorCounter = 8;
+
+        constexpr uint32_t ProcessDescriptorPid = 1;
+        constexpr uint32_t ProcessDescriptorName = 6;
+
+        constexpr uint32_t ThreadDescriptorPid = 1;
+        constexpr uint32_t ThreadDescriptorTid = 2;
+
+        constexpr uint32_t TrackEventCategoryIids = 3;
+        constexpr uint32_t TrackEventDebugAnnotations = 4;
+        constexpr uint32_t TrackEventType = 9;
+        constexpr uint32_t TrackEventNameIid = 10;
+        constexpr uint32_t TrackEventTrackUuid = 11;
+        constexpr uint32_t TrackEventCounterValue = 30;
+        constexpr uint32_t TrackEventDoubleCounterValue = 44;
+
+        constexpr uint32_t InternedEventCategories = 1;
+        constexpr uint32_t InternedEventNames = 2;
+        constexpr uint32_t InternedEntryIid = 1;
+        constexpr uint32_t InternedEntryName = 2;
+
+        constexpr uint32_t DebugAnnotationBool = 2;
+        constexpr uint32_t DebugAnnotationUint = 3;
+        constexpr uint32_t DebugAnnotationInt = 4;
+        constexpr uint32_t DebugAnnotationDouble = 5;
+        constexpr uint32_t DebugAnnotationString = 6;
+        constexpr uint32_t DebugAnnotationName = 10;
+        constexpr uint32_t DebugAnnotationDictEntries = 11;
+        constexpr uint32_t DebugAnnotationArrayValues = 12;
+    } // namespace PerfettoFields
+
+    // TrackEvent.Type
+    constexpr int TypeSliceBegin = 1;
+    constexpr int TypeSliceEnd = 2;
+    constexpr int TypeInstant = 3;
+    constexpr int TypeCounter = 4;
+
+    // TracePacket.SequenceFlags
+    constexpr AZ::u64 SequenceIncrementalStateCleared = 1;
+    constexpr AZ::u64 SequenceNeedsIncrementalState = 2;
+
+    // All the packets of a logger are written to a single sequence
+    constexpr AZ::u64 SequenceId = 1;
+
+    // The track uuids of the different kinds of tracks are kept apart by their top bits
+    constexpr AZ::u64 ProcessTrackTag = AZ::u64{ 1 } << 62;
+    constexpr AZ::u64 ThreadTrackTag = AZ::u64{ 2 } << 62;
+    constexpr AZ::u64 NamedTrackTag = AZ::u64{ 3 } << 62;
+    constexpr AZ::u64 TrackTagMask = ~(AZ::u64{ 3 } << 62);
+
+    enum class WireType : uint32_t
+    {
+        Varint = 0,
+        Fixed64 = 1,
+        LengthDelimited = 2,
+    };
+
+    using ByteBuffer = PerfettoTraceEventLogger::ByteBuffer;
+
+    static void AppendVarint(ByteBuffer& buffer, AZ::u64 value)
+    {
+        while (value >= 0x80)
+        {
+            buffer.push_back(static_cast<AZ::u8>(value | 0x80));
+            value >>= 7;
+        }
+        buffer.push_back(static_cast<AZ::u8>(value));
+    }
+
+    static void AppendTag(ByteBuffer& buffer, uint32_t field, WireType wireType)
+    {
+        AppendVarint(buffer, (AZ::u64{ field } << 3) | static_cast<uint32_t>(wireType));
+    }
+
+    static void AppendVarintField(ByteBuffer& buffer, uint32_t field, AZ::u64 value)
+    {
+        AppendTag(buffer, field, WireType::Varint);
+        AppendVarint(buffer, value);
+    }
+
+    static void AppendDoubleField(ByteBuffer& buffer, uint32_t field, double value)
+    {
+        AppendTag(buffer, field, WireType::Fixed64);
+        AZ::u64 bits;
+        memcpy(&bits, &value, sizeof(bits));
+        // The protobuf wire format is little endian, like all the supported platforms
+        const auto* bytes = reinterpret_cast<const AZ::u8*>(&bits);
+        buffer.insert(buffer.end(), bytes, bytes + sizeof(bits));
+    }
+
+    static void AppendBytesField(ByteBuffer& buffer, uint32_t field, const void* data, size_t size)
+    {
+        AppendTag(buffer, field, WireType::LengthDelimited);
+        AppendVarint(buffer, size);
+        const auto* bytes = static_cast<const AZ::u8*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    }
+
+    static void AppendStringField(ByteBuffer& buffer, uint32_t field, AZStd::string_view value)
+    {
+        AppendBytesField(buffer, field, value.data(), value.size());
+    }
+
+    static void AppendMessageField(ByteBuffer& buffer, uint32_t field, const ByteBuffer& message)
+    {
+        AppendBytesField(buffer, field, message.data(), message.size());
+    }
+
+    // Events are attributed to the recording thread at the time of recording, unless the arguments specify otherwise
+    static AZStd::thread::id GetThreadId(const EventArgs& eventArgs)
+    {
+        return eventArgs.m_tid ? *eventArgs.m_tid : AZStd::this_thread::get_id();
+    }
+
+    static AZ::u64 GetTimestampNs(const EventArgs& eventArgs)
+    {
+        const AZStd::chrono::microseconds timestamp = eventArgs.m_ts
+            ? *eventArgs.m_ts
+            : AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::utc_clock::now().time_since_epoch());
+        return static_cast<AZ::u64>(AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(timestamp).count());
+    }
+
+    static void AppendDebugAnnotationValue(ByteBuffer& annotation, const EventValue& value);
+
+    static void AppendDebugAnnotation(ByteBuffer& buffer, uint32_t field, const EventField& eventField)
+    {
+        ByteBuffer annotation;
+        AppendStringField(annotation, PerfettoFields::DebugAnnotationName, eventField.m_name);
+        AppendDebugAnnotationValue(annotation, eventField.m_value);
+        AppendMessageField(buffer, field, annotation);
+    }
+
+    static void AppendDebugAnnotationValue(ByteBuffer& annotation, const EventValue& value)
+    {
+        AZStd::visit(
+            [&annotation](auto&& fieldValue)
+            {
+                using FieldType = AZStd::remove_cvref_t<decltype(fieldValue)>;
+                if constexpr (AZStd::same_as<FieldType, AZStd::string_view>)
+                {
+                    AppendStringField(annotation, PerfettoFields::DebugAnnotationString, fieldValue);
+                }
+                else if constexpr (AZStd::same_as<FieldType, bool>)
+                {
+                    AppendVarintField(annotation, PerfettoFields::DebugAnnotationBool, fieldValue ? 1 : 0);
+                }
+                else if constexpr (AZStd::same_as<FieldType, AZ::s64>)
+                {
+                    AppendVarintField(annotation, PerfettoFields::DebugAnnotationInt, static_cast<AZ::u64>(fieldValue));
+                }
+                else if constexpr (AZStd::same_as<FieldType, AZ::u64>)
+                {
+                    AppendVarintField(annotation, PerfettoFields::DebugAnnotationUint, fieldValue);
+                }
+                else if constexpr (AZStd::same_as<FieldType, double>)
+                {
+                    AppendDoubleField(annotation, PerfettoFields::DebugAnnotationDouble, fieldValue);
+                }
+                else if constexpr (AZStd::same_as<FieldType, EventArray>)
+                {
+                    for (const EventValue& arrayValue : fieldValue.GetArrayValues())
+                    {
+                        ByteBuffer entry;
+                        AppendDebugAnnotationValue(entry, arrayValue);
+                        AppendMessageField(annotation, PerfettoFields::DebugAnnotationArrayValues, entry);
+                    }
+                }
+                else if constexpr (AZStd::same_as<FieldType, EventObject>)
+                {
+                    for (const EventField& objectField : fieldValue.GetObjectFields())
+                    {
+                        AppendDebugAnnotation(annotation, PerfettoFields::DebugAnnotationDictEntries, objectField);
+                    }
+                }
+            },
+            value.m_value);
+    }
+
+    static void AppendDebugAnnotations(ByteBuffer& trackEvent, AZStd::span<const EventField> args)
+    {
+        for (const EventField& arg : args)
+        {
+            AppendDebugAnnotation(trackEvent, PerfettoFields::TrackEventDebugAnnotations, arg);
+        }
+    }
+
+    static AZ::u64 GetNamedTrackUuid(AZStd::string_view key)
+    {
+        return NamedTrackTag | (AZStd::hash<AZStd::string_view>{}(key) & TrackTagMask);
+    }
+
+    PerfettoTraceEventLogger::PerfettoTraceEventLogger() = default;
+
+    PerfettoTraceEventLogger::PerfettoTraceEventLogger(AZStd::unique_ptr<AZ::IO::GenericStream> stream, AZStd::string_view name)
+        : m_stream(AZStd::move(stream))
+        , m_name(name)
+    {
+    }
+
+    PerfettoTraceEventLogger::~PerfettoTraceEventLogger()
+    {
+        ResetStream(nullptr);
+    }
+
+    void PerfettoTraceEventLogger::SetName(AZStd::string_view name)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        m_name = name;
+    }
+
+    AZStd::string_view PerfettoTraceEventLogger::GetName() const
+    {
+        return m_name;
+    }
+
+    void PerfettoTraceEventLogger::Flush()
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        WriteBufferedSlices();
+    }
+
+    void PerfettoTraceEventLogger::ResetStream(AZStd::unique_ptr<AZ::IO::GenericStream> stream)
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        WriteBufferedSlices();
+        m_stream = AZStd::move(stream);
+
+        // The interned names and the track descriptors are per stream
+        m_nameIids.clear();
+        m_categoryIids.clear();
+        m_describedTracks.clear();
+        m_sequenceStarted = false;
+    }
+
+    auto PerfettoTraceEventLogger::RecordDurationEventBegin(const DurationArgs& durationArgs) -> ResultOutcome
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return RecordSliceEvent(GetThreadTrack(GetThreadId(durationArgs)), TypeSliceBegin, durationArgs);
+    }
+
+    auto PerfettoTraceEventLogger::RecordDurationEventEnd(const DurationArgs& durationArgs) -> ResultOutcome
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return RecordSliceEvent(GetThreadTrack(GetThreadId(durationArgs)), TypeSliceEnd, durationArgs);
+    }
+
+    auto PerfettoTraceEventLogger::RecordCompleteEvent(const CompleteArgs& completeArgs) -> ResultOutcome
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        if (m_stream == nullptr)
+        {
+            return AZ::Failure(ErrorString("Logger has no output stream associated. The complete event cannot be recorded"));
+        }
+
+        const AZ::u64 trackUuid = GetThreadTrack(GetThreadId(completeArgs));
+
+        // The slice is written on flush, the new interned names are written now so the sequence keeps them
+        ByteBuffer internedData;
+        BufferedSlice slice;
+        slice.m_startNs = GetTimestampNs(completeArgs);
+        slice.m_endNs = slice.m_startNs + static_cast<AZ::u64>(AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(completeArgs.m_dur).count());
+        slice.m_nameIid = InternName(completeArgs.m_name, internedData);
+        slice.m_categoryIid = completeArgs.m_cat.empty() ? 0 : InternCategory(completeArgs.m_cat, internedData);
+        AppendDebugAnnotations(slice.m_annotations, completeArgs.m_args);
+
+        if (!internedData.empty())
+        {
+            WriteSequenceStart();
+            ByteBuffer packet;
+            AppendMessageField(packet, PerfettoFields::PacketInternedData, internedData);
+            AppendVarintField(packet, PerfettoFields::PacketSequenceId, SequenceId);
+            AppendVarintField(packet, PerfettoFields::PacketSequenceFlags, SequenceNeedsIncrementalState);
+            WritePacket(packet);
+        }
+        m_bufferedSlices[trackUuid].push_back(AZStd::move(slice));
+        return AZ::Success();
+    }
+
+    auto PerfettoTraceEventLogger::RecordInstantEvent(const InstantArgs& instantArgs) -> ResultOutcome
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        const AZ::u64 trackUuid = instantArgs.m_scope == InstantEventScope::Thread ? GetThreadTrack(GetThreadId(instantArgs)) : GetProcessTrack();
+        return RecordSliceEvent(trackUuid, TypeInstant, instantArgs);
+    }
+
+    auto PerfettoTraceEventLogger::RecordCounterEvent(const CounterArgs& counterArgs) -> ResultOutcome
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        if (m_stream == nullptr)
+        {
+            return AZ::Failure(ErrorString("Logger has no output stream associated. The counter event cannot be recorded"));
+        }
+
+        // Every numeric argument is a series of values of the counter, each on its own counter track
+        const AZ::u64 timestampNs = GetTimestampNs(counterArgs);
+        for (const EventField& arg : counterArgs.m_args)
+        {
+            ByteBuffer trackEvent;
+            AZStd::visit(
+                [&trackEvent](auto&& fieldValue)
+                {
+                    using FieldType = AZStd::remove_cvref_t<decltype(fieldValue)>;
+                    if constexpr (AZStd::same_as<FieldType, AZ::s64> || AZStd::same_as<FieldType, AZ::u64>)
+                    {
+                        AppendVarintField(trackEvent, PerfettoFields::TrackEventCounterValue, static_cast<AZ::u64>(fieldValue));
+                    }
+                    else if constexpr (AZStd::same_as<FieldType, double>)
+                    {
+                        AppendDoubleField(trackEvent, PerfettoFields::TrackEventDoubleCounterValue, fieldValue);
+                    }
+                    else if constexpr (AZStd::same_as<FieldType, bool>)
+                    {
+                        AppendVarintField(trackEvent, PerfettoFields::TrackEventCounterValue, fieldValue ? 1 : 0);
+                    }
+                },
+                arg.m_value.m_value);
+            if (trackEvent.empty())
+            {
+                continue;
+            }
+
+            const AZStd::string counterName = AZStd::string::format("%.*s.%.*s", AZ_STRING_ARG(counterArgs.m_name), AZ_STRING_ARG(arg.m_name));
+            AppendVarintField(trackEvent, PerfettoFields::TrackEventType, TypeCounter);
+            AppendVarintField(trackEvent, PerfettoFields::TrackEventTrackUuid, GetCounterTrack(counterName));
+            WriteTrackEvent(timestampNs, trackEvent, {});
+        }
+        return AZ::Success();
+    }
+
+    auto PerfettoTraceEventLogger::RecordAsyncEventStart(const AsyncArgs& asyncArgs) -> ResultOutcome
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return RecordSliceEvent(GetAsyncTrack(asyncArgs.m_cat, asyncArgs.m_id, asyncArgs.m_name), TypeSliceBegin, asyncArgs);
+    }
+
+    auto PerfettoTraceEventLogger::RecordAsyncEventInstant(const AsyncArgs& asyncArgs) -> ResultOutcome
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return RecordSliceEvent(GetAsyncTrack(asyncArgs.m_cat, asyncArgs.m_id, asyncArgs.m_name), TypeInstant, asyncArgs);
+    }
+
+    auto PerfettoTraceEventLogger::RecordAsyncEventEnd(const AsyncArgs& asyncArgs) -> ResultOutcome
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        return RecordSliceEvent(GetAsyncTrack(asyncArgs.m_cat, asyncArgs.m_id, asyncArgs.m_name), TypeSliceEnd, asyncArgs);
+    }
+
+    auto PerfettoTraceEventLogger::RecordSliceEvent(AZ::u64 trackUuid, int eventType, const EventArgs& eventArgs) -> ResultOutcome
+    {
+        if (m_stream == nullptr)
+        {
+            return AZ::Failure(ErrorString("Logger has no output stream associated. The event cannot be recorded"));
+        }
+
+        ByteBuffer internedData;
+        ByteBuffer trackEvent;
+        AppendVarintField(trackEvent, PerfettoFields::TrackEventType, eventType);
+        AppendVarintField(trackEvent, PerfettoFields::TrackEventTrackUuid, trackUuid);
+        // The name and category of the slice are taken from its begin event
+        if (eventType != TypeSliceEnd)
+        {
+            AppendVarintField(trackEvent, PerfettoFields::TrackEventNameIid, InternName(eventArgs.m_name, internedData));
+            if (!eventArgs.m_cat.empty())
+            {
+                AppendVarintField(trackEvent, PerfettoFields::TrackEventCategoryIids, InternCategory(eventArgs.m_cat, internedData));
+            }
+        }
+        AppendDebugAnnotations(trackEvent, eventArgs.m_args);
+        WriteTrackEvent(GetTimestampNs(eventArgs), trackEvent, internedData);
+        return AZ::Success();
+    }
+
+    void PerfettoTraceEventLogger::WriteBufferedSlices()
+    {
+        if (m_stream == nullptr)
+        {
+            m_bufferedSlices.clear();
+            return;
+        }
+
+        AZStd::vector<const BufferedSlice*> openSlices;
+        for (auto& [trackUuid, slices] : m_bufferedSlices)
+        {
+            // Parents come before their children, which start at the same time or later and end at the same time or earlier
+            AZStd::sort(slices.begin(), slices.end(),
+                [](const BufferedSlice& lhs, const BufferedSlice& rhs)
+                {
+                    return lhs.m_startNs != rhs.m_startNs ? lhs.m_startNs < rhs.m_startNs : lhs.m_endNs > rhs.m_endNs;
+                });
+
+            auto writeSliceEnd = [this, trackUuid = trackUuid](const BufferedSlice& slice)
+            {
+                ByteBuffer trackEvent;
+                AppendVarintField(trackEvent, PerfettoFields::TrackEventType, TypeSliceEnd);
+                AppendVarintField(trackEvent, PerfettoFields::TrackEventTrackUuid, trackUuid);
+                WriteTrackEvent(slice.m_endNs, trackEvent, {});
+            };
+
+            openSlices.clear();
+            for (const BufferedSlice& slice : slices)
+            {
+                while (!openSlices.empty() && openSlices.back()->m_endNs <= slice.m_startNs)
+                {
+                    writeSliceEnd(*openSlices.back());
+                    openSlices.pop_back();
+                }
+
+                ByteBuffer trackEvent;
+                AppendVarintField(trackEvent, PerfettoFields::TrackEventType, TypeSliceBegin);
+                AppendVarintField(trackEvent, PerfettoFields::TrackEventTrackUuid, trackUuid);
+                AppendVarintField(trackEvent, PerfettoFields::TrackEventNameIid, slice.m_nameIid);
+                if (slice.m_categoryIid != 0)
+                {
+                    AppendVarintField(trackEvent, PerfettoFields::TrackEventCategoryIids, slice.m_categoryIid);
+                }
+                trackEvent.insert(trackEvent.end(), slice.m_annotations.begin(), slice.m_annotations.end());
+                WriteTrackEvent(slice.m_startNs, trackEvent, {});
+                openSlices.push_back(&slice);
+            }
+
+            while (!openSlices.empty())
+            {
+                writeSliceEnd(*openSlices.back());
+                openSlices.pop_back();
+            }
+        }
+        m_bufferedSlices.clear();
+    }
+
+    void PerfettoTraceEventLogger::WriteSequenceStart()
+    {
+        if (m_sequenceStarted)
+        {
+            return;
+        }
+        m_sequenceStarted = true;
+
+        ByteBuffer packet;
+        AppendVarintField(packet, PerfettoFields::PacketSequenceId, SequenceId);
+        AppendVarintField(packet, PerfettoFields::PacketSequenceFlags, SequenceIncrementalStateCleared);
+        WritePacket(packet);
+    }
+
+    void PerfettoTraceEventLogger::WritePacket(const ByteBuffer& packet)
+    {
+        ByteBuffer header;
+        AppendTag(header, PerfettoFields::TracePacket, WireType::LengthDelimited);
+        AppendVarint(header, packet.size());
+        m_stream->Write(header.size(), header.data());
+        m_stream->Write(packet.size(), packet.data());
+    }
+
+    void PerfettoTraceEventLogger::WriteTrackEvent(AZ::u64 timestampNs, const ByteBuffer& trackEvent, const ByteBuffer& internedData)
+    {
+        WriteSequenceStart();
+
+        ByteBuffer packet;
+        AppendVarintField(packet, PerfettoFields::PacketTimestamp, timestampNs);
+        AppendMessageField(packet, PerfettoFields::PacketTrackEvent, trackEvent);
+        if (!internedData.empty())
+        {
+            AppendMessageField(packet, PerfettoFields::PacketInternedData, internedData);
+        }
+        AppendVarintField(packet, PerfettoFields::PacketSequenceId, SequenceId);
+        AppendVarintField(packet, PerfettoFields::PacketSequenceFlags, SequenceNeedsIncrementalState);
+        WritePacket(packet);
+    }
+
+    AZ::u64 PerfettoTraceEventLogger::GetProcessTrack()
+    {
+        const AZ::u64 processId = AZ::Platform::GetCurrentProcessId();
+        const AZ::u64 trackUuid = ProcessTrackTag | (processId & TrackTagMask);
+        if (m_describedTracks.insert(trackUuid).second)
+        {
+            WriteSequenceStart();
+
+            ByteBuffer process;
+            AppendVarintField(process, PerfettoFields::ProcessDescriptorPid, processId);
+            if (!m_name.empty())
+            {
+                AppendStringField(process, PerfettoFields::ProcessDescriptorName, m_name);
+            }
+            ByteBuffer track;
+            AppendVarintField(track, PerfettoFields::TrackDescriptorUuid, trackUuid);
+            AppendMessageField(track, PerfettoFields::TrackDescriptorProcess, process);
+            ByteBuffer packet;
+            AppendMessageField(packet, PerfettoFields::PacketTrackDescriptor, track);
+            AppendVarintField(packet, PerfettoFields::PacketSequenceId, SequenceId);
+            WritePacket(packet);
+        }
+        return trackUuid;
+    }
+
+    AZ::u64 PerfettoTraceEventLogger::GetThreadTrack(AZStd::thread::id threadId)
+    {
+        // Since only little_endian platforms are supported reinterprets the thread id as a uintptr_t type, like the JsonTraceEventLogger
+        uintptr_t numericThreadId{};
+        *reinterpret_cast<AZStd::thread_id*>(&numericThreadId) = threadId;
+
+        const AZ::u64 trackUuid = ThreadTrackTag | (static_cast<AZ::u64>(numericThreadId) & TrackTagMask);
+        if (!m_describedTracks.contains(trackUuid))
+        {
+            const AZ::u64 processTrackUuid = GetProcessTrack();
+            m_describedTracks.insert(trackUuid);
+
+            ByteBuffer thread;
+            AppendVarintField(thread, PerfettoFields::ThreadDescriptorPid, AZ::Platform::GetCurrentProcessId());
+            AppendVarintField(thread, PerfettoFields::ThreadDescriptorTid, static_cast<AZ::u32>(numericThreadId));
+            ByteBuffer track;
+            AppendVarintField(track, PerfettoFields::TrackDescriptorUuid, trackUuid);
+            AppendVarintField(track, PerfettoFields::TrackDescriptorParentUuid, processTrackUuid);
+            AppendMessageField(track, PerfettoFields::TrackDescriptorThread, thread);
+            ByteBuffer packet;
+            AppendMessageField(packet, PerfettoFields::PacketTrackDescriptor, track);
+            AppendVarintField(packet, PerfettoFields::PacketSequenceId, SequenceId);
+            WritePacket(packet);
+        }
+        return trackUuid;
+    }
+
+    AZ::u64 PerfettoTraceEventLogger::GetAsyncTrack(AZStd::string_view category, AZStd::string_view id, AZStd::string_view name)
+    {
+        const AZStd::string key = AZStd::string::format("%.*s/%.*s", AZ_STRING_ARG(category), AZ_STRING_ARG(id));
+        const AZ::u64 trackUuid = GetNamedTrackUuid(key);
+        if (!m_describedTracks.contains(trackUuid))
+        {
+            const AZ::u64 processTrackUuid = GetProcessTrack();
+            m_describedTracks.insert(trackUuid);
+
+            ByteBuffer track;
+            AppendVarintField(track, PerfettoFields::TrackDescriptorUuid, trackUuid);
+            AppendVarintField(track, PerfettoFields::TrackDescriptorParentUuid, processTrackUuid);
+            AppendStringField(track, PerfettoFields::TrackDescriptorName, name);
+            ByteBuffer packet;
+            AppendMessageField(packet, PerfettoFields::PacketTrackDescriptor, track);
+            AppendVarintField(packet, PerfettoFields::PacketSequenceId, SequenceId);
+            WritePacket(packet);
+        }
+        return trackUuid;
+    }
+
+    AZ::u64 PerfettoTraceEventLogger::GetCounterTrack(AZStd::string_view counterName)
+    {
+        const AZ::u64 trackUuid = GetNamedTrackUuid(counterName);
+        if (!m_describedTracks.contains(trackUuid))
+        {
+            const AZ::u64 processTrackUuid = GetProcessTrack();
+            m_describedTracks.insert(trackUuid);
+
+            ByteBuffer track;
+            AppendVarintField(track, PerfettoFields::TrackDescriptorUuid, trackUuid);
+            AppendVarintField(track, PerfettoFields::TrackDescriptorParentUuid, processTrackUuid);
+            AppendStringField(track, PerfettoFields::TrackDescriptorName, counterName);
+            // An empty counter descriptor makes it a counter track
+            AppendMessageField(track, PerfettoFields::TrackDescriptorCounter, {});
+            ByteBuffer packet;
+            AppendMessageField(packet, PerfettoFields::PacketTrackDescriptor, track);
+            AppendVarintField(packet, PerfettoFields::PacketSequenceId, SequenceId);
+            WritePacket(packet);
+        }
+        return trackUuid;
+    }
+
+    template<class InternedStringMap>
+    static AZ::u64 Intern(
+        InternedStringMap& iids, AZStd::string_view value, uint32_t internedField, ByteBuffer& internedData)
+    {
+        if (auto it = iids.find(value); it != iids.end())
+        {
+            return it->second;
+        }
+
+        // Interned ids start at 1
+        const AZ::u64 iid = iids.size() + 1;
+        iids.emplace(value, iid);
+
+        ByteBuffer entry;
+        AppendVarintField(entry, PerfettoFields::InternedEntryIid, iid);
+        AppendStringField(entry, PerfettoFields::InternedEntryName, value);
+        AppendMessageField(internedData, internedField, entry);
+        return iid;
+    }
+
+    AZ::u64 PerfettoTraceEventLogger::InternName(AZStd::string_view name, ByteBuffer& internedData)
+    {
+        return Intern(m_nameIids, name, PerfettoFields::InternedEventNames, internedData);
+    }
+
+    AZ::u64 PerfettoTraceEventLogger::InternCategory(AZStd::string_view category, ByteBuffer& internedData)
+    {
+        return Intern(m_categoryIids, category, PerfettoFields::InternedEventCategories, internedData);
+    }
+} // namespace AZ::Metrics
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Metrics/IEventLogger.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO
+{
+    class GenericStream;
+}
+
+namespace AZ::Metrics
+{
+    //! Event logger which writes the binary protobuf trace format of Perfetto, that can be opened with https://ui.perfetto.dev.
+    //! The event names and categories are interned and the events are binary, so traces are several times smaller and faster
+    //! to write than the json trace event format of the JsonTraceEventLogger, which matters for long captures of many threads.
+    //! Complete events are buffered until the logger is flushed, so their slices can be written in nesting order.
+    //! Events are written to one thread track per thread id, async events to one track per category and id, and counter
+    //! events to one counter track for each of their numeric arguments.
+    class PerfettoTraceEventLogger
+        : public IEventLogger
+    {
+    public:
+        PerfettoTraceEventLogger();
+        //! Generic stream which is owned by the PerfettoTraceEventLogger
+        explicit PerfettoTraceEventLogger(AZStd::unique_ptr<AZ::IO::GenericStream> stream, AZStd::string_view name = {});
+
+        //! Writes the buffered events to the stream
+        ~PerfettoTraceEventLogger();
+
+        //! Set the name associated of this event logger, which is also the name of the process track
+        void SetName(AZStd::string_view) override;
+
+        //! Returns the name associated with this event logger
+        AZStd::string_view GetName() const override;
+
+        //! Writes the buffered complete events to the stream
+        void Flush() override;
+
+        ResultOutcome RecordDurationEventBegin(const DurationArgs&) override;
+        ResultOutcome RecordDurationEventEnd(const DurationArgs&) override;
+        ResultOutcome RecordCompleteEvent(const CompleteArgs&) override;
+        ResultOutcome RecordInstantEvent(const InstantArgs&) override;
+        ResultOutcome RecordCounterEvent(const CounterArgs&) override;
+        ResultOutcome RecordAsyncEventStart(const AsyncArgs&) override;
+        ResultOutcome RecordAsyncEventInstant(const AsyncArgs&) override;
+        ResultOutcome RecordAsyncEventEnd(const AsyncArgs&) override;
+
+        //! Writes the buffered events to the previous stream, closes it and associates a new stream
+        void ResetStream(AZStd::unique_ptr<AZ::IO::GenericStream> stream);
+
+        using ByteBuffer = AZStd::vector<AZ::u8>;
+
+    private:
+        struct BufferedSlice
+        {
+            AZ::u64 m_startNs = 0;
+            AZ::u64 m_endNs = 0;
+            AZ::u64 m_nameIid = 0;
+            AZ::u64 m_categoryIid = 0;
+            //! Encoded debug annotations of the arguments of the event, empty for events without arguments
+            ByteBuffer m_annotations;
+        };
+
+        // All the functions below expect m_mutex to be locked
+        void WriteSequenceStart();
+        void WriteBufferedSlices();
+        void WritePacket(const ByteBuffer& packet);
+        void WriteTrackEvent(AZ::u64 timestampNs, const ByteBuffer& trackEvent, const ByteBuffer& internedData);
+        AZ::u64 GetProcessTrack();
+        AZ::u64 GetThreadTrack(AZStd::thread::id threadId);
+        AZ::u64 GetAsyncTrack(AZStd::string_view category, AZStd::string_view id, AZStd::string_view name);
+        AZ::u64 GetCounterTrack(AZStd::string_view counterName);
+        AZ::u64 InternName(AZStd::string_view name, ByteBuffer& internedData);
+        AZ::u64 InternCategory(AZStd::string_view category, ByteBuffer& internedData);
+        ResultOutcome RecordSliceEvent(AZ::u64 trackUuid, int eventType, const EventArgs& eventArgs);
+
+        AZStd::mutex m_mutex;
+        AZStd::unique_ptr<AZ::IO::GenericStream> m_stream;
+        AZStd::string m_name;
+
+        //! Interned ids of the event names and categories, which can be looked up without allocating
+        using InternedStringMap = AZStd::unordered_map<AZStd::string, AZ::u64, AZStd::hash<AZStd::string>, AZStd::equal_to<>>;
+        InternedStringMap m_nameIids;
+        InternedStringMap m_categoryIids;
+        AZStd::unordered_set<AZ::u64> m_describedTracks;
+        AZStd::unordered_map<AZ::u64, AZStd::vector<BufferedSlice>> m_bufferedSlices;
+
+        //! Set once the first packet of the sequence, which clears the interned state of the readers, has been written
+        bool m_sequenceStarted = false;
+    };
+} // namespace AZ::Metrics
@@ -6,7 +6,9 @@
  *
  */
 #include <AzCore/Module/Module.h>
+#include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/RTTI/ReflectionManager.h>
 
 namespace AZ
 {
@@ -25,10 +27,21 @@ namespace AZ
 
     void Module::RegisterComponentDescriptors()
     {
+        ReflectionManager* reflectionManager = IsReflectionDeferrable() ? ReflectionEnvironment::GetReflectionManager() : nullptr;
+        if (reflectionManager)
+        {
+            reflectionManager->BeginDeferrableReflection();
+        }
+
         for (const ComponentDescriptor* descriptor : m_descriptors)
         {
             AZ_Warning("AZ::Module", descriptor, "Null module descriptor is being skipped (%s)", RTTI_GetType().ToString<AZStd::string>().c_str());
             ComponentApplicationBus::Broadcast(&ComponentApplicationBus::Events::RegisterComponentDescriptor, descriptor);
         }
+
+        if (reflectionManager)
+        {
+            reflectionManager->EndDeferrableReflection();
+        }
     }
 }
@@ -71,6 +71,13 @@ namespace AZ
          */
         virtual ComponentTypeList GetRequiredSystemComponents() const { return ComponentTypeList(); }
 
+        /**
+         * Override to return true when nothing needs the script reflection of this module's components during startup.
+         * The descriptors are then reflected into the lazy reflect contexts (the BehaviorContext) only when that context
+         * is first requested, which shortens the startup of applications that don't run scripts, such as servers.
+         */
+        virtual bool IsReflectionDeferrable() const { return false; }
+
         // Non virtual, just registers component descriptors
         void RegisterComponentDescriptors();
 
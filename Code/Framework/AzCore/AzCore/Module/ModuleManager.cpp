@@ -16,9 +16,13 @@
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/ComponentApplicationLifecycle.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/NativeUI/NativeUIRequests.h>
 
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 namespace
@@ -26,6 +30,11 @@ namespace
     static const char* s_moduleLoggingScope = "Module Manager";
 }
 
+AZ_CVAR(bool, cl_prefetchModules, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Read the dynamic modules from disk on several threads before they are loaded one after another, so loading them doesn't wait on the disk");
+AZ_CVAR(uint32_t, cl_prefetchModulesThreadCount, 4, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Number of threads reading the dynamic modules from disk when cl_prefetchModules is enabled");
+
 namespace AZ
 {
     bool ShouldUseSystemComponent(const ComponentDescriptor& descriptor, const AZStd::vector<Crc32>& requiredTags, const SerializeContext& serialize)
@@ -517,6 +526,11 @@ namespace AZ
     {
         LoadModulesResult results;
 
+        if (cl_prefetchModules && lastStepToPerform >= ModuleInitializationSteps::Load)
+        {
+            PrefetchDynamicModules(modules);
+        }
+
         Internal::ModuleManagerSearchPathTool moduleSearchPathHelper;
 
         // Load DLLs specified in the application descriptor
@@ -532,6 +546,71 @@ namespace AZ
         return results;
     }
 
+    //=========================================================================
+    // PrefetchDynamicModules
+    //=========================================================================
+    void ModuleManager::PrefetchDynamicModules(const ModuleDescriptorList& modules)
+    {
+        // The operating system loader serializes the loading of the modules and the module initialization depends on
+        // the load order, so only the reads from disk are done in parallel.
+        AZStd::vector<AZ::IO::FixedMaxPathString> filePaths;
+        filePaths.reserve(modules.size());
+        for (const auto& moduleDescriptor : modules)
+        {
+            if (AZStd::shared_ptr<ModuleDataImpl> moduleData = GetLoadedModule(moduleDescriptor.m_dynamicLibraryPath);
+                moduleData && moduleData->m_lastCompletedStep >= ModuleInitializationSteps::Load)
+            {
+                continue;
+            }
+
+            // Creating the handle only resolves the path of the module file, it doesn't load it
+            if (auto moduleHandle = DynamicModuleHandle::Create(PreProcessModule(moduleDescriptor.m_dynamicLibraryPath).c_str()))
+            {
+                filePaths.emplace_back(moduleHandle->GetFilename());
+            }
+        }
+
+        if (filePaths.size() < 2)
+        {
+            return;
+        }
+
+        AZStd::atomic<size_t> nextFileIndex{ 0 };
+        auto PrefetchFiles = [&filePaths, &nextFileIndex]()
+        {
+            constexpr size_t ReadChunkSize = 256 * 1024;
+            AZStd::vector<AZ::u8> readBuffer(ReadChunkSize);
+            for (size_t fileIndex = nextFileIndex++; fileIndex < filePaths.size(); fileIndex = nextFileIndex++)
+            {
+                AZ::IO::SystemFile file;
+                if (file.Open(filePaths[fileIndex].c_str(), AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+                {
+                    while (file.Read(ReadChunkSize, readBuffer.data()) == ReadChunkSize)
+                    {
+                    }
+                }
+            }
+        };
+
+        const size_t threadCount = AZStd::clamp<size_t>(static_cast<uint32_t>(cl_prefetchModulesThreadCount), 1, filePaths.size());
+        AZStd::vector<AZStd::thread> threads;
+        threads.reserve(threadCount - 1);
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "Module Prefetch";
+        for (size_t threadIndex = 1; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back(threadDesc, PrefetchFiles);
+        }
+
+        // The calling thread takes its share of the files as well
+        PrefetchFiles();
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
     //=========================================================================
     // LoadStaticModules
     //=========================================================================
@@ -163,6 +163,10 @@ namespace AZ
         // Helper function to preprocess the module names to handle any special processing
         static AZ::OSString PreProcessModule(AZStd::string_view moduleName);
 
+        //! Reads the files of the modules that aren't loaded yet on several threads, so the operating system has them
+        //! cached when they are loaded one after another
+        void PrefetchDynamicModules(const ModuleDescriptorList& modules);
+
         // Tags to look for when activating system components
         AZStd::vector<Crc32> m_systemComponentTags;
 
@@ -106,30 +106,59 @@ namespace AZ
 
         [[maybe_unused]] bool leaksDetected = false;
 
-        for (auto i = m_dictionary.begin(), last = m_dictionary.end(); i != last;)
+        for (Shard& shard : m_shards)
         {
-            Internal::NameData* nameData = i->second.m_nameData;
-            const int useCount = nameData->m_useCount;
-
-            if (useCount == 0)
+            for (auto i = shard.m_entries.begin(), last = shard.m_entries.end(); i != last;)
             {
-                i = m_dictionary.erase(i);
-                delete nameData;
-            }
-            else
-            {
-                leaksDetected = true;
-                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, i->first, AZ_STRING_ARG(nameData->GetName()));
-                ++i;
+                Internal::NameData* nameData = i->second.m_nameData;
+                const int useCount = nameData->m_useCount;
+
+                if (useCount == 0)
+                {
+                    i = shard.m_entries.erase(i);
+                    delete nameData;
+                }
+                else
+                {
+                    leaksDetected = true;
+                    AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, i->first, AZ_STRING_ARG(nameData->GetName()));
+                    ++i;
+                }
             }
         }
 
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
     }
 
+    size_t NameDictionary::GetShardIndex(Name::Hash hash)
+    {
+        return hash & (ShardCount - 1);
+    }
+
+    auto NameDictionary::GetShard(Name::Hash hash) -> Shard&
+    {
+        return m_shards[GetShardIndex(hash)];
+    }
+
+    auto NameDictionary::GetShard(Name::Hash hash) const -> const Shard&
+    {
+        return m_shards[GetShardIndex(hash)];
+    }
+
+    size_t NameDictionary::GetEntryCount() const
+    {
+        size_t entryCount = 0;
+        for (const Shard& shard : m_shards)
+        {
+            entryCount += shard.m_entries.size();
+        }
+        return entryCount;
+    }
+
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        const Shard& shard = GetShard(hash);
+        AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
 
         // The NameData m_useCount check is to avoid a multithread race condition
         // where thread B is in NameData::release and reduces the m_useCount to 0
@@ -138,8 +167,8 @@ namespace AZ
         // If thread A continues along and releases the NameData again, before thread B can run
         // the the m_useCount can be reduced to 0 and multiple threads can be in the
         // NameData::release `if (m_useCount.fetch_sub(1) == 1)` block
-        if (auto iter = m_dictionary.find(hash);
-            iter != m_dictionary.end() && iter->second.m_nameData->m_useCount > 0)
+        if (auto iter = shard.m_entries.find(hash);
+            iter != shard.m_entries.end() && iter->second.m_nameData->m_useCount > 0)
         {
             return Name(iter->second.m_nameData);
         }
@@ -235,20 +264,22 @@ namespace AZ
             return AZStd::move(name);
         }
 
-        // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        // The name doesn't exist in the dictionary, so we have to lock and add it.
+        // Collisions are resolved within the shard, so only its lock is needed.
+        Shard& shard = GetShard(hash);
+        AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
 
-        auto iter = m_dictionary.find(hash);
+        auto iter = shard.m_entries.find(hash);
         bool collisionDetected = false;
         while (true)
         {
             // No existing entry, add a new one and we're done
-            if (iter == m_dictionary.end())
+            if (iter == shard.m_entries.end())
             {
                 Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
                 nameData->m_hashCollision = collisionDetected;
                 // Piecewise construct to prevent creating a temporary ScopedNameDataWrapper that destructs
-                m_dictionary.emplace(AZStd::piecewise_construct, AZStd::forward_as_tuple(hash), AZStd::forward_as_tuple(*this, nameData));
+                shard.m_entries.emplace(AZStd::piecewise_construct, AZStd::forward_as_tuple(hash), AZStd::forward_as_tuple(*this, nameData));
                 return Name(nameData);
             }
             // Found the desired entry, return it
@@ -256,13 +287,15 @@ namespace AZ
             {
                 return Name(iter->second.m_nameData);
             }
-            // Hash collision, try a new hash
+            // Hash collision, try a new hash.
+            // Step by the shard count so the new hash maps to the same shard. The shard count divides 2^32,
+            // so this holds even when the hash wraps around.
             else
             {
                 collisionDetected = true;
                 iter->second.m_nameData->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
-                ++hash;
-                iter = m_dictionary.find(hash);
+                hash += static_cast<Name::Hash>(ShardCount);
+                iter = shard.m_entries.find(hash);
             }
         }
     }
@@ -281,10 +314,11 @@ namespace AZ
         //      entry and Name objects pointing to the new entry will fail comparison operations.
 
 
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        Shard& shard = GetShard(hash);
+        AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
 
-        auto dictIt = m_dictionary.find(hash);
-        if (dictIt == m_dictionary.end())
+        auto dictIt = shard.m_entries.find(hash);
+        if (dictIt == shard.m_entries.end())
         {
             // This check is to safeguard around the following scenario
             // T1, gets into TryReleaseName
@@ -297,7 +331,7 @@ namespace AZ
 
         Internal::NameData* nameData = dictIt->second.m_nameData;
 
-        // Check m_hashCollision inside the m_sharedMutex because a new collision could have happened
+        // Check m_hashCollision inside the shard's m_sharedMutex because a new collision could have happened
         // on another thread before taking the lock.
         if (nameData->m_hashCollision)
         {
@@ -311,7 +345,7 @@ namespace AZ
         int32_t expectedRefCount = 0;
         if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
         {
-            m_dictionary.erase(nameData->GetHash());
+            shard.m_entries.erase(nameData->GetHash());
             delete nameData;
         }
 
@@ -333,35 +367,39 @@ namespace AZ
             Internal::NameData* longestName = nullptr;
             Internal::NameData* mostRepeatedName = nullptr;
 
-            for (auto& iter : m_dictionary)
+            // This is only activated from the debugger, so the shards other than the one locked by the caller aren't locked here
+            for (const Shard& shard : m_shards)
             {
-                Internal::NameData* nameData = iter.second.m_nameData;
-                const size_t nameLength = nameData->m_name.size();
-                actualStringMemoryUsed += nameLength;
-                potentialStringMemoryUsed += (nameLength * nameData->m_useCount);
-
-                if (!longestName || longestName->m_name.size() < nameLength)
+                for (auto& iter : shard.m_entries)
                 {
-                    longestName = nameData;
-                }
+                    Internal::NameData* nameData = iter.second.m_nameData;
+                    const size_t nameLength = nameData->m_name.size();
+                    actualStringMemoryUsed += nameLength;
+                    potentialStringMemoryUsed += (nameLength * nameData->m_useCount);
 
-                if (!mostRepeatedName)
-                {
-                    mostRepeatedName = nameData;
-                }
-                else
-                {
-                    const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
-                    const size_t currentIndividualSavings = nameLength * (nameData->m_useCount - 1);
-                    if (currentIndividualSavings > mostIndividualSavings)
+                    if (!longestName || longestName->m_name.size() < nameLength)
+                    {
+                        longestName = nameData;
+                    }
+
+                    if (!mostRepeatedName)
                     {
                         mostRepeatedName = nameData;
                     }
+                    else
+                    {
+                        const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
+                        const size_t currentIndividualSavings = nameLength * (nameData->m_useCount - 1);
+                        if (currentIndividualSavings > mostIndividualSavings)
+                        {
+                            mostRepeatedName = nameData;
+                        }
+                    }
                 }
             }
 
             AZ_TracePrintf("NameDictionary", "NameDictionary Stats\n");
-            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_dictionary.size());
+            AZ_TracePrintf("NameDictionary", "Names:              %d\n", GetEntryCount());
             AZ_TracePrintf("NameDictionary", "Total chars:        %d\n", actualStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Logical chars:      %d\n", potentialStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Memory saved:       %d\n", potentialStringMemoryUsed - actualStringMemoryUsed);
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
@@ -43,6 +44,9 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names
     //! that already exist.
+    //!
+    //! The entries are spread over several shards by hash, each with its own lock, so threads looking
+    //! up or adding different names rarely contend for the same lock.
     class NameDictionary final
     {
     public:
@@ -127,8 +131,30 @@ namespace AZ
             NameDictionary& m_nameDictionary;
         };
 
-        AZStd::unordered_map<Name::Hash, ScopedNameDataWrapper> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+        using EntryMap = AZStd::unordered_map<Name::Hash, ScopedNameDataWrapper>;
+
+        //! Number of shards, must be a power of two so that the shard of a hash is preserved
+        //! when a collision is resolved by stepping the hash by ShardCount.
+        static constexpr size_t ShardCount = 16;
+        static_assert((ShardCount & (ShardCount - 1)) == 0, "ShardCount must be a power of two");
+
+        //! A part of the dictionary holding the entries whose hash maps to it.
+        //! Shards are kept on separate cache lines so their locks don't share one.
+        struct alignas(64) Shard
+        {
+            EntryMap m_entries;
+            mutable AZStd::shared_mutex m_sharedMutex;
+        };
+
+        static size_t GetShardIndex(Name::Hash hash);
+        Shard& GetShard(Name::Hash hash);
+        const Shard& GetShard(Name::Hash hash) const;
+
+        //! Returns the total number of entries across all shards.
+        //! This isn't synchronized with other threads adding or removing names.
+        size_t GetEntryCount() const;
+
+        AZStd::array<Shard, ShardCount> m_shards;
 
         //! A fixed Name used as the head of a linked list of Name literals.
         //! These literals can be static and have lifecycles not coupled to the name dictionary,
@@ -668,6 +668,13 @@ namespace AZ
         }
     }
 
+    void BehaviorContext::ReserveCapacity(size_t classCount, size_t ebusCount)
+    {
+        m_classes.reserve(classCount);
+        m_typeToClassMap.reserve(classCount);
+        m_ebuses.reserve(ebusCount);
+    }
+
     bool BehaviorContext::IsTypeReflected(AZ::Uuid typeId) const
     {
         auto classTypeIt = m_typeToClassMap.find(typeId);
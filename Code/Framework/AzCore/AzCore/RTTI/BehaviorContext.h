@@ -1554,6 +1554,10 @@ namespace AZ
         const BehaviorClass* FindClassByTypeId(const AZ::TypeId& typeId) const;
         const BehaviorEBus* FindEBusByReflectedName(AZStd::string_view reflectedName) const;
 
+        //! Reserves room for the number of classes and EBuses, so the reflection of all modules doesn't rehash the maps repeatedly.
+        //! The counts are usually the capacity hints written at build time by the 'dumpreflectionhints' action of SerializeContextTools.
+        void ReserveCapacity(size_t classCount, size_t ebusCount);
+
         //! Prefer to access BehaviorContext methods, properties, classes and EBuses through the Find* functions
         //! instead of direct member access
         AZStd::unordered_map<AZStd::string, BehaviorMethod*> m_methods;
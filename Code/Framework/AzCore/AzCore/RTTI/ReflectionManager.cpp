@@ -7,6 +7,7 @@
  */
 #include <AzCore/RTTI/ReflectionManager.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AZ
 {
@@ -48,9 +49,15 @@ namespace AZ
         auto entryIt = m_entryPoints.emplace(m_entryPoints.end(), typeId, reflectEntryPoint);
         m_typedEntryPoints.emplace(typeId, AZStd::move(entryIt));
 
-        // Call the new entry point with all known contexts
+        // Call the new entry point with all known contexts, lazy contexts get deferrable entry points when they are requested
         for (const auto& context : m_contexts)
         {
+            if (LazyContext* lazyContext = m_deferrableReflectionDepth > 0 ? FindLazyContext(azrtti_typeid(context.get())) : nullptr)
+            {
+                lazyContext->m_pendingEntryPoints.push_back(&*entryIt);
+                continue;
+            }
+
             reflectEntryPoint(context.get());
         }
     }
@@ -66,6 +73,11 @@ namespace AZ
             // Call unreflect on everything in reverse context order
             for (auto contextIt = m_contexts.rbegin(); contextIt != m_contexts.rend(); ++contextIt)
             {
+                if (RemovePendingEntryPoint(FindLazyContext(azrtti_typeid(contextIt->get())), *entryIt->second))
+                {
+                    continue;
+                }
+
                 (*contextIt)->EnableRemoveReflection();
                 (*entryIt->second)(contextIt->get());
                 (*contextIt)->DisableRemoveReflection();
@@ -174,6 +186,16 @@ namespace AZ
         {
             if (azrtti_typeid(context.get()) == contextTypeId)
             {
+                if (LazyContext* lazyContext = FindLazyContext(contextTypeId); lazyContext && !lazyContext->m_pendingEntryPoints.empty())
+                {
+                    // Take the list first, reflecting may request the context again
+                    AZStd::vector<const EntryPoint*> pendingEntryPoints = AZStd::move(lazyContext->m_pendingEntryPoints);
+                    lazyContext->m_pendingEntryPoints.clear();
+                    for (const EntryPoint* entryPoint : pendingEntryPoints)
+                    {
+                        (*entryPoint)(context.get());
+                    }
+                }
                 return context.get();
             }
         }
@@ -191,17 +213,87 @@ namespace AZ
             ReflectContext* context = contextIt->get();
             if (azrtti_typeid(context) == contextTypeId)
             {
-                // Unreflect everything from the context
+                // Unreflect everything from the context, except the entry points that were never reflected into it
+                LazyContext* lazyContext = FindLazyContext(contextTypeId);
                 context->EnableRemoveReflection();
                 for (auto entryIt = m_entryPoints.rbegin(); entryIt != m_entryPoints.rend(); ++entryIt)
                 {
-                    (*entryIt)(context);
+                    if (!RemovePendingEntryPoint(lazyContext, *entryIt))
+                    {
+                        (*entryIt)(context);
+                    }
                 }
                 context->DisableRemoveReflection();
 
+                if (lazyContext)
+                {
+                    m_lazyContexts.erase(m_lazyContexts.begin() + AZStd::distance(m_lazyContexts.data(), lazyContext));
+                }
                 m_contexts.erase(contextIt);
                 return;
             }
         }
     }
+
+    //=========================================================================
+    // SetReflectContextLazy
+    //=========================================================================
+    void ReflectionManager::SetReflectContextLazy(AZ::TypeId contextTypeId)
+    {
+        if (!FindLazyContext(contextTypeId))
+        {
+            m_lazyContexts.push_back({ contextTypeId, {} });
+        }
+    }
+
+    //=========================================================================
+    // BeginDeferrableReflection
+    //=========================================================================
+    void ReflectionManager::BeginDeferrableReflection()
+    {
+        ++m_deferrableReflectionDepth;
+    }
+
+    //=========================================================================
+    // EndDeferrableReflection
+    //=========================================================================
+    void ReflectionManager::EndDeferrableReflection()
+    {
+        AZ_Assert(m_deferrableReflectionDepth > 0, "EndDeferrableReflection called without a matching BeginDeferrableReflection.");
+        --m_deferrableReflectionDepth;
+    }
+
+    //=========================================================================
+    // FindLazyContext
+    //=========================================================================
+    ReflectionManager::LazyContext* ReflectionManager::FindLazyContext(AZ::TypeId contextTypeId)
+    {
+        for (LazyContext& lazyContext : m_lazyContexts)
+        {
+            if (lazyContext.m_contextTypeId == contextTypeId)
+            {
+                return &lazyContext;
+            }
+        }
+
+        return nullptr;
+    }
+
+    //=========================================================================
+    // RemovePendingEntryPoint
+    //=========================================================================
+    bool ReflectionManager::RemovePendingEntryPoint(LazyContext* lazyContext, const EntryPoint& entryPoint)
+    {
+        if (lazyContext)
+        {
+            auto pendingIt = AZStd::find(lazyContext->m_pendingEntryPoints.begin(), lazyContext->m_pendingEntryPoints.end(), &entryPoint);
+            if (pendingIt != lazyContext->m_pendingEntryPoints.end())
+            {
+                lazyContext->m_pendingEntryPoints.erase(pendingIt);
+                return true;
+            }
+        }
+
+        return false;
+    }
 }
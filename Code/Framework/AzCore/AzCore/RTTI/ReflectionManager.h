@@ -57,6 +57,14 @@ namespace AZ
         template <typename ReflectContextT, typename = IsReflectContextT<ReflectContextT>>
         void RemoveReflectContext() { RemoveReflectContext(azrtti_typeid<ReflectContextT>()); }
 
+        /// Makes a reflect context lazy: deferrable entry points are reflected into it only when it is first requested with GetReflectContext
+        template <typename ReflectContextT, typename = IsReflectContextT<ReflectContextT>>
+        void SetReflectContextLazy() { SetReflectContextLazy(azrtti_typeid<ReflectContextT>()); }
+
+        /// The typed entry points added between Begin and End are deferrable, they are not reflected into the lazy contexts right away
+        void BeginDeferrableReflection();
+        void EndDeferrableReflection();
+
     protected:
         struct EntryPoint
         {
@@ -72,7 +80,16 @@ namespace AZ
             bool operator==(const EntryPoint& other) const;
         };
 
+        struct LazyContext
+        {
+            AZ::TypeId m_contextTypeId;
+            /// Entry points that have not been reflected into the context yet, in the order they were added
+            AZStd::vector<const EntryPoint*> m_pendingEntryPoints;
+        };
+
         AZStd::vector<AZStd::unique_ptr<ReflectContext>> m_contexts;
+        AZStd::vector<LazyContext> m_lazyContexts;
+        AZ::u32 m_deferrableReflectionDepth = 0;
 
         using EntryPointList = AZStd::list<EntryPoint>;
         EntryPointList m_entryPoints;
@@ -83,5 +100,10 @@ namespace AZ
         void AddReflectContext(AZStd::unique_ptr<ReflectContext>&& context);
         ReflectContext* GetReflectContext(AZ::TypeId contextTypeId);
         void RemoveReflectContext(AZ::TypeId contextTypeId);
+        void SetReflectContextLazy(AZ::TypeId contextTypeId);
+
+        LazyContext* FindLazyContext(AZ::TypeId contextTypeId);
+        /// Returns true and forgets the entry point if it was waiting to be reflected into the lazy context
+        static bool RemovePendingEntryPoint(LazyContext* lazyContext, const EntryPoint& entryPoint);
     };
 }
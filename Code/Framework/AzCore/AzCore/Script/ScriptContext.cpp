@@ -3513,6 +3513,17 @@ LUA_API const Node* lua_getDummyNode()
                 }
                 int numResults = 0;
 
+                // Everything the result callback needs is referenced through this struct, so the callback captures a single
+                // pointer and fits in the small object buffer of AZStd::function instead of allocating on every call.
+                struct AssignedResultData
+                {
+                    lua_State* m_lua;
+                    LuaScriptCaller* m_caller;
+                    BehaviorArgument* m_result;
+                    int* m_numResults;
+                };
+                AssignedResultData assignedResultData{ lua, thisPtr, &result, &numResults };
+
                 if (thisPtr->m_resultToLua)
                 {
                     result.Set(*thisPtr->m_method->GetResult());
@@ -3522,13 +3533,13 @@ LUA_API const Node* lua_getDummyNode()
                         usedBackupAlloc  = thisPtr->m_prepareResult(result, thisPtr->m_resultClass, tempData, &backupAllocator); // pass temp memory and class info
                     }
 
-                    // TODO: Make it optional for EBuses only, make it light weight too, probably a virtual function for the store result.
-                    result.m_onAssignedResult = AZStd::function<void()>([&]()
+                    // TODO: Make it optional for EBuses only, probably a virtual function for the store result.
+                    result.m_onAssignedResult = AZStd::function<void()>([data = &assignedResultData]()
                     {
-                        if (result.m_value)
+                        if (data->m_result->m_value)
                         {
-                            thisPtr->m_resultToLua(lua, result);
-                            ++numResults;
+                            data->m_caller->m_resultToLua(data->m_lua, *data->m_result);
+                            ++(*data->m_numResults);
                         }
                     });
                 }
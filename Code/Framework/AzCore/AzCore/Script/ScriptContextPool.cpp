@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Script/ScriptContextPool.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    ScriptContextPool::ScopedContext::ScopedContext(ScriptContextPool* pool, ScriptContext* context)
+        : m_pool(pool)
+        , m_context(context)
+    {
+    }
+
+    ScriptContextPool::ScopedContext::ScopedContext(ScopedContext&& other)
+        : m_pool(other.m_pool)
+        , m_context(other.m_context)
+    {
+        other.m_pool = nullptr;
+        other.m_context = nullptr;
+    }
+
+    ScriptContextPool::ScopedContext::~ScopedContext()
+    {
+        if (m_pool && m_context)
+        {
+            m_pool->Release(m_context);
+        }
+    }
+
+    ScriptContextPool::ScriptContextPool(BehaviorContext* behaviorContext, size_t numContexts, ScriptContextId id)
+    {
+        AZ_Assert(behaviorContext, "A behavior context is required to bind the script contexts of the pool.");
+        AZ_Assert(numContexts > 0, "A script context pool needs at least one context.");
+
+        m_contexts.reserve(numContexts);
+        m_freeContexts.reserve(numContexts);
+        for (size_t i = 0; i < numContexts; ++i)
+        {
+            m_contexts.emplace_back(AZStd::make_unique<ScriptContext>(id));
+            m_contexts.back()->BindTo(behaviorContext);
+            m_freeContexts.push_back(m_contexts.back().get());
+        }
+    }
+
+    ScriptContextPool::~ScriptContextPool()
+    {
+        AZ_Assert(m_freeContexts.size() == m_contexts.size(), "Script context pool destroyed while %zu of its contexts are in use.",
+            m_contexts.size() - m_freeContexts.size());
+    }
+
+    ScriptContextPool::ScopedContext ScriptContextPool::Acquire()
+    {
+        ScriptContext* context = nullptr;
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
+            m_contextReleased.wait(lock, [this]() { return !m_freeContexts.empty(); });
+            context = m_freeContexts.back();
+            m_freeContexts.pop_back();
+        }
+
+        context->DebugSetOwnerThread(AZStd::this_thread::get_id());
+        return ScopedContext(this, context);
+    }
+
+    size_t ScriptContextPool::GetNumContexts() const
+    {
+        return m_contexts.size();
+    }
+
+    void ScriptContextPool::Release(ScriptContext* context)
+    {
+        // collect some of the garbage of the scripts while the releasing thread still owns the context
+        context->GarbageCollectStep();
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_freeContexts.push_back(context);
+        }
+        m_contextReleased.notify_one();
+    }
+} // namespace AZ
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Script/ScriptContext.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    class BehaviorContext;
+
+    //! A pool of isolated script contexts, to run scripts that opt in (pure calculations, AI evaluation) on worker threads.
+    //! Each context has its own Lua VM bound to the same behavior context, so scripts running on different threads never share
+    //! any Lua state. A context is used by a single thread at a time, which becomes its owner while it holds the context.
+    //! Scripts in the pool must not connect EBus handlers that outlive their use of a context. Results are passed back to the
+    //! main thread with messages, for example with AZ::TickBus::QueueFunction.
+    class ScriptContextPool
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ScriptContextPool, SystemAllocator);
+
+        //! Exclusive use of a context of the pool. The context returns to the pool when this is destroyed.
+        class ScopedContext
+        {
+        public:
+            ScopedContext(ScopedContext&& other);
+            ~ScopedContext();
+
+            ScriptContext* Get() const { return m_context; }
+            ScriptContext* operator->() const { return m_context; }
+            ScriptContext& operator*() const { return *m_context; }
+
+        private:
+            AZ_DISABLE_COPY(ScopedContext);
+            friend class ScriptContextPool;
+
+            ScopedContext(ScriptContextPool* pool, ScriptContext* context);
+
+            ScriptContextPool* m_pool = nullptr;
+            ScriptContext* m_context = nullptr;
+        };
+
+        //! Create the contexts of the pool, bound to the behavior context.
+        //! @param numContexts The number of contexts, which is the number of threads that can run scripts at the same time.
+        //! @param id The id of the contexts, which is passed to the reflection of script types.
+        ScriptContextPool(BehaviorContext* behaviorContext, size_t numContexts, ScriptContextId id = ScriptContextIds::DefaultScriptContextId);
+        ~ScriptContextPool();
+
+        //! Get exclusive use of a context, blocking until one of the contexts is available.
+        ScopedContext Acquire();
+
+        size_t GetNumContexts() const;
+
+    private:
+        AZ_DISABLE_COPY_MOVE(ScriptContextPool);
+
+        void Release(ScriptContext* context);
+
+        AZStd::vector<AZStd::unique_ptr<ScriptContext>> m_contexts;
+        AZStd::vector<ScriptContext*> m_freeContexts;
+        AZStd::mutex m_mutex;
+        AZStd::condition_variable m_contextReleased;
+    };
+} // namespace AZ
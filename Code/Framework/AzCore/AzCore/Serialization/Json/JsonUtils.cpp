@@ -13,6 +13,7 @@
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/IO/TextStreamReaders.h>
 #include <AzCore/IO/TextStreamWriters.h>
 #include <AzCore/JSON/error/error.h>
 #include <AzCore/JSON/error/en.h>
@@ -236,36 +237,41 @@ namespace AZ::JsonSerializationUtils
 
     AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonStream(IO::GenericStream& stream)
     {
-        IO::SizeType length = stream.GetLength();
+        // Parse while reading the stream, so the text doesn't have to be held in memory next to the document
+        IO::RapidJSONStreamReader jsonStreamReader(&stream);
 
-        AZStd::vector<char> memoryBuffer;
-        memoryBuffer.resize_no_construct(static_cast<AZStd::vector<char>::size_type>(static_cast<AZStd::vector<char>::size_type>(length) + 1));
-
-        IO::SizeType bytesRead = stream.Read(length, memoryBuffer.data());
-        if (bytesRead != length)
+        rapidjson::Document jsonDocument;
+        jsonDocument.ParseStream<rapidjson::kParseCommentsFlag>(jsonStreamReader);
+        if (jsonDocument.HasParseError())
         {
-            return AZ::Failure(AZStd::string{"Cannot to read input stream."});
+            const size_t lineNumber = jsonStreamReader.GetLineNumber(jsonDocument.GetErrorOffset());
+            return AZ::Failure(AZStd::string::format("JSON parse error at line %zu: %s", lineNumber, rapidjson::GetParseError_En(jsonDocument.GetParseError())));
+        }
+        else
+        {
+            return AZ::Success(AZStd::move(jsonDocument));
         }
-
-        memoryBuffer.back() = 0;
-
-        return ReadJsonString(AZStd::string_view{memoryBuffer.data(), memoryBuffer.size()});
     }
 
-    AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonFile(AZStd::string_view filePath, size_t maxFileSize)
+    static AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonFileStream(
+        IO::GenericStream& file, AZStd::string_view filePath, size_t maxFileSize)
     {
-        // Read into memory first and then parse the json, rather than passing a file stream to rapidjson.
-        // This should avoid creating a large number of micro-reads from the file.
-
-        auto readResult = AZ::Utils::ReadFile<AZStd::string>(filePath, maxFileSize);
-        if(!readResult.IsSuccess())
+        if (!file.IsOpen())
         {
-            return AZ::Failure(readResult.GetError());
+            return AZ::Failure(AZStd::string::format("Failed to open '%.*s'.", AZ_STRING_ARG(filePath)));
         }
 
-        AZStd::string jsonContent = readResult.TakeValue();
+        const IO::SizeType length = file.GetLength();
+        if (length > maxFileSize)
+        {
+            return AZ::Failure(AZStd::string{ "Data is too large." });
+        }
+        else if (length == 0)
+        {
+            return AZ::Failure(AZStd::string::format("Failed to load '%.*s'. File is empty.", AZ_STRING_ARG(filePath)));
+        }
 
-        auto result = ReadJsonString(jsonContent);
+        auto result = ReadJsonStream(file);
         if (!result.IsSuccess())
         {
             return AZ::Failure(AZStd::string::format("Failed to load '%.*s'. %s", AZ_STRING_ARG(filePath), result.GetError().c_str()));
@@ -276,6 +282,26 @@ namespace AZ::JsonSerializationUtils
         }
     }
 
+    AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonFile(AZStd::string_view filePath, size_t maxFileSize)
+    {
+        // Stream the file into the parser in large blocks rather than reading all of it into memory first. The blocks avoid
+        // creating a large number of micro-reads from the file.
+        const AZ::IO::FixedMaxPathString filePathString{ filePath };
+        constexpr IO::OpenMode openMode = IO::OpenMode::ModeRead | IO::OpenMode::ModeBinary;
+        if (IO::FileIOBase::GetInstance() != nullptr)
+        {
+            IO::FileIOStream file;
+            file.Open(filePathString.c_str(), openMode);
+            return ReadJsonFileStream(file, filePath, maxFileSize);
+        }
+        else
+        {
+            IO::SystemFileStream file;
+            file.Open(filePathString.c_str(), openMode);
+            return ReadJsonFileStream(file, filePath, maxFileSize);
+        }
+    }
+
     // Helper function to validate the JSON is structured with the standard header for a generic class
     AZ::Outcome<void, AZStd::string> ValidateJsonClassHeader(const rapidjson::Document& jsonDocument)
     {
@@ -240,6 +240,46 @@ namespace AZ
             // completed successfully to make sure the equivalent amount
             // of CloseElements are called
             AZStd::vector<bool>                           m_writeElementResultStack;
+
+            // Binary streams repeat the same few (parent class, element type, element name) combinations for every instance of
+            // a class or container element, so the type resolution that only depends on those and the serialize context
+            // is done once per stream and looked up for the remaining elements.
+            struct ElementLoadPlanKey
+            {
+                bool operator==(const ElementLoadPlanKey& other) const
+                {
+                    return m_parentClassData == other.m_parentClassData && m_typeId == other.m_typeId && m_nameCrc == other.m_nameCrc
+                        && m_version == other.m_version;
+                }
+
+                const SerializeContext::ClassData* m_parentClassData;
+                Uuid m_typeId; //< Type id as stored in the stream
+                u32 m_nameCrc;
+                unsigned int m_version;
+            };
+
+            struct ElementLoadPlanKeyHasher
+            {
+                size_t operator()(const ElementLoadPlanKey& key) const
+                {
+                    size_t hash = 0;
+                    AZStd::hash_combine(hash, key.m_parentClassData, key.m_typeId, key.m_nameCrc, key.m_version);
+                    return hash;
+                }
+            };
+
+            struct ElementLoadPlan
+            {
+                const SerializeContext::ClassData* m_classData;
+                Uuid m_typeId; //< Type id after the specialized type lookup
+                const SerializeContext::ClassElement* m_classElement = nullptr; //< Matching member of the parent class, once resolved
+                bool m_isAssetReference = false;
+            };
+
+            // The cache only lives as long as the stream, as the reflected classes can change between loads
+            AZStd::unordered_map<ElementLoadPlanKey, ElementLoadPlan, ElementLoadPlanKeyHasher> m_elementLoadPlans;
+            // Plan of the element returned by the last ReadElement call, nullptr if it wasn't read from a binary stream
+            ElementLoadPlan* m_lastElementLoadPlan = nullptr;
         };
 
         //=========================================================================
@@ -409,6 +449,7 @@ namespace AZ
             {
                 // reset the class info
                 const SerializeContext::ClassData* classData = nullptr;
+                ElementLoadPlan* loadPlan = nullptr;
 
                 bool isConvertedData = false;
                 // read from the converted list (if we have something)
@@ -442,6 +483,7 @@ namespace AZ
                         break;
                     }
                     nextLevel = false;
+                    loadPlan = m_lastElementLoadPlan;
                 }
 
                 // Handle conversion of deprecated classes to non-deprecated ones.
@@ -475,6 +517,7 @@ namespace AZ
                     classData = convertedClassElement.m_classData;
                     element = convertedClassElement.m_element;
                     isConvertedData = true;
+                    loadPlan = nullptr;
                 }
 
                 // If classData is NULL then we failed to find a registration for this element
@@ -616,6 +659,10 @@ namespace AZ
                         dynamicElementMetadata.m_typeId = fieldContainer->m_typeId;
                         classElement = &dynamicElementMetadata;
                     }
+                    else if (loadPlan && loadPlan->m_classElement)
+                    {
+                        classElement = loadPlan->m_classElement;
+                    }
                     else
                     {
                         for (size_t i = 0; i < parentClassInfo->m_elements.size(); ++i)
@@ -680,6 +727,12 @@ namespace AZ
                             }
                         }
 
+                        // Only matches are remembered, so that mismatched elements keep reporting their errors
+                        if (loadPlan)
+                        {
+                            loadPlan->m_classElement = classElement;
+                        }
+
                         // If we can't resolve classElement while looking into members of a containing class, issue a warning.
                         // We can continue safely, but this constitutes loss of old data that users should be aware of.
                         if (classElement == nullptr)
@@ -787,7 +840,17 @@ namespace AZ
                     classData->m_eventHandler->OnWriteBegin(dataAddress);
                 }
 
-                if (const auto* genericTypeInfo = m_sc->FindGenericClassInfo(element.m_id); genericTypeInfo && genericTypeInfo->GetGenericTypeId() == GetAssetClassId())
+                bool isAssetReference = false;
+                if (loadPlan)
+                {
+                    isAssetReference = loadPlan->m_isAssetReference;
+                }
+                else if (const auto* genericTypeInfo = m_sc->FindGenericClassInfo(element.m_id))
+                {
+                    isAssetReference = genericTypeInfo->GetGenericTypeId() == GetAssetClassId();
+                }
+
+                if (isAssetReference)
                 {
                     AZ_Assert(dataAddress, "Reference field address is invalid");
                     AZ_Assert(classData->m_serializer, "Asset references should always have a serializer defined");
@@ -1041,6 +1104,7 @@ namespace AZ
             element.m_id = AZ::Uuid::CreateNull();
 
             cd = nullptr;
+            m_lastElementLoadPlan = nullptr;
 
             if (GetType() == ST_XML)
             {
@@ -1348,14 +1412,34 @@ namespace AZ
 
                 element.m_dataType = SerializeContext::DataElement::DT_BINARY_BE;
 
-                // find the registered class data
-                cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
-                if (cd && ShouldLookUpSpecializedTypeId(element))
+                // find the registered class data, unless an element with the same type and name was already seen under this parent
+                const ElementLoadPlanKey planKey{ parent, element.m_id, element.m_nameCrc, element.m_version };
+                if (auto planIt = m_elementLoadPlans.find(planKey); planIt != m_elementLoadPlans.end())
                 {
-                    // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
-                    if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
+                    m_lastElementLoadPlan = &planIt->second;
+                    cd = m_lastElementLoadPlan->m_classData;
+                    element.m_id = m_lastElementLoadPlan->m_typeId;
+                }
+                else
+                {
+                    cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
+                    if (cd && ShouldLookUpSpecializedTypeId(element))
                     {
-                        element.m_id = genericClassInfo->GetSpecializedTypeId();
+                        // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
+                        if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
+                        {
+                            element.m_id = genericClassInfo->GetSpecializedTypeId();
+                        }
+                    }
+
+                    if (cd)
+                    {
+                        ElementLoadPlan plan;
+                        plan.m_classData = cd;
+                        plan.m_typeId = element.m_id;
+                        const GenericClassInfo* genericTypeInfo = sc.FindGenericClassInfo(element.m_id);
+                        plan.m_isAssetReference = genericTypeInfo && genericTypeInfo->GetGenericTypeId() == GetAssetClassId();
+                        m_lastElementLoadPlan = &m_elementLoadPlans.emplace(planKey, plan).first->second;
                     }
                 }
 
@@ -1954,6 +1954,15 @@ namespace AZ
         }
     }
 
+    //=========================================================================
+    // ReserveClassData
+    //=========================================================================
+    void SerializeContext::ReserveClassData(size_t classCount)
+    {
+        m_uuidMap.reserve(classCount);
+        m_classNameToUuid.reserve(classCount);
+    }
+
     //=========================================================================
     // EnumerateAll
     //=========================================================================
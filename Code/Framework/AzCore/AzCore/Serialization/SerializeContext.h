@@ -331,6 +331,10 @@ namespace AZ
         void EnumerateAll(const TypeInfoCB& callback, bool includeGenerics=false) const;
         // @}
 
+        /// Reserves room in the class maps for the number of classes, so the reflection of all modules doesn't rehash them repeatedly.
+        /// The count is usually the capacity hint written at build time by the 'dumpreflectionhints' action of SerializeContextTools.
+        void ReserveClassData(size_t classCount);
+
         /// Makes a copy of obj. The behavior is the same as if obj was first serialized out and the copy was then created from the serialized data.
         template<class T>
         T* CloneObject(const T* obj);
@@ -1339,6 +1339,19 @@ namespace AZ::SettingsRegistryMergeUtils
                 AZ::IO::StdoutStream outputStream;
                 DumpSettingsRegistryToStream(registry, "", outputStream, dumperSettings);
             }
+
+            const size_t regsnapshotSwitchValues = commandLine.GetNumSwitchValues("regsnapshot");
+            for (size_t regsnapshotIndex = 0; regsnapshotIndex < regsnapshotSwitchValues; ++regsnapshotIndex)
+            {
+                AZStd::string_view regsnapshotValue = commandLine.GetSwitchValue("regsnapshot", regsnapshotIndex);
+                if (regsnapshotValue.empty())
+                {
+                    AZ_Warning("SettingsRegistryMergeUtils", false, "A file path is required for --regsnapshot.");
+                    continue;
+                }
+
+                SaveSettingsRegistrySnapshot(registry, regsnapshotValue);
+            }
         }
     }
 
@@ -1626,6 +1639,31 @@ namespace AZ::SettingsRegistryMergeUtils
         return visitor.Finalize();
     }
 
+    bool SaveSettingsRegistrySnapshot(SettingsRegistryInterface& registry, AZStd::string_view filePath)
+    {
+        const AZ::IO::FixedMaxPath snapshotPath(filePath);
+        AZ::IO::SystemFileStream snapshotStream;
+        if (!snapshotStream.Open(snapshotPath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeCreatePath))
+        {
+            AZ_Error("SettingsRegistryMergeUtils", false, R"(Unable to open settings registry snapshot "%s" for writing.)",
+                snapshotPath.c_str());
+            return false;
+        }
+
+        DumperSettings dumperSettings;
+        dumperSettings.m_includeFilter = [](AZStd::string_view path)
+        {
+            return !IsPathDescendantOrEqual(RuntimeRootKey, path);
+        };
+        return DumpSettingsRegistryToStream(registry, "", snapshotStream, dumperSettings);
+    }
+
+    auto MergeSettingsToRegistry_Snapshot(SettingsRegistryInterface& registry, AZStd::string_view filePath)
+        -> SettingsRegistryInterface::MergeSettingsResult
+    {
+        return registry.MergeSettingsFile(filePath, SettingsRegistryInterface::Format::JsonMergePatch);
+    }
+
     bool IsPathAncestorDescendantOrEqual(AZStd::string_view candidatePath, AZStd::string_view inputPath)
     {
         const AZ::IO::PathView candidateView{ candidatePath, AZ::IO::PosixPathSeparator };
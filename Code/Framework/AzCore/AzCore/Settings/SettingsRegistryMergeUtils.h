@@ -24,6 +24,12 @@ namespace AZ::SettingsRegistryMergeUtils
     inline constexpr const char* BuildTargetNameKey = "/O3DE/Settings/BuildTargetName";
     inline constexpr const char* SpecializationsRootKey = "/O3DE/Settings/Specializations";
     inline constexpr const char* BootstrapSettingsRootKey = "/Amazon/AzCore/Bootstrap";
+    //! Path of a snapshot written by SaveSettingsRegistrySnapshot. When set, the snapshot is merged at startup in place of the
+    //! target build dependency, engine, gem and project registry folders.
+    //! example: --regset=/O3DE/Settings/SnapshotPath=Registry/server.setregsnapshot
+    inline constexpr const char* SnapshotPathKey = "/O3DE/Settings/SnapshotPath";
+    //! Root key for settings that are calculated on every launch and are never persisted, such as the runtime file paths
+    inline constexpr const char* RuntimeRootKey = "/O3DE/Runtime";
     inline constexpr const char* FilePathsRootKey = "/O3DE/Runtime/FilePaths";
     inline constexpr const char* FilePathKey_BinaryFolder = "/O3DE/Runtime/FilePaths/BinaryFolder";
     inline constexpr const char* FilePathKey_EngineRootFolder = "/O3DE/Runtime/FilePaths/EngineRootFolder";
@@ -277,9 +283,11 @@ namespace AZ::SettingsRegistryMergeUtils
     //! --regdump <path> Dumps the content of the key at path and all it's content/children to output.
     //!     example: --regdump /My/Array/With/Objects
     //! --regdumpall Dumps the entire settings registry to output.
+    //! --regsnapshot <path> Writes the entire settings registry to a snapshot file. See SaveSettingsRegistrySnapshot.
+    //!     example: --regsnapshot "Registry/server.setregsnapshot"
     //!
     //! The CommandsToParse structure determines which options should be processed from the command line
-    //! `CommandsToParse::m_parseRegdumpCommands=true` allows the --regdump and --regdumpall commands to be processed
+    //! `CommandsToParse::m_parseRegdumpCommands=true` allows the --regdump, --regdumpall and --regsnapshot commands to be processed
     //! `CommandsToParse::m_parseRegsetCommands=true` allows the --regset command to be processed
     //! `CommandsToParse::m_parseRegremveCommands=true` allows the --regremove command to be processed
     //! `CommandsToParse::m_parseRegsetFileCommands=true` allows the --regset-file command to be processed
@@ -329,6 +337,22 @@ namespace AZ::SettingsRegistryMergeUtils
     bool DumpSettingsRegistryToStream(SettingsRegistryInterface& registry, AZStd::string_view key,
         AZ::IO::GenericStream& stream, const DumperSettings& dumperSettings);
 
+    //! Writes the merged content of the Settings Registry to a single snapshot file.
+    //! Merging the snapshot with MergeSettingsToRegistry_Snapshot replaces enumerating and parsing every .setreg file of the
+    //! engine, gems and project, which makes it suitable for packaged applications such as dedicated servers, where the
+    //! registry files don't change between launches.
+    //! The snapshot holds the settings for the platform and specializations of the application that writes it.
+    //! Settings underneath the RuntimeRootKey are left out as they are recalculated on every launch.
+    //! @param filePath path of the snapshot file to write, missing directories are created
+    //! @return true if the snapshot was written
+    bool SaveSettingsRegistrySnapshot(SettingsRegistryInterface& registry, AZStd::string_view filePath);
+
+    //! Merges a snapshot written by SaveSettingsRegistrySnapshot into the Settings Registry.
+    //! The snapshot is a single compact JSON document, so this costs one file read and parse.
+    //! @param filePath path of the snapshot file to merge
+    auto MergeSettingsToRegistry_Snapshot(SettingsRegistryInterface& registry, AZStd::string_view filePath)
+        -> SettingsRegistryInterface::MergeSettingsResult;
+
     //! Do not use this function for anything other than bootstrap settings. It is only here to provide compatibility
     //! with current functionality. Proper settings per platform should use the MergeSettingsFolder functionality.
     //! Gets the value using the provided rootPath + platform + keyName, if the platform key does not exist
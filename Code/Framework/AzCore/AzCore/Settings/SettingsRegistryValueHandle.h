@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/typetraits/conditional.h>
+#include <AzCore/std/typetraits/is_arithmetic.h>
+#include <AzCore/std/typetraits/is_floating_point.h>
+#include <AzCore/std/typetraits/is_signed.h>
+
+namespace AZ
+{
+    //! Caches a boolean or numeric value of the Settings Registry for code that reads it frequently, such as once per frame.
+    //! The JSON pointer is resolved and the value is read when the handle is created. After that Get is an atomic load which
+    //! doesn't lock the registry or parse the path. A notifier marks the cached value as stale when the path, one of its
+    //! ancestors or one of its descendants changes, and the next Get reads it from the registry again.
+    //! The notifier refers to the handle, so the handle can't be copied or moved, and it shouldn't outlive the registry.
+    template<typename T>
+    class SettingsRegistryValueHandle
+    {
+        static_assert(AZStd::is_arithmetic_v<T>, "SettingsRegistryValueHandle only supports boolean and numeric values.");
+
+        //! Type the Settings Registry stores the value as.
+        using RegistryType = AZStd::conditional_t<AZStd::is_same_v<T, bool>, bool,
+            AZStd::conditional_t<AZStd::is_floating_point_v<T>, double,
+            AZStd::conditional_t<AZStd::is_signed_v<T>, AZ::s64, AZ::u64>>>;
+
+    public:
+        AZ_DISABLE_COPY_MOVE(SettingsRegistryValueHandle);
+
+        //! @param path JSON pointer of the value
+        //! @param defaultValue value returned while the path doesn't hold a value of a compatible type
+        SettingsRegistryValueHandle(SettingsRegistryInterface& registry, AZStd::string_view path, T defaultValue = {})
+            : m_registry(registry)
+            , m_path(path)
+            , m_defaultValue(defaultValue)
+            , m_value(defaultValue)
+        {
+            m_notifyHandler = m_registry.RegisterNotifier(
+                [this](const SettingsRegistryInterface::NotifyEventArgs& notifyEventArgs)
+                {
+                    if (SettingsRegistryMergeUtils::IsPathAncestorDescendantOrEqual(m_path, notifyEventArgs.m_jsonKeyPath))
+                    {
+                        m_stale.store(true, AZStd::memory_order_release);
+                    }
+                });
+            Refresh();
+        }
+
+        //! Returns the cached value, reading it from the registry first if it changed since the last call.
+        T Get() const
+        {
+            // Only one caller reads the new value, concurrent callers keep getting the previous value until it's stored
+            if (m_stale.load(AZStd::memory_order_acquire) && m_stale.exchange(false, AZStd::memory_order_acq_rel))
+            {
+                Refresh();
+            }
+            return m_value.load(AZStd::memory_order_acquire);
+        }
+
+        //! Returns true if the path held a value of a compatible type the last time it was read.
+        bool HasValue() const
+        {
+            Get();
+            return m_hasValue.load(AZStd::memory_order_acquire);
+        }
+
+        AZStd::string_view GetPath() const
+        {
+            return m_path;
+        }
+
+    private:
+        void Refresh() const
+        {
+            RegistryType registryValue{};
+            const bool hasValue = m_registry.Get(registryValue, m_path);
+            m_hasValue.store(hasValue, AZStd::memory_order_release);
+            m_value.store(hasValue ? static_cast<T>(registryValue) : m_defaultValue, AZStd::memory_order_release);
+        }
+
+        SettingsRegistryInterface& m_registry;
+        SettingsRegistryInterface::FixedValueString m_path;
+        SettingsRegistryInterface::NotifyEventHandler m_notifyHandler;
+        T m_defaultValue;
+        mutable AZStd::atomic<T> m_value;
+        mutable AZStd::atomic_bool m_hasValue{ false };
+        mutable AZStd::atomic_bool m_stale{ false };
+    };
+} // namespace AZ
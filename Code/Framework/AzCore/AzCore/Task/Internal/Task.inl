@@ -71,6 +71,11 @@ namespace AZ::Internal
         return static_cast<uint8_t>(m_descriptor.priority);
     }
 
+    inline uint16_t Task::GetWorkerHint() const noexcept
+    {
+        return m_descriptor.workerHint;
+    }
+
     inline void Task::Link(Task& other)
     {
         ++m_outboundLinkCount;
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/execution.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/iterator/move_iterator.h>
+#include <AzCore/std/numeric.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
+
+// Overloads of the AZStd algorithms that take an execution policy. The parallel_policy overloads split the range into
+// chunks that run as tasks on a TaskExecutor, while the calling thread processes the first chunk and waits for the rest.
+// They run sequentially if the range is too small to be worth splitting, if the task graph isn't active, or if they are
+// called from a task, as a task isn't allowed to wait for another task graph.
+//
+// Usage:
+//     AZStd::for_each(AZStd::execution::par, points.begin(), points.end(), [](Point& point) { ... });
+//     AZStd::sort(AZStd::execution::par.with_grain_size(4096), entries.begin(), entries.end());
+
+namespace AZ::Internal
+{
+    //! Fewest elements each task gets when the policy doesn't set a grain size.
+    inline constexpr size_t ParallelAlgorithmDefaultGrainSize = 256;
+    //! Tasks created per worker, so workers that finish early can pick up the chunks of slower ones.
+    inline constexpr size_t ParallelAlgorithmTasksPerWorker = 4;
+
+    //! Returns the executor to run the tasks of a parallel algorithm on, or nullptr to run it on the calling thread.
+    inline TaskExecutor* GetParallelAlgorithmExecutor(const AZStd::execution::parallel_policy& policy)
+    {
+        TaskExecutor* executor = policy.m_executor;
+        if (!executor)
+        {
+            TaskGraphActiveInterface* taskGraphActive = Interface<TaskGraphActiveInterface>::Get();
+            if (!taskGraphActive || !taskGraphActive->IsTaskGraphActive())
+            {
+                return nullptr;
+            }
+            executor = &TaskExecutor::Instance();
+        }
+        return executor->IsRunningTask() ? nullptr : executor;
+    }
+
+    //! Returns the number of chunks to split elementCount elements into, where 1 means the range isn't split.
+    inline size_t GetParallelAlgorithmChunkCount(TaskExecutor* executor, size_t elementCount, size_t grainSize)
+    {
+        if (!executor)
+        {
+            return 1;
+        }
+
+        // Executors that run on a JobManager have no workers of their own, but share the job threads
+        const size_t workerCount = executor->GetWorkerCount() ? executor->GetWorkerCount() : AZStd::thread::hardware_concurrency();
+        const size_t maxChunkCount = AZStd::max<size_t>(workerCount, 1) * ParallelAlgorithmTasksPerWorker;
+        const size_t chunkCount = elementCount / (grainSize ? grainSize : ParallelAlgorithmDefaultGrainSize);
+        return AZStd::clamp<size_t>(chunkCount, 1, maxChunkCount);
+    }
+
+    //! Returns the first element of a chunk. Chunk sizes differ by at most one element.
+    inline size_t GetParallelAlgorithmChunkBegin(size_t chunkIndex, size_t chunkCount, size_t elementCount)
+    {
+        return elementCount / chunkCount * chunkIndex + AZStd::min(chunkIndex, elementCount % chunkCount);
+    }
+
+    //! Invokes function(chunkIndex) for every chunk, the first one on the calling thread and the others in tasks,
+    //! and returns once all of them have finished.
+    template<class Function>
+    void RunParallelAlgorithmChunks(TaskExecutor& executor, size_t chunkCount, const Function& function)
+    {
+        static const TaskDescriptor parallelAlgorithmTaskDescriptor{ "AZStd::execution::par", "ParallelAlgorithms" };
+
+        TaskGraph taskGraph{ "AZStd::execution::par" };
+        for (size_t chunkIndex = 1; chunkIndex < chunkCount; ++chunkIndex)
+        {
+            taskGraph.AddTask(
+                parallelAlgorithmTaskDescriptor,
+                [&function, chunkIndex]()
+                {
+                    function(chunkIndex);
+                });
+        }
+
+        TaskGraphEvent finishedEvent{ "AZStd::execution::par Wait" };
+        taskGraph.SubmitOnExecutor(executor, &finishedEvent);
+        function(size_t{ 0 });
+        finishedEvent.Wait();
+    }
+
+    //! Merges every pair of neighboring sorted runs of source into destination. Runs are delimited by runBounds.
+    template<class SourceIterator, class DestinationIterator, class Compare>
+    void MergeSortedRuns(TaskExecutor& executor, SourceIterator source, DestinationIterator destination,
+        const AZStd::vector<size_t>& runBounds, Compare& comp)
+    {
+        const size_t runCount = runBounds.size() - 1;
+        RunParallelAlgorithmChunks(
+            executor,
+            (runCount + 1) / 2,
+            [source, destination, &runBounds, &comp, runCount](size_t mergeIndex)
+            {
+                const size_t begin = runBounds[mergeIndex * 2];
+                const size_t middle = runBounds[AZStd::min(mergeIndex * 2 + 1, runCount)];
+                const size_t end = runBounds[AZStd::min(mergeIndex * 2 + 2, runCount)];
+                AZStd::merge(
+                    AZStd::make_move_iterator(source + begin), AZStd::make_move_iterator(source + middle),
+                    AZStd::make_move_iterator(source + middle), AZStd::make_move_iterator(source + end),
+                    destination + begin, comp);
+            });
+    }
+} // namespace AZ::Internal
+
+namespace AZStd
+{
+    template<class InputIterator, class Function>
+    void for_each(const execution::sequenced_policy&, InputIterator first, InputIterator last, Function f)
+    {
+        AZStd::for_each(first, last, AZStd::move(f));
+    }
+
+    //! Invokes f on every element from several threads, so f must be safe to call concurrently.
+    template<class RandomAccessIterator, class Function>
+    void for_each(const execution::parallel_policy& policy, RandomAccessIterator first, RandomAccessIterator last, Function f)
+    {
+        const size_t elementCount = AZStd::distance(first, last);
+        AZ::TaskExecutor* executor = AZ::Internal::GetParallelAlgorithmExecutor(policy);
+        const size_t chunkCount = AZ::Internal::GetParallelAlgorithmChunkCount(executor, elementCount, policy.m_grainSize);
+        if (chunkCount <= 1)
+        {
+            AZStd::for_each(first, last, f);
+            return;
+        }
+
+        AZ::Internal::RunParallelAlgorithmChunks(
+            *executor,
+            chunkCount,
+            [first, &f, chunkCount, elementCount](size_t chunkIndex)
+            {
+                const size_t begin = AZ::Internal::GetParallelAlgorithmChunkBegin(chunkIndex, chunkCount, elementCount);
+                const size_t end = AZ::Internal::GetParallelAlgorithmChunkBegin(chunkIndex + 1, chunkCount, elementCount);
+                for (RandomAccessIterator iter = first + begin; iter != first + end; ++iter)
+                {
+                    f(*iter);
+                }
+            });
+    }
+
+    template<class RandomAccessIterator, class Compare>
+    void sort(const execution::sequenced_policy&, RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+    {
+        AZStd::sort(first, last, comp);
+    }
+    template<class RandomAccessIterator>
+    void sort(const execution::sequenced_policy& policy, RandomAccessIterator first, RandomAccessIterator last)
+    {
+        AZStd::sort(policy, first, last, AZStd::less<typename AZStd::iterator_traits<RandomAccessIterator>::value_type>());
+    }
+
+    //! Sorts the chunks of the range in parallel, then merges pairs of sorted chunks in parallel until a single one is left.
+    //! Merging needs a buffer as large as the range, so the parallel sort requires default constructible elements and
+    //! falls back to a sequential sort for others.
+    template<class RandomAccessIterator, class Compare>
+    void sort(const execution::parallel_policy& policy, RandomAccessIterator first, RandomAccessIterator last, Compare comp)
+    {
+        using value_type = typename AZStd::iterator_traits<RandomAccessIterator>::value_type;
+
+        const size_t elementCount = AZStd::distance(first, last);
+        AZ::TaskExecutor* executor = AZ::Internal::GetParallelAlgorithmExecutor(policy);
+        const size_t chunkCount = AZ::Internal::GetParallelAlgorithmChunkCount(executor, elementCount, policy.m_grainSize);
+        if constexpr (AZStd::is_default_constructible_v<value_type>)
+        {
+            if (chunkCount > 1)
+            {
+                AZStd::vector<size_t> runBounds(chunkCount + 1);
+                for (size_t chunkIndex = 0; chunkIndex <= chunkCount; ++chunkIndex)
+                {
+                    runBounds[chunkIndex] = AZ::Internal::GetParallelAlgorithmChunkBegin(chunkIndex, chunkCount, elementCount);
+                }
+
+                AZ::Internal::RunParallelAlgorithmChunks(
+                    *executor,
+                    chunkCount,
+                    [first, &runBounds, &comp](size_t chunkIndex)
+                    {
+                        AZStd::sort(first + runBounds[chunkIndex], first + runBounds[chunkIndex + 1], comp);
+                    });
+
+                // Merge back and forth between the range and the buffer, halving the number of runs each time
+                AZStd::vector<value_type> buffer(elementCount);
+                bool sortedIntoBuffer = false;
+                while (runBounds.size() > 2)
+                {
+                    if (sortedIntoBuffer)
+                    {
+                        AZ::Internal::MergeSortedRuns(*executor, buffer.begin(), first, runBounds, comp);
+                    }
+                    else
+                    {
+                        AZ::Internal::MergeSortedRuns(*executor, first, buffer.begin(), runBounds, comp);
+                    }
+                    sortedIntoBuffer = !sortedIntoBuffer;
+
+                    AZStd::vector<size_t> mergedBounds;
+                    mergedBounds.reserve(runBounds.size() / 2 + 1);
+                    for (size_t boundIndex = 0; boundIndex < runBounds.size() - 1; boundIndex += 2)
+                    {
+                        mergedBounds.push_back(runBounds[boundIndex]);
+                    }
+                    mergedBounds.push_back(elementCount);
+                    runBounds = AZStd::move(mergedBounds);
+                }
+
+                if (sortedIntoBuffer)
+                {
+                    AZ::Internal::RunParallelAlgorithmChunks(
+                        *executor,
+                        chunkCount,
+                        [first, &buffer, chunkCount, elementCount](size_t chunkIndex)
+                        {
+                            const size_t begin = AZ::Internal::GetParallelAlgorithmChunkBegin(chunkIndex, chunkCount, elementCount);
+                            const size_t end = AZ::Internal::GetParallelAlgorithmChunkBegin(chunkIndex + 1, chunkCount, elementCount);
+                            AZStd::move(buffer.begin() + begin, buffer.begin() + end, first + begin);
+                        });
+                }
+                return;
+            }
+        }
+
+        AZStd::sort(first, last, comp);
+    }
+    template<class RandomAccessIterator>
+    void sort(const execution::parallel_policy& policy, RandomAccessIterator first, RandomAccessIterator last)
+    {
+        AZStd::sort(policy, first, last, AZStd::less<typename AZStd::iterator_traits<RandomAccessIterator>::value_type>());
+    }
+
+    template<class InputIterator, class T, class BinaryReduceOp, class UnaryTransformOp>
+    T transform_reduce(const execution::sequenced_policy&, InputIterator first, InputIterator last, T init,
+        BinaryReduceOp reduce, UnaryTransformOp transform)
+    {
+        return AZStd::transform_reduce(first, last, AZStd::move(init), reduce, transform);
+    }
+
+    //! Reduces every chunk on its own and then reduces the results of the chunks in order, so reduce must be associative.
+    //! Both reduce and transform are invoked from several threads.
+    template<class RandomAccessIterator, class T, class BinaryReduceOp, class UnaryTransformOp>
+    T transform_reduce(const execution::parallel_policy& policy, RandomAccessIterator first, RandomAccessIterator last, T init,
+        BinaryReduceOp reduce, UnaryTransformOp transform)
+    {
+        const size_t elementCount = AZStd::distance(first, last);
+        AZ::TaskExecutor* executor = AZ::Internal::GetParallelAlgorithmExecutor(policy);
+        const size_t chunkCount = AZ::Internal::GetParallelAlgorithmChunkCount(executor, elementCount, policy.m_grainSize);
+        if (chunkCount <= 1)
+        {
+            return AZStd::transform_reduce(first, last, AZStd::move(init), reduce, transform);
+        }
+
+        // Every chunk has at least one element, so its first transformed element seeds its result
+        AZStd::vector<T> chunkResults(chunkCount, init);
+        AZ::Internal::RunParallelAlgorithmChunks(
+            *executor,
+            chunkCount,
+            [first, &chunkResults, &reduce, &transform, chunkCount, elementCount](size_t chunkIndex)
+            {
+                const size_t begin = AZ::Internal::GetParallelAlgorithmChunkBegin(chunkIndex, chunkCount, elementCount);
+                const size_t end = AZ::Internal::GetParallelAlgorithmChunkBegin(chunkIndex + 1, chunkCount, elementCount);
+                T result = transform(*(first + begin));
+                for (RandomAccessIterator iter = first + begin + 1; iter != first + end; ++iter)
+                {
+                    result = reduce(AZStd::move(result), transform(*iter));
+                }
+                chunkResults[chunkIndex] = AZStd::move(result);
+            });
+
+        for (T& chunkResult : chunkResults)
+        {
+            init = reduce(AZStd::move(init), AZStd::move(chunkResult));
+        }
+        return init;
+    }
+} // namespace AZStd
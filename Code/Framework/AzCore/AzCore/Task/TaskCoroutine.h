@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+// Coroutine support for the task executor. Coroutines require C++20, when compiling with an earlier standard this header
+// doesn't declare anything. Check for AZ_TASK_COROUTINES_SUPPORTED before using any of the types below.
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#define AZ_TASK_COROUTINES_SUPPORTED
+
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+
+#include <coroutine>
+
+namespace AZ
+{
+    // Return type of coroutines that are resumed by the task executor. A TaskCoroutine is fire-and-forget: it starts
+    // running immediately on the calling thread and its frame is destroyed once the coroutine returns. Use a
+    // TaskGraphEvent, or any other synchronization primitive, to find out when the coroutine has finished.
+    //
+    //     AZ::TaskCoroutine LoadAndProcess(AZ::TaskExecutor& executor)
+    //     {
+    //         co_await AZ::ResumeOn(executor);   // continue on a task worker
+    //         ...
+    //         co_await someEvent;                // suspend until the event's task graph has finished
+    //         ...
+    //     }
+    //
+    // Exceptions are disabled in the engine, so coroutines are not allowed to throw.
+    class TaskCoroutine final
+    {
+    public:
+        struct promise_type
+        {
+            TaskCoroutine get_return_object() const noexcept
+            {
+                return {};
+            }
+            std::suspend_never initial_suspend() const noexcept
+            {
+                return {};
+            }
+            std::suspend_never final_suspend() const noexcept
+            {
+                return {};
+            }
+            void return_void() const noexcept
+            {
+            }
+            void unhandled_exception() const noexcept
+            {
+                AZ_Assert(false, "Unhandled exception in a TaskCoroutine.");
+            }
+        };
+    };
+
+    namespace Internal
+    {
+        inline constexpr TaskDescriptor ResumeCoroutineTaskDescriptor{ "Resume coroutine", "TaskCoroutine" };
+
+        // Resumes the coroutine from a single task detached graph on the given executor
+        inline void ResumeCoroutineOnExecutor(TaskExecutor& executor, const TaskDescriptor& descriptor, std::coroutine_handle<> handle)
+        {
+            TaskGraph graph{ "ResumeCoroutine" };
+            graph.AddTask(
+                descriptor,
+                [handle]
+                {
+                    handle.resume();
+                });
+            graph.Detach();
+            graph.SubmitOnExecutor(executor);
+        }
+    } // namespace Internal
+
+    // Awaiting this suspends the coroutine and resumes it on one of the workers of the executor.
+    class ResumeOnExecutorAwaiter final
+    {
+    public:
+        ResumeOnExecutorAwaiter(TaskExecutor& executor, const TaskDescriptor& descriptor)
+            : m_executor{ executor }
+            , m_descriptor{ descriptor }
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+        void await_suspend(std::coroutine_handle<> handle) const
+        {
+            Internal::ResumeCoroutineOnExecutor(m_executor, m_descriptor, handle);
+        }
+        void await_resume() const noexcept
+        {
+        }
+
+    private:
+        TaskExecutor& m_executor;
+        TaskDescriptor m_descriptor;
+    };
+
+    inline ResumeOnExecutorAwaiter ResumeOn(
+        TaskExecutor& executor, const TaskDescriptor& descriptor = Internal::ResumeCoroutineTaskDescriptor)
+    {
+        return { executor, descriptor };
+    }
+
+    // Awaiting this suspends the coroutine until the event is signaled. Without an executor the coroutine is resumed on
+    // the thread that signals the event, which for events passed to TaskGraph::Submit is the task worker that finished
+    // the graph. With an executor the coroutine is resumed by a new task on that executor instead.
+    // Like with TaskGraphEvent::Wait, an event can only be awaited once.
+    class TaskGraphEventAwaiter final
+    {
+    public:
+        explicit TaskGraphEventAwaiter(TaskGraphEvent& event, TaskExecutor* executor = nullptr)
+            : m_event{ event }
+            , m_executor{ executor }
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            m_handle = handle;
+            m_event.SetContinuation(&TaskGraphEventAwaiter::OnSignaled, this);
+        }
+        void await_resume() const noexcept
+        {
+        }
+
+    private:
+        static void OnSignaled(void* userData)
+        {
+            // The awaiter is part of the coroutine frame, so it's gone once the coroutine resumes.
+            auto* self = static_cast<TaskGraphEventAwaiter*>(userData);
+            std::coroutine_handle<> handle = self->m_handle;
+            if (TaskExecutor* executor = self->m_executor)
+            {
+                Internal::ResumeCoroutineOnExecutor(*executor, Internal::ResumeCoroutineTaskDescriptor, handle);
+            }
+            else
+            {
+                handle.resume();
+            }
+        }
+
+        TaskGraphEvent& m_event;
+        TaskExecutor* m_executor;
+        std::coroutine_handle<> m_handle;
+    };
+
+    inline TaskGraphEventAwaiter operator co_await(TaskGraphEvent& event)
+    {
+        return TaskGraphEventAwaiter{ event };
+    }
+
+    inline TaskGraphEventAwaiter WaitFor(TaskGraphEvent& event, TaskExecutor& resumeOn)
+    {
+        return TaskGraphEventAwaiter{ event, &resumeOn };
+    }
+} // namespace AZ
+
+#endif // defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
@@ -31,6 +31,9 @@ namespace AZ
     // TODO: Define various task kinds and provide a mechanism for cpuMask computation on different systems.
     struct TaskDescriptor
     {
+        // Value of workerHint for tasks that can run on any worker
+        static constexpr uint16_t NoWorkerHint = AZStd::numeric_limits<uint16_t>::max();
+
         // Unique task kind label (e.g. "frustum culling")
         // Task names *must* be provided
         const char* taskName = nullptr;
@@ -42,6 +45,11 @@ namespace AZ
         // that were queued before it provided they had not yet started
         TaskPriority priority = TaskPriority::MEDIUM;
 
+        // EXPERTS ONLY. Queues tasks of this kind on a specific worker (modulo the number of workers) so that
+        // tasks working on the same data share a thread and its caches. Hinted tasks are not subject to work
+        // stealing. The hint is ignored if the worker is unavailable
+        uint16_t workerHint = NoWorkerHint;
+
         // EXPERTS ONLY. A bitmask that restricts tasks of this kind to run only on cores
         // corresponding to a set bit. 0 is synonymous with all bits set
         uint32_t cpuMask = 0;
@@ -6,16 +6,26 @@
  *
  */
 
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/Job.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
+#include <AzCore/Metrics/IEventLogger.h>
 
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/queue.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/std/parallel/exponential_backoff.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/parallel/semaphore.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/Module/Environment.h>
 
@@ -197,6 +207,159 @@ namespace AZ
             return nullptr;
         }
 
+        // Chase-Lev work-stealing deque ("Dynamic Circular Work-Stealing Deque", with the memory orderings from "Correct and
+        // Efficient Work-Stealing for Weak Memory Models"). The owning worker pushes and pops tasks at the bottom in LIFO order
+        // which keeps the successors of a task on the same thread while their inputs are still in the cache. Other workers
+        // steal from the top. The capacity is fixed, Push fails if the deque is full.
+        class WorkStealingDeque final
+        {
+        public:
+            constexpr static int64_t Capacity = 4096;
+
+            WorkStealingDeque() = default;
+            WorkStealingDeque(const WorkStealingDeque&) = delete;
+            WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+            // Only called by the owning worker
+            bool Push(Task* task);
+            // Only called by the owning worker
+            Task* Pop();
+            // Can be called by any thread
+            Task* Steal();
+
+        private:
+            constexpr static int64_t Mask = Capacity - 1;
+            static_assert((Capacity & Mask) == 0, "WorkStealingDeque capacity must be a power of 2");
+
+            // Top and bottom are kept on separate cache lines as they're written by different threads
+            alignas(64) AZStd::atomic<int64_t> m_top{ 0 };
+            alignas(64) AZStd::atomic<int64_t> m_bottom{ 0 };
+            AZStd::atomic<Task*> m_tasks[Capacity] = {};
+        };
+
+        bool WorkStealingDeque::Push(Task* task)
+        {
+            const int64_t bottom = m_bottom.load(AZStd::memory_order_relaxed);
+            const int64_t top = m_top.load(AZStd::memory_order_acquire);
+            if (bottom - top >= Capacity)
+            {
+                return false;
+            }
+
+            m_tasks[bottom & Mask].store(task, AZStd::memory_order_relaxed);
+            AZStd::atomic_thread_fence(AZStd::memory_order_release);
+            m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+            return true;
+        }
+
+        Task* WorkStealingDeque::Pop()
+        {
+            const int64_t bottom = m_bottom.load(AZStd::memory_order_relaxed) - 1;
+            m_bottom.store(bottom, AZStd::memory_order_relaxed);
+            AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+            int64_t top = m_top.load(AZStd::memory_order_relaxed);
+
+            if (top > bottom)
+            {
+                // Empty
+                m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+                return nullptr;
+            }
+
+            Task* task = m_tasks[bottom & Mask].load(AZStd::memory_order_relaxed);
+            if (top == bottom)
+            {
+                // Last task, race against the thieves for it
+                if (!m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+                {
+                    task = nullptr;
+                }
+                m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+            }
+            return task;
+        }
+
+        Task* WorkStealingDeque::Steal()
+        {
+            int64_t top = m_top.load(AZStd::memory_order_acquire);
+            AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+            const int64_t bottom = m_bottom.load(AZStd::memory_order_acquire);
+            if (top >= bottom)
+            {
+                return nullptr;
+            }
+
+            Task* task = m_tasks[top & Mask].load(AZStd::memory_order_relaxed);
+            if (!m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+            {
+                // Lost the race against the owner or another thief
+                return nullptr;
+            }
+            return task;
+        }
+
+        struct TaskTimelineEvent
+        {
+            static constexpr uint32_t NotStolen = AZStd::numeric_limits<uint32_t>::max();
+
+            AZStd::chrono::steady_clock::time_point m_start;
+            AZStd::chrono::steady_clock::time_point m_end;
+            // The task name is nullptr for periods the worker was idle
+            const char* m_taskName = nullptr;
+            const char* m_taskGroup = nullptr;
+            // Id of the worker that scheduled the task if it was stolen
+            uint32_t m_stolenFrom = NotStolen;
+        };
+
+        // Ring buffer with the most recent timeline events of a worker. Only the worker itself records events, but the
+        // events can be copied from any thread, even while the worker is still recording.
+        class TaskTimelineBuffer final
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(TaskTimelineBuffer, SystemAllocator);
+
+            static constexpr uint64_t Capacity = 8192;
+
+            void Record(const TaskTimelineEvent& event)
+            {
+                const uint64_t index = m_recorded.load(AZStd::memory_order_relaxed);
+                m_events[index % Capacity] = event;
+                m_recorded.store(index + 1, AZStd::memory_order_release);
+            }
+
+            // Appends the events that started at or after the given time, oldest first
+            void CopyEvents(AZStd::vector<TaskTimelineEvent>& events, AZStd::chrono::steady_clock::time_point since) const
+            {
+                const uint64_t recorded = m_recorded.load(AZStd::memory_order_acquire);
+                const size_t firstCopied = events.size();
+                const uint64_t first = recorded > Capacity ? recorded - Capacity : 0;
+                for (uint64_t i = first; i != recorded; ++i)
+                {
+                    events.push_back(m_events[i % Capacity]);
+                }
+
+                // Drop the events the worker may have overwritten while they were copied
+                AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+                const uint64_t recordedAfterCopy = m_recorded.load(AZStd::memory_order_relaxed);
+                const uint64_t firstIntact = recordedAfterCopy >= Capacity ? recordedAfterCopy - Capacity + 1 : 0;
+                const size_t overwritten = static_cast<size_t>(AZStd::min(recorded, AZStd::max(first, firstIntact)) - first);
+                events.erase(events.begin() + firstCopied, events.begin() + firstCopied + overwritten);
+                events.erase(
+                    AZStd::remove_if(
+                        events.begin() + firstCopied,
+                        events.end(),
+                        [since](const TaskTimelineEvent& event)
+                        {
+                            return event.m_start < since;
+                        }),
+                    events.end());
+            }
+
+        private:
+            TaskTimelineEvent m_events[Capacity];
+            AZStd::atomic<uint64_t> m_recorded{ 0 };
+        };
+
         class TaskWorker
         {
         public:
@@ -205,6 +368,9 @@ namespace AZ
             void Spawn(::AZ::TaskExecutor& executor, uint32_t id, AZStd::semaphore& initSemaphore, bool affinitize)
             {
                 m_executor = &executor;
+                m_id = id;
+                // Seed for picking the workers to steal from, only needs to differ between workers
+                m_randomState = (static_cast<uint64_t>(id) + 1) * 0x9E3779B97F4A7C15ULL;
 
                 m_threadName = AZStd::string::format("TaskWorker %u", id);
                 AZStd::thread_desc desc = {};
@@ -254,6 +420,18 @@ namespace AZ
                 m_semaphore.release();
             }
 
+            // Wakes the worker if it's waiting for work. Returns false if the worker was already awake
+            bool Wake()
+            {
+                bool sleeping = true;
+                if (m_sleeping.compare_exchange_strong(sleeping, false))
+                {
+                    m_semaphore.release();
+                    return true;
+                }
+                return false;
+            }
+
             const char* GetThreadName() {return m_threadName.c_str();}
 
         private:
@@ -261,51 +439,211 @@ namespace AZ
             {
                 while (m_active)
                 {
-                    m_semaphore.acquire();
-
-                    if (!m_active)
+                    uint32_t stolenFrom = TaskTimelineEvent::NotStolen;
+                    if (Task* task = FindTask(stolenFrom); task)
                     {
-                        return;
+                        Execute(*m_executor, this, task, stolenFrom);
+                        continue;
                     }
 
-                    Task* task = m_queue.TryDequeue();
-                    while (task)
+                    // Advertise that this worker is about to sleep before looking for work one last time. Workers that push
+                    // tasks check this flag after publishing them, so either the task is found here or this worker is woken.
+                    m_sleeping.store(true);
+                    ++m_executor->m_sleepingWorkerCount;
+                    if (Task* task = FindTask(stolenFrom); task)
                     {
-                        task->Invoke();
-                        // Decrement counts for all task successors
-                        for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
+                        if (bool sleeping = true; !m_sleeping.compare_exchange_strong(sleeping, false))
                         {
-                            Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
-                            if (--successor->m_dependencyCount == 0)
-                            {
-                                m_executor->Submit(*successor);
-                            }
+                            // Another thread already woke this worker, consume the release so the semaphore stays balanced
+                            m_semaphore.acquire();
                         }
+                        --m_executor->m_sleepingWorkerCount;
+                        Execute(*m_executor, this, task, stolenFrom);
+                        continue;
+                    }
+
+                    TaskTimelineBuffer* timeline = GetTimeline();
+                    const AZStd::chrono::steady_clock::time_point idleStart =
+                        timeline ? AZStd::chrono::steady_clock::now() : AZStd::chrono::steady_clock::time_point{};
+                    m_semaphore.acquire();
+                    // Tasks that are enqueued directly release the semaphore without going through Wake
+                    m_sleeping.store(false);
+                    --m_executor->m_sleepingWorkerCount;
+                    if (timeline)
+                    {
+                        TaskTimelineEvent event;
+                        event.m_start = idleStart;
+                        event.m_end = AZStd::chrono::steady_clock::now();
+                        timeline->Record(event);
+                    }
+                }
+            }
+
+            TaskTimelineBuffer* GetTimeline() const
+            {
+                return m_executor->m_recordingTimeline.load(AZStd::memory_order_acquire) ? m_timeline.get() : nullptr;
+            }
 
-                        bool isRetained = task->m_graph->m_parent != nullptr;
-                        if (task->m_graph->Release(m_executor->GetEventTracker()) == (isRetained ? 1u : 0u))
+            // Tasks queued on this worker take precedence, as they're ordered by priority, followed by the tasks this worker
+            // scheduled itself. Idle workers steal from a random worker to spread the contention between the deques.
+            Task* FindTask(uint32_t& stolenFrom)
+            {
+                if (Task* task = m_queue.TryDequeue(); task)
+                {
+                    return task;
+                }
+                if (Task* task = m_deque.Pop(); task)
+                {
+                    return task;
+                }
+
+                const uint32_t workerCount = m_executor->m_threadCount;
+                if (workerCount > 1)
+                {
+                    // xorshift64
+                    m_randomState ^= m_randomState << 13;
+                    m_randomState ^= m_randomState >> 7;
+                    m_randomState ^= m_randomState << 17;
+                    const uint32_t start = static_cast<uint32_t>(m_randomState % workerCount);
+                    for (uint32_t i = 0; i != workerCount; ++i)
+                    {
+                        TaskWorker& victim = m_executor->m_workers[(start + i) % workerCount];
+                        if (&victim == this)
                         {
-                            m_executor->ReleaseGraph();
+                            continue;
                         }
+                        if (Task* task = victim.m_deque.Steal(); task)
+                        {
+                            stolenFrom = victim.m_id;
+                            return task;
+                        }
+                    }
+                }
+                return nullptr;
+            }
 
-                        task = m_queue.TryDequeue();
+            // Runs the task and schedules the successors that became ready. The worker is nullptr if the task runs as a job.
+            // Stolen tasks pass the id of the worker they were stolen from, which is only used for the timeline
+            static void Execute(
+                ::AZ::TaskExecutor& executor, TaskWorker* worker, Task* task, uint32_t stolenFrom = TaskTimelineEvent::NotStolen)
+            {
+                if (executor.m_recordingTimeline.load(AZStd::memory_order_relaxed))
+                {
+                    // Record the task before its successors are scheduled, the graph may be released by another worker afterwards
+                    TaskTimelineBuffer* timeline = worker ? worker->GetTimeline() : nullptr;
+                    TaskTimelineEvent event;
+                    event.m_taskName = task->m_descriptor.taskName;
+                    event.m_taskGroup = task->m_descriptor.taskGroup;
+                    event.m_stolenFrom = stolenFrom;
+                    event.m_start = AZStd::chrono::steady_clock::now();
+                    AZ_PROFILE_BEGIN(AzCore, task->m_descriptor.taskName);
+                    task->Invoke();
+                    AZ_PROFILE_END(AzCore);
+                    if (timeline)
+                    {
+                        event.m_end = AZStd::chrono::steady_clock::now();
+                        timeline->Record(event);
+                    }
+                }
+                else
+                {
+                    task->Invoke();
+                }
+                // Decrement counts for all task successors
+                for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
+                {
+                    Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
+                    if (--successor->m_dependencyCount == 0)
+                    {
+                        if (worker)
+                        {
+                            worker->Schedule(successor);
+                        }
+                        else
+                        {
+                            executor.Submit(*successor);
+                        }
                     }
                 }
+
+                bool isRetained = task->m_graph->m_parent != nullptr;
+                if (task->m_graph->Release(executor.GetEventTracker()) == (isRetained ? 1u : 0u))
+                {
+                    executor.ReleaseGraph();
+                }
+            }
+
+            // Successors that became ready on this worker are kept on this worker, other workers will steal them if they're idle
+            void Schedule(Task* task)
+            {
+                if (task->GetWorkerHint() != TaskDescriptor::NoWorkerHint || !m_deque.Push(task))
+                {
+                    m_executor->Submit(*task);
+                    return;
+                }
+                m_executor->WakeSleepingWorker();
             }
 
             AZStd::thread m_thread;
             AZStd::atomic<bool> m_active;
             AZStd::atomic<bool> m_enabled = true;
+            AZStd::atomic<bool> m_sleeping = false;
             AZStd::binary_semaphore m_semaphore;
 
             ::AZ::TaskExecutor* m_executor;
+            uint32_t m_id = 0;
+            uint64_t m_randomState = 0;
             TaskQueue m_queue;
+            WorkStealingDeque m_deque;
+            // Allocated the first time a timeline is recorded
+            AZStd::unique_ptr<TaskTimelineBuffer> m_timeline;
             AZStd::string m_threadName;
             friend class ::AZ::TaskExecutor;
+            friend class TaskJob;
         };
 
         thread_local TaskWorker* TaskWorker::t_worker = nullptr;
 
+        // Runs a task on the worker threads of a job manager for executors that don't have their own workers
+        class TaskJob final
+            : public Job
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(TaskJob, ThreadPoolAllocator);
+
+            TaskJob(::AZ::TaskExecutor& executor, Task& task, JobContext* context)
+                : Job(true, context, false, GetJobPriority(task))
+                , m_executor(executor)
+                , m_task(task)
+            {
+            }
+
+            void Process() override
+            {
+                TaskWorker::Execute(m_executor, nullptr, &m_task);
+            }
+
+        private:
+            // Maps the task priorities onto the job priority range, so tasks and jobs share the same ordering
+            static s8 GetJobPriority(const Task& task)
+            {
+                switch (static_cast<TaskPriority>(task.GetPriorityNumber()))
+                {
+                case TaskPriority::CRITICAL:
+                    return 96;
+                case TaskPriority::HIGH:
+                    return 32;
+                case TaskPriority::LOW:
+                    return -32;
+                default:
+                    return 0;
+                }
+            }
+
+            ::AZ::TaskExecutor& m_executor;
+            Task& m_task;
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Implement basic CompiledTaskGraph event breadcrumbs to help debug
         // https://github.com/o3de/o3de/issues/12015
@@ -376,7 +714,7 @@ namespace AZ
         // TODO: Configure thread count + affinity based on configuration
         m_threadCount = threadCount == 0 ? AZStd::thread::hardware_concurrency() : threadCount;
 
-        m_workers = reinterpret_cast<Internal::TaskWorker*>(azmalloc(m_threadCount * sizeof(Internal::TaskWorker)));
+        m_workers = reinterpret_cast<Internal::TaskWorker*>(azmalloc(m_threadCount * sizeof(Internal::TaskWorker), alignof(Internal::TaskWorker)));
 
         AZStd::semaphore initSemaphore;
 
@@ -392,17 +730,147 @@ namespace AZ
         }
     }
 
+    TaskExecutor::TaskExecutor(JobContext& jobContext)
+        : m_jobContext(&jobContext)
+        , m_eventTracker(this)
+    {
+    }
+
     TaskExecutor::~TaskExecutor()
     {
+        // All workers need to be stopped before any of them are destroyed, as idle workers steal from the others
         for (size_t i = 0; i != m_threadCount; ++i)
         {
             m_workers[i].Join();
+        }
+        for (size_t i = 0; i != m_threadCount; ++i)
+        {
             m_workers[i].~TaskWorker();
         }
 
         azfree(m_workers);
     }
 
+    bool TaskExecutor::IsRunningTask()
+    {
+        if (m_jobContext)
+        {
+            return m_jobContext->GetJobManager().GetCurrentJob() != nullptr;
+        }
+        return GetTaskWorker() != nullptr;
+    }
+
+    uint32_t TaskExecutor::GetWorkerCount() const
+    {
+        return m_threadCount;
+    }
+
+    uint32_t TaskExecutor::GetCurrentWorkerIndex()
+    {
+        Internal::TaskWorker* worker = GetTaskWorker();
+        return worker ? worker->m_id : InvalidWorkerIndex;
+    }
+
+    void TaskExecutor::StartTimelineRecording()
+    {
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            if (!m_workers[i].m_timeline)
+            {
+                m_workers[i].m_timeline = AZStd::make_unique<Internal::TaskTimelineBuffer>();
+            }
+        }
+        m_timelineStart.store(AZStd::chrono::steady_clock::now().time_since_epoch().count(), AZStd::memory_order_relaxed);
+        // Publishes the buffers to the workers
+        m_recordingTimeline.store(true, AZStd::memory_order_release);
+    }
+
+    void TaskExecutor::StopTimelineRecording()
+    {
+        m_recordingTimeline.store(false, AZStd::memory_order_release);
+    }
+
+    bool TaskExecutor::IsRecordingTimeline() const
+    {
+        return m_recordingTimeline.load(AZStd::memory_order_relaxed);
+    }
+
+    void TaskExecutor::ExportTimeline(Metrics::IEventLogger& eventLogger)
+    {
+        using namespace AZStd::chrono;
+
+        StopTimelineRecording();
+        const steady_clock::time_point timelineStart{ steady_clock::duration{ m_timelineStart.load(AZStd::memory_order_relaxed) } };
+        // Trace events use UTC timestamps
+        const steady_clock::time_point steadyNow = steady_clock::now();
+        const microseconds utcNow = duration_cast<microseconds>(utc_clock::now().time_since_epoch());
+        auto toTimestamp = [steadyNow, utcNow](steady_clock::time_point time)
+        {
+            return utcNow - duration_cast<microseconds>(steadyNow - time);
+        };
+
+        AZStd::vector<Internal::TaskTimelineEvent> events;
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            Internal::TaskWorker& worker = m_workers[i];
+            if (!worker.m_timeline)
+            {
+                continue;
+            }
+            events.clear();
+            worker.m_timeline->CopyEvents(events, timelineStart);
+            if (events.empty())
+            {
+                continue;
+            }
+
+            const AZStd::thread::id threadId = worker.m_thread.get_id();
+            microseconds busyTime{ 0 };
+            microseconds idleTime{ 0 };
+            uint64_t stolenCount = 0;
+            for (const Internal::TaskTimelineEvent& event : events)
+            {
+                const microseconds duration = duration_cast<microseconds>(event.m_end - event.m_start);
+                const bool isIdle = event.m_taskName == nullptr;
+                const bool isStolen = event.m_stolenFrom != Internal::TaskTimelineEvent::NotStolen;
+                (isIdle ? idleTime : busyTime) += duration;
+                stolenCount += isStolen ? 1 : 0;
+
+                AZStd::fixed_vector<Metrics::EventField, 2> args;
+                if (isStolen)
+                {
+                    args.emplace_back("stolenFrom", Metrics::EventValue{ AZStd::in_place_type<AZ::u64>, event.m_stolenFrom });
+                }
+                Metrics::CompleteArgs completeArgs;
+                completeArgs.m_name = isIdle ? "Idle" : event.m_taskName;
+                completeArgs.m_cat = isIdle ? "TaskWorker" : (event.m_taskGroup ? event.m_taskGroup : "Task");
+                completeArgs.m_args = args;
+                completeArgs.m_ts = toTimestamp(event.m_start);
+                completeArgs.m_tid = threadId;
+                completeArgs.m_dur = duration;
+                eventLogger.RecordCompleteEvent(completeArgs);
+            }
+
+            // Occupancy is the fraction of the recorded time the worker spent running tasks
+            const microseconds recordedTime = duration_cast<microseconds>(events.back().m_end - events.front().m_start);
+            const double occupancy =
+                recordedTime.count() > 0 ? static_cast<double>(busyTime.count()) / static_cast<double>(recordedTime.count()) : 0.0;
+            Metrics::EventField occupancyArgs[] = {
+                { "occupancy", Metrics::EventValue{ AZStd::in_place_type<double>, occupancy } },
+                { "busyUs", Metrics::EventValue{ AZStd::in_place_type<AZ::s64>, busyTime.count() } },
+                { "idleUs", Metrics::EventValue{ AZStd::in_place_type<AZ::s64>, idleTime.count() } },
+                { "stolenTasks", Metrics::EventValue{ AZStd::in_place_type<AZ::u64>, stolenCount } },
+            };
+            Metrics::InstantArgs instantArgs;
+            instantArgs.m_name = "Occupancy";
+            instantArgs.m_cat = "TaskWorker";
+            instantArgs.m_args = occupancyArgs;
+            instantArgs.m_ts = toTimestamp(events.back().m_end);
+            instantArgs.m_tid = threadId;
+            eventLogger.RecordInstantEvent(instantArgs);
+        }
+    }
+
     Internal::TaskWorker* TaskExecutor::GetTaskWorker()
     {
         if (Internal::TaskWorker::t_worker && Internal::TaskWorker::t_worker->m_executor == this)
@@ -451,9 +919,22 @@ namespace AZ
 
     void TaskExecutor::Submit(Internal::Task& task)
     {
-        // TODO: Something more sophisticated is likely needed here.
-        // First, we are completely ignoring affinity.
-        // Second, some heuristics on core availability will help distribute work more effectively
+        if (m_jobContext)
+        {
+            (aznew Internal::TaskJob(*this, task, m_jobContext))->Start();
+            return;
+        }
+
+        if (const uint16_t workerHint = task.GetWorkerHint(); workerHint != TaskDescriptor::NoWorkerHint)
+        {
+            if (Internal::TaskWorker& worker = m_workers[workerHint % m_threadCount]; worker.Enabled())
+            {
+                worker.Enqueue(&task);
+                return;
+            }
+        }
+
+        // Tasks are spread round robin, the work stealing between the workers evens out the imbalance from there.
         uint32_t nextWorker = ++m_lastSubmission % m_threadCount;
         while (!m_workers[nextWorker].Enabled())
         {
@@ -465,6 +946,24 @@ namespace AZ
         m_workers[nextWorker].Enqueue(&task);
     }
 
+    void TaskExecutor::WakeSleepingWorker()
+    {
+        // Pairs with the sleeping worker advertising that it's about to sleep before checking the deques a last time
+        AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+        if (m_sleepingWorkerCount.load(AZStd::memory_order_relaxed) == 0)
+        {
+            return;
+        }
+
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            if (m_workers[i].Enabled() && m_workers[i].Wake())
+            {
+                return;
+            }
+        }
+    }
+
     void TaskExecutor::ReleaseGraph()
     {
         --m_graphsRemaining;
@@ -22,6 +22,11 @@
 
 namespace AZ
 {
+    namespace Metrics
+    {
+        class IEventLogger;
+    }
+    class JobContext;
     class TaskGraphEvent;
     class TaskGraph;
     class TaskExecutor;
@@ -128,6 +133,10 @@ namespace AZ
 
         // Passing 0 for the threadCount requests for the thread count to match the hardware concurrency
         explicit TaskExecutor(uint32_t threadCount = 0);
+
+        // Runs the tasks as jobs on the worker threads of the job context's JobManager instead of spawning workers,
+        // so task graphs and jobs share a single pool of threads. Task priorities are mapped onto job priorities
+        explicit TaskExecutor(JobContext& jobContext);
         ~TaskExecutor();
 
         // Submit a task graph for execution. Waitable task graphs cannot enqueue work on the task thread
@@ -138,19 +147,51 @@ namespace AZ
 
         Internal::CompiledTaskGraphTracker& GetEventTracker() {return m_eventTracker;}
 
+        // Returns true if the calling thread is running a task (or job if the executor runs on a JobManager)
+        bool IsRunningTask();
+
+        static constexpr uint32_t InvalidWorkerIndex = 0xffffffff;
+
+        // Returns the number of worker threads owned by this executor, which is 0 if it runs its tasks on a JobManager
+        uint32_t GetWorkerCount() const;
+
+        // Returns the index (0 to GetWorkerCount() - 1) of the worker running on the calling thread, or InvalidWorkerIndex
+        // if the calling thread isn't one of the workers of this executor
+        uint32_t GetCurrentWorkerIndex();
+
+        // Start recording a timeline of the tasks each worker runs, which tasks were stolen from other workers and how
+        // long the workers were idle. Each worker keeps its most recent events in a fixed size ring buffer. While
+        // recording, tasks are also reported as profiler regions so they show up in the CpuProfiler.
+        // Executors that run on a JobManager only report the profiler regions, as they don't have workers of their own.
+        void StartTimelineRecording();
+        void StopTimelineRecording();
+        bool IsRecordingTimeline() const;
+
+        // Stops the recording and writes the timeline as trace events: a complete event for every task and idle period
+        // on the thread of the worker it occurred on, followed by an instant event per worker with its occupancy.
+        void ExportTimeline(Metrics::IEventLogger& eventLogger);
+
     private:
         friend class Internal::TaskWorker;
         friend class TaskGraphEvent;
         friend class Internal::CompiledTaskGraphTracker;
 
         Internal::TaskWorker* GetTaskWorker();
+        // Wakes one of the workers that are waiting for work, if any, so it can steal recently scheduled tasks
+        void WakeSleepingWorker();
         void ReleaseGraph();
         void ReactivateTaskWorker();
 
-        Internal::TaskWorker* m_workers;
+        Internal::TaskWorker* m_workers = nullptr;
         uint32_t m_threadCount = 0;
+        // If set, tasks are run as jobs in this context and the executor has no workers of its own
+        JobContext* m_jobContext = nullptr;
         AZStd::atomic<uint32_t> m_lastSubmission;
         AZStd::atomic<uint64_t> m_graphsRemaining;
+        AZStd::atomic<uint32_t> m_sleepingWorkerCount{ 0 };
+        AZStd::atomic<bool> m_recordingTimeline{ false };
+        // Only events recorded after this time, in steady clock ticks, are part of the current timeline
+        AZStd::atomic<int64_t> m_timelineStart{ 0 };
 
         // Implement basic CompiledTaskGraph event breadcrumbs to help debug
         // https://github.com/o3de/o3de/issues/12015
@@ -16,10 +16,27 @@ namespace AZ
 
     void TaskGraphEvent::Wait()
     {
-        AZ_Assert(m_executor->GetTaskWorker() == nullptr, "Event %s waiting in a task is unsupported", m_label);
+        AZ_Assert(!m_executor->IsRunningTask(), "Event %s waiting in a task is unsupported", m_label);
         m_semaphore.acquire();
     }
 
+    void TaskGraphEvent::SetContinuation(ContinuationFunction continuation, void* userData)
+    {
+        AZ_Assert(continuation, "Null continuation set on event %s", m_label);
+        m_continuation = continuation;
+        m_continuationData = userData;
+
+        int expectedState = 0;
+        if (!m_continuationState.compare_exchange_strong(expectedState, 1, AZStd::memory_order_acq_rel))
+        {
+            AZ_Assert(expectedState == 2, "Only a single continuation may be set on event %s", m_label);
+            if (expectedState == 2) // already signaled
+            {
+                continuation(userData);
+            }
+        }
+    }
+
     void TaskGraphEvent::IncWaitCount()
     {
         // guess zero to optimize for single task graph using an event, if multiple are using it then this will take 2+ comp_exch calls
@@ -55,7 +72,20 @@ namespace AZ
             // validate no one incremented the wait count and mark signalling state
             if (m_waitCount.compare_exchange_strong(expectedValue, -1))
             {
+                // The event may be destroyed as soon as the semaphore is released or the continuation runs, so
+                // fetch the continuation first and don't touch any members afterwards.
+                ContinuationFunction continuation = nullptr;
+                void* continuationData = nullptr;
+                if (m_continuationState.exchange(2, AZStd::memory_order_acq_rel) == 1)
+                {
+                    continuation = m_continuation;
+                    continuationData = m_continuationData;
+                }
                 m_semaphore.release();
+                if (continuation)
+                {
+                    continuation(continuationData);
+                }
             }
         }
     }
@@ -79,6 +79,14 @@ namespace AZ
         bool IsSignaled();
         void Wait();
 
+        using ContinuationFunction = void (*)(void* userData);
+
+        // Register a function to invoke once the event is signaled, as an alternative to blocking in Wait. The function
+        // runs on the thread that signals the event, or immediately on the calling thread if the event was already
+        // signaled. Only a single continuation may be registered. The event isn't accessed after the continuation has
+        // been invoked, so the continuation is allowed to destroy the event.
+        void SetContinuation(ContinuationFunction continuation, void* userData);
+
     private:
         friend class ::AZ::Internal::CompiledTaskGraph;
         friend class TaskGraph;
@@ -90,6 +98,9 @@ namespace AZ
         AZStd::binary_semaphore m_semaphore;
         AZStd::atomic_int       m_waitCount = 0;
         TaskExecutor*           m_executor = nullptr;
+        ContinuationFunction    m_continuation = nullptr;
+        void*                   m_continuationData = nullptr;
+        AZStd::atomic_int       m_continuationState = 0; // 0 = none, 1 = registered, 2 = signaled
         [[maybe_unused]] const char* m_label = nullptr;
     };
 
@@ -8,11 +8,17 @@
 
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Metrics/JsonTraceEventLogger.h>
+#include <AzCore/Metrics/PerfettoTraceEventLogger.h>
 #include <AzCore/Task/TaskGraphSystemComponent.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Threading/ThreadUtils.h>
 
  // PERFORMANCE NOTE & TODO
@@ -27,6 +33,7 @@ AZ_CVAR(float, cl_taskGraphThreadsConcurrencyRatio, 1.0f, nullptr, AZ::ConsoleFu
 AZ_CVAR(uint32_t, cl_taskGraphThreadsNumReserved, 2, nullptr, AZ::ConsoleFunctorFlags::Null, "TaskGraph number of hardware threads that are reserved for O3DE system threads. Value is clamped between 0 and the number of logical cores in the system");
 AZ_CVAR(uint32_t, cl_taskGraphThreadsMinNumber, 2, nullptr, AZ::ConsoleFunctorFlags::Null, "TaskGraph minimum number of worker threads to create after scaling the number of hw threads");
 AZ_CVAR(uint32_t, cl_taskGraphThreadsMaxNumber, 0, nullptr, AZ::ConsoleFunctorFlags::Null, "TaskGraph maximum number of worker threads to create after scaling the number of hw threads (0 indicates uncapped)");
+AZ_CVAR(bool, cl_taskGraphUseJobWorkers, false, nullptr, AZ::ConsoleFunctorFlags::Null, "TaskGraph runs its tasks on the JobManager worker threads instead of creating its own, so tasks and jobs share one pool of threads (read on activation)");
 
 static constexpr uint32_t TaskExecutorServiceCrc = AZ_CRC_CE("TaskExecutorService");
 
@@ -55,7 +62,17 @@ namespace AZ
                 cl_taskGraphThreadsNumReserved);
         #endif // (AZ_TRAIT_THREAD_NUM_TASK_GRAPH_WORKER_THREADS)
             Interface<TaskGraphActiveInterface>::Register(this); // small window that another thread can try to use taskgraph between this line and the set instance.
-            m_taskExecutor = aznew TaskExecutor(numberOfWorkerThreads);
+            JobContext* jobContext = JobContext::GetGlobalContext();
+            AZ_Warning("TaskGraph", !cl_taskGraphUseJobWorkers || jobContext,
+                "cl_taskGraphUseJobWorkers is set but there is no global job context, TaskGraph creates its own worker threads.");
+            if (cl_taskGraphUseJobWorkers && jobContext)
+            {
+                m_taskExecutor = aznew TaskExecutor(*jobContext);
+            }
+            else
+            {
+                m_taskExecutor = aznew TaskExecutor(numberOfWorkerThreads);
+            }
             TaskExecutor::SetInstance(m_taskExecutor);
         }
     }
@@ -87,8 +104,10 @@ namespace AZ
         incompatible.push_back(TaskExecutorServiceCrc);
     }
 
-    void TaskGraphSystemComponent::GetDependentServices([[maybe_unused]] ComponentDescriptor::DependencyArrayType& dependent)
+    void TaskGraphSystemComponent::GetDependentServices(ComponentDescriptor::DependencyArrayType& dependent)
     {
+        // Activate after the job manager so its workers can be used
+        dependent.push_back(AZ_CRC_CE("JobsService"));
     }
 
     void TaskGraphSystemComponent::Reflect(ReflectContext* context)
@@ -110,6 +129,54 @@ namespace AZ
         }
     }
 
+    void TaskGraphSystemComponent::StartTaskTimeline(const AZ::ConsoleCommandContainer&)
+    {
+        if (m_taskExecutor)
+        {
+            m_taskExecutor->StartTimelineRecording();
+            AZ_Printf("TaskGraph", "Started recording the TaskGraph timeline.\n");
+        }
+    }
+
+    void TaskGraphSystemComponent::ExportTaskTimeline(const AZ::ConsoleCommandContainer& someStrings)
+    {
+        if (m_taskExecutor)
+        {
+            if (someStrings.empty())
+            {
+                AZ_Printf("TaskGraph", "ExportTaskTimeline requires the path to the file to store the timeline in.\n");
+                return;
+            }
+            AZ::IO::FixedMaxPath path;
+            if (!AZ::IO::FileIOBase::GetInstance() ||
+                !AZ::IO::FileIOBase::GetInstance()->ResolvePath(path, AZ::IO::PathView(someStrings.front())))
+            {
+                path = someStrings.front();
+            }
+
+            auto stream = AZStd::make_unique<AZ::IO::SystemFileStream>(path.c_str(), AZ::IO::OpenMode::ModeWrite);
+            if (!stream->IsOpen())
+            {
+                AZ_Printf("TaskGraph", "Unable to open '%s' to store the TaskGraph timeline in.\n", path.c_str());
+                return;
+            }
+            // Timelines with the .pftrace extension are written in the binary Perfetto trace format
+            AZStd::unique_ptr<Metrics::IEventLogger> eventLogger;
+            if (path.Extension() == ".pftrace")
+            {
+                eventLogger = AZStd::make_unique<Metrics::PerfettoTraceEventLogger>(AZStd::move(stream), "TaskGraphTimeline");
+            }
+            else
+            {
+                eventLogger = AZStd::make_unique<Metrics::JsonTraceEventLogger>(
+                    AZStd::move(stream), Metrics::JsonTraceEventLoggerConfig{ "TaskGraphTimeline" });
+            }
+            m_taskExecutor->ExportTimeline(*eventLogger);
+            eventLogger->Flush();
+            AZ_Printf("TaskGraph", "Stored the TaskGraph timeline in '%s'.\n", path.c_str());
+        }
+    }
+
     bool TaskGraphSystemComponent::IsTaskGraphActive() const
     {
         return cl_activateTaskGraph;
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/Crc.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
@@ -42,6 +43,14 @@ namespace AZ
         /// \red ComponentDescriptor::Reflect
         static void Reflect(ReflectContext* reflection);
 
+        void StartTaskTimeline(const AZ::ConsoleCommandContainer& someStrings);
+        void ExportTaskTimeline(const AZ::ConsoleCommandContainer& someStrings);
+
+        AZ_CONSOLEFUNC(TaskGraphSystemComponent, StartTaskTimeline, AZ::ConsoleFunctorFlags::Null,
+            "Starts recording the tasks run by the TaskGraph workers and how long the workers are idle");
+        AZ_CONSOLEFUNC(TaskGraphSystemComponent, ExportTaskTimeline, AZ::ConsoleFunctorFlags::Null,
+            "Stops recording the TaskGraph timeline and writes it to the provided file as json trace events, or as a Perfetto trace for .pftrace files");
+
         AZ::TaskExecutor*   m_taskExecutor = nullptr;
     };
 }
@@ -42,6 +42,7 @@ set(FILES
     Component/ComponentBus.cpp
     Component/ComponentBus.h
     Component/ComponentExport.h
+    Component/DenseComponentStorage.h
     Component/Entity.cpp
     Component/Entity.h
     Component/EntityBus.h
@@ -95,6 +96,8 @@ set(FILES
     Debug/Timer.h
     Debug/Trace.cpp
     Debug/Trace.h
+    Debug/TraceAsyncOutput.cpp
+    Debug/TraceAsyncOutput.h
     Debug/TraceMessageBus.h
     Debug/TraceReflection.cpp
     Debug/TraceReflection.h
@@ -141,6 +144,8 @@ set(FILES
     EBus/ScheduledEvent.h
     EBus/ScheduledEventHandle.cpp
     EBus/ScheduledEventHandle.h
+    EBus/ScheduledEventTimingWheel.cpp
+    EBus/ScheduledEventTimingWheel.h
     EBus/Internal/BusContainer.h
     EBus/Internal/CallstackEntry.h
     EBus/Internal/Debug.h
@@ -172,8 +177,11 @@ set(FILES
     IO/IStreamerTypes.h
     IO/IStreamerTypes.inl
     IO/IStreamerTypes.cpp
+    IO/StreamerCoroutine.h
     IO/GenericStreams.cpp
     IO/GenericStreams.h
+    IO/MemoryMappedFile.cpp
+    IO/MemoryMappedFile.h
     IO/OpenMode.h
     IO/OpenMode.cpp
     IO/Path/Path.cpp
@@ -186,9 +194,12 @@ set(FILES
     IO/Path/Path_fwd.h
     IO/SystemFile.cpp
     IO/SystemFile.h
+    IO/TextStreamReaders.h
     IO/TextStreamWriters.h
     IO/Streamer/BlockCache.h
     IO/Streamer/BlockCache.cpp
+    IO/Streamer/SharedBlockCache.h
+    IO/Streamer/SharedBlockCache.cpp
     IO/Streamer/DedicatedCache.h
     IO/Streamer/DedicatedCache.cpp
     IO/Streamer/FileRange.h
@@ -198,6 +209,8 @@ set(FILES
     IO/Streamer/FileRequest.cpp
     IO/Streamer/FullFileDecompressor.h
     IO/Streamer/FullFileDecompressor.cpp
+    IO/Streamer/ReadAhead.h
+    IO/Streamer/ReadAhead.cpp
     IO/Streamer/ReadSplitter.h
     IO/Streamer/ReadSplitter.cpp
     IO/Streamer/RequestPath.h
@@ -216,6 +229,8 @@ set(FILES
     IO/Streamer/StreamerContext.cpp
     IO/Streamer/StreamerComponent.cpp
     IO/Streamer/StreamerComponent.h
+    IO/Streamer/StreamerTrace.h
+    IO/Streamer/StreamerTrace.cpp
     IO/Streamer/StreamStackEntry.h
     IO/Streamer/StreamStackEntry.cpp
     IPC/SharedMemory.cpp
@@ -305,6 +320,8 @@ set(FILES
     Math/Internal/SimdMathVec4_neon.inl
     Math/Internal/SimdMathVec4_scalar.inl
     Math/Internal/SimdMathVec4_sse.inl
+    Math/Internal/SimdMathVec8_avx.inl
+    Math/Internal/SimdMathVec8_vec4.inl
     Math/Internal/SimdMathCommon_neon.inl
     Math/Internal/SimdMathCommon_neonDouble.inl
     Math/Internal/SimdMathCommon_neonQuad.inl
@@ -319,6 +336,8 @@ set(FILES
     Math/IntersectSegment.h
     Math/LineSegment.cpp
     Math/LineSegment.h
+    Math/MathBatch.cpp
+    Math/MathBatch.h
     Math/MathIntrinsics.h
     Math/MathReflection.cpp
     Math/MathReflection.h
@@ -370,6 +389,7 @@ set(FILES
     Math/SimdMathVec2.h
     Math/SimdMathVec3.h
     Math/SimdMathVec4.h
+    Math/SimdMathVec8.h
     Math/Sha1.h
     Math/Spline.cpp
     Math/Spline.h
@@ -419,6 +439,8 @@ set(FILES
     Memory/ChildAllocatorSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameArenaAllocator.cpp
+    Memory/FrameArenaAllocator.h
     Memory/HphaAllocator.cpp
     Memory/HphaAllocator.h
     Memory/IAllocator.h
@@ -442,6 +464,14 @@ set(FILES
     Metrics/EventLoggerUtils.h
     Metrics/JsonTraceEventLogger.h
     Metrics/JsonTraceEventLogger.cpp
+    Metrics/IMetricsRegistry.h
+    Metrics/IMetricsRegistry.cpp
+    Metrics/MetricsExporterSystemComponent.h
+    Metrics/MetricsExporterSystemComponent.cpp
+    Metrics/MetricsRegistryImpl.h
+    Metrics/MetricsRegistryImpl.cpp
+    Metrics/PerfettoTraceEventLogger.h
+    Metrics/PerfettoTraceEventLogger.cpp
     Metrics/IEventLogger.h
     Metrics/IEventLogger.cpp
     Metrics/IEventLogger.inl
@@ -523,6 +553,8 @@ set(FILES
     Script/ScriptContext.h
     Script/ScriptContext.cpp
     Script/ScriptContextAttributes.h
+    Script/ScriptContextPool.h
+    Script/ScriptContextPool.cpp
     Script/ScriptContextDebug.cpp
     Script/ScriptContextDebug.h
     Script/ScriptSystemBus.h
@@ -653,6 +685,7 @@ set(FILES
     Settings/SettingsRegistryOriginTracker.h
     Settings/SettingsRegistryScriptUtils.cpp
     Settings/SettingsRegistryScriptUtils.h
+    Settings/SettingsRegistryValueHandle.h
     Settings/SettingsRegistryVisitorUtils.cpp
     Settings/SettingsRegistryVisitorUtils.h
     Settings/TextParser.cpp
@@ -688,6 +721,8 @@ set(FILES
     Task/Internal/Task.inl
     Task/Internal/Task.h
     Task/Internal/TaskConfig.h
+    Task/ParallelAlgorithms.h
+    Task/TaskCoroutine.h
     Task/TaskDescriptor.h
     Task/TaskExecutor.cpp
     Task/TaskExecutor.h
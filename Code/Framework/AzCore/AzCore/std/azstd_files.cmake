@@ -27,6 +27,7 @@ set(FILES
     createdestroy.h
     docs.h
     exceptions.h
+    execution.h
     functional.h
     functional_basic.h
     hash.cpp
@@ -97,6 +98,10 @@ set(FILES
     containers/fixed_unordered_map.h
     containers/fixed_unordered_set.h
     containers/fixed_vector.h
+    containers/flat_hash_map.h
+    containers/flat_hash_set.h
+    containers/flat_hash_table.h
+    containers/flat_map.h
     containers/forward_list.h
     containers/intrusive_list.h
     containers/intrusive_set.h
@@ -108,6 +113,7 @@ set(FILES
     containers/rbtree.h
     containers/ring_buffer.h
     containers/set.h
+    containers/small_vector.h
     containers/span_fwd.h
     containers/span.h
     containers/span.inl
@@ -154,6 +160,7 @@ set(FILES
     function/function_template.h
     function/identity.h
     function/invoke.h
+    function/move_only_function.h
     smart_ptr/checked_delete.h
     smart_ptr/enable_shared_from_this.h
     smart_ptr/enable_shared_from_this2.h
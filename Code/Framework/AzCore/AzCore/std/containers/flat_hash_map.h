@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/flat_hash_table.h>
+#include <AzCore/std/tuple.h>
+#include <AzCore/std/utility/pair.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+        struct FlatHashMapTraits
+        {
+            using key_type = Key;
+            using key_equal = EqualKey;
+            using hasher = Hasher;
+            using value_type = AZStd::pair<Key, MappedType>;
+            using allocator_type = Allocator;
+
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value) { return value.first; }
+        };
+    }
+
+    /**
+     * Map with unique keys, stored in an open addressing hash table instead of the nodes of \ref unordered_map.
+     * Inserting doesn't allocate unless the table grows and lookups don't chase pointers, which makes it the better choice
+     * for maps that are looked up often. The price is that inserting can move the elements, so pointers, references and
+     * iterators to elements are invalidated by every insertion, and there are no node handles or bucket interfaces.
+     */
+    template<class Key, class MappedType, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_map
+        : public Internal::flat_hash_table<Internal::FlatHashMapTraits<Key, MappedType, Hasher, EqualKey, Allocator>>
+    {
+        using this_type = flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>;
+        using base_type = Internal::flat_hash_table<Internal::FlatHashMapTraits<Key, MappedType, Hasher, EqualKey, Allocator>>;
+
+    public:
+        using traits_type = typename base_type::traits_type;
+
+        using key_type = typename base_type::key_type;
+        using key_equal = typename base_type::key_equal;
+        using hasher = typename base_type::hasher;
+        using mapped_type = MappedType;
+
+        using allocator_type = typename base_type::allocator_type;
+        using size_type = typename base_type::size_type;
+        using difference_type = typename base_type::difference_type;
+        using pointer = typename base_type::pointer;
+        using const_pointer = typename base_type::const_pointer;
+        using reference = typename base_type::reference;
+        using const_reference = typename base_type::const_reference;
+
+        using iterator = typename base_type::iterator;
+        using const_iterator = typename base_type::const_iterator;
+
+        using value_type = typename base_type::value_type;
+        using pair_iter_bool = typename base_type::pair_iter_bool;
+
+        flat_hash_map() = default;
+        explicit flat_hash_map(size_type elementCountHint,
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : base_type(elementCountHint, hash, keyEqual, allocator)
+        {
+        }
+        explicit flat_hash_map(const allocator_type& allocator)
+            : base_type(allocator)
+        {
+        }
+        template<class InputIterator>
+        flat_hash_map(InputIterator first, InputIterator last, size_type elementCountHint = {},
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : base_type(elementCountHint, hash, keyEqual, allocator)
+        {
+            base_type::insert(first, last);
+        }
+        flat_hash_map(initializer_list<value_type> list, size_type elementCountHint = {},
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : base_type(elementCountHint, hash, keyEqual, allocator)
+        {
+            base_type::insert(list);
+        }
+
+        flat_hash_map(const flat_hash_map& rhs) = default;
+        flat_hash_map(flat_hash_map&& rhs) = default;
+        flat_hash_map& operator=(const flat_hash_map& rhs) = default;
+        flat_hash_map& operator=(flat_hash_map&& rhs) = default;
+
+        using base_type::insert;
+
+        template<class... Args>
+        pair_iter_bool try_emplace(const key_type& key, Args&&... args)
+        {
+            return base_type::emplace_with_key(key, AZStd::piecewise_construct, AZStd::forward_as_tuple(key),
+                AZStd::forward_as_tuple(AZStd::forward<Args>(args)...));
+        }
+        template<class... Args>
+        pair_iter_bool try_emplace(key_type&& key, Args&&... args)
+        {
+            // The key is only moved once it is known that it isn't stored yet
+            return base_type::emplace_with_key(key, AZStd::piecewise_construct, AZStd::forward_as_tuple(AZStd::move(key)),
+                AZStd::forward_as_tuple(AZStd::forward<Args>(args)...));
+        }
+
+        template<class M>
+        pair_iter_bool insert_or_assign(const key_type& key, M&& value)
+        {
+            pair_iter_bool result = try_emplace(key, AZStd::forward<M>(value));
+            if (!result.second)
+            {
+                result.first->second = AZStd::forward<M>(value);
+            }
+            return result;
+        }
+        template<class M>
+        pair_iter_bool insert_or_assign(key_type&& key, M&& value)
+        {
+            pair_iter_bool result = try_emplace(AZStd::move(key), AZStd::forward<M>(value));
+            if (!result.second)
+            {
+                result.first->second = AZStd::forward<M>(value);
+            }
+            return result;
+        }
+
+        mapped_type& operator[](const key_type& key)
+        {
+            return try_emplace(key).first->second;
+        }
+        mapped_type& operator[](key_type&& key)
+        {
+            return try_emplace(AZStd::move(key)).first->second;
+        }
+
+        mapped_type& at(const key_type& key)
+        {
+            iterator iter = base_type::find(key);
+            AZ_Assert(iter != base_type::end(), "Element with key is not present");
+            return iter->second;
+        }
+        const mapped_type& at(const key_type& key) const
+        {
+            const_iterator iter = base_type::find(key);
+            AZ_Assert(iter != base_type::end(), "Element with key is not present");
+            return iter->second;
+        }
+    };
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    void swap(flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& left, flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& right)
+    {
+        left.swap(right);
+    }
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    bool operator==(const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& left, const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& right)
+    {
+        if (left.size() != right.size())
+        {
+            return false;
+        }
+        for (const auto& element : left)
+        {
+            auto rightIter = right.find(element.first);
+            if (rightIter == right.end() || !(rightIter->second == element.second))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    bool operator!=(const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& left, const flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& right)
+    {
+        return !(left == right);
+    }
+} // namespace AZStd
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/flat_hash_table.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class Hasher, class EqualKey, class Allocator>
+        struct FlatHashSetTraits
+        {
+            using key_type = Key;
+            using key_equal = EqualKey;
+            using hasher = Hasher;
+            using value_type = Key;
+            using allocator_type = Allocator;
+
+            static AZ_FORCE_INLINE const key_type& key_from_value(const value_type& value) { return value; }
+        };
+    }
+
+    /**
+     * Set with unique keys, stored in an open addressing hash table instead of the nodes of \ref unordered_set.
+     * Has the same trade-offs as \ref flat_hash_map: inserting invalidates pointers and iterators to the elements.
+     */
+    template<class Key, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_set
+        : public Internal::flat_hash_table<Internal::FlatHashSetTraits<Key, Hasher, EqualKey, Allocator>>
+    {
+        using this_type = flat_hash_set<Key, Hasher, EqualKey, Allocator>;
+        using base_type = Internal::flat_hash_table<Internal::FlatHashSetTraits<Key, Hasher, EqualKey, Allocator>>;
+
+    public:
+        using traits_type = typename base_type::traits_type;
+
+        using key_type = typename base_type::key_type;
+        using key_equal = typename base_type::key_equal;
+        using hasher = typename base_type::hasher;
+
+        using allocator_type = typename base_type::allocator_type;
+        using size_type = typename base_type::size_type;
+        using difference_type = typename base_type::difference_type;
+        using pointer = typename base_type::pointer;
+        using const_pointer = typename base_type::const_pointer;
+        using reference = typename base_type::reference;
+        using const_reference = typename base_type::const_reference;
+
+        using iterator = typename base_type::iterator;
+        using const_iterator = typename base_type::const_iterator;
+
+        using value_type = typename base_type::value_type;
+        using pair_iter_bool = typename base_type::pair_iter_bool;
+
+        flat_hash_set() = default;
+        explicit flat_hash_set(size_type elementCountHint,
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : base_type(elementCountHint, hash, keyEqual, allocator)
+        {
+        }
+        explicit flat_hash_set(const allocator_type& allocator)
+            : base_type(allocator)
+        {
+        }
+        template<class InputIterator>
+        flat_hash_set(InputIterator first, InputIterator last, size_type elementCountHint = {},
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : base_type(elementCountHint, hash, keyEqual, allocator)
+        {
+            base_type::insert(first, last);
+        }
+        flat_hash_set(initializer_list<value_type> list, size_type elementCountHint = {},
+            const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : base_type(elementCountHint, hash, keyEqual, allocator)
+        {
+            base_type::insert(list);
+        }
+
+        flat_hash_set(const flat_hash_set& rhs) = default;
+        flat_hash_set(flat_hash_set&& rhs) = default;
+        flat_hash_set& operator=(const flat_hash_set& rhs) = default;
+        flat_hash_set& operator=(flat_hash_set&& rhs) = default;
+    };
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    void swap(flat_hash_set<Key, Hasher, EqualKey, Allocator>& left, flat_hash_set<Key, Hasher, EqualKey, Allocator>& right)
+    {
+        left.swap(right);
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    bool operator==(const flat_hash_set<Key, Hasher, EqualKey, Allocator>& left, const flat_hash_set<Key, Hasher, EqualKey, Allocator>& right)
+    {
+        if (left.size() != right.size())
+        {
+            return false;
+        }
+        for (const Key& element : left)
+        {
+            if (!right.contains(element))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    bool operator!=(const flat_hash_set<Key, Hasher, EqualKey, Allocator>& left, const flat_hash_set<Key, Hasher, EqualKey, Allocator>& right)
+    {
+        return !(left == right);
+    }
+} // namespace AZStd
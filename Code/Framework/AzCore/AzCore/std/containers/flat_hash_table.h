@@ -0,0 +1,684 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/utils.h>
+#include <AzCore/std/typetraits/conditional.h>
+#include <AzCore/std/typetraits/is_destructible.h>
+
+#include <new>
+#include <string.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        /**
+         * Control byte of a slot in a flat hash table. A full slot stores the 7 lowest bits of the hash of its key,
+         * empty and deleted slots have the high bit set.
+         */
+        using flat_hash_ctrl = AZ::s8;
+        inline constexpr flat_hash_ctrl FlatHashCtrlEmpty = -128;
+        inline constexpr flat_hash_ctrl FlatHashCtrlDeleted = -2;
+
+        /**
+         * Group of consecutive control bytes which are tested at once with 64 bit integer operations.
+         * Every mask returned has the high bit set of each byte that matched.
+         */
+        struct flat_hash_group
+        {
+            static constexpr size_t width = 8;
+            static constexpr AZ::u64 lsbs = 0x0101010101010101ull;
+            static constexpr AZ::u64 msbs = 0x8080808080808080ull;
+
+            explicit flat_hash_group(const flat_hash_ctrl* ctrl)
+            {
+                memcpy(&m_ctrl, ctrl, sizeof(m_ctrl));
+            }
+
+            //! Returns the slots that might store the hash. A false positive can only follow a real match, and the keys are compared anyway.
+            AZ::u64 match(flat_hash_ctrl h2) const
+            {
+                const AZ::u64 x = m_ctrl ^ (lsbs * static_cast<AZ::u8>(h2));
+                return (x - lsbs) & ~x & msbs;
+            }
+
+            AZ::u64 match_empty() const
+            {
+                return (m_ctrl & (~m_ctrl << 6)) & msbs;
+            }
+
+            AZ::u64 match_empty_or_deleted() const
+            {
+                return (m_ctrl & ~(m_ctrl << 7)) & msbs;
+            }
+
+            static size_t lowest_index(AZ::u64 mask)
+            {
+                return static_cast<size_t>(az_ctz_u64(mask)) >> 3;
+            }
+
+            static AZ::u64 clear_lowest(AZ::u64 mask)
+            {
+                return mask & (mask - 1);
+            }
+
+            AZ::u64 m_ctrl;
+        };
+
+        /**
+         * Open addressing hash table that stores its elements in a single array of slots, with an array of control bytes next to it.
+         * Lookups probe the control bytes a group at a time and only compare the keys of slots whose control byte matches
+         * 7 bits of the hash, so most lookups touch one cache line of control bytes and one slot.
+         * Unlike \ref hash_table, inserting can move the elements, so pointers and iterators are invalidated on insertion.
+         * Erasing only invalidates the iterators of the erased elements.
+         *
+         * Traits must define key_type, value_type, hasher, key_equal, allocator_type and a static key_from_value function.
+         */
+        template<class Traits>
+        class flat_hash_table
+        {
+            using this_type = flat_hash_table<Traits>;
+
+        public:
+            using traits_type = Traits;
+
+            using key_type = typename Traits::key_type;
+            using key_equal = typename Traits::key_equal;
+            using hasher = typename Traits::hasher;
+            using allocator_type = typename Traits::allocator_type;
+
+            using value_type = typename Traits::value_type;
+            using pointer = value_type*;
+            using const_pointer = const value_type*;
+            using reference = value_type&;
+            using const_reference = const value_type&;
+            using size_type = AZStd::size_t;
+            using difference_type = AZStd::ptrdiff_t;
+
+            template<bool IsConst>
+            class iterator_impl
+            {
+                friend class flat_hash_table;
+                template<bool>
+                friend class iterator_impl;
+
+            public:
+                using iterator_category = AZStd::forward_iterator_tag;
+                using value_type = typename flat_hash_table::value_type;
+                using difference_type = AZStd::ptrdiff_t;
+                using pointer = AZStd::conditional_t<IsConst, const value_type*, value_type*>;
+                using reference = AZStd::conditional_t<IsConst, const value_type&, value_type&>;
+
+                iterator_impl() = default;
+
+                template<bool WasConst, class = AZStd::enable_if_t<IsConst && !WasConst>>
+                iterator_impl(const iterator_impl<WasConst>& rhs)
+                    : m_ctrl(rhs.m_ctrl)
+                    , m_ctrlEnd(rhs.m_ctrlEnd)
+                    , m_slot(rhs.m_slot)
+                {
+                }
+
+                reference operator*() const
+                {
+                    return *m_slot;
+                }
+                pointer operator->() const
+                {
+                    return m_slot;
+                }
+
+                iterator_impl& operator++()
+                {
+                    ++m_ctrl;
+                    ++m_slot;
+                    skip_empty_slots();
+                    return *this;
+                }
+                iterator_impl operator++(int)
+                {
+                    iterator_impl result = *this;
+                    ++(*this);
+                    return result;
+                }
+
+                friend bool operator==(const iterator_impl& lhs, const iterator_impl& rhs)
+                {
+                    return lhs.m_ctrl == rhs.m_ctrl;
+                }
+                friend bool operator!=(const iterator_impl& lhs, const iterator_impl& rhs)
+                {
+                    return lhs.m_ctrl != rhs.m_ctrl;
+                }
+
+            private:
+                iterator_impl(const flat_hash_ctrl* ctrl, const flat_hash_ctrl* ctrlEnd, value_type* slot)
+                    : m_ctrl(ctrl)
+                    , m_ctrlEnd(ctrlEnd)
+                    , m_slot(slot)
+                {
+                }
+
+                void skip_empty_slots()
+                {
+                    while (m_ctrl != m_ctrlEnd && *m_ctrl < 0)
+                    {
+                        ++m_ctrl;
+                        ++m_slot;
+                    }
+                }
+
+                const flat_hash_ctrl* m_ctrl = nullptr;
+                const flat_hash_ctrl* m_ctrlEnd = nullptr;
+                value_type* m_slot = nullptr;
+            };
+
+            using iterator = iterator_impl<false>;
+            using const_iterator = iterator_impl<true>;
+            using pair_iter_bool = AZStd::pair<iterator, bool>;
+
+            flat_hash_table() = default;
+
+            explicit flat_hash_table(const allocator_type& allocator)
+                : m_allocator(allocator)
+            {
+            }
+
+            flat_hash_table(size_type elementCount, const hasher& hash, const key_equal& keyEqual, const allocator_type& allocator)
+                : m_hasher(hash)
+                , m_keyEqual(keyEqual)
+                , m_allocator(allocator)
+            {
+                reserve(elementCount);
+            }
+
+            flat_hash_table(const this_type& rhs)
+                : m_hasher(rhs.m_hasher)
+                , m_keyEqual(rhs.m_keyEqual)
+                , m_allocator(rhs.m_allocator)
+            {
+                reserve(rhs.m_size);
+                for (const value_type& value : rhs)
+                {
+                    insert_unique(value);
+                }
+            }
+
+            flat_hash_table(this_type&& rhs)
+                : m_hasher(AZStd::move(rhs.m_hasher))
+                , m_keyEqual(AZStd::move(rhs.m_keyEqual))
+                , m_allocator(AZStd::move(rhs.m_allocator))
+            {
+                steal(rhs);
+            }
+
+            ~flat_hash_table()
+            {
+                destroy_elements();
+                deallocate_storage();
+            }
+
+            this_type& operator=(const this_type& rhs)
+            {
+                if (this != &rhs)
+                {
+                    clear();
+                    m_hasher = rhs.m_hasher;
+                    m_keyEqual = rhs.m_keyEqual;
+                    reserve(rhs.m_size);
+                    for (const value_type& value : rhs)
+                    {
+                        insert_unique(value);
+                    }
+                }
+                return *this;
+            }
+
+            this_type& operator=(this_type&& rhs)
+            {
+                if (this != &rhs)
+                {
+                    destroy_elements();
+                    deallocate_storage();
+                    m_hasher = AZStd::move(rhs.m_hasher);
+                    m_keyEqual = AZStd::move(rhs.m_keyEqual);
+                    m_allocator = AZStd::move(rhs.m_allocator);
+                    steal(rhs);
+                }
+                return *this;
+            }
+
+            iterator begin()
+            {
+                iterator result(m_ctrl, m_ctrl + m_capacity, m_slots);
+                result.skip_empty_slots();
+                return result;
+            }
+            const_iterator begin() const
+            {
+                return const_cast<this_type*>(this)->begin();
+            }
+            const_iterator cbegin() const
+            {
+                return begin();
+            }
+            iterator end()
+            {
+                return iterator(m_ctrl + m_capacity, m_ctrl + m_capacity, m_slots + m_capacity);
+            }
+            const_iterator end() const
+            {
+                return const_cast<this_type*>(this)->end();
+            }
+            const_iterator cend() const
+            {
+                return end();
+            }
+
+            bool empty() const
+            {
+                return m_size == 0;
+            }
+            size_type size() const
+            {
+                return m_size;
+            }
+            size_type max_size() const
+            {
+                return m_allocator.max_size() / (sizeof(value_type) + 1);
+            }
+            //! Number of slots, including the ones that have to stay empty because of the maximum load factor.
+            size_type bucket_count() const
+            {
+                return m_capacity;
+            }
+            float load_factor() const
+            {
+                return m_capacity != 0 ? static_cast<float>(m_size) / static_cast<float>(m_capacity) : 0.0f;
+            }
+            float max_load_factor() const
+            {
+                return 7.0f / 8.0f;
+            }
+
+            hasher hash_function() const
+            {
+                return m_hasher;
+            }
+            key_equal key_eq() const
+            {
+                return m_keyEqual;
+            }
+            allocator_type& get_allocator()
+            {
+                return m_allocator;
+            }
+            const allocator_type& get_allocator() const
+            {
+                return m_allocator;
+            }
+
+            //! Destroys all elements and keeps the slots, so the table can be filled again without allocating.
+            void clear()
+            {
+                destroy_elements();
+                if (m_capacity != 0)
+                {
+                    memset(m_ctrl, FlatHashCtrlEmpty, m_capacity + flat_hash_group::width);
+                }
+                m_size = 0;
+                m_growthLeft = max_load(m_capacity);
+            }
+
+            //! Makes room for the number of elements, so they can be inserted without rehashing.
+            void reserve(size_type elementCount)
+            {
+                if (elementCount > max_load(m_capacity))
+                {
+                    size_type capacity = flat_hash_group::width;
+                    while (max_load(capacity) < elementCount)
+                    {
+                        capacity *= 2;
+                    }
+                    rehash_to(capacity);
+                }
+            }
+
+            void swap(this_type& rhs)
+            {
+                if (this != &rhs)
+                {
+                    AZStd::swap(m_ctrl, rhs.m_ctrl);
+                    AZStd::swap(m_slots, rhs.m_slots);
+                    AZStd::swap(m_capacity, rhs.m_capacity);
+                    AZStd::swap(m_size, rhs.m_size);
+                    AZStd::swap(m_growthLeft, rhs.m_growthLeft);
+                    AZStd::swap(m_hasher, rhs.m_hasher);
+                    AZStd::swap(m_keyEqual, rhs.m_keyEqual);
+                    AZStd::swap(m_allocator, rhs.m_allocator);
+                }
+            }
+
+            iterator find(const key_type& key)
+            {
+                const size_type index = find_index(key, mix_hash(m_hasher(key)));
+                return index != npos ? iterator_at(index) : end();
+            }
+            const_iterator find(const key_type& key) const
+            {
+                return const_cast<this_type*>(this)->find(key);
+            }
+            bool contains(const key_type& key) const
+            {
+                return find_index(key, mix_hash(m_hasher(key))) != npos;
+            }
+            size_type count(const key_type& key) const
+            {
+                return contains(key) ? 1 : 0;
+            }
+
+            pair_iter_bool insert(const value_type& value)
+            {
+                return emplace_with_key(Traits::key_from_value(value), value);
+            }
+            pair_iter_bool insert(value_type&& value)
+            {
+                return emplace_with_key(Traits::key_from_value(value), AZStd::move(value));
+            }
+            template<class InputIterator>
+            void insert(InputIterator first, InputIterator last)
+            {
+                for (; first != last; ++first)
+                {
+                    insert(*first);
+                }
+            }
+            void insert(AZStd::initializer_list<value_type> list)
+            {
+                reserve(m_size + list.size());
+                insert(list.begin(), list.end());
+            }
+
+            //! Constructs the element before looking it up, use the key based functions of the containers to avoid that.
+            template<class... Args>
+            pair_iter_bool emplace(Args&&... args)
+            {
+                value_type value(AZStd::forward<Args>(args)...);
+                return emplace_with_key(Traits::key_from_value(value), AZStd::move(value));
+            }
+
+            iterator erase(const_iterator erasePos)
+            {
+                const size_type index = static_cast<size_type>(erasePos.m_slot - m_slots);
+                AZ_Assert(index < m_capacity && m_ctrl[index] >= 0, "Erasing an invalid iterator");
+                m_slots[index].~value_type();
+                // Other keys might have probed past this slot while it was full, so it can't be marked empty
+                set_ctrl(index, FlatHashCtrlDeleted);
+                --m_size;
+                iterator next(m_ctrl + index + 1, m_ctrl + m_capacity, m_slots + index + 1);
+                next.skip_empty_slots();
+                return next;
+            }
+            iterator erase(const_iterator first, const_iterator last)
+            {
+                while (first != last)
+                {
+                    first = erase(first);
+                }
+                return iterator(last.m_ctrl, last.m_ctrlEnd, last.m_slot);
+            }
+            size_type erase(const key_type& key)
+            {
+                const size_type index = find_index(key, mix_hash(m_hasher(key)));
+                if (index == npos)
+                {
+                    return 0;
+                }
+                erase(const_iterator(iterator_at(index)));
+                return 1;
+            }
+
+        protected:
+            //! Looks the key up and only constructs the element from the arguments if the key isn't stored yet.
+            template<class... Args>
+            pair_iter_bool emplace_with_key(const key_type& key, Args&&... args)
+            {
+                const AZ::u64 mixedHash = mix_hash(m_hasher(key));
+                size_type index = find_index(key, mixedHash);
+                if (index != npos)
+                {
+                    return { iterator_at(index), false };
+                }
+                index = prepare_insert(mixedHash);
+                ::new (static_cast<void*>(m_slots + index)) value_type(AZStd::forward<Args>(args)...);
+                return { iterator_at(index), true };
+            }
+
+        private:
+            static constexpr size_type npos = static_cast<size_type>(-1);
+
+            //! The hashers of AZStd return integers unchanged, so the bits are mixed before splitting them in probe position and tag.
+            static AZ::u64 mix_hash(size_t hash)
+            {
+                const AZ::u64 product = static_cast<AZ::u64>(hash) * 0x9E3779B97F4A7C15ull;
+                return product ^ (product >> 32);
+            }
+            static size_type h1(AZ::u64 mixedHash)
+            {
+                return static_cast<size_type>(mixedHash >> 7);
+            }
+            static flat_hash_ctrl h2(AZ::u64 mixedHash)
+            {
+                return static_cast<flat_hash_ctrl>(mixedHash & 0x7F);
+            }
+
+            //! Keeps at least one eighth of the slots empty, so every probe sequence ends on an empty slot.
+            static size_type max_load(size_type capacity)
+            {
+                return capacity - capacity / 8;
+            }
+
+            static size_type storage_ctrl_size(size_type capacity)
+            {
+                // The first group of control bytes is cloned after the last slot, so a group can be loaded at any slot
+                const size_type ctrlSize = capacity + flat_hash_group::width;
+                return (ctrlSize + alignof(value_type) - 1) & ~(alignof(value_type) - 1);
+            }
+            static size_type storage_size(size_type capacity)
+            {
+                return storage_ctrl_size(capacity) + capacity * sizeof(value_type);
+            }
+            static constexpr size_type storage_alignment()
+            {
+                return alignof(value_type) > alignof(AZ::u64) ? alignof(value_type) : alignof(AZ::u64);
+            }
+
+            iterator iterator_at(size_type index)
+            {
+                return iterator(m_ctrl + index, m_ctrl + m_capacity, m_slots + index);
+            }
+
+            void set_ctrl(size_type index, flat_hash_ctrl ctrl)
+            {
+                m_ctrl[index] = ctrl;
+                if (index < flat_hash_group::width)
+                {
+                    m_ctrl[m_capacity + index] = ctrl;
+                }
+            }
+
+            //! Probes the groups with triangular steps, which visits every group once as the capacity is a power of two.
+            size_type find_index(const key_type& key, AZ::u64 mixedHash) const
+            {
+                if (m_capacity == 0)
+                {
+                    return npos;
+                }
+                const size_type mask = m_capacity - 1;
+                const flat_hash_ctrl tag = h2(mixedHash);
+                size_type offset = h1(mixedHash) & mask;
+                for (size_type step = flat_hash_group::width;; step += flat_hash_group::width)
+                {
+                    const flat_hash_group group(m_ctrl + offset);
+                    for (AZ::u64 match = group.match(tag); match != 0; match = flat_hash_group::clear_lowest(match))
+                    {
+                        const size_type index = (offset + flat_hash_group::lowest_index(match)) & mask;
+                        if (m_keyEqual(Traits::key_from_value(m_slots[index]), key))
+                        {
+                            return index;
+                        }
+                    }
+                    if (group.match_empty() != 0)
+                    {
+                        return npos;
+                    }
+                    offset = (offset + step) & mask;
+                }
+            }
+
+            size_type find_first_non_full(AZ::u64 mixedHash) const
+            {
+                const size_type mask = m_capacity - 1;
+                size_type offset = h1(mixedHash) & mask;
+                for (size_type step = flat_hash_group::width;; step += flat_hash_group::width)
+                {
+                    const AZ::u64 available = flat_hash_group(m_ctrl + offset).match_empty_or_deleted();
+                    if (available != 0)
+                    {
+                        return (offset + flat_hash_group::lowest_index(available)) & mask;
+                    }
+                    offset = (offset + step) & mask;
+                }
+            }
+
+            size_type prepare_insert(AZ::u64 mixedHash)
+            {
+                size_type index = m_capacity != 0 ? find_first_non_full(mixedHash) : 0;
+                // Reusing a deleted slot doesn't reduce the number of empty slots, so it never needs a rehash
+                if (m_capacity == 0 || (m_growthLeft == 0 && m_ctrl[index] != FlatHashCtrlDeleted))
+                {
+                    // Tables that mostly filled up with deleted slots are cleaned up in place instead of growing
+                    if (m_capacity == 0)
+                    {
+                        rehash_to(flat_hash_group::width);
+                    }
+                    else
+                    {
+                        rehash_to(m_size <= max_load(m_capacity) / 2 ? m_capacity : m_capacity * 2);
+                    }
+                    index = find_first_non_full(mixedHash);
+                }
+                if (m_ctrl[index] == FlatHashCtrlEmpty)
+                {
+                    --m_growthLeft;
+                }
+                set_ctrl(index, h2(mixedHash));
+                ++m_size;
+                return index;
+            }
+
+            void rehash_to(size_type capacity)
+            {
+                AZ_Assert((capacity & (capacity - 1)) == 0 && capacity >= flat_hash_group::width, "Flat hash table capacity must be a power of two");
+                flat_hash_ctrl* oldCtrl = m_ctrl;
+                value_type* oldSlots = m_slots;
+                const size_type oldCapacity = m_capacity;
+
+                void* storage = m_allocator.allocate(storage_size(capacity), storage_alignment());
+                AZ_Assert(storage, "Failed to allocate %zu bytes for a flat hash table", storage_size(capacity));
+                m_ctrl = static_cast<flat_hash_ctrl*>(storage);
+                m_slots = reinterpret_cast<value_type*>(static_cast<char*>(storage) + storage_ctrl_size(capacity));
+                m_capacity = capacity;
+                memset(m_ctrl, FlatHashCtrlEmpty, capacity + flat_hash_group::width);
+
+                for (size_type oldIndex = 0; oldIndex < oldCapacity; ++oldIndex)
+                {
+                    if (oldCtrl[oldIndex] >= 0)
+                    {
+                        value_type& value = oldSlots[oldIndex];
+                        const AZ::u64 mixedHash = mix_hash(m_hasher(Traits::key_from_value(value)));
+                        const size_type index = find_first_non_full(mixedHash);
+                        set_ctrl(index, h2(mixedHash));
+                        ::new (static_cast<void*>(m_slots + index)) value_type(AZStd::move(value));
+                        value.~value_type();
+                    }
+                }
+                m_growthLeft = max_load(capacity) - m_size;
+
+                if (oldCtrl)
+                {
+                    m_allocator.deallocate(oldCtrl, storage_size(oldCapacity), storage_alignment());
+                }
+            }
+
+            void insert_unique(const value_type& value)
+            {
+                const size_type index = prepare_insert(mix_hash(m_hasher(Traits::key_from_value(value))));
+                ::new (static_cast<void*>(m_slots + index)) value_type(value);
+            }
+
+            void destroy_elements()
+            {
+                if constexpr (!AZStd::is_trivially_destructible_v<value_type>)
+                {
+                    for (size_type index = 0; index < m_capacity; ++index)
+                    {
+                        if (m_ctrl[index] >= 0)
+                        {
+                            m_slots[index].~value_type();
+                        }
+                    }
+                }
+            }
+
+            void deallocate_storage()
+            {
+                if (m_ctrl)
+                {
+                    m_allocator.deallocate(m_ctrl, storage_size(m_capacity), storage_alignment());
+                }
+                m_ctrl = nullptr;
+                m_slots = nullptr;
+                m_capacity = 0;
+                m_size = 0;
+                m_growthLeft = 0;
+            }
+
+            void steal(this_type& rhs)
+            {
+                m_ctrl = rhs.m_ctrl;
+                m_slots = rhs.m_slots;
+                m_capacity = rhs.m_capacity;
+                m_size = rhs.m_size;
+                m_growthLeft = rhs.m_growthLeft;
+                rhs.m_ctrl = nullptr;
+                rhs.m_slots = nullptr;
+                rhs.m_capacity = 0;
+                rhs.m_size = 0;
+                rhs.m_growthLeft = 0;
+            }
+
+            flat_hash_ctrl* m_ctrl = nullptr;
+            value_type* m_slots = nullptr;
+            size_type m_capacity = 0;
+            size_type m_size = 0;
+            //! Number of empty slots that can still be filled before the table has to rehash
+            size_type m_growthLeft = 0;
+            hasher m_hasher;
+            key_equal m_keyEqual;
+            allocator_type m_allocator;
+        };
+    } // namespace Internal
+} // namespace AZStd
@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/tuple.h>
+#include <AzCore/std/utility/pair.h>
+
+namespace AZStd
+{
+    /**
+     * Map with unique keys, stored as a vector of pairs sorted by key. Lookups are binary searches over contiguous memory
+     * and iterating is as fast as iterating a vector, while inserting and erasing move the elements after the position.
+     * This makes it a good fit for small maps, and for maps that are built once and then mostly looked up.
+     * Like with a vector, inserting and erasing invalidate pointers and iterators to the elements.
+     */
+    template<class Key, class MappedType, class Compare = AZStd::less<Key>, class Allocator = AZStd::allocator>
+    class flat_map
+    {
+        using this_type = flat_map<Key, MappedType, Compare, Allocator>;
+
+    public:
+        using key_type = Key;
+        using mapped_type = MappedType;
+        using value_type = AZStd::pair<Key, MappedType>;
+        using key_compare = Compare;
+        using allocator_type = Allocator;
+        using container_type = AZStd::vector<value_type, Allocator>;
+
+        using size_type = typename container_type::size_type;
+        using difference_type = typename container_type::difference_type;
+        using pointer = typename container_type::pointer;
+        using const_pointer = typename container_type::const_pointer;
+        using reference = typename container_type::reference;
+        using const_reference = typename container_type::const_reference;
+
+        using iterator = typename container_type::iterator;
+        using const_iterator = typename container_type::const_iterator;
+        using pair_iter_bool = AZStd::pair<iterator, bool>;
+
+        flat_map() = default;
+        explicit flat_map(const key_compare& compare, const allocator_type& allocator = allocator_type())
+            : m_container(allocator)
+            , m_compare(compare)
+        {
+        }
+        explicit flat_map(const allocator_type& allocator)
+            : m_container(allocator)
+        {
+        }
+        template<class InputIterator>
+        flat_map(InputIterator first, InputIterator last, const key_compare& compare = key_compare(),
+            const allocator_type& allocator = allocator_type())
+            : m_container(allocator)
+            , m_compare(compare)
+        {
+            insert(first, last);
+        }
+        flat_map(initializer_list<value_type> list, const key_compare& compare = key_compare(),
+            const allocator_type& allocator = allocator_type())
+            : m_container(allocator)
+            , m_compare(compare)
+        {
+            insert(list);
+        }
+
+        iterator begin() { return m_container.begin(); }
+        const_iterator begin() const { return m_container.begin(); }
+        const_iterator cbegin() const { return m_container.begin(); }
+        iterator end() { return m_container.end(); }
+        const_iterator end() const { return m_container.end(); }
+        const_iterator cend() const { return m_container.end(); }
+
+        bool empty() const { return m_container.empty(); }
+        size_type size() const { return m_container.size(); }
+        size_type max_size() const { return m_container.max_size(); }
+        size_type capacity() const { return m_container.capacity(); }
+        void reserve(size_type elementCount) { m_container.reserve(elementCount); }
+        void shrink_to_fit() { m_container.shrink_to_fit(); }
+        void clear() { m_container.clear(); }
+
+        key_compare key_comp() const { return m_compare; }
+        allocator_type& get_allocator() { return m_container.get_allocator(); }
+        const allocator_type& get_allocator() const { return m_container.get_allocator(); }
+
+        //! Returns the sorted elements, for algorithms that work on contiguous ranges.
+        const container_type& values() const { return m_container; }
+
+        iterator lower_bound(const key_type& key)
+        {
+            return AZStd::lower_bound(m_container.begin(), m_container.end(), key, KeyCompare{ m_compare });
+        }
+        const_iterator lower_bound(const key_type& key) const
+        {
+            return AZStd::lower_bound(m_container.begin(), m_container.end(), key, KeyCompare{ m_compare });
+        }
+        iterator upper_bound(const key_type& key)
+        {
+            return AZStd::upper_bound(m_container.begin(), m_container.end(), key, KeyCompare{ m_compare });
+        }
+        const_iterator upper_bound(const key_type& key) const
+        {
+            return AZStd::upper_bound(m_container.begin(), m_container.end(), key, KeyCompare{ m_compare });
+        }
+
+        iterator find(const key_type& key)
+        {
+            iterator iter = lower_bound(key);
+            return iter != m_container.end() && !m_compare(key, iter->first) ? iter : m_container.end();
+        }
+        const_iterator find(const key_type& key) const
+        {
+            const_iterator iter = lower_bound(key);
+            return iter != m_container.end() && !m_compare(key, iter->first) ? iter : m_container.end();
+        }
+        bool contains(const key_type& key) const
+        {
+            return find(key) != m_container.end();
+        }
+        size_type count(const key_type& key) const
+        {
+            return contains(key) ? 1 : 0;
+        }
+
+        pair_iter_bool insert(const value_type& value)
+        {
+            return try_emplace(value.first, value.second);
+        }
+        pair_iter_bool insert(value_type&& value)
+        {
+            return try_emplace(AZStd::move(value.first), AZStd::move(value.second));
+        }
+        //! Appending keys in ascending order only costs a comparison per element, as every element goes to the end.
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last)
+        {
+            for (; first != last; ++first)
+            {
+                insert(*first);
+            }
+        }
+        void insert(initializer_list<value_type> list)
+        {
+            m_container.reserve(m_container.size() + list.size());
+            insert(list.begin(), list.end());
+        }
+
+        template<class... Args>
+        pair_iter_bool emplace(Args&&... args)
+        {
+            value_type value(AZStd::forward<Args>(args)...);
+            return insert(AZStd::move(value));
+        }
+
+        template<class... Args>
+        pair_iter_bool try_emplace(const key_type& key, Args&&... args)
+        {
+            iterator iter = insert_position(key);
+            if (iter != m_container.end() && !m_compare(key, iter->first))
+            {
+                return { iter, false };
+            }
+            iter = m_container.emplace(iter, AZStd::piecewise_construct, AZStd::forward_as_tuple(key),
+                AZStd::forward_as_tuple(AZStd::forward<Args>(args)...));
+            return { iter, true };
+        }
+        template<class... Args>
+        pair_iter_bool try_emplace(key_type&& key, Args&&... args)
+        {
+            iterator iter = insert_position(key);
+            if (iter != m_container.end() && !m_compare(key, iter->first))
+            {
+                return { iter, false };
+            }
+            iter = m_container.emplace(iter, AZStd::piecewise_construct, AZStd::forward_as_tuple(AZStd::move(key)),
+                AZStd::forward_as_tuple(AZStd::forward<Args>(args)...));
+            return { iter, true };
+        }
+
+        template<class M>
+        pair_iter_bool insert_or_assign(const key_type& key, M&& value)
+        {
+            pair_iter_bool result = try_emplace(key, AZStd::forward<M>(value));
+            if (!result.second)
+            {
+                result.first->second = AZStd::forward<M>(value);
+            }
+            return result;
+        }
+
+        mapped_type& operator[](const key_type& key)
+        {
+            return try_emplace(key).first->second;
+        }
+        mapped_type& operator[](key_type&& key)
+        {
+            return try_emplace(AZStd::move(key)).first->second;
+        }
+
+        mapped_type& at(const key_type& key)
+        {
+            iterator iter = find(key);
+            AZ_Assert(iter != m_container.end(), "Element with key is not present");
+            return iter->second;
+        }
+        const mapped_type& at(const key_type& key) const
+        {
+            const_iterator iter = find(key);
+            AZ_Assert(iter != m_container.end(), "Element with key is not present");
+            return iter->second;
+        }
+
+        iterator erase(const_iterator erasePos)
+        {
+            return m_container.erase(erasePos);
+        }
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            return m_container.erase(first, last);
+        }
+        size_type erase(const key_type& key)
+        {
+            iterator iter = find(key);
+            if (iter == m_container.end())
+            {
+                return 0;
+            }
+            m_container.erase(iter);
+            return 1;
+        }
+
+        void swap(this_type& rhs)
+        {
+            m_container.swap(rhs.m_container);
+            AZStd::swap(m_compare, rhs.m_compare);
+        }
+
+        friend bool operator==(const this_type& left, const this_type& right)
+        {
+            return left.m_container == right.m_container;
+        }
+        friend bool operator!=(const this_type& left, const this_type& right)
+        {
+            return !(left == right);
+        }
+
+    private:
+        struct KeyCompare
+        {
+            bool operator()(const value_type& value, const key_type& key) const { return m_compare(value.first, key); }
+            bool operator()(const key_type& key, const value_type& value) const { return m_compare(key, value.first); }
+
+            const key_compare& m_compare;
+        };
+
+        //! Checks the end first, so appending in order doesn't need a binary search.
+        iterator insert_position(const key_type& key)
+        {
+            if (m_container.empty() || m_compare(m_container.back().first, key))
+            {
+                return m_container.end();
+            }
+            return lower_bound(key);
+        }
+
+        container_type m_container;
+        key_compare m_compare;
+    };
+
+    template<class Key, class MappedType, class Compare, class Allocator>
+    void swap(flat_map<Key, MappedType, Compare, Allocator>& left, flat_map<Key, MappedType, Compare, Allocator>& right)
+    {
+        left.swap(right);
+    }
+} // namespace AZStd
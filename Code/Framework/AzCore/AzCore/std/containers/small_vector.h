@@ -0,0 +1,461 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/createdestroy.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/utils.h>
+#include <AzCore/std/typetraits/is_destructible.h>
+#include <AzCore/std/typetraits/is_integral.h>
+
+#include <new>
+
+namespace AZStd
+{
+    /**
+     * Vector that stores up to InlineCapacity elements inside the object, and moves them to memory from the allocator
+     * once it grows past that. Unlike \ref fixed_vector it never runs out of room, and unlike \ref vector a small vector
+     * doesn't allocate at all, which makes it a good fit for short lists that are built and thrown away every frame.
+     * Moving a small vector that uses its inline storage moves the elements one by one, so iterators are invalidated by moves.
+     */
+    template<class T, AZStd::size_t InlineCapacity, class Allocator = AZStd::allocator>
+    class small_vector
+    {
+        using this_type = small_vector<T, InlineCapacity, Allocator>;
+
+        static_assert(InlineCapacity > 0, "small_vector needs room for at least one inline element, use vector otherwise");
+
+    public:
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = const T*;
+        using reference = T&;
+        using const_reference = const T&;
+        using size_type = AZStd::size_t;
+        using difference_type = AZStd::ptrdiff_t;
+        using allocator_type = Allocator;
+
+        using iterator = T*;
+        using const_iterator = const T*;
+        using reverse_iterator = AZStd::reverse_iterator<iterator>;
+        using const_reverse_iterator = AZStd::reverse_iterator<const_iterator>;
+
+        small_vector() = default;
+
+        explicit small_vector(const allocator_type& allocator)
+            : m_allocator(allocator)
+        {
+        }
+
+        explicit small_vector(size_type count, const_reference value = value_type(), const allocator_type& allocator = allocator_type())
+            : m_allocator(allocator)
+        {
+            assign(count, value);
+        }
+
+        template<class InputIterator, class = AZStd::enable_if_t<!AZStd::is_integral_v<InputIterator>>>
+        small_vector(InputIterator first, InputIterator last, const allocator_type& allocator = allocator_type())
+            : m_allocator(allocator)
+        {
+            for (; first != last; ++first)
+            {
+                emplace_back(*first);
+            }
+        }
+
+        small_vector(AZStd::initializer_list<value_type> list, const allocator_type& allocator = allocator_type())
+            : m_allocator(allocator)
+        {
+            reserve(list.size());
+            for (const value_type& value : list)
+            {
+                ::new (static_cast<void*>(m_data + m_size)) value_type(value);
+                ++m_size;
+            }
+        }
+
+        small_vector(const this_type& rhs)
+            : m_allocator(rhs.m_allocator)
+        {
+            reserve(rhs.m_size);
+            for (const value_type& value : rhs)
+            {
+                ::new (static_cast<void*>(m_data + m_size)) value_type(value);
+                ++m_size;
+            }
+        }
+
+        small_vector(this_type&& rhs)
+            : m_allocator(rhs.m_allocator)
+        {
+            steal(rhs);
+        }
+
+        ~small_vector()
+        {
+            clear();
+            deallocate_storage();
+        }
+
+        this_type& operator=(const this_type& rhs)
+        {
+            if (this != &rhs)
+            {
+                clear();
+                reserve(rhs.m_size);
+                for (const value_type& value : rhs)
+                {
+                    ::new (static_cast<void*>(m_data + m_size)) value_type(value);
+                    ++m_size;
+                }
+            }
+            return *this;
+        }
+
+        this_type& operator=(this_type&& rhs)
+        {
+            if (this != &rhs)
+            {
+                clear();
+                deallocate_storage();
+                m_allocator = rhs.m_allocator;
+                steal(rhs);
+            }
+            return *this;
+        }
+
+        void assign(size_type count, const_reference value)
+        {
+            clear();
+            reserve(count);
+            for (; m_size < count; ++m_size)
+            {
+                ::new (static_cast<void*>(m_data + m_size)) value_type(value);
+            }
+        }
+
+        iterator begin() { return m_data; }
+        const_iterator begin() const { return m_data; }
+        const_iterator cbegin() const { return m_data; }
+        iterator end() { return m_data + m_size; }
+        const_iterator end() const { return m_data + m_size; }
+        const_iterator cend() const { return m_data + m_size; }
+        reverse_iterator rbegin() { return reverse_iterator(end()); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        reverse_iterator rend() { return reverse_iterator(begin()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+        bool empty() const { return m_size == 0; }
+        size_type size() const { return m_size; }
+        size_type capacity() const { return m_capacity; }
+        size_type max_size() const { return m_allocator.max_size() / sizeof(value_type); }
+        //! Returns true while the elements are stored inside the object instead of memory from the allocator.
+        bool is_inline() const { return m_data == inline_data(); }
+
+        pointer data() { return m_data; }
+        const_pointer data() const { return m_data; }
+
+        reference operator[](size_type index)
+        {
+            AZSTD_CONTAINER_ASSERT(index < m_size, "AZStd::small_vector<>::operator[] - position is out of range");
+            return m_data[index];
+        }
+        const_reference operator[](size_type index) const
+        {
+            AZSTD_CONTAINER_ASSERT(index < m_size, "AZStd::small_vector<>::operator[] - position is out of range");
+            return m_data[index];
+        }
+        reference at(size_type index) { return (*this)[index]; }
+        const_reference at(size_type index) const { return (*this)[index]; }
+
+        reference front()
+        {
+            AZSTD_CONTAINER_ASSERT(m_size != 0, "AZStd::small_vector<>::front - container is empty");
+            return m_data[0];
+        }
+        const_reference front() const
+        {
+            AZSTD_CONTAINER_ASSERT(m_size != 0, "AZStd::small_vector<>::front - container is empty");
+            return m_data[0];
+        }
+        reference back()
+        {
+            AZSTD_CONTAINER_ASSERT(m_size != 0, "AZStd::small_vector<>::back - container is empty");
+            return m_data[m_size - 1];
+        }
+        const_reference back() const
+        {
+            AZSTD_CONTAINER_ASSERT(m_size != 0, "AZStd::small_vector<>::back - container is empty");
+            return m_data[m_size - 1];
+        }
+
+        allocator_type& get_allocator() { return m_allocator; }
+        const allocator_type& get_allocator() const { return m_allocator; }
+
+        void reserve(size_type capacity)
+        {
+            if (capacity > m_capacity)
+            {
+                reallocate(capacity);
+            }
+        }
+
+        //! Moves the elements back to the inline storage if they fit, otherwise to an allocation that fits them exactly.
+        void shrink_to_fit()
+        {
+            if (!is_inline() && m_size < m_capacity)
+            {
+                reallocate(m_size);
+            }
+        }
+
+        void clear()
+        {
+            destroy(m_data, m_data + m_size);
+            m_size = 0;
+        }
+
+        void resize(size_type count)
+        {
+            resize_impl(count);
+        }
+        void resize(size_type count, const_reference value)
+        {
+            resize_impl(count, value);
+        }
+
+        void push_back(const_reference value)
+        {
+            emplace_back(value);
+        }
+        void push_back(value_type&& value)
+        {
+            emplace_back(AZStd::move(value));
+        }
+
+        template<class... Args>
+        reference emplace_back(Args&&... args)
+        {
+            if (m_size == m_capacity)
+            {
+                // The arguments may reference an element, so the new element is constructed before the old ones are moved
+                const size_type newCapacity = grow_capacity(m_size + 1);
+                T* newData = allocate(newCapacity);
+                ::new (static_cast<void*>(newData + m_size)) value_type(AZStd::forward<Args>(args)...);
+                relocate(m_data, m_data + m_size, newData);
+                deallocate_storage();
+                m_data = newData;
+                m_capacity = newCapacity;
+            }
+            else
+            {
+                ::new (static_cast<void*>(m_data + m_size)) value_type(AZStd::forward<Args>(args)...);
+            }
+            return m_data[m_size++];
+        }
+
+        void pop_back()
+        {
+            AZSTD_CONTAINER_ASSERT(m_size != 0, "AZStd::small_vector<>::pop_back - container is empty");
+            --m_size;
+            m_data[m_size].~value_type();
+        }
+
+        template<class... Args>
+        iterator emplace(const_iterator insertPos, Args&&... args)
+        {
+            const size_type index = static_cast<size_type>(insertPos - m_data);
+            AZSTD_CONTAINER_ASSERT(index <= m_size, "AZStd::small_vector<>::emplace - position is out of range");
+            if (index == m_size)
+            {
+                emplace_back(AZStd::forward<Args>(args)...);
+                return m_data + index;
+            }
+
+            value_type value(AZStd::forward<Args>(args)...);
+            emplace_back(AZStd::move(m_data[m_size - 1]));
+            for (size_type moveIndex = m_size - 2; moveIndex > index; --moveIndex)
+            {
+                m_data[moveIndex] = AZStd::move(m_data[moveIndex - 1]);
+            }
+            m_data[index] = AZStd::move(value);
+            return m_data + index;
+        }
+        iterator insert(const_iterator insertPos, const_reference value)
+        {
+            return emplace(insertPos, value);
+        }
+        iterator insert(const_iterator insertPos, value_type&& value)
+        {
+            return emplace(insertPos, AZStd::move(value));
+        }
+
+        iterator erase(const_iterator erasePos)
+        {
+            return erase(erasePos, erasePos + 1);
+        }
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            iterator eraseFirst = m_data + (first - m_data);
+            iterator eraseLast = m_data + (last - m_data);
+            AZSTD_CONTAINER_ASSERT(eraseFirst >= m_data && eraseFirst <= eraseLast && eraseLast <= end(), "AZStd::small_vector<>::erase - invalid range");
+            if (eraseFirst != eraseLast)
+            {
+                iterator newEnd = AZStd::move(eraseLast, end(), eraseFirst);
+                destroy(newEnd, end());
+                m_size = static_cast<size_type>(newEnd - m_data);
+            }
+            return eraseFirst;
+        }
+
+        void swap(this_type& rhs)
+        {
+            if (this != &rhs)
+            {
+                this_type temp(AZStd::move(rhs));
+                rhs = AZStd::move(*this);
+                *this = AZStd::move(temp);
+            }
+        }
+
+        friend bool operator==(const this_type& lhs, const this_type& rhs)
+        {
+            if (lhs.m_size != rhs.m_size)
+            {
+                return false;
+            }
+            for (size_type index = 0; index < lhs.m_size; ++index)
+            {
+                if (!(lhs.m_data[index] == rhs.m_data[index]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+        friend bool operator!=(const this_type& lhs, const this_type& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        T* inline_data()
+        {
+            return reinterpret_cast<T*>(m_inlineStorage);
+        }
+        const T* inline_data() const
+        {
+            return reinterpret_cast<const T*>(m_inlineStorage);
+        }
+
+        size_type grow_capacity(size_type requiredCapacity) const
+        {
+            const size_type doubled = m_capacity * 2;
+            return doubled > requiredCapacity ? doubled : requiredCapacity;
+        }
+
+        T* allocate(size_type capacity)
+        {
+            if (capacity <= InlineCapacity)
+            {
+                return inline_data();
+            }
+            return static_cast<T*>(m_allocator.allocate(capacity * sizeof(T), alignof(T)));
+        }
+
+        void deallocate_storage()
+        {
+            if (!is_inline())
+            {
+                m_allocator.deallocate(m_data, m_capacity * sizeof(T), alignof(T));
+            }
+            m_data = inline_data();
+            m_capacity = InlineCapacity;
+        }
+
+        void reallocate(size_type capacity)
+        {
+            T* newData = allocate(capacity);
+            if (newData == m_data)
+            {
+                return;
+            }
+            relocate(m_data, m_data + m_size, newData);
+            deallocate_storage();
+            m_data = newData;
+            m_capacity = capacity > InlineCapacity ? capacity : InlineCapacity;
+        }
+
+        static void relocate(T* first, T* last, T* destination)
+        {
+            for (; first != last; ++first, ++destination)
+            {
+                ::new (static_cast<void*>(destination)) value_type(AZStd::move(*first));
+                first->~value_type();
+            }
+        }
+
+        static void destroy(T* first, T* last)
+        {
+            if constexpr (!AZStd::is_trivially_destructible_v<T>)
+            {
+                for (; first != last; ++first)
+                {
+                    first->~value_type();
+                }
+            }
+        }
+
+        template<class... Args>
+        void resize_impl(size_type count, const Args&... args)
+        {
+            if (count < m_size)
+            {
+                destroy(m_data + count, m_data + m_size);
+                m_size = count;
+                return;
+            }
+            reserve(count);
+            for (; m_size < count; ++m_size)
+            {
+                ::new (static_cast<void*>(m_data + m_size)) value_type(args...);
+            }
+        }
+
+        void steal(this_type& rhs)
+        {
+            if (rhs.is_inline())
+            {
+                relocate(rhs.m_data, rhs.m_data + rhs.m_size, m_data);
+                m_size = rhs.m_size;
+            }
+            else
+            {
+                m_data = rhs.m_data;
+                m_size = rhs.m_size;
+                m_capacity = rhs.m_capacity;
+                rhs.m_data = rhs.inline_data();
+                rhs.m_capacity = InlineCapacity;
+            }
+            rhs.m_size = 0;
+        }
+
+        alignas(T) unsigned char m_inlineStorage[InlineCapacity * sizeof(T)];
+        T* m_data = inline_data();
+        size_type m_size = 0;
+        size_type m_capacity = InlineCapacity;
+        allocator_type m_allocator;
+    };
+
+    template<class T, AZStd::size_t InlineCapacity, class Allocator>
+    void swap(small_vector<T, InlineCapacity, Allocator>& left, small_vector<T, InlineCapacity, Allocator>& right)
+    {
+        left.swap(right);
+    }
+} // namespace AZStd
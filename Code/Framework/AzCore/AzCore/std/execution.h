@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/typetraits/integral_constant.h>
+
+namespace AZ
+{
+    class TaskExecutor;
+}
+
+namespace AZStd
+{
+    // ref: https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t
+    // The algorithm overloads that take a parallel_policy are declared in AzCore/Task/ParallelAlgorithms.h, as they run
+    // on the tasks of an AZ::TaskExecutor.
+    namespace execution
+    {
+        struct sequenced_policy
+        {
+        };
+
+        struct parallel_policy
+        {
+            //! Returns a copy of the policy that runs on the supplied executor instead of the default TaskExecutor.
+            constexpr parallel_policy on(AZ::TaskExecutor& taskExecutor) const
+            {
+                parallel_policy policy = *this;
+                policy.m_executor = &taskExecutor;
+                return policy;
+            }
+
+            //! Returns a copy of the policy that gives every task at least grainSize elements.
+            //! By default the grain size is picked from the number of elements and workers.
+            constexpr parallel_policy with_grain_size(size_t grainSize) const
+            {
+                parallel_policy policy = *this;
+                policy.m_grainSize = grainSize;
+                return policy;
+            }
+
+            AZ::TaskExecutor* m_executor = nullptr;
+            size_t m_grainSize = 0;
+        };
+
+        inline constexpr sequenced_policy seq{};
+        inline constexpr parallel_policy par{};
+    } // namespace execution
+
+    template<class T>
+    struct is_execution_policy : false_type
+    {
+    };
+    template<>
+    struct is_execution_policy<execution::sequenced_policy> : true_type
+    {
+    };
+    template<>
+    struct is_execution_policy<execution::parallel_policy> : true_type
+    {
+    };
+
+    template<class T>
+    inline constexpr bool is_execution_policy_v = is_execution_policy<T>::value;
+} // namespace AZStd
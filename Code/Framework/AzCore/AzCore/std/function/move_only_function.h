@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/function/invoke.h>
+#include <AzCore/std/utils.h>
+#include <AzCore/std/typetraits/decay.h>
+#include <AzCore/std/typetraits/is_member_pointer.h>
+#include <AzCore/std/typetraits/is_same.h>
+
+#include <cstddef>
+#include <new>
+
+namespace AZStd
+{
+    template<class Signature, AZStd::size_t InlineCapacity = 6 * sizeof(void*), class Allocator = AZStd::allocator>
+    class move_only_function;
+
+    /**
+     * Move-only wrapper for a callable. Callables that fit in InlineCapacity bytes are stored inside the object, larger ones
+     * are moved to memory from the allocator. Since it never copies the callable, it can wrap lambdas that capture move-only
+     * types and doesn't need the type erased copy support of \ref function, which also makes it a bit smaller and faster to move.
+     * Use it instead of AZStd::function for callbacks that are queued or stored once and never copied, and raise the inline
+     * capacity where the captures are known to be larger.
+     */
+    template<class R, class... Args, AZStd::size_t InlineCapacity, class Allocator>
+    class move_only_function<R(Args...), InlineCapacity, Allocator>
+    {
+        static_assert(InlineCapacity >= sizeof(void*), "The inline storage of move_only_function must at least fit a pointer");
+
+        template<class F>
+        static constexpr bool stored_inline = sizeof(F) <= InlineCapacity && alignof(F) <= alignof(std::max_align_t);
+
+    public:
+        using result_type = R;
+        using allocator_type = Allocator;
+        static constexpr AZStd::size_t inline_capacity = InlineCapacity;
+
+        move_only_function() = default;
+
+        move_only_function(std::nullptr_t)
+        {
+        }
+
+        template<class F, class = AZStd::enable_if_t<!AZStd::is_same_v<AZStd::decay_t<F>, move_only_function>
+            && AZStd::is_invocable_r_v<R, AZStd::decay_t<F>&, Args...>>>
+        move_only_function(F&& callable, const allocator_type& allocator = allocator_type())
+            : m_allocator(allocator)
+        {
+            emplace<AZStd::decay_t<F>>(AZStd::forward<F>(callable));
+        }
+
+        move_only_function(move_only_function&& rhs)
+            : m_allocator(rhs.m_allocator)
+        {
+            steal(rhs);
+        }
+
+        move_only_function(const move_only_function&) = delete;
+        move_only_function& operator=(const move_only_function&) = delete;
+
+        ~move_only_function()
+        {
+            reset();
+        }
+
+        move_only_function& operator=(move_only_function&& rhs)
+        {
+            if (this != &rhs)
+            {
+                reset();
+                m_allocator = rhs.m_allocator;
+                steal(rhs);
+            }
+            return *this;
+        }
+
+        move_only_function& operator=(std::nullptr_t)
+        {
+            reset();
+            return *this;
+        }
+
+        template<class F, class = AZStd::enable_if_t<!AZStd::is_same_v<AZStd::decay_t<F>, move_only_function>
+            && AZStd::is_invocable_r_v<R, AZStd::decay_t<F>&, Args...>>>
+        move_only_function& operator=(F&& callable)
+        {
+            reset();
+            emplace<AZStd::decay_t<F>>(AZStd::forward<F>(callable));
+            return *this;
+        }
+
+        explicit operator bool() const
+        {
+            return m_invoker != nullptr;
+        }
+
+        R operator()(Args... args)
+        {
+            AZ_Assert(m_invoker, "Calling an empty move_only_function");
+            return m_invoker(m_storage, AZStd::forward<Args>(args)...);
+        }
+
+        void swap(move_only_function& rhs)
+        {
+            move_only_function temp(AZStd::move(rhs));
+            rhs = AZStd::move(*this);
+            *this = AZStd::move(temp);
+        }
+
+        //! Returns true if the callable is stored inside the object instead of memory from the allocator.
+        bool is_inline() const
+        {
+            return m_manager != nullptr && m_manager(Operation::IsInline, const_cast<unsigned char*>(m_storage), nullptr, const_cast<allocator_type&>(m_allocator));
+        }
+
+        allocator_type& get_allocator()
+        {
+            return m_allocator;
+        }
+
+        friend bool operator==(const move_only_function& function, std::nullptr_t)
+        {
+            return !function;
+        }
+        friend bool operator!=(const move_only_function& function, std::nullptr_t)
+        {
+            return static_cast<bool>(function);
+        }
+
+    private:
+        enum class Operation
+        {
+            MoveTo,
+            Destroy,
+            IsInline
+        };
+
+        using Invoker = R (*)(unsigned char* storage, Args&&... args);
+        using Manager = bool (*)(Operation operation, unsigned char* storage, unsigned char* destination, allocator_type& allocator);
+
+        template<class F>
+        static F* get_callable(unsigned char* storage)
+        {
+            if constexpr (stored_inline<F>)
+            {
+                return std::launder(reinterpret_cast<F*>(storage));
+            }
+            else
+            {
+                return *reinterpret_cast<F**>(storage);
+            }
+        }
+
+        template<class F>
+        static R invoke_callable(unsigned char* storage, Args&&... args)
+        {
+            if constexpr (AZStd::is_void_v<R>)
+            {
+                AZStd::invoke(*get_callable<F>(storage), AZStd::forward<Args>(args)...);
+            }
+            else
+            {
+                return AZStd::invoke(*get_callable<F>(storage), AZStd::forward<Args>(args)...);
+            }
+        }
+
+        template<class F>
+        static bool manage_callable(Operation operation, unsigned char* storage, unsigned char* destination, allocator_type& allocator)
+        {
+            switch (operation)
+            {
+            case Operation::MoveTo:
+                if constexpr (stored_inline<F>)
+                {
+                    F* callable = get_callable<F>(storage);
+                    ::new (static_cast<void*>(destination)) F(AZStd::move(*callable));
+                    callable->~F();
+                }
+                else
+                {
+                    *reinterpret_cast<F**>(destination) = get_callable<F>(storage);
+                }
+                return true;
+            case Operation::Destroy:
+                if constexpr (stored_inline<F>)
+                {
+                    get_callable<F>(storage)->~F();
+                }
+                else
+                {
+                    F* callable = get_callable<F>(storage);
+                    callable->~F();
+                    allocator.deallocate(callable, sizeof(F), alignof(F));
+                }
+                return true;
+            case Operation::IsInline:
+                return stored_inline<F>;
+            }
+            return false;
+        }
+
+        template<class F, class Callable>
+        void emplace(Callable&& callable)
+        {
+            if constexpr (AZStd::is_pointer_v<F> || AZStd::is_member_pointer_v<F>)
+            {
+                if (callable == nullptr)
+                {
+                    return;
+                }
+            }
+
+            if constexpr (stored_inline<F>)
+            {
+                ::new (static_cast<void*>(m_storage)) F(AZStd::forward<Callable>(callable));
+            }
+            else
+            {
+                void* memory = m_allocator.allocate(sizeof(F), alignof(F));
+                AZ_Assert(memory, "Failed to allocate %zu bytes for a move_only_function", sizeof(F));
+                *reinterpret_cast<F**>(m_storage) = ::new (memory) F(AZStd::forward<Callable>(callable));
+            }
+            m_invoker = &invoke_callable<F>;
+            m_manager = &manage_callable<F>;
+        }
+
+        void reset()
+        {
+            if (m_manager)
+            {
+                m_manager(Operation::Destroy, m_storage, nullptr, m_allocator);
+                m_invoker = nullptr;
+                m_manager = nullptr;
+            }
+        }
+
+        void steal(move_only_function& rhs)
+        {
+            if (rhs.m_manager)
+            {
+                rhs.m_manager(Operation::MoveTo, rhs.m_storage, m_storage, rhs.m_allocator);
+                m_invoker = rhs.m_invoker;
+                m_manager = rhs.m_manager;
+                rhs.m_invoker = nullptr;
+                rhs.m_manager = nullptr;
+            }
+        }
+
+        alignas(std::max_align_t) unsigned char m_storage[InlineCapacity];
+        Invoker m_invoker = nullptr;
+        Manager m_manager = nullptr;
+        allocator_type m_allocator;
+    };
+} // namespace AZStd
@@ -21,9 +21,11 @@ namespace AZStd
     using std::cos;
     using std::exp;
     using std::exp2;
+    using std::expm1;
     using std::floor;
     using std::fmod;
     using std::llround;
+    using std::log;
     using std::lround;
     using std::pow;
     using std::round;
@@ -63,4 +63,16 @@ namespace AZStd
 
         return init;
     }
+
+    // ref: https://en.cppreference.com/w/cpp/algorithm/transform_reduce
+    template<class InputIt, class T, class BinaryReduceOp, class UnaryTransformOp>
+    constexpr T transform_reduce(InputIt first, InputIt last, T init, BinaryReduceOp reduce, UnaryTransformOp transform)
+    {
+        for (; first != last; ++first)
+        {
+            init = reduce(AZStd::move(init), transform(*first));
+        }
+
+        return init;
+    }
 } // namespace AZStd
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MemoryMappedFile.h>
+#include <AzCore/Casting/numeric_cast.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+    bool MemoryMappedFile::PlatformOpen(const char* filePath)
+    {
+        int fileDescriptor = open(filePath, O_RDONLY | O_CLOEXEC);
+        if (fileDescriptor == -1)
+        {
+            return false;
+        }
+
+        struct stat fileStats;
+        if (fstat(fileDescriptor, &fileStats) != 0 || fileStats.st_size <= 0)
+        {
+            close(fileDescriptor);
+            return false;
+        }
+
+        // MAP_PRIVATE with write access gives copy-on-write pages, matching the WinAPI FILE_MAP_COPY behavior.
+        size_t size = aznumeric_cast<size_t>(fileStats.st_size);
+        void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileDescriptor, 0);
+        // The mapping keeps its own reference to the file so the descriptor is no longer needed.
+        close(fileDescriptor);
+        if (data == MAP_FAILED)
+        {
+            AZ_Warning("MemoryMappedFile", false, "Failed to map '%s' into memory: %s", filePath, strerror(errno));
+            return false;
+        }
+
+        m_data = data;
+        m_size = aznumeric_cast<u64>(fileStats.st_size);
+        return true;
+    }
+
+    void MemoryMappedFile::PlatformClose()
+    {
+        munmap(m_data, aznumeric_cast<size_t>(m_size));
+    }
+} // namespace AZ::IO
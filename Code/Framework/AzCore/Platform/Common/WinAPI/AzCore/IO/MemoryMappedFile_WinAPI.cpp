@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MemoryMappedFile.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/string/conversions.h>
+
+#include <AzCore/PlatformIncl.h>
+
+namespace AZ::IO
+{
+    bool MemoryMappedFile::PlatformOpen(const char* filePath)
+    {
+        AZStd::fixed_wstring<MaxPathLength> filePathW;
+        AZStd::to_wstring(filePathW, filePath);
+
+        HANDLE file = CreateFileW(
+            filePathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!::GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        // PAGE_WRITECOPY together with FILE_MAP_COPY gives copy-on-write pages, matching MAP_PRIVATE on UnixLike platforms.
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        void* data = mapping ? MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0) : nullptr;
+        // The view keeps a reference to the mapping and the file, so both handles can be released.
+        if (mapping)
+        {
+            CloseHandle(mapping);
+        }
+        CloseHandle(file);
+
+        if (!data)
+        {
+            AZ_Warning("MemoryMappedFile", false, "Failed to map '%s' into memory (error %lu).", filePath, GetLastError());
+            return false;
+        }
+
+        m_data = data;
+        m_size = aznumeric_cast<u64>(fileSize.QuadPart);
+        return true;
+    }
+
+    void MemoryMappedFile::PlatformClose()
+    {
+        UnmapViewOfFile(m_data);
+    }
+} // namespace AZ::IO
@@ -60,7 +60,7 @@
 #define AZ_TRAIT_OS_USE_WINDOWS_SOCKETS 0
 #define AZ_TRAIT_OS_USE_WINDOWS_THREADS 0
 #define AZ_TRAIT_OS_USE_WINDOWS_MUTEX 0
-#define AZ_TRAIT_SUPPORT_IPC 0
+#define AZ_TRAIT_SUPPORT_IPC 1
 
 // Compiler traits ...
 #define AZ_TRAIT_COMPILER_DEFINE_AZSWNPRINTF_AS_SWPRINTF 1
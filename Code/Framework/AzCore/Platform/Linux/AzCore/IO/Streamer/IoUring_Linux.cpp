@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <AzCore/IO/Streamer/IoUring_Linux.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ::IO
+{
+    namespace IoUringInternal
+    {
+        static int Setup(u32 entryCount, io_uring_params* params)
+        {
+            return aznumeric_cast<int>(::syscall(__NR_io_uring_setup, entryCount, params));
+        }
+
+        template<typename T>
+        static T* Offset(void* base, u32 offset)
+        {
+            return reinterpret_cast<T*>(reinterpret_cast<u8*>(base) + offset);
+        }
+
+        static u32 LoadAcquire(const u32* value)
+        {
+            return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+        }
+
+        static void StoreRelease(u32* target, u32 value)
+        {
+            __atomic_store_n(target, value, __ATOMIC_RELEASE);
+        }
+    } // namespace IoUringInternal
+
+    IoUring::~IoUring()
+    {
+        Shutdown();
+    }
+
+    bool IoUring::IsSupported()
+    {
+        io_uring_params params{};
+        int ringHandle = IoUringInternal::Setup(1, &params);
+        if (ringHandle < 0)
+        {
+            return false;
+        }
+        ::close(ringHandle);
+        // IORING_OP_READ and registered file updates require at least the feature set that introduced
+        // IORING_FEAT_NODROP (5.5) and IORING_FEAT_RW_CUR_POS (5.6).
+        return (params.features & IORING_FEAT_NODROP) && (params.features & IORING_FEAT_RW_CUR_POS);
+    }
+
+    bool IoUring::Initialize(u32 entryCount, bool enableKernelSubmissionPolling)
+    {
+        AZ_Assert(!IsInitialized(), "IoUring has already been initialized.");
+
+        io_uring_params params{};
+        if (enableKernelSubmissionPolling)
+        {
+            params.flags |= IORING_SETUP_SQPOLL;
+            params.sq_thread_idle = 50; // Time in milliseconds before the kernel polling thread goes to sleep.
+        }
+
+        m_ringHandle = IoUringInternal::Setup(entryCount, &params);
+        if (m_ringHandle < 0 && enableKernelSubmissionPolling)
+        {
+            // Kernel side submission polling requires elevated privileges on kernels before 5.11, so try again without.
+            AZ_Warning("IoUring", false, "Unable to enable kernel submission polling (Error: %i). Falling back to regular submission.\n",
+                errno);
+            params = io_uring_params{};
+            m_ringHandle = IoUringInternal::Setup(entryCount, &params);
+        }
+        if (m_ringHandle < 0)
+        {
+            AZ_Warning("IoUring", false, "Failed to create io_uring (Error: %i).\n", errno);
+            Reset();
+            return false;
+        }
+        m_usesKernelSubmissionPolling = (params.flags & IORING_SETUP_SQPOLL) != 0;
+
+        m_submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+        m_completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap)
+        {
+            m_submissionRingSize = AZStd::max(m_submissionRingSize, m_completionRingSize);
+            m_completionRingSize = m_submissionRingSize;
+        }
+
+        m_submissionRing = ::mmap(nullptr, m_submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            m_ringHandle, IORING_OFF_SQ_RING);
+        if (m_submissionRing == MAP_FAILED)
+        {
+            m_submissionRing = nullptr;
+            Shutdown();
+            return false;
+        }
+
+        if (singleMap)
+        {
+            m_completionRing = m_submissionRing;
+        }
+        else
+        {
+            m_completionRing = ::mmap(nullptr, m_completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                m_ringHandle, IORING_OFF_CQ_RING);
+            if (m_completionRing == MAP_FAILED)
+            {
+                m_completionRing = nullptr;
+                Shutdown();
+                return false;
+            }
+        }
+
+        m_submissionEntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void* submissionEntries = ::mmap(nullptr, m_submissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            m_ringHandle, IORING_OFF_SQES);
+        if (submissionEntries == MAP_FAILED)
+        {
+            Shutdown();
+            return false;
+        }
+        m_submissionEntries = reinterpret_cast<io_uring_sqe*>(submissionEntries);
+
+        using IoUringInternal::Offset;
+        m_submissionHead = Offset<u32>(m_submissionRing, params.sq_off.head);
+        m_submissionTail = Offset<u32>(m_submissionRing, params.sq_off.tail);
+        m_submissionFlags = Offset<u32>(m_submissionRing, params.sq_off.flags);
+        m_submissionArray = Offset<u32>(m_submissionRing, params.sq_off.array);
+        m_submissionMask = *Offset<u32>(m_submissionRing, params.sq_off.ring_mask);
+        m_submissionEntryCount = params.sq_entries;
+        m_submissionLocalTail = *m_submissionTail;
+
+        m_completionHead = Offset<u32>(m_completionRing, params.cq_off.head);
+        m_completionTail = Offset<u32>(m_completionRing, params.cq_off.tail);
+        m_completionMask = *Offset<u32>(m_completionRing, params.cq_off.ring_mask);
+        m_completionEntries = Offset<io_uring_cqe>(m_completionRing, params.cq_off.cqes);
+
+        return true;
+    }
+
+    void IoUring::Shutdown()
+    {
+        if (m_submissionEntries)
+        {
+            ::munmap(m_submissionEntries, m_submissionEntriesSize);
+        }
+        if (m_completionRing && m_completionRing != m_submissionRing)
+        {
+            ::munmap(m_completionRing, m_completionRingSize);
+        }
+        if (m_submissionRing)
+        {
+            ::munmap(m_submissionRing, m_submissionRingSize);
+        }
+        if (m_ringHandle >= 0)
+        {
+            ::close(m_ringHandle);
+        }
+        Reset();
+    }
+
+    bool IoUring::IsInitialized() const
+    {
+        return m_ringHandle >= 0;
+    }
+
+    u32 IoUring::GetEntryCount() const
+    {
+        return m_submissionEntryCount;
+    }
+
+    io_uring_sqe* IoUring::GetSubmissionEntry()
+    {
+        u32 head = IoUringInternal::LoadAcquire(m_submissionHead);
+        if (m_submissionLocalTail - head >= m_submissionEntryCount)
+        {
+            return nullptr;
+        }
+
+        u32 index = m_submissionLocalTail & m_submissionMask;
+        io_uring_sqe* entry = &m_submissionEntries[index];
+        ::memset(entry, 0, sizeof(io_uring_sqe));
+        m_submissionArray[index] = index;
+        m_submissionLocalTail++;
+        return entry;
+    }
+
+    int IoUring::Submit()
+    {
+        // Publish the new entries to the kernel before notifying it. Any entries the kernel didn't consume during a previous
+        // call, for instance because it ran out of resources, are submitted again as part of this batch.
+        IoUringInternal::StoreRelease(m_submissionTail, m_submissionLocalTail);
+        u32 submitCount = m_submissionLocalTail - IoUringInternal::LoadAcquire(m_submissionHead);
+        if (submitCount == 0)
+        {
+            return 0;
+        }
+
+        if (m_usesKernelSubmissionPolling)
+        {
+            // The kernel thread picks up the entries by itself, unless it went to sleep because it was idle for too long.
+            if (IoUringInternal::LoadAcquire(m_submissionFlags) & IORING_SQ_NEED_WAKEUP)
+            {
+                int result = Enter(submitCount, 0, IORING_ENTER_SQ_WAKEUP);
+                if (result < 0)
+                {
+                    return result;
+                }
+            }
+            return aznumeric_cast<int>(submitCount);
+        }
+        return Enter(submitCount, 0, 0);
+    }
+
+    bool IoUring::WaitForCompletions(u32 count)
+    {
+        return Enter(0, count, IORING_ENTER_GETEVENTS) >= 0;
+    }
+
+    io_uring_cqe* IoUring::PeekCompletion()
+    {
+        u32 head = *m_completionHead;
+        if (head == IoUringInternal::LoadAcquire(m_completionTail))
+        {
+            return nullptr;
+        }
+        return &m_completionEntries[head & m_completionMask];
+    }
+
+    void IoUring::ReleaseCompletion()
+    {
+        IoUringInternal::StoreRelease(m_completionHead, *m_completionHead + 1);
+    }
+
+    bool IoUring::RegisterFiles(u32 count)
+    {
+        AZStd::unique_ptr<int[]> handles(new int[count]);
+        AZStd::fill_n(handles.get(), count, -1);
+        return Register(IORING_REGISTER_FILES, handles.get(), count) >= 0;
+    }
+
+    bool IoUring::UpdateRegisteredFile(u32 index, int fileHandle)
+    {
+        io_uring_files_update update{};
+        update.offset = index;
+        update.fds = reinterpret_cast<u64>(&fileHandle);
+        return Register(IORING_REGISTER_FILES_UPDATE, &update, 1) == 1;
+    }
+
+    bool IoUring::RegisterBuffers(const iovec* buffers, u32 count)
+    {
+        return Register(IORING_REGISTER_BUFFERS, buffers, count) >= 0;
+    }
+
+    bool IoUring::RegisterEventHandle(int eventHandle)
+    {
+        return Register(IORING_REGISTER_EVENTFD, &eventHandle, 1) >= 0;
+    }
+
+    int IoUring::Enter(u32 submitCount, u32 minCompleteCount, u32 flags)
+    {
+        int result;
+        do
+        {
+            result = aznumeric_cast<int>(::syscall(__NR_io_uring_enter, m_ringHandle, submitCount, minCompleteCount, flags, nullptr, 0));
+        } while (result < 0 && errno == EINTR);
+        return result < 0 ? -errno : result;
+    }
+
+    int IoUring::Register(u32 opcode, const void* arguments, u32 argumentCount)
+    {
+        int result = aznumeric_cast<int>(::syscall(__NR_io_uring_register, m_ringHandle, opcode, arguments, argumentCount));
+        return result < 0 ? -errno : result;
+    }
+
+    void IoUring::Reset()
+    {
+        m_submissionEntries = nullptr;
+        m_submissionHead = nullptr;
+        m_submissionTail = nullptr;
+        m_submissionFlags = nullptr;
+        m_submissionArray = nullptr;
+        m_submissionMask = 0;
+        m_submissionEntryCount = 0;
+        m_submissionLocalTail = 0;
+        m_completionEntries = nullptr;
+        m_completionHead = nullptr;
+        m_completionTail = nullptr;
+        m_completionMask = 0;
+        m_submissionRing = nullptr;
+        m_completionRing = nullptr;
+        m_submissionRingSize = 0;
+        m_completionRingSize = 0;
+        m_submissionEntriesSize = 0;
+        m_ringHandle = -1;
+        m_usesKernelSubmissionPolling = false;
+    }
+} // namespace AZ::IO
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <linux/io_uring.h>
+#include <sys/uio.h>
+#include <AzCore/base.h>
+
+namespace AZ::IO
+{
+    //! Minimal wrapper around the raw io_uring system calls. AzCore doesn't take a dependency on liburing so this only
+    //! covers the subset that's needed by StorageDriveLinuxUring: a single submission and completion queue pair, a
+    //! sparse table of registered files, a set of registered buffers and an eventfd for completion notifications.
+    //! All calls are expected to come from a single thread.
+    class IoUring
+    {
+    public:
+        IoUring() = default;
+        ~IoUring();
+
+        IoUring(const IoUring&) = delete;
+        IoUring& operator=(const IoUring&) = delete;
+
+        //! Checks if the kernel supports io_uring and allows the process to use it. Container runtimes and older kernels
+        //! frequently block or lack the required system calls.
+        static bool IsSupported();
+
+        //! Creates the ring with at least the requested number of entries.
+        //! @param entryCount The minimum number of submission entries. The kernel will round this up to a power of 2.
+        //! @param enableKernelSubmissionPolling If true a kernel thread polls the submission queue, which removes the need
+        //!     for a system call per submission at the cost of a (mostly idle) kernel thread.
+        bool Initialize(u32 entryCount, bool enableKernelSubmissionPolling);
+        void Shutdown();
+        bool IsInitialized() const;
+        u32 GetEntryCount() const;
+
+        //! Gets the next free submission entry or null if the submission queue is full. The returned entry is cleared.
+        io_uring_sqe* GetSubmissionEntry();
+        //! Hands all submission entries that were retrieved since the last call, and any the kernel hasn't consumed yet, to the kernel.
+        //! @return The number of entries that were submitted or a negative errno value.
+        int Submit();
+        //! Blocks until at least the given number of completions are available.
+        bool WaitForCompletions(u32 count);
+        //! Returns the oldest completion that hasn't been released yet or null if there are no completions. This doesn't
+        //! require a system call.
+        io_uring_cqe* PeekCompletion();
+        //! Releases the completion that was last returned by PeekCompletion.
+        void ReleaseCompletion();
+
+        //! Registers a sparse, fixed size, table of files. Entries can be filled in with UpdateRegisteredFile.
+        bool RegisterFiles(u32 count);
+        //! Assigns a file to a slot in the registered file table. Use -1 to clear the slot.
+        bool UpdateRegisteredFile(u32 index, int fileHandle);
+        bool RegisterBuffers(const iovec* buffers, u32 count);
+        //! Registers an eventfd that will be signaled every time a completion is posted.
+        bool RegisterEventHandle(int eventHandle);
+
+    private:
+        int Enter(u32 submitCount, u32 minCompleteCount, u32 flags);
+        int Register(u32 opcode, const void* arguments, u32 argumentCount);
+        void Reset();
+
+        io_uring_sqe* m_submissionEntries{ nullptr };
+        u32* m_submissionHead{ nullptr };
+        u32* m_submissionTail{ nullptr };
+        u32* m_submissionFlags{ nullptr };
+        u32* m_submissionArray{ nullptr };
+        u32 m_submissionMask{ 0 };
+        u32 m_submissionEntryCount{ 0 };
+        //! The tail of the submission entries that have been handed out, including the ones that haven't been submitted yet.
+        u32 m_submissionLocalTail{ 0 };
+
+        io_uring_cqe* m_completionEntries{ nullptr };
+        u32* m_completionHead{ nullptr };
+        u32* m_completionTail{ nullptr };
+        u32 m_completionMask{ 0 };
+
+        void* m_submissionRing{ nullptr };
+        void* m_completionRing{ nullptr };
+        size_t m_submissionRingSize{ 0 };
+        size_t m_completionRingSize{ 0 };
+        size_t m_submissionEntriesSize{ 0 };
+
+        int m_ringHandle{ -1 };
+        bool m_usesKernelSubmissionPolling{ false };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxUringStorageDriveConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        if (!StorageDriveLinuxUring::IsSupported())
+        {
+            AZ_Warning("Streamer", false, "io_uring is not available for this process. Falling back to the generic storage drive.\n");
+            return AZStd::make_shared<StorageDrive>(m_maxFileHandles);
+        }
+
+        StorageDriveLinuxUring::ConstructionOptions options;
+        options.m_hasSeekPenalty = m_hasSeekPenalty;
+        options.m_enableUnbufferedReads = m_enableUnbufferedReads;
+        options.m_enableKernelSubmissionPolling = m_enableKernelSubmissionPolling;
+        options.m_minimalReporting = m_minimalReporting;
+
+        auto stackEntry = AZStd::make_shared<StorageDriveLinuxUring>(
+            m_maxFileHandles, m_maxMetaDataCache, hardware.m_maxPhysicalSectorSize, hardware.m_maxLogicalSectorSize, m_queueDepth,
+            m_registeredBufferSize, m_overcommit, options);
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void LinuxUringStorageDriveConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<LinuxUringStorageDriveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxFileHandles", &LinuxUringStorageDriveConfig::m_maxFileHandles)
+                ->Field("MaxMetaDataCache", &LinuxUringStorageDriveConfig::m_maxMetaDataCache)
+                ->Field("QueueDepth", &LinuxUringStorageDriveConfig::m_queueDepth)
+                ->Field("RegisteredBufferSize", &LinuxUringStorageDriveConfig::m_registeredBufferSize)
+                ->Field("Overcommit", &LinuxUringStorageDriveConfig::m_overcommit)
+                ->Field("HasSeekPenalty", &LinuxUringStorageDriveConfig::m_hasSeekPenalty)
+                ->Field("EnableUnbufferedReads", &LinuxUringStorageDriveConfig::m_enableUnbufferedReads)
+                ->Field("EnableKernelSubmissionPolling", &LinuxUringStorageDriveConfig::m_enableKernelSubmissionPolling)
+                ->Field("MinimalReporting", &LinuxUringStorageDriveConfig::m_minimalReporting);
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+
+namespace AZ::IO
+{
+    //! Configuration for StorageDriveLinuxUring. If the kernel doesn't support io_uring, or it's blocked for the process,
+    //! the generic StorageDrive is created instead.
+    class LinuxUringStorageDriveConfig final :
+        public IStreamerStackConfig
+    {
+    public:
+        AZ_RTTI(AZ::IO::LinuxUringStorageDriveConfig, "{9597557E-1859-4CA2-91F8-25C02F08CA4B}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(LinuxUringStorageDriveConfig, SystemAllocator);
+
+        ~LinuxUringStorageDriveConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(ReflectContext* context);
+
+    private:
+        AZ::u32 m_maxFileHandles{ 32 };
+        AZ::u32 m_maxMetaDataCache{ 32 };
+        AZ::u32 m_queueDepth{ 32 };
+        AZ::u32 m_registeredBufferSize{ 256 * 1024 };
+        AZ::s32 m_overcommit{ 8 };
+        bool m_hasSeekPenalty{ false };
+        bool m_enableUnbufferedReads{ false };
+        bool m_enableKernelSubmissionPolling{ false };
+        bool m_minimalReporting{ false };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,1189 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace AZ::IO
+{
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+    static constexpr char FileSwitchesName[] = "File switches";
+    static constexpr char SeeksName[] = "Seeks";
+    static constexpr char DirectReadsName[] = "Direct reads (no internal alloc)";
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+    const AZStd::chrono::microseconds StorageDriveLinuxUring::s_averageSeekTime =
+        AZStd::chrono::milliseconds(9) + // Common average seek time for desktop hdd drives.
+        AZStd::chrono::milliseconds(3); // Rotational latency for a 7200RPM disk
+
+    //
+    // ConstructionOptions
+    //
+
+    StorageDriveLinuxUring::ConstructionOptions::ConstructionOptions()
+        : m_hasSeekPenalty(false)
+        , m_enableUnbufferedReads(false)
+        , m_enableKernelSubmissionPolling(false)
+        , m_minimalReporting(false)
+    {}
+
+    //
+    // ReadSlot
+    //
+
+    void StorageDriveLinuxUring::ReadSlot::AllocateAlignedBuffer(size_t size, size_t sectorSize)
+    {
+        AZ_Assert(m_sectorAlignedOutput == nullptr, "Assign a sector aligned buffer when one is already assigned.");
+        m_sectorAlignedOutput = azmalloc(size, sectorSize, AZ::SystemAllocator);
+    }
+
+    void StorageDriveLinuxUring::ReadSlot::Clear()
+    {
+        if (m_sectorAlignedOutput)
+        {
+            azfree(m_sectorAlignedOutput, AZ::SystemAllocator);
+        }
+        *this = ReadSlot{};
+    }
+
+    //
+    // StorageDriveLinuxUring
+    //
+
+    StorageDriveLinuxUring::StorageDriveLinuxUring(u32 maxFileHandles, u32 maxMetaDataCacheEntries, size_t physicalSectorSize,
+        size_t logicalSectorSize, u32 queueDepth, size_t registeredBufferSize, s32 overCommit, ConstructionOptions options)
+        : StreamStackEntry("Storage drive (io_uring)")
+        , m_physicalSectorSize(physicalSectorSize)
+        , m_logicalSectorSize(logicalSectorSize)
+        , m_registeredBufferSize(registeredBufferSize)
+        , m_maxFileHandles(AZStd::max(maxFileHandles, 1u))
+        , m_queueDepth(queueDepth)
+        , m_overCommit(overCommit)
+        , m_constructionOptions(options)
+    {
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s created.\n", m_name.c_str());
+        }
+
+        if (m_physicalSectorSize == 0)
+        {
+            m_physicalSectorSize = 4_kib;
+            AZ_Error("StorageDriveLinuxUring", false,
+                "Received physical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_physicalSectorSize);
+        }
+        if (m_logicalSectorSize == 0)
+        {
+            m_logicalSectorSize = 512;
+            AZ_Error("StorageDriveLinuxUring", false,
+                "Received logical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_logicalSectorSize);
+        }
+        AZ_Error("StorageDriveLinuxUring", IStreamerTypes::IsPowerOf2(m_physicalSectorSize) && IStreamerTypes::IsPowerOf2(m_logicalSectorSize),
+            "StorageDriveLinuxUring requires power-of-2 sector sizes. Received physical: %zu and logical: %zu",
+            m_physicalSectorSize, m_logicalSectorSize);
+
+        // The number of in-flight reads is tracked in a 16-bit counter.
+        constexpr u32 MaxQueueDepth = 4096;
+        if (m_queueDepth == 0)
+        {
+            m_queueDepth = 32;
+            AZ_Warning("StorageDriveLinuxUring", false,
+                "Received queue depth of 0 for %s. Picking a depth of %u instead.\n", m_name.c_str(), m_queueDepth);
+        }
+        else
+        {
+            m_queueDepth = AZStd::min(m_queueDepth, MaxQueueDepth);
+        }
+        // Make sure that the overCommit isn't so small that no slots are ever reported.
+        if (aznumeric_cast<s32>(m_queueDepth) + m_overCommit <= 0)
+        {
+            AZ_Error("StorageDriveLinuxUring", false,
+                "Received overcommit (%i) for %s that subtracts more than the queue depth (%u). Setting combined count to 1.\n",
+                m_overCommit, m_name.c_str(), m_queueDepth);
+            m_overCommit = 1 - aznumeric_cast<s32>(m_queueDepth);
+        }
+        m_registeredBufferSize = AZ_SIZE_ALIGN_UP(m_registeredBufferSize, m_physicalSectorSize);
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+
+        AZ_Assert(IStreamerTypes::IsPowerOf2(maxMetaDataCacheEntries),
+            "StorageDriveLinuxUring requires a power-of-2 for maxMetaDataCacheEntries. Received %u", maxMetaDataCacheEntries);
+        m_metaDataCache_paths.resize(maxMetaDataCacheEntries);
+        m_metaDataCache_fileSize.resize(maxMetaDataCacheEntries);
+    }
+
+    StorageDriveLinuxUring::~StorageDriveLinuxUring()
+    {
+        if (m_ring.IsInitialized())
+        {
+            // The Scheduler completes all requests before the stack is destroyed, but if reads are still in flight they
+            // have to be retired before the file handles and buffers are released as the kernel may still be writing to them.
+            if (m_activeReads_Count > 0)
+            {
+                for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+                {
+                    if (m_readSlots_active[readSlot])
+                    {
+                        if (io_uring_sqe* entry = m_ring.GetSubmissionEntry(); entry != nullptr)
+                        {
+                            entry->opcode = IORING_OP_ASYNC_CANCEL;
+                            entry->fd = -1;
+                            entry->addr = readSlot;
+                            entry->user_data = CancelSubmissionTag | readSlot;
+                        }
+                    }
+                }
+                m_ring.Submit();
+
+                while (m_activeReads_Count > 0 && m_ring.WaitForCompletions(1))
+                {
+                    while (io_uring_cqe* completion = m_ring.PeekCompletion())
+                    {
+                        if ((completion->user_data & CancelSubmissionTag) == 0)
+                        {
+                            size_t readSlot = aznumeric_cast<size_t>(completion->user_data);
+                            m_readSlots[readSlot].Clear();
+                            m_readSlots_active[readSlot] = false;
+                            m_activeReads_Count--;
+                        }
+                        m_ring.ReleaseCompletion();
+                    }
+                }
+            }
+            m_ring.Shutdown();
+        }
+
+        for (int file : m_fileCache_handles)
+        {
+            if (file >= 0)
+            {
+                ::close(file);
+            }
+        }
+        for (void* buffer : m_registeredBuffers)
+        {
+            azfree(buffer, AZ::SystemAllocator);
+        }
+
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s destroyed.\n", m_name.c_str());
+        }
+    }
+
+    bool StorageDriveLinuxUring::IsSupported()
+    {
+        return IoUring::IsSupported();
+    }
+
+    void StorageDriveLinuxUring::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (AZStd::holds_alternative<Requests::ReadRequestData>(request->GetCommand()))
+        {
+            auto& readRequest = AZStd::get<Requests::ReadRequestData>(request->GetCommand());
+
+            FileRequest* read = m_context->GetNewInternalRequest();
+            read->CreateRead(request, readRequest.m_output, readRequest.m_outputSize, readRequest.m_path,
+                readRequest.m_offset, readRequest.m_size);
+            m_context->PushPreparedRequest(read);
+            return;
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void StorageDriveLinuxUring::QueueRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                m_pendingReadRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData> ||
+                AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+            {
+                m_pendingRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CancelData>)
+            {
+                if (CancelRequest(request, args.m_target))
+                {
+                    // Only forward if this isn't part of the request chain, otherwise the storage device should
+                    // be the last step as it doesn't forward any (sub)requests.
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushData>)
+            {
+                FlushCache(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushAllData>)
+            {
+                FlushEntireCache();
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::ReportData>)
+            {
+                Report(args);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool StorageDriveLinuxUring::ExecuteRequests()
+    {
+        bool hasFinalizedReads = FinalizeReads();
+        bool hasWorked = false;
+
+        // Queue up as many reads as there are slots available and hand them to the kernel as a single batch.
+        while (!m_pendingReadRequests.empty())
+        {
+            FileRequest* request = m_pendingReadRequests.front();
+            if (!ReadRequest(request))
+            {
+                break;
+            }
+            m_pendingReadRequests.pop_front();
+            hasWorked = true;
+        }
+        SubmitQueuedEntries();
+
+        if (!m_pendingRequests.empty())
+        {
+            FileRequest* request = m_pendingRequests.front();
+            AZStd::visit(
+                [this, request](auto&& args)
+                {
+                    using Command = AZStd::decay_t<decltype(args)>;
+                    if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+                    {
+                        FileExistsRequest(request);
+                    }
+                    else if constexpr (AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+                    {
+                        FileMetaDataRetrievalRequest(request);
+                    }
+                    else
+                    {
+                        AZ_Assert(false, "A request was added to StorageDriveLinuxUring's pending queue that isn't supported.");
+                    }
+                },
+                request->GetCommand());
+            m_pendingRequests.pop_front();
+            hasWorked = true;
+        }
+
+        return StreamStackEntry::ExecuteRequests() || hasFinalizedReads || hasWorked;
+    }
+
+    void StorageDriveLinuxUring::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, CalculateNumAvailableSlots());
+        status.m_isIdle = status.m_isIdle && m_pendingReadRequests.empty() && m_pendingRequests.empty() && (m_activeReads_Count == 0);
+    }
+
+    void StorageDriveLinuxUring::UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now,
+        AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+        StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+        const RequestPath* activeFile = nullptr;
+        if (m_activeCacheSlot != InvalidFileCacheIndex)
+        {
+            activeFile = &m_fileCache_paths[m_activeCacheSlot];
+        }
+        u64 activeOffset = m_activeOffset;
+
+        // Determine the time of the first available slot
+        AZStd::chrono::steady_clock::time_point earliestSlot = AZStd::chrono::steady_clock::time_point::max();
+        for (size_t i = 0; i < m_readSlots.size(); ++i)
+        {
+            if (m_readSlots_active[i])
+            {
+                const ReadSlot& read = m_readSlots[i];
+                u64 totalBytesRead = m_readSizeAverage.GetTotal();
+                double totalReadTime = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+                auto readCommand = AZStd::get_if<Requests::ReadData>(&read.m_request->GetCommand());
+                AZ_Assert(readCommand, "Request currently reading doesn't contain a read command.");
+                AZStd::chrono::steady_clock::time_point endTime =
+                    read.m_startTime + Statistic::TimeValue(aznumeric_cast<u64>((readCommand->m_size * totalReadTime) / totalBytesRead));
+                earliestSlot = AZStd::min(earliestSlot, endTime);
+                read.m_request->SetEstimatedCompletion(endTime);
+            }
+        }
+        if (earliestSlot != AZStd::chrono::steady_clock::time_point::max())
+        {
+            now = earliestSlot;
+        }
+
+        // Estimate requests in this stack entry.
+        for (FileRequest* request : m_pendingReadRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+        for (FileRequest* request : m_pendingRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+
+        // Estimate internally pending requests. Because this call will go from the top of the stack to the bottom,
+        // but estimation is calculated from the bottom to the top, this list should be processed in reverse order.
+        for (auto requestIt = internalPending.rbegin(); requestIt != internalPending.rend(); ++requestIt)
+        {
+            EstimateCompletionTimeForRequest(*requestIt, now, activeFile, activeOffset);
+        }
+
+        // Estimate pending requests that have not been queued yet.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompletionTimeForRequest(*requestIt, now, activeFile, activeOffset);
+        }
+    }
+
+    void StorageDriveLinuxUring::EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::steady_clock::time_point& startTime,
+        const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        u64 readSize = 0;
+        u64 offset = 0;
+        const RequestPath* targetFile = nullptr;
+
+        AZStd::visit([&](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.m_size;
+                offset = args.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
+            {
+                targetFile = &args.m_compressionInfo.m_archiveFilename;
+                readSize = args.m_compressionInfo.m_compressedSize;
+                offset = args.m_compressionInfo.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+            {
+                readSize = 0;
+                startTime += m_getFileExistsTimeAverage.CalculateAverage();
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+            {
+                readSize = 0;
+                startTime += m_getFileMetaDataRetrievalTimeAverage.CalculateAverage();
+            }
+        }, request->GetCommand());
+
+        if (readSize > 0)
+        {
+            if (activeFile && activeFile != targetFile)
+            {
+                if (FindInFileHandleCache(*targetFile) == InvalidFileCacheIndex)
+                {
+                    startTime += m_fileOpenCloseTimeAverage.CalculateAverage();
+                }
+                activeOffset = std::numeric_limits<u64>::max();
+            }
+
+            if (activeOffset != offset && m_constructionOptions.m_hasSeekPenalty)
+            {
+                startTime += s_averageSeekTime;
+            }
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTime = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+            startTime += Statistic::TimeValue(aznumeric_cast<u64>((readSize * totalReadTime) / totalBytesRead));
+            activeOffset = offset + readSize;
+        }
+        request->SetEstimatedCompletion(startTime);
+    }
+
+    s32 StorageDriveLinuxUring::CalculateNumAvailableSlots() const
+    {
+        return (m_overCommit + aznumeric_cast<s32>(m_queueDepth)) - aznumeric_cast<s32>(m_pendingReadRequests.size()) -
+            aznumeric_cast<s32>(m_pendingRequests.size()) - m_activeReads_Count;
+    }
+
+    bool StorageDriveLinuxUring::InitializeRing()
+    {
+        if (m_ring.IsInitialized())
+        {
+            return true;
+        }
+        if (m_ringInitializationFailed)
+        {
+            return false;
+        }
+
+        // Leave room in the submission queue to cancel every active read.
+        if (!m_ring.Initialize(m_queueDepth * 2, m_constructionOptions.m_enableKernelSubmissionPolling))
+        {
+            AZ_Error("StorageDriveLinuxUring", false, "Unable to create an io_uring for %s. Reads will fail.\n", m_name.c_str());
+            m_ringInitializationFailed = true;
+            return false;
+        }
+
+        // Completions need to wake up the scheduling thread, otherwise it may go to sleep with reads in flight.
+        if (!m_ring.RegisterEventHandle(m_context->GetStreamerThreadSynchronizer().GetEventHandle()))
+        {
+            AZ_Error("StorageDriveLinuxUring", false,
+                "Unable to register the Streamer eventfd with the io_uring for %s (Error: %i). Reads will fail.\n", m_name.c_str(), errno);
+            m_ring.Shutdown();
+            m_ringInitializationFailed = true;
+            return false;
+        }
+
+        m_fileCache_lastTimeUsed.resize(m_maxFileHandles, AZStd::chrono::steady_clock::time_point::min());
+        m_fileCache_paths.resize(m_maxFileHandles);
+        m_fileCache_handles.resize(m_maxFileHandles, -1);
+        m_fileCache_activeReads.resize(m_maxFileHandles, 0);
+        m_fileCache_isDirect.resize(m_maxFileHandles, false);
+        m_readSlots.resize(m_queueDepth);
+        m_readSlots_active.resize(m_queueDepth, false);
+        m_cachesInitialized = true;
+
+        // Registering the file handles avoids the kernel having to look up and reference count the file for every read.
+        m_usesRegisteredFiles = m_ring.RegisterFiles(m_maxFileHandles);
+        AZ_Warning("StorageDriveLinuxUring", m_usesRegisteredFiles || m_constructionOptions.m_minimalReporting,
+            "Unable to register file handles with the io_uring for %s. Falling back to regular file handles.\n", m_name.c_str());
+
+        // Unbuffered reads that aren't aligned have to go through an intermediate buffer. Registering those with the kernel
+        // avoids the kernel having to map the pages for every read.
+        if (m_constructionOptions.m_enableUnbufferedReads && m_registeredBufferSize > 0)
+        {
+            AZStd::vector<iovec> buffers;
+            buffers.reserve(m_queueDepth);
+            m_registeredBuffers.reserve(m_queueDepth);
+            for (u32 i = 0; i < m_queueDepth; ++i)
+            {
+                void* buffer = azmalloc(m_registeredBufferSize, m_physicalSectorSize, AZ::SystemAllocator);
+                m_registeredBuffers.push_back(buffer);
+                buffers.push_back(iovec{ buffer, m_registeredBufferSize });
+            }
+            m_usesRegisteredBuffers = m_ring.RegisterBuffers(buffers.data(), aznumeric_cast<u32>(buffers.size()));
+            if (!m_usesRegisteredBuffers)
+            {
+                // Registered buffers count towards the locked memory limit (RLIMIT_MEMLOCK), which can be low in containers.
+                AZ_Warning("StorageDriveLinuxUring", m_constructionOptions.m_minimalReporting,
+                    "Unable to register %u buffers of %zu bytes with the io_uring for %s. Falling back to temporary allocations.\n",
+                    m_queueDepth, m_registeredBufferSize, m_name.c_str());
+                for (void* buffer : m_registeredBuffers)
+                {
+                    azfree(buffer, AZ::SystemAllocator);
+                }
+                m_registeredBuffers.clear();
+            }
+        }
+        return true;
+    }
+
+    auto StorageDriveLinuxUring::OpenFile(size_t& cacheSlot, FileRequest* request, const Requests::ReadData& data) -> OpenFileResult
+    {
+        // If the file is already opened for use, use that file handle and update it's last touched time.
+        size_t cacheIndex = FindInFileHandleCache(data.m_path);
+        if (cacheIndex == InvalidFileCacheIndex)
+        {
+            // If the file is not already found in the cache, attempt to claim an available cache entry.
+            cacheIndex = FindAvailableFileHandleCacheIndex();
+            if (cacheIndex == InvalidFileCacheIndex)
+            {
+                // No files ready to be evicted.
+                return OpenFileResult::CacheFull;
+            }
+
+            int file = -1;
+            bool isDirect = false;
+            {
+                AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinuxUring::ReadRequest OpenFile %s", m_name.c_str());
+                TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
+
+                int openFlags = O_RDONLY | O_CLOEXEC;
+                if (m_constructionOptions.m_enableUnbufferedReads)
+                {
+                    file = ::open(data.m_path.GetAbsolutePathCStr(), openFlags | O_DIRECT);
+                    isDirect = file >= 0;
+                }
+                if (file < 0)
+                {
+                    // Either unbuffered reads are disabled or the file system doesn't support O_DIRECT, such as tmpfs.
+                    file = ::open(data.m_path.GetAbsolutePathCStr(), openFlags);
+                }
+                if (file < 0)
+                {
+                    // Failed to open the file, so let the next entry in the stack try.
+                    StreamStackEntry::QueueRequest(request);
+                    return OpenFileResult::RequestForwarded;
+                }
+
+                if (m_usesRegisteredFiles && !m_ring.UpdateRegisteredFile(aznumeric_cast<u32>(cacheIndex), file))
+                {
+                    AZ_Warning("StorageDriveLinuxUring", false, "Failed to register file '%s' with the io_uring. (Error: %i)\n",
+                        data.m_path.GetRelativePathCStr(), errno);
+                    ::close(file);
+                    StreamStackEntry::QueueRequest(request);
+                    return OpenFileResult::RequestForwarded;
+                }
+
+                if (m_fileCache_handles[cacheIndex] >= 0)
+                {
+                    // The registered file slot has already been overwritten so the kernel no longer references the old file.
+                    ::close(m_fileCache_handles[cacheIndex]);
+                }
+            }
+
+            // Fill the cache entry with data about the new file.
+            m_fileCache_handles[cacheIndex] = file;
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_isDirect[cacheIndex] = isDirect;
+            m_fileCache_paths[cacheIndex] = data.m_path;
+        }
+
+        // Set the current request and update timestamp, regardless of cache hit or miss.
+        m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::steady_clock::now();
+        cacheSlot = cacheIndex;
+        return OpenFileResult::FileOpened;
+    }
+
+    bool StorageDriveLinuxUring::ReadRequest(FileRequest* request)
+    {
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinuxUring::ReadRequest %s", m_name.c_str());
+
+        if (!InitializeRing())
+        {
+            StreamStackEntry::QueueRequest(request);
+            return true;
+        }
+
+        if (m_activeReads_Count >= m_queueDepth)
+        {
+            return false;
+        }
+
+        auto data = AZStd::get_if<Requests::ReadData>(&request->GetCommand());
+        AZ_Assert(data, "Read request in StorageDriveLinuxUring doesn't contain read data.");
+
+        size_t fileCacheSlot = InvalidFileCacheIndex;
+        switch (OpenFile(fileCacheSlot, request, *data))
+        {
+        case OpenFileResult::FileOpened:
+            break;
+        case OpenFileResult::RequestForwarded:
+            return true;
+        case OpenFileResult::CacheFull:
+            return false;
+        default:
+            AZ_Assert(false, "Unsupported OpenFileRequest returned.");
+        }
+
+        io_uring_sqe* entry = m_ring.GetSubmissionEntry();
+        if (!entry)
+        {
+            // The submission queue is full, so hand what's there to the kernel and try again during the next update.
+            return false;
+        }
+
+        size_t readSlot = FindAvailableReadSlot();
+        AZ_Assert(readSlot != InvalidReadSlotIndex, "Active read count indicates there's a read slot available, but no read slot was found.");
+        ReadSlot& slot = m_readSlots[readSlot];
+        slot.m_request = request;
+        slot.m_fileHandleIndex = fileCacheSlot;
+
+        u64 readSize = data->m_size;
+        u64 readOffset = data->m_offset;
+        void* output = data->m_output;
+
+        // Files that successfully opened with O_DIRECT have alignment restrictions on the address, offset and size.
+        if (m_fileCache_isDirect[fileCacheSlot])
+        {
+            const bool alignedAddr = IStreamerTypes::IsAlignedTo(data->m_output, aznumeric_caster(m_physicalSectorSize));
+            const bool alignedOffs = IStreamerTypes::IsAlignedTo(data->m_offset, aznumeric_caster(m_logicalSectorSize));
+
+            // See StorageDriveWin::ReadRequest for a description of how misaligned reads are adjusted.
+            if (!alignedOffs)
+            {
+                readOffset = AZ_SIZE_ALIGN_DOWN(readOffset, m_logicalSectorSize);
+                slot.m_copyBackOffset = data->m_offset - readOffset;
+                readSize = data->m_size + slot.m_copyBackOffset;
+            }
+
+            bool alignedSize = IStreamerTypes::IsAlignedTo(readSize, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedSize)
+            {
+                u64 alignedReadSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (alignedReadSize <= data->m_outputSize)
+                {
+                    alignedSize = true;
+                    readSize = alignedReadSize;
+                }
+            }
+
+            const bool isAligned = (alignedAddr && alignedSize && alignedOffs);
+            if (!isAligned)
+            {
+                readSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (m_usesRegisteredBuffers && readSize <= m_registeredBufferSize)
+                {
+                    slot.m_usesRegisteredBuffer = true;
+                    output = m_registeredBuffers[readSlot];
+                }
+                else
+                {
+                    slot.AllocateAlignedBuffer(readSize, m_physicalSectorSize);
+                    output = slot.m_sectorAlignedOutput;
+                }
+            }
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            m_directReadsPercentageStat.PushSample(isAligned ? 1.0 : 0.0);
+            Statistic::PlotImmediate(m_name, DirectReadsName, m_directReadsPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        }
+
+        AZ_Assert(readSize <= std::numeric_limits<u32>::max(), "Read is too large for a single io_uring read.");
+        entry->opcode = slot.m_usesRegisteredBuffer ? IORING_OP_READ_FIXED : IORING_OP_READ;
+        if (m_usesRegisteredFiles)
+        {
+            entry->flags |= IOSQE_FIXED_FILE;
+            entry->fd = aznumeric_cast<s32>(fileCacheSlot);
+        }
+        else
+        {
+            entry->fd = m_fileCache_handles[fileCacheSlot];
+        }
+        entry->addr = reinterpret_cast<u64>(output);
+        entry->len = aznumeric_cast<u32>(readSize);
+        entry->off = readOffset;
+        entry->buf_index = slot.m_usesRegisteredBuffer ? aznumeric_cast<u16>(readSlot) : 0;
+        entry->user_data = readSlot;
+        m_queuedSubmissions++;
+
+        auto now = AZStd::chrono::steady_clock::now();
+        if (m_activeReads_Count++ == 0)
+        {
+            m_activeReads_startTime = now;
+        }
+        slot.m_startTime = now;
+        m_readSlots_active[readSlot] = true;
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        if (m_activeCacheSlot == fileCacheSlot)
+        {
+            m_fileSwitchPercentageStat.PushSample(0.0);
+            m_seekPercentageStat.PushSample(m_activeOffset == data->m_offset ? 0.0 : 1.0);
+        }
+        else
+        {
+            m_fileSwitchPercentageStat.PushSample(1.0);
+            m_seekPercentageStat.PushSample(0.0);
+        }
+
+        Statistic::PlotImmediate(m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetMostRecentSample());
+        Statistic::PlotImmediate(m_name, SeeksName, m_seekPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+        m_fileCache_activeReads[fileCacheSlot]++;
+        m_activeCacheSlot = fileCacheSlot;
+        m_activeOffset = readOffset + readSize;
+
+        return true;
+    }
+
+    void StorageDriveLinuxUring::SubmitQueuedEntries()
+    {
+        if (m_queuedSubmissions > 0)
+        {
+            AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinuxUring::SubmitQueuedEntries %s", m_name.c_str());
+
+            int result = m_ring.Submit();
+            if (result >= 0)
+            {
+                m_submissionBatchSizeAverage.PushEntry(m_queuedSubmissions);
+                m_queuedSubmissions = 0;
+            }
+            else
+            {
+                // Entries that weren't consumed stay in the submission queue and will be submitted again with the next batch.
+                AZ_Warning("StorageDriveLinuxUring", result == -EAGAIN || result == -EBUSY,
+                    "Failed to submit %u entries to the io_uring for %s (Error: %s).\n", m_queuedSubmissions, m_name.c_str(),
+                    ::strerror(-result));
+            }
+        }
+    }
+
+    bool StorageDriveLinuxUring::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        bool ownsRequestChain = false;
+        for (auto it = m_pendingReadRequests.begin(); it != m_pendingReadRequests.end();)
+        {
+            if ((*it)->WorksOn(target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingReadRequests.erase(it);
+                ownsRequestChain = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Pending requests have been accounted for, now ask the kernel to cancel any active reads. The reads will still post
+        // a completion, which will be picked up by FinalizeReads, so there's no further bookkeeping needed here.
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            if (m_readSlots_active[readSlot] && m_readSlots[readSlot].m_request->WorksOn(target))
+            {
+                ownsRequestChain = true;
+                if (io_uring_sqe* entry = m_ring.GetSubmissionEntry(); entry != nullptr)
+                {
+                    entry->opcode = IORING_OP_ASYNC_CANCEL;
+                    entry->fd = -1;
+                    entry->addr = readSlot;
+                    entry->user_data = CancelSubmissionTag | readSlot;
+                    m_queuedSubmissions++;
+                }
+            }
+        }
+        SubmitQueuedEntries();
+
+        if (ownsRequestChain)
+        {
+            cancelRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(cancelRequest);
+        }
+
+        return ownsRequestChain;
+    }
+
+    void StorageDriveLinuxUring::FileExistsRequest(FileRequest* request)
+    {
+        auto& fileExists = AZStd::get<Requests::FileExistsCheckData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinuxUring::FileExistsRequest %s : %s",
+            m_name.c_str(), fileExists.m_path.GetRelativePathCStr());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileExistsTimeAverage);
+
+        if (FindInFileHandleCache(fileExists.m_path) != InvalidFileCacheIndex ||
+            FindInMetaDataCache(fileExists.m_path) != InvalidMetaDataCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat fileInfo;
+        if (::stat(fileExists.m_path.GetAbsolutePathCStr(), &fileInfo) == 0)
+        {
+            fileExists.m_found = S_ISREG(fileInfo.st_mode);
+            if (fileExists.m_found)
+            {
+                size_t cacheIndex = GetNextMetaDataCacheSlot();
+                m_metaDataCache_paths[cacheIndex] = fileExists.m_path;
+                m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(fileInfo.st_size);
+            }
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    void StorageDriveLinuxUring::FileMetaDataRetrievalRequest(FileRequest* request)
+    {
+        auto& command = AZStd::get<Requests::FileMetaDataRetrievalData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinuxUring::FileMetaDataRetrievalRequest %s : %s",
+            m_name.c_str(), command.m_path.GetRelativePathCStr());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileMetaDataRetrievalTimeAverage);
+
+        size_t cacheIndex = FindInMetaDataCache(command.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            command.m_fileSize = m_metaDataCache_fileSize[cacheIndex];
+            command.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat fileInfo;
+        cacheIndex = FindInFileHandleCache(command.m_path);
+        // If the file is already open, use the file handle which is cheaper than asking for the file by name.
+        int result = cacheIndex != InvalidFileCacheIndex
+            ? ::fstat(m_fileCache_handles[cacheIndex], &fileInfo)
+            : ::stat(command.m_path.GetAbsolutePathCStr(), &fileInfo);
+        if (result != 0 || !S_ISREG(fileInfo.st_mode))
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        command.m_fileSize = aznumeric_caster(fileInfo.st_size);
+        command.m_found = true;
+
+        cacheIndex = GetNextMetaDataCacheSlot();
+        m_metaDataCache_paths[cacheIndex] = command.m_path;
+        m_metaDataCache_fileSize[cacheIndex] = command.m_fileSize;
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void StorageDriveLinuxUring::CloseFileHandle(size_t cacheIndex)
+    {
+        if (m_fileCache_handles[cacheIndex] >= 0)
+        {
+            AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Flushing '%s' but it has %u active reads\n",
+                m_fileCache_paths[cacheIndex].GetRelativePathCStr(), m_fileCache_activeReads[cacheIndex]);
+            if (m_usesRegisteredFiles)
+            {
+                m_ring.UpdateRegisteredFile(aznumeric_cast<u32>(cacheIndex), -1);
+            }
+            ::close(m_fileCache_handles[cacheIndex]);
+            m_fileCache_handles[cacheIndex] = -1;
+        }
+        m_fileCache_activeReads[cacheIndex] = 0;
+        m_fileCache_isDirect[cacheIndex] = false;
+        m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::steady_clock::time_point();
+        m_fileCache_paths[cacheIndex].Clear();
+        if (m_activeCacheSlot == cacheIndex)
+        {
+            m_activeCacheSlot = InvalidFileCacheIndex;
+        }
+    }
+
+    void StorageDriveLinuxUring::FlushCache(const RequestPath& filePath)
+    {
+        if (m_cachesInitialized)
+        {
+            size_t cacheIndex = FindInFileHandleCache(filePath);
+            if (cacheIndex != InvalidFileCacheIndex)
+            {
+                CloseFileHandle(cacheIndex);
+            }
+        }
+
+        size_t cacheIndex = FindInMetaDataCache(filePath);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            m_metaDataCache_paths[cacheIndex].Clear();
+            m_metaDataCache_fileSize[cacheIndex] = 0;
+        }
+    }
+
+    void StorageDriveLinuxUring::FlushEntireCache()
+    {
+        if (m_cachesInitialized)
+        {
+            for (size_t cacheIndex = 0; cacheIndex < m_maxFileHandles; ++cacheIndex)
+            {
+                CloseFileHandle(cacheIndex);
+            }
+        }
+
+        auto metaDataCacheSize = m_metaDataCache_paths.size();
+        m_metaDataCache_paths.clear();
+        m_metaDataCache_fileSize.clear();
+        m_metaDataCache_front = 0;
+        m_metaDataCache_paths.resize(metaDataCacheSize);
+        m_metaDataCache_fileSize.resize(metaDataCacheSize);
+    }
+
+    bool StorageDriveLinuxUring::FinalizeReads()
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        if (m_activeReads_Count == 0)
+        {
+            return false;
+        }
+
+        // Completions are read directly from the shared completion ring and don't require a system call.
+        bool hasWorked = false;
+        while (io_uring_cqe* completion = m_ring.PeekCompletion())
+        {
+            u64 userData = completion->user_data;
+            s32 result = completion->res;
+            m_ring.ReleaseCompletion();
+
+            if ((userData & CancelSubmissionTag) == 0)
+            {
+                FinalizeSingleRequest(aznumeric_cast<size_t>(userData), result);
+                hasWorked = true;
+            }
+            // Completions for cancel submissions can be ignored as the canceled read will post its own completion.
+        }
+        return hasWorked;
+    }
+
+    void StorageDriveLinuxUring::FinalizeSingleRequest(size_t readSlot, s32 result)
+    {
+        AZ_Assert(m_readSlots_active[readSlot], "Received an io_uring completion for read slot %zu which isn't active.", readSlot);
+
+        u64 numBytesTransferred = result > 0 ? aznumeric_cast<u64>(result) : 0;
+        bool isCanceled = (result == -ECANCELED || result == -EINTR);
+        bool encounteredError = (result < 0) && !isCanceled;
+        AZ_Error("StorageDriveLinuxUring", !encounteredError, "Async file read operation completed with error: %s\n", ::strerror(-result));
+
+        m_activeReads_ByteCount += numBytesTransferred;
+        if (--m_activeReads_Count == 0)
+        {
+            // Update read stats now that the operation is done.
+            m_readSizeAverage.PushEntry(m_activeReads_ByteCount);
+            m_readTimeAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                AZStd::chrono::steady_clock::now() - m_activeReads_startTime));
+
+            m_activeReads_ByteCount = 0;
+        }
+
+        ReadSlot& slot = m_readSlots[readSlot];
+        auto readCommand = AZStd::get_if<Requests::ReadData>(&slot.m_request->GetCommand());
+        AZ_Assert(readCommand != nullptr, "Request stored with the io_uring read did not contain a read request.");
+
+        // The request could be reading more due to alignment requirements. It should however never read less that the amount of
+        // requested data.
+        bool isSuccess = !encounteredError && !isCanceled && (slot.m_copyBackOffset + readCommand->m_size <= numBytesTransferred);
+
+        void* intermediateBuffer = slot.m_usesRegisteredBuffer ? m_registeredBuffers[readSlot] : slot.m_sectorAlignedOutput;
+        if (intermediateBuffer && isSuccess)
+        {
+            auto offsetAddress = reinterpret_cast<u8*>(intermediateBuffer) + slot.m_copyBackOffset;
+            ::memcpy(readCommand->m_output, offsetAddress, readCommand->m_size);
+        }
+
+        slot.m_request->SetStatus(
+            isCanceled
+                ? IStreamerTypes::RequestStatus::Canceled
+                : isSuccess
+                    ? IStreamerTypes::RequestStatus::Completed
+                    : IStreamerTypes::RequestStatus::Failed
+        );
+        m_context->MarkRequestAsCompleted(slot.m_request);
+
+        m_fileCache_activeReads[slot.m_fileHandleIndex]--;
+        m_readSlots_active[readSlot] = false;
+        slot.Clear();
+    }
+
+    size_t StorageDriveLinuxUring::FindInFileHandleCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_fileCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_fileCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidFileCacheIndex;
+    }
+
+    size_t StorageDriveLinuxUring::FindAvailableFileHandleCacheIndex() const
+    {
+        AZ_Assert(m_cachesInitialized, "Using file cache before it has been (lazily) initialized\n");
+
+        // This needs to look for files with no active reads, and the oldest file among those.
+        size_t cacheIndex = InvalidFileCacheIndex;
+        AZStd::chrono::steady_clock::time_point oldest = AZStd::chrono::steady_clock::time_point::max();
+        for (size_t index = 0; index < m_maxFileHandles; ++index)
+        {
+            if (m_fileCache_activeReads[index] == 0 && m_fileCache_lastTimeUsed[index] < oldest)
+            {
+                oldest = m_fileCache_lastTimeUsed[index];
+                cacheIndex = index;
+            }
+        }
+
+        return cacheIndex;
+    }
+
+    size_t StorageDriveLinuxUring::FindAvailableReadSlot() const
+    {
+        for (size_t i = 0; i < m_readSlots_active.size(); ++i)
+        {
+            if (!m_readSlots_active[i])
+            {
+                return i;
+            }
+        }
+        return InvalidReadSlotIndex;
+    }
+
+    size_t StorageDriveLinuxUring::FindInMetaDataCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_metaDataCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_metaDataCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidMetaDataCacheIndex;
+    }
+
+    size_t StorageDriveLinuxUring::GetNextMetaDataCacheSlot()
+    {
+        m_metaDataCache_front = (m_metaDataCache_front + 1) & (m_metaDataCache_paths.size() - 1);
+        return m_metaDataCache_front;
+    }
+
+    void StorageDriveLinuxUring::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        if (m_cachesInitialized)
+        {
+            using DoubleSeconds = AZStd::chrono::duration<double>;
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+            statistics.push_back(Statistic::CreateBytesPerSecond(m_name, "Read Speed", totalBytesRead / totalReadTimeSec,
+                "The average read speed this drive achieved. This is the maximum achievable speed for reading from disk. If this is "
+                "lower than expected it may indicate that the queue depth is too low to saturate the drive, other applications are "
+                "using the same drive or the reads are too small."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "File Open & Close", m_fileOpenCloseTimeAverage.CalculateAverage(), m_fileOpenCloseTimeAverage.GetMinimum(),
+                m_fileOpenCloseTimeAverage.GetMaximum(),
+                "The average amount of time needed to open and close file handles. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "Get file exists", m_getFileExistsTimeAverage.CalculateAverage(),
+                m_getFileExistsTimeAverage.GetMinimum(), m_getFileExistsTimeAverage.GetMaximum(),
+                "The average amount of time needed to check if a file exists. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "Get file meta data", m_getFileMetaDataRetrievalTimeAverage.CalculateAverage(),
+                m_getFileMetaDataRetrievalTimeAverage.GetMinimum(), m_getFileMetaDataRetrievalTimeAverage.GetMaximum(),
+                "The average amount of time in microseconds needed to retrieve file information. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateFloat(
+                m_name, "Submission batch size", m_submissionBatchSizeAverage.CalculateAverage(),
+                "The average number of entries that were handed to the kernel with a single submission. Higher values mean fewer "
+                "system calls per read. If this is close to one, the scheduler isn't providing enough requests to batch."));
+
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateNumAvailableSlots(),
+                "The total number of available slots to queue requests on. The lower this number, the more active this node is. A small "
+                "number is ideal as it means there are a few requests available for immediate processing next once a request "
+                "completes. If this is value is often negative then increasing the over-commit value, but keep in mind that too many "
+                "over-committed reduces the ability of scheduler to order requests."));
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            statistics.push_back(Statistic::CreatePercentageRange(
+                m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetAverage(), m_fileSwitchPercentageStat.GetMinimum(),
+                m_fileSwitchPercentageStat.GetMaximum(),
+                "The percentage of file requests that required switching to a different file. When running from loose file this should be "
+                "close to 100% as that would indicate mostly full file reads. When running from archives this should be as close to 0 as "
+                "possible as that would indicate efficiently running from archives."));
+            statistics.push_back(Statistic::CreatePercentageRange(
+                m_name, SeeksName, m_seekPercentageStat.GetAverage(), m_seekPercentageStat.GetMinimum(), m_seekPercentageStat.GetMaximum(),
+                "The percentage of file reads that required seeking within a file. For loose files this should be lose to zero to indicate "
+                "no partial file reads. For archives this value is typically high, which is not a problem, but lower values indicate more "
+                "efficient scheduling and archive layout which will result in better hardware cache utilization."));
+            statistics.push_back(Statistic::CreatePercentageRange(
+                m_name, DirectReadsName, m_directReadsPercentageStat.GetAverage(), m_directReadsPercentageStat.GetMinimum(),
+                m_directReadsPercentageStat.GetMaximum(),
+                "The percentage of unbuffered reads that did not require any additional aligning. If this number isn't close to 100 "
+                "percent performance will suffer as data needs to be copied from intermediate buffers. The best way to avoid this is by "
+                "adding a block cache and/or read splitter in front of this node."));
+#endif
+        }
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void StorageDriveLinuxUring::Report(const Requests::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case IStreamerTypes::ReportType::Config:
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max file handles", m_maxFileHandles,
+                "The maximum number of file handles this drive node will cache. Increasing this will allow files that are read "
+                "multiple times to be processed faster. It's recommended to have this set to at least the largest number of archives "
+                "that can be in use at the same time."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max meta data cache", m_metaDataCache_paths.size(),
+                "The maximum number of meta data like file sizes this drive node will cache."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Physical sector size", m_physicalSectorSize,
+                "The memory alignment used for unbuffered reads."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Logical sector size", m_logicalSectorSize,
+                "The alignment of file offsets and read sizes used for unbuffered reads."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Queue depth", m_queueDepth, "The maximum number of reads that are in flight at the same time."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Registered buffer size", m_registeredBufferSize,
+                "The size of the intermediate buffers registered with the io_uring for unbuffered reads that aren't aligned."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Overcommit", m_overCommit,
+                "The number of additional requests this node will accept. Higher numbers means that drives don't have to wait for the "
+                "scheduler to provide new request to process and the next request can immediately start reading. If this value is too "
+                "high though it will negatively impact the scheduler's ability to order and prioritize requests, which can lead to "
+                "poorer hardware and software cache performance and slower cancellations, among others."));
+            data.m_output.push_back(Statistic::CreateBoolean(
+                m_name, "Has seek penalty", m_constructionOptions.m_hasSeekPenalty,
+                "Whether or not the hardware has a penalty for seeking. This refers to drives that need to physically position a read "
+                "head to retrieve data, which can cause additional seek times for non-consecutive reads."));
+            data.m_output.push_back(Statistic::CreateBoolean(
+                m_name, "Unbuffered reads enabled", m_constructionOptions.m_enableUnbufferedReads,
+                "Whether or not this drive will bypass the page cache by opening files with O_DIRECT."));
+            data.m_output.push_back(Statistic::CreateBoolean(
+                m_name, "Kernel submission polling", m_constructionOptions.m_enableKernelSubmissionPolling,
+                "Whether or not a kernel thread polls for new reads instead of the drive issuing a system call per batch."));
+            data.m_output.push_back(Statistic::CreateBoolean(
+                m_name, "Registered files", m_usesRegisteredFiles, "Whether or not file handles are registered with the io_uring."));
+            data.m_output.push_back(Statistic::CreateBoolean(
+                m_name, "Registered buffers", m_usesRegisteredBuffers,
+                "Whether or not intermediate buffers are registered with the io_uring."));
+            data.m_output.push_back(Statistic::CreateBoolean(
+                m_name, "Minimal reporting", m_constructionOptions.m_minimalReporting,
+                "Whether or not this node only reports issues or reports all information."));
+            data.m_output.push_back(Statistic::CreateReferenceString(
+                m_name, "Next node", m_next ? AZStd::string_view(m_next->GetName()) : AZStd::string_view("<None>"),
+                "The name of the node that follows this node or none."));
+            break;
+        case IStreamerTypes::ReportType::FileLocks:
+            if (m_cachesInitialized)
+            {
+                for (u32 i = 0; i < m_maxFileHandles; ++i)
+                {
+                    if (m_fileCache_handles[i] >= 0)
+                    {
+                        data.m_output.push_back(
+                            Statistic::CreatePersistentString(m_name, "File lock", m_fileCache_paths[i].GetRelativePath().Native()));
+                    }
+                }
+            }
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <dirent.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/std/string/fixed_string.h>
+
+namespace AZ::IO
+{
+    static bool ReadBlockDeviceValue(const char* device, const char* property, size_t& value)
+    {
+        AZStd::fixed_string<256> path = AZStd::fixed_string<256>::format("/sys/block/%s/queue/%s", device, property);
+        FILE* file = ::fopen(path.c_str(), "r");
+        if (!file)
+        {
+            return false;
+        }
+        unsigned long long readValue = 0;
+        bool result = ::fscanf(file, "%llu", &readValue) == 1;
+        ::fclose(file);
+        value = aznumeric_caster(readValue);
+        return result;
+    }
+
+    bool CollectIoHardwareInformation(HardwareInformation& info, [[maybe_unused]] bool includeAllHardware, bool reportHardware)
+    {
+        // Start from the same defaults as the generic implementation and widen them to what's reported by the block devices.
+        info.m_maxPageSize = AZStd::max(aznumeric_cast<size_t>(::sysconf(_SC_PAGESIZE)), size_t{ 4096 });
+        info.m_maxTransfer = 512_kib;
+        info.m_maxPhysicalSectorSize = 4096;
+        info.m_maxLogicalSectorSize = 512;
+        info.m_profile = "Generic";
+
+        DIR* blockDevices = ::opendir("/sys/block");
+        if (!blockDevices)
+        {
+            return true;
+        }
+
+        while (dirent* entry = ::readdir(blockDevices))
+        {
+            const char* device = entry->d_name;
+            // Skip the directory entries and virtual devices that don't represent storage the Streamer reads from.
+            if (device[0] == '.' || ::strncmp(device, "loop", 4) == 0 || ::strncmp(device, "ram", 3) == 0 ||
+                ::strncmp(device, "zram", 4) == 0)
+            {
+                continue;
+            }
+
+            size_t physicalSectorSize = 0;
+            size_t logicalSectorSize = 0;
+            size_t maxTransferKib = 0;
+            size_t isRotational = 0;
+            bool hasPhysical = ReadBlockDeviceValue(device, "physical_block_size", physicalSectorSize);
+            bool hasLogical = ReadBlockDeviceValue(device, "logical_block_size", logicalSectorSize);
+            bool hasTransfer = ReadBlockDeviceValue(device, "max_sectors_kb", maxTransferKib);
+            ReadBlockDeviceValue(device, "rotational", isRotational);
+
+            if (hasPhysical && IStreamerTypes::IsPowerOf2(physicalSectorSize))
+            {
+                info.m_maxPhysicalSectorSize = AZStd::max(info.m_maxPhysicalSectorSize, physicalSectorSize);
+            }
+            if (hasLogical && IStreamerTypes::IsPowerOf2(logicalSectorSize))
+            {
+                info.m_maxLogicalSectorSize = AZStd::max(info.m_maxLogicalSectorSize, logicalSectorSize);
+            }
+            if (hasTransfer)
+            {
+                info.m_maxTransfer = AZStd::max(info.m_maxTransfer, maxTransferKib * 1024);
+            }
+
+            if (reportHardware)
+            {
+                AZ_Trace(
+                    "Streamer",
+                    "Block device '%s':\n"
+                    "    Physical sector size: %zu\n"
+                    "    Logical sector size: %zu\n"
+                    "    Max transfer: %zu kb\n"
+                    "    Rotational: %s\n",
+                    device, physicalSectorSize, logicalSectorSize, maxTransferKib, isRotational ? "yes" : "no");
+            }
+        }
+        ::closedir(blockDevices);
+        return true;
+    }
+
+    void ReflectNative(ReflectContext* context)
+    {
+        LinuxUringStorageDriveConfig::Reflect(context);
+    }
+} // namespace AZ::IO
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <AzCore/IO/Streamer/StreamerContext_Linux.h>
+#include <AzCore/Debug/Trace.h>
+
+namespace AZ::Platform
+{
+    StreamerContextThreadSync::StreamerContextThreadSync()
+    {
+        m_eventHandle = ::eventfd(0, EFD_CLOEXEC);
+        AZ_Assert(m_eventHandle >= 0, "Failed to create a required eventfd for IO Scheduler (Error: %i).", errno);
+    }
+
+    StreamerContextThreadSync::~StreamerContextThreadSync()
+    {
+        if (m_eventHandle >= 0)
+        {
+            ::close(m_eventHandle);
+        }
+    }
+
+    void StreamerContextThreadSync::Suspend()
+    {
+        AZ_Assert(m_eventHandle >= 0, "There is no eventfd created for the main streamer thread to use to suspend.");
+
+        // Reading from a blocking eventfd waits until the counter is non-zero and then resets it to zero, which
+        // collapses any number of queued wake up calls into a single one.
+        eventfd_t value = 0;
+        while (::eventfd_read(m_eventHandle, &value) != 0)
+        {
+            if (errno != EINTR)
+            {
+                AZ_Assert(false, "Unexpected failure while waiting for the IO Scheduler eventfd (Error: %i).", errno);
+                return;
+            }
+        }
+    }
+
+    void StreamerContextThreadSync::Resume()
+    {
+        AZ_Assert(m_eventHandle >= 0, "There is no eventfd created for the main streamer thread to use to resume.");
+        [[maybe_unused]] int result = ::eventfd_write(m_eventHandle, 1);
+        AZ_Assert(result == 0, "Failed to signal the IO Scheduler eventfd (Error: %i).", errno);
+    }
+
+    int StreamerContextThreadSync::GetEventHandle() const
+    {
+        return m_eventHandle;
+    }
+} // namespace AZ::Platform
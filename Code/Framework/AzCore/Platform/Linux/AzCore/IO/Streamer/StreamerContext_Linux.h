@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ::Platform
+{
+    //! Synchronization for the Streamer scheduling thread that is built on top of an eventfd. Using a file descriptor
+    //! instead of a condition variable allows the kernel to wake the scheduling thread up directly, for instance when
+    //! an io_uring has completed a read, without the need for an additional thread to relay the signal.
+    class StreamerContextThreadSync
+    {
+    public:
+        StreamerContextThreadSync();
+        ~StreamerContextThreadSync();
+
+        void Suspend();
+        void Resume();
+
+        //! Gets the eventfd that's used to wake up the scheduling thread. Writing to this descriptor, either directly or
+        //! through a kernel facility such as IORING_REGISTER_EVENTFD, will resume the scheduling thread.
+        int GetEventHandle() const;
+
+    private:
+        int m_eventHandle{ -1 };
+    };
+
+} // namespace AZ::Platform
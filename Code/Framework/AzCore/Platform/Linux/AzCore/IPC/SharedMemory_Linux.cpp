@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "SharedMemory_Linux.h"
+#include <AzCore/IPC/SharedMemory.h>
+
+#include <sys/types.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+namespace AZ
+{
+    namespace SharedMemoryInternal
+    {
+        // POSIX shared memory names have to start with a slash and can't contain any others.
+        static void ComposeName(char* dest, size_t length, const char* name)
+        {
+            azsnprintf(dest, length, "/%s_Data", name);
+            for (char* c = dest + 1; *c != 0; ++c)
+            {
+                if (*c == '/')
+                {
+                    *c = '_';
+                }
+            }
+        }
+
+        static bool LockRange(int handle, short type, bool wait)
+        {
+            struct flock lockInfo{};
+            lockInfo.l_type = type;
+            lockInfo.l_whence = SEEK_SET;
+            lockInfo.l_start = 0;
+            lockInfo.l_len = 1;
+            int result;
+            do
+            {
+                result = fcntl(handle, wait ? F_OFD_SETLKW : F_OFD_SETLK, &lockInfo);
+            } while (result == -1 && errno == EINTR);
+            return result == 0;
+        }
+    } // namespace SharedMemoryInternal
+
+    SharedMemory_Linux::SharedMemory_Linux()
+        : m_mapHandle(-1)
+    {
+    }
+
+    int SharedMemory_Linux::GetLastError()
+    {
+        return errno;
+    }
+
+    SharedMemory_Common::CreateResult SharedMemory_Linux::Create(const char* name, unsigned int size, bool openIfCreated)
+    {
+        char fullName[256];
+        azstrncpy(m_name, AZ_ARRAY_SIZE(m_name), name, strlen(name));
+        SharedMemoryInternal::ComposeName(fullName, AZ_ARRAY_SIZE(fullName), name);
+
+        bool createdNew = true;
+        m_mapHandle = shm_open(fullName, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+        int error = errno;
+        if (m_mapHandle == -1 && error == EEXIST)
+        {
+            if (!openIfCreated)
+            {
+                AZ_TracePrintf("AZSystem", "CreateFileMapping failed with error %d\n", error);
+                return CreateFailed;
+            }
+            createdNew = false;
+            m_mapHandle = shm_open(fullName, O_RDWR | O_CLOEXEC, 0600);
+            error = errno;
+        }
+        if (m_mapHandle == -1)
+        {
+            AZ_TracePrintf("AZSystem", "CreateFileMapping failed with error %d\n", error);
+            return CreateFailed;
+        }
+
+        // Register as a user of the shared memory so the last one to close it knows to remove it.
+        flock(m_mapHandle, LOCK_SH);
+
+        if (createdNew && ftruncate(m_mapHandle, size) != 0)
+        {
+            AZ_TracePrintf("AZSystem", "CreateFileMapping failed to resize to %u bytes with error %d\n", size, GetLastError());
+            Close();
+            return CreateFailed;
+        }
+
+        m_globalMutex = AZStd::make_unique<AZStd::mutex>();
+        return createdNew ? CreatedNew : CreatedExisting;
+    }
+
+    bool SharedMemory_Linux::Open(const char* name)
+    {
+        char fullName[256];
+        azstrncpy(m_name, AZ_ARRAY_SIZE(m_name), name, strlen(name));
+        SharedMemoryInternal::ComposeName(fullName, AZ_ARRAY_SIZE(fullName), name);
+
+        m_mapHandle = shm_open(fullName, O_RDWR | O_CLOEXEC, 0600);
+        if (m_mapHandle == -1)
+        {
+            AZ_TracePrintf("AZSystem", "OpenFileMapping %s failed with error %d\n", m_name, errno);
+            return false;
+        }
+        flock(m_mapHandle, LOCK_SH);
+
+        m_globalMutex = AZStd::make_unique<AZStd::mutex>();
+        return true;
+    }
+
+    void SharedMemory_Linux::Close()
+    {
+        if (m_mapHandle != -1)
+        {
+            // If no other process holds a shared lock, this is the last user so remove the name as well.
+            if (flock(m_mapHandle, LOCK_EX | LOCK_NB) == 0)
+            {
+                char fullName[256];
+                SharedMemoryInternal::ComposeName(fullName, AZ_ARRAY_SIZE(fullName), m_name);
+                shm_unlink(fullName);
+            }
+
+            if (close(m_mapHandle) == -1)
+            {
+                AZ_TracePrintf("AZSystem", "CloseHandle failed with error %d\n", GetLastError());
+            }
+        }
+
+        m_mapHandle = -1;
+        m_globalMutex.reset();
+    }
+
+    bool SharedMemory_Linux::Map(AccessMode mode, unsigned int size)
+    {
+        struct stat st;
+        if (fstat(m_mapHandle, &st) != 0)
+        {
+            AZ_TracePrintf("AZSystem", "MapViewOfFile failed with error %d\n", GetLastError());
+            return false;
+        }
+        if (size == 0)
+        {
+            size = static_cast<unsigned int>(st.st_size);
+        }
+        int desiredAccess = (mode == ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE);
+        m_mappedBase = mmap(nullptr, size, desiredAccess, MAP_SHARED, m_mapHandle, 0);
+        m_mappedBase = (m_mappedBase == MAP_FAILED) ? nullptr : m_mappedBase;
+
+        if (m_mappedBase == nullptr)
+        {
+            AZ_TracePrintf("AZSystem", "MapViewOfFile failed with error %d\n", GetLastError());
+            return false;
+        }
+
+        m_dataSize = size;
+
+        if (!static_cast<SharedMemory*>(this)->CheckMappedBaseValid())
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    bool SharedMemory_Linux::UnMap()
+    {
+        return munmap(m_mappedBase, m_dataSize) == 0;
+    }
+
+    void SharedMemory_Linux::lock()
+    {
+        m_globalMutex->lock();
+        SharedMemoryInternal::LockRange(m_mapHandle, F_WRLCK, true);
+    }
+
+    bool SharedMemory_Linux::try_lock()
+    {
+        if (!m_globalMutex->try_lock())
+        {
+            return false;
+        }
+        if (!SharedMemoryInternal::LockRange(m_mapHandle, F_WRLCK, false))
+        {
+            m_globalMutex->unlock();
+            return false;
+        }
+        return true;
+    }
+
+    void SharedMemory_Linux::unlock()
+    {
+        SharedMemoryInternal::LockRange(m_mapHandle, F_UNLCK, false);
+        m_globalMutex->unlock();
+    }
+
+    bool SharedMemory_Linux::IsLockAbandoned()
+    {
+        // The kernel releases the lock of a process that terminates, so it can't be abandoned.
+        return false;
+    }
+
+    bool SharedMemory_Linux::IsWaitFailed() const
+    {
+        return false;
+    }
+}
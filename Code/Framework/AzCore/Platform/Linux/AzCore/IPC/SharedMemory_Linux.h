@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/IPC/SharedMemory_Common.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    //! Shared memory backed by POSIX shared memory objects.
+    //! The inter-process lock is an open file description lock on the shared memory object, which
+    //! the kernel releases when a process dies, so a crashed process can't leave the lock held.
+    //! Open file description locks don't exclude threads that use the same SharedMemory instance, so
+    //! those are serialized with a process local mutex first.
+    //! Every user holds a shared flock on the object. The last user to close it removes the object's name,
+    //! which mirrors the lifetime of named file mappings on Windows.
+    class SharedMemory_Linux : public SharedMemory_Common
+    {
+    protected:
+        SharedMemory_Linux();
+
+        bool IsReady() const
+        {
+            return m_mapHandle != -1;
+        }
+
+        bool IsMapHandleValid() const
+        {
+            return m_mapHandle != -1;
+        }
+
+        static int GetLastError();
+
+        CreateResult Create(const char* name, unsigned int size, bool openIfCreated);
+        bool Open(const char* name);
+        void Close();
+        bool Map(AccessMode mode, unsigned int size);
+        bool UnMap();
+        void lock();
+        bool try_lock();
+        void unlock();
+        bool IsLockAbandoned();
+        bool IsWaitFailed() const;
+
+        int m_mapHandle;
+        AZStd::unique_ptr<AZStd::mutex> m_globalMutex;
+    };
+
+    using SharedMemory_Platform = SharedMemory_Linux;
+}
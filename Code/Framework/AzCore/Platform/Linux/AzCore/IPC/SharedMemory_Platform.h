@@ -7,4 +7,4 @@
  */
 #pragma once
 
-#include <../Common/Unimplemented/AzCore/IPC/SharedMemory_Unimplemented.h>
+#include <AzCore/IPC/SharedMemory_Linux.h>
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include "UserTypes.h"
+#include <AzCore/std/containers/flat_hash_map.h>
+#include <AzCore/std/containers/flat_hash_set.h>
+#include <AzCore/std/containers/flat_map.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/string/string.h>
+
+namespace UnitTest
+{
+    using FlatContainers = LeakDetectionFixture;
+
+    TEST_F(FlatContainers, FlatHashMap_InsertFindErase_MatchesUnorderedMap)
+    {
+        AZStd::flat_hash_map<int, int> flatMap;
+        AZStd::unordered_map<int, int> referenceMap;
+
+        // Mix inserts and erases on a small key range, so the table reuses deleted slots and rehashes in place
+        unsigned int seed = 1;
+        for (int index = 0; index < 20000; ++index)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            const int key = static_cast<int>((seed >> 8) % 500);
+            if ((seed >> 4) % 3 == 0)
+            {
+                EXPECT_EQ(referenceMap.erase(key), flatMap.erase(key));
+            }
+            else
+            {
+                flatMap[key] = index;
+                referenceMap[key] = index;
+            }
+        }
+
+        ASSERT_EQ(referenceMap.size(), flatMap.size());
+        for (const auto& [key, value] : referenceMap)
+        {
+            auto found = flatMap.find(key);
+            ASSERT_NE(flatMap.end(), found);
+            EXPECT_EQ(value, found->second);
+        }
+        size_t iteratedCount = 0;
+        for (const auto& [key, value] : flatMap)
+        {
+            EXPECT_EQ(referenceMap[key], value);
+            ++iteratedCount;
+        }
+        EXPECT_EQ(referenceMap.size(), iteratedCount);
+    }
+
+    TEST_F(FlatContainers, FlatHashMap_EraseWhileIterating_KeepsRemainingElements)
+    {
+        AZStd::flat_hash_map<int, AZStd::string> flatMap;
+        for (int key = 0; key < 100; ++key)
+        {
+            flatMap.try_emplace(key, AZStd::string::format("value%d", key));
+        }
+
+        for (auto iter = flatMap.begin(); iter != flatMap.end();)
+        {
+            iter = (iter->first % 2 != 0) ? flatMap.erase(iter) : AZStd::next(iter);
+        }
+
+        EXPECT_EQ(50u, flatMap.size());
+        for (int key = 0; key < 100; key += 2)
+        {
+            EXPECT_EQ(AZStd::string::format("value%d", key), flatMap.at(key));
+            EXPECT_FALSE(flatMap.contains(key + 1));
+        }
+    }
+
+    TEST_F(FlatContainers, FlatHashMap_CopyAndMove_PreserveElements)
+    {
+        AZStd::flat_hash_map<AZStd::string, int> flatMap{ { "one", 1 }, { "two", 2 }, { "three", 3 } };
+
+        AZStd::flat_hash_map<AZStd::string, int> copy(flatMap);
+        EXPECT_EQ(flatMap, copy);
+
+        AZStd::flat_hash_map<AZStd::string, int> moved(AZStd::move(copy));
+        EXPECT_EQ(flatMap, moved);
+        EXPECT_TRUE(copy.empty());
+
+        EXPECT_FALSE(moved.insert_or_assign("two", 22).second);
+        EXPECT_EQ(22, moved.at("two"));
+        EXPECT_NE(flatMap, moved);
+    }
+
+    TEST_F(FlatContainers, FlatHashMap_Reserve_DoesNotRehashWhileInserting)
+    {
+        AZStd::flat_hash_map<int, int> flatMap;
+        flatMap.reserve(1000);
+        const size_t bucketCount = flatMap.bucket_count();
+        for (int key = 0; key < 1000; ++key)
+        {
+            flatMap.emplace(key, key);
+        }
+        EXPECT_EQ(bucketCount, flatMap.bucket_count());
+        EXPECT_LE(flatMap.load_factor(), flatMap.max_load_factor());
+    }
+
+    TEST_F(FlatContainers, FlatHashSet_Insert_IgnoresDuplicates)
+    {
+        AZStd::flat_hash_set<int> flatSet{ 1, 2, 3, 3 };
+        EXPECT_EQ(3u, flatSet.size());
+        EXPECT_FALSE(flatSet.insert(2).second);
+        EXPECT_TRUE(flatSet.insert(4).second);
+        EXPECT_TRUE(flatSet.contains(4));
+        EXPECT_EQ(1u, flatSet.erase(1));
+        EXPECT_FALSE(flatSet.contains(1));
+    }
+
+    TEST_F(FlatContainers, FlatMap_Insert_KeepsKeysSortedAndUnique)
+    {
+        AZStd::flat_map<int, int> flatMap{ { 3, 30 }, { 1, 10 }, { 2, 20 }, { 1, 11 } };
+        ASSERT_EQ(3u, flatMap.size());
+        EXPECT_EQ(10, flatMap.at(1));
+
+        flatMap[0] = 5;
+        int previousKey = -1;
+        for (const auto& [key, value] : flatMap)
+        {
+            EXPECT_LT(previousKey, key);
+            previousKey = key;
+        }
+
+        EXPECT_EQ(1u, flatMap.erase(2));
+        EXPECT_FALSE(flatMap.contains(2));
+        EXPECT_EQ(flatMap.end(), flatMap.find(2));
+        EXPECT_EQ(3, flatMap.lower_bound(2)->first);
+    }
+} // namespace UnitTest
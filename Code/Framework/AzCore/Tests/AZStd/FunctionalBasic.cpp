@@ -9,6 +9,8 @@
 #include "UserTypes.h"
 
 #include <AzCore/std/functional_basic.h>
+#include <AzCore/std/function/move_only_function.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/tuple.h>
 
 
@@ -225,4 +227,38 @@ namespace UnitTest
         AZStd::function rawFuncDeduce(&Internal::RawTestFunc);
         AZStd::function functionObjectDeduce([](int) -> double { return {}; });
     }
+
+    TEST_F(FunctionalBasicTest, MoveOnlyFunction_MoveOnlyCapture_IsInvocable)
+    {
+        AZStd::move_only_function<int(int)> function = [value = AZStd::make_unique<int>(5)](int addend)
+        {
+            return *value + addend;
+        };
+        EXPECT_TRUE(function.is_inline());
+        EXPECT_EQ(7, function(2));
+
+        AZStd::move_only_function<int(int)> movedFunction(AZStd::move(function));
+        EXPECT_EQ(nullptr, function);
+        ASSERT_NE(nullptr, movedFunction);
+        EXPECT_EQ(8, movedFunction(3));
+    }
+
+    TEST_F(FunctionalBasicTest, MoveOnlyFunction_CaptureLargerThanInlineCapacity_IsStoredInAllocator)
+    {
+        struct LargeCapture
+        {
+            int m_values[32] = {};
+        };
+        LargeCapture capture;
+        capture.m_values[31] = 42;
+        AZStd::move_only_function<int(), sizeof(void*) * 2> function = [capture]()
+        {
+            return capture.m_values[31];
+        };
+        EXPECT_FALSE(function.is_inline());
+        EXPECT_EQ(42, function());
+
+        function = nullptr;
+        EXPECT_FALSE(function);
+    }
 }
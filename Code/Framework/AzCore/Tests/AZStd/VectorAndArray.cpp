@@ -12,11 +12,13 @@
 #include <AzCore/std/containers/bitset.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/small_vector.h>
 #include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/ranges/subrange.h>
 #include <AzCore/std/ranges/transform_view.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
 #include <AzCore/std/utils.h>
 
 /**
@@ -1177,4 +1179,59 @@ namespace UnitTest
         testVec.append_range(testView | AZStd::views::transform([](const char elem) -> char { return elem + 3; }));
         EXPECT_THAT(testVec, ::testing::ElementsAre('a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i'));
     }
+
+    TEST_F(Arrays, SmallVector_WithinInlineCapacity_DoesNotAllocate)
+    {
+        AZStd::small_vector<int, 4> testVec{ 1, 2, 3 };
+        EXPECT_TRUE(testVec.is_inline());
+        EXPECT_EQ(4, testVec.capacity());
+        testVec.push_back(4);
+        EXPECT_TRUE(testVec.is_inline());
+        EXPECT_THAT(testVec, ::testing::ElementsAre(1, 2, 3, 4));
+    }
+
+    TEST_F(Arrays, SmallVector_PastInlineCapacity_MovesToAllocator)
+    {
+        AZStd::small_vector<AZStd::unique_ptr<int>, 2> testVec;
+        for (int i = 0; i < 5; ++i)
+        {
+            testVec.emplace_back(AZStd::make_unique<int>(i));
+        }
+        EXPECT_FALSE(testVec.is_inline());
+        ASSERT_EQ(5, testVec.size());
+        for (int i = 0; i < 5; ++i)
+        {
+            EXPECT_EQ(i, *testVec[i]);
+        }
+
+        testVec.erase(testVec.begin(), testVec.begin() + 3);
+        testVec.shrink_to_fit();
+        EXPECT_TRUE(testVec.is_inline());
+        ASSERT_EQ(2, testVec.size());
+        EXPECT_EQ(3, *testVec[0]);
+        EXPECT_EQ(4, *testVec[1]);
+    }
+
+    TEST_F(Arrays, SmallVector_PushBackOwnElementWhileGrowing_CopiesValue)
+    {
+        AZStd::small_vector<AZStd::string, 2> testVec{ "first", "second" };
+        testVec.push_back(testVec[0]);
+        EXPECT_THAT(testVec, ::testing::ElementsAre("first", "second", "first"));
+    }
+
+    TEST_F(Arrays, SmallVector_InsertEraseAndCompare_Succeeds)
+    {
+        AZStd::small_vector<int, 3> testVec{ 1, 3 };
+        testVec.insert(testVec.begin() + 1, 2);
+        testVec.insert(testVec.end(), 4);
+        EXPECT_THAT(testVec, ::testing::ElementsAre(1, 2, 3, 4));
+
+        testVec.erase(testVec.begin());
+        AZStd::small_vector<int, 3> otherVec{ 2, 3, 4 };
+        EXPECT_EQ(otherVec, testVec);
+
+        AZStd::small_vector<int, 3> movedVec(AZStd::move(testVec));
+        EXPECT_TRUE(testVec.empty());
+        EXPECT_EQ(otherVec, movedVec);
+    }
 }
@@ -674,6 +674,69 @@ namespace UnitTest
         EXPECT_EQ(asset.GetAutoLoadBehavior(), AZ::Data::AssetLoadBehavior::PreLoad);
     }
 
+    struct AssetEvictedListener
+        : public AssetManagerNotificationBus::Handler
+    {
+        AssetEvictedListener()
+        {
+            BusConnect();
+        }
+        ~AssetEvictedListener() override
+        {
+            BusDisconnect();
+        }
+        void OnAssetEvicted(const AssetId& assetId, [[maybe_unused]] const AssetType& assetType, [[maybe_unused]] size_t residentSize) override
+        {
+            m_evictedAssets.push_back(assetId);
+        }
+
+        AZStd::vector<AssetId> m_evictedAssets;
+    };
+
+#if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    TEST_F(AssetJobsFloodTest, DISABLED_ResidencyBudget_OverBudget_EvictsLeastRecentlyRequestedAsset)
+#else
+    TEST_F(AssetJobsFloodTest, ResidencyBudget_OverBudget_EvictsLeastRecentlyRequestedAsset)
+#endif // !AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    {
+        const AssetType assetType = azrtti_typeid<AssetWithSerializedData>();
+        m_testAssetManager->SetAssetResidencyBudget(assetType, AZStd::numeric_limits<size_t>::max());
+
+        auto asset4 = m_testAssetManager->GetAsset<AssetWithSerializedData>(MyAsset4Id, AssetLoadBehavior::Default);
+        asset4.BlockUntilLoadComplete();
+        ASSERT_TRUE(asset4.IsReady());
+
+        // All of the test assets serialize the same data, so they all have the same size
+        const size_t assetSize = m_testAssetManager->GetAssetResidentSize(assetType);
+        ASSERT_GT(assetSize, 0u);
+        m_testAssetManager->SetAssetResidencyBudget(assetType, 2 * assetSize);
+
+        auto asset5 = m_testAssetManager->GetAsset<AssetWithSerializedData>(MyAsset5Id, AssetLoadBehavior::Default);
+        auto asset6 = m_testAssetManager->GetAsset<AssetWithSerializedData>(MyAsset6Id, AssetLoadBehavior::Default);
+        asset5.BlockUntilLoadComplete();
+        asset6.BlockUntilLoadComplete();
+        EXPECT_EQ(3 * assetSize, m_testAssetManager->GetAssetResidentSize(assetType));
+
+        AssetEvictedListener evictedListener;
+
+        // Referenced assets count towards the budget, but aren't evicted
+        m_testAssetManager->DispatchEvents();
+        EXPECT_TRUE(evictedListener.m_evictedAssets.empty());
+
+        asset4.Reset();
+        asset5.Reset();
+        asset6.Reset();
+        m_testAssetManager->DispatchEvents();
+
+        ASSERT_EQ(1u, evictedListener.m_evictedAssets.size());
+        EXPECT_EQ(AssetId(MyAsset4Id), evictedListener.m_evictedAssets[0]);
+        EXPECT_EQ(2 * assetSize, m_testAssetManager->GetAssetResidentSize(assetType));
+
+        // The cached assets are still loaded
+        auto cachedAsset5 = m_testAssetManager->FindAsset<AssetWithSerializedData>(MyAsset5Id, AssetLoadBehavior::Default);
+        EXPECT_TRUE(cachedAsset5.IsReady());
+    }
+
 #if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
     TEST_F(AssetJobsFloodTest, DISABLED_BlockOnTheSameAsset_DoesNotDeadlock)
 #else
@@ -1561,6 +1561,98 @@ namespace UnitTest
         EXPECT_FALSE(component.GetConfiguration(config));
     }
 
+    //=========================================================================
+    // Thread safe component initialization
+
+    class ThreadSafeInitComponent : public Component
+    {
+    public:
+        AZ_COMPONENT(ThreadSafeInitComponent, "{8E0C6F3A-2B7D-4C59-A1E4-5F9D3B7C2A60}");
+        static void Reflect(ReflectContext*) {}
+        static bool IsInitThreadSafe() { return true; }
+
+        int m_initCount = 0;
+
+    protected:
+        void Init() override { ++m_initCount; }
+        void Activate() override {}
+        void Deactivate() override {}
+    };
+
+    class MainThreadInitComponent : public Component
+    {
+    public:
+        AZ_COMPONENT(MainThreadInitComponent, "{4A9B2E7C-6D1F-4E38-B5C0-9F2A7D6E1B83}");
+        static void Reflect(ReflectContext*) {}
+
+        int m_initCount = 0;
+
+    protected:
+        void Init() override { ++m_initCount; }
+        void Activate() override {}
+        void Deactivate() override {}
+    };
+
+    class ComponentThreadSafeInit
+        : public Components
+    {
+    public:
+        void SetUp() override
+        {
+            Components::SetUp();
+
+            m_descriptors.emplace_back(ThreadSafeInitComponent::CreateDescriptor());
+            m_descriptors.emplace_back(MainThreadInitComponent::CreateDescriptor());
+        }
+
+        void TearDown() override
+        {
+            m_descriptors.clear();
+            m_descriptors.set_capacity(0);
+
+            Components::TearDown();
+        }
+
+        AZStd::vector<AZStd::unique_ptr<ComponentDescriptor>> m_descriptors;
+    };
+
+    TEST_F(ComponentThreadSafeInit, IsInitThreadSafe_ReportedByDescriptor)
+    {
+        EXPECT_TRUE(m_descriptors[0]->IsInitThreadSafe());
+        EXPECT_FALSE(m_descriptors[1]->IsInitThreadSafe());
+    }
+
+    TEST_F(ComponentThreadSafeInit, InitThreadSafeComponentsThenInit_InitializesEachComponentOnce)
+    {
+        Entity entity;
+        auto threadSafeComponent = entity.CreateComponent<ThreadSafeInitComponent>();
+        auto mainThreadComponent = entity.CreateComponent<MainThreadInitComponent>();
+
+        entity.InitThreadSafeComponents();
+        EXPECT_EQ(Entity::State::Constructed, entity.GetState());
+        EXPECT_EQ(1, threadSafeComponent->m_initCount);
+        EXPECT_EQ(0, mainThreadComponent->m_initCount);
+
+        entity.Init();
+        EXPECT_EQ(Entity::State::Init, entity.GetState());
+        EXPECT_EQ(1, threadSafeComponent->m_initCount);
+        EXPECT_EQ(1, mainThreadComponent->m_initCount);
+    }
+
+    TEST_F(ComponentThreadSafeInit, ComponentAddedAfterInitThreadSafeComponents_IsInitializedOnce)
+    {
+        Entity entity;
+        auto firstComponent = entity.CreateComponent<ThreadSafeInitComponent>();
+        entity.InitThreadSafeComponents();
+
+        auto addedComponent = entity.CreateComponent<ThreadSafeInitComponent>();
+        EXPECT_EQ(1, addedComponent->m_initCount);
+
+        entity.Init();
+        EXPECT_EQ(1, firstComponent->m_initCount);
+        EXPECT_EQ(1, addedComponent->m_initCount);
+    }
+
     //=========================================================================
 
     TEST_F(Components, GenerateNewIdsAndFixRefsExistingMapTest)
@@ -290,6 +290,18 @@ namespace AZ
         AZ_TEST_ASSERT(console->GetCvarValue("testString", testValue) != GetValueResult::Success); // Console can't convert an arbitrary string to a float
     }
 
+    TEST_F(ConsoleTests, CVar_FindCommand_IgnoresCase)
+    {
+        static_assert(AZ::Console::HashCommandName("testVec3") == AZ::Console::HashCommandName("TESTVEC3"));
+
+        AZ::IConsole* console = m_console.get();
+
+        ConsoleFunctorBase* foundCommand = console->FindCommand("TestVEC3");
+        ASSERT_NE(nullptr, foundCommand);
+        EXPECT_STREQ("testVec3", foundCommand->GetName());
+        EXPECT_EQ(nullptr, console->FindCommand("testVec"));
+    }
+
     TEST_F(ConsoleTests, CVar_Autocomplete)
     {
         AZ::IConsole* console = m_console.get();
@@ -560,6 +560,35 @@ namespace AZ::Dom::Tests
         GenerateAndVerifyDelta();
     }
 
+    TEST_F(DomPatchTests, TestPatch_ApplySharesUnmodifiedSubtrees)
+    {
+        m_deltaDataset["arr"][2] = 42;
+        PatchUndoRedoInfo info = GenerateAndVerifyDelta();
+
+        auto result = info.m_forwardPatches.Apply(m_dataset);
+        ASSERT_TRUE(result.IsSuccess());
+        const Value& patched = result.GetValue();
+        const Value& original = m_dataset;
+
+        // Only the containers along the patched path are copied, everything else still points at the original storage
+        EXPECT_TRUE(patched["obj"].GetInternalValue() == original["obj"].GetInternalValue());
+        EXPECT_TRUE(patched["node"].GetInternalValue() == original["node"].GetInternalValue());
+        EXPECT_FALSE(patched["arr"].GetInternalValue() == original["arr"].GetInternalValue());
+        EXPECT_EQ(original["arr"][2].GetInt64(), 2);
+    }
+
+    TEST_F(DomPatchTests, TestPatch_ReorderedObjectKeys_GeneratesNoPatches)
+    {
+        m_deltaDataset = Value(Type::Object);
+        m_deltaDataset["obj"] = m_dataset["obj"];
+        m_deltaDataset["node"] = m_dataset["node"];
+        m_deltaDataset["arr"] = m_dataset["arr"];
+
+        PatchUndoRedoInfo info = GenerateAndVerifyDelta();
+        EXPECT_EQ(info.m_forwardPatches.Size(), 0);
+        EXPECT_EQ(info.m_inversePatches.Size(), 0);
+    }
+
     TEST_F(DomPatchTests, TestPatch_DenormalizeOnApply)
     {
         m_dataset = Value(Type::Array);
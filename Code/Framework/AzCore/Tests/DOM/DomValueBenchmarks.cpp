@@ -145,6 +145,18 @@ namespace AZ::Dom::Benchmark
     }
     DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomValueBenchmark, AzDomValueMakeComplexObject)
 
+    BENCHMARK_DEFINE_F(DomValueBenchmark, AzDomValueMakeComplexObjectInArena)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ValueArenaScope arenaScope;
+            TakeAndDiscardWithoutTimingDtor(GenerateDomBenchmarkPayload(state.range(0), state.range(1)), state);
+        }
+
+        state.SetItemsProcessed(state.range(0) * state.range(0) * state.iterations());
+    }
+    DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomValueBenchmark, AzDomValueMakeComplexObjectInArena)
+
     BENCHMARK_DEFINE_F(DomValueBenchmark, AzDomValueShallowCopy)(benchmark::State& state)
     {
         Value original = GenerateDomBenchmarkPayload(state.range(0), state.range(1));
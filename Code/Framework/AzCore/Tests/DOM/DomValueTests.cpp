@@ -381,4 +381,67 @@ namespace AZ::Dom::Tests
         EXPECT_EQ(&v1.GetNode(), &v2.GetNode());
         EXPECT_EQ(&v1["obj"].GetNode(), &v2["obj"].GetNode());
     }
+
+    TEST_F(DomValueTests, ArenaScope_ContainersAllocateFromArena)
+    {
+        ValueArenaPtr arena = aznew ValueArena();
+        {
+            ValueArenaScope scope(arena);
+            EXPECT_EQ(ValueArenaScope::GetCurrentArena(), arena.get());
+
+            m_value.SetObject();
+            for (int i = 0; i < 10; ++i)
+            {
+                Value entry(Type::Array);
+                entry.ArrayPushBack(Value(i));
+                entry.ArrayPushBack(Value("a string that doesn't fit in the short string storage", true));
+                m_value[AZStd::string::format("Key%i", i)] = AZStd::move(entry);
+            }
+
+            EXPECT_EQ(m_value.GetObject().get_allocator().GetArena(), arena.get());
+            EXPECT_EQ(m_value["Key0"].GetArray().get_allocator().GetArena(), arena.get());
+        }
+        EXPECT_EQ(ValueArenaScope::GetCurrentArena(), nullptr);
+        EXPECT_GT(arena->GetReservedBytes(), 0);
+
+        // The document stays valid after the scope, and compares equal to a copy made without the arena
+        Value deepCopy = Utils::DeepCopy(m_value);
+        EXPECT_EQ(deepCopy.GetObject().get_allocator().GetArena(), nullptr);
+        EXPECT_TRUE(Utils::DeepCompareIsEqual(m_value, deepCopy));
+        EXPECT_EQ(m_value["Key9"][0].GetInt64(), 9);
+
+        PerformValueChecks();
+    }
+
+    TEST_F(DomValueTests, ArenaScope_ArenaIsReleasedWithTheLastValue)
+    {
+        ValueArenaPtr arena = aznew ValueArena();
+        {
+            ValueArenaScope scope(arena);
+            m_value.SetArray();
+            m_value.ArrayPushBack(Value(Type::Object));
+            m_value[0]["nested"] = Value(Type::Array);
+        }
+        EXPECT_GT(arena->use_count(), 1);
+
+        // A copy that is mutated outside of the scope detaches, its containers keep the arena alive as well
+        Value copy = m_value;
+        copy.ArrayPushBack(Value(42));
+        EXPECT_EQ(copy.ArraySize(), 2);
+        EXPECT_EQ(m_value.ArraySize(), 1);
+
+        m_value = Value();
+        copy = Value();
+        EXPECT_EQ(arena->use_count(), 1);
+    }
+
+    TEST_F(DomValueTests, ArenaScope_NestedScopesRestoreThePreviousArena)
+    {
+        ValueArenaScope outerScope;
+        {
+            ValueArenaScope innerScope;
+            EXPECT_EQ(ValueArenaScope::GetCurrentArena(), &innerScope.GetArena());
+        }
+        EXPECT_EQ(ValueArenaScope::GetCurrentArena(), &outerScope.GetArena());
+    }
 } // namespace AZ::Dom::Tests
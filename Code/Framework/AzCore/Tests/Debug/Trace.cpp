@@ -42,6 +42,7 @@ namespace UnitTest
         bool OnPrintf(const char*, const char*) override
         {
             m_printf = true;
+            ++m_printfCount;
 
             return true;
         }
@@ -76,6 +77,7 @@ namespace UnitTest
         bool m_error = false;
         bool m_warning = false;
         bool m_printf = false;
+        int m_printfCount = 0;
         AZ::Console* m_console{ nullptr };
     };
 
@@ -139,6 +141,29 @@ namespace UnitTest
         ASSERT_TRUE(m_printf);
     }
 
+    TEST_F(TraceTests, AsyncOutput_DispatchesMessages_AndLimitsRepeats)
+    {
+        auto console = AZ::Interface<AZ::IConsole>::Get();
+        console->PerformCommand("bg_traceLogLevel 3");
+        console->PerformCommand("bg_traceAsyncRepeatLimit 5");
+        console->PerformCommand("bg_traceAsyncOutput true");
+
+        AZ_Warning("UnitTest", false, "test");
+        for (int i = 0; i < 100; ++i)
+        {
+            AZ_TracePrintf("UnitTest", "repeated test");
+        }
+        AZ::Debug::Trace::Instance().FlushAsyncOutput();
+        EXPECT_TRUE(m_warning);
+
+        // Stopping the asynchronous output reports the suppressed repeats
+        console->PerformCommand("bg_traceAsyncOutput false");
+        console->PerformCommand("bg_traceAsyncRepeatLimit 20");
+
+        // The first 5 repeats are output, followed by one message that reports the other 95
+        EXPECT_EQ(6, m_printfCount);
+    }
+
     TEST_F(TraceTests, RedirectRawOutputToStderr_DoesNotOutputToStdout)
     {
         // Invoke the Trace::Init() function to create AZ environment variables
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/Component/DenseComponentStorage.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class DenseComponentStorageTests
+        : public LeakDetectionFixture
+    {
+    protected:
+        using Storage = AZ::DenseComponentStorage<int>;
+    };
+
+    TEST_F(DenseComponentStorageTests, Add_MultipleElements_DataIsContiguousAndMatchesEntityIds)
+    {
+        Storage storage;
+        Storage::Handle handle1 = storage.Add(AZ::EntityId(1), 10);
+        Storage::Handle handle2 = storage.Add(AZ::EntityId(2), 20);
+
+        ASSERT_EQ(2, storage.GetSize());
+        EXPECT_EQ(10, storage.GetData()[0]);
+        EXPECT_EQ(AZ::EntityId(1), storage.GetEntityIds()[0]);
+        EXPECT_EQ(20, storage.GetData()[1]);
+        EXPECT_EQ(AZ::EntityId(2), storage.GetEntityIds()[1]);
+
+        ASSERT_NE(nullptr, storage.Find(handle1));
+        EXPECT_EQ(10, *storage.Find(handle1));
+        ASSERT_NE(nullptr, storage.Find(handle2));
+        EXPECT_EQ(20, *storage.Find(handle2));
+    }
+
+    TEST_F(DenseComponentStorageTests, Remove_FirstElement_LastElementMovesAndHandlesStayValid)
+    {
+        Storage storage;
+        Storage::Handle handle1 = storage.Add(AZ::EntityId(1), 10);
+        storage.Add(AZ::EntityId(2), 20);
+        Storage::Handle handle3 = storage.Add(AZ::EntityId(3), 30);
+
+        EXPECT_TRUE(storage.Remove(handle1));
+        ASSERT_EQ(2, storage.GetSize());
+        EXPECT_EQ(30, storage.GetData()[0]);
+        EXPECT_EQ(AZ::EntityId(3), storage.GetEntityIds()[0]);
+
+        ASSERT_NE(nullptr, storage.Find(handle3));
+        *storage.Find(handle3) = 31;
+        EXPECT_EQ(31, storage.GetData()[0]);
+    }
+
+    TEST_F(DenseComponentStorageTests, Remove_HandleRemovedTwice_SecondRemoveIsIgnored)
+    {
+        Storage storage;
+        Storage::Handle handle1 = storage.Add(AZ::EntityId(1), 10);
+        EXPECT_TRUE(storage.Remove(handle1));
+
+        // The slot of the first handle is reused, but the old handle doesn't refer to the new element.
+        Storage::Handle handle2 = storage.Add(AZ::EntityId(2), 20);
+        EXPECT_FALSE(storage.Remove(handle1));
+        EXPECT_EQ(nullptr, storage.Find(handle1));
+        ASSERT_NE(nullptr, storage.Find(handle2));
+        EXPECT_EQ(20, *storage.Find(handle2));
+    }
+
+    TEST_F(DenseComponentStorageTests, Clear_ElementsAdded_AllHandlesAreInvalidated)
+    {
+        Storage storage;
+        Storage::Handle handle1 = storage.Add(AZ::EntityId(1), 10);
+        Storage::Handle handle2 = storage.Add(AZ::EntityId(2), 20);
+
+        storage.Clear();
+        EXPECT_TRUE(storage.IsEmpty());
+        EXPECT_EQ(nullptr, storage.Find(handle1));
+        EXPECT_FALSE(storage.Remove(handle2));
+
+        storage.Add(AZ::EntityId(3), 30);
+        EXPECT_EQ(nullptr, storage.Find(handle1));
+        EXPECT_EQ(nullptr, storage.Find(handle2));
+    }
+} // namespace UnitTest
@@ -9,6 +9,8 @@
 #include <AzCore/EBus/IEventScheduler.h>
 #include <AzCore/EBus/EventSchedulerSystemComponent.h>
 #include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/EBus/ScheduledEventHandle.h>
+#include <AzCore/EBus/ScheduledEventTimingWheel.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Console/LoggerSystemComponent.h>
 #include <AzCore/Time/TimeSystem.h>
@@ -100,4 +102,50 @@ namespace UnitTest
         // Use EXPECT_GT in case the OS oversleeps long enough to cause unexpected extra timer pops
         EXPECT_GT(m_requeuedEventTriggerCount, 1);
     }
+
+    TEST(ScheduledEventTimingWheelTests, Advance_ExpiresHandlesAcrossAllLevelsInOrder)
+    {
+        // One handle per level of the wheel, plus one that is too far out for all of them
+        constexpr AZ::TimeMs StartTimeMs{ 1000 };
+        const AZ::TimeMs durationsMs[] = { AZ::TimeMs{ 10 }, AZ::TimeMs{ 1000 }, AZ::TimeMs{ 100000 }, AZ::TimeMs{ 10000000 }, AZ::TimeMs{ 20000000 } };
+        AZStd::vector<AZ::ScheduledEventHandle> handles;
+        for (AZ::TimeMs durationMs : durationsMs)
+        {
+            handles.emplace_back(StartTimeMs + durationMs, durationMs, nullptr);
+        }
+
+        AZ::ScheduledEventTimingWheel wheel;
+        for (AZ::ScheduledEventHandle& handle : handles)
+        {
+            wheel.Insert(&handle, StartTimeMs);
+        }
+        EXPECT_EQ(handles.size(), wheel.GetSize());
+
+        AZStd::vector<AZ::ScheduledEventHandle*> expiredHandles;
+        for (size_t index = 0; index < handles.size(); ++index)
+        {
+            // Nothing expires a millisecond early
+            wheel.Advance(handles[index].GetExecuteTimeMs() - AZ::TimeMs{ 1 }, expiredHandles);
+            EXPECT_EQ(index, expiredHandles.size());
+
+            wheel.Advance(handles[index].GetExecuteTimeMs(), expiredHandles);
+            ASSERT_EQ(index + 1, expiredHandles.size());
+            EXPECT_EQ(&handles[index], expiredHandles.back());
+        }
+        EXPECT_EQ(0, wheel.GetSize());
+    }
+
+    TEST(ScheduledEventTimingWheelTests, Insert_HandleAlreadyDue_ExpiresOnNextAdvance)
+    {
+        AZ::ScheduledEventTimingWheel wheel;
+        AZStd::vector<AZ::ScheduledEventHandle*> expiredHandles;
+        wheel.Advance(AZ::TimeMs{ 500 }, expiredHandles);
+
+        AZ::ScheduledEventHandle handle(AZ::TimeMs{ 500 }, AZ::TimeMs{ 0 }, nullptr);
+        wheel.Insert(&handle, AZ::TimeMs{ 500 });
+        wheel.Advance(AZ::TimeMs{ 500 }, expiredHandles);
+
+        ASSERT_EQ(1, expiredHandles.size());
+        EXPECT_EQ(&handle, expiredHandles.front());
+    }
 }
@@ -38,6 +38,17 @@ namespace Benchmark
                 data.aabbMax = AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetAbs() * 10.0f + data.aabbMin;
                 return data;
             });
+
+            for (const Data& data : m_dataArray)
+            {
+                m_aabbComponents[0].push_back(data.aabbMin.GetX());
+                m_aabbComponents[1].push_back(data.aabbMin.GetY());
+                m_aabbComponents[2].push_back(data.aabbMin.GetZ());
+                m_aabbComponents[3].push_back(data.aabbMax.GetX());
+                m_aabbComponents[4].push_back(data.aabbMax.GetY());
+                m_aabbComponents[5].push_back(data.aabbMax.GetZ());
+            }
+            m_visibility.resize((m_dataArray.size() + 31) / 32);
         }
     public:
         void SetUp(const benchmark::State&) override
@@ -58,6 +69,8 @@ namespace Benchmark
         };
 
         std::vector<Data> m_dataArray;
+        std::vector<float> m_aabbComponents[6]; // structure of arrays copy of the aabbs for the batched test
+        std::vector<uint32_t> m_visibility;
         AZ::Frustum m_testFrustum;
     };
 
@@ -84,6 +97,24 @@ namespace Benchmark
             }
         }
     }
+
+    BENCHMARK_F(BM_MathFrustum, AabbIntersectBatch)(benchmark::State& state)
+    {
+        AZ::Frustum::AabbBatch batch;
+        AZStd::span<const float>* batchComponents[6] = { &batch.m_minX, &batch.m_minY, &batch.m_minZ,
+                                                         &batch.m_maxX, &batch.m_maxY, &batch.m_maxZ };
+        for (size_t i = 0; i < 6; ++i)
+        {
+            *batchComponents[i] = AZStd::span<const float>(m_aabbComponents[i].data(), m_aabbComponents[i].size());
+        }
+        const AZStd::span<uint32_t> visibility(m_visibility.data(), m_visibility.size());
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            uint32_t visibleCount = m_testFrustum.IntersectAabbs(batch, visibility);
+            benchmark::DoNotOptimize(visibleCount);
+        }
+    }
 }
 
 #endif
@@ -9,6 +9,7 @@
 #include <AzCore/Math/Frustum.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
 #include <AZTestShared/Math/MathTestHelpers.h>
 
 namespace UnitTest
@@ -717,4 +718,108 @@ namespace UnitTest
             EXPECT_EQ(onPlaneCount, 3);
         }
     }
+
+    // Stores the boxes as the structure of arrays expected by Frustum::IntersectAabbs
+    struct AabbBatchStorage
+    {
+        explicit AabbBatchStorage(const AZStd::vector<AZ::Aabb>& aabbs)
+        {
+            for (const AZ::Aabb& aabb : aabbs)
+            {
+                m_components[0].push_back(aabb.GetMin().GetX());
+                m_components[1].push_back(aabb.GetMin().GetY());
+                m_components[2].push_back(aabb.GetMin().GetZ());
+                m_components[3].push_back(aabb.GetMax().GetX());
+                m_components[4].push_back(aabb.GetMax().GetY());
+                m_components[5].push_back(aabb.GetMax().GetZ());
+            }
+        }
+
+        AZ::Frustum::AabbBatch GetBatch() const
+        {
+            return { m_components[0], m_components[1], m_components[2], m_components[3], m_components[4], m_components[5] };
+        }
+
+        AZStd::vector<float> m_components[6];
+    };
+
+    static AZStd::vector<AZ::Aabb> GenerateAabbGrid()
+    {
+        // A grid of boxes around testFrustum1, the count isn't a multiple of the batch size so the padding is exercised too.
+        // The offsets keep the box faces away from the frustum planes.
+        AZStd::vector<AZ::Aabb> aabbs;
+        for (int32_t x = -5; x <= 5; ++x)
+        {
+            for (int32_t y = -1; y <= 11; ++y)
+            {
+                for (int32_t z = -3; z <= 3; z += 2)
+                {
+                    const AZ::Vector3 center(x * 11.3f + 0.17f, y * 9.7f + 0.31f, z * 13.1f + 0.23f);
+                    const AZ::Vector3 halfExtents(1.0f + (x + 5) * 0.35f, 0.5f + (y + 1) * 0.6f, 2.0f);
+                    aabbs.push_back(AZ::Aabb::CreateCenterHalfExtents(center, halfExtents));
+                }
+            }
+        }
+        return aabbs;
+    }
+
+    TEST(MATH_Frustum, IntersectAabbs_MatchesIntersectAabb)
+    {
+        const AZStd::vector<AZ::Aabb> aabbs = GenerateAabbGrid();
+        const AabbBatchStorage storage(aabbs);
+        ASSERT_NE(0u, aabbs.size() % 32);
+
+        // Fill with garbage to verify that the bits past the last box are cleared
+        AZStd::vector<uint32_t> visibility((aabbs.size() + 31) / 32, 0xFFFFFFFF);
+        AZStd::vector<uint8_t> interiorPlaneMasks(aabbs.size());
+        const uint32_t visibleCount = testFrustum1.IntersectAabbs(
+            storage.GetBatch(), visibility, AZ::Frustum::AllPlanesMask, interiorPlaneMasks);
+
+        uint32_t expectedVisibleCount = 0;
+        uint32_t expectedInteriorCount = 0;
+        for (size_t i = 0; i < aabbs.size(); ++i)
+        {
+            const AZ::IntersectResult expected = testFrustum1.IntersectAabb(aabbs[i]);
+            const bool visible = (visibility[i / 32] & (1u << (i % 32))) != 0;
+            EXPECT_EQ(expected != AZ::IntersectResult::Exterior, visible) << "Aabb " << i;
+            if (visible)
+            {
+                ++expectedVisibleCount;
+                const bool interior = interiorPlaneMasks[i] == AZ::Frustum::AllPlanesMask;
+                EXPECT_EQ(expected == AZ::IntersectResult::Interior, interior) << "Aabb " << i;
+                expectedInteriorCount += interior ? 1 : 0;
+            }
+        }
+        EXPECT_EQ(expectedVisibleCount, visibleCount);
+        EXPECT_EQ(0u, visibility.back() >> (aabbs.size() % 32));
+
+        // Make sure the grid actually covers all three results
+        EXPECT_GT(expectedInteriorCount, 0u);
+        EXPECT_LT(expectedInteriorCount, expectedVisibleCount);
+        EXPECT_LT(expectedVisibleCount, aabbs.size());
+    }
+
+    TEST(MATH_Frustum, IntersectAabbs_PlaneMask_OnlyTestsMaskedPlanes)
+    {
+        const AZStd::vector<AZ::Aabb> aabbs = {
+            AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3(0.0f, 50.0f, 0.0f), AZ::Vector3(1.0f)), // inside
+            AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3(0.0f, 150.0f, 0.0f), AZ::Vector3(1.0f)), // beyond the far plane
+            AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3(0.0f, 100.0f, 0.0f), AZ::Vector3(1.0f)), // crossing the far plane
+            AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3(-80.0f, 50.0f, 0.0f), AZ::Vector3(1.0f)), // left of the frustum
+        };
+        const AabbBatchStorage storage(aabbs);
+
+        const uint32_t nearFarMask = (1u << AZ::Frustum::PlaneId::Near) | (1u << AZ::Frustum::PlaneId::Far);
+        uint32_t visibility[1] = {};
+        uint8_t interiorPlaneMasks[4] = {};
+        EXPECT_EQ(3u, testFrustum1.IntersectAabbs(storage.GetBatch(), visibility, nearFarMask, interiorPlaneMasks));
+        EXPECT_EQ(0b1101u, visibility[0]);
+        EXPECT_EQ(nearFarMask, interiorPlaneMasks[0]);
+        EXPECT_EQ(1u << AZ::Frustum::PlaneId::Near, interiorPlaneMasks[2]);
+        EXPECT_EQ(nearFarMask, interiorPlaneMasks[3]);
+
+        // Without any planes everything is visible
+        EXPECT_EQ(4u, testFrustum1.IntersectAabbs(storage.GetBatch(), visibility, 0));
+        EXPECT_EQ(0b1111u, visibility[0]);
+    }
 } // namespace UnitTest
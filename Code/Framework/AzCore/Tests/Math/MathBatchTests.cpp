@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AZTestShared/Math/MathTestHelpers.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/MathBatch.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+
+using namespace AZ;
+
+namespace UnitTest
+{
+    // Not a multiple of four, so the remainder loops are covered too
+    constexpr size_t BatchSize = 11;
+
+    static Matrix3x4 CreateBatchTestMatrix()
+    {
+        Matrix3x4 matrix = Matrix3x4::CreateFromQuaternionAndTranslation(
+            Quaternion::CreateFromEulerAnglesDegrees(Vector3(30.0f, -45.0f, 60.0f)), Vector3(1.0f, -2.0f, 3.0f));
+        matrix.MultiplyByScale(Vector3(2.0f, 0.5f, 1.5f));
+        return matrix;
+    }
+
+    static Vector3 CreateBatchTestPoint(size_t index)
+    {
+        const float value = static_cast<float>(index);
+        return Vector3(value * 0.5f - 2.0f, 3.0f - value, value * value * 0.1f);
+    }
+
+    TEST(MATH_Batch, TransformPoints_MatchesMatrixTransformPoint)
+    {
+        const Matrix3x4 matrix = CreateBatchTestMatrix();
+        AZStd::vector<Vector3> points;
+        for (size_t i = 0; i < BatchSize; ++i)
+        {
+            points.push_back(CreateBatchTestPoint(i));
+        }
+
+        AZStd::vector<Vector3> results(BatchSize);
+        MathBatch::TransformPoints(matrix, points, results);
+        for (size_t i = 0; i < BatchSize; ++i)
+        {
+            EXPECT_THAT(results[i], IsClose(matrix.TransformPoint(points[i])));
+        }
+
+        // In place
+        MathBatch::TransformPoints(matrix, points, points);
+        EXPECT_THAT(points, testing::Pointwise(ContainerIsClose(), results));
+    }
+
+    TEST(MATH_Batch, TransformPoints_WithTransform_MatchesTransformPoint)
+    {
+        const Transform transform = Transform::CreateFromQuaternionAndTranslation(
+            Quaternion::CreateRotationY(DegToRad(70.0f)), Vector3(-4.0f, 0.5f, 2.0f)) * Transform::CreateUniformScale(3.0f);
+        AZStd::vector<Vector3> points;
+        for (size_t i = 0; i < BatchSize; ++i)
+        {
+            points.push_back(CreateBatchTestPoint(i));
+        }
+
+        AZStd::vector<Vector3> results(BatchSize);
+        MathBatch::TransformPoints(transform, points, results);
+        for (size_t i = 0; i < BatchSize; ++i)
+        {
+            EXPECT_THAT(results[i], IsClose(transform.TransformPoint(points[i])));
+        }
+    }
+
+    TEST(MATH_Batch, TransformPoints_StructureOfArrays_MatchesMatrixTransformPoint)
+    {
+        const Matrix3x4 matrix = CreateBatchTestMatrix();
+        AZStd::vector<float> x, y, z;
+        for (size_t i = 0; i < BatchSize; ++i)
+        {
+            const Vector3 point = CreateBatchTestPoint(i);
+            x.push_back(point.GetX());
+            y.push_back(point.GetY());
+            z.push_back(point.GetZ());
+        }
+
+        AZStd::vector<float> outX(BatchSize), outY(BatchSize), outZ(BatchSize);
+        MathBatch::TransformPoints(matrix, x, y, z, outX, outY, outZ);
+        for (size_t i = 0; i < BatchSize; ++i)
+        {
+            EXPECT_THAT(Vector3(outX[i], outY[i], outZ[i]), IsClose(matrix.TransformPoint(CreateBatchTestPoint(i))));
+        }
+    }
+
+    TEST(MATH_Batch, TransformAabbs_MatchesGetTransformedAabb)
+    {
+        const Matrix3x4 matrix = CreateBatchTestMatrix();
+        AZStd::vector<Aabb> aabbs;
+        for (size_t i = 0; i < BatchSize; ++i)
+        {
+            const Vector3 min = CreateBatchTestPoint(i);
+            aabbs.push_back(Aabb::CreateFromMinMax(min, min + Vector3(1.0f + i, 2.0f, 0.5f * i)));
+        }
+
+        AZStd::vector<Aabb> results(BatchSize);
+        MathBatch::TransformAabbs(matrix, aabbs, results);
+        for (size_t i = 0; i < BatchSize; ++i)
+        {
+            const Aabb expected = aabbs[i].GetTransformedAabb(matrix);
+            EXPECT_THAT(results[i].GetMin(), IsCloseTolerance(expected.GetMin(), 1e-4f));
+            EXPECT_THAT(results[i].GetMax(), IsCloseTolerance(expected.GetMax(), 1e-4f));
+        }
+    }
+
+    TEST(MATH_Batch, SlerpQuaternions_MatchesQuaternionSlerp)
+    {
+        AZStd::vector<Quaternion> from, to;
+        AZStd::vector<float> t;
+        for (size_t i = 0; i < BatchSize; ++i)
+        {
+            const float angle = static_cast<float>(i) * 25.0f;
+            from.push_back(Quaternion::CreateFromEulerAnglesDegrees(Vector3(angle, 10.0f, -angle * 0.5f)));
+            // Include nearly identical and opposite facing pairs to cover the lerp and short way around paths
+            if (i == 3)
+            {
+                to.push_back(from.back());
+            }
+            else if (i == 5)
+            {
+                to.push_back(-Quaternion::CreateFromEulerAnglesDegrees(Vector3(angle + 20.0f, 10.0f, 0.0f)));
+            }
+            else
+            {
+                to.push_back(Quaternion::CreateFromEulerAnglesDegrees(Vector3(-angle, 90.0f, angle)));
+            }
+            t.push_back(static_cast<float>(i) / static_cast<float>(BatchSize - 1));
+        }
+
+        AZStd::vector<Quaternion> results(BatchSize);
+        MathBatch::SlerpQuaternions(from, to, t, results);
+        for (size_t i = 0; i < BatchSize; ++i)
+        {
+            EXPECT_THAT(results[i], IsCloseTolerance(from[i].Slerp(to[i], t[i]), 1e-4f));
+        }
+    }
+} // namespace UnitTest
@@ -3153,4 +3153,111 @@ namespace UnitTest
     {
         TestZeroVectorInt<Simd::Vec4>();
     }
+
+    // Vec8 only supports a float subset of the Vec4 interface, so it's tested separately from the templated tests above
+    TEST(MATH_SimdMath, TestLoadStoreFloatVec8)
+    {
+        alignas(32) float testLoadValues[8] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f };
+        alignas(32) float testStoreValues[8] = {};
+
+        Simd::Vec8::StoreUnaligned(testStoreValues, Simd::Vec8::LoadUnaligned(testLoadValues));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(testLoadValues[i], testStoreValues[i]);
+        }
+
+        Simd::Vec8::StoreAligned(testStoreValues, Simd::Vec8::Splat(-2.0f));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(-2.0f, testStoreValues[i]);
+        }
+
+        Simd::Vec8::StoreAligned(testStoreValues, Simd::Vec8::ZeroFloat());
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(0.0f, testStoreValues[i]);
+        }
+    }
+
+    TEST(MATH_SimdMath, TestArithmeticFloatVec8)
+    {
+        const float values1[8] = { 1.0f, -2.0f, 3.5f, 4.0f, -5.0f, 6.25f, 7.0f, -8.0f };
+        const float values2[8] = { 2.0f, 4.0f, -1.0f, 0.5f, 3.0f, -2.0f, 7.0f, 16.0f };
+        const float values3[8] = { 0.5f, 1.0f, 1.5f, 2.0f, 2.5f, 3.0f, 3.5f, 4.0f };
+
+        const Simd::Vec8::FloatType vec1 = Simd::Vec8::LoadUnaligned(values1);
+        const Simd::Vec8::FloatType vec2 = Simd::Vec8::LoadUnaligned(values2);
+        const Simd::Vec8::FloatType vec3 = Simd::Vec8::LoadUnaligned(values3);
+
+        float add[8], sub[8], mul[8], madd[8], div[8], abs[8], min[8], max[8];
+        Simd::Vec8::StoreUnaligned(add, Simd::Vec8::Add(vec1, vec2));
+        Simd::Vec8::StoreUnaligned(sub, Simd::Vec8::Sub(vec1, vec2));
+        Simd::Vec8::StoreUnaligned(mul, Simd::Vec8::Mul(vec1, vec2));
+        Simd::Vec8::StoreUnaligned(madd, Simd::Vec8::Madd(vec1, vec2, vec3));
+        Simd::Vec8::StoreUnaligned(div, Simd::Vec8::Div(vec1, vec2));
+        Simd::Vec8::StoreUnaligned(abs, Simd::Vec8::Abs(vec1));
+        Simd::Vec8::StoreUnaligned(min, Simd::Vec8::Min(vec1, vec2));
+        Simd::Vec8::StoreUnaligned(max, Simd::Vec8::Max(vec1, vec2));
+
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_NEAR(values1[i] + values2[i], add[i], AZ::Constants::Tolerance);
+            EXPECT_NEAR(values1[i] - values2[i], sub[i], AZ::Constants::Tolerance);
+            EXPECT_NEAR(values1[i] * values2[i], mul[i], AZ::Constants::Tolerance);
+            EXPECT_NEAR(values1[i] * values2[i] + values3[i], madd[i], AZ::Constants::Tolerance);
+            EXPECT_NEAR(values1[i] / values2[i], div[i], AZ::Constants::Tolerance);
+            EXPECT_NEAR(fabsf(values1[i]), abs[i], AZ::Constants::Tolerance);
+            EXPECT_NEAR(AZStd::min(values1[i], values2[i]), min[i], AZ::Constants::Tolerance);
+            EXPECT_NEAR(AZStd::max(values1[i], values2[i]), max[i], AZ::Constants::Tolerance);
+        }
+    }
+
+    TEST(MATH_SimdMath, TestFloorCeilSqrtFloatVec8)
+    {
+        const float values[8] = { 0.5f, 1.5f, -1.5f, 2.0f, 9.0f, 16.25f, -0.25f, 100.0f };
+        const float positiveValues[8] = { 0.25f, 1.0f, 2.0f, 4.0f, 9.0f, 16.0f, 0.5f, 100.0f };
+
+        float floor[8], ceil[8], sqrt[8], sqrtInv[8], reciprocal[8];
+        Simd::Vec8::StoreUnaligned(floor, Simd::Vec8::Floor(Simd::Vec8::LoadUnaligned(values)));
+        Simd::Vec8::StoreUnaligned(ceil, Simd::Vec8::Ceil(Simd::Vec8::LoadUnaligned(values)));
+        Simd::Vec8::StoreUnaligned(sqrt, Simd::Vec8::Sqrt(Simd::Vec8::LoadUnaligned(positiveValues)));
+        Simd::Vec8::StoreUnaligned(sqrtInv, Simd::Vec8::SqrtInv(Simd::Vec8::LoadUnaligned(positiveValues)));
+        Simd::Vec8::StoreUnaligned(reciprocal, Simd::Vec8::Reciprocal(Simd::Vec8::LoadUnaligned(positiveValues)));
+
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(floorf(values[i]), floor[i]);
+            EXPECT_EQ(ceilf(values[i]), ceil[i]);
+            EXPECT_NEAR(sqrtf(positiveValues[i]), sqrt[i], AZ::Constants::Tolerance);
+            EXPECT_NEAR(1.0f / sqrtf(positiveValues[i]), sqrtInv[i], AZ::Constants::Tolerance);
+            EXPECT_NEAR(1.0f / positiveValues[i], reciprocal[i], AZ::Constants::Tolerance);
+        }
+    }
+
+    TEST(MATH_SimdMath, TestCompareSelectFloatVec8)
+    {
+        const float values1[8] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f };
+        const float values2[8] = { 8.0f, 2.0f, 6.0f, 4.0f, 4.0f, 3.0f, 7.0f, 1.0f };
+
+        const Simd::Vec8::FloatType vec1 = Simd::Vec8::LoadUnaligned(values1);
+        const Simd::Vec8::FloatType vec2 = Simd::Vec8::LoadUnaligned(values2);
+
+        float lessThan[8], selected[8];
+        Simd::Vec8::StoreUnaligned(lessThan, Simd::Vec8::And(Simd::Vec8::CmpLt(vec1, vec2), Simd::Vec8::Splat(1.0f)));
+        Simd::Vec8::StoreUnaligned(selected, Simd::Vec8::Select(vec1, vec2, Simd::Vec8::CmpGtEq(vec1, vec2)));
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(values1[i] < values2[i] ? 1.0f : 0.0f, lessThan[i]);
+            EXPECT_EQ(AZStd::max(values1[i], values2[i]), selected[i]);
+        }
+
+        // Every lane has to pass, including the ones in the upper half
+        EXPECT_TRUE(Simd::Vec8::CmpAllEq(vec1, vec1));
+        EXPECT_FALSE(Simd::Vec8::CmpAllEq(vec1, vec2));
+        EXPECT_TRUE(Simd::Vec8::CmpAllLt(vec1, Simd::Vec8::Splat(9.0f)));
+        EXPECT_FALSE(Simd::Vec8::CmpAllLt(vec1, Simd::Vec8::Splat(8.0f)));
+        EXPECT_TRUE(Simd::Vec8::CmpAllLtEq(vec1, Simd::Vec8::Splat(8.0f)));
+        EXPECT_TRUE(Simd::Vec8::CmpAllGt(vec1, Simd::Vec8::ZeroFloat()));
+        EXPECT_FALSE(Simd::Vec8::CmpAllGtEq(vec1, Simd::Vec8::Splat(2.0f)));
+    }
 }
@@ -12,6 +12,8 @@
 
 #include <AzCore/Memory/AllocationRecords.h>
 #include <AzCore/Debug/StackTracer.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Metrics/JsonTraceEventLogger.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <AzCore/std/parallel/thread.h>
@@ -892,6 +894,121 @@ namespace UnitTest
         run();
     }
 
+    class AllocationRecordsSamplingTest
+        : public LeakDetectionFixture
+    {
+    public:
+        static constexpr size_t SamplingInterval = 1024;
+
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_records = AZStd::make_unique<AllocationRecords>(static_cast<unsigned char>(8), false, false, "SamplingTest");
+            m_records->SetMode(AllocationRecords::RECORD_FULL);
+            m_records->SetSamplingInterval(SamplingInterval);
+        }
+
+        void TearDown() override
+        {
+            m_records.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+        static void* GetAddress(size_t index)
+        {
+            // The records never access the memory, so any unique address will do.
+            return reinterpret_cast<void*>((index + 1) * 16);
+        }
+
+    protected:
+        AZStd::unique_ptr<AllocationRecords> m_records;
+    };
+
+    TEST_F(AllocationRecordsSamplingTest, RegisterAllocation_ManySmallAllocations_EstimatedBytesAreCloseToAllocatedBytes)
+    {
+        constexpr size_t AllocationCount = 20000;
+        constexpr size_t AllocationSize = 64;
+        for (size_t i = 0; i < AllocationCount; ++i)
+        {
+            m_records->RegisterAllocation(GetAddress(i), AllocationSize, 8, 0);
+        }
+
+        const size_t totalBytes = AllocationCount * AllocationSize;
+        size_t estimatedBytes = 0;
+        m_records->EnumerateAllocations(
+            [&estimatedBytes](void*, const AllocationInfo& info, unsigned char)
+            {
+                EXPECT_NE(0u, info.m_sampledBytes);
+                estimatedBytes += info.m_sampledBytes;
+                return true;
+            });
+        // On average one sample per interval, so only a fraction of the allocations are recorded.
+        EXPECT_LT(m_records->GetMap().size(), AllocationCount / 4);
+        EXPECT_GT(estimatedBytes, totalBytes * 3 / 4);
+        EXPECT_LT(estimatedBytes, totalBytes * 5 / 4);
+    }
+
+    TEST_F(AllocationRecordsSamplingTest, RegisterAllocation_AllocationMuchLargerThanInterval_IsAlwaysRecorded)
+    {
+        for (size_t i = 0; i < 16; ++i)
+        {
+            EXPECT_NE(nullptr, m_records->RegisterAllocation(GetAddress(i), SamplingInterval * 64, 8, 0));
+        }
+        EXPECT_EQ(16u, m_records->GetMap().size());
+    }
+
+    TEST_F(AllocationRecordsSamplingTest, RegisterAllocation_SameStack_StacksAreShared)
+    {
+        for (size_t i = 0; i < 4; ++i)
+        {
+            m_records->RegisterAllocation(GetAddress(i), SamplingInterval * 64, 8, 0);
+        }
+
+        const StackFrame* stackFrames = m_records->GetMap().begin()->second.m_stackFrames;
+        ASSERT_NE(nullptr, stackFrames);
+        for (const auto& [address, info] : m_records->GetMap())
+        {
+            EXPECT_EQ(stackFrames, info.m_stackFrames);
+        }
+
+        for (size_t i = 0; i < 4; ++i)
+        {
+            m_records->UnregisterAllocation(GetAddress(i), SamplingInterval * 64, 8, nullptr);
+        }
+        EXPECT_TRUE(m_records->GetMap().empty());
+    }
+
+    TEST_F(AllocationRecordsSamplingTest, UnregisterAllocation_AllocationWasNotSampled_IsIgnored)
+    {
+        // Tiny allocations are unlikely to be sampled, but the ones that weren't recorded must not cause any errors.
+        for (size_t i = 0; i < 64; ++i)
+        {
+            m_records->RegisterAllocation(GetAddress(i), 1, 1, 0);
+        }
+        for (size_t i = 0; i < 64; ++i)
+        {
+            m_records->UnregisterAllocation(GetAddress(i), 1, 1, nullptr);
+        }
+        EXPECT_TRUE(m_records->GetMap().empty());
+        EXPECT_EQ(0u, m_records->RequestedBytes());
+    }
+
+    TEST_F(AllocationRecordsSamplingTest, ExportSampledAllocations_WithSamples_WritesEventsPerStack)
+    {
+        m_records->RegisterAllocation(GetAddress(0), SamplingInterval * 64, 8, 0);
+
+        AZStd::string output;
+        {
+            Metrics::JsonTraceEventLogger eventLogger(AZStd::make_unique<IO::ByteContainerStream<AZStd::string>>(&output));
+            m_records->ExportSampledAllocations(eventLogger);
+        }
+        EXPECT_NE(AZStd::string::npos, output.find("SamplingTest"));
+        EXPECT_NE(AZStd::string::npos, output.find("estimatedBytes"));
+        EXPECT_NE(AZStd::string::npos, output.find("estimatedLiveBytes"));
+
+        m_records->UnregisterAllocation(GetAddress(0), SamplingInterval * 64, 8, nullptr);
+    }
+
 #if AZ_TRAIT_PERF_MEMORYBENCHMARK_IS_AVAILABLE
     class PERF_MemoryBenchmark
         : public ::testing::Test
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    class FrameArenaAllocatorTestFixture
+        : public LeakDetectionFixture
+    {
+    public:
+        static constexpr size_t BlockSize = 4096;
+
+        static AZ::FrameArenaAllocator::Descriptor GetDescriptor()
+        {
+            AZ::FrameArenaAllocator::Descriptor desc;
+            desc.m_blockSize = BlockSize;
+            desc.m_maxRetainedBlocks = 2;
+            return desc;
+        }
+    };
+
+    TEST_F(FrameArenaAllocatorTestFixture, Allocate_MultipleAllocations_AreAlignedAndDoNotOverlap)
+    {
+        AZ::FrameArenaAllocator allocator(GetDescriptor());
+        char* first = static_cast<char*>(allocator.allocate(10, 1));
+        char* second = static_cast<char*>(allocator.allocate(32, 16));
+        ASSERT_NE(nullptr, first);
+        ASSERT_NE(nullptr, second);
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(second) % 16);
+        EXPECT_GE(second, first + 10);
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, Deallocate_LastAllocation_MemoryIsReused)
+    {
+        AZ::FrameArenaAllocator allocator(GetDescriptor());
+        void* first = allocator.allocate(64, 8);
+        allocator.deallocate(first, 64, 8);
+        void* second = allocator.allocate(64, 8);
+        EXPECT_EQ(first, second);
+
+        // Older allocations are only reclaimed when the frame ends.
+        void* third = allocator.allocate(64, 8);
+        allocator.deallocate(second, 64, 8);
+        EXPECT_NE(second, allocator.allocate(64, 8));
+        EXPECT_NE(nullptr, third);
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, NextFrame_AllocationsAfterReset_ReuseRetainedBlocks)
+    {
+        AZ::FrameArenaAllocator allocator(GetDescriptor());
+        void* first = allocator.allocate(128, 8);
+        for (int i = 0; i < 32; ++i)
+        {
+            allocator.allocate(256, 8);
+        }
+        const size_t allocatedBytes = allocator.NumAllocatedBytes();
+        EXPECT_GT(allocatedBytes, BlockSize * 2);
+
+        allocator.NextFrame();
+        EXPECT_EQ(1u, allocator.GetFrame());
+        EXPECT_EQ(first, allocator.allocate(128, 8));
+        // Only the retained blocks are kept after the reset.
+        EXPECT_EQ(BlockSize * 2, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, Allocate_LargerThanHalfABlock_GetsDedicatedBlockThatIsReleasedOnReset)
+    {
+        AZ::FrameArenaAllocator allocator(GetDescriptor());
+        allocator.allocate(16, 8);
+        const size_t regularBytes = allocator.NumAllocatedBytes();
+
+        void* large = allocator.allocate(BlockSize * 4, 16);
+        ASSERT_NE(nullptr, large);
+        EXPECT_GT(allocator.NumAllocatedBytes(), regularBytes + BlockSize * 4);
+
+        allocator.NextFrame();
+        allocator.allocate(16, 8);
+        EXPECT_EQ(regularBytes, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, Reallocate_LastAllocation_GrowsInPlace)
+    {
+        AZ::FrameArenaAllocator allocator(GetDescriptor());
+        void* ptr = allocator.allocate(64, 8);
+        EXPECT_EQ(ptr, allocator.reallocate(ptr, 256, 8));
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, UsedByVector_ElementsAreStored)
+    {
+        AZ::FrameArenaAllocator allocator(GetDescriptor());
+        {
+            AZStd::vector<int, AZ::AZStdIAllocator> values{ AZ::AZStdIAllocator(&allocator) };
+            for (int i = 0; i < 1000; ++i)
+            {
+                values.push_back(i);
+            }
+            for (int i = 0; i < 1000; ++i)
+            {
+                EXPECT_EQ(i, values[i]);
+            }
+        }
+        allocator.NextFrame();
+        allocator.GarbageCollect();
+        EXPECT_EQ(0u, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, Allocate_MultipleThreads_EachThreadUsesItsOwnArena)
+    {
+        AZ::FrameArenaAllocator allocator(GetDescriptor());
+        constexpr size_t ThreadCount = 4;
+        AZStd::vector<void*> firstAllocations(ThreadCount, nullptr);
+
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t i = 0; i < ThreadCount; ++i)
+        {
+            threads.emplace_back(
+                [&allocator, &firstAllocations, i]()
+                {
+                    firstAllocations[i] = allocator.allocate(64, 8);
+                    for (int j = 0; j < 100; ++j)
+                    {
+                        allocator.allocate(64, 8);
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (size_t i = 0; i < ThreadCount; ++i)
+        {
+            ASSERT_NE(nullptr, firstAllocations[i]);
+            for (size_t j = i + 1; j < ThreadCount; ++j)
+            {
+                EXPECT_NE(firstAllocations[i], firstAllocations[j]);
+            }
+        }
+    }
+} // namespace UnitTest
@@ -9,6 +9,7 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/HphaAllocator.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace UnitTest
 {
@@ -106,4 +107,125 @@ namespace UnitTest
     INSTANTIATE_TEST_CASE_P(Mixed,
         HphaSchemaTestFixture,
         ::testing::ValuesIn(s_mixedInstancesParameters));
+
+    class HphaSchemaThreadCacheTestFixture
+        : public LeakDetectionFixture
+    {
+    public:
+        static constexpr size_t MaxCachedSize = 128;
+        static constexpr AZ::u32 MagazineCapacity = 16;
+
+        static AZ::HphaSchema::ThreadCacheConfig GetConfig()
+        {
+            AZ::HphaSchema::ThreadCacheConfig config;
+            config.m_maxCachedSize = MaxCachedSize;
+            config.m_magazineCapacity = MagazineCapacity;
+            return config;
+        }
+    };
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, AllocateAndDeallocate_SmallAllocations_ServedFromThreadCache)
+    {
+        AZ::HphaSchema schema(GetConfig());
+        AZStd::vector<void*, AZ::OSStdAllocator> allocations;
+        for (size_t i = 0; i < MagazineCapacity; ++i)
+        {
+            allocations.push_back(schema.allocate(64, 8));
+            ASSERT_NE(nullptr, allocations.back());
+        }
+        EXPECT_EQ(MagazineCapacity * 64, schema.NumAllocatedBytes());
+
+        for (void* allocation : allocations)
+        {
+            schema.deallocate(allocation, 64);
+        }
+        EXPECT_EQ(0u, schema.NumAllocatedBytes());
+
+        AZ::AllocatorThreadCacheStats stats = schema.GetThreadCacheStats();
+        EXPECT_EQ(1u, stats.m_threadCount);
+        EXPECT_EQ(MagazineCapacity * 64, stats.m_cachedBytes);
+        EXPECT_GT(stats.m_hits, 0u);
+        EXPECT_GT(stats.m_refills, 0u);
+
+        // Allocating again reuses the cached blocks without refilling.
+        void* allocation = schema.allocate(64, 8);
+        EXPECT_EQ(allocations.back(), allocation);
+        EXPECT_EQ(stats.m_refills, schema.GetThreadCacheStats().m_refills);
+        schema.deallocate(allocation, 64);
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, Deallocate_MagazineIsFull_HalfIsReturnedToBuckets)
+    {
+        AZ::HphaSchema schema(GetConfig());
+        AZStd::vector<void*, AZ::OSStdAllocator> allocations;
+        for (size_t i = 0; i < MagazineCapacity * 2; ++i)
+        {
+            allocations.push_back(schema.allocate(32, 8));
+        }
+        for (void* allocation : allocations)
+        {
+            schema.deallocate(allocation, 32);
+        }
+
+        AZ::AllocatorThreadCacheStats stats = schema.GetThreadCacheStats();
+        EXPECT_GT(stats.m_flushes, 0u);
+        EXPECT_LE(stats.m_cachedBytes, MagazineCapacity * 32);
+        EXPECT_EQ(0u, schema.NumAllocatedBytes());
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, GarbageCollect_BlocksCachedByCallingThread_CacheIsEmptied)
+    {
+        AZ::HphaSchema schema(GetConfig());
+        void* allocation = schema.allocate(16, 8);
+        schema.deallocate(allocation, 16);
+        EXPECT_GT(schema.GetThreadCacheStats().m_cachedBytes, 0u);
+
+        schema.GarbageCollect();
+        EXPECT_EQ(0u, schema.GetThreadCacheStats().m_cachedBytes);
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, AllocateAndDeallocate_LargerThanMaxCachedSize_BypassesThreadCache)
+    {
+        AZ::HphaSchema schema(GetConfig());
+        void* allocation = schema.allocate(MaxCachedSize * 2, 8);
+        schema.deallocate(allocation, MaxCachedSize * 2);
+
+        AZ::AllocatorThreadCacheStats stats = schema.GetThreadCacheStats();
+        EXPECT_EQ(0u, stats.m_threadCount);
+        EXPECT_EQ(0u, stats.m_cachedBytes);
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, AllocateAndDeallocate_MultipleThreads_CachesAreReleasedOnThreadExit)
+    {
+        AZ::HphaSchema schema(GetConfig());
+        constexpr size_t ThreadCount = 4;
+        constexpr size_t AllocationCount = 1000;
+
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t i = 0; i < ThreadCount; ++i)
+        {
+            threads.emplace_back(
+                [&schema]()
+                {
+                    AZStd::vector<void*, AZ::OSStdAllocator> allocations;
+                    for (size_t j = 0; j < AllocationCount; ++j)
+                    {
+                        allocations.push_back(schema.allocate(8 + (j % MaxCachedSize), 8));
+                    }
+                    for (size_t j = 0; j < AllocationCount; ++j)
+                    {
+                        schema.deallocate(allocations[j], 8 + (j % MaxCachedSize));
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        AZ::AllocatorThreadCacheStats stats = schema.GetThreadCacheStats();
+        EXPECT_EQ(0u, stats.m_threadCount);
+        EXPECT_EQ(0u, stats.m_cachedBytes);
+        EXPECT_EQ(0u, schema.NumAllocatedBytes());
+    }
 }
@@ -524,6 +524,36 @@ namespace UnitTest
             EXPECT_FALSE(JsonStringContains(metricsOutput, R"("Field1":"Metrics Elided")"));
         }
     }
+
+    TEST_F(JsonTraceEventLoggerTest, RecordCompleteEvent_WithTimestampAndThread_UsesProvidedValues)
+    {
+        AZStd::string metricsOutput;
+        auto metricsStream = AZStd::make_unique<AZ::IO::ByteContainerStream<AZStd::string>>(&metricsOutput);
+        AZ::Metrics::JsonTraceEventLogger googleTraceLogger(AZStd::move(metricsStream));
+
+        AZStd::thread_id otherThreadId;
+        AZStd::thread otherThread(
+            [&otherThreadId]
+            {
+                otherThreadId = AZStd::this_thread::get_id();
+            });
+        otherThread.join();
+
+        AZ::Metrics::CompleteArgs completeArgs;
+        completeArgs.m_name = "PastEvent";
+        completeArgs.m_cat = "Test";
+        completeArgs.m_ts = AZStd::chrono::microseconds(123456);
+        completeArgs.m_tid = otherThreadId;
+        completeArgs.m_dur = AZStd::chrono::microseconds(42);
+        EXPECT_TRUE(googleTraceLogger.RecordCompleteEvent(completeArgs));
+        googleTraceLogger.ResetStream(nullptr);
+
+        uintptr_t numericThreadId{};
+        *reinterpret_cast<AZStd::thread_id*>(&numericThreadId) = otherThreadId;
+        EXPECT_TRUE(JsonStringContains(metricsOutput, R"("ts": 123456)"));
+        EXPECT_TRUE(JsonStringContains(metricsOutput, AZStd::string::format(R"("tid": %llu)", static_cast<unsigned long long>(numericThreadId))));
+        EXPECT_TRUE(JsonStringContains(metricsOutput, R"("dur": 42)"));
+    }
 } // namespace UnitTest
 
 
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Metrics/MetricsRegistryImpl.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class MetricsRegistryTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    };
+
+    TEST_F(MetricsRegistryTest, RegisterCounter_SameNameTwice_ReturnsSameCounter)
+    {
+        AZ::Metrics::MetricsRegistryImpl metricsRegistry;
+        AZ::Metrics::Counter* counter = metricsRegistry.RegisterCounter("sent_bytes_total", "Bytes sent");
+        ASSERT_NE(nullptr, counter);
+        EXPECT_EQ(counter, metricsRegistry.RegisterCounter("sent_bytes_total", "Bytes sent"));
+        EXPECT_EQ(counter, metricsRegistry.FindMetric("sent_bytes_total"));
+
+        EXPECT_TRUE(metricsRegistry.UnregisterMetric("sent_bytes_total"));
+        EXPECT_EQ(nullptr, metricsRegistry.FindMetric("sent_bytes_total"));
+        EXPECT_FALSE(metricsRegistry.UnregisterMetric("sent_bytes_total"));
+    }
+
+    TEST_F(MetricsRegistryTest, RegisterMetric_InvalidNameOrOtherType_Fails)
+    {
+        AZ::Metrics::MetricsRegistryImpl metricsRegistry;
+        ASSERT_NE(nullptr, metricsRegistry.RegisterGauge("entity_count", "Entities"));
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_EQ(nullptr, metricsRegistry.RegisterCounter("entity_count", "Entities"));
+        EXPECT_EQ(nullptr, metricsRegistry.RegisterGauge("0entity count", "Entities"));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(2);
+    }
+
+    TEST_F(MetricsRegistryTest, CounterIncrement_FromMultipleThreads_SumsAllIncrements)
+    {
+        AZ::Metrics::MetricsRegistryImpl metricsRegistry;
+        AZ::Metrics::Counter* counter = metricsRegistry.RegisterCounter("increments_total", "Increments");
+        ASSERT_NE(nullptr, counter);
+
+        constexpr size_t ThreadCount = 8;
+        constexpr AZ::u64 IncrementCount = 10000;
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+        {
+            threads.emplace_back([counter]()
+            {
+                for (AZ::u64 index = 0; index < IncrementCount; ++index)
+                {
+                    counter->Increment();
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(ThreadCount * IncrementCount, counter->GetValue());
+    }
+
+    TEST_F(MetricsRegistryTest, WritePrometheusText_AllMetricTypes_WritesTextExpositionFormat)
+    {
+        AZ::Metrics::MetricsRegistryImpl metricsRegistry;
+        metricsRegistry.RegisterCounter("sent_bytes_total", "Bytes sent")->Increment(42);
+        metricsRegistry.RegisterGauge("entity_count", "Entities")->Set(7.0);
+        const double bucketBounds[] = { 10.0, 20.0 };
+        AZ::Metrics::Histogram* histogram = metricsRegistry.RegisterHistogram("tick_time_ms", "Tick time", bucketBounds);
+        histogram->Observe(5.0);
+        histogram->Observe(20.0);
+        histogram->Observe(40.0);
+
+        AZStd::string output;
+        AZ::Metrics::WritePrometheusText(metricsRegistry, output);
+
+        // Metrics are written in the order of their names
+        EXPECT_EQ(
+            "# HELP entity_count Entities\n"
+            "# TYPE entity_count gauge\n"
+            "entity_count 7\n"
+            "# HELP sent_bytes_total Bytes sent\n"
+            "# TYPE sent_bytes_total counter\n"
+            "sent_bytes_total 42\n"
+            "# HELP tick_time_ms Tick time\n"
+            "# TYPE tick_time_ms histogram\n"
+            "tick_time_ms_bucket{le=\"10\"} 1\n"
+            "tick_time_ms_bucket{le=\"20\"} 2\n"
+            "tick_time_ms_bucket{le=\"+Inf\"} 3\n"
+            "tick_time_ms_sum 65\n"
+            "tick_time_ms_count 3\n",
+            output);
+    }
+} // namespace UnitTest
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Metrics/PerfettoTraceEventLogger.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class PerfettoTraceEventLoggerTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    protected:
+        struct DecodedTrackEvent
+        {
+            AZ::u64 m_timestampNs = 0;
+            AZ::u64 m_type = 0;
+            AZ::u64 m_nameIid = 0;
+        };
+
+        struct DecodedTrace
+        {
+            AZStd::vector<DecodedTrackEvent> m_trackEvents;
+            size_t m_internedNameCount = 0;
+            bool m_valid = true;
+        };
+
+        // Minimal protobuf reader, which visits the fields of a message with the varint value or the bytes of each field
+        template<class FieldVisitor>
+        static bool ReadMessage(AZStd::string_view message, FieldVisitor&& visitor)
+        {
+            size_t offset = 0;
+            auto readVarint = [&message, &offset](AZ::u64& value)
+            {
+                value = 0;
+                for (uint32_t shift = 0; offset < message.size() && shift < 64; shift += 7)
+                {
+                    const auto byte = static_cast<AZ::u8>(message[offset++]);
+                    value |= AZ::u64{ byte & 0x7fu } << shift;
+                    if ((byte & 0x80) == 0)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            };
+
+            while (offset < message.size())
+            {
+                AZ::u64 tag;
+                if (!readVarint(tag))
+                {
+                    return false;
+                }
+                const auto field = static_cast<uint32_t>(tag >> 3);
+                AZ::u64 value = 0;
+                AZStd::string_view bytes;
+                switch (tag & 7)
+                {
+                case 0:
+                    if (!readVarint(value))
+                    {
+                        return false;
+                    }
+                    break;
+                case 1:
+                    if (offset + 8 > message.size())
+                    {
+                        return false;
+                    }
+                    offset += 8;
+                    break;
+                case 2:
+                    if (!readVarint(value) || offset + value > message.size())
+                    {
+                        return false;
+                    }
+                    bytes = message.substr(offset, value);
+                    offset += value;
+                    break;
+                default:
+                    return false;
+                }
+                visitor(field, value, bytes);
+            }
+            return true;
+        }
+
+        static DecodedTrace DecodeTrace(AZStd::string_view trace)
+        {
+            DecodedTrace decodedTrace;
+            decodedTrace.m_valid = ReadMessage(trace, [&decodedTrace](uint32_t field, AZ::u64, AZStd::string_view packet)
+            {
+                if (field != 1)
+                {
+                    decodedTrace.m_valid = false;
+                    return;
+                }
+
+                DecodedTrackEvent trackEvent;
+                bool hasTrackEvent = false;
+                ReadMessage(packet, [&](uint32_t packetField, AZ::u64 value, AZStd::string_view bytes)
+                {
+                    if (packetField == 8)
+                    {
+                        trackEvent.m_timestampNs = value;
+                    }
+                    else if (packetField == 11)
+                    {
+                        hasTrackEvent = true;
+                        ReadMessage(bytes, [&trackEvent](uint32_t eventField, AZ::u64 eventValue, AZStd::string_view)
+                        {
+                            if (eventField == 9)
+                            {
+                                trackEvent.m_type = eventValue;
+                            }
+                            else if (eventField == 10)
+                            {
+                                trackEvent.m_nameIid = eventValue;
+                            }
+                        });
+                    }
+                    else if (packetField == 12)
+                    {
+                        ReadMessage(bytes, [&decodedTrace](uint32_t internedField, AZ::u64, AZStd::string_view)
+                        {
+                            decodedTrace.m_internedNameCount += internedField == 2 ? 1 : 0;
+                        });
+                    }
+                });
+                if (hasTrackEvent)
+                {
+                    decodedTrace.m_trackEvents.push_back(trackEvent);
+                }
+            });
+            return decodedTrace;
+        }
+
+        static AZ::Metrics::CompleteArgs MakeCompleteArgs(AZStd::string_view name, AZ::s64 startUs, AZ::s64 durationUs)
+        {
+            AZ::Metrics::CompleteArgs completeArgs;
+            completeArgs.m_name = name;
+            completeArgs.m_cat = "Test";
+            completeArgs.m_ts = AZStd::chrono::microseconds(startUs);
+            completeArgs.m_dur = AZStd::chrono::microseconds(durationUs);
+            return completeArgs;
+        }
+    };
+
+    TEST_F(PerfettoTraceEventLoggerTest, RecordCompleteEvent_RecordedOutOfOrder_WrittenAsNestedSlices)
+    {
+        AZStd::string metricsOutput;
+        auto metricsStream = AZStd::make_unique<AZ::IO::ByteContainerStream<AZStd::string>>(&metricsOutput);
+        AZ::Metrics::PerfettoTraceEventLogger perfettoLogger(AZStd::move(metricsStream), "PerfettoTest");
+
+        // Children are recorded before their parents, like the profiling regions which are recorded when they end
+        EXPECT_TRUE(perfettoLogger.RecordCompleteEvent(MakeCompleteArgs("Inner", 20, 10)));
+        EXPECT_TRUE(perfettoLogger.RecordCompleteEvent(MakeCompleteArgs("Outer", 10, 40)));
+        EXPECT_TRUE(perfettoLogger.RecordCompleteEvent(MakeCompleteArgs("Next", 50, 5)));
+        perfettoLogger.ResetStream(nullptr);
+
+        const DecodedTrace decodedTrace = DecodeTrace(metricsOutput);
+        ASSERT_TRUE(decodedTrace.m_valid);
+        ASSERT_EQ(6, decodedTrace.m_trackEvents.size());
+
+        constexpr AZ::u64 SliceBegin = 1;
+        constexpr AZ::u64 SliceEnd = 2;
+        const AZStd::pair<AZ::u64, AZ::u64> expectedEvents[] = {
+            { SliceBegin, 10'000 }, { SliceBegin, 20'000 }, { SliceEnd, 30'000 },
+            { SliceEnd, 50'000 }, { SliceBegin, 50'000 }, { SliceEnd, 55'000 }
+        };
+        for (size_t index = 0; index < decodedTrace.m_trackEvents.size(); ++index)
+        {
+            EXPECT_EQ(expectedEvents[index].first, decodedTrace.m_trackEvents[index].m_type);
+            EXPECT_EQ(expectedEvents[index].second, decodedTrace.m_trackEvents[index].m_timestampNs);
+        }
+    }
+
+    TEST_F(PerfettoTraceEventLoggerTest, RecordInstantEvent_RepeatedName_InternedOnce)
+    {
+        AZStd::string metricsOutput;
+        auto metricsStream = AZStd::make_unique<AZ::IO::ByteContainerStream<AZStd::string>>(&metricsOutput);
+        AZ::Metrics::PerfettoTraceEventLogger perfettoLogger(AZStd::move(metricsStream));
+
+        AZStd::fixed_vector<AZ::Metrics::EventField, 2> argContainer{ { "Field1", AZ::s64{ -2 } }, { "Field2", "Hello world" } };
+        AZ::Metrics::InstantArgs instantArgs;
+        instantArgs.m_name = "RepeatedEvent";
+        instantArgs.m_args = argContainer;
+        for (int index = 0; index < 10; ++index)
+        {
+            EXPECT_TRUE(perfettoLogger.RecordInstantEvent(instantArgs));
+        }
+        perfettoLogger.ResetStream(nullptr);
+
+        const DecodedTrace decodedTrace = DecodeTrace(metricsOutput);
+        ASSERT_TRUE(decodedTrace.m_valid);
+        ASSERT_EQ(10, decodedTrace.m_trackEvents.size());
+        EXPECT_EQ(1, decodedTrace.m_internedNameCount);
+        for (const DecodedTrackEvent& trackEvent : decodedTrace.m_trackEvents)
+        {
+            EXPECT_EQ(3, trackEvent.m_type);
+            EXPECT_EQ(1, trackEvent.m_nameIid);
+        }
+    }
+
+    TEST_F(PerfettoTraceEventLoggerTest, RecordEvent_WithoutStream_Fails)
+    {
+        AZ::Metrics::PerfettoTraceEventLogger perfettoLogger;
+        AZ::Metrics::InstantArgs instantArgs;
+        instantArgs.m_name = "Event";
+        EXPECT_FALSE(perfettoLogger.RecordInstantEvent(instantArgs));
+        EXPECT_FALSE(perfettoLogger.RecordCompleteEvent(MakeCompleteArgs("Event", 0, 1)));
+    }
+} // namespace UnitTest
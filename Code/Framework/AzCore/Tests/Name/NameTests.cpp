@@ -50,9 +50,24 @@ namespace UnitTest
             AZ::NameDictionary::Destroy();
         }
 
-        static const auto& GetDictionary()
+        static AZ::Name::Hash GetShardCount()
         {
-            return AZ::NameDictionary::Instance().m_dictionary;
+            return static_cast<AZ::Name::Hash>(AZ::NameDictionary::ShardCount);
+        }
+
+        static bool ContainsName(AZStd::string_view nameString)
+        {
+            for (const auto& shard : AZ::NameDictionary::Instance().m_shards)
+            {
+                for (const auto& entry : shard.m_entries)
+                {
+                    if (entry.second.m_nameData->GetName() == nameString)
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
         }
         
         static size_t GetEntryCount()
@@ -76,7 +91,7 @@ namespace UnitTest
                     break;
                 }
             }
-            return GetDictionary().size() - staticNameCount;
+            return AZ::NameDictionary::Instance().GetEntryCount() - staticNameCount;
         }
 
         //! Directly calculate the hash value for a string without collision resolution
@@ -297,13 +312,7 @@ namespace UnitTest
         // Make sure all entries in the localDictionary got copied into the globalDictionary
         for (const AZStd::string& nameString : localDictionary)
         {
-            auto& globalDictionary = NameDictionaryTester::GetDictionary();
-            // Workaround VS2022 17.3 issue with incorrect detection of unused lambda captures assigning the nameString reference to a same type
-            auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString = nameString](const AZStd::pair<AZ::Name::Hash, AZ::NameDictionary::ScopedNameDataWrapper>& entry)
-            {
-                return entry.second.m_nameData->GetName() == nameString;
-            });
-            EXPECT_TRUE(it != globalDictionary.end()) << "Can't find '" << nameString.data() << "' in local dictionary.";
+            EXPECT_TRUE(NameDictionaryTester::ContainsName(nameString)) << "Can't find '" << nameString.data() << "' in local dictionary.";
         }
 
         // Make sure all the threads got an accurate Name object
@@ -663,6 +672,37 @@ namespace UnitTest
         AZ::Interface<AZ::NameDictionary>::Unregister(nameDictionary.get());
     }
 
+    TEST_F(NameTest, HashCollisions_ResolvedHashesStayInTheSameShard)
+    {
+        AZ::NameDictionary::Destroy();
+
+        // With a single hash slot every name hashes to 0, so each new name is a collision
+        ASSERT_EQ(nullptr, AZ::Interface<AZ::NameDictionary>::Get());
+        constexpr AZ::u64 maxHashSlots = 1;
+        AZStd::unique_ptr<AZ::NameDictionary> nameDictionary = AZStd::make_unique<AZ::NameDictionary>(maxHashSlots);
+        AZ::Interface<AZ::NameDictionary>::Register(nameDictionary.get());
+
+        {
+            AZ::Name nameA("collisionA");
+            AZ::Name nameB("collisionB");
+            AZ::Name nameC("collisionC");
+
+            EXPECT_NE(nameA.GetHash(), nameB.GetHash());
+            EXPECT_NE(nameA.GetHash(), nameC.GetHash());
+            EXPECT_NE(nameB.GetHash(), nameC.GetHash());
+
+            const AZ::Name::Hash shardMask = NameDictionaryTester::GetShardCount() - 1;
+            EXPECT_EQ(nameA.GetHash() & shardMask, nameB.GetHash() & shardMask);
+            EXPECT_EQ(nameA.GetHash() & shardMask, nameC.GetHash() & shardMask);
+
+            EXPECT_EQ(nameB, nameDictionary->FindName(nameB.GetHash()));
+            EXPECT_EQ(nameC, nameDictionary->FindName(nameC.GetHash()));
+            EXPECT_EQ(nameC, AZ::Name("collisionC"));
+        }
+
+        AZ::Interface<AZ::NameDictionary>::Unregister(nameDictionary.get());
+    }
+
     TEST_F(NameTest, ConcurrencyDataTest_EachThreadRepeatedlyCreatesAndReleasesOneName_AndAccessItOnManyThread)
     {
         AZ::NameDictionary::Destroy();
@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+
+namespace AZ::IO
+{
+    constexpr AZ::u32 TestMaxFileHandles = 1;
+    constexpr AZ::u32 TestMaxMetaDataEntries = 16;
+    constexpr size_t TestPhysicalSectorSize = 4_kib;
+    constexpr size_t TestLogicalSectorSize = 512;
+    constexpr AZ::u32 TestQueueDepth = 8;
+    constexpr size_t TestRegisteredBufferSize = 64_kib;
+    constexpr AZ::s32 TestOverCommit = 0;
+
+    //
+    // StreamStackEntry API Conformity
+    //
+    class StorageDriveLinuxUringTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<StorageDriveLinuxUring>
+    {
+    public:
+        StorageDriveLinuxUring CreateInstance() override
+        {
+            StorageDriveLinuxUring::ConstructionOptions options;
+            options.m_minimalReporting = true;
+
+            return StorageDriveLinuxUring(TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize, TestLogicalSectorSize,
+                TestQueueDepth, TestRegisteredBufferSize, TestOverCommit, options);
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_StorageDriveLinuxUringConformityTests, StreamStackEntryConformityTests, StorageDriveLinuxUringTestDescription);
+
+    //
+    // StorageDriveLinuxUring Tests
+    //
+
+    class Streamer_StorageDriveLinuxUringTestFixture
+        : public UnitTest::LeakDetectionFixture
+        , public UnitTest::SetRestoreFileIOBaseRAII
+        , public ::testing::WithParamInterface<bool>
+    {
+    public:
+        static constexpr char s_dummyFilename[] = "DummyUring.bin";
+        static constexpr char s_fileCharacter = 'F';
+        static constexpr char s_beginCharacter = 'B';
+        static constexpr char s_endCharacter = 'E';
+        static constexpr char s_chunkCharacter = 'C';
+
+        UnitTest::TestFileIOBase m_fileIO{};
+        AZStd::string m_dummyFilepath;
+        AZ::IO::RequestPath m_dummyRequestPath;
+        AZStd::shared_ptr<StreamStackEntry> m_storageDrive{};
+        AZStd::unique_ptr<AZ::IO::StreamerContext> m_context;
+        AZStd::vector<AZStd::string> m_dummyFiles;
+        bool m_isSupported{ false };
+
+        Streamer_StorageDriveLinuxUringTestFixture()
+            : UnitTest::SetRestoreFileIOBaseRAII(m_fileIO)
+        {
+        }
+
+        void SetUp() override
+        {
+            UnitTest::LeakDetectionFixture::SetUp();
+
+            // io_uring can be unavailable, for instance on older kernels or when blocked by a container's seccomp profile.
+            m_isSupported = StorageDriveLinuxUring::IsSupported();
+
+            AZStd::string filePath(AZ::Utils::GetExecutableDirectory().c_str());
+            AZ::StringFunc::Path::Join(filePath.c_str(), "TestFiles", filePath);
+            if (!AZ::IO::SystemFile::Exists(filePath.c_str()))
+            {
+                AZ::IO::SystemFile::CreateDir(filePath.c_str());
+            }
+            AZ::StringFunc::Path::Join(filePath.c_str(), s_dummyFilename, m_dummyFilepath);
+            m_dummyRequestPath = RequestPath(AZ::IO::PathView(m_dummyFilepath));
+
+            m_context = AZStd::make_unique<AZ::IO::StreamerContext>();
+
+            // The parameter toggles unbuffered reads, which exercises the alignment and registered buffer paths.
+            StorageDriveLinuxUring::ConstructionOptions options;
+            options.m_enableUnbufferedReads = GetParam();
+            options.m_minimalReporting = true;
+            m_storageDrive = AZStd::make_shared<StorageDriveLinuxUring>(TestMaxFileHandles, TestMaxMetaDataEntries,
+                TestPhysicalSectorSize, TestLogicalSectorSize, TestQueueDepth, TestRegisteredBufferSize, TestOverCommit, options);
+            m_storageDrive->SetContext(*m_context);
+        }
+
+        void TearDown() override
+        {
+            m_storageDrive.reset();
+            m_context.reset();
+
+            for (auto& dummyFile : m_dummyFiles)
+            {
+                AZ::IO::SystemFile::Delete(dummyFile.c_str());
+            }
+            m_dummyFiles = {};
+            m_dummyRequestPath = {};
+            m_dummyFilepath = {};
+
+            UnitTest::LeakDetectionFixture::TearDown();
+        }
+
+        // Create a file filled with a single character.
+        // If chunkOffset is non-zero, it will write in a specific character every chunkOffset bytes till the end of file.
+        // If beginEndMarkers is true, it will write in specific bytes to mark the begin and end of the file.
+        void CreateDummyFile(size_t fileSize, size_t chunkOffset = 0, bool beginEndMarkers = false)
+        {
+            SystemFile file;
+            ASSERT_TRUE(file.Open(m_dummyFilepath.c_str(), SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE));
+            m_dummyFiles.push_back(m_dummyFilepath);
+
+            AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+            ::memset(buffer.get(), s_fileCharacter, fileSize);
+            if (chunkOffset != 0)
+            {
+                for (size_t offset = 0; offset < fileSize; offset += chunkOffset)
+                {
+                    buffer[offset] = s_chunkCharacter;
+                }
+            }
+            if (beginEndMarkers)
+            {
+                buffer[0] = s_beginCharacter;
+                buffer[fileSize - 1] = s_endCharacter;
+            }
+
+            auto bytesWritten = file.Write(buffer.get(), fileSize);
+            file.Close();
+            ASSERT_EQ(bytesWritten, fileSize);
+        }
+
+        void WaitTillCompleted()
+        {
+            StreamStackEntry::Status status;
+            auto startTime = AZStd::chrono::steady_clock::now();
+            do
+            {
+                m_storageDrive->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                status.m_isIdle = true;
+                m_storageDrive->UpdateStatus(status);
+
+                if (AZStd::chrono::steady_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+            } while (!status.m_isIdle);
+        }
+    };
+
+    TEST_P(Streamer_StorageDriveLinuxUringTestFixture, Constructor_InvalidQueueDepth_WarningIsReportedAndSizeAdjusted)
+    {
+        StorageDriveLinuxUring::ConstructionOptions options;
+        options.m_minimalReporting = true;
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDrive = AZStd::make_shared<StorageDriveLinuxUring>(TestMaxFileHandles, TestMaxMetaDataEntries,
+            TestPhysicalSectorSize, TestLogicalSectorSize, 0, TestRegisteredBufferSize, TestOverCommit, options);
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+
+        AZ::IO::StreamStackEntry::Status status{};
+        m_storageDrive->UpdateStatus(status);
+        EXPECT_GT(status.m_numAvailableSlots, 0);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxUringTestFixture, FileExistsRequest_FileExists_ReturnsCompletedWithFileFound)
+    {
+        CreateDummyFile(4_kib);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(m_dummyRequestPath);
+        bool found = false;
+        request->SetCompletionCallback([&found](const FileRequest& request)
+            {
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                found = AZStd::get<Requests::FileExistsCheckData>(request.GetCommand()).m_found;
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+        EXPECT_TRUE(found);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxUringTestFixture, FileMetaDataRetrievalRequest_FileExists_ReportsAccurateFileSize)
+    {
+        CreateDummyFile(4_kib);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+        u64 fileSize = 0;
+        request->SetCompletionCallback([&fileSize](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<Requests::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_TRUE(fileMetaData.m_found);
+                fileSize = fileMetaData.m_fileSize;
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+        EXPECT_EQ(4_kib, fileSize);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxUringTestFixture, ReadDataRequest_QueueAndExecuteRequest_DataIsCorrect)
+    {
+        if (!m_isSupported)
+        {
+            return;
+        }
+
+        constexpr size_t fileSize = 16_kib;
+        char* buffer = reinterpret_cast<char*>(azmalloc(fileSize, TestPhysicalSectorSize));
+        CreateDummyFile(fileSize, 0, true);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, fileSize, m_dummyRequestPath, 0, fileSize);
+        IStreamerTypes::RequestStatus status = IStreamerTypes::RequestStatus::Pending;
+        request->SetCompletionCallback([&status](const FileRequest& request)
+            {
+                status = request.GetStatus();
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, status);
+        EXPECT_EQ(buffer[0], s_beginCharacter);
+        EXPECT_EQ(buffer[1], s_fileCharacter);
+        EXPECT_EQ(buffer[fileSize - 2], s_fileCharacter);
+        EXPECT_EQ(buffer[fileSize - 1], s_endCharacter);
+
+        azfree(buffer);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxUringTestFixture, ReadDataRequest_UnalignedOffsetRead_ReturnsCorrectDataAndDoesNotWriteMore)
+    {
+        if (!m_isSupported)
+        {
+            return;
+        }
+
+        constexpr AZ::u64 unalignedOffset = 40;
+        constexpr AZ::u64 numChunksToRead = 7;
+        constexpr AZ::u64 unalignedSize = unalignedOffset * numChunksToRead;
+        constexpr size_t fileSize = 16_kib;
+        constexpr char unexpectedChar = 'Z';
+
+        char* buffer = reinterpret_cast<char*>(azmalloc(unalignedSize + 4, TestPhysicalSectorSize));
+        buffer[unalignedSize] = unexpectedChar;
+        CreateDummyFile(fileSize, unalignedOffset);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, unalignedSize + 4, m_dummyRequestPath, unalignedOffset, unalignedSize);
+        IStreamerTypes::RequestStatus status = IStreamerTypes::RequestStatus::Pending;
+        request->SetCompletionCallback([&status](const FileRequest& request)
+            {
+                status = request.GetStatus();
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, status);
+        EXPECT_EQ(buffer[0], s_chunkCharacter);
+        for (size_t offset = 1; offset < numChunksToRead; ++offset)
+        {
+            EXPECT_EQ(buffer[(offset * unalignedOffset) - 1], s_fileCharacter);
+            EXPECT_EQ(buffer[offset * unalignedOffset], s_chunkCharacter);
+        }
+        EXPECT_EQ(buffer[unalignedSize - 1], s_fileCharacter);
+        EXPECT_EQ(buffer[unalignedSize], unexpectedChar);
+
+        azfree(buffer);
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxUringTestFixture, ReadDataRequest_ParallelReads_AreBatchedAndDataIsCorrect)
+    {
+        if (!m_isSupported)
+        {
+            return;
+        }
+
+        constexpr size_t chunkSize = TestPhysicalSectorSize;
+        constexpr size_t numChunks = TestQueueDepth;
+        constexpr size_t fileSize = numChunks * chunkSize;
+        AZStd::array<u8*, numChunks> buffers;
+
+        CreateDummyFile(fileSize, chunkSize, true);
+
+        size_t completedCount = 0;
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            buffers[i] = reinterpret_cast<u8*>(azmalloc(chunkSize, TestPhysicalSectorSize));
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffers[i], chunkSize, m_dummyRequestPath, i * chunkSize, chunkSize);
+            request->SetCompletionCallback([&completedCount](const FileRequest& request)
+                {
+                    EXPECT_EQ(request.GetStatus(), AZ::IO::IStreamerTypes::RequestStatus::Completed);
+                    completedCount++;
+                });
+            m_storageDrive->QueueRequest(request);
+        }
+
+        // All reads fit in the queue, so the first update should submit all of them at once.
+        m_storageDrive->ExecuteRequests();
+        AZ::IO::StreamStackEntry::Status status{};
+        m_storageDrive->UpdateStatus(status);
+        EXPECT_GE(status.m_numAvailableSlots, 0);
+
+        WaitTillCompleted();
+        EXPECT_EQ(numChunks, completedCount);
+
+        EXPECT_EQ(buffers[0][0], s_beginCharacter);
+        EXPECT_EQ(buffers[numChunks - 1][chunkSize - 1], s_endCharacter);
+        for (size_t i = 1; i < numChunks; ++i)
+        {
+            EXPECT_EQ(buffers[i][0], s_chunkCharacter);
+            EXPECT_EQ(buffers[i][chunkSize - 2], s_fileCharacter);
+        }
+
+        for (u8* buffer : buffers)
+        {
+            azfree(buffer);
+        }
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxUringTestFixture, ReadDataRequest_InvalidFilePath_ForwardsToNextEntry)
+    {
+        if (!m_isSupported)
+        {
+            return;
+        }
+
+        constexpr AZ::u64 readSize = TestPhysicalSectorSize;
+        char buffer[readSize];
+
+        auto mock = AZStd::make_shared<::testing::NiceMock<StreamStackEntryMock>>();
+        m_storageDrive->SetNext(mock);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        AZ::IO::RequestPath path{ AZ::IO::PathView{ m_dummyFilepath + "/Broken/Path.txt" } };
+
+        request->CreateRead(nullptr, buffer, readSize, path, 0, readSize);
+        EXPECT_CALL(*mock, QueueRequest(request)).
+            WillOnce([this](AZ::IO::FileRequest* request)
+                {
+                    m_context->MarkRequestAsCompleted(request);
+                });
+
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_P(Streamer_StorageDriveLinuxUringTestFixture, CollectStatistics_ReadDone_MoreThanZeroStatisticsReturned)
+    {
+        if (!m_isSupported)
+        {
+            return;
+        }
+
+        constexpr size_t fileSize = 4_kib;
+        char* buffer = reinterpret_cast<char*>(azmalloc(fileSize, TestPhysicalSectorSize));
+        CreateDummyFile(fileSize);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, fileSize, m_dummyRequestPath, 0, fileSize);
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+
+        AZStd::vector<Statistic> statistics;
+        m_storageDrive->CollectStatistics(statistics);
+        EXPECT_FALSE(statistics.empty());
+
+        azfree(buffer);
+    }
+
+    INSTANTIATE_TEST_CASE_P(
+        Streamer_StorageDriveLinuxUringTests, Streamer_StorageDriveLinuxUringTestFixture, ::testing::Bool());
+} // namespace AZ::IO
@@ -1215,6 +1215,7 @@ namespace UnitTest
         }
     };
     bool TestReflectedClass::s_isReflected = false;
+    static const AZ::TypeId TestReflectedClassTypeId("{5D0C8E31-6A2B-4F97-B1E4-93C7A2F0D865}");
 
     TEST_F(ReflectionManagerTest, AddContext_AddClass)
     {
@@ -1274,4 +1275,35 @@ namespace UnitTest
         m_reflection.reset();
         EXPECT_FALSE(TestReflectedClass::s_isReflected);
     }
+
+    TEST_F(ReflectionManagerTest, DeferrableReflection_LazyContext_ReflectsWhenContextIsRequested)
+    {
+        m_reflection->AddReflectContext<AZ::SerializeContext>();
+        m_reflection->SetReflectContextLazy<AZ::SerializeContext>();
+
+        m_reflection->BeginDeferrableReflection();
+        m_reflection->Reflect(TestReflectedClassTypeId, &TestReflectedClass::Reflect);
+        m_reflection->EndDeferrableReflection();
+        EXPECT_FALSE(TestReflectedClass::s_isReflected);
+
+        EXPECT_NE(nullptr, m_reflection->GetReflectContext<AZ::SerializeContext>());
+        EXPECT_TRUE(TestReflectedClass::s_isReflected);
+
+        m_reflection->Unreflect(TestReflectedClassTypeId);
+        EXPECT_FALSE(TestReflectedClass::s_isReflected);
+    }
+
+    TEST_F(ReflectionManagerTest, DeferrableReflection_UnreflectBeforeRequest_NeverReflected)
+    {
+        m_reflection->AddReflectContext<AZ::SerializeContext>();
+        m_reflection->SetReflectContextLazy<AZ::SerializeContext>();
+
+        m_reflection->BeginDeferrableReflection();
+        m_reflection->Reflect(TestReflectedClassTypeId, &TestReflectedClass::Reflect);
+        m_reflection->EndDeferrableReflection();
+
+        m_reflection->Unreflect(TestReflectedClassTypeId);
+        EXPECT_NE(nullptr, m_reflection->GetReflectContext<AZ::SerializeContext>());
+        EXPECT_FALSE(TestReflectedClass::s_isReflected);
+    }
 }
@@ -10,6 +10,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Script/lua/lua.h>
 #include <AzCore/Script/ScriptContextDebug.h>
+#include <AzCore/Script/ScriptContextPool.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <AzCore/Component/Entity.h>
@@ -19,6 +20,7 @@
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include <math.h> // for pow
 
@@ -3116,6 +3118,44 @@ namespace UnitTest
         run();
     }
 
+    TEST_F(ScriptContextTest, ScriptContextPool_ScriptsOnWorkerThreads_RunInIsolatedContexts)
+    {
+        BehaviorContext behaviorContext;
+        ScriptContextPool pool(&behaviorContext, 2);
+        EXPECT_EQ(pool.GetNumContexts(), 2);
+
+        constexpr int numThreads = 4;
+        int results[numThreads] = {};
+        AZStd::vector<AZStd::thread> threads;
+        for (int threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads.emplace_back([&pool, &results, threadIndex]()
+                {
+                    ScriptContextPool::ScopedContext context = pool.Acquire();
+                    EXPECT_TRUE(context->DebugIsCallingThreadTheOwner());
+
+                    AZStd::string code = AZStd::string::format("PoolValue = %d * %d", threadIndex, threadIndex);
+                    EXPECT_TRUE(context->Execute(code.c_str()));
+
+                    ScriptDataContext dc;
+                    if (context->FindGlobal("PoolValue", dc))
+                    {
+                        dc.ReadValue(0, results[threadIndex]);
+                    }
+                });
+        }
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (int threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            EXPECT_EQ(results[threadIndex], threadIndex * threadIndex);
+        }
+    }
+
     class ScriptDebugTest
         : public LeakDetectionFixture
     {
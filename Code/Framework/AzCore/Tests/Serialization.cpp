@@ -6481,6 +6481,88 @@ namespace UnitTest
         });
         m_serializeContext->DisableRemoveReflection();
     }
+    TEST_F(ObjectStreamSerialization, BinaryStream_RepeatedContainerElements_LoadWithTheirOwnTypes)
+    {
+        using namespace ContainerElementDeprecationTestData;
+        ClassWithAVectorOfBaseClasses::Reflect(m_serializeContext.get());
+
+        // Elements of the same type and name share their type resolution, make sure alternating types are still told apart
+        constexpr size_t ElementCount = 32;
+        ClassWithAVectorOfBaseClasses vectorContainer;
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            vectorContainer.m_vectorOfBaseClasses.push_back(i % 3 == 0 ? static_cast<BaseClass*>(new DerivedClass2()) : new DerivedClass1());
+        }
+
+        AZStd::vector<char> charBuffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char> > containerStream(&charBuffer);
+        EXPECT_TRUE(AZ::Utils::SaveObjectToStream(containerStream, AZ::ObjectStream::ST_BINARY, &vectorContainer, m_serializeContext.get()));
+
+        ClassWithAVectorOfBaseClasses loadedContainer;
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromBufferInPlace(charBuffer.data(), charBuffer.size(), loadedContainer, m_serializeContext.get()));
+        ASSERT_EQ(ElementCount, loadedContainer.m_vectorOfBaseClasses.size());
+        for (size_t i = 0; i < ElementCount; ++i)
+        {
+            EXPECT_EQ(vectorContainer.m_vectorOfBaseClasses[i]->RTTI_GetType(), loadedContainer.m_vectorOfBaseClasses[i]->RTTI_GetType());
+        }
+    }
+
+    struct RepeatedMemberTestClass
+    {
+        AZ_TYPE_INFO(RepeatedMemberTestClass, "{0B8C7A3E-5D41-4F6B-A2C9-7E13D4F58B60}");
+        AZ_CLASS_ALLOCATOR(RepeatedMemberTestClass, AZ::SystemAllocator);
+
+        int32_t m_value{};
+        float m_floatValue{};
+    };
+
+    struct RepeatedMemberTestContainer
+    {
+        AZ_TYPE_INFO(RepeatedMemberTestContainer, "{6E2F9D14-8A3B-4C57-B1E0-93D7A5C2F846}");
+        AZ_CLASS_ALLOCATOR(RepeatedMemberTestContainer, AZ::SystemAllocator);
+
+        AZStd::vector<RepeatedMemberTestClass> m_elements;
+    };
+
+    TEST_F(ObjectStreamSerialization, BinaryStream_RepeatedMismatchedMember_ReportsErrorForEveryElement)
+    {
+        m_serializeContext->Class<RepeatedMemberTestClass>()
+            ->Field("m_value", &RepeatedMemberTestClass::m_value)
+            ;
+        m_serializeContext->Class<RepeatedMemberTestContainer>()
+            ->Field("m_elements", &RepeatedMemberTestContainer::m_elements)
+            ;
+
+        constexpr size_t ElementCount = 4;
+        RepeatedMemberTestContainer testData;
+        testData.m_elements.resize(ElementCount);
+        AZStd::vector<char> charBuffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char> > containerStream(&charBuffer);
+        EXPECT_TRUE(AZ::Utils::SaveObjectToStream(containerStream, AZ::ObjectStream::ST_BINARY, &testData, m_serializeContext.get()));
+
+        // Change the type of the member, so that the saved member matches by name but not by type
+        m_serializeContext->EnableRemoveReflection();
+        m_serializeContext->Class<RepeatedMemberTestClass>();
+        m_serializeContext->DisableRemoveReflection();
+        m_serializeContext->Class<RepeatedMemberTestClass>()
+            ->Field("m_value", &RepeatedMemberTestClass::m_floatValue)
+            ;
+
+        // Only matching members are remembered between elements, every mismatched element is reported
+        RepeatedMemberTestContainer loadedData;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromBufferInPlace(charBuffer.data(), charBuffer.size(), loadedData, m_serializeContext.get()));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(4); // one type mismatch per element
+        EXPECT_EQ(ElementCount, loadedData.m_elements.size());
+
+        m_serializeContext->EnableRemoveReflection();
+        m_serializeContext->Class<RepeatedMemberTestContainer>()
+            ->Field("m_elements", &RepeatedMemberTestContainer::m_elements)
+            ;
+        m_serializeContext->Class<RepeatedMemberTestClass>();
+        m_serializeContext->DisableRemoveReflection();
+    }
+
     struct ClassWithObjectStreamCallback
     {
         AZ_TYPE_INFO(ClassWithObjectStreamCallback, "{780F96D2-9907-439D-94B2-60B915BC12F6}");
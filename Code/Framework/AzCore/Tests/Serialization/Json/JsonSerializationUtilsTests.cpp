@@ -294,6 +294,53 @@ namespace UnitTest
         EXPECT_TRUE(result.GetError().find("JSON parse error at line 5:") == 0);
     }
     
+    TEST_F(JsonSerializationUtilsTests, LoadJsonStream_LargerThanReadBlock_ParsesAllMembers)
+    {
+        // The stream is parsed in blocks, make sure members spanning the block boundaries are read correctly
+        constexpr int MemberCount = 20000;
+        AZStd::string jsonText = "{\n";
+        for (int i = 0; i < MemberCount; ++i)
+        {
+            jsonText += AZStd::string::format("    \"member%i\": %i%s\n", i, i, i + 1 < MemberCount ? "," : "");
+        }
+        jsonText += "}\n";
+
+        IO::MemoryStream stream(jsonText.data(), jsonText.size());
+
+        AZ::Outcome<rapidjson::Document, AZStd::string> result = JsonSerializationUtils::ReadJsonStream(stream);
+
+        ASSERT_TRUE(result.IsSuccess());
+        ASSERT_TRUE(result.GetValue().IsObject());
+        EXPECT_EQ(MemberCount, result.GetValue().MemberCount());
+        for (int i = 0; i < MemberCount; ++i)
+        {
+            AZStd::string memberName = AZStd::string::format("member%i", i);
+            ASSERT_TRUE(result.GetValue().HasMember(memberName.c_str()));
+            EXPECT_EQ(i, result.GetValue()[memberName.c_str()].GetInt());
+        }
+    }
+
+    TEST_F(JsonSerializationUtilsTests, LoadJsonStream_ErrorAfterFirstReadBlock_ReportsLineNumber)
+    {
+        constexpr int MemberCount = 20000;
+        AZStd::string jsonText = "{\n";
+        for (int i = 0; i < MemberCount; ++i)
+        {
+            jsonText += AZStd::string::format("    \"member%i\": %i,\n", i, i);
+        }
+        jsonText += "    \"a\": \"This line is missing a comma\"\n";
+        jsonText += "    \"b\": 2\n";
+        jsonText += "}\n";
+
+        IO::MemoryStream stream(jsonText.data(), jsonText.size());
+
+        AZ::Outcome<rapidjson::Document, AZStd::string> result = JsonSerializationUtils::ReadJsonStream(stream);
+
+        EXPECT_FALSE(result.IsSuccess());
+        const AZStd::string expectedError = AZStd::string::format("JSON parse error at line %i:", MemberCount + 3);
+        EXPECT_TRUE(result.GetError().starts_with(expectedError)) << result.GetError().c_str();
+    }
+
     TEST_F(JsonSerializationUtilsTests, LoadObjectFromStream_Failed_ParseError)
     {
         char buffer[1024] = "Not a Json";
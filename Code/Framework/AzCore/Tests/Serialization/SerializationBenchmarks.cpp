@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Math/MathReflection.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonSystemComponent.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Entity-like object with the member types commonly found in components
+    struct SerializationBenchmarkEntity
+    {
+        AZ_TYPE_INFO(SerializationBenchmarkEntity, "{6F2D3B8E-4A1C-4E7B-9D05-3C8A1F6E2B94}");
+        AZ_CLASS_ALLOCATOR(SerializationBenchmarkEntity, AZ::SystemAllocator);
+
+        AZStd::string m_name;
+        AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+        AZStd::vector<float> m_weights;
+        AZStd::unordered_map<AZStd::string, AZ::s32> m_tags;
+        AZ::u64 m_id = 0;
+        bool m_active = true;
+    };
+
+    struct SerializationBenchmarkLevel
+    {
+        AZ_TYPE_INFO(SerializationBenchmarkLevel, "{A4C1E97B-2F38-4B6D-8E51-7D0B9C3F6A28}");
+        AZ_CLASS_ALLOCATOR(SerializationBenchmarkLevel, AZ::SystemAllocator);
+
+        AZStd::vector<SerializationBenchmarkEntity> m_entities;
+    };
+
+    //! Saves and loads a level of a number of entities, provided as the first argument, through the ObjectStream and the
+    //! json serialization. The level is generated deterministically, so the results of different runs can be compared.
+    class SerializationBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void internalSetUp(const ::benchmark::State& state)
+        {
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_jsonRegistrationContext = AZStd::make_unique<AZ::JsonRegistrationContext>();
+            AZ::MathReflect(m_serializeContext.get());
+            AZ::JsonSystemComponent::Reflect(m_jsonRegistrationContext.get());
+            m_serializeContext->Class<SerializationBenchmarkEntity>()
+                ->Field("Name", &SerializationBenchmarkEntity::m_name)
+                ->Field("Position", &SerializationBenchmarkEntity::m_position)
+                ->Field("Weights", &SerializationBenchmarkEntity::m_weights)
+                ->Field("Tags", &SerializationBenchmarkEntity::m_tags)
+                ->Field("Id", &SerializationBenchmarkEntity::m_id)
+                ->Field("Active", &SerializationBenchmarkEntity::m_active);
+            m_serializeContext->Class<SerializationBenchmarkLevel>()
+                ->Field("Entities", &SerializationBenchmarkLevel::m_entities);
+
+            m_serializerSettings.m_serializeContext = m_serializeContext.get();
+            m_serializerSettings.m_registrationContext = m_jsonRegistrationContext.get();
+            m_deserializerSettings.m_serializeContext = m_serializeContext.get();
+            m_deserializerSettings.m_registrationContext = m_jsonRegistrationContext.get();
+
+            const auto entityCount = aznumeric_cast<size_t>(state.range(0));
+            m_level.m_entities.resize(entityCount);
+            for (size_t index = 0; index < entityCount; ++index)
+            {
+                SerializationBenchmarkEntity& entity = m_level.m_entities[index];
+                entity.m_name = AZStd::string::format("Entity%zu", index);
+                entity.m_position = AZ::Vector3(aznumeric_cast<float>(index), aznumeric_cast<float>(index % 7), -1.0f);
+                entity.m_weights.assign(8, aznumeric_cast<float>(index) * 0.5f);
+                entity.m_tags[AZStd::string::format("Tag%zu", index % 4)] = aznumeric_cast<AZ::s32>(index);
+                entity.m_id = index * 7919;
+                entity.m_active = index % 2 == 0;
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_level = {};
+            m_serializerSettings = {};
+            m_deserializerSettings = {};
+
+            m_jsonRegistrationContext->EnableRemoveReflection();
+            AZ::JsonSystemComponent::Reflect(m_jsonRegistrationContext.get());
+            m_jsonRegistrationContext->DisableRemoveReflection();
+            m_jsonRegistrationContext.reset();
+            m_serializeContext.reset();
+        }
+
+        AZStd::vector<char> SaveObjectStream(AZ::DataStream::StreamType streamType)
+        {
+            AZStd::vector<char> buffer;
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+            AZ::Utils::SaveObjectToStream(stream, streamType, &m_level, m_serializeContext.get());
+            return buffer;
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::JsonRegistrationContext> m_jsonRegistrationContext;
+        AZ::JsonSerializerSettings m_serializerSettings;
+        AZ::JsonDeserializerSettings m_deserializerSettings;
+        SerializationBenchmarkLevel m_level;
+    };
+
+    BENCHMARK_DEFINE_F(SerializationBenchmarkFixture, BM_ObjectStream_SaveBinary)(benchmark::State& state)
+    {
+        size_t bytes = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            bytes += SaveObjectStream(AZ::DataStream::ST_BINARY).size();
+        }
+        state.SetBytesProcessed(bytes);
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SerializationBenchmarkFixture, BM_ObjectStream_SaveBinary)->Arg(10)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(SerializationBenchmarkFixture, BM_ObjectStream_LoadBinary)(benchmark::State& state)
+    {
+        const AZStd::vector<char> buffer = SaveObjectStream(AZ::DataStream::ST_BINARY);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZStd::unique_ptr<SerializationBenchmarkLevel> level(
+                AZ::Utils::LoadObjectFromBuffer<SerializationBenchmarkLevel>(buffer.data(), buffer.size(), m_serializeContext.get()));
+            benchmark::DoNotOptimize(level.get());
+        }
+        state.SetBytesProcessed(state.iterations() * buffer.size());
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SerializationBenchmarkFixture, BM_ObjectStream_LoadBinary)->Arg(10)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(SerializationBenchmarkFixture, BM_ObjectStream_LoadXml)(benchmark::State& state)
+    {
+        const AZStd::vector<char> buffer = SaveObjectStream(AZ::DataStream::ST_XML);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZStd::unique_ptr<SerializationBenchmarkLevel> level(
+                AZ::Utils::LoadObjectFromBuffer<SerializationBenchmarkLevel>(buffer.data(), buffer.size(), m_serializeContext.get()));
+            benchmark::DoNotOptimize(level.get());
+        }
+        state.SetBytesProcessed(state.iterations() * buffer.size());
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SerializationBenchmarkFixture, BM_ObjectStream_LoadXml)->Arg(10)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(SerializationBenchmarkFixture, BM_JsonSerialization_Store)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            rapidjson::Document document;
+            AZ::JsonSerialization::Store(document, document.GetAllocator(), m_level, m_serializerSettings);
+            benchmark::DoNotOptimize(document.MemberCount());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SerializationBenchmarkFixture, BM_JsonSerialization_Store)->Arg(10)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(SerializationBenchmarkFixture, BM_JsonSerialization_Load)(benchmark::State& state)
+    {
+        rapidjson::Document document;
+        AZ::JsonSerialization::Store(document, document.GetAllocator(), m_level, m_serializerSettings);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            SerializationBenchmarkLevel level;
+            AZ::JsonSerialization::Load(level, document, m_deserializerSettings);
+            benchmark::DoNotOptimize(level.m_entities.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SerializationBenchmarkFixture, BM_JsonSerialization_Load)->Arg(10)->Arg(1000)->Unit(benchmark::kMicrosecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -722,6 +722,38 @@ tags=tools,renderer,metal)"
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, m_registry->GetType("/AnchorPath/Of/Settings"));
     }
 
+    TEST_F(SettingsRegistryMergeUtilsCommandLineFixture, RegsnapshotArgument_WritesSnapshotWithoutRuntimeSettings)
+    {
+        AZ::Test::ScopedAutoTempDirectory testFolder;
+        const auto snapshotPath = testFolder.GetDirectoryAsFixedMaxPath() / "Registry" / "test.setregsnapshot";
+
+        m_registry->Set("/O3DE/Test/String", "Hello");
+        m_registry->Set("/O3DE/Test/Int", aznumeric_cast<AZ::s64>(42));
+        m_registry->Set("/O3DE/Test/Bool", true);
+        m_registry->Set(AZ::SettingsRegistryMergeUtils::FilePathKey_EngineRootFolder, "/engine");
+
+        AZ::CommandLine commandLine;
+        commandLine.Parse({ "--regsnapshot", snapshotPath.String() });
+        AZ::SettingsRegistryMergeUtils::CommandsToParse commandsToParse;
+        commandsToParse.m_parseRegdumpCommands = true;
+        AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_CommandLine(*m_registry, commandLine, commandsToParse);
+        ASSERT_TRUE(AZ::IO::SystemFile::Exists(snapshotPath.c_str()));
+
+        AZ::SettingsRegistryImpl snapshotRegistry;
+        EXPECT_TRUE(AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_Snapshot(snapshotRegistry, snapshotPath.Native()));
+
+        AZ::SettingsRegistryInterface::FixedValueString stringValue;
+        EXPECT_TRUE(snapshotRegistry.Get(stringValue, "/O3DE/Test/String"));
+        EXPECT_EQ("Hello", stringValue);
+        AZ::s64 intValue{};
+        EXPECT_TRUE(snapshotRegistry.Get(intValue, "/O3DE/Test/Int"));
+        EXPECT_EQ(42, intValue);
+        bool boolValue{};
+        EXPECT_TRUE(snapshotRegistry.Get(boolValue, "/O3DE/Test/Bool"));
+        EXPECT_TRUE(boolValue);
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, snapshotRegistry.GetType(AZ::SettingsRegistryMergeUtils::RuntimeRootKey));
+    }
+
     using SettingsRegistryAncestorDescendantOrEqualPathFixture = SettingsRegistryMergeUtilsCommandLineFixture;
 
     TEST_F(SettingsRegistryAncestorDescendantOrEqualPathFixture, ValidateThatAncestorOrDescendantOrPathWithTheSameValue_Succeeds)
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Settings/SettingsRegistryValueHandle.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace SettingsRegistryValueHandleTests
+{
+    class SettingsRegistryValueHandleFixture
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            m_registry = AZStd::make_unique<AZ::SettingsRegistryImpl>();
+        }
+
+        void TearDown() override
+        {
+            m_registry.reset();
+        }
+
+        AZStd::unique_ptr<AZ::SettingsRegistryImpl> m_registry;
+    };
+
+    TEST_F(SettingsRegistryValueHandleFixture, Get_ExistingValue_ReturnsValue)
+    {
+        m_registry->Set("/O3DE/Test/Int", aznumeric_cast<AZ::s64>(42));
+        m_registry->Set("/O3DE/Test/Float", 1.5);
+        m_registry->Set("/O3DE/Test/Bool", true);
+
+        AZ::SettingsRegistryValueHandle<int> intHandle(*m_registry, "/O3DE/Test/Int");
+        AZ::SettingsRegistryValueHandle<float> floatHandle(*m_registry, "/O3DE/Test/Float");
+        AZ::SettingsRegistryValueHandle<bool> boolHandle(*m_registry, "/O3DE/Test/Bool");
+
+        EXPECT_TRUE(intHandle.HasValue());
+        EXPECT_EQ(42, intHandle.Get());
+        EXPECT_TRUE(floatHandle.HasValue());
+        EXPECT_FLOAT_EQ(1.5f, floatHandle.Get());
+        EXPECT_TRUE(boolHandle.HasValue());
+        EXPECT_TRUE(boolHandle.Get());
+    }
+
+    TEST_F(SettingsRegistryValueHandleFixture, Get_MissingOrMismatchedValue_ReturnsDefault)
+    {
+        m_registry->Set("/O3DE/Test/String", "Hello");
+
+        AZ::SettingsRegistryValueHandle<AZ::u32> missingHandle(*m_registry, "/O3DE/Test/Missing", 7);
+        AZ::SettingsRegistryValueHandle<AZ::u32> stringHandle(*m_registry, "/O3DE/Test/String", 8);
+
+        EXPECT_FALSE(missingHandle.HasValue());
+        EXPECT_EQ(7u, missingHandle.Get());
+        EXPECT_FALSE(stringHandle.HasValue());
+        EXPECT_EQ(8u, stringHandle.Get());
+    }
+
+    TEST_F(SettingsRegistryValueHandleFixture, Get_ValueChanged_ReturnsNewValue)
+    {
+        AZ::SettingsRegistryValueHandle<AZ::s64> handle(*m_registry, "/O3DE/Test/Int", -1);
+        EXPECT_EQ(-1, handle.Get());
+
+        m_registry->Set("/O3DE/Test/Int", aznumeric_cast<AZ::s64>(1));
+        EXPECT_EQ(1, handle.Get());
+
+        m_registry->Set("/O3DE/Test/Int", aznumeric_cast<AZ::s64>(2));
+        EXPECT_EQ(2, handle.Get());
+
+        m_registry->Remove("/O3DE/Test/Int");
+        EXPECT_FALSE(handle.HasValue());
+        EXPECT_EQ(-1, handle.Get());
+    }
+
+    TEST_F(SettingsRegistryValueHandleFixture, Get_AncestorMerged_ReturnsNewValue)
+    {
+        AZ::SettingsRegistryValueHandle<double> handle(*m_registry, "/O3DE/Test/Double");
+        EXPECT_FALSE(handle.HasValue());
+
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "O3DE": { "Test": { "Double": 2.5 } } })",
+            AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        EXPECT_TRUE(handle.HasValue());
+        EXPECT_DOUBLE_EQ(2.5, handle.Get());
+    }
+
+    TEST_F(SettingsRegistryValueHandleFixture, Get_UnrelatedValueChanged_KeepsCachedValue)
+    {
+        m_registry->Set("/O3DE/Test/Int", aznumeric_cast<AZ::s64>(3));
+        AZ::SettingsRegistryValueHandle<int> handle(*m_registry, "/O3DE/Test/Int");
+
+        m_registry->Set("/O3DE/Test/IntOther", aznumeric_cast<AZ::s64>(4));
+        m_registry->Set("/O3DE/Other", aznumeric_cast<AZ::s64>(5));
+        EXPECT_EQ(3, handle.Get());
+    }
+} // namespace SettingsRegistryValueHandleTests
@@ -9,9 +9,12 @@
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
 #include <AzCore/IO/Streamer/BlockCache.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/SharedBlockCache.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -1167,4 +1170,170 @@ namespace AZ::IO
         EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(1);
         ProcessRead(m_buffer, m_path, 512, m_blockSize - 1024, IStreamerTypes::RequestStatus::Completed);
     }
+
+#if AZ_TRAIT_SUPPORT_IPC
+    class Streamer_SharedBlockCacheTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            m_prevFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(&m_fileIO);
+        }
+
+        void TearDown() override
+        {
+            AZ::IO::FileIOBase::SetInstance(m_prevFileIO);
+        }
+
+    protected:
+        static constexpr u32 BlockSize = 4096;
+        static constexpr u64 CacheSize = 4 * BlockSize;
+
+        UnitTest::TestFileIOBase m_fileIO;
+        FileIOBase* m_prevFileIO{ nullptr };
+    };
+
+    TEST_F(Streamer_SharedBlockCacheTest, Read_BlockStoredByOtherInstance_DataIsShared)
+    {
+        SharedBlockCache writer("SharedBlockCacheUnitTest", CacheSize, BlockSize);
+        SharedBlockCache reader("SharedBlockCacheUnitTest", CacheSize, BlockSize);
+        ASSERT_TRUE(writer.IsReady());
+        ASSERT_TRUE(reader.IsReady());
+
+        RequestPath path("Test");
+        AZStd::vector<u8> data(BlockSize);
+        for (u32 i = 0; i < BlockSize; ++i)
+        {
+            data[i] = aznumeric_cast<u8>(i);
+        }
+        writer.Store(path, BlockSize, data.data(), BlockSize);
+
+        AZStd::vector<u8> output(BlockSize, 0);
+        EXPECT_FALSE(reader.Read(path, 0, output.data(), BlockSize));
+        ASSERT_TRUE(reader.Read(path, BlockSize, output.data(), BlockSize));
+        EXPECT_EQ(data, output);
+    }
+
+    TEST_F(Streamer_SharedBlockCacheTest, Read_SizeDifferentFromStoredBlock_ReadFails)
+    {
+        SharedBlockCache cache("SharedBlockCacheUnitTest", CacheSize, BlockSize);
+        ASSERT_TRUE(cache.IsReady());
+
+        RequestPath path("Test");
+        AZStd::vector<u8> data(BlockSize, 42);
+        cache.Store(path, 0, data.data(), BlockSize / 2);
+
+        EXPECT_TRUE(cache.Read(path, 0, data.data(), BlockSize / 2));
+        EXPECT_FALSE(cache.Read(path, 0, data.data(), BlockSize));
+    }
+
+    TEST_F(Streamer_SharedBlockCacheTest, Flush_FlushStoredFile_BlockIsNoLongerAvailable)
+    {
+        SharedBlockCache cache("SharedBlockCacheUnitTest", CacheSize, BlockSize);
+        ASSERT_TRUE(cache.IsReady());
+
+        RequestPath path("Test");
+        RequestPath otherPath("Other");
+        AZStd::vector<u8> data(BlockSize, 42);
+        cache.Store(path, 0, data.data(), BlockSize);
+        cache.Store(otherPath, 0, data.data(), BlockSize);
+
+        cache.Flush(path);
+        EXPECT_FALSE(cache.Read(path, 0, data.data(), BlockSize));
+        EXPECT_TRUE(cache.Read(otherPath, 0, data.data(), BlockSize));
+
+        cache.FlushAll();
+        EXPECT_FALSE(cache.Read(otherPath, 0, data.data(), BlockSize));
+    }
+
+    TEST_F(Streamer_SharedBlockCacheTest, Store_MoreBlocksThanAvailable_LeastRecentlyUsedBlockIsReplaced)
+    {
+        SharedBlockCache cache("SharedBlockCacheUnitTest", CacheSize, BlockSize);
+        ASSERT_TRUE(cache.IsReady());
+        ASSERT_EQ(4, cache.GetNumBlocks());
+
+        RequestPath path("Test");
+        AZStd::vector<u8> data(BlockSize, 42);
+        for (u64 i = 0; i < 4; ++i)
+        {
+            cache.Store(path, i * BlockSize, data.data(), BlockSize);
+        }
+        // Touch the first block so the second block becomes the oldest.
+        EXPECT_TRUE(cache.Read(path, 0, data.data(), BlockSize));
+        cache.Store(path, 4 * BlockSize, data.data(), BlockSize);
+
+        EXPECT_TRUE(cache.Read(path, 0, data.data(), BlockSize));
+        EXPECT_FALSE(cache.Read(path, BlockSize, data.data(), BlockSize));
+        EXPECT_TRUE(cache.Read(path, 4 * BlockSize, data.data(), BlockSize));
+    }
+
+    TEST_F(Streamer_SharedBlockCacheTest, Read_FileChangedSinceBlockWasStored_ReadFails)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        AZ::IO::Path filePath = tempDirectory.Resolve("SharedBlockCacheFile.bin");
+        auto writeFile = [&filePath](u64 size)
+        {
+            AZStd::vector<u8> contents(size, 7);
+            SystemFile file;
+            ASSERT_TRUE(file.Open(filePath.c_str(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_WRITE_ONLY));
+            EXPECT_EQ(size, file.Write(contents.data(), size));
+            file.Close();
+        };
+
+        writeFile(BlockSize);
+        RequestPath path(filePath);
+        AZStd::vector<u8> data(BlockSize, 42);
+        {
+            SharedBlockCache writer("SharedBlockCacheUnitTest", CacheSize, BlockSize);
+            ASSERT_TRUE(writer.IsReady());
+            writer.Store(path, 0, data.data(), BlockSize);
+            EXPECT_TRUE(writer.Read(path, 0, data.data(), BlockSize));
+
+            // Another process changes the file. A process that opens the file afterwards must not see the old blocks.
+            writeFile(2 * BlockSize);
+            SharedBlockCache reader("SharedBlockCacheUnitTest", CacheSize, BlockSize);
+            ASSERT_TRUE(reader.IsReady());
+            EXPECT_FALSE(reader.Read(path, 0, data.data(), BlockSize));
+
+            // Once the writer is told about the change, it uses the new version of the file as well.
+            writer.Flush(path);
+            writer.Store(path, 0, data.data(), BlockSize);
+            EXPECT_TRUE(reader.Read(path, 0, data.data(), BlockSize));
+            writer.FlushAll();
+        }
+    }
+
+    TEST_F(Streamer_SharedBlockCacheTest, Store_ManyBlocksReplacedAndFlushed_AllStoredBlocksAreFound)
+    {
+        // Exercises the index with collisions, removals and recycling over many more blocks than the cache holds.
+        constexpr u64 LargeCacheSize = 64 * BlockSize;
+        SharedBlockCache cache("SharedBlockCacheIndexUnitTest", LargeCacheSize, BlockSize);
+        ASSERT_TRUE(cache.IsReady());
+        const u32 numBlocks = cache.GetNumBlocks();
+
+        RequestPath path("Test");
+        RequestPath otherPath("Other");
+        AZStd::vector<u8> data(BlockSize, 42);
+        for (u64 i = 0; i < 4 * numBlocks; ++i)
+        {
+            cache.Store((i % 3) == 0 ? otherPath : path, i * BlockSize, data.data(), BlockSize);
+        }
+
+        // Only the most recently stored blocks are still cached.
+        for (u64 i = 0; i < 4 * numBlocks; ++i)
+        {
+            const bool isRecent = i >= 3 * numBlocks;
+            EXPECT_EQ(isRecent, cache.Read((i % 3) == 0 ? otherPath : path, i * BlockSize, data.data(), BlockSize)) << i;
+        }
+
+        cache.Flush(otherPath);
+        for (u64 i = 3 * numBlocks; i < 4 * numBlocks; ++i)
+        {
+            EXPECT_EQ((i % 3) != 0, cache.Read((i % 3) == 0 ? otherPath : path, i * BlockSize, data.data(), BlockSize)) << i;
+        }
+        cache.FlushAll();
+    }
+#endif // AZ_TRAIT_SUPPORT_IPC
 } // namespace AZ::IO
@@ -125,6 +125,9 @@ namespace AZ::IO
             auto data = AZStd::get_if<Requests::ReadData>(&request->GetCommand());
             ASSERT_NE(nullptr, data);
 
+            m_lastReadOffset = data->m_offset;
+            m_lastReadSize = data->m_size;
+
             u64 size = data->m_size >> 2;
             u32* buffer = reinterpret_cast<u32*>(data->m_output);
             for (u64 i = 0; i < size; ++i)
@@ -163,13 +166,26 @@ namespace AZ::IO
             return false;
         }
 
-        void ProcessCompressedRead(u64 offset, u64 size, CompressionState compressionState, IStreamerTypes::RequestStatus expectedResult)
+        void ProcessCompressedRead(u64 offset, u64 size, CompressionState compressionState, IStreamerTypes::RequestStatus expectedResult,
+            u64 blockSize = 0)
         {
             CompressionInfo compressionInfo;
             compressionInfo.m_compressedSize = m_fakeFileLength;
             compressionInfo.m_isCompressed = (compressionState == CompressionState::Compressed || compressionState == CompressionState::Corrupted);
             compressionInfo.m_offset = 0;
             compressionInfo.m_uncompressedSize = m_fakeFileLength;
+            if (blockSize > 0)
+            {
+                // The fake compression only copies data so the compressed and uncompressed blocks are at the same offsets.
+                for (u64 blockOffset = 0; blockOffset < m_fakeFileLength; blockOffset += blockSize)
+                {
+                    CompressedBlock& block = compressionInfo.m_blocks.emplace_back();
+                    block.m_compressedOffset = blockOffset;
+                    block.m_compressedSize = AZStd::min(blockSize, m_fakeFileLength - blockOffset);
+                    block.m_uncompressedOffset = block.m_compressedOffset;
+                    block.m_uncompressedSize = block.m_compressedSize;
+                }
+            }
             if (compressionState == CompressionState::Corrupted)
             {
                 compressionInfo.m_decompressor = &Streamer_FullDecompressorTest::CorruptedDecompressor;
@@ -293,6 +309,8 @@ namespace AZ::IO
         AZStd::shared_ptr<FullFileDecompressor> m_decompressor;
         AZStd::shared_ptr<StreamStackEntryMock> m_mock;
         u64 m_fakeFileLength{ 1 * 1024 * 1024 };
+        u64 m_lastReadOffset{ 0 };
+        u64 m_lastReadSize{ 0 };
     };
 
     TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FullReadAndDecompressData_SuccessfullyReadData)
@@ -348,6 +366,41 @@ namespace AZ::IO
         ProcessCompressedRead(0, m_fakeFileLength, CompressionState::Corrupted, IStreamerTypes::RequestStatus::Failed);
     }
 
+    TEST_F(Streamer_FullDecompressorTest, BlockDecompressedRead_FullReadAndDecompressData_SuccessfullyReadData)
+    {
+        SetupEnvironment(1, 4);
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(0, m_fakeFileLength, CompressionState::Compressed, IStreamerTypes::RequestStatus::Completed, 64_kib);
+        VerifyReadBuffer(0, m_fakeFileLength);
+        EXPECT_EQ(0u, m_lastReadOffset);
+        EXPECT_EQ(m_fakeFileLength, m_lastReadSize);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, BlockDecompressedRead_PartialReadAndDecompressData_OnlyOverlappingBlocksAreRead)
+    {
+        SetupEnvironment(1, 4);
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(200_kib + 256, 100_kib, CompressionState::Compressed, IStreamerTypes::RequestStatus::Completed, 64_kib);
+        VerifyReadBuffer(200_kib + 256, 100_kib);
+        EXPECT_EQ(192_kib, m_lastReadOffset);
+        EXPECT_EQ(128_kib, m_lastReadSize);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, BlockDecompressedRead_UnevenLastBlock_SuccessfullyReadData)
+    {
+        SetupEnvironment(1, 4);
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(256, m_fakeFileLength - 512, CompressionState::Compressed, IStreamerTypes::RequestStatus::Completed, 48_kib);
+        VerifyReadBuffer(256, m_fakeFileLength - 512);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, BlockDecompressedRead_CorruptedArchiveRead_RequestIsCompletedWithFailedState)
+    {
+        SetupEnvironment(1, 4);
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(0, m_fakeFileLength, CompressionState::Corrupted, IStreamerTypes::RequestStatus::Failed, 64_kib);
+    }
+
     TEST_F(Streamer_FullDecompressorTest, DecompressedRead_MultipleRequestsWithSingleJob_AllRequestsComplete)
     {
         SetupEnvironment(4, 1);
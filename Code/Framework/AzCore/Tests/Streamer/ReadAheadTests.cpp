@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/ReadAhead.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class ReadAheadTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<ReadAhead>
+    {
+    public:
+        ReadAhead CreateInstance() override
+        {
+            return ReadAhead(16, 2, 64_kib, 2, AZCORE_GLOBAL_NEW_ALIGNMENT);
+        }
+
+        bool UsesSlots() const override
+        {
+            return false;
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(Streamer_ReadAheadConformityTests, StreamStackEntryConformityTests, ReadAheadTestDescription);
+
+    class Streamer_ReadAheadTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        static constexpr u64 MaxReadSize = 4_kib;
+        static constexpr u32 Depth = 2;
+
+        struct SpeculativeRead
+        {
+            u64 m_offset;
+            u64 m_size;
+        };
+
+        void SetUp() override
+        {
+            using ::testing::_;
+            using ::testing::AnyNumber;
+            using ::testing::Invoke;
+            using ::testing::Return;
+
+            m_prevFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(&m_fileIO);
+
+            m_context = AZStd::make_unique<StreamerContext>();
+            m_mock = AZStd::make_shared<StreamStackEntryMock>();
+            m_readAhead = AZStd::make_unique<ReadAhead>(4, 4, MaxReadSize, Depth, AZCORE_GLOBAL_NEW_ALIGNMENT);
+            m_readAhead->SetNext(m_mock);
+            EXPECT_CALL(*m_mock, SetContext(_));
+            m_readAhead->SetContext(*m_context);
+
+            EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+            EXPECT_CALL(*m_mock, ExecuteRequests()).WillRepeatedly(Return(false));
+            EXPECT_CALL(*m_mock, QueueRequest(_)).WillRepeatedly(Invoke(this, &Streamer_ReadAheadTest::QueueRequest));
+        }
+
+        void TearDown() override
+        {
+            for (FileRequest* request : m_requests)
+            {
+                m_context->RecycleRequest(request);
+            }
+            m_requests.clear();
+
+            m_readAhead.reset();
+            m_mock.reset();
+            m_context.reset();
+
+            AZ::IO::FileIOBase::SetInstance(m_prevFileIO);
+        }
+
+        void QueueRequest(FileRequest* request)
+        {
+            if (auto metaData = AZStd::get_if<Requests::FileMetaDataRetrievalData>(&request->GetCommand()); metaData != nullptr)
+            {
+                metaData->m_fileSize = m_fileSize;
+                metaData->m_found = true;
+                request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                m_context->MarkRequestAsCompleted(request);
+            }
+            else if (auto read = AZStd::get_if<Requests::ReadData>(&request->GetCommand()); read != nullptr)
+            {
+                if (AZStd::find(m_requests.begin(), m_requests.end(), request) == m_requests.end())
+                {
+                    m_speculativeReads.push_back(SpeculativeRead{ read->m_offset, read->m_size });
+                    request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                    m_context->MarkRequestAsCompleted(request);
+                }
+            }
+        }
+
+        void Read(u64 offset, u64 size)
+        {
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, nullptr, size, m_path, offset, size);
+            m_requests.push_back(request);
+            m_readAhead->QueueRequest(request);
+        }
+
+        void Process()
+        {
+            // Run a few times to allow the file size to be retrieved before the speculative reads are issued.
+            for (int i = 0; i < 4; ++i)
+            {
+                m_readAhead->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+            }
+        }
+
+    protected:
+        UnitTest::TestFileIOBase m_fileIO;
+        FileIOBase* m_prevFileIO{};
+        AZStd::unique_ptr<StreamerContext> m_context;
+        AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+        AZStd::unique_ptr<ReadAhead> m_readAhead;
+        AZStd::vector<FileRequest*> m_requests;
+        AZStd::vector<SpeculativeRead> m_speculativeReads;
+        RequestPath m_path{ "Test" };
+        u64 m_fileSize{ 1_mib };
+    };
+
+    TEST_F(Streamer_ReadAheadTest, QueueRequest_SequentialReads_NextRequestsAreReadAhead)
+    {
+        Read(0, 1_kib);
+        Read(1_kib, 1_kib);
+        Read(2_kib, 1_kib);
+        Process();
+
+        ASSERT_EQ(Depth, m_speculativeReads.size());
+        EXPECT_EQ(3_kib, m_speculativeReads[0].m_offset);
+        EXPECT_EQ(1_kib, m_speculativeReads[0].m_size);
+        EXPECT_EQ(4_kib, m_speculativeReads[1].m_offset);
+        EXPECT_EQ(1_kib, m_speculativeReads[1].m_size);
+    }
+
+    TEST_F(Streamer_ReadAheadTest, QueueRequest_ContinueSequentialReads_OnlyNewRangesAreReadAhead)
+    {
+        Read(0, 1_kib);
+        Read(1_kib, 1_kib);
+        Read(2_kib, 1_kib);
+        Process();
+        Read(3_kib, 1_kib);
+        Process();
+
+        ASSERT_EQ(Depth + 1, m_speculativeReads.size());
+        EXPECT_EQ(5_kib, m_speculativeReads[2].m_offset);
+        EXPECT_DOUBLE_EQ(1.0, m_readAhead->CalculateHitRatePercentage());
+    }
+
+    TEST_F(Streamer_ReadAheadTest, QueueRequest_StridedReads_ReadAheadFollowsStride)
+    {
+        Read(0, 1_kib);
+        Read(4_kib, 1_kib);
+        Read(8_kib, 1_kib);
+        Process();
+
+        ASSERT_EQ(Depth, m_speculativeReads.size());
+        EXPECT_EQ(12_kib, m_speculativeReads[0].m_offset);
+        EXPECT_EQ(16_kib, m_speculativeReads[1].m_offset);
+    }
+
+    TEST_F(Streamer_ReadAheadTest, QueueRequest_BackwardReads_ReadAheadFollowsDirection)
+    {
+        Read(8_kib, 1_kib);
+        Read(7_kib, 1_kib);
+        Read(6_kib, 1_kib);
+        Process();
+
+        ASSERT_EQ(Depth, m_speculativeReads.size());
+        EXPECT_EQ(5_kib, m_speculativeReads[0].m_offset);
+        EXPECT_EQ(4_kib, m_speculativeReads[1].m_offset);
+    }
+
+    TEST_F(Streamer_ReadAheadTest, QueueRequest_RandomReads_NothingIsReadAhead)
+    {
+        Read(8_kib, 1_kib);
+        Read(1_kib, 1_kib);
+        Read(5_kib, 1_kib);
+        Read(2_kib, 1_kib);
+        Process();
+
+        EXPECT_TRUE(m_speculativeReads.empty());
+    }
+
+    TEST_F(Streamer_ReadAheadTest, QueueRequest_RequestsLargerThanMaxReadSize_NothingIsReadAhead)
+    {
+        Read(0, 2 * MaxReadSize);
+        Read(2 * MaxReadSize, 2 * MaxReadSize);
+        Read(4 * MaxReadSize, 2 * MaxReadSize);
+        Process();
+
+        EXPECT_TRUE(m_speculativeReads.empty());
+    }
+
+    TEST_F(Streamer_ReadAheadTest, QueueRequest_ReadAheadPastEndOfFile_ReadIsClampedToFileSize)
+    {
+        m_fileSize = 3_kib + 512;
+
+        Read(0, 1_kib);
+        Read(1_kib, 1_kib);
+        Read(2_kib, 1_kib);
+        Process();
+
+        ASSERT_EQ(1u, m_speculativeReads.size());
+        EXPECT_EQ(3_kib, m_speculativeReads[0].m_offset);
+        EXPECT_EQ(512u, m_speculativeReads[0].m_size);
+    }
+
+    TEST_F(Streamer_ReadAheadTest, QueueRequest_FlushAllBeforePatternIsDetected_NothingIsReadAhead)
+    {
+        Read(0, 1_kib);
+        Read(1_kib, 1_kib);
+
+        FileRequest* flush = m_context->GetNewInternalRequest();
+        flush->CreateFlushAll();
+        m_requests.push_back(flush);
+        m_readAhead->QueueRequest(flush);
+
+        Read(2_kib, 1_kib);
+        Process();
+
+        EXPECT_TRUE(m_speculativeReads.empty());
+    }
+} // namespace AZ::IO
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/Scheduler.h>
+#include <AzCore/IO/Streamer/StorageDrive.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/semaphore.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzTest/Utils.h>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Reads a set of generated files through the Streamer with a stack that only contains the storage drive. Unlike
+    //! the trace replay this doesn't need any external data, so it can run on every build to track the Streamer overhead.
+    //! Arguments are:
+    //!     0 - The number of files, which are all read once per iteration.
+    //!     1 - The size of each file in kilobytes.
+    class StreamerBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void internalSetUp(const ::benchmark::State& state)
+        {
+            m_tempDirectory = AZStd::make_unique<AZ::Test::ScopedAutoTempDirectory>();
+            m_fileSize = aznumeric_cast<size_t>(state.range(1)) * 1024;
+
+            AZStd::vector<AZStd::byte> content(m_fileSize);
+            for (size_t index = 0; index < content.size(); ++index)
+            {
+                content[index] = static_cast<AZStd::byte>(index);
+            }
+
+            const auto fileCount = aznumeric_cast<size_t>(state.range(0));
+            m_filePaths.reserve(fileCount);
+            for (size_t index = 0; index < fileCount; ++index)
+            {
+                auto filePath = AZ::Test::CreateTestFile(
+                    *m_tempDirectory, AZ::IO::FixedMaxPath(AZStd::string::format("StreamerBenchmark%zu.bin", index)), content);
+                if (filePath.has_value())
+                {
+                    m_filePaths.emplace_back(filePath->c_str());
+                }
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_filePaths = {};
+            m_tempDirectory.reset();
+        }
+
+        AZStd::unique_ptr<AZ::IO::Scheduler> CreateStack() const
+        {
+            using namespace AZ::IO;
+
+            HardwareInformation hardware;
+            if (!CollectIoHardwareInformation(hardware, true, false))
+            {
+                return {};
+            }
+
+            StorageDriveConfig driveConfig;
+            AZStd::shared_ptr<StreamStackEntry> stack = driveConfig.AddStreamStackEntry(hardware, {});
+            return AZStd::make_unique<Scheduler>(
+                AZStd::move(stack), hardware.m_maxPhysicalSectorSize, hardware.m_maxLogicalSectorSize, hardware.m_maxTransfer);
+        }
+
+        AZStd::unique_ptr<AZ::Test::ScopedAutoTempDirectory> m_tempDirectory;
+        AZStd::vector<AZ::IO::Path> m_filePaths;
+        size_t m_fileSize{ 0 };
+    };
+
+    BENCHMARK_DEFINE_F(StreamerBenchmarkFixture, BM_ReadFiles)(benchmark::State& state)
+    {
+        using namespace AZ::IO;
+
+        if (m_filePaths.size() != aznumeric_cast<size_t>(state.range(0)))
+        {
+            state.SkipWithError("Unable to create the files to read.");
+            return;
+        }
+
+        auto streamer = AZStd::make_unique<Streamer>(AZStd::thread_desc{}, CreateStack());
+        IStreamerTypes::DefaultRequestMemoryAllocator allocator;
+        AZStd::vector<FileRequestPtr> requests;
+        requests.reserve(m_filePaths.size());
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZStd::semaphore completed;
+            AZStd::atomic<size_t> failed{ 0 };
+            for (const AZ::IO::Path& filePath : m_filePaths)
+            {
+                FileRequestPtr& request = requests.emplace_back(streamer->Read(filePath.Native(), allocator, m_fileSize));
+                streamer->SetRequestCompleteCallback(request,
+                    [&streamer, &completed, &failed](FileRequestHandle handle)
+                    {
+                        if (streamer->GetRequestStatus(handle) != IStreamerTypes::RequestStatus::Completed)
+                        {
+                            ++failed;
+                        }
+                        completed.release();
+                    });
+                streamer->QueueRequest(request);
+            }
+            for (size_t index = 0; index < m_filePaths.size(); ++index)
+            {
+                completed.acquire();
+            }
+
+            state.PauseTiming();
+            // The requests own the read buffers, so release them outside of the timing
+            requests.clear();
+            if (failed > 0)
+            {
+                state.SkipWithError("Not all reads completed successfully.");
+            }
+            state.ResumeTiming();
+        }
+
+        streamer.reset();
+        state.SetItemsProcessed(state.iterations() * m_filePaths.size());
+        state.SetBytesProcessed(state.iterations() * m_filePaths.size() * m_fileSize);
+    }
+    BENCHMARK_REGISTER_F(StreamerBenchmarkFixture, BM_ReadFiles)
+        ->ArgNames({ "Files", "SizeKiB" })
+        ->Args({ 64, 4 })
+        ->Args({ 16, 256 })
+        ->Unit(benchmark::kMicrosecond)
+        ->UseRealTime();
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/BlockCache.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/ReadAhead.h>
+#include <AzCore/IO/Streamer/ReadSplitter.h>
+#include <AzCore/IO/Streamer/Scheduler.h>
+#include <AzCore/IO/Streamer/StorageDrive.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/semaphore.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Replays a trace recorded with the StartStreamerTrace console command against various stream stack configurations.
+    //! The trace to replay is provided through the O3DE_STREAMER_TRACE environment variable. The files referenced by the trace
+    //! need to be available at the same location as when the trace was recorded.
+    //! Arguments are:
+    //!     0 - The size of the block cache in megabytes or 0 to disable the block cache.
+    //!     1 - The size in kilobytes at which the read splitter splits reads or 0 to disable the read splitter.
+    //!     2 - The read ahead depth or 0 to disable read ahead.
+    class StreamerTraceBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            LoadTrace();
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            LoadTrace();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_trace = {};
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            m_trace = {};
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void LoadTrace()
+        {
+            m_traceLoaded = false;
+            char tracePathBuffer[AZ::IO::MaxPathLength];
+            if (auto tracePath = AZ::Utils::GetEnv(tracePathBuffer, "O3DE_STREAMER_TRACE"); tracePath.IsSuccess())
+            {
+                m_traceLoaded = m_trace.Load(AZ::IO::FixedMaxPathString(tracePath.GetValue()).c_str());
+            }
+        }
+
+        AZStd::unique_ptr<AZ::IO::Scheduler> CreateStack(const ::benchmark::State& state) const
+        {
+            using namespace AZ::IO;
+
+            HardwareInformation hardware;
+            if (!CollectIoHardwareInformation(hardware, true, false))
+            {
+                return {};
+            }
+
+            AZStd::shared_ptr<StreamStackEntry> stack;
+            StorageDriveConfig driveConfig;
+            stack = driveConfig.AddStreamStackEntry(hardware, AZStd::move(stack));
+
+            if (state.range(1) > 0)
+            {
+                ReadSplitterConfig splitterConfig;
+                splitterConfig.m_splitSize = static_cast<ReadSplitterConfig::SplitSize>(state.range(1) * 1_kib);
+                splitterConfig.m_adjustOffset = state.range(0) == 0;
+                stack = splitterConfig.AddStreamStackEntry(hardware, AZStd::move(stack));
+            }
+            if (state.range(0) > 0)
+            {
+                BlockCacheConfig cacheConfig;
+                cacheConfig.m_cacheSizeMib = aznumeric_cast<AZ::u32>(state.range(0));
+                stack = cacheConfig.AddStreamStackEntry(hardware, AZStd::move(stack));
+            }
+            if (state.range(2) > 0)
+            {
+                ReadAheadConfig readAheadConfig;
+                readAheadConfig.m_depth = aznumeric_cast<AZ::u32>(state.range(2));
+                stack = readAheadConfig.AddStreamStackEntry(hardware, AZStd::move(stack));
+            }
+
+            return AZStd::make_unique<Scheduler>(
+                AZStd::move(stack), hardware.m_maxPhysicalSectorSize, hardware.m_maxLogicalSectorSize, hardware.m_maxTransfer);
+        }
+
+        AZ::IO::StreamerTrace m_trace;
+        bool m_traceLoaded{ false };
+    };
+
+    BENCHMARK_DEFINE_F(StreamerTraceBenchmarkFixture, BM_ReplayTrace)(benchmark::State& state)
+    {
+        using namespace AZ::IO;
+
+        if (!m_traceLoaded)
+        {
+            state.SkipWithError("No Streamer trace available. Set O3DE_STREAMER_TRACE to the path of a recorded trace.");
+            return;
+        }
+
+        double totalLatencyUs = 0.0;
+        size_t totalCompleted = 0;
+        size_t totalMissedDeadlines = 0;
+        size_t totalFailed = 0;
+        size_t totalBytes = 0;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            auto streamer = AZStd::make_unique<Streamer>(AZStd::thread_desc{}, CreateStack(state));
+            IStreamerTypes::DefaultRequestMemoryAllocator allocator;
+            AZStd::vector<FileRequestPtr> requests;
+            requests.reserve(m_trace.m_reads.size());
+
+            AZStd::semaphore completed;
+            AZStd::atomic<AZ::s64> latencyUs{ 0 };
+            AZStd::atomic<size_t> missedDeadlines{ 0 };
+            AZStd::atomic<size_t> failed{ 0 };
+            state.ResumeTiming();
+
+            const AZStd::chrono::steady_clock::time_point start = AZStd::chrono::steady_clock::now();
+            for (const StreamerTrace::Read& read : m_trace.m_reads)
+            {
+                // Issue the request at the same relative time it was issued during recording.
+                auto delay = (start + read.m_issueTime) - AZStd::chrono::steady_clock::now();
+                if (delay.count() > 0)
+                {
+                    AZStd::this_thread::sleep_for(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(delay));
+                }
+
+                FileRequestPtr& request = requests.emplace_back(streamer->Read(
+                    m_trace.m_paths[read.m_pathIndex], allocator, read.m_size, read.m_deadline, read.m_priority, read.m_offset));
+                AZStd::chrono::steady_clock::time_point issueTime = AZStd::chrono::steady_clock::now();
+                AZStd::chrono::steady_clock::time_point deadline = read.m_deadline == IStreamerTypes::s_noDeadline
+                    ? AZStd::chrono::steady_clock::time_point::max()
+                    : issueTime + read.m_deadline;
+                streamer->SetRequestCompleteCallback(request,
+                    [&, issueTime, deadline](FileRequestHandle handle)
+                    {
+                        AZStd::chrono::steady_clock::time_point now = AZStd::chrono::steady_clock::now();
+                        latencyUs += AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(now - issueTime).count();
+                        if (now > deadline)
+                        {
+                            ++missedDeadlines;
+                        }
+                        if (streamer->GetRequestStatus(handle) != IStreamerTypes::RequestStatus::Completed)
+                        {
+                            ++failed;
+                        }
+                        completed.release();
+                    });
+                streamer->QueueRequest(request);
+            }
+            for (size_t i = 0; i < m_trace.m_reads.size(); ++i)
+            {
+                completed.acquire();
+            }
+
+            state.PauseTiming();
+            totalLatencyUs += aznumeric_cast<double>(latencyUs.load());
+            totalCompleted += m_trace.m_reads.size();
+            totalMissedDeadlines += missedDeadlines;
+            totalFailed += failed;
+            for (const StreamerTrace::Read& read : m_trace.m_reads)
+            {
+                totalBytes += read.m_size;
+            }
+            requests.clear();
+            streamer.reset();
+            state.ResumeTiming();
+        }
+
+        if (totalCompleted > 0)
+        {
+            state.counters["AvgLatencyUs"] = totalLatencyUs / aznumeric_cast<double>(totalCompleted);
+            state.counters["MissedDeadlines%"] =
+                100.0 * aznumeric_cast<double>(totalMissedDeadlines) / aznumeric_cast<double>(totalCompleted);
+            state.counters["Failed"] = aznumeric_cast<double>(totalFailed);
+        }
+        state.SetBytesProcessed(totalBytes);
+    }
+
+    BENCHMARK_REGISTER_F(StreamerTraceBenchmarkFixture, BM_ReplayTrace)
+        ->ArgNames({ "CacheMib", "SplitKib", "ReadAhead" })
+        ->Args({ 0, 0, 0 })
+        ->Args({ 0, 1024, 0 })
+        ->Args({ 8, 1024, 0 })
+        ->Args({ 32, 1024, 0 })
+        ->Args({ 8, 1024, 2 })
+        ->Args({ 32, 1024, 4 })
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime()
+        ->Iterations(1);
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/Utils.h>
+
+namespace AZ::IO
+{
+    class Streamer_StreamerTraceTest
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        void TearDown() override
+        {
+            m_tempDirectory.reset();
+            UnitTest::LeakDetectionFixture::TearDown();
+        }
+
+        AZ::IO::Path GetTracePath()
+        {
+            if (!m_tempDirectory)
+            {
+                m_tempDirectory = AZStd::make_unique<AZ::Test::ScopedAutoTempDirectory>();
+            }
+            return m_tempDirectory->Resolve("Streamer.trace");
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::Test::ScopedAutoTempDirectory> m_tempDirectory;
+    };
+
+    TEST_F(Streamer_StreamerTraceTest, SaveAndLoad_TraceWithReads_AllValuesAreRestored)
+    {
+        StreamerTrace trace;
+        trace.m_paths.push_back("FileA");
+        trace.m_paths.push_back("FileB");
+
+        StreamerTrace::Read& first = trace.m_reads.emplace_back();
+        first.m_issueTime = AZStd::chrono::microseconds(10);
+        first.m_completionTime = AZStd::chrono::microseconds(250);
+        first.m_offset = 4_kib;
+        first.m_size = 64_kib;
+        first.m_pathIndex = 1;
+        first.m_priority = IStreamerTypes::s_priorityHigh;
+        first.m_status = IStreamerTypes::RequestStatus::Completed;
+
+        StreamerTrace::Read& second = trace.m_reads.emplace_back();
+        second.m_issueTime = AZStd::chrono::microseconds(20);
+        second.m_deadline = AZStd::chrono::milliseconds(16);
+        second.m_size = 1_kib;
+        second.m_status = IStreamerTypes::RequestStatus::Canceled;
+
+        AZ::IO::Path tracePath = GetTracePath();
+        ASSERT_TRUE(trace.Save(tracePath.c_str()));
+
+        StreamerTrace loaded;
+        ASSERT_TRUE(loaded.Load(tracePath.c_str()));
+        ASSERT_EQ(2u, loaded.m_paths.size());
+        EXPECT_STREQ("FileA", loaded.m_paths[0].c_str());
+        EXPECT_STREQ("FileB", loaded.m_paths[1].c_str());
+
+        ASSERT_EQ(2u, loaded.m_reads.size());
+        EXPECT_EQ(first.m_issueTime, loaded.m_reads[0].m_issueTime);
+        EXPECT_EQ(first.m_completionTime, loaded.m_reads[0].m_completionTime);
+        EXPECT_EQ(IStreamerTypes::s_noDeadline, loaded.m_reads[0].m_deadline);
+        EXPECT_EQ(first.m_offset, loaded.m_reads[0].m_offset);
+        EXPECT_EQ(first.m_size, loaded.m_reads[0].m_size);
+        EXPECT_EQ(first.m_pathIndex, loaded.m_reads[0].m_pathIndex);
+        EXPECT_EQ(first.m_priority, loaded.m_reads[0].m_priority);
+        EXPECT_EQ(first.m_status, loaded.m_reads[0].m_status);
+
+        EXPECT_EQ(second.m_deadline, loaded.m_reads[1].m_deadline);
+        EXPECT_EQ(second.m_status, loaded.m_reads[1].m_status);
+    }
+
+    TEST_F(Streamer_StreamerTraceTest, Load_FileIsNotATrace_ReturnsFalse)
+    {
+        AZ::IO::Path tracePath = GetTracePath();
+        SystemFile file;
+        ASSERT_TRUE(file.Open(tracePath.c_str(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_WRITE_ONLY));
+        const char data[] = "Not a Streamer trace";
+        file.Write(data, sizeof(data));
+        file.Close();
+
+        StreamerTrace loaded;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(loaded.Load(tracePath.c_str()));
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+        EXPECT_TRUE(loaded.m_reads.empty());
+    }
+
+    TEST_F(Streamer_StreamerTraceTest, Recorder_RecordReadAndCompletion_TraceIsStoredOnStop)
+    {
+        AZ::IO::Path tracePath = GetTracePath();
+        StreamerTraceRecorder recorder;
+        ASSERT_TRUE(recorder.Start(tracePath.Native()));
+        EXPECT_TRUE(recorder.IsRecording());
+
+        AZStd::chrono::steady_clock::time_point now = AZStd::chrono::steady_clock::now();
+        char buffer[16];
+        Requests::ReadRequestData readData(RequestPath(tracePath.c_str()), buffer, sizeof(buffer), 8, sizeof(buffer),
+            now + AZStd::chrono::milliseconds(5), IStreamerTypes::s_priorityLow);
+        StreamerTraceRecorder::Token token = recorder.RecordRead(readData, now);
+        EXPECT_NE(StreamerTraceRecorder::s_invalidToken, token);
+        recorder.RecordCompletion(token, IStreamerTypes::RequestStatus::Completed, now + AZStd::chrono::milliseconds(1));
+
+        EXPECT_TRUE(recorder.Stop());
+        EXPECT_FALSE(recorder.IsRecording());
+        // Completions after the recording has stopped are ignored.
+        recorder.RecordCompletion(token, IStreamerTypes::RequestStatus::Failed, now);
+
+        StreamerTrace loaded;
+        ASSERT_TRUE(loaded.Load(tracePath.c_str()));
+        ASSERT_EQ(1u, loaded.m_paths.size());
+        ASSERT_EQ(1u, loaded.m_reads.size());
+        EXPECT_EQ(8u, loaded.m_reads[0].m_offset);
+        EXPECT_EQ(sizeof(buffer), loaded.m_reads[0].m_size);
+        EXPECT_EQ(IStreamerTypes::Deadline(AZStd::chrono::milliseconds(5)), loaded.m_reads[0].m_deadline);
+        EXPECT_EQ(IStreamerTypes::s_priorityLow, loaded.m_reads[0].m_priority);
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, loaded.m_reads[0].m_status);
+        EXPECT_LT(loaded.m_reads[0].m_issueTime, loaded.m_reads[0].m_completionTime);
+    }
+} // namespace AZ::IO
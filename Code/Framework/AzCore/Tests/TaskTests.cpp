@@ -6,9 +6,15 @@
  *
  */
 
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Metrics/IEventLogger.h>
+#include <AzCore/Task/ParallelAlgorithms.h>
+#include <AzCore/Task/TaskCoroutine.h>
 #include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/string/string.h>
 
 #include <AzCore/UnitTest/TestTypes.h>
 
@@ -20,6 +26,10 @@ using AZ::TaskGraphEvent;
 using AZ::TaskExecutor;
 using AZ::Internal::Task;
 using AZ::TaskPriority;
+using AZ::JobContext;
+using AZ::JobManager;
+using AZ::JobManagerDesc;
+using AZ::JobManagerThreadDesc;
 
 static TaskDescriptor defaultTD{ "TaskGraphTestTask", "TaskGraphTests" };
 
@@ -624,6 +634,382 @@ namespace UnitTest
 
         EXPECT_EQ(3 | 0b100000, x);
     }
+
+    TEST_F(TaskGraphTestFixture, UnevenFanOut)
+    {
+        // All the work becomes ready on the worker that ran the root, the other workers have to steal it
+        TaskExecutor executor{ 4 };
+        constexpr int TaskCount = 1024;
+        AZStd::atomic<int> count = 0;
+
+        TaskGraph graph{ "UnevenFanOut" };
+        auto root = graph.AddTask(
+            defaultTD,
+            []
+            {
+            });
+        for (int i = 0; i != TaskCount; ++i)
+        {
+            auto task = graph.AddTask(
+                defaultTD,
+                [&count]
+                {
+                    ++count;
+                });
+            root.Precedes(task);
+        }
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(TaskCount, count);
+    }
+
+    TEST_F(TaskGraphTestFixture, WorkerHint)
+    {
+        TaskExecutor executor{ 4 };
+        TaskDescriptor hintedTD = defaultTD;
+        hintedTD.workerHint = 2;
+
+        constexpr size_t TaskCount = 64;
+        AZStd::thread_id threadIds[TaskCount];
+
+        TaskGraph graph{ "WorkerHint" };
+        auto root = graph.AddTask(
+            defaultTD,
+            []
+            {
+            });
+        for (size_t i = 0; i != TaskCount; ++i)
+        {
+            auto task = graph.AddTask(
+                hintedTD,
+                [&threadIds, i]
+                {
+                    threadIds[i] = AZStd::this_thread::get_id();
+                });
+            root.Precedes(task);
+        }
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(executor, &ev);
+        ev.Wait();
+
+        for (size_t i = 1; i != TaskCount; ++i)
+        {
+            EXPECT_EQ(threadIds[0], threadIds[i]);
+        }
+    }
+
+    TEST_F(TaskGraphTestFixture, ExecutorOnJobManagerWorkers)
+    {
+        JobManagerDesc desc;
+        desc.m_workerThreads.push_back(JobManagerThreadDesc());
+        desc.m_workerThreads.push_back(JobManagerThreadDesc());
+        JobManager jobManager(desc);
+        JobContext jobContext(jobManager);
+        TaskExecutor executor(jobContext);
+
+        AZStd::atomic<int> x = 0;
+        TaskGraph graph{ "JobWorkers" };
+        auto a = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x = 0b111;
+            });
+        TaskDescriptor criticalTD = defaultTD;
+        criticalTD.priority = TaskPriority::CRITICAL;
+        auto b = graph.AddTask(
+            criticalTD,
+            [&]
+            {
+                x ^= 1;
+            });
+        auto c = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x ^= 2;
+            });
+        auto d = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                x -= 1;
+            });
+        a.Precedes(b, c);
+        d.Follows(b, c);
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(3, x);
+    }
+
+    TEST_F(TaskGraphTestFixture, EventContinuation)
+    {
+        AZStd::atomic<int> x = 0;
+        AZStd::binary_semaphore done;
+        struct ContinuationData
+        {
+            AZStd::atomic<int>* m_x;
+            AZStd::binary_semaphore* m_done;
+        } data{ &x, &done };
+
+        TaskGraph graph{ "EventContinuation" };
+        graph.AddTask(
+            defaultTD,
+            [&x]
+            {
+                x = 1;
+            });
+
+        TaskGraphEvent ev{ "ev" };
+        ev.SetContinuation(
+            [](void* userData)
+            {
+                auto* continuationData = static_cast<ContinuationData*>(userData);
+                *continuationData->m_x += 1;
+                continuationData->m_done->release();
+            },
+            &data);
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        done.acquire();
+
+        EXPECT_EQ(2, x);
+    }
+
+    TEST_F(TaskGraphTestFixture, EventContinuationAfterSignal)
+    {
+        TaskGraph graph{ "EventContinuationAfterSignal" };
+        graph.AddTask(
+            defaultTD,
+            []
+            {
+            });
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        // Continuations set after the event was signaled are invoked immediately
+        bool invoked = false;
+        ev.SetContinuation(
+            [](void* userData)
+            {
+                *static_cast<bool*>(userData) = true;
+            },
+            &invoked);
+        EXPECT_TRUE(invoked);
+    }
+
+    // Keeps the names of the recorded events and ignores everything else
+    class TimelineEventLogger : public AZ::Metrics::IEventLogger
+    {
+    public:
+        void Flush() override
+        {
+        }
+        ResultOutcome RecordDurationEventBegin(const AZ::Metrics::DurationArgs&) override
+        {
+            return AZ::Success();
+        }
+        ResultOutcome RecordDurationEventEnd(const AZ::Metrics::DurationArgs&) override
+        {
+            return AZ::Success();
+        }
+        ResultOutcome RecordCompleteEvent(const AZ::Metrics::CompleteArgs& args) override
+        {
+            EXPECT_TRUE(args.m_ts.has_value());
+            EXPECT_TRUE(args.m_tid.has_value());
+            m_completeEvents.emplace_back(args.m_name);
+            return AZ::Success();
+        }
+        ResultOutcome RecordInstantEvent(const AZ::Metrics::InstantArgs& args) override
+        {
+            m_instantEvents.emplace_back(args.m_name);
+            return AZ::Success();
+        }
+        ResultOutcome RecordCounterEvent(const AZ::Metrics::CounterArgs&) override
+        {
+            return AZ::Success();
+        }
+        ResultOutcome RecordAsyncEventStart(const AZ::Metrics::AsyncArgs&) override
+        {
+            return AZ::Success();
+        }
+        ResultOutcome RecordAsyncEventInstant(const AZ::Metrics::AsyncArgs&) override
+        {
+            return AZ::Success();
+        }
+        ResultOutcome RecordAsyncEventEnd(const AZ::Metrics::AsyncArgs&) override
+        {
+            return AZ::Success();
+        }
+
+        AZStd::vector<AZStd::string> m_completeEvents;
+        AZStd::vector<AZStd::string> m_instantEvents;
+    };
+
+    TEST_F(TaskGraphTestFixture, TimelineRecording)
+    {
+        TaskExecutor executor{ 2 };
+        EXPECT_FALSE(executor.IsRecordingTimeline());
+        executor.StartTimelineRecording();
+        EXPECT_TRUE(executor.IsRecordingTimeline());
+
+        constexpr int TaskCount = 16;
+        TaskDescriptor timelineTD{ "TimelineTask", "TaskGraphTests" };
+        TaskGraph graph{ "TimelineRecording" };
+        for (int i = 0; i != TaskCount; ++i)
+        {
+            graph.AddTask(
+                timelineTD,
+                []
+                {
+                });
+        }
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(executor, &ev);
+        ev.Wait();
+
+        TimelineEventLogger logger;
+        executor.ExportTimeline(logger);
+        EXPECT_FALSE(executor.IsRecordingTimeline());
+
+        int taskEvents = 0;
+        for (const AZStd::string& name : logger.m_completeEvents)
+        {
+            if (name == "TimelineTask")
+            {
+                ++taskEvents;
+            }
+            else
+            {
+                EXPECT_EQ("Idle", name);
+            }
+        }
+        EXPECT_EQ(TaskCount, taskEvents);
+        // Every worker that ran a task reports its occupancy
+        EXPECT_FALSE(logger.m_instantEvents.empty());
+        EXPECT_GE(2u, logger.m_instantEvents.size());
+    }
+
+    TEST_F(TaskGraphTestFixture, ParallelForEach_VisitsEveryElementOnce)
+    {
+        AZStd::vector<int> values(10000, 1);
+        AZStd::for_each(AZStd::execution::par.on(*m_executor).with_grain_size(64), values.begin(), values.end(), [](int& value)
+            {
+                value *= 3;
+            });
+
+        EXPECT_EQ(values.end(), AZStd::find_if(values.begin(), values.end(), [](int value) { return value != 3; }));
+    }
+
+    TEST_F(TaskGraphTestFixture, ParallelSort_MatchesSequentialSort)
+    {
+        std::mt19937 generator(7);
+        AZStd::vector<uint32_t> values(10007);
+        for (uint32_t& value : values)
+        {
+            value = generator();
+        }
+        AZStd::vector<uint32_t> expected = values;
+        AZStd::sort(expected.begin(), expected.end(), AZStd::greater<uint32_t>());
+
+        // Splits into six chunks when there are enough workers, so one of the merge passes has a run without a partner
+        AZStd::sort(AZStd::execution::par.on(*m_executor).with_grain_size(1500), values.begin(), values.end(), AZStd::greater<uint32_t>());
+
+        EXPECT_EQ(expected, values);
+    }
+
+    TEST_F(TaskGraphTestFixture, ParallelTransformReduce_MatchesSequentialResult)
+    {
+        AZStd::vector<int64_t> values(5000);
+        for (size_t index = 0; index < values.size(); ++index)
+        {
+            values[index] = static_cast<int64_t>(index);
+        }
+        auto square = [](int64_t value)
+        {
+            return value * value;
+        };
+
+        const int64_t expected = AZStd::transform_reduce(values.begin(), values.end(), int64_t{ 10 }, AZStd::plus<int64_t>(), square);
+        const int64_t result = AZStd::transform_reduce(
+            AZStd::execution::par.on(*m_executor).with_grain_size(100), values.begin(), values.end(), int64_t{ 10 }, AZStd::plus<int64_t>(), square);
+
+        EXPECT_EQ(expected, result);
+    }
+
+#if defined(AZ_TASK_COROUTINES_SUPPORTED)
+    TEST_F(TaskGraphTestFixture, CoroutineResumeOnExecutor)
+    {
+        TaskExecutor executor{ 2 };
+        AZStd::thread_id coroutineThread;
+        AZStd::binary_semaphore done;
+
+        auto coroutine = [](TaskExecutor& executor, AZStd::thread_id& coroutineThread, AZStd::binary_semaphore& done) -> AZ::TaskCoroutine
+        {
+            co_await AZ::ResumeOn(executor);
+            coroutineThread = AZStd::this_thread::get_id();
+            done.release();
+        };
+        coroutine(executor, coroutineThread, done);
+        done.acquire();
+
+        EXPECT_NE(AZStd::this_thread::get_id(), coroutineThread);
+    }
+
+    TEST_F(TaskGraphTestFixture, CoroutineAwaitEvent)
+    {
+        AZStd::atomic<int> x = 0;
+        AZStd::binary_semaphore done;
+
+        auto coroutine = [](TaskExecutor& executor, AZStd::atomic<int>& x, AZStd::binary_semaphore& done) -> AZ::TaskCoroutine
+        {
+            TaskGraph graph{ "CoroutineAwaitEvent" };
+            auto a = graph.AddTask(
+                defaultTD,
+                [&x]
+                {
+                    x = 1;
+                });
+            auto b = graph.AddTask(
+                defaultTD,
+                [&x]
+                {
+                    x = x * 3;
+                });
+            a.Precedes(b);
+
+            // Both the graph and event are part of the coroutine frame, which stays alive while the coroutine is suspended
+            TaskGraphEvent ev{ "ev" };
+            graph.SubmitOnExecutor(executor, &ev);
+            co_await ev;
+            x += 1;
+
+            TaskGraph secondGraph{ "CoroutineAwaitEventResumeOnExecutor" };
+            secondGraph.AddTask(
+                defaultTD,
+                [&x]
+                {
+                    x = x * 2;
+                });
+            TaskGraphEvent secondEv{ "secondEv" };
+            secondGraph.SubmitOnExecutor(executor, &secondEv);
+            co_await AZ::WaitFor(secondEv, executor);
+            done.release();
+        };
+        coroutine(*m_executor, x, done);
+        done.acquire();
+
+        EXPECT_EQ(8, x);
+    }
+#endif // AZ_TASK_COROUTINES_SUPPORTED
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
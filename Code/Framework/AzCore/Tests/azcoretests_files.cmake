@@ -31,6 +31,7 @@ set(FILES
     AZStd/DequeAndSimilar.cpp
     AZStd/Examples.cpp
     AZStd/ExpectedTests.cpp
+    AZStd/FlatContainers.cpp
     AZStd/FunctionalBasic.cpp
     AZStd/FunctorsBind.cpp
     AZStd/Hashed.cpp
@@ -72,6 +73,7 @@ set(FILES
     BehaviorContext.cpp
     BehaviorContextFixture.h
     Components.cpp
+    DenseComponentStorageTests.cpp
     Console/LoggerSystemComponentTests.cpp
     Console/ConsoleTests.cpp
     Date/DateFormatTests.cpp
@@ -123,6 +125,7 @@ set(FILES
     Math/IntersectionTestHelpers.cpp
     Math/IntersectionTestHelpers.h
     Math/IntersectionTests.cpp
+    Math/MathBatchTests.cpp
     Math/MathIntrinsicsTests.cpp
     Math/IntersectPointTest.cpp
     Math/MathStringsTests.cpp
@@ -164,6 +167,7 @@ set(FILES
     Math/VectorNTests.cpp
     Math/VectorNPerformanceTests.cpp
     Memory/AllocatorBenchmarks.cpp
+    Memory/FrameArenaAllocator.cpp
     Memory/HphaAllocator.cpp
     Memory/HphaAllocatorErrorDetection.cpp
     Memory/LeakDetection.cpp
@@ -172,6 +176,8 @@ set(FILES
     Metrics/EventLoggerReflectUtilsTests.cpp
     Metrics/EventLoggerUtilsTests.cpp
     Metrics/JsonTraceEventLoggerTests.cpp
+    Metrics/MetricsRegistryTests.cpp
+    Metrics/PerfettoTraceEventLoggerTests.cpp
     Module.cpp
     ModuleTestBus.h
     Name/NameJsonSerializerTests.cpp
@@ -187,6 +193,7 @@ set(FILES
     Rtti.cpp
     Script.cpp
     ScriptMath.cpp
+    Serialization/SerializationBenchmarks.cpp
     Serialization/Json/ArraySerializerTests.cpp
     Serialization/Json/AnySerializerTests.cpp
     Serialization/Json/BaseJsonSerializerFixture.h
@@ -239,6 +246,7 @@ set(FILES
     Settings/SettingsRegistryMergeUtilsTests.cpp
     Settings/SettingsRegistryOriginTrackerTests.cpp
     Settings/SettingsRegistryScriptUtilsTests.cpp
+    Settings/SettingsRegistryValueHandleTests.cpp
     Settings/SettingsRegistryVisitorUtilsTests.cpp
     Settings/TextParserTests.cpp
     Slice.cpp
@@ -252,11 +260,15 @@ set(FILES
     Streamer/FullDecompressorTests.cpp
     Streamer/IStreamerMock.h
     Streamer/IStreamerTypesMock.h
+    Streamer/ReadAheadTests.cpp
     Streamer/ReadSplitterTests.cpp
     Streamer/SchedulerTests.cpp
     Streamer/StreamStackEntryConformityTests.h
     Streamer/StreamStackEntryMock.h
     Streamer/StreamStackEntryTests.cpp
+    Streamer/StreamerBenchmarks.cpp
+    Streamer/StreamerTraceBenchmarks.cpp
+    Streamer/StreamerTraceTests.cpp
     StreamerTests.cpp
     StringFunc.cpp
     SystemFileTest.cpp
@@ -108,7 +108,7 @@ namespace AZ::IO::ArchiveInternal
 
         int FSeek(uint64_t nOffset, int nMode);
         size_t FRead(void* pDest, size_t bytesToRead, AZ::IO::HandleType fileHandle);
-        void* GetFileData(size_t& nFileSize, AZ::IO::HandleType fileHandle);
+        const void* GetFileData(size_t& nFileSize, AZ::IO::HandleType fileHandle);
         int FEof();
 
         uint64_t GetModificationTime() { return m_pFileData->GetFileEntry()->GetModificationTime(); }
@@ -197,7 +197,7 @@ namespace AZ::IO::ArchiveInternal
 
 
     //////////////////////////////////////////////////////////////////////////
-    void* ArchiveInternal::CZipPseudoFile::GetFileData(size_t& nFileSize, [[maybe_unused]] AZ::IO::HandleType fileHandle)
+    const void* ArchiveInternal::CZipPseudoFile::GetFileData(size_t& nFileSize, [[maybe_unused]] AZ::IO::HandleType fileHandle)
     {
         AZ_PROFILE_FUNCTION(AzCore);
 
@@ -208,7 +208,7 @@ namespace AZ::IO::ArchiveInternal
 
         nFileSize = GetFileSize();
 
-        void* pData = GetFile()->GetData();
+        const void* pData = GetFile()->GetReadOnlyData();
         m_nCurSeek = nFileSize;
         return pData;
     }
@@ -905,7 +905,7 @@ namespace AZ::IO
     }
 
     //////////////////////////////////////////////////////////////////////////
-    void* Archive::FGetCachedFileData(AZ::IO::HandleType fileHandle, size_t& nFileSize)
+    const void* Archive::FGetCachedFileData(AZ::IO::HandleType fileHandle, size_t& nFileSize)
     {
         AZ_PROFILE_FUNCTION(AzCore);
 
@@ -1563,7 +1563,12 @@ namespace AZ::IO
             return 0;
         }
 
-        if (m_pFileEntry->nMethod == ZipFile::METHOD_STORE) //Can't use this technique for METHOD_STORE_AND_STREAMCIPHER_KEYTABLE as seeking with encryption performs poorly
+        if (AZStd::span<const AZStd::byte> mappedData = GetMappedData(); !mappedData.empty())
+        {
+            // Uncompressed read from the memory mapped archive, no locking needed as the view is never modified by the archive.
+            memcpy(pBuffer, mappedData.data() + nFileOffset, aznumeric_cast<size_t>(nReadSize));
+        }
+        else if (m_pFileEntry->nMethod == ZipFile::METHOD_STORE) //Can't use this technique for METHOD_STORE_AND_STREAMCIPHER_KEYTABLE as seeking with encryption performs poorly
         {
             AZStd::scoped_lock lock(m_pFileEntry->m_readLock);
             // Uncompressed read.
@@ -1590,6 +1595,26 @@ namespace AZ::IO
         return nReadSize;
     }
 
+    const void* CCachedFileData::GetReadOnlyData(bool bRefreshCache)
+    {
+        // stored entries of mapped archives are handed out straight from the view, everything else is read into m_pFileData
+        if (AZStd::span<const AZStd::byte> mappedData = GetMappedData(); !mappedData.empty())
+        {
+            return mappedData.data();
+        }
+        return GetData(bRefreshCache);
+    }
+
+    AZStd::span<const AZStd::byte> CCachedFileData::GetMappedData()
+    {
+        if (!m_pZip || !m_pFileEntry || m_pFileEntry->nMethod != ZipFile::METHOD_STORE || !m_pZip->IsFileMapped())
+        {
+            return {};
+        }
+        AZStd::scoped_lock lock(m_pFileEntry->m_readLock);
+        return m_pZip->GetMappedFileData(m_pFileEntry);
+    }
+
     uint32_t CCachedFileData::GetFileDataOffset()
     {
         m_pZip->Refresh(m_pFileEntry);
@@ -2120,7 +2145,7 @@ namespace AZ::IO
         {
             auto manifestInfo =
                 AZStd::shared_ptr<AzFramework::AssetBundleManifest>(AZ::Utils::LoadObjectFromBuffer<AzFramework::AssetBundleManifest>(
-                    fileData->GetData(), fileData->GetFileEntry()->desc.lSizeUncompressed));
+                    fileData->GetReadOnlyData(), fileData->GetFileEntry()->desc.lSizeUncompressed));
 
             return manifestInfo;
         }
@@ -2185,7 +2210,7 @@ namespace AZ::IO
         AZ::SerializeContext* serializeContext = nullptr;
         AZ::ComponentApplicationBus::BroadcastResult(serializeContext, &AZ::ComponentApplicationBus::Events::GetSerializeContext);
         AZ_Assert(serializeContext, "Failed to retrieve serialize context.");
-        auto catalogInfo = AZStd::shared_ptr<AzFramework::AssetRegistry>(AZ::Utils::LoadObjectFromBuffer<AzFramework::AssetRegistry>(fileData->GetData(), fileData->GetFileEntry()->desc.lSizeUncompressed));
+        auto catalogInfo = AZStd::shared_ptr<AzFramework::AssetRegistry>(AZ::Utils::LoadObjectFromBuffer<AzFramework::AssetRegistry>(fileData->GetReadOnlyData(), fileData->GetFileEntry()->desc.lSizeUncompressed));
 
         return catalogInfo;
     }
@@ -57,12 +57,19 @@ namespace AZ::IO
         // decompress can be harmlessly set to true if you want the data back decompressed.
         // set them to false only if you want to operate on the raw data while its still compressed.
         void* GetData(bool bRefreshCache = true, bool decompress = true);
+        // return the decompressed data in the file, or nullptr if error
+        // unlike GetData, this doesn't copy stored entries of memory mapped archives, so the data must not be modified.
+        const void* GetReadOnlyData(bool bRefreshCache = true);
         // Uncompress file data directly to provided memory.
         bool GetDataTo(void* pFileData, int nDataSize, bool bDecompress = true);
 
         // Return number of copied bytes, or -1 if did not read anything
         int64_t ReadData(void* pBuffer, int64_t nFileOffset, int64_t nReadSize);
 
+        // Returns a zero-copy view of the file data in the memory mapped archive. This is only available for stored
+        // (uncompressed) entries of archives that are mapped into memory, otherwise an empty span is returned.
+        AZStd::span<const AZStd::byte> GetMappedData();
+
         ZipDir::Cache* GetZip() { return m_pZip.get(); }
         ZipDir::FileEntry* GetFileEntry() { return m_pFileEntry; }
 
@@ -199,7 +206,7 @@ namespace AZ::IO
 
         AZ::IO::HandleType FOpen(AZStd::string_view pName, const char* mode) override;
         size_t FRead(void* data, size_t bytesToRead, AZ::IO::HandleType handle) override;
-        void* FGetCachedFileData(AZ::IO::HandleType handle, size_t& nFileSize) override;
+        const void* FGetCachedFileData(AZ::IO::HandleType handle, size_t& nFileSize) override;
         size_t FWrite(const void* data, size_t bytesToWrite, AZ::IO::HandleType handle) override;
         size_t FSeek(AZ::IO::HandleType handle, uint64_t seek, int mode) override;
         uint64_t FTell(AZ::IO::HandleType handle) override;
@@ -11,6 +11,7 @@
 
 #include <AzCore/IO/Path/Path_fwd.h>
 #include <AzCore/Math/Crc.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzCore/std/string/string.h>
@@ -105,6 +106,24 @@ namespace AZ::IO
         virtual int UpdateFile(AZStd::string_view szRelativePath, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod = 0,
             int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB) = 0;
 
+        // A file for UpdateFiles, the data must stay valid until UpdateFiles returns
+        struct FileToUpdate
+        {
+            AZStd::string_view m_relativePath;
+            const void* m_uncompressed{};
+            uint64_t m_size{};
+        };
+
+        // Summary:
+        //   Adds several files to the zip or updates the existing ones.
+        // Description:
+        //   Same as calling UpdateFile for each file in order, but the files are compressed in parallel
+        //   before they are written. A file that fails doesn't stop the remaining files from being added.
+        //   fileResults receives the error code of each file and must be as large as files.
+        //   Returns the error code of the first file that failed, or ZD_ERROR_SUCCESS if all of them were added.
+        virtual int UpdateFiles(AZStd::span<const FileToUpdate> files, AZStd::span<int> fileResults, uint32_t nCompressionMethod = 0,
+            int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB) = 0;
+
         // Summary:
         //   Adds a new file to the zip or update an existing one if it is not compressed - just stored  - start a big file
         //   ( name might be misleading as if nOverwriteSeekPos is used the update is not continuous )
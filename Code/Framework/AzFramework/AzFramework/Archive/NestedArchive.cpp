@@ -7,6 +7,7 @@
  */
 
 
+#include <AzCore/Task/ParallelAlgorithms.h>
 #include <AzFramework/Archive/NestedArchive.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
 #include <AzFramework/Archive/ZipDirTree.h>
@@ -153,6 +154,56 @@ namespace AZ::IO
         return m_pCache->UpdateFile(fullPath, pUncompressed, nSize, nCompressionMethod, nCompressionLevel, codec);
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    // Adds or updates several files. Compressing is the expensive part and doesn't touch the cache,
+    // so the files are compressed in parallel first and then written to the archive one after the other
+    int NestedArchive::UpdateFiles(AZStd::span<const FileToUpdate> files, AZStd::span<int> fileResults, uint32_t nCompressionMethod, int nCompressionLevel, CompressionCodec::Codec codec)
+    {
+        AZ_Assert(fileResults.size() >= files.size(), "UpdateFiles needs a result for each of the %zu files, got %zu", files.size(), fileResults.size());
+        if (m_nFlags & FLAGS_READ_ONLY)
+        {
+            AZStd::fill(fileResults.begin(), fileResults.begin() + files.size(), ZipDir::ZD_ERROR_INVALID_CALL);
+            return ZipDir::ZD_ERROR_INVALID_CALL;
+        }
+
+        struct CompressedFile
+        {
+            ZipDir::CompressedFileData m_data;
+            ZipDir::ErrorEnum m_result = ZipDir::ZD_ERROR_SUCCESS;
+        };
+        AZStd::vector<CompressedFile> compressedFiles(files.size());
+        AZStd::for_each(AZStd::execution::par.with_grain_size(1), compressedFiles.begin(), compressedFiles.end(),
+            [&files, &compressedFiles, nCompressionMethod, nCompressionLevel, codec](CompressedFile& compressedFile)
+            {
+                const FileToUpdate& file = files[&compressedFile - compressedFiles.data()];
+                compressedFile.m_result = ZipDir::Cache::CompressFileData(
+                    file.m_uncompressed, file.m_size, nCompressionMethod, nCompressionLevel, codec, compressedFile.m_data);
+            });
+
+        int firstError = ZipDir::ZD_ERROR_SUCCESS;
+        for (size_t fileIndex = 0; fileIndex < files.size(); ++fileIndex)
+        {
+            const FileToUpdate& file = files[fileIndex];
+            int result = compressedFiles[fileIndex].m_result;
+            if (result == ZipDir::ZD_ERROR_SUCCESS)
+            {
+                AZ::IO::FixedMaxPathString fullPath = AdjustPath(file.m_relativePath);
+                result = fullPath.empty()
+                    ? ZipDir::ZD_ERROR_INVALID_PATH
+                    : m_pCache->UpdateFileData(fullPath, file.m_uncompressed, file.m_size, compressedFiles[fileIndex].m_data);
+            }
+            // release the compressed data as soon as it is written to keep the peak memory of large batches down
+            compressedFiles[fileIndex].m_data = {};
+
+            fileResults[fileIndex] = result;
+            if (firstError == ZipDir::ZD_ERROR_SUCCESS)
+            {
+                firstError = result;
+            }
+        }
+        return firstError;
+    }
+
     //////////////////////////////////////////////////////////////////////////
     //   Adds a new file to the zip or update an existing one if it is not compressed - just stored  - start a big file
     int NestedArchive::StartContinuousFileUpdate(AZStd::string_view szRelativePath, uint64_t nSize)
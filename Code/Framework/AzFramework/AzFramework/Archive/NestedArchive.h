@@ -48,6 +48,10 @@ namespace AZ::IO
         int UpdateFile(AZStd::string_view szRelativePath, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod = ZipFile::METHOD_STORE,
             int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB) override;
 
+        // Adds or updates several files, compressing them in parallel and writing them in order
+        int UpdateFiles(AZStd::span<const FileToUpdate> files, AZStd::span<int> fileResults, uint32_t nCompressionMethod = ZipFile::METHOD_STORE,
+            int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB) override;
+
         // Adds a new file to the zip or update an existing one if it is not compressed - just stored  - start a big file
         int StartContinuousFileUpdate(AZStd::string_view szRelativePath, uint64_t nSize) override;
 
@@ -34,6 +34,11 @@ namespace AZ::IO::ZipDir
         "Sets the verbosity level for zip directory cache operations\n"
         ">=1 - Turns on verbose logging of all operations");
 
+    AZ_CVAR(bool, az_archive_memory_mapped_reads, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When enabled, read-only archives are mapped into memory when they're opened.\n"
+        "Stored (uncompressed) entries are then served straight from the mapped view instead of being read into heap buffers,\n"
+        "which lets processes that open the same archives share the memory through the OS file cache.");
+
     namespace ZipDirCacheInternal
     {
         [[nodiscard]] static AZStd::intrusive_ptr<AZ::IO::MemoryBlock> CreateMemoryBlock(size_t size)
@@ -150,9 +155,47 @@ namespace AZ::IO::ZipDir
                 m_fileHandle = AZ::IO::InvalidHandle;
             }
         }
+        m_mappedFile.reset();
         m_treeDir.Clear();
     }
 
+    bool Cache::MapFile(const char* szFileName)
+    {
+        if (m_mappedFile)
+        {
+            return true;
+        }
+
+        if (!az_archive_memory_mapped_reads || !(m_nFlags & FLAGS_READ_ONLY))
+        {
+            return false;
+        }
+
+        auto mappedFile = AZStd::make_unique<AZ::IO::MemoryMappedFile>();
+        if (!mappedFile->Open(szFileName))
+        {
+            // This is expected for archives that don't live on the local file system, such as archives
+            // accessed through a remote file system. Reads will continue to go through the file handle.
+            if (az_archive_zip_directory_cache_verbosity)
+            {
+                AZ_TracePrintf("Archive", R"(Unable to map archive "%s" into memory, falling back to file reads.)" "\n", szFileName);
+            }
+            return false;
+        }
+
+        m_mappedFile = AZStd::move(mappedFile);
+        return true;
+    }
+
+    AZStd::span<const AZStd::byte> Cache::GetMappedFileData(FileEntry* pFileEntry)
+    {
+        if (!m_mappedFile || !pFileEntry || Refresh(pFileEntry) != ZD_ERROR_SUCCESS)
+        {
+            return {};
+        }
+        return m_mappedFile->GetView(pFileEntry->nFileDataOffset, pFileEntry->desc.lSizeCompressed);
+    }
+
     bool Cache::WriteCompressedData(uint8_t* data, size_t size, bool)
     {
         if (size == 0)
@@ -227,11 +270,17 @@ namespace AZ::IO::ZipDir
     // adds a directory (creates several nested directories if needed)
     ErrorEnum Cache::UpdateFile(AZStd::string_view szRelativePathSrc, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod, int nCompressionLevel, CompressionCodec::Codec codec)
     {
-        AZStd::intrusive_ptr<AZ::IO::MemoryBlock> memoryBlock;
+        CompressedFileData compressedData;
+        if (ErrorEnum e = CompressFileData(pUncompressed, nSize, nCompressionMethod, nCompressionLevel, codec, compressedData); e != ZD_ERROR_SUCCESS)
+        {
+            return e;
+        }
+        return UpdateFileData(szRelativePathSrc, pUncompressed, nSize, compressedData);
+    }
 
-        // we'll need the compressed data
+    ErrorEnum Cache::CompressFileData(const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod, int nCompressionLevel, CompressionCodec::Codec codec, CompressedFileData& compressedData)
+    {
         void* pCompressed = nullptr;
-        const void* dataBuffer{};
         size_t nSizeCompressed;
         int nError = Z_ERRNO;
 
@@ -243,9 +292,9 @@ namespace AZ::IO::ZipDir
         {
         case ZipFile::METHOD_DEFLATE:
             nSizeCompressed = GetCompressedSizeEstimate(nSize, codec);
-            memoryBlock = ZipDirCacheInternal::CreateMemoryBlock(nSizeCompressed);
-            pCompressed = memoryBlock->m_address.get();
-            dataBuffer = pCompressed;
+            compressedData.m_memoryBlock = ZipDirCacheInternal::CreateMemoryBlock(nSizeCompressed);
+            pCompressed = compressedData.m_memoryBlock->m_address.get();
+            compressedData.m_data = pCompressed;
 
             switch (codec)
             {
@@ -268,7 +317,7 @@ namespace AZ::IO::ZipDir
             break;
 
         case ZipFile::METHOD_STORE:
-            dataBuffer = pUncompressed;
+            compressedData.m_data = pUncompressed;
             nSizeCompressed = nSize;
             break;
 
@@ -276,6 +325,17 @@ namespace AZ::IO::ZipDir
             return ZD_ERROR_UNSUPPORTED;
         }
 
+        compressedData.m_size = nSizeCompressed;
+        compressedData.m_compressionMethod = nCompressionMethod;
+        return ZD_ERROR_SUCCESS;
+    }
+
+    ErrorEnum Cache::UpdateFileData(AZStd::string_view szRelativePathSrc, const void* pUncompressed, uint64_t nSize, const CompressedFileData& compressedData)
+    {
+        const void* dataBuffer = compressedData.m_data;
+        const size_t nSizeCompressed = compressedData.m_size;
+        const uint32_t nCompressionMethod = compressedData.m_compressionMethod;
+
         // create or find the file entry.. this object will rollback (delete the object
         // if the operation fails) if needed.
         FileEntryTransactionAdd pFileEntry(this, szRelativePathSrc);
@@ -666,36 +726,59 @@ namespace AZ::IO::ZipDir
             return nError;
         }
 
-        if (!AZ::IO::FileIOBase::GetDirectInstance()->Seek(m_fileHandle, pFileEntry->nFileDataOffset, AZ::IO::SeekType::SeekFromStart))
+        if (!pCompressed && !pUncompressed)
         {
-            return ZD_ERROR_IO_FAILED;
+            // what's the sense of it - no buffers at all?
+            return ZD_ERROR_INVALID_CALL;
         }
 
         AZStd::intrusive_ptr<AZ::IO::MemoryBlock> memoryBlock;
 
-        void* pBuffer = pCompressed; // the buffer where the compressed data will go
+        const void* pBuffer = pCompressed; // the buffer where the compressed data will go
 
-        if (pFileEntry->nMethod == 0 && pUncompressed)
+        if (AZStd::span<const AZStd::byte> mappedData = GetMappedFileData(pFileEntry); !mappedData.empty())
         {
-            // we can directly read into the uncompress buffer
-            pBuffer = pUncompressed;
+            if (pFileEntry->nMethod == 0 && pUncompressed)
+            {
+                // stored data can be copied straight into the uncompressed buffer
+                memcpy(pUncompressed, mappedData.data(), mappedData.size());
+                pBuffer = pUncompressed;
+            }
+            else if (pCompressed)
+            {
+                memcpy(pCompressed, mappedData.data(), mappedData.size());
+            }
+            else
+            {
+                // decompress straight from the mapped view, without an intermediate copy of the compressed data
+                pBuffer = mappedData.data();
+            }
         }
-
-        if (!pBuffer)
+        else
         {
-            if (!pUncompressed)
+            if (!AZ::IO::FileIOBase::GetDirectInstance()->Seek(m_fileHandle, pFileEntry->nFileDataOffset, AZ::IO::SeekType::SeekFromStart))
             {
-                // what's the sense of it - no buffers at all?
-                return ZD_ERROR_INVALID_CALL;
+                return ZD_ERROR_IO_FAILED;
             }
 
-            memoryBlock = ZipDirCacheInternal::CreateMemoryBlock(pFileEntry->desc.lSizeCompressed);
-            pBuffer = memoryBlock->m_address.get();
-        }
+            void* pReadBuffer = pCompressed;
+            if (pFileEntry->nMethod == 0 && pUncompressed)
+            {
+                // we can directly read into the uncompress buffer
+                pReadBuffer = pUncompressed;
+            }
 
-        if (!AZ::IO::FileIOBase::GetDirectInstance()->Read(m_fileHandle, pBuffer, pFileEntry->desc.lSizeCompressed, true))
-        {
-            return ZD_ERROR_IO_FAILED;
+            if (!pReadBuffer)
+            {
+                memoryBlock = ZipDirCacheInternal::CreateMemoryBlock(pFileEntry->desc.lSizeCompressed);
+                pReadBuffer = memoryBlock->m_address.get();
+            }
+
+            if (!AZ::IO::FileIOBase::GetDirectInstance()->Read(m_fileHandle, pReadBuffer, pFileEntry->desc.lSizeCompressed, true))
+            {
+                return ZD_ERROR_IO_FAILED;
+            }
+            pBuffer = pReadBuffer;
         }
 
         // if there's a buffer for uncompressed data, uncompress it to that buffer
@@ -16,10 +16,13 @@
 #pragma once
 
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/MemoryMappedFile.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzFramework/Archive/Codec.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
 #include <AzFramework/Archive/ZipDirTree.h>
@@ -28,6 +31,15 @@ namespace AZ::IO::ZipDir
 {
     struct FileDataRecord;
 
+    //! The data of a file as it will be stored in the archive, prepared by Cache::CompressFileData.
+    struct CompressedFileData
+    {
+        AZStd::intrusive_ptr<AZ::IO::MemoryBlock> m_memoryBlock; //!< Holds the compressed data, if the file is compressed
+        const void* m_data{}; //!< The data to write, the uncompressed data itself for stored files
+        size_t m_size{};
+        uint32_t m_compressionMethod = ZipFile::METHOD_STORE;
+    };
+
     class Cache
         : public AZStd::intrusive_base
     {
@@ -55,6 +67,13 @@ namespace AZ::IO::ZipDir
         // adds a directory (creates several nested directories if needed)
         ErrorEnum UpdateFile(AZStd::string_view szRelativePath, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod = ZipFile::METHOD_STORE, int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB);
 
+        // Compresses the data of a file for UpdateFileData. This doesn't touch the cache, so it can run for several files in parallel
+        static ErrorEnum CompressFileData(const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod, int nCompressionLevel, CompressionCodec::Codec codec, CompressedFileData& compressedData);
+
+        // Adds a new file to the zip or update an existing one with data prepared by CompressFileData
+        // pUncompressed must be the data that was compressed, it's needed for the CRC of the file
+        ErrorEnum UpdateFileData(AZStd::string_view szRelativePath, const void* pUncompressed, uint64_t nSize, const CompressedFileData& compressedData);
+
         //   Adds a new file to the zip or update an existing one if it is not compressed - just stored  - start a big file
         ErrorEnum StartContinuousFileUpdate(AZStd::string_view szRelativePath, uint64_t nSize);
 
@@ -90,6 +109,18 @@ namespace AZ::IO::ZipDir
         // refreshes information about the given file entry into this file entry
         ErrorEnum Refresh(FileEntryBase* pFileEntry);
 
+        // maps the archive file at the given path into memory, so the data of its entries can be accessed without going through
+        // the file handle. only read-only archives can be mapped. returns true if the archive is mapped after the call.
+        bool MapFile(const char* szFileName);
+        bool IsFileMapped() const
+        {
+            return m_mappedFile != nullptr;
+        }
+
+        // returns a view into the mapped archive covering the data of the given entry as it's stored in the archive,
+        // which is the uncompressed data for stored entries. returns an empty span if the archive isn't mapped.
+        AZStd::span<const AZStd::byte> GetMappedFileData(FileEntry* pFileEntry);
+
         // QUICK check to determine whether the file entry belongs to this object
         bool IsOwnerOf(const FileEntry* pFileEntry) const
         {
@@ -125,7 +156,7 @@ namespace AZ::IO::ZipDir
         ZipFile::CrySignedCDRHeader& GetSignedHeader() { return m_headerSignature; }
         ZipFile::CryCustomExtendedHeader& GetExtendedHeader() { return m_headerExtended; }
 
-        size_t GetCompressedSizeEstimate(size_t uncompressedSize, CompressionCodec::Codec codec);
+        static size_t GetCompressedSizeEstimate(size_t uncompressedSize, CompressionCodec::Codec codec);
 
     protected:
         friend class CacheFactory;
@@ -133,6 +164,8 @@ namespace AZ::IO::ZipDir
         FileEntryTree m_treeDir;
         AZ::IO::HandleType m_fileHandle = AZ::IO::InvalidHandle;
         AZ::IO::Path m_strFilePath;
+        // read-only view of the whole archive, only set when memory mapped reads are enabled
+        AZStd::unique_ptr<AZ::IO::MemoryMappedFile> m_mappedFile;
 
         // String Pool for persistently storing paths as long as they reside in the cache
         AZStd::unordered_set<AZ::IO::Path> m_relativePathPool;
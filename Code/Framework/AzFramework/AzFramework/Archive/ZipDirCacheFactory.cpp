@@ -89,6 +89,12 @@ namespace AZ::IO::ZipDir
                 AZ_Warning("Archive", false, R"(ZD_ERROR_IO_FAILED: Could not read the CDR of the pack file "%s".)", pCache->m_strFilePath.c_str());
                 return {};
             }
+
+            // archives nested inside other archives can't be mapped, they're only reachable through the outer archive
+            if (!(m_nFlags & FLAGS_READ_INSIDE_PAK))
+            {
+                pCache->MapFile(szFileName);
+            }
         }
         else
         {
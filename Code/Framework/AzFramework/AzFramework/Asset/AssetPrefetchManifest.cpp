@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Asset/AssetPrefetchManifest.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/IStreamer.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/smart_ptr/enable_shared_from_this.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AzFramework
+{
+    void AssetPrefetchManifest::ReflectSerialize(AZ::SerializeContext* serializeContext)
+    {
+        if (serializeContext)
+        {
+            serializeContext->Class<Entry>()
+                ->Version(1)
+                ->Field("AssetId", &Entry::m_assetId)
+                ->Field("StreamName", &Entry::m_streamName)
+                ->Field("Offset", &Entry::m_offset)
+                ->Field("Size", &Entry::m_size);
+
+            serializeContext->Class<AssetPrefetchManifest>()
+                ->Version(1)
+                ->Field("Entries", &AssetPrefetchManifest::m_entries);
+        }
+    }
+
+    bool AssetPrefetchManifest::Save(const AZStd::string& filePath, AZ::SerializeContext* serializeContext) const
+    {
+        return AZ::Utils::SaveObjectToFile(filePath, AZ::DataStream::ST_XML, this, serializeContext);
+    }
+
+    AZStd::unique_ptr<AssetPrefetchManifest> AssetPrefetchManifest::Load(const AZStd::string& filePath, AZ::SerializeContext* serializeContext)
+    {
+        return AZStd::unique_ptr<AssetPrefetchManifest>(AZ::Utils::LoadObjectFromFile<AssetPrefetchManifest>(filePath, serializeContext));
+    }
+
+    AZ::u64 AssetPrefetchManifest::GetTotalSize() const
+    {
+        AZ::u64 totalSize = 0;
+        for (const Entry& entry : m_entries)
+        {
+            totalSize += entry.m_size;
+        }
+        return totalSize;
+    }
+
+    //=========================================================================
+    // AssetPrefetchRecorder
+    //=========================================================================
+    AssetPrefetchRecorder::~AssetPrefetchRecorder()
+    {
+        AZ::Data::AssetManagerNotificationBus::Handler::BusDisconnect();
+    }
+
+    void AssetPrefetchRecorder::Start()
+    {
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+            m_manifest = {};
+            m_recordedAssets.clear();
+        }
+        AZ::Data::AssetManagerNotificationBus::Handler::BusConnect();
+    }
+
+    AssetPrefetchManifest AssetPrefetchRecorder::Stop()
+    {
+        AZ::Data::AssetManagerNotificationBus::Handler::BusDisconnect();
+
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        m_recordedAssets.clear();
+        return AZStd::move(m_manifest);
+    }
+
+    bool AssetPrefetchRecorder::IsRecording() const
+    {
+        return AZ::Data::AssetManagerNotificationBus::Handler::BusIsConnected();
+    }
+
+    void AssetPrefetchRecorder::OnAssetLoadQueued(const AZ::Data::AssetId& assetId, [[maybe_unused]] const AZ::Data::AssetType& assetType,
+        AZStd::string_view streamName, AZ::u64 dataOffset, AZ::u64 dataLength)
+    {
+        if (dataLength == 0 || streamName.empty())
+        {
+            return;
+        }
+
+        AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+        if (m_recordedAssets.insert(assetId).second)
+        {
+            m_manifest.AddEntry({ assetId, AZStd::string(streamName), dataOffset, dataLength });
+        }
+    }
+
+    //=========================================================================
+    // AssetPrefetchReplayer
+    //=========================================================================
+    struct AssetPrefetchReplayer::ReplayState
+        : public AZStd::enable_shared_from_this<ReplayState>
+    {
+        AZ_CLASS_ALLOCATOR(ReplayState, AZ::SystemAllocator);
+
+        //! Queues reads until the number of bytes in flight reaches the maximum.
+        void QueueReads()
+        {
+            auto streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+            if (!streamer)
+            {
+                AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+                m_canceled = true;
+                return;
+            }
+
+            AZStd::vector<AZ::IO::FileRequestPtr> requests;
+            {
+                AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+                const AZStd::vector<AssetPrefetchManifest::Entry>& entries = m_manifest.GetEntries();
+                while (!m_canceled && m_nextEntry < entries.size() &&
+                    (m_bytesInFlight == 0 || m_bytesInFlight + entries[m_nextEntry].m_size <= m_maxBytesInFlight))
+                {
+                    const AssetPrefetchManifest::Entry& entry = entries[m_nextEntry++];
+                    AZ::IO::FileRequestPtr request = streamer->Read(entry.m_streamName, m_allocator, entry.m_size,
+                        AZ::IO::IStreamerTypes::s_noDeadline, AZ::IO::IStreamerTypes::s_priorityLowest, entry.m_offset);
+                    streamer->SetRequestCompleteCallback(request,
+                        [state = shared_from_this(), size = entry.m_size](AZ::IO::FileRequestHandle fileHandle)
+                        {
+                            state->OnReadComplete(fileHandle, size);
+                        });
+                    requests.push_back(AZStd::move(request));
+                    m_bytesInFlight += entry.m_size;
+                }
+            }
+
+            if (!requests.empty())
+            {
+                streamer->QueueRequestBatch(AZStd::move(requests));
+            }
+        }
+
+        void OnReadComplete(AZ::IO::FileRequestHandle fileHandle, AZ::u64 size)
+        {
+            // Only the side effect of reading the data is needed, so release the buffer right away instead of
+            // when the request is recycled, which can happen after the replay state is destroyed.
+            auto streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+            void* buffer = nullptr;
+            AZ::u64 bytesRead = 0;
+            if (streamer->GetReadRequestResult(fileHandle, buffer, bytesRead, AZ::IO::IStreamerTypes::ClaimMemory::Yes) && buffer)
+            {
+                m_allocator.Release(buffer);
+            }
+
+            {
+                AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+                m_bytesInFlight -= size;
+            }
+            QueueReads();
+        }
+
+        bool IsComplete()
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_mutex);
+            return m_bytesInFlight == 0 && (m_canceled || m_nextEntry == m_manifest.GetEntries().size());
+        }
+
+        AZStd::mutex m_mutex;
+        AssetPrefetchManifest m_manifest;
+        AZ::IO::IStreamerTypes::DefaultRequestMemoryAllocator m_allocator;
+        size_t m_nextEntry = 0;
+        AZ::u64 m_bytesInFlight = 0;
+        AZ::u64 m_maxBytesInFlight = 0;
+        bool m_canceled = false;
+    };
+
+    AssetPrefetchReplayer::~AssetPrefetchReplayer()
+    {
+        Cancel();
+    }
+
+    void AssetPrefetchReplayer::Start(AssetPrefetchManifest manifest, AZ::u64 maxBytesInFlight)
+    {
+        Cancel();
+
+        m_state = AZStd::make_shared<ReplayState>();
+        m_state->m_manifest = AZStd::move(manifest);
+        m_state->m_maxBytesInFlight = maxBytesInFlight;
+        m_state->QueueReads();
+    }
+
+    void AssetPrefetchReplayer::Cancel()
+    {
+        if (m_state)
+        {
+            AZStd::scoped_lock<AZStd::mutex> lock(m_state->m_mutex);
+            m_state->m_canceled = true;
+        }
+    }
+
+    bool AssetPrefetchReplayer::IsComplete() const
+    {
+        return !m_state || m_state->IsComplete();
+    }
+} // namespace AzFramework
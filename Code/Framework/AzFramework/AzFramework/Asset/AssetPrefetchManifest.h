@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    class SerializeContext;
+}
+
+namespace AzFramework
+{
+    //! The asset data reads of a play session, such as a level load, in the order they were queued.
+    //! Replaying the reads at the start of the next session turns the scattered reads of the asset loads into reads the
+    //! Streamer can schedule ahead of time, so the data is in the caches by the time the assets request it.
+    class AssetPrefetchManifest
+    {
+    public:
+        AZ_TYPE_INFO(AssetPrefetchManifest, "{0E5D6B5C-3F0B-4E43-9D55-0C3B8E0D6A21}");
+        AZ_CLASS_ALLOCATOR(AssetPrefetchManifest, AZ::SystemAllocator);
+
+        struct Entry
+        {
+            AZ_TYPE_INFO(AssetPrefetchManifest::Entry, "{6C1B6F0E-7A5D-4B8E-A3F4-2D9E5C7B1A08}");
+
+            AZ::Data::AssetId m_assetId;
+            AZStd::string m_streamName;
+            AZ::u64 m_offset = 0;
+            AZ::u64 m_size = 0;
+        };
+
+        static void ReflectSerialize(AZ::SerializeContext* serializeContext);
+
+        //! Saves the manifest as XML. The file path can contain aliases such as @user@.
+        bool Save(const AZStd::string& filePath, AZ::SerializeContext* serializeContext = nullptr) const;
+        //! Returns the manifest loaded from the file path, or nullptr if the file doesn't exist or isn't a manifest.
+        static AZStd::unique_ptr<AssetPrefetchManifest> Load(const AZStd::string& filePath, AZ::SerializeContext* serializeContext = nullptr);
+
+        const AZStd::vector<Entry>& GetEntries() const { return m_entries; }
+        void AddEntry(Entry entry) { m_entries.push_back(AZStd::move(entry)); }
+
+        //! Returns the total number of bytes the entries read.
+        AZ::u64 GetTotalSize() const;
+
+        static constexpr const char* FileExtension = "assetprefetch";
+
+    private:
+        AZStd::vector<Entry> m_entries;
+    };
+
+    //! Records the asset data reads that are queued with the AssetManager into a prefetch manifest.
+    //! Each read is recorded once, the first time it's queued.
+    class AssetPrefetchRecorder
+        : private AZ::Data::AssetManagerNotificationBus::Handler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(AssetPrefetchRecorder, AZ::SystemAllocator);
+
+        ~AssetPrefetchRecorder() override;
+
+        //! Starts recording into a new manifest, discarding anything that was recorded before.
+        void Start();
+        //! Stops recording and returns the recorded manifest.
+        AssetPrefetchManifest Stop();
+        bool IsRecording() const;
+
+    private:
+        // AssetManagerNotificationBus
+        void OnAssetLoadQueued(const AZ::Data::AssetId& assetId, const AZ::Data::AssetType& assetType,
+            AZStd::string_view streamName, AZ::u64 dataOffset, AZ::u64 dataLength) override;
+
+        mutable AZStd::mutex m_mutex;
+        AssetPrefetchManifest m_manifest;
+        AZStd::unordered_set<AZ::Data::AssetId> m_recordedAssets;
+    };
+
+    //! Replays the reads of a prefetch manifest as lowest priority Streamer requests without a deadline, so they never get in
+    //! the way of the reads the game waits on. The data that's read is discarded, the reads warm the Streamer and OS file caches.
+    //! The reads are queued in manifest order, and only up to a number of bytes is in flight at once to limit the memory use.
+    class AssetPrefetchReplayer
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(AssetPrefetchReplayer, AZ::SystemAllocator);
+
+        ~AssetPrefetchReplayer();
+
+        //! Starts replaying a manifest, canceling the reads of a previous replay that haven't been queued yet.
+        //! @param maxBytesInFlight number of bytes that can be read at once, a read larger than this is queued on its own
+        void Start(AssetPrefetchManifest manifest, AZ::u64 maxBytesInFlight);
+        //! Stops queueing reads. Reads that were already queued still complete.
+        void Cancel();
+        //! Returns true when all reads of the last replay completed or the replay was canceled.
+        bool IsComplete() const;
+
+    private:
+        struct ReplayState;
+        AZStd::shared_ptr<ReplayState> m_state;
+    };
+} // namespace AzFramework
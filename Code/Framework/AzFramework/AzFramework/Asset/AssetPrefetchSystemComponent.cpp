@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Asset/AssetPrefetchSystemComponent.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Serialization/SerializeContext.h>
+
+namespace AzFramework
+{
+    AZ_CVAR(bool, asset_prefetchRecord, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Records the asset data reads of every level load into the prefetch manifest of the level.");
+
+    AZ_CVAR(bool, asset_prefetchReplay, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Reads the data in the prefetch manifest of a level ahead of time when the level starts loading.");
+
+    AZ_CVAR(AZ::CVarFixedString, asset_prefetchManifestFolder, "@user@/AssetPrefetch", nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Folder that contains the prefetch manifests of the levels.");
+
+    AZ_CVAR(AZ::u64, asset_prefetchMaxBytesInFlight, 32 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Maximum number of bytes that prefetch reads can have in flight at once.");
+
+    void AssetPrefetchSystemComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<AssetPrefetchSystemComponent, AZ::Component>();
+            AssetPrefetchManifest::ReflectSerialize(serializeContext);
+        }
+    }
+
+    void AssetPrefetchSystemComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("AssetPrefetchService"));
+    }
+
+    void AssetPrefetchSystemComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("AssetPrefetchService"));
+    }
+
+    void AssetPrefetchSystemComponent::Activate()
+    {
+        LevelSystemLifecycleNotificationBus::Handler::BusConnect();
+    }
+
+    void AssetPrefetchSystemComponent::Deactivate()
+    {
+        LevelSystemLifecycleNotificationBus::Handler::BusDisconnect();
+        m_replayer.Cancel();
+        m_recorder.Stop();
+    }
+
+    AZStd::string AssetPrefetchSystemComponent::GetManifestPath(AZStd::string_view levelName)
+    {
+        // The spawnable level system names levels by the path of their asset, such as levels/mylevel/mylevel.spawnable
+        AZ::IO::Path manifestPath(static_cast<AZ::CVarFixedString>(asset_prefetchManifestFolder));
+        manifestPath /= AZ::IO::PathView(levelName).Stem();
+        manifestPath.ReplaceExtension(AssetPrefetchManifest::FileExtension);
+        return manifestPath.Native();
+    }
+
+    void AssetPrefetchSystemComponent::OnLoadingStart(const char* levelName)
+    {
+        if (asset_prefetchRecord)
+        {
+            m_recorder.Start();
+        }
+
+        if (asset_prefetchReplay)
+        {
+            const AZStd::string manifestPath = GetManifestPath(levelName);
+            if (auto fileIo = AZ::IO::FileIOBase::GetInstance(); fileIo && fileIo->Exists(manifestPath.c_str()))
+            {
+                if (AZStd::unique_ptr<AssetPrefetchManifest> manifest = AssetPrefetchManifest::Load(manifestPath))
+                {
+                    AZ_TracePrintf("AssetPrefetch", "Prefetching %zu assets (%llu bytes) for level %s.\n",
+                        manifest->GetEntries().size(), static_cast<unsigned long long>(manifest->GetTotalSize()), levelName);
+                    m_replayer.Start(AZStd::move(*manifest), asset_prefetchMaxBytesInFlight);
+                }
+                else
+                {
+                    AZ_Warning("AssetPrefetch", false, "Failed to load the prefetch manifest %s.", manifestPath.c_str());
+                }
+            }
+        }
+    }
+
+    void AssetPrefetchSystemComponent::OnLoadingComplete(const char* levelName)
+    {
+        if (!m_recorder.IsRecording())
+        {
+            return;
+        }
+
+        AssetPrefetchManifest manifest = m_recorder.Stop();
+        if (!manifest.GetEntries().empty())
+        {
+            const AZStd::string manifestPath = GetManifestPath(levelName);
+            if (manifest.Save(manifestPath))
+            {
+                AZ_TracePrintf("AssetPrefetch", "Recorded %zu assets (%llu bytes) for level %s into %s.\n",
+                    manifest.GetEntries().size(), static_cast<unsigned long long>(manifest.GetTotalSize()), levelName,
+                    manifestPath.c_str());
+            }
+            else
+            {
+                AZ_Warning("AssetPrefetch", false, "Failed to save the prefetch manifest %s.", manifestPath.c_str());
+            }
+        }
+    }
+
+    void AssetPrefetchSystemComponent::OnLoadingError([[maybe_unused]] const char* levelName, [[maybe_unused]] const char* error)
+    {
+        // Don't keep the reads of a level that failed to load
+        m_replayer.Cancel();
+        m_recorder.Stop();
+    }
+
+    void AssetPrefetchSystemComponent::OnUnloadComplete([[maybe_unused]] const char* levelName)
+    {
+        m_replayer.Cancel();
+    }
+} // namespace AzFramework
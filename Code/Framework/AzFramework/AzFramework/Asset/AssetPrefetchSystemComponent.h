@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzFramework/API/ApplicationAPI.h>
+#include <AzFramework/Asset/AssetPrefetchManifest.h>
+
+namespace AzFramework
+{
+    //! Records the asset data reads of level loads into prefetch manifests, and replays the manifest of a level as low priority
+    //! Streamer reads when the level starts loading.
+    //! Recording is enabled with the asset_prefetchRecord cvar, and the manifests are stored per level in the folder set by
+    //! asset_prefetchManifestFolder.
+    class AssetPrefetchSystemComponent final
+        : public AZ::Component
+        , private LevelSystemLifecycleNotificationBus::Handler
+    {
+    public:
+        AZ_COMPONENT(AssetPrefetchSystemComponent, "{3B7E2C91-5D4A-4F0E-8C6B-A1D2E3F40516}");
+
+        static void Reflect(AZ::ReflectContext* context);
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        // AZ::Component
+        void Activate() override;
+        void Deactivate() override;
+
+        //! Returns the path of the prefetch manifest of a level. Level names can be paths to the level asset.
+        static AZStd::string GetManifestPath(AZStd::string_view levelName);
+
+    private:
+        // LevelSystemLifecycleNotificationBus
+        void OnLoadingStart(const char* levelName) override;
+        void OnLoadingComplete(const char* levelName) override;
+        void OnLoadingError(const char* levelName, const char* error) override;
+        void OnUnloadComplete(const char* levelName) override;
+
+        AssetPrefetchRecorder m_recorder;
+        AssetPrefetchReplayer m_replayer;
+    };
+} // namespace AzFramework
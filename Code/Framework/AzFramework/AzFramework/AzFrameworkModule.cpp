@@ -9,6 +9,7 @@
 
 // Component includes
 #include <AzFramework/Asset/AssetCatalogComponent.h>
+#include <AzFramework/Asset/AssetPrefetchSystemComponent.h>
 #include <AzFramework/Asset/CustomAssetTypeComponent.h>
 #include <AzFramework/Asset/AssetSystemComponent.h>
 #include <AzFramework/Components/TransformComponent.h>
@@ -47,6 +48,7 @@ namespace AzFramework
             AzFramework::RenderGeometry::GameIntersectorComponent::CreateDescriptor(),
             AzFramework::CreateScriptDebugAgentFactory(),
             AzFramework::AssetSystem::AssetSystemComponent::CreateDescriptor(),
+            AzFramework::AssetPrefetchSystemComponent::CreateDescriptor(),
             AzFramework::InputSystemComponent::CreateDescriptor(),
             AzFramework::InputContextComponent::CreateDescriptor(),
             AzFramework::PaintBrushSystemComponent::CreateDescriptor(),
@@ -73,6 +75,7 @@ namespace AzFramework
             azrtti_typeid<AzFramework::OctreeSystemComponent>(),
             azrtti_typeid<AzFramework::QualitySystemComponent>(),
             azrtti_typeid<AzFramework::DeviceAttributesSystemComponent>(),
+            azrtti_typeid<AzFramework::AssetPrefetchSystemComponent>(),
         };
     }
 }
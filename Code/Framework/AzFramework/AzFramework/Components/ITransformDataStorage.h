@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/DenseComponentStorage.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/RTTI/RTTI.h>
+
+namespace AzFramework
+{
+    //! Keeps the world transforms of all active transform components in one contiguous array, so systems that process the
+    //! transforms of many entities every frame can iterate them directly instead of querying each entity.
+    //! Transform components write their world transform here whenever it changes, the component itself remains the way to
+    //! modify a transform. Only use this from the main thread.
+    class ITransformDataStorage
+    {
+    public:
+        AZ_RTTI(ITransformDataStorage, "{5A0E3C7B-9D21-4F86-B4E8-1C6F2A9D7E53}");
+
+        using Handle = AZ::DenseComponentStorage<AZ::Transform>::Handle;
+
+        //! Adds the world transform of an entity. Called by transform components when they activate.
+        virtual Handle AddWorldTM(AZ::EntityId entityId, const AZ::Transform& worldTM) = 0;
+        //! Removes a world transform. Called by transform components when they deactivate.
+        virtual void RemoveWorldTM(Handle handle) = 0;
+        //! Updates a world transform. Handles that are no longer valid are ignored.
+        virtual void SetWorldTM(Handle handle, const AZ::Transform& worldTM) = 0;
+
+        //! The world transforms of all active transform components. worldTMs[i] is the world transform of entityIds[i].
+        //! The order changes when transform components activate or deactivate, so the spans are only valid until then.
+        virtual AZStd::span<const AZ::EntityId> GetEntityIds() const = 0;
+        virtual AZStd::span<const AZ::Transform> GetWorldTMs() const = 0;
+
+    protected:
+        ~ITransformDataStorage() = default;
+    };
+} // namespace AzFramework
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/ComponentBus.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/span.h>
+
+namespace AzFramework
+{
+    //! Collects the world transforms that changed during a frame so they can be delivered to listeners in one batch.
+    //! Transform components report every change here, in addition to the per entity AZ::TransformNotificationBus.
+    class ITransformChangeBatch
+    {
+    public:
+        AZ_RTTI(ITransformChangeBatch, "{3C1F5D2E-7B0A-4E37-9A51-6A8E2C4D0B91}");
+
+        //! Records that the world transform of an entity changed. If the entity changed more than once since the last
+        //! flush, only its latest transform is delivered.
+        virtual void OnTransformUpdated(AZ::EntityId entityId, const AZ::Transform& worldTM) = 0;
+
+        //! Delivers all the changes recorded since the last flush to the TransformChangeBatchNotificationBus.
+        //! @note During normal operation this is called every frame in OnTick but can
+        //! also be called explicitly (e.g. For testing purposes).
+        virtual void FlushTransformChanges() = 0;
+
+    protected:
+        ~ITransformChangeBatch() = default;
+    };
+
+    //! Notifications for listeners that track the transforms of many entities, such as render or physics scenes.
+    //! Rather than connecting to the AZ::TransformNotificationBus of every entity, a listener receives all the world
+    //! transforms that changed during the frame as parallel arrays. Entities appear at most once per notification.
+    class TransformChangeBatchNotifications
+        : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+
+        virtual ~TransformChangeBatchNotifications() = default;
+
+        //! Called once per frame when any world transforms changed. worldTMs[i] is the new world transform of entityIds[i].
+        //! The spans are only valid for the duration of the call.
+        virtual void OnTransformsChanged(AZStd::span<const AZ::EntityId> entityIds, AZStd::span<const AZ::Transform> worldTMs) = 0;
+    };
+    using TransformChangeBatchNotificationBus = AZ::EBus<TransformChangeBatchNotifications>;
+} // namespace AzFramework
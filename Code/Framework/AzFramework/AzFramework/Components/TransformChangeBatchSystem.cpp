@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Components/TransformChangeBatchSystem.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+
+AZ_DECLARE_BUDGET(AzFramework);
+
+namespace AzFramework
+{
+    void TransformChangeBatchSystem::Connect()
+    {
+        AZ::Interface<ITransformChangeBatch>::Register(this);
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void TransformChangeBatchSystem::Disconnect()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+        AZ::Interface<ITransformChangeBatch>::Unregister(this);
+
+        m_dirtyEntityIds.clear();
+        m_dirtyWorldTMs.clear();
+        m_dirtyEntityIndices.clear();
+    }
+
+    void TransformChangeBatchSystem::OnTransformUpdated(AZ::EntityId entityId, const AZ::Transform& worldTM)
+    {
+        // nothing would consume the batch, so avoid the bookkeeping
+        if (!TransformChangeBatchNotificationBus::HasHandlers())
+        {
+            return;
+        }
+
+        if (auto [indexIt, inserted] = m_dirtyEntityIndices.emplace(entityId, m_dirtyEntityIds.size()); inserted)
+        {
+            m_dirtyEntityIds.push_back(entityId);
+            m_dirtyWorldTMs.push_back(worldTM);
+        }
+        else
+        {
+            m_dirtyWorldTMs[indexIt->second] = worldTM;
+        }
+    }
+
+    void TransformChangeBatchSystem::FlushTransformChanges()
+    {
+        AZ_PROFILE_FUNCTION(AzFramework);
+
+        if (m_dirtyEntityIds.empty())
+        {
+            return;
+        }
+
+        // swap the batch out first, listeners are allowed to move entities while handling the notification and those
+        // changes go into the next batch
+        AZStd::vector<AZ::EntityId> entityIds;
+        AZStd::vector<AZ::Transform> worldTMs;
+        entityIds.swap(m_dirtyEntityIds);
+        worldTMs.swap(m_dirtyWorldTMs);
+        m_dirtyEntityIndices.clear();
+
+        TransformChangeBatchNotificationBus::Broadcast(
+            &TransformChangeBatchNotificationBus::Events::OnTransformsChanged,
+            AZStd::span<const AZ::EntityId>(entityIds),
+            AZStd::span<const AZ::Transform>(worldTMs));
+
+        // hand the storage back to avoid reallocating it every frame
+        if (m_dirtyEntityIds.empty())
+        {
+            entityIds.clear();
+            worldTMs.clear();
+            m_dirtyEntityIds.swap(entityIds);
+            m_dirtyWorldTMs.swap(worldTMs);
+        }
+    }
+
+    void TransformChangeBatchSystem::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        FlushTransformChanges();
+    }
+
+    int TransformChangeBatchSystem::GetTickOrder()
+    {
+        // deliver after all gameplay, physics and attachment updates of the frame
+        return AZ::ComponentTickBus::TICK_LAST;
+    }
+} // namespace AzFramework
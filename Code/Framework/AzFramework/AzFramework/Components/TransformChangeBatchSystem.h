@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Components/TransformChangeBatchBus.h>
+
+namespace AzFramework
+{
+    //! Gathers the transform changes of a frame and delivers them to the TransformChangeBatchNotificationBus at the
+    //! end of the tick. Changes are only recorded while the bus has listeners.
+    class TransformChangeBatchSystem
+        : public ITransformChangeBatch
+        , private AZ::TickBus::Handler
+    {
+    public:
+        TransformChangeBatchSystem() = default;
+
+        void Connect();
+        void Disconnect();
+
+        // ITransformChangeBatch overrides ...
+        void OnTransformUpdated(AZ::EntityId entityId, const AZ::Transform& worldTM) override;
+        void FlushTransformChanges() override;
+
+    private:
+        // TickBus overrides ...
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
+        //! Dirty entities and their latest world transforms, kept as parallel arrays so they can be handed out as spans.
+        AZStd::vector<AZ::EntityId> m_dirtyEntityIds;
+        AZStd::vector<AZ::Transform> m_dirtyWorldTMs;
+        //! Index of each dirty entity in the arrays above.
+        AZStd::unordered_map<AZ::EntityId, size_t> m_dirtyEntityIndices;
+    };
+} // namespace AzFramework
@@ -7,6 +7,8 @@
  */
 
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/ITransformDataStorage.h>
+#include <AzFramework/Components/TransformChangeBatchBus.h>
 #include <AzFramework/Visibility/EntityBoundsUnionBus.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -152,6 +154,11 @@ namespace AzFramework
         AZ::TransformBus::Handler::BusConnect(m_entity->GetId());
         AZ::TransformNotificationBus::Bind(m_notificationBus, m_entity->GetId());
 
+        if (ITransformDataStorage* dataStorage = AZ::Interface<ITransformDataStorage>::Get())
+        {
+            m_worldTMStorageHandle = dataStorage->AddWorldTM(GetEntityId(), m_worldTM);
+        }
+
         const bool keepWorldTm = (m_parentActivationTransformMode == ParentActivationTransformMode::MaintainCurrentWorldTransform || !m_parentId.IsValid());
         SetParentImpl(m_parentId, keepWorldTm);
     }
@@ -173,6 +180,15 @@ namespace AzFramework
             AZ::EntityBus::Handler::BusDisconnect();
         }
         AZ::TransformBus::Handler::BusDisconnect();
+
+        if (m_worldTMStorageHandle.IsValid())
+        {
+            if (ITransformDataStorage* dataStorage = AZ::Interface<ITransformDataStorage>::Get())
+            {
+                dataStorage->RemoveWorldTM(m_worldTMStorageHandle);
+            }
+            m_worldTMStorageHandle = {};
+        }
     }
 
     void TransformComponent::BindTransformChangedEventHandler(AZ::TransformChangedEvent::Handler& handler)
@@ -589,9 +605,7 @@ namespace AzFramework
 
             if (oldParent.IsValid())
             {
-                AZ::TransformNotificationBus::Event(
-                    m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
-                m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+                NotifyTransformChanged();
             }
         }
 
@@ -637,9 +651,7 @@ namespace AzFramework
             if (m_onParentChangedBehavior == AZ::OnParentChangedBehavior::Update)
             {
                 m_worldTM = parentWorldTM * m_localTM;
-                AZ::TransformNotificationBus::Event(
-                    m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
-                m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+                NotifyTransformChanged();
             }
             else
             {
@@ -663,9 +675,7 @@ namespace AzFramework
             m_localTM = m_worldTM;
         }
 
-        AZ::TransformNotificationBus::Event(
-            m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
-        m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+        NotifyTransformChanged();
 
         AzFramework::IEntityBoundsUnion* boundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
         if (boundsUnion != nullptr)
@@ -685,9 +695,27 @@ namespace AzFramework
             m_worldTM = m_localTM;
         }
 
+        NotifyTransformChanged();
+    }
+
+    void TransformComponent::NotifyTransformChanged()
+    {
         AZ::TransformNotificationBus::Event(
             m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+
+        if (ITransformChangeBatch* changeBatch = AZ::Interface<ITransformChangeBatch>::Get())
+        {
+            changeBatch->OnTransformUpdated(GetEntityId(), m_worldTM);
+        }
+
+        if (m_worldTMStorageHandle.IsValid())
+        {
+            if (ITransformDataStorage* dataStorage = AZ::Interface<ITransformDataStorage>::Get())
+            {
+                dataStorage->SetWorldTM(m_worldTMStorageHandle, m_worldTM);
+            }
+        }
     }
 
     bool TransformComponent::AreMoveRequestsAllowed() const
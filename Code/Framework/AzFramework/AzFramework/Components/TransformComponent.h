@@ -13,6 +13,7 @@
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/EBus/Event.h>
+#include <AzFramework/Components/ITransformDataStorage.h>
 
 namespace AzToolsFramework
 {
@@ -162,6 +163,9 @@ namespace AzFramework
         void ComputeWorldTM();
         //////////////////////////////////////////////////////////////////////////
 
+        //! Sends the transform changed notifications and adds the new world transform to the frame's change batch.
+        void NotifyTransformChanged();
+
         //! Returns whether external calls are currently allowed to move the transform.
         bool AreMoveRequestsAllowed() const;
 
@@ -180,6 +184,7 @@ namespace AzFramework
 
         AZ::Transform m_localTM = AZ::Transform::CreateIdentity(); ///< Local transform relative to parent transform (same as worldTM if no parent).
         AZ::Transform m_worldTM = AZ::Transform::CreateIdentity(); ///< World transform including parent transform (same as localTM if no parent).
+        ITransformDataStorage::Handle m_worldTMStorageHandle; ///< Location of the world transform in the transform data storage while active.
 
         AZ::EntityId m_parentId; ///< If valid, this transform is parented to m_parentId.
         AZ::TransformInterface* m_parentTM = nullptr; ///< Cached - pointer to parent transform, to avoid extra calls. Valid only when if it's present.
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Components/TransformDataStorageSystem.h>
+
+#include <AzCore/Interface/Interface.h>
+
+namespace AzFramework
+{
+    void TransformDataStorageSystem::Connect()
+    {
+        AZ::Interface<ITransformDataStorage>::Register(this);
+    }
+
+    void TransformDataStorageSystem::Disconnect()
+    {
+        AZ::Interface<ITransformDataStorage>::Unregister(this);
+
+        // transform components that are still active hold handles that are invalidated here, so if they deactivate
+        // after the storage is connected again their handles are ignored
+        m_worldTMs.Clear();
+    }
+
+    auto TransformDataStorageSystem::AddWorldTM(AZ::EntityId entityId, const AZ::Transform& worldTM) -> Handle
+    {
+        return m_worldTMs.Add(entityId, worldTM);
+    }
+
+    void TransformDataStorageSystem::RemoveWorldTM(Handle handle)
+    {
+        m_worldTMs.Remove(handle);
+    }
+
+    void TransformDataStorageSystem::SetWorldTM(Handle handle, const AZ::Transform& worldTM)
+    {
+        if (AZ::Transform* storedWorldTM = m_worldTMs.Find(handle))
+        {
+            *storedWorldTM = worldTM;
+        }
+    }
+
+    AZStd::span<const AZ::EntityId> TransformDataStorageSystem::GetEntityIds() const
+    {
+        return m_worldTMs.GetEntityIds();
+    }
+
+    AZStd::span<const AZ::Transform> TransformDataStorageSystem::GetWorldTMs() const
+    {
+        return m_worldTMs.GetData();
+    }
+} // namespace AzFramework
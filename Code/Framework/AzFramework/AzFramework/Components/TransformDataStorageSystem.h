@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzFramework/Components/ITransformDataStorage.h>
+
+namespace AzFramework
+{
+    //! Stores the world transforms of the transform components that activate while it's connected.
+    class TransformDataStorageSystem
+        : public ITransformDataStorage
+    {
+    public:
+        TransformDataStorageSystem() = default;
+
+        void Connect();
+        void Disconnect();
+
+        // ITransformDataStorage overrides ...
+        Handle AddWorldTM(AZ::EntityId entityId, const AZ::Transform& worldTM) override;
+        void RemoveWorldTM(Handle handle) override;
+        void SetWorldTM(Handle handle, const AZ::Transform& worldTM) override;
+        AZStd::span<const AZ::EntityId> GetEntityIds() const override;
+        AZStd::span<const AZ::Transform> GetWorldTMs() const override;
+
+    private:
+        AZ::DenseComponentStorage<AZ::Transform> m_worldTMs;
+    };
+} // namespace AzFramework
@@ -20,6 +20,30 @@ namespace AZ::DocumentPropertyEditor
     }
 
     void RowAggregateAdapter::AddAdapter(DocumentAdapterPtr sourceAdapter)
+    {
+        ConnectAdapter(sourceAdapter);
+        PopulateNodesForAdapter(m_adapters.size() - 1);
+        NotifyResetDocument();
+    }
+
+    void RowAggregateAdapter::AddAdapters(const AZStd::vector<DocumentAdapterPtr>& sourceAdapters)
+    {
+        if (sourceAdapters.empty())
+        {
+            return;
+        }
+
+        // every reset makes the views regenerate the whole aggregate document, so only reset once all the adapters are in
+        m_adapters.reserve(m_adapters.size() + sourceAdapters.size());
+        for (const auto& sourceAdapter : sourceAdapters)
+        {
+            ConnectAdapter(sourceAdapter);
+            PopulateNodesForAdapter(m_adapters.size() - 1);
+        }
+        NotifyResetDocument();
+    }
+
+    void RowAggregateAdapter::ConnectAdapter(DocumentAdapterPtr sourceAdapter)
     {
         // capture the actual adapter, not just the index, as adding or removing adapters could change the index
         auto& newAdapterInfo = m_adapters.emplace_back(AZStd::make_unique<AdapterInfo>());
@@ -45,10 +69,6 @@ namespace AZ::DocumentPropertyEditor
                 this->HandleDomMessage(sourceAdapter, message, value);
             });
         sourceAdapter->ConnectMessageHandler(newAdapterInfo->domMessageHandler);
-
-        const auto adapterIndex = m_adapters.size() - 1;
-        PopulateNodesForAdapter(adapterIndex);
-        NotifyResetDocument();
     }
 
     void RowAggregateAdapter::RemoveAdapter(DocumentAdapterPtr sourceAdapter)
@@ -386,8 +406,70 @@ namespace AZ::DocumentPropertyEditor
         }
 
         if (outgoingPatch.Size())
+        {
+            NotifyOrCoalesceContentsChanged(outgoingPatch);
+        }
+    }
+
+    static bool PathsOverlap(const Dom::Path& lhs, const Dom::Path& rhs)
+    {
+        for (size_t entryIndex = 0, numEntries = AZStd::min(lhs.Size(), rhs.Size()); entryIndex < numEntries; ++entryIndex)
+        {
+            // end of array entries could refer to any index, so assume they overlap
+            if (lhs[entryIndex].IsEndOfArray() || rhs[entryIndex].IsEndOfArray())
+            {
+                return true;
+            }
+            if (!(lhs[entryIndex] == rhs[entryIndex]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void RowAggregateAdapter::NotifyOrCoalesceContentsChanged(const Dom::Patch& outgoingPatch)
+    {
+        if (m_coalescePatchesDepth == 0)
         {
             NotifyContentsChanged(outgoingPatch);
+            return;
+        }
+
+        for (const auto& operation : outgoingPatch)
+        {
+            // an edit forwarded to every adapter typically replaces the same aggregate row once per adapter, so replace the
+            // earlier operation in place if nothing queued after it touches the same path. Only the last value is needed,
+            // as aggregate rows are generated from the current state of all the adapters
+            bool replacedEarlierOperation = false;
+            if (operation.GetType() == Dom::PatchOperation::Type::Replace)
+            {
+                const auto& destinationPath = operation.GetDestinationPath();
+                for (size_t queuedIndex = m_coalescedPatch.Size(); queuedIndex > 0; --queuedIndex)
+                {
+                    auto& queuedOperation = m_coalescedPatch[queuedIndex - 1];
+                    const auto queuedType = queuedOperation.GetType();
+                    if (queuedType != Dom::PatchOperation::Type::Replace && queuedType != Dom::PatchOperation::Type::Add &&
+                        queuedType != Dom::PatchOperation::Type::Remove)
+                    {
+                        break;
+                    }
+                    if (PathsOverlap(queuedOperation.GetDestinationPath(), destinationPath))
+                    {
+                        if (queuedType == Dom::PatchOperation::Type::Replace && queuedOperation.GetDestinationPath() == destinationPath)
+                        {
+                            queuedOperation = operation;
+                            replacedEarlierOperation = true;
+                        }
+                        break;
+                    }
+                }
+            }
+
+            if (!replacedEarlierOperation)
+            {
+                m_coalescedPatch.PushBack(operation);
+            }
         }
     }
 
@@ -905,7 +987,9 @@ namespace AZ::DocumentPropertyEditor
             const auto messagesToForward = GetMessagesToForward();
             if (AZStd::find(messagesToForward.begin(), messagesToForward.end(), message.m_messageName) != messagesToForward.end())
             {
-                // it's a forwarded message, we need to look up the original handler for each adapter and call them individually
+                // it's a forwarded message, we need to look up the original handler for each adapter and call them individually.
+                // Each adapter reports its own change, so gather those into a single patch for the views
+                ++m_coalescePatchesDepth;
                 for (size_t adapterIndex = 0, numAdapters = m_adapters.size(); adapterIndex < numAdapters; ++adapterIndex)
                 {
                     auto attributePath = messageNode->GetPathForAdapter(adapterIndex) / originalColumn / message.m_messageName;
@@ -961,6 +1045,13 @@ namespace AZ::DocumentPropertyEditor
                     };
                     messageResult = invokeDomValueFunction(attributeValue, invokeDomValueFunction);
                 }
+
+                if (--m_coalescePatchesDepth == 0 && m_coalescedPatch.Size())
+                {
+                    Dom::Patch coalescedPatch = AZStd::move(m_coalescedPatch);
+                    m_coalescedPatch.Clear();
+                    NotifyContentsChanged(coalescedPatch);
+                }
             }
         }
         else
@@ -23,6 +23,10 @@ namespace AZ::DocumentPropertyEditor
         virtual ~RowAggregateAdapter();
 
         void AddAdapter(DocumentAdapterPtr sourceAdapter);
+
+        //! adds several adapters at once, resetting the aggregate document only once after all of them have been added,
+        //! instead of once per adapter as repeated calls to AddAdapter would
+        void AddAdapters(const AZStd::vector<DocumentAdapterPtr>& sourceAdapters);
         void RemoveAdapter(DocumentAdapterPtr sourceAdapter);
         void ClearAdapters();
 
@@ -142,6 +146,12 @@ namespace AZ::DocumentPropertyEditor
 
         static void RemoveChildRows(Dom::Value& rowValue);
 
+        //! connects the handlers for a new source adapter and adds it to m_adapters, without populating its nodes
+        void ConnectAdapter(DocumentAdapterPtr sourceAdapter);
+
+        //! sends the outgoing patch of a source adapter change, or adds it to m_coalescedPatch while forwarding a message
+        void NotifyOrCoalesceContentsChanged(const Dom::Patch& outgoingPatch);
+
         struct AdapterInfo
         {
             DocumentAdapter::ResetEvent::Handler resetHandler;
@@ -160,6 +170,10 @@ namespace AZ::DocumentPropertyEditor
         unsigned int m_updateFrame = 0;
         bool m_generateDiffRows = true;
         AdapterBuilder m_builder;
+
+        //! while a message is forwarded to every source adapter, their resulting changes are gathered here and sent as one patch
+        Dom::Patch m_coalescedPatch;
+        int m_coalescePatchesDepth = 0;
     };
 
     class LabeledRowAggregateAdapter : public RowAggregateAdapter
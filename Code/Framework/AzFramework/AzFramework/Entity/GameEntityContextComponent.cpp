@@ -100,6 +100,8 @@ namespace AzFramework
         GameEntityContextRequestBus::Handler::BusConnect();
 
         m_entityVisibilityBoundsUnionSystem.Connect();
+        m_transformChangeBatchSystem.Connect();
+        m_transformDataStorageSystem.Connect();
     }
 
     //=========================================================================
@@ -107,6 +109,8 @@ namespace AzFramework
     //=========================================================================
     void GameEntityContextComponent::Deactivate()
     {
+        m_transformDataStorageSystem.Disconnect();
+        m_transformChangeBatchSystem.Disconnect();
         m_entityVisibilityBoundsUnionSystem.Disconnect();
 
         GameEntityContextRequestBus::Handler::BusDisconnect();
@@ -14,6 +14,8 @@
 #include <AzCore/Component/Component.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Entity/SliceGameEntityOwnershipService.h>
+#include <AzFramework/Components/TransformChangeBatchSystem.h>
+#include <AzFramework/Components/TransformDataStorageSystem.h>
 #include <AzFramework/Visibility/EntityVisibilityBoundsUnionSystem.h>
 
 #include "EntityContext.h"
@@ -92,6 +94,8 @@ namespace AzFramework
     private:
 
         AzFramework::EntityVisibilityBoundsUnionSystem m_entityVisibilityBoundsUnionSystem;
+        AzFramework::TransformChangeBatchSystem m_transformChangeBatchSystem;
+        AzFramework::TransformDataStorageSystem m_transformDataStorageSystem;
     };
 } // namespace AzFramework
 
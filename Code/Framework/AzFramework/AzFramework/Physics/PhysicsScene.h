@@ -140,6 +140,7 @@ namespace AzPhysics
         virtual bool QueryScene(SceneHandle sceneHandle, const SceneQueryRequest* request, SceneQueryHits& result) = 0;
 
         //! Make many blocking queries into the scene.
+        //! The filter callbacks of the requests may be called from worker threads, see Scene::QuerySceneBatch.
         //! @param sceneHandle A handle to the scene to make the scene query with.
         //! @param requests A list of requests to make. Each entry should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
         //! @return Returns a list of SceneQueryHits. Will be in the same order as supplied in SceneQueryRequests.
@@ -358,6 +359,9 @@ namespace AzPhysics
         virtual bool QueryScene(const SceneQueryRequest* request, SceneQueryHits& result) = 0;
 
         //! Make many blocking queries into the scene.
+        //! Implementations may execute the requests in parallel (see physx_parallelSceneQueryBatch), in which case the filter
+        //! callbacks of the requests are called from worker threads and must be thread safe. The call still only returns
+        //! once every request is complete.
         //! @param requests A list of requests to make. Each entry should be one of RayCastRequest || ShapeCastRequest || OverlapRequest
         //! @return Returns a list of SceneQueryHits. Will be in the same order as supplied in SceneQueryRequests.
         virtual SceneQueryHitsList QuerySceneBatch(const SceneQueryRequests& requests) = 0;
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Asset/AssetSerializer.h>
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/numeric.h>
@@ -408,9 +409,57 @@ namespace AzFramework
 
     Spawnable::EntityList& Spawnable::GetEntities()
     {
+        // The entities can be changed through the returned list, so the spawn template needs to be rebuilt.
+        m_hasSpawnTemplate.store(false, AZStd::memory_order_release);
         return m_entities;
     }
 
+    auto Spawnable::GetSpawnTemplate(AZ::SerializeContext& serializeContext) const -> const SpawnTemplate&
+    {
+        if (m_hasSpawnTemplate.load(AZStd::memory_order_acquire))
+        {
+            return m_spawnTemplate;
+        }
+
+        AZStd::scoped_lock lock(m_spawnTemplateMutex);
+        if (!m_hasSpawnTemplate.load(AZStd::memory_order_relaxed))
+        {
+            const AZ::Uuid& entityIdType = azrtti_typeid<AZ::EntityId>();
+            auto& componentsWithEntityIds = m_spawnTemplate.m_componentsWithEntityIds;
+            componentsWithEntityIds.clear();
+            componentsWithEntityIds.resize(m_entities.size());
+            auto& entityIndices = m_spawnTemplate.m_entityIndices;
+            entityIndices.clear();
+            entityIndices.reserve(m_entities.size());
+            for (size_t entityIndex = 0; entityIndex < m_entities.size(); ++entityIndex)
+            {
+                entityIndices.emplace(m_entities[entityIndex]->GetId(), aznumeric_caster(entityIndex));
+
+                const AZ::Entity::ComponentArrayType& components = m_entities[entityIndex]->GetComponents();
+                for (uint32_t componentIndex = 0; componentIndex < components.size(); ++componentIndex)
+                {
+                    bool hasEntityIds = false;
+                    auto beginElementCB = [&hasEntityIds, &entityIdType](
+                        void*, const AZ::SerializeContext::ClassData* classData, const AZ::SerializeContext::ClassElement*)
+                    {
+                        hasEntityIds = hasEntityIds || classData->m_typeId == entityIdType;
+                        // Stop descending once an entity id was found
+                        return !hasEntityIds;
+                    };
+                    const AZ::Component* component = components[componentIndex];
+                    serializeContext.EnumerateInstanceConst(component, AZ::SerializeTypeInfo<AZ::Component>::GetUuid(component),
+                        beginElementCB, nullptr, AZ::SerializeContext::ENUM_ACCESS_FOR_READ, nullptr, nullptr);
+                    if (hasEntityIds)
+                    {
+                        componentsWithEntityIds[entityIndex].push_back(componentIndex);
+                    }
+                }
+            }
+            m_hasSpawnTemplate.store(true, AZStd::memory_order_release);
+        }
+        return m_spawnTemplate;
+    }
+
     auto Spawnable::TryGetAliasesConst() const -> EntityAliasConstVisitor
     {
         int32_t expected = ShareState::NotShared;
@@ -453,16 +502,27 @@ namespace AzFramework
         return m_metaData;
     }
 
+    bool Spawnable::IsPoolable() const
+    {
+        return m_poolable;
+    }
+
+    void Spawnable::SetPoolable(bool poolable)
+    {
+        m_poolable = poolable;
+    }
+
     void Spawnable::Reflect(AZ::ReflectContext* context)
     {
         EntityAlias::Reflect(context);
 
         if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
         {
-            serializeContext->Class<Spawnable, AZ::Data::AssetData>()->Version(2)
+            serializeContext->Class<Spawnable, AZ::Data::AssetData>()->Version(3)
                 ->Field("Meta data", &Spawnable::m_metaData)
                 ->Field("Entity aliases", &Spawnable::m_entityAliases)
-                ->Field("Entities", &Spawnable::m_entities);
+                ->Field("Entities", &Spawnable::m_entities)
+                ->Field("Poolable", &Spawnable::m_poolable);
         }
     }
 
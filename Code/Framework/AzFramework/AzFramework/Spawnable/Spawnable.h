@@ -12,6 +12,8 @@
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzFramework/Spawnable/SpawnableMetaData.h>
@@ -19,6 +21,7 @@
 namespace AZ
 {
     class ReflectContext;
+    class SerializeContext;
 }
 
 namespace AzFramework
@@ -69,6 +72,16 @@ namespace AzFramework
         using EntityList = AZStd::vector<AZStd::unique_ptr<AZ::Entity>>;
         using EntityAliasList = AZStd::vector<EntityAlias>;
 
+        //! Information derived from the entities that's the same for every instance that's spawned from them.
+        struct SpawnTemplate
+        {
+            //! For each entity, the indices of its components that contain entity ids. Only these components need to have their
+            //! entity ids remapped after cloning, the other components can be used as cloned.
+            AZStd::vector<AZStd::vector<uint32_t>> m_componentsWithEntityIds;
+            //! The index of every entity by its id, so ids that are referenced can be converted to an index in the entity list.
+            AZStd::unordered_map<AZ::EntityId, uint32_t> m_entityIndices;
+        };
+
         class EntityAliasConstVisitor
         {
         protected:
@@ -162,6 +175,10 @@ namespace AzFramework
 
         const EntityList& GetEntities() const;
         EntityList& GetEntities();
+        //! Returns the spawn template of the entities, which is built the first time it's requested.
+        //! Getting mutable access to the entities discards the template, so use the const version of GetEntities for reading.
+        const SpawnTemplate& GetSpawnTemplate(AZ::SerializeContext& serializeContext) const;
+
         EntityAliasConstVisitor TryGetAliasesConst() const;
         EntityAliasConstVisitor TryGetAliases() const;
         EntityAliasVisitor TryGetAliases();
@@ -170,6 +187,11 @@ namespace AzFramework
         SpawnableMetaData& GetMetaData();
         const SpawnableMetaData& GetMetaData() const;
 
+        //! Poolable spawnables keep the entities that are despawned with DespawnAllEntities in the ticket that spawned them, and reuse
+        //! them the next time the ticket spawns all entities instead of cloning new ones. Spawnables with aliases are never pooled.
+        bool IsPoolable() const;
+        void SetPoolable(bool poolable);
+
         static void Reflect(AZ::ReflectContext* context);
 
     private:
@@ -180,8 +202,13 @@ namespace AzFramework
         // Container for keeping all entities of the prefab the Spawnable was created from.
         // Includes both direct and nested entities of the prefab.
         EntityList m_entities;
+        bool m_poolable{ false };
 
         mutable AZStd::atomic<int32_t> m_shareState{ ShareState::NotShared };
+
+        mutable SpawnTemplate m_spawnTemplate;
+        mutable AZStd::mutex m_spawnTemplateMutex;
+        mutable AZStd::atomic_bool m_hasSpawnTemplate{ false };
     };
 
     using SpawnableAsset = AZ::Data::Asset<AzFramework::Spawnable>;
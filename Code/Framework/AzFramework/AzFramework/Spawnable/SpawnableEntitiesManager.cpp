@@ -8,9 +8,11 @@
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/IdUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Components/TransformComponent.h>
@@ -20,6 +22,46 @@
 
 namespace AzFramework
 {
+    AZ_CVAR(uint32_t, sp_parallelInitMinEntities, 256, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Minimum number of entities a spawn call needs to create before the components with a thread safe Init are initialized in "
+        "parallel tasks. Set to 0 to always initialize the components on the main thread.");
+
+    namespace SpawnableEntitiesManagerInternal
+    {
+        //! Remaps the entity ids in the components of an entity that contain entity ids, producing the same result as
+        //! IdUtils::Remapper::GenerateNewIdsAndFixRefs for the whole entity. The ids that are replaced by newly generated ids are
+        //! remapped first and then the references to ids, so references can point to ids that are replaced later in the entity.
+        //! @param getComponent returns the component of the entity for an index in componentsWithEntityIds.
+        template<typename GetComponent>
+        void RemapComponentEntityIds(
+            const AZStd::vector<uint32_t>& componentsWithEntityIds,
+            GetComponent&& getComponent,
+            SpawnableEntitiesManager::EntityIdMap& prototypeToCloneMap,
+            AZ::SerializeContext& serializeContext)
+        {
+            using Remapper = AZ::IdUtils::Remapper<AZ::EntityId>;
+            auto idMapper = [&prototypeToCloneMap](
+                const AZ::EntityId& originalId, bool replaceId, const Remapper::IdGenerator& idGenerator) -> AZ::EntityId
+            {
+                if (replaceId)
+                {
+                    // If the same ID gets remapped more than once, preserve the original remapping instead of overwriting it.
+                    return idGenerator ? prototypeToCloneMap.emplace(originalId, idGenerator()).first->second : originalId;
+                }
+                auto findIt = prototypeToCloneMap.find(originalId);
+                return findIt != prototypeToCloneMap.end() ? findIt->second : originalId;
+            };
+
+            for (bool replaceIds : { true, false })
+            {
+                for (uint32_t componentIndex : componentsWithEntityIds)
+                {
+                    Remapper::RemapIds(getComponent(componentIndex), idMapper, &serializeContext, replaceIds);
+                }
+            }
+        }
+    } // namespace SpawnableEntitiesManagerInternal
+
     template<typename T>
     void SpawnableEntitiesManager::QueueRequest(EntitySpawnTicket& ticket, SpawnablePriority priority, T&& request)
     {
@@ -44,6 +86,10 @@ namespace AzFramework
             AZ::u64 value = aznumeric_caster(m_highPriorityThreshold);
             settingsRegistry->Get(value, "/O3DE/AzFramework/Spawnables/HighPriorityThreshold");
             m_highPriorityThreshold = aznumeric_cast<SpawnablePriority>(AZStd::clamp(value, 0llu, 255llu));
+
+            AZ::u64 frameBudget = aznumeric_caster(m_frameBudget.count());
+            settingsRegistry->Get(frameBudget, "/O3DE/AzFramework/Spawnables/FrameBudgetUs");
+            m_frameBudget = AZStd::chrono::microseconds(frameBudget);
         }
     }
 
@@ -62,6 +108,12 @@ namespace AzFramework
             optionalArgs.m_serializeContext == nullptr ? m_defaultSerializeContext : optionalArgs.m_serializeContext;
         queueEntry.m_completionCallback = AZStd::move(optionalArgs.m_completionCallback);
         queueEntry.m_preInsertionCallback = AZStd::move(optionalArgs.m_preInsertionCallback);
+        queueEntry.m_spawnedEntitiesInitialCount = 0;
+        queueEntry.m_nextAliasIndex = 0;
+        queueEntry.m_nextInsertionIndex = 0;
+        queueEntry.m_nextEntityIndex = 0;
+        queueEntry.m_isStarted = false;
+        queueEntry.m_areEntitiesCloned = false;
         QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
     }
 
@@ -222,14 +274,34 @@ namespace AzFramework
         }
         if ((priority & CommandQueuePriority::Regular) == CommandQueuePriority::Regular)
         {
+            // Only regular priority requests are limited by the frame budget, high priority requests such as those coming from the
+            // network need to be completed right away.
+            m_isFrameBudgetActive = m_frameBudget.count() > 0;
+            m_frameBudgetDeadline = AZStd::chrono::steady_clock::now() + m_frameBudget;
             if (ProcessQueue(m_regularPriorityQueue) == CommandQueueStatus::HasCommandsLeft)
             {
                 result = CommandQueueStatus::HasCommandsLeft;
             }
+            m_isFrameBudgetActive = false;
         }
         return result;
     }
 
+    void SpawnableEntitiesManager::SetFrameBudget(AZStd::chrono::microseconds budget)
+    {
+        m_frameBudget = budget;
+    }
+
+    AZStd::chrono::microseconds SpawnableEntitiesManager::GetFrameBudget() const
+    {
+        return m_frameBudget;
+    }
+
+    bool SpawnableEntitiesManager::IsFrameBudgetExhausted() const
+    {
+        return m_isFrameBudgetActive && AZStd::chrono::steady_clock::now() >= m_frameBudgetDeadline;
+    }
+
     auto SpawnableEntitiesManager::ProcessQueue(Queue& queue) -> CommandQueueStatus
     {
         // Process delayed requests first.
@@ -249,6 +321,12 @@ namespace AzFramework
                 queue.m_delayed.emplace_back(AZStd::move(request));
             }
             queue.m_delayed.pop_front();
+
+            // The remaining delayed requests stay at the front of the queue so they're the first to be processed in the next call.
+            if (IsFrameBudgetExhausted())
+            {
+                return CommandQueueStatus::HasCommandsLeft;
+            }
         }
 
         // Process newly added requests.
@@ -276,6 +354,18 @@ namespace AzFramework
                         queue.m_delayed.emplace_back(AZStd::move(request));
                     }
                     pendingRequestQueue.pop();
+
+                    if (IsFrameBudgetExhausted())
+                    {
+                        // Requests on a ticket are executed in the order of their request id, so moving the requests that haven't
+                        // been processed yet to the delayed requests doesn't change the order they're executed in.
+                        while (!pendingRequestQueue.empty())
+                        {
+                            queue.m_delayed.emplace_back(AZStd::move(pendingRequestQueue.front()));
+                            pendingRequestQueue.pop();
+                        }
+                        return CommandQueueStatus::HasCommandsLeft;
+                    }
                 }
             }
             else
@@ -352,6 +442,34 @@ namespace AzFramework
             &entityPrototype, prototypeToCloneMap, &serializeContext);
     }
 
+    AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(
+        const AZ::Entity& entityPrototype,
+        const AZStd::vector<uint32_t>& componentsWithEntityIds,
+        EntityIdMap& prototypeToCloneMap,
+        AZ::SerializeContext& serializeContext)
+    {
+        AZ::Entity* clone = serializeContext.CloneObject(&entityPrototype);
+        if (!clone)
+        {
+            return nullptr;
+        }
+
+        // This produces the same result as CloneSingleEntity without walking the components that don't have entity ids. The id of the
+        // entity is set directly, and only the components that contain entity ids get their ids remapped.
+        clone->SetId(prototypeToCloneMap.emplace(entityPrototype.GetId(), AZ::Entity::MakeId()).first->second);
+
+        const AZ::Entity::ComponentArrayType& components = clone->GetComponents();
+        SpawnableEntitiesManagerInternal::RemapComponentEntityIds(
+            componentsWithEntityIds,
+            [&components](uint32_t componentIndex)
+            {
+                return components[componentIndex];
+            },
+            prototypeToCloneMap, serializeContext);
+
+        return clone;
+    }
+
     AZ::Entity* SpawnableEntitiesManager::CloneSingleAliasedEntity(
         const AZ::Entity& entityPrototype,
         const Spawnable::EntityAlias& alias,
@@ -360,6 +478,12 @@ namespace AzFramework
         AZ::SerializeContext& serializeContext)
     {
         AZ::Entity* clone = nullptr;
+        // Read the target entity through a const spawnable, as mutable access to the entities discards the spawn template.
+        auto targetEntity = [&alias]() -> const AZ::Entity&
+        {
+            const Spawnable& target = *alias.m_spawnable;
+            return *target.GetEntities()[alias.m_targetIndex];
+        };
         switch (alias.m_aliasType)
         {
         case Spawnable::EntityAliasType::Original:
@@ -371,20 +495,19 @@ namespace AzFramework
             // Do nothing.
             return nullptr;
         case Spawnable::EntityAliasType::Replace:
-            clone = CloneSingleEntity(*(alias.m_spawnable->GetEntities()[alias.m_targetIndex]), prototypeToCloneMap, serializeContext);
+            clone = CloneSingleEntity(targetEntity(), prototypeToCloneMap, serializeContext);
             AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
             return clone;
         case Spawnable::EntityAliasType::Additional:
             // The asset handler will have sorted and inserted a Spawnable::EntityAliasType::Original, so the just
             // spawn the additional entity.
-            clone = CloneSingleEntity(*(alias.m_spawnable->GetEntities()[alias.m_targetIndex]), prototypeToCloneMap, serializeContext);
+            clone = CloneSingleEntity(targetEntity(), prototypeToCloneMap, serializeContext);
             AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
             return clone;
         case Spawnable::EntityAliasType::Merge:
             AZ_Assert(previouslySpawnedEntity != nullptr, "Merging components but there's no entity to add to yet.");
             AppendComponents(
-                *previouslySpawnedEntity, alias.m_spawnable->GetEntities()[alias.m_targetIndex]->GetComponents(), prototypeToCloneMap,
-                serializeContext);
+                *previouslySpawnedEntity, targetEntity().GetComponents(), prototypeToCloneMap, serializeContext);
             return nullptr;
         default:
             AZ_Assert(false, "Unsupported spawnable entity alias type: %i", alias.m_aliasType);
@@ -392,55 +515,194 @@ namespace AzFramework
         }
     }
 
-    void SpawnableEntitiesManager::AppendComponents(
-        AZ::Entity& target,
-        const AZ::Entity::ComponentArrayType& componentPrototypes,
-        EntityIdMap& prototypeToCloneMap,
-        AZ::SerializeContext& serializeContext)
+    bool SpawnableEntitiesManager::CanPoolEntities(const Ticket& ticket) const
     {
-        // Only components are added and entities are looked up so no duplicate entity ids should be encountered.
-        constexpr bool allowDuplicateIds = false;
+        if (!ticket.m_spawnable.IsReady())
+        {
+            return false;
+        }
 
-        for (const AZ::Component* component : componentPrototypes)
+        const Spawnable& spawnable = *ticket.m_spawnable;
+        if (!spawnable.IsPoolable())
         {
-            AZ::Component* clone = AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::CloneObjectAndGenerateNewIdsAndFixRefs(
-                component, prototypeToCloneMap, &serializeContext);
-            AZ_Assert(clone, "Unable to clone component for entity '%s' (%zu).", target.GetName().c_str(), target.GetId());
-            [[maybe_unused]] bool result = target.AddComponent(clone);
-            AZ_Assert(result, "Unable to add cloned component to entity '%s' (%zu).", target.GetName().c_str(), target.GetId());
+            return false;
         }
+
+        // The prototype index of an aliased entity doesn't identify the entity it was cloned from, so spawnables with aliases aren't
+        // pooled.
+        Spawnable::EntityAliasConstVisitor aliases = spawnable.TryGetAliasesConst();
+        return aliases.IsValid() && aliases.begin() == aliases.end();
     }
 
-    void SpawnableEntitiesManager::InitializeEntityIdMappings(
-        const Spawnable::EntityList& entities, EntityIdMap& idMap, AZStd::unordered_set<AZ::EntityId>& previouslySpawned)
+    bool SpawnableEntitiesManager::ReturnEntityToPool(Ticket& ticket, AZ::Entity& entity, uint32_t prototypeIndex)
     {
-        // Make sure we don't have any previous data lingering around.
-        idMap.clear();
-        previouslySpawned.clear();
+        if (entity.GetState() == AZ::Entity::State::Active)
+        {
+            GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::DeactivateGameEntity, entity.GetId());
+        }
 
-        idMap.reserve(entities.size());
-        previouslySpawned.reserve(entities.size());
+        // Entities that are still changing state, or that never got added to the game entity context, can't be reused safely.
+        if (entity.GetState() != AZ::Entity::State::Init)
+        {
+            return false;
+        }
 
-        for (auto& entity : entities)
+        if (prototypeIndex >= ticket.m_entityPool.size())
         {
-            idMap.emplace(entity->GetId(), AZ::Entity::MakeId());
+            ticket.m_entityPool.resize(prototypeIndex + 1);
         }
+        ticket.m_entityPool[prototypeIndex].push_back(&entity);
+        return true;
     }
 
-    void SpawnableEntitiesManager::RefreshEntityIdMapping(
-        const AZ::EntityId& entityId, EntityIdMap& idMap, AZStd::unordered_set<AZ::EntityId>& previouslySpawned)
+    AZ::Entity* SpawnableEntitiesManager::TakeEntityFromPool(Ticket& ticket, const AZ::Entity& entityPrototype, uint32_t prototypeIndex)
     {
-        if (previouslySpawned.contains(entityId))
+        if (prototypeIndex >= ticket.m_entityPool.size())
         {
-            // This entity has already been spawned at least once before, so we need to generate a new id for it and
-            // preserve the new id to fix up any future entity references to this entity.
-            idMap[entityId] = AZ::Entity::MakeId();
+            return nullptr;
         }
-        else
+
+        AZStd::vector<AZ::Entity*>& pool = ticket.m_entityPool[prototypeIndex];
+        while (!pool.empty())
         {
-            // This entity hasn't been spawned yet, so use the first id we've already generated for this entity and mark
-            // it as spawned so we know not to reuse this id next time.
-            previouslySpawned.emplace(entityId);
+            AZ::Entity* entity = pool.back();
+            pool.pop_back();
+
+            // Components could have been added or removed while the entity was spawned, in which case it no longer matches its
+            // prototype. Components are matched by id because the component order changes when the entity is initialized.
+            const AZ::Entity::ComponentArrayType& prototypeComponents = entityPrototype.GetComponents();
+            bool isMatch = entity->GetComponents().size() == prototypeComponents.size();
+            for (size_t i = 0; isMatch && i < prototypeComponents.size(); ++i)
+            {
+                const AZ::Component* component = entity->FindComponent(prototypeComponents[i]->GetId());
+                isMatch = component && azrtti_typeid(component) == azrtti_typeid(prototypeComponents[i]);
+            }
+
+            if (isMatch)
+            {
+                return entity;
+            }
+
+            // Setting it to 0 is needed to avoid the infinite loop between GameEntityContext and SpawnableEntitiesManager.
+            entity->SetEntitySpawnTicketId(0);
+            GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::DestroyGameEntity, entity->GetId());
+        }
+        return nullptr;
+    }
+
+    void SpawnableEntitiesManager::ResetPooledEntity(
+        AZ::Entity& entity,
+        const AZ::Entity& entityPrototype,
+        const AZStd::vector<uint32_t>& componentsWithEntityIds,
+        EntityIdMap& prototypeToCloneMap,
+        AZ::SerializeContext& serializeContext)
+    {
+        if (entity.GetName() != entityPrototype.GetName())
+        {
+            entity.SetName(entityPrototype.GetName());
+        }
+        entity.SetRuntimeActiveByDefault(entityPrototype.IsRuntimeActiveByDefault());
+
+        // Cloning in place over the used components would keep whatever their containers and owned objects gathered while they were
+        // spawned, so each component is replaced by a fresh clone of its prototype. The swap keeps the component id and position, and
+        // initializes the new component because the pooled entity is still initialized.
+        const AZ::Entity::ComponentArrayType& prototypeComponents = entityPrototype.GetComponents();
+        for (const AZ::Component* prototypeComponent : prototypeComponents)
+        {
+            AZ::Component* usedComponent = entity.FindComponent(prototypeComponent->GetId());
+            AZ::Component* freshComponent = serializeContext.CloneObject(prototypeComponent);
+            if (entity.SwapComponents(usedComponent, freshComponent))
+            {
+                delete usedComponent;
+            }
+            else
+            {
+                AZ_Assert(false, "Unable to replace component %s on pooled entity '%s'.", usedComponent->RTTI_GetTypeName(),
+                    entity.GetName().c_str());
+                delete freshComponent;
+            }
+        }
+
+        // The entity keeps its id, which was already added to the id map, so only the ids in the components need to be remapped.
+        SpawnableEntitiesManagerInternal::RemapComponentEntityIds(
+            componentsWithEntityIds,
+            [&entity, &prototypeComponents](uint32_t componentIndex)
+            {
+                return entity.FindComponent(prototypeComponents[componentIndex]->GetId());
+            },
+            prototypeToCloneMap, serializeContext);
+    }
+
+    void SpawnableEntitiesManager::DestroyPooledEntities(Ticket& ticket)
+    {
+        for (AZStd::vector<AZ::Entity*>& pool : ticket.m_entityPool)
+        {
+            for (AZ::Entity* entity : pool)
+            {
+                // Setting it to 0 is needed to avoid the infinite loop between GameEntityContext and SpawnableEntitiesManager.
+                entity->SetEntitySpawnTicketId(0);
+                GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::DestroyGameEntity, entity->GetId());
+            }
+        }
+        ticket.m_entityPool.clear();
+    }
+
+    void SpawnableEntitiesManager::InitThreadSafeComponents(SpawnableEntityContainerView entities)
+    {
+        constexpr size_t EntitiesPerTask = 64;
+
+        const size_t entityCount = entities.size();
+        const uint32_t minEntities = sp_parallelInitMinEntities;
+        AZ::TaskGraphActiveInterface* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (minEntities == 0 || entityCount < minEntities || !taskGraphActive ||
+            !taskGraphActive->IsTaskGraphActive())
+        {
+            return;
+        }
+
+        static const AZ::TaskDescriptor initTaskDescriptor{ "SpawnableEntitiesManager::InitThreadSafeComponents", "Spawnables" };
+        AZ::TaskGraph taskGraph{ "SpawnableEntitiesManager::InitThreadSafeComponents" };
+        for (size_t begin = 0; begin < entityCount; begin += EntitiesPerTask)
+        {
+            AZ::Entity** batchBegin = entities.begin() + begin;
+            AZ::Entity** batchEnd = entities.begin() + AZStd::min(begin + EntitiesPerTask, entityCount);
+            taskGraph.AddTask(
+                initTaskDescriptor,
+                [batchBegin, batchEnd]()
+                {
+                    for (AZ::Entity** it = batchBegin; it != batchEnd; ++it)
+                    {
+                        // Entities taken from a pool have already been initialized.
+                        if (*it && (*it)->GetState() == AZ::Entity::State::Constructed)
+                        {
+                            (*it)->InitThreadSafeComponents();
+                        }
+                    }
+                });
+        }
+
+        // The rest of the initialization and the activation happen on this thread when the entities are added to the game context.
+        AZ::TaskGraphEvent finishedEvent{ "SpawnableEntitiesManager::InitThreadSafeComponents Wait" };
+        taskGraph.Submit(&finishedEvent);
+        finishedEvent.Wait();
+    }
+
+    void SpawnableEntitiesManager::AppendComponents(
+        AZ::Entity& target,
+        const AZ::Entity::ComponentArrayType& componentPrototypes,
+        EntityIdMap& prototypeToCloneMap,
+        AZ::SerializeContext& serializeContext)
+    {
+        // Only components are added and entities are looked up so no duplicate entity ids should be encountered.
+        constexpr bool allowDuplicateIds = false;
+
+        for (const AZ::Component* component : componentPrototypes)
+        {
+            AZ::Component* clone = AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::CloneObjectAndGenerateNewIdsAndFixRefs(
+                component, prototypeToCloneMap, &serializeContext);
+            AZ_Assert(clone, "Unable to clone component for entity '%s' (%zu).", target.GetName().c_str(), target.GetId());
+            [[maybe_unused]] bool result = target.AddComponent(clone);
+            AZ_Assert(result, "Unable to add cloned component to entity '%s' (%zu).", target.GetName().c_str(), target.GetId());
         }
     }
 
@@ -455,94 +717,172 @@ namespace AzFramework
                 AZStd::vector<AZ::Entity*>& spawnedEntities = ticket.m_spawnedEntities;
                 AZStd::vector<uint32_t>& spawnedEntityIndices = ticket.m_spawnedEntityIndices;
 
-                // Keep track how many entities there were in the array initially
-                size_t spawnedEntitiesInitialCount = spawnedEntities.size();
-
                 // These are 'prototype' entities we'll be cloning from
-                const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
+                // These are read through a const spawnable, as mutable access to the entities discards the spawn template.
+                const Spawnable& spawnable = *ticket.m_spawnable;
+                const Spawnable::EntityList& entitiesToSpawn = spawnable.GetEntities();
                 uint32_t entitiesToSpawnSize = aznumeric_caster(entitiesToSpawn.size());
-
-                // Reserve buffers
-                spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
-                spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
-
-                // Pre-generate the full set of entity-id-to-new-entity-id mappings, so that during the clone operation below,
-                // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
-                // We clear out and regenerate the set of IDs on every SpawnAllEntities call, because presumably every entity reference
-                // in every entity we're about to instantiate is intended to point to an entity in our newly-instantiated batch, regardless
-                // of spawn order.  If we didn't clear out the map, it would be possible for some entities here to have references to
-                // previously-spawned entities from a previous SpawnEntities or SpawnAllEntities call.
-                InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                const Spawnable::SpawnTemplate& spawnTemplate = spawnable.GetSpawnTemplate(*request.m_serializeContext);
 
                 auto aliasIt = aliases.begin();
                 auto aliasEnd = aliases.end();
-                if (aliasIt == aliasEnd)
+
+                if (!request.m_isStarted)
                 {
-                    for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
-                    {
-                        // If this entity has previously been spawned, give it a new id in the reference map
-                        RefreshEntityIdMapping(
-                            entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                    // Keep track how many entities there were in the array initially
+                    request.m_spawnedEntitiesInitialCount = spawnedEntities.size();
+
+                    // Reserve buffers
+                    spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
+                    spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
 
-                        spawnedEntities.emplace_back(
-                            CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
-                        spawnedEntityIndices.push_back(i);
+                    // Pre-generate the full set of entity-id-to-new-entity-id mappings, so that during the clone operation below,
+                    // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
+                    // We clear out and regenerate the set of IDs on every SpawnAllEntities call, because presumably every entity reference
+                    // in every entity we're about to instantiate is intended to point to an entity in our newly-instantiated batch, regardless
+                    // of spawn order.  If we didn't clear out the map, it would be possible for some entities here to have references to
+                    // previously-spawned entities from a previous SpawnEntities or SpawnAllEntities call.
+                    ticket.m_entityIdReferenceMap.Initialize(entitiesToSpawn, spawnTemplate);
+
+                    // Entities taken from the pool keep their id, so the prototypes are mapped to them before any entity is spawned.
+                    // This way references to a pooled entity are remapped correctly regardless of the spawn order.
+                    if (aliasIt == aliasEnd && !ticket.m_entityPool.empty())
+                    {
+                        request.m_pooledEntities.resize(entitiesToSpawnSize, nullptr);
+                        for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
+                        {
+                            if (AZ::Entity* pooledEntity = TakeEntityFromPool(ticket, *entitiesToSpawn[i], i))
+                            {
+                                ticket.m_entityIdReferenceMap.Assign(i, pooledEntity->GetId());
+                                request.m_pooledEntities[i] = pooledEntity;
+                            }
+                        }
                     }
+
+                    request.m_isStarted = true;
                 }
-                else
+
+                if (!request.m_areEntitiesCloned)
                 {
-                    for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
+                    if (aliasIt == aliasEnd)
                     {
-                        // If this entity has previously been spawned, give it a new id in the reference map
-                        RefreshEntityIdMapping(
-                            entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
-
-                        if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != i)
+                        const AZStd::vector<AZ::Entity*>& pooledEntities = request.m_pooledEntities;
+                        for (uint32_t i = request.m_nextEntityIndex; i < entitiesToSpawnSize; ++i)
                         {
-                            spawnedEntities.emplace_back(
-                                CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
-                            spawnedEntityIndices.push_back(i);
+                            if (!pooledEntities.empty() && pooledEntities[i])
+                            {
+                                ResetPooledEntity(
+                                    *pooledEntities[i], *entitiesToSpawn[i], spawnTemplate.m_componentsWithEntityIds[i],
+                                    ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                                spawnedEntities.emplace_back(pooledEntities[i]);
+                                spawnedEntityIndices.push_back(i);
+                            }
+                            else
+                            {
+                                // If this entity has previously been spawned, give it a new id in the reference map
+                                ticket.m_entityIdReferenceMap.Refresh(i);
+
+                                spawnedEntities.emplace_back(CloneSingleEntity(
+                                    *entitiesToSpawn[i], spawnTemplate.m_componentsWithEntityIds[i], ticket.m_entityIdReferenceMap,
+                                    *request.m_serializeContext));
+                                spawnedEntityIndices.push_back(i);
+                            }
+
+                            if (i + 1 < entitiesToSpawnSize && IsFrameBudgetExhausted())
+                            {
+                                request.m_nextEntityIndex = i + 1;
+                                return CommandResult::Requeue;
+                            }
                         }
-                        else
+                    }
+                    else
+                    {
+                        aliasIt += request.m_nextAliasIndex;
+                        for (uint32_t i = request.m_nextEntityIndex; i < entitiesToSpawnSize; ++i)
                         {
-                            // The list of entities has already been sorted and optimized (See SpawnableEntitiesAliasList:Optimize) so can
-                            // be safely executed in order without risking an invalid state.
-                            AZ::Entity* previousEntity = nullptr;
-                            do
+                            // If this entity has previously been spawned, give it a new id in the reference map
+                            ticket.m_entityIdReferenceMap.Refresh(i);
+
+                            if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != i)
+                            {
+                                spawnedEntities.emplace_back(CloneSingleEntity(
+                                    *entitiesToSpawn[i], spawnTemplate.m_componentsWithEntityIds[i], ticket.m_entityIdReferenceMap,
+                                    *request.m_serializeContext));
+                                spawnedEntityIndices.push_back(i);
+                            }
+                            else
                             {
-                                AZ::Entity* clone = CloneSingleAliasedEntity(
-                                    *entitiesToSpawn[i], *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
-                                    *request.m_serializeContext);
-                                previousEntity = clone;
-                                if (clone)
+                                // The list of entities has already been sorted and optimized (See SpawnableEntitiesAliasList:Optimize) so can
+                                // be safely executed in order without risking an invalid state.
+                                AZ::Entity* previousEntity = nullptr;
+                                do
                                 {
-                                    spawnedEntities.emplace_back(clone);
-                                    spawnedEntityIndices.push_back(i);
-                                }
-                                ++aliasIt;
-                            } while (aliasIt != aliasEnd && aliasIt->m_sourceIndex == i);
+                                    AZ::Entity* clone = CloneSingleAliasedEntity(
+                                        *entitiesToSpawn[i], *aliasIt, ticket.m_entityIdReferenceMap, previousEntity,
+                                        *request.m_serializeContext);
+                                    previousEntity = clone;
+                                    if (clone)
+                                    {
+                                        spawnedEntities.emplace_back(clone);
+                                        spawnedEntityIndices.push_back(i);
+                                    }
+                                    ++aliasIt;
+                                } while (aliasIt != aliasEnd && aliasIt->m_sourceIndex == i);
+                            }
+
+                            if (i + 1 < entitiesToSpawnSize && IsFrameBudgetExhausted())
+                            {
+                                request.m_nextEntityIndex = i + 1;
+                                request.m_nextAliasIndex = AZStd::distance(aliases.begin(), aliasIt);
+                                return CommandResult::Requeue;
+                            }
                         }
                     }
-                }
 
-                // There were no initial entities then the ticket now holds exactly all entities. If there were already entities then
-                // a new set are not added so it no longer holds exactly the number of entities.
-                ticket.m_loadAll = spawnedEntitiesInitialCount == 0;
+                    // There were no initial entities then the ticket now holds exactly all entities. If there were already entities then
+                    // a new set are not added so it no longer holds exactly the number of entities.
+                    ticket.m_loadAll = request.m_spawnedEntitiesInitialCount == 0;
+                    request.m_pooledEntities = {};
+                    request.m_areEntitiesCloned = true;
 
-                auto newEntitiesBegin = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount;
-                auto newEntitiesEnd = ticket.m_spawnedEntities.end();
-                // Let other systems know about newly spawned entities for any pre-processing before adding to the scene/game context.
-                if (request.m_preInsertionCallback)
-                {
-                    request.m_preInsertionCallback(request.m_ticketId, SpawnableEntityContainerView(newEntitiesBegin, newEntitiesEnd));
+                    auto newEntitiesBegin = ticket.m_spawnedEntities.begin() + request.m_spawnedEntitiesInitialCount;
+                    auto newEntitiesEnd = ticket.m_spawnedEntities.end();
+                    // Let other systems know about newly spawned entities for any pre-processing before adding to the scene/game context.
+                    if (request.m_preInsertionCallback)
+                    {
+                        request.m_preInsertionCallback(request.m_ticketId, SpawnableEntityContainerView(newEntitiesBegin, newEntitiesEnd));
+                    }
+
+                    InitThreadSafeComponents(SpawnableEntityContainerView(newEntitiesBegin, newEntitiesEnd));
                 }
 
+                auto newEntitiesBegin = ticket.m_spawnedEntities.begin() + request.m_spawnedEntitiesInitialCount;
+                auto newEntitiesEnd = ticket.m_spawnedEntities.end();
+
                 // Add to the game context, now the entities are active
-                for (auto it = newEntitiesBegin; it != newEntitiesEnd; ++it)
+                for (auto it = newEntitiesBegin + request.m_nextInsertionIndex; it != newEntitiesEnd; ++it)
                 {
                     AZ::Entity* clone = (*it);
                     clone->SetEntitySpawnTicketId(request.m_ticketId);
-                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
+                    if (clone->GetState() == AZ::Entity::State::Init)
+                    {
+                        // Entities from the pool are still in the game context, so they only need to be activated.
+                        if (clone->IsRuntimeActiveByDefault())
+                        {
+                            GameEntityContextRequestBus::Broadcast(
+                                &GameEntityContextRequestBus::Events::ActivateGameEntity, clone->GetId());
+                        }
+                    }
+                    else
+                    {
+                        GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, clone);
+                    }
+
+                    if (it + 1 != newEntitiesEnd && IsFrameBudgetExhausted())
+                    {
+                        request.m_nextInsertionIndex = AZStd::distance(newEntitiesBegin, it + 1);
+                        return CommandResult::Requeue;
+                    }
                 }
 
                 // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
@@ -576,8 +916,10 @@ namespace AzFramework
                 size_t spawnedEntitiesInitialCount = spawnedEntities.size();
 
                 // These are 'prototype' entities we'll be cloning from
-                const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
+                const Spawnable& spawnable = *ticket.m_spawnable;
+                const Spawnable::EntityList& entitiesToSpawn = spawnable.GetEntities();
                 size_t entitiesToSpawnSize = request.m_entityIndices.size();
+                const Spawnable::SpawnTemplate& spawnTemplate = spawnable.GetSpawnTemplate(*request.m_serializeContext);
 
                 if (ticket.m_entityIdReferenceMap.empty() || !request.m_referencePreviouslySpawnedEntities)
                 {
@@ -589,7 +931,7 @@ namespace AzFramework
                     // that reference fixups work even when the entity being referenced is spawned in a different SpawnEntities
                     // (or SpawnAllEntities) call.
                     // However, the caller can also choose to reset the map by passing in "m_referencePreviouslySpawnedEntities = false".
-                    InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                    ticket.m_entityIdReferenceMap.Initialize(entitiesToSpawn, spawnTemplate);
                 }
 
                 spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
@@ -604,11 +946,11 @@ namespace AzFramework
                         if (index < entitiesToSpawn.size())
                         {
                             // If this entity has previously been spawned, give it a new id in the reference map
-                            RefreshEntityIdMapping(
-                                entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                            ticket.m_entityIdReferenceMap.Refresh(index);
 
-                            spawnedEntities.push_back(
-                                CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                            spawnedEntities.push_back(CloneSingleEntity(
+                                *entitiesToSpawn[index], spawnTemplate.m_componentsWithEntityIds[index], ticket.m_entityIdReferenceMap,
+                                *request.m_serializeContext));
                             spawnedEntityIndices.push_back(index);
                         }
                     }
@@ -620,8 +962,7 @@ namespace AzFramework
                         if (index < entitiesToSpawn.size())
                         {
                             // If this entity has previously been spawned, give it a new id in the reference map
-                            RefreshEntityIdMapping(
-                                entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                            ticket.m_entityIdReferenceMap.Refresh(index);
 
                             auto aliasIt = AZStd::lower_bound(
                                 aliasBegin, aliasEnd, index,
@@ -632,8 +973,9 @@ namespace AzFramework
 
                             if (aliasIt == aliasEnd || aliasIt->m_sourceIndex != index)
                             {
-                                spawnedEntities.emplace_back(
-                                    CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext));
+                                spawnedEntities.emplace_back(CloneSingleEntity(
+                                    *entitiesToSpawn[index], spawnTemplate.m_componentsWithEntityIds[index],
+                                    ticket.m_entityIdReferenceMap, *request.m_serializeContext));
                                 spawnedEntityIndices.push_back(index);
                             }
                             else
@@ -670,6 +1012,9 @@ namespace AzFramework
                             ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
                 }
 
+                InitThreadSafeComponents(SpawnableEntityContainerView(
+                    ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
+
                 // Add to the game context, now the entities are active
                 for (auto it = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount; it != ticket.m_spawnedEntities.end(); ++it)
                 {
@@ -698,10 +1043,17 @@ namespace AzFramework
         Ticket& ticket = *request.m_ticket;
         if (request.m_requestId == ticket.m_currentRequestId)
         {
-            for (AZ::Entity* entity : ticket.m_spawnedEntities)
+            const bool poolEntities = CanPoolEntities(ticket);
+            for (size_t i = 0; i < ticket.m_spawnedEntities.size(); ++i)
             {
+                AZ::Entity* entity = ticket.m_spawnedEntities[i];
                 if (entity != nullptr)
                 {
+                    if (poolEntities && ReturnEntityToPool(ticket, *entity, ticket.m_spawnedEntityIndices[i]))
+                    {
+                        continue;
+                    }
+
                     // Setting it to 0 is needed to avoid the infinite loop between GameEntityContext and SpawnableEntitiesManager.
                     entity->SetEntitySpawnTicketId(0);
                     GameEntityContextRequestBus::Broadcast(
@@ -732,20 +1084,48 @@ namespace AzFramework
         if (request.m_requestId == ticket.m_currentRequestId)
         {
             AZStd::vector<AZ::Entity*>& spawnedEntities = request.m_ticket->m_spawnedEntities;
-            for (auto entityIterator = spawnedEntities.begin(); entityIterator != spawnedEntities.end(); ++entityIterator)
+            AZStd::vector<uint32_t>& spawnedEntityIndices = request.m_ticket->m_spawnedEntityIndices;
+            bool isFound = false;
+            for (size_t i = 0; i < spawnedEntities.size(); ++i)
             {
-                if (*entityIterator != nullptr && (*entityIterator)->GetId() == request.m_entityId)
+                if (spawnedEntities[i] != nullptr && spawnedEntities[i]->GetId() == request.m_entityId)
                 {
                     // Setting it to 0 is needed to avoid the infinite loop between GameEntityContext and SpawnableEntitiesManager.
-                    (*entityIterator)->SetEntitySpawnTicketId(0);
+                    spawnedEntities[i]->SetEntitySpawnTicketId(0);
                     GameEntityContextRequestBus::Broadcast(
-                        &GameEntityContextRequestBus::Events::DestroyGameEntity, (*entityIterator)->GetId());
-                    AZStd::iter_swap(entityIterator, spawnedEntities.rbegin());
+                        &GameEntityContextRequestBus::Events::DestroyGameEntity, spawnedEntities[i]->GetId());
+                    // Keep the indices in sync with the entities, as they identify the prototype of each entity.
+                    AZStd::swap(spawnedEntities[i], spawnedEntities.back());
                     spawnedEntities.pop_back();
+                    if (i < spawnedEntityIndices.size())
+                    {
+                        AZStd::swap(spawnedEntityIndices[i], spawnedEntityIndices.back());
+                        spawnedEntityIndices.pop_back();
+                    }
+                    isFound = true;
                     break;
                 }
             }
 
+            // Pooled entities are still in the game entity context, so they can be destroyed through it as well.
+            for (auto poolIt = ticket.m_entityPool.begin(); !isFound && poolIt != ticket.m_entityPool.end(); ++poolIt)
+            {
+                auto entityIt = AZStd::find_if(
+                    poolIt->begin(), poolIt->end(),
+                    [&request](const AZ::Entity* entity)
+                    {
+                        return entity->GetId() == request.m_entityId;
+                    });
+                if (entityIt != poolIt->end())
+                {
+                    // Setting it to 0 is needed to avoid the infinite loop between GameEntityContext and SpawnableEntitiesManager.
+                    (*entityIt)->SetEntitySpawnTicketId(0);
+                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::DestroyGameEntity, request.m_entityId);
+                    poolIt->erase(entityIt);
+                    isFound = true;
+                }
+            }
+
             if (request.m_completionCallback)
             {
                 request.m_completionCallback(request.m_ticketId);
@@ -779,16 +1159,20 @@ namespace AzFramework
                         &GameEntityContextRequestBus::Events::DestroyGameEntity, entity->GetId());
                 }
             }
+            // The pooled entities were spawned from the previous version of the spawnable.
+            DestroyPooledEntities(ticket);
 
             // Rebuild the list of entities.
             ticket.m_spawnedEntities.clear();
-            const Spawnable::EntityList& entities = request.m_spawnable->GetEntities();
+            const Spawnable& spawnable = *request.m_spawnable;
+            const Spawnable::EntityList& entities = spawnable.GetEntities();
+            const Spawnable::SpawnTemplate& spawnTemplate = spawnable.GetSpawnTemplate(*request.m_serializeContext);
 
             // Pre-generate the full set of entity id to new entity id mappings, so that during the clone operation below,
             // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
             // This map is intentionally cleared out and regenerated here to ensure that we're starting fresh with mappings that
             // match the new set of prototype entities getting spawned.
-            InitializeEntityIdMappings(entities, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+            ticket.m_entityIdReferenceMap.Initialize(entities, spawnTemplate);
 
             if (ticket.m_loadAll)
             {
@@ -800,9 +1184,10 @@ namespace AzFramework
                 for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
                 {
                     // If this entity has previously been spawned, give it a new id in the reference map
-                    RefreshEntityIdMapping(entities[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                    ticket.m_entityIdReferenceMap.Refresh(i);
 
-                    AZ::Entity* clone = CloneSingleEntity(*entities[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                    AZ::Entity* clone = CloneSingleEntity(
+                        *entities[i], spawnTemplate.m_componentsWithEntityIds[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
                     AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
 
                     ticket.m_spawnedEntities.push_back(clone);
@@ -821,9 +1206,11 @@ namespace AzFramework
                     if (index < entitiesSize)
                     {
                         // If this entity has previously been spawned, give it a new id in the reference map
-                        RefreshEntityIdMapping(entities[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                        ticket.m_entityIdReferenceMap.Refresh(index);
 
-                        AZ::Entity* clone = CloneSingleEntity(*entities[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
+                        AZ::Entity* clone = CloneSingleEntity(
+                            *entities[index], spawnTemplate.m_componentsWithEntityIds[index], ticket.m_entityIdReferenceMap,
+                            *request.m_serializeContext);
                         AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
                         ticket.m_spawnedEntities.push_back(clone);
                     }
@@ -1045,6 +1432,7 @@ namespace AzFramework
                         &GameEntityContextRequestBus::Events::DestroyGameEntity, entity->GetId());
                 }
             }
+            DestroyPooledEntities(*request.m_ticket);
 
             m_entitySpawnTicketMap.erase(request.m_ticket->m_ticketId);
 
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/limits.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/deque.h>
@@ -17,6 +18,7 @@
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
+#include <AzFramework/Spawnable/SpawnableEntityIdMap.h>
 
 namespace AZ
 {
@@ -33,7 +35,7 @@ namespace AzFramework
         AZ_RTTI(AzFramework::SpawnableEntitiesManager, "{6E14333F-128C-464C-94CA-A63B05A5E51C}");
         AZ_CLASS_ALLOCATOR(SpawnableEntitiesManager, AZ::SystemAllocator);
 
-        using EntityIdMap = AZStd::unordered_map<AZ::EntityId, AZ::EntityId>;
+        using EntityIdMap = SpawnableEntityIdMap;
         
         enum class CommandQueueStatus : bool
         {
@@ -88,6 +90,13 @@ namespace AzFramework
 
         CommandQueueStatus ProcessQueue(CommandQueuePriority priority);
 
+        //! Sets the maximum time a call to ProcessQueue spends on regular priority requests. Requests that are still waiting once the
+        //! budget is used up are processed in the next call, and large SpawnAllEntities requests are split across multiple calls.
+        //! High priority requests are always fully processed. A budget of zero disables the limit.
+        //! The starting value can be configured through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/FrameBudgetUs".
+        void SetFrameBudget(AZStd::chrono::microseconds budget);
+        AZStd::chrono::microseconds GetFrameBudget() const;
+
     protected:
         enum class CommandResult : bool
         {
@@ -112,13 +121,15 @@ namespace AzFramework
             //!   spawn the entity.
             //! Note that this implies a certain level of non-determinism when spawning across calls, because the entity references
             //! will be based on the order in which the SpawnEntity calls occur, which can be affected by things like priority.
+            //! The map also keeps track of whether or not each entity has been spawned at least once, so it knows whether or not to
+            //! replace the id when spawning a new instance of that entity.
             EntityIdMap m_entityIdReferenceMap;
-            //! For this to work, we also need to keep track of whether or not each entity has been spawned at least once, so we know
-            //! whether or not to replace the id in the map when spawning a new instance of that entity.
-            AZStd::unordered_set<AZ::EntityId> m_previouslySpawned;
 
             AZStd::vector<AZ::Entity*> m_spawnedEntities;
             AZStd::vector<uint32_t> m_spawnedEntityIndices;
+            //! Deactivated entities of a poolable spawnable that were despawned with DespawnAllEntities, stored per index of the
+            //! prototype entity they were spawned from. The entities are still owned by the game entity context.
+            AZStd::vector<AZStd::vector<AZ::Entity*>> m_entityPool;
             AZ::Data::Asset<Spawnable> m_spawnable;
             uint32_t m_nextRequestId{ 0 }; //!< Next id to be handed out to command that's using this ticket..
             uint32_t m_currentRequestId { 0 }; //!< The id for the command that should be executed.
@@ -134,6 +145,17 @@ namespace AzFramework
             Ticket* m_ticket;
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
+
+            //! Progress of a request that ran out of frame budget and continues in a later call to ProcessQueue.
+            //! Entities are first all cloned, then all added to the game context, so the pre-insertion and completion callbacks
+            //! still see the full set of spawned entities.
+            AZStd::vector<AZ::Entity*> m_pooledEntities; //!< Entities taken from the pool, stored per prototype index.
+            size_t m_spawnedEntitiesInitialCount; //!< Number of entities the ticket held before this request.
+            size_t m_nextAliasIndex;
+            size_t m_nextInsertionIndex;
+            uint32_t m_nextEntityIndex;
+            bool m_isStarted;
+            bool m_areEntitiesCloned;
         };
         struct SpawnEntitiesCommand final
         {
@@ -263,9 +285,17 @@ namespace AzFramework
         const AZ::Data::Asset<Spawnable>& GetSpawnableOnTicket(void* ticket) override;
         
         CommandQueueStatus ProcessQueue(Queue& queue);
+        //! Returns true if a frame budget is being applied to the queue that's being processed and it has been used up.
+        bool IsFrameBudgetExhausted() const;
 
         AZ::Entity* CloneSingleEntity(
             const AZ::Entity& entityPrototype, EntityIdMap& prototypeToCloneMap, AZ::SerializeContext& serializeContext);
+        //! Clones an entity and only remaps the entity ids of the listed components, see Spawnable::SpawnTemplate.
+        AZ::Entity* CloneSingleEntity(
+            const AZ::Entity& entityPrototype,
+            const AZStd::vector<uint32_t>& componentsWithEntityIds,
+            EntityIdMap& prototypeToCloneMap,
+            AZ::SerializeContext& serializeContext);
         AZ::Entity* CloneSingleAliasedEntity(
             const AZ::Entity& entityPrototype,
             const Spawnable::EntityAlias& alias,
@@ -277,6 +307,25 @@ namespace AzFramework
             const AZ::Entity::ComponentArrayType& componentPrototypes,
             EntityIdMap& prototypeToCloneMap,
             AZ::SerializeContext& serializeContext);
+
+        //! Returns true if the entities of the ticket can be returned to its entity pool when they're despawned.
+        bool CanPoolEntities(const Ticket& ticket) const;
+        //! Deactivates a spawned entity and adds it to the entity pool of the ticket. Returns false if the entity can't be pooled, in
+        //! which case it's left untouched.
+        bool ReturnEntityToPool(Ticket& ticket, AZ::Entity& entity, uint32_t prototypeIndex);
+        //! Removes a pooled entity that was spawned from the prototype from the pool of the ticket. Entities that no longer match the
+        //! prototype are destroyed. Returns nullptr if there's no entity available for the prototype.
+        AZ::Entity* TakeEntityFromPool(Ticket& ticket, const AZ::Entity& entityPrototype, uint32_t prototypeIndex);
+        //! Replaces the components of a pooled entity with fresh clones of the ones of its prototype and remaps their entity ids.
+        void ResetPooledEntity(
+            AZ::Entity& entity,
+            const AZ::Entity& entityPrototype,
+            const AZStd::vector<uint32_t>& componentsWithEntityIds,
+            EntityIdMap& prototypeToCloneMap,
+            AZ::SerializeContext& serializeContext);
+        void DestroyPooledEntities(Ticket& ticket);
+        //! Initializes the components with a thread safe Init of newly spawned entities in parallel tasks, if there are enough entities.
+        void InitThreadSafeComponents(SpawnableEntityContainerView entities);
         
         CommandResult ProcessRequest(SpawnAllEntitiesCommand& request);
         CommandResult ProcessRequest(SpawnEntitiesCommand& request);
@@ -293,15 +342,6 @@ namespace AzFramework
         CommandResult ProcessRequest(RegisterTicketCommand& request);
         CommandResult ProcessRequest(DestroyTicketCommand& request);
 
-        //! Generate a base set of original-to-new entity ID mappings to use during spawning.
-        //! Since Entity references get fixed up on an entity-by-entity basis while spawning, it's important to have the complete
-        //! set of new IDs available right at the start.  This way, entities that refer to other entities that haven't spawned yet
-        //! will still get their references remapped correctly.
-        void InitializeEntityIdMappings(
-            const Spawnable::EntityList& entities, EntityIdMap& idMap, AZStd::unordered_set<AZ::EntityId>& previouslySpawned);
-        void RefreshEntityIdMapping(
-            const AZ::EntityId& entityId, EntityIdMap& idMap, AZStd::unordered_set<AZ::EntityId>& previouslySpawned);
-
         Queue m_highPriorityQueue;
         Queue m_regularPriorityQueue;
 
@@ -311,6 +351,10 @@ namespace AzFramework
         //! SpawnablePriority_Default which gives users a bit of room to fine tune the priorities as this value can be configured
         //! through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/HighPriorityThreshold".
         SpawnablePriority m_highPriorityThreshold { 64 };
+        AZStd::chrono::microseconds m_frameBudget{ 0 };
+        //! The time at which the frame budget of the regular priority queue runs out, set while that queue is processed.
+        AZStd::chrono::steady_clock::time_point m_frameBudgetDeadline;
+        bool m_isFrameBudgetActive{ false };
 
         AZStd::unordered_map<EntitySpawnTicket::Id, Ticket*> m_entitySpawnTicketMap;
         AZStd::atomic_int m_totalTickets{ 0 };
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/Entity.h>
+#include <AzFramework/Spawnable/SpawnableEntityIdMap.h>
+
+namespace AzFramework
+{
+    void SpawnableEntityIdMap::Initialize(const Spawnable::EntityList& entities, const Spawnable::SpawnTemplate& spawnTemplate)
+    {
+        m_entityIndices = &spawnTemplate.m_entityIndices;
+        m_otherMappings.clear();
+
+        m_mappings.clear();
+        m_mappings.reserve(entities.size());
+        for (const AZStd::unique_ptr<AZ::Entity>& entity : entities)
+        {
+            m_mappings.emplace_back(entity->GetId(), AZ::Entity::MakeId());
+        }
+        m_isSpawned.assign(entities.size(), false);
+    }
+
+    void SpawnableEntityIdMap::Refresh(uint32_t entityIndex)
+    {
+        if (m_isSpawned[entityIndex])
+        {
+            // This entity has already been spawned at least once before, so it needs a new id, which is preserved to fix up any
+            // future entity references to this entity.
+            m_mappings[entityIndex].second = AZ::Entity::MakeId();
+        }
+        else
+        {
+            // This entity hasn't been spawned yet, so use the id that was generated during initialization and mark it as spawned so
+            // the id isn't reused next time.
+            m_isSpawned[entityIndex] = true;
+        }
+    }
+
+    void SpawnableEntityIdMap::Assign(uint32_t entityIndex, AZ::EntityId id)
+    {
+        m_mappings[entityIndex].second = id;
+        m_isSpawned[entityIndex] = true;
+    }
+
+    void SpawnableEntityIdMap::Clear()
+    {
+        m_entityIndices = nullptr;
+        m_mappings = {};
+        m_isSpawned = {};
+        m_otherMappings = {};
+    }
+
+    auto SpawnableEntityIdMap::find(const AZ::EntityId& id) -> iterator
+    {
+        if (m_entityIndices)
+        {
+            if (auto it = m_entityIndices->find(id); it != m_entityIndices->end() && it->second < m_mappings.size())
+            {
+                return &m_mappings[it->second];
+            }
+        }
+        auto it = m_otherMappings.find(id);
+        return it != m_otherMappings.end() ? &it->second : end();
+    }
+
+    auto SpawnableEntityIdMap::emplace(const AZ::EntityId& id, AZ::EntityId mappedId) -> AZStd::pair<iterator, bool>
+    {
+        if (iterator existing = find(id); existing != end())
+        {
+            return { existing, false };
+        }
+        auto it = m_otherMappings.emplace(id, value_type(id, mappedId)).first;
+        return { &it->second, true };
+    }
+
+    bool SpawnableEntityIdMap::empty() const
+    {
+        return m_mappings.empty() && m_otherMappings.empty();
+    }
+} // namespace AzFramework
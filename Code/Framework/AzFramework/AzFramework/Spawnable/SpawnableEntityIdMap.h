@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/utils.h>
+#include <AzFramework/Spawnable/Spawnable.h>
+
+namespace AzFramework
+{
+    //! Maps the ids of the entities in a spawnable to the ids of the entities that were spawned from them.
+    //! The mappings for the entities of the spawnable are stored in arrays in the same order as the entities, so the only lookup
+    //! needed is the conversion from an id to an index, which uses the table that's shared by all tickets through the spawn template.
+    //! Ids that don't belong to the spawnable, such as the ids of entities in aliased spawnables, are stored in a regular map.
+    //! The map provides the functions of an unordered_map that IdUtils::Remapper uses, so it can be passed to it directly.
+    class SpawnableEntityIdMap final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SpawnableEntityIdMap, AZ::SystemAllocator);
+
+        //! A mapping from the id of an entity in the spawnable to the id of the entity that was spawned from it.
+        using value_type = AZStd::pair<AZ::EntityId, AZ::EntityId>;
+        using iterator = value_type*;
+
+        //! Generates a new id for every entity of the spawnable and marks all entities as not spawned.
+        //! The spawn template has to stay alive until the map is initialized again or cleared.
+        void Initialize(const Spawnable::EntityList& entities, const Spawnable::SpawnTemplate& spawnTemplate);
+        //! Prepares the mapping for spawning the entity at the index in the spawnable. If the entity was spawned before, it gets a
+        //! new id so later references point to the latest instance, otherwise the id generated during initialization is used.
+        void Refresh(uint32_t entityIndex);
+        //! Maps the entity at the index in the spawnable to an existing id and marks it as spawned.
+        void Assign(uint32_t entityIndex, AZ::EntityId id);
+        void Clear();
+
+        iterator find(const AZ::EntityId& id);
+        iterator end() { return nullptr; }
+        //! Adds a mapping for the id if there's none yet. Returns the mapping for the id and whether it was added.
+        AZStd::pair<iterator, bool> emplace(const AZ::EntityId& id, AZ::EntityId mappedId);
+        bool empty() const;
+
+    private:
+        const AZStd::unordered_map<AZ::EntityId, uint32_t>* m_entityIndices{ nullptr };
+        AZStd::vector<value_type> m_mappings; //!< The mapping of each entity in the spawnable, by entity index.
+        AZStd::vector<bool> m_isSpawned; //!< Whether the entity at the index was spawned since the map was initialized.
+        //! Mappings for ids that don't belong to the spawnable. The key is stored twice so both kinds of mappings can be returned as
+        //! the same type.
+        AZStd::unordered_map<AZ::EntityId, value_type> m_otherMappings;
+    };
+} // namespace AzFramework
@@ -314,6 +314,18 @@ namespace AzFramework
             //! Given a ray, return the closest intersection with terrain.
             virtual RenderGeometry::RayResult GetClosestIntersection(const RenderGeometry::RayRequest& ray) const = 0;
 
+            //! Given a batch of rays, return the closest intersection with terrain for each of them.
+            //! The results span must be the same size as the rays span.
+            virtual void GetClosestIntersections(
+                AZStd::span<const RenderGeometry::RayRequest> rays, AZStd::span<RenderGeometry::RayResult> results) const
+            {
+                const size_t numRays = AZStd::min(rays.size(), results.size());
+                for (size_t rayIndex = 0; rayIndex < numRays; rayIndex++)
+                {
+                    results[rayIndex] = GetClosestIntersection(rays[rayIndex]);
+                }
+            }
+
             //! Asynchronous versions of the various 'Query*' API functions declared above.
             //! It's the responsibility of the caller to ensure all callbacks are thread-safe.
             virtual AZStd::shared_ptr<TerrainJobContext> QueryListAsync(
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/EBus/Event.h>
 
 namespace AZ
 {
@@ -17,6 +18,9 @@ namespace AZ
 
 namespace AzFramework
 {
+    //! Event signaled when the cached union of component Aabbs of an entity has been recalculated.
+    using EntityBoundsUnionChangedEvent = AZ::Event<AZ::EntityId>;
+
     //! Provides an interface to retrieve and update the union of all Aabbs on a single Entity.
     //! @note This will be the combination/union of all individual Component Aabbs.
     class IEntityBoundsUnion
@@ -43,6 +47,10 @@ namespace AzFramework
         //! @param entity the entity whose transform has been modified.
         virtual void OnTransformUpdated(AZ::Entity* entity) = 0;
 
+        //! Registers a handler to be notified when the cached union of component Aabbs of an entity is recalculated.
+        //! @note Only changes to the local bounds are signaled, transform changes are not.
+        virtual void RegisterEntityBoundsUnionChangedEventHandler(EntityBoundsUnionChangedEvent::Handler& handler) = 0;
+
     protected:
         ~IEntityBoundsUnion() = default;
     };
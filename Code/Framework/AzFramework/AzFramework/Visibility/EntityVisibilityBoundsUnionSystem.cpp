@@ -67,6 +67,7 @@ namespace AzFramework
 
             auto next_it = m_entityVisibilityBoundsUnionInstanceMapping.insert({ entity, instance });
             UpdateVisibilitySystem(entity, next_it.first->second);
+            m_entityBoundsUnionChangedEvent.Signal(entity->GetId());
         }
     }
 
@@ -161,6 +162,7 @@ namespace AzFramework
             {
                 instanceIt->second.m_localEntityBoundsUnion = CalculateEntityLocalBoundsUnion(entity);
                 UpdateVisibilitySystem(entity, instanceIt->second);
+                m_entityBoundsUnionChangedEvent.Signal(entity->GetId());
             }
         }
 
@@ -178,6 +180,12 @@ namespace AzFramework
         }
     }
 
+    void EntityVisibilityBoundsUnionSystem::RegisterEntityBoundsUnionChangedEventHandler(
+        EntityBoundsUnionChangedEvent::Handler& handler)
+    {
+        handler.Connect(m_entityBoundsUnionChangedEvent);
+    }
+
     void EntityVisibilityBoundsUnionSystem::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
         ProcessEntityBoundsUnionRequests();
@@ -34,6 +34,7 @@ namespace AzFramework
         AZ::Aabb GetEntityWorldBoundsUnion(AZ::EntityId entityId) const override;
         void ProcessEntityBoundsUnionRequests() override;
         void OnTransformUpdated(AZ::Entity* entity) override;
+        void RegisterEntityBoundsUnionChangedEventHandler(EntityBoundsUnionChangedEvent::Handler& handler) override;
 
     private:
         struct EntityVisibilityBoundsUnionInstance
@@ -59,5 +60,6 @@ namespace AzFramework
 
         AZ::EntityActivatedEvent::Handler m_entityActivatedEventHandler;
         AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler;
+        EntityBoundsUnionChangedEvent m_entityBoundsUnionChangedEvent;
     };
 } // namespace AzFramework
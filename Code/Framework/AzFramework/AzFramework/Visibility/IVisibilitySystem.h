@@ -111,6 +111,16 @@ namespace AzFramework
         //! @param callback the callback to invoke when a node is visible
         virtual void Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const = 0;
 
+        //! Intersects a frustum against the visibility system, potentially spreading the work over the task system.
+        //! The callback may be invoked from several threads at the same time, so it must be thread safe. Nodes are not reported
+        //! in any particular order. The default implementation calls Enumerate on the calling thread.
+        //! @param frustum the frustum to test against
+        //! @param callback the callback to invoke when a node is visible
+        virtual void EnumerateParallel(const AZ::Frustum& frustum, const EnumerateCallback& callback) const
+        {
+            Enumerate(frustum, callback);
+        }
+
         //! Enumerate *all* OctreeNodes that have any entries in them (without any culling).
         //! @param callback the callback to invoke when a node is visible
         virtual void EnumerateNoCull(const EnumerateCallback& callback) const = 0;
@@ -119,6 +129,14 @@ namespace AzFramework
         virtual uint32_t GetEntryCount() const = 0;
     };
 
+    //! The spatial index used by a visibility scene.
+    enum class VisibilitySceneType
+    {
+        Default, //< Picked by the visibility system, see the bg_octreeUseLooseOctree cvar
+        Octree, //< Adaptive octree, nodes are split and merged as entries are added and removed
+        LooseOctree //< Loose octree with a fixed cell grid, cheaper to update and cull for scenes with many moving entries
+    };
+
     //! @class IVisibilitySystem
     //! @brief This is an AZ::Interface<> useful for extremely fast, CPU only, proximity and visibility queries.
     class IVisibilitySystem
@@ -133,7 +151,8 @@ namespace AzFramework
         virtual IVisibilityScene* GetDefaultVisibilityScene() = 0;
 
         //! Create a new IVisibilityScene that is uniquely identified by the scene name.
-        virtual IVisibilityScene* CreateVisibilityScene(const AZ::Name& sceneName) = 0;
+        //! @param sceneType the spatial index to use for the scene
+        virtual IVisibilityScene* CreateVisibilityScene(const AZ::Name& sceneName, VisibilitySceneType sceneType = VisibilitySceneType::Default) = 0;
 
         //! Destroy the visibility scene.
         //! This does not destroy the entities that are a part of the scene, only the visibility scene.
@@ -0,0 +1,503 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Visibility/LooseOctreeScene.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/sort.h>
+
+namespace AzFramework
+{
+    AZ_CVAR(uint32_t, bg_looseOctreeParallelMinNodes, 256, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of nodes in a loose visibility octree before EnumerateParallel spreads the culling over tasks");
+
+    namespace
+    {
+        //! Subtrees at this level are culled by separate tasks in EnumerateParallel, which gives at most 64 tasks.
+        constexpr uint32_t ParallelSplitLevel = 2;
+
+        // Spreads the lower 21 bits of the value out so that there are two zero bits between each of them
+        uint64_t SpreadBits(uint64_t value)
+        {
+            value &= 0x1FFFFF;
+            value = (value | (value << 32)) & 0x001F00000000FFFF;
+            value = (value | (value << 16)) & 0x001F0000FF0000FF;
+            value = (value | (value << 8)) & 0x100F00F00F00F00F;
+            value = (value | (value << 4)) & 0x10C30C30C30C30C3;
+            value = (value | (value << 2)) & 0x1249249249249249;
+            return value;
+        }
+
+        // Inverse of SpreadBits, gathers every third bit into the lower 21 bits
+        uint32_t CompactBits(uint64_t value)
+        {
+            value &= 0x1249249249249249;
+            value = (value | (value >> 2)) & 0x10C30C30C30C30C3;
+            value = (value | (value >> 4)) & 0x100F00F00F00F00F;
+            value = (value | (value >> 8)) & 0x001F0000FF0000FF;
+            value = (value | (value >> 16)) & 0x001F00000000FFFF;
+            value = (value | (value >> 32)) & 0x1FFFFF;
+            return aznumeric_cast<uint32_t>(value);
+        }
+
+        // Uses the same child ordering as OctreeNode, X in the lowest bit, then Y, then Z
+        uint64_t CreateNodeKey(uint32_t x, uint32_t y, uint32_t z, uint32_t level)
+        {
+            return (uint64_t{ 1 } << (3 * level)) | SpreadBits(x) | (SpreadBits(y) << 1) | (SpreadBits(z) << 2);
+        }
+
+        bool IsAncestorOrSelf(uint64_t ancestorKey, uint32_t ancestorLevel, uint64_t key, uint32_t level)
+        {
+            return level >= ancestorLevel && (key >> (3 * (level - ancestorLevel))) == ancestorKey;
+        }
+    }
+
+    LooseOctreeScene::LooseOctreeScene(const AZ::Name& sceneName, float worldExtents, uint32_t maxDepth)
+        : m_sceneName(sceneName)
+        , m_worldMin(-worldExtents)
+        , m_worldSize(2.0f * worldExtents)
+        , m_maxDepth(AZStd::min(maxDepth, MaxSupportedDepth))
+    {
+        AZ_Assert(!sceneName.IsEmpty(), "sceneName must be a valid string");
+        AZ_Assert(worldExtents > 0.0f, "worldExtents must be positive");
+    }
+
+    const AZ::Name& LooseOctreeScene::GetName() const
+    {
+        return m_sceneName;
+    }
+
+    void LooseOctreeScene::InsertOrUpdateEntry(VisibilityEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+
+        uint32_t level = 0;
+        const uint64_t key = FindNodeKey(entry.m_boundingVolume, level);
+        if (entry.m_internalNode != nullptr)
+        {
+            if (static_cast<LooseOctreeNode*>(entry.m_internalNode)->m_key == key)
+            {
+                // The entry moved within its current node, nothing to do
+                return;
+            }
+            RemoveFromNode(entry);
+        }
+        else
+        {
+            ++m_entryCount;
+        }
+
+        const uint32_t nodeIndex = AcquireNode(key, level);
+        LooseOctreeNode& node = m_nodes[nodeIndex];
+        entry.m_internalNode = &node;
+        entry.m_internalNodeIndex = aznumeric_cast<uint32_t>(node.m_entries.size());
+        node.m_entries.push_back(&entry);
+
+        for (uint32_t index = nodeIndex; index != LooseOctreeNode::InvalidNodeIndex; index = m_nodes[index].m_parentIndex)
+        {
+            ++m_nodes[index].m_subtreeEntryCount;
+        }
+    }
+
+    void LooseOctreeScene::RemoveEntry(VisibilityEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        if (entry.m_internalNode)
+        {
+            RemoveFromNode(entry);
+            entry.m_internalNode = nullptr;
+            entry.m_internalNodeIndex = 0;
+            --m_entryCount;
+        }
+    }
+
+    void LooseOctreeScene::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateHelper(aabb, callback);
+    }
+
+    void LooseOctreeScene::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateHelper(sphere, callback);
+    }
+
+    void LooseOctreeScene::Enumerate(const AZ::Hemisphere& hemisphere, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateHelper(hemisphere, callback);
+    }
+
+    void LooseOctreeScene::Enumerate(const AZ::Capsule& capsule, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateHelper(capsule, callback);
+    }
+
+    void LooseOctreeScene::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        LockForEnumerate();
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex, AZStd::adopt_lock);
+        EnumerateFrustumRange(frustum, 0, m_traversalNodes.size(), callback);
+    }
+
+    void LooseOctreeScene::Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const
+    {
+        LockForEnumerate();
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex, AZStd::adopt_lock);
+
+        const size_t nodeCount = m_traversalNodes.size();
+        for (size_t index = 0; index < nodeCount;)
+        {
+            const TraversalNode& traversalNode = m_traversalNodes[index];
+
+            // Loose bounds are nested, so when the exclude frustum contains a node it contains the whole subtree
+            if (!AZ::ShapeIntersection::Overlaps(includeFrustum, traversalNode.m_looseBounds) ||
+                AZ::ShapeIntersection::Contains(excludeFrustum, traversalNode.m_looseBounds))
+            {
+                index += traversalNode.m_subtreeSize;
+                continue;
+            }
+
+            const LooseOctreeNode& node = m_nodes[traversalNode.m_nodeIndex];
+            if (!node.m_entries.empty())
+            {
+                callback({ traversalNode.m_looseBounds, node.m_entries });
+            }
+            ++index;
+        }
+    }
+
+    void LooseOctreeScene::EnumerateParallel(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        LockForEnumerate();
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex, AZStd::adopt_lock);
+
+        const size_t nodeCount = m_traversalNodes.size();
+        AZ::TaskGraphActiveInterface* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (nodeCount < bg_looseOctreeParallelMinNodes || !taskGraphActive || !taskGraphActive->IsTaskGraphActive())
+        {
+            EnumerateFrustumRange(frustum, 0, nodeCount, callback);
+            return;
+        }
+
+        static const AZ::TaskDescriptor enumerateTaskDescriptor{ "LooseOctreeScene::EnumerateParallel", "Visibility" };
+        AZ::TaskGraph taskGraph{ "LooseOctreeScene::EnumerateParallel" };
+
+        // Cull the top levels on this thread, and hand every subtree at the split level over to a task
+        for (size_t index = 0; index < nodeCount;)
+        {
+            const TraversalNode& traversalNode = m_traversalNodes[index];
+            if (traversalNode.m_level == ParallelSplitLevel)
+            {
+                const size_t end = index + traversalNode.m_subtreeSize;
+                taskGraph.AddTask(
+                    enumerateTaskDescriptor,
+                    [this, &frustum, &callback, index, end]()
+                    {
+                        EnumerateFrustumRange(frustum, index, end, callback);
+                    });
+                index = end;
+                continue;
+            }
+
+            if (!AZ::ShapeIntersection::Overlaps(frustum, traversalNode.m_looseBounds))
+            {
+                index += traversalNode.m_subtreeSize;
+                continue;
+            }
+
+            const LooseOctreeNode& node = m_nodes[traversalNode.m_nodeIndex];
+            if (!node.m_entries.empty())
+            {
+                callback({ traversalNode.m_looseBounds, node.m_entries });
+            }
+            ++index;
+        }
+
+        if (!taskGraph.IsEmpty())
+        {
+            AZ::TaskGraphEvent finishedEvent{ "LooseOctreeScene::EnumerateParallel Wait" };
+            taskGraph.Submit(&finishedEvent);
+            finishedEvent.Wait();
+        }
+    }
+
+    void LooseOctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        LockForEnumerate();
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex, AZStd::adopt_lock);
+        EnumerateRangeNoCull(0, m_traversalNodes.size(), callback);
+    }
+
+    uint32_t LooseOctreeScene::GetEntryCount() const
+    {
+        return m_entryCount;
+    }
+
+    uint32_t LooseOctreeScene::GetNodeCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_nodeLookup.size());
+    }
+
+    uint32_t LooseOctreeScene::GetFreeNodeCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_freeNodes.size());
+    }
+
+    uint32_t LooseOctreeScene::GetMaxDepth() const
+    {
+        return m_maxDepth;
+    }
+
+    void LooseOctreeScene::DumpStats()
+    {
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::EntryCount = %u", GetName().GetCStr(), GetEntryCount());
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::NodeCount = %u", GetName().GetCStr(), GetNodeCount());
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::FreeNodeCount = %u", GetName().GetCStr(), GetFreeNodeCount());
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::MaxDepth = %u", GetName().GetCStr(), GetMaxDepth());
+    }
+
+    uint64_t LooseOctreeScene::FindNodeKey(const AZ::Aabb& boundingVolume, uint32_t& level) const
+    {
+        level = 0;
+        if (!boundingVolume.IsValid())
+        {
+            return 1;
+        }
+
+        // A loose cell is twice the size of its cell, so any entry no larger than a cell fits the loose cell around its center
+        const float maxExtent = boundingVolume.GetExtents().GetMaxElement();
+        uint32_t targetLevel = 0;
+        float cellSize = m_worldSize;
+        while (targetLevel < m_maxDepth && cellSize * 0.5f >= maxExtent)
+        {
+            cellSize *= 0.5f;
+            ++targetLevel;
+        }
+
+        // Entries centered outside of the world are clamped to the border cells, move up until one of the loose cells fits them
+        const AZ::Vector3 center = boundingVolume.GetCenter();
+        for (level = targetLevel; level > 0; --level, cellSize *= 2.0f)
+        {
+            const uint32_t maxCoordinate = (1u << level) - 1;
+            const AZ::Vector3 cellCoordinates = ((center - m_worldMin) / cellSize).GetFloor();
+            const uint32_t x = aznumeric_cast<uint32_t>(AZ::GetClamp(cellCoordinates.GetX(), 0.0f, aznumeric_cast<float>(maxCoordinate)));
+            const uint32_t y = aznumeric_cast<uint32_t>(AZ::GetClamp(cellCoordinates.GetY(), 0.0f, aznumeric_cast<float>(maxCoordinate)));
+            const uint32_t z = aznumeric_cast<uint32_t>(AZ::GetClamp(cellCoordinates.GetZ(), 0.0f, aznumeric_cast<float>(maxCoordinate)));
+
+            const AZ::Vector3 looseMin = m_worldMin + AZ::Vector3(aznumeric_cast<float>(x), aznumeric_cast<float>(y), aznumeric_cast<float>(z)) * cellSize - AZ::Vector3(cellSize * 0.5f);
+            const AZ::Aabb looseBounds = AZ::Aabb::CreateFromMinMax(looseMin, looseMin + AZ::Vector3(cellSize * 2.0f));
+            if (AZ::ShapeIntersection::Contains(looseBounds, boundingVolume))
+            {
+                return CreateNodeKey(x, y, z, level);
+            }
+        }
+
+        // The root accepts anything, matching the root of OctreeScene
+        return 1;
+    }
+
+    uint32_t LooseOctreeScene::AcquireNode(uint64_t key, uint32_t level)
+    {
+        if (auto iter = m_nodeLookup.find(key); iter != m_nodeLookup.end())
+        {
+            return iter->second;
+        }
+
+        const uint32_t parentIndex = (level > 0) ? AcquireNode(key >> 3, level - 1) : LooseOctreeNode::InvalidNodeIndex;
+
+        uint32_t nodeIndex;
+        if (!m_freeNodes.empty())
+        {
+            nodeIndex = m_freeNodes.back();
+            m_freeNodes.pop_back();
+        }
+        else
+        {
+            nodeIndex = aznumeric_cast<uint32_t>(m_nodes.size());
+            m_nodes.emplace_back();
+        }
+
+        const uint64_t cellBits = key & ((uint64_t{ 1 } << (3 * level)) - 1);
+        const AZ::Vector3 cellCoordinates(
+            aznumeric_cast<float>(CompactBits(cellBits)),
+            aznumeric_cast<float>(CompactBits(cellBits >> 1)),
+            aznumeric_cast<float>(CompactBits(cellBits >> 2)));
+        const float cellSize = m_worldSize / aznumeric_cast<float>(uint64_t{ 1 } << level);
+        const AZ::Vector3 looseMin = m_worldMin + cellCoordinates * cellSize - AZ::Vector3(cellSize * 0.5f);
+
+        LooseOctreeNode& node = m_nodes[nodeIndex];
+        node.m_looseBounds = AZ::Aabb::CreateFromMinMax(looseMin, looseMin + AZ::Vector3(cellSize * 2.0f));
+        node.m_key = key;
+        node.m_parentIndex = parentIndex;
+        node.m_subtreeEntryCount = 0;
+        node.m_level = level;
+
+        m_nodeLookup.emplace(key, nodeIndex);
+        m_traversalDirty = true;
+        return nodeIndex;
+    }
+
+    void LooseOctreeScene::RemoveFromNode(VisibilityEntry& entry)
+    {
+        LooseOctreeNode* node = static_cast<LooseOctreeNode*>(entry.m_internalNode);
+        AZ_Assert(entry.m_internalNodeIndex < node->m_entries.size() && node->m_entries[entry.m_internalNodeIndex] == &entry,
+            "Visibility entry is not bound to the loose octree node it points at");
+
+        // Swap and pop, fixing up the index of the entry that was moved
+        VisibilityEntry* lastEntry = node->m_entries.back();
+        lastEntry->m_internalNodeIndex = entry.m_internalNodeIndex;
+        node->m_entries[entry.m_internalNodeIndex] = lastEntry;
+        node->m_entries.pop_back();
+
+        for (uint32_t index = m_nodeLookup[node->m_key]; index != LooseOctreeNode::InvalidNodeIndex;)
+        {
+            LooseOctreeNode& current = m_nodes[index];
+            const uint32_t parentIndex = current.m_parentIndex;
+            if (--current.m_subtreeEntryCount == 0)
+            {
+                m_nodeLookup.erase(current.m_key);
+                current.m_key = 0;
+                current.m_parentIndex = LooseOctreeNode::InvalidNodeIndex;
+                current.m_entries.clear();
+                m_freeNodes.push_back(index);
+                m_traversalDirty = true;
+            }
+            index = parentIndex;
+        }
+    }
+
+    void LooseOctreeScene::LockForEnumerate() const
+    {
+        m_sharedMutex.lock_shared();
+        while (m_traversalDirty)
+        {
+            m_sharedMutex.unlock_shared();
+            {
+                AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+                if (m_traversalDirty)
+                {
+                    RebuildTraversalOrder();
+                }
+            }
+            m_sharedMutex.lock_shared();
+        }
+    }
+
+    void LooseOctreeScene::RebuildTraversalOrder() const
+    {
+        m_traversalNodes.clear();
+        m_traversalNodes.reserve(m_nodeLookup.size());
+        for (const auto& [key, nodeIndex] : m_nodeLookup)
+        {
+            const LooseOctreeNode& node = m_nodes[nodeIndex];
+            m_traversalNodes.push_back({ node.m_looseBounds, nodeIndex, 1, node.m_level });
+        }
+
+        // Aligning every key to the deepest level sorts nodes by Morton code, with ancestors ahead of their descendants
+        const uint32_t maxDepth = m_maxDepth;
+        const auto& nodes = m_nodes;
+        AZStd::sort(m_traversalNodes.begin(), m_traversalNodes.end(),
+            [maxDepth, &nodes](const TraversalNode& lhs, const TraversalNode& rhs)
+            {
+                const uint64_t lhsKey = nodes[lhs.m_nodeIndex].m_key << (3 * (maxDepth - lhs.m_level));
+                const uint64_t rhsKey = nodes[rhs.m_nodeIndex].m_key << (3 * (maxDepth - rhs.m_level));
+                return (lhsKey != rhsKey) ? (lhsKey < rhsKey) : (lhs.m_level < rhs.m_level);
+            });
+
+        // A subtree ends at the first node that isn't a descendant of its root
+        AZStd::vector<uint32_t> openSubtrees;
+        const uint32_t nodeCount = aznumeric_cast<uint32_t>(m_traversalNodes.size());
+        for (uint32_t index = 0; index < nodeCount; ++index)
+        {
+            const TraversalNode& traversalNode = m_traversalNodes[index];
+            const uint64_t key = m_nodes[traversalNode.m_nodeIndex].m_key;
+            while (!openSubtrees.empty())
+            {
+                TraversalNode& subtreeRoot = m_traversalNodes[openSubtrees.back()];
+                if (IsAncestorOrSelf(m_nodes[subtreeRoot.m_nodeIndex].m_key, subtreeRoot.m_level, key, traversalNode.m_level))
+                {
+                    break;
+                }
+                subtreeRoot.m_subtreeSize = index - openSubtrees.back();
+                openSubtrees.pop_back();
+            }
+            openSubtrees.push_back(index);
+        }
+        for (const uint32_t subtreeRootIndex : openSubtrees)
+        {
+            m_traversalNodes[subtreeRootIndex].m_subtreeSize = nodeCount - subtreeRootIndex;
+        }
+
+        m_traversalDirty = false;
+    }
+
+    template<typename T>
+    void LooseOctreeScene::EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        LockForEnumerate();
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex, AZStd::adopt_lock);
+
+        const size_t nodeCount = m_traversalNodes.size();
+        for (size_t index = 0; index < nodeCount;)
+        {
+            const TraversalNode& traversalNode = m_traversalNodes[index];
+            if (!AZ::ShapeIntersection::Overlaps(boundingVolume, traversalNode.m_looseBounds))
+            {
+                index += traversalNode.m_subtreeSize;
+                continue;
+            }
+
+            const LooseOctreeNode& node = m_nodes[traversalNode.m_nodeIndex];
+            if (!node.m_entries.empty())
+            {
+                callback({ traversalNode.m_looseBounds, node.m_entries });
+            }
+            ++index;
+        }
+    }
+
+    void LooseOctreeScene::EnumerateFrustumRange(
+        const AZ::Frustum& frustum, size_t begin, size_t end, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        for (size_t index = begin; index < end;)
+        {
+            const TraversalNode& traversalNode = m_traversalNodes[index];
+            const AZ::IntersectResult result = frustum.IntersectAabb(traversalNode.m_looseBounds);
+            if (result == AZ::IntersectResult::Exterior)
+            {
+                index += traversalNode.m_subtreeSize;
+            }
+            else if (result == AZ::IntersectResult::Interior)
+            {
+                // Every descendant is inside the frustum as well, so the rest of the subtree needs no more tests
+                EnumerateRangeNoCull(index, index + traversalNode.m_subtreeSize, callback);
+                index += traversalNode.m_subtreeSize;
+            }
+            else
+            {
+                const LooseOctreeNode& node = m_nodes[traversalNode.m_nodeIndex];
+                if (!node.m_entries.empty())
+                {
+                    callback({ traversalNode.m_looseBounds, node.m_entries });
+                }
+                ++index;
+            }
+        }
+    }
+
+    void LooseOctreeScene::EnumerateRangeNoCull(size_t begin, size_t end, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        for (size_t index = begin; index < end; ++index)
+        {
+            const TraversalNode& traversalNode = m_traversalNodes[index];
+            const LooseOctreeNode& node = m_nodes[traversalNode.m_nodeIndex];
+            if (!node.m_entries.empty())
+            {
+                callback({ traversalNode.m_looseBounds, node.m_entries });
+            }
+        }
+    }
+}
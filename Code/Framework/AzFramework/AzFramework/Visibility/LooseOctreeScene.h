@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzFramework/Visibility/IVisibilitySystem.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+
+namespace AzFramework
+{
+    //! A node of the loose octree.
+    //! Nodes are identified by a locational code: a leading 1 bit followed by the Morton code of the node's cell, three bits
+    //! per level. The parent of a node is found by dropping the lowest three bits, so no child pointers are needed.
+    struct LooseOctreeNode
+        : public VisibilityNode
+    {
+        static constexpr uint32_t InvalidNodeIndex = 0xFFFFFFFF;
+
+        AZ::Aabb m_looseBounds = AZ::Aabb::CreateNull(); //< Bounds of the node's cell, grown by half a cell on every side
+        AZStd::vector<VisibilityEntry*> m_entries;
+        uint64_t m_key = 0; //< Locational code of the node, 0 for a free node
+        uint32_t m_parentIndex = InvalidNodeIndex;
+        uint32_t m_subtreeEntryCount = 0; //< Number of entries in this node and all its descendants, the node is released at 0
+        uint32_t m_level = 0;
+    };
+
+    //! Alternative spatial index for the visibility system, a loose octree stored as flat arrays.
+    //! Every entry is stored in a single node of a fixed grid, picked from the entry's center and size, with no splitting or
+    //! merging. Since the node bounds are grown by half a cell, entries never have to be stored higher up the tree because
+    //! they straddle a cell boundary. For queries the nodes are sorted by Morton code into a depth first array, where
+    //! rejecting a node skips over its whole subtree, so culling is a linear walk over contiguous memory instead of chasing
+    //! child pointers. The array is rebuilt on the next query after nodes were added or removed.
+    class LooseOctreeScene
+        : public IVisibilityScene
+    {
+    public:
+        AZ_RTTI(LooseOctreeScene, "{5B0C8E0E-6E1B-4A1C-9E43-2F6E3D6A6C1B}", IVisibilityScene);
+        AZ_CLASS_ALLOCATOR(LooseOctreeScene, AZ::SystemAllocator);
+        AZ_DISABLE_COPY_MOVE(LooseOctreeScene);
+
+        //! The deepest level supported by the 64-bit locational codes.
+        static constexpr uint32_t MaxSupportedDepth = 20;
+
+        //! @param worldExtents half the edge length of the world cube centered on the origin that is covered by the root node
+        //! @param maxDepth level of the smallest cells, clamped to MaxSupportedDepth
+        LooseOctreeScene(const AZ::Name& sceneName, float worldExtents, uint32_t maxDepth);
+        ~LooseOctreeScene() override = default;
+
+        //! IVisibilityScene overrides.
+        //! @{
+        const AZ::Name& GetName() const override;
+        void InsertOrUpdateEntry(VisibilityEntry& entry) override;
+        void RemoveEntry(VisibilityEntry& entry) override;
+        void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Hemisphere& hemisphere, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Capsule& capsule, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Frustum& includeFrustum, const AZ::Frustum& excludeFrustum, const EnumerateCallback& callback) const override;
+        void EnumerateParallel(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
+        uint32_t GetEntryCount() const override;
+        //! @}
+
+        //! Stats
+        //! @{
+        uint32_t GetNodeCount() const;
+        uint32_t GetFreeNodeCount() const;
+        uint32_t GetMaxDepth() const;
+        void DumpStats();
+        //! @}
+
+    private:
+        // A node in depth first order, along with the number of nodes in its subtree (including itself)
+        struct TraversalNode
+        {
+            AZ::Aabb m_looseBounds;
+            uint32_t m_nodeIndex;
+            uint32_t m_subtreeSize;
+            uint32_t m_level;
+        };
+
+        //! Returns the locational code of the node that the bounding volume should be stored in.
+        uint64_t FindNodeKey(const AZ::Aabb& boundingVolume, uint32_t& level) const;
+
+        //! Returns the index of the node with the given locational code, creating it and any missing ancestors.
+        uint32_t AcquireNode(uint64_t key, uint32_t level);
+
+        //! Removes an entry from its node and releases the nodes that no longer have any entries in their subtree.
+        void RemoveFromNode(VisibilityEntry& entry);
+
+        //! Acquires the shared lock, sorting the nodes into depth first order first if they changed since the last query.
+        void LockForEnumerate() const;
+        void RebuildTraversalOrder() const;
+
+        template<typename T>
+        void EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const;
+        void EnumerateFrustumRange(
+            const AZ::Frustum& frustum, size_t begin, size_t end, const IVisibilityScene::EnumerateCallback& callback) const;
+        void EnumerateRangeNoCull(size_t begin, size_t end, const IVisibilityScene::EnumerateCallback& callback) const;
+
+        mutable AZStd::shared_mutex m_sharedMutex;
+
+        AZ::Name m_sceneName; //< The uniquely identifying name for the visibility scene.
+        AZ::Vector3 m_worldMin; //< Minimum corner of the root cell.
+        float m_worldSize = 0.0f; //< Edge length of the root cell.
+        uint32_t m_maxDepth = 0; //< Level of the smallest cells.
+
+        AZStd::deque<LooseOctreeNode> m_nodes; //< Node storage, a deque so that entries can point at their node.
+        AZStd::vector<uint32_t> m_freeNodes; //< Indices of released nodes that can be reused.
+        AZStd::unordered_map<uint64_t, uint32_t> m_nodeLookup; //< Maps the locational code of each live node to its index.
+        uint32_t m_entryCount = 0; //< Metric tracking the number of entries inserted into the scene.
+
+        mutable AZStd::vector<TraversalNode> m_traversalNodes; //< Live nodes in depth first order, used by all queries.
+        mutable bool m_traversalDirty = false; //< Set when nodes were added or removed since the traversal order was built.
+    };
+}
@@ -7,6 +7,7 @@
  */
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzFramework/Visibility/LooseOctreeScene.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
@@ -16,6 +17,8 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,        64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,        32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(bool,     bg_octreeUseLooseOctree,     false, nullptr, AZ::ConsoleFunctorFlags::ReadOnly, "If set to true, visibility scenes that don't request a specific type use a loose octree");
+    AZ_CVAR(uint32_t, bg_looseOctreeMaxDepth,         10, nullptr, AZ::ConsoleFunctorFlags::Null, "Depth of the smallest cells of loose visibility octrees, read when a scene is created");
 
     static uint32_t GetChildNodeCount()
     {
@@ -580,7 +583,7 @@ namespace AzFramework
         AZ::Interface<IVisibilitySystem>::Register(this);
         IVisibilitySystemRequestBus::Handler::BusConnect();
 
-        m_defaultScene = aznew OctreeScene(AZ::Name("DefaultVisibilityScene"));
+        m_defaultScene = CreateScene(AZ::Name("DefaultVisibilityScene"), VisibilitySceneType::Default);
     }
 
     OctreeSystemComponent::~OctreeSystemComponent()
@@ -608,10 +611,10 @@ namespace AzFramework
         return m_defaultScene;
     }
 
-    IVisibilityScene* OctreeSystemComponent::CreateVisibilityScene(const AZ::Name& sceneName)
+    IVisibilityScene* OctreeSystemComponent::CreateVisibilityScene(const AZ::Name& sceneName, VisibilitySceneType sceneType)
     {
         AZ_Assert(FindVisibilityScene(sceneName) == nullptr, "Scene with same name already created!");
-        OctreeScene* newScene = aznew OctreeScene(sceneName);
+        IVisibilityScene* newScene = CreateScene(sceneName, sceneType);
         m_scenes.push_back(newScene);
         return newScene;
     }
@@ -632,7 +635,7 @@ namespace AzFramework
 
     IVisibilityScene* OctreeSystemComponent::FindVisibilityScene(const AZ::Name& sceneName)
     {
-        for (OctreeScene* scene : m_scenes)
+        for (IVisibilityScene* scene : m_scenes)
         {
             if(scene->GetName() == sceneName)
             {
@@ -644,11 +647,32 @@ namespace AzFramework
 
     void OctreeSystemComponent::DumpStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
     {
-        for (OctreeScene* scene : m_scenes)
+        for (IVisibilityScene* scene : m_scenes)
         {
             AZ_TracePrintf("Console", "============================================");
-            scene->DumpStats();
+            if (OctreeScene* octreeScene = azrtti_cast<OctreeScene*>(scene))
+            {
+                octreeScene->DumpStats();
+            }
+            else if (LooseOctreeScene* looseOctreeScene = azrtti_cast<LooseOctreeScene*>(scene))
+            {
+                looseOctreeScene->DumpStats();
+            }
         }
         AZ_TracePrintf("Console", "============================================");
     }
+
+    IVisibilityScene* OctreeSystemComponent::CreateScene(const AZ::Name& sceneName, VisibilitySceneType sceneType)
+    {
+        if (sceneType == VisibilitySceneType::Default)
+        {
+            sceneType = bg_octreeUseLooseOctree ? VisibilitySceneType::LooseOctree : VisibilitySceneType::Octree;
+        }
+
+        if (sceneType == VisibilitySceneType::LooseOctree)
+        {
+            return aznew LooseOctreeScene(sceneName, bg_octreeMaxWorldExtents, bg_looseOctreeMaxDepth);
+        }
+        return aznew OctreeScene(sceneName);
+    }
 }
@@ -95,7 +95,7 @@ namespace AzFramework
         : public IVisibilityScene
     {
     public:
-        AZ_RTTI(OctreeScene, "{A88E4D86-11F1-4E3F-A91A-66DE99502B93}");
+        AZ_RTTI(OctreeScene, "{A88E4D86-11F1-4E3F-A91A-66DE99502B93}", IVisibilityScene);
         AZ_CLASS_ALLOCATOR(OctreeScene, AZ::SystemAllocator);
         AZ_DISABLE_COPY_MOVE(OctreeScene);
 
@@ -177,18 +177,20 @@ namespace AzFramework
         //! IVisibilitySystem overrides
         //! @{
         IVisibilityScene* GetDefaultVisibilityScene() override;
-        IVisibilityScene* CreateVisibilityScene(const AZ::Name& sceneName) override;
+        IVisibilityScene* CreateVisibilityScene(const AZ::Name& sceneName, VisibilitySceneType sceneType = VisibilitySceneType::Default) override;
         void DestroyVisibilityScene(IVisibilityScene* visScene) override;
         IVisibilityScene* FindVisibilityScene(const AZ::Name& sceneName) override;
         void DumpStats(const AZ::ConsoleCommandContainer& arguments) override;
         //! @}
 
     private:
+        static IVisibilityScene* CreateScene(const AZ::Name& sceneName, VisibilitySceneType sceneType);
+
         //! The default scene used for most entities (e.g. gameplay, networking)
-        OctreeScene* m_defaultScene = nullptr;
+        IVisibilityScene* m_defaultScene = nullptr;
 
         //! Other scenes (e.g. each rendering scene) are stored here and looked up by name.
-        AZStd::vector<OctreeScene*> m_scenes;   //using a vector<> here because we'll generally have a small number of scenes
+        AZStd::vector<IVisibilityScene*> m_scenes;   //using a vector<> here because we'll generally have a small number of scenes
         
     };
 }
@@ -63,6 +63,10 @@ set(FILES
     Asset/GenericAssetHandler.h
     Asset/AssetBundleManifest.cpp
     Asset/AssetBundleManifest.h
+    Asset/AssetPrefetchManifest.cpp
+    Asset/AssetPrefetchManifest.h
+    Asset/AssetPrefetchSystemComponent.cpp
+    Asset/AssetPrefetchSystemComponent.h
     Asset/CustomAssetTypeComponent.cpp
     Asset/CustomAssetTypeComponent.h
     Asset/FileTagAsset.cpp
@@ -133,6 +137,12 @@ set(FILES
     Components/ComponentAdapter.inl
     Components/ComponentAdapterHelpers.h
     Components/EditorEntityEvents.h
+    Components/TransformChangeBatchBus.h
+    Components/TransformChangeBatchSystem.cpp
+    Components/TransformChangeBatchSystem.h
+    Components/ITransformDataStorage.h
+    Components/TransformDataStorageSystem.cpp
+    Components/TransformDataStorageSystem.h
     Components/TransformComponent.cpp
     Components/TransformComponent.h
     Components/CameraBus.h
@@ -369,6 +379,8 @@ set(FILES
     Spawnable/SpawnableEntitiesInterface.cpp
     Spawnable/SpawnableEntitiesManager.h
     Spawnable/SpawnableEntitiesManager.cpp
+    Spawnable/SpawnableEntityIdMap.h
+    Spawnable/SpawnableEntityIdMap.cpp
     Spawnable/SpawnableMetaData.cpp
     Spawnable/SpawnableMetaData.h
     Spawnable/SpawnableMonitor.h
@@ -492,6 +504,8 @@ set(FILES
     Visibility/OcclusionBus.h
     Visibility/OctreeSystemComponent.cpp
     Visibility/OctreeSystemComponent.h
+    Visibility/LooseOctreeScene.cpp
+    Visibility/LooseOctreeScene.h
     Visibility/VisibilityDebug.cpp
     Visibility/VisibilityDebug.h
     Visibility/VisibleGeometryBus.cpp
@@ -123,14 +123,14 @@ namespace UnitTest
                 ASSERT_NE(AZ::IO::InvalidHandle, fileHandle);
 
                 size_t fileSize = 0;
-                char* pFileBuffer = (char*)archive->FGetCachedFileData(fileHandle, fileSize);
+                const char* pFileBuffer = (const char*)archive->FGetCachedFileData(fileHandle, fileSize);
                 ASSERT_NE(nullptr, pFileBuffer);
                 EXPECT_EQ(dataLen, fileSize);
                 EXPECT_EQ(0, memcmp(pFileBuffer, testData, dataLen));
 
                 // 2nd call to FGetCachedFileData, same file handle
                 fileSize = 0;
-                char* pFileBuffer2 = (char*)archive->FGetCachedFileData(fileHandle, fileSize);
+                const char* pFileBuffer2 = (const char*)archive->FGetCachedFileData(fileHandle, fileSize);
                 EXPECT_NE(nullptr, pFileBuffer2);
                 EXPECT_EQ(pFileBuffer, pFileBuffer2);
                 EXPECT_EQ(dataLen, fileSize);
@@ -139,7 +139,7 @@ namespace UnitTest
                 fileSize = 0;
                 {
                     AZ::IO::HandleType fileHandle2 = archive->FOpen(testFilePath, "rb");
-                    char* pFileBuffer3 = (char*)archive->FGetCachedFileData(fileHandle2, fileSize);
+                    const char* pFileBuffer3 = (const char*)archive->FGetCachedFileData(fileHandle2, fileSize);
                     ASSERT_NE(nullptr, pFileBuffer3);
                     EXPECT_EQ(dataLen, fileSize);
                     EXPECT_EQ(0, memcmp(pFileBuffer3, testData, dataLen));
@@ -755,6 +755,60 @@ namespace UnitTest
         EXPECT_TRUE(!archive->IsFileExist("testfile.xml"));
     }
 
+    TEST_F(ArchiveTestFixture, TestArchiveMemoryMappedReads_StoredAndCompressedEntries_ReadCorrectly)
+    {
+        using namespace AZ::IO;
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+        AZ::IO::ArchiveFileIO cpfio(archive);
+
+        auto console = AZ::Interface<AZ::IConsole>::Get();
+        ASSERT_NE(nullptr, console);
+
+        constexpr const char* mappedArchiveFileName = "@usercache@/testmappedarchive.pak";
+        constexpr AZStd::string_view dataString = "HELLO MAPPED WORLD";
+
+        archive->ClosePack(mappedArchiveFileName);
+        cpfio.Remove(mappedArchiveFileName);
+
+        AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(mappedArchiveFileName, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_EQ(0, pArchive->UpdateFile("stored.txt", dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_STORE));
+        EXPECT_EQ(0, pArchive->UpdateFile("compressed.txt", dataString.data(), dataString.size(), AZ::IO::INestedArchive::METHOD_COMPRESS, AZ::IO::INestedArchive::LEVEL_FASTEST));
+        pArchive.reset();
+
+        // packs opened from here on are mapped into memory
+        console->PerformCommand("az_archive_memory_mapped_reads", { "true" });
+        EXPECT_TRUE(archive->OpenPack("@products@", mappedArchiveFileName));
+
+        for (const char* fileName : { "stored.txt", "compressed.txt" })
+        {
+            // read a range in the middle of the file through the file IO interface
+            HandleType fileHandle = InvalidHandle;
+            char readBuffer[6] = { 0 };
+            AZ::u64 bytesRead = 0;
+            EXPECT_EQ(ResultCode::Success, cpfio.Open(fileName, OpenMode::ModeRead | OpenMode::ModeBinary, fileHandle));
+            EXPECT_EQ(ResultCode::Success, cpfio.Seek(fileHandle, 6, SeekType::SeekFromStart));
+            EXPECT_EQ(ResultCode::Success, cpfio.Read(fileHandle, readBuffer, sizeof(readBuffer), true, &bytesRead));
+            EXPECT_EQ(sizeof(readBuffer), bytesRead);
+            EXPECT_EQ(dataString.substr(6, sizeof(readBuffer)), AZStd::string_view(readBuffer, sizeof(readBuffer))) << fileName;
+            EXPECT_EQ(ResultCode::Success, cpfio.Close(fileHandle));
+
+            // and the whole file through the cached file data
+            fileHandle = archive->FOpen(fileName, "rb");
+            ASSERT_NE(InvalidHandle, fileHandle);
+            size_t fileSize = 0;
+            const char* fileData = reinterpret_cast<const char*>(archive->FGetCachedFileData(fileHandle, fileSize));
+            ASSERT_NE(nullptr, fileData);
+            EXPECT_EQ(dataString, AZStd::string_view(fileData, fileSize)) << fileName;
+            archive->FClose(fileHandle);
+        }
+
+        EXPECT_TRUE(archive->ClosePack(mappedArchiveFileName));
+        console->PerformCommand("az_archive_memory_mapped_reads", { "false" });
+        cpfio.Remove(mappedArchiveFileName);
+    }
+
     TEST_F(ArchiveTestFixture, TestArchiveFolderAliases)
     {
         AZ::IO::FileIOBase* fileIo = AZ::IO::FileIOBase::GetInstance();
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Asset/AssetPrefetchManifest.h>
+#include <AzFramework/Asset/AssetPrefetchSystemComponent.h>
+
+namespace UnitTest
+{
+    class AssetPrefetchRecorderTests
+        : public LeakDetectionFixture
+    {
+    protected:
+        static void QueueLoad(const AZ::Data::AssetId& assetId, AZStd::string_view streamName, AZ::u64 offset, AZ::u64 size)
+        {
+            AZ::Data::AssetManagerNotificationBus::Broadcast(&AZ::Data::AssetManagerNotificationBus::Events::OnAssetLoadQueued,
+                assetId, AZ::Data::AssetType::CreateNull(), streamName, offset, size);
+        }
+
+        const AZ::Data::AssetId m_assetId1{ AZ::Uuid("{D9A2F0B1-4C3E-4E5A-9B7D-1E2F3A4B5C6D}"), 0 };
+        const AZ::Data::AssetId m_assetId2{ AZ::Uuid("{0B1C2D3E-4F5A-4B6C-8D7E-9F0A1B2C3D4E}"), 0 };
+        const AZ::Data::AssetId m_assetId3{ AZ::Uuid("{5E6F7A8B-9C0D-4E1F-A2B3-C4D5E6F7A8B9}"), 0 };
+    };
+
+    TEST_F(AssetPrefetchRecorderTests, Stop_LoadsQueued_RecordsReadsInOrder)
+    {
+        AzFramework::AssetPrefetchRecorder recorder;
+        recorder.Start();
+        EXPECT_TRUE(recorder.IsRecording());
+
+        QueueLoad(m_assetId2, "@products@/b.bin", 0, 200);
+        QueueLoad(m_assetId1, "@products@/a.bin", 16, 100);
+        // Loading the same asset again doesn't record it twice, and reads without data aren't recorded
+        QueueLoad(m_assetId2, "@products@/b.bin", 0, 200);
+        QueueLoad(m_assetId3, "@products@/c.bin", 0, 0);
+
+        AzFramework::AssetPrefetchManifest manifest = recorder.Stop();
+        EXPECT_FALSE(recorder.IsRecording());
+
+        const auto& entries = manifest.GetEntries();
+        ASSERT_EQ(2u, entries.size());
+        EXPECT_EQ(m_assetId2, entries[0].m_assetId);
+        EXPECT_STREQ("@products@/b.bin", entries[0].m_streamName.c_str());
+        EXPECT_EQ(200u, entries[0].m_size);
+        EXPECT_EQ(m_assetId1, entries[1].m_assetId);
+        EXPECT_EQ(16u, entries[1].m_offset);
+        EXPECT_EQ(300u, manifest.GetTotalSize());
+    }
+
+    TEST_F(AssetPrefetchRecorderTests, Stop_LoadsQueuedAfterStop_AreNotRecorded)
+    {
+        AzFramework::AssetPrefetchRecorder recorder;
+        recorder.Start();
+        QueueLoad(m_assetId1, "@products@/a.bin", 0, 100);
+        AzFramework::AssetPrefetchManifest manifest = recorder.Stop();
+        QueueLoad(m_assetId2, "@products@/b.bin", 0, 200);
+
+        EXPECT_EQ(1u, manifest.GetEntries().size());
+        EXPECT_TRUE(recorder.Stop().GetEntries().empty());
+    }
+
+    TEST_F(AssetPrefetchRecorderTests, GetManifestPath_LevelAssetPath_UsesLevelName)
+    {
+        const AZStd::string manifestPath = AzFramework::AssetPrefetchSystemComponent::GetManifestPath("levels/mylevel/mylevel.spawnable");
+        EXPECT_EQ(AZStd::string("@user@/AssetPrefetch/mylevel.assetprefetch"), manifestPath);
+    }
+} // namespace UnitTest
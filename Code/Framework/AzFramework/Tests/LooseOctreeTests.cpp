@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Console/Console.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/Visibility/LooseOctreeScene.h>
+#include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <random>
+
+using namespace AzFramework;
+
+namespace UnitTest
+{
+    class LooseOctreeTests
+        : public LeakDetectionFixture
+        , public AZ::TaskGraphActiveInterface
+    {
+    public:
+        void SetUp() override
+        {
+            m_console = aznew AZ::Console();
+            AZ::Interface<AZ::IConsole>::Register(m_console);
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+
+            m_console->GetCvarValue("bg_octreeMaxWorldExtents", m_savedBounds);
+            m_console->GetCvarValue("bg_looseOctreeMaxDepth", m_savedMaxDepth);
+            m_console->GetCvarValue("bg_looseOctreeParallelMinNodes", m_savedParallelMinNodes);
+            m_console->PerformCommand("bg_octreeMaxWorldExtents 64"); // Create a -64,-64,-64 to 64,64,64 world volume
+            m_console->PerformCommand("bg_looseOctreeMaxDepth 6");
+            m_console->PerformCommand("bg_looseOctreeParallelMinNodes 1");
+
+            m_executor = aznew AZ::TaskExecutor();
+            AZ::TaskExecutor::SetInstance(m_executor);
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Register(this);
+
+            if (!AZ::NameDictionary::IsReady())
+            {
+                AZ::NameDictionary::Create();
+            }
+            m_octreeSystemComponent = new OctreeSystemComponent;
+            IVisibilityScene* visScene = m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("LooseOctreeUnitTestScene"), VisibilitySceneType::LooseOctree);
+            m_looseOctreeScene = azrtti_cast<LooseOctreeScene*>(visScene);
+        }
+
+        void TearDown() override
+        {
+            m_octreeSystemComponent->DestroyVisibilityScene(m_looseOctreeScene);
+            delete m_octreeSystemComponent;
+            m_octreeSystemComponent = nullptr;
+
+            AZ::NameDictionary::Destroy();
+
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(this);
+            if (&AZ::TaskExecutor::Instance() == m_executor)
+            {
+                AZ::TaskExecutor::SetInstance(nullptr);
+            }
+            azdestroy(m_executor);
+
+            // Restore the cvars for any future tests or benchmarks that might get executed
+            AZStd::string commandString;
+            commandString.format("bg_octreeMaxWorldExtents %f", m_savedBounds);
+            m_console->PerformCommand(commandString.c_str());
+            commandString.format("bg_looseOctreeMaxDepth %u", m_savedMaxDepth);
+            m_console->PerformCommand(commandString.c_str());
+            commandString.format("bg_looseOctreeParallelMinNodes %u", m_savedParallelMinNodes);
+            m_console->PerformCommand(commandString.c_str());
+
+            AZ::Interface<AZ::IConsole>::Unregister(m_console);
+            delete m_console;
+            m_console = nullptr;
+        }
+
+        bool IsTaskGraphActive() const override
+        {
+            return true;
+        }
+
+        // Creates randomly sized and placed entries within the world volume
+        void CreateRandomEntries(AZStd::vector<VisibilityEntry>& entries, size_t count)
+        {
+            std::mt19937 generator(12345);
+            std::uniform_real_distribution<float> positionDistribution(-60.0f, 60.0f);
+            std::uniform_real_distribution<float> sizeDistribution(0.0f, 3.0f);
+
+            entries.resize(count);
+            for (VisibilityEntry& entry : entries)
+            {
+                const AZ::Vector3 center(positionDistribution(generator), positionDistribution(generator), positionDistribution(generator));
+                // Every tenth entry is large, so that entries end up at all levels of the tree
+                const float halfSize = sizeDistribution(generator) * ((&entry - entries.data()) % 10 == 0 ? 10.0f : 1.0f);
+                entry.m_boundingVolume = AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(halfSize));
+                m_looseOctreeScene->InsertOrUpdateEntry(entry);
+            }
+        }
+
+        OctreeSystemComponent* m_octreeSystemComponent = nullptr;
+        LooseOctreeScene* m_looseOctreeScene = nullptr;
+        AZ::TaskExecutor* m_executor = nullptr;
+        float m_savedBounds = 0.0f;
+        uint32_t m_savedMaxDepth = 0;
+        uint32_t m_savedParallelMinNodes = 0;
+        AZ::Console* m_console = nullptr;
+    };
+
+    // Gathers the entries reported by an enumeration, and checks that every node contains the entries it reports
+    static IVisibilityScene::EnumerateCallback GatherEntries(AZStd::vector<VisibilityEntry*>& gatheredEntries)
+    {
+        return [&gatheredEntries](const IVisibilityScene::NodeData& nodeData)
+        {
+            for (VisibilityEntry* entry : nodeData.m_entries)
+            {
+                EXPECT_TRUE(AZ::ShapeIntersection::Contains(nodeData.m_bounds, entry->m_boundingVolume));
+            }
+            gatheredEntries.insert(gatheredEntries.end(), nodeData.m_entries.begin(), nodeData.m_entries.end());
+        };
+    }
+
+    // Every overlapping entry must be reported exactly once, entries that don't overlap may be reported as well
+    template<typename BoundType>
+    void ValidateEnumerateResult(
+        const AZStd::vector<VisibilityEntry>& entries, const BoundType& bounds, AZStd::vector<VisibilityEntry*> gatheredEntries)
+    {
+        AZStd::sort(gatheredEntries.begin(), gatheredEntries.end());
+        EXPECT_TRUE(AZStd::adjacent_find(gatheredEntries.begin(), gatheredEntries.end()) == gatheredEntries.end());
+
+        for (const VisibilityEntry& entry : entries)
+        {
+            if (AZ::ShapeIntersection::Overlaps(bounds, entry.m_boundingVolume))
+            {
+                EXPECT_TRUE(AZStd::binary_search(gatheredEntries.begin(), gatheredEntries.end(), &entry));
+            }
+        }
+    }
+
+    static AZ::Frustum CreateTestFrustum(const AZ::Vector3& origin, float nearClip, float farClip)
+    {
+        const AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateIdentity(), origin);
+        return AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.5f), nearClip, farClip));
+    }
+
+    TEST_F(LooseOctreeTests, CreateVisibilityScene_LooseOctreeType_CreatesLooseOctreeScene)
+    {
+        EXPECT_TRUE(m_looseOctreeScene != nullptr);
+        EXPECT_EQ(m_looseOctreeScene->GetMaxDepth(), 6u);
+    }
+
+    TEST_F(LooseOctreeTests, InsertUpdateRemoveEntry_NodesAreCreatedAndReleased)
+    {
+        AzFramework::VisibilityEntry visEntry;
+        visEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(1.0f), AZ::Vector3(1.5f));
+
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry);
+        EXPECT_TRUE(visEntry.m_internalNode != nullptr);
+        EXPECT_EQ(visEntry.m_internalNodeIndex, 0u);
+        EXPECT_EQ(m_looseOctreeScene->GetEntryCount(), 1u);
+        // The deepest level has cells of 2 units, and all ancestors up to the root are created as well
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 7u);
+
+        // Moving within the loose bounds of the same cell keeps the entry in its node
+        const uint64_t nodeKey = static_cast<LooseOctreeNode*>(visEntry.m_internalNode)->m_key;
+        visEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.5f), AZ::Vector3(1.0f));
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry);
+        EXPECT_EQ(static_cast<LooseOctreeNode*>(visEntry.m_internalNode)->m_key, nodeKey);
+        EXPECT_EQ(m_looseOctreeScene->GetEntryCount(), 1u);
+
+        // Moving to the other side of the world releases the old branch
+        visEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-40.0f), AZ::Vector3(-39.5f));
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry);
+        EXPECT_NE(static_cast<LooseOctreeNode*>(visEntry.m_internalNode)->m_key, nodeKey);
+        EXPECT_EQ(m_looseOctreeScene->GetFreeNodeCount(), 0u);
+        EXPECT_EQ(m_looseOctreeScene->GetEntryCount(), 1u);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 7u);
+
+        m_looseOctreeScene->RemoveEntry(visEntry);
+        EXPECT_TRUE(visEntry.m_internalNode == nullptr);
+        EXPECT_EQ(m_looseOctreeScene->GetEntryCount(), 0u);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 0u);
+
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+        m_looseOctreeScene->EnumerateNoCull(GatherEntries(gatheredEntries));
+        EXPECT_TRUE(gatheredEntries.empty());
+    }
+
+    TEST_F(LooseOctreeTests, InsertOrUpdateEntry_EntriesOutsideOfWorld_AreStoredInRoot)
+    {
+        AzFramework::VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(200.0f), AZ::Vector3(201.0f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateNull();
+
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry[0]);
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry[1]);
+        EXPECT_EQ(visEntry[0].m_internalNode, visEntry[1].m_internalNode);
+        EXPECT_EQ(m_looseOctreeScene->GetEntryCount(), 2u);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 1u);
+
+        m_looseOctreeScene->RemoveEntry(visEntry[0]);
+        m_looseOctreeScene->RemoveEntry(visEntry[1]);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 0u);
+    }
+
+    TEST_F(LooseOctreeTests, Enumerate_RandomEntries_ReportsAllOverlappingEntries)
+    {
+        AZStd::vector<VisibilityEntry> entries;
+        CreateRandomEntries(entries, 2000);
+
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+        m_looseOctreeScene->EnumerateNoCull(GatherEntries(gatheredEntries));
+        EXPECT_EQ(gatheredEntries.size(), entries.size());
+
+        const AZ::Aabb aabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-20.0f, -5.0f, 0.0f), AZ::Vector3(10.0f, 30.0f, 12.0f));
+        gatheredEntries.clear();
+        m_looseOctreeScene->Enumerate(aabb, GatherEntries(gatheredEntries));
+        ValidateEnumerateResult(entries, aabb, gatheredEntries);
+
+        const AZ::Sphere sphere(AZ::Vector3(15.0f, -10.0f, 5.0f), 25.0f);
+        gatheredEntries.clear();
+        m_looseOctreeScene->Enumerate(sphere, GatherEntries(gatheredEntries));
+        ValidateEnumerateResult(entries, sphere, gatheredEntries);
+
+        const AZ::Frustum frustum = CreateTestFrustum(AZ::Vector3(0.0f, -70.0f, 0.0f), 1.0f, 100.0f);
+        gatheredEntries.clear();
+        m_looseOctreeScene->Enumerate(frustum, GatherEntries(gatheredEntries));
+        ValidateEnumerateResult(entries, frustum, gatheredEntries);
+        EXPECT_LT(gatheredEntries.size(), entries.size());
+
+        // Removing half of the entries and enumerating again rebuilds the traversal order
+        for (size_t index = 0; index < entries.size(); index += 2)
+        {
+            m_looseOctreeScene->RemoveEntry(entries[index]);
+        }
+        gatheredEntries.clear();
+        m_looseOctreeScene->EnumerateNoCull(GatherEntries(gatheredEntries));
+        EXPECT_EQ(gatheredEntries.size(), entries.size() / 2);
+        EXPECT_EQ(m_looseOctreeScene->GetEntryCount(), entries.size() / 2);
+
+        for (size_t index = 1; index < entries.size(); index += 2)
+        {
+            m_looseOctreeScene->RemoveEntry(entries[index]);
+        }
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 0u);
+    }
+
+    TEST_F(LooseOctreeTests, EnumerateParallel_RandomEntries_MatchesEnumerate)
+    {
+        AZStd::vector<VisibilityEntry> entries;
+        CreateRandomEntries(entries, 5000);
+
+        const AZ::Frustum frustum = CreateTestFrustum(AZ::Vector3(10.0f, -70.0f, -5.0f), 1.0f, 120.0f);
+
+        AZStd::vector<VisibilityEntry*> serialEntries;
+        m_looseOctreeScene->Enumerate(frustum, GatherEntries(serialEntries));
+
+        AZStd::mutex gatherMutex;
+        AZStd::vector<VisibilityEntry*> parallelEntries;
+        m_looseOctreeScene->EnumerateParallel(
+            frustum,
+            [&gatherMutex, &parallelEntries](const IVisibilityScene::NodeData& nodeData)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(gatherMutex);
+                parallelEntries.insert(parallelEntries.end(), nodeData.m_entries.begin(), nodeData.m_entries.end());
+            });
+
+        AZStd::sort(serialEntries.begin(), serialEntries.end());
+        AZStd::sort(parallelEntries.begin(), parallelEntries.end());
+        EXPECT_EQ(serialEntries, parallelEntries);
+        ValidateEnumerateResult(entries, frustum, parallelEntries);
+
+        for (VisibilityEntry& entry : entries)
+        {
+            m_looseOctreeScene->RemoveEntry(entry);
+        }
+    }
+
+    TEST_F(LooseOctreeTests, EnumerateExcludeFrustum_RandomEntries_SkipsOnlyExcludedEntries)
+    {
+        AZStd::vector<VisibilityEntry> entries;
+        CreateRandomEntries(entries, 2000);
+
+        const AZ::Frustum include = CreateTestFrustum(AZ::Vector3(0.0f, -70.0f, 0.0f), 1.0f, 140.0f);
+        const AZ::Frustum exclude = CreateTestFrustum(AZ::Vector3(0.0f, -70.0f, 0.0f), 1.0f, 60.0f);
+
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+        m_looseOctreeScene->Enumerate(include, exclude, GatherEntries(gatheredEntries));
+        AZStd::sort(gatheredEntries.begin(), gatheredEntries.end());
+
+        size_t excludedCount = 0;
+        for (const VisibilityEntry& entry : entries)
+        {
+            const bool reported = AZStd::binary_search(gatheredEntries.begin(), gatheredEntries.end(), &entry);
+            if (AZ::ShapeIntersection::Overlaps(include, entry.m_boundingVolume) &&
+                !AZ::ShapeIntersection::Contains(exclude, entry.m_boundingVolume))
+            {
+                EXPECT_TRUE(reported);
+            }
+            excludedCount += reported ? 0 : 1;
+        }
+        EXPECT_GT(excludedCount, 0u);
+
+        for (VisibilityEntry& entry : entries)
+        {
+            m_looseOctreeScene->RemoveEntry(entry);
+        }
+    }
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UserSettings/UserSettingsComponent.h>
+#include <AzFramework/Application/Application.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Spawnable/SpawnableEntitiesManager.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Spawns and despawns all entities of a spawnable through the SpawnableEntitiesManager. Each entity has a transform
+    //! component, so the timings include the cloning of the entities and the fix up of their entity ids.
+    //! Arguments are:
+    //!     0 - The number of entities in the spawnable.
+    class SpawnableEntitiesManagerBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void internalSetUp(const ::benchmark::State& state)
+        {
+            m_application = AZStd::make_unique<AzFramework::Application>();
+            AZ::ComponentApplication::Descriptor descriptor;
+            AZ::ComponentApplication::StartupParameters startupParameters;
+            startupParameters.m_loadSettingsRegistry = false;
+            m_application->Start(descriptor, startupParameters);
+            // Prevent the user settings from being saved on shutdown, as the file is shared with the tests running in parallel.
+            AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::DisableSaveOnFinalize);
+
+            auto spawnable = aznew AzFramework::Spawnable(
+                AZ::Data::AssetId::CreateString("{3E0D7B49-8C1A-4F26-A5D3-9B7E2C4F1A60}:0"), AZ::Data::AssetData::AssetStatus::Ready);
+            AzFramework::Spawnable::EntityList& entities = spawnable->GetEntities();
+            const auto entityCount = aznumeric_cast<AZ::u64>(state.range(0));
+            entities.reserve(entityCount);
+            for (AZ::u64 index = 0; index < entityCount; ++index)
+            {
+                auto entity = AZStd::make_unique<AZ::Entity>(AZ::EntityId(index + 1));
+                entity->CreateComponent<AzFramework::TransformComponent>();
+                entities.push_back(AZStd::move(entity));
+            }
+            m_spawnableAsset = AZ::Data::Asset<AzFramework::Spawnable>(spawnable, AZ::Data::AssetLoadBehavior::Default);
+            m_ticket = AZStd::make_unique<AzFramework::EntitySpawnTicket>(m_spawnableAsset);
+
+            m_manager = azrtti_cast<AzFramework::SpawnableEntitiesManager*>(AzFramework::SpawnableEntitiesInterface::Get());
+        }
+
+        void internalTearDown()
+        {
+            m_ticket.reset();
+            ProcessQueue();
+            m_spawnableAsset.Reset();
+            m_manager = nullptr;
+            m_application.reset();
+        }
+
+        void ProcessQueue()
+        {
+            using Manager = AzFramework::SpawnableEntitiesManager;
+            while (m_manager->ProcessQueue(Manager::CommandQueuePriority::High | Manager::CommandQueuePriority::Regular) !=
+                Manager::CommandQueueStatus::NoCommandsLeft)
+            {
+            }
+        }
+
+        AZStd::unique_ptr<AzFramework::Application> m_application;
+        AZ::Data::Asset<AzFramework::Spawnable> m_spawnableAsset;
+        AZStd::unique_ptr<AzFramework::EntitySpawnTicket> m_ticket;
+        AzFramework::SpawnableEntitiesManager* m_manager{ nullptr };
+    };
+
+    BENCHMARK_DEFINE_F(SpawnableEntitiesManagerBenchmarkFixture, BM_SpawnAllEntities)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_manager->SpawnAllEntities(*m_ticket);
+            ProcessQueue();
+
+            state.PauseTiming();
+            m_manager->DespawnAllEntities(*m_ticket);
+            ProcessQueue();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SpawnableEntitiesManagerBenchmarkFixture, BM_SpawnAllEntities)
+        ->Arg(10)
+        ->Arg(1000)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(SpawnableEntitiesManagerBenchmarkFixture, BM_DespawnAllEntities)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            m_manager->SpawnAllEntities(*m_ticket);
+            ProcessQueue();
+            state.ResumeTiming();
+
+            m_manager->DespawnAllEntities(*m_ticket);
+            ProcessQueue();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(SpawnableEntitiesManagerBenchmarkFixture, BM_DespawnAllEntities)
+        ->Arg(10)
+        ->Arg(1000)
+        ->Unit(benchmark::kMicrosecond);
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
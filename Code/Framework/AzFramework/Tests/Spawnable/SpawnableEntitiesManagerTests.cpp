@@ -55,6 +55,26 @@ namespace UnitTest
         AZ::EntityId m_entityReference;
     };
 
+    class ComponentWithContainer : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ComponentWithContainer, "{6A1E4B3C-2D8F-4E57-9C0B-7F3A5D61E2B4}");
+
+        void Activate() override {}
+        void Deactivate() override {}
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection))
+            {
+                serializeContext->Class<ComponentWithContainer, AZ::Component>()
+                    ->Field("Values", &ComponentWithContainer::m_values);
+            }
+        }
+
+        AZStd::vector<int> m_values;
+    };
+
     class SourceSpawnableComponent : public AZ::Component
     {
     public:
@@ -113,6 +133,7 @@ namespace UnitTest
             startupParameters.m_loadSettingsRegistry = false;
             m_application->Start(descriptor, startupParameters);
             m_application->RegisterComponentDescriptor(ComponentWithEntityReference::CreateDescriptor());
+            m_application->RegisterComponentDescriptor(ComponentWithContainer::CreateDescriptor());
             m_application->RegisterComponentDescriptor(SourceSpawnableComponent::CreateDescriptor());
             m_application->RegisterComponentDescriptor(TargetSpawnableComponent::CreateDescriptor());
 
@@ -622,6 +643,223 @@ namespace UnitTest
         }
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_ReferencesAddedAfterSpawn_EntityIdsAreMappedCorrectly)
+    {
+        // The first spawn builds the spawn template of the spawnable. Adding references afterwards needs to discard it, otherwise the
+        // new references would be cloned without being remapped.
+        constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        m_manager->SpawnAllEntities(*m_ticket);
+        ProcessQueueTillEmtpy();
+
+        delete m_ticket;
+        m_ticket = aznew AzFramework::EntitySpawnTicket(*m_spawnableAsset);
+        CreateEntityReferences(EntityReferenceScheme::AllReferenceNextCircular);
+
+        size_t spawnedEntitiesCount = 0;
+        auto callback =
+            [this, &spawnedEntitiesCount](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            spawnedEntitiesCount = entities.size();
+            ValidateEntityReferences(EntityReferenceScheme::AllReferenceNextCircular, NumEntities, entities);
+        };
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_completionCallback = AZStd::move(callback);
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        ProcessQueueTillEmtpy();
+
+        EXPECT_EQ(NumEntities, spawnedEntitiesCount);
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, GetSpawnTemplate_ComponentsWithReferences_OnlyComponentsWithEntityIdsAreListed)
+    {
+        constexpr size_t NumEntities = 2;
+        FillSpawnable(NumEntities);
+        CreateEntityReferences(EntityReferenceScheme::AllReferenceFirst);
+
+        const AzFramework::Spawnable& spawnable = *m_spawnable;
+        const AzFramework::Spawnable::SpawnTemplate& spawnTemplate =
+            spawnable.GetSpawnTemplate(*m_application->GetSerializeContext());
+
+        ASSERT_EQ(NumEntities, spawnTemplate.m_componentsWithEntityIds.size());
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            // The SourceSpawnableComponent doesn't have any entity ids, the ComponentWithEntityReference that was added after it does.
+            ASSERT_EQ(1u, spawnTemplate.m_componentsWithEntityIds[i].size());
+            EXPECT_EQ(1u, spawnTemplate.m_componentsWithEntityIds[i][0]);
+        }
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_PoolableSpawnableRespawned_EntitiesAreReusedAndReset)
+    {
+        constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        CreateEntityReferences(EntityReferenceScheme::AllReferenceNextCircular);
+        m_spawnable->SetPoolable(true);
+
+        AZStd::vector<const AZ::Entity*> firstSpawn;
+        AzFramework::SpawnAllEntitiesOptionalArgs firstArgs;
+        firstArgs.m_completionCallback =
+            [&firstSpawn](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            for (const AZ::Entity* entity : entities)
+            {
+                firstSpawn.push_back(entity);
+                // Change the serialized state so the respawn needs to reset it.
+                entity->FindComponent<ComponentWithEntityReference>()->m_entityReference.SetInvalid();
+            }
+        };
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(firstArgs));
+        m_manager->DespawnAllEntities(*m_ticket);
+
+        AZStd::vector<const AZ::Entity*> secondSpawn;
+        AzFramework::SpawnAllEntitiesOptionalArgs secondArgs;
+        secondArgs.m_completionCallback =
+            [this, &secondSpawn](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            secondSpawn.assign(entities.begin(), entities.end());
+            ValidateEntityReferences(EntityReferenceScheme::AllReferenceNextCircular, NumEntities, entities);
+        };
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(secondArgs));
+        ProcessQueueTillEmtpy();
+
+        ASSERT_EQ(NumEntities, firstSpawn.size());
+        ASSERT_EQ(NumEntities, secondSpawn.size());
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            EXPECT_EQ(firstSpawn[i], secondSpawn[i]);
+        }
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_PoolableSpawnableWithContainerRespawned_ContainerIsReset)
+    {
+        constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        for (AZStd::unique_ptr<AZ::Entity>& entity : m_spawnable->GetEntities())
+        {
+            entity->CreateComponent<ComponentWithContainer>()->m_values = { 1, 2 };
+        }
+        m_spawnable->SetPoolable(true);
+
+        AZStd::vector<const AZ::Entity*> firstSpawn;
+        AzFramework::SpawnAllEntitiesOptionalArgs firstArgs;
+        firstArgs.m_completionCallback =
+            [&firstSpawn](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            for (const AZ::Entity* entity : entities)
+            {
+                firstSpawn.push_back(entity);
+                // Grow the container so the respawn has to drop the added values instead of merging the prototype into them.
+                AZStd::vector<int>& values = entity->FindComponent<ComponentWithContainer>()->m_values;
+                values.push_back(3);
+                values.push_back(4);
+            }
+        };
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(firstArgs));
+        m_manager->DespawnAllEntities(*m_ticket);
+
+        AZStd::vector<const AZ::Entity*> secondSpawn;
+        AZStd::vector<AZStd::vector<int>> secondValues;
+        AzFramework::SpawnAllEntitiesOptionalArgs secondArgs;
+        secondArgs.m_completionCallback =
+            [&secondSpawn, &secondValues](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            for (const AZ::Entity* entity : entities)
+            {
+                secondSpawn.push_back(entity);
+                secondValues.push_back(entity->FindComponent<ComponentWithContainer>()->m_values);
+            }
+        };
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(secondArgs));
+        ProcessQueueTillEmtpy();
+
+        ASSERT_EQ(NumEntities, firstSpawn.size());
+        ASSERT_EQ(NumEntities, secondSpawn.size());
+        const AZStd::vector<int> expectedValues = { 1, 2 };
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            EXPECT_EQ(firstSpawn[i], secondSpawn[i]);
+            EXPECT_EQ(expectedValues, secondValues[i]);
+        }
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_NotPoolableSpawnableRespawned_NewEntitiesAreSpawned)
+    {
+        constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+
+        AZStd::vector<AZ::EntityId> firstSpawn;
+        AzFramework::SpawnAllEntitiesOptionalArgs firstArgs;
+        firstArgs.m_completionCallback =
+            [&firstSpawn](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            for (const AZ::Entity* entity : entities)
+            {
+                firstSpawn.push_back(entity->GetId());
+            }
+        };
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(firstArgs));
+        m_manager->DespawnAllEntities(*m_ticket);
+
+        size_t reusedIds = 0;
+        AzFramework::SpawnAllEntitiesOptionalArgs secondArgs;
+        secondArgs.m_completionCallback =
+            [&firstSpawn, &reusedIds](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            for (const AZ::Entity* entity : entities)
+            {
+                reusedIds += AZStd::find(firstSpawn.begin(), firstSpawn.end(), entity->GetId()) != firstSpawn.end() ? 1 : 0;
+            }
+        };
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(secondArgs));
+        ProcessQueueTillEmtpy();
+
+        EXPECT_EQ(NumEntities, firstSpawn.size());
+        EXPECT_EQ(0, reusedIds);
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_FrameBudgetExhausted_SpawnIsSplitAcrossCallsAndBarrierWaits)
+    {
+        static constexpr size_t NumEntities = 64;
+        FillSpawnable(NumEntities);
+
+        size_t preInsertionCount = 0;
+        size_t spawnedEntitiesCount = 0;
+        size_t completionCallCount = 0;
+        bool barrierCalled = false;
+        AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+        optionalArgs.m_preInsertionCallback =
+            [&preInsertionCount](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableEntityContainerView entities)
+        {
+            preInsertionCount = entities.size();
+        };
+        optionalArgs.m_completionCallback =
+            [&spawnedEntitiesCount, &completionCallCount, &barrierCalled](
+                AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            EXPECT_FALSE(barrierCalled);
+            spawnedEntitiesCount += entities.size();
+            ++completionCallCount;
+        };
+        m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+        m_manager->Barrier(*m_ticket, [&barrierCalled](AzFramework::EntitySpawnTicket::Id) { barrierCalled = true; });
+
+        m_manager->SetFrameBudget(AZStd::chrono::microseconds(1));
+        EXPECT_EQ(
+            AzFramework::SpawnableEntitiesManager::CommandQueueStatus::HasCommandsLeft,
+            m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular));
+        EXPECT_EQ(0, completionCallCount);
+        EXPECT_FALSE(barrierCalled);
+
+        ProcessQueueTillEmtpy();
+        m_manager->SetFrameBudget(AZStd::chrono::microseconds(0));
+
+        EXPECT_EQ(NumEntities, preInsertionCount);
+        EXPECT_EQ(NumEntities, spawnedEntitiesCount);
+        EXPECT_EQ(1, completionCallCount);
+        EXPECT_TRUE(barrierCalled);
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_DeleteTicketBeforeCall_NoCrash)
     {
         {
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzFramework/Spawnable/SpawnableEntityIdMap.h>
+#include <AzTest/AzTest.h>
+
+namespace UnitTest
+{
+    class SpawnableEntityIdMapTest : public LeakDetectionFixture
+    {
+    public:
+        static constexpr size_t EntityCount = 4;
+
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+
+            m_serializeContext = aznew AZ::SerializeContext();
+            m_spawnable = aznew AzFramework::Spawnable();
+            AzFramework::Spawnable::EntityList& entities = m_spawnable->GetEntities();
+            for (size_t i = 0; i < EntityCount; ++i)
+            {
+                entities.push_back(AZStd::make_unique<AZ::Entity>());
+            }
+        }
+
+        void TearDown() override
+        {
+            m_idMap.Clear();
+            delete m_spawnable;
+            m_spawnable = nullptr;
+            delete m_serializeContext;
+            m_serializeContext = nullptr;
+
+            LeakDetectionFixture::TearDown();
+        }
+
+        void InitializeIdMap()
+        {
+            const AzFramework::Spawnable& spawnable = *m_spawnable;
+            m_idMap.Initialize(spawnable.GetEntities(), spawnable.GetSpawnTemplate(*m_serializeContext));
+        }
+
+        AZ::EntityId GetPrototypeId(size_t index) const
+        {
+            const AzFramework::Spawnable& spawnable = *m_spawnable;
+            return spawnable.GetEntities()[index]->GetId();
+        }
+
+        AZ::SerializeContext* m_serializeContext{ nullptr };
+        AzFramework::Spawnable* m_spawnable{ nullptr };
+        AzFramework::SpawnableEntityIdMap m_idMap;
+    };
+
+    TEST_F(SpawnableEntityIdMapTest, Initialize_EntitiesInSpawnable_EveryEntityIsMappedToNewId)
+    {
+        InitializeIdMap();
+
+        EXPECT_FALSE(m_idMap.empty());
+        for (size_t i = 0; i < EntityCount; ++i)
+        {
+            auto it = m_idMap.find(GetPrototypeId(i));
+            ASSERT_NE(m_idMap.end(), it);
+            EXPECT_EQ(GetPrototypeId(i), it->first);
+            EXPECT_TRUE(it->second.IsValid());
+            EXPECT_NE(GetPrototypeId(i), it->second);
+        }
+    }
+
+    TEST_F(SpawnableEntityIdMapTest, Refresh_FirstSpawn_KeepsGeneratedId)
+    {
+        InitializeIdMap();
+        const AZ::EntityId generatedId = m_idMap.find(GetPrototypeId(1))->second;
+
+        m_idMap.Refresh(1);
+        EXPECT_EQ(generatedId, m_idMap.find(GetPrototypeId(1))->second);
+    }
+
+    TEST_F(SpawnableEntityIdMapTest, Refresh_SecondSpawn_GeneratesNewId)
+    {
+        InitializeIdMap();
+        m_idMap.Refresh(1);
+        const AZ::EntityId firstId = m_idMap.find(GetPrototypeId(1))->second;
+
+        m_idMap.Refresh(1);
+        const AZ::EntityId secondId = m_idMap.find(GetPrototypeId(1))->second;
+        EXPECT_TRUE(secondId.IsValid());
+        EXPECT_NE(firstId, secondId);
+    }
+
+    TEST_F(SpawnableEntityIdMapTest, Assign_ExistingId_IsMappedAndMarkedAsSpawned)
+    {
+        InitializeIdMap();
+        const AZ::EntityId existingId = AZ::Entity::MakeId();
+
+        m_idMap.Assign(2, existingId);
+        EXPECT_EQ(existingId, m_idMap.find(GetPrototypeId(2))->second);
+
+        // The entity is marked as spawned, so spawning it again gives it a new id.
+        m_idMap.Refresh(2);
+        EXPECT_NE(existingId, m_idMap.find(GetPrototypeId(2))->second);
+    }
+
+    TEST_F(SpawnableEntityIdMapTest, Emplace_IdInSpawnable_KeepsExistingMapping)
+    {
+        InitializeIdMap();
+        const AZ::EntityId generatedId = m_idMap.find(GetPrototypeId(0))->second;
+
+        auto [it, inserted] = m_idMap.emplace(GetPrototypeId(0), AZ::Entity::MakeId());
+        EXPECT_FALSE(inserted);
+        EXPECT_EQ(generatedId, it->second);
+    }
+
+    TEST_F(SpawnableEntityIdMapTest, Emplace_IdNotInSpawnable_IsAddedAsSeparateMapping)
+    {
+        InitializeIdMap();
+        const AZ::EntityId otherId = AZ::Entity::MakeId();
+        const AZ::EntityId mappedId = AZ::Entity::MakeId();
+
+        EXPECT_EQ(m_idMap.end(), m_idMap.find(otherId));
+        auto [it, inserted] = m_idMap.emplace(otherId, mappedId);
+        EXPECT_TRUE(inserted);
+        EXPECT_EQ(mappedId, it->second);
+        ASSERT_NE(m_idMap.end(), m_idMap.find(otherId));
+        EXPECT_EQ(mappedId, m_idMap.find(otherId)->second);
+
+        // Initializing again starts over with only the entities of the spawnable.
+        InitializeIdMap();
+        EXPECT_EQ(m_idMap.end(), m_idMap.find(otherId));
+    }
+} // namespace UnitTest
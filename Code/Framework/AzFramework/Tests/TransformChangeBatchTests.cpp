@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Components/TransformChangeBatchSystem.h>
+
+namespace UnitTest
+{
+    class TransformChangeBatchRecorder : public AzFramework::TransformChangeBatchNotificationBus::Handler
+    {
+    public:
+        TransformChangeBatchRecorder()
+        {
+            BusConnect();
+        }
+
+        ~TransformChangeBatchRecorder() override
+        {
+            BusDisconnect();
+        }
+
+        void OnTransformsChanged(AZStd::span<const AZ::EntityId> entityIds, AZStd::span<const AZ::Transform> worldTMs) override
+        {
+            ++m_batchCount;
+            m_entityIds.assign(entityIds.begin(), entityIds.end());
+            m_worldTMs.assign(worldTMs.begin(), worldTMs.end());
+        }
+
+        int m_batchCount = 0;
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AZStd::vector<AZ::Transform> m_worldTMs;
+    };
+
+    using TransformChangeBatchTestFixture = LeakDetectionFixture;
+
+    TEST_F(TransformChangeBatchTestFixture, FlushTransformChanges_EntityChangedMultipleTimes_DeliversLatestTransformOnce)
+    {
+        AzFramework::TransformChangeBatchSystem batchSystem;
+        TransformChangeBatchRecorder recorder;
+
+        const AZ::EntityId firstEntity(1);
+        const AZ::EntityId secondEntity(2);
+        const AZ::Transform firstTM = AZ::Transform::CreateTranslation(AZ::Vector3(1.0f, 0.0f, 0.0f));
+        const AZ::Transform secondTM = AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 2.0f, 0.0f));
+        const AZ::Transform latestTM = AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 0.0f, 3.0f));
+
+        batchSystem.OnTransformUpdated(firstEntity, firstTM);
+        batchSystem.OnTransformUpdated(secondEntity, secondTM);
+        batchSystem.OnTransformUpdated(firstEntity, latestTM);
+        batchSystem.FlushTransformChanges();
+
+        EXPECT_EQ(1, recorder.m_batchCount);
+        ASSERT_EQ(2u, recorder.m_entityIds.size());
+        ASSERT_EQ(2u, recorder.m_worldTMs.size());
+        EXPECT_EQ(firstEntity, recorder.m_entityIds[0]);
+        EXPECT_TRUE(recorder.m_worldTMs[0].IsClose(latestTM));
+        EXPECT_EQ(secondEntity, recorder.m_entityIds[1]);
+        EXPECT_TRUE(recorder.m_worldTMs[1].IsClose(secondTM));
+
+        // the batch is cleared after it was delivered
+        batchSystem.FlushTransformChanges();
+        EXPECT_EQ(1, recorder.m_batchCount);
+    }
+
+    TEST_F(TransformChangeBatchTestFixture, OnTransformUpdated_NoListeners_NothingIsDelivered)
+    {
+        AzFramework::TransformChangeBatchSystem batchSystem;
+        batchSystem.OnTransformUpdated(AZ::EntityId(1), AZ::Transform::CreateIdentity());
+
+        TransformChangeBatchRecorder recorder;
+        batchSystem.FlushTransformChanges();
+        EXPECT_EQ(0, recorder.m_batchCount);
+    }
+} // namespace UnitTest
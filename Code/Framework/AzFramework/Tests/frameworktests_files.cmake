@@ -9,7 +9,9 @@
 set(FILES
     Main.cpp
     Spawnable/SpawnableEntitiesInterfaceTests.cpp
+    Spawnable/SpawnableEntitiesManagerBenchmarks.cpp
     Spawnable/SpawnableEntitiesManagerTests.cpp
+    Spawnable/SpawnableEntityIdMapTests.cpp
     Spawnable/SpawnableScriptMediatorTests.cpp
     Spawnable/SpawnableTests.cpp
     ArchiveCompressionTests.cpp
@@ -25,9 +27,11 @@ set(FILES
     GenAppDescriptors.cpp
     OctreePerformanceTests.cpp
     OctreeTests.cpp
+    LooseOctreeTests.cpp
     AssetCatalog.cpp
     AssetRegistry.cpp
     AssetProcessorConnection.cpp
+    AssetPrefetchManifestTests.cpp
     ProcessLaunchParseTests.cpp
     Application.cpp
     PlatformHelper.cpp
@@ -43,5 +47,6 @@ set(FILES
     PaintBrush/PaintBrushPaintSettingsTests.cpp
     PaintBrush/PaintBrushSmoothLocationTests.cpp
     QualitySystemComponentTests.cpp
+    TransformChangeBatchTests.cpp
     DeviceAttributeSystemComponentTests.cpp
 )
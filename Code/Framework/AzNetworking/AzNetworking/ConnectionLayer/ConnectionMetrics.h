@@ -136,6 +136,9 @@ namespace AzNetworking
         uint32_t m_packetsLost  = 0;
         uint32_t m_packetsAcked = 0;
 
+        //! The send rate allowed by the connection's congestion controller in bytes per second, 0 if the send rate is not limited.
+        uint32_t m_sendRateLimitBytesPerSecond = 0;
+
         DatarateMetrics      m_sendDatarate;
         DatarateMetrics      m_recvDatarate;
         ConnectionComputeRtt m_connectionRtt;
@@ -8,16 +8,34 @@
 
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
 #include <climits>
 #include <cinttypes>
 
 namespace AzNetworking
 {
+    TimeoutQueue::TimeoutQueue(TimeoutQueueMode mode)
+        : m_mode(mode)
+    {
+        m_wheelSlots.fill(InvalidWheelIndex);
+    }
+
+    TimeoutQueueMode TimeoutQueue::GetMode() const
+    {
+        return m_mode;
+    }
+
     void TimeoutQueue::Reset()
     {
         m_timeoutItemMap.clear();
         m_timeoutItemQueue = TimeoutItemQueue();
         m_nextTimeoutId = TimeoutId{0};
+
+        m_wheelEntries.clear();
+        m_freeWheelEntries.clear();
+        m_wheelEntryLookup.clear();
+        m_wheelSlots.fill(InvalidWheelIndex);
+        m_wheelTimeMs = AZ::Time::ZeroTimeMs;
     }
 
     TimeoutId TimeoutQueue::RegisterItem(uint64_t userData, AZ::TimeMs timeoutMs)
@@ -32,9 +50,38 @@ namespace AzNetworking
             aznumeric_cast<uint32_t>(timeoutTimeMs)
         );
 
-        TimeoutQueueItem queueItem(timeoutId, timeoutTimeMs);
-        m_timeoutItemMap[timeoutId] = TimeoutItem(userData, timeoutMs);
-        m_timeoutItemQueue.push(queueItem);
+        if (m_mode == TimeoutQueueMode::TimingWheel)
+        {
+            if (m_wheelEntryLookup.empty())
+            {
+                // Nothing is pending, so start the wheel at the current time rather than stepping through the idle period
+                m_wheelTimeMs = AZStd::max(m_wheelTimeMs, AZ::GetElapsedTimeMs());
+            }
+
+            uint32_t entryIndex = InvalidWheelIndex;
+            if (!m_freeWheelEntries.empty())
+            {
+                entryIndex = m_freeWheelEntries.back();
+                m_freeWheelEntries.pop_back();
+            }
+            else
+            {
+                entryIndex = aznumeric_cast<uint32_t>(m_wheelEntries.size());
+                m_wheelEntries.emplace_back();
+            }
+
+            WheelEntry& entry = m_wheelEntries[entryIndex];
+            entry.m_item = TimeoutItem(userData, timeoutMs);
+            entry.m_timeoutId = timeoutId;
+            m_wheelEntryLookup[timeoutId] = entryIndex;
+            InsertWheelEntry(entryIndex, timeoutTimeMs);
+        }
+        else
+        {
+            TimeoutQueueItem queueItem(timeoutId, timeoutTimeMs);
+            m_timeoutItemMap[timeoutId] = TimeoutItem(userData, timeoutMs);
+            m_timeoutItemQueue.push(queueItem);
+        }
         ++m_nextTimeoutId;
 
         return timeoutId;
@@ -44,6 +91,12 @@ namespace AzNetworking
     {
         AZStd::lock_guard lock(m_mutex);
 
+        if (m_mode == TimeoutQueueMode::TimingWheel)
+        {
+            auto lookupIter = m_wheelEntryLookup.find(timeoutId);
+            return (lookupIter != m_wheelEntryLookup.end()) ? &m_wheelEntries[lookupIter->second].m_item : nullptr;
+        }
+
         TimeoutItemMap::iterator iter = m_timeoutItemMap.find(timeoutId);
         if (iter != m_timeoutItemMap.end())
         {
@@ -56,6 +109,16 @@ namespace AzNetworking
     {
         AZStd::lock_guard lock(m_mutex);
 
+        if (m_mode == TimeoutQueueMode::TimingWheel)
+        {
+            auto lookupIter = m_wheelEntryLookup.find(timeoutId);
+            if (lookupIter != m_wheelEntryLookup.end())
+            {
+                RemoveWheelEntry(lookupIter->second);
+            }
+            return;
+        }
+
         m_timeoutItemMap.erase(timeoutId);
     }
 
@@ -63,11 +126,24 @@ namespace AzNetworking
     {
         AZStd::lock_guard lock(m_mutex);
 
-        int32_t numTimeouts = 0;
         if (maxTimeouts < 0)
         {
             maxTimeouts = INT_MAX;
         }
+
+        if (m_mode == TimeoutQueueMode::TimingWheel)
+        {
+            UpdateWheelTimeouts(timeoutHandler, maxTimeouts);
+        }
+        else
+        {
+            UpdateQueueTimeouts(timeoutHandler, maxTimeouts);
+        }
+    }
+
+    void TimeoutQueue::UpdateQueueTimeouts(const TimeoutHandler& timeoutHandler, int32_t maxTimeouts)
+    {
+        int32_t numTimeouts = 0;
         AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
         while (m_timeoutItemQueue.size() > 0)
         {
@@ -131,4 +207,160 @@ namespace AzNetworking
             m_timeoutItemMap.erase(itemTimeoutId);
         }
     }
+
+    void TimeoutQueue::UpdateWheelTimeouts(const TimeoutHandler& timeoutHandler, int32_t maxTimeouts)
+    {
+        int32_t numTimeouts = 0;
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+
+        // Matching the priority queue, items time out once the current time has passed their timeout time
+        while (m_wheelTimeMs < currentTimeMs)
+        {
+            if (m_wheelEntryLookup.empty())
+            {
+                m_wheelTimeMs = currentTimeMs;
+                break;
+            }
+
+            // Expire every entry in the level 0 slot for the current millisecond
+            const uint32_t slot = static_cast<uint32_t>(aznumeric_cast<uint64_t>(m_wheelTimeMs) & WheelSlotMask);
+            while (m_wheelSlots[slot] != InvalidWheelIndex)
+            {
+                if (numTimeouts >= maxTimeouts)
+                {
+                    // Leave the wheel on this millisecond so the remaining entries are expired on the next update
+                    AZLOG_WARN("Terminating timeout queue iteration due to hitting timeout count limit: %d", numTimeouts);
+                    return;
+                }
+                ++numTimeouts;
+
+                const uint32_t entryIndex = m_wheelSlots[slot];
+                UnlinkWheelEntry(entryIndex);
+
+                // Check to see if the item has been refreshed since it was inserted
+                if (m_wheelEntries[entryIndex].m_item.m_nextTimeoutTimeMs > currentTimeMs)
+                {
+                    InsertWheelEntry(entryIndex, m_wheelEntries[entryIndex].m_item.m_nextTimeoutTimeMs);
+                    continue;
+                }
+
+                // The handler may register or remove items, which can invalidate references into the entry storage
+                const TimeoutId itemTimeoutId = m_wheelEntries[entryIndex].m_timeoutId;
+                TimeoutItem item = m_wheelEntries[entryIndex].m_item;
+                const TimeoutResult result = timeoutHandler(item);
+
+                auto lookupIter = m_wheelEntryLookup.find(itemTimeoutId);
+                if (lookupIter == m_wheelEntryLookup.end())
+                {
+                    // Item was removed by the handler, just continue
+                    continue;
+                }
+
+                WheelEntry& entry = m_wheelEntries[lookupIter->second];
+                if (result == TimeoutResult::Refresh)
+                {
+                    entry.m_item.UpdateTimeoutTime(currentTimeMs);
+                    InsertWheelEntry(lookupIter->second, entry.m_item.m_nextTimeoutTimeMs);
+                    continue;
+                }
+
+                AZLOG(TimeoutQueue, "Popping timeoutid %u with user data %" PRIu64 ", expire time %d, current time %u",
+                    aznumeric_cast<uint32_t>(itemTimeoutId),
+                    entry.m_item.m_userData,
+                    aznumeric_cast<uint32_t>(entry.m_item.m_nextTimeoutTimeMs),
+                    aznumeric_cast<uint32_t>(currentTimeMs));
+
+                RemoveWheelEntry(lookupIter->second);
+            }
+
+            ++m_wheelTimeMs;
+
+            // Crossing a slot boundary of a higher level moves that slot's entries down into the finer levels
+            const uint64_t wheelTime = aznumeric_cast<uint64_t>(m_wheelTimeMs);
+            for (uint32_t level = WheelLevelCount - 1; level > 0; --level)
+            {
+                const uint64_t levelMask = (uint64_t(1) << (WheelLevelBits * level)) - 1;
+                if ((wheelTime & levelMask) == 0)
+                {
+                    CascadeWheelSlot(level);
+                }
+            }
+        }
+    }
+
+    void TimeoutQueue::InsertWheelEntry(uint32_t entryIndex, AZ::TimeMs expiryTimeMs)
+    {
+        // Entries are placed on the finest level whose span still contains both the wheel time and the expiry time
+        // Expiry times beyond the range of the top level are clamped, they cascade back down and are re-checked when they expire
+        static constexpr uint64_t MaxWheelDelayMs = (uint64_t(1) << (WheelLevelBits * WheelLevelCount - 1)) - 1;
+        const uint64_t wheelTime = aznumeric_cast<uint64_t>(m_wheelTimeMs);
+        const uint64_t expiryTime = AZStd::min(AZStd::max(aznumeric_cast<uint64_t>(expiryTimeMs), wheelTime), wheelTime + MaxWheelDelayMs);
+
+        uint32_t level = 0;
+        while ((level < WheelLevelCount - 1) && ((expiryTime >> (WheelLevelBits * (level + 1))) != (wheelTime >> (WheelLevelBits * (level + 1)))))
+        {
+            ++level;
+        }
+
+        const uint32_t slot = level * WheelSlotCount + static_cast<uint32_t>((expiryTime >> (WheelLevelBits * level)) & WheelSlotMask);
+        WheelEntry& entry = m_wheelEntries[entryIndex];
+        entry.m_expiryTimeMs = AZ::TimeMs(expiryTime);
+        entry.m_slot = slot;
+        entry.m_prev = InvalidWheelIndex;
+        entry.m_next = m_wheelSlots[slot];
+        if (entry.m_next != InvalidWheelIndex)
+        {
+            m_wheelEntries[entry.m_next].m_prev = entryIndex;
+        }
+        m_wheelSlots[slot] = entryIndex;
+    }
+
+    void TimeoutQueue::UnlinkWheelEntry(uint32_t entryIndex)
+    {
+        WheelEntry& entry = m_wheelEntries[entryIndex];
+        if (entry.m_slot == InvalidWheelIndex)
+        {
+            return;
+        }
+
+        if (entry.m_prev != InvalidWheelIndex)
+        {
+            m_wheelEntries[entry.m_prev].m_next = entry.m_next;
+        }
+        else
+        {
+            m_wheelSlots[entry.m_slot] = entry.m_next;
+        }
+
+        if (entry.m_next != InvalidWheelIndex)
+        {
+            m_wheelEntries[entry.m_next].m_prev = entry.m_prev;
+        }
+
+        entry.m_slot = InvalidWheelIndex;
+        entry.m_prev = InvalidWheelIndex;
+        entry.m_next = InvalidWheelIndex;
+    }
+
+    void TimeoutQueue::RemoveWheelEntry(uint32_t entryIndex)
+    {
+        UnlinkWheelEntry(entryIndex);
+        m_wheelEntryLookup.erase(m_wheelEntries[entryIndex].m_timeoutId);
+        m_freeWheelEntries.push_back(entryIndex);
+    }
+
+    void TimeoutQueue::CascadeWheelSlot(uint32_t level)
+    {
+        const uint64_t wheelTime = aznumeric_cast<uint64_t>(m_wheelTimeMs);
+        const uint32_t slot = level * WheelSlotCount + static_cast<uint32_t>((wheelTime >> (WheelLevelBits * level)) & WheelSlotMask);
+
+        uint32_t entryIndex = m_wheelSlots[slot];
+        m_wheelSlots[slot] = InvalidWheelIndex;
+        while (entryIndex != InvalidWheelIndex)
+        {
+            const uint32_t nextIndex = m_wheelEntries[entryIndex].m_next;
+            InsertWheelEntry(entryIndex, m_wheelEntries[entryIndex].m_expiryTimeMs);
+            entryIndex = nextIndex;
+        }
+    }
 }
@@ -10,8 +10,11 @@
 
 #include <AzCore/Time/ITime.h>
 #include <AzCore/RTTI/TypeSafeIntegral.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AzNetworking
 {
@@ -23,6 +26,13 @@ namespace AzNetworking
         Delete
     };
 
+    //! The storage strategy used by a TimeoutQueue.
+    enum class TimeoutQueueMode
+    {
+        PriorityQueue, //!< Items are ordered in a priority queue, insertion is O(log n) and removed items are discarded lazily
+        TimingWheel    //!< Items are bucketed into a hierarchical timing wheel, insertion and removal are O(1) and expiry is per bucket
+    };
+
     //! @class TimeoutQueue
     //! @brief class for managing timeout items.
     class TimeoutQueue
@@ -41,9 +51,13 @@ namespace AzNetworking
             AZ::TimeMs m_nextTimeoutTimeMs = AZ::Time::ZeroTimeMs;
         };
 
-        TimeoutQueue() = default;
+        explicit TimeoutQueue(TimeoutQueueMode mode = TimeoutQueueMode::PriorityQueue);
         ~TimeoutQueue() = default;
 
+        //! Returns the storage strategy used by this timeout queue.
+        //! @return the storage strategy used by this timeout queue
+        TimeoutQueueMode GetMode() const;
+
         //! Resets all internal state for this timeout queue.
         void Reset();
 
@@ -83,10 +97,42 @@ namespace AzNetworking
         using TimeoutItemMap   = AZStd::map<TimeoutId, TimeoutItem>;
         using TimeoutItemQueue = AZStd::priority_queue<TimeoutQueueItem>;
 
+        // Timing wheel storage, each level has WheelSlotCount slots and each slot of a level spans all slots of the level below
+        // Slot 0 of level 0 spans a single millisecond, so four levels cover the full range of a 32 bit millisecond delay
+        static constexpr uint32_t WheelLevelBits = 8;
+        static constexpr uint32_t WheelSlotCount = 1 << WheelLevelBits;
+        static constexpr uint32_t WheelSlotMask = WheelSlotCount - 1;
+        static constexpr uint32_t WheelLevelCount = 4;
+        static constexpr uint32_t InvalidWheelIndex = 0xFFFFFFFF;
+
+        struct WheelEntry
+        {
+            TimeoutItem m_item;
+            TimeoutId m_timeoutId = TimeoutId{ 0 };
+            AZ::TimeMs m_expiryTimeMs = AZ::Time::ZeroTimeMs;
+            uint32_t m_slot = InvalidWheelIndex;
+            uint32_t m_prev = InvalidWheelIndex;
+            uint32_t m_next = InvalidWheelIndex;
+        };
+
+        void UpdateQueueTimeouts(const TimeoutHandler& timeoutHandler, int32_t maxTimeouts);
+        void UpdateWheelTimeouts(const TimeoutHandler& timeoutHandler, int32_t maxTimeouts);
+        void InsertWheelEntry(uint32_t entryIndex, AZ::TimeMs expiryTimeMs);
+        void UnlinkWheelEntry(uint32_t entryIndex);
+        void RemoveWheelEntry(uint32_t entryIndex);
+        void CascadeWheelSlot(uint32_t level);
+
+        TimeoutQueueMode m_mode = TimeoutQueueMode::PriorityQueue;
         TimeoutId        m_nextTimeoutId = TimeoutId{ 0 };
         TimeoutItemMap   m_timeoutItemMap;
         TimeoutItemQueue m_timeoutItemQueue;
 
+        AZStd::vector<WheelEntry> m_wheelEntries;
+        AZStd::vector<uint32_t> m_freeWheelEntries;
+        AZStd::unordered_map<TimeoutId, uint32_t> m_wheelEntryLookup;
+        AZStd::array<uint32_t, WheelSlotCount * WheelLevelCount> m_wheelSlots;
+        AZ::TimeMs m_wheelTimeMs = AZ::Time::ZeroTimeMs; // The next millisecond the wheel will expire
+
         // TimeoutQueue is a shared resource among connections. A mutex (or a read-write sync object) is required with multi-threaded sends.
         // See @sv_multithreadedConnectionUpdates cvar.
         AZStd::recursive_mutex m_mutex;
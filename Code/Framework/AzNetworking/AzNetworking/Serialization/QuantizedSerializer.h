@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/Serialization/ISerializer.h>
+
+namespace AzNetworking
+{
+    //! Serializes a value through a quantized representation of it, such as QuantizedValues or QuantizedQuaternion.
+    //! Only the quantized integral values are written, and when reading, the value is set to the decoded quantized value.
+    //! Any serializer can be used, so delta and hash serializers operate on the quantized values as well.
+    //! @param serializer ISerializer instance to use for serialization
+    //! @param value      the value to serialize, QUANTIZED_TYPE must be constructible from and convertible to VALUE_TYPE
+    //! @param name       the name of the value
+    //! @return boolean true for success, false for serialization failure
+    template <typename QUANTIZED_TYPE, typename VALUE_TYPE>
+    inline bool SerializeQuantized(ISerializer& serializer, VALUE_TYPE& value, const char* name)
+    {
+        QUANTIZED_TYPE quantizedValue(value);
+        if (serializer.Serialize(quantizedValue, name) && (serializer.GetSerializerMode() == SerializerMode::WriteToObject))
+        {
+            value = static_cast<VALUE_TYPE>(quantizedValue);
+        }
+        return serializer.IsValid();
+    }
+}
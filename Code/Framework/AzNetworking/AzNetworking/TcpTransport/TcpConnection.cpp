@@ -93,29 +93,40 @@ namespace AzNetworking
 
     void TcpConnection::UpdateSend()
     {
-        const uint32_t numSendBytes = m_sendRingbuffer.GetReadBufferSize();
-        if (numSendBytes <= 0)
+        // Keep writing until the ringbuffer drains or the socket would block, edge triggered socket managers only report writability once
+        for (;;)
         {
-            return;
-        }
+            const uint32_t numSendBytes = m_sendRingbuffer.GetReadBufferSize();
+            if (numSendBytes <= 0)
+            {
+                return;
+            }
 
-        uint8_t* sendData = m_sendRingbuffer.GetReadBufferData();
-        const int32_t sentBytes = m_socket->Send(sendData, numSendBytes);
-        const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(sentBytes);
-        if (disconnectReason != DisconnectReason::MAX)
-        {
-            Disconnect(disconnectReason, TerminationEndpoint::Remote);
-            return;
-        }
+            uint8_t* sendData = m_sendRingbuffer.GetReadBufferData();
+            const int32_t sentBytes = m_socket->Send(sendData, numSendBytes);
+            const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(sentBytes);
+            if (disconnectReason != DisconnectReason::MAX)
+            {
+                Disconnect(disconnectReason, TerminationEndpoint::Remote);
+                return;
+            }
+
+            if (sentBytes <= 0)
+            {
+                // The socket would block, nothing was sent and we'll be notified once it's writable again
+                return;
+            }
 
-        m_sendRingbuffer.AdvanceReadBuffer(sentBytes);
-        m_networkInterface.GetMetrics().m_sendBytes += numSendBytes;
-        m_networkInterface.GetMetrics().m_sendBytesUncompressed += numSendBytes;
+            // A partial write only consumes part of the ringbuffer, the remainder goes out on the next iteration
+            m_sendRingbuffer.AdvanceReadBuffer(sentBytes);
+            m_networkInterface.GetMetrics().m_sendBytes += sentBytes;
+            m_networkInterface.GetMetrics().m_sendBytesUncompressed += sentBytes;
 
-        if (m_socket->IsEncrypted() && sentBytes > 0)
-        {
-            m_networkInterface.GetMetrics().m_sendBytesEncryptionInflation += (aznumeric_cast<uint32_t>(sentBytes) - numSendBytes);
-            m_networkInterface.GetMetrics().m_sendPacketsEncrypted++;
+            if (m_socket->IsEncrypted())
+            {
+                m_networkInterface.GetMetrics().m_sendBytesEncryptionInflation += (aznumeric_cast<uint32_t>(sentBytes) - numSendBytes);
+                m_networkInterface.GetMetrics().m_sendPacketsEncrypted++;
+            }
         }
     }
 
@@ -124,62 +135,73 @@ namespace AzNetworking
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
         GetMetrics().LogPacketRecv(0, startTimeMs);
 
-        // Read new data off the input socket
+        // Keep reading until the socket would block, edge triggered socket managers only report readability once
+        // Packets are processed after each read so that large bursts can't overflow the receive ringbuffer
+        for (;;)
         {
-            uint8_t* srcData = m_recvRingbuffer.ReserveBlockForWrite(MaxPacketSize);
-            if (srcData == nullptr)
+            // Read new data off the input socket
             {
-                AZLOG_ERROR("Receive ringbuffer full, dropped connection");
-                Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
-                return false;
-            }
+                uint8_t* srcData = m_recvRingbuffer.ReserveBlockForWrite(MaxPacketSize);
+                if (srcData == nullptr)
+                {
+                    AZLOG_ERROR("Receive ringbuffer full, dropped connection");
+                    Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
+                    return false;
+                }
 
-            const int32_t receivedBytes = m_socket->Receive(srcData, MaxPacketSize);
-            if (receivedBytes == 0)
-            {
-                // No data on the socket, can happen if we're not in select or epoll mode
-                return true;
-            }
+                const int32_t receivedBytes = m_socket->Receive(srcData, MaxPacketSize);
+                if (receivedBytes == 0)
+                {
+                    // No more data on the socket
+                    break;
+                }
 
-            const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(receivedBytes);
-            if (disconnectReason != DisconnectReason::MAX)
-            {
-                Disconnect(disconnectReason, TerminationEndpoint::Remote);
-                return true;
+                const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(receivedBytes);
+                if (disconnectReason != DisconnectReason::MAX)
+                {
+                    Disconnect(disconnectReason, TerminationEndpoint::Remote);
+                    return true;
+                }
+                m_recvRingbuffer.AdvanceWriteBuffer(receivedBytes);
+                m_networkInterface.GetMetrics().m_recvBytes += receivedBytes;
+                m_networkInterface.GetMetrics().m_recvBytesUncompressed += receivedBytes;
             }
-            m_recvRingbuffer.AdvanceWriteBuffer(receivedBytes);
-            m_networkInterface.GetMetrics().m_recvBytes += receivedBytes;
-            m_networkInterface.GetMetrics().m_recvBytesUncompressed += receivedBytes;
-        }
 
-        // Process received packets
-        for (;;)
-        {
-            TcpPacketHeader header(PacketType(0), 0);
-            TcpPacketEncodingBuffer buffer;
-
-            if (!ReceivePacketInternal(header, buffer, startTimeMs))
+            // Process received packets
+            for (;;)
             {
-                break;
-            }
+                TcpPacketHeader header(PacketType(0), 0);
+                TcpPacketEncodingBuffer buffer;
 
-            NetworkOutputSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
-            if (m_state == ConnectionState::Connecting)
-            {
-                const ConnectResult connectResult = m_networkInterface.GetConnectionListener().ValidateConnect(GetRemoteAddress(), header, serializer);
-                if (connectResult == ConnectResult::Rejected)
+                if (!ReceivePacketInternal(header, buffer, startTimeMs))
                 {
-                    Disconnect(DisconnectReason::ConnectionRejected, TerminationEndpoint::Local);
+                    break;
                 }
-                else
+
+                NetworkOutputSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetSize()));
+                if (m_state == ConnectionState::Connecting)
                 {
-                    m_state = ConnectionState::Connected;
+                    const ConnectResult connectResult = m_networkInterface.GetConnectionListener().ValidateConnect(GetRemoteAddress(), header, serializer);
+                    if (connectResult == ConnectResult::Rejected)
+                    {
+                        Disconnect(DisconnectReason::ConnectionRejected, TerminationEndpoint::Local);
+                    }
+                    else
+                    {
+                        m_state = ConnectionState::Connected;
+                    }
+                }
+
+                if (m_state == ConnectionState::Connected)
+                {
+                    m_networkInterface.GetConnectionListener().OnPacketReceived(this, header, serializer);
                 }
             }
 
-            if (m_state == ConnectionState::Connected)
+            if ((m_state != ConnectionState::Connecting) && (m_state != ConnectionState::Connected))
             {
-                m_networkInterface.GetConnectionListener().OnPacketReceived(this, header, serializer);
+                // Stop reading from connections that were disconnected while processing packets
+                break;
             }
         }
 
@@ -8,6 +8,8 @@
 
 #include <AzNetworking/TcpTransport/TcpSocketManager.h>
 #include <AzCore/Console/ILogger.h>
+#include <errno.h>
+#include <unistd.h>
 
 #if AZ_TRAIT_USE_SOCKET_SERVER_EPOLL
 
@@ -28,6 +30,14 @@ namespace AzNetworking
         }
     }
 
+    TcpSocketManager::~TcpSocketManager()
+    {
+        if (m_epollFd != InvalidSocketFd)
+        {
+            close(static_cast<int32_t>(m_epollFd));
+        }
+    }
+
     bool TcpSocketManager::AddSocket(SocketFd socketFd)
     {
         if (socketFd < SocketFd{ 0 })
@@ -36,7 +46,8 @@ namespace AzNetworking
         }
 
         struct epoll_event fdEvents;
-        fdEvents.events = EPOLLIN | EPOLLOUT | EPOLLET;
+        // Edge triggered, sockets are only reported once each time they become readable or writable
+        fdEvents.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
         fdEvents.data.fd = static_cast<int32_t>(socketFd);
 
         if (epoll_ctl(static_cast<int32_t>(m_epollFd), EPOLL_CTL_ADD, static_cast<int32_t>(socketFd), &fdEvents) < 0)
@@ -53,14 +64,18 @@ namespace AzNetworking
     bool TcpSocketManager::ClearSocket(SocketFd socketFd)
     {
         ClearSocketHelper(socketFd);
+
+        // Closing a socket also removes it from the epoll set, so this only fails if the socket was already closed
+        struct epoll_event fdEvents = {};
+        epoll_ctl(static_cast<int32_t>(m_epollFd), EPOLL_CTL_DEL, static_cast<int32_t>(socketFd), &fdEvents);
         return true;
     }
 
     void TcpSocketManager::ProcessEvents(AZ::TimeMs maxBlockMs, const SocketEventCallback& readCallback, const SocketEventCallback& writeCallback)
     {
         struct epoll_event socketEvents[MaxEpollEvents];
-        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, -1);
-        if (numEpollEvents < 0)
+        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, static_cast<int32_t>(maxBlockMs));
+        if ((numEpollEvents < 0) && (errno != EINTR))
         {
             const int32_t error = GetLastNetworkError();
             AZLOG_ERROR("epoll_wait returned an error (%d:%s)", error, GetNetworkErrorDesc(error));
@@ -71,7 +86,8 @@ namespace AzNetworking
             for (int32_t event = 0; event < numEpollEvents; ++event)
             {
                 const SocketFd socketFd = static_cast<SocketFd>(socketEvents[event].data.fd);
-                if (socketEvents[event].events & EPOLLIN)
+                // Hangups and errors are surfaced through the read callback, where the failed receive disconnects the socket
+                if (socketEvents[event].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))
                 {
                     readCallback(socketFd);
                 }
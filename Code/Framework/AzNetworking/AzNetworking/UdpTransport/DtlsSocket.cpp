@@ -69,7 +69,7 @@ namespace AzNetworking
         UdpSocket::Close();
     }
 
-    int32_t DtlsSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const
+    int32_t DtlsSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint)
     {
         if (!encrypt)
         {
@@ -84,15 +84,28 @@ namespace AzNetworking
         }
 
 #if AZ_TRAIT_USE_OPENSSL
+        // Read the encrypted payload straight into the send batch if sends are batched
         uint8_t encrpytedSendBuffer[MaxUdpTransmissionUnit];
+        BatchWriteBuffer writeBuffer = ReserveBatchedSend(MaxUdpTransmissionUnit);
+        uint8_t* batchedData = writeBuffer.GetData();
+        uint8_t* encryptedData = (batchedData != nullptr) ? batchedData : encrpytedSendBuffer;
+
         // Write out the packet we were requested to send
         SSL_write(dtlsEndpoint.m_sslSocket, data, size);
-        const int32_t sentBytesEnc = BIO_read(dtlsEndpoint.m_writeBio, encrpytedSendBuffer, sizeof(encrpytedSendBuffer));
+        const int32_t sentBytesEnc = BIO_read(dtlsEndpoint.m_writeBio, encryptedData, MaxUdpTransmissionUnit);
 
         // Track encryption metrics
         m_sentBytesEncryptionInflation += aznumeric_cast<uint32_t>(sentBytesEnc - aznumeric_cast<int32_t>(size));
         m_sentPacketsEncrypted++;
 
+        if (batchedData != nullptr)
+        {
+            if (sentBytesEnc > 0)
+            {
+                CommitBatchedSend(writeBuffer, address, aznumeric_cast<uint32_t>(sentBytesEnc));
+            }
+            return sentBytesEnc;
+        }
         return UdpSocket::SendInternal(address, encrpytedSendBuffer, sentBytesEnc, encrypt, dtlsEndpoint);
 #else
         return 0;
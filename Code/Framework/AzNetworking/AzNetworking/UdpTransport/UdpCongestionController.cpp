@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpCongestionController.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AzNetworking
+{
+    AZ_CVAR(bool, net_UdpCongestionControl, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Whether new Udp connections pace their sends and reliable resends with an AIMD congestion controller");
+    AZ_CVAR(uint32_t, net_UdpCongestionInitialRate, 32 * 1024, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The initial send rate in bytes per second allowed by the Udp congestion controller");
+    AZ_CVAR(uint32_t, net_UdpCongestionMinRate, 8 * 1024, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The minimum send rate in bytes per second the Udp congestion controller will back off to");
+    AZ_CVAR(uint32_t, net_UdpCongestionMaxRate, 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The maximum send rate in bytes per second the Udp congestion controller will grow to");
+    AZ_CVAR(uint32_t, net_UdpCongestionIncrease, 4 * 1024, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The number of bytes per second the Udp congestion controller adds to the send rate each round trip without loss");
+    AZ_CVAR(float, net_UdpCongestionDecrease, 0.75f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The scalar the Udp congestion controller multiplies the send rate by when packets are lost, applied at most once per round trip");
+    AZ_CVAR(AZ::TimeMs, net_UdpPacingBurstMs, AZ::TimeMs{ 50 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The number of milliseconds of send rate a paced Udp connection may save up and send in a single burst");
+
+    UdpAimdCongestionController::UdpAimdCongestionController()
+        : m_sendRateBytesPerSecond(static_cast<int64_t>(static_cast<uint32_t>(net_UdpCongestionInitialRate)))
+    {
+        ;
+    }
+
+    void UdpAimdCongestionController::OnPacketSent(uint32_t byteCount, AZ::TimeMs currentTimeMs)
+    {
+        RefillTokens(currentTimeMs);
+
+        // The bucket may go into debt by the final packet of a burst, which is paid back before sending again
+        m_tokens -= static_cast<int64_t>(byteCount);
+        m_bytesSentSinceIncrease += static_cast<int64_t>(byteCount);
+    }
+
+    void UdpAimdCongestionController::OnPacketAcked(AZ::TimeMs currentTimeMs, AZ::TimeMs roundTripTimeMs)
+    {
+        const int64_t elapsedMs = static_cast<int64_t>(currentTimeMs - m_lastIncreaseTimeMs);
+        if (elapsedMs < static_cast<int64_t>(roundTripTimeMs))
+        {
+            return;
+        }
+
+        // Only grow the rate if the connection used at least half of it, otherwise an idle connection would grow without bound
+        const int64_t allowedBytes = m_sendRateBytesPerSecond * elapsedMs / 1000;
+        if (m_bytesSentSinceIncrease * 2 >= allowedBytes)
+        {
+            const int64_t maxRate = static_cast<int64_t>(static_cast<uint32_t>(net_UdpCongestionMaxRate));
+            m_sendRateBytesPerSecond = AZStd::min(m_sendRateBytesPerSecond + static_cast<int64_t>(static_cast<uint32_t>(net_UdpCongestionIncrease)), maxRate);
+        }
+        m_bytesSentSinceIncrease = 0;
+        m_lastIncreaseTimeMs = currentTimeMs;
+    }
+
+    void UdpAimdCongestionController::OnPacketLost(AZ::TimeMs currentTimeMs, AZ::TimeMs roundTripTimeMs)
+    {
+        if (static_cast<int64_t>(currentTimeMs - m_lastDecreaseTimeMs) < static_cast<int64_t>(roundTripTimeMs))
+        {
+            // Losses within a round trip of the last decrease are most likely from the same congestion event
+            return;
+        }
+
+        const int64_t minRate = static_cast<int64_t>(static_cast<uint32_t>(net_UdpCongestionMinRate));
+        m_sendRateBytesPerSecond = AZStd::max(static_cast<int64_t>(static_cast<float>(m_sendRateBytesPerSecond) * net_UdpCongestionDecrease), minRate);
+        m_lastDecreaseTimeMs = currentTimeMs;
+
+        // Don't let the rate grow again until a full round trip has passed at the reduced rate
+        m_bytesSentSinceIncrease = 0;
+        m_lastIncreaseTimeMs = currentTimeMs;
+    }
+
+    bool UdpAimdCongestionController::HasSendBudget(AZ::TimeMs currentTimeMs)
+    {
+        RefillTokens(currentTimeMs);
+        return m_tokens > 0;
+    }
+
+    uint32_t UdpAimdCongestionController::GetSendRateBytesPerSecond() const
+    {
+        return static_cast<uint32_t>(m_sendRateBytesPerSecond);
+    }
+
+    void UdpAimdCongestionController::RefillTokens(AZ::TimeMs currentTimeMs)
+    {
+        // Always allow at least a full packet to be saved up, otherwise a low rate could never send a full sized packet
+        const int64_t burstBytes = AZStd::max<int64_t>(
+            m_sendRateBytesPerSecond * static_cast<int64_t>(static_cast<AZ::TimeMs>(net_UdpPacingBurstMs)) / 1000, MaxUdpTransmissionUnit);
+        if (m_lastRefillTimeMs == AZ::Time::ZeroTimeMs)
+        {
+            m_tokens = burstBytes;
+            m_lastIncreaseTimeMs = currentTimeMs;
+        }
+        else
+        {
+            const int64_t elapsedMs = static_cast<int64_t>(currentTimeMs - m_lastRefillTimeMs);
+            m_tokens = AZStd::min(m_tokens + m_sendRateBytesPerSecond * elapsedMs / 1000, burstBytes);
+        }
+        m_lastRefillTimeMs = currentTimeMs;
+    }
+
+    AZStd::unique_ptr<IUdpCongestionController> CreateUdpCongestionController()
+    {
+        if (!net_UdpCongestionControl)
+        {
+            return nullptr;
+        }
+        return AZStd::make_unique<UdpAimdCongestionController>();
+    }
+}
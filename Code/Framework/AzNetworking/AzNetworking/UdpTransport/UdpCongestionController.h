@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AzNetworking
+{
+    //! @class IUdpCongestionController
+    //! @brief interface for controlling the rate a udp connection sends at in response to network congestion.
+    class IUdpCongestionController
+    {
+    public:
+
+        virtual ~IUdpCongestionController() = default;
+
+        //! Invoked whenever a packet is sent through the connection.
+        //! @param byteCount     number of bytes sent, including the packet header
+        //! @param currentTimeMs current process time in milliseconds
+        virtual void OnPacketSent(uint32_t byteCount, AZ::TimeMs currentTimeMs) = 0;
+
+        //! Invoked whenever a sent packet is acknowledged by the remote endpoint.
+        //! @param currentTimeMs current process time in milliseconds
+        //! @param roundTripTimeMs current round trip time estimate of the connection in milliseconds
+        virtual void OnPacketAcked(AZ::TimeMs currentTimeMs, AZ::TimeMs roundTripTimeMs) = 0;
+
+        //! Invoked whenever a sent packet is determined to be lost.
+        //! @param currentTimeMs current process time in milliseconds
+        //! @param roundTripTimeMs current round trip time estimate of the connection in milliseconds
+        virtual void OnPacketLost(AZ::TimeMs currentTimeMs, AZ::TimeMs roundTripTimeMs) = 0;
+
+        //! Returns whether the connection may send another packet without exceeding its paced send rate.
+        //! @param currentTimeMs current process time in milliseconds
+        //! @return boolean true if a packet may be sent now, false if sends should be deferred
+        virtual bool HasSendBudget(AZ::TimeMs currentTimeMs) = 0;
+
+        //! Returns the send rate currently allowed by the controller.
+        //! @return the allowed send rate in bytes per second
+        virtual uint32_t GetSendRateBytesPerSecond() const = 0;
+    };
+
+    //! @class UdpAimdCongestionController
+    //! @brief additive increase, multiplicative decrease congestion controller with token bucket pacing.
+    //! The allowed send rate grows by a fixed amount every round trip the connection makes use of it, and is scaled down at most once
+    //! per round trip when packets are lost, so a burst of losses from a single congestion event only backs off once.
+    class UdpAimdCongestionController final
+        : public IUdpCongestionController
+    {
+    public:
+
+        UdpAimdCongestionController();
+        ~UdpAimdCongestionController() override = default;
+
+        //! IUdpCongestionController interface.
+        // @{
+        void OnPacketSent(uint32_t byteCount, AZ::TimeMs currentTimeMs) override;
+        void OnPacketAcked(AZ::TimeMs currentTimeMs, AZ::TimeMs roundTripTimeMs) override;
+        void OnPacketLost(AZ::TimeMs currentTimeMs, AZ::TimeMs roundTripTimeMs) override;
+        bool HasSendBudget(AZ::TimeMs currentTimeMs) override;
+        uint32_t GetSendRateBytesPerSecond() const override;
+        // @}
+
+    private:
+
+        //! Refills the pacing token bucket for the time elapsed since the last refill.
+        void RefillTokens(AZ::TimeMs currentTimeMs);
+
+        int64_t m_sendRateBytesPerSecond = 0;
+        int64_t m_tokens = 0;
+        int64_t m_bytesSentSinceIncrease = 0;
+        AZ::TimeMs m_lastRefillTimeMs = AZ::Time::ZeroTimeMs;
+        AZ::TimeMs m_lastIncreaseTimeMs = AZ::Time::ZeroTimeMs;
+        AZ::TimeMs m_lastDecreaseTimeMs = AZ::Time::ZeroTimeMs;
+    };
+
+    //! Creates the default congestion controller for new udp connections, as configured by net_UdpCongestionControl.
+    //! @return the created congestion controller, or nullptr if congestion control is disabled
+    AZStd::unique_ptr<IUdpCongestionController> CreateUdpCongestionController();
+}
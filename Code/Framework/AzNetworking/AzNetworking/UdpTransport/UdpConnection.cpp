@@ -31,6 +31,11 @@ namespace AzNetworking
         return ((static_cast<uint32_t>(packetId) & PacketRttMask) == 0);
     }
 
+    static AZ::TimeMs GetRoundTripTimeMs(const ConnectionMetrics& metrics)
+    {
+        return aznumeric_cast<AZ::TimeMs>(aznumeric_cast<int64_t>(metrics.m_connectionRtt.GetRoundTripTimeSeconds() * 1000.0f));
+    }
+
     const char* GetEnumString(PacketTimeoutResult value)
     {
         switch (value)
@@ -51,7 +56,7 @@ namespace AzNetworking
         , m_lastSentPacketMs(AZ::GetElapsedTimeMs())
         , m_connectionRole(connectionRole)
     {
-        ;
+        SetCongestionController(CreateUdpCongestionController());
     }
 
     UdpConnection::~UdpConnection()
@@ -154,6 +159,22 @@ namespace AzNetworking
         return m_connectionMtu;
     }
 
+    void UdpConnection::SetCongestionController(AZStd::unique_ptr<IUdpCongestionController> congestionController)
+    {
+        m_congestionController = AZStd::move(congestionController);
+        UpdateSendRateLimit();
+    }
+
+    IUdpCongestionController* UdpConnection::GetCongestionController() const
+    {
+        return m_congestionController.get();
+    }
+
+    bool UdpConnection::HasSendBudget(AZ::TimeMs currentTimeMs)
+    {
+        return (m_congestionController == nullptr) || m_congestionController->HasSendBudget(currentTimeMs);
+    }
+
     void UdpConnection::ProcessAcked(PacketId packetId, AZ::TimeMs currentTimeMs)
     {
         GetMetrics().LogPacketAcked();
@@ -164,6 +185,12 @@ namespace AzNetworking
         {
             GetMetrics().m_connectionRtt.LogPacketAcked(packetId, currentTimeMs);
         }
+
+        if (m_congestionController != nullptr)
+        {
+            m_congestionController->OnPacketAcked(currentTimeMs, GetRoundTripTimeMs(GetMetrics()));
+            UpdateSendRateLimit();
+        }
     }
 
     void UdpConnection::ProcessSent(PacketId packetId, [[maybe_unused]] const IPacket& packet, 
@@ -177,6 +204,10 @@ namespace AzNetworking
         }
 
         GetMetrics().LogPacketSent(packetSize, currentTimeMs);
+        if (m_congestionController != nullptr)
+        {
+            m_congestionController->OnPacketSent(packetSize, currentTimeMs);
+        }
         m_lastSentPacketMs = currentTimeMs;
         m_unackedPacketCount = 0;
     }
@@ -197,6 +228,11 @@ namespace AzNetworking
 
         case PacketAckState::Nacked:
             GetMetrics().LogPacketLost();
+            if (m_congestionController != nullptr)
+            {
+                m_congestionController->OnPacketLost(AZ::GetElapsedTimeMs(), GetRoundTripTimeMs(GetMetrics()));
+                UpdateSendRateLimit();
+            }
             if (reliability == ReliabilityType::Reliable)
             {
                 m_reliableQueue.OnPacketLost(m_networkInterface, *this, packetId);
@@ -219,6 +255,16 @@ namespace AzNetworking
         return PacketTimeoutResult::Lost;
     }
 
+    void UdpConnection::UpdateDeferredResends()
+    {
+        m_reliableQueue.SendDeferredResends(m_networkInterface, *this);
+    }
+
+    void UdpConnection::UpdateSendRateLimit()
+    {
+        GetMetrics().m_sendRateLimitBytesPerSecond = (m_congestionController != nullptr) ? m_congestionController->GetSendRateBytesPerSecond() : 0;
+    }
+
     bool UdpConnection::ProcessReceived(UdpPacketHeader& header, [[maybe_unused]] const NetworkOutputSerializer& serializer, 
         uint32_t packetSize, AZ::TimeMs currentTimeMs)
     {
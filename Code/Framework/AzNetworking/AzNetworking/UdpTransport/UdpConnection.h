@@ -11,6 +11,7 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
+#include <AzNetworking/UdpTransport/UdpCongestionController.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpReliableQueue.h>
 #include <AzNetworking/UdpTransport/UdpFragmentQueue.h>
@@ -84,6 +85,19 @@ namespace AzNetworking
         //! @return the number of unacked reliable messages still pending in the reliable queue
         uint32_t GetReliableQueueSize() const;
 
+        //! Replaces the congestion controller used to pace sends and reliable resends on this connection.
+        //! @param congestionController the congestion controller to use, nullptr disables congestion control
+        void SetCongestionController(AZStd::unique_ptr<IUdpCongestionController> congestionController);
+
+        //! Retrieves the congestion controller used to pace sends and reliable resends on this connection.
+        //! @return pointer to the congestion controller, nullptr if congestion control is disabled
+        IUdpCongestionController* GetCongestionController() const;
+
+        //! Returns whether the congestion controller of this connection allows a packet to be sent now.
+        //! @param currentTimeMs current wall clock time in milliseconds
+        //! @return boolean true if a packet may be sent now or congestion control is disabled, false otherwise
+        bool HasSendBudget(AZ::TimeMs currentTimeMs);
+
         //! Acks a packetId.
         //! @param packetId      the PacketId of the packet being acked
         //! @param currentTimeMs current wall clock time in milliseconds
@@ -97,6 +111,14 @@ namespace AzNetworking
         //! @return the timeout identifier for this connection instance
         TimeoutId GetTimeoutId() const;
 
+        //! Sets the index of the socket of the network interface that this connection sends and receives on.
+        //! @param socketIndex the index of the socket that owns this connection
+        void SetSocketIndex(uint32_t socketIndex);
+
+        //! Retrieves the index of the socket of the network interface that this connection sends and receives on.
+        //! @return the index of the socket that owns this connection
+        uint32_t GetSocketIndex() const;
+
     protected:
 
         //! Prepare a reliable packet for transmission.
@@ -118,6 +140,12 @@ namespace AzNetworking
         //! @return PacketTimeoutResult::Acked if the packet was confirmed to be received prior to timeout, PacketTimeoutResult::Lost if not
         PacketTimeoutResult ProcessTimeout(PacketId packetId, ReliabilityType reliability);
 
+        //! Resends reliable packets that were deferred by the congestion controller, as the send budget allows.
+        void UpdateDeferredResends();
+
+        //! Publishes the send rate allowed by the congestion controller to the connection metrics.
+        void UpdateSendRateLimit();
+
         //! Process a received packet header.
         //! @param header        the packet header received to process
         //! @param serializer    the output serializer containing the transmitted packet data
@@ -142,6 +170,7 @@ namespace AzNetworking
         ConnectionState  m_state = ConnectionState::Disconnected;
         ConnectionRole   m_connectionRole = ConnectionRole::Connector;
         DtlsEndpoint     m_dtlsEndpoint;
+        AZStd::unique_ptr<IUdpCongestionController> m_congestionController;
 
         AZ::TimeMs m_lastSentPacketMs;
         uint32_t   m_unackedPacketCount = 0;
@@ -149,6 +178,7 @@ namespace AzNetworking
 
         TimeoutId m_timeoutId;
         uint32_t  m_timeoutCounter = 0;
+        uint32_t  m_socketIndex = 0;
 
         AZStd::mutex m_sendPacketMutex;
     };
@@ -40,6 +40,16 @@ namespace AzNetworking
         return m_timeoutId;
     }
 
+    inline void UdpConnection::SetSocketIndex(uint32_t socketIndex)
+    {
+        m_socketIndex = socketIndex;
+    }
+
+    inline uint32_t UdpConnection::GetSocketIndex() const
+    {
+        return m_socketIndex;
+    }
+
     inline bool UdpConnection::PrepareReliablePacketForSend(PacketId packetId, SequenceId reliableSequenceId, const IPacket& packet)
     {
         return m_reliableQueue.PrepareForSend(packetId, reliableSequenceId, packet);
@@ -17,6 +17,9 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/MathUtils.h>
 
 namespace AzNetworking
@@ -35,9 +38,17 @@ namespace AzNetworking
     AZ_CVAR(AZ::TimeMs, net_UdpDefaultTimeoutMs, AZ::TimeMs{ 10 * 1000 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Time in milliseconds before we timeout an idle Udp connection");
     AZ_CVAR(AZ::TimeMs, net_MinPacketTimeoutMs, AZ::TimeMs{ 200 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Minimum time to wait before timing out an unacked packet");
     AZ_CVAR(int32_t, net_MaxTimeoutsPerFrame, 1000, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Maximum number of packet timeouts to allow to process in a single frame");
+    AZ_CVAR(bool, net_UdpParallelDecryption, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Decrypt received packets on job threads, one job per connection, before processing them on the network thread");
+    AZ_CVAR(uint32_t, net_UdpParallelDecryptionMinPackets, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The minimum number of packets received in an update before net_UdpParallelDecryption decrypts them on job threads");
+    AZ_CVAR(bool, net_UdpPacketTimeoutWheel, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Track packet timeouts in a hierarchical timing wheel, which expires all due packets each frame rather than limiting them with net_MaxTimeoutsPerFrame. Read when the network interface is created");
     AZ_CVAR(float, net_RttFudgeScalar, 2.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Scalar value to multiply computed Rtt by to determine an optimal packet timeout threshold");
     AZ_CVAR(uint32_t, net_FragmentedHeaderOverhead, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "A fudge overhead value to take out of fragmented packet payloads");
     AZ_CVAR(bool, net_FragmentsAlwaysReliable, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether fragmented packets should be reliable by default or use their source packet's reliability type");
+    AZ_CVAR(uint32_t, net_UdpListenSocketCount, 1, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The number of sockets a listening Udp network interface opens on its port, each with its own reader thread. Values above 1 require port reuse support");
     AZ_CVAR(AZ::CVarFixedString, net_UdpCompressor, "MultiplayerCompressor", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "UDP compressor to use."); // WARN: similar to encryption this needs to be set once and only once before creating the network interface
 
     static uint64_t ConstructTimeoutId(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability)
@@ -60,6 +71,7 @@ namespace AzNetworking
         : m_name(name)
         , m_trustZone(trustZone)
         , m_connectionListener(connectionListener)
+        , m_packetTimeoutQueue(net_UdpPacketTimeoutWheel ? TimeoutQueueMode::TimingWheel : TimeoutQueueMode::PriorityQueue)
         , m_socket(net_UdpUseEncryption ? new DtlsSocket() : new UdpSocket())
         , m_readerThread(readerThread)
         , m_timeoutMs(net_UdpDefaultTimeoutMs)
@@ -70,6 +82,7 @@ namespace AzNetworking
 
     UdpNetworkInterface::~UdpNetworkInterface()
     {
+        CloseListenShards();
         m_readerThread.UnregisterSocket(m_socket.get());
     }
 
@@ -111,11 +124,20 @@ namespace AzNetworking
             return false;
         }
 
+        uint32_t socketCount = AZStd::max<uint32_t>(net_UdpListenSocketCount, 1);
+        if ((socketCount > 1) && (port == 0))
+        {
+            AZLOG_WARN("Listen sockets can only be shared on a fixed port, opening a single socket");
+            socketCount = 1;
+        }
+
         m_port = port;
         m_allowIncomingConnections = true;
+        m_socket->SetReusePort(socketCount > 1);
         if (m_socket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
         {
             m_readerThread.RegisterSocket(m_socket.get());
+            OpenListenShards(socketCount - 1);
             return true;
         }
         else
@@ -175,6 +197,9 @@ namespace AzNetworking
             return;
         }
 
+        // Send the packets that were queued since the last update in one batch
+        FlushSends();
+
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
         const UdpReaderThread::ReceivedPackets* packets = m_readerThread.GetReceivedPackets(m_socket.get());
         if (packets == nullptr)
@@ -183,146 +208,15 @@ namespace AzNetworking
             return;
         }
 
-        for (uint32_t i = 0; i < packets->size(); ++i)
+        ProcessReceivedPackets(0, *packets, startTimeMs);
+        for (uint32_t shardIndex = 0; shardIndex < m_listenShards.size(); ++shardIndex)
         {
-            const UdpReaderThread::ReceivedPacket& packet = (*packets)[i];
-            const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
-
-            // Don't exceed our timeslice, even if unprocessed data remains
-            if ((currentTimeMs - startTimeMs) > net_UdpPacketTimeSliceMs)
-            {
-                AZLOG_WARN("Processing time exceeded, discarding %d/%d received packets", aznumeric_cast<int32_t>(packets->size() - i), aznumeric_cast<int32_t>(packets->size()));
-                GetMetrics().m_discardedPackets += packets->size() - i;
-                break;
-            }
-
-            UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
-            if (connection == nullptr)
-            {
-                AcceptConnection(packet);
-                continue;
-            }
-
-            const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(packet.m_receivedBytes);
-            if (disconnectReason != DisconnectReason::MAX)
-            {
-                connection->Disconnect(disconnectReason, TerminationEndpoint::Local);
-                continue;
-            }
-            
-            const ConnectionState connectionState = connection->GetConnectionState();
-            if (connectionState == ConnectionState::Disconnecting || connectionState == ConnectionState::Disconnected)
-            {
-                // Skip packets from disconnected connections
-                continue;
-            }
-
-            int32_t decodedPacketSize = 0;
-            m_decryptBuffer.Resize(m_decryptBuffer.GetCapacity());
-            const uint8_t* decodedPacketData = connection->GetDtlsEndpoint().DecodePacket(*connection, packet.m_buffer, packet.m_receivedBytes, m_decryptBuffer.GetBuffer(), decodedPacketSize);
-            m_decryptBuffer.Resize(decodedPacketSize);
-
-            if (decodedPacketSize == 0)
-            {
-                // OpenSSL may have consumed packets during handshake negotiation
-                continue;
-            }
-            else if (decodedPacketSize < 0)
-            {
-                // Late unencrypted handshake packets or just random garbage can show up, discard and continue
-                continue;
-            }
-
-            connection->GetMetrics().LogPacketRecv(packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs);
-
-            // Decode the packet flag bitset first since it's always uncompressed
-            UdpPacketHeader header;
-            {
-                NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
-                if (!header.SerializePacketFlags(flagSerializer))
-                {
-                    continue;
-                }
-                // Adjust decoded tracking to represent the payload now that we've grabbed the flags
-                decodedPacketData = flagSerializer.GetUnreadData();
-                decodedPacketSize = flagSerializer.GetUnreadSize();
-                GetMetrics().m_recvBytesUncompressed += flagSerializer.GetReadSize();
-            }
-
-            if (m_compressor && header.IsPacketFlagSet(PacketFlag::Compressed))
-            {
-                // Only the payload is compressed
-                if (!DecompressPacket(decodedPacketData, decodedPacketSize, m_decompressBuffer))
-                {
-                    AZLOG_WARN("Failed to decompress packet!");
-                    continue;
-                }
-                decodedPacketData = m_decompressBuffer.GetBuffer();
-                decodedPacketSize = static_cast<int32_t>(m_decompressBuffer.GetSize());
-            }
-            GetMetrics().m_recvBytesUncompressed += decodedPacketSize;
-
-            TimeoutQueue::TimeoutItem* timeoutItem = m_connectionTimeoutQueue.RetrieveItem(connection->GetTimeoutId());
-            if (timeoutItem == nullptr)
-            {
-                connection->Disconnect(DisconnectReason::Unknown, TerminationEndpoint::Local);
-                continue;
-            }
-            else
+            // Additional listen sockets have their own reader threads, which aren't swapped by the networking system
+            ListenShard& shard = m_listenShards[shardIndex];
+            shard.m_readerThread->SwapBuffers();
+            if (const UdpReaderThread::ReceivedPackets* shardPackets = shard.m_readerThread->GetReceivedPackets(shard.m_socket.get()))
             {
-                // Deserialize the packet header
-                NetworkOutputSerializer packetSerializer(decodedPacketData, decodedPacketSize);
-                ISerializer& serializer = packetSerializer; // To get the default typeinfo parameters in ISerializer
-                if (!serializer.Serialize(header, "Header"))
-                {
-                    continue;
-                }
-
-                // Note that the serializer passed in here is unused for UDP
-                if (!connection->ProcessReceived(header, packetSerializer, packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs))
-                {
-                    continue;
-                }
-
-                timeoutItem->UpdateTimeoutTime(startTimeMs);
-                connection->m_timeoutCounter = 0;
-
-                PacketDispatchResult handledPacket = PacketDispatchResult::Failure;
-                if (header.GetPacketType() < aznumeric_cast<PacketType>(CorePackets::PacketType::MAX))
-                {
-                    handledPacket = connection->HandleCorePacket(m_connectionListener, header, packetSerializer);
-                }
-                else
-                {
-                    handledPacket = m_connectionListener.OnPacketReceived(connection, header, packetSerializer);
-                }
-
-                if (handledPacket == PacketDispatchResult::Success)
-                {
-                    connection->UpdateHeartbeat(currentTimeMs);
-                    if (connection->GetConnectionState() == ConnectionState::Connecting && !connection->GetDtlsEndpoint().IsConnecting())
-                    {
-                        // Connection is realized once a packet is received and socket handshake is verified complete
-                        connection->m_state = ConnectionState::Connected;
-                    }
-                }
-                else if (m_socket->IsEncrypted() && connection->GetDtlsEndpoint().IsConnecting() &&
-                    !IsHandshakePacket(connection->GetDtlsEndpoint(), header.GetPacketType()))
-                {
-                    // It's possible for one side to finish its half of the encryption handshake and start sending encrypted data
-                    // This will appear as a SerializationError due to the incomplete encryption handshake
-                    // If it's not an expected unencrypted type then skip it for now
-                    continue;
-                }
-                else if (handledPacket == PacketDispatchResult::Skipped)
-                {
-                    // If the result is marked as skipped then do so (i.e. if a handshake is not yet complete)
-                    continue;
-                }
-                else if (connection->GetConnectionState() != ConnectionState::Disconnecting)
-                {
-                    connection->Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
-                }
+                ProcessReceivedPackets(shardIndex + 1, *shardPackets, startTimeMs);
             }
         }
         const AZ::TimeMs receiveTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
@@ -331,7 +225,12 @@ namespace AzNetworking
         m_connectionTimeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item) { return HandleConnectionTimeout(item); });
 
         // Time out any packets that haven't been acked within our timeout window
-        m_packetTimeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item) { return HandlePacketTimeout(item); }, static_cast<int32_t>(net_MaxTimeoutsPerFrame));
+        // Timing wheel expiry is flat cost per timeout, so it isn't capped, otherwise resends would be delayed under load
+        const int32_t maxPacketTimeouts = (m_packetTimeoutQueue.GetMode() == TimeoutQueueMode::TimingWheel) ? -1 : static_cast<int32_t>(net_MaxTimeoutsPerFrame);
+        m_packetTimeoutQueue.UpdateTimeouts([this](TimeoutQueue::TimeoutItem& item) { return HandlePacketTimeout(item); }, maxPacketTimeouts);
+
+        // Resend any lost reliable packets the congestion controllers held back, now that the pacing budgets have refilled
+        m_connectionSet.VisitConnections([](IConnection& connection) { static_cast<UdpConnection&>(connection).UpdateDeferredResends(); });
 
         // Delete any connections we've disconnected
         for (RemovedConnection& removedConnection : m_removedConnections)
@@ -341,14 +240,27 @@ namespace AzNetworking
         }
         m_removedConnections.clear();
 
+        // Send the acks, heartbeats and resends that were queued during this update
+        FlushSends();
+
         // Update metrics
-        GetMetrics().m_sendPackets = m_socket->GetSentPackets();
-        GetMetrics().m_sendBytes = m_socket->GetSentBytes();
-        GetMetrics().m_sendPacketsEncrypted = m_socket->GetSentPacketsEncrypted();
-        GetMetrics().m_sendBytesEncryptionInflation = m_socket->GetSentBytesEncryptionInflation();
+        GetMetrics().m_sendPackets = 0;
+        GetMetrics().m_sendBytes = 0;
+        GetMetrics().m_sendPacketsEncrypted = 0;
+        GetMetrics().m_sendBytesEncryptionInflation = 0;
+        GetMetrics().m_recvPackets = 0;
+        GetMetrics().m_recvBytes = 0;
+        for (uint32_t socketIndex = 0; socketIndex <= m_listenShards.size(); ++socketIndex)
+        {
+            const UdpSocket& socket = GetSocket(socketIndex);
+            GetMetrics().m_sendPackets += socket.GetSentPackets();
+            GetMetrics().m_sendBytes += socket.GetSentBytes();
+            GetMetrics().m_sendPacketsEncrypted += socket.GetSentPacketsEncrypted();
+            GetMetrics().m_sendBytesEncryptionInflation += socket.GetSentBytesEncryptionInflation();
+            GetMetrics().m_recvPackets += socket.GetRecvPackets();
+            GetMetrics().m_recvBytes += socket.GetRecvBytes();
+        }
         GetMetrics().m_recvTimeMs += receiveTimeMs;
-        GetMetrics().m_recvPackets = m_socket->GetRecvPackets();
-        GetMetrics().m_recvBytes = m_socket->GetRecvBytes();
         GetMetrics().m_connectionCount = m_connectionSet.GetConnectionCount();
         GetMetrics().m_updateTimeMs += AZ::GetElapsedTimeMs() - startTimeMs;
     }
@@ -391,6 +303,7 @@ namespace AzNetworking
         }
 
         m_port = 0;
+        CloseListenShards();
         m_readerThread.UnregisterSocket(m_socket.get());
         m_allowIncomingConnections = false;
         m_socket->Close();
@@ -427,6 +340,58 @@ namespace AzNetworking
         return m_socket->IsOpen();
     }
 
+    UdpSocket& UdpNetworkInterface::GetSocket(uint32_t socketIndex) const
+    {
+        // Connections that outlive their listen socket fall back to the primary socket
+        if ((socketIndex == 0) || (socketIndex > m_listenShards.size()))
+        {
+            return *m_socket;
+        }
+        return *m_listenShards[socketIndex - 1].m_socket;
+    }
+
+    void UdpNetworkInterface::OpenListenShards(uint32_t shardCount)
+    {
+        for (uint32_t shardIndex = 0; shardIndex < shardCount; ++shardIndex)
+        {
+            ListenShard shard;
+            shard.m_socket.reset(m_socket->IsEncrypted() ? new DtlsSocket() : new UdpSocket());
+            shard.m_socket->SetReusePort(true);
+            if (!shard.m_socket->Open(m_port, UdpSocket::CanAcceptConnections::True, m_trustZone))
+            {
+                AZLOG_WARN("Failed to open listen socket %u on port %u, listening with %u sockets",
+                    shardIndex + 2, aznumeric_cast<uint32_t>(m_port), shardIndex + 1);
+                break;
+            }
+
+            // The kernel keeps sending the traffic of a remote address to the same socket, so each reader thread
+            // only receives packets for the connections owned by its socket
+            shard.m_readerThread = AZStd::make_unique<UdpReaderThread>();
+            shard.m_readerThread->RegisterSocket(shard.m_socket.get());
+            m_listenShards.emplace_back(AZStd::move(shard));
+        }
+    }
+
+    void UdpNetworkInterface::CloseListenShards()
+    {
+        for (ListenShard& shard : m_listenShards)
+        {
+            // Stop the reader thread before closing the socket it reads from
+            shard.m_readerThread.reset();
+            shard.m_socket->Close();
+        }
+        m_listenShards.clear();
+    }
+
+    void UdpNetworkInterface::FlushSends()
+    {
+        m_socket->FlushSends();
+        for (ListenShard& shard : m_listenShards)
+        {
+            shard.m_socket->FlushSends();
+        }
+    }
+
     void UdpNetworkInterface::RegisterWithTimeoutQueue(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability, const ConnectionMetrics& metrics)
     {
         const float avgRtt = metrics.m_connectionRtt.GetRoundTripTimeSeconds(); // Time is in seconds, timeout times are in milliseconds
@@ -436,6 +401,85 @@ namespace AzNetworking
         m_packetTimeoutQueue.RegisterItem(ConstructTimeoutId(connectionId, packetId, reliability), packetTimeoutMs);
     }
 
+    void UdpNetworkInterface::DecodeReceivedPacketsInParallel(const UdpReaderThread::ReceivedPackets& packets)
+    {
+        // Link the packets of each connection together, in the order they were received
+        // Handshaking connections are left to be decrypted during processing, since processing their packets changes the handshake state
+        uint32_t decodedBufferSize = 0;
+        m_decodedPackets.resize(packets.size());
+        m_decodeLastPacketIndices.clear();
+        for (uint32_t i = 0; i < packets.size(); ++i)
+        {
+            const UdpReaderThread::ReceivedPacket& packet = packets[i];
+            DecodedPacket& decodedPacket = m_decodedPackets[i];
+            decodedPacket = DecodedPacket();
+            if (packet.m_receivedBytes <= 0)
+            {
+                continue;
+            }
+
+            UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
+            if ((connection == nullptr) || connection->GetDtlsEndpoint().IsConnecting())
+            {
+                continue;
+            }
+
+            decodedPacket.m_connection = connection;
+            decodedPacket.m_nextPacketIndex = aznumeric_cast<uint32_t>(packets.size());
+            decodedBufferSize += aznumeric_cast<uint32_t>(packet.m_receivedBytes);
+
+            auto lastIter = m_decodeLastPacketIndices.find(connection);
+            if (lastIter != m_decodeLastPacketIndices.end())
+            {
+                m_decodedPackets[lastIter->second].m_nextPacketIndex = i;
+                lastIter->second = i;
+            }
+            else
+            {
+                m_decodeLastPacketIndices.emplace(connection, i);
+            }
+        }
+
+        // Decrypted packets are never larger than their encrypted payloads, so each packet decrypts into a slice the size of the payload
+        m_decodedPacketBuffer.resize_no_construct(decodedBufferSize);
+        uint32_t decodedBufferOffset = 0;
+        for (uint32_t i = 0; i < packets.size(); ++i)
+        {
+            if (m_decodedPackets[i].m_connection != nullptr)
+            {
+                m_decodedPackets[i].m_data = m_decodedPacketBuffer.data() + decodedBufferOffset;
+                decodedBufferOffset += aznumeric_cast<uint32_t>(packets[i].m_receivedBytes);
+            }
+        }
+
+        AZ::JobCompletion jobCompletion;
+        for (uint32_t i = 0; i < packets.size(); ++i)
+        {
+            if ((m_decodedPackets[i].m_connection == nullptr) || (m_decodeLastPacketIndices.find(m_decodedPackets[i].m_connection) == m_decodeLastPacketIndices.end()))
+            {
+                // Not decrypted ahead of time, or not the first packet of its connection
+                continue;
+            }
+            m_decodeLastPacketIndices.erase(m_decodedPackets[i].m_connection);
+
+            AZ::Job* job = AZ::CreateJobFunction([this, &packets, firstPacketIndex = i]()
+            {
+                for (uint32_t packetIndex = firstPacketIndex; packetIndex < packets.size(); packetIndex = m_decodedPackets[packetIndex].m_nextPacketIndex)
+                {
+                    const UdpReaderThread::ReceivedPacket& packet = packets[packetIndex];
+                    DecodedPacket& decodedPacket = m_decodedPackets[packetIndex];
+                    uint8_t* decodeBuffer = const_cast<uint8_t*>(decodedPacket.m_data);
+                    decodedPacket.m_data = decodedPacket.m_connection->GetDtlsEndpoint().DecodePacket(
+                        *decodedPacket.m_connection, packet.m_buffer, packet.m_receivedBytes, decodeBuffer, decodedPacket.m_size);
+                }
+            }, true /*auto delete*/, nullptr);
+
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
     bool UdpNetworkInterface::DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const
     {
         if (!m_compressor) // should probably have some compression handshake than relying on existence of compressor
@@ -568,10 +612,27 @@ namespace AzNetworking
             return localPacketId;
         }
 
+        // If we're not connected then we're still handshaking and require packets to be unencrypted
+        const bool shouldEncrypt = !IsHandshakePacket(connection.GetDtlsEndpoint(), packet.GetPacketType());
+        UdpSocket& socket = GetSocket(connection.GetSocketIndex());
+        bool isWrittenToSocket = false;
+
         UdpPacketEncodingBuffer writeBuffer;
+        UdpSocket::BatchWriteBuffer socketWriteBuffer;
         if (m_compressor && shouldCompress)
         {
-            NetworkInputSerializer flagSerializer(writeBuffer.GetBuffer(), static_cast<uint32_t>(writeBuffer.GetCapacity()));
+            // Packet flags always serialize to a single byte, which is asserted below
+            const uint32_t payloadSize = static_cast<uint32_t>(buffer.GetSize() - 1);
+            const AZStd::size_t maxSizeNeeded = m_compressor->GetMaxCompressedBufferSize(payloadSize);
+
+            // If the socket doesn't have to encrypt the packet, compress it directly into the socket's send batch to save a copy
+            // The socket's send batch stays locked until the packet is sent or the write buffer goes out of scope
+            socketWriteBuffer = socket.AcquireWriteBuffer(aznumeric_cast<uint32_t>(1 + maxSizeNeeded), shouldEncrypt, connection.GetConnectionQuality());
+            uint8_t* socketBuffer = socketWriteBuffer.GetData();
+            uint8_t* compressedData = (socketBuffer != nullptr) ? socketBuffer : writeBuffer.GetBuffer();
+            const uint32_t compressedCapacity = (socketBuffer != nullptr) ? aznumeric_cast<uint32_t>(1 + maxSizeNeeded) : static_cast<uint32_t>(writeBuffer.GetCapacity());
+
+            NetworkInputSerializer flagSerializer(compressedData, compressedCapacity);
             ISerializer& serializer = flagSerializer; // To get the default typeinfo parameters in ISerializer
 
             header.SetPacketFlag(PacketFlag::Compressed, true);
@@ -584,11 +645,9 @@ namespace AzNetworking
             AZ_Assert(flagSize == 1, "Flag bitfield should serialize to one byte");
 
             // Compress the packet, make sure to offset by the size of the flag which is now serialized
-            const uint32_t payloadSize = static_cast<uint32_t>(buffer.GetSize() - flagSize);
             uint8_t* payload = buffer.GetBuffer() + flagSize;
-            const AZStd::size_t maxSizeNeeded = m_compressor->GetMaxCompressedBufferSize(payloadSize);
             AZStd::size_t compressionMemBytesUsed = 0;
-            CompressorError compErr = m_compressor->Compress(payload, payloadSize, writeBuffer.GetBuffer() + flagSize, maxSizeNeeded, compressionMemBytesUsed);
+            CompressorError compErr = m_compressor->Compress(payload, payloadSize, compressedData + flagSize, maxSizeNeeded, compressionMemBytesUsed);
 
             if (compErr != CompressorError::Ok)
             {
@@ -599,12 +658,18 @@ namespace AzNetworking
             // Only use compression if there's actual gain
             if (compressionMemBytesUsed < payloadSize)
             {
-                writeBuffer.Resize(aznumeric_cast<int32_t>(flagSize + compressionMemBytesUsed));
-                packetSize = static_cast<uint32_t>(writeBuffer.GetSize());
-                packetData = writeBuffer.GetBuffer();
+                packetSize = aznumeric_cast<uint32_t>(flagSize + compressionMemBytesUsed);
+                packetData = compressedData;
                 // Track byte delta caused by compression
                 GetMetrics().m_sendBytesCompressedDelta += (packetSize - compressionMemBytesUsed);
-            }        
+            }
+            else if (socketBuffer != nullptr)
+            {
+                // The space in the send batch is already reserved, so the uncompressed packet is placed there instead
+                memcpy(socketBuffer, packetData, packetSize);
+                packetData = socketBuffer;
+            }
+            isWrittenToSocket = (socketBuffer != nullptr);
         }
 
         AZLOG(NET_Debug, "Sending local sequence id %d, remote sequence id %d, %s, reliable id: %d, ack vector %x",
@@ -616,9 +681,10 @@ namespace AzNetworking
         );
 
         AZLOG(NET_DebugDtls, "Connection is sending packet type %d", aznumeric_cast<int32_t>(packet.GetPacketType()));
-        // If we're not connected then we're still handshaking and require packets to be unencrypted
-        const bool shouldEncrypt = !IsHandshakePacket(connection.GetDtlsEndpoint(), packet.GetPacketType());
-        if (m_socket->Send(address, packetData, packetSize, shouldEncrypt, connection.GetDtlsEndpoint(), connection.GetConnectionQuality()))
+        const int32_t sentBytes = isWrittenToSocket
+            ? socket.SendWriteBuffer(socketWriteBuffer, address, packetSize)
+            : socket.Send(address, packetData, packetSize, shouldEncrypt, connection.GetDtlsEndpoint(), connection.GetConnectionQuality());
+        if (sentBytes != 0)
         {
             RegisterWithTimeoutQueue(connection.GetConnectionId(), localPacketId, reliabilityType, connection.GetMetrics());
             connection.ProcessSent(localPacketId, packet, packetSize + UdpPacketHeaderSize, reliabilityType);
@@ -633,7 +699,169 @@ namespace AzNetworking
         return InvalidPacketId;
     }
 
-    void UdpNetworkInterface::AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket)
+    void UdpNetworkInterface::ProcessReceivedPackets(uint32_t socketIndex, const UdpReaderThread::ReceivedPackets& packets, AZ::TimeMs startTimeMs)
+    {
+        m_decodedPackets.clear();
+        if (net_UdpParallelDecryption && m_socket->IsEncrypted() && (packets.size() >= net_UdpParallelDecryptionMinPackets)
+         && (AZ::JobContext::GetGlobalContext() != nullptr))
+        {
+            DecodeReceivedPacketsInParallel(packets);
+        }
+
+        for (uint32_t i = 0; i < packets.size(); ++i)
+        {
+            const UdpReaderThread::ReceivedPacket& packet = packets[i];
+            const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+
+            // Don't exceed our timeslice, even if unprocessed data remains
+            if ((currentTimeMs - startTimeMs) > net_UdpPacketTimeSliceMs)
+            {
+                AZLOG_WARN("Processing time exceeded, discarding %d/%d received packets", aznumeric_cast<int32_t>(packets.size() - i), aznumeric_cast<int32_t>(packets.size()));
+                GetMetrics().m_discardedPackets += packets.size() - i;
+                break;
+            }
+
+            UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
+            if (connection == nullptr)
+            {
+                AcceptConnection(socketIndex, packet);
+                continue;
+            }
+
+            const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(packet.m_receivedBytes);
+            if (disconnectReason != DisconnectReason::MAX)
+            {
+                connection->Disconnect(disconnectReason, TerminationEndpoint::Local);
+                continue;
+            }
+
+            const ConnectionState connectionState = connection->GetConnectionState();
+            if (connectionState == ConnectionState::Disconnecting || connectionState == ConnectionState::Disconnected)
+            {
+                // Skip packets from disconnected connections
+                continue;
+            }
+
+            int32_t decodedPacketSize = 0;
+            const uint8_t* decodedPacketData = nullptr;
+            if ((i < m_decodedPackets.size()) && (m_decodedPackets[i].m_connection == connection))
+            {
+                decodedPacketData = m_decodedPackets[i].m_data;
+                decodedPacketSize = m_decodedPackets[i].m_size;
+            }
+            else
+            {
+                m_decryptBuffer.Resize(m_decryptBuffer.GetCapacity());
+                decodedPacketData = connection->GetDtlsEndpoint().DecodePacket(*connection, packet.m_buffer, packet.m_receivedBytes, m_decryptBuffer.GetBuffer(), decodedPacketSize);
+                m_decryptBuffer.Resize(decodedPacketSize);
+            }
+
+            if (decodedPacketSize == 0)
+            {
+                // OpenSSL may have consumed packets during handshake negotiation
+                continue;
+            }
+            else if (decodedPacketSize < 0)
+            {
+                // Late unencrypted handshake packets or just random garbage can show up, discard and continue
+                continue;
+            }
+
+            connection->GetMetrics().LogPacketRecv(packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs);
+
+            // Decode the packet flag bitset first since it's always uncompressed
+            UdpPacketHeader header;
+            {
+                NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
+                if (!header.SerializePacketFlags(flagSerializer))
+                {
+                    continue;
+                }
+                // Adjust decoded tracking to represent the payload now that we've grabbed the flags
+                decodedPacketData = flagSerializer.GetUnreadData();
+                decodedPacketSize = flagSerializer.GetUnreadSize();
+                GetMetrics().m_recvBytesUncompressed += flagSerializer.GetReadSize();
+            }
+
+            if (m_compressor && header.IsPacketFlagSet(PacketFlag::Compressed))
+            {
+                // Only the payload is compressed
+                if (!DecompressPacket(decodedPacketData, decodedPacketSize, m_decompressBuffer))
+                {
+                    AZLOG_WARN("Failed to decompress packet!");
+                    continue;
+                }
+                decodedPacketData = m_decompressBuffer.GetBuffer();
+                decodedPacketSize = static_cast<int32_t>(m_decompressBuffer.GetSize());
+            }
+            GetMetrics().m_recvBytesUncompressed += decodedPacketSize;
+
+            TimeoutQueue::TimeoutItem* timeoutItem = m_connectionTimeoutQueue.RetrieveItem(connection->GetTimeoutId());
+            if (timeoutItem == nullptr)
+            {
+                connection->Disconnect(DisconnectReason::Unknown, TerminationEndpoint::Local);
+                continue;
+            }
+            else
+            {
+                // Deserialize the packet header
+                NetworkOutputSerializer packetSerializer(decodedPacketData, decodedPacketSize);
+                ISerializer& serializer = packetSerializer; // To get the default typeinfo parameters in ISerializer
+                if (!serializer.Serialize(header, "Header"))
+                {
+                    continue;
+                }
+
+                // Note that the serializer passed in here is unused for UDP
+                if (!connection->ProcessReceived(header, packetSerializer, packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs))
+                {
+                    continue;
+                }
+
+                timeoutItem->UpdateTimeoutTime(startTimeMs);
+                connection->m_timeoutCounter = 0;
+
+                PacketDispatchResult handledPacket = PacketDispatchResult::Failure;
+                if (header.GetPacketType() < aznumeric_cast<PacketType>(CorePackets::PacketType::MAX))
+                {
+                    handledPacket = connection->HandleCorePacket(m_connectionListener, header, packetSerializer);
+                }
+                else
+                {
+                    handledPacket = m_connectionListener.OnPacketReceived(connection, header, packetSerializer);
+                }
+
+                if (handledPacket == PacketDispatchResult::Success)
+                {
+                    connection->UpdateHeartbeat(currentTimeMs);
+                    if (connection->GetConnectionState() == ConnectionState::Connecting && !connection->GetDtlsEndpoint().IsConnecting())
+                    {
+                        // Connection is realized once a packet is received and socket handshake is verified complete
+                        connection->m_state = ConnectionState::Connected;
+                    }
+                }
+                else if (m_socket->IsEncrypted() && connection->GetDtlsEndpoint().IsConnecting() &&
+                    !IsHandshakePacket(connection->GetDtlsEndpoint(), header.GetPacketType()))
+                {
+                    // It's possible for one side to finish its half of the encryption handshake and start sending encrypted data
+                    // This will appear as a SerializationError due to the incomplete encryption handshake
+                    // If it's not an expected unencrypted type then skip it for now
+                    continue;
+                }
+                else if (handledPacket == PacketDispatchResult::Skipped)
+                {
+                    // If the result is marked as skipped then do so (i.e. if a handshake is not yet complete)
+                    continue;
+                }
+                else if (connection->GetConnectionState() != ConnectionState::Disconnecting)
+                {
+                    connection->Disconnect(DisconnectReason::StreamError, TerminationEndpoint::Local);
+                }
+            }
+        }
+    }
+
+    void UdpNetworkInterface::AcceptConnection(uint32_t socketIndex, const UdpReaderThread::ReceivedPacket& connectPacket)
     {
         if (!m_allowIncomingConnections)
         {
@@ -691,7 +919,8 @@ namespace AzNetworking
 
         AZLOG(Debug_UdpConnect, "Accepted new Udp Connection");
         AZStd::unique_ptr<UdpConnection> connection = AZStd::make_unique<UdpConnection>(connectionId, connectPacket.m_address, *this, ConnectionRole::Acceptor);
-        DtlsEndpoint::ConnectResult result = m_socket->AcceptDtlsEndpoint(connection->GetDtlsEndpoint(), connectPacket.m_address);
+        DtlsEndpoint::ConnectResult result = GetSocket(socketIndex).AcceptDtlsEndpoint(connection->GetDtlsEndpoint(), connectPacket.m_address);
+        connection->SetSocketIndex(socketIndex);
 
         // Transition state based on our how our socket resolved
         connection->m_state = result == DtlsEndpoint::ConnectResult::Complete ? ConnectionState::Connected : ConnectionState::Connecting;
@@ -16,6 +16,7 @@
 #include <AzNetworking/Framework/INetworkInterface.h>
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzCore/Threading/ThreadSafeDeque.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 
 namespace AzNetworking
@@ -121,6 +122,21 @@ namespace AzNetworking
 
     private:
 
+        //! Returns the socket with the provided index, index 0 is the primary socket and higher indices are the additional listen sockets.
+        //! @param socketIndex index of the socket to return
+        //! @return reference to the requested socket, or the primary socket if the index is no longer valid
+        UdpSocket& GetSocket(uint32_t socketIndex) const;
+
+        //! Opens additional sockets on the listen port, each served by its own reader thread.
+        //! @param shardCount the number of additional sockets to open
+        void OpenListenShards(uint32_t shardCount);
+
+        //! Stops the reader threads of the additional listen sockets and closes the sockets.
+        void CloseListenShards();
+
+        //! Sends the queued payloads of all sockets.
+        void FlushSends();
+
         //! Registers a packet with a timeout queue on the provided connection.
         //! @param connectionId identifier of the connection to register
         //! @param packetId     packet id of the packet to register for the given connection
@@ -142,9 +158,21 @@ namespace AzNetworking
         //! @return packet id for the transmitted packet
         PacketId SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence);
 
+        //! Processes the packets that were received on a socket.
+        //! @param socketIndex index of the socket the packets were received on
+        //! @param packets     the packets to process
+        //! @param startTimeMs the time the update started, used to limit the time spent processing packets
+        void ProcessReceivedPackets(uint32_t socketIndex, const UdpReaderThread::ReceivedPackets& packets, AZ::TimeMs startTimeMs);
+
+        //! Decrypts received packets on job threads ahead of processing them, one job per connection so each connection's packets are
+        //! decrypted in the order they were received. Packets that can't be decrypted ahead of time are decrypted during processing.
+        //! @param packets the packets to decrypt
+        void DecodeReceivedPacketsInParallel(const UdpReaderThread::ReceivedPackets& packets);
+
         //! Accepts an incoming udp connection.
+        //! @param socketIndex   index of the socket the connectPacket was received on, which takes ownership of the connection
         //! @param connectPacket the initial connectPacket
-        void AcceptConnection(const UdpReaderThread::ReceivedPacket& connectPacket);
+        void AcceptConnection(uint32_t socketIndex, const UdpReaderThread::ReceivedPacket& connectPacket);
 
         //! Internal helper to cleanly remove a connection from the network interface.
         //! @param connection pointer to the connection to disconnect
@@ -183,6 +211,14 @@ namespace AzNetworking
         AZStd::unique_ptr<ICompressor> m_compressor;
         UdpReaderThread& m_readerThread;
 
+        //! An additional socket on the listen port, used when net_UdpListenSocketCount is above 1.
+        struct ListenShard
+        {
+            AZStd::unique_ptr<UdpSocket> m_socket;
+            AZStd::unique_ptr<UdpReaderThread> m_readerThread;
+        };
+        AZStd::vector<ListenShard> m_listenShards;
+
         struct RemovedConnection
         {
             UdpConnection* m_connection;
@@ -192,6 +228,18 @@ namespace AzNetworking
         AZStd::vector<RemovedConnection> m_removedConnections;
 
         UdpPacketEncodingBuffer m_decryptBuffer;
+
+        //! A received packet that was decrypted ahead of processing by DecodeReceivedPacketsInParallel.
+        struct DecodedPacket
+        {
+            UdpConnection* m_connection = nullptr;
+            const uint8_t* m_data = nullptr;
+            int32_t m_size = 0;
+            uint32_t m_nextPacketIndex = 0; // The next packet received from the same connection
+        };
+        AZStd::vector<DecodedPacket> m_decodedPackets;
+        AZStd::vector<uint8_t> m_decodedPacketBuffer;
+        AZStd::unordered_map<UdpConnection*, uint32_t> m_decodeLastPacketIndices;
         UdpPacketEncodingBuffer m_decompressBuffer;
 
         friend class UdpReliableQueue;
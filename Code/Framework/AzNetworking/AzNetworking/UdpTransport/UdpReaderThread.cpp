@@ -11,6 +11,7 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AzNetworking
 {
@@ -176,7 +177,6 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
                 const uint32_t bufferHead = static_cast<uint32_t>(receiveBuffer.GetSize());
                 if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
                 {
@@ -185,18 +185,45 @@ namespace AzNetworking
                     break;
                 }
 
+                const uint32_t batchCount = AZStd::min(
+                    AZStd::min(UdpSocket::MaxBatchedReceives,
+                        aznumeric_cast<uint32_t>((receiveBuffer.GetCapacity() - bufferHead) / MaxUdpTransmissionUnit)),
+                    aznumeric_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size()));
+                if (batchCount == 0)
+                {
+                    break;
+                }
+
                 uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                receiveBuffer.Resize(bufferHead + batchCount * MaxUdpTransmissionUnit);
+
+                IpAddress addresses[UdpSocket::MaxBatchedReceives];
+                uint32_t receivedSizes[UdpSocket::MaxBatchedReceives];
+                const int32_t receivedCount = socket->ReceiveBatch(addresses, dstData, receivedSizes, MaxUdpTransmissionUnit, batchCount);
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                // Each payload is received into its own MaxUdpTransmissionUnit sized slot, move them together so the buffer
+                // only holds the received data
+                uint8_t* packetData = dstData;
+                for (int32_t i = 0; i < receivedCount; ++i)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    if (receivedSizes[i] == 0)
+                    {
+                        continue;
+                    }
+
+                    const uint8_t* slotData = dstData + i * MaxUdpTransmissionUnit;
+                    if (packetData != slotData)
+                    {
+                        memmove(packetData, slotData, receivedSizes[i]);
+                    }
+                    receivedPackets.push_back(ReceivedPacket(addresses[i], packetData, aznumeric_cast<int32_t>(receivedSizes[i])));
+                    packetData += receivedSizes[i];
                 }
-                else
+                receiveBuffer.Resize(bufferHead + (packetData - dstData));
+
+                if (receivedCount < aznumeric_cast<int32_t>(batchCount))
                 {
-                    receiveBuffer.Resize(bufferHead);
+                    // No more data is waiting on the socket
                     break;
                 }
             }
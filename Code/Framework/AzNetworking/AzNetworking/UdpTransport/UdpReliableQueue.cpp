@@ -31,7 +31,7 @@ namespace AzNetworking
 
     uint32_t UdpReliableQueue::GetQueueSize() const
     {
-        return static_cast<uint32_t>(m_packetWindow.size());
+        return static_cast<uint32_t>(m_packetWindow.size() + m_deferredResends.size());
     }
 
     bool UdpReliableQueue::PrepareForSend(PacketId packetId, SequenceId reliableSequenceId, const IPacket& packet)
@@ -103,40 +103,59 @@ namespace AzNetworking
     {
         AZLOG(NET_ReliableQueueDebug, "Lost packetId %u", static_cast<uint32_t>(packetId));
 
-        bool result = false;
-        AZStd::unique_ptr<IPacket> lostPacket;
-        SequenceId lostReliableSequenceId = InvalidSequenceId;
-
         PendingPacketMap::iterator iter = m_packetWindow.find(packetId);
-        if (iter != m_packetWindow.end())
-        {
-            AZ_Assert(iter->second.m_packet != nullptr, "Timed out reliable packet was nullptr");
-            lostPacket = AZStd::move(iter->second.m_packet); // This transfers ownership out of the pending packet to this local scoped alloc
-            lostReliableSequenceId = iter->second.m_reliableSequenceId;
-            m_packetWindow.erase(iter);
-        }
-        else
+        if (iter == m_packetWindow.end())
         {
             AZLOG_ERROR("Failed to find timed out packetId %u in reliable queue", static_cast<uint32_t>(packetId));
+            return false;
         }
 
-        if (lostReliableSequenceId != InvalidSequenceId)
+        AZ_Assert(iter->second.m_packet != nullptr, "Timed out reliable packet was nullptr");
+        PendingPacket lostPacket = AZStd::move(iter->second); // This transfers ownership out of the pending packet to this local scoped alloc
+        m_packetWindow.erase(iter);
+
+        // Resends behind ones already waiting on the pacing budget are deferred too, so they keep their order
+        if (!m_deferredResends.empty() || !connection.HasSendBudget(AZ::GetElapsedTimeMs()))
         {
-            AZLOG(NET_ReliableQueue, "Resending reliable packetId %u due to loss", static_cast<uint32_t>(lostReliableSequenceId));
+            AZLOG(NET_ReliableQueue, "Deferring resend of reliable packetId %u due to congestion", static_cast<uint32_t>(lostPacket.m_reliableSequenceId));
+            m_deferredResends.emplace_back(AZStd::move(lostPacket));
+            return false;
+        }
 
-            // This punches down an abstraction layer purposefully to resend using the existing reliable SequenceId
-            // NOTE: This will call back into UdpReliableQueue::PrepareForSend!!
-            if (networkInterface.SendPacket(connection, *lostPacket, lostReliableSequenceId) == InvalidPacketId)
+        return ResendPacket(networkInterface, connection, lostPacket);
+    }
+
+    void UdpReliableQueue::SendDeferredResends(UdpNetworkInterface& networkInterface, UdpConnection& connection)
+    {
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+        while (!m_deferredResends.empty() && connection.HasSendBudget(currentTimeMs))
+        {
+            PendingPacket lostPacket = AZStd::move(m_deferredResends.front());
+            m_deferredResends.pop_front();
+            if (ResendPacket(networkInterface, connection, lostPacket))
             {
-                // Packet failed to retransmit, meaning no retry attempt was made
-                // Since we've lost a reliable packet, the appropriate response is to terminate the connection
-                connection.Disconnect(DisconnectReason::ReliableTransportFailure, TerminationEndpoint::Local);
-                result = true;
+                m_deferredResends.clear();
+                break;
             }
+        }
+    }
 
-            networkInterface.GetMetrics().m_resentPackets++;
+    bool UdpReliableQueue::ResendPacket(UdpNetworkInterface& networkInterface, UdpConnection& connection, PendingPacket& lostPacket)
+    {
+        bool result = false;
+        AZLOG(NET_ReliableQueue, "Resending reliable packetId %u due to loss", static_cast<uint32_t>(lostPacket.m_reliableSequenceId));
+
+        // This punches down an abstraction layer purposefully to resend using the existing reliable SequenceId
+        // NOTE: This will call back into UdpReliableQueue::PrepareForSend!!
+        if (networkInterface.SendPacket(connection, *lostPacket.m_packet, lostPacket.m_reliableSequenceId) == InvalidPacketId)
+        {
+            // Packet failed to retransmit, meaning no retry attempt was made
+            // Since we've lost a reliable packet, the appropriate response is to terminate the connection
+            connection.Disconnect(DisconnectReason::ReliableTransportFailure, TerminationEndpoint::Local);
+            result = true;
         }
 
+        networkInterface.GetMetrics().m_resentPackets++;
         return result;
     }
 }
@@ -12,6 +12,7 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/SequenceGenerator.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/unordered_map.h>
 
 namespace AzNetworking
@@ -68,16 +69,27 @@ namespace AzNetworking
         //! @return boolean true if the packet was lost and no retry attempt was made, false otherwise
         bool OnPacketLost(UdpNetworkInterface& networkInterface, UdpConnection& connection, PacketId packetId);
 
+        //! Resends lost packets that were deferred because the connection had exceeded its paced send rate.
+        //! @param networkInterface reference to the network interface bound to the UdpConnection instance
+        //! @param connection       reference of the connection instance to resend on
+        void SendDeferredResends(UdpNetworkInterface& networkInterface, UdpConnection& connection);
+
     private:
 
         static constexpr uint32_t PacketWindowAckCount = 16384; // The total number of packet id's to track
 
         using PacketAckContainer = RingbufferBitset<PacketWindowAckCount>;
         using PendingPacketMap = AZStd::unordered_map<PacketId, PendingPacket>;
+        using PendingPacketQueue = AZStd::deque<PendingPacket>;
+
+        //! Resends a lost packet using its existing reliable sequence id.
+        //! @return boolean true if the resend failed and the connection was disconnected, false otherwise
+        bool ResendPacket(UdpNetworkInterface& networkInterface, UdpConnection& connection, PendingPacket& lostPacket);
 
         SequenceGenerator  m_reliableSequenceGenerator;
         SequenceId         m_lastReceivedReliableSequenceId = InvalidSequenceId;
         PacketAckContainer m_receivedSequenceHistory;
         PendingPacketMap   m_packetWindow;
+        PendingPacketQueue m_deferredResends;
     };
 }
@@ -23,6 +23,8 @@ namespace AzNetworking
     AZ_CVAR(int32_t, net_UdpSendBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket send buffer size");
     AZ_CVAR(int32_t, net_UdpRecvBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket receive buffer size");
     AZ_CVAR(bool, net_UdpIgnoreWin10054, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, will ignore 10054 socket errors on windows");
+    AZ_CVAR(bool, net_UdpBatchSends, AZ_TRAIT_USE_SOCKET_MMSG != 0, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, UDP sockets opened afterwards queue their payloads and send them together when the network interface updates");
 
     UdpSocket::~UdpSocket()
     {
@@ -68,6 +70,12 @@ namespace AzNetworking
             }
         }
 
+        if (m_reusePort && !SetSocketReusePort(m_socketFd))
+        {
+            Close();
+            return false;
+        }
+
         // Handle binding
         {
             sockaddr_in hints;
@@ -91,11 +99,14 @@ namespace AzNetworking
             return false;
         }
 
+        m_batchSends = net_UdpBatchSends;
         return true;
     }
 
     void UdpSocket::Close()
     {
+        // Send anything that's still queued, such as disconnect packets
+        FlushSends();
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
@@ -108,7 +119,7 @@ namespace AzNetworking
         bool encrypt,
         DtlsEndpoint& dtlsEndpoint,
         [[maybe_unused]] const ConnectionQuality& connectionQuality
-    ) const
+    )
     {
         AZ_Assert(size > 0, "Invalid data size for send");
         AZ_Assert(data != nullptr, "NULL data pointer passed to send");
@@ -224,8 +235,232 @@ namespace AzNetworking
         return receivedBytes;
     }
 
+    int32_t UdpSocket::ReceiveBatch(IpAddress* outAddresses, uint8_t* outData, uint32_t* outSizes, uint32_t size, uint32_t count) const
+    {
+        AZ_Assert(size > 0, "Invalid data size for receive");
+        AZ_Assert(outData != nullptr, "NULL data pointer passed to receive");
+
+        if (!IsOpen())
+        {
+            return 0;
+        }
+
+#if AZ_TRAIT_USE_SOCKET_MMSG
+        count = AZStd::min(count, MaxBatchedReceives);
+
+        sockaddr_in from[MaxBatchedReceives];
+        iovec buffers[MaxBatchedReceives];
+        mmsghdr messages[MaxBatchedReceives];
+        memset(messages, 0, sizeof(mmsghdr) * count);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            buffers[i].iov_base = outData + i * size;
+            buffers[i].iov_len = size;
+            messages[i].msg_hdr.msg_name = &from[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(from[i]);
+            messages[i].msg_hdr.msg_iov = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        const int32_t receivedCount = recvmmsg(static_cast<int32_t>(m_socketFd), messages, count, 0, nullptr);
+        if (receivedCount < 0)
+        {
+            const int32_t error = GetLastNetworkError();
+            if (!ErrorIsWouldBlock(error)) // Filter would block messages
+            {
+                AZLOG_WARN("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            }
+            return 0;
+        }
+
+        for (int32_t i = 0; i < receivedCount; ++i)
+        {
+            outAddresses[i] = IpAddress(ByteOrder::Network, from[i].sin_addr.s_addr, from[i].sin_port);
+            outSizes[i] = messages[i].msg_len;
+            if (outSizes[i] > 0)
+            {
+                m_recvPackets++;
+                m_recvBytes += outSizes[i];
+            }
+        }
+        return receivedCount;
+#else
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const int32_t receivedBytes = Receive(outAddresses[i], outData + i * size, size);
+            if (receivedBytes <= 0)
+            {
+                // Report the payloads that were received before the error, the error will be returned again on the next call
+                return (receivedBytes < 0 && i == 0) ? receivedBytes : aznumeric_cast<int32_t>(i);
+            }
+            outSizes[i] = aznumeric_cast<uint32_t>(receivedBytes);
+        }
+        return aznumeric_cast<int32_t>(count);
+#endif
+    }
+
+    uint8_t* UdpSocket::BatchWriteBuffer::GetData() const
+    {
+        return m_lock.owns_lock() ? m_data : nullptr;
+    }
+
+    UdpSocket::BatchWriteBuffer UdpSocket::AcquireWriteBuffer(uint32_t size, bool encrypt, [[maybe_unused]] const ConnectionQuality& connectionQuality)
+    {
+        if (!IsOpen() || (encrypt && IsEncrypted()))
+        {
+            return {};
+        }
+
+#ifdef ENABLE_LATENCY_DEBUG
+        // Simulated loss and latency are applied by Send
+        if ((connectionQuality.m_lossPercentage > 0)
+         || (connectionQuality.m_latencyMs > AZ::Time::ZeroTimeMs)
+         || (connectionQuality.m_varianceMs > AZ::Time::ZeroTimeMs))
+        {
+            return {};
+        }
+#endif
+
+        return ReserveBatchedSend(size);
+    }
+
+    int32_t UdpSocket::SendWriteBuffer(BatchWriteBuffer& writeBuffer, const IpAddress& address, uint32_t size)
+    {
+        AZ_Assert(size > 0, "Invalid data size for send");
+        AZ_Assert(address.GetAddress(ByteOrder::Host) != 0, "Invalid address");
+
+        CommitBatchedSend(writeBuffer, address, size);
+        m_sentPackets++;
+        m_sentBytes += size;
+        return aznumeric_cast<int32_t>(size);
+    }
+
+    UdpSocket::BatchWriteBuffer UdpSocket::ReserveBatchedSend(uint32_t size)
+    {
+        BatchWriteBuffer writeBuffer;
+        if (!m_batchSends || size > MaxUdpTransmissionUnit)
+        {
+            return writeBuffer;
+        }
+
+        writeBuffer.m_lock = AZStd::unique_lock<AZStd::mutex>(m_sendBatchMutex);
+        if (m_sendBatch.full() || m_sendBatchBuffer.GetSize() + size > m_sendBatchBuffer.GetCapacity())
+        {
+            FlushBatch();
+        }
+        writeBuffer.m_data = m_sendBatchBuffer.GetBufferEnd();
+        return writeBuffer;
+    }
+
+    void UdpSocket::CommitBatchedSend(BatchWriteBuffer& writeBuffer, const IpAddress& address, uint32_t size)
+    {
+        AZ_Assert(writeBuffer.GetData() == m_sendBatchBuffer.GetBufferEnd(), "Committed payload wasn't written to space reserved in this send batch");
+        AZ_Assert(size <= MaxUdpTransmissionUnit, "Batched payload exceeds the maximum transmission unit");
+        const uint32_t offset = aznumeric_cast<uint32_t>(m_sendBatchBuffer.GetSize());
+        m_sendBatchBuffer.Resize(offset + size);
+        m_sendBatch.push_back(BatchedSend{ address, offset, size });
+        writeBuffer.m_lock.unlock();
+        writeBuffer.m_data = nullptr;
+    }
+
+    void UdpSocket::FlushSends()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_sendBatchMutex);
+        FlushBatch();
+    }
+
+    void UdpSocket::FlushBatch()
+    {
+        if (m_sendBatch.empty())
+        {
+            return;
+        }
+
+        if (IsOpen())
+        {
+#if AZ_TRAIT_USE_SOCKET_MMSG
+            const uint32_t count = aznumeric_cast<uint32_t>(m_sendBatch.size());
+            sockaddr_in destAddrs[MaxBatchedSends];
+            iovec buffers[MaxBatchedSends];
+            mmsghdr messages[MaxBatchedSends];
+            memset(destAddrs, 0, sizeof(sockaddr_in) * count);
+            memset(messages, 0, sizeof(mmsghdr) * count);
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                const BatchedSend& send = m_sendBatch[i];
+                destAddrs[i].sin_family = AF_INET;
+                destAddrs[i].sin_addr.s_addr = send.m_address.GetAddress(ByteOrder::Network);
+                destAddrs[i].sin_port = send.m_address.GetPort(ByteOrder::Network);
+                buffers[i].iov_base = const_cast<uint8_t*>(m_sendBatchBuffer.GetBuffer() + send.m_offset);
+                buffers[i].iov_len = send.m_size;
+                messages[i].msg_hdr.msg_name = &destAddrs[i];
+                messages[i].msg_hdr.msg_namelen = sizeof(destAddrs[i]);
+                messages[i].msg_hdr.msg_iov = &buffers[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            uint32_t sentCount = 0;
+            while (sentCount < count)
+            {
+                const int32_t result = sendmmsg(static_cast<int32_t>(m_socketFd), messages + sentCount, count - sentCount, 0);
+                if (result > 0)
+                {
+                    sentCount += result;
+                    continue;
+                }
+
+                const int32_t error = GetLastNetworkError();
+                if (ErrorIsWouldBlock(error))
+                {
+                    // The socket buffer is full, drop the rest of the batch the same way individual sends would be dropped
+                    break;
+                }
+
+                // Skip the payload that failed so the rest of the batch is still sent
+                AZLOG_WARN("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                ++sentCount;
+            }
+#else
+            for (const BatchedSend& send : m_sendBatch)
+            {
+                if (SendImmediate(send.m_address, m_sendBatchBuffer.GetBuffer() + send.m_offset, send.m_size) < 0)
+                {
+                    const int32_t error = GetLastNetworkError();
+                    if (!ErrorIsWouldBlock(error)) // Filter would block messages
+                    {
+                        AZLOG_WARN("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                    }
+                }
+            }
+#endif
+        }
+
+        m_sendBatch.clear();
+        m_sendBatchBuffer.Resize(0);
+    }
+
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
-        [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
+        [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint)
+    {
+        if (!m_batchSends)
+        {
+            return SendImmediate(address, data, size);
+        }
+
+        BatchWriteBuffer writeBuffer = ReserveBatchedSend(size);
+        if (uint8_t* batchedData = writeBuffer.GetData())
+        {
+            memcpy(batchedData, data, size);
+            CommitBatchedSend(writeBuffer, address, size);
+            return aznumeric_cast<int32_t>(size);
+        }
+
+        // Keep the payloads in order if a payload that doesn't fit into the batch is sent
+        FlushSends();
+        return SendImmediate(address, data, size);
+    }
+
+    int32_t UdpSocket::SendImmediate(const IpAddress& address, const uint8_t* data, uint32_t size) const
     {
         sockaddr_in destAddr;
         memset(&destAddr, 0, sizeof(destAddr));
@@ -236,7 +471,7 @@ namespace AzNetworking
     }
 
 #ifdef ENABLE_LATENCY_DEBUG
-    int32_t UdpSocket::SendInternalDeferred(const DeferredData& data) const
+    int32_t UdpSocket::SendInternalDeferred(const DeferredData& data)
     {
         return SendInternal(data.m_address, data.m_dataBuffer.GetBuffer(), static_cast<uint32_t>(data.m_dataBuffer.GetSize()), data.m_encrypt, *data.m_dtlsEndpoint);
     }
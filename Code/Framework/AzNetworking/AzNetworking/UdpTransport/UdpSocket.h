@@ -8,12 +8,15 @@
 
 #pragma once
 
+#include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzNetworking/Utilities/IpAddress.h>
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
 
 #ifndef _RELEASE
 #   define ENABLE_LATENCY_DEBUG 1
@@ -42,6 +45,24 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
+        //! Maximum number of payloads ReceiveBatch receives with a single system call.
+        static constexpr uint32_t MaxBatchedReceives = 64;
+
+        //! Space at the end of the send batch that a payload is written to directly, see AcquireWriteBuffer.
+        //! The send batch stays locked while the space is held, so other threads can neither flush it nor write after it.
+        //! Destroying the buffer without sending it releases the space.
+        class BatchWriteBuffer
+        {
+        public:
+            //! Returns the space to write the payload to, or nullptr if no space is held.
+            uint8_t* GetData() const;
+
+        private:
+            friend class UdpSocket;
+            AZStd::unique_lock<AZStd::mutex> m_lock;
+            uint8_t* m_data = nullptr;
+        };
+
         UdpSocket() = default;
         virtual ~UdpSocket();
 
@@ -72,6 +93,11 @@ namespace AzNetworking
         //! Closes an open socket.
         virtual void Close();
 
+        //! Sets whether the socket is opened with port reuse, so several sockets can share a port and receive its traffic in turn.
+        //! Only takes effect the next time the socket is opened.
+        //! @param reusePort if true, the socket enables port reuse before binding
+        void SetReusePort(bool reusePort);
+
         //! Returns true if the UDP socket is currently in an open state.
         //! @return boolean true if the socket is in a connected state
         bool IsOpen() const;
@@ -84,7 +110,7 @@ namespace AzNetworking
         //! @param dtlsEndpoint      data required for DTLS encryption
         //! @param connectionQuality debug connection quality parameters
         //! @return number of bytes sent, <= 0 on error
-        int32_t Send(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint, const ConnectionQuality& connectionQuality) const;
+        int32_t Send(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint, const ConnectionQuality& connectionQuality);
 
         //! Receives a payload from the UDP socket.
         //! @param outAddress on success, the address of the endpoint that sent the data
@@ -93,6 +119,36 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives multiple payloads from the UDP socket, using a single system call on platforms that support it.
+        //! @param outAddresses on success, the addresses of the endpoints that sent the data, count entries
+        //! @param outData      on success, address to write the received data to, payload i is written to outData + i * size
+        //! @param outSizes     on success, the number of bytes received for each payload, count entries
+        //! @param size         maximum size of a single payload
+        //! @param count        maximum number of payloads to receive
+        //! @return number of payloads received, < 0 on error
+        int32_t ReceiveBatch(IpAddress* outAddresses, uint8_t* outData, uint32_t* outSizes, uint32_t size, uint32_t count) const;
+
+        //! Returns a buffer at the end of the send batch that a payload can be written to directly, so the payload doesn't have to be
+        //! copied into the batch when it's sent with SendWriteBuffer. Other threads sending on the socket wait until the buffer is
+        //! sent or destroyed, so the calling thread must not send anything else on the socket in between.
+        //! @param size              the maximum size of the payload that will be written
+        //! @param encrypt           signals that the payload should be encrypted, which the socket has to do before it's queued
+        //! @param connectionQuality debug connection quality parameters, payloads with simulated loss or latency go through Send
+        //! @return the buffer to write the payload to, its data is nullptr if the payload has to be sent with Send instead
+        BatchWriteBuffer AcquireWriteBuffer(uint32_t size, bool encrypt, const ConnectionQuality& connectionQuality);
+
+        //! Queues the payload that was written to the buffer returned by AcquireWriteBuffer for sending, and releases the buffer.
+        //! @param writeBuffer the buffer the payload was written to
+        //! @param address     the address to send the payload to
+        //! @param size        size of the written payload in bytes
+        //! @return number of bytes sent
+        int32_t SendWriteBuffer(BatchWriteBuffer& writeBuffer, const IpAddress& address, uint32_t size);
+
+        //! Sends all payloads that were queued for sending since the last flush.
+        //! Payloads are only queued if net_UdpBatchSends is enabled, otherwise they're sent immediately and this does nothing.
+        //! This is safe to call while other threads send on the socket.
+        void FlushSends();
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -126,11 +182,44 @@ namespace AzNetworking
         mutable uint32_t m_sentPacketsEncrypted = 0;
         mutable uint32_t m_sentBytesEncryptionInflation = 0;
 
-        virtual int32_t SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint) const;
+        virtual int32_t SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size, bool encrypt, DtlsEndpoint& dtlsEndpoint);
+
+        //! Reserves space for a payload at the end of the send batch, flushing the batch first if it's full.
+        //! @param size the maximum size of the payload
+        //! @return the space to write the payload to, its data is nullptr if sends aren't batched or the payload is too large for the batch
+        BatchWriteBuffer ReserveBatchedSend(uint32_t size);
+
+        //! Adds the payload that was written to the space returned by ReserveBatchedSend to the send batch and releases the space.
+        //! @param writeBuffer the space the payload was written to
+        //! @param address     the address to send the payload to
+        //! @param size        size of the written payload in bytes
+        void CommitBatchedSend(BatchWriteBuffer& writeBuffer, const IpAddress& address, uint32_t size);
+
+        //! Sends the payloads in the send batch, the caller must hold m_sendBatchMutex.
+        void FlushBatch();
+
+        //! Guards the send batch, connections may be updated on several threads that send on the same socket.
+        AZStd::mutex m_sendBatchMutex;
 
     private:
 
+        static constexpr uint32_t MaxBatchedSends = 64;
+
+        //! A payload that's waiting in the send batch, the data is stored in m_sendBatchBuffer.
+        struct BatchedSend
+        {
+            IpAddress m_address;
+            uint32_t m_offset = 0;
+            uint32_t m_size = 0;
+        };
+
+        int32_t SendImmediate(const IpAddress& address, const uint8_t* data, uint32_t size) const;
+
         SocketFd m_socketFd = InvalidSocketFd;
+        bool m_batchSends = false;
+        bool m_reusePort = false;
+        AZStd::fixed_vector<BatchedSend, MaxBatchedSends> m_sendBatch;
+        ByteBuffer<MaxBatchedSends * MaxUdpTransmissionUnit> m_sendBatchBuffer;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
@@ -155,7 +244,7 @@ namespace AzNetworking
             ChunkBuffer m_dataBuffer;
         };
 
-        int32_t SendInternalDeferred(const DeferredData& data) const;
+        int32_t SendInternalDeferred(const DeferredData& data);
 
         mutable AZ::SimpleLcgRandom m_random;
 #endif
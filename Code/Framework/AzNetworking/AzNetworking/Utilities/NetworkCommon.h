@@ -82,6 +82,12 @@ namespace AzNetworking
     //! @return boolean true on success
     bool SetSocketBufferSizes(SocketFd socketFd, int32_t sendSize, int32_t recvSize);
 
+    //! Allows multiple sockets to bind to the same port, the kernel distributes incoming datagrams between them.
+    //! Must be called before the socket is bound, fails on platforms that don't balance load across reuseport sockets.
+    //! @param socketFd identifier of the socket to enable port reuse for
+    //! @return boolean true on success
+    bool SetSocketReusePort(SocketFd socketFd);
+
     //! Closes the provided socket.
     //! @param socketFd identifier of socket to close
     void CloseSocket(SocketFd socketFd);
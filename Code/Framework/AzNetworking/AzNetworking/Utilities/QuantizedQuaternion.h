@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzNetworking/Serialization/ISerializer.h>
+
+namespace AzNetworking
+{
+    //! Quantizes a rotation using the smallest three encoding.
+    //! The largest component of a unit quaternion can be reconstructed from the other three, and the other three are bounded to
+    //! [-1/sqrt(2), 1/sqrt(2)], so only the index of the largest component and the three smallest components are transmitted.
+    //! All of them are bit-packed into a single integral of NUM_BYTES bytes, using 2 bits for the index and
+    //! (NUM_BYTES * 8 - 2) / 3 bits for each of the three components.
+    template <AZStd::size_t NUM_BYTES>
+    class QuantizedQuaternion
+    {
+    public:
+
+        static_assert(NUM_BYTES == 2 || NUM_BYTES == 4 || NUM_BYTES == 8, "QuantizedQuaternion supports 2, 4 or 8 bytes");
+
+        using SelfType = QuantizedQuaternion<NUM_BYTES>;
+        using ValueType = AZ::Quaternion;
+        using PackedType = typename AZ::SizeType<NUM_BYTES, false>::Type;
+
+        static constexpr uint32_t BitsPerComponent = (NUM_BYTES * 8 - 2) / 3;
+        static constexpr PackedType ComponentMask = (PackedType(1) << BitsPerComponent) - 1;
+        //! The largest quantized component value, one less than the mask so the range has an exact zero at its center.
+        static constexpr PackedType MaxComponentValue = ComponentMask - 1;
+
+        //! Default constructor, holds the identity rotation.
+        QuantizedQuaternion();
+
+        //! Copy construct from same type.
+        //! @param value instance to construct from
+        QuantizedQuaternion(const SelfType& value) = default;
+
+        //! Construct from a rotation.
+        //! @param value rotation to construct from, expected to be normalized
+        explicit QuantizedQuaternion(const ValueType& value);
+
+        //! Assignment from same type.
+        //! @param rhs instance to assign from
+        SelfType& operator =(const SelfType& rhs) = default;
+
+        //! Assignment from a rotation.
+        //! @param rhs rotation to assign from, expected to be normalized
+        SelfType& operator =(const ValueType& rhs);
+
+        //! Const underlying type operator.
+        //! @return the decoded rotation
+        operator ValueType() const;
+
+        //! Equality operator.
+        //! @param rhs base type value to compare against
+        //! @return boolean true if this == rhs
+        bool operator ==(const SelfType& rhs) const;
+
+        //! Inequality operator.
+        //! @param rhs base type value to compare against
+        //! @return boolean true if this != rhs
+        bool operator !=(const SelfType& rhs) const;
+
+        //! Retrieves the bit-packed integral value used during serialization of this QuantizedQuaternion instance.
+        //! @return the bit-packed integral value used during serialization of this QuantizedQuaternion instance
+        PackedType GetPackedValue() const;
+
+        //! Base serialize method for all serializable structures or classes to implement.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        bool Serialize(ISerializer& serializer);
+
+    private:
+
+        //! Helper method to convert and store an un-quantized rotation.
+        //! @param value the input rotation to convert and store
+        void Set(const ValueType& value);
+
+        //! Takes the bit-packed integral value and stores the decoded rotation.
+        void DecodePackedValue();
+
+        PackedType m_packedValue = 0;
+        ValueType m_quantizedValue = ValueType::CreateIdentity();
+    };
+}
+
+#include <AzNetworking/Utilities/QuantizedQuaternion.inl>
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+#include <cmath>
+
+namespace AzNetworking
+{
+    // The largest magnitude any of the three smallest components of a unit quaternion can have, 1 / sqrt(2)
+    static constexpr float QuantizedQuaternionMaxComponent = 0.707106781f;
+
+    template <AZStd::size_t NUM_BYTES>
+    inline QuantizedQuaternion<NUM_BYTES>::QuantizedQuaternion()
+    {
+        Set(ValueType::CreateIdentity());
+    }
+
+    template <AZStd::size_t NUM_BYTES>
+    inline QuantizedQuaternion<NUM_BYTES>::QuantizedQuaternion(const ValueType& value)
+    {
+        Set(value);
+    }
+
+    template <AZStd::size_t NUM_BYTES>
+    inline QuantizedQuaternion<NUM_BYTES>& QuantizedQuaternion<NUM_BYTES>::operator =(const ValueType& rhs)
+    {
+        Set(rhs);
+        return *this;
+    }
+
+    template <AZStd::size_t NUM_BYTES>
+    inline QuantizedQuaternion<NUM_BYTES>::operator ValueType() const
+    {
+        return m_quantizedValue;
+    }
+
+    template <AZStd::size_t NUM_BYTES>
+    inline bool QuantizedQuaternion<NUM_BYTES>::operator ==(const SelfType& rhs) const
+    {
+        return m_packedValue == rhs.m_packedValue;
+    }
+
+    template <AZStd::size_t NUM_BYTES>
+    inline bool QuantizedQuaternion<NUM_BYTES>::operator !=(const SelfType& rhs) const
+    {
+        return m_packedValue != rhs.m_packedValue;
+    }
+
+    template <AZStd::size_t NUM_BYTES>
+    inline typename QuantizedQuaternion<NUM_BYTES>::PackedType QuantizedQuaternion<NUM_BYTES>::GetPackedValue() const
+    {
+        return m_packedValue;
+    }
+
+    template <AZStd::size_t NUM_BYTES>
+    inline bool QuantizedQuaternion<NUM_BYTES>::Serialize(ISerializer& serializer)
+    {
+        serializer.Serialize(m_packedValue, "PackedValue");
+        if (serializer.GetSerializerMode() == SerializerMode::WriteToObject)
+        {
+            DecodePackedValue();
+        }
+        return serializer.IsValid();
+    }
+
+    template <AZStd::size_t NUM_BYTES>
+    inline void QuantizedQuaternion<NUM_BYTES>::Set(const ValueType& value)
+    {
+        int32_t largestIndex = 0;
+        for (int32_t i = 1; i < 4; ++i)
+        {
+            if (AZ::GetAbs(value.GetElement(i)) > AZ::GetAbs(value.GetElement(largestIndex)))
+            {
+                largestIndex = i;
+            }
+        }
+
+        // q and -q describe the same rotation, flip the sign so the largest component is positive and can be reconstructed
+        const float sign = (value.GetElement(largestIndex) < 0.0f) ? -1.0f : 1.0f;
+        PackedType packedValue = static_cast<PackedType>(largestIndex);
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            if (i != largestIndex)
+            {
+                const float normalized = (sign * value.GetElement(i) / QuantizedQuaternionMaxComponent + 1.0f) * 0.5f;
+                const float scaled = AZStd::clamp(normalized, 0.0f, 1.0f) * static_cast<float>(MaxComponentValue) + 0.5f;
+                packedValue = static_cast<PackedType>((packedValue << BitsPerComponent) | static_cast<PackedType>(scaled));
+            }
+        }
+        m_packedValue = packedValue;
+        DecodePackedValue();
+    }
+
+    template <AZStd::size_t NUM_BYTES>
+    inline void QuantizedQuaternion<NUM_BYTES>::DecodePackedValue()
+    {
+        const int32_t largestIndex = static_cast<int32_t>((m_packedValue >> (3 * BitsPerComponent)) & 0x3);
+        PackedType remainingValue = m_packedValue;
+        float sumOfSquares = 0.0f;
+        float largestOtherComponent = 0.0f;
+
+        // Components were packed in ascending order, so the last component is in the lowest bits
+        for (int32_t i = 3; i >= 0; --i)
+        {
+            if (i != largestIndex)
+            {
+                const float normalized = static_cast<float>(remainingValue & ComponentMask) / static_cast<float>(MaxComponentValue);
+                const float component = (normalized * 2.0f - 1.0f) * QuantizedQuaternionMaxComponent;
+                m_quantizedValue.SetElement(i, component);
+                sumOfSquares += component * component;
+                largestOtherComponent = AZStd::max(largestOtherComponent, AZ::GetAbs(component));
+                remainingValue = static_cast<PackedType>(remainingValue >> BitsPerComponent);
+            }
+        }
+
+        // Near ties the reconstructed component can come out smaller than another one, keep it the largest so that quantizing the
+        // decoded rotation again selects the same component and produces the same packed value
+        const float largestComponent = AZ::Sqrt(AZStd::max(0.0f, 1.0f - sumOfSquares));
+        m_quantizedValue.SetElement(largestIndex, AZStd::max(largestComponent, std::nextafter(largestOtherComponent, 1.0f)));
+    }
+}
@@ -61,6 +61,7 @@ set(FILES
     Serialization/NetworkOutputSerializer.cpp
     Serialization/NetworkOutputSerializer.h
     Serialization/NetworkOutputSerializer.inl
+    Serialization/QuantizedSerializer.h
     Serialization/StringifySerializer.cpp
     Serialization/StringifySerializer.h
     Serialization/TrackChangedSerializer.h
@@ -97,6 +98,8 @@ set(FILES
     UdpTransport/DtlsEndpoint.h
     UdpTransport/DtlsSocket.cpp
     UdpTransport/DtlsSocket.h
+    UdpTransport/UdpCongestionController.cpp
+    UdpTransport/UdpCongestionController.h
     UdpTransport/UdpConnection.cpp
     UdpTransport/UdpConnection.h
     UdpTransport/UdpConnection.inl
@@ -134,6 +137,8 @@ set(FILES
     Utilities/NetworkCommon.h
     Utilities/NetworkCommon.inl
     Utilities/NetworkIncludes.h
+    Utilities/QuantizedQuaternion.h
+    Utilities/QuantizedQuaternion.inl
     Utilities/QuantizedValues.h
     Utilities/QuantizedValues.inl
     Utilities/TimedThread.cpp
@@ -11,4 +11,38 @@
 
 namespace UnitTest
 {
+    TEST(FixedSizeVectorBitset, TestEquality)
+    {
+        AzNetworking::FixedSizeVectorBitset<64> lhs;
+        AzNetworking::FixedSizeVectorBitset<64> rhs;
+        EXPECT_EQ(lhs, rhs);
+
+        lhs.Resize(20);
+        EXPECT_NE(lhs, rhs);
+        rhs.Resize(20);
+        EXPECT_EQ(lhs, rhs);
+
+        lhs.SetBit(3, true);
+        lhs.SetBit(17, true);
+        EXPECT_NE(lhs, rhs);
+        rhs.SetBit(3, true);
+        rhs.SetBit(17, true);
+        EXPECT_EQ(lhs, rhs);
+    }
+
+    TEST(FixedSizeVectorBitset, TestEqualityIgnoresBitsPastSize)
+    {
+        AzNetworking::FixedSizeVectorBitset<64> lhs;
+        AzNetworking::FixedSizeVectorBitset<64> rhs;
+        lhs.Resize(20);
+        rhs.Resize(20);
+
+        lhs.PushBack(true);
+        lhs.PopBack();
+        EXPECT_EQ(lhs, rhs);
+
+        lhs.PushBack(true);
+        rhs.PushBack(false);
+        EXPECT_NE(lhs, rhs);
+    }
 }
@@ -7,8 +7,178 @@
  */
 
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
+#include <AzCore/Time/TimeSystem.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 namespace UnitTest
 {
+    using namespace AzNetworking;
+
+    class TimeoutQueueTests
+        : public LeakDetectionFixture
+        , public ::testing::WithParamInterface<TimeoutQueueMode>
+    {
+    public:
+
+        void SetUp() override
+        {
+            m_timeSystem = AZStd::make_unique<AZ::TimeSystem>();
+            SetTime(AZ::TimeMs{ 10000 });
+            m_timeoutQueue = AZStd::make_unique<TimeoutQueue>(GetParam());
+        }
+
+        void TearDown() override
+        {
+            m_timeoutQueue.reset();
+            m_timeSystem.reset();
+        }
+
+        void SetTime(AZ::TimeMs timeMs)
+        {
+            m_timeSystem->SetElapsedTimeMsDebug(timeMs);
+        }
+
+        uint32_t UpdateTimeouts(TimeoutResult result, int32_t maxTimeouts = -1)
+        {
+            uint32_t timeoutCount = 0;
+            m_timeoutQueue->UpdateTimeouts([&timeoutCount, result](TimeoutQueue::TimeoutItem&)
+            {
+                ++timeoutCount;
+                return result;
+            }, maxTimeouts);
+            return timeoutCount;
+        }
+
+        AZStd::unique_ptr<AZ::TimeSystem> m_timeSystem;
+        AZStd::unique_ptr<TimeoutQueue> m_timeoutQueue;
+    };
+
+    TEST_P(TimeoutQueueTests, ItemExpiresAfterTimeout)
+    {
+        const TimeoutId timeoutId = m_timeoutQueue->RegisterItem(42, AZ::TimeMs{ 1000 });
+        EXPECT_EQ(m_timeoutQueue->GetMode(), GetParam());
+
+        SetTime(AZ::TimeMs{ 10500 });
+        EXPECT_EQ(UpdateTimeouts(TimeoutResult::Delete), 0);
+        ASSERT_NE(m_timeoutQueue->RetrieveItem(timeoutId), nullptr);
+        EXPECT_EQ(m_timeoutQueue->RetrieveItem(timeoutId)->m_userData, 42);
+
+        uint64_t expiredUserData = 0;
+        SetTime(AZ::TimeMs{ 11500 });
+        m_timeoutQueue->UpdateTimeouts([&expiredUserData](TimeoutQueue::TimeoutItem& item)
+        {
+            expiredUserData = item.m_userData;
+            return TimeoutResult::Delete;
+        });
+        EXPECT_EQ(expiredUserData, 42);
+        EXPECT_EQ(m_timeoutQueue->RetrieveItem(timeoutId), nullptr);
+    }
+
+    TEST_P(TimeoutQueueTests, RemovedItemDoesNotExpire)
+    {
+        const TimeoutId timeoutId = m_timeoutQueue->RegisterItem(1, AZ::TimeMs{ 1000 });
+        m_timeoutQueue->RegisterItem(2, AZ::TimeMs{ 1000 });
+        m_timeoutQueue->RemoveItem(timeoutId);
+        EXPECT_EQ(m_timeoutQueue->RetrieveItem(timeoutId), nullptr);
+
+        SetTime(AZ::TimeMs{ 11500 });
+        EXPECT_EQ(UpdateTimeouts(TimeoutResult::Delete), 1);
+    }
+
+    TEST_P(TimeoutQueueTests, RefreshedItemExpiresAgain)
+    {
+        const TimeoutId timeoutId = m_timeoutQueue->RegisterItem(1, AZ::TimeMs{ 1000 });
+
+        SetTime(AZ::TimeMs{ 11500 });
+        EXPECT_EQ(UpdateTimeouts(TimeoutResult::Refresh), 1);
+        EXPECT_NE(m_timeoutQueue->RetrieveItem(timeoutId), nullptr);
+
+        SetTime(AZ::TimeMs{ 12000 });
+        EXPECT_EQ(UpdateTimeouts(TimeoutResult::Refresh), 0);
+
+        SetTime(AZ::TimeMs{ 13000 });
+        EXPECT_EQ(UpdateTimeouts(TimeoutResult::Delete), 1);
+        EXPECT_EQ(m_timeoutQueue->RetrieveItem(timeoutId), nullptr);
+    }
+
+    TEST_P(TimeoutQueueTests, ExternallyRefreshedItemIsDeferred)
+    {
+        const TimeoutId timeoutId = m_timeoutQueue->RegisterItem(1, AZ::TimeMs{ 1000 });
+
+        SetTime(AZ::TimeMs{ 10500 });
+        m_timeoutQueue->RetrieveItem(timeoutId)->UpdateTimeoutTime(AZ::TimeMs{ 10500 });
+
+        SetTime(AZ::TimeMs{ 11200 });
+        EXPECT_EQ(UpdateTimeouts(TimeoutResult::Delete), 0);
+
+        SetTime(AZ::TimeMs{ 11800 });
+        EXPECT_EQ(UpdateTimeouts(TimeoutResult::Delete), 1);
+    }
+
+    TEST_P(TimeoutQueueTests, LongTimeoutExpires)
+    {
+        // Long enough to be stored outside the finest level of the timing wheel
+        m_timeoutQueue->RegisterItem(1, AZ::TimeMs{ 100000 });
+        m_timeoutQueue->RegisterItem(2, AZ::TimeMs{ 300 });
+
+        SetTime(AZ::TimeMs{ 10500 });
+        EXPECT_EQ(UpdateTimeouts(TimeoutResult::Delete), 1);
+
+        SetTime(AZ::TimeMs{ 109000 });
+        EXPECT_EQ(UpdateTimeouts(TimeoutResult::Delete), 0);
+
+        SetTime(AZ::TimeMs{ 111000 });
+        EXPECT_EQ(UpdateTimeouts(TimeoutResult::Delete), 1);
+    }
+
+    TEST_P(TimeoutQueueTests, MaxTimeoutsDefersRemainingItems)
+    {
+        static constexpr uint32_t ItemCount = 10;
+        for (uint32_t i = 0; i < ItemCount; ++i)
+        {
+            m_timeoutQueue->RegisterItem(i, AZ::TimeMs{ 1000 });
+        }
+
+        SetTime(AZ::TimeMs{ 11500 });
+        const uint32_t firstCount = UpdateTimeouts(TimeoutResult::Delete, 5);
+        EXPECT_GT(firstCount, 0);
+        EXPECT_LT(firstCount, ItemCount);
+        EXPECT_EQ(firstCount + UpdateTimeouts(TimeoutResult::Delete), ItemCount);
+    }
+
+    TEST_P(TimeoutQueueTests, HandlerCanRegisterItems)
+    {
+        m_timeoutQueue->RegisterItem(1, AZ::TimeMs{ 1000 });
+
+        SetTime(AZ::TimeMs{ 11500 });
+        m_timeoutQueue->UpdateTimeouts([this](TimeoutQueue::TimeoutItem&)
+        {
+            m_timeoutQueue->RegisterItem(2, AZ::TimeMs{ 1000 });
+            return TimeoutResult::Delete;
+        });
+
+        SetTime(AZ::TimeMs{ 13000 });
+        uint64_t expiredUserData = 0;
+        m_timeoutQueue->UpdateTimeouts([&expiredUserData](TimeoutQueue::TimeoutItem& item)
+        {
+            expiredUserData = item.m_userData;
+            return TimeoutResult::Delete;
+        });
+        EXPECT_EQ(expiredUserData, 2);
+    }
+
+    TEST_P(TimeoutQueueTests, ResetRemovesAllItems)
+    {
+        m_timeoutQueue->RegisterItem(1, AZ::TimeMs{ 1000 });
+        m_timeoutQueue->RegisterItem(2, AZ::TimeMs{ 100000 });
+        m_timeoutQueue->Reset();
+
+        SetTime(AZ::TimeMs{ 111000 });
+        EXPECT_EQ(UpdateTimeouts(TimeoutResult::Delete), 0);
+    }
+
+    INSTANTIATE_TEST_CASE_P(
+        TimeoutQueue,
+        TimeoutQueueTests,
+        ::testing::Values(TimeoutQueueMode::PriorityQueue, TimeoutQueueMode::TimingWheel));
 }
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpCongestionController.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    static constexpr AZ::TimeMs TestRoundTripTimeMs = AZ::TimeMs{ 100 };
+
+    // Sends at currentTimeMs until the pacing budget runs out, returning the number of bytes sent
+    static uint32_t SendUntilPaced(UdpAimdCongestionController& controller, AZ::TimeMs currentTimeMs)
+    {
+        uint32_t bytesSent = 0;
+        while (controller.HasSendBudget(currentTimeMs))
+        {
+            controller.OnPacketSent(1000, currentTimeMs);
+            bytesSent += 1000;
+        }
+        return bytesSent;
+    }
+
+    TEST(UdpCongestionControllerTests, PacingLimitsBurst)
+    {
+        UdpAimdCongestionController controller;
+        const uint32_t burstBytes = SendUntilPaced(controller, AZ::TimeMs{ 1000 });
+        EXPECT_GT(burstBytes, 0);
+        EXPECT_LT(burstBytes, controller.GetSendRateBytesPerSecond());
+        EXPECT_FALSE(controller.HasSendBudget(AZ::TimeMs{ 1000 }));
+
+        // Budget refills with time
+        EXPECT_TRUE(controller.HasSendBudget(AZ::TimeMs{ 1100 }));
+    }
+
+    TEST(UdpCongestionControllerTests, LossDecreasesRateOncePerRoundTrip)
+    {
+        UdpAimdCongestionController controller;
+        const uint32_t initialRate = controller.GetSendRateBytesPerSecond();
+
+        controller.OnPacketLost(AZ::TimeMs{ 1000 }, TestRoundTripTimeMs);
+        const uint32_t reducedRate = controller.GetSendRateBytesPerSecond();
+        EXPECT_LT(reducedRate, initialRate);
+
+        // Further losses within the same round trip belong to the same congestion event
+        controller.OnPacketLost(AZ::TimeMs{ 1050 }, TestRoundTripTimeMs);
+        EXPECT_EQ(controller.GetSendRateBytesPerSecond(), reducedRate);
+
+        controller.OnPacketLost(AZ::TimeMs{ 1200 }, TestRoundTripTimeMs);
+        EXPECT_LT(controller.GetSendRateBytesPerSecond(), reducedRate);
+    }
+
+    TEST(UdpCongestionControllerTests, AcksIncreaseRateWhenUtilized)
+    {
+        UdpAimdCongestionController controller;
+        const uint32_t initialRate = controller.GetSendRateBytesPerSecond();
+
+        // An idle connection doesn't grow its rate
+        controller.HasSendBudget(AZ::TimeMs{ 1000 });
+        controller.OnPacketAcked(AZ::TimeMs{ 1200 }, TestRoundTripTimeMs);
+        EXPECT_EQ(controller.GetSendRateBytesPerSecond(), initialRate);
+
+        // A connection using its full rate grows additively once per round trip
+        for (AZ::TimeMs timeMs = AZ::TimeMs{ 1200 }; timeMs < AZ::TimeMs{ 1400 }; timeMs += AZ::TimeMs{ 10 })
+        {
+            SendUntilPaced(controller, timeMs);
+        }
+        controller.OnPacketAcked(AZ::TimeMs{ 1400 }, TestRoundTripTimeMs);
+        const uint32_t increasedRate = controller.GetSendRateBytesPerSecond();
+        EXPECT_GT(increasedRate, initialRate);
+
+        controller.OnPacketAcked(AZ::TimeMs{ 1450 }, TestRoundTripTimeMs);
+        EXPECT_EQ(controller.GetSendRateBytesPerSecond(), increasedRate);
+    }
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Utilities/QuantizedQuaternion.h>
+#include <AzNetworking/Utilities/QuantizedValues.h>
+#include <AzNetworking/Serialization/DeltaSerializer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzNetworking/Serialization/QuantizedSerializer.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    // Quaternions q and -q describe the same rotation
+    static bool IsSameRotation(const AZ::Quaternion& lhs, const AZ::Quaternion& rhs, float tolerance)
+    {
+        return lhs.IsClose(rhs, tolerance) || lhs.IsClose(-rhs, tolerance);
+    }
+
+    template <AZStd::size_t NUM_BYTES>
+    void TestQuantizedQuaternionHelper(float tolerance)
+    {
+        const AZ::Quaternion rotations[] =
+        {
+            AZ::Quaternion::CreateIdentity(),
+            AZ::Quaternion::CreateRotationX(AZ::Constants::HalfPi),
+            AZ::Quaternion::CreateRotationY(-AZ::Constants::Pi * 0.75f),
+            AZ::Quaternion::CreateRotationZ(AZ::Constants::Pi),
+            AZ::Quaternion::CreateFromEulerAnglesRadians(AZ::Vector3(0.3f, -1.2f, 2.5f)),
+            AZ::Quaternion(-0.5f, 0.5f, -0.5f, -0.5f)
+        };
+
+        for (const AZ::Quaternion& rotation : rotations)
+        {
+            AzNetworking::QuantizedQuaternion<NUM_BYTES> testIn(rotation), testOut;
+
+            AZStd::array<uint8_t, 1024> buffer;
+            AzNetworking::NetworkInputSerializer  inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+            AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+
+            EXPECT_TRUE(IsSameRotation(static_cast<AZ::Quaternion>(testIn), rotation, tolerance));
+            EXPECT_NEAR(static_cast<AZ::Quaternion>(testIn).GetLength(), 1.0f, tolerance);
+            EXPECT_TRUE(testIn.Serialize(inputSerializer));
+            EXPECT_EQ(inputSerializer.GetSize(), NUM_BYTES);
+            EXPECT_TRUE(testOut.Serialize(outputSerializer));
+            EXPECT_EQ(testIn, testOut);
+            EXPECT_TRUE(static_cast<AZ::Quaternion>(testIn).IsClose(static_cast<AZ::Quaternion>(testOut)));
+
+            // Quantizing a decoded value must not change it, otherwise every update would look like a change
+            AzNetworking::QuantizedQuaternion<NUM_BYTES> requantized(static_cast<AZ::Quaternion>(testOut));
+            EXPECT_EQ(requantized.GetPackedValue(), testOut.GetPackedValue());
+        }
+    }
+
+    TEST(QuantizedQuaternion, Test2Bytes)
+    {
+        TestQuantizedQuaternionHelper<2>(0.15f);
+    }
+
+    TEST(QuantizedQuaternion, Test4Bytes)
+    {
+        TestQuantizedQuaternionHelper<4>(0.003f);
+    }
+
+    TEST(QuantizedQuaternion, Test8Bytes)
+    {
+        TestQuantizedQuaternionHelper<8>(0.00001f);
+    }
+
+    struct QuantizedTransformData
+    {
+        using QuantizedRotation = AzNetworking::QuantizedQuaternion<4>;
+        using QuantizedTranslation = AzNetworking::QuantizedValues<3, 2, -1024, 1024>;
+        using QuantizedScale = AzNetworking::QuantizedValues<1, 1, 0, 4>;
+
+        AZ::Quaternion m_rotation = AZ::Quaternion::CreateIdentity();
+        AZ::Vector3 m_translation = AZ::Vector3::CreateZero();
+        float m_scale = 1.0f;
+
+        bool Serialize(AzNetworking::ISerializer& serializer)
+        {
+            return AzNetworking::SerializeQuantized<QuantizedRotation>(serializer, m_rotation, "Rotation")
+                && AzNetworking::SerializeQuantized<QuantizedTranslation>(serializer, m_translation, "Translation")
+                && AzNetworking::SerializeQuantized<QuantizedScale>(serializer, m_scale, "Scale");
+        }
+    };
+
+    TEST(QuantizedQuaternion, SerializeQuantizedValues)
+    {
+        QuantizedTransformData dataIn, dataOut;
+        dataIn.m_rotation = AZ::Quaternion::CreateRotationZ(1.0f);
+        dataIn.m_translation = AZ::Vector3(10.0f, -250.5f, 3.25f);
+        dataIn.m_scale = 2.0f;
+
+        AZStd::array<uint8_t, 1024> buffer;
+        AzNetworking::NetworkInputSerializer  inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+
+        EXPECT_TRUE(dataIn.Serialize(inputSerializer));
+        EXPECT_EQ(inputSerializer.GetSize(), 4 + 3 * 2 + 1);
+        EXPECT_TRUE(dataOut.Serialize(outputSerializer));
+
+        EXPECT_TRUE(IsSameRotation(dataOut.m_rotation, dataIn.m_rotation, 0.003f));
+        EXPECT_TRUE(dataOut.m_translation.IsClose(dataIn.m_translation, 0.05f));
+        EXPECT_NEAR(dataOut.m_scale, dataIn.m_scale, 0.02f);
+    }
+
+    TEST(QuantizedQuaternion, SerializeQuantizedValuesDelta)
+    {
+        QuantizedTransformData previous, current;
+        current.m_rotation = AZ::Quaternion::CreateRotationX(-0.5f);
+
+        AzNetworking::SerializerDelta deltaSerializer;
+        AzNetworking::DeltaSerializerCreate createSerializer(deltaSerializer);
+        EXPECT_TRUE(createSerializer.CreateDelta(previous, current));
+
+        QuantizedTransformData applied = previous;
+        AzNetworking::DeltaSerializerApply applySerializer(deltaSerializer);
+        EXPECT_TRUE(applySerializer.ApplyDelta(applied));
+
+        EXPECT_TRUE(IsSameRotation(applied.m_rotation, current.m_rotation, 0.003f));
+        EXPECT_TRUE(applied.m_translation.IsClose(current.m_translation, 0.05f));
+        EXPECT_NEAR(applied.m_scale, current.m_scale, 0.02f);
+    }
+}
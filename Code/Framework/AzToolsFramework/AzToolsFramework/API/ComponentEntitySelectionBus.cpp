@@ -22,4 +22,13 @@ namespace AzToolsFramework
 
         return aabbResult.value;
     }
+
+    bool EditorEntitySelectionBoundsDependOnCamera(const AZ::EntityId entityId)
+    {
+        AZ::EBusLogicalResult<bool, AZStd::logical_or<bool>> dependOnCamera(false);
+        EditorComponentSelectionRequestsBus::EventResult(
+            dependOnCamera, entityId, &EditorComponentSelectionRequestsBus::Events::EditorSelectionBoundsDependOnCamera);
+
+        return dependOnCamera.value;
+    }
 }
@@ -73,6 +73,15 @@ namespace AzToolsFramework
             return SupportsEditorRayIntersect();
         }
 
+        //! @brief Returns true if the bounds returned by GetEditorSelectionBoundsViewport change with the camera
+        //! (e.g. the object stays at a constant size on screen).
+        //! @note The viewport selection caches the selection bounds of entities and only recalculates them when the
+        //! entity changes, the bounds of entities where this returns true are never cached.
+        virtual bool EditorSelectionBoundsDependOnCamera()
+        {
+            return false;
+        }
+
     protected:
         ~EditorComponentSelectionRequests() = default;
     };
@@ -104,6 +113,9 @@ namespace AzToolsFramework
     //! Returns the union of all editor selection bounds on a given Entity.
     //! @note The returned Aabb is in world space.
     AZ::Aabb CalculateEditorEntitySelectionBounds(const AZ::EntityId entityId, const AzFramework::ViewportInfo& viewportInfo);
+
+    //! Returns true if any of the editor selection bounds on a given Entity change with the camera.
+    bool EditorEntitySelectionBoundsDependOnCamera(const AZ::EntityId entityId);
 } // namespace AzToolsFramework
 
 DECLARE_EBUS_EXTERN(AzToolsFramework::EditorComponentSelectionRequests);
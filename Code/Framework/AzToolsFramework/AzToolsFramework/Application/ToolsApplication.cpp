@@ -9,6 +9,7 @@
 
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Asset/AssetSerializer.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/IO/FileIO.h>
@@ -106,6 +107,22 @@ AZ_POP_DISABLE_WARNING
 // For now we'll stick with the CRT new/delete in tools.
 //#include <AzCore/Memory/NewAndDelete.inl>
 
+AZ_CVAR(
+    AZ::u32,
+    ed_undoHistoryMaxSteps,
+    0,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "The maximum number of undo steps kept in the history, older steps are discarded (0 keeps every step).");
+
+AZ_CVAR(
+    AZ::u32,
+    ed_undoHistoryMaxMemoryMB,
+    512,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "The memory budget in MB for the undo history, the oldest undo steps are discarded once it is exceeded (0 for no budget).");
+
 namespace AzToolsFramework
 {
     namespace Internal
@@ -1647,6 +1664,8 @@ namespace AzToolsFramework
             // record each undo batch
             if (m_undoStack && changed)
             {
+                m_undoStack->SetHistoryLimits(
+                    ed_undoHistoryMaxSteps, static_cast<AZStd::size_t>(ed_undoHistoryMaxMemoryMB) * 1024 * 1024);
                 m_undoStack->Post(m_currentBatchUndo);
             }
             else
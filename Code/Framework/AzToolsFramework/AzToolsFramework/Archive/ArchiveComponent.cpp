@@ -25,6 +25,8 @@ namespace AzToolsFramework
     constexpr AZ::u32 s_compressionMethod = AZ::IO::INestedArchive::METHOD_DEFLATE;
     constexpr AZ::s32 s_compressionLevel = AZ::IO::INestedArchive::LEVEL_NORMAL;
     constexpr CompressionCodec::Codec s_compressionCodec = CompressionCodec::Codec::ZLIB;
+    // files from a list are read into batches of up to this many bytes, and each batch is compressed in parallel
+    constexpr size_t s_maxBatchBytes = 256 * 1024 * 1024;
 
     namespace ArchiveUtils
     {
@@ -481,21 +483,56 @@ namespace AzToolsFramework
             bool success = true; // starts true and turns false when any error is encountered.
             AZ::IO::Path basePath{ workingDirectory };
 
-            auto PerLineCallback = [&success, &basePath, &archive](AZStd::string_view filePathLine) -> void
+            struct BatchedFile
             {
-                AZStd::vector<char> fileBuffer;
-                AZ::IO::Path fullPath = (basePath / filePathLine);
-                if (ArchiveUtils::ReadFile(fullPath, AZ::IO::OpenMode::ModeRead, fileBuffer))
+                AZStd::string m_relativePath;
+                AZStd::vector<char> m_buffer;
+            };
+            AZStd::vector<BatchedFile> batch;
+            size_t batchBytes = 0;
+
+            auto FlushBatch = [&success, &batch, &batchBytes, &archive]() -> void
+            {
+                if (batch.empty())
                 {
-                    int result = archive->UpdateFile(
-                        filePathLine, fileBuffer.data(), fileBuffer.size(), s_compressionMethod,
-                        s_compressionLevel, s_compressionCodec);
+                    return;
+                }
+
+                AZStd::vector<AZ::IO::INestedArchive::FileToUpdate> filesToUpdate;
+                filesToUpdate.reserve(batch.size());
+                for (const BatchedFile& batchedFile : batch)
+                {
+                    filesToUpdate.push_back({ batchedFile.m_relativePath, batchedFile.m_buffer.data(), batchedFile.m_buffer.size() });
+                }
+
+                AZStd::vector<int> fileResults(batch.size(), AZ::IO::ZipDir::ZD_ERROR_SUCCESS);
+                archive->UpdateFiles(filesToUpdate, fileResults, s_compressionMethod, s_compressionLevel, s_compressionCodec);
 
-                    bool thisSuccess = (result == AZ::IO::ZipDir::ZD_ERROR_SUCCESS);
+                for (size_t fileIndex = 0; fileIndex < batch.size(); ++fileIndex)
+                {
+                    bool thisSuccess = (fileResults[fileIndex] == AZ::IO::ZipDir::ZD_ERROR_SUCCESS);
                     success = (success && thisSuccess);
                     AZ_Error(
-                        s_traceName, thisSuccess, "Error %d encountered while adding '%.*s' to archive '%.*s'", result,
-                        AZ_STRING_ARG(filePathLine), AZ_STRING_ARG(archive->GetFullPath().Native()));
+                        s_traceName, thisSuccess, "Error %d encountered while adding '%s' to archive '%.*s'", fileResults[fileIndex],
+                        batch[fileIndex].m_relativePath.c_str(), AZ_STRING_ARG(archive->GetFullPath().Native()));
+                }
+
+                batch.clear();
+                batchBytes = 0;
+            };
+
+            auto PerLineCallback = [&basePath, &archive, &batch, &batchBytes, &FlushBatch](AZStd::string_view filePathLine) -> void
+            {
+                AZStd::vector<char> fileBuffer;
+                AZ::IO::Path fullPath = (basePath / filePathLine);
+                if (ArchiveUtils::ReadFile(fullPath, AZ::IO::OpenMode::ModeRead, fileBuffer))
+                {
+                    batchBytes += fileBuffer.size();
+                    batch.push_back({ AZStd::string(filePathLine), AZStd::move(fileBuffer) });
+                    if (batchBytes >= s_maxBatchBytes)
+                    {
+                        FlushBatch();
+                    }
                 }
                 else
                 {
@@ -506,6 +543,7 @@ namespace AzToolsFramework
             };
 
             ArchiveUtils::ProcessFileList(listFilePath, PerLineCallback);
+            FlushBatch();
 
             archive.reset();
             p.set_value(success);
@@ -59,6 +59,8 @@ namespace AzToolsFramework
         int m_bundleVersion = AzFramework::AssetBundleManifest::CurrentBundleVersion;
         AZ::u64 m_maxBundleSizeInMB = MaxBundleSizeInMB;
         AZStd::string m_comment;
+        //! Optional Streamer trace of a play session. When set, files are stored in the bundles in the order they were first read in the trace.
+        AZStd::string m_accessOrderFilePath;
     };
 
    /*
@@ -10,10 +10,14 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Debug/Trace.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/conversions.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzFramework/Asset/AssetBundleManifest.h>
 #include <AzFramework/StringFunc/StringFunc.h>
@@ -297,7 +301,23 @@ namespace AzToolsFramework
         AzFramework::ApplicationRequests::Bus::BroadcastResult(
             usePrefabSystemForLevels, &AzFramework::ApplicationRequests::IsPrefabSystemEnabled);
 
-        for (const AzToolsFramework::AssetFileInfo& assetFileInfo : assetFileInfoList.m_fileInfoList)
+        // Lay the files out in the order they are loaded, so loading reads the bundles front to back instead of seeking around in them.
+        AZStd::vector<AssetFileInfo> orderedFileInfos;
+        if (!assetBundleSettings.m_accessOrderFilePath.empty())
+        {
+            AZ::IO::Path accessOrderFilePath = AZ::IO::Path(AZStd::string_view{ AZ::Utils::GetEnginePath() }) / assetBundleSettings.m_accessOrderFilePath;
+            AZ::IO::StreamerTrace trace;
+            if (!trace.Load(accessOrderFilePath.c_str()))
+            {
+                AZ_Error(logWindowName, false, "Failed to load the access order trace (%s).\n", accessOrderFilePath.c_str());
+                return false;
+            }
+            orderedFileInfos = assetFileInfoList.m_fileInfoList;
+            SortByAccessOrder(orderedFileInfos, trace);
+        }
+        const AZStd::vector<AssetFileInfo>& fileInfos = assetBundleSettings.m_accessOrderFilePath.empty() ? assetFileInfoList.m_fileInfoList : orderedFileInfos;
+
+        for (const AzToolsFramework::AssetFileInfo& assetFileInfo : fileInfos)
         {
             AZ::u64 fileSize = 0;
             AZStd::string fullAssetFilePath;
@@ -680,6 +700,73 @@ namespace AzToolsFramework
         return filesAddedToArchive;
     }
 
+    void AssetBundleComponent::SortByAccessOrder(AZStd::vector<AssetFileInfo>& fileInfos, const AZ::IO::StreamerTrace& trace)
+    {
+        // Relative paths are compared without regard to case or separator style, as the trace uses the paths of the running platform.
+        auto NormalizePath = [](AZStd::string path)
+        {
+            AZStd::replace(path.begin(), path.end(), '\\', '/');
+            AZStd::to_lower(path.begin(), path.end());
+            return path;
+        };
+
+        AZStd::unordered_map<AZStd::string, size_t> fileIndices;
+        for (size_t fileIndex = 0; fileIndex < fileInfos.size(); ++fileIndex)
+        {
+            fileIndices.emplace(NormalizePath(fileInfos[fileIndex].m_assetRelativePath), fileIndex);
+        }
+
+        // Find the file for every path that's read, in the order of the first read of the path. A trace path matches the file whose
+        // relative path is the longest suffix of it that starts after a separator.
+        AZStd::vector<size_t> accessRanks(fileInfos.size(), AZStd::numeric_limits<size_t>::max());
+        AZStd::vector<bool> pathSeen(trace.m_paths.size(), false);
+        size_t nextRank = 0;
+        for (const AZ::IO::StreamerTrace::Read& read : trace.m_reads)
+        {
+            if (pathSeen[read.m_pathIndex])
+            {
+                continue;
+            }
+            pathSeen[read.m_pathIndex] = true;
+
+            const AZStd::string tracePath = NormalizePath(trace.m_paths[read.m_pathIndex]);
+            for (size_t separator = tracePath.find('/'); separator != AZStd::string::npos; separator = tracePath.find('/', separator + 1))
+            {
+                auto fileIt = fileIndices.find(tracePath.substr(separator + 1));
+                if (fileIt != fileIndices.end())
+                {
+                    size_t& rank = accessRanks[fileIt->second];
+                    rank = AZStd::min(rank, nextRank++);
+                    break;
+                }
+            }
+        }
+
+        if (nextRank == 0)
+        {
+            AZ_Warning(logWindowName, false, "None of the files in the bundle were read in the access order trace, the order of the files is unchanged.\n");
+            return;
+        }
+
+        AZStd::vector<size_t> order(fileInfos.size());
+        for (size_t fileIndex = 0; fileIndex < order.size(); ++fileIndex)
+        {
+            order[fileIndex] = fileIndex;
+        }
+        AZStd::stable_sort(order.begin(), order.end(), [&accessRanks](size_t lhs, size_t rhs)
+            {
+                return accessRanks[lhs] < accessRanks[rhs];
+            });
+
+        AZStd::vector<AssetFileInfo> sortedFileInfos;
+        sortedFileInfos.reserve(fileInfos.size());
+        for (size_t fileIndex : order)
+        {
+            sortedFileInfos.emplace_back(AZStd::move(fileInfos[fileIndex]));
+        }
+        fileInfos = AZStd::move(sortedFileInfos);
+    }
+
     bool AssetBundleComponent::HasManifest(const AZStd::vector<AZStd::string>& fileEntries)
     {
         auto itr = AZStd::find(fileEntries.begin(), fileEntries.end(), AZStd::string(AzFramework::AssetBundleManifest::s_manifestFileName));
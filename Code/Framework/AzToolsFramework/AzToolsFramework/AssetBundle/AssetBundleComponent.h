@@ -13,6 +13,11 @@
 namespace AZ
 {
     class ReflectContext;
+
+    namespace IO
+    {
+        struct StreamerTrace;
+    }
 }
 
 namespace AzFramework
@@ -66,6 +71,11 @@ namespace AzToolsFramework
         //! Returns whether all known non-asset entries were removed from the list
         static bool RemoveNonAssetFileEntries(AZStd::vector<AZStd::string>& fileEntries, const AZStd::string& normalizedSourcePakPath, const AzFramework::AssetBundleManifest* manifest);
 
+        //! Sorts the files by the order they were first read in the Streamer trace, so they can be laid out in a bundle in the order they're loaded.
+        //! Trace paths are absolute, a file matches a trace path that ends with its relative path. Files that weren't read in the trace
+        //! keep their relative order and are placed after the ones that were.
+        static void SortByAccessOrder(AZStd::vector<AssetFileInfo>& fileInfos, const AZ::IO::StreamerTrace& trace);
+
     private:
         static void Reflect(AZ::ReflectContext* context);
 
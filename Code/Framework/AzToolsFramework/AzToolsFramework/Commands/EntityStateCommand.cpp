@@ -52,6 +52,18 @@ namespace AzToolsFramework
     {
     }
 
+    void EntityStateCommand::ReleaseUnusedMemory()
+    {
+        // the streams the states are serialized with grow their buffers geometrically
+        m_undoState.shrink_to_fit();
+        m_redoState.shrink_to_fit();
+    }
+
+    AZStd::size_t EntityStateCommand::GetMemoryUsage() const
+    {
+        return UndoSystem::URSequencePoint::GetMemoryUsage() + m_undoState.capacity() + m_redoState.capacity();
+    }
+
     void EntityStateCommand::Capture(AZ::Entity* pSourceEntity, bool captureUndo)
     {
         AZ_PROFILE_FUNCTION(AzToolsFramework);
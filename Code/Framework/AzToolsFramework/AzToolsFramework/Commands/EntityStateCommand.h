@@ -62,6 +62,8 @@ namespace AzToolsFramework
         AZ::EntityId GetEntityID() const { return m_entityID; }
 
         bool Changed() const override { return m_undoState != m_redoState; }
+        void ReleaseUnusedMemory() override;
+        AZStd::size_t GetMemoryUsage() const override;
 
     protected:
 
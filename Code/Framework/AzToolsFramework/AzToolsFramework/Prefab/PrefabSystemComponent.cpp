@@ -9,15 +9,19 @@
 #include <AzToolsFramework/Prefab/PrefabSystemComponent.h>
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzToolsFramework/API/EditorAssetSystemAPI.h>
 #include <AzToolsFramework/Entity/EditorEntityContextBus.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceEntityIdMapper.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceSerializer.h>
 #include <AzToolsFramework/Prefab/PrefabDomUtils.h>
+#include <AzToolsFramework/Prefab/Spawnable/AssetPlatformComponentRemover.h>
 #include <AzToolsFramework/Prefab/Spawnable/EditorInfoRemover.h>
 #include <AzToolsFramework/Prefab/Spawnable/PrefabCatchmentProcessor.h>
 #include <AzToolsFramework/Prefab/Spawnable/PrefabConversionPipeline.h>
@@ -25,6 +29,15 @@
 
 AZ_DEFINE_BUDGET(PrefabSystem);
 
+AZ_CVAR(
+    uint32_t,
+    ed_prefabParallelPropagationMinLinks,
+    32,
+    nullptr,
+    AZ::ConsoleFunctorFlags::DontReplicate | AZ::ConsoleFunctorFlags::DontDuplicate,
+    "Minimum number of links a prefab template change has to be propagated to at once before the templates they target are updated "
+    "in parallel tasks. Set to 0 to always update them on the calling thread.");
+
 namespace AzToolsFramework
 {
     namespace Prefab
@@ -69,6 +82,7 @@ namespace AzToolsFramework
             AzToolsFramework::Prefab::PrefabConversionUtils::PrefabConversionPipeline::Reflect(context);
             AzToolsFramework::Prefab::PrefabConversionUtils::PrefabCatchmentProcessor::Reflect(context);
             AzToolsFramework::Prefab::PrefabConversionUtils::EditorInfoRemover::Reflect(context);
+            AzToolsFramework::Prefab::PrefabConversionUtils::AssetPlatformComponentRemover::Reflect(context);
             PrefabPublicRequestHandler::Reflect(context);
             PrefabPublicNotificationHandler::Reflect(context);
             PrefabFocusHandler::Reflect(context);
@@ -313,9 +327,12 @@ namespace AzToolsFramework
 
                 // Update all the linked instances corresponding to the LinkIds before fetching the next set of linkIds.
                 // This will ensure that templates are updated with changes in the same order they are received.
+                UpdateLinkTargets(LinkIdsToUpdate, targetTemplateIdToLinkIdMap);
                 for (const LinkId& linkIdToUpdate : LinkIdsToUpdate)
                 {
-                    UpdateLinkedInstance(linkIdToUpdate, targetTemplateIdToLinkIdMap, linkIdsQueue);
+                    TemplateId targetTemplateId = m_linkIdMap[linkIdToUpdate].GetTargetTemplateId();
+                    targetTemplateIdToLinkIdMap[targetTemplateId].first.erase(linkIdToUpdate);
+                    UpdateTemplateChangePropagationQueue(targetTemplateIdToLinkIdMap, targetTemplateId, linkIdsQueue);
                 }
 
                 linkIdsQueue.pop();
@@ -350,44 +367,96 @@ namespace AzToolsFramework
             }
         }
 
-      
-        void PrefabSystemComponent::UpdateLinkedInstance(const LinkId linkIdToUpdate,
-            TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap, AZStd::queue<LinkIds>& linkIdsQueue)
+        void PrefabSystemComponent::UpdateLinkTargets(const LinkIds& linkIdsToUpdate, TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap)
         {
-            Link& linkToUpdate = m_linkIdMap[linkIdToUpdate];
-            TemplateId targetTemplateId = linkToUpdate.GetTargetTemplateId();
-            PrefabDomValue& linkedInstanceDom = linkToUpdate.GetLinkedInstanceDom();
+            AZ_PROFILE_FUNCTION(PrefabSystem);
+
+            // The links that target the same template write into the DOM of that template and use its allocator, so they are
+            // updated in order by the same task. The links only read their source template, which is shared by all of them and
+            // doesn't change while they're updated, so links that target different templates can be updated in parallel.
+            struct TargetTemplateUpdate
+            {
+                AZStd::vector<Link*> m_links;
+                TemplateId m_targetTemplateId;
+                bool m_isTemplateUpdated;
+            };
+            AZStd::vector<TargetTemplateUpdate> targetTemplateUpdates;
+            AZStd::unordered_map<TemplateId, size_t> targetTemplateUpdateIndices;
+            for (const LinkId& linkIdToUpdate : linkIdsToUpdate)
+            {
+                Link& linkToUpdate = m_linkIdMap[linkIdToUpdate];
+                TemplateId targetTemplateId = linkToUpdate.GetTargetTemplateId();
+                auto [indexIt, inserted] = targetTemplateUpdateIndices.emplace(targetTemplateId, targetTemplateUpdates.size());
+                if (inserted)
+                {
+                    targetTemplateUpdates.push_back({ {}, targetTemplateId, targetTemplateIdToLinkIdMap[targetTemplateId].second });
+                }
+                targetTemplateUpdates[indexIt->second].m_links.push_back(&linkToUpdate);
+            }
+
+            auto updateTargetTemplate = [](TargetTemplateUpdate& targetTemplateUpdate)
+            {
+                for (Link* linkToUpdate : targetTemplateUpdate.m_links)
+                {
+                    // It is expensive to compare a DOM, so once one of the linked instances of the target template differs from
+                    // before, the template is known to be updated and the remaining linked instances don't need to be compared.
+                    if (targetTemplateUpdate.m_isTemplateUpdated)
+                    {
+                        linkToUpdate->UpdateTarget();
+                        continue;
+                    }
+
+                    PrefabDomValue& linkedInstanceDom = linkToUpdate->GetLinkedInstanceDom();
 
-            // create an empty Dom to hold the temp allocations so they are cleared when we leave this scope:
-            PrefabDom linkedDomBeforeUpdate; 
-            linkedDomBeforeUpdate.CopyFrom(linkedInstanceDom, linkedDomBeforeUpdate.GetAllocator());
+                    // create an empty Dom to hold the temp allocations so they are cleared when we leave this scope:
+                    PrefabDom linkedDomBeforeUpdate;
+                    linkedDomBeforeUpdate.CopyFrom(linkedInstanceDom, linkedDomBeforeUpdate.GetAllocator());
 
-            // the following call modifies the linkedInstanceDom to have the updated changes.
-            // Most of the time, this modifies the actual linkedInstanceDom to have patches.
-            // The only circumstance this doesn't happen is if the linkedInstanceDom happens to already have the values
-            // that the override would have applied, in which case the patches don't do anything to it when applied to it
-            // and 'linkedDomBeforeUpdate == linkedDomAfterUpdate'.
-            linkToUpdate.UpdateTarget();
+                    // the following call modifies the linkedInstanceDom to have the updated changes.
+                    // If the linkedInstanceDom already has the values that the overrides would have applied, it doesn't change and
+                    // the propagation ends at this point in the hierarchy, since there are no downstream effects.
+                    linkToUpdate->UpdateTarget();
 
-            // the below chunk of code's job is to determine whether the template actually changed or not from UpdateTarget
-            // if it didn't change, we don't need to recurse into its children and propogate the changes - the propogation
-            // will end at this point in the heirarchy since it will not have any downstream effects.
+                    targetTemplateUpdate.m_isTemplateUpdated =
+                        AZ::JsonSerialization::Compare(linkedDomBeforeUpdate, linkedInstanceDom) != AZ::JsonSerializerCompareResult::Equal;
+                }
+            };
 
-            // It is expensive to compare a DOM, so once we've compared one, we cache the fact that we compared it and it differed
-            // from before in targetTemplateIdToLinkIdMap[targetTemplateId].second.  This also means that if
-            // targetTemplateIdToLinkIdMap[targetTemplateId].second is true, there is no need to compare it again, as it will have
-            // already added its links to the queue.
-            
-            bool isTemplateUpdated = targetTemplateIdToLinkIdMap[targetTemplateId].second;
-            if (!isTemplateUpdated || AZ::JsonSerialization::Compare(linkedDomBeforeUpdate, linkedInstanceDom) != AZ::JsonSerializerCompareResult::Equal)
+            const uint32_t minParallelLinks = ed_prefabParallelPropagationMinLinks;
+            AZ::TaskGraphActiveInterface* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+            if (targetTemplateUpdates.size() < 2 || minParallelLinks == 0 || linkIdsToUpdate.size() < minParallelLinks ||
+                !taskGraphActive || !taskGraphActive->IsTaskGraphActive())
             {
-                targetTemplateIdToLinkIdMap[targetTemplateId].second = true;
+                for (TargetTemplateUpdate& targetTemplateUpdate : targetTemplateUpdates)
+                {
+                    updateTargetTemplate(targetTemplateUpdate);
+                }
+            }
+            else
+            {
+                static const AZ::TaskDescriptor updateTaskDescriptor{ "PrefabSystemComponent::UpdateLinkTargets", "Prefab" };
+                AZ::TaskGraph taskGraph{ "PrefabSystemComponent::UpdateLinkTargets" };
+                for (TargetTemplateUpdate& targetTemplateUpdate : targetTemplateUpdates)
+                {
+                    taskGraph.AddTask(
+                        updateTaskDescriptor,
+                        [&updateTargetTemplate, &targetTemplateUpdate]()
+                        {
+                            updateTargetTemplate(targetTemplateUpdate);
+                        });
+                }
+
+                AZ::TaskGraphEvent finishedEvent{ "PrefabSystemComponent::UpdateLinkTargets Wait" };
+                taskGraph.Submit(&finishedEvent);
+                finishedEvent.Wait();
             }
 
-            if (targetTemplateIdToLinkIdMap.find(targetTemplateId) != targetTemplateIdToLinkIdMap.end())
+            for (const TargetTemplateUpdate& targetTemplateUpdate : targetTemplateUpdates)
             {
-                targetTemplateIdToLinkIdMap[targetTemplateId].first.erase(linkIdToUpdate);
-                UpdateTemplateChangePropagationQueue(targetTemplateIdToLinkIdMap, targetTemplateId, linkIdsQueue);
+                if (targetTemplateUpdate.m_isTemplateUpdated)
+                {
+                    targetTemplateIdToLinkIdMap[targetTemplateUpdate.m_targetTemplateId].second = true;
+                }
             }
         }
 
@@ -302,16 +302,14 @@ namespace AzToolsFramework
                 TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap);
 
             /**
-             * Updates a single linked instance corresponding to the given link Id and adds more linkIds to the
-             * template change propagation queue(linkIdsQueue) when necessary.
+             * Updates the linked instances corresponding to the given link ids in their target templates. The links of each target
+             * template are updated in order, and different target templates are updated in parallel tasks when there are enough links.
              *
-             * @param linkIdToUpdate The id of the linked instance to update
+             * @param linkIdsToUpdate The ids of the linked instances to update. They all share the same source template.
              * @param targetTemplateIdToLinkIdMap The map of target templateIds to a pair of lists of linkIds and a bool flag indicating
              *                                    whether any of the instances of the target template were updated.
-             * @param linkIdsQueue A queue of vector of link-Ids to update.
              */
-            void UpdateLinkedInstance(const LinkId linkIdToUpdate, TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap,
-                AZStd::queue<LinkIds>& linkIdsQueue);
+            void UpdateLinkTargets(const LinkIds& linkIdsToUpdate, TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap);
 
             /**
              * If all linked instances of a target template are updated and if the content of any of the linked instances changed,
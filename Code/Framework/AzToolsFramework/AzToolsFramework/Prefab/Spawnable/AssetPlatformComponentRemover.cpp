@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzToolsFramework/Prefab/Spawnable/AssetPlatformComponentRemover.h>
+
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzToolsFramework/Prefab/Instance/Instance.h>
+#include <AzToolsFramework/Prefab/Spawnable/PrefabDocument.h>
+
+namespace AzToolsFramework::Prefab::PrefabConversionUtils
+{
+    void AssetPlatformComponentRemover::Process(PrefabProcessorContext& prefabProcessorContext)
+    {
+        const AZ::PlatformTagSet& platformTags = prefabProcessorContext.GetPlatformTags();
+
+        ComponentTypeSet excludedComponentTypes;
+        for (const auto& [platformTag, excludedComponents] : m_platformExcludedComponents)
+        {
+            if (platformTags.find(AZ::Crc32(platformTag)) == platformTags.end())
+            {
+                continue;
+            }
+
+            for (const auto& excludedComponent : excludedComponents)
+            {
+                excludedComponentTypes.insert(excludedComponent.second);
+            }
+        }
+
+        if (excludedComponentTypes.empty())
+        {
+            return;
+        }
+
+        prefabProcessorContext.ListPrefabs(
+            [&excludedComponentTypes](PrefabDocument& prefab)
+            {
+                size_t removedCount = 0;
+                prefab.GetInstance().GetAllEntitiesInHierarchy(
+                    [&excludedComponentTypes, &removedCount](AZStd::unique_ptr<AZ::Entity>& entity)
+                    {
+                        removedCount += RemoveExcludedComponents(*entity, excludedComponentTypes);
+                        return true;
+                    });
+
+                if (removedCount > 0)
+                {
+                    AZ_TracePrintf("Prefab", "Removed %zu components excluded from the asset platform from prefab '%s'.\n",
+                        removedCount, prefab.GetName().c_str());
+                }
+            });
+    }
+
+    size_t AssetPlatformComponentRemover::RemoveExcludedComponents(AZ::Entity& entity, const ComponentTypeSet& excludedComponentTypes)
+    {
+        AZ::Entity::ComponentArrayType componentsToRemove;
+        AZ::Entity::ComponentArrayType componentsToKeep;
+        for (AZ::Component* component : entity.GetComponents())
+        {
+            const bool isExcluded = excludedComponentTypes.find(component->RTTI_GetType()) != excludedComponentTypes.end();
+            (isExcluded ? componentsToRemove : componentsToKeep).push_back(component);
+        }
+
+        if (componentsToRemove.empty())
+        {
+            return 0;
+        }
+
+        const auto findDescriptor = [](const AZ::Component* component)
+        {
+            AZ::ComponentDescriptor* descriptor = nullptr;
+            AZ::ComponentApplicationBus::BroadcastResult(
+                descriptor, &AZ::ComponentApplicationBus::Events::FindComponentDescriptor, component->RTTI_GetType());
+            return descriptor;
+        };
+
+        // Keep the excluded components that provide a service required by a component that stays. Keeping one may require
+        // keeping others for the services it requires itself, so repeat until no more components are kept.
+        AZ::ComponentDescriptor::DependencyArrayType requiredServices;
+        for (size_t keptIndex = 0; keptIndex < componentsToKeep.size(); ++keptIndex)
+        {
+            if (const AZ::ComponentDescriptor* descriptor = findDescriptor(componentsToKeep[keptIndex]))
+            {
+                descriptor->GetRequiredServices(requiredServices, componentsToKeep[keptIndex]);
+            }
+
+            for (auto removeIt = componentsToRemove.begin(); removeIt != componentsToRemove.end();)
+            {
+                AZ::ComponentDescriptor::DependencyArrayType providedServices;
+                if (const AZ::ComponentDescriptor* descriptor = findDescriptor(*removeIt))
+                {
+                    descriptor->GetProvidedServices(providedServices, *removeIt);
+                }
+
+                const bool isRequired = AZStd::any_of(providedServices.begin(), providedServices.end(),
+                    [&requiredServices](AZ::ComponentServiceType service)
+                    {
+                        return AZStd::find(requiredServices.begin(), requiredServices.end(), service) != requiredServices.end();
+                    });
+                if (!isRequired)
+                {
+                    ++removeIt;
+                    continue;
+                }
+
+                AZ_Warning("Prefab", false,
+                    "Entity '%s' %s - component '%s' is excluded from the asset platform but kept, another component requires it.",
+                    entity.GetName().c_str(), entity.GetId().ToString().c_str(), (*removeIt)->RTTI_GetTypeName());
+                componentsToKeep.push_back(*removeIt);
+                removeIt = componentsToRemove.erase(removeIt);
+            }
+        }
+
+        for (AZ::Component* component : componentsToRemove)
+        {
+            if (entity.RemoveComponent(component))
+            {
+                delete component;
+            }
+        }
+
+        return componentsToRemove.size();
+    }
+
+    void AssetPlatformComponentRemover::SetPlatformExcludedComponents(AZStd::string_view platformTag, ExcludedComponents excludedComponents)
+    {
+        m_platformExcludedComponents[AZStd::string(platformTag)] = AZStd::move(excludedComponents);
+    }
+
+    void AssetPlatformComponentRemover::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<AssetPlatformComponentRemover, PrefabProcessor>()
+                ->Version(1)
+                ->Field("PlatformExcludedComponents", &AssetPlatformComponentRemover::m_platformExcludedComponents);
+        }
+    }
+} // namespace AzToolsFramework::Prefab::PrefabConversionUtils
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/string/string.h>
+#include <AzToolsFramework/Prefab/Spawnable/PrefabProcessor.h>
+
+namespace AZ
+{
+    class Entity;
+    class ReflectContext;
+}
+
+namespace AzToolsFramework::Prefab::PrefabConversionUtils
+{
+    //! Removes components from the game entities of spawnables built for asset platforms that don't use them, for example
+    //! the render components from the spawnables of dedicated servers, so the servers never load their meshes, materials and
+    //! textures. The components to remove are listed per platform tag in the processing stack settings, gems add their own
+    //! components under a name of their choosing:
+    //!     "PlatformExcludedComponents": { "server": { "Mesh": "{C7801FA8-3E82-4D40-B039-4854F1892FDE}" } }
+    //! A listed component is kept if a component that stays on the entity requires one of the services it provides,
+    //! as the entity couldn't be activated without it.
+    class AssetPlatformComponentRemover
+        : public PrefabProcessor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(AssetPlatformComponentRemover, AZ::SystemAllocator);
+        AZ_RTTI(AzToolsFramework::Prefab::PrefabConversionUtils::AssetPlatformComponentRemover,
+            "{C070DC85-B749-4772-A364-79F52B54E61C}", PrefabProcessor);
+
+        using ComponentTypeSet = AZStd::unordered_set<AZ::TypeId>;
+        //! The components to remove by name, the names only serve to let several settings files add to the same platform tag.
+        using ExcludedComponents = AZStd::unordered_map<AZStd::string, AZ::TypeId>;
+
+        ~AssetPlatformComponentRemover() override = default;
+
+        void Process(PrefabProcessorContext& prefabProcessorContext) override;
+
+        //! Removes the components of the given types from the entity, except the ones that provide a service required by
+        //! a component that stays on it.
+        //! @return The number of components that were removed.
+        static size_t RemoveExcludedComponents(AZ::Entity& entity, const ComponentTypeSet& excludedComponentTypes);
+
+        void SetPlatformExcludedComponents(AZStd::string_view platformTag, ExcludedComponents excludedComponents);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+    protected:
+        //! The components to remove, keyed by the platform tag they're removed for.
+        AZStd::unordered_map<AZStd::string, ExcludedComponents> m_platformExcludedComponents;
+    };
+} // namespace AzToolsFramework::Prefab::PrefabConversionUtils
@@ -7,8 +7,10 @@
  */
 
 #include <AzCore/Component/ComponentExport.h>
+#include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
 #include <AzCore/std/ranges/ranges_algorithm.h>
 #include <AzCore/std/ranges/transform_view.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
@@ -58,10 +60,26 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
     {
         if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
         {
-            serializeContext->Class<EditorInfoRemover, PrefabProcessor>()->Version(1);
+            serializeContext->Class<EditorInfoRemover, PrefabProcessor>()
+                ->Version(2)
+                ->Field("CacheExportedEntities", &EditorInfoRemover::m_cacheExportedEntities);
         }
     }
 
+    void EditorInfoRemover::SetCacheExportedEntities(bool cacheExportedEntities)
+    {
+        m_cacheExportedEntities = cacheExportedEntities;
+        if (!m_cacheExportedEntities)
+        {
+            m_exportEntityCache.clear();
+        }
+    }
+
+    bool EditorInfoRemover::IsCachingExportedEntities() const
+    {
+        return m_cacheExportedEntities;
+    }
+
     void EditorInfoRemover::GetEntitiesFromInstance(AzToolsFramework::Prefab::Instance& instance, EntityList& hierarchyEntities)
     {
         instance.GetAllEntitiesInHierarchy(
@@ -194,6 +212,65 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         return AZ::Success(AZStd::move(exportEntity));
     }
 
+    EditorInfoRemover::ExportEntityResult EditorInfoRemover::ExportEntityCached(
+        AZ::Entity* sourceEntity, size_t platformFingerprint, PrefabProcessorContext& context, ExportEntityCache& usedCache)
+    {
+        const size_t fingerprint = CalculateEntityFingerprint(*sourceEntity, platformFingerprint);
+        if (fingerprint == 0)
+        {
+            return ExportEntity(sourceEntity, context);
+        }
+
+        auto cached = m_exportEntityCache.find(sourceEntity->GetId());
+        if (cached != m_exportEntityCache.end() && cached->second.m_fingerprint == fingerprint)
+        {
+            // The editor-only state still has to be queried from the source entity, which requires it to be initialized.
+            if (sourceEntity->GetState() == AZ::Entity::State::Constructed)
+            {
+                sourceEntity->Init();
+            }
+            AddEntityIdIfEditorOnly(sourceEntity);
+
+            AZStd::unique_ptr<AZ::Entity> exportEntity(m_serializeContext->CloneObject(cached->second.m_exportEntity.get()));
+            usedCache.emplace(sourceEntity->GetId(), AZStd::move(cached->second));
+            m_exportEntityCache.erase(cached);
+            if (exportEntity)
+            {
+                return AZ::Success(AZStd::move(exportEntity));
+            }
+            return AZ::Failure(AZStd::string::format(
+                "Entity '%s' %s - cloning the cached export failed.", sourceEntity->GetName().c_str(),
+                sourceEntity->GetId().ToString().c_str()));
+        }
+
+        auto result = ExportEntity(sourceEntity, context);
+        if (result)
+        {
+            CachedExportEntity entry;
+            entry.m_fingerprint = fingerprint;
+            entry.m_exportEntity.reset(m_serializeContext->CloneObject(result.GetValue().get()));
+            if (entry.m_exportEntity)
+            {
+                usedCache.emplace(sourceEntity->GetId(), AZStd::move(entry));
+            }
+        }
+        return result;
+    }
+
+    size_t EditorInfoRemover::CalculateEntityFingerprint(const AZ::Entity& sourceEntity, size_t platformFingerprint) const
+    {
+        AZStd::vector<uint8_t> buffer;
+        AZ::IO::ByteContainerStream stream(&buffer);
+        if (!AZ::Utils::SaveObjectToStream(stream, AZ::DataStream::ST_BINARY, &sourceEntity, m_serializeContext))
+        {
+            return 0;
+        }
+
+        size_t fingerprint = platformFingerprint;
+        AZStd::hash_range(fingerprint, buffer.begin(), buffer.end());
+        return fingerprint != 0 ? fingerprint : 1;
+    }
+
     bool EditorInfoRemover::ReadComponentAttribute(
         AZ::Component* component,
         AZ::Edit::Attribute* attribute,
@@ -528,10 +605,24 @@ exportComponent, prefabProcessorContext);
         // find valid editor-only entity handler for removing editor-only entities later.
         SetEditorOnlyEntityHandlerFromCandidates(sourceEntities);
 
+        // Only the entities of this prefab are kept in the cache, so it doesn't grow with every prefab that's converted.
+        ExportEntityCache usedExportEntityCache;
+        size_t platformFingerprint = 0;
+        if (m_cacheExportedEntities)
+        {
+            // The tags are combined in an order independent way as they're stored in an unordered set.
+            for (AZ::Crc32 tag : prefabProcessorContext.GetPlatformTags())
+            {
+                platformFingerprint += AZStd::hash<AZ::Crc32>{}(tag);
+            }
+        }
+
         // export entities.
         for (AZ::Entity* entity : sourceEntities)
         {
-            auto result = ExportEntity(entity, prefabProcessorContext);
+            auto result = m_cacheExportedEntities
+                ? ExportEntityCached(entity, platformFingerprint, prefabProcessorContext, usedExportEntityCache)
+                : ExportEntity(entity, prefabProcessorContext);
             if (!result)
             {
                 return AZ::Failure(AZStd::string::format(
@@ -544,6 +635,10 @@ exportComponent, prefabProcessorContext);
 
             exportEntitiesOwner.emplace_back(result.TakeValue());
         }
+        if (m_cacheExportedEntities)
+        {
+            m_exportEntityCache = AZStd::move(usedExportEntityCache);
+        }
 
         const auto nonOwningEntityView = exportEntitiesOwner | AZStd::views::transform([](const auto& entity) { return entity.get(); });
         EntityList exportEntities(exportEntitiesOwner.size());
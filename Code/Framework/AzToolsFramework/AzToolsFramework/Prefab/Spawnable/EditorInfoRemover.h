@@ -10,6 +10,8 @@
 
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzToolsFramework/Entity/EntityTypes.h>
 #include <AzToolsFramework/Prefab/Instance/Instance.h>
 #include <AzToolsFramework/Prefab/Spawnable/ComponentRequirementsValidator.h>
@@ -48,6 +50,13 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
             AZ::SerializeContext* serializeContext,
             PrefabProcessorContext& prefabProcessorContext);
 
+        //! Enables keeping a copy of every exported entity, so converting the same entity again while its editor data and the
+        //! platform tags didn't change clones the copy instead of exporting each of its components again. Only the entities
+        //! of the prefab that was converted last are kept. Components that export data from outside their own entity, such as
+        //! the content of assets, need the cache to stay disabled for their exports to stay up to date.
+        void SetCacheExportedEntities(bool cacheExportedEntities);
+        bool IsCachingExportedEntities() const;
+
         static void Reflect(AZ::ReflectContext* context);
 
      protected:
@@ -72,6 +81,20 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
         using ExportEntityResult = AZ::Outcome<AZStd::unique_ptr<AZ::Entity>, AZStd::string>;
         ExportEntityResult ExportEntity(AZ::Entity* sourceEntity, PrefabProcessorContext& context);
 
+        struct CachedExportEntity
+        {
+            size_t m_fingerprint{ 0 };
+            AZStd::unique_ptr<AZ::Entity> m_exportEntity;
+        };
+        using ExportEntityCache = AZStd::unordered_map<AZ::EntityId, CachedExportEntity>;
+
+        //! Exports the entity, or clones its cached export if the editor entity didn't change since it was cached. The cache
+        //! entry for the entity is moved to, or newly stored in, usedCache.
+        ExportEntityResult ExportEntityCached(
+            AZ::Entity* sourceEntity, size_t platformFingerprint, PrefabProcessorContext& context, ExportEntityCache& usedCache);
+        //! Calculates a fingerprint from the serialized editor entity. Returns 0 if the entity couldn't be serialized.
+        size_t CalculateEntityFingerprint(const AZ::Entity& sourceEntity, size_t platformFingerprint) const;
+
         using ResolveExportedComponentResult = AZ::Outcome<AZ::ExportedComponent, AZStd::string>;
         ResolveExportedComponentResult ResolveExportedComponent(
             AZ::ExportedComponent& component, PrefabProcessorContext& prefabProcessorContext);
@@ -102,5 +125,7 @@ namespace AzToolsFramework::Prefab::PrefabConversionUtils
             aznew UiEditorOnlyEntityHandler() };
         ComponentRequirementsValidator m_componentRequirementsValidator;
         EntityIdSet m_editorOnlyEntityIds;
+        ExportEntityCache m_exportEntityCache;
+        bool m_cacheExportedEntities{ false };
     };
 } // namespace AzToolsFramework::Prefab::PrefabConversionUtils
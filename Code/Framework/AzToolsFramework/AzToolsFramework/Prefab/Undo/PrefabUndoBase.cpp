@@ -16,6 +16,35 @@ namespace AzToolsFramework
 {
     namespace Prefab
     {
+        // The allocator of a DOM only frees its memory when the DOM is destroyed, and allocates in 64KB chunks by default,
+        // so the intermediate values from generating a patch stay allocated along with it, and even a tiny patch holds a
+        // whole chunk. Copy the patch into an allocator with chunks sized by what the patch used instead.
+        static void CompactPatch(PrefabDom& patch, AZStd::unique_ptr<PrefabDomAllocator>& patchAllocator)
+        {
+            PrefabDomAllocator& currentAllocator = patch.GetAllocator();
+            const size_t usedSize = currentAllocator.Size();
+            const size_t capacity = currentAllocator.Capacity();
+            if (usedSize == 0 || (&currentAllocator == patchAllocator.get() && capacity <= usedSize * 2))
+            {
+                // nothing allocated, or already compacted and not grown much since
+                return;
+            }
+
+            constexpr size_t MinChunkSize = 256;
+            auto compactAllocator = AZStd::make_unique<PrefabDomAllocator>(AZStd::max(usedSize, MinChunkSize));
+            PrefabDom compactPatch(compactAllocator.get());
+            compactPatch.CopyFrom(patch, compactPatch.GetAllocator(), true);
+            if (compactAllocator->Capacity() * 2 > capacity)
+            {
+                // the copy doesn't save enough to be worth it, keep the original
+                return;
+            }
+
+            patch.Swap(compactPatch);
+            patchAllocator.swap(compactAllocator);
+            // compactPatch now holds the original values, and is destroyed before the allocator they may come from
+        }
+
         PrefabUndoBase::PrefabUndoBase(const AZStd::string& undoOperationName)
             : UndoSystem::URSequencePoint(undoOperationName)
             , m_redoPatch(rapidjson::kArrayType)
@@ -38,6 +67,18 @@ namespace AzToolsFramework
             return m_changed;
         }
 
+        void PrefabUndoBase::ReleaseUnusedMemory()
+        {
+            CompactPatch(m_redoPatch, m_redoPatchAllocator);
+            CompactPatch(m_undoPatch, m_undoPatchAllocator);
+        }
+
+        AZStd::size_t PrefabUndoBase::GetMemoryUsage() const
+        {
+            return UndoSystem::URSequencePoint::GetMemoryUsage() + const_cast<PrefabDom&>(m_redoPatch).GetAllocator().Capacity() +
+                const_cast<PrefabDom&>(m_undoPatch).GetAllocator().Capacity();
+        }
+
         void PrefabUndoBase::Undo()
         {
             [[maybe_unused]] bool isPatchApplicationSuccessful =
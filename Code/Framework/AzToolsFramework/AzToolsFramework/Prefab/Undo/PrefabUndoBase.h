@@ -7,7 +7,9 @@
  */
 
 #pragma once
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzToolsFramework/Undo/UndoSystem.h>
+#include <AzToolsFramework/Prefab/PrefabDomTypes.h>
 #include <AzToolsFramework/Prefab/PrefabIdTypes.h>
 
 namespace AzToolsFramework
@@ -28,6 +30,8 @@ namespace AzToolsFramework
             explicit PrefabUndoBase(const AZStd::string& undoOperationName);
 
             bool Changed() const override;
+            void ReleaseUnusedMemory() override;
+            AZStd::size_t GetMemoryUsage() const override;
 
             void Undo() override;
             void Redo() override;
@@ -36,6 +40,10 @@ namespace AzToolsFramework
             void virtual Redo(InstanceOptionalConstReference instanceToExclude);
 
         protected:
+            // The allocators the patches are compacted into, declared before the patches so they outlive them.
+            AZStd::unique_ptr<PrefabDomAllocator> m_redoPatchAllocator;
+            AZStd::unique_ptr<PrefabDomAllocator> m_undoPatchAllocator;
+
             PrefabDom m_redoPatch;
             PrefabDom m_undoPatch;
 
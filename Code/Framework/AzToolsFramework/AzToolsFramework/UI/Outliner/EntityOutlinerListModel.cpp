@@ -35,6 +35,7 @@
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/sort.h>
 
 #include <AzFramework/StringFunc/StringFunc.h>
 
@@ -1140,16 +1141,49 @@ namespace AzToolsFramework
         {
             AZ_PROFILE_SCOPE(Editor, "EntityOutlinerListModel::ProcessEntityUpdates:ChangeQueue");
 
+            // Sort the changed rows by parent, so neighboring rows that changed together are reported with a single dataChanged
+            struct ChangedRow
+            {
+                AZ::EntityId m_parentId;
+                int m_row;
+                AZ::EntityId m_entityId;
+            };
+            AZStd::vector<ChangedRow> changedRows;
+            changedRows.reserve(m_entityChangeQueue.size());
             for (auto entityId : m_entityChangeQueue)
             {
-                if (const QModelIndex beginIndex = GetIndexFromEntity(entityId, ColumnName); beginIndex.isValid())
+                if (entityId.IsValid())
                 {
-                    const QModelIndex endIndex = createIndex(beginIndex.row(), VisibleColumnCount - 1, beginIndex.internalId());
-                    emit dataChanged(beginIndex, endIndex);
+                    AZ::EntityId parentId;
+                    EditorEntityInfoRequestBus::EventResult(parentId, entityId, &EditorEntityInfoRequestBus::Events::GetParent);
+                    AZStd::size_t row = 0;
+                    EditorEntityInfoRequestBus::EventResult(row, parentId, &EditorEntityInfoRequestBus::Events::GetChildIndex, entityId);
+                    changedRows.push_back({ parentId, static_cast<int>(row), entityId });
                 }
             }
-        
             m_entityChangeQueue.clear();
+
+            AZStd::sort(changedRows.begin(), changedRows.end(), [](const ChangedRow& lhs, const ChangedRow& rhs)
+                {
+                    return lhs.m_parentId != rhs.m_parentId ? lhs.m_parentId < rhs.m_parentId : lhs.m_row < rhs.m_row;
+                });
+
+            for (size_t rangeBegin = 0; rangeBegin < changedRows.size();)
+            {
+                size_t rangeEnd = rangeBegin + 1;
+                while (rangeEnd < changedRows.size() && changedRows[rangeEnd].m_parentId == changedRows[rangeBegin].m_parentId
+                    && changedRows[rangeEnd].m_row <= changedRows[rangeEnd - 1].m_row + 1)
+                {
+                    ++rangeEnd;
+                }
+
+                const ChangedRow& first = changedRows[rangeBegin];
+                const ChangedRow& last = changedRows[rangeEnd - 1];
+                emit dataChanged(
+                    createIndex(first.m_row, ColumnName, static_cast<AZ::u64>(first.m_entityId)),
+                    createIndex(last.m_row, VisibleColumnCount - 1, static_cast<AZ::u64>(last.m_entityId)));
+                rangeBegin = rangeEnd;
+            }
         }
 
         {
@@ -1510,7 +1544,16 @@ namespace AzToolsFramework
 
     void EntityOutlinerListModel::InvalidateFilter()
     {
-        FilterEntity(AZ::EntityId());
+        if (m_filterString.empty() && m_componentFilters.empty())
+        {
+            // Without a filter every entity matches, so rather than visiting every entity in the level,
+            // only the entities the previous filter hid need to have their expansion restored
+            ClearFilteredState();
+        }
+        else
+        {
+            FilterEntity(AZ::EntityId());
+        }
 
         // Emit data changed directly as it is immediately valid
         auto modelIndex = GetIndexFromEntity(AZ::EntityId());
@@ -1699,6 +1742,20 @@ namespace AzToolsFramework
         return isFilterMatch;
     }
 
+    void EntityOutlinerListModel::ClearFilteredState()
+    {
+        for (const auto& [entityId, isFiltered] : m_entityFilteredState)
+        {
+            // Same as FilterEntity, entities that were filtered out and are set in an expanded state
+            // need to be expanded again so that the treeview state matches our internal saved state
+            if (isFiltered && IsExpanded(entityId))
+            {
+                QueueEntityToExpand(entityId, true);
+            }
+        }
+        m_entityFilteredState.clear();
+    }
+
     bool EntityOutlinerListModel::IsFiltered(const AZ::EntityId& entityId) const
     {
         auto hiddenItr = m_entityFilteredState.find(entityId);
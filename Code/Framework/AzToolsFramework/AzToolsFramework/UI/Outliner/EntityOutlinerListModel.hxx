@@ -262,6 +262,8 @@ namespace AzToolsFramework
         void RestoreDescendantSelection(const AZ::EntityId& entityId);
 
         bool IsFiltered(const AZ::EntityId& entityId) const;
+        //! Marks every entity as matching, for when no filter is set.
+        void ClearFilteredState();
         AZStd::unordered_map<AZ::EntityId, bool> m_entityFilteredState;
 
         bool HasSelectedDescendant(const AZ::EntityId& entityId) const;
@@ -227,25 +227,12 @@ namespace AzToolsFramework
             }
             else
             {
-                // there's an aggregateInstance, so we're in multi-edit. Create the AggregateAdapter if it doesn't exist yet
-                if (!m_aggregateAdapter)
-                {
-                    m_aggregateAdapter = AZStd::make_shared<AZ::DocumentPropertyEditor::LabeledRowAggregateAdapter>();
-
-                    // for now, disable "values differ rows", since there are so many pointer and opaque types in the Inspector
-                    // and the output is noisy and unpleasant.
-                    m_aggregateAdapter->SetGenerateDiffRows(false);
-
-                    // add the original adapter which was already set in a prior AddInstance with a null aggregateInstance
-                    m_aggregateAdapter->AddAdapter(m_adapter);
-                    m_filterAdapter->SetSourceAdapter(m_aggregateAdapter);
-                }
-
+                // there's an aggregateInstance, so we're in multi-edit.
                 // create the new ComponentAdapter for the componentInstance using the factory from our constructor
                 auto newAdapter = m_adapterFactory();
                 AZ_Assert(newAdapter, "m_adapterFactory should always return a valid ComponentAdapter in DPE mode!");
                 newAdapter->SetComponent(componentInstance);
-                m_aggregateAdapter->AddAdapter(newAdapter);
+                AddAggregatedAdapters({ newAdapter });
             }
         }
         else
@@ -269,6 +256,73 @@ namespace AzToolsFramework
         GetHeader()->setToolTip(BuildHeaderTooltip());
     }
 
+    void ComponentEditor::AddInstances(const AZ::Entity::ComponentArrayType& componentInstances, AZ::Component* compareInstance)
+    {
+        if (componentInstances.empty())
+        {
+            return;
+        }
+
+        // non-first instances are aggregated under the first instance
+        AZ::Component* firstInstance = componentInstances.front();
+        AddInstance(firstInstance, nullptr, compareInstance);
+
+        if (!m_adapter || !firstInstance)
+        {
+            for (size_t instanceIndex = 1; instanceIndex < componentInstances.size(); ++instanceIndex)
+            {
+                AddInstance(componentInstances[instanceIndex], firstInstance, compareInstance);
+            }
+            return;
+        }
+
+        // in DPE mode, hand all the other instances to the aggregate adapter at once, as every adapter added separately resets
+        // the whole document, which makes building the multi-edit rows quadratic in the size of the selection
+        AZStd::vector<AZ::DocumentPropertyEditor::DocumentAdapterPtr> newAdapters;
+        newAdapters.reserve(componentInstances.size() - 1);
+        for (size_t instanceIndex = 1; instanceIndex < componentInstances.size(); ++instanceIndex)
+        {
+            AZ::Component* componentInstance = componentInstances[instanceIndex];
+            if (!componentInstance)
+            {
+                continue;
+            }
+
+            m_components.push_back(componentInstance);
+
+            auto newAdapter = m_adapterFactory();
+            AZ_Assert(newAdapter, "m_adapterFactory should always return a valid ComponentAdapter in DPE mode!");
+            newAdapter->SetComponent(componentInstance);
+            newAdapters.push_back(AZStd::move(newAdapter));
+        }
+
+        if (!newAdapters.empty())
+        {
+            AddAggregatedAdapters(AZStd::move(newAdapters));
+            GetHeader()->setToolTip(BuildHeaderTooltip());
+        }
+    }
+
+    void ComponentEditor::AddAggregatedAdapters(AZStd::vector<AZ::DocumentPropertyEditor::DocumentAdapterPtr> newAdapters)
+    {
+        if (m_aggregateAdapter)
+        {
+            m_aggregateAdapter->AddAdapters(newAdapters);
+            return;
+        }
+
+        m_aggregateAdapter = AZStd::make_shared<AZ::DocumentPropertyEditor::LabeledRowAggregateAdapter>();
+
+        // for now, disable "values differ rows", since there are so many pointer and opaque types in the Inspector
+        // and the output is noisy and unpleasant.
+        m_aggregateAdapter->SetGenerateDiffRows(false);
+
+        // add the original adapter which was already set in a prior AddInstance with a null aggregateInstance
+        newAdapters.insert(newAdapters.begin(), m_adapter);
+        m_aggregateAdapter->AddAdapters(newAdapters);
+        m_filterAdapter->SetSourceAdapter(m_aggregateAdapter);
+    }
+
     void ComponentEditor::ClearInstances(bool invalidateImmediately)
     {
         GetPropertyEditor()->SetDynamicEditDataProvider(nullptr);
@@ -74,6 +74,9 @@ namespace AzToolsFramework
         ~ComponentEditor();
 
         void AddInstance(AZ::Component* componentInstance, AZ::Component* aggregateInstance, AZ::Component* compareInstance);
+        //! Adds the instances of a component shared by a selection, the first instance is the one the others are aggregated under.
+        //! Prefer this to AddInstance per instance, as the DPE then regenerates the multi-edit rows once for the whole selection.
+        void AddInstances(const AZ::Entity::ComponentArrayType& componentInstances, AZ::Component* compareInstance);
         void ClearInstances(bool invalidateImmediately);
 
         void AddNotifications();
@@ -160,6 +163,9 @@ namespace AzToolsFramework
 
         AzQtComponents::CardNotification* CreateNotificationForWarningComponents(const QString& message);
 
+        //! Adds adapters to multi-edit in DPE mode, creating the aggregate adapter the first time.
+        void AddAggregatedAdapters(AZStd::vector<AZ::DocumentPropertyEditor::DocumentAdapterPtr> newAdapters);
+
         bool AreAnyComponentsDisabled() const;
         AzToolsFramework::EntityCompositionRequests::PendingComponentInfo GetPendingComponentInfoForAllComponents() const;
         AzToolsFramework::EntityCompositionRequests::PendingComponentInfo GetPendingComponentInfoForAllComponentsInReverse() const;
@@ -1824,17 +1824,8 @@ namespace AzToolsFramework
 
             auto componentEditor = CreateComponentEditor();
 
-            // Add instances to componentEditor
-            auto& componentInstances = sharedComponentInfo.m_instances;
-            for (AZ::Component* componentInstance : componentInstances)
-            {
-                // non-first instances are aggregated under the first instance
-                AZ::Component* aggregateInstance = componentInstance != componentInstances.front() ? componentInstances.front() : nullptr;
-
-                // Reference the slice entity if we are a slice so we can indicate differences from base
-                AZ::Component* referenceComponentInstance = sharedComponentInfo.m_sliceReferenceComponent;
-                componentEditor->AddInstance(componentInstance, aggregateInstance, referenceComponentInstance);
-            }
+            // Add instances to componentEditor, referencing the slice entity if we are a slice so we can indicate differences from base
+            componentEditor->AddInstances(sharedComponentInfo.m_instances, sharedComponentInfo.m_sliceReferenceComponent);
 
             // Set up other entity property editor customization
             if (ShouldUseDPE() && Prefab::IsInspectorOverrideManagementEnabled())
@@ -67,6 +67,25 @@ namespace AzToolsFramework
         {
         }
 
+        void URSequencePoint::ReleaseUnusedMemory()
+        {
+        }
+
+        AZStd::size_t URSequencePoint::GetMemoryUsage() const
+        {
+            return sizeof(*this) + m_friendlyName.capacity() + m_children.capacity() * sizeof(URSequencePoint*);
+        }
+
+        AZStd::size_t URSequencePoint::GetTreeMemoryUsage() const
+        {
+            AZStd::size_t memoryUsage = GetMemoryUsage();
+            for (const URSequencePoint* child : m_children)
+            {
+                memoryUsage += child->GetTreeMemoryUsage();
+            }
+            return memoryUsage;
+        }
+
         URSequencePoint* URSequencePoint::Find(URCommandID id, const AZ::Uuid& typeOfCommand)
         {
             if (*this == id && this->RTTI_IsTypeOf(typeOfCommand))
@@ -186,8 +205,19 @@ namespace AzToolsFramework
             // any commands beyond the cursor are invalidated thereby
             Slice();
 
+            cmd->ApplyToTree(
+                [](URSequencePoint* sequencePoint)
+                {
+                    sequencePoint->ReleaseUnusedMemory();
+                });
+
+            const AZStd::size_t memoryUsage = cmd->GetTreeMemoryUsage();
             m_SequencePointsBuffer.push_back(cmd);
+            m_SequencePointsMemory.push_back(memoryUsage);
+            m_memoryUsage += memoryUsage;
             m_Cursor = int(m_SequencePointsBuffer.size()) - 1;
+
+            TrimHistory();
 #ifdef _DEBUG
             CleanCheck();
 #endif
@@ -217,6 +247,8 @@ namespace AzToolsFramework
 
             URSequencePoint* returned = m_SequencePointsBuffer[m_Cursor];
             m_SequencePointsBuffer.pop_back();
+            m_memoryUsage -= m_SequencePointsMemory.back();
+            m_SequencePointsMemory.pop_back();
             returned->m_isPosted = false;
             m_Cursor = int(m_SequencePointsBuffer.size()) - 1;
 
@@ -252,6 +284,8 @@ namespace AzToolsFramework
                 }
             }
             m_SequencePointsBuffer.clear();
+            m_SequencePointsMemory.clear();
+            m_memoryUsage = 0;
 
             if (m_notify)
             {
@@ -329,6 +363,8 @@ namespace AzToolsFramework
                 for (int idx = m_Cursor + 1; idx < int(m_SequencePointsBuffer.size()); )
                 {
                     m_SequencePointsBuffer.pop_back();
+                    m_memoryUsage -= m_SequencePointsMemory.back();
+                    m_SequencePointsMemory.pop_back();
                 }
 
                 if (m_CleanPoint > m_Cursor)
@@ -346,6 +382,52 @@ namespace AzToolsFramework
             }
         }
 
+        void UndoStack::SetHistoryLimits(AZStd::size_t maxCommands, AZStd::size_t maxMemoryBytes)
+        {
+            m_maxCommands = maxCommands;
+            m_maxMemoryBytes = maxMemoryBytes;
+        }
+
+        AZStd::size_t UndoStack::GetMemoryUsage() const
+        {
+            return m_memoryUsage;
+        }
+
+        void UndoStack::TrimHistory()
+        {
+            // only trim below the cursor, the commands that can be redone are sliced off by the next post anyway
+            int trimCount = 0;
+            AZStd::size_t memoryUsage = m_memoryUsage;
+            while (trimCount < m_Cursor &&
+                   ((m_maxCommands > 0 && m_SequencePointsBuffer.size() - trimCount > m_maxCommands) ||
+                    (m_maxMemoryBytes > 0 && memoryUsage > m_maxMemoryBytes)))
+            {
+                memoryUsage -= m_SequencePointsMemory[trimCount];
+                ++trimCount;
+            }
+
+            if (trimCount == 0)
+            {
+                return;
+            }
+
+            for (int idx = 0; idx < trimCount; ++idx)
+            {
+                delete m_SequencePointsBuffer[idx];
+            }
+            m_SequencePointsBuffer.erase(m_SequencePointsBuffer.begin(), m_SequencePointsBuffer.begin() + trimCount);
+            m_SequencePointsMemory.erase(m_SequencePointsMemory.begin(), m_SequencePointsMemory.begin() + trimCount);
+            m_memoryUsage = memoryUsage;
+            m_Cursor -= trimCount;
+
+            // the state after the last trimmed command is the state with nothing left to undo, any earlier clean point
+            // can't be reached anymore
+            m_CleanPoint = m_CleanPoint >= trimCount - 1 ? m_CleanPoint - trimCount : -2;
+#ifdef _DEBUG
+            CleanCheck();
+#endif
+        }
+
         URSequencePoint* UndoStack::Find(URCommandID id, const AZ::Uuid& typeOfCommand)
         {
             for (int idx = 0; idx < int(m_SequencePointsBuffer.size()); ++idx)
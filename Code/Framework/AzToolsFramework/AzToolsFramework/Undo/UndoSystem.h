@@ -75,6 +75,21 @@ namespace AzToolsFramework
             */
             virtual bool Changed() const = 0;
 
+            /**
+            Usage: override to release memory that was only needed while capturing the command.
+            Called on every command in the tree when it is posted to the undo stack.
+            */
+            virtual void ReleaseUnusedMemory();
+
+            /**
+            Usage: override to report the memory held by the command (not including its children),
+            so the undo stack can keep its history within a memory budget.
+            */
+            virtual AZStd::size_t GetMemoryUsage() const;
+
+            //! Returns the memory held by this command and all of its children.
+            AZStd::size_t GetTreeMemoryUsage() const;
+
             /**
             Usage: return the first command in the parent/child tree with a matching id
             returns NULL on failure to make any match
@@ -184,7 +199,19 @@ namespace AzToolsFramework
             */
             void Slice();
 
+            /**
+            Usage: limits the history kept by the stack, the oldest commands are deleted when a command is posted
+            past either limit. A limit of 0 means no limit, and the command that was just posted is always kept.
+            */
+            void SetHistoryLimits(AZStd::size_t maxCommands, AZStd::size_t maxMemoryBytes);
+
+            //! Returns the memory held by all the commands in the stack, as reported by URSequencePoint::GetMemoryUsage.
+            AZStd::size_t GetMemoryUsage() const;
+
         protected:
+            //! Deletes the oldest commands until the history is within the limits.
+            void TrimHistory();
+
 #ifdef _DEBUG
             void CleanCheck();
 #endif
@@ -195,6 +222,10 @@ namespace AzToolsFramework
             typedef AZStd::vector<URSequencePoint*> SequencePointBuffer;
 
             SequencePointBuffer m_SequencePointsBuffer;
+            AZStd::vector<AZStd::size_t> m_SequencePointsMemory; //!< The tree memory usage of each command in m_SequencePointsBuffer
+            AZStd::size_t m_memoryUsage = 0;
+            AZStd::size_t m_maxCommands = 0;
+            AZStd::size_t m_maxMemoryBytes = 0;
             IUndoNotify* m_notify;
 
         private:
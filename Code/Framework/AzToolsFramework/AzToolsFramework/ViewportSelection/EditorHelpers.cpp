@@ -193,6 +193,13 @@ namespace AzToolsFramework
         const AZ::Matrix3x4 cameraView = AzFramework::CameraView(cameraState);
         const AZ::Matrix4x4 cameraProjection = AzFramework::CameraProjection(cameraState);
 
+        // only entities whose cached selection bounds the pick ray intersects need the full (per component) intersection test
+        const bool pickCandidatesFound = m_entityDataCache->FindVisibleEntityIndicesAlongRay(
+            mouseInteraction.m_mouseInteraction.m_mousePick.m_rayOrigin,
+            mouseInteraction.m_mouseInteraction.m_mousePick.m_rayDirection,
+            m_pickCandidateEntityIndices);
+        auto nextPickCandidateIt = m_pickCandidateEntityIndices.cbegin();
+
         // selecting new entities
         AZ::EntityId entityIdUnderCursor;
         float closestDistance = AZStd::numeric_limits<float>::max();
@@ -200,6 +207,14 @@ namespace AzToolsFramework
              entityCacheIndex < visibleEntityCount;
              ++entityCacheIndex)
         {
+            // candidates are in ascending order, so advance through them alongside the visible entities
+            bool pickCandidate = !pickCandidatesFound;
+            if (nextPickCandidateIt != m_pickCandidateEntityIndices.cend() && *nextPickCandidateIt == entityCacheIndex)
+            {
+                pickCandidate = true;
+                ++nextPickCandidateIt;
+            }
+
             const AZ::EntityId entityId = m_entityDataCache->GetVisibleEntityId(entityCacheIndex);
 
             if (m_entityDataCache->IsVisibleEntityLocked(entityCacheIndex) || !m_entityDataCache->IsVisibleEntityVisible(entityCacheIndex))
@@ -240,7 +255,7 @@ namespace AzToolsFramework
             }
 
             float closestBoundDifference;
-            if (PickEntity(entityId, mouseInteraction.m_mouseInteraction, closestBoundDifference, viewportId))
+            if (pickCandidate && PickEntity(entityId, mouseInteraction.m_mouseInteraction, closestBoundDifference, viewportId))
             {
                 if (closestBoundDifference < closestDistance)
                 {
@@ -106,6 +106,7 @@ namespace AzToolsFramework
         bool IsSelectableInViewport(size_t entityCacheIndex) const;
 
         AZStd::unique_ptr<InvalidClicks> m_invalidClicks; //!< Display for invalid click behavior.
+        AZStd::vector<size_t> m_pickCandidateEntityIndices; //!< Visible entities the cursor pick ray may intersect (reused between calls).
 
         const EditorVisibleEntityDataCacheInterface* m_entityDataCache = nullptr; //!< Entity Data queried by the EditorHelpers.
         const FocusModeInterface* m_focusModeInterface = nullptr; //!< API to interact with focus mode functionality.
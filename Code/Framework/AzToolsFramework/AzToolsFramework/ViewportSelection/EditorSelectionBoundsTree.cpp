@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "EditorSelectionBoundsTree.h"
+
+#include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/std/containers/small_vector.h>
+#include <AzCore/std/function/function_template.h>
+#include <AzToolsFramework/ViewportSelection/EditorSelectionUtil.h>
+
+namespace AzToolsFramework
+{
+    // the margin the bounds of a leaf are enlarged by, relative to the size of the bounds with a minimum absolute size
+    static AZ::Vector3 BoundsMargin(const AZ::Aabb& bounds)
+    {
+        return bounds.GetExtents() * 0.1f + AZ::Vector3(0.1f);
+    }
+
+    static AZ::Aabb CombinedBounds(const AZ::Aabb& lhs, const AZ::Aabb& rhs)
+    {
+        AZ::Aabb combined = lhs;
+        combined.AddAabb(rhs);
+        return combined;
+    }
+
+    void EditorSelectionBoundsTree::InsertOrUpdate(const AZ::EntityId entityId, const AZ::Aabb& bounds)
+    {
+        if (!bounds.IsValid())
+        {
+            Remove(entityId);
+            return;
+        }
+
+        const AZ::Vector3 margin = BoundsMargin(bounds);
+        if (const auto leafIt = m_leafIndices.find(entityId); leafIt != m_leafIndices.end())
+        {
+            const int32_t leafIndex = leafIt->second;
+            const AZ::Aabb& storedBounds = m_nodes[leafIndex].m_bounds;
+
+            // keep the leaf where it is while the enlarged bounds still contain the entity and have not become
+            // much too large for it (e.g. after the entity was scaled down)
+            if (storedBounds.Contains(bounds) && bounds.GetExpanded(margin * 4.0f).Contains(storedBounds))
+            {
+                return;
+            }
+
+            RemoveLeaf(leafIndex);
+            m_nodes[leafIndex].m_bounds = bounds.GetExpanded(margin);
+            InsertLeaf(leafIndex);
+            return;
+        }
+
+        const int32_t leafIndex = AllocateNode();
+        m_nodes[leafIndex].m_bounds = bounds.GetExpanded(margin);
+        m_nodes[leafIndex].m_entityId = entityId;
+        m_leafIndices.emplace(entityId, leafIndex);
+        InsertLeaf(leafIndex);
+    }
+
+    void EditorSelectionBoundsTree::Remove(const AZ::EntityId entityId)
+    {
+        if (const auto leafIt = m_leafIndices.find(entityId); leafIt != m_leafIndices.end())
+        {
+            const int32_t leafIndex = leafIt->second;
+            m_leafIndices.erase(leafIt);
+            RemoveLeaf(leafIndex);
+            FreeNode(leafIndex);
+        }
+    }
+
+    void EditorSelectionBoundsTree::Clear()
+    {
+        m_nodes.clear();
+        m_leafIndices.clear();
+        m_root = NullNode;
+        m_freeList = NullNode;
+    }
+
+    void EditorSelectionBoundsTree::EnumerateRay(
+        const AZ::Vector3& rayOrigin, const AZ::Vector3& rayDirection, const AZStd::function<void(AZ::EntityId)>& callback) const
+    {
+        AZ_PROFILE_FUNCTION(AzToolsFramework);
+
+        if (m_root == NullNode)
+        {
+            return;
+        }
+
+        // use the same ray as AabbIntersectRay so every entity PickEntity can hit is found
+        const AZ::Vector3 rayScaledDir = rayDirection * EditorPickRayLength;
+        const AZ::Vector3 rayScaledDirReciprocal = rayScaledDir.GetReciprocal();
+
+        AZStd::small_vector<int32_t, 64> nodeStack;
+        nodeStack.push_back(m_root);
+        while (!nodeStack.empty())
+        {
+            const Node& node = m_nodes[nodeStack.back()];
+            nodeStack.pop_back();
+
+            float start, end;
+            AZ::Vector3 startNormal;
+            if (AZ::Intersect::IntersectRayAABB(rayOrigin, rayScaledDir, rayScaledDirReciprocal, node.m_bounds, start, end, startNormal) ==
+                AZ::Intersect::ISECT_RAY_AABB_NONE)
+            {
+                continue;
+            }
+
+            if (node.IsLeaf())
+            {
+                callback(node.m_entityId);
+            }
+            else
+            {
+                nodeStack.push_back(node.m_left);
+                nodeStack.push_back(node.m_right);
+            }
+        }
+    }
+
+    bool EditorSelectionBoundsTree::Contains(const AZ::EntityId entityId) const
+    {
+        return m_leafIndices.find(entityId) != m_leafIndices.end();
+    }
+
+    size_t EditorSelectionBoundsTree::Size() const
+    {
+        return m_leafIndices.size();
+    }
+
+    int32_t EditorSelectionBoundsTree::AllocateNode()
+    {
+        if (m_freeList != NullNode)
+        {
+            const int32_t nodeIndex = m_freeList;
+            m_freeList = m_nodes[nodeIndex].m_parent;
+            m_nodes[nodeIndex] = Node{};
+            return nodeIndex;
+        }
+
+        m_nodes.emplace_back();
+        return aznumeric_cast<int32_t>(m_nodes.size() - 1);
+    }
+
+    void EditorSelectionBoundsTree::FreeNode(const int32_t nodeIndex)
+    {
+        m_nodes[nodeIndex] = Node{};
+        m_nodes[nodeIndex].m_parent = m_freeList;
+        m_freeList = nodeIndex;
+    }
+
+    void EditorSelectionBoundsTree::InsertLeaf(const int32_t leafIndex)
+    {
+        if (m_root == NullNode)
+        {
+            m_root = leafIndex;
+            m_nodes[leafIndex].m_parent = NullNode;
+            return;
+        }
+
+        // descend the tree choosing the child that grows the least in surface area (the surface area heuristic)
+        const AZ::Aabb leafBounds = m_nodes[leafIndex].m_bounds;
+        int32_t siblingIndex = m_root;
+        while (!m_nodes[siblingIndex].IsLeaf())
+        {
+            const Node& node = m_nodes[siblingIndex];
+            const float area = node.m_bounds.GetSurfaceArea();
+            const float combinedArea = CombinedBounds(node.m_bounds, leafBounds).GetSurfaceArea();
+
+            // cost of creating a new parent for this node and the new leaf
+            const float cost = 2.0f * combinedArea;
+            // minimum cost of pushing the leaf further down the tree
+            const float inheritanceCost = 2.0f * (combinedArea - area);
+
+            const auto descendCost = [this, &leafBounds, inheritanceCost](const int32_t childIndex)
+            {
+                const Node& child = m_nodes[childIndex];
+                const float childCombinedArea = CombinedBounds(child.m_bounds, leafBounds).GetSurfaceArea();
+                return child.IsLeaf() ? childCombinedArea + inheritanceCost
+                                      : childCombinedArea - child.m_bounds.GetSurfaceArea() + inheritanceCost;
+            };
+
+            const float leftCost = descendCost(node.m_left);
+            const float rightCost = descendCost(node.m_right);
+            if (cost < leftCost && cost < rightCost)
+            {
+                break;
+            }
+
+            siblingIndex = leftCost < rightCost ? node.m_left : node.m_right;
+        }
+
+        // note: allocating may grow m_nodes, so do not hold references to nodes across it
+        const int32_t oldParentIndex = m_nodes[siblingIndex].m_parent;
+        const int32_t newParentIndex = AllocateNode();
+        m_nodes[newParentIndex].m_parent = oldParentIndex;
+        m_nodes[newParentIndex].m_bounds = CombinedBounds(m_nodes[siblingIndex].m_bounds, leafBounds);
+        m_nodes[newParentIndex].m_left = siblingIndex;
+        m_nodes[newParentIndex].m_right = leafIndex;
+        m_nodes[siblingIndex].m_parent = newParentIndex;
+        m_nodes[leafIndex].m_parent = newParentIndex;
+
+        if (oldParentIndex == NullNode)
+        {
+            m_root = newParentIndex;
+        }
+        else
+        {
+            Node& oldParent = m_nodes[oldParentIndex];
+            (oldParent.m_left == siblingIndex ? oldParent.m_left : oldParent.m_right) = newParentIndex;
+            RefitAncestors(oldParentIndex);
+        }
+    }
+
+    void EditorSelectionBoundsTree::RemoveLeaf(const int32_t leafIndex)
+    {
+        if (leafIndex == m_root)
+        {
+            m_root = NullNode;
+            return;
+        }
+
+        const int32_t parentIndex = m_nodes[leafIndex].m_parent;
+        const int32_t grandParentIndex = m_nodes[parentIndex].m_parent;
+        const int32_t siblingIndex =
+            m_nodes[parentIndex].m_left == leafIndex ? m_nodes[parentIndex].m_right : m_nodes[parentIndex].m_left;
+
+        // replace the parent with the sibling of the leaf
+        m_nodes[siblingIndex].m_parent = grandParentIndex;
+        if (grandParentIndex == NullNode)
+        {
+            m_root = siblingIndex;
+        }
+        else
+        {
+            Node& grandParent = m_nodes[grandParentIndex];
+            (grandParent.m_left == parentIndex ? grandParent.m_left : grandParent.m_right) = siblingIndex;
+            RefitAncestors(grandParentIndex);
+        }
+
+        FreeNode(parentIndex);
+        m_nodes[leafIndex].m_parent = NullNode;
+    }
+
+    void EditorSelectionBoundsTree::RefitAncestors(int32_t nodeIndex)
+    {
+        while (nodeIndex != NullNode)
+        {
+            Node& node = m_nodes[nodeIndex];
+            node.m_bounds = CombinedBounds(m_nodes[node.m_left].m_bounds, m_nodes[node.m_right].m_bounds);
+            nodeIndex = node.m_parent;
+        }
+    }
+} // namespace AzToolsFramework
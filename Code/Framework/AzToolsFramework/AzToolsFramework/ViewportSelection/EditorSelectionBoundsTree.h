@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_fwd.h>
+
+namespace AzToolsFramework
+{
+    //! A bounding volume hierarchy of the editor selection bounds of entities, used to find the entities
+    //! a pick ray may intersect without testing every visible entity.
+    //! Every entity is stored in a leaf with its bounds enlarged by a margin, so small movements (e.g. while
+    //! dragging a manipulator) only have to check the enlarged bounds and do not restructure the tree.
+    //! @note The tree is a broad phase only, the stored bounds always contain the bounds they were
+    //! updated with but may be larger.
+    class EditorSelectionBoundsTree
+    {
+    public:
+        //! Inserts the entity, or updates its bounds if it is already in the tree.
+        //! @note Entities with invalid bounds are removed from the tree.
+        void InsertOrUpdate(AZ::EntityId entityId, const AZ::Aabb& bounds);
+
+        //! Removes the entity from the tree (does nothing if it is not in the tree).
+        void Remove(AZ::EntityId entityId);
+
+        //! Removes all entities from the tree.
+        void Clear();
+
+        //! Calls the callback for every entity whose stored bounds intersect the pick ray.
+        //! @note The ray length is EditorPickRayLength to match the tests in PickEntity.
+        void EnumerateRay(
+            const AZ::Vector3& rayOrigin, const AZ::Vector3& rayDirection, const AZStd::function<void(AZ::EntityId)>& callback) const;
+
+        //! Returns true if the entity is stored in the tree.
+        bool Contains(AZ::EntityId entityId) const;
+
+        //! Returns the number of entities stored in the tree.
+        size_t Size() const;
+
+    private:
+        static constexpr int32_t NullNode = -1;
+
+        struct Node
+        {
+            bool IsLeaf() const
+            {
+                return m_left == NullNode;
+            }
+
+            AZ::Aabb m_bounds = AZ::Aabb::CreateNull(); //!< Enlarged bounds for leaves, union of the children otherwise.
+            AZ::EntityId m_entityId; //!< The entity of a leaf.
+            int32_t m_parent = NullNode; //!< Also links the free nodes together.
+            int32_t m_left = NullNode;
+            int32_t m_right = NullNode;
+        };
+
+        int32_t AllocateNode();
+        void FreeNode(int32_t nodeIndex);
+        void InsertLeaf(int32_t leafIndex);
+        void RemoveLeaf(int32_t leafIndex);
+        //! Recalculates the bounds of the node and its ancestors after one of its children changed.
+        void RefitAncestors(int32_t nodeIndex);
+
+        AZStd::vector<Node> m_nodes;
+        AZStd::unordered_map<AZ::EntityId, int32_t> m_leafIndices; //!< Lookup from an entity to its leaf.
+        int32_t m_root = NullNode;
+        int32_t m_freeList = NullNode;
+    };
+} // namespace AzToolsFramework
@@ -8,13 +8,26 @@
 
 #include "EditorVisibleEntityDataCache.h"
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/sort.h>
+#include <AzFramework/Visibility/EntityBoundsUnionBus.h>
 #include <AzToolsFramework/ContainerEntity/ContainerEntityInterface.h>
 #include <AzToolsFramework/Entity/EditorEntityModel.h>
 #include <AzToolsFramework/FocusMode/FocusModeInterface.h>
+#include <AzToolsFramework/UI/PropertyEditor/PropertyEditorAPI.h>
 #include <AzToolsFramework/Viewport/ViewportMessages.h>
+#include <AzToolsFramework/ViewportSelection/EditorSelectionBoundsTree.h>
 #include <Entity/EditorEntityHelpers.h>
 
+AZ_CVAR(
+    bool,
+    ed_viewportSelectionBoundsTree,
+    true,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "Cache the selection bounds of visible entities in a bounding volume hierarchy to accelerate picking in the viewport");
+
 namespace AzToolsFramework
 {
     //! Cached Entity data required by the selection.
@@ -56,13 +69,56 @@ namespace AzToolsFramework
     };
 
     class EditorVisibleEntityDataCache::EditorVisibleEntityDataCacheImpl
+        : private PropertyEditorEntityChangeNotificationBus::Router
     {
     public:
+        EditorVisibleEntityDataCacheImpl();
+        ~EditorVisibleEntityDataCacheImpl();
+
         EntityIdList m_visibleEntityIds; //!< The EntityIds that are visible this frame.
         EntityIdList m_prevVisibleEntityIds; //!< The EntityIds that were visible the previous frame (unsorted).
         EntityDatas m_visibleEntityDatas; //!< Cached EntityData required by EditorTransformComponentSelection.
+
+        EditorSelectionBoundsTree m_selectionBoundsTree; //!< Cached selection bounds of the visible entities.
+        AZStd::unordered_set<AZ::EntityId> m_selectionBoundsDirtyEntityIds; //!< Entities whose selection bounds may have changed.
+        AZStd::unordered_set<AZ::EntityId> m_cameraDependentBoundsEntityIds; //!< Visible entities whose selection bounds are never cached.
+        bool m_selectionBoundsCached = false; //!< Is every visible entity either in the tree, camera dependent or dirty.
+
+    private:
+        // PropertyEditorEntityChangeNotificationBus overrides ...
+        void OnEntityComponentPropertyChanged(AZ::ComponentId componentId) override;
+
+        //! Local bounds changes (e.g. a mesh finished loading) are tracked by the entity bounds union system.
+        AzFramework::EntityBoundsUnionChangedEvent::Handler m_entityBoundsUnionChangedHandler;
     };
 
+    EditorVisibleEntityDataCache::EditorVisibleEntityDataCacheImpl::EditorVisibleEntityDataCacheImpl()
+        : m_entityBoundsUnionChangedHandler(
+              [this](const AZ::EntityId entityId)
+              {
+                  m_selectionBoundsDirtyEntityIds.insert(entityId);
+              })
+    {
+        PropertyEditorEntityChangeNotificationBus::Router::BusRouterConnect();
+
+        if (auto entityBoundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get())
+        {
+            entityBoundsUnion->RegisterEntityBoundsUnionChangedEventHandler(m_entityBoundsUnionChangedHandler);
+        }
+    }
+
+    EditorVisibleEntityDataCache::EditorVisibleEntityDataCacheImpl::~EditorVisibleEntityDataCacheImpl()
+    {
+        PropertyEditorEntityChangeNotificationBus::Router::BusRouterDisconnect();
+    }
+
+    void EditorVisibleEntityDataCache::EditorVisibleEntityDataCacheImpl::OnEntityComponentPropertyChanged(
+        [[maybe_unused]] const AZ::ComponentId componentId)
+    {
+        // editing a property may change the selection bounds without moving the entity (e.g. the size of a shape)
+        m_selectionBoundsDirtyEntityIds.insert(*PropertyEditorEntityChangeNotificationBus::GetCurrentBusId());
+    }
+
     // constructor for EntityData to support emplace_back in vector
     EntityData::EntityData(
         const AZ::EntityId entityId,
@@ -204,6 +260,8 @@ namespace AzToolsFramework
         }
 
         AZStd::sort(m_impl->m_visibleEntityDatas.begin(), m_impl->m_visibleEntityDatas.end());
+
+        m_impl->m_selectionBoundsDirtyEntityIds.insert(entityIds.begin(), entityIds.end());
     }
 
     void EditorVisibleEntityDataCache::CalculateVisibleEntityDatas(const AzFramework::ViewportInfo& viewportInfo)
@@ -247,6 +305,13 @@ namespace AzToolsFramework
                 return removeIt.first != removeIt.second;
             };
 
+            // entities that are no longer visible cannot be picked
+            for (const EntityData& entityData : removed)
+            {
+                m_impl->m_selectionBoundsTree.Remove(entityData.m_entityId);
+                m_impl->m_cameraDependentBoundsEntityIds.erase(entityData.m_entityId);
+            }
+
             // erase-remove idiom - bubble entities to be removed to the end, then erase them in one go
             m_impl->m_visibleEntityDatas.erase(
                 AZStd::remove_if(m_impl->m_visibleEntityDatas.begin(), m_impl->m_visibleEntityDatas.end(), removePredicate),
@@ -257,11 +322,65 @@ namespace AzToolsFramework
             for (AZ::EntityId entityId : added)
             {
                 m_impl->m_visibleEntityDatas.push_back(EntityDataFromEntityId(entityId));
+                m_impl->m_selectionBoundsDirtyEntityIds.insert(entityId);
             }
 
             // after inserting added elements, ensure we keep the visible entity data in sorted order
             AZStd::sort(m_impl->m_visibleEntityDatas.begin(), m_impl->m_visibleEntityDatas.end());
         }
+
+        UpdateSelectionBounds(viewportInfo);
+    }
+
+    void EditorVisibleEntityDataCache::UpdateSelectionBounds(const AzFramework::ViewportInfo& viewportInfo)
+    {
+        AZ_PROFILE_FUNCTION(AzToolsFramework);
+
+        if (!ed_viewportSelectionBoundsTree)
+        {
+            if (m_impl->m_selectionBoundsCached)
+            {
+                m_impl->m_selectionBoundsTree.Clear();
+                m_impl->m_cameraDependentBoundsEntityIds.clear();
+                m_impl->m_selectionBoundsCached = false;
+            }
+
+            m_impl->m_selectionBoundsDirtyEntityIds.clear();
+            return;
+        }
+
+        if (!m_impl->m_selectionBoundsCached)
+        {
+            for (const EntityData& entityData : m_impl->m_visibleEntityDatas)
+            {
+                m_impl->m_selectionBoundsDirtyEntityIds.insert(entityData.m_entityId);
+            }
+
+            m_impl->m_selectionBoundsCached = true;
+        }
+
+        // note: the bounds are cached for the viewport that is updated, the bounds of entities that
+        // depend on the viewport (camera) are recalculated by PickEntity every time instead
+        for (const AZ::EntityId entityId : m_impl->m_selectionBoundsDirtyEntityIds)
+        {
+            if (!GetVisibleEntityIndexFromId(entityId).has_value())
+            {
+                continue;
+            }
+
+            if (EditorEntitySelectionBoundsDependOnCamera(entityId))
+            {
+                m_impl->m_selectionBoundsTree.Remove(entityId);
+                m_impl->m_cameraDependentBoundsEntityIds.insert(entityId);
+            }
+            else
+            {
+                m_impl->m_cameraDependentBoundsEntityIds.erase(entityId);
+                m_impl->m_selectionBoundsTree.InsertOrUpdate(entityId, CalculateEditorEntitySelectionBounds(entityId, viewportInfo));
+            }
+        }
+
+        m_impl->m_selectionBoundsDirtyEntityIds.clear();
     }
 
     size_t EditorVisibleEntityDataCache::VisibleEntityDataCount() const
@@ -333,6 +452,45 @@ namespace AzToolsFramework
         return {};
     }
 
+    bool EditorVisibleEntityDataCache::FindVisibleEntityIndicesAlongRay(
+        const AZ::Vector3& rayOrigin, const AZ::Vector3& rayDirection, AZStd::vector<size_t>& entityIndices) const
+    {
+        AZ_PROFILE_FUNCTION(AzToolsFramework);
+
+        entityIndices.clear();
+
+        if (!ed_viewportSelectionBoundsTree || !m_impl->m_selectionBoundsCached)
+        {
+            return false;
+        }
+
+        const auto addVisibleEntity = [this, &entityIndices](const AZ::EntityId entityId)
+        {
+            if (const AZStd::optional<size_t> entityIndex = GetVisibleEntityIndexFromId(entityId))
+            {
+                entityIndices.push_back(entityIndex.value());
+            }
+        };
+
+        m_impl->m_selectionBoundsTree.EnumerateRay(rayOrigin, rayDirection, addVisibleEntity);
+
+        // entities that changed since the last update may have moved anywhere
+        for (const AZ::EntityId entityId : m_impl->m_selectionBoundsDirtyEntityIds)
+        {
+            addVisibleEntity(entityId);
+        }
+
+        for (const AZ::EntityId entityId : m_impl->m_cameraDependentBoundsEntityIds)
+        {
+            addVisibleEntity(entityId);
+        }
+
+        AZStd::sort(entityIndices.begin(), entityIndices.end());
+        entityIndices.erase(AZStd::unique(entityIndices.begin(), entityIndices.end()), entityIndices.end());
+
+        return true;
+    }
+
     void EditorVisibleEntityDataCache::AfterUndoRedo()
     {
         // ensure we refresh all EntityData after an undo/redo action as
@@ -340,6 +498,7 @@ namespace AzToolsFramework
         for (EntityData& entityData : m_impl->m_visibleEntityDatas)
         {
             entityData = EntityDataFromEntityId(entityData.m_entityId);
+            m_impl->m_selectionBoundsDirtyEntityIds.insert(entityData.m_entityId);
         }
     }
 
@@ -374,6 +533,7 @@ namespace AzToolsFramework
         if (AZStd::optional<size_t> entityIndex = GetVisibleEntityIndexFromId(entityId))
         {
             m_impl->m_visibleEntityDatas[entityIndex.value()].m_worldFromLocal = world;
+            m_impl->m_selectionBoundsDirtyEntityIds.insert(entityId);
         }
     }
 
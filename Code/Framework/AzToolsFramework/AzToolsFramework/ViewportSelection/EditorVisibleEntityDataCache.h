@@ -44,6 +44,13 @@ namespace AzToolsFramework
         virtual bool IsVisibleEntityIndividuallySelectableInViewport(size_t index) const = 0;
         virtual bool IsVisibleEntityInFocusSubTree(size_t index) const = 0;
         virtual AZStd::optional<size_t> GetVisibleEntityIndexFromId(AZ::EntityId entityId) const = 0;
+        //! Finds the visible entities a pick ray may intersect, using the cached selection bounds of the entities.
+        //! Entities whose bounds are not cached (they changed since the last update or depend on the camera) are always
+        //! included, so each entity found must still be tested exactly (see PickEntity).
+        //! @param entityIndices Receives the indices of the entities found in ascending order.
+        //! @return False if the cached bounds are not available, in which case every visible entity must be tested.
+        virtual bool FindVisibleEntityIndicesAlongRay(
+            const AZ::Vector3& rayOrigin, const AZ::Vector3& rayDirection, AZStd::vector<size_t>& entityIndices) const = 0;
     };
 
     //! A cache of packed EntityData that can be iterated over efficiently without
@@ -85,10 +92,15 @@ namespace AzToolsFramework
         bool IsVisibleEntityIndividuallySelectableInViewport(size_t index) const override;
         bool IsVisibleEntityInFocusSubTree(size_t index) const override;
         AZStd::optional<size_t> GetVisibleEntityIndexFromId(AZ::EntityId entityId) const override;
+        bool FindVisibleEntityIndicesAlongRay(
+            const AZ::Vector3& rayOrigin, const AZ::Vector3& rayDirection, AZStd::vector<size_t>& entityIndices) const override;
 
         void AddEntityIds(const EntityIdList& entityIds);
 
     private:
+        //! Recalculates the cached selection bounds of the visible entities that changed since the last update.
+        void UpdateSelectionBounds(const AzFramework::ViewportInfo& viewportInfo);
+
         // ToolsApplicationNotificationBus overrides ...
         void AfterUndoRedo() override;
 
@@ -681,6 +681,8 @@ set(FILES
     ViewportSelection/EditorInteractionSystemViewportSelectionRequestBus.h
     ViewportSelection/EditorPickEntitySelection.h
     ViewportSelection/EditorPickEntitySelection.cpp
+    ViewportSelection/EditorSelectionBoundsTree.h
+    ViewportSelection/EditorSelectionBoundsTree.cpp
     ViewportSelection/EditorSelectionUtil.h
     ViewportSelection/EditorSelectionUtil.cpp
     ViewportSelection/EditorTransformComponentSelection.h
@@ -888,6 +890,8 @@ set(FILES
     Prefab/PrefabUndoCache.h
     Prefab/PrefabUndoHelpers.cpp
     Prefab/PrefabUndoHelpers.h
+    Prefab/Spawnable/AssetPlatformComponentRemover.h
+    Prefab/Spawnable/AssetPlatformComponentRemover.cpp
     Prefab/Spawnable/ComponentRequirementsValidator.h
     Prefab/Spawnable/ComponentRequirementsValidator.cpp
     Prefab/Spawnable/EditorInfoRemover.h
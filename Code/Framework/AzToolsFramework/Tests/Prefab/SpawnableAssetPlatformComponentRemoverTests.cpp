@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzToolsFramework/Prefab/Spawnable/AssetPlatformComponentRemover.h>
+#include <AzToolsFramework/UnitTest/AzToolsFrameworkTestHelpers.h>
+
+namespace UnitTest
+{
+    using AzToolsFramework::Prefab::PrefabConversionUtils::AssetPlatformComponentRemover;
+
+    class TestRenderServiceComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(TestRenderServiceComponent, "{89196003-6265-42BE-A006-ED61E74D6B1E}", AZ::Component);
+
+        void Activate() override {}
+        void Deactivate() override {}
+
+        static void Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<TestRenderServiceComponent, AZ::Component>();
+            }
+        }
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+        {
+            provided.push_back(AZ_CRC_CE("TestRenderService"));
+        }
+    };
+
+    class TestRenderServiceUserComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(TestRenderServiceUserComponent, "{FB8337DD-53BF-4776-90BA-727BE58CC601}", AZ::Component);
+
+        void Activate() override {}
+        void Deactivate() override {}
+
+        static void Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<TestRenderServiceUserComponent, AZ::Component>();
+            }
+        }
+
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+        {
+            required.push_back(AZ_CRC_CE("TestRenderService"));
+        }
+    };
+
+    class TestStandaloneRenderComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(TestStandaloneRenderComponent, "{C54C3E95-66A9-45F1-8B5C-82AA69E34FAA}", AZ::Component);
+
+        void Activate() override {}
+        void Deactivate() override {}
+
+        static void Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<TestStandaloneRenderComponent, AZ::Component>();
+            }
+        }
+    };
+
+    class SpawnableAssetPlatformComponentRemoverTests
+        : public ToolsApplicationFixture<>
+    {
+    protected:
+        void SetUpEditorFixtureImpl() override
+        {
+            auto* app = GetApplication();
+            app->RegisterComponentDescriptor(TestRenderServiceComponent::CreateDescriptor());
+            app->RegisterComponentDescriptor(TestRenderServiceUserComponent::CreateDescriptor());
+            app->RegisterComponentDescriptor(TestStandaloneRenderComponent::CreateDescriptor());
+        }
+    };
+
+    TEST_F(SpawnableAssetPlatformComponentRemoverTests, RemoveExcludedComponents_ExcludedComponent_IsRemoved)
+    {
+        AZ::Entity entity("Entity");
+        entity.CreateComponent<TestStandaloneRenderComponent>();
+        entity.CreateComponent<TestRenderServiceUserComponent>();
+        entity.CreateComponent<TestRenderServiceComponent>();
+
+        const size_t removedCount =
+            AssetPlatformComponentRemover::RemoveExcludedComponents(entity, { azrtti_typeid<TestStandaloneRenderComponent>() });
+
+        EXPECT_EQ(removedCount, 1);
+        EXPECT_FALSE(entity.FindComponent<TestStandaloneRenderComponent>());
+        EXPECT_TRUE(entity.FindComponent<TestRenderServiceUserComponent>());
+        EXPECT_TRUE(entity.FindComponent<TestRenderServiceComponent>());
+    }
+
+    TEST_F(SpawnableAssetPlatformComponentRemoverTests, RemoveExcludedComponents_ExcludedComponentProvidingRequiredService_IsKept)
+    {
+        AZ::Entity entity("Entity");
+        entity.CreateComponent<TestRenderServiceUserComponent>();
+        entity.CreateComponent<TestRenderServiceComponent>();
+
+        const size_t removedCount =
+            AssetPlatformComponentRemover::RemoveExcludedComponents(entity, { azrtti_typeid<TestRenderServiceComponent>() });
+
+        EXPECT_EQ(removedCount, 0);
+        EXPECT_TRUE(entity.FindComponent<TestRenderServiceComponent>());
+    }
+
+    TEST_F(SpawnableAssetPlatformComponentRemoverTests, RemoveExcludedComponents_ExcludedProviderAndUser_AreBothRemoved)
+    {
+        AZ::Entity entity("Entity");
+        entity.CreateComponent<TestRenderServiceUserComponent>();
+        entity.CreateComponent<TestRenderServiceComponent>();
+
+        const size_t removedCount = AssetPlatformComponentRemover::RemoveExcludedComponents(
+            entity, { azrtti_typeid<TestRenderServiceComponent>(), azrtti_typeid<TestRenderServiceUserComponent>() });
+
+        EXPECT_EQ(removedCount, 2);
+        EXPECT_TRUE(entity.GetComponents().empty());
+    }
+} // namespace UnitTest
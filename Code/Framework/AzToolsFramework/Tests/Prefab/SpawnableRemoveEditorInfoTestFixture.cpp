@@ -85,6 +85,7 @@ namespace UnitTest
     AZ::ExportedComponent TestExportEditorComponent::ExportComponent(
         AZ::Component* thisComponent, const AZ::PlatformTagSet& /*platformTags*/)
     {
+        ++s_exportComponentCallCount;
         switch (m_exportType)
         {
         case ExportComponentType::ExportEditorComponent:
@@ -123,10 +124,15 @@ namespace UnitTest
         app->RegisterComponentDescriptor(TestExportRuntimeComponentWithCallback::CreateDescriptor());
         app->RegisterComponentDescriptor(TestExportRuntimeComponentWithoutCallback::CreateDescriptor());
         app->RegisterComponentDescriptor(TestExportEditorComponent::CreateDescriptor());
+
+        TestExportEditorComponent::s_exportComponentCallCount = 0;
     }
 
     void SpawnableRemoveEditorInfoTestFixture::TearDownEditorFixtureImpl()
     {
+        // Release the cached exports while the application is still running.
+        m_editorInfoRemover.SetCacheExportedEntities(false);
+
         for (AZ::Entity* entity : m_runtimeEntities)
         {
             delete entity;
@@ -201,7 +207,11 @@ namespace UnitTest
     void SpawnableRemoveEditorInfoTestFixture::ConvertRuntimePrefab(bool expectedResult)
     {
         ConvertSourceEntitiesToPrefab();
+        ConvertRuntimePrefabAgain(expectedResult);
+    }
 
+    void SpawnableRemoveEditorInfoTestFixture::ConvertRuntimePrefabAgain(bool expectedResult)
+    {
         AzToolsFramework::Prefab::PrefabConversionUtils::PrefabDocument prefab("Test");
         prefab.SetPrefabDom(m_prefabDom);
         const bool actualResult =
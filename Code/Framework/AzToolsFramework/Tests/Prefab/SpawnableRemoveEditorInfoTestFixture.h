@@ -80,6 +80,8 @@ namespace UnitTest
 
         ExportComponentType m_exportType{ ExportComponentType::ExportNullComponent };
         bool m_exportHandled{ false };
+
+        static inline int s_exportComponentCallCount = 0;
     };
 
     class SpawnableRemoveEditorInfoTestFixture
@@ -108,6 +110,9 @@ namespace UnitTest
 
         void ConvertRuntimePrefab(bool expectedResult = true);
 
+        // Convert the prefab DOM created by the last call to ConvertRuntimePrefab again.
+        void ConvertRuntimePrefabAgain(bool expectedResult = true);
+
         AZStd::vector<AZ::Entity*> m_sourceEntities;
         AZStd::vector<AZ::Entity*> m_runtimeEntities;
         AZ::SerializeContext* m_serializeContext{ nullptr };
@@ -164,4 +164,43 @@ namespace UnitTest
         // We expect the exporting to fail, since an editor component is being exported as a game component.
         ConvertRuntimePrefab(false);
     }
+
+    TEST_F(SpawnableRemoveEditorInfoTests, CacheExportedEntities_UnchangedEntityConvertedAgain_CachedExportIsReused)
+    {
+        m_editorInfoRemover.SetCacheExportedEntities(true);
+        CreateSourceTestExportEditorEntity(
+            "EntityWithEditorComponent",
+            TestExportEditorComponent::ExportComponentType::ExportRuntimeComponentWithCallBack,
+            true);
+
+        ConvertRuntimePrefab();
+        EXPECT_EQ(1, TestExportEditorComponent::s_exportComponentCallCount);
+
+        // Converting the same prefab again creates a new export entity from the cache without exporting the components.
+        AZ::Entity* firstEntity = GetRuntimeEntity("EntityWithEditorComponent");
+        ASSERT_TRUE(firstEntity);
+        m_runtimeEntities.clear();
+        ConvertRuntimePrefabAgain();
+        EXPECT_EQ(1, TestExportEditorComponent::s_exportComponentCallCount);
+
+        AZ::Entity* secondEntity = GetRuntimeEntity("EntityWithEditorComponent");
+        ASSERT_TRUE(secondEntity);
+        EXPECT_NE(firstEntity, secondEntity);
+        EXPECT_EQ(firstEntity->GetId(), secondEntity->GetId());
+        EXPECT_FALSE(secondEntity->FindComponent<TestExportEditorComponent>());
+        EXPECT_TRUE(secondEntity->FindComponent<TestExportRuntimeComponentWithCallback>());
+        m_runtimeEntities.push_back(firstEntity);
+    }
+
+    TEST_F(SpawnableRemoveEditorInfoTests, CacheExportedEntities_CacheDisabled_EntityIsExportedAgain)
+    {
+        CreateSourceTestExportEditorEntity(
+            "EntityWithEditorComponent",
+            TestExportEditorComponent::ExportComponentType::ExportRuntimeComponentWithCallBack,
+            true);
+
+        ConvertRuntimePrefab();
+        ConvertRuntimePrefabAgain();
+        EXPECT_EQ(2, TestExportEditorComponent::s_exportComponentCallCount);
+    }
 }
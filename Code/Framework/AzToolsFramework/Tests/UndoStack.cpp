@@ -519,4 +519,93 @@ namespace UnitTest
         EXPECT_EQ(numUndos, counter);
         EXPECT_EQ(tracker, numUndos);
     }
+
+    TEST(UndoStack, HistoryMaxCommands_OldestCommandsAreDiscarded)
+    {
+        UndoStack undoStack(nullptr);
+        undoStack.SetHistoryLimits(3, 0);
+
+        int tracker = 0;
+        for (int i = 0; i < 5; i++)
+        {
+            undoStack.Post(aznew UndoIntSetter(&tracker, i + 1));
+        }
+
+        int counter = 0;
+        while (undoStack.CanUndo())
+        {
+            undoStack.Undo();
+            counter++;
+        }
+
+        // only the last three commands (setting 3, 4 and 5) can be undone
+        EXPECT_EQ(counter, 3);
+        EXPECT_EQ(tracker, 2);
+    }
+
+    class UndoFixedMemoryTest : public URSequencePoint
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(UndoFixedMemoryTest, AZ::SystemAllocator)
+
+        explicit UndoFixedMemoryTest(AZStd::size_t memoryUsage)
+            : URSequencePoint("UndoFixedMemoryTest")
+            , m_memoryUsage(memoryUsage)
+        {
+        }
+
+        AZStd::size_t GetMemoryUsage() const override { return m_memoryUsage; }
+
+        bool Changed() const override { return true; }
+
+    private:
+        AZStd::size_t m_memoryUsage;
+    };
+
+    TEST(UndoStack, HistoryMaxMemory_OldestCommandsAreDiscardedAndNewestIsKept)
+    {
+        UndoStack undoStack(nullptr);
+        undoStack.SetHistoryLimits(0, 1000);
+
+        undoStack.Post(aznew UndoFixedMemoryTest(400));
+        undoStack.Post(aznew UndoFixedMemoryTest(400));
+        EXPECT_EQ(undoStack.GetMemoryUsage(), 800);
+
+        undoStack.Post(aznew UndoFixedMemoryTest(400));
+        EXPECT_EQ(undoStack.GetMemoryUsage(), 800);
+
+        // a single command over the budget is still kept
+        undoStack.Post(aznew UndoFixedMemoryTest(2000));
+        EXPECT_EQ(undoStack.GetMemoryUsage(), 2000);
+        EXPECT_TRUE(undoStack.CanUndo());
+
+        undoStack.Undo();
+        EXPECT_FALSE(undoStack.CanUndo());
+    }
+
+    TEST(UndoStack, HistoryTrimmed_CleanPointIsKeptOnlyWhileReachable)
+    {
+        UndoStack undoStack(nullptr);
+        undoStack.SetHistoryLimits(2, 0);
+
+        int tracker = 0;
+        undoStack.Post(aznew UndoIntSetter(&tracker, 1));
+        undoStack.SetClean();
+        undoStack.Post(aznew UndoIntSetter(&tracker, 2));
+        undoStack.Post(aznew UndoIntSetter(&tracker, 3));
+
+        // the clean state is the state before the oldest command that is left
+        undoStack.Undo();
+        undoStack.Undo();
+        EXPECT_TRUE(undoStack.IsClean());
+
+        undoStack.Redo();
+        undoStack.Redo();
+        undoStack.Post(aznew UndoIntSetter(&tracker, 4));
+        while (undoStack.CanUndo())
+        {
+            undoStack.Undo();
+            EXPECT_FALSE(undoStack.IsClean());
+        }
+    }
 }
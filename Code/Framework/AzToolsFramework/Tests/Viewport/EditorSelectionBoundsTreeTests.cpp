@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/sort.h>
+#include <AzTest/AzTest.h>
+#include <AzToolsFramework/ViewportSelection/EditorSelectionBoundsTree.h>
+
+namespace UnitTest
+{
+    using EditorSelectionBoundsTreeFixture = LeakDetectionFixture;
+
+    static AZStd::vector<AZ::EntityId> EntitiesAlongRay(
+        const AzToolsFramework::EditorSelectionBoundsTree& tree, const AZ::Vector3& rayOrigin, const AZ::Vector3& rayDirection)
+    {
+        AZStd::vector<AZ::EntityId> entityIds;
+        tree.EnumerateRay(
+            rayOrigin,
+            rayDirection,
+            [&entityIds](const AZ::EntityId entityId)
+            {
+                entityIds.push_back(entityId);
+            });
+        AZStd::sort(entityIds.begin(), entityIds.end());
+        return entityIds;
+    }
+
+    TEST_F(EditorSelectionBoundsTreeFixture, EnumerateRayFindsOnlyEntitiesAlongTheRay)
+    {
+        AzToolsFramework::EditorSelectionBoundsTree tree;
+
+        // a row of unit boxes along the x axis
+        for (AZ::u64 index = 0; index < 10; ++index)
+        {
+            const AZ::Vector3 center(aznumeric_cast<float>(index) * 10.0f, 0.0f, 0.0f);
+            tree.InsertOrUpdate(AZ::EntityId(index + 1), AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(0.5f)));
+        }
+
+        EXPECT_EQ(tree.Size(), 10);
+
+        // a ray along the row hits every box
+        EXPECT_EQ(EntitiesAlongRay(tree, AZ::Vector3(-10.0f, 0.0f, 0.0f), AZ::Vector3::CreateAxisX()).size(), 10);
+
+        // a ray looking down on a single box only hits that box
+        const AZStd::vector<AZ::EntityId> entityIds =
+            EntitiesAlongRay(tree, AZ::Vector3(30.0f, 0.0f, 10.0f), -AZ::Vector3::CreateAxisZ());
+        ASSERT_EQ(entityIds.size(), 1);
+        EXPECT_EQ(entityIds.front(), AZ::EntityId(4));
+
+        // a ray away from the row hits nothing
+        EXPECT_TRUE(EntitiesAlongRay(tree, AZ::Vector3(0.0f, 0.0f, 10.0f), AZ::Vector3::CreateAxisZ()).empty());
+    }
+
+    TEST_F(EditorSelectionBoundsTreeFixture, UpdatedEntitiesAreFoundAtTheirNewBounds)
+    {
+        AzToolsFramework::EditorSelectionBoundsTree tree;
+        const AZ::EntityId entityId(1);
+        const AZ::Vector3 down = -AZ::Vector3::CreateAxisZ();
+
+        tree.InsertOrUpdate(entityId, AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3(0.5f)));
+        tree.InsertOrUpdate(AZ::EntityId(2), AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3(-50.0f, 0.0f, 0.0f), AZ::Vector3(0.5f)));
+
+        // move the entity far enough to leave its enlarged bounds
+        tree.InsertOrUpdate(entityId, AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3(50.0f, 0.0f, 0.0f), AZ::Vector3(0.5f)));
+
+        EXPECT_TRUE(EntitiesAlongRay(tree, AZ::Vector3(0.0f, 0.0f, 10.0f), down).empty());
+        EXPECT_EQ(EntitiesAlongRay(tree, AZ::Vector3(50.0f, 0.0f, 10.0f), down), AZStd::vector<AZ::EntityId>{ entityId });
+        EXPECT_EQ(tree.Size(), 2);
+    }
+
+    TEST_F(EditorSelectionBoundsTreeFixture, RemovedAndInvalidEntitiesAreNotFound)
+    {
+        AzToolsFramework::EditorSelectionBoundsTree tree;
+        const AZ::Vector3 rayOrigin(0.0f, 0.0f, 10.0f);
+        const AZ::Vector3 down = -AZ::Vector3::CreateAxisZ();
+
+        tree.InsertOrUpdate(AZ::EntityId(1), AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3(0.5f)));
+        tree.InsertOrUpdate(AZ::EntityId(2), AZ::Aabb::CreateCenterHalfExtents(AZ::Vector3::CreateZero(), AZ::Vector3(1.0f)));
+        tree.InsertOrUpdate(AZ::EntityId(3), AZ::Aabb::CreateNull());
+
+        EXPECT_EQ(EntitiesAlongRay(tree, rayOrigin, down).size(), 2);
+        EXPECT_FALSE(tree.Contains(AZ::EntityId(3)));
+
+        tree.Remove(AZ::EntityId(1));
+        EXPECT_EQ(EntitiesAlongRay(tree, rayOrigin, down), AZStd::vector<AZ::EntityId>{ AZ::EntityId(2) });
+
+        // an entity whose bounds become invalid is removed
+        tree.InsertOrUpdate(AZ::EntityId(2), AZ::Aabb::CreateNull());
+        EXPECT_TRUE(EntitiesAlongRay(tree, rayOrigin, down).empty());
+        EXPECT_EQ(tree.Size(), 0);
+    }
+} // namespace UnitTest
@@ -152,6 +152,7 @@ set(FILES
     Prefab/Spawnable/SpawnableTestFixture.h
     Prefab/Spawnable/SpawnableTestFixture.cpp
     Prefab/Spawnable/SpawnableTicketTests.cpp
+    Prefab/SpawnableAssetPlatformComponentRemoverTests.cpp
     Prefab/SpawnableCreateTests.cpp
     Prefab/SpawnableRemoveEditorInfoTestFixture.cpp
     Prefab/SpawnableRemoveEditorInfoTestFixture.h
@@ -193,6 +194,7 @@ set(FILES
     UI/AssetBrowserTests.cpp
     UndoStack.cpp
     Viewport/ClusterTests.cpp
+    Viewport/EditorSelectionBoundsTreeTests.cpp
     Viewport/ViewportEditorModeTests.cpp
     Viewport/ViewportScreenTests.cpp
     Viewport/ViewportUiClusterTests.cpp
@@ -340,6 +340,7 @@ namespace AssetBundler
             OutputBundlePathArg,
             BundleVersionArg,
             MaxBundleSizeArg,
+            AccessOrderFileArg,
             PlatformArg,
             PrintFlag,
             VerboseFlag,
@@ -352,6 +353,7 @@ namespace AssetBundler
             OutputBundlePathArg,
             BundleVersionArg,
             MaxBundleSizeArg,
+            AccessOrderFileArg,
             PlatformArg,
             AllowOverwritesFlag,
             VerboseFlag,
@@ -1102,6 +1104,17 @@ namespace AssetBundler
             params.m_maxBundleSizeInMB = AZStd::stoi(parser->GetSwitchValue(MaxBundleSizeArg, 0));
         }
 
+        // Read in Access Order File arg
+        argOutcome = GetFilePathArg(parser, AccessOrderFileArg, BundleSettingsCommand);
+        if (!argOutcome.IsSuccess())
+        {
+            return AZ::Failure(argOutcome.GetError());
+        }
+        if (!argOutcome.GetValue().empty())
+        {
+            params.m_accessOrderFile = FilePath(argOutcome.GetValue());
+        }
+
         // Read in Print flag
         params.m_print = parser->HasSwitch(PrintFlag);
 
@@ -1216,6 +1229,13 @@ namespace AssetBundler
             return AZ::Failure(platformOutcome.GetError());
         }
 
+        // Read in Access Order File arg, the same trace is used for all Bundles
+        auto accessOrderFileOutcome = GetFilePathArg(parser, AccessOrderFileArg, commandName);
+        if (!accessOrderFileOutcome.IsSuccess())
+        {
+            return AZ::Failure(accessOrderFileOutcome.GetError());
+        }
+
         // Read in Allow Overwrites flag
         bool allowOverwrites = parser->HasSwitch(AllowOverwritesFlag);
         BundlesParamsList bundleParamsList;
@@ -1236,6 +1256,11 @@ namespace AssetBundler
                 bundleParams.m_maxBundleSizeInMB = maxBundleListSize == 1 ? AZStd::stoi(maxBundleSizeList[0]) : AZStd::stoi(maxBundleSizeList[idx]);
             }
 
+            if (!accessOrderFileOutcome.GetValue().empty())
+            {
+                bundleParams.m_accessOrderFile = FilePath(accessOrderFileOutcome.GetValue());
+            }
+
             bundleParams.m_platformFlags = platformOutcome.GetValue();
             bundleParams.m_allowOverwrites = allowOverwrites;
             bundleParamsList.emplace_back(bundleParams);
@@ -2098,6 +2123,22 @@ namespace AssetBundler
                 bundleSettings.m_maxBundleSizeInMB = params.m_maxBundleSizeInMB;
             }
 
+            // Access Order File
+            AZStd::string accessOrderFilePath = params.m_accessOrderFile.AbsolutePath();
+            if (!accessOrderFilePath.empty())
+            {
+                if (!AZ::IO::FileIOBase::GetInstance()->Exists(accessOrderFilePath.c_str()))
+                {
+                    AZ_Error(AppWindowName, false, "Cannot set Access Order file to ( %s ): file does not exist.", accessOrderFilePath.c_str());
+                    return false;
+                }
+
+                // Make the path relative to the engine root folder before saving
+                AZ::StringFunc::Replace(accessOrderFilePath, GetEngineRoot(), "");
+
+                bundleSettings.m_accessOrderFilePath = accessOrderFilePath;
+            }
+
             // Print
             if (params.m_print)
             {
@@ -2106,7 +2147,8 @@ namespace AssetBundler
                 AZ_TracePrintf(AssetBundler::AppWindowName, "    Asset List file: %s\n", bundleSettings.m_assetFileInfoListPath.c_str());
                 AZ_TracePrintf(AssetBundler::AppWindowName, "    Output Bundle path: %s\n", bundleSettings.m_bundleFilePath.c_str());
                 AZ_TracePrintf(AssetBundler::AppWindowName, "    Bundle Version: %i\n", bundleSettings.m_bundleVersion);
-                AZ_TracePrintf(AssetBundler::AppWindowName, "    Max Bundle Size: %u MB\n\n", bundleSettings.m_maxBundleSizeInMB);
+                AZ_TracePrintf(AssetBundler::AppWindowName, "    Max Bundle Size: %u MB\n", bundleSettings.m_maxBundleSizeInMB);
+                AZ_TracePrintf(AssetBundler::AppWindowName, "    Access Order file: %s\n\n", bundleSettings.m_accessOrderFilePath.c_str());
             }
 
             // Save
@@ -2225,6 +2267,11 @@ namespace AssetBundler
                     return;
                 }
 
+                if (!params.m_accessOrderFile.AbsolutePath().empty())
+                {
+                    bundleSettings.first.m_accessOrderFilePath = params.m_accessOrderFile.AbsolutePath();
+                }
+
                 FilePath bundleFilePath(bundleSettings.first.m_bundleFilePath);
 
                 // Check if we are performing a destructive overwrite that the user did not approve 
@@ -2842,6 +2889,7 @@ namespace AssetBundler
         AZ_Printf(AppWindowName, "    --%-25s-Determines which version of Open 3D Engine Bundles to generate. Current version is (%i).\n", BundleVersionArg, AzFramework::AssetBundleManifest::CurrentBundleVersion);
         AZ_Printf(AppWindowName, "    --%-25s-Sets the maximum size for a single Bundle (in MB). Default size is (%i MB).\n", MaxBundleSizeArg, AssetBundleSettings::GetMaxBundleSizeInMB());
         AZ_Printf(AppWindowName, "%-31s---Bundles larger than this limit will be divided into a series of smaller Bundles and named accordingly.\n", "");
+        AZ_Printf(AppWindowName, "    --%-25s-Sets a Streamer trace recorded while playing. Bundled files are ordered by when they were first read in it.\n", AccessOrderFileArg);
         AZ_Printf(AppWindowName, "    --%-25s-Specifies the platform(s) referenced by all Bundle Settings operations.\n", PlatformArg);
         AZ_Printf(AppWindowName, "%-31s---Defaults to all enabled platforms. Platforms can be changed by modifying AssetProcessorPlatformConfig.setreg.\n", "");
         AZ_Printf(AppWindowName, "    --%-25s-Outputs the contents of the Bundle Settings file after modifying any specified values.\n", PrintFlag);
@@ -2859,6 +2907,7 @@ namespace AssetBundler
         AZ_Printf(AppWindowName, "    --%-25s-Determines which versions of Open 3D Engine Bundles to generate. Current version is (%i).\n", BundleVersionArg, AzFramework::AssetBundleManifest::CurrentBundleVersion);
         AZ_Printf(AppWindowName, "    --%-25s-Sets the maximum size for Bundles (in MB). Default size is (%i MB).\n", MaxBundleSizeArg, AssetBundleSettings::GetMaxBundleSizeInMB());
         AZ_Printf(AppWindowName, "%-31s---Bundles larger than this limit will be divided into a series of smaller Bundles and named accordingly.\n", "");
+        AZ_Printf(AppWindowName, "    --%-25s-Sets a Streamer trace recorded while playing. Bundled files are ordered by when they were first read in it.\n", AccessOrderFileArg);
         AZ_Printf(AppWindowName, "    --%-25s-Specifies the platform(s) that will be referenced when generating Bundles.\n", PlatformArg);
         AZ_Printf(AppWindowName, "%-31s---If no platforms are specified, Bundles will be generated for all available platforms.\n", "");
         AZ_Printf(AppWindowName, "    --%-25s-Allow destructive overwrites of files. Include this arg in automation.\n", AllowOverwritesFlag);
@@ -121,6 +121,7 @@ namespace AssetBundler
         FilePath m_bundleSettingsFile;
         FilePath m_assetListFile;
         FilePath m_outputBundlePath;
+        FilePath m_accessOrderFile;
 
         int m_bundleVersion = -1;
         int m_maxBundleSizeInMB = -1;
@@ -137,6 +138,7 @@ namespace AssetBundler
         FilePath m_bundleSettingsFile;
         FilePath m_assetListFile;
         FilePath m_outputBundlePath;
+        FilePath m_accessOrderFile;
 
         int m_bundleVersion = -1;
         int m_maxBundleSizeInMB = -1;
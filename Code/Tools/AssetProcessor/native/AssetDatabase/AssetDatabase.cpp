@@ -3426,6 +3426,34 @@ namespace AssetProcessor
         return m_databaseConnection->GetNumAffectedRows() > 0;
     }
 
+    bool AssetDatabaseConnection::UpdateFileModTimesAndHashes(const FileDatabaseEntryContainer& entries)
+    {
+        // Skip creating and committing a scoped transaction, if the entry list is empty.
+        if (entries.empty())
+        {
+            return true;
+        }
+        ScopedTransaction transaction(m_databaseConnection);
+
+        bool allUpdated = true;
+        for (const auto& entry : entries)
+        {
+            if (!s_UpdateFileModtimeByFileNameScanFolderIdQuery.BindAndStep(*m_databaseConnection, entry.m_modTime, entry.m_hash, entry.m_fileName.c_str(), entry.m_scanFolderPK))
+            {
+                return false;
+            }
+
+            if (m_databaseConnection->GetNumAffectedRows() <= 0)
+            {
+                AZ_Warning(LOG_NAME, false, "Failed to update the modtime of file %s, which is not in the database.", entry.m_fileName.c_str());
+                allUpdated = false;
+            }
+        }
+
+        transaction.Commit();
+        return allUpdated;
+    }
+
     bool AssetDatabaseConnection::UpdateFileHashByFileNameAndScanFolderId(QString fileName, AZ::s64 scanFolderId, AZ::u64 hash)
     {
         if (!s_UpdateFileHashByFileNameScanFolderIdQuery.BindAndStep(
@@ -232,6 +232,9 @@ namespace AssetProcessor
 
         // updates the modtime and hash for a file if it exists.  Only returns true if the row existed and was successfully updated
         bool UpdateFileModTimeAndHashByFileNameAndScanFolderId(QString fileName, AZ::s64 scanFolderId, AZ::u64 modTime, AZ::u64 hash);
+        // bulk version of UpdateFileModTimeAndHashByFileNameAndScanFolderId, which updates all the entries in a single transaction
+        // instead of committing each of them separately.  Only returns true if all the rows existed and were successfully updated
+        bool UpdateFileModTimesAndHashes(const AzToolsFramework::AssetDatabase::FileDatabaseEntryContainer& entries);
         bool UpdateFileHashByFileNameAndScanFolderId(QString fileName, AZ::s64 scanFolderId, AZ::u64 hash);
         bool RemoveFile(AZ::s64 sourceID);
 
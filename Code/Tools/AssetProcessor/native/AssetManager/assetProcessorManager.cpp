@@ -3532,6 +3532,10 @@ namespace AssetProcessor
 
         AssetProcessor::StatsCapture::BeginCaptureStat("InitialFileAssessment");
 
+        // the modtimes of the skipped files are written in a single transaction after the loop, since committing each of them
+        // separately dominates the assessment time of large projects.
+        AzToolsFramework::AssetDatabase::FileDatabaseEntryContainer modTimeUpdates;
+
         for (const AssetFileInfo& fileInfo : filePaths)
         {
             if (m_allowModtimeSkippingFeature)
@@ -3547,12 +3551,11 @@ namespace AssetProcessor
                         m_platformConfig->ConvertToRelativePath(fileInfo.m_filePath, fileInfo.m_scanFolder, databaseName);
 
                         // Update the modtime in the db since its possible that the hash is the same, but the modtime is out of date.  Recording the current modtime will allow us to skip hashing the file in the future if no changes are made
-                        bool updated = m_stateData->UpdateFileModTimeAndHashByFileNameAndScanFolderId(databaseName, fileInfo.m_scanFolder->ScanFolderID(), AssetUtilities::AdjustTimestamp(fileInfo.m_modTime), fileHash);
-
-                        if(!updated)
-                        {
-                            AZ_Error(AssetProcessor::ConsoleChannel, false, "Failed to update modtime for file %s during file scan", fileInfo.m_filePath.toUtf8().constData());
-                        }
+                        AzToolsFramework::AssetDatabase::FileDatabaseEntry& modTimeUpdate = modTimeUpdates.emplace_back();
+                        modTimeUpdate.m_scanFolderPK = fileInfo.m_scanFolder->ScanFolderID();
+                        modTimeUpdate.m_fileName = databaseName.toUtf8().constData();
+                        modTimeUpdate.m_modTime = AssetUtilities::AdjustTimestamp(fileInfo.m_modTime);
+                        modTimeUpdate.m_hash = fileHash;
                     }
 
                     continue;
@@ -3563,6 +3566,11 @@ namespace AssetProcessor
             AssessFileInternal(fileInfo.m_filePath, false, true);
         }
 
+        if (!m_stateData->UpdateFileModTimesAndHashes(modTimeUpdates))
+        {
+            AZ_Error(AssetProcessor::ConsoleChannel, false, "Failed to update the modtimes of some of the files during file scan");
+        }
+
         if (m_allowModtimeSkippingFeature)
         {
             AZ_TracePrintf(AssetProcessor::DebugChannel, "%d files reported from scanner.  %d unchanged files skipped, %d files processed\n", filePaths.size(), filePaths.size() - processedFileCount, processedFileCount);
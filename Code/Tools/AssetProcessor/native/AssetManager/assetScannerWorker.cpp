@@ -10,6 +10,9 @@
 #include "native/utilities/PlatformConfiguration.h"
 #include <QDir>
 #include <QtConcurrent/QtConcurrentFilter>
+#include <QtConcurrent/QtConcurrentRun>
+#include <QFuture>
+#include <QVector>
 
 using namespace AssetProcessor;
 
@@ -35,10 +38,30 @@ void AssetScannerWorker::StartScan()
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Started);
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::InProgress);
 
-    for (int idx = 0; idx < m_platformConfiguration->GetScanFolderCount(); idx++)
+    // The scan folders are independent of each other, so they are walked in parallel, which keeps several directory
+    // reads in flight at once on large projects. The results are merged in scan folder order afterwards, so the
+    // found files are the same as when the scan folders are walked one after another.
+    const int scanFolderCount = m_platformConfiguration->GetScanFolderCount();
+    QVector<ScanResult> scanResults(scanFolderCount);
+    QVector<QFuture<void>> scanFutures;
+    scanFutures.reserve(scanFolderCount);
+    for (int idx = 0; idx < scanFolderCount; idx++)
     {
         const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
-        ScanForSourceFiles(scanFolderInfo, scanFolderInfo);
+        ScanResult& scanResult = scanResults[idx];
+        scanFutures.push_back(QtConcurrent::run([this, &scanFolderInfo, &scanResult]()
+            {
+                ScanForSourceFiles(scanFolderInfo, scanFolderInfo, scanResult);
+            }));
+    }
+
+    for (int idx = 0; idx < scanFolderCount; idx++)
+    {
+        scanFutures[idx].waitForFinished();
+
+        m_fileList.unite(scanResults[idx].m_fileList);
+        m_folderList.unite(scanResults[idx].m_folderList);
+        m_excludedList.unite(scanResults[idx].m_excludedList);
     }
 
     // we want not to emit any signals until we're finished scanning
@@ -72,7 +95,7 @@ void AssetScannerWorker::StopScan()
     m_doScan = false;
 }
 
-void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder)
+void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder, ScanResult& result) const
 {
     if (!m_doScan)
     {
@@ -135,13 +158,13 @@ void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo
 
                 if (m_platformConfiguration->IsFileExcludedRelPath(relPath))
                 {
-                    m_excludedList.insert(AZStd::move(assetFileInfo));
+                    result.m_excludedList.insert(AZStd::move(assetFileInfo));
                     continue;
                 }
 
                 // Entry is a directory
                 // The AP needs to know about all directories so it knows when a delete occurs if the path refers to a folder or a file
-                m_folderList.insert(AZStd::move(assetFileInfo));
+                result.m_folderList.insert(AZStd::move(assetFileInfo));
 
                 // recurse into this folder.
                 // Since we only care about source files, we can skip cache folders that are not the Intermediate Assets Folder.
@@ -173,11 +196,11 @@ void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo
                 {
                     if (!m_platformConfiguration->IsFileExcludedRelPath(relPath))
                     {
-                        m_fileList.insert(AZStd::move(assetFileInfo));
+                        result.m_fileList.insert(AZStd::move(assetFileInfo));
                     }
                     else
                     {
-                        m_excludedList.insert(AZStd::move(assetFileInfo));
+                        result.m_excludedList.insert(AZStd::move(assetFileInfo));
                     }
                 }
             }
@@ -43,9 +43,18 @@ Q_SIGNALS:
         void StopScan();
 
     protected:
+        //! The files and folders found in a single scan folder.
+        struct ScanResult
+        {
+            QSet<AssetFileInfo> m_fileList;
+            QSet<AssetFileInfo> m_folderList;
+            QSet<AssetFileInfo> m_excludedList;
+        };
+
         // scanFolderInfo - the folder we're currently scanning (this will sometimes be a fake scanfolder created when recursing through directories)
         // rootScanFolder - the actual scan folder we started with, which will either be the same as scanFolderInfo or a parent folder
-        void ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder);
+        // This is called from multiple threads at once, one for each scan folder, so it only writes to the given result.
+        void ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder, ScanResult& result) const;
         void EmitFiles();
 
     private:
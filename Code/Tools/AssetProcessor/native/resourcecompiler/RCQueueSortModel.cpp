@@ -252,6 +252,13 @@ namespace AssetProcessor
             return leftJobEscalation > rightJobEscalation;
         }
 
+        // On a build farm sharing the asset cache server, run the jobs assigned to this node first, so that the results of the
+        // jobs of the other nodes are likely to be on the server by the time this node gets to them.
+        if (leftJob->IsAssignedToThisNode() != rightJob->IsAssignedToThisNode())
+        {
+            return leftJob->IsAssignedToThisNode();
+        }
+
         // arbitrarily, lets have PC get done first since pc-format assets are what the editor uses.
         if (!platformsMatch)
         {
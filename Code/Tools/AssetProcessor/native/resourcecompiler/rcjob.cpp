@@ -21,6 +21,7 @@
 
 #include <qstorageinfo.h>
 #include <native/utilities/ProductOutputUtil.h>
+#include <native/utilities/StatsCapture.h>
 
 namespace
 {
@@ -99,6 +100,13 @@ namespace AssetProcessor
     {
         m_jobDetails = AZStd::move(details);
         m_queueElementID = QueueElementID(GetJobEntry().m_sourceAssetReference, GetPlatformInfo().m_identifier.c_str(), GetJobKey());
+
+        m_assignedToThisNode = true;
+        if (m_jobDetails.m_checkServer)
+        {
+            AssetServerBus::BroadcastResult(m_assignedToThisNode, &AssetServerBus::Events::IsJobAssignedToThisNode,
+                GetJobEntry().m_sourceAssetReference.RelativePath().AsPosix(), GetJobKey().toUtf8().constData(), GetPlatformInfo().m_identifier);
+        }
     }
 
     const JobEntry& RCJob::GetJobEntry() const
@@ -268,6 +276,11 @@ namespace AssetProcessor
         return m_jobDetails.m_autoFail;
     }
 
+    bool RCJob::IsAssignedToThisNode() const
+    {
+        return m_assignedToThisNode;
+    }
+
     int RCJob::GetPriority() const
     {
         return m_jobDetails.m_priority;
@@ -531,7 +544,33 @@ namespace AssetProcessor
                                  builderParams.m_processJobRequest.m_platformInfo.m_identifier.c_str())
                             .arg(builderParams.m_rcJob->GetOriginalFingerprint());
                         bool operationResult = false;
-                        if (assetServerMode == AssetServerMode::Server)
+                        if (assetServerMode == AssetServerMode::Server && !builderParams.m_rcJob->IsAssignedToThisNode())
+                        {
+                            // the job belongs to another build farm node, which may have already stored it on the server
+                            AssetProcessor::AssetServerBus::BroadcastResult(operationResult, &AssetProcessor::AssetServerBusTraits::RetrieveJobResult, builderParams);
+                            if (operationResult)
+                            {
+                                operationResult = AfterRetrievingJobResult(builderParams, jobLogTraceListener, result);
+                            }
+
+                            AssetProcessor::StatsCapture::CountStat(operationResult ? "AssetCacheServerHit" : "AssetCacheServerMiss");
+                            if (operationResult)
+                            {
+                                for (auto& product : result.m_outputProducts)
+                                {
+                                    product.m_outputFlags |= AssetBuilderSDK::ProductOutputFlags::CachedAsset;
+                                }
+                                runProcessJob = false;
+                            }
+                            else
+                            {
+                                AZ_TracePrintf(AssetProcessor::DebugChannel, "Job (%s, %s, %s) with fingerprint (%u) is not on the server yet. Processing on this node.\n",
+                                    builderParams.m_rcJob->GetJobEntry().m_sourceAssetReference.AbsolutePath().c_str(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
+                                    builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), builderParams.m_rcJob->GetOriginalFingerprint());
+                            }
+                        }
+
+                        if (assetServerMode == AssetServerMode::Server && runProcessJob)
                         {
                             // sending process job command to the builder
                             builderParams.m_assetBuilderDesc.m_processJobFunction(builderParams.m_processJobRequest, result);
@@ -580,6 +619,7 @@ namespace AssetProcessor
                                     builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), builderParams.m_rcJob->GetOriginalFingerprint());
                             }
 
+                            AssetProcessor::StatsCapture::CountStat(operationResult ? "AssetCacheServerHit" : "AssetCacheServerMiss");
                             if (operationResult)
                             {
                                 for (auto& product : result.m_outputProducts)
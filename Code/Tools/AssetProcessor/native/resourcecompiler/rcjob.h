@@ -249,6 +249,8 @@ namespace AssetProcessor
         AZ::Uuid GetBuilderGuid() const;
         bool IsCritical() const;
         bool IsAutoFail() const;
+        //! Returns false if the job is assigned to another node of a build farm sharing the asset cache server.
+        bool IsAssignedToThisNode() const;
         int GetPriority() const;
         const AZStd::vector<JobDependencyInternal>& GetJobDependencies();
 
@@ -276,6 +278,8 @@ namespace AssetProcessor
         AssetBuilderSDK::ProcessJobResponse m_processJobResponse;
 
         AZ::u32 m_scanFolderID;
+
+        bool m_assignedToThisNode = true;
     };
 } // namespace AssetProcessor
 
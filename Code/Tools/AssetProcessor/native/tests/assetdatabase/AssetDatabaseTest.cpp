@@ -2220,6 +2220,40 @@ namespace UnitTests
         EXPECT_EQ(m_errorAbsorber->m_numAssertsAbsorbed, 0); // not allowed to assert on this
     }
 
+    TEST_F(AssetDatabaseTest, UpdateFileModTimesAndHashes_ExistingFiles_Succeeds)
+    {
+        CreateCoverageTestData();
+
+        FileDatabaseEntryContainer files;
+        for (const char* fileName : { "testfile1.txt", "testfile2.txt" })
+        {
+            FileDatabaseEntry& entry = files.emplace_back();
+            entry.m_fileName = fileName;
+            entry.m_scanFolderPK = m_data->m_scanFolder.m_scanFolderID;
+        }
+        ASSERT_TRUE(m_data->m_connection.InsertFiles(files));
+
+        files[0].m_modTime = 1234;
+        files[0].m_hash = 1111;
+        files[1].m_modTime = 5678;
+        files[1].m_hash = 2222;
+        ASSERT_TRUE(m_data->m_connection.UpdateFileModTimesAndHashes(files));
+
+        FileDatabaseEntry result;
+        ASSERT_TRUE(m_data->m_connection.GetFileByFileNameAndScanFolderId("testfile2.txt", m_data->m_scanFolder.m_scanFolderID, result));
+        EXPECT_EQ(result.m_modTime, 5678);
+        EXPECT_EQ(result.m_hash, 2222);
+
+        // a file that is not in the database fails the update, but does not prevent the other files from being updated
+        files[0].m_fileName = "non_existent.txt";
+        files[1].m_modTime = 9999;
+        EXPECT_FALSE(m_data->m_connection.UpdateFileModTimesAndHashes(files));
+        ASSERT_TRUE(m_data->m_connection.GetFileByFileNameAndScanFolderId("testfile2.txt", m_data->m_scanFolder.m_scanFolderID, result));
+        EXPECT_EQ(result.m_modTime, 9999);
+
+        EXPECT_EQ(m_errorAbsorber->m_numAssertsAbsorbed, 0); // not allowed to assert on this
+    }
+
     TEST_F(AssetDatabaseTest, GetSourceBySourceName_InvalidInput_SourceNotFound)
     {
         CreateCoverageTestData();
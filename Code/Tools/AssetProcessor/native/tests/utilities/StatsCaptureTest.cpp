@@ -216,6 +216,44 @@ namespace AssetProcessor
         EXPECT_TRUE(foundFoo2) << "The expected CreateJobs.foo2.mybuilder2 did not appear in the output";
     }
 
+    // Counted stats, like the asset cache server hits and misses, are dumped with their count.
+    TEST_F(StatsCaptureOutputTest, StatsCaptureTest_CountStat_DumpsCount)
+    {
+        auto registry = AZ::SettingsRegistry::Get();
+        ASSERT_NE(registry, nullptr);
+        registry->Set("/Amazon/AssetProcessor/Settings/Stats/HumanReadable", false);
+        registry->Set("/Amazon/AssetProcessor/Settings/Stats/MachineReadable", true);
+        AssetProcessor::StatsCapture::CountStat("AssetCacheServerHit");
+        AssetProcessor::StatsCapture::CountStat("AssetCacheServerHit");
+        AssetProcessor::StatsCapture::CountStat("AssetCacheServerMiss");
+
+        Dump();
+
+        bool foundHit = false;
+        bool foundMiss = false;
+        for (const auto& stat : m_gatheredMessages)
+        {
+            if (stat.contains("MachineReadableStat:"))
+            {
+                AZStd::vector<AZStd::string> tokens;
+                AZ::StringFunc::Tokenize(stat, tokens, ":", false, false);
+                ASSERT_EQ(tokens.size(), 5);
+                if (AZ::StringFunc::Equal(tokens[4], "AssetCacheServerHit"))
+                {
+                    foundHit = true;
+                    EXPECT_STREQ(tokens[2].c_str(), "2");
+                }
+                else if (AZ::StringFunc::Equal(tokens[4], "AssetCacheServerMiss"))
+                {
+                    foundMiss = true;
+                    EXPECT_STREQ(tokens[2].c_str(), "1");
+                }
+            }
+        }
+        EXPECT_TRUE(foundHit);
+        EXPECT_TRUE(foundMiss);
+    }
+
     // If BeginCaptureStat was called for a certain statName, EndCaptureStat returns with a AZStd::optional containing just-measured duration as
     // its value. If BeginCaptureStat was not called for a certain statName, EndCaptureStat returns with a AZStd::optional without a value.
     TEST_F(StatsCaptureOutputTest, StatsCaptureTest_ReturnsLastDuration)
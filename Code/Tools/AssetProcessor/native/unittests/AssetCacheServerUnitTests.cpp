@@ -231,4 +231,39 @@ namespace UnitTest
         EXPECT_EQ(mode, AssetServerMode::Client);
         EXPECT_TRUE(assetServerHandler.RetrieveJobResult(builderParams));
     }
+
+    TEST_F(AssetServerHandlerUnitTest, AssetCacheServer_FarmNodes_AssignEachJobToOneNode)
+    {
+        m_enableServer = true;
+        MockSettingsRegistry();
+
+        AssetProcessor::AssetServerHandler assetServerHandler;
+        EXPECT_EQ(assetServerHandler.GetRemoteCachingMode(), AssetProcessor::AssetServerMode::Server);
+
+        // a single node processes all of the jobs
+        EXPECT_TRUE(assetServerHandler.IsJobAssignedToThisNode("textures/brick.png", "Image Compile", "pc"));
+
+        constexpr AZ::u64 nodeCount = 3;
+        const char* sourceFiles[] = { "textures/brick.png", "materials/brick.material", "levels/town/town.prefab", "scripts/door.lua" };
+        for (const char* sourceFile : sourceFiles)
+        {
+            int numAssignedNodes = 0;
+            for (AZ::u64 nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex)
+            {
+                assetServerHandler.SetFarmNode(nodeIndex, nodeCount);
+                if (assetServerHandler.IsJobAssignedToThisNode(sourceFile, "Job", "pc"))
+                {
+                    ++numAssignedNodes;
+                }
+            }
+            EXPECT_EQ(numAssignedNodes, 1);
+        }
+
+        // clients process every job they cannot retrieve from the server
+        assetServerHandler.SetRemoteCachingMode(AssetProcessor::AssetServerMode::Client);
+        for (const char* sourceFile : sourceFiles)
+        {
+            EXPECT_TRUE(assetServerHandler.IsJobAssignedToThisNode(sourceFile, "Job", "pc"));
+        }
+    }
 }
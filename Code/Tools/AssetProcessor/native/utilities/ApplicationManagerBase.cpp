@@ -1816,7 +1816,9 @@ void ApplicationManagerBase::RegisterBuilderInformation(const AssetBuilderSDK::A
             AssetBuilderSDK::JobCancelListener jobCancelListener(request.m_jobId);
 
             AssetProcessor::BuilderRef builderRef;
-            AssetProcessor::BuilderManagerBus::BroadcastResult(builderRef, &AssetProcessor::BuilderManagerBusTraits::GetBuilder, AssetProcessor::BuilderPurpose::ProcessJob);
+            AssetProcessor::BuilderManagerBus::BroadcastResult(
+                builderRef, &AssetProcessor::BuilderManagerBusTraits::GetBuilderWithAffinity, AssetProcessor::BuilderPurpose::ProcessJob,
+                request.m_builderGuid);
 
             if (builderRef)
             {
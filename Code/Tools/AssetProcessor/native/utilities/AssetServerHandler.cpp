@@ -11,6 +11,7 @@
 #include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzToolsFramework/Archive/ArchiveAPI.h>
 #include <AzCore/JSON/pointer.h>
+#include <AzCore/Math/Crc.h>
 #include <QDir>
 
 namespace AssetProcessor
@@ -85,6 +86,18 @@ namespace AssetProcessor
         return {};
     }
 
+    void CheckFarmNode(AZ::u64& nodeIndex, AZ::u64& nodeCount)
+    {
+        auto settingsRegistry = AZ::SettingsRegistry::Get();
+        if (settingsRegistry)
+        {
+            AZ::SettingsRegistryInterface::FixedValueString key(AssetProcessor::AssetProcessorServerKey);
+            key += "/";
+            settingsRegistry->Get(nodeCount, key + FarmNodeCountKey);
+            settingsRegistry->Get(nodeIndex, key + FarmNodeIndexKey);
+        }
+    }
+
     QString AssetServerHandler::ComputeArchiveFilePath(const AssetProcessor::BuilderParams& builderParams)
     {
         QFileInfo fileInfo(builderParams.m_processJobRequest.m_sourceFile.c_str());
@@ -134,6 +147,12 @@ namespace AssetProcessor
     {
         SetRemoteCachingMode(CheckServerMode());
         SetServerAddress(CheckServerAddress());
+
+        AZ::u64 farmNodeIndex = 0;
+        AZ::u64 farmNodeCount = 1;
+        CheckFarmNode(farmNodeIndex, farmNodeCount);
+        SetFarmNode(farmNodeIndex, farmNodeCount);
+
         AssetServerBus::Handler::BusConnect();
     }
 
@@ -249,6 +268,38 @@ namespace AssetProcessor
         return true;
     }
 
+    bool AssetServerHandler::IsJobAssignedToThisNode(AZStd::string_view sourceRelativePath, AZStd::string_view jobKey, AZStd::string_view platform) const
+    {
+        if (m_assetCachingMode != AssetServerMode::Server || m_farmNodeCount <= 1)
+        {
+            return true;
+        }
+
+        AZ::Crc32 jobHash(sourceRelativePath);
+        jobHash.Add(jobKey);
+        jobHash.Add(platform);
+        return (static_cast<AZ::u32>(jobHash) % m_farmNodeCount) == m_farmNodeIndex;
+    }
+
+    void AssetServerHandler::SetFarmNode(AZ::u64 nodeIndex, AZ::u64 nodeCount)
+    {
+        if (nodeCount == 0 || nodeIndex >= nodeCount)
+        {
+            AZ_Error(AssetProcessor::DebugChannel, false,
+                "Build farm node index (%llu) is invalid for (%llu) nodes! Processing all jobs on this node.",
+                static_cast<unsigned long long>(nodeIndex), static_cast<unsigned long long>(nodeCount));
+            nodeIndex = 0;
+            nodeCount = 1;
+        }
+        else if (nodeCount > 1)
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Build farm node %llu of %llu\n",
+                static_cast<unsigned long long>(nodeIndex + 1), static_cast<unsigned long long>(nodeCount));
+        }
+        m_farmNodeIndex = nodeIndex;
+        m_farmNodeCount = nodeCount;
+    }
+
     bool AssetServerHandler::RetrieveJobResult(const AssetProcessor::BuilderParams& builderParams)
     {
         AssetBuilderSDK::JobCancelListener jobCancelListener(builderParams.m_rcJob->GetJobEntry().m_jobRunKey);
@@ -15,6 +15,8 @@ namespace AssetProcessor
 {
     inline constexpr const char* AssetCacheServerModeKey{ "assetCacheServerMode" };
     inline constexpr const char* CacheServerAddressKey{ "cacheServerAddress" };
+    inline constexpr const char* FarmNodeCountKey{ "farmNodeCount" };
+    inline constexpr const char* FarmNodeIndexKey{ "farmNodeIndex" };
 
     //! AssetServerHandler is implementing asset server using network share.
     class AssetServerHandler
@@ -44,6 +46,11 @@ namespace AssetProcessor
         const AZStd::string& GetServerAddress() const override;
         //! Store the remote folder location for the shared cache 
         bool SetServerAddress(const AZStd::string& address) override;
+        //! Jobs are assigned to the farm nodes by a hash of the source path, job key and platform, so that every node
+        //! computes the same assignment without talking to the other nodes.
+        bool IsJobAssignedToThisNode(AZStd::string_view sourceRelativePath, AZStd::string_view jobKey, AZStd::string_view platform) const override;
+        //! Store the number of build farm nodes sharing the cache in server mode, and the index of this node
+        void SetFarmNode(AZ::u64 nodeIndex, AZ::u64 nodeCount);
     protected:
         //! Source files intended to be copied into the cache don't go through out temp folder so they need
         //! to be added to the Archive in an additional step
@@ -53,5 +60,7 @@ namespace AssetProcessor
     private:
         AssetServerMode m_assetCachingMode = AssetServerMode::Inactive;
         AZStd::string m_serverAddress;
+        AZ::u64 m_farmNodeIndex = 0;
+        AZ::u64 m_farmNodeCount = 1;
     };
 } //namespace AssetProcessor
@@ -257,6 +257,10 @@ namespace AssetProcessor
         virtual const AZStd::string& GetServerAddress() const = 0;
         //! Store the remote folder location for the shared cache 
         virtual bool SetServerAddress(const AZStd::string& address) = 0;
+        //! When several build farm nodes share the cache in server mode, each job is assigned to one of the nodes.
+        //! Nodes process their own jobs first and retrieve the results of the other jobs from the shared cache.
+        //! This will return true if the job should be processed by this node.
+        virtual bool IsJobAssignedToThisNode(AZStd::string_view sourceRelativePath, AZStd::string_view jobKey, AZStd::string_view platform) const = 0;
     };
     using AssetServerBus = AZ::EBus<AssetServerBusTraits>;
 
@@ -121,6 +121,9 @@ namespace AssetProcessor
         //! Indicates if the builder is currently in use
         bool m_busy = false;
 
+        //! The asset builder of the last job handed to this process, whose state is likely still loaded in the process
+        AZ::Uuid m_lastAssetBuilderId = AZ::Uuid::CreateNull();
+
         AZStd::atomic<AZ::u32> m_connectionId = 0;
 
         //! Signals the exe has successfully established a connection
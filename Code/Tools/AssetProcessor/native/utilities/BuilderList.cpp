@@ -42,7 +42,7 @@ namespace AssetProcessor
         return itr != m_builders.end() ? itr->second : nullptr;
     }
 
-    BuilderRef BuilderList::GetFirst(BuilderPurpose purpose)
+    BuilderRef BuilderList::GetFirst(BuilderPurpose purpose, const AZ::Uuid& assetBuilderId)
     {
         if (purpose == BuilderPurpose::CreateJobs)
         {
@@ -72,6 +72,7 @@ namespace AssetProcessor
             return {};
         }
 
+        AZStd::shared_ptr<Builder> firstIdleBuilder;
         for (auto itr = m_builders.begin(); itr != m_builders.end();)
         {
             auto& builder = itr->second;
@@ -82,7 +83,19 @@ namespace AssetProcessor
 
                 if (builder->IsValid())
                 {
-                    return BuilderRef(builder);
+                    if (assetBuilderId.IsNull() || builder->m_lastAssetBuilderId == assetBuilderId)
+                    {
+                        builder->m_lastAssetBuilderId = assetBuilderId;
+                        return BuilderRef(builder);
+                    }
+
+                    // keep looking for a builder that already has the state of the asset builder loaded
+                    if (!firstIdleBuilder)
+                    {
+                        firstIdleBuilder = builder;
+                    }
+                    ++itr;
+                    continue;
                 }
 
                 itr = m_builders.erase(itr);
@@ -93,6 +106,12 @@ namespace AssetProcessor
             }
         }
 
+        if (firstIdleBuilder)
+        {
+            firstIdleBuilder->m_lastAssetBuilderId = assetBuilderId;
+            return BuilderRef(firstIdleBuilder);
+        }
+
         return {};
     }
 
@@ -21,7 +21,8 @@ namespace AssetProcessor
 
         void AddBuilder(AZStd::shared_ptr<Builder> builder, BuilderPurpose purpose);
         AZStd::shared_ptr<Builder> Find(AZ::Uuid uuid);
-        BuilderRef GetFirst(BuilderPurpose purpose);
+        //! Returns an idle builder, preferring one that last ran a job of the given asset builder if the id is not null
+        BuilderRef GetFirst(BuilderPurpose purpose, const AZ::Uuid& assetBuilderId = AZ::Uuid::CreateNull());
         AZStd::string RemoveByConnectionId(AZ::u32 connId);
         void RemoveByUuid(AZ::Uuid uuid);
         void PumpIdleBuilders();
@@ -154,6 +154,11 @@ namespace AssetProcessor
     }
 
     BuilderRef BuilderManager::GetBuilder(BuilderPurpose purpose)
+    {
+        return GetBuilderWithAffinity(purpose, AZ::Uuid::CreateNull());
+    }
+
+    BuilderRef BuilderManager::GetBuilderWithAffinity(BuilderPurpose purpose, const AZ::Uuid& assetBuilderId)
     {
         AZStd::shared_ptr<Builder> newBuilder;
         BuilderRef builderRef;
@@ -169,7 +174,7 @@ namespace AssetProcessor
 
             if (purpose != BuilderPurpose::Registration)
             {
-                auto builder = m_builderList.GetFirst(purpose);
+                auto builder = m_builderList.GetFirst(purpose, assetBuilderId);
 
                 if (builder)
                 {
@@ -181,6 +186,7 @@ namespace AssetProcessor
 
             // None found, start up a new one
             newBuilder = AddNewBuilder(purpose);
+            newBuilder->m_lastAssetBuilderId = assetBuilderId;
 
             // Grab a reference so no one else can take it while we're outside the lock
             builderRef = BuilderRef(newBuilder);
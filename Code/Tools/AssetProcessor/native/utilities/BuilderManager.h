@@ -38,6 +38,14 @@ namespace AssetProcessor
         //! Returns a builder for doing work
         virtual BuilderRef GetBuilder(BuilderPurpose purpose) = 0;
 
+        //! Returns a builder for processing a job of the given asset builder.  Builder processes keep the state that
+        //! asset builders load (compilers, SceneAPI, serialize contexts) between jobs, so a process that already ran a job
+        //! of the same asset builder is preferred over any other idle process.
+        virtual BuilderRef GetBuilderWithAffinity(BuilderPurpose purpose, const AZ::Uuid& /*assetBuilderId*/)
+        {
+            return GetBuilder(purpose);
+        }
+
         virtual void AddAssetToBuilderProcessedList(const AZ::Uuid& /*builderId*/, const AZStd::string& /*sourceAsset*/)
         {
         }
@@ -66,6 +74,7 @@ namespace AssetProcessor
 
         //BuilderManagerBus
         BuilderRef GetBuilder(BuilderPurpose purpose) override;
+        BuilderRef GetBuilderWithAffinity(BuilderPurpose purpose, const AZ::Uuid& assetBuilderId) override;
         void AddAssetToBuilderProcessedList(const AZ::Uuid& builderId, const AZStd::string& sourceAsset) override;
 
     protected:
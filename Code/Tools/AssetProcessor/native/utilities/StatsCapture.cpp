@@ -19,6 +19,8 @@
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/StringFunc/StringFunc.h>
 
 #include <inttypes.h>
@@ -38,6 +40,7 @@ namespace AssetProcessor
             StatsCaptureImpl();
             void BeginCaptureStat(AZStd::string_view statName);
             AZStd::optional<AZStd::sys_time_t> EndCaptureStat(AZStd::string_view statName, bool persistToDb);
+            void CountStat(AZStd::string_view statName);
             void Dump();
         private:
             using timepoint = AZStd::chrono::steady_clock::time_point;
@@ -51,6 +54,8 @@ namespace AssetProcessor
 
             AssetDatabaseConnection m_dbConnection;
             AZStd::unordered_map<AZStd::string, StatsEntry> m_stats;
+            AZStd::unordered_map<AZStd::string, int64_t> m_counts; // Stats without a duration, which are counted from any thread.
+            AZStd::mutex m_countsMutex;
             bool m_dumpMachineReadableStats = false;
             bool m_dumpHumanReadableStats = true;
             bool m_dbConnectionIsOpen = false;
@@ -132,6 +137,20 @@ namespace AssetProcessor
                 }
             }
 
+            // Prints out a single stat that has no duration.
+            void PrintCount([[maybe_unused]] const char* name, int64_t count)
+            {
+                if (m_dumpHumanReadableStats)
+                {
+                    AZ_TracePrintf(AssetProcessor::ConsoleChannel, "    Count: %4" PRId64 ", EventName: %s\n", count, name);
+                }
+                if (m_dumpMachineReadableStats)
+                {
+                    // same format as PrintStat, with no time
+                    AZ_TracePrintf(AssetProcessor::ConsoleChannel, "MachineReadableStat:0:%" PRId64 ":0:%s\n", count, name);
+                }
+            }
+
             // calls PrintStat on each element in the vector.
             void PrintStatsArray(AZStd::vector<AZStd::string>& keys, int maxToPrint, const char* header)
             {
@@ -218,6 +237,17 @@ namespace AssetProcessor
             return operationDurationInMillisecond;
         }
 
+        void StatsCaptureImpl::CountStat(AZStd::string_view statName)
+        {
+            if (!m_dbConnectionIsOpen)
+            {
+                return;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_countsMutex);
+            ++m_counts[statName];
+        }
+
         void StatsCaptureImpl::Dump()
         {
             if (!m_dbConnectionIsOpen)
@@ -382,6 +412,24 @@ namespace AssetProcessor
                 PrintStatsArray(allProcessJobsByJobKey, maxCumulativeStats, "cumulative time spent in ProcessJob by JobKey");
                 PrintStatsArray(allProcessJobsByPlatform, maxCumulativeStats, "cumulative time spent in ProcessJob by Platform");
             }
+
+            // asset cache server stats
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_countsMutex);
+                const int64_t cacheHits = m_counts["AssetCacheServerHit"];
+                const int64_t cacheMisses = m_counts["AssetCacheServerMiss"];
+                if (cacheHits + cacheMisses > 0)
+                {
+                    PrintCount("AssetCacheServerHit", cacheHits);
+                    PrintCount("AssetCacheServerMiss", cacheMisses);
+                    if (m_dumpHumanReadableStats)
+                    {
+                        AZ_TracePrintf(AssetProcessor::ConsoleChannel, "    Asset cache server hit rate: %.1f%%\n",
+                            100.0 * static_cast<double>(cacheHits) / static_cast<double>(cacheHits + cacheMisses));
+                    }
+                }
+            }
+
             duration costToGenerateStats = AZStd::chrono::duration_cast<duration>(AZStd::chrono::steady_clock::now() - startTimeStamp);
             PrintStat("ComputeStatsTime", costToGenerateStats, 1);
         }
@@ -433,6 +481,15 @@ namespace AssetProcessor
             return AZStd::optional<AZStd::sys_time_t>();
         }
 
+        //! Count one occurrence of a stat that has no duration.
+        void CountStat(AZStd::string_view statName)
+        {
+            if (g_instance)
+            {
+                g_instance->CountStat(statName);
+            }
+        }
+
         //! Do additional processing and then write the cumulative stats to log.
         //! Note that since this is an AP-specific system, the analysis done in the dump function
         //! is going to make a lot of assumptions about the way the data is encoded.
@@ -33,6 +33,10 @@ namespace AssetProcessor
         //! or if BeginCaptureStat was not called before, no duration is returned.
         AZStd::optional<AZStd::sys_time_t> EndCaptureStat(AZStd::string_view statName, bool persistToDb = false);
 
+        //! Count one occurrence of a stat that has no duration, like a hit in the asset cache server.
+        //! Unlike the other functions, this can be called from the job threads.
+        void CountStat(AZStd::string_view statName);
+
         //! Do additional processing and then write the cumulative stats to log.
         //! Note that since this is an AP-specific system, the analysis done in the dump function
         //! is going to make a lot of assumptions about the way the data is encoded.
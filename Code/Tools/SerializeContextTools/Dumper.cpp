@@ -9,6 +9,8 @@
 #include <Dumper.h> // Moved to the top because AssetSerializer requires include for the SerializeContext
 #include <AzCore/Asset/AssetSerializer.h>
 #include <AzCore/Casting/lossy_cast.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Debug/Trace.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/GenericStreams.h>
@@ -17,6 +19,7 @@
 #include <AzCore/JSON/stringbuffer.h>
 #include <AzCore/JSON/pointer.h>
 #include <AzCore/JSON/prettywriter.h>
+#include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/JsonSerializationSettings.h>
@@ -442,6 +445,62 @@ namespace AZ::SerializeContextTools
         return result;
     }
 
+    bool Dumper::DumpReflectionHints(Application& application)
+    {
+        AZ::IO::FixedMaxPath outputPath;
+        AZ::CommandLine& commandLine = *application.GetAzCommandLine();
+        if (size_t optionCount = commandLine.GetNumSwitchValues("output-file"); optionCount > 0)
+        {
+            AZ::IO::PathView outputPathView(commandLine.GetSwitchValue("output-file", optionCount - 1));
+            if (outputPathView.IsRelative())
+            {
+                AZ::Utils::ConvertToAbsolutePath(outputPath, outputPathView.Native());
+            }
+            else
+            {
+                outputPath = outputPathView.LexicallyNormal();
+            }
+        }
+        else
+        {
+            // By default the hints are written to the Registry folder of the project, so every application merges them on startup
+            outputPath = AZ::IO::FixedMaxPath(AZ::Utils::GetProjectPath()) / "Registry" / "reflection_capacity_hints.setreg";
+        }
+
+        size_t serializeClassCount = 0;
+        application.GetSerializeContext()->EnumerateAll(
+            [&serializeClassCount](const SerializeContext::ClassData*, const Uuid&) -> bool
+            {
+                ++serializeClassCount;
+                return true;
+            });
+        const AZ::BehaviorContext* behaviorContext = application.GetBehaviorContext();
+        const size_t behaviorClassCount = behaviorContext->m_classes.size();
+        const size_t behaviorEBusCount = behaviorContext->m_ebuses.size();
+
+        rapidjson::Document document;
+        document.SetObject();
+        auto AddHint = [&document](AZStd::string_view key, size_t count)
+        {
+            rapidjson::Pointer(key.data(), key.size()).Set(document, aznumeric_cast<uint64_t>(count));
+        };
+        AddHint(ReflectionCapacityHints::SerializeContextClassCountKey, serializeClassCount);
+        AddHint(ReflectionCapacityHints::BehaviorContextClassCountKey, behaviorClassCount);
+        AddHint(ReflectionCapacityHints::BehaviorContextEBusCountKey, behaviorEBusCount);
+
+        constexpr AZ::IO::OpenMode openMode = AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeCreatePath;
+        AZ::IO::SystemFileStream outputStream(outputPath.c_str(), openMode);
+        if (!outputStream.IsOpen())
+        {
+            AZ_Printf("dumpreflectionhints", R"(Unable to open output file "%s".)" "\n", outputPath.c_str());
+            return false;
+        }
+
+        AZ_Printf("dumpreflectionhints", R"(Writing the counts of %zu serialized classes, %zu behavior classes and %zu EBuses to "%s".)" "\n",
+            serializeClassCount, behaviorClassCount, behaviorEBusCount, outputPath.c_str());
+        return WriteDocumentToStream(outputStream, document, {});
+    }
+
     bool Dumper::CreateType(Application& application)
     {
         // outputStream defaults to writing to stdout
@@ -31,6 +31,7 @@ namespace AZ::SerializeContextTools
         static bool DumpSerializeContext(Application& application);
 
         static bool DumpTypes(Application& application);
+        static bool DumpReflectionHints(Application& application);
         static bool CreateType(Application& application);
         static bool CreateUuid(Application& application);
 
@@ -48,6 +48,12 @@ namespace SerializeContextTools
         AZ_Printf("Help", R"(    example: 'dumptypes --sort=typeid)" "\n");
         AZ_Printf("Help", R"(    example: 'dumptypes --output-file=reflectedtypes.txt)" "\n");
         AZ_Printf("Help", "\n");
+        AZ_Printf("Help", "  'dumpreflectionhints': Write the number of reflected types to a .setreg file, which applications use\n");
+        AZ_Printf("Help", "          to reserve room in the Serialize and Behavior Context before the modules reflect.\n");
+        AZ_Printf("Help", "    [opt] --output-file=<filepath>: Path to the .setreg file to write.\n");
+        AZ_Printf("Help", "          If not specified, <project>/Registry/reflection_capacity_hints.setreg is written.\n");
+        AZ_Printf("Help", R"(    example: 'dumpreflectionhints')" "\n");
+        AZ_Printf("Help", "\n");
         AZ_Printf("Help", "  'convert': Converts a file with an ObjectStream to the new JSON formats.\n");
         AZ_Printf("Help", "    [arg] -files=<path>: <comma or semicolon>-separated list of files to verify. Supports wildcards.\n");
         AZ_Printf("Help", "    [arg] -ext=<string>: Extension to use for the new file.\n");
@@ -167,6 +173,10 @@ namespace SerializeContextTools
             {
                 result = Dumper::DumpTypes(application);
             }
+            else if (AZ::StringFunc::Equal("dumpreflectionhints", action))
+            {
+                result = Dumper::DumpReflectionHints(application);
+            }
             else if (AZ::StringFunc::Equal("convert", action))
             {
                 result = Converter::ConvertObjectStreamFiles(application);
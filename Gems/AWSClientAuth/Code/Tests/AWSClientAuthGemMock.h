@@ -229,6 +229,12 @@ namespace AWSClientAuthUnitTest
             AZ_UNUSED(callback);
         }
 
+        void AddRequestBatch(AZStd::vector<HttpRequestor::Parameters>&& requests, const HttpRequestor::BatchCallback& callback) override
+        {
+            AZ_UNUSED(requests);
+            AZ_UNUSED(callback);
+        }
+
         AZStd::chrono::milliseconds GetLastRoundTripTime() const override
         {
             return {};
@@ -13,11 +13,28 @@
 #include <AzCore/JSON/schema.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #include <sstream>
 
 namespace AWSMetrics
 {
+    //! The metrics event schema is compiled once and shared by the validators of all threads, it's immutable after construction.
+    static const rapidjson::SchemaDocument* GetMetricsEventJsonSchema()
+    {
+        static const AZStd::unique_ptr<rapidjson::SchemaDocument> jsonSchema = []() -> AZStd::unique_ptr<rapidjson::SchemaDocument>
+        {
+            rapidjson::Document jsonSchemaDocument;
+            if (jsonSchemaDocument.Parse(AwsMetricsEventJsonSchema).HasParseError())
+            {
+                AZ_Error("AWSMetrics", false, "Invalid metrics event json schema.");
+                return nullptr;
+            }
+            return AZStd::make_unique<rapidjson::SchemaDocument>(jsonSchemaDocument);
+        }();
+        return jsonSchema.get();
+    }
+
     void MetricsEvent::AddAttribute(const MetricsAttribute& attribute)
     {
         AZStd::string attributeName = attribute.GetName();
@@ -72,7 +89,7 @@ namespace AWSMetrics
         bool ok = true;
         ok = ok && writer.StartObject();
 
-        AZStd::vector<MetricsAttribute> customAttributes;
+        bool hasCustomAttributes = false;
         for (const auto& attr : m_attributes)
         {
             if (attr.IsDefault())
@@ -82,19 +99,23 @@ namespace AWSMetrics
             }
             else
             {
-                customAttributes.emplace_back(attr);
+                hasCustomAttributes = true;
             }
         }
 
-        if (customAttributes.size() > 0)
+        if (hasCustomAttributes)
         {
-            // Wrap up the cutom event attributes in a separate event_data field
+            // Wrap up the cutom event attributes in a separate event_data field.
+            // Write them in a second pass instead of copying them, this runs for every event of every request.
             ok = ok && writer.Key(AwsMetricsAttributeKeyEventData);
             ok = ok && writer.StartObject();
-            for (const auto& attr : customAttributes)
+            for (const auto& attr : m_attributes)
             {
-                ok = ok && writer.Key(attr.GetName().c_str());
-                ok = ok && attr.SerializeToJson(writer);
+                if (!attr.IsDefault())
+                {
+                    ok = ok && writer.Key(attr.GetName().c_str());
+                    ok = ok && attr.SerializeToJson(writer);
+                }
             }
             ok = ok && writer.EndObject();
         }
@@ -151,23 +172,24 @@ namespace AWSMetrics
             return false;
         }
 
-        auto result = AZ::JsonSerializationUtils::ReadJsonString(stringStream.str().c_str());
-        if (!result.IsSuccess())
+        const rapidjson::SchemaDocument* jsonSchema = GetMetricsEventJsonSchema();
+        if (!jsonSchema)
         {
             return false;
         }
 
-        rapidjson::Document jsonSchemaDocument;
-        if (jsonSchemaDocument.Parse(AwsMetricsEventJsonSchema).HasParseError())
+        // This runs on the thread submitting the event, so feed the serialized event straight to the validator
+        // instead of parsing it into a document first.
+        rapidjson::SchemaValidator validator(*jsonSchema);
+        const std::string serializedEvent = stringStream.str();
+        rapidjson::StringStream serializedEventStream(serializedEvent.c_str());
+        rapidjson::Reader reader;
+        if (!reader.Parse(serializedEventStream, validator) && validator.IsValid())
         {
-            AZ_Error("AWSMetrics", false, "Invalid metrics event json schema.");
             return false;
         }
 
-        auto jsonSchema = rapidjson::SchemaDocument(jsonSchemaDocument);
-        rapidjson::SchemaValidator validator(jsonSchema);
-
-        if (!result.GetValue().Accept(validator))
+        if (!validator.IsValid())
         {
             rapidjson::StringBuffer error;
             validator.GetInvalidSchemaPointer().StringifyUriFragment(error);
@@ -15,6 +15,7 @@
 #include <MetricsEventBuilder.h>
 #include <MetricsManager.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Math/MathUtils.h>
@@ -22,6 +23,10 @@
 
 namespace AWSMetrics
 {
+    AZ_CVAR(float, aws_metricsMaxInFlightSizeInMb, 16.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The maximum size of the metrics events being sent at once. Past it, buffered metrics are held back until requests complete"
+        " and only the highest priority events are kept once the queue grows past twice its maximum size. 0 disables the limit.");
+
     MetricsManager::MetricsManager()
         : m_clientConfiguration(AZStd::make_unique<ClientConfiguration>())
         , m_clientIdProvider(IdentityProvider::CreateIdentityProvider())
@@ -69,7 +74,12 @@ namespace AWSMetrics
             // The thread will wake up either when the metrics event queue is full (try_acquire_for call returns true),
             // or the flush period limit is hit (try_acquire_for call returns false).
             m_waitEvent.try_acquire_for(AZStd::chrono::seconds(m_clientConfiguration->GetQueueFlushPeriodInSeconds()));
-            FlushMetricsAsync();
+
+            // Hold the buffered metrics back while too many are in flight, the monitor is woken up again once enough requests completed
+            if (!IsInFlightLimitReached(m_inFlightSizeInBytes))
+            {
+                FlushMetricsAsync();
+            }
         }
     }
 
@@ -108,8 +118,15 @@ namespace AWSMetrics
 
         if (m_metricsQueue.GetSizeInBytes() >= static_cast<size_t>(m_clientConfiguration->GetMaxQueueSizeInBytes()))
         {
-            // Flush the metrics queue when the accumulated metrics size hits the limit
-            m_waitEvent.release();
+            if (IsInFlightLimitReached(m_inFlightSizeInBytes))
+            {
+                ApplyBackpressure();
+            }
+            else
+            {
+                // Flush the metrics queue when the accumulated metrics size hits the limit
+                m_waitEvent.release();
+            }
         }
 
         return true;
@@ -161,13 +178,16 @@ namespace AWSMetrics
     void MetricsManager::SendMetricsToLocalFileAsync(AZStd::shared_ptr<MetricsQueue> metricsQueue)
     {
         int requestId = ++m_sendMetricsId;
+        const size_t requestSizeInBytes = metricsQueue->GetSizeInBytes();
+        m_inFlightSizeInBytes += requestSizeInBytes;
 
         // Send metrics to a local file
         AZ::Job* job{nullptr};
         job = AZ::CreateJobFunction(
-            [this, metricsQueue, requestId]()
+            [this, metricsQueue, requestId, requestSizeInBytes]()
             {
                 AZ::Outcome<void, AZStd::string> outcome = SendMetricsToFile(metricsQueue);
+                OnRequestCompleted(requestSizeInBytes);
 
                 if (outcome.IsSuccess())
                 {
@@ -208,10 +228,13 @@ namespace AWSMetrics
     void MetricsManager::SendMetricsToServiceApiAsync(const MetricsQueue& metricsQueue)
     {
         int requestId = ++m_sendMetricsId;
+        const size_t requestSizeInBytes = metricsQueue.GetSizeInBytes();
+        m_inFlightSizeInBytes += requestSizeInBytes;
 
         ServiceAPI::PostMetricsEventsRequestJob* requestJob = ServiceAPI::PostMetricsEventsRequestJob::Create(
-            [this, requestId](ServiceAPI::PostMetricsEventsRequestJob* successJob)
+            [this, requestId, requestSizeInBytes](ServiceAPI::PostMetricsEventsRequestJob* successJob)
             {
+                OnRequestCompleted(requestSizeInBytes);
                 OnResponseReceived(successJob->parameters.m_metricsQueue, successJob->result.m_responseEntries);
 
                 AZ::TickBus::QueueFunction([requestId]()
@@ -219,8 +242,9 @@ namespace AWSMetrics
                     AWSMetricsNotificationBus::Broadcast(&AWSMetricsNotifications::OnSendMetricsSuccess, requestId);
                 });
             },
-            [this, requestId](ServiceAPI::PostMetricsEventsRequestJob* failedJob)
+            [this, requestId, requestSizeInBytes](ServiceAPI::PostMetricsEventsRequestJob* failedJob)
             {
+                OnRequestCompleted(requestSizeInBytes);
                 OnResponseReceived(failedJob->parameters.m_metricsQueue);
 
                 AZStd::string errorMessage = failedJob->error.message;
@@ -300,6 +324,40 @@ namespace AWSMetrics
         m_globalStats.m_numDropped += m_metricsQueue.FilterMetricsByPriority(m_clientConfiguration->GetMaxQueueSizeInBytes());
     }
 
+    void MetricsManager::OnRequestCompleted(size_t sizeInBytes)
+    {
+        // Requests can complete concurrently, so the sizes before and after this one completed have to come from the same update
+        // for exactly one of them to see the size dropping below the limit.
+        size_t previousSizeInBytes = m_inFlightSizeInBytes.load();
+        while (!m_inFlightSizeInBytes.compare_exchange_weak(previousSizeInBytes, previousSizeInBytes - sizeInBytes))
+        {
+        }
+
+        if (IsInFlightLimitReached(previousSizeInBytes) && !IsInFlightLimitReached(previousSizeInBytes - sizeInBytes))
+        {
+            // Send the metrics that were held back while the limit was reached without waiting for the next flush period
+            m_waitEvent.release();
+        }
+    }
+
+    bool MetricsManager::IsInFlightLimitReached(size_t inFlightSizeInBytes) const
+    {
+        static constexpr float MbToBytes = 1000000.0f;
+        const float maxInFlightSizeInMb = aws_metricsMaxInFlightSizeInMb;
+        return maxInFlightSizeInMb > 0.0f && inFlightSizeInBytes >= static_cast<size_t>(maxInFlightSizeInMb * MbToBytes);
+    }
+
+    void MetricsManager::ApplyBackpressure()
+    {
+        // Filtering sorts the queue, so let it grow to twice its maximum size before filtering it back down
+        // instead of filtering on every submission.
+        const size_t maxQueueSizeInBytes = static_cast<size_t>(m_clientConfiguration->GetMaxQueueSizeInBytes());
+        if (m_metricsQueue.GetSizeInBytes() >= maxQueueSizeInBytes * 2)
+        {
+            m_globalStats.m_numDropped += m_metricsQueue.FilterMetricsByPriority(maxQueueSizeInBytes);
+        }
+    }
+
     AZ::Outcome<void, AZStd::string> MetricsManager::SendMetricsToFile(AZStd::shared_ptr<MetricsQueue> metricsQueue)
     {
         AZStd::lock_guard<AZStd::mutex> lock(m_metricsFileMutex);
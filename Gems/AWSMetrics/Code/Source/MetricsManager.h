@@ -64,6 +64,8 @@ namespace AWSMetrics
         void OnResponseReceived(const MetricsQueue& metricsEventsInRequest, const ServiceAPI::PostMetricsEventsResponseEntries& responseEntries = ServiceAPI::PostMetricsEventsResponseEntries());
 
         //! Implementation for flush all metrics buffered in memory.
+        //! Explicit flushes always send the buffered metrics. Only the flushes of the metrics queue monitor are deferred
+        //! while the size of the metrics being sent exceeds aws_metricsMaxInFlightSizeInMb.
         void FlushMetricsAsync();
 
         //! Get the total number of metrics buffered in the metrics queue.
@@ -121,6 +123,18 @@ namespace AWSMetrics
         //! @param metricsEventsForRetry Metrics events for retry.
         void PushMetricsForRetry(MetricsQueue& metricsEventsForRetry);
 
+        //! Account for a request that completed, and wake the monitor if flushing was deferred because of it.
+        //! @param sizeInBytes Size of the metrics events in the request.
+        void OnRequestCompleted(size_t sizeInBytes);
+
+        //! Whether the given size of the metrics events in flight has reached aws_metricsMaxInFlightSizeInMb.
+        //! @param inFlightSizeInBytes Size of the metrics events sent but not completed yet.
+        bool IsInFlightLimitReached(size_t inFlightSizeInBytes) const;
+
+        //! Keep only the highest priority metrics events once the queue has grown well over its maximum size while flushing is deferred.
+        //! The metrics mutex needs to be locked by the caller.
+        void ApplyBackpressure();
+
         void SubmitLocalMetricsAsync();
 
         AZStd::mutex m_metricsMutex; //!< Mutex to protect the metrics queue
@@ -129,6 +143,7 @@ namespace AWSMetrics
         AZStd::mutex m_metricsFileMutex; //!< Mutex to protect the local metrics file
 
         AZStd::atomic<int> m_sendMetricsId;//!< Request ID for sending metrics
+        AZStd::atomic<size_t> m_inFlightSizeInBytes{ 0 }; //!< Size of the metrics events sent but not completed yet
 
         AZStd::thread m_monitorThread; //!< Thread to monitor and consume the metrics queue
         AZStd::atomic<bool> m_monitorTerminated;
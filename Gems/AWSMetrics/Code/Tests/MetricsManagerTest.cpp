@@ -13,6 +13,7 @@
 #include <MetricsEvent.h>
 #include <MetricsManager.h>
 
+#include <AzCore/Console/Console.h>
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzFramework/StringFunc/StringFunc.h>
@@ -78,9 +79,14 @@ namespace AWSMetrics
     class MetricsManagerMock
         : public MetricsManager
     {
+    public:
+        //! Lock to keep the requests to the local file in flight until it's unlocked.
+        AZStd::mutex m_sendMutex;
+
     private:
         AZ::Outcome<void, AZStd::string> SendMetricsToFile(AZStd::shared_ptr<MetricsQueue> metricsQueue) override
         {
+            AZStd::lock_guard<AZStd::mutex> lock(m_sendMutex);
             if (AZ::IO::FileIOBase::GetInstance())
             {
                 return AZ::Success();
@@ -555,6 +561,131 @@ namespace AWSMetrics
         ASSERT_EQ(m_metricsManager->GetNumBufferedMetrics(), 0);
     }
 
+    class MetricsManagerInFlightLimitTest
+        : public MetricsManagerTest
+    {
+    public:
+        void SetUp() override
+        {
+            MetricsManagerTest::SetUp();
+
+            m_console = aznew AZ::Console();
+            AZ::Interface<AZ::IConsole>::Register(m_console);
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+
+            // A single request of a test metrics event reaches the in flight limit, and two events fill the queue.
+            const AZStd::string command = AZStd::string::format("aws_metricsMaxInFlightSizeInMb %f", (double)TestMetricsEventSizeInBytes / MbToBytes);
+            m_console->PerformCommand(command.c_str());
+            ResetClientConfig(true, (double)TestMetricsEventSizeInBytes * 2 / MbToBytes, DefaultFlushPeriodInSeconds, 0);
+        }
+
+        void TearDown() override
+        {
+            m_console->PerformCommand("aws_metricsMaxInFlightSizeInMb 16");
+            AZ::Interface<AZ::IConsole>::Unregister(m_console);
+            delete m_console;
+
+            MetricsManagerTest::TearDown();
+        }
+
+        bool SubmitTestMetrics(int eventPriority = 0)
+        {
+            AZStd::vector<MetricsAttribute> metricsAttributes;
+            metricsAttributes.emplace_back(AZStd::move(MetricsAttribute(AwsMetricsAttributeKeyEventName, AttrValue)));
+
+            bool result = false;
+            AWSMetricsRequestBus::BroadcastResult(result, &AWSMetricsRequests::SubmitMetrics, metricsAttributes, eventPriority, "", true);
+            return result;
+        }
+
+        //! Wait for either timeout or the monitor to flush the metrics queue down to the expected number of metrics events.
+        void WaitForNumBufferedMetrics(AZ::s64 expectedNumBufferedMetrics)
+        {
+            for (int processingTime = 0; processingTime < TimeoutForProcessingInMs; processingTime += SleepTimeForProcessingInMs)
+            {
+                if (m_metricsManager->GetNumBufferedMetrics() == expectedNumBufferedMetrics)
+                {
+                    break;
+                }
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(SleepTimeForProcessingInMs));
+            }
+        }
+
+        AZ::Console* m_console = nullptr;
+    };
+
+    TEST_F(MetricsManagerInFlightLimitTest, SubmitMetrics_InFlightLimitReached_FlushDeferredUntilRequestCompletes)
+    {
+        m_metricsManager->StartMetrics();
+        AZStd::unique_lock<AZStd::mutex> sendLock(m_metricsManager->m_sendMutex);
+
+        // The full queue is flushed and the request stays in flight until the send lock is released.
+        ASSERT_TRUE(SubmitTestMetrics());
+        ASSERT_TRUE(SubmitTestMetrics());
+        WaitForNumBufferedMetrics(0);
+        ASSERT_EQ(m_metricsManager->GetNumBufferedMetrics(), 0);
+
+        // The next full queue is held back, even once the flush period has passed.
+        ASSERT_TRUE(SubmitTestMetrics());
+        ASSERT_TRUE(SubmitTestMetrics());
+        AZStd::this_thread::sleep_for(AZStd::chrono::seconds(DefaultFlushPeriodInSeconds * 2));
+        EXPECT_EQ(m_metricsManager->GetNumBufferedMetrics(), 2);
+
+        // Completing the request in flight sends the metrics that were held back.
+        sendLock.unlock();
+        WaitForProcessing(4);
+        EXPECT_EQ(m_notifications.m_numSuccessNotification, 2);
+        EXPECT_EQ(m_notifications.m_numFailureNotification, 0);
+        EXPECT_EQ(m_metricsManager->GetNumBufferedMetrics(), 0);
+
+        m_metricsManager->ShutdownMetrics();
+    }
+
+    TEST_F(MetricsManagerInFlightLimitTest, SubmitMetrics_InFlightLimitReachedAndQueueSizeDoubled_DropLowPriorityMetrics)
+    {
+        m_metricsManager->StartMetrics();
+        AZStd::unique_lock<AZStd::mutex> sendLock(m_metricsManager->m_sendMutex);
+
+        ASSERT_TRUE(SubmitTestMetrics());
+        ASSERT_TRUE(SubmitTestMetrics());
+        WaitForNumBufferedMetrics(0);
+        ASSERT_EQ(m_metricsManager->GetNumBufferedMetrics(), 0);
+
+        // Once the held back metrics reach twice the max queue size, only the highest priority ones are kept.
+        ASSERT_TRUE(SubmitTestMetrics(1));
+        ASSERT_TRUE(SubmitTestMetrics(0));
+        ASSERT_TRUE(SubmitTestMetrics(1));
+        EXPECT_EQ(m_metricsManager->GetNumBufferedMetrics(), 3);
+        ASSERT_TRUE(SubmitTestMetrics(0));
+        EXPECT_EQ(m_metricsManager->GetNumBufferedMetrics(), 2);
+        EXPECT_EQ(m_metricsManager->GetGlobalStatistics().m_numDropped, 2);
+
+        sendLock.unlock();
+        WaitForProcessing(4);
+        EXPECT_EQ(m_metricsManager->GetNumBufferedMetrics(), 0);
+
+        m_metricsManager->ShutdownMetrics();
+    }
+
+    TEST_F(MetricsManagerInFlightLimitTest, FlushMetrics_InFlightLimitReached_Success)
+    {
+        AZStd::unique_lock<AZStd::mutex> sendLock(m_metricsManager->m_sendMutex);
+
+        ASSERT_TRUE(SubmitTestMetrics());
+        AWSMetricsRequestBus::Broadcast(&AWSMetricsRequests::FlushMetrics);
+        ASSERT_EQ(m_metricsManager->GetNumBufferedMetrics(), 0);
+
+        // Explicit flushes aren't held back by the request in flight.
+        ASSERT_TRUE(SubmitTestMetrics());
+        AWSMetricsRequestBus::Broadcast(&AWSMetricsRequests::FlushMetrics);
+        EXPECT_EQ(m_metricsManager->GetNumBufferedMetrics(), 0);
+
+        sendLock.unlock();
+        WaitForProcessing(2);
+        EXPECT_EQ(m_notifications.m_numSuccessNotification, 2);
+        EXPECT_EQ(m_notifications.m_numFailureNotification, 0);
+    }
+
     class ClientConfigurationTest
         : public AWSMetricsGemAllocatorFixture
     {
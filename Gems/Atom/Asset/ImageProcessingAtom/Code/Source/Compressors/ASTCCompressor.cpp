@@ -224,8 +224,9 @@ namespace ImageProcessingAtom
                 {
                     completionJob = aznew AZ::JobCompletion();
                 }
-                // Create jobs for each compression thread
-                for (AZ::u32 threadIdx = 0; threadIdx < threadCount; threadIdx++)
+                // Create jobs for each compression thread, except for the first one which is run by the calling thread.
+                // Each thread index has its own working memory in the context, so no index can be used by two threads at once.
+                for (AZ::u32 threadIdx = 1; threadIdx < threadCount; threadIdx++)
                 {
                     const auto jobLambda = [&status, context, &image, &swizzle, dstMem, dataSize, threadIdx]()
                     {
@@ -249,14 +250,14 @@ namespace ImageProcessingAtom
                         simulationJob->SetDependent(completionJob);
                         simulationJob->Start();
                     }
+                }
 
-                    astcenc_error error = astcenc_compress_image(context, &image, &swizzle, dstMem, dataSize, threadIdx);
-                    if (error != ASTCENC_SUCCESS)
-                    {
-                        status = error;
-                    }
+                astcenc_error error = astcenc_compress_image(context, &image, &swizzle, dstMem, dataSize, 0);
+                if (error != ASTCENC_SUCCESS)
+                {
+                    status = error;
                 }
-                
+
                 if (currentJob)
                 {
                     currentJob->WaitForChildren();
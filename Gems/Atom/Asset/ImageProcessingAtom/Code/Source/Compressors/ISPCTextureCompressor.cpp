@@ -7,6 +7,9 @@
  */
 
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/function/function_template.h>
 
 #include <Atom/ImageProcessing/ImageObject.h>
@@ -185,66 +188,122 @@ namespace ImageProcessingAtom
         // Allocate the destination image
         IImageObjectPtr destinationImage(sourceImage->AllocateImage(destinationFormat));
 
-        // Compress the images per mip
+        // Get the settings of the destination format once, they are shared by all the bands
+        bc6h_enc_settings bc6Settings = {};
+        bc7_enc_settings bc7Settings = {};
+        switch (destinationFormat)
+        {
+        case ePixelFormat_BC3:
+            break;
+        case ePixelFormat_BC6UH:
+            compressionProfile->GetBC6()(&bc6Settings);
+            break;
+        case ePixelFormat_BC7:
+        case ePixelFormat_BC7t:
+            compressionProfile->GetBC7(discardAlpha)(&bc7Settings);
+            break;
+        default:
+            // No valid pixel format
+            AZ_Assert(false, "Unhandled pixel format %d", destinationFormat);
+            return nullptr;
+        }
+
+        // Split the mips into bands of block rows, which are compressed independently of each other.
+        // A band of a mip is a valid surface on its own, since the blocks of a row only depend on the pixels of that row.
+        struct CompressionBand
+        {
+            rgba_surface m_sourceSurface;
+            AZ::u8* m_destination;
+        };
+        constexpr uint32_t BlockSize = 4;
+        constexpr uint32_t BandPixelRows = 64 * BlockSize;
+        AZStd::vector<CompressionBand> bands;
+
         const uint32 mipCount = destinationImage->GetMipCount();
         for (uint32_t mip = 0; mip < mipCount; mip++)
         {
-            // Create rgba_surface as input
             uint32 sourcePitch = 0;
             AZ::u8* sourceImageData = nullptr;
             sourceImage->GetImagePointer(mip, sourceImageData, sourcePitch);
-            rgba_surface sourceSurface = {};
-            {
-                sourceSurface.ptr = sourceImageData;
-                sourceSurface.width = sourceImage->GetWidth(mip);
-                sourceSurface.height = sourceImage->GetHeight(mip);
-                sourceSurface.stride = static_cast<int32_t>(sourcePitch);
-            }
 
-            // Get the mip image destination pointer
             uint32_t destinationPitch = 0;
             AZ::u8* destinationImageData = nullptr;
             destinationImage->GetImagePointer(mip, destinationImageData, destinationPitch);
 
+            const uint32_t mipWidth = sourceImage->GetWidth(mip);
+            const uint32_t mipHeight = sourceImage->GetHeight(mip);
+            for (uint32_t row = 0; row < mipHeight; row += BandPixelRows)
+            {
+                CompressionBand& band = bands.emplace_back();
+                band.m_sourceSurface.ptr = sourceImageData + row * sourcePitch;
+                band.m_sourceSurface.width = mipWidth;
+                band.m_sourceSurface.height = AZStd::min(BandPixelRows, mipHeight - row);
+                band.m_sourceSurface.stride = static_cast<int32_t>(sourcePitch);
+                band.m_destination = destinationImageData + (row / BlockSize) * destinationPitch;
+            }
+        }
+
+        const auto compressBand = [destinationFormat, &bc6Settings, &bc7Settings](CompressionBand& band)
+        {
             // Compress with the correct function, depending on the destination format
             switch (destinationFormat)
             {
             case ePixelFormat_BC3:
-                CompressBlocksBC3(&sourceSurface, destinationImageData);
+                CompressBlocksBC3(&band.m_sourceSurface, band.m_destination);
                 break;
             case ePixelFormat_BC6UH:
-            {
-                // Get the profile setter
-                bc6h_enc_settings settings = {};
-                const auto setProfile = compressionProfile->GetBC6();
-                setProfile(&settings);
-
                 // Compress with BC6 half precision
-                CompressBlocksBC6H(&sourceSurface, destinationImageData, &settings);
-            }
-            break;
-            case ePixelFormat_BC7:
-            case ePixelFormat_BC7t:
-            {
-                // Get the profile setter
-                bc7_enc_settings settings = {};
-                const auto setProfile = compressionProfile->GetBC7(discardAlpha);
-                setProfile(&settings);
-
+                CompressBlocksBC6H(&band.m_sourceSurface, band.m_destination, &bc6Settings);
+                break;
+            default:
                 // Compress with BC7
-                CompressBlocksBC7(&sourceSurface, destinationImageData, &settings);
+                CompressBlocksBC7(&band.m_sourceSurface, band.m_destination, &bc7Settings);
+                break;
             }
-            break;
-            default:
+        };
+
+        // Compress all the bands of all the mips in parallel, with the calling thread compressing the first band
+        AZ::Job* currentJob = AZ::JobContext::GetGlobalContext()->GetJobManager().GetCurrentJob();
+        AZ::JobCompletion* completionJob = nullptr;
+        if (!currentJob && bands.size() > 1)
+        {
+            completionJob = aznew AZ::JobCompletion();
+        }
+
+        for (size_t bandIndex = 1; bandIndex < bands.size(); ++bandIndex)
+        {
+            CompressionBand& band = bands[bandIndex];
+            AZ::Job* compressionJob = AZ::CreateJobFunction([&compressBand, &band]() { compressBand(band); }, true, nullptr); //auto-deletes
+
+            // adds this job as child to current job if there is a current job
+            // otherwise adds it as a dependent for the complete job
+            if (currentJob)
             {
-                // No valid pixel format
-                AZ_Assert(false, "Unhandled pixel format %d", destinationFormat);
-                return nullptr;
+                currentJob->StartAsChild(compressionJob);
             }
-            break;
+            else
+            {
+                compressionJob->SetDependent(completionJob);
+                compressionJob->Start();
             }
         }
 
+        if (!bands.empty())
+        {
+            compressBand(bands[0]);
+        }
+
+        if (currentJob)
+        {
+            currentJob->WaitForChildren();
+        }
+
+        if (completionJob)
+        {
+            completionJob->StartAndWaitForCompletion();
+            delete completionJob;
+        }
+
         return destinationImage;
     }
 
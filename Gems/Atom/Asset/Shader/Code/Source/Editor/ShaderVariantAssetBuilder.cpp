@@ -47,6 +47,10 @@
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/time.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/Utils/TypeHash.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/StringFunc/StringFunc.h>
 
@@ -67,6 +71,76 @@ namespace AZ
     {
         static constexpr char ShaderVariantAssetBuilderName[] = "ShaderVariantAssetBuilder";
 
+        namespace
+        {
+            //! Shader functions compiled by this builder process, keyed by a hash of everything that is passed to the platform compiler.
+            //! Variants of different shaders often compile identical HLSL (e.g. shaders that share an azsl file and only differ
+            //! in their render states), and the compiled functions are reused instead of running the platform compilers again.
+            class CompiledShaderFunctionCache
+            {
+            public:
+                static CompiledShaderFunctionCache& Get()
+                {
+                    static CompiledShaderFunctionCache s_cache;
+                    return s_cache;
+                }
+
+                static HashValue64 CalculateKey(
+                    const AZStd::string& hlslSource,
+                    const AZStd::string& functionName,
+                    RHI::ShaderHardwareStage shaderStage,
+                    const RHI::ShaderPlatformInterface& shaderPlatformInterface,
+                    const AssetBuilderSDK::PlatformInfo& platformInfo,
+                    const RHI::ShaderBuildArguments& shaderBuildArguments)
+                {
+                    HashValue64 key = TypeHash64(reinterpret_cast<const uint8_t*>(hlslSource.data()), hlslSource.size());
+                    key = TypeHash64(functionName.c_str(), key);
+                    key = TypeHash64(shaderStage, key);
+                    key = TypeHash64(shaderPlatformInterface.GetAPIName().GetCStr(), key);
+                    key = TypeHash64(platformInfo.m_identifier.c_str(), key);
+                    for (const auto* argumentList : { &shaderBuildArguments.m_preprocessorArguments, &shaderBuildArguments.m_azslcArguments,
+                        &shaderBuildArguments.m_dxcArguments, &shaderBuildArguments.m_spirvCrossArguments,
+                        &shaderBuildArguments.m_metalAirArguments, &shaderBuildArguments.m_metalLibArguments })
+                    {
+                        key = TypeHash64(RHI::ShaderBuildArguments::ListAsString(*argumentList).c_str(), key);
+                    }
+                    return key;
+                }
+
+                bool Find(HashValue64 key, RHI::ShaderPlatformInterface::StageDescriptor& descriptor)
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                    auto entry = m_descriptors.find(key);
+                    if (entry == m_descriptors.end())
+                    {
+                        return false;
+                    }
+                    descriptor = entry->second;
+                    return true;
+                }
+
+                void Insert(HashValue64 key, const RHI::ShaderPlatformInterface::StageDescriptor& descriptor)
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                    if (m_descriptors.size() >= MaxEntries)
+                    {
+                        // builder processes are long lived, so keep the memory of the cache bounded
+                        m_descriptors.clear();
+                    }
+                    RHI::ShaderPlatformInterface::StageDescriptor& cachedDescriptor = m_descriptors[key];
+                    cachedDescriptor = descriptor;
+                    // the intermediate files are in the temp folder of the job that compiled the function
+                    cachedDescriptor.m_byProducts.m_intermediatePaths.clear();
+                }
+
+            private:
+                static constexpr size_t MaxEntries = 4096;
+
+                AZStd::mutex m_mutex;
+                AZStd::unordered_map<HashValue64, RHI::ShaderPlatformInterface::StageDescriptor> m_descriptors;
+            };
+        } // namespace
+
 
         AZStd::string ShaderVariantAssetBuilder::GetShaderVariantTreeAssetJobKey()
         {
@@ -869,12 +943,13 @@ namespace AZ
             }
 
             AZStd::string variantShaderSourcePath;
+            AZStd::string variantShaderSourceString;
             // Check if we need to prepend any code prefix
             if (!hlslCodeToPrependForVariant.empty())
             {
                 // Prepend any shader code prefix that we should apply to this variant
                 // and save it back to a file.
-                AZStd::string variantShaderSourceString(hlslCodeToPrependForVariant);
+                variantShaderSourceString = hlslCodeToPrependForVariant;
                 variantShaderSourceString += creationContext.m_hlslSourceContent;
 
                 AZStd::string shaderAssetName = AZStd::string::format(
@@ -893,6 +968,8 @@ namespace AZ
             {
                 variantShaderSourcePath = creationContext.m_hlslSourcePath;
             }
+            const AZStd::string& variantShaderSourceContent =
+                hlslCodeToPrependForVariant.empty() ? creationContext.m_hlslSourceContent : variantShaderSourceString;
 
             AZ_TracePrintf(ShaderVariantAssetBuilderName, "Variant StableId: %u", shaderVariantInfo.m_stableId);
             AZ_TracePrintf(ShaderVariantAssetBuilderName, "Variant Shader Options: %s", optionGroup.ToString().c_str());
@@ -919,15 +996,38 @@ namespace AZ
 
                 auto assetBuilderShaderType = ShaderBuilderUtility::ToAssetBuilderShaderType(shaderStageType);
 
-                // Compile HLSL to the platform specific shader.
+                // Compile HLSL to the platform specific shader, unless this process already compiled the same function.
+                // Debug builds and register analysis need the intermediate files of the compilers in the temp folder of this job.
                 RHI::ShaderPlatformInterface::StageDescriptor descriptor;
-                bool shaderWasCompiled = creationContext.m_shaderPlatformInterface.CompilePlatformInternal(
-                    creationContext.m_platformInfo, variantShaderSourcePath, shaderEntryName, assetBuilderShaderType,
-                    creationContext.m_tempDirPath, descriptor, creationContext.m_shaderBuildArguments);
+                const bool useCompiledFunctionCache =
+                    !creationContext.m_shaderBuildArguments.m_generateDebugInfo && !shaderVariantInfo.m_enableRegisterAnalysis;
+                HashValue64 compiledFunctionKey{ 0 };
+                if (useCompiledFunctionCache)
+                {
+                    compiledFunctionKey = CompiledShaderFunctionCache::CalculateKey(
+                        variantShaderSourceContent, shaderEntryName, assetBuilderShaderType, creationContext.m_shaderPlatformInterface,
+                        creationContext.m_platformInfo, creationContext.m_shaderBuildArguments);
+                }
 
-                if (!shaderWasCompiled)
+                if (useCompiledFunctionCache && CompiledShaderFunctionCache::Get().Find(compiledFunctionKey, descriptor))
                 {
-                    return AZ::Failure(AZStd::string::format("Could not compile the shader function %s", shaderEntryName.c_str()));
+                    AZ_TracePrintf(ShaderVariantAssetBuilderName, "Reusing identical shader function compiled by an earlier variant");
+                }
+                else
+                {
+                    bool shaderWasCompiled = creationContext.m_shaderPlatformInterface.CompilePlatformInternal(
+                        creationContext.m_platformInfo, variantShaderSourcePath, shaderEntryName, assetBuilderShaderType,
+                        creationContext.m_tempDirPath, descriptor, creationContext.m_shaderBuildArguments);
+
+                    if (!shaderWasCompiled)
+                    {
+                        return AZ::Failure(AZStd::string::format("Could not compile the shader function %s", shaderEntryName.c_str()));
+                    }
+
+                    if (useCompiledFunctionCache)
+                    {
+                        CompiledShaderFunctionCache::Get().Insert(compiledFunctionKey, descriptor);
+                    }
                 }
                 // bubble up the byproducts to the caller by moving them to the context.
                 outputByproducts.emplace(AZStd::move(descriptor.m_byProducts));
@@ -0,0 +1,24 @@
+{
+    "Source" : "RestoreShadowmap.azsl",
+
+    "DepthStencilState" : {
+        "Depth" : { "Enable" : true, "CompareFunc" : "Always" }
+    },
+
+    "DrawList" : "shadow",
+
+    "ProgramSettings":
+    {
+      "EntryPoints":
+      [
+        {
+          "name": "MainVS",
+          "type": "Vertex"
+        },
+        {
+          "name": "MainPS",
+          "type": "Fragment"
+        }
+      ]
+    }
+}
@@ -48,6 +48,10 @@ namespace AZ
             RPI::AuxGeomDrawPtr GetOrCreateDrawQueueForView(const RPI::View* view) override;
             void ReleaseDrawQueueForView(const RPI::View* view) override;
 
+            PersistentGeometryHandle AddPersistentGeometry(const PersistentGeometryDescriptor& descriptor) override;
+            void RemovePersistentGeometry(PersistentGeometryHandle handle) override;
+            void SetPersistentGeometryVisible(PersistentGeometryHandle handle, bool visible) override;
+
             // RPI::SceneNotificationBus::Handler overrides...
             void OnRenderPipelineChanged(AZ::RPI::RenderPipeline* pipeline, RPI::SceneNotification::RenderPipelineChangeType changeType) override;
 
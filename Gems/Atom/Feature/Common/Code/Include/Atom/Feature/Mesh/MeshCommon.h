@@ -24,6 +24,11 @@ namespace AZ::Render::MeshCommon
 
     inline static AZ::Name MeshMovedName = AZ::Name::FromStringLiteral("MeshMoved", AZ::Interface<AZ::NameDictionary>::Get());
 
+    //! The scene data the mesh feature processor writes when Simulate() updates the bounds of the mesh cullables.
+    //! Feature processors that call MarkMeshesWithFlag() from their Simulate() read these bounds, and declare this
+    //! name in FeatureProcessor::GetSceneDataAccess() so the scene runs them after the mesh feature processor.
+    inline static AZ::Name CullableBoundsName = AZ::Name::FromStringLiteral("CullableBounds", AZ::Interface<AZ::NameDictionary>::Get());
+
     // The DrawListTag name for drawing to MeshMotionVector pass
     inline static AZ::Name MotionDrawListTagName = AZ::Name::FromStringLiteral("motion", AZ::Interface<AZ::NameDictionary>::Get());
 
@@ -25,6 +25,8 @@
 
 namespace AZ
 {
+    class TaskToken;
+
     namespace Render
     {
         class TransformServiceFeatureProcessor;
@@ -139,6 +141,9 @@ namespace AZ
 
             size_t m_lodBias = 0;
 
+            //! The most detailed resident lod of the model when the draw packets were built, see RPI::ModelLodStreamingController.
+            size_t m_mostDetailedResidentLod = 0;
+
             RPI::Cullable m_cullable;
             CustomMaterialMap m_customMaterials;
             MeshHandleDescriptor m_descriptor;
@@ -202,6 +207,8 @@ namespace AZ
             void Deactivate() override;
             //! Updates GPU buffers with latest data from render proxies
             void Simulate(const FeatureProcessor::SimulatePacket& packet) override;
+            //! Declares the mesh cullable bounds that Simulate() updates
+            void GetSceneDataAccess(SceneDataAccess& access) const override;
             //! Updates ViewSrgs with per-view instance data for visible instances
             void OnEndCulling(const RenderPacket& packet) override;
 
@@ -285,6 +292,7 @@ namespace AZ
             void OnRenderPipelineChanged(AZ::RPI::RenderPipeline* pipeline, RPI::SceneNotification::RenderPipelineChangeType changeType) override;
 
             void CheckForInstancingCVarChange();
+            void CheckForModelLodResidencyChange();
             AZStd::vector<AZ::Job*> CreateInitJobQueue();
             AZStd::vector<AZ::Job*> CreatePerInstanceGroupJobQueue();
             AZStd::vector<AZ::Job*> CreateUpdateCullingJobQueue();
@@ -293,9 +301,10 @@ namespace AZ
             
             
             void ResizePerViewInstanceVectors(size_t viewCount);
-            void AddVisibleObjectsToBuckets(TaskGraph& addVisibleObjectsToBucketsTG, size_t viewIndex, const RPI::ViewPtr& view);
-            void SortInstanceBufferBuckets(TaskGraph& sortInstanceBufferBucketsTG, size_t viewIndex);
-            void BuildInstanceBufferAndDrawCalls(TaskGraph& taskGraph, size_t viewIndex, const RPI::ViewPtr& view);
+            void AddVisibleObjectsToBuckets(
+                TaskGraph& addVisibleObjectsToBucketsTG, size_t viewIndex, const RPI::ViewPtr& view, TaskToken& bucketsFilledToken);
+            void AssignInstanceDataOffsets(size_t viewIndex);
+            void SortBucketsAndBuildDrawCalls(TaskGraph& sortAndBuildTG, size_t viewIndex, const RPI::ViewPtr& view, TaskToken& bucketsFilledToken);
             void UpdateGPUInstanceBufferForView(size_t viewIndex, const RPI::ViewPtr& view);
 
             AZStd::concurrency_checker m_meshDataChecker;
@@ -325,6 +334,8 @@ namespace AZ
             {
                 AZStd::atomic<uint32_t> m_currentElementIndex = 0;
                 AZStd::vector<SortInstanceData> m_sortInstanceData = {};
+                // Index of the first instance of the bucket in the view's instance buffer
+                uint32_t m_instanceDataOffset = 0;
 
                 InstanceGroupBucket()
                     : m_currentElementIndex(0)
@@ -336,12 +347,14 @@ namespace AZ
                 {
                     m_currentElementIndex = rhs.m_currentElementIndex.load();
                     m_sortInstanceData = rhs.m_sortInstanceData;
+                    m_instanceDataOffset = rhs.m_instanceDataOffset;
                 }
 
                  void operator=(const InstanceGroupBucket& rhs)
                 {
                     m_currentElementIndex = rhs.m_currentElementIndex.load();
                     m_sortInstanceData = rhs.m_sortInstanceData;
+                    m_instanceDataOffset = rhs.m_instanceDataOffset;
                 }
             };
             
@@ -363,6 +376,7 @@ namespace AZ
             bool m_enablePerMeshShaderOptionFlags = false;
             bool m_enableMeshInstancing = false;
             bool m_enableMeshInstancingForTransparentObjects = false;
+            uint32_t m_lodResidencyChangeCount = 0;
         };
     } // namespace Render
 } // namespace AZ
@@ -63,6 +63,8 @@ namespace AZ
             // so that we can calculate the maximum range a given mesh might be morphed if all of the morph targets
             // associated with it were active at once.
             uint32_t m_meshIndex;
+            // Index of the first delta of the morph target within the deltas of the lod
+            uint32_t m_startIndex;
         };
 
         namespace MorphTargetConstants
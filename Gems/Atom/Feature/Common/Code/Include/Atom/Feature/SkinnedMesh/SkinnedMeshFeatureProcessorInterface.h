@@ -29,6 +29,23 @@ namespace AZ
 
             using SkinnedMeshHandle = StableDynamicArrayHandle<SkinnedMeshRenderProxy>;
 
+            //! A looping motion baked for GPU pose evaluation.
+            //! The skinning shader samples and blends the frames around the scene time instead of using the uploaded skinning matrices.
+            struct BakedMotion
+            {
+                //! Skinning transforms of every bone for every frame, one frame after the other.
+                //! Each frame uses the same layout and skinning method as the data passed to SetSkinningMatrices.
+                Data::Instance<RPI::Buffer> m_boneTransforms;
+                uint32_t m_boneCount = 0;
+                uint32_t m_frameCount = 0;
+                float m_framesPerSecond = 30.0f;
+                float m_playbackSpeed = 1.0f;
+                //! Offset into the motion in seconds, so instances sharing a motion don't move in lockstep
+                float m_timeOffset = 0.0f;
+
+                bool IsValid() const { return m_boneTransforms && m_boneCount > 0 && m_frameCount > 0; }
+            };
+
             struct SkinnedMeshHandleDescriptor
             {
                 Data::Instance<SkinnedMeshInputBuffers> m_inputBuffers;
@@ -36,6 +53,8 @@ namespace AZ
                 AZStd::shared_ptr<MeshFeatureProcessorInterface::MeshHandle> m_meshHandle;
                 Data::Instance<RPI::Buffer> m_boneTransforms;
                 SkinnedMeshShaderOptions m_shaderOptions;
+                //! Optional baked motion. If it is valid, the pose is evaluated on the GPU and SetSkinningMatrices is not needed.
+                BakedMotion m_bakedMotion;
             };
 
             //! Given a descriptor of the input and output for skinning, acquire a handle to the instance that will be skinned
@@ -51,6 +70,11 @@ namespace AZ
             virtual void EnableSkinning(const SkinnedMeshHandle& handle, uint32_t lodIndex, uint32_t meshIndex) = 0;
             //! Disable skinning for a given mesh and lod of a skinned mesh handle
             virtual void DisableSkinning(const SkinnedMeshHandle& handle, uint32_t lodIndex, uint32_t meshIndex) = 0;
+            //! Sets how many frames pass between skinning updates of a skinned mesh handle.
+            //! The mesh keeps the skinned vertices of the last update in between. 1 updates the mesh every frame.
+            virtual void SetSkinningUpdateInterval(const SkinnedMeshHandle& handle, uint32_t updateInterval) = 0;
+            //! Changes the playback of the baked motion of a skinned mesh handle that was acquired with one
+            virtual void SetBakedMotionPlayback(const SkinnedMeshHandle& handle, float playbackSpeed, float timeOffset) = 0;
         };
     } // namespace Render
 } // namespace AZ
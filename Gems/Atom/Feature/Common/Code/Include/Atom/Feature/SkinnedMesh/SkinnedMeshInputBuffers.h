@@ -83,10 +83,10 @@ namespace AZ
             uint32_t GetVertexCount() const;
 
             //! Add a single morph target that can be applied to an instance of this skinned mesh
-            //! Creates a view into the larger morph target buffer to be used for applying an individual morph
+            //! The first morph target of a lod creates the view into the larger morph target buffer that all morph targets of the lod are applied from
             //! @param morphTarget The metadata that has info such as the min/max weight, offset, and vertex count for the morph
             //! @param morphBufferAssetView The view of all the morph target deltas that can be applied to this mesh
-            //! @param bufferNamePrefix A prefix that can be used to identify this morph target when creating the view into the morph target buffer.
+            //! @param bufferNamePrefix A prefix that can be used to identify the view into the morph target buffer.
             //! @param minWeight The minimum weight that might be applied to this morph target. It's possible for the weight of a morph target to be outside the 0-1 range. Defaults to 0
             //! @param maxWeight The maximum weight that might be applied to this morph target. It's possible for the weight of a morph target to be outside the 0-1 range. 
             void AddMorphTarget(
@@ -99,8 +99,8 @@ namespace AZ
             //! Get the MetaDatas for all the morph targets that can be applied to an instance of this skinned mesh
             const AZStd::vector<MorphTargetComputeMetaData>& GetMorphTargetComputeMetaDatas() const;
 
-            //! Get the MorphTargetInputBuffers for all the morph targets that can be applied to an instance of this skinned mesh
-            const AZStd::vector<AZStd::intrusive_ptr<MorphTargetInputBuffers>>& GetMorphTargetInputBuffers() const;
+            //! Get the MorphTargetInputBuffers with the deltas of all the morph targets that can be applied to an instance of this skinned mesh
+            const AZStd::intrusive_ptr<MorphTargetInputBuffers>& GetMorphTargetInputBuffers() const;
 
             //! Check if there are any morph targets that can be applied to a particular sub-mesh
             bool HasMorphTargetsForMesh(uint32_t meshIndex) const;
@@ -140,8 +140,9 @@ namespace AZ
             //! Container with one MorphTargetMetaData per morph target that can potentially be applied to an instance of this lod
             AZStd::vector<MorphTargetComputeMetaData> m_morphTargetComputeMetaDatas;
 
-            //! Container with one MorphTargetInputBuffers per morph target that can potentially be applied to an instance of this lod
-            AZStd::vector<AZStd::intrusive_ptr<MorphTargetInputBuffers>> m_morphTargetInputBuffers;
+            //! View of the deltas of every morph target that can potentially be applied to an instance of this lod.
+            //! MorphTargetComputeMetaData::m_startIndex locates the deltas of each morph target within it.
+            AZStd::intrusive_ptr<MorphTargetInputBuffers> m_morphTargetInputBuffers;
 
             SkinnedMeshOutputVertexCounts m_outputVertexCountsByStream;
         };
@@ -189,20 +190,20 @@ namespace AZ
             //! Returns a vector of MorphTargetMetaData with one entry for each morph target that could be applied to this mesh
             const AZStd::vector<MorphTargetComputeMetaData>& GetMorphTargetComputeMetaDatas(uint32_t lodIndex) const;
 
-            //! Returns a vector of MorphTargetInputBuffers which serve as input to the morph target pass
-            const AZStd::vector<AZStd::intrusive_ptr<MorphTargetInputBuffers>>& GetMorphTargetInputBuffers(uint32_t lodIndex) const;
+            //! Returns the MorphTargetInputBuffers with the deltas of every morph target of the lod, which serve as input to the morph target pass
+            const AZStd::intrusive_ptr<MorphTargetInputBuffers>& GetMorphTargetInputBuffers(uint32_t lodIndex) const;
 
             //! Return the integer encoding used for the morph targets for a given lod/mesh, or -1 if there are no morph targets for the mesh.
             //! If the values are not yet pre-calculated, they will be when calling this function
             float GetMorphTargetIntegerEncoding(uint32_t lodIndex, uint32_t meshIndex) const;
 
             //! Add a single morph target that can be applied to an instance of this skinned mesh
-            //! Creates a view into the larger morph target buffer to be used for applying an individual morph
+            //! The first morph target of a lod creates the view into the larger morph target buffer that all morph targets of the lod are applied from
             //! Must call Finalize after all morph targets have been added
             //! @param lodIndex The index of the lod modified by the morph target
             //! @param morphTarget The metadata that has info such as the min/max weight, offset, and vertex count for the morph
             //! @param morphBufferAssetView The view of all the morph target deltas that can be applied to this mesh
-            //! @param bufferNamePrefix A prefix that can be used to identify this morph target when creating the view into the morph target buffer.
+            //! @param bufferNamePrefix A prefix that can be used to identify the view into the morph target buffer.
             //! @param minWeight The minimum weight that might be applied to this morph target. It's possible for the weight of a morph target to be outside the 0-1 range. Defaults to 0
             //! @param maxWeight The maximum weight that might be applied to this morph target. It's possible for the weight of a morph target to be outside the 0-1 range.
             void AddMorphTarget(
@@ -24,6 +24,7 @@ namespace AZ
         {
             SkinningMethod m_skinningMethod = SkinningMethod::LinearSkinning;
             bool m_applyMorphTargets = false;
+            bool m_gpuPoseEvaluation = false;
         };
     }
 }
@@ -67,7 +67,11 @@ namespace AZ
 
             // Prepare GPU buffers for object transformation matrices
             // Create the buffers if they don't exist. Otherwise, resize them if they are not large enough for the matrices
-            void PrepareBuffers();
+            // Returns true if any buffer was created or resized, which discards its content
+            bool PrepareBuffers();
+
+            // Uploads the slots at the given sorted indices, merging nearby slots into a single update
+            static void UploadSlots(RPI::Buffer& buffer, const AZStd::vector<Float4x3>& slots, const AZStd::vector<uint32_t>& sortedIndices);
 
             void UpdateSceneSrg(RPI::ShaderResourceGroup *sceneSrg);
 
@@ -91,9 +95,14 @@ namespace AZ
             Data::Instance<RPI::Buffer> m_objectToWorldInverseTransposeBuffer;
             Data::Instance<RPI::Buffer> m_objectToWorldHistoryBuffer;
 
+            // Slots whose transform changed since the last upload, only these are uploaded unless the whole buffer needs updating
+            AZStd::vector<uint32_t> m_dirtyTransformIndices;
+            // Slots that changed in the previous frame, so their history transform differs from the one on the GPU
+            AZStd::vector<uint32_t> m_dirtyHistoryIndices;
+
             uint32_t m_firstAvailableTransformIndex = NoAvailableTransformIndices;
-            bool m_deviceBufferNeedsUpdate = false;
-            bool m_historyBufferNeedsUpdate = false;
+            bool m_deviceBufferNeedsUpdate = false; // the whole transform and normal buffers need to be uploaded
+            bool m_historyBufferNeedsUpdate = false; // the whole history buffer needs to be uploaded
             bool m_isWriteable = true;     //prevents write access during certain parts of the frame (for threadsafety)
         };
     }
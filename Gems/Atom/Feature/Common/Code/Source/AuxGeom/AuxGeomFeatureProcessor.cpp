@@ -85,6 +85,7 @@ namespace AZ
             // Process the dynamic primitives
             m_dynamicPrimitiveProcessor->PrepareFrame();
             m_dynamicPrimitiveProcessor->ProcessDynamicPrimitives(bufferData, fpPacket);
+            m_dynamicPrimitiveProcessor->ProcessPersistentGeometry(fpPacket);
 
             // Process the objects (draw requests using fixed shape buffers)
             m_fixedShapeProcessor->PrepareFrame();
@@ -157,6 +158,32 @@ namespace AZ
             m_viewDrawDataMap.erase(view);
         }
 
+        RPI::AuxGeomFeatureProcessorInterface::PersistentGeometryHandle AuxGeomFeatureProcessor::AddPersistentGeometry(
+            const PersistentGeometryDescriptor& descriptor)
+        {
+            if (!m_dynamicPrimitiveProcessor)
+            {
+                return InvalidPersistentGeometryHandle;
+            }
+            return m_dynamicPrimitiveProcessor->AddPersistentGeometry(descriptor);
+        }
+
+        void AuxGeomFeatureProcessor::RemovePersistentGeometry(PersistentGeometryHandle handle)
+        {
+            if (m_dynamicPrimitiveProcessor)
+            {
+                m_dynamicPrimitiveProcessor->RemovePersistentGeometry(handle);
+            }
+        }
+
+        void AuxGeomFeatureProcessor::SetPersistentGeometryVisible(PersistentGeometryHandle handle, bool visible)
+        {
+            if (m_dynamicPrimitiveProcessor)
+            {
+                m_dynamicPrimitiveProcessor->SetPersistentGeometryVisible(handle, visible);
+            }
+        }
+
         void AuxGeomFeatureProcessor::OnSceneRenderPipelinesChanged()
         {
             m_dynamicPrimitiveProcessor->SetUpdatePipelineStates();
@@ -14,6 +14,7 @@
 #include <Atom/RHI.Reflect/InputStreamLayoutBuilder.h>
 
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
 #include <Atom/RPI.Public/DynamicDraw/DynamicDrawInterface.h>
 #include <Atom/RPI.Public/RPIUtils.h>
 #include <Atom/RPI.Public/Scene.h>
@@ -34,6 +35,26 @@ namespace AZ
                 RHI::PrimitiveTopology::LineList,
                 RHI::PrimitiveTopology::TriangleList,
             };
+
+            static const uint32_t VerticesPerPrimitive[PrimitiveType_Count] = { 1, 2, 3 };
+
+            AZ::u32 PackColor(AZ::Color color)
+            {
+                // We use the format RHI::Format::R8G8B8A8_UNORM
+                return (color.GetA8() << 24) | (color.GetB8() << 16) | (color.GetG8() << 8) | color.GetR8();
+            }
+
+            AuxGeomPrimitiveType ConvertPersistentPrimitiveType(RPI::AuxGeomFeatureProcessorInterface::PersistentPrimitiveType primitiveType)
+            {
+                switch (primitiveType)
+                {
+                case RPI::AuxGeomFeatureProcessorInterface::PersistentPrimitiveType::PointList: return PrimitiveType_PointList;
+                case RPI::AuxGeomFeatureProcessorInterface::PersistentPrimitiveType::LineList: return PrimitiveType_LineList;
+                case RPI::AuxGeomFeatureProcessorInterface::PersistentPrimitiveType::TriangleList: return PrimitiveType_TriangleList;
+                }
+                AZ_Assert(false, "Invalid PersistentPrimitiveType value passed to AuxGeom");
+                return PrimitiveType_Count;
+            }
         }
 
         bool DynamicPrimitiveProcessor::Initialize(const AZ::RPI::Scene* scene)
@@ -55,6 +76,12 @@ namespace AZ
 
         void DynamicPrimitiveProcessor::Release()
         {
+            {
+                AZStd::scoped_lock lock(m_persistentGeometryMutex);
+                m_persistentGeometry.clear();
+                m_removedPersistentGeometry.clear();
+            }
+
             m_drawPackets.clear();
             m_processSrgs.clear();
             m_shaderData.m_defaultSRG = nullptr;
@@ -87,6 +114,9 @@ namespace AZ
         {
             m_processSrgs.clear();
             m_drawPackets.clear();
+
+            AZStd::scoped_lock lock(m_persistentGeometryMutex);
+            m_removedPersistentGeometry.clear();
         }
 
         void DynamicPrimitiveProcessor::ProcessDynamicPrimitives(const AuxGeomBufferData* bufferData, const RPI::FeatureProcessor::RenderPacket& fpPacket)
@@ -192,6 +222,197 @@ namespace AZ
             }
         }
 
+        RPI::AuxGeomFeatureProcessorInterface::PersistentGeometryHandle DynamicPrimitiveProcessor::AddPersistentGeometry(
+            const RPI::AuxGeomFeatureProcessorInterface::PersistentGeometryDescriptor& descriptor)
+        {
+            using RPI::AuxGeomFeatureProcessorInterface;
+
+            const size_t vertexCount = descriptor.m_vertices.size();
+            const size_t colorCount = descriptor.m_colors.size();
+            if (vertexCount == 0 || (colorCount != 1 && colorCount != vertexCount))
+            {
+                AZ_Warning("AuxGeom", false, "Persistent geometry needs vertices and either one color or one color per vertex, ignoring it");
+                return AuxGeomFeatureProcessorInterface::InvalidPersistentGeometryHandle;
+            }
+
+            const AuxGeomPrimitiveType primitiveType = ConvertPersistentPrimitiveType(descriptor.m_primitiveType);
+            const size_t indexCountPerInstance = descriptor.m_indices.empty() ? vertexCount : descriptor.m_indices.size();
+            if (indexCountPerInstance % VerticesPerPrimitive[primitiveType] != 0)
+            {
+                AZ_Warning("AuxGeom", false, "Persistent geometry index count isn't a multiple of the primitive size, ignoring it");
+                return AuxGeomFeatureProcessorInterface::InvalidPersistentGeometryHandle;
+            }
+            for (const uint32_t index : descriptor.m_indices)
+            {
+                if (index >= vertexCount)
+                {
+                    AZ_Warning("AuxGeom", false, "Persistent geometry index %u is out of range, ignoring it", index);
+                    return AuxGeomFeatureProcessorInterface::InvalidPersistentGeometryHandle;
+                }
+            }
+
+            const size_t instanceCount = AZStd::max<size_t>(descriptor.m_instanceTransforms.size(), 1);
+            if (vertexCount * instanceCount > MaxDynamicVertexIndex || indexCountPerInstance * instanceCount > MaxDynamicVertexIndex)
+            {
+                AZ_Warning("AuxGeom", false, "Persistent geometry has too many vertices or indices, ignoring it");
+                return AuxGeomFeatureProcessorInterface::InvalidPersistentGeometryHandle;
+            }
+
+            // The instances are baked into the buffers once, so the draw costs nothing per frame beyond its draw packets
+            AZStd::vector<AuxGeomDynamicVertex> vertices;
+            vertices.reserve(vertexCount * instanceCount);
+            AZStd::vector<AuxGeomIndex> indices;
+            indices.reserve(indexCountPerInstance * instanceCount);
+            AZ::Aabb bounds = AZ::Aabb::CreateNull();
+
+            const bool singleColor = colorCount == 1;
+            const AuxGeomColor packedColor = PackColor(descriptor.m_colors[0]);
+            for (size_t instanceIndex = 0; instanceIndex < instanceCount; ++instanceIndex)
+            {
+                const AZ::Transform transform = descriptor.m_instanceTransforms.empty()
+                    ? AZ::Transform::CreateIdentity()
+                    : descriptor.m_instanceTransforms[instanceIndex];
+                const AuxGeomIndex baseVertex = aznumeric_cast<AuxGeomIndex>(vertices.size());
+                for (size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+                {
+                    const AZ::Vector3 position = transform.TransformPoint(descriptor.m_vertices[vertexIndex]);
+                    bounds.AddPoint(position);
+                    vertices.emplace_back(position, singleColor ? packedColor : PackColor(descriptor.m_colors[vertexIndex]));
+                }
+
+                if (descriptor.m_indices.empty())
+                {
+                    for (size_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+                    {
+                        indices.push_back(baseVertex + aznumeric_cast<AuxGeomIndex>(vertexIndex));
+                    }
+                }
+                else
+                {
+                    for (const uint32_t index : descriptor.m_indices)
+                    {
+                        indices.push_back(baseVertex + index);
+                    }
+                }
+            }
+
+            const uint32_t vertexByteCount = aznumeric_cast<uint32_t>(vertices.size() * sizeof(AuxGeomDynamicVertex));
+            const uint32_t indexByteCount = aznumeric_cast<uint32_t>(indices.size() * sizeof(AuxGeomIndex));
+
+            PersistentGeometry geometry;
+            RPI::CommonBufferDescriptor bufferDesc;
+            bufferDesc.m_poolType = RPI::CommonBufferPoolType::StaticInputAssembly;
+            bufferDesc.m_bufferName = "AuxGeomPersistentVertexBuffer";
+            bufferDesc.m_elementSize = sizeof(AuxGeomDynamicVertex);
+            bufferDesc.m_byteCount = vertexByteCount;
+            bufferDesc.m_bufferData = vertices.data();
+            geometry.m_vertexBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(bufferDesc);
+
+            bufferDesc.m_bufferName = "AuxGeomPersistentIndexBuffer";
+            bufferDesc.m_elementSize = sizeof(AuxGeomIndex);
+            bufferDesc.m_byteCount = indexByteCount;
+            bufferDesc.m_bufferData = indices.data();
+            geometry.m_indexBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(bufferDesc);
+
+            if (!geometry.m_vertexBuffer || !geometry.m_indexBuffer)
+            {
+                AZ_Error("DynamicPrimitiveProcessor", false, "Failed to create the buffers for persistent geometry");
+                return AuxGeomFeatureProcessorInterface::InvalidPersistentGeometryHandle;
+            }
+
+            geometry.m_bufferGroup.m_indexBufferView =
+                RHI::IndexBufferView(*geometry.m_indexBuffer->GetRHIBuffer(), 0, indexByteCount, RHI::IndexFormat::Uint32);
+            geometry.m_bufferGroup.m_streamBufferViews.push_back(
+                RHI::StreamBufferView(*geometry.m_vertexBuffer->GetRHIBuffer(), 0, vertexByteCount, sizeof(AuxGeomDynamicVertex)));
+
+            const bool isOpaque = singleColor ? descriptor.m_colors[0].GetA8() == 0xFF
+                                              : descriptor.m_opacityType == RPI::AuxGeomDraw::OpacityType::Opaque;
+            geometry.m_primitiveType = primitiveType;
+            geometry.m_blendMode = isOpaque ? BlendMode_Off : BlendMode_Alpha;
+            geometry.m_depthReadType = ConvertRPIDepthTestFlag(descriptor.m_depthTest);
+            geometry.m_depthWriteType = ConvertRPIDepthWriteFlag(descriptor.m_depthWrite);
+            geometry.m_faceCullMode = ConvertRPIFaceCullFlag(descriptor.m_faceCullMode);
+            geometry.m_center = bounds.GetCenter();
+            geometry.m_indexCount = aznumeric_cast<uint32_t>(indices.size());
+
+            AZStd::scoped_lock lock(m_persistentGeometryMutex);
+            const AuxGeomFeatureProcessorInterface::PersistentGeometryHandle handle = m_nextPersistentGeometryHandle++;
+            m_persistentGeometry.emplace(handle, AZStd::move(geometry));
+            return handle;
+        }
+
+        void DynamicPrimitiveProcessor::RemovePersistentGeometry(RPI::AuxGeomFeatureProcessorInterface::PersistentGeometryHandle handle)
+        {
+            AZStd::scoped_lock lock(m_persistentGeometryMutex);
+            if (auto geometryIt = m_persistentGeometry.find(handle); geometryIt != m_persistentGeometry.end())
+            {
+                m_removedPersistentGeometry.push_back(AZStd::move(geometryIt->second));
+                m_persistentGeometry.erase(geometryIt);
+            }
+        }
+
+        void DynamicPrimitiveProcessor::SetPersistentGeometryVisible(
+            RPI::AuxGeomFeatureProcessorInterface::PersistentGeometryHandle handle, bool visible)
+        {
+            AZStd::scoped_lock lock(m_persistentGeometryMutex);
+            if (auto geometryIt = m_persistentGeometry.find(handle); geometryIt != m_persistentGeometry.end())
+            {
+                geometryIt->second.m_visible = visible;
+            }
+        }
+
+        void DynamicPrimitiveProcessor::ProcessPersistentGeometry(const RPI::FeatureProcessor::RenderPacket& fpPacket)
+        {
+            AZ_PROFILE_SCOPE(AzRender, "DynamicPrimitiveProcessor: ProcessPersistentGeometry");
+
+            AZStd::scoped_lock lock(m_persistentGeometryMutex);
+            if (m_persistentGeometry.empty())
+            {
+                return;
+            }
+
+            RHI::DrawPacketBuilder drawPacketBuilder;
+            for (auto& [handle, geometry] : m_persistentGeometry)
+            {
+                if (!geometry.m_visible)
+                {
+                    continue;
+                }
+
+                PipelineStateOptions pipelineStateOptions;
+                pipelineStateOptions.m_blendMode = geometry.m_blendMode;
+                pipelineStateOptions.m_primitiveType = geometry.m_primitiveType;
+                pipelineStateOptions.m_depthReadType = geometry.m_depthReadType;
+                pipelineStateOptions.m_depthWriteType = geometry.m_depthWriteType;
+                pipelineStateOptions.m_faceCullMode = geometry.m_faceCullMode;
+                const RPI::Ptr<RPI::PipelineStateForDraw>& pipelineState = GetPipelineState(pipelineStateOptions);
+
+                for (auto& view : fpPacket.m_views)
+                {
+                    if (!view->HasDrawListTag(m_shaderData.m_drawListTag))
+                    {
+                        continue;
+                    }
+
+                    RHI::DrawItemSortKey sortKey = geometry.m_blendMode == BlendMode_Off ? 0 : view->GetSortKeyForPosition(geometry.m_center);
+                    const RHI::DrawPacket* drawPacket = BuildDrawPacketForDynamicPrimitive(
+                        geometry.m_bufferGroup,
+                        pipelineState,
+                        m_shaderData.m_defaultSRG,
+                        geometry.m_indexCount,
+                        0,
+                        drawPacketBuilder,
+                        sortKey);
+
+                    if (drawPacket)
+                    {
+                        m_drawPackets.emplace_back(drawPacket);
+                        view->AddDrawPacket(drawPacket);
+                    }
+                }
+            }
+        }
+
         bool DynamicPrimitiveProcessor::UpdateIndexBuffer(const IndexBuffer& source, DynamicBufferGroup& group)
         {
             const size_t sourceByteSize = source.size() * sizeof(AuxGeomIndex);
@@ -18,9 +18,13 @@
 #include <Atom/RHI.Reflect/InputStreamLayout.h>
 #include <Atom/RHI.Reflect/Limits.h>
 
+#include <Atom/RPI.Public/AuxGeom/AuxGeomFeatureProcessorInterface.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
 #include <Atom/RPI.Public/FeatureProcessor.h>
 #include <Atom/RPI.Public/PipelineState.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
 
 #include "AuxGeomBase.h"
 
@@ -75,6 +79,18 @@ namespace AZ
             //! Notify this DynamicPrimitiveProcessor to update its pipeline states
             void SetUpdatePipelineStates();
 
+            //! Uploads the persistent geometry into static buffers, see AuxGeomFeatureProcessorInterface::AddPersistentGeometry
+            RPI::AuxGeomFeatureProcessorInterface::PersistentGeometryHandle AddPersistentGeometry(
+                const RPI::AuxGeomFeatureProcessorInterface::PersistentGeometryDescriptor& descriptor);
+
+            //! Removes the persistent geometry, its buffers are kept until the end of the frame that may still draw them
+            void RemovePersistentGeometry(RPI::AuxGeomFeatureProcessorInterface::PersistentGeometryHandle handle);
+
+            void SetPersistentGeometryVisible(RPI::AuxGeomFeatureProcessorInterface::PersistentGeometryHandle handle, bool visible);
+
+            //! Add draw packets for all the visible persistent geometry to the views in the feature processor packet
+            void ProcessPersistentGeometry(const RPI::FeatureProcessor::RenderPacket& fpPacket);
+
         private: // types
 
             using StreamBufferViewsForAllStreams = AZStd::fixed_vector<AZ::RHI::StreamBufferView, AZ::RHI::Limits::Pipeline::StreamCountMax>;
@@ -90,6 +106,22 @@ namespace AZ
 
             using DrawPackets = AZStd::vector<AZStd::unique_ptr<const RHI::DrawPacket>>;
 
+            //! Geometry that stays in static buffers until it's removed, only its draw packets are built each frame
+            struct PersistentGeometry
+            {
+                Data::Instance<RPI::Buffer> m_vertexBuffer;
+                Data::Instance<RPI::Buffer> m_indexBuffer;
+                DynamicBufferGroup m_bufferGroup;
+                AuxGeomPrimitiveType m_primitiveType = PrimitiveType_LineList;
+                AuxGeomBlendMode m_blendMode = BlendMode_Off;
+                AuxGeomDepthReadType m_depthReadType = DepthRead_On;
+                AuxGeomDepthWriteType m_depthWriteType = DepthWrite_On;
+                AuxGeomFaceCullMode m_faceCullMode = FaceCull_Back;
+                AZ::Vector3 m_center = AZ::Vector3::CreateZero(); // used for depth sorting blended draws
+                uint32_t m_indexCount = 0;
+                bool m_visible = true;
+            };
+
             struct ShaderData
             {
                 RHI::Ptr<RHI::ShaderResourceGroupLayout> m_perDrawSrgLayout;
@@ -170,6 +202,12 @@ namespace AZ
 
             bool m_needUpdatePipelineStates = false;
 
+            // Persistent geometry can be added and removed from any thread, the mutex guards the members below
+            AZStd::mutex m_persistentGeometryMutex;
+            AZStd::unordered_map<RPI::AuxGeomFeatureProcessorInterface::PersistentGeometryHandle, PersistentGeometry> m_persistentGeometry;
+            // Removed geometry whose buffers may be used by this frame's draw packets, released in FrameEnd
+            AZStd::vector<PersistentGeometry> m_removedPersistentGeometry;
+            RPI::AuxGeomFeatureProcessorInterface::PersistentGeometryHandle m_nextPersistentGeometryHandle = 1;
         };
     } // namespace Render
 } // namespace AZ
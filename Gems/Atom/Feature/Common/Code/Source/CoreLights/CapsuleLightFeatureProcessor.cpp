@@ -124,6 +124,11 @@ namespace AZ
             }
         }
 
+        void CapsuleLightFeatureProcessor::GetSceneDataAccess(SceneDataAccess& access) const
+        {
+            access.m_reads.push_back(MeshCommon::CullableBoundsName);
+        }
+
         void CapsuleLightFeatureProcessor::Render(const CapsuleLightFeatureProcessor::RenderPacket& packet)
         {
             AZ_PROFILE_SCOPE(RPI, "CapsuleLightFeatureProcessor: Render");
@@ -8,6 +8,8 @@
 
 #include <Atom/RHI/DrawListTagRegistry.h>
 #include <Atom/RHI/RHISystemInterface.h>
+#include <Atom/RPI.Public/Image/AttachmentImage.h>
+#include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
 #include <Atom/RPI.Reflect/Pass/RasterPassData.h>
 #include <CoreLights/CascadedShadowmapsPass.h>
@@ -81,8 +83,18 @@ namespace AZ
 
         void CascadedShadowmapsPass::BuildInternal()
         {
-            UpdateShadowmapImageSize();
+            const bool shadowmapRecreated = UpdateShadowmapImageSize();
             Base::BuildInternal();
+
+            if (shadowmapRecreated)
+            {
+                // The new image has no content to keep yet.
+                m_renderedCascadeMask = 0;
+                for (const RPI::Ptr<RPI::Pass>& child : m_children)
+                {
+                    static_cast<ShadowmapPass*>(child.get())->SetSkipRender(false);
+                }
+            }
         }
 
         void CascadedShadowmapsPass::SetShadowmapSize(ShadowmapSize shadowmapSize, u16 numCascades)
@@ -107,7 +119,34 @@ namespace AZ
             m_atlas.Finalize();
         }
 
-        void CascadedShadowmapsPass::UpdateShadowmapImageSize()
+        void CascadedShadowmapsPass::SetShadowmapPersistent(bool persistent)
+        {
+            if (m_isShadowmapPersistent != persistent)
+            {
+                m_isShadowmapPersistent = persistent;
+                QueueForBuildAndInitialization();
+            }
+        }
+
+        void CascadedShadowmapsPass::SetCascadeSkipRender(u16 cascadeIndex, bool skipRender)
+        {
+            if (cascadeIndex < m_children.size())
+            {
+                // A cascade can only keep content it has rendered into the current image.
+                const uint32_t cascadeBit = 1u << cascadeIndex;
+                const bool canSkipRender = m_isShadowmapPersistent && m_persistentShadowmapImage && (m_renderedCascadeMask & cascadeBit);
+                const bool skip = skipRender && canSkipRender;
+                if (!skip)
+                {
+                    m_renderedCascadeMask |= cascadeBit;
+                }
+
+                ShadowmapPass* shadowPass = static_cast<ShadowmapPass*>(m_children[cascadeIndex].get());
+                shadowPass->SetSkipRender(skip);
+            }
+        }
+
+        bool CascadedShadowmapsPass::UpdateShadowmapImageSize()
         {
             // [GFX TODO][ATOM-2470] stop caring about attachment
             RPI::Ptr<RPI::PassAttachment> attachment = m_ownedAttachments.front();
@@ -121,6 +160,41 @@ namespace AZ
             const uint32_t shadowmapWidth = static_cast<uint32_t>(m_atlas.GetBaseShadowmapSize());
             imageDescriptor.m_size = RHI::Size(shadowmapWidth, shadowmapWidth, 1);
             imageDescriptor.m_arraySize = m_atlas.GetArraySliceCount();
+
+            if (!m_isShadowmapPersistent || shadowmapWidth == 0)
+            {
+                m_persistentShadowmapImage = {};
+                return false;
+            }
+
+            bool shadowmapRecreated = false;
+            if (!m_persistentShadowmapImage ||
+                m_persistentShadowmapImage->GetDescriptor().m_size != imageDescriptor.m_size ||
+                m_persistentShadowmapImage->GetDescriptor().m_arraySize != imageDescriptor.m_arraySize)
+            {
+                RHI::ImageDescriptor persistentDescriptor = imageDescriptor;
+                persistentDescriptor.m_bindFlags = RHI::ImageBindFlags::Depth | RHI::ImageBindFlags::ShaderRead;
+                persistentDescriptor.m_sharedQueueMask = RHI::HardwareQueueClassMask::Graphics;
+
+                // The ImageViewDescriptor must be specified to make sure the frame graph compiler doesn't treat this as a transient image.
+                RHI::ImageViewDescriptor viewDesc = RHI::ImageViewDescriptor::Create(persistentDescriptor.m_format, 0, 0);
+                viewDesc.m_aspectFlags = RHI::ImageAspectFlags::Depth;
+
+                RPI::CreateAttachmentImageRequest createImageRequest;
+                createImageRequest.m_imagePool = RPI::ImageSystemInterface::Get()->GetSystemAttachmentPool().get();
+                createImageRequest.m_imageDescriptor = persistentDescriptor;
+                createImageRequest.m_imageName = AZStd::string::format("%s.PersistentShadowmap", GetPathName().GetCStr());
+                createImageRequest.m_imageViewDescriptor = &viewDesc;
+                m_persistentShadowmapImage = RPI::AttachmentImage::Create(createImageRequest);
+                shadowmapRecreated = true;
+            }
+
+            if (m_persistentShadowmapImage)
+            {
+                attachment->m_lifetime = RHI::AttachmentLifetimeType::Imported;
+                attachment->m_importedResource = m_persistentShadowmapImage;
+            }
+            return shadowmapRecreated;
         }
 
         // View related ...
@@ -44,6 +44,13 @@ namespace AZ
             //! This queues the image size and array size which will be updated in the beginning of the frame.
             void SetShadowmapSize(ShadowmapSize shadowmapSize, u16 numCascades);
 
+            //! Keeps the shadowmap image alive between frames instead of using a transient image, so cascades can skip rendering.
+            void SetShadowmapPersistent(bool persistent);
+
+            //! Skips rendering the cascade this frame and keeps the content it rendered in an earlier frame.
+            //! This is ignored unless the shadowmap is persistent.
+            void SetCascadeSkipRender(u16 cascadeIndex, bool skipRender);
+
         private:
             CascadedShadowmapsPass() = delete;
             explicit CascadedShadowmapsPass(const RPI::PassDescriptor& descriptor);
@@ -56,7 +63,8 @@ namespace AZ
             void CreateChildPassesInternal() override;
             void CreateChildShadowMapPass(u16 cascadeIndex);
 
-            void UpdateShadowmapImageSize();
+            // Returns true if the persistent shadowmap image was recreated, which discards the content of every cascade.
+            bool UpdateShadowmapImageSize();
 
             const Name m_slotName{ "Shadowmap" };
             Name m_drawListTagName;
@@ -72,6 +80,11 @@ namespace AZ
 
             ShadowmapAtlas m_atlas;
             ShadowmapSize m_shadowmapSize = ShadowmapSize::None;
+
+            bool m_isShadowmapPersistent = false;
+            Data::Instance<RPI::AttachmentImage> m_persistentShadowmapImage;
+            // Bit per cascade which has rendered into m_persistentShadowmapImage.
+            uint32_t m_renderedCascadeMask = 0;
         };
     } // namespace Render
 } // namespace AZ
@@ -33,6 +33,7 @@ namespace AZ
     namespace Render
     {
         AZ_CVAR(bool, r_excludeItemsInSmallerShadowCascades, true, nullptr, ConsoleFunctorFlags::Null, "Set to true to exclude drawing items to a directional shadow cascade that are already covered by a smaller cascade.");
+        AZ_CVAR(uint32_t, r_directionalShadowCascadeUpdateInterval, 1, nullptr, ConsoleFunctorFlags::Null, "Number of frames between updates of the directional shadow cascades other than the nearest one. Cascades are staggered so that a different one updates each frame. 1 updates every cascade every frame.");
 
         // --- Camera Configuration ---
 
@@ -249,13 +250,40 @@ namespace AZ
                     UpdateBorderDepthsForSegments(m_shadowingLightHandle);
                     property.m_borderDepthsForSegmentsNeedsUpdate = false;
                 }
+
+                const uint32_t cascadeUpdateInterval = AZStd::max<uint32_t>(r_directionalShadowCascadeUpdateInterval, 1u);
+                if (m_previousCascadeUpdateInterval != cascadeUpdateInterval)
+                {
+                    // Skipped cascades need a shadowmap image which keeps its content between frames.
+                    for (const auto& it : m_cascadedShadowmapsPasses)
+                    {
+                        for (CascadedShadowmapsPass* pass : it.second)
+                        {
+                            pass->SetShadowmapPersistent(cascadeUpdateInterval > 1);
+                        }
+                    }
+                    property.m_shadowmapViewNeedsUpdate = true;
+                    m_previousCascadeUpdateInterval = cascadeUpdateInterval;
+                }
+                ++m_cascadeUpdateFrame;
+
+                for (auto& segmentIt : property.m_segments)
+                {
+                    for (uint16_t cascadeIndex = 0; cascadeIndex < segmentIt.second.size(); ++cascadeIndex)
+                    {
+                        segmentIt.second[cascadeIndex].m_renderThisFrame = IsCascadeUpdateFrame(cascadeIndex);
+                    }
+                }
+
                 if (property.m_shadowmapViewNeedsUpdate || m_previousExcludeCvarValue != r_excludeItemsInSmallerShadowCascades)
                 {
-                    UpdateShadowmapViews(m_shadowingLightHandle);
+                    // Keep updating the views while some of the cascades are waiting for their turn.
+                    const bool cascadeUpdateDeferred = UpdateShadowmapViews(m_shadowingLightHandle);
                     UpdateFilterParameters(m_shadowingLightHandle);
-                    property.m_shadowmapViewNeedsUpdate = false;
+                    property.m_shadowmapViewNeedsUpdate = cascadeUpdateDeferred;
                     m_previousExcludeCvarValue = r_excludeItemsInSmallerShadowCascades;
                 }
+                UpdateCascadeSkipRender(m_shadowingLightHandle);
                 SetShadowParameterToShadowData(m_shadowingLightHandle);
             }
 
@@ -693,6 +721,8 @@ namespace AZ
         void DirectionalLightFeatureProcessor::CacheCascadedShadowmapsPass()
         {
             m_cascadedShadowmapsPasses.clear();
+            // Forces the persistence of the shadowmap to be passed to the new passes.
+            m_previousCascadeUpdateInterval = 0;
 
             RPI::PassFilter passFilter = RPI::PassFilter::CreateWithTemplateName(Name("CascadedShadowmapsTemplate"), GetParentScene());
             RPI::PassSystemInterface::Get()->ForEachPass(passFilter, [this](RPI::Pass* pass) -> RPI::PassFilterExecutionFlow
@@ -1304,6 +1334,14 @@ namespace AZ
                 }
             }
 
+            // The split has changed, so no cascade can keep its view.
+            for (auto& segmentIt : property.m_segments)
+            {
+                for (CascadeSegment& segment : segmentIt.second)
+                {
+                    segment.m_snappedAabb = Aabb::CreateNull();
+                }
+            }
             property.m_shadowmapViewNeedsUpdate = true;
         }
 
@@ -1333,9 +1371,38 @@ namespace AZ
             orthoMax *= worldUnitsPerTexel;
         }
 
-        void DirectionalLightFeatureProcessor::UpdateShadowmapViews(LightHandle handle)
+        bool DirectionalLightFeatureProcessor::IsCascadeUpdateFrame(uint16_t cascadeIndex) const
+        {
+            // The nearest cascade covers the area closest to the camera, so it is updated every frame.
+            const uint32_t cascadeUpdateInterval = AZStd::max<uint32_t>(r_directionalShadowCascadeUpdateInterval, 1u);
+            return cascadeIndex == 0 || (m_cascadeUpdateFrame % cascadeUpdateInterval) == (cascadeIndex % cascadeUpdateInterval);
+        }
+
+        void DirectionalLightFeatureProcessor::UpdateCascadeSkipRender(LightHandle handle)
+        {
+            const ShadowProperty& property = m_shadowProperties.GetData(handle.GetIndex());
+            for (const auto& it : m_cascadedShadowmapsPasses)
+            {
+                for (CascadedShadowmapsPass* pass : it.second)
+                {
+                    const RPI::View* cameraView = pass->GetRenderPipeline()->GetDefaultView().get();
+                    const auto segmentIt = property.m_segments.find(cameraView);
+                    if (segmentIt == property.m_segments.end())
+                    {
+                        continue;
+                    }
+                    for (uint16_t cascadeIndex = 0; cascadeIndex < segmentIt->second.size(); ++cascadeIndex)
+                    {
+                        pass->SetCascadeSkipRender(cascadeIndex, !segmentIt->second[cascadeIndex].m_renderThisFrame);
+                    }
+                }
+            }
+        }
+
+        bool DirectionalLightFeatureProcessor::UpdateShadowmapViews(LightHandle handle)
         {
             ShadowProperty& property = m_shadowProperties.GetData(handle.GetIndex());
+            bool cascadeUpdateDeferred = false;
 
             const DirectionalLightData light = m_lightData.GetData(handle.GetIndex());
             static const Vector3 position = Vector3::CreateZero();
@@ -1353,6 +1420,21 @@ namespace AZ
 
                 for (uint16_t cascadeIndex = 0; cascadeIndex < segmentIt.second.size(); ++cascadeIndex)
                 {
+                    CascadeSegment& segment = segmentIt.second[cascadeIndex];
+
+                    // A cascade which is not scheduled this frame keeps its view, unless the light has turned
+                    // or the cascade has not been updated since its split changed.
+                    if (!segment.m_renderThisFrame && segment.m_snappedAabb.IsValid() && segment.m_lightDirection.IsClose(direction))
+                    {
+                        previousAabbMin = segment.m_snappedAabb.GetMin();
+                        previousAabbMax = segment.m_snappedAabb.GetMax();
+                        previousNear = segment.m_aabb.GetMin().GetY();
+                        previousFar = segment.m_aabb.GetMax().GetY();
+                        cascadeUpdateDeferred = true;
+                        continue;
+                    }
+                    segment.m_renderThisFrame = true;
+
                     const Aabb viewAabb = CalculateShadowViewAabb(handle, segmentIt.first, cascadeIndex, lightTransform);
 
                     if (viewAabb.IsValid() && viewAabb.IsFinite())
@@ -1370,8 +1452,9 @@ namespace AZ
                             viewToClipMatrix, snappedAabbMin.GetElement(0), snappedAabbMax.GetElement(0), snappedAabbMin.GetElement(2),
                             snappedAabbMax.GetElement(2), cascadeNear, cascadeFar);
 
-                        CascadeSegment& segment = segmentIt.second[cascadeIndex];
                         segment.m_aabb = viewAabb;
+                        segment.m_snappedAabb = Aabb::CreateFromMinMax(snappedAabbMin, snappedAabbMax);
+                        segment.m_lightDirection = direction;
                         segment.m_view->SetCameraTransform(lightTransform);
                         segment.m_view->SetViewToClipMatrix(viewToClipMatrix);
 
@@ -1409,6 +1492,7 @@ namespace AZ
                     }
                 }
             }
+            return cascadeUpdateDeferred;
         }
 
         void DirectionalLightFeatureProcessor::UpdateViewsOfCascadeSegments()
@@ -135,6 +135,16 @@ namespace AZ
 
                 // Far depth of the segment, i.e., border to the next segment
                 float m_borderFarDepth;
+
+                // Snapped light space AABB the view was last updated with.
+                // A null AABB means the view has to be updated before the cascade can skip an update.
+                Aabb m_snappedAabb = Aabb::CreateNull();
+
+                // Light direction the view was last updated with
+                Vector3 m_lightDirection = Vector3::CreateZero();
+
+                // If false, the cascade keeps its view and the shadowmap content of an earlier frame.
+                bool m_renderThisFrame = true;
             };
 
             struct ShadowProperty
@@ -318,7 +328,13 @@ namespace AZ
             void UpdateBorderDepthsForSegments(LightHandle handle);
 
             //! This updates the shadowmap view.
-            void UpdateShadowmapViews(LightHandle handle);
+            //! Returns true if the update of a cascade was deferred to a later frame.
+            bool UpdateShadowmapViews(LightHandle handle);
+
+            //! Returns true if the cascade is scheduled to update in the current frame.
+            bool IsCascadeUpdateFrame(uint16_t cascadeIndex) const;
+            //! This decides which cascades render this frame and passes it to the shadowmap passes.
+            void UpdateCascadeSkipRender(LightHandle handle);
 
             void UpdateViewsOfCascadeSegments();
             void SetFullscreenPassSettings();
@@ -402,6 +418,8 @@ namespace AZ
             bool m_lightBufferNeedsUpdate = false;
             bool m_shadowBufferNeedsUpdate = false;
             bool m_previousExcludeCvarValue = false;
+            uint32_t m_previousCascadeUpdateInterval = 0;
+            uint32_t m_cascadeUpdateFrame = 0;
             uint32_t m_shadowBufferNameIndex = 0;
             uint32_t m_shadowmapIndexTableBufferNameIndex = 0;
 
@@ -170,6 +170,11 @@ namespace AZ
             }
         }
 
+        void DiskLightFeatureProcessor::GetSceneDataAccess(SceneDataAccess& access) const
+        {
+            access.m_reads.push_back(MeshCommon::CullableBoundsName);
+        }
+
         void DiskLightFeatureProcessor::Render(const DiskLightFeatureProcessor::RenderPacket& packet)
         {
             AZ_PROFILE_SCOPE(RPI, "DiskLightFeatureProcessor: Simulate");
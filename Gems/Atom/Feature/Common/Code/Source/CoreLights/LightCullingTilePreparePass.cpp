@@ -16,11 +16,17 @@
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RPI.Reflect/Pass/PassTemplate.h>
 #include <Atom/RPI.Public/View.h>
+#include <AzCore/Console/Console.h>
 
 namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(bool, r_lightCullingClustered, false, nullptr, ConsoleFunctorFlags::Null,
+            "Set to true to cull lights against exponential depth slices of the view frustum (clustered light culling) instead of the tile depth bounds.");
+        AZ_CVAR(float, r_lightCullingClusteredFarDistance, 500.0f, nullptr, ConsoleFunctorFlags::Null,
+            "View distance where the last depth slice of clustered light culling starts. The last slice extends to infinity.");
+
         RPI::Ptr<LightCullingTilePreparePass> LightCullingTilePreparePass::Create(const RPI::PassDescriptor& descriptor)
         {
             RPI::Ptr<LightCullingTilePreparePass> pass = aznew LightCullingTilePreparePass(descriptor);
@@ -152,12 +158,17 @@ namespace AZ
                 AZStd::array<float, 2> m_unprojectZ;
                 uint32_t depthBufferWidth;
                 uint32_t depthBufferHeight;
-            } constantData;
+                uint32_t m_clustered;
+                float m_clusteredFarDistance;
+                uint32_t m_padding[2];
+            } constantData{};
 
             const RHI::Size resolution = GetDepthBufferDimensions();
             constantData.m_unprojectZ = ComputeUnprojectConstants();
             constantData.depthBufferWidth = resolution.m_width;
             constantData.depthBufferHeight = resolution.m_height;
+            constantData.m_clustered = r_lightCullingClustered ? 1 : 0;
+            constantData.m_clusteredFarDistance = r_lightCullingClusteredFarDistance;
 
             [[maybe_unused]] bool setOk = m_shaderResourceGroup->SetConstant(m_constantDataIndex, constantData);
             AZ_Assert(setOk, "LightCullingTilePreparePass::SetConstantData() - could not set constant data");
@@ -158,6 +158,11 @@ namespace AZ
             }
         }
 
+        void PointLightFeatureProcessor::GetSceneDataAccess(SceneDataAccess& access) const
+        {
+            access.m_reads.push_back(MeshCommon::CullableBoundsName);
+        }
+
         void PointLightFeatureProcessor::Render(const PointLightFeatureProcessor::RenderPacket& packet)
         {
             AZ_PROFILE_SCOPE(RPI, "PointLightFeatureProcessor: Render");
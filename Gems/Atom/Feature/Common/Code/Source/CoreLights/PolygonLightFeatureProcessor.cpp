@@ -161,6 +161,11 @@ namespace AZ::Render
         }
     }
 
+    void PolygonLightFeatureProcessor::GetSceneDataAccess(SceneDataAccess& access) const
+    {
+        access.m_reads.push_back(MeshCommon::CullableBoundsName);
+    }
+
     void PolygonLightFeatureProcessor::Render(const PolygonLightFeatureProcessor::RenderPacket& packet)
     {
         AZ_PROFILE_SCOPE(RPI, "PolygonLightFeatureProcessor: Render");
@@ -65,6 +65,15 @@ namespace AZ
             }
         }
 
+        void ProjectedShadowmapsPass::SetCacheAtlasAttachmentImage(Data::Instance<RPI::AttachmentImage> cacheAtlasAttachmentImage)
+        {
+            if (m_cacheAtlasAttachmentImage != cacheAtlasAttachmentImage)
+            {
+                m_cacheAtlasAttachmentImage = cacheAtlasAttachmentImage;
+                QueueForBuildAndInitialization();
+            }
+        }
+
         void ProjectedShadowmapsPass::BuildInternal()
         {
             for (auto passToAddOrRemove : m_passesToAddOrRemove)
@@ -73,6 +82,10 @@ namespace AZ
                 {
                     RemoveChild(passToAddOrRemove.m_pass);
                 }
+                else if (passToAddOrRemove.m_insertFirst)
+                {
+                    InsertChild(passToAddOrRemove.m_pass, 0u);
+                }
                 else
                 {
                     AddChild(passToAddOrRemove.m_pass);
@@ -80,9 +93,11 @@ namespace AZ
             }
             m_passesToAddOrRemove.clear();
 
+            auto depthAttachmentImage = RPI::ImageSystemInterface::Get()->GetSystemAttachmentImage(RHI::Format::D32_FLOAT);
+            AttachImageToSlot(Name("ShadowmapCache"), m_cacheAtlasAttachmentImage ? m_cacheAtlasAttachmentImage : depthAttachmentImage);
+
             if (!m_atlasAttachmentImage)
             {
-                auto depthAttachmentImage = RPI::ImageSystemInterface::Get()->GetSystemAttachmentImage(RHI::Format::D32_FLOAT);
                 AttachImageToSlot(Name("Shadowmap"), depthAttachmentImage);
                 SetEnabled(false);
                 return;
@@ -93,9 +108,9 @@ namespace AZ
             Base::BuildInternal();
         }
 
-        void ProjectedShadowmapsPass::QueueAddChild(RPI::Ptr<Pass> pass)
+        void ProjectedShadowmapsPass::QueueAddChild(RPI::Ptr<Pass> pass, bool insertFirst)
         {
-            m_passesToAddOrRemove.push_back({ pass, false });
+            m_passesToAddOrRemove.push_back({ pass, false, insertFirst });
             QueueForBuildAndInitialization(); // passes in `m_passesToAddOrRemove` are resolved in `BuildInternal()`
         }
 
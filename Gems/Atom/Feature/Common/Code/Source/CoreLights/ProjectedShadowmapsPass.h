@@ -35,7 +35,11 @@ namespace AZ
             //! Sets the image to use as the output for all esm passes. This is needed so multiple pipelines in a scene can share the same resource.
             void SetAtlasAttachmentImage(Data::Instance<RPI::AttachmentImage> atlasAttachmentIamge);
 
-            void QueueAddChild(RPI::Ptr<Pass> pass);
+            //! Sets the image static casters of cached shadows are rendered into. Passes rendering cached shadows restore from it each frame.
+            void SetCacheAtlasAttachmentImage(Data::Instance<RPI::AttachmentImage> cacheAtlasAttachmentImage);
+
+            //! Queues a child pass to be added. If insertFirst is true it is scheduled before all existing children.
+            void QueueAddChild(RPI::Ptr<Pass> pass, bool insertFirst = false);
             void QueueRemoveChild(RPI::Ptr<Pass> pass);
 
         private:
@@ -48,11 +52,13 @@ namespace AZ
             RHI::DrawListTag m_drawListTag;
             RPI::PipelineViewTag m_pipelineViewTag;
             Data::Instance<RPI::AttachmentImage> m_atlasAttachmentImage;
+            Data::Instance<RPI::AttachmentImage> m_cacheAtlasAttachmentImage;
 
             struct PassAddRemove
             {
                 RPI::Ptr<Pass> m_pass;
                 bool m_isRemoval;
+                bool m_insertFirst = false;
             };
             AZStd::vector<PassAddRemove> m_passesToAddOrRemove;
 
@@ -141,6 +141,11 @@ namespace AZ
             }
         }
 
+        void QuadLightFeatureProcessor::GetSceneDataAccess(SceneDataAccess& access) const
+        {
+            access.m_reads.push_back(MeshCommon::CullableBoundsName);
+        }
+
         void QuadLightFeatureProcessor::Render(const QuadLightFeatureProcessor::RenderPacket& packet)
         {
             AZ_PROFILE_SCOPE(RPI, "QuadLightFeatureProcessor: Render");
@@ -37,6 +37,7 @@ namespace AZ
             void Activate() override;
             void Deactivate() override;
             void Simulate(const SimulatePacket& packet) override;
+            void GetSceneDataAccess(SceneDataAccess& access) const override;
             void Render(const RenderPacket& packet) override;
 
             // QuadLightFeatureProcessorInterface overrides ...
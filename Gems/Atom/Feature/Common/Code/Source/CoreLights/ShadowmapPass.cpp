@@ -30,11 +30,12 @@ namespace AZ
             m_overrideScissorSate = true;
         }
 
-        RPI::Ptr<Render::ShadowmapPass> ShadowmapPass::CreateWithPassRequest(const Name& passName, AZStd::shared_ptr<RPI::RasterPassData> passData)
+        RPI::Ptr<Render::ShadowmapPass> ShadowmapPass::CreateWithPassRequest(
+            const Name& passName, AZStd::shared_ptr<RPI::RasterPassData> passData, const Name& templateName)
         {
             // Create a pass request for the descriptor so we can connect it to the parent class input connections
             RPI::PassRequest childRequest;
-            childRequest.m_templateName = Name{ "ShadowmapPassTemplate" };
+            childRequest.m_templateName = templateName;
             childRequest.m_passName = passName;
 
             // Add a connection to the skinned mesh input
@@ -56,29 +57,57 @@ namespace AZ
 
         void ShadowmapPass::CreatePassTemplate()
         {
-            AZStd::shared_ptr<RPI::PassTemplate> m_childTemplate = AZStd::make_shared<RPI::PassTemplate>();
-            m_childTemplate->m_name = Name{ "ShadowmapPassTemplate" };
-            m_childTemplate->m_passClass = "ShadowmapPass";
-
-            m_childTemplate->m_slots.resize(2);
-            RPI::PassSlot& slot = m_childTemplate->m_slots[0];
-            slot.m_name = Name{ "Shadowmap" };
-            slot.m_slotType = RPI::PassSlotType::Output;
-            slot.m_scopeAttachmentUsage = RHI::ScopeAttachmentUsage::DepthStencil;
-
-            // This slot it used to create a connection between the skinned mesh compute pass and the cascade shadow map pass
-            RPI::PassSlot& skinnedMeshSlot = m_childTemplate->m_slots[1];
-            skinnedMeshSlot.m_name = Name{ "SkinnedMeshes" };
-            skinnedMeshSlot.m_slotType = RPI::PassSlotType::Input;
-            skinnedMeshSlot.m_scopeAttachmentUsage = RHI::ScopeAttachmentUsage::InputAssembly;
-
-            m_childTemplate->m_connections.resize(1);
-            RPI::PassConnection& connection = m_childTemplate->m_connections[0];
-            connection.m_localSlot = Name{ "Shadowmap" };
-            connection.m_attachmentRef.m_pass = Name{ "Parent" };
-            connection.m_attachmentRef.m_attachment = Name{ "Shadowmap" };
-
-            RPI::PassSystemInterface::Get()->AddPassTemplate(Name{ "ShadowmapPassTemplate" }, m_childTemplate);
+            auto createTemplate = [](const Name& templateName, const Name& parentShadowmapName)
+            {
+                AZStd::shared_ptr<RPI::PassTemplate> childTemplate = AZStd::make_shared<RPI::PassTemplate>();
+                childTemplate->m_name = templateName;
+                childTemplate->m_passClass = "ShadowmapPass";
+
+                childTemplate->m_slots.resize(2);
+                RPI::PassSlot& slot = childTemplate->m_slots[0];
+                slot.m_name = Name{ "Shadowmap" };
+                slot.m_slotType = RPI::PassSlotType::Output;
+                slot.m_scopeAttachmentUsage = RHI::ScopeAttachmentUsage::DepthStencil;
+
+                // This slot it used to create a connection between the skinned mesh compute pass and the cascade shadow map pass
+                RPI::PassSlot& skinnedMeshSlot = childTemplate->m_slots[1];
+                skinnedMeshSlot.m_name = Name{ "SkinnedMeshes" };
+                skinnedMeshSlot.m_slotType = RPI::PassSlotType::Input;
+                skinnedMeshSlot.m_scopeAttachmentUsage = RHI::ScopeAttachmentUsage::InputAssembly;
+
+                childTemplate->m_connections.resize(1);
+                RPI::PassConnection& connection = childTemplate->m_connections[0];
+                connection.m_localSlot = Name{ "Shadowmap" };
+                connection.m_attachmentRef.m_pass = Name{ "Parent" };
+                connection.m_attachmentRef.m_attachment = parentShadowmapName;
+
+                return childTemplate;
+            };
+
+            RPI::PassSystemInterface* passSystem = RPI::PassSystemInterface::Get();
+            passSystem->AddPassTemplate(Name{ "ShadowmapPassTemplate" }, createTemplate(Name{ "ShadowmapPassTemplate" }, Name{ "Shadowmap" }));
+
+            // Renders the static casters of a cached shadow into the parent's cache atlas.
+            passSystem->AddPassTemplate(
+                Name{ "StaticShadowmapPassTemplate" }, createTemplate(Name{ "StaticShadowmapPassTemplate" }, Name{ "ShadowmapCache" }));
+
+            // Restores a cached shadow from the parent's cache atlas, then renders the dynamic casters on top of it.
+            AZStd::shared_ptr<RPI::PassTemplate> cachedTemplate = createTemplate(Name{ "CachedShadowmapPassTemplate" }, Name{ "Shadowmap" });
+
+            RPI::PassSlot& cacheSlot = cachedTemplate->m_slots.emplace_back();
+            cacheSlot.m_name = Name{ "ShadowmapCache" };
+            cacheSlot.m_shaderInputName = Name{ "m_shadowmapCache" };
+            cacheSlot.m_slotType = RPI::PassSlotType::Input;
+            cacheSlot.m_scopeAttachmentUsage = RHI::ScopeAttachmentUsage::Shader;
+            cacheSlot.m_imageViewDesc = AZStd::make_shared<RHI::ImageViewDescriptor>();
+            cacheSlot.m_imageViewDesc->m_isArray = 1;
+
+            RPI::PassConnection& cacheConnection = cachedTemplate->m_connections.emplace_back();
+            cacheConnection.m_localSlot = Name{ "ShadowmapCache" };
+            cacheConnection.m_attachmentRef.m_pass = Name{ "Parent" };
+            cacheConnection.m_attachmentRef.m_attachment = Name{ "ShadowmapCache" };
+
+            passSystem->AddPassTemplate(Name{ "CachedShadowmapPassTemplate" }, cachedTemplate);
         }
 
         // --- Build Override ---
@@ -97,7 +126,22 @@ namespace AZ
 
             RPI::PassAttachmentBinding& binding = GetOutputBinding(0);
 
-            RPI::Ptr<RPI::PassAttachment> attachment = parentPass->GetOutputBinding(0).GetAttachment();
+            // The shadowmap slot is connected either to the parent's shadowmap atlas or to its static caster cache atlas.
+            Name parentSlotName = parentPass->GetOutputBinding(0).m_name;
+            if (m_template)
+            {
+                for (const RPI::PassConnection& connection : m_template->m_connections)
+                {
+                    if (connection.m_localSlot == binding.m_name)
+                    {
+                        parentSlotName = connection.m_attachmentRef.m_attachment;
+                        break;
+                    }
+                }
+            }
+
+            const RPI::PassAttachmentBinding* parentBinding = parentPass->FindAttachmentBinding(parentSlotName);
+            RPI::Ptr<RPI::PassAttachment> attachment = parentBinding ? parentBinding->GetAttachment() : nullptr;
             if (!attachment)
             {
                 AZ_Assert(false, "[ShadowmapPass %s] Cannot find shadowmap image attachment.", GetPathName().GetCStr());
@@ -118,6 +162,12 @@ namespace AZ
         void ShadowmapPass::SetArraySlice(uint16_t arraySlice)
         {
             m_arraySlice = arraySlice;
+
+            // Only passes restoring a cached shadow have a pass srg, which needs the slice to read from the cache atlas.
+            if (m_shaderResourceGroup)
+            {
+                m_shaderResourceGroup->SetConstant(m_arraySliceIndex, static_cast<uint32_t>(arraySlice));
+            }
         }
 
         void ShadowmapPass::SetClearEnabled(bool enabled)
@@ -140,6 +190,16 @@ namespace AZ
             m_forceRenderNextFrame = true;
         }
 
+        void ShadowmapPass::SetDynamicCasterPass(ShadowmapPass* dynamicCasterPass)
+        {
+            m_dynamicCasterPass = dynamicCasterPass;
+        }
+
+        void ShadowmapPass::SetSkipRender(bool skipRender)
+        {
+            m_skipRender = skipRender;
+        }
+
         void ShadowmapPass::SetViewportScissorFromImageSize(const RHI::Size& imageSize)
         {
             const RHI::Viewport viewport(
@@ -169,28 +229,51 @@ namespace AZ
         
         void ShadowmapPass::SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph)
         {
+            // A skipped shadowmap keeps the content of an earlier frame, so it must be loaded rather than cleared.
+            if (m_clearEnabled)
+            {
+                GetOutputBinding(0).m_unifiedScopeDesc.m_loadStoreAction.m_loadAction =
+                    m_skipRender ? RHI::AttachmentLoadAction::Load : RHI::AttachmentLoadAction::Clear;
+            }
+
             Base::SetupFrameGraphDependencies(frameGraph);
 
+            if (m_skipRender)
+            {
+                frameGraph.SetEstimatedItemCount(0);
+                return;
+            }
+
             // Override the estimated item count set by the base class. Draw item count is compared against
             // the last frame to detect cases where a moving object leaves the shadow frustum. It wouldn't
             // set m_casterMovedBit since its outside the view, but needs to trigger a re-render anyway.
+            bool skipRender = false;
             if (m_isStatic && !m_forceRenderNextFrame && m_lastFrameDrawCount == m_drawItemCount)
             {
                 const auto& views = m_pipeline->GetViews(GetPipelineViewTag());
                 if (!views.empty())
                 {
                     const RPI::ViewPtr& view = views.front();
-                    if (view && (view->GetOrFlags() & m_casterMovedBit.GetIndex()) == 0)
-                    {
-                        // Shadow is static and no casters moved since last frame.
-                        frameGraph.SetEstimatedItemCount(0);
-                    }
+                    // Shadow is static and no casters moved since last frame.
+                    skipRender = view && (view->GetOrFlags() & m_casterMovedBit.GetIndex()) == 0;
                 }
             }
+
+            if (skipRender)
+            {
+                frameGraph.SetEstimatedItemCount(0);
+            }
             else
             {
                 // Report + 1 to make room for the clear draw packet.
                 frameGraph.SetEstimatedItemCount(static_cast<uint32_t>(m_drawListView.size() + 1));
+
+                if (m_dynamicCasterPass)
+                {
+                    // The cache atlas changed, so the dynamic casters need to be composited on top of it again.
+                    // The dynamic caster pass is scheduled after this one, so it picks this up in the same frame.
+                    m_dynamicCasterPass->m_forceRenderNextFrame = true;
+                }
             }
         }
 
@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <Atom/RHI.Reflect/ShaderInputNameIndex.h>
 #include <Atom/RHI.Reflect/Size.h>
 #include <Atom/RHI/DrawPacket.h>
 #include <Atom/RPI.Public/Pass/RasterPass.h>
@@ -34,12 +35,15 @@ namespace AZ
 
             static RPI::Ptr<ShadowmapPass> Create(const RPI::PassDescriptor& descriptor);
 
-            // Creates a common pass template for the child shadowmap passes.
+            // Creates the common pass templates for the child shadowmap passes.
             static void CreatePassTemplate();
 
-            //! Creates a pass descriptor from the input, using the ShadowmapPassTemplate, and adds a pass request to connect to the parent pass.
-            //! This function assumes the parent pass has a SkinnedMeshes input slot
-            static RPI::Ptr<ShadowmapPass> CreateWithPassRequest(const Name& passName, AZStd::shared_ptr<RPI::RasterPassData> passData);
+            //! Creates a pass descriptor from the input, using the given template, and adds a pass request to connect to the parent pass.
+            //! This function assumes the parent pass has a SkinnedMeshes input slot.
+            //! StaticShadowmapPassTemplate renders into the parent's ShadowmapCache slot, and CachedShadowmapPassTemplate reads from it,
+            //! so both require the parent pass to have a ShadowmapCache slot.
+            static RPI::Ptr<ShadowmapPass> CreateWithPassRequest(
+                const Name& passName, AZStd::shared_ptr<RPI::RasterPassData> passData, const Name& templateName = Name{ "ShadowmapPassTemplate" });
 
             //! This updates array slice for this shadowmap.
             void SetArraySlice(uint16_t arraySlice);
@@ -56,6 +60,13 @@ namespace AZ
             //! When the shadow is static, this forces the shadow to still re-render next frame (due to the light moving for instance)
             void ForceRenderNextFrame();
 
+            //! Sets the pass that composites dynamic casters on top of the static casters rendered by this pass. It is forced
+            //! to re-render whenever this pass re-renders. This pass must be scheduled before the dynamic caster pass.
+            void SetDynamicCasterPass(ShadowmapPass* dynamicCasterPass);
+
+            //! Skips rendering this frame and keeps the content rendered in an earlier frame, which requires the shadowmap image to persist.
+            void SetSkipRender(bool skipRender);
+
             //! This update viewport and scissor for this shadowmap from the given image size.
             void SetViewportScissorFromImageSize(const RHI::Size& imageSize);
 
@@ -86,9 +97,12 @@ namespace AZ
             RHI::ConstPtr<RHI::DrawPacket> m_clearShadowDrawPacket;
             RHI::DrawItemProperties m_clearShadowDrawItemProperties;
             RHI::Handle<uint32_t> m_casterMovedBit;
+            RHI::ShaderInputNameIndex m_arraySliceIndex = "m_arraySlice";
+            ShadowmapPass* m_dynamicCasterPass = nullptr;
             uint16_t m_arraySlice = 0;
             bool m_clearEnabled = true;
             bool m_isStatic = false;
+            bool m_skipRender = false;
             uint32_t m_lastFrameDrawCount = 0;
             mutable bool m_forceRenderNextFrame = false;
         };
@@ -152,14 +152,42 @@ namespace AZ
             return GetStreamingImageAsset(materialAsset, GetMapName(DecalMapType_Diffuse)).IsReady();
         }
 
+        void DecalTextureArray::SetMipBias(const uint16_t mipBias)
+        {
+            if (mipBias == m_mipBias)
+            {
+                return;
+            }
+
+            m_mipBias = mipBias;
+            m_mipBiasChanged = true;
+            Pack();
+        }
+
+        uint16_t DecalTextureArray::GetMipBias() const
+        {
+            return m_mipBias;
+        }
+
+        uint16_t DecalTextureArray::GetSourceMipLevels() const
+        {
+            return m_sourceMipLevels;
+        }
+
+        uint16_t DecalTextureArray::GetClampedMipBias(const DecalMapType mapType) const
+        {
+            return AZStd::min<uint16_t>(m_mipBias, GetNumMipLevels(mapType) - 1);
+        }
+
         AZ::Data::Asset<AZ::RPI::ImageMipChainAsset> DecalTextureArray::BuildPackedMipChainAsset(const DecalMapType mapType, const size_t numTexturesToCreate)
         {
             RPI::ImageMipChainAssetCreator assetCreator;
+            const uint32_t mipBias = GetClampedMipBias(mapType);
             const uint32_t mipLevels = GetNumMipLevels(mapType);
 
-            assetCreator.Begin(Data::AssetId(AZ::Uuid::CreateRandom()), aznumeric_cast<uint16_t>(mipLevels), aznumeric_cast<uint16_t>(numTexturesToCreate));
+            assetCreator.Begin(Data::AssetId(AZ::Uuid::CreateRandom()), aznumeric_cast<uint16_t>(mipLevels - mipBias), aznumeric_cast<uint16_t>(numTexturesToCreate));
 
-            for (uint32_t mipLevel = 0; mipLevel < mipLevels; ++mipLevel)
+            for (uint32_t mipLevel = mipBias; mipLevel < mipLevels; ++mipLevel)
             {
                 const auto& layout = GetLayout(mapType, mipLevel);
                 assetCreator.BeginMip(layout);
@@ -180,12 +208,12 @@ namespace AZ
         }
 
         RHI::ImageDescriptor DecalTextureArray::CreatePackedImageDescriptor(
-            const DecalMapType mapType, const uint16_t arraySize, const uint16_t mipLevels) const
+            const DecalMapType mapType, const uint16_t arraySize, const uint16_t mipLevels, const uint16_t mipBias) const
         {
-            const RHI::Size imageDimensions = GetImageDimensions(mapType);
+            const RHI::Size imageDimensions = GetImageDimensions(mapType).GetReducedMip(mipBias);
             RHI::ImageDescriptor imageDescriptor = RHI::ImageDescriptor::Create2DArray(
                 RHI::ImageBindFlags::ShaderRead, imageDimensions.m_width, imageDimensions.m_height, arraySize, GetFormat(mapType));
-            imageDescriptor.m_mipLevels = mipLevels;
+            imageDescriptor.m_mipLevels = mipLevels - mipBias;
             return imageDescriptor;
         }
 
@@ -200,6 +228,8 @@ namespace AZ
                 return;
             }
 
+            // Build all the arrays before replacing the packed ones, so a repack for a new mip bias doesn't leave a gap
+            AZStd::array<Data::Instance<RPI::StreamingImage>, DecalMapType_Num> textureArrayPacked;
             const size_t numTexturesToCreate = m_materials.array_size();
             for (int i = 0; i < DecalMapType_Num; ++i)
             {
@@ -207,7 +237,6 @@ namespace AZ
                 if (!AreAllTextureMapsPresent(mapType))
                 {
                     AZ_Warning("DecalTextureArray", false, "Missing decal texture maps for %s. Please make sure all maps of this type are present.\n", GetMapName(mapType).GetCStr());
-                    m_textureArrayPacked[i] = nullptr;
                     continue;
                 }
 
@@ -219,17 +248,20 @@ namespace AZ
                 assetCreator.Begin(Data::AssetId(Uuid::CreateRandom()));
                 assetCreator.SetPoolAssetId(GetImagePoolId());
                 assetCreator.SetFlags(RPI::StreamingImageFlags::None);
-                assetCreator.SetImageDescriptor(
-                    CreatePackedImageDescriptor(mapType, aznumeric_cast<uint16_t>(numTexturesToCreate), GetNumMipLevels(mapType)));
+                assetCreator.SetImageDescriptor(CreatePackedImageDescriptor(
+                    mapType, aznumeric_cast<uint16_t>(numTexturesToCreate), GetNumMipLevels(mapType), GetClampedMipBias(mapType)));
                 assetCreator.SetImageViewDescriptor(imageViewDescriptor);
                 assetCreator.AddMipChainAsset(*mipChainAsset);
                 Data::Asset<RPI::StreamingImageAsset> packedAsset;
                 const bool createdOk = assetCreator.End(packedAsset);
                 AZ_Error("TextureArrayData", createdOk, "Pack() call failed.");
-                m_textureArrayPacked[i] = createdOk ? RPI::StreamingImage::FindOrCreate(packedAsset) : nullptr;
-
+                textureArrayPacked[i] = createdOk ? RPI::StreamingImage::FindOrCreate(packedAsset) : nullptr;
             }
 
+            m_textureArrayPacked = AZStd::move(textureArrayPacked);
+            m_sourceMipLevels = GetNumMipLevels(DecalMapType_Diffuse);
+            m_mipBiasChanged = false;
+
             // Free unused memory
             ClearAssets();
         }
@@ -379,7 +411,7 @@ namespace AZ
                 return false;
 
             // We pack all diffuse/normal/etc in one go, so just check to see if the diffusemaps need packing
-            return m_textureArrayPacked[DecalMapType_Diffuse] == nullptr;
+            return m_textureArrayPacked[DecalMapType_Diffuse] == nullptr || m_mipBiasChanged;
         }
 
     }
@@ -57,6 +57,14 @@ namespace AZ
             // often different (BC5 for normals, BC7 for diffuse, etc)
             const Data::Instance<RPI::StreamingImage>& GetPackedTexture(const DecalMapType mapType) const;
 
+            // Sets how many of the most detailed mips are left out of the packed texture arrays, and repacks them if it changed.
+            // The current packed textures stay in use until the repacked ones are ready.
+            void SetMipBias(const uint16_t mipBias);
+            uint16_t GetMipBias() const;
+
+            // The number of mips of the source textures, known once the array has been packed. 0 before that.
+            uint16_t GetSourceMipLevels() const;
+
             static bool IsValidDecalMaterial(RPI::MaterialAsset& materialAsset);
 
         private:
@@ -75,7 +83,10 @@ namespace AZ
 
             // packs the contents of the source images into a texture array readable by the GPU and returns it
             AZ::Data::Asset<AZ::RPI::ImageMipChainAsset> BuildPackedMipChainAsset(const DecalMapType mapType, const size_t numTexturesToCreate);
-            RHI::ImageDescriptor CreatePackedImageDescriptor(const DecalMapType mapType, const uint16_t arraySize, const uint16_t mipLevels) const;
+            RHI::ImageDescriptor CreatePackedImageDescriptor(const DecalMapType mapType, const uint16_t arraySize, const uint16_t mipLevels, const uint16_t mipBias) const;
+
+            // The mip bias clamped so that at least the least detailed mip of the given map type is packed
+            uint16_t GetClampedMipBias(const DecalMapType mapType) const;
 
             uint16_t GetNumMipLevels(const DecalMapType mapType) const;
             RHI::Size GetImageDimensions(const DecalMapType mapType) const;
@@ -101,6 +112,11 @@ namespace AZ
             AZStd::array<Data::Instance<RPI::StreamingImage>, DecalMapType_Num> m_textureArrayPacked;
              
             AZStd::unordered_set<AZ::Data::AssetId> m_assetsCurrentlyLoading;
+
+            uint16_t m_mipBias = 0;
+            uint16_t m_sourceMipLevels = 0;
+            // Set when the mip bias changed since the last pack, the packed textures are still valid until then
+            bool m_mipBiasChanged = false;
         };
 
     } // namespace Render
@@ -12,6 +12,7 @@
 #include <Atom/RPI.Public/Material/Material.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Public/View.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/Quaternion.h>
 #include <AzCore/std/containers/span.h>
 #include <Atom/RPI.Public/Image/ImageSystemInterface.h>
@@ -24,8 +25,19 @@ namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(bool, r_decalTextureStreaming, true, nullptr, ConsoleFunctorFlags::Null,
+            "Pack decal texture arrays without the mips that are more detailed than their decals need at their current on-screen size.");
+        AZ_CVAR(uint32_t, r_decalTextureStreamingScreenHeight, 2160, nullptr, ConsoleFunctorFlags::Null,
+            "The screen height in pixels used to estimate how many texels of a decal texture are visible on screen.");
+
         namespace
         {
+            // Texture arrays are never reduced below this size, so decals that come into view have a usable mip right away
+            constexpr float MinStreamedTextureSize = 64.0f;
+            // Less detail is only packed after the decals needed it for this many frames, so decals at the threshold
+            // between two mips don't cause a repack every frame
+            constexpr uint32_t FramesBeforeReducingDetail = 300;
+
             static AZ::RHI::Size GetTextureSizeFromMaterialAsset(AZ::RPI::MaterialAsset* materialAsset)
             {
                 for (const auto& elem : materialAsset->GetPropertyValues())
@@ -154,6 +166,8 @@ namespace AZ
             AZ_PROFILE_SCOPE(AzRender, "DecalTextureArrayFeatureProcessor: Simulate");
             AZ_UNUSED(packet);
 
+            UpdateTextureArrayMipBias();
+
             if (m_deviceBufferNeedsUpdate)
             {
                 m_decalBufferHandler.UpdateBuffer(m_decalData.GetDataVector());
@@ -171,6 +185,99 @@ namespace AZ
                 m_decalBufferHandler.UpdateSrg(view->GetShaderResourceGroup().get());
                 SetPackedTexturesToSrg(view);
             }
+
+            if (r_decalTextureStreaming)
+            {
+                UpdateRequiredTexels(packet.m_views);
+            }
+        }
+
+        void DecalTextureArrayFeatureProcessor::UpdateRequiredTexels(const AZStd::vector<RPI::ViewPtr>& views)
+        {
+            for (TextureArrayStreamingState& state : m_textureArrayStreamingStates)
+            {
+                state.m_requiredTexels = 0.0f;
+            }
+
+            const float screenHeight = aznumeric_cast<float>(static_cast<uint32_t>(r_decalTextureStreamingScreenHeight));
+            for (const RPI::ViewPtr& view : views)
+            {
+                // Decals are only drawn by the forward pass, the shadow and other views don't sample them
+                if ((view->GetUsageFlags() & RPI::View::UsageCamera) == 0)
+                {
+                    continue;
+                }
+
+                const AZ::Vector3 viewPosition = view->GetViewToWorldMatrix().GetTranslation();
+                const float projectionScale = view->GetViewToClipMatrix().GetElement(1, 1);
+                for (const DecalData& decal : m_decalData.GetDataVector())
+                {
+                    if (decal.m_textureArrayIndex >= NumTextureArrays)
+                    {
+                        continue;
+                    }
+
+                    // Measure the size of the decal on screen from the nearest point of its bounding sphere
+                    const AZ::Vector3 position = AZ::Vector3::CreateFromFloat3(decal.m_position.data());
+                    const float radius = AZ::Vector3::CreateFromFloat3(decal.m_halfSize.data()).GetLength();
+                    const float distance = AZ::GetMax(position.GetDistance(viewPosition) - radius, 0.01f);
+                    const float texels = radius * projectionScale / distance * screenHeight;
+
+                    float& requiredTexels = m_textureArrayStreamingStates[decal.m_textureArrayIndex].m_requiredTexels;
+                    requiredTexels = AZ::GetMax(requiredTexels, texels);
+                }
+            }
+        }
+
+        void DecalTextureArrayFeatureProcessor::UpdateTextureArrayMipBias()
+        {
+            for (int iter = m_textureArrayList.begin(); iter != -1; iter = m_textureArrayList.next(iter))
+            {
+                const RHI::Size& textureSize = m_textureArrayList[iter].first;
+                DecalTextureArray& textureArray = m_textureArrayList[iter].second;
+                TextureArrayStreamingState& state = m_textureArrayStreamingStates[iter];
+
+                const uint16_t sourceMipLevels = textureArray.GetSourceMipLevels();
+                if (!r_decalTextureStreaming || sourceMipLevels == 0)
+                {
+                    // Not packed yet, or streaming is disabled so the arrays are packed with all their mips
+                    state.m_framesNeedingLessDetail = 0;
+                    if (sourceMipLevels > 0)
+                    {
+                        textureArray.SetMipBias(0);
+                    }
+                    continue;
+                }
+
+                // Find the least detailed mip that still has as many texels as the decals cover on screen
+                const float textureTexels = aznumeric_cast<float>(AZ::GetMax(textureSize.m_width, textureSize.m_height));
+                const float requiredTexels = AZ::GetMax(state.m_requiredTexels, MinStreamedTextureSize);
+                uint16_t targetMipBias = 0;
+                while (targetMipBias + 1 < sourceMipLevels && textureTexels / aznumeric_cast<float>(2u << targetMipBias) >= requiredTexels)
+                {
+                    ++targetMipBias;
+                }
+
+                const uint16_t currentMipBias = textureArray.GetMipBias();
+                if (targetMipBias < currentMipBias)
+                {
+                    // More detail is needed, repack right away
+                    state.m_framesNeedingLessDetail = 0;
+                    textureArray.SetMipBias(targetMipBias);
+                }
+                else if (targetMipBias > currentMipBias)
+                {
+                    if (++state.m_framesNeedingLessDetail >= FramesBeforeReducingDetail)
+                    {
+                        state.m_framesNeedingLessDetail = 0;
+                        textureArray.SetMipBias(targetMipBias);
+                    }
+                }
+                else
+                {
+                    state.m_framesNeedingLessDetail = 0;
+                }
+            }
         }
 
         void DecalTextureArrayFeatureProcessor::SetDecalData(const DecalHandle handle, const DecalData& data)
@@ -416,6 +523,7 @@ namespace AZ
                 DecalTextureArray decalTextureArray;
                 textureIndex = decalTextureArray.AddMaterial(materialAsset->GetId());
                 textureArrayIndex = m_textureArrayList.push_front(AZStd::make_pair(textureSize, decalTextureArray));
+                m_textureArrayStreamingStates[textureArrayIndex] = {};
             }
             else
             {
@@ -521,6 +629,8 @@ namespace AZ
 
                 if (textureArray.NumMaterials() == 0)
                 {
+                    // Reset the slot so its packed textures are released now rather than when the slot is reused
+                    m_textureArrayList[decalLocation.textureArrayIndex] = {};
                     m_textureArrayList.erase(decalLocation.textureArrayIndex);
                 }
             }
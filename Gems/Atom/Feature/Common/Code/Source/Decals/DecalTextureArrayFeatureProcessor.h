@@ -109,6 +109,15 @@ namespace AZ
                 int m_useCount = 0;
             };
 
+            // Tracks how detailed a texture array needs to be for the on-screen size of its decals
+            struct TextureArrayStreamingState
+            {
+                // The largest on-screen size of the decals using the array, in pixels, measured in the last Render()
+                float m_requiredTexels = 0.0f;
+                // The number of frames the decals needed less detail than the array provides
+                uint32_t m_framesNeedingLessDetail = 0;
+            };
+
             void OnAssetReady(Data::Asset<Data::AssetData> asset) override;
 
             void SetPackedTexturesToSrg(const RPI::ViewPtr& view);
@@ -125,6 +134,11 @@ namespace AZ
             AZ::Data::AssetId GetMaterialUsedByDecal(const DecalHandle handle) const;
             void PackTexureArrays();
 
+            // Measures the on-screen size of the decals using each texture array in the given views
+            void UpdateRequiredTexels(const AZStd::vector<RPI::ViewPtr>& views);
+            // Repacks the texture arrays without the mips that are more detailed than their decals need
+            void UpdateTextureArrayMipBias();
+
             IndexedDataVector<DecalData> m_decalData;
 
             // Texture arrays are organized one per texture size permutation.
@@ -135,6 +149,7 @@ namespace AZ
             IndexableList < AZStd::pair < AZ::RHI::Size, DecalTextureArray>> m_textureArrayList;
 
             AZStd::array<AZStd::array<RHI::ShaderInputImageIndex, DecalMapType_Num>, NumTextureArrays> m_decalTextureArrayIndices;
+            AZStd::array<TextureArrayStreamingState, NumTextureArrays> m_textureArrayStreamingStates;
             GpuBufferHandler m_decalBufferHandler;
 
             AsyncLoadTracker<DecalHandle> m_materialLoadTracker;
@@ -17,6 +17,7 @@
 #include <Atom/RHI/RHIUtils.h>
 #include <Atom/RPI.Public/AssetQuality.h>
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Model/ModelLodStreamingController.h>
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/Model/ModelTagSystemComponent.h>
 #include <Atom/RPI.Public/RPIUtils.h>
@@ -217,6 +218,8 @@ namespace AZ
 
             // If the instancing cvar has changed, we need to re-initalize the ModelDataInstances
             CheckForInstancingCVarChange();
+            // Models which streamed lods in or out need new draw packets
+            CheckForModelLodResidencyChange();
 
             AZStd::vector<Job*> initJobQueue = CreateInitJobQueue();
             AZStd::vector<Job*> updateCullingJobQueue = CreateUpdateCullingJobQueue();
@@ -244,6 +247,11 @@ namespace AZ
             m_forceRebuildDrawPackets = false;
         }
 
+        void MeshFeatureProcessor::GetSceneDataAccess(SceneDataAccess& access) const
+        {
+            access.m_writes.push_back(MeshCommon::CullableBoundsName);
+        }
+
         void MeshFeatureProcessor::CheckForInstancingCVarChange()
         {
             if (m_enableMeshInstancing != r_meshInstancingEnabled || m_enableMeshInstancingForTransparentObjects != r_meshInstancingEnabledForTransparentObjects)
@@ -258,6 +266,25 @@ namespace AZ
             }
         }
 
+        void MeshFeatureProcessor::CheckForModelLodResidencyChange()
+        {
+            const RPI::ModelLodStreamingController* lodStreamingController = RPI::ModelLodStreamingController::Get();
+            if (!lodStreamingController || lodStreamingController->GetResidencyChangeCount() == m_lodResidencyChangeCount)
+            {
+                return;
+            }
+            m_lodResidencyChangeCount = lodStreamingController->GetResidencyChangeCount();
+
+            for (auto& modelDataInstance : m_modelData)
+            {
+                if (modelDataInstance.m_model && !modelDataInstance.m_flags.m_needsInit &&
+                    modelDataInstance.m_model->GetMostDetailedResidentLodIndex().GetIndex() != modelDataInstance.m_mostDetailedResidentLod)
+                {
+                    modelDataInstance.ReInit(this);
+                }
+            }
+        }
+
         AZStd::vector<Job*> MeshFeatureProcessor::CreatePerInstanceGroupJobQueue()
         {
             const auto instanceManagerRanges = m_meshInstanceManager.GetParallelRanges();
@@ -458,49 +485,36 @@ namespace AZ
                 ResizePerViewInstanceVectors(packet.m_views.size());
 
                 {
-                    // Iterate over all of the visible objects for each view, and perform the first stage of the bucket sort
-                    // where each visible object is sorted into its bucket
-                    AZ_PROFILE_SCOPE(RPI, "MeshFeatureProcessor: Add Visible Objects to Buckets");
-                    AZ::TaskGraphEvent addVisibleObjectsToBucketsTGEvent{ "AddVisibleObjectsToBuckets Wait" };
-                    AZ::TaskGraph addVisibleObjectsToBucketsTG{ "AddVisibleObjectsToBuckets" };
-                    for (size_t viewIndex = 0; viewIndex < packet.m_views.size(); ++viewIndex)
-                    {
-                        AddVisibleObjectsToBuckets(addVisibleObjectsToBucketsTG, viewIndex, packet.m_views[viewIndex]);
-                    }
+                    // The instancing work of each view only depends on the earlier stages of the same view, so all of the stages
+                    // of all of the views go in one task graph. A view can build its draw calls while others are still filling their buckets.
+                    AZ_PROFILE_SCOPE(RPI, "MeshFeatureProcessor: Build Instance Buffers and Draw Calls");
+                    AZ::TaskGraphEvent instancingTGEvent{ "MeshInstancing Wait" };
+                    AZ::TaskGraph instancingTG{ "MeshInstancing" };
 
-                    addVisibleObjectsToBucketsTG.Submit(&addVisibleObjectsToBucketsTGEvent);
-                    addVisibleObjectsToBucketsTGEvent.Wait();
-                }
+                    static const AZ::TaskDescriptor assignInstanceDataOffsetsTaskDescriptor{
+                        "AZ::Render::MeshFeatureProcessor::OnEndCulling - assign instance data offsets", "Graphics"
+                    };
 
-                {
-                    // Now that the buckets have been filled, create a task for each bucket to sort each individual bucket in parallel
-                    AZ_PROFILE_SCOPE(RPI, "MeshFeatureProcessor: Sort Buckets");
-                    AZ::TaskGraphEvent sortInstanceBufferBucketsTGEvent{ "SortInstanceBufferBuckets Wait" };
-                    AZ::TaskGraph sortInstanceBufferBucketsTG{ "SortInstanceBufferBuckets" };
                     for (size_t viewIndex = 0; viewIndex < packet.m_views.size(); ++viewIndex)
                     {
-                        SortInstanceBufferBuckets(sortInstanceBufferBucketsTG, viewIndex);
-                    }
+                        // Once every visible object of the view is in its bucket, the instance data range of each bucket is known
+                        AZ::TaskToken bucketsFilledToken = instancingTG.AddTask(
+                            assignInstanceDataOffsetsTaskDescriptor,
+                            [this, viewIndex]()
+                            {
+                                AssignInstanceDataOffsets(viewIndex);
+                            });
 
-                    // submit the tasks
-                    sortInstanceBufferBucketsTG.Submit(&sortInstanceBufferBucketsTGEvent);
-                    sortInstanceBufferBucketsTGEvent.Wait();
-                }
+                        // Iterate over all of the visible objects for the view, and perform the first stage of the bucket sort
+                        // where each visible object is sorted into its bucket
+                        AddVisibleObjectsToBuckets(instancingTG, viewIndex, packet.m_views[viewIndex], bucketsFilledToken);
 
-                {
-                    // For each bucket, create a task to iterate over the instance buffer to calculate the offset and count
-                    // to use with each instanced draw call, and add the draw calls to the view.
-                    AZ_PROFILE_SCOPE(RPI, "MeshFeatureProcessor: Build Instance Buffer and Draw Calls");
-                    AZ::TaskGraphEvent buildInstanceBufferTGEvent{ "BuildInstanceBuffer Wait" };
-                    AZ::TaskGraph buildInstanceBufferTG{ "BuildInstanceBuffer" };
-                    for (size_t viewIndex = 0; viewIndex < packet.m_views.size(); ++viewIndex)
-                    {
-                        BuildInstanceBufferAndDrawCalls(buildInstanceBufferTG, viewIndex, packet.m_views[viewIndex]);
+                        // Then sort each bucket, and add the draw calls of its instance groups to the view
+                        SortBucketsAndBuildDrawCalls(instancingTG, viewIndex, packet.m_views[viewIndex], bucketsFilledToken);
                     }
 
-                    // submit the tasks
-                    buildInstanceBufferTG.Submit(&buildInstanceBufferTGEvent);
-                    buildInstanceBufferTGEvent.Wait();
+                    instancingTG.Submit(&instancingTGEvent);
+                    instancingTGEvent.Wait();
                 }
 
                 for (size_t viewIndex = 0; viewIndex < packet.m_views.size(); ++viewIndex)
@@ -606,7 +620,7 @@ namespace AZ
         }
 
         void MeshFeatureProcessor::AddVisibleObjectsToBuckets(
-            TaskGraph& addVisibleObjectsToBucketsTG, size_t viewIndex, const RPI::ViewPtr& view)
+            TaskGraph& addVisibleObjectsToBucketsTG, size_t viewIndex, const RPI::ViewPtr& view, TaskToken& bucketsFilledToken)
         {
             AZ_PROFILE_SCOPE(RPI, "MeshFeatureProcessor: AddVisibleObjectsToBuckets");
             size_t visibleObjectCount = view->GetVisibleObjectList().size();
@@ -627,9 +641,9 @@ namespace AZ
                 {
                     size_t batchStart = batchIndex * batchSize;
                     // If we're in the last batch, we just get the remaining objects
-                    size_t currentBatchCount = batchIndex == batchCount - 1 ? visibleObjectCount % batchSize : batchSize;
+                    size_t currentBatchCount = AZStd::min(batchSize, visibleObjectCount - batchStart);
 
-                    addVisibleObjectsToBucketsTG.AddTask(
+                    AZ::TaskToken addVisibleObjectsToBucketsToken = addVisibleObjectsToBucketsTG.AddTask(
                         addVisibleObjectsToBucketsTaskDescriptor,
                         [this, view, viewIndex, batchStart, currentBatchCount]()
                         {
@@ -663,40 +677,28 @@ namespace AZ
                                 }
                             }
                         });
+                    addVisibleObjectsToBucketsToken.Precedes(bucketsFilledToken);
                 }
             }
         }
 
-        void MeshFeatureProcessor::SortInstanceBufferBuckets(TaskGraph& sortInstanceBufferBucketsTG, size_t viewIndex)
+        void MeshFeatureProcessor::AssignInstanceDataOffsets(size_t viewIndex)
         {
-            AZ_PROFILE_SCOPE(RPI, "MeshFeatureProcessor: SortInstanceBufferBuckets");
+            AZ_PROFILE_SCOPE(RPI, "MeshFeatureProcessor: AssignInstanceDataOffsets");
+            AZStd::vector<TransformServiceFeatureProcessorInterface::ObjectId>& perViewInstanceData = m_perViewInstanceData[viewIndex];
             AZStd::vector<InstanceGroupBucket>& currentViewInstanceGroupBuckets = m_perViewInstanceGroupBuckets[viewIndex];
 
-            // Populate a task graph where each task is responsible for sorting a bucket.
-            static const AZ::TaskDescriptor sortInstanceBufferBucketsTaskDescriptor{
-                "AZ::Render::MeshFeatureProcessor::OnEndCulling - sort instance data buckets", "Graphics"
-            };
-
+            // At this point, inserting into the buckets is complete, so m_currentElementIndex is the count of all visible meshes in each bucket.
+            uint32_t instanceDataOffset = 0;
             for (InstanceGroupBucket& instanceGroupBucket : currentViewInstanceGroupBuckets)
             {
-                // We're creating one task per bucket here. That is ideal when the buckets are all close to the same size,
-                // but it can lead to an imperfect distribution of work if one bucket has more objects than any of the others.
-                // If this becomes a performance bottleneck, it could be alleviated by adding an heuristic to sort any overfull
-                // buckets using a parallel std sort rather than using a single task, or by breaking it up into smaller buckets.
-                sortInstanceBufferBucketsTG.AddTask(
-                    sortInstanceBufferBucketsTaskDescriptor,
-                    [&instanceGroupBucket]()
-                    {
-                        // Note: we've previously resized m_sortInstanceData to conservatively fit all possible visible meshes for the bucket,
-                        // which allowed us to use an atomic index for parallel lock free insertion.
-                        // As a result, m_sortInstanceData it has a greater size than the actual count.
-                        // We only care about the real visible objects, so cut off the last unused elements here
-                        instanceGroupBucket.m_sortInstanceData.resize(instanceGroupBucket.m_currentElementIndex);
-
-                        // Sort within the bucket
-                        std::sort(instanceGroupBucket.m_sortInstanceData.begin(), instanceGroupBucket.m_sortInstanceData.end());
-                    });
+                instanceGroupBucket.m_instanceDataOffset = instanceDataOffset;
+                instanceDataOffset += instanceGroupBucket.m_currentElementIndex;
             }
+
+            // instanceDataOffset now represents the total count of visible instances in this view.
+            // Re-size the instance data buffer so that the bucket tasks can fill their ranges in parallel
+            perViewInstanceData.resize_no_construct(instanceDataOffset);
         }
 
         static void AddInstancedDrawPacketToView(
@@ -754,66 +756,72 @@ namespace AZ
             view->AddDrawPacket(clonedDrawPacket.get(), averageDepth);
         }
 
-        void MeshFeatureProcessor::BuildInstanceBufferAndDrawCalls(
-            TaskGraph& buildInstanceBufferTG, size_t viewIndex, const RPI::ViewPtr& view)
+        void MeshFeatureProcessor::SortBucketsAndBuildDrawCalls(
+            TaskGraph& sortAndBuildTG, size_t viewIndex, const RPI::ViewPtr& view, TaskToken& bucketsFilledToken)
         {
             AZStd::vector<TransformServiceFeatureProcessorInterface::ObjectId>& perViewInstanceData = m_perViewInstanceData[viewIndex];
             AZStd::vector<InstanceGroupBucket>& currentViewInstanceGroupBuckets = m_perViewInstanceGroupBuckets[viewIndex];
 
-            uint32_t currentBatchStart = 0;
+            static const AZ::TaskDescriptor sortAndBuildTaskDescriptor{
+                "AZ::Render::MeshFeatureProcessor::OnEndCulling - sort instance data buckets and build draw calls", "Graphics"
+            };
+
             for (InstanceGroupBucket& instanceGroupBucket : currentViewInstanceGroupBuckets)
             {
-                if (instanceGroupBucket.m_currentElementIndex > 0)
-                {
-                    static const AZ::TaskDescriptor buildInstanceBufferTaskDescriptor{
-                        "AZ::Render::MeshFeatureProcessor::OnEndCulling - process instance data", "Graphics"
-                    };
-                    // Process data up to but not including actualEndOffset
-                    buildInstanceBufferTG.AddTask(
-                        buildInstanceBufferTaskDescriptor,
-                        [currentBatchStart,
-                        viewIndex,
-                        &view,
-                        &perViewInstanceData, &instanceGroupBucket]()
+                // We're creating one task per bucket here. That is ideal when the buckets are all close to the same size,
+                // but it can lead to an imperfect distribution of work if one bucket has more objects than any of the others.
+                // If this becomes a performance bottleneck, it could be alleviated by adding an heuristic to sort any overfull
+                // buckets using a parallel std sort rather than using a single task, or by breaking it up into smaller buckets.
+                AZ::TaskToken sortAndBuildToken = sortAndBuildTG.AddTask(
+                    sortAndBuildTaskDescriptor,
+                    [viewIndex, &view, &perViewInstanceData, &instanceGroupBucket]()
+                    {
+                        // Note: we've previously resized m_sortInstanceData to conservatively fit all possible visible meshes for the bucket,
+                        // which allowed us to use an atomic index for parallel lock free insertion.
+                        // As a result, m_sortInstanceData it has a greater size than the actual count.
+                        // We only care about the real visible objects, so cut off the last unused elements here
+                        instanceGroupBucket.m_sortInstanceData.resize(instanceGroupBucket.m_currentElementIndex);
+                        if (instanceGroupBucket.m_sortInstanceData.empty())
                         {
-                            ModelDataInstance::InstanceGroupHandle currentInstanceGroup =
-                                instanceGroupBucket.m_sortInstanceData.begin()->m_instanceGroupHandle;
-                            uint32_t instanceDataOffset = currentBatchStart;
-                            float accumulatedDepth = 0.0f;
-                            uint32_t instanceDataIndex = currentBatchStart;
-                            for (SortInstanceData& sortInstanceData : instanceGroupBucket.m_sortInstanceData)
-                            {
-                                // Anytime the instance group changes, submit a draw for the previous group
-                                if (sortInstanceData.m_instanceGroupHandle != currentInstanceGroup)
-                                {
-                                    AddInstancedDrawPacketToView(
-                                        view, viewIndex, currentInstanceGroup, accumulatedDepth, instanceDataOffset, instanceDataIndex);
+                            return;
+                        }
 
-                                    // Update the loop trackers
-                                    accumulatedDepth = 0.0f;
-                                    instanceDataOffset = instanceDataIndex;
-                                    currentInstanceGroup = sortInstanceData.m_instanceGroupHandle;
-                                }
-                                perViewInstanceData[instanceDataIndex] = sortInstanceData.m_objectId;
-                                accumulatedDepth += sortInstanceData.m_depth;
-                                instanceDataIndex++;
-                            }
+                        // Sort within the bucket
+                        std::sort(instanceGroupBucket.m_sortInstanceData.begin(), instanceGroupBucket.m_sortInstanceData.end());
 
-                            // Submit the last instance group
+                        // Iterate over the sorted bucket to fill its range of the instance buffer, and to calculate the offset and count
+                        // to use with each instanced draw call
+                        ModelDataInstance::InstanceGroupHandle currentInstanceGroup =
+                            instanceGroupBucket.m_sortInstanceData.begin()->m_instanceGroupHandle;
+                        uint32_t instanceDataOffset = instanceGroupBucket.m_instanceDataOffset;
+                        float accumulatedDepth = 0.0f;
+                        uint32_t instanceDataIndex = instanceGroupBucket.m_instanceDataOffset;
+                        for (SortInstanceData& sortInstanceData : instanceGroupBucket.m_sortInstanceData)
+                        {
+                            // Anytime the instance group changes, submit a draw for the previous group
+                            if (sortInstanceData.m_instanceGroupHandle != currentInstanceGroup)
                             {
                                 AddInstancedDrawPacketToView(
                                     view, viewIndex, currentInstanceGroup, accumulatedDepth, instanceDataOffset, instanceDataIndex);
+
+                                // Update the loop trackers
+                                accumulatedDepth = 0.0f;
+                                instanceDataOffset = instanceDataIndex;
+                                currentInstanceGroup = sortInstanceData.m_instanceGroupHandle;
                             }
-                        });
+                            perViewInstanceData[instanceDataIndex] = sortInstanceData.m_objectId;
+                            accumulatedDepth += sortInstanceData.m_depth;
+                            instanceDataIndex++;
+                        }
 
-                    // At this point, inserting into the bucket is already complete, so m_currentElementIndex represents the count of all visible meshes in this bucket.
-                    currentBatchStart += instanceGroupBucket.m_currentElementIndex;
-                }
+                        // Submit the last instance group
+                        {
+                            AddInstancedDrawPacketToView(
+                                view, viewIndex, currentInstanceGroup, accumulatedDepth, instanceDataOffset, instanceDataIndex);
+                        }
+                    });
+                bucketsFilledToken.Precedes(sortAndBuildToken);
             }
-
-            // currentBatchStart now represents the total count of visible instances in this view.
-            // Re-size the instance data buffer so that we can fill it with the tasks created above
-            perViewInstanceData.resize_no_construct(currentBatchStart);
         }
 
         void MeshFeatureProcessor::UpdateGPUInstanceBufferForView(size_t viewIndex, const RPI::ViewPtr& view)
@@ -951,6 +959,8 @@ namespace AZ
             meshDataHandle->m_meshLoader = AZStd::make_shared<ModelDataInstance::MeshLoader>(descriptor.m_modelAsset, &*meshDataHandle);
             meshDataHandle->m_flags.m_isAlwaysDynamic = descriptor.m_isAlwaysDynamic;
             meshDataHandle->m_flags.m_isDrawMotion = descriptor.m_isAlwaysDynamic;
+            meshDataHandle->m_cullable.m_cullData.m_hideFlags |=
+                descriptor.m_isAlwaysDynamic ? RPI::View::UsageShadowStaticCasters : RPI::View::UsageShadowDynamicCasters;
 
             if (descriptor.m_excludeFromReflectionCubeMaps)
             {
@@ -1235,6 +1245,11 @@ namespace AZ
             if (meshHandle.IsValid())
             {
                 meshHandle->m_flags.m_isAlwaysDynamic = isAlwaysDynamic;
+
+                // Always dynamic meshes are drawn on top of cached shadows every frame instead of being baked into the cache.
+                RPI::View::UsageFlags& hideFlags = meshHandle->m_cullable.m_cullData.m_hideFlags;
+                hideFlags &= ~(RPI::View::UsageShadowStaticCasters | RPI::View::UsageShadowDynamicCasters);
+                hideFlags |= isAlwaysDynamic ? RPI::View::UsageShadowStaticCasters : RPI::View::UsageShadowDynamicCasters;
             }
         }
 
@@ -1585,8 +1600,8 @@ namespace AZ
             }
             else
             {
-                // Static mesh, no cloth buffer present.
-                model = RPI::Model::FindOrCreate(modelAsset);
+                // Static mesh, no cloth buffer present. Its less detailed lods may be streamed in and out based on screen coverage.
+                model = RPI::Model::FindOrCreate(modelAsset, /*allowLodStreaming=*/true);
             }
             
             if (model)
@@ -1759,6 +1774,7 @@ namespace AZ
                 m_updateDrawPacketEventHandlersByLod.resize(modelLodCount);
             }
             
+            m_mostDetailedResidentLod = m_model->GetMostDetailedResidentLodIndex().GetIndex();
             for (size_t modelLodIndex = 0; modelLodIndex < modelLodCount; ++modelLodIndex)
             {
                 BuildDrawPacketList(meshFeatureProcessor, modelLodIndex);
@@ -1856,7 +1872,18 @@ namespace AZ
 
         void ModelDataInstance::BuildDrawPacketList(MeshFeatureProcessor* meshFeatureProcessor, size_t modelLodIndex)
         {
-            RPI::ModelLod& modelLod = *m_model->GetLods()[modelLodIndex];
+            const Data::Instance<RPI::ModelLod>& modelLodInstance = m_model->GetLods()[modelLodIndex];
+            if (!modelLodInstance)
+            {
+                // The lod isn't resident yet, it gets draw packets once it's streamed in, see CheckForModelLodResidencyChange()
+                if (!r_meshInstancingEnabled)
+                {
+                    m_drawPacketListsByLod[modelLodIndex].clear();
+                }
+                return;
+            }
+
+            RPI::ModelLod& modelLod = *modelLodInstance;
             const size_t meshCount = modelLod.GetMeshes().size();
             MeshInstanceManager& meshInstanceManager = meshFeatureProcessor->GetMeshInstanceManager();
 
@@ -2660,6 +2687,11 @@ namespace AZ
             lodData.m_lods.resize(modelLodCount);
             cullData.m_drawListMask.reset();
 
+            // The lods are indexed with the lod bias applied, so the first lod with draw packets is shifted by the bias as well.
+            // The culling requests the unbiased lod of streaming models, which may stream in more detail than needed but never less.
+            lodData.m_lodStreamingModel = m_model->IsLodStreamingEnabled() ? m_model.get() : nullptr;
+            lodData.m_mostDetailedResidentLod = aznumeric_cast<uint32_t>(m_mostDetailedResidentLod > m_lodBias ? m_mostDetailedResidentLod - m_lodBias : 0);
+
             const size_t lodCount = lodAssets.size();
 
             for (size_t lodIndex = 0; lodIndex < lodCount; ++lodIndex)
@@ -13,11 +13,14 @@
 #include <Atom/RPI.Public/Shader/Shader.h>
 #include <Atom/RPI.Public/Model/ModelLod.h>
 #include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
 #include <Atom/RPI.Public/RPIUtils.h>
 
 #include <Atom/RHI/Factory.h>
 #include <Atom/RHI/BufferView.h>
 
+#include <AzCore/Math/MathUtils.h>
+
 #include <limits>
 
 namespace AZ
@@ -26,15 +29,17 @@ namespace AZ
     {
         MorphTargetDispatchItem::MorphTargetDispatchItem(
             const AZStd::intrusive_ptr<MorphTargetInputBuffers> inputBuffers,
-            const MorphTargetComputeMetaData& morphTargetComputeMetaData,
+            const AZStd::vector<MorphTargetComputeMetaData>& morphTargetComputeMetaDatas,
             SkinnedMeshFeatureProcessor* skinnedMeshFeatureProcessor,
-            MorphTargetInstanceMetaData morphInstanceMetaData,
-            float morphDeltaIntegerEncoding)
+            const AZStd::vector<MorphTargetInstanceMetaData>& morphInstanceMetaDatas,
+            const AZStd::vector<float>& accumulatedDeltaIntegerEncodings)
             : m_inputBuffers(inputBuffers)
-            , m_morphTargetComputeMetaData(morphTargetComputeMetaData)
-            , m_morphInstanceMetaData(morphInstanceMetaData)
-            , m_accumulatedDeltaIntegerEncoding(morphDeltaIntegerEncoding)
+            , m_morphTargetComputeMetaDatas(morphTargetComputeMetaDatas)
+            , m_weights(morphTargetComputeMetaDatas.size(), 0.0f)
+            , m_morphInstanceMetaDatas(morphInstanceMetaDatas)
+            , m_accumulatedDeltaIntegerEncodings(accumulatedDeltaIntegerEncodings)
         {
+            m_activeMorphTargets.reserve(m_morphTargetComputeMetaDatas.size());
             m_morphTargetShader = skinnedMeshFeatureProcessor->GetMorphTargetShader();
             RPI::ShaderReloadNotificationBus::Handler::BusConnect(m_morphTargetShader->GetAssetId());
         }
@@ -86,7 +91,7 @@ namespace AZ
                 AZ_Error("MorphTargetDispatchItem", false, outcome.GetError().c_str());
             }
 
-            arguments.m_totalNumberOfThreadsX = m_morphTargetComputeMetaData.m_vertexCount;
+            arguments.m_totalNumberOfThreadsX = m_activeDeltaCount;
             arguments.m_totalNumberOfThreadsY = 1;
             arguments.m_totalNumberOfThreadsZ = 1;
 
@@ -111,6 +116,31 @@ namespace AZ
             
             m_inputBuffers->SetBufferViewsOnShaderResourceGroup(m_instanceSrg);
 
+            // Create a buffer large enough for every morph target of the lod to be active at once
+            if (!m_activeMorphTargetBuffer)
+            {
+                RPI::CommonBufferDescriptor desc;
+                desc.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
+                desc.m_bufferName = "MorphTargetActiveMorphTargets";
+                desc.m_elementSize = sizeof(ActiveMorphTarget);
+                desc.m_byteCount = AZStd::max<size_t>(m_morphTargetComputeMetaDatas.size(), 1) * sizeof(ActiveMorphTarget);
+                m_activeMorphTargetBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+                if (!m_activeMorphTargetBuffer)
+                {
+                    AZ_Error("MorphTargetDispatchItem", false, "Failed to create the active morph target buffer");
+                    return false;
+                }
+
+                if (!m_activeMorphTargets.empty())
+                {
+                    m_activeMorphTargetBuffer->UpdateData(m_activeMorphTargets.data(), m_activeMorphTargets.size() * sizeof(ActiveMorphTarget));
+                }
+            }
+
+            RHI::ShaderInputBufferIndex activeMorphTargetsIndex = m_instanceSrg->FindShaderInputBufferIndex(Name{ "m_activeMorphTargets" });
+            AZ_Error("MorphTargetDispatchItem", activeMorphTargetsIndex.IsValid(), "Failed to find shader input index for 'm_activeMorphTargets' in the morph target compute shader per-instance SRG.");
+            m_instanceSrg->SetBuffer(activeMorphTargetsIndex, m_activeMorphTargetBuffer);
+
             m_instanceSrg->Compile();
 
             m_dispatchItem.m_uniqueShaderResourceGroup = m_instanceSrg->GetRHIShaderResourceGroup();
@@ -119,51 +149,92 @@ namespace AZ
 
         void MorphTargetDispatchItem::InitRootConstants(const RHI::ConstantsLayout* rootConstantsLayout)
         {
-            auto vertexCountIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_vertexCount" });
-            AZ_Error("MorphTargetDispatchItem", vertexCountIndex.IsValid(), "Could not find root constant 's_vertexCount' in the shader");
-            auto positionOffsetIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_targetPositionOffset" });
-            AZ_Error("MorphTargetDispatchItem", positionOffsetIndex.IsValid(), "Could not find root constant 's_targetPositionOffset' in the shader");
-            auto normalOffsetIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_targetNormalOffset" });
-            AZ_Error("MorphTargetDispatchItem", normalOffsetIndex.IsValid(), "Could not find root constant 's_targetNormalOffset' in the shader");
-            auto tangentOffsetIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_targetTangentOffset" });
-            AZ_Error("MorphTargetDispatchItem", tangentOffsetIndex.IsValid(), "Could not find root constant 's_targetTangentOffset' in the shader");
-            auto bitangentOffsetIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_targetBitangentOffset" });
-            AZ_Error("MorphTargetDispatchItem", bitangentOffsetIndex.IsValid(), "Could not find root constant 's_targetBitangentOffset' in the shader");
-
-            auto minIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_min" });
-            AZ_Error("MorphTargetDispatchItem", minIndex.IsValid(), "Could not find root constant 's_min' in the shader");
-            auto maxIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_max" });
-            AZ_Error("MorphTargetDispatchItem", maxIndex.IsValid(), "Could not find root constant 's_max' in the shader");
-            auto morphDeltaIntegerEncodingIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_accumulatedDeltaIntegerEncoding" });
-            AZ_Error("MorphTargetDispatchItem", morphDeltaIntegerEncodingIndex.IsValid(), "Could not find root constant 's_accumulatedDeltaIntegerEncoding' in the shader");
-            m_weightIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_weight" });
-            AZ_Error("MorphTargetDispatchItem", m_weightIndex.IsValid(), "Could not find root constant 's_weight' in the shader");
+            m_activeMorphTargetCountIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_activeMorphTargetCount" });
+            AZ_Error("MorphTargetDispatchItem", m_activeMorphTargetCountIndex.IsValid(), "Could not find root constant 's_activeMorphTargetCount' in the shader");
+            m_deltaCountIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_deltaCount" });
+            AZ_Error("MorphTargetDispatchItem", m_deltaCountIndex.IsValid(), "Could not find root constant 's_deltaCount' in the shader");
 
             m_rootConstantData = AZ::RHI::ConstantsData(rootConstantsLayout);
-            m_rootConstantData.SetConstant(minIndex, m_morphTargetComputeMetaData.m_minDelta);
-            m_rootConstantData.SetConstant(maxIndex, m_morphTargetComputeMetaData.m_maxDelta);
-            m_rootConstantData.SetConstant(morphDeltaIntegerEncodingIndex, m_accumulatedDeltaIntegerEncoding);
-            m_rootConstantData.SetConstant(m_weightIndex, 0.0f);
-            m_rootConstantData.SetConstant(vertexCountIndex, m_morphTargetComputeMetaData.m_vertexCount);
-            // The buffer is using 32-bit integers, so divide the offset by 4 here so it doesn't have to be done in the shader
-            m_rootConstantData.SetConstant(positionOffsetIndex, m_morphInstanceMetaData.m_accumulatedPositionDeltaOffsetInBytes / 4);
-            m_rootConstantData.SetConstant(normalOffsetIndex, m_morphInstanceMetaData.m_accumulatedNormalDeltaOffsetInBytes / 4);
-            m_rootConstantData.SetConstant(tangentOffsetIndex, m_morphInstanceMetaData.m_accumulatedTangentDeltaOffsetInBytes / 4);
-            m_rootConstantData.SetConstant(bitangentOffsetIndex, m_morphInstanceMetaData.m_accumulatedBitangentDeltaOffsetInBytes / 4);
+            m_rootConstantData.SetConstant(m_activeMorphTargetCountIndex, aznumeric_cast<uint32_t>(m_activeMorphTargets.size()));
+            m_rootConstantData.SetConstant(m_deltaCountIndex, m_activeDeltaCount);
 
             m_dispatchItem.m_rootConstantSize = static_cast<uint8_t>(m_rootConstantData.GetConstantData().size());
             m_dispatchItem.m_rootConstants = m_rootConstantData.GetConstantData().data();
         }
 
-        void MorphTargetDispatchItem::SetWeight(float weight)
+        bool MorphTargetDispatchItem::SetWeights(const AZStd::vector<float>& weights)
         {
-            m_rootConstantData.SetConstant(m_weightIndex, weight);
-            m_dispatchItem.m_rootConstants = m_rootConstantData.GetConstantData().data();
+            AZ_Assert(weights.size() == m_weights.size(), "MorphTargetDispatchItem - Morph target weights passed into SetWeights don't align with the morph targets of the lod.");
+            if (weights == m_weights)
+            {
+                return false;
+            }
+
+            m_weights = weights;
+            UpdateActiveMorphTargets();
+            return true;
+        }
+
+        void MorphTargetDispatchItem::UpdateActiveMorphTargets()
+        {
+            // Every active morph target gets a contiguous range of threads, one per delta. The shader finds the morph target
+            // of a thread with a binary search on m_firstThread, so all of the morph targets of the lod are applied in one dispatch
+            m_activeMorphTargets.clear();
+            m_activeDeltaCount = 0;
+            for (size_t morphTargetIndex = 0; morphTargetIndex < m_morphTargetComputeMetaDatas.size(); ++morphTargetIndex)
+            {
+                const MorphTargetComputeMetaData& metaData = m_morphTargetComputeMetaDatas[morphTargetIndex];
+                if (m_weights[morphTargetIndex] <= AZ::Constants::FloatEpsilon || metaData.m_vertexCount == 0)
+                {
+                    continue;
+                }
+
+                const MorphTargetInstanceMetaData& instanceMetaData = m_morphInstanceMetaDatas[metaData.m_meshIndex];
+
+                ActiveMorphTarget activeMorphTarget = {};
+                activeMorphTarget.m_firstThread = m_activeDeltaCount;
+                activeMorphTarget.m_deltaStartIndex = metaData.m_startIndex;
+                activeMorphTarget.m_weight = m_weights[morphTargetIndex];
+                activeMorphTarget.m_minDelta = metaData.m_minDelta;
+                activeMorphTarget.m_maxDelta = metaData.m_maxDelta;
+                activeMorphTarget.m_accumulatedDeltaIntegerEncoding = m_accumulatedDeltaIntegerEncodings[metaData.m_meshIndex];
+                // The buffer is using 32-bit integers, so divide the offset by 4 here so it doesn't have to be done in the shader
+                activeMorphTarget.m_targetPositionOffset = instanceMetaData.m_accumulatedPositionDeltaOffsetInBytes / 4;
+                activeMorphTarget.m_targetNormalOffset = instanceMetaData.m_accumulatedNormalDeltaOffsetInBytes / 4;
+                activeMorphTarget.m_targetTangentOffset = instanceMetaData.m_accumulatedTangentDeltaOffsetInBytes / 4;
+                activeMorphTarget.m_targetBitangentOffset = instanceMetaData.m_accumulatedBitangentDeltaOffsetInBytes / 4;
+                m_activeMorphTargets.push_back(activeMorphTarget);
+
+                m_activeDeltaCount += metaData.m_vertexCount;
+            }
+
+            if (m_activeMorphTargetBuffer && !m_activeMorphTargets.empty())
+            {
+                m_activeMorphTargetBuffer->UpdateData(m_activeMorphTargets.data(), m_activeMorphTargets.size() * sizeof(ActiveMorphTarget));
+            }
+
+            if (m_activeMorphTargetCountIndex.IsValid() && m_deltaCountIndex.IsValid())
+            {
+                m_rootConstantData.SetConstant(m_activeMorphTargetCountIndex, aznumeric_cast<uint32_t>(m_activeMorphTargets.size()));
+                m_rootConstantData.SetConstant(m_deltaCountIndex, m_activeDeltaCount);
+                m_dispatchItem.m_rootConstants = m_rootConstantData.GetConstantData().data();
+            }
+            m_dispatchItem.m_arguments.m_direct.m_totalNumberOfThreadsX = m_activeDeltaCount;
+        }
+
+        float MorphTargetDispatchItem::GetWeight(size_t morphTargetIndex) const
+        {
+            return m_weights[morphTargetIndex];
+        }
+
+        size_t MorphTargetDispatchItem::GetMorphTargetCount() const
+        {
+            return m_weights.size();
         }
 
-        float MorphTargetDispatchItem::GetWeight() const
+        bool MorphTargetDispatchItem::HasActiveMorphTargets() const
         {
-            return m_rootConstantData.GetConstant<float>(m_weightIndex);
+            return !m_activeMorphTargets.empty();
         }
 
         const RHI::DispatchItem& MorphTargetDispatchItem::GetRHIDispatchItem() const
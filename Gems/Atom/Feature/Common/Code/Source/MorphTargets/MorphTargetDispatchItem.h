@@ -35,7 +35,25 @@ namespace AZ
     {
         class SkinnedMeshFeatureProcessor;
 
-        //! Holds and manages an RHI DispatchItem for a specific morph target, and the resources that are needed to build and maintain it.
+        //! A morph target with a non-zero weight, as read by the morph target compute shader.
+        //! See ActiveMorphTarget in MorphTargetSRG.azsli for the corresponding gpu struct
+        struct ActiveMorphTarget
+        {
+            uint32_t m_firstThread;
+            uint32_t m_deltaStartIndex;
+            float m_weight;
+            float m_minDelta;
+            float m_maxDelta;
+            float m_accumulatedDeltaIntegerEncoding;
+            uint32_t m_targetPositionOffset;
+            uint32_t m_targetNormalOffset;
+            uint32_t m_targetTangentOffset;
+            uint32_t m_targetBitangentOffset;
+            uint32_t m_pad[2];
+        };
+
+        //! Holds and manages an RHI DispatchItem that applies all of the active morph targets of a skinned mesh lod,
+        //! and the resources that are needed to build and maintain it.
         class MorphTargetDispatchItem
             : private RPI::ShaderReloadNotificationBus::Handler
         {
@@ -43,13 +61,17 @@ namespace AZ
             AZ_CLASS_ALLOCATOR(MorphTargetDispatchItem, AZ::SystemAllocator);
 
             MorphTargetDispatchItem() = delete;
-            //! Create one dispatch item per morph target
+            //! Create one dispatch item per skinned mesh lod
+            //! @param inputBuffers The deltas of every morph target of the lod
+            //! @param morphTargetMetaDatas The metadata of each morph target of the lod, in the order they were added to the skinned mesh
+            //! @param morphInstanceMetaDatas The per-instance offsets to the accumulated deltas of each mesh of the lod
+            //! @param accumulatedDeltaIntegerEncodings The integer encoding of the accumulated deltas of each mesh of the lod
             explicit MorphTargetDispatchItem(
                 const AZStd::intrusive_ptr<MorphTargetInputBuffers> inputBuffers,
-                const MorphTargetComputeMetaData& morphTargetMetaData,
+                const AZStd::vector<MorphTargetComputeMetaData>& morphTargetMetaDatas,
                 SkinnedMeshFeatureProcessor* skinnedMeshFeatureProcessor,
-                MorphTargetInstanceMetaData morphInstanceMetaData,
-                float accumulatedDeltaRange
+                const AZStd::vector<MorphTargetInstanceMetaData>& morphInstanceMetaDatas,
+                const AZStd::vector<float>& accumulatedDeltaIntegerEncodings
             );
             ~MorphTargetDispatchItem();
 
@@ -60,11 +82,18 @@ namespace AZ
 
             const RHI::DispatchItem& GetRHIDispatchItem() const;
 
-            void SetWeight(float weight);
-            float GetWeight() const;
+            //! Set the weights of every morph target of the lod. Returns true if any weight changed.
+            bool SetWeights(const AZStd::vector<float>& weights);
+            float GetWeight(size_t morphTargetIndex) const;
+            size_t GetMorphTargetCount() const;
+
+            //! Returns true if at least one morph target has a non-zero weight, in which case the dispatch item needs to be submitted
+            bool HasActiveMorphTargets() const;
         private:
             bool InitPerInstanceSRG();
             void InitRootConstants(const RHI::ConstantsLayout* rootConstantsLayout);
+            //! Rebuild the list of active morph targets and update the dispatch to cover all of their deltas
+            void UpdateActiveMorphTargets();
 
             // ShaderInstanceNotificationBus::Handler overrides
             void OnShaderReinitialized(const RPI::Shader& shader) override;
@@ -82,18 +111,26 @@ namespace AZ
             // The per-object shader resource group
             Data::Instance<RPI::ShaderResourceGroup> m_instanceSrg;
 
-            // Metadata used to set the root constants for the shader
-            MorphTargetComputeMetaData m_morphTargetComputeMetaData;
+            // Metadata of each morph target, used to fill in the active morph targets
+            AZStd::vector<MorphTargetComputeMetaData> m_morphTargetComputeMetaDatas;
+            AZStd::vector<float> m_weights;
+
+            // The morph targets with a non-zero weight, and the buffer they are uploaded to
+            AZStd::vector<ActiveMorphTarget> m_activeMorphTargets;
+            Data::Instance<RPI::Buffer> m_activeMorphTargetBuffer;
+            // Total number of deltas of the active morph targets, which is the number of threads that are dispatched
+            uint32_t m_activeDeltaCount = 0;
 
             AZ::RHI::ConstantsData m_rootConstantData;
 
-            // Per-SkinnedMeshInstance constants for morph targets
-            MorphTargetInstanceMetaData m_morphInstanceMetaData;
-            // A conservative value for encoding/decoding the accumulated deltas
-            float m_accumulatedDeltaIntegerEncoding;
+            // Per-SkinnedMeshInstance constants for morph targets, for each mesh of the lod
+            AZStd::vector<MorphTargetInstanceMetaData> m_morphInstanceMetaDatas;
+            // A conservative value for encoding/decoding the accumulated deltas, for each mesh of the lod
+            AZStd::vector<float> m_accumulatedDeltaIntegerEncodings;
 
-            // Keep track of the constant index of m_weight since it is updated frequently
-            RHI::ShaderInputConstantIndex m_weightIndex;
+            // Keep track of the constant indices that are updated when the weights change
+            RHI::ShaderInputConstantIndex m_activeMorphTargetCountIndex;
+            RHI::ShaderInputConstantIndex m_deltaCountIndex;
         };
     } // namespace Render
 } // namespace AZ
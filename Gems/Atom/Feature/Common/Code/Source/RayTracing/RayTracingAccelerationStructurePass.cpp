@@ -47,9 +47,68 @@ namespace AZ
 
         void RayTracingAccelerationStructurePass::FrameBeginInternal(FramePrepareParams params)
         {
+            ++m_frameIndex;
             params.m_frameGraphBuilder->ImportScopeProducer(*this);
         }
 
+        bool RayTracingAccelerationStructurePass::PrepareBlasCompaction(RayTracingFeatureProcessor& rayTracingFeatureProcessor)
+        {
+            // number of frames after the BLAS build to wait for its compacted size before leaving it uncompacted
+            static constexpr uint64_t MaxCompactedSizeWaitFrameCount = 60;
+
+            RHI::Ptr<RHI::Device> device = RHI::RHISystemInterface::Get()->GetDevice();
+            RHI::RayTracingBufferPools& rayTracingBufferPools = rayTracingFeatureProcessor.GetBufferPools();
+
+            m_blasToCompact.clear();
+
+            RayTracingFeatureProcessor::BlasInstanceMap& blasInstances = rayTracingFeatureProcessor.GetBlasInstances();
+            for (auto& blasInstance : blasInstances)
+            {
+                RayTracingFeatureProcessor::MeshBlasInstance& meshBlasInstance = blasInstance.second;
+                if (!meshBlasInstance.m_blasBuilt || meshBlasInstance.m_blasCompacted || meshBlasInstance.m_isSkinnedMesh)
+                {
+                    continue;
+                }
+
+                // the compacted size is written by the GPU when the BLAS is built, wait until that frame has completed
+                if (m_frameIndex - meshBlasInstance.m_blasBuildFrameIndex < RHI::Limits::Device::FrameCountMax)
+                {
+                    continue;
+                }
+
+                bool allSubMeshesCompacted = true;
+                for (auto& submeshBlasInstance : meshBlasInstance.m_subMeshes)
+                {
+                    if (submeshBlasInstance.m_blasCompacted)
+                    {
+                        continue;
+                    }
+
+                    // a compacted size of zero means the size is not available yet, try again on the next frame
+                    RHI::RayTracingBlas& blas = *submeshBlasInstance.m_blas;
+                    uint64_t compactedSizeInBytes = blas.GetCompactedSizeInBytes();
+                    if (compactedSizeInBytes == 0)
+                    {
+                        allSubMeshesCompacted = false;
+                        continue;
+                    }
+
+                    if (compactedSizeInBytes < blas.GetSizeInBytes() &&
+                        blas.CreateCompactedBuffers(*device, compactedSizeInBytes, rayTracingBufferPools) == RHI::ResultCode::Success)
+                    {
+                        m_blasToCompact.push_back(submeshBlasInstance.m_blas);
+                    }
+                    submeshBlasInstance.m_blasCompacted = true;
+                }
+
+                // stop retrying when the compacted size never becomes available, e.g. when the RHI doesn't support compaction
+                meshBlasInstance.m_blasCompacted = allSubMeshesCompacted ||
+                    m_frameIndex - meshBlasInstance.m_blasBuildFrameIndex >= MaxCompactedSizeWaitFrameCount;
+            }
+
+            return !m_blasToCompact.empty();
+        }
+
         void RayTracingAccelerationStructurePass::SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph)
         {
             RHI::Ptr<RHI::Device> device = RHI::RHISystemInterface::Get()->GetDevice();
@@ -57,9 +116,18 @@ namespace AZ
             RPI::Scene* scene = m_pipeline->GetScene();
             RayTracingFeatureProcessor* rayTracingFeatureProcessor = scene->GetFeatureProcessor<RayTracingFeatureProcessor>();
 
+            m_tlasBuildMode = TlasBuildMode::None;
+
             if (rayTracingFeatureProcessor)
             {
-                if (rayTracingFeatureProcessor->GetRevision() != m_rayTracingRevision)
+                // compacting a BLAS moves it to a new buffer, which requires a TLAS rebuild
+                const bool blasCompacted = PrepareBlasCompaction(*rayTracingFeatureProcessor);
+                const bool meshListChanged = rayTracingFeatureProcessor->GetMeshListRevision() != m_meshListRevision;
+
+                if (blasCompacted ||
+                    meshListChanged ||
+                    rayTracingFeatureProcessor->GetRevision() != m_rayTracingRevision ||
+                    rayTracingFeatureProcessor->GetSkinnedMeshCount() > 0)
                 {
                     RHI::RayTracingBufferPools& rayTracingBufferPools = rayTracingFeatureProcessor->GetBufferPools();
                     RayTracingFeatureProcessor::SubMeshVector& subMeshes = rayTracingFeatureProcessor->GetSubMeshes();
@@ -67,7 +135,8 @@ namespace AZ
 
                     // create the TLAS descriptor
                     RHI::RayTracingTlasDescriptor tlasDescriptor;
-                    RHI::RayTracingTlasDescriptor* tlasDescriptorBuild = tlasDescriptor.Build();
+                    RHI::RayTracingTlasDescriptor* tlasDescriptorBuild = tlasDescriptor.Build()
+                        ->BuildFlags(RHI::RayTracingAccelerationStructureBuildFlags::FAST_TRACE | RHI::RayTracingAccelerationStructureBuildFlags::ENABLE_UPDATE);
 
                     uint32_t instanceIndex = 0;
                     for (auto& subMesh : subMeshes)
@@ -85,9 +154,21 @@ namespace AZ
                         instanceIndex++;
                     }
 
-                    // create the TLAS buffers based on the descriptor
+                    // update the TLAS if only the instance data changed, otherwise rebuild it
+                    // the TLAS is also rebuilt periodically, since updates degrade the quality of the TLAS
                     RHI::Ptr<RHI::RayTracingTlas>& rayTracingTlas = rayTracingFeatureProcessor->GetTlas();
-                    rayTracingTlas->CreateBuffers(*device, &tlasDescriptor, rayTracingBufferPools);
+                    const bool rebuildTlas = blasCompacted || meshListChanged || m_tlasUpdateCount >= TLAS_REBUILD_UPDATE_INTERVAL;
+                    if (!rebuildTlas && rayTracingTlas->UpdateBuffers(*device, &tlasDescriptor, rayTracingBufferPools) == RHI::ResultCode::Success)
+                    {
+                        m_tlasBuildMode = TlasBuildMode::Update;
+                        ++m_tlasUpdateCount;
+                    }
+                    else
+                    {
+                        rayTracingTlas->CreateBuffers(*device, &tlasDescriptor, rayTracingBufferPools);
+                        m_tlasBuildMode = TlasBuildMode::Build;
+                        m_tlasUpdateCount = 0;
+                    }
 
                     // import and attach the TLAS buffer
                     const RHI::Ptr<RHI::Buffer>& rayTracingTlasBuffer = rayTracingTlas->GetTlasBuffer();
@@ -145,14 +226,15 @@ namespace AZ
                 return;
             }
 
-            if (rayTracingFeatureProcessor->GetRevision() == m_rayTracingRevision && rayTracingFeatureProcessor->GetSkinnedMeshCount() == 0)
+            if (m_tlasBuildMode == TlasBuildMode::None)
             {
                 // TLAS is up to date
                 return;
             }
 
-            // update the stored revision, even if we don't have any meshes to process
+            // update the stored revisions, even if we don't have any meshes to process
             m_rayTracingRevision = rayTracingFeatureProcessor->GetRevision();
+            m_meshListRevision = rayTracingFeatureProcessor->GetMeshListRevision();
 
             if (!rayTracingFeatureProcessor->GetSubMeshCount())
             {
@@ -195,11 +277,26 @@ namespace AZ
                     }
 
                     blasInstance.second.m_blasBuilt = true;
+                    blasInstance.second.m_blasBuildFrameIndex = m_frameIndex;
                 }
             }
 
-            // build the TLAS object
-            context.GetCommandList()->BuildTopLevelAccelerationStructure(*rayTracingFeatureProcessor->GetTlas());
+            // copy the BLAS objects into their compacted buffers, the TLAS is rebuilt with the compacted BLAS objects
+            for (const RHI::Ptr<RHI::RayTracingBlas>& blas : m_blasToCompact)
+            {
+                context.GetCommandList()->CompactBottomLevelAccelerationStructure(*blas);
+            }
+            m_blasToCompact.clear();
+
+            // build or update the TLAS object
+            if (m_tlasBuildMode == TlasBuildMode::Update)
+            {
+                context.GetCommandList()->UpdateTopLevelAccelerationStructure(*rayTracingFeatureProcessor->GetTlas());
+            }
+            else
+            {
+                context.GetCommandList()->BuildTopLevelAccelerationStructure(*rayTracingFeatureProcessor->GetTlas());
+            }
 
             ++m_frameCount;
         }
@@ -10,12 +10,16 @@
 #include <Atom/RHI/ScopeProducer.h>
 #include <Atom/RPI.Public/Pass/Pass.h>
 #include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RHI/RayTracingAccelerationStructure.h>
 #include <Atom/RHI/RayTracingBufferPools.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AZ
 {
     namespace Render
     {
+        class RayTracingFeatureProcessor;
+
         //! This pass builds the RayTracing acceleration structures for a scene
         class RayTracingAccelerationStructurePass final
             : public RPI::Pass
@@ -43,17 +47,45 @@ namespace AZ
             void BuildInternal() override;
             void FrameBeginInternal(FramePrepareParams params) override;
 
+            // creates the compacted buffers of the static BLASes whose compacted size is available
+            // returns true if any BLAS is going to be compacted this frame
+            bool PrepareBlasCompaction(RayTracingFeatureProcessor& rayTracingFeatureProcessor);
+
             // buffer view descriptor for the TLAS
             RHI::BufferViewDescriptor m_tlasBufferViewDescriptor;
 
             // revision number of the ray tracing data when the TLAS was built
             uint32_t m_rayTracingRevision = 0;
 
+            // revision number of the ray tracing mesh list when the TLAS was built
+            uint32_t m_meshListRevision = 0;
+
             // keeps track of the current frame to determine updates or rebuilds of the skinned BLASes
             uint64_t m_frameCount = 0;
 
+            // incremented every frame, used to determine when the compacted size of a BLAS is available on the CPU
+            uint64_t m_frameIndex = 0;
+
             // the bits of this constant are used to check if a skinned BLAS is going to be rebuilt in any given frame
             static constexpr uint32_t SKINNED_BLAS_REBUILD_FRAME_INTERVAL = 8;
+
+            // the TLAS is rebuilt after this number of consecutive updates, since updates degrade its quality
+            static constexpr uint32_t TLAS_REBUILD_UPDATE_INTERVAL = 32;
+
+            // the operation performed on the TLAS in the current frame
+            enum class TlasBuildMode
+            {
+                None,
+                Build,
+                Update
+            };
+            TlasBuildMode m_tlasBuildMode = TlasBuildMode::None;
+
+            // number of TLAS updates since the last TLAS build
+            uint32_t m_tlasUpdateCount = 0;
+
+            // BLASes with compacted buffers that are waiting for the compaction copy
+            AZStd::vector<RHI::Ptr<RHI::RayTracingBlas>> m_blasToCompact;
         };
     }   // namespace RPI
 }   // namespace AZ
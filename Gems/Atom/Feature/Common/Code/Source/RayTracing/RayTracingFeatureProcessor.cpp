@@ -287,6 +287,7 @@ namespace AZ
             }
 
             m_revision++;
+            m_meshListRevision++;
             m_subMeshCount += aznumeric_cast<uint32_t>(subMeshes.size());
 
             m_meshInfoBufferNeedsUpdate = true;
@@ -376,6 +377,7 @@ namespace AZ
                 m_subMeshCount -= aznumeric_cast<uint32_t>(mesh.m_subMeshIndices.size());
                 m_meshes.erase(itMesh);
                 m_revision++;
+                m_meshListRevision++;
 
                 // reset all data structures if all meshes were removed (i.e., empty scene)
                 if (m_subMeshCount == 0)
@@ -819,7 +821,8 @@ namespace AZ
             }
             else
             {
-                buildFlags = AZ::RHI::RayTracingAccelerationStructureBuildFlags::FAST_TRACE;
+                // static meshes are compacted by the RayTracingAccelerationStructurePass after they are built
+                buildFlags = AZ::RHI::RayTracingAccelerationStructureBuildFlags::FAST_TRACE | AZ::RHI::RayTracingAccelerationStructureBuildFlags::ENABLE_COMPACTION;
             }
 
             return buildFlags;
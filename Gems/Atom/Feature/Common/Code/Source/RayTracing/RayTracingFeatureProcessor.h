@@ -218,6 +218,10 @@ namespace AZ
             //! This is used to determine if the RayTracingShaderTable needs to be rebuilt.
             uint32_t GetRevision() const { return m_revision; }
 
+            //! Retrieves the revision number of the ray tracing mesh list, which only changes when meshes are added or removed.
+            //! This is used to determine if the TLAS needs to be rebuilt or if it can be updated with the new transforms.
+            uint32_t GetMeshListRevision() const { return m_meshListRevision; }
+
             uint32_t GetSkinnedMeshCount() const
             {
                 return m_skinnedMeshCount;
@@ -244,6 +248,9 @@ namespace AZ
             struct SubMeshBlasInstance
             {
                 RHI::Ptr<RHI::RayTracingBlas> m_blas;
+
+                // flag indicating if the compacted size of the Blas was read, and the Blas compacted if that saves memory
+                bool m_blasCompacted = false;
             };
 
             struct MeshBlasInstance
@@ -254,6 +261,12 @@ namespace AZ
                 // flag indicating if the Blas objects in the sub-mesh list are built
                 bool m_blasBuilt = false;
                 bool m_isSkinnedMesh = false;
+
+                // flag indicating if the Blas objects in the sub-mesh list are compacted, only static meshes are compacted
+                bool m_blasCompacted = false;
+
+                // frame index of the RayTracingAccelerationStructurePass when the Blas objects were built
+                uint64_t m_blasBuildFrameIndex = 0;
             };
 
             using BlasInstanceMap = AZStd::unordered_map<AZ::Data::AssetId, MeshBlasInstance>;
@@ -294,6 +307,9 @@ namespace AZ
             // current revision number of ray tracing data
             uint32_t m_revision = 0;
 
+            // current revision number of the ray tracing mesh list
+            uint32_t m_meshListRevision = 0;
+
             // total number of ray tracing sub-meshes
             uint32_t m_subMeshCount = 0;
 
@@ -10,6 +10,7 @@
 
 #include <AzCore/Math/MatrixUtils.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/algorithm.h>
 #include <Math/GaussianMathFilter.h>
 #include <Atom/RHI/DrawPacketBuilder.h>
 #include <Atom/RHI/RHISystemInterface.h>
@@ -106,7 +107,7 @@ namespace AZ::Render
             auto& shadowProperty = GetShadowPropertyFromShadowId(id);
             if (m_primaryProjectedShadowmapsPass)
             {
-                m_primaryProjectedShadowmapsPass->QueueRemoveChild(shadowProperty.m_shadowmapPass);
+                RemoveShadowmapPasses(shadowProperty);
             }
             m_shadowProperties.RemoveData(&shadowProperty);
             m_shadowData.Release(id.GetIndex());
@@ -220,7 +221,21 @@ namespace AZ::Render
     {
         AZ_Assert(id.IsValid(), "Invalid ShadowId passed to ProjectedShadowFeatureProcessor::SetUseCachedShadows().");
         ShadowProperty& shadowProperty = GetShadowPropertyFromShadowId(id);
-        shadowProperty.m_useCachedShadows = useCachedShadows;
+        if (shadowProperty.m_useCachedShadows != useCachedShadows)
+        {
+            // Cached shadows use different views and passes to keep static and dynamic casters apart, so recreate them.
+            if (m_primaryProjectedShadowmapsPass)
+            {
+                RemoveShadowmapPasses(shadowProperty);
+            }
+            shadowProperty.m_useCachedShadows = useCachedShadows;
+            CreateShadowViews(shadowProperty);
+            if (m_primaryProjectedShadowmapsPass)
+            {
+                CreateShadowmapPasses(shadowProperty);
+            }
+            UpdateShadowView(shadowProperty);
+        }
         m_shadowmapPassNeedsUpdate = true;
     }
 
@@ -267,6 +282,12 @@ namespace AZ::Render
         view->SetViewToClipMatrix(viewToClipMatrix);
         view->SetCameraTransform(Matrix3x4::CreateFromTransform(desc.m_transform));
 
+        if (shadowProperty.m_staticShadowmapView)
+        {
+            shadowProperty.m_staticShadowmapView->SetViewToClipMatrix(viewToClipMatrix);
+            shadowProperty.m_staticShadowmapView->SetCameraTransform(Matrix3x4::CreateFromTransform(desc.m_transform));
+        }
+
         ShadowData& shadowData = m_shadowData.GetElement<ShadowDataIndex>(shadowProperty.m_shadowId.GetIndex());
 
         // Adjust the manually set bias to a more appropriate range for the shader. Scale the bias by the
@@ -293,6 +314,10 @@ namespace AZ::Render
         if (shadowProperty.m_useCachedShadows && m_primaryProjectedShadowmapsPass)
         {
             shadowProperty.m_shadowmapPass->ForceRenderNextFrame();
+            if (shadowProperty.m_staticShadowmapPass)
+            {
+                shadowProperty.m_staticShadowmapPass->ForceRenderNextFrame();
+            }
         }
 
         m_deviceBufferNeedsUpdate = true;
@@ -310,15 +335,34 @@ namespace AZ::Render
         ShadowProperty& shadowProperty = m_shadowProperties.GetData(shadowPropertyIndex);
         shadowProperty.m_shadowId = shadowId;
 
-        Name viewName(AZStd::string::format("ProjectedShadowView (shadowId:%d)", shadowId.GetIndex()));
-        shadowProperty.m_shadowmapView = RPI::View::CreateView(viewName, RPI::View::UsageShadow);
-
+        CreateShadowViews(shadowProperty);
         UpdateShadowView(shadowProperty);
 
         if (m_primaryProjectedShadowmapsPass)
         {
-            shadowProperty.m_shadowmapPass = CreateShadowmapPass(shadowId.GetIndex());
-            m_primaryProjectedShadowmapsPass->QueueAddChild(shadowProperty.m_shadowmapPass);
+            CreateShadowmapPasses(shadowProperty);
+        }
+    }
+
+    void ProjectedShadowFeatureProcessor::CreateShadowViews(ShadowProperty& shadowProperty)
+    {
+        const uint16_t shadowIndex = shadowProperty.m_shadowId.GetIndex();
+        Name viewName(AZStd::string::format("ProjectedShadowView (shadowId:%d)", shadowIndex));
+
+        if (shadowProperty.m_useCachedShadows)
+        {
+            // Static casters are only drawn by the static view, which re-renders the cache atlas when one of them moves.
+            // Dynamic casters moving every frame only re-render the main view, which composites them on top of the cache.
+            shadowProperty.m_shadowmapView = RPI::View::CreateView(viewName, RPI::View::UsageShadow | RPI::View::UsageShadowDynamicCasters);
+
+            Name staticViewName(AZStd::string::format("ProjectedShadowStaticView (shadowId:%d)", shadowIndex));
+            shadowProperty.m_staticShadowmapView =
+                RPI::View::CreateView(staticViewName, RPI::View::UsageShadow | RPI::View::UsageShadowStaticCasters);
+        }
+        else
+        {
+            shadowProperty.m_shadowmapView = RPI::View::CreateView(viewName, RPI::View::UsageShadow);
+            shadowProperty.m_staticShadowmapView = nullptr;
         }
     }
         
@@ -413,6 +457,7 @@ namespace AZ::Render
                 }
                 ProjectedShadowmapsPass* shadowmapPass = static_cast<ProjectedShadowmapsPass*>(pass);
                 shadowmapPass->SetAtlasAttachmentImage(m_atlasImage);
+                shadowmapPass->SetCacheAtlasAttachmentImage(m_cacheAtlasImage);
                 m_projectedShadowmapsPasses[renderPipeline] = shadowmapPass;
 
                 return RPI::PassFilterExecutionFlow::ContinueVisitingPasses; // continue to check for multiple (error case)
@@ -468,9 +513,7 @@ namespace AZ::Render
 
                     for (auto& shadowProperty : m_shadowProperties.GetDataVector())
                     {
-                        size_t shadowIndex = shadowProperty.m_shadowId.GetIndex();
-                        shadowProperty.m_shadowmapPass = CreateShadowmapPass(shadowIndex);
-                        m_primaryProjectedShadowmapsPass->QueueAddChild(shadowProperty.m_shadowmapPass);
+                        CreateShadowmapPasses(shadowProperty);
                     }
                 }
                 m_primaryShadowPipeline = pipeline.get();
@@ -520,7 +563,8 @@ namespace AZ::Render
 
         if (m_primaryProjectedShadowmapsPass && !m_clearShadowDrawPacket)
         {
-            CreateClearShadowDrawPacket();
+            m_clearShadowDrawPacket = CreateShadowDrawPacket("Shaders/Shadow/ClearShadow.azshader", m_clearShadowShader);
+            m_restoreShadowDrawPacket = CreateShadowDrawPacket("Shaders/Shadow/RestoreShadowmap.azshader", m_restoreShadowShader);
         }
 
         m_shadowmapPassNeedsUpdate = true;
@@ -617,19 +661,6 @@ namespace AZ::Render
             m_deviceBufferNeedsUpdate = false;
         }
 
-        // Turn off cached esm shadow maps for next frame
-        for (const auto& shadowProperty : m_shadowProperties.GetDataVector())
-        {
-            if (shadowProperty.m_useCachedShadows)
-            {
-                FilterParameter& esmData = m_shadowData.GetElement<FilterParamIndex>(shadowProperty.m_shadowId.GetIndex());
-                if (esmData.m_isEnabled != 0)
-                {
-                    esmData.m_isEnabled = false;
-                    m_filterParameterNeedsUpdate = true;
-                }
-            }
-        }
     }
     
     void ProjectedShadowFeatureProcessor::PrepareViews(const PrepareViewsPacket&, AZStd::vector<AZStd::pair<RPI::PipelineViewTag, RPI::ViewPtr>>& outViews)
@@ -658,6 +689,19 @@ namespace AZ::Render
                     }
 
                     outViews.emplace_back(AZStd::make_pair(viewTag, shadowProperty.m_shadowmapView));
+
+                    if (shadowProperty.m_staticShadowmapPass)
+                    {
+                        const RPI::PipelineViewTag& staticViewTag = shadowProperty.m_staticShadowmapPass->GetPipelineViewTag();
+                        const RHI::DrawListMask staticDrawListMask = renderPipeline->GetDrawListMask(staticViewTag);
+                        if (shadowProperty.m_staticShadowmapView->GetDrawListMask() != staticDrawListMask)
+                        {
+                            shadowProperty.m_staticShadowmapView->Reset();
+                            shadowProperty.m_staticShadowmapView->SetDrawListMask(staticDrawListMask);
+                        }
+
+                        outViews.emplace_back(AZStd::make_pair(staticViewTag, shadowProperty.m_staticShadowmapView));
+                    }
                 }
             }
         }
@@ -702,30 +746,29 @@ namespace AZ::Render
         return m_shadowProperties.GetData(shadowPropertyId);
     }
 
-    void ProjectedShadowFeatureProcessor::CreateClearShadowDrawPacket()
+    RHI::ConstPtr<RHI::DrawPacket> ProjectedShadowFeatureProcessor::CreateShadowDrawPacket(const char* shaderFilePath, Data::Instance<RPI::Shader>& shader)
     {
-        // Force load of shader to clear shadow maps.
-        const AZStd::string clearShadowShaderFilePath = "Shaders/Shadow/ClearShadow.azshader";
+        // Force load of shader used to clear or restore shadow maps.
         Data::Asset<RPI::ShaderAsset> shaderAsset = RPI::AssetUtils::LoadCriticalAsset<RPI::ShaderAsset>
-            (clearShadowShaderFilePath, RPI::AssetUtils::TraceLevel::Assert);
+            (shaderFilePath, RPI::AssetUtils::TraceLevel::Assert);
 
-        m_clearShadowShader = RPI::Shader::FindOrCreate(shaderAsset);
-        const RPI::ShaderVariant& variant = m_clearShadowShader->GetRootVariant();
+        shader = RPI::Shader::FindOrCreate(shaderAsset);
+        const RPI::ShaderVariant& variant = shader->GetRootVariant();
 
         RHI::PipelineStateDescriptorForDraw pipelineStateDescriptor;
         variant.ConfigurePipelineState(pipelineStateDescriptor);
 
-        [[maybe_unused]] bool foundPipelineState = GetParentScene()->ConfigurePipelineState(m_clearShadowShader->GetDrawListTag(), pipelineStateDescriptor);
-        AZ_Assert(foundPipelineState, "Could not find pipeline state for ClearShadow shader's draw list '%s'", shaderAsset->GetDrawListName().GetCStr())
+        [[maybe_unused]] bool foundPipelineState = GetParentScene()->ConfigurePipelineState(shader->GetDrawListTag(), pipelineStateDescriptor);
+        AZ_Assert(foundPipelineState, "Could not find pipeline state for shader '%s' with draw list '%s'", shaderFilePath, shaderAsset->GetDrawListName().GetCStr())
 
         RHI::InputStreamLayoutBuilder layoutBuilder;
         pipelineStateDescriptor.m_inputStreamLayout = layoutBuilder.End();
 
-        const RHI::PipelineState* pipelineState = m_clearShadowShader->AcquirePipelineState(pipelineStateDescriptor);
+        const RHI::PipelineState* pipelineState = shader->AcquirePipelineState(pipelineStateDescriptor);
         if (!pipelineState)
         {
             AZ_Assert(false, "Shader '%s'. Failed to acquire default pipeline state", shaderAsset->GetName().GetCStr());
-            return;
+            return nullptr;
         }
 
         RHI::DrawPacketBuilder drawPacketBuilder;
@@ -733,12 +776,12 @@ namespace AZ::Render
         drawPacketBuilder.SetDrawArguments(RHI::DrawLinear(1, 0, 3, 0));
 
         RHI::DrawPacketBuilder::DrawRequest drawRequest;
-        drawRequest.m_listTag = m_clearShadowShader->GetDrawListTag();
+        drawRequest.m_listTag = shader->GetDrawListTag();
         drawRequest.m_pipelineState = pipelineState;
         drawRequest.m_sortKey = AZStd::numeric_limits<RHI::DrawItemSortKey>::min();
 
         drawPacketBuilder.AddDrawItem(drawRequest);
-        m_clearShadowDrawPacket = drawPacketBuilder.End();
+        return drawPacketBuilder.End();
     }
 
     void ProjectedShadowFeatureProcessor::UpdateAtlas()
@@ -783,9 +826,22 @@ namespace AZ::Render
 
         m_atlasImage = createAtlas(RHI::Format::D32_FLOAT, RHI::ImageBindFlags::Depth, RHI::ImageAspectFlags::Depth, "ProjectedShadowAtlas");
 
+        // The cache atlas mirrors the layout of the shadowmap atlas and holds the static casters of cached shadows.
+        const bool needsCache = AZStd::any_of(shadowProperties.begin(), shadowProperties.end(),
+            [](const ShadowProperty& shadowProperty) { return shadowProperty.m_useCachedShadows; });
+        if (needsCache)
+        {
+            m_cacheAtlasImage = createAtlas(RHI::Format::D32_FLOAT, RHI::ImageBindFlags::Depth, RHI::ImageAspectFlags::Depth, "ProjectedShadowCacheAtlas");
+        }
+        else
+        {
+            m_cacheAtlasImage = {};
+        }
+
         for (auto& [key, projectedShadowmapsPass] : m_projectedShadowmapsPasses)
         {
             projectedShadowmapsPass->SetAtlasAttachmentImage(m_atlasImage);
+            projectedShadowmapsPass->SetCacheAtlasAttachmentImage(m_cacheAtlasImage);
             projectedShadowmapsPass->QueueForBuildAndInitialization();
         }
 
@@ -804,16 +860,56 @@ namespace AZ::Render
         }
     }
 
-    RPI::Ptr<ShadowmapPass> ProjectedShadowFeatureProcessor::CreateShadowmapPass(size_t childIndex)
+    RPI::Ptr<ShadowmapPass> ProjectedShadowFeatureProcessor::CreateShadowmapPass(size_t childIndex, ShadowmapPassType passType)
     {
-        const Name passName{ AZStd::string::format("ProjectedShadowmapPass.%zu", childIndex) };
+        const char* suffix = passType == ShadowmapPassType::StaticCasters ? ".Static" : "";
+        const Name passName{ AZStd::string::format("ProjectedShadowmapPass.%zu%s", childIndex, suffix) };
 
         RHI::RHISystemInterface* rhiSystem = RHI::RHISystemInterface::Get();
         auto passData = AZStd::make_shared<RPI::RasterPassData>();
         passData->m_drawListTag = rhiSystem->GetDrawListTagRegistry()->GetName(m_primaryProjectedShadowmapsPass->GetDrawListTag());
-        passData->m_pipelineViewTag = AZStd::string::format("%s.%zu", m_primaryProjectedShadowmapsPass->GetPipelineViewTag().GetCStr(), childIndex);
+        passData->m_pipelineViewTag = AZStd::string::format("%s.%zu%s", m_primaryProjectedShadowmapsPass->GetPipelineViewTag().GetCStr(), childIndex, suffix);
+
+        switch (passType)
+        {
+        case ShadowmapPassType::StaticCasters:
+            return ShadowmapPass::CreateWithPassRequest(passName, passData, Name{ "StaticShadowmapPassTemplate" });
+        case ShadowmapPassType::DynamicCasters:
+            // The pass srg of the restore shader binds the cache atlas for the restore draw.
+            passData->m_passSrgShaderReference.m_filePath = "Shaders/Shadow/RestoreShadowmap.azshader";
+            return ShadowmapPass::CreateWithPassRequest(passName, passData, Name{ "CachedShadowmapPassTemplate" });
+        default:
+            return ShadowmapPass::CreateWithPassRequest(passName, passData);
+        }
+    }
+
+    void ProjectedShadowFeatureProcessor::CreateShadowmapPasses(ShadowProperty& shadowProperty)
+    {
+        const size_t shadowIndex = shadowProperty.m_shadowId.GetIndex();
+        if (shadowProperty.m_useCachedShadows)
+        {
+            shadowProperty.m_shadowmapPass = CreateShadowmapPass(shadowIndex, ShadowmapPassType::DynamicCasters);
+            shadowProperty.m_staticShadowmapPass = CreateShadowmapPass(shadowIndex, ShadowmapPassType::StaticCasters);
+            shadowProperty.m_staticShadowmapPass->SetDynamicCasterPass(shadowProperty.m_shadowmapPass.get());
+
+            // Static caster passes are scheduled first so the cache atlas is up to date before any pass restores from it.
+            m_primaryProjectedShadowmapsPass->QueueAddChild(shadowProperty.m_staticShadowmapPass, true);
+        }
+        else
+        {
+            shadowProperty.m_shadowmapPass = CreateShadowmapPass(shadowIndex, ShadowmapPassType::AllCasters);
+            shadowProperty.m_staticShadowmapPass = nullptr;
+        }
+        m_primaryProjectedShadowmapsPass->QueueAddChild(shadowProperty.m_shadowmapPass);
+    }
 
-        return ShadowmapPass::CreateWithPassRequest(passName, passData);
+    void ProjectedShadowFeatureProcessor::RemoveShadowmapPasses(ShadowProperty& shadowProperty)
+    {
+        m_primaryProjectedShadowmapsPass->QueueRemoveChild(shadowProperty.m_shadowmapPass);
+        if (shadowProperty.m_staticShadowmapPass)
+        {
+            m_primaryProjectedShadowmapsPass->QueueRemoveChild(shadowProperty.m_staticShadowmapPass);
+        }
     }
 
     void ProjectedShadowFeatureProcessor::UpdateShadowPasses()
@@ -824,6 +920,8 @@ namespace AZ::Render
             AZStd::vector<ShadowmapPass*> m_shadowPasses;
         };
 
+        RHI::Handle<uint32_t> casterMovedBit = GetParentScene()->GetViewTagBitRegistry().FindTag(MeshCommon::MeshMovedName);
+
         AZStd::vector<SliceInfo> sliceInfo(m_atlas.GetArraySliceCount());
         for (const auto& it : m_shadowProperties.GetDataVector())
         {
@@ -832,11 +930,18 @@ namespace AZ::Render
             // The first pass to render a slice should clear the slice.
             size_t shadowIndex = it.m_shadowId.GetIndex();
             auto* pass = it.m_shadowmapPass.get();
+            auto* staticPass = it.m_staticShadowmapPass.get();
 
             const ShadowmapAtlas::Origin origin = m_atlas.GetOrigin(shadowIndex);
             pass->SetArraySlice(origin.m_arraySlice);
             pass->SetIsStatic(it.m_useCachedShadows);
             pass->ForceRenderNextFrame();
+            if (staticPass)
+            {
+                staticPass->SetArraySlice(origin.m_arraySlice);
+                staticPass->SetIsStatic(true);
+                staticPass->ForceRenderNextFrame();
+            }
 
             const auto& filterData = m_shadowData.GetElement<FilterParamIndex>(shadowIndex);
             if (filterData.m_shadowmapSize != static_cast<uint32_t>(ShadowmapSize::None))
@@ -855,13 +960,27 @@ namespace AZ::Render
                 pass->SetClearEnabled(false);
 
                 SliceInfo& sliceInfoItem = sliceInfo.at(origin.m_arraySlice);
-                sliceInfoItem.m_shadowPasses.push_back(pass);
                 sliceInfoItem.m_hasStaticShadows = sliceInfoItem.m_hasStaticShadows || it.m_useCachedShadows;
+
+                if (staticPass)
+                {
+                    // The static casters share the cache atlas slice with other cached shadows, so they clear their own viewport with a draw.
+                    staticPass->SetViewportScissor(viewport, scissor);
+                    staticPass->SetClearEnabled(false);
+                    staticPass->SetClearShadowDrawPacket(m_clearShadowDrawPacket);
+                    staticPass->SetCasterMovedBit(casterMovedBit);
+
+                    // Restoring the cache overwrites the whole viewport, so it replaces the clear draw.
+                    pass->SetClearShadowDrawPacket(m_restoreShadowDrawPacket);
+                    pass->SetCasterMovedBit(casterMovedBit);
+                }
+                else
+                {
+                    sliceInfoItem.m_shadowPasses.push_back(pass);
+                }
             }
         }
 
-        RHI::Handle<uint32_t> casterMovedBit = GetParentScene()->GetViewTagBitRegistry().FindTag(MeshCommon::MeshMovedName);
-
         for (const auto& it : sliceInfo)
         {
             if (!it.m_hasStaticShadows)
@@ -83,11 +83,23 @@ namespace AZ::Render
             ProjectedShadowDescriptor m_desc;
             RPI::ViewPtr m_shadowmapView;
             RPI::Ptr<ShadowmapPass> m_shadowmapPass;
+            // Only used by cached shadows, which render their static casters into the cache atlas separately from dynamic casters.
+            RPI::ViewPtr m_staticShadowmapView;
+            RPI::Ptr<ShadowmapPass> m_staticShadowmapPass;
             float m_bias = 0.1f;
             ShadowId m_shadowId;
             bool m_useCachedShadows = false;
         };
 
+        // Which casters a shadowmap pass renders. Cached shadows are split into a static caster pass rendering into the cache atlas
+        // only when needed, and a dynamic caster pass that restores the cache and draws the dynamic casters on top of it.
+        enum class ShadowmapPassType
+        {
+            AllCasters,
+            StaticCasters,
+            DynamicCasters,
+        };
+
         using FilterParameter = EsmShadowmapsPass::FilterParameter;
         static constexpr float MinimumFieldOfView = 0.001f;
 
@@ -97,6 +109,7 @@ namespace AZ::Render
         // Shadow specific functions
         void UpdateShadowView(ShadowProperty& shadowProperty);
         void InitializeShadow(ShadowId shadowId);
+        void CreateShadowViews(ShadowProperty& shadowProperty);
             
         // Functions for caching the ProjectedShadowmapsPass and EsmShadowmapsPass.
         void CheckRemovePrimaryPasses(RPI::RenderPipeline* renderPipeline);
@@ -111,9 +124,11 @@ namespace AZ::Render
         bool FilterMethodIsEsm(const ShadowData& shadowData) const;
 
         ShadowProperty& GetShadowPropertyFromShadowId(ShadowId id);
-        RPI::Ptr<ShadowmapPass> CreateShadowmapPass(size_t childIndex);
+        RPI::Ptr<ShadowmapPass> CreateShadowmapPass(size_t childIndex, ShadowmapPassType passType);
+        void CreateShadowmapPasses(ShadowProperty& shadowProperty);
+        void RemoveShadowmapPasses(ShadowProperty& shadowProperty);
 
-        void CreateClearShadowDrawPacket();
+        RHI::ConstPtr<RHI::DrawPacket> CreateShadowDrawPacket(const char* shaderFilePath, Data::Instance<RPI::Shader>& shader);
 
         void UpdateAtlas();
         void UpdateShadowPasses();
@@ -139,6 +154,7 @@ namespace AZ::Render
 
         ShadowmapAtlas m_atlas;
         Data::Instance<RPI::AttachmentImage> m_atlasImage;
+        Data::Instance<RPI::AttachmentImage> m_cacheAtlasImage;
         Data::Instance<RPI::AttachmentImage> m_esmAtlasImage;
 
         AZStd::unordered_map<RPI::RenderPipeline*, ProjectedShadowmapsPass*> m_projectedShadowmapsPasses;
@@ -149,6 +165,8 @@ namespace AZ::Render
 
         Data::Instance<RPI::Shader> m_clearShadowShader;
         RHI::ConstPtr<RHI::DrawPacket> m_clearShadowDrawPacket;
+        Data::Instance<RPI::Shader> m_restoreShadowShader;
+        RHI::ConstPtr<RHI::DrawPacket> m_restoreShadowDrawPacket;
 
         RHI::ShaderInputNameIndex m_shadowmapAtlasSizeIndex{ "m_shadowmapAtlasSize" };
         RHI::ShaderInputNameIndex m_invShadowmapAtlasSizeIndex{ "m_invShadowmapAtlasSize" };
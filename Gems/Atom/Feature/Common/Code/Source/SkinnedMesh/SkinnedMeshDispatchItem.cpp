@@ -35,7 +35,8 @@ namespace AZ
             const SkinnedMeshShaderOptions& shaderOptions,
             SkinnedMeshFeatureProcessor* skinnedMeshFeatureProcessor,
             MorphTargetInstanceMetaData morphTargetInstanceMetaData,
-            float morphTargetDeltaIntegerEncoding)
+            float morphTargetDeltaIntegerEncoding,
+            const SkinnedMeshFeatureProcessorInterface::BakedMotion& bakedMotion)
             : m_inputBuffers(inputBuffers)
             , m_outputBufferOffsetsInBytes(outputBufferOffsetsInBytes)
             , m_positionHistoryBufferOffsetInBytes(positionHistoryOutputBufferOffsetInBytes)
@@ -45,6 +46,7 @@ namespace AZ
             , m_shaderOptions(shaderOptions)
             , m_morphTargetInstanceMetaData(morphTargetInstanceMetaData)
             , m_morphTargetDeltaIntegerEncoding(morphTargetDeltaIntegerEncoding)
+            , m_bakedMotion(bakedMotion)
         {
             m_skinningShader = skinnedMeshFeatureProcessor->GetSkinningShader();
 
@@ -54,6 +56,9 @@ namespace AZ
                 m_shaderOptions.m_applyMorphTargets = true;
             }
 
+            // The pose is sampled from the baked motion by the skinning shader
+            m_shaderOptions.m_gpuPoseEvaluation = m_bakedMotion.IsValid();
+
             // CreateShaderOptionGroup will also connect to the SkinnedMeshShaderOptionNotificationBus
             m_shaderOptionGroup = skinnedMeshFeatureProcessor->CreateSkinningShaderOptionGroup(m_shaderOptions, *this);
         }
@@ -160,6 +165,25 @@ namespace AZ
 
             m_instanceSrg->SetBuffer(actorInstanceBoneTransformsIndex, m_boneTransforms);
 
+            if (m_shaderOptions.m_gpuPoseEvaluation)
+            {
+                const Name bakedBoneTransformsName = m_shaderOptions.m_skinningMethod == SkinningMethod::DualQuaternion
+                    ? Name{ "m_bakedBoneTransformsDualQuaternion" }
+                    : Name{ "m_bakedBoneTransformsLinear" };
+                RHI::ShaderInputBufferIndex bakedBoneTransformsIndex = m_instanceSrg->FindShaderInputBufferIndex(bakedBoneTransformsName);
+                if (!bakedBoneTransformsIndex.IsValid())
+                {
+                    AZ_Error("SkinnedMeshDispatchItem", false, "Failed to find shader input index for %s in the skinning compute shader per-instance SRG.", bakedBoneTransformsName.GetCStr());
+                    return false;
+                }
+                m_instanceSrg->SetBuffer(bakedBoneTransformsIndex, m_bakedMotion.m_boneTransforms);
+                m_instanceSrg->SetConstant(m_instanceSrg->FindShaderInputConstantIndex(Name{ "m_bakedBoneCount" }), m_bakedMotion.m_boneCount);
+                m_instanceSrg->SetConstant(m_instanceSrg->FindShaderInputConstantIndex(Name{ "m_bakedFrameCount" }), m_bakedMotion.m_frameCount);
+                m_instanceSrg->SetConstant(m_instanceSrg->FindShaderInputConstantIndex(Name{ "m_bakedFramesPerSecond" }), m_bakedMotion.m_framesPerSecond);
+                m_instanceSrg->SetConstant(m_instanceSrg->FindShaderInputConstantIndex(Name{ "m_bakedPlaybackSpeed" }), m_bakedMotion.m_playbackSpeed);
+                m_instanceSrg->SetConstant(m_instanceSrg->FindShaderInputConstantIndex(Name{ "m_bakedTimeOffset" }), m_bakedMotion.m_timeOffset);
+            }
+
             // Set the morph target related srg constants
             RHI::ShaderInputConstantIndex morphPositionOffsetIndex = m_instanceSrg->FindShaderInputConstantIndex(Name{ "m_morphTargetPositionDeltaOffset" });
             // The buffer is using 32-bit integers, so divide the offset by 4 here so it doesn't have to be done in the shader
@@ -242,6 +266,19 @@ namespace AZ
             return m_isEnabled;
         }
 
+        void SkinnedMeshDispatchItem::SetBakedMotionPlayback(float playbackSpeed, float timeOffset)
+        {
+            m_bakedMotion.m_playbackSpeed = playbackSpeed;
+            m_bakedMotion.m_timeOffset = timeOffset;
+
+            if (m_instanceSrg && m_shaderOptions.m_gpuPoseEvaluation)
+            {
+                m_instanceSrg->SetConstant(m_instanceSrg->FindShaderInputConstantIndex(Name{ "m_bakedPlaybackSpeed" }), playbackSpeed);
+                m_instanceSrg->SetConstant(m_instanceSrg->FindShaderInputConstantIndex(Name{ "m_bakedTimeOffset" }), timeOffset);
+                m_instanceSrg->Compile();
+            }
+        }
+
         void SkinnedMeshDispatchItem::OnShaderReinitialized(const CachedSkinnedMeshShaderOptions* cachedShaderOptions)
         {
             m_shaderOptionGroup = cachedShaderOptions->CreateShaderOptionGroup(m_shaderOptions);
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <Atom/Feature/SkinnedMesh/SkinnedMeshFeatureProcessorInterface.h>
 #include <Atom/Feature/SkinnedMesh/SkinnedMeshInputBuffers.h>
 #include <Atom/Feature/SkinnedMesh/SkinnedMeshShaderOptions.h>
 #include <SkinnedMesh/SkinnedMeshShaderOptionsCache.h>
@@ -55,7 +56,8 @@ namespace AZ
                 const SkinnedMeshShaderOptions& shaderOptions,
                 SkinnedMeshFeatureProcessor* skinnedMeshFeatureProcessor,
                 MorphTargetInstanceMetaData morphTargetInstanceMetaData,
-                float morphTargetDeltaIntegerEncoding
+                float morphTargetDeltaIntegerEncoding,
+                const SkinnedMeshFeatureProcessorInterface::BakedMotion& bakedMotion = {}
             );
             ~SkinnedMeshDispatchItem();
 
@@ -71,6 +73,9 @@ namespace AZ
             void Enable();
             void Disable();
             bool IsEnabled() const;
+
+            //! Changes the playback of the baked motion used for GPU pose evaluation.
+            void SetBakedMotionPlayback(float playbackSpeed, float timeOffset);
         private:
             // SkinnedMeshShaderOptionNotificationBus::Handler
             void OnShaderReinitialized(const CachedSkinnedMeshShaderOptions* cachedShaderOptions) override;
@@ -112,6 +117,9 @@ namespace AZ
 
             // Skip the skinning dispatch if this is false
             bool m_isEnabled = true;
+
+            // Optional baked motion, used instead of m_boneTransforms when the pose is evaluated on the GPU
+            SkinnedMeshFeatureProcessorInterface::BakedMotion m_bakedMotion;
         };
 
         //! The skinned mesh compute shader has Nx1x1 threads per group and dispatches a total number of threads greater than or equal to the number of vertices in the mesh, with one vertex skinned per thread.
@@ -25,15 +25,22 @@
 
 #include <Atom/RHI/CommandList.h>
 
+#include <AzCore/Console/Console.h>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/RTTI/TypeInfo.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/bitset.h>
 
 namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(float, r_skinnedMeshReducedUpdateScreenCoverage, 0.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Skinned meshes whose approximate screen coverage is below this value in every view are skinned at a reduced rate. 0 disables the reduced rate.");
+        AZ_CVAR(uint32_t, r_skinnedMeshReducedUpdateInterval, 2, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Number of frames between skinning updates of skinned meshes below r_skinnedMeshReducedUpdateScreenCoverage.");
+
         const char* SkinnedMeshFeatureProcessor::s_featureProcessorName = "SkinnedMeshFeatureProcessor";
 
         void SkinnedMeshFeatureProcessor::Reflect(ReflectContext* context)
@@ -158,13 +165,11 @@ namespace AZ
                                                 }
                                             }
                                             
-                                            for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy->m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
+                                            // A single dispatch item applies all of the active morph targets of the lod
+                                            const MorphTargetDispatchItem* dispatchItem = renderProxy->m_morphTargetDispatchItemsByLod[lodIndex].get();
+                                            if (dispatchItem && dispatchItem->HasActiveMorphTargets())
                                             {
-                                                const MorphTargetDispatchItem* dispatchItem = renderProxy->m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                                                if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
-                                                {
-                                                    m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
-                                                }
+                                                m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
                                             }
                                         }
                                     }
@@ -180,6 +185,8 @@ namespace AZ
                 }
             }
 #else  //[GFX_TODO][ATOM-13564] This is a temporary implementation that submits all of the skinning compute shaders without any culling:
+            ++m_frameIndex;
+
             for (SkinnedMeshRenderProxy& renderProxy : m_renderProxies)
             {
                 if (renderProxy.m_inputBuffers->GetModel()->IsUploadPending())
@@ -195,6 +202,10 @@ namespace AZ
                 ModelDataInstance& modelDataInstance = **renderProxy.m_meshHandle;
                 const RPI::Cullable& cullable = modelDataInstance.GetCullable();
 
+                // Gather the lods needed by any of the views first, so that the update rate is decided once per frame.
+                AZStd::bitset<RPI::ModelLodAsset::LodCountMax> lodsToDispatch;
+                float maxScreenPercentage = 0.0f;
+
                 for (const RPI::ViewPtr& viewPtr : packet.m_views)
                 {
                     RPI::View* view = viewPtr.get();
@@ -214,26 +225,9 @@ namespace AZ
                     {
                     case RPI::Cullable::LodType::SpecificLod:
                     {
-                        AZStd::lock_guard lock(m_dispatchItemMutex);
-                        auto lodIndex = cullable.m_lodData.m_lodConfiguration.m_lodOverride;
-                        
-                        for (const AZStd::unique_ptr<SkinnedMeshDispatchItem>& skinnedMeshDispatchItem : renderProxy.m_dispatchItemsByLod[lodIndex])
-                        {
-                            // Add one skinning dispatch item for each mesh in the lod
-                            if (skinnedMeshDispatchItem->IsEnabled())
-                            {
-                                m_skinningDispatches.insert(&skinnedMeshDispatchItem->GetRHIDispatchItem());
-                            }
-                        }
-                        
-                        for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy.m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
-                        {
-                            const MorphTargetDispatchItem* dispatchItem = renderProxy.m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                            if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
-                            {
-                                m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
-                            }
-                        }
+                        lodsToDispatch.set(cullable.m_lodData.m_lodConfiguration.m_lodOverride);
+                        // A specific lod is not reduced by screen coverage.
+                        maxScreenPercentage = AZStd::numeric_limits<float>::max();
                     }
                     break;
                     case RPI::Cullable::LodType::ScreenCoverage:
@@ -248,6 +242,7 @@ namespace AZ
 
                         const float approxScreenPercentage = RPI::ModelLodUtils::ApproxScreenPercentage(
                             pos, cullable.m_lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
+                        maxScreenPercentage = AZStd::max(maxScreenPercentage, approxScreenPercentage);
 
                         for (size_t lodIndex = 0; lodIndex < cullable.m_lodData.m_lods.size(); ++lodIndex)
                         {
@@ -256,29 +251,42 @@ namespace AZ
                             //Note that this supports overlapping lod ranges (to support cross-fading lods, for example)
                             if (approxScreenPercentage >= lod.m_screenCoverageMin && approxScreenPercentage <= lod.m_screenCoverageMax)
                             {
-                                AZStd::lock_guard lock(m_dispatchItemMutex);
-                                for (const AZStd::unique_ptr<SkinnedMeshDispatchItem>& skinnedMeshDispatchItem : renderProxy.m_dispatchItemsByLod[lodIndex])
-                                {
-                                    // Add one skinning dispatch item for each mesh in the lod
-                                    if (skinnedMeshDispatchItem->IsEnabled())
-                                    {
-                                        m_skinningDispatches.insert(&skinnedMeshDispatchItem->GetRHIDispatchItem());
-                                    }
-                                }
-
-                                for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy.m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
-                                {
-                                    const MorphTargetDispatchItem* dispatchItem = renderProxy.m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                                    if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
-                                    {
-                                        m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
-                                    }
-                                }
+                                lodsToDispatch.set(lodIndex);
                             }
                         }
                         break;
                     }
                 }
+
+                // Meshes that are small on every view are skinned at a reduced rate.
+                const uint32_t minUpdateInterval = maxScreenPercentage < r_skinnedMeshReducedUpdateScreenCoverage
+                    ? AZStd::max<uint32_t>(r_skinnedMeshReducedUpdateInterval, 1u)
+                    : 1u;
+
+                for (uint32_t lodIndex = 0; lodIndex < renderProxy.GetLodCount(); ++lodIndex)
+                {
+                    if (!lodsToDispatch.test(lodIndex) || !renderProxy.ShouldDispatchLod(lodIndex, m_frameIndex, minUpdateInterval))
+                    {
+                        continue;
+                    }
+
+                    AZStd::lock_guard lock(m_dispatchItemMutex);
+                    for (const AZStd::unique_ptr<SkinnedMeshDispatchItem>& skinnedMeshDispatchItem : renderProxy.m_dispatchItemsByLod[lodIndex])
+                    {
+                        // Add one skinning dispatch item for each mesh in the lod
+                        if (skinnedMeshDispatchItem->IsEnabled())
+                        {
+                            m_skinningDispatches.insert(&skinnedMeshDispatchItem->GetRHIDispatchItem());
+                        }
+                    }
+
+                    // A single dispatch item applies all of the active morph targets of the lod
+                    const MorphTargetDispatchItem* dispatchItem = renderProxy.m_morphTargetDispatchItemsByLod[lodIndex].get();
+                    if (dispatchItem && dispatchItem->HasActiveMorphTargets())
+                    {
+                        m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
+                    }
+                }
             }
 #endif
         }
@@ -322,6 +330,10 @@ namespace AZ
             {
                 m_renderProxies.erase(handle);
             }
+            else
+            {
+                handle->m_updateFrameOffset = m_nextUpdateFrameOffset++;
+            }
             return handle;
         }
 
@@ -369,6 +381,22 @@ namespace AZ
             }
         }
 
+        void SkinnedMeshFeatureProcessor::SetSkinningUpdateInterval(const SkinnedMeshHandle& handle, uint32_t updateInterval)
+        {
+            if (handle.IsValid())
+            {
+                handle->SetSkinningUpdateInterval(updateInterval);
+            }
+        }
+
+        void SkinnedMeshFeatureProcessor::SetBakedMotionPlayback(const SkinnedMeshHandle& handle, float playbackSpeed, float timeOffset)
+        {
+            if (handle.IsValid())
+            {
+                handle->SetBakedMotionPlayback(playbackSpeed, timeOffset);
+            }
+        }
+
         void SkinnedMeshFeatureProcessor::InitSkinningAndMorphPass(RPI::RenderPipeline* renderPipeline)
         {
             RPI::PassFilter skinPassFilter = RPI::PassFilter::CreateWithPassName(AZ::Name{ "SkinningPass" }, renderPipeline);
@@ -62,6 +62,8 @@ namespace AZ
             void SetMorphTargetWeights(const SkinnedMeshHandle& handle, uint32_t lodIndex, const AZStd::vector<float>& weights) override;
             void EnableSkinning(const SkinnedMeshHandle& handle, uint32_t lodIndex, uint32_t meshIndex) override;
             void DisableSkinning(const SkinnedMeshHandle& handle, uint32_t lodIndex, uint32_t meshIndex) override;
+            void SetSkinningUpdateInterval(const SkinnedMeshHandle& handle, uint32_t updateInterval) override;
+            void SetBakedMotionPlayback(const SkinnedMeshHandle& handle, float playbackSpeed, float timeOffset) override;
 
             Data::Instance<RPI::Shader> GetSkinningShader() const;
             RPI::ShaderOptionGroup CreateSkinningShaderOptionGroup(const SkinnedMeshShaderOptions shaderOptions, SkinnedMeshShaderOptionNotificationBus::Handler& shaderReinitializedHandler);
@@ -97,6 +99,11 @@ namespace AZ
 
             AZStd::mutex m_dispatchItemMutex;
 
+            // Frame counter used to schedule reduced rate skinning
+            uint32_t m_frameIndex = 0;
+            // Spreads the reduced rate updates of skinned meshes over different frames
+            uint32_t m_nextUpdateFrameOffset = 0;
+
         };
     } // namespace Render
 } // namespace AZ
@@ -266,18 +266,16 @@ namespace AZ
             float minWeight = 0.0f,
             float maxWeight = 1.0f)
         {
+            // The morphTarget refers to an offset within the larger per-lod morph buffer, which all
+            // morph targets of the lod share so they can be applied in a single dispatch
             m_morphTargetComputeMetaDatas.push_back(MorphTargetComputeMetaData{
-                minWeight, maxWeight, morphTarget.m_minPositionDelta, morphTarget.m_maxPositionDelta, morphTarget.m_numVertices, morphTarget.m_meshIndex });
+                minWeight, maxWeight, morphTarget.m_minPositionDelta, morphTarget.m_maxPositionDelta, morphTarget.m_numVertices, morphTarget.m_meshIndex,
+                morphTarget.m_startIndex });
 
-            // Create a view into the larger per-lod morph buffer for this particular morph
-            // The morphTarget itself refers to an offset from within the mesh, so combine that
-            // with the mesh offset to get the view within the lod buffer
-            RHI::BufferViewDescriptor morphView = morphBufferAssetView->GetBufferViewDescriptor();
-            morphView.m_elementOffset += morphTarget.m_startIndex;
-            morphView.m_elementCount = morphTarget.m_numVertices;
-            RPI::BufferAssetView morphTargetDeltaView{ morphBufferAssetView->GetBufferAsset(), morphView };
-
-            m_morphTargetInputBuffers.push_back(aznew MorphTargetInputBuffers{ morphTargetDeltaView, bufferNamePrefix });
+            if (!m_morphTargetInputBuffers)
+            {
+                m_morphTargetInputBuffers = aznew MorphTargetInputBuffers{ *morphBufferAssetView, bufferNamePrefix };
+            }
         }
 
         const AZStd::vector<MorphTargetComputeMetaData>& SkinnedMeshInputLod::GetMorphTargetComputeMetaDatas() const
@@ -285,7 +283,7 @@ namespace AZ
             return m_morphTargetComputeMetaDatas;
         }
 
-        const AZStd::vector<AZStd::intrusive_ptr<MorphTargetInputBuffers>>& SkinnedMeshInputLod::GetMorphTargetInputBuffers() const
+        const AZStd::intrusive_ptr<MorphTargetInputBuffers>& SkinnedMeshInputLod::GetMorphTargetInputBuffers() const
         {
             return m_morphTargetInputBuffers;
         }
@@ -347,6 +345,9 @@ namespace AZ
 
             if (m_model)
             {
+                // Skinning needs the buffers of every lod, the model may be shared with a static mesh streaming its lods
+                m_model->MakeAllLodsResident();
+
                 m_lods.resize(m_model->GetLodCount());
                 for (uint32_t lodIndex = 0; lodIndex < m_model->GetLodCount(); ++lodIndex)
                 {
@@ -398,7 +399,7 @@ namespace AZ
             return m_lods[lodIndex].m_morphTargetComputeMetaDatas;
         }
 
-        const AZStd::vector<AZStd::intrusive_ptr<MorphTargetInputBuffers>>& SkinnedMeshInputBuffers::GetMorphTargetInputBuffers(uint32_t lodIndex) const
+        const AZStd::intrusive_ptr<MorphTargetInputBuffers>& SkinnedMeshInputBuffers::GetMorphTargetInputBuffers(uint32_t lodIndex) const
         {
             return m_lods[lodIndex].m_morphTargetInputBuffers;
         }
@@ -28,6 +28,7 @@ namespace AZ
             , m_meshHandle(desc.m_meshHandle)
             , m_boneTransforms(desc.m_boneTransforms)
             , m_shaderOptions(desc.m_shaderOptions)
+            , m_bakedMotion(desc.m_bakedMotion)
         {
         }
 
@@ -71,7 +72,7 @@ namespace AZ
 
             // Create a vector of dispatch items for each lod
             m_dispatchItemsByLod.emplace_back(AZStd::vector<AZStd::unique_ptr<SkinnedMeshDispatchItem>>());
-            m_morphTargetDispatchItemsByLod.emplace_back(AZStd::vector<AZStd::unique_ptr<MorphTargetDispatchItem>>());
+            m_morphTargetDispatchItemsByLod.emplace_back(nullptr);
 
             size_t meshCount = m_inputBuffers->GetMeshCount(modelLodIndex);
             m_dispatchItemsByLod[modelLodIndex].reserve(meshCount);
@@ -89,7 +90,8 @@ namespace AZ
                         m_shaderOptions,
                         m_featureProcessor,
                         m_instance->m_morphTargetInstanceMetaData[modelLodIndex][meshIndex],
-                        m_inputBuffers->GetMorphTargetIntegerEncoding(modelLodIndex, meshIndex)});
+                        m_inputBuffers->GetMorphTargetIntegerEncoding(modelLodIndex, meshIndex),
+                        m_bakedMotion});
             }
 
             AZ_Assert(m_dispatchItemsByLod.size() == modelLodIndex + 1, "Skinned Mesh Feature Processor - Mismatch in size between the fixed vector of dispatch items and the lod being initialized");
@@ -101,31 +103,34 @@ namespace AZ
                 }
             }
 
-            size_t morphTargetCount = m_inputBuffers->GetMorphTargetInputBuffers(modelLodIndex).size();
-            AZ_Assert(
-                m_inputBuffers->GetMorphTargetComputeMetaDatas(modelLodIndex).size() == morphTargetCount,
-                "SkinnedMeshRenderProxy: Invalid SkinnedMeshInputBuffers have mis-matched morph target input buffers and compute metadata");
-            m_morphTargetDispatchItemsByLod[modelLodIndex].reserve(morphTargetCount);
-
-            // Create one dispatch item per morph target, in the order that they were originally added
-            // to the skinned mesh to stay in sync with the animation system
-            for (size_t morphTargetIndex = 0; morphTargetIndex < morphTargetCount; ++morphTargetIndex)
+            const AZStd::vector<MorphTargetComputeMetaData>& morphTargetMetaDatas = m_inputBuffers->GetMorphTargetComputeMetaDatas(modelLodIndex);
+            if (!morphTargetMetaDatas.empty())
             {
-                const MorphTargetComputeMetaData& metaData =
-                    m_inputBuffers->GetMorphTargetComputeMetaDatas(modelLodIndex)[morphTargetIndex];
+                AZ_Assert(
+                    m_inputBuffers->GetMorphTargetInputBuffers(modelLodIndex),
+                    "SkinnedMeshRenderProxy: Invalid SkinnedMeshInputBuffers have morph target compute metadata without morph target input buffers");
 
-                m_morphTargetDispatchItemsByLod[modelLodIndex].emplace_back(
+                AZStd::vector<float> morphTargetIntegerEncodings;
+                morphTargetIntegerEncodings.reserve(meshCount);
+                for (uint32_t meshIndex = 0; meshIndex < meshCount; ++meshIndex)
+                {
+                    morphTargetIntegerEncodings.push_back(m_inputBuffers->GetMorphTargetIntegerEncoding(modelLodIndex, meshIndex));
+                }
+
+                // Create one dispatch item that applies all of the morph targets of the lod. The weights are kept
+                // in the order that the morph targets were originally added to the skinned mesh to stay in sync with the animation system
+                m_morphTargetDispatchItemsByLod[modelLodIndex].reset(
                     aznew MorphTargetDispatchItem
                     {
-                        m_inputBuffers->GetMorphTargetInputBuffers(modelLodIndex)[morphTargetIndex],
-                        metaData,
+                        m_inputBuffers->GetMorphTargetInputBuffers(modelLodIndex),
+                        morphTargetMetaDatas,
                         m_featureProcessor,
-                        m_instance->m_morphTargetInstanceMetaData[modelLodIndex][metaData.m_meshIndex],
-                        m_inputBuffers->GetMorphTargetIntegerEncoding(modelLodIndex, metaData.m_meshIndex)
+                        m_instance->m_morphTargetInstanceMetaData[modelLodIndex],
+                        morphTargetIntegerEncodings
                     });
 
                 // Initialize the MorphTargetDispatchItem we just created
-                if (!m_morphTargetDispatchItemsByLod[modelLodIndex].back()->Init())
+                if (!m_morphTargetDispatchItemsByLod[modelLodIndex]->Init())
                 {
                     return false;
                 }
@@ -138,24 +143,36 @@ namespace AZ
         {
             if (m_boneTransforms)
             {
+                if (data == m_skinningMatrices)
+                {
+                    return;
+                }
+                m_skinningMatrices = data;
                 m_boneTransforms->UpdateData(data.data(), data.size() * sizeof(float));
+                OnPoseChanged();
             }
         }
 
         void SkinnedMeshRenderProxy::SetMorphTargetWeights(uint32_t lodIndex, const AZStd::vector<float>& weights)
         {
-            auto& morphTargetDispatchItems = m_morphTargetDispatchItemsByLod[lodIndex];
+            auto& morphTargetDispatchItem = m_morphTargetDispatchItemsByLod[lodIndex];
+            if (!morphTargetDispatchItem)
+            {
+                AZ_Assert(weights.empty(), "Skinned Mesh Feature Processor - Morph target weights passed into SetMorphTargetWeight for a lod without morph targets.");
+                return;
+            }
 
-            AZ_Assert(morphTargetDispatchItems.size() == weights.size(), "Skinned Mesh Feature Processor - Morph target weights passed into SetMorphTargetWeight don't align with morph target dispatch items.");
-            for (size_t morphIndex = 0; morphIndex < weights.size(); ++morphIndex)
+            AZ_Assert(morphTargetDispatchItem->GetMorphTargetCount() == weights.size(), "Skinned Mesh Feature Processor - Morph target weights passed into SetMorphTargetWeight don't align with the morph targets of the lod.");
+            if (morphTargetDispatchItem->SetWeights(weights))
             {
-                morphTargetDispatchItems[morphIndex]->SetWeight(weights[morphIndex]);
+                OnPoseChanged();
             }
         }
 
         void SkinnedMeshRenderProxy::EnableSkinning(uint32_t lodIndex, uint32_t meshIndex)
         {
             m_dispatchItemsByLod[lodIndex][meshIndex]->Enable();
+            OnPoseChanged();
         }
 
         void SkinnedMeshRenderProxy::DisableSkinning(uint32_t lodIndex, uint32_t meshIndex)
@@ -163,6 +180,59 @@ namespace AZ
             m_dispatchItemsByLod[lodIndex][meshIndex]->Disable();
         }
 
+        void SkinnedMeshRenderProxy::SetSkinningUpdateInterval(uint32_t updateInterval)
+        {
+            m_skinningUpdateInterval = AZStd::max(updateInterval, 1u);
+        }
+
+        void SkinnedMeshRenderProxy::SetBakedMotionPlayback(float playbackSpeed, float timeOffset)
+        {
+            AZ_Warning("SkinnedMeshRenderProxy", m_bakedMotion.IsValid(), "Setting the baked motion playback of a skinned mesh without a baked motion.");
+            m_bakedMotion.m_playbackSpeed = playbackSpeed;
+            m_bakedMotion.m_timeOffset = timeOffset;
+            for (const auto& dispatchItems : m_dispatchItemsByLod)
+            {
+                for (const AZStd::unique_ptr<SkinnedMeshDispatchItem>& dispatchItem : dispatchItems)
+                {
+                    dispatchItem->SetBakedMotionPlayback(playbackSpeed, timeOffset);
+                }
+            }
+        }
+
+        bool SkinnedMeshRenderProxy::ShouldDispatchLod(uint32_t lodIndex, uint32_t frameIndex, uint32_t minUpdateInterval)
+        {
+            LodSkinningState& state = m_lodSkinningStates[lodIndex];
+
+            // The output and the position history already hold the current pose.
+            // A baked motion changes the pose on the GPU every frame.
+            if (!m_bakedMotion.IsValid() && state.m_hasDispatched && state.m_dispatchesWithCurrentPose >= 2)
+            {
+                return false;
+            }
+
+            // A reduced rate mesh waits for its update frame, unless the lod has fallen behind,
+            // e.g. because it just became visible again.
+            const uint32_t updateInterval = AZStd::max(m_skinningUpdateInterval, minUpdateInterval);
+            const bool isUpToDate = state.m_hasDispatched && (frameIndex - state.m_lastDispatchFrame) <= updateInterval;
+            if (isUpToDate && (frameIndex + m_updateFrameOffset) % updateInterval != 0)
+            {
+                return false;
+            }
+
+            state.m_lastDispatchFrame = frameIndex;
+            state.m_hasDispatched = true;
+            ++state.m_dispatchesWithCurrentPose;
+            return true;
+        }
+
+        void SkinnedMeshRenderProxy::OnPoseChanged()
+        {
+            for (LodSkinningState& state : m_lodSkinningStates)
+            {
+                state.m_dispatchesWithCurrentPose = 0;
+            }
+        }
+
         uint32_t SkinnedMeshRenderProxy::GetLodCount() const
         {
             return aznumeric_caster(m_dispatchItemsByLod.size());
@@ -43,6 +43,8 @@ namespace AZ
             void SetMorphTargetWeights(uint32_t lodIndex, const AZStd::vector<float>& weights);
             void EnableSkinning(uint32_t lodIndex, uint32_t meshIndex);
             void DisableSkinning(uint32_t lodIndex, uint32_t meshIndex);
+            void SetSkinningUpdateInterval(uint32_t updateInterval);
+            void SetBakedMotionPlayback(float playbackSpeed, float timeOffset);
 
             uint32_t GetLodCount() const;
             AZStd::span<const AZStd::unique_ptr<SkinnedMeshDispatchItem>> GetDispatchItems(uint32_t lodIndex) const;
@@ -53,14 +55,40 @@ namespace AZ
             bool Init(const RPI::Scene& scene, SkinnedMeshFeatureProcessor* featureProcessor);
             bool BuildDispatchItem(const RPI::Scene& scene, uint32_t modelLodIndex, const SkinnedMeshShaderOptions& shaderOptions);
 
+            //! Returns true if the skinning and morph targets of the lod need to be dispatched this frame, and records the dispatch.
+            //! minUpdateInterval is the update interval requested by the feature processor, e.g. for a mesh that is small on screen.
+            bool ShouldDispatchLod(uint32_t lodIndex, uint32_t frameIndex, uint32_t minUpdateInterval);
+            //! Forces every lod to be skinned again with the new pose.
+            void OnPoseChanged();
+
+            // Skinning state of a lod, used to skip dispatches whose output is already in the skinned mesh output stream.
+            struct LodSkinningState
+            {
+                // Frame index of the last dispatch of the lod
+                uint32_t m_lastDispatchFrame = 0;
+                // Number of dispatches since the pose last changed. The position history matches the
+                // current positions after two dispatches of the same pose.
+                uint32_t m_dispatchesWithCurrentPose = 0;
+                bool m_hasDispatched = false;
+            };
+
             AZStd::fixed_vector<AZStd::vector<AZStd::unique_ptr<SkinnedMeshDispatchItem>>, RPI::ModelLodAsset::LodCountMax> m_dispatchItemsByLod;
-            AZStd::fixed_vector<AZStd::vector<AZStd::unique_ptr<MorphTargetDispatchItem>>, RPI::ModelLodAsset::LodCountMax> m_morphTargetDispatchItemsByLod;
+            // One dispatch item per lod that applies all of its active morph targets, or null if the lod has no morph targets
+            AZStd::fixed_vector<AZStd::unique_ptr<MorphTargetDispatchItem>, RPI::ModelLodAsset::LodCountMax> m_morphTargetDispatchItemsByLod;
             Data::Instance<SkinnedMeshInputBuffers> m_inputBuffers;
             AZStd::intrusive_ptr<SkinnedMeshInstance> m_instance;
             AZStd::shared_ptr<MeshFeatureProcessorInterface::MeshHandle> m_meshHandle;
             SkinnedMeshShaderOptions m_shaderOptions;
+            SkinnedMeshFeatureProcessorInterface::BakedMotion m_bakedMotion;
 
             Data::Instance<RPI::Buffer> m_boneTransforms;
+            // Copy of the last skinning matrices, used to detect when the pose didn't change
+            AZStd::vector<float> m_skinningMatrices;
+
+            AZStd::array<LodSkinningState, RPI::ModelLodAsset::LodCountMax> m_lodSkinningStates;
+            uint32_t m_skinningUpdateInterval = 1;
+            // Offsets the frames a reduced rate mesh is updated on, so that meshes don't all update on the same frame
+            uint32_t m_updateFrameOffset = 0;
 
             SkinnedMeshFeatureProcessor* m_featureProcessor = nullptr;
         };
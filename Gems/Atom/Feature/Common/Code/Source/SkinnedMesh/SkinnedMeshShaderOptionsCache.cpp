@@ -28,6 +28,10 @@ namespace AZ
             m_applyMorphTargetFalseValue = layout->FindValue(m_applyMorphTargetOptionIndex, AZ::Name("false"));
             m_applyMorphTargetTrueValue = layout->FindValue(m_applyMorphTargetOptionIndex, AZ::Name("true"));
 
+            m_gpuPoseEvaluationOptionIndex = layout->FindShaderOptionIndex(AZ::Name("o_gpuPoseEvaluation"));
+            m_gpuPoseEvaluationFalseValue = layout->FindValue(m_gpuPoseEvaluationOptionIndex, AZ::Name("false"));
+            m_gpuPoseEvaluationTrueValue = layout->FindValue(m_gpuPoseEvaluationOptionIndex, AZ::Name("true"));
+
             SkinnedMeshShaderOptionNotificationBus::Event(this, &SkinnedMeshShaderOptionNotificationBus::Events::OnShaderReinitialized, this);
         }
 
@@ -58,6 +62,15 @@ namespace AZ
                 shaderOptionGroup.SetValue(m_applyMorphTargetOptionIndex, m_applyMorphTargetFalseValue);
             }
 
+            if (shaderOptions.m_gpuPoseEvaluation)
+            {
+                shaderOptionGroup.SetValue(m_gpuPoseEvaluationOptionIndex, m_gpuPoseEvaluationTrueValue);
+            }
+            else
+            {
+                shaderOptionGroup.SetValue(m_gpuPoseEvaluationOptionIndex, m_gpuPoseEvaluationFalseValue);
+            }
+
             shaderOptionGroup.SetUnspecifiedToDefaultValues();
 
             return shaderOptionGroup;
@@ -55,6 +55,10 @@ namespace AZ
             RPI::ShaderOptionIndex m_applyMorphTargetOptionIndex;
             RPI::ShaderOptionValue m_applyMorphTargetFalseValue;
             RPI::ShaderOptionValue m_applyMorphTargetTrueValue;
+
+            RPI::ShaderOptionIndex m_gpuPoseEvaluationOptionIndex;
+            RPI::ShaderOptionValue m_gpuPoseEvaluationFalseValue;
+            RPI::ShaderOptionValue m_gpuPoseEvaluationTrueValue;
         };
     } // namespace Render
 } // namespace AZ
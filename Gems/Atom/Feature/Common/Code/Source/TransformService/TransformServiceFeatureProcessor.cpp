@@ -13,6 +13,7 @@
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/Utils/Utils.h>
+#include <AzCore/std/algorithm.h>
 
 #include <cinttypes>
 
@@ -22,6 +23,10 @@ namespace AZ
     {
         constexpr size_t BufferReserveCount = 1024;
 
+        // Unchanged slots between two dirty ones are uploaded as well when the gap is at most this many slots,
+        // since a few extra bytes are cheaper than a separate update
+        constexpr uint32_t MaxUploadGapSlots = 4;
+
         void TransformServiceFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -50,6 +55,9 @@ namespace AZ
         {
             m_objectToWorldTransforms = {};
             m_objectToWorldInverseTransposeTransforms = {};
+            m_objectToWorldHistoryTransforms = {};
+            m_dirtyTransformIndices = {};
+            m_dirtyHistoryIndices = {};
 
             m_objectToWorldBuffer = nullptr;
             m_objectToWorldInverseTransposeBuffer = nullptr;
@@ -67,10 +75,12 @@ namespace AZ
             m_updateSceneSrgHandler.Disconnect();
         }
         
-        void TransformServiceFeatureProcessor::PrepareBuffers()
+        bool TransformServiceFeatureProcessor::PrepareBuffers()
         {
             AZ_Assert(!m_isWriteable, "Must be called between OnBeginPrepareRender() and OnEndPrepareRender()");
 
+            bool buffersReallocated = false;
+
             RHI::BufferDescriptor desc;
             desc.m_bindFlags = RHI::BufferBindFlags::ShaderRead;
 
@@ -93,6 +103,7 @@ namespace AZ
 
                     desc2.m_bufferName = "m_objectToWorldHistoryBuffer";
                     m_objectToWorldHistoryBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc2);
+                    buffersReallocated = true;
                 }
                 else
                 {
@@ -100,6 +111,7 @@ namespace AZ
                     {
                         m_objectToWorldBuffer->Resize(byteCount);
                         m_objectToWorldHistoryBuffer->Resize(byteCount);
+                        buffersReallocated = true;
                     }
                 }
             }
@@ -120,15 +132,39 @@ namespace AZ
                     desc2.m_elementSize = elementSize;
 
                     m_objectToWorldInverseTransposeBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc2);
+                    buffersReallocated = true;
                 }
                 else
                 {
                     if (byteCount > m_objectToWorldInverseTransposeBuffer->GetBufferSize())
                     {
                         m_objectToWorldInverseTransposeBuffer->Resize(byteCount);
+                        buffersReallocated = true;
                     }
                 }
             }
+
+            return buffersReallocated;
+        }
+
+        void TransformServiceFeatureProcessor::UploadSlots(
+            RPI::Buffer& buffer, const AZStd::vector<Float4x3>& slots, const AZStd::vector<uint32_t>& sortedIndices)
+        {
+            static_assert(TransformValueSize == NormalValueSize, "Transform and normal slots are expected to have the same size");
+
+            for (size_t rangeStart = 0; rangeStart < sortedIndices.size();)
+            {
+                size_t rangeEnd = rangeStart + 1;
+                while (rangeEnd < sortedIndices.size() && sortedIndices[rangeEnd] - sortedIndices[rangeEnd - 1] <= MaxUploadGapSlots + 1)
+                {
+                    ++rangeEnd;
+                }
+
+                const uint32_t firstSlot = sortedIndices[rangeStart];
+                const uint32_t slotCount = sortedIndices[rangeEnd - 1] - firstSlot + 1;
+                buffer.UpdateData(&slots[firstSlot], slotCount * TransformValueSize, firstSlot * TransformValueSize);
+                rangeStart = rangeEnd;
+            }
         }
 
         void TransformServiceFeatureProcessor::UpdateSceneSrg(RPI::ShaderResourceGroup *sceneSrg)
@@ -142,26 +178,57 @@ namespace AZ
         {
             m_isWriteable = false;
 
-            if (m_historyBufferNeedsUpdate || m_deviceBufferNeedsUpdate)
+            if (!m_historyBufferNeedsUpdate && !m_deviceBufferNeedsUpdate && m_dirtyTransformIndices.empty() && m_dirtyHistoryIndices.empty())
             {
-                PrepareBuffers();
-                if (m_historyBufferNeedsUpdate)
-                {
-                    m_objectToWorldHistoryBuffer->UpdateData(m_objectToWorldHistoryTransforms.data(), m_objectToWorldHistoryTransforms.size() * TransformValueSize);
-                    m_historyBufferNeedsUpdate = false;
-                }
+                return;
+            }
 
-                if (m_deviceBufferNeedsUpdate)
-                {
-                    // copy data to the buffers
-                    m_objectToWorldBuffer->UpdateData(m_objectToWorldTransforms.data(), m_objectToWorldTransforms.size() * TransformValueSize);
-                    m_objectToWorldInverseTransposeBuffer->UpdateData(m_objectToWorldInverseTransposeTransforms.data(), m_objectToWorldInverseTransposeTransforms.size() * NormalValueSize);
+            if (PrepareBuffers())
+            {
+                m_deviceBufferNeedsUpdate = true;
+                m_historyBufferNeedsUpdate = true;
+            }
+
+            // The history buffer holds last frame's transforms, which only differ from what's on the GPU for the objects that moved last frame
+            if (m_historyBufferNeedsUpdate)
+            {
+                m_objectToWorldHistoryBuffer->UpdateData(m_objectToWorldHistoryTransforms.data(), m_objectToWorldHistoryTransforms.size() * TransformValueSize);
+                m_historyBufferNeedsUpdate = false;
+            }
+            else
+            {
+                UploadSlots(*m_objectToWorldHistoryBuffer, m_objectToWorldHistoryTransforms, m_dirtyHistoryIndices);
+            }
+            m_dirtyHistoryIndices.clear();
 
-                    m_objectToWorldHistoryTransforms = m_objectToWorldTransforms;
+            if (m_deviceBufferNeedsUpdate)
+            {
+                // copy data to the buffers
+                m_objectToWorldBuffer->UpdateData(m_objectToWorldTransforms.data(), m_objectToWorldTransforms.size() * TransformValueSize);
+                m_objectToWorldInverseTransposeBuffer->UpdateData(m_objectToWorldInverseTransposeTransforms.data(), m_objectToWorldInverseTransposeTransforms.size() * NormalValueSize);
+
+                m_objectToWorldHistoryTransforms = m_objectToWorldTransforms;
+
+                m_dirtyTransformIndices.clear();
+                m_deviceBufferNeedsUpdate = false;
+                m_historyBufferNeedsUpdate = true;
+            }
+            else if (!m_dirtyTransformIndices.empty())
+            {
+                // Only upload the slots that changed, an object can be moved several times per frame
+                AZStd::sort(m_dirtyTransformIndices.begin(), m_dirtyTransformIndices.end());
+                m_dirtyTransformIndices.erase(
+                    AZStd::unique(m_dirtyTransformIndices.begin(), m_dirtyTransformIndices.end()), m_dirtyTransformIndices.end());
+
+                UploadSlots(*m_objectToWorldBuffer, m_objectToWorldTransforms, m_dirtyTransformIndices);
+                UploadSlots(*m_objectToWorldInverseTransposeBuffer, m_objectToWorldInverseTransposeTransforms, m_dirtyTransformIndices);
 
-                    m_deviceBufferNeedsUpdate = false;
-                    m_historyBufferNeedsUpdate = true;
+                // Keep this frame's transforms of the moved objects for next frame's history, the others already match the GPU
+                for (const uint32_t index : m_dirtyTransformIndices)
+                {
+                    m_objectToWorldHistoryTransforms[index] = m_objectToWorldTransforms[index];
                 }
+                m_dirtyHistoryIndices.swap(m_dirtyTransformIndices);
             }
         }
 
@@ -213,7 +280,7 @@ namespace AZ
 
                 // Inverse transpose to take the non-uniform scale out of the transform for usage with normals.
                 matrix3x4.GetInverseFull().GetTranspose3x3().StoreToRowMajorFloat12(m_objectToWorldInverseTransposeTransforms.at(id.GetIndex()).m_transform);
-                m_deviceBufferNeedsUpdate = true;
+                m_dirtyTransformIndices.push_back(id.GetIndex());
             }
         }
 
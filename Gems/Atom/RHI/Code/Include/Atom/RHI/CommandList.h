@@ -88,6 +88,12 @@ namespace AZ::RHI
         /// Builds a Top Level Acceleration Structure (TLAS) for ray tracing operations, which is made up of RayTracingInstance entries that refer to a BLAS entry
         virtual void BuildTopLevelAccelerationStructure(const RHI::RayTracingTlas& rayTracingTlas) = 0;
 
+        /// Updates (refits) a Top Level Acceleration Structure (TLAS) after its instances were rewritten with RayTracingTlas::UpdateBuffers()
+        virtual void UpdateTopLevelAccelerationStructure(const RHI::RayTracingTlas& rayTracingTlas) = 0;
+
+        /// Copies a Bottom Level Acceleration Structure (BLAS) into the compacted buffers created with RayTracingBlas::CreateCompactedBuffers()
+        virtual void CompactBottomLevelAccelerationStructure(const RHI::RayTracingBlas& rayTracingBlas) = 0;
+
         /// Defines the submit range for a CommandList
         /// Note: the default is 0 items, which disables validation for items submitted outside of the framegraph
         struct SubmitRange
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
+#include <Atom/RHI.Reflect/TransientAttachmentStatistics.h>
 #include <Atom/RHI/Object.h>
 #include <Atom/RHI/ObjectCache.h>
 #include <Atom/RHI/ImageView.h>
@@ -207,6 +208,10 @@ namespace AZ::RHI
             FrameGraph& frameGraph,
             FrameSchedulerCompileFlags compileFlags);
 
+        /// Moves graphics queue scopes that only need compute and copy functionality to the compute queue.
+        /// Only used when r_frameGraphAutoAsyncCompute is enabled.
+        void AssignAsyncComputeQueues(FrameGraph& frameGraph);
+
         void ExtendTransientAttachmentAsyncQueueLifetimes(
             FrameGraph& frameGraph,
             FrameSchedulerCompileFlags compileFlags);
@@ -238,5 +243,10 @@ namespace AZ::RHI
         // once they have been replaced with a new view instance. 
         AZStd::unordered_map<ImageResourceViewData, HashValue64> m_imageReverseLookupHash;
         AZStd::unordered_map<BufferResourceViewData, HashValue64> m_bufferReverseLookupHash;
+
+        // Memory hint pools size their heaps with an extra pass over the transient attachments. The size only depends on the
+        // transient attachment layout, so it is kept and reused until the layout changes (e.g. when the pass tree changes).
+        HashValue64 m_transientAttachmentLayoutHash = HashValue64{ 0 };
+        AZStd::optional<TransientAttachmentStatistics::MemoryUsage> m_transientAttachmentMemoryUsage;
     };
 }
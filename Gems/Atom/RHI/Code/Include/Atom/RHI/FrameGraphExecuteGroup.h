@@ -9,6 +9,7 @@
 
 #include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
 #include <Atom/RHI/FrameGraphExecuteContext.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/RTTI/RTTI.h>
@@ -54,6 +55,9 @@ namespace AZ::RHI
         //! If parallel, they may be called independently from any thread.
         JobPolicy GetJobPolicy() const;
 
+        //! Returns the CPU time spent recording the context at index \param contextIndex, between its BeginContext and EndContext calls.
+        AZStd::chrono::microseconds GetContextRecordingTime(uint32_t contextIndex) const;
+
     protected:
         FrameGraphExecuteGroup() = default;
 
@@ -127,6 +131,8 @@ namespace AZ::RHI
 
         JobPolicy m_jobPolicy = JobPolicy::Serial;
         AZStd::vector<FrameGraphExecuteContext> m_contexts;
+        AZStd::vector<AZStd::chrono::steady_clock::time_point> m_contextBeginTimes;
+        AZStd::vector<AZStd::chrono::microseconds> m_contextRecordingTimes;
         AZStd::atomic_int m_contextCountActive = { 0 };
         AZStd::atomic_int m_contextCountCompleted = { 0 };
         AZStd::atomic_bool m_isSubmittable = { false };
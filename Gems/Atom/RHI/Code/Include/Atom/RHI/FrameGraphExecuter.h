@@ -11,6 +11,7 @@
 #include <Atom/RHI/DeviceObject.h>
 #include <Atom/RHI/FrameGraphExecuteGroup.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <Atom/RHI.Reflect/PlatformLimitsDescriptor.h>
 
 namespace AZ::RHI
@@ -124,6 +125,12 @@ namespace AZ::RHI
         //! Returns a list of the registered execute groups.
         AZStd::span<const AZStd::unique_ptr<FrameGraphExecuteGroup>> GetGroups() const;
 
+        //! Returns the cost used to partition the scope into execute groups and command lists. Platforms pass
+        //! the cost estimated from the scope contents, and while r_frameGraphTimedScopeCosts is enabled
+        //! this is replaced by the CPU time previous frames spent recording the scope, converted into the
+        //! same units as the estimates. Scopes that haven't been recorded before keep the estimated cost.
+        uint32_t GetScopeCost(const ScopeId& scopeId, uint32_t estimatedScopeCost);
+
     private:
         //////////////////////////////////////////////////////////////////////////
         // Platform API
@@ -147,6 +154,8 @@ namespace AZ::RHI
 
         //////////////////////////////////////////////////////////////////////////
 
+        void UpdateScopeRecordingTimes();
+
         JobPolicy m_jobPolicy = JobPolicy::Serial;
 
         AZStd::mutex m_pendingContextGroupLock;
@@ -155,6 +164,17 @@ namespace AZ::RHI
 
         FrameGraphExecuterDescriptor m_descriptor;
 
+        struct ScopeCost
+        {
+            //! The cost estimated by the platform for the current frame
+            uint32_t m_estimatedCost = 0;
+            //! A running average of the CPU time spent recording the scope, or zero if it hasn't been recorded yet
+            float m_recordingTimeUs = 0.0f;
+        };
+        AZStd::unordered_map<ScopeId, ScopeCost> m_scopeCosts;
+
+        //! A running average of the ratio between estimated costs and recording times across all recorded scopes
+        float m_costPerRecordingUs = 0.0f;
     };
 
     template <typename FrameGraphExecuteGroupType>
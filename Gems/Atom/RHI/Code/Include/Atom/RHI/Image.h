@@ -65,6 +65,10 @@ namespace AZ::RHI
         //! Returns the most detailed mip level currently resident in memory, where a value of 0
         //! is the highest detailed mip.
         uint32_t GetResidentMipLevel() const;
+
+        //! Returns the number of most detailed mips which are streamed per tile, see StreamingImageInitRequest::m_enableTileStreaming.
+        //! These mips are visible to image views even though they are only partially resident. 0 if the image isn't tile streamed.
+        uint32_t GetTiledMipCount() const;
             
         //! Returns the set of queue classes that are supported for usage as an attachment on the frame scheduler.
         //! Effectively, for a scope of a specific hardware class to use the image as an attachment, the queue must
@@ -116,6 +120,9 @@ namespace AZ::RHI
         /// The resident mip level of this image (e.g. 0 being the top, most detailed mip).
         uint32_t m_residentMipLevel = 0;
 
+        /// The number of tile streamed mips of this image.
+        uint32_t m_tiledMipCount = 0;
+
         /// Aspects supported by the image
         ImageAspectFlags m_aspectFlags = ImageAspectFlags::None;
     };
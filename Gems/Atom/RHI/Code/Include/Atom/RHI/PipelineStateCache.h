@@ -11,6 +11,8 @@
 #include <Atom/RHI/PipelineLibrary.h>
 #include <Atom/RHI/ThreadLocalContext.h>
 #include <AzCore/std/containers/bitset.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/condition_variable.h>
 #include <AzCore/Utils/TypeHash.h>
 
 namespace UnitTest
@@ -82,6 +84,20 @@ namespace AZ::RHI
     //!      This is the fast-path case where multiple threads are now able to resolve pipeline states with very
     //!      little performance overhead.
     //!
+    //!  4. A thread requests an un-cached pipeline state with AcquirePipelineStateAsync:
+    //!
+    //!      The pipeline state is allocated in the pending cache as usual, but compilation is queued as a job instead of
+    //!      being performed on the calling thread. The caller receives the fallback pipeline state it provided, as does
+    //!      every thread requesting the same pipeline state until the job completes. Once compiled, the pipeline state
+    //!      itself is returned. Callers can poll IsPipelineStateCompiling to know when to acquire again.
+    //!
+    //!  5. A thread requests a pipeline state with AcquirePipelineState while its AcquirePipelineStateAsync compile is pending:
+    //!
+    //!      AcquirePipelineState never returns a pipeline state that is still queued for asynchronous compilation. If the
+    //!      job hasn't started yet, the calling thread compiles the pipeline state itself and the job is skipped. Otherwise
+    //!      the calling thread waits for the job to finish. This also applies to pipeline states that Compact merged into
+    //!      the read-only cache while their compile was still running.
+    //!
     //! Example Usage:
     //! @code{.cpp}
     //!      // Create library instance.
@@ -136,11 +152,28 @@ namespace AZ::RHI
         //! is held externally, the instance will remain valid even after the cache is reset / destroyed.
         const PipelineState* AcquirePipelineState(PipelineLibraryHandle library, const PipelineStateDescriptor& descriptor);
 
+        //! Acquires a pipeline state like AcquirePipelineState, but never compiles on the calling thread. If the pipeline state
+        //! has not finished compiling, its compilation is queued on a worker thread (if not already in progress) and the
+        //! fallback pipeline state is returned instead. The fallback must be compatible with the descriptor, e.g. the pipeline
+        //! state of the root shader variant, and may be null if the caller would rather skip the draw.
+        //! When the fallback is returned and compilingPipelineState is not null, it receives the requested pipeline state so the
+        //! caller can poll IsPipelineStateCompiling to know when to acquire again.
+        const PipelineState* AcquirePipelineStateAsync(
+            PipelineLibraryHandle library,
+            const PipelineStateDescriptor& descriptor,
+            const PipelineState* fallbackPipelineState,
+            ConstPtr<PipelineState>* compilingPipelineState = nullptr);
+
+        //! Returns whether the pipeline state is still queued or being compiled by a job from AcquirePipelineStateAsync.
+        bool IsPipelineStateCompiling(const PipelineState* pipelineState) const;
+
         //! This method merges the global pending cache into the global read-only cache and clears all thread-local caches.
         //! This reduces the total memory footprint of the caches and optimizes subsequent fetches. This method should be called
         //! once per frame.
         void Compact();
 
+        ~PipelineStateCache();
+
     private:
         PipelineStateCache(Device& device);
 
@@ -227,6 +260,30 @@ namespace AZ::RHI
             const PipelineStateDescriptor& pipelineStateDescriptor,
             PipelineStateHash pipelineStateHash);
 
+        //! Lazily initializes the thread-local pipeline library on first access.
+        void InitThreadLibrary(const GlobalLibraryEntry& globalLibraryEntry, ThreadLibraryEntry& threadLibraryEntry);
+
+        //! Initializes an allocated pipeline state from its descriptor, using the pipeline library if it is initialized.
+        ResultCode InitPipelineState(PipelineState& pipelineState, const PipelineStateDescriptor& descriptor, PipelineLibrary* pipelineLibrary);
+
+        //! Compiles a pipeline state allocated by AcquirePipelineStateAsync on the calling (worker) thread, unless a thread
+        //! acquiring it synchronously already took over its compilation.
+        void CompilePipelineStateAsync(PipelineLibraryHandle handle, const PipelineStateEntry& pipelineStateEntry);
+
+        //! Takes ownership of the asynchronous compilation of the pipeline state. Returns null if it already completed or
+        //! another thread is compiling it.
+        Ptr<PipelineState> ClaimAsyncCompile(const PipelineState* pipelineState);
+
+        //! Marks an asynchronous compilation claimed with ClaimAsyncCompile as completed and wakes up waiting threads.
+        void CompleteAsyncCompile(const PipelineState* pipelineState);
+
+        //! Makes sure a pipeline state returned by AcquirePipelineState is not still pending asynchronous compilation, either by
+        //! compiling it on the calling thread if its job hasn't started, or by waiting for the job to finish.
+        void WaitForAsyncCompile(PipelineLibraryHandle handle, const PipelineState* pipelineState, const PipelineStateDescriptor& descriptor);
+
+        //! Blocks until all compilations queued by AcquirePipelineStateAsync have completed.
+        void WaitForAsyncCompiles() const;
+
         //! Resets the library without validating the handle or taking a lock.
         void ResetLibraryImpl(PipelineLibraryHandle handle);
 
@@ -245,6 +302,24 @@ namespace AZ::RHI
         /// Tracks whether the library at the bit index is active.
         AZStd::bitset<LibraryCountMax> m_globalLibraryActiveBits;
 
+        struct AsyncCompileEntry
+        {
+            /// The pipeline state to compile. Held here so a thread acquiring it synchronously can compile it instead of the job.
+            Ptr<PipelineState> m_pipelineState;
+            /// Set once the job or an acquiring thread has taken over the compilation.
+            bool m_isCompiling = false;
+        };
+
+        /// The pipeline states queued or being compiled by jobs from AcquirePipelineStateAsync.
+        AZStd::unordered_map<const PipelineState*, AsyncCompileEntry> m_asyncCompilingPipelineStates;
+        /// The number of compile jobs that haven't finished running. Guarded by m_asyncCompileMutex.
+        uint32_t m_asyncCompileJobCount = 0;
+        mutable AZStd::mutex m_asyncCompileMutex;
+        mutable AZStd::condition_variable m_asyncCompileCondition;
+
+        /// The size of m_asyncCompilingPipelineStates, readable without taking m_asyncCompileMutex.
+        AZStd::atomic_uint32_t m_asyncCompilePendingCount = {0};
+
         /// The free list of handles. This free list is checked first before expanding the watermark in order
         /// to recycle slots in m_globalLibrarySet.
         AZStd::fixed_vector<PipelineLibraryHandle, LibraryCountMax> m_libraryFreeList;
@@ -26,12 +26,14 @@ namespace AZ::RHI
         //!
         //! FAST_TRACE: Sets a preference to build the RTAS to have faster raytracing capabilities. Can incur longer build times.
         //! FAST_BUILD: Sets a preference for faster build times of the Acceleration Structure over faster raytracing.
-        //! ENABLE_UPDATE: Enables incremental updating of a BLAS object. Needs to be set at BLAS creation time.
+        //! ENABLE_UPDATE: Enables incremental updating (refit) of a BLAS or TLAS object. Needs to be set at creation time.
+        //! ENABLE_COMPACTION: Enables querying the compacted size of a BLAS after it is built, so it can be copied into smaller buffers.
         enum class RayTracingAccelerationStructureBuildFlags : uint32_t
         {
             FAST_TRACE = AZ_BIT(1),
             FAST_BUILD = AZ_BIT(2),
             ENABLE_UPDATE = AZ_BIT(3),
+            ENABLE_COMPACTION = AZ_BIT(4),
         };
         AZ_DEFINE_ENUM_BITWISE_OPERATORS(AZ::RHI::RayTracingAccelerationStructureBuildFlags);
 
@@ -120,9 +122,20 @@ namespace AZ::RHI
         //! Creates the internal BLAS buffers from the descriptor
         ResultCode CreateBuffers(Device& device, const RayTracingBlasDescriptor* descriptor, const RayTracingBufferPools& rayTracingBufferPools);
 
+        //! Creates buffers of the compacted size for the BLAS, the current BLAS buffers become the source of the compaction copy.
+        //! The copy is recorded with CommandList::CompactBottomLevelAccelerationStructure(), after which the BLAS refers to the compacted buffers.
+        ResultCode CreateCompactedBuffers(Device& device, uint64_t compactedSizeInBytes, const RayTracingBufferPools& rayTracingBufferPools);
+
         //! Returns true if the RayTracingBlas has been initialized
         virtual bool IsValid() const = 0;
 
+        //! Returns the compacted size of the BLAS as reported by the GPU, or 0 if the size is not available (yet).
+        //! The BLAS must have been created with the ENABLE_COMPACTION build flag and its build must have completed on the GPU.
+        virtual uint64_t GetCompactedSizeInBytes() const = 0;
+
+        //! Returns the size of the current BLAS buffer
+        virtual uint64_t GetSizeInBytes() const = 0;
+
         RayTracingGeometryVector& GetGeometries()
         {
             return m_geometries;
@@ -131,6 +144,7 @@ namespace AZ::RHI
     private:
         // Platform API
         virtual RHI::ResultCode CreateBuffersInternal(RHI::Device& deviceBase, const RHI::RayTracingBlasDescriptor* descriptor, const RayTracingBufferPools& rayTracingBufferPools) = 0;
+        virtual RHI::ResultCode CreateCompactedBuffersInternal(RHI::Device& deviceBase, uint64_t compactedSizeInBytes, const RayTracingBufferPools& rayTracingBufferPools) = 0;
 
         RayTracingGeometryVector m_geometries;
     };
@@ -189,6 +203,8 @@ namespace AZ::RHI
 
         uint32_t GetNumInstancesInBuffer() const { return m_numInstancesInBuffer; }
 
+        [[nodiscard]] const RayTracingAccelerationStructureBuildFlags& GetBuildFlags() const { return m_buildFlags; }
+
         // build operations
         RayTracingTlasDescriptor* Build();
         RayTracingTlasDescriptor* Instance();
@@ -201,10 +217,12 @@ namespace AZ::RHI
         RayTracingTlasDescriptor* Blas(const RHI::Ptr<RHI::RayTracingBlas>& blas);
         RayTracingTlasDescriptor* InstancesBuffer(const RHI::Ptr<RHI::Buffer>& tlasInstances);
         RayTracingTlasDescriptor* NumInstances(uint32_t numInstancesInBuffer);
+        RayTracingTlasDescriptor* BuildFlags(const RHI::RayTracingAccelerationStructureBuildFlags& buildFlags);
 
     private:
         RayTracingTlasInstanceVector m_instances;
         RayTracingTlasInstance* m_buildContext = nullptr;
+        RayTracingAccelerationStructureBuildFlags m_buildFlags = AZ::RHI::RayTracingAccelerationStructureBuildFlags::FAST_TRACE;
 
         // externally created Instances buffer, cannot be combined with other Instances
         RHI::Ptr<RHI::Buffer> m_instancesBuffer;
@@ -226,6 +244,13 @@ namespace AZ::RHI
         //! Creates the internal TLAS buffers from the descriptor
         ResultCode CreateBuffers(Device& device, const RayTracingTlasDescriptor* descriptor, const RayTracingBufferPools& rayTracingBufferPools);
 
+        //! Prepares the TLAS for an update (refit) with CommandList::UpdateTopLevelAccelerationStructure().
+        //! Only the instances that changed since the instance buffer was last written are rewritten.
+        //! The descriptor must contain the same number of instances as the last CreateBuffers() call, and the TLAS must
+        //! have been created with the ENABLE_UPDATE build flag. Returns ResultCode::InvalidOperation if the TLAS cannot be
+        //! updated, in which case it needs to be recreated with CreateBuffers() and rebuilt.
+        ResultCode UpdateBuffers(Device& device, const RayTracingTlasDescriptor* descriptor, const RayTracingBufferPools& rayTracingBufferPools);
+
         //! Returns the TLAS RHI buffer
         virtual const RHI::Ptr<RHI::Buffer> GetTlasBuffer() const = 0;
         virtual const RHI::Ptr<RHI::Buffer> GetTlasInstancesBuffer() const = 0;
@@ -233,5 +258,6 @@ namespace AZ::RHI
     private:
         // Platform API
         virtual RHI::ResultCode CreateBuffersInternal(RHI::Device& deviceBase, const RHI::RayTracingTlasDescriptor* descriptor, const RayTracingBufferPools& rayTracingBufferPools) = 0;
+        virtual RHI::ResultCode UpdateBuffersInternal(RHI::Device& deviceBase, const RHI::RayTracingTlasDescriptor* descriptor, const RayTracingBufferPools& rayTracingBufferPools) = 0;
     };
 }
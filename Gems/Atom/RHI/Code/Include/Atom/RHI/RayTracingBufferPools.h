@@ -34,6 +34,7 @@ namespace AZ::RHI
         const RHI::Ptr<RHI::BufferPool>& GetBlasBufferPool() const;
         const RHI::Ptr<RHI::BufferPool>& GetTlasInstancesBufferPool() const;
         const RHI::Ptr<RHI::BufferPool>& GetTlasBufferPool() const;
+        const RHI::Ptr<RHI::BufferPool>& GetCompactionSizeReadbackBufferPool() const;
 
         // operations
         void Init(RHI::Ptr<RHI::Device>& device);
@@ -46,6 +47,7 @@ namespace AZ::RHI
         virtual RHI::BufferBindFlags GetBlasBufferBindFlags() const { return RHI::BufferBindFlags::ShaderReadWrite | RHI::BufferBindFlags::RayTracingAccelerationStructure; }
         virtual RHI::BufferBindFlags GetTlasInstancesBufferBindFlags() const { return RHI::BufferBindFlags::ShaderReadWrite; }
         virtual RHI::BufferBindFlags GetTlasBufferBindFlags() const { return RHI::BufferBindFlags::RayTracingAccelerationStructure; }
+        virtual RHI::BufferBindFlags GetCompactionSizeReadbackBufferBindFlags() const { return RHI::BufferBindFlags::CopyWrite; }
 
     private:
         bool m_initialized = false;
@@ -54,5 +56,6 @@ namespace AZ::RHI
         RHI::Ptr<RHI::BufferPool> m_blasBufferPool;
         RHI::Ptr<RHI::BufferPool> m_tlasInstancesBufferPool;
         RHI::Ptr<RHI::BufferPool> m_tlasBufferPool;
+        RHI::Ptr<RHI::BufferPool> m_compactionSizeReadbackBufferPool;
     };
 }
@@ -72,6 +72,20 @@ namespace AZ::RHI
 
         //! Update the view hash within m_viewHash
         void UpdateViewHash(const AZ::Name& viewName, const HashValue64 viewHash);
+
+        //! The parts of the group modified since a copy of its compiled data was last written.
+        struct CompiledDataUpdate
+        {
+            //! ShaderResourceGroupData::ResourceTypeMask bits of the modified resource types.
+            uint32_t m_resourceTypeMask = 0;
+            //! Byte interval of the modified constant data. Empty if no constant was modified.
+            Interval m_constantDataInterval;
+        };
+
+        //! For platforms keeping one copy of the compiled data per frame in flight. Returns the parts of the group modified
+        //! since the copy at compiledDataIndex was last written, and marks them as written for that copy. Every copy starts
+        //! out fully modified, so only what changed since needs to be written again.
+        CompiledDataUpdate AcquireCompiledDataUpdate(uint32_t compiledDataIndex);
             
     protected:
         ShaderResourceGroup() = default;
@@ -96,5 +110,11 @@ namespace AZ::RHI
 
         // Track hash related to views. This will help ensure we compile views in case they get invalidated and partial srg compilation is enabled
         AZStd::unordered_map<AZ::Name, HashValue64> m_viewHash;
+
+        // Adds modified parts of the group to the pending updates of every compiled data copy.
+        void AddCompiledDataUpdate(uint32_t resourceTypeMask, Interval constantDataInterval);
+
+        // Parts of the group modified since each compiled data copy was last written, see AcquireCompiledDataUpdate.
+        AZStd::array<CompiledDataUpdate, RHI::Limits::Device::FrameCountMax> m_pendingCompiledDataUpdates;
     };
 }
@@ -229,6 +229,10 @@ namespace AZ::RHI
 
         //! Returns the mask that is suppose to indicate which resource type was updated
         uint32_t GetUpdateMask() const;
+
+        //! Returns the byte interval of the constant data modified since the update mask was last reset.
+        //! The interval is empty if no constant was modified.
+        Interval GetConstantDataUpdateInterval() const;
             
         //! Update the indirect buffer view with the indices of all the image views which reside in the global gpu heap.
         //! Ideally higher level code can access bindless heap indices directly from the view and populate any indirect
@@ -265,6 +269,10 @@ namespace AZ::RHI
         static const ConstPtr<BufferView> s_nullBufferView;
         static const SamplerState s_nullSamplerState;
 
+        //! Enables compilation of the constant data, and adds the modified bytes to the constant data update interval.
+        void EnableConstantDataCompilation(ShaderInputConstantIndex inputIndex);
+        void EnableConstantDataCompilation(uint32_t byteOffset, uint32_t byteCount);
+
         bool ValidateSetImageView(ShaderInputImageIndex inputIndex, const ImageView* imageView, uint32_t arrayIndex) const;
         bool ValidateSetBufferView(ShaderInputBufferIndex inputIndex, const BufferView* bufferView, uint32_t arrayIndex) const;
 
@@ -292,37 +300,56 @@ namespace AZ::RHI
 
         //! Mask used to check whether to compile a specific resource type. This mask is managed by RPI and copied over to the RHI every frame. 
         uint32_t m_updateMask = 0;
+
+        //! Bytes of the constant data modified since the update mask was reset, so only those need to be uploaded.
+        Interval m_constantDataUpdateInterval;
     };
 
     template <typename T>
     bool ShaderResourceGroupData::SetConstant(ShaderInputConstantIndex inputIndex, const T& value)
     {
-        EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
-        return m_constantsData.SetConstant(inputIndex, value);
+        if (m_constantsData.SetConstant(inputIndex, value))
+        {
+            EnableConstantDataCompilation(inputIndex);
+            return true;
+        }
+        return false;
     }
 
     template <typename T>
     bool ShaderResourceGroupData::SetConstant(ShaderInputConstantIndex inputIndex, const T& value, uint32_t arrayIndex)
     {
-        EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
-        return m_constantsData.SetConstant(inputIndex, value, arrayIndex);
+        if (m_constantsData.SetConstant(inputIndex, value, arrayIndex))
+        {
+            EnableConstantDataCompilation(inputIndex);
+            return true;
+        }
+        return false;
     }
 
     template<typename T>
     bool ShaderResourceGroupData::SetConstantMatrixRows(ShaderInputConstantIndex inputIndex, const T& value, uint32_t rowCount)
     {
-        EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
-        return m_constantsData.SetConstantMatrixRows(inputIndex, value, rowCount);
+        if (m_constantsData.SetConstantMatrixRows(inputIndex, value, rowCount))
+        {
+            EnableConstantDataCompilation(inputIndex);
+            return true;
+        }
+        return false;
     }
 
     template <typename T>
     bool ShaderResourceGroupData::SetConstantArray(ShaderInputConstantIndex inputIndex, AZStd::span<const T> values)
     {
-        if (!values.empty())
+        if (m_constantsData.SetConstantArray(inputIndex, values))
         {
-            EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
+            if (!values.empty())
+            {
+                EnableConstantDataCompilation(inputIndex);
+            }
+            return true;
         }
-        return m_constantsData.SetConstantArray(inputIndex, values);
+        return false;
     }
 
     template <typename T>
@@ -11,6 +11,7 @@
 #include <Atom/RHI/Image.h>
 #include <Atom/RHI/ImagePoolBase.h>
 
+#include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/span.h>
 
 namespace AZ::RHI
@@ -61,6 +62,13 @@ namespace AZ::RHI
         //! This should only include the baseline set of mips necessary to render the image at
         //! its lowest resolution. The uploads is performed synchronously.
         AZStd::span<const StreamingImageMipSlice> m_tailMipSlices;
+
+        //! Requests the mips more detailed than the tail mip slices be streamed per tile, if the pool supports tiled
+        //! images (see StreamingImagePool::SupportTiledImage). Tiled mips are visible to image views right away, and
+        //! their tiles are made resident and evicted with StreamingImagePool::UpdateImageTiles. Only supported for
+        //! single 2D images. Either all the mips more detailed than the tail mip slices end up tiled, or none if the device
+        //! can't map them per tile; StreamingImagePool::GetImageTileLayout returns how many mips are tiled.
+        bool m_enableTileStreaming = false;
     };
 
     //! A structure used as an argument to StreamingImagePool::ExpandImage.
@@ -84,8 +92,69 @@ namespace AZ::RHI
         CompleteCallback m_completeCallback;
     };
 
+    //! The tile grid of the tiled mips of a tile streamed image.
+    struct StreamingImageTileLayout
+    {
+        //! The size of a tile in texels.
+        Size m_tileSize;
+
+        //! The device memory used by one resident tile.
+        uint32_t m_tileSizeInBytes = 0;
+
+        //! The number of most detailed mips which are streamed per tile. The less detailed mips are
+        //! streamed as whole mips with ExpandImage and TrimImage. 0 if the image isn't tile streamed.
+        uint32_t m_tiledMipCount = 0;
+
+        //! The number of tiles in each dimension for each tiled mip.
+        AZStd::fixed_vector<Size, Limits::Image::MipCountMax> m_mipTileCounts;
+    };
+
+    //! Identifies a tile of a tiled mip.
+    struct StreamingImageTile
+    {
+        uint32_t m_mipLevel = 0;
+        uint32_t m_x = 0;
+        uint32_t m_y = 0;
+    };
+
+    //! A tile to make resident, along with the content of its mip.
+    struct StreamingImageTileData
+    {
+        StreamingImageTile m_tile;
+
+        //! The data of the whole mip the tile belongs to. Only the region covered by the tile is uploaded.
+        const void* m_mipData = nullptr;
+
+        //! The layout of the mip data.
+        ImageSubresourceLayout m_mipLayout;
+    };
+
+    //! A structure used as an argument to StreamingImagePool::UpdateImageTiles.
+    template <typename ImageClass>
+    struct StreamingImageTileRequestTemplate
+    {
+        StreamingImageTileRequestTemplate() = default;
+
+        /// The tile streamed image to update.
+        ImageClass* m_image = nullptr;
+
+        //! Tiles to make resident. The mip data *must* remain valid for the duration of the upload
+        //! (until m_completeCallback is triggered).
+        AZStd::span<const StreamingImageTileData> m_residentTiles;
+
+        //! Tiles to evict. Their memory is released right away, so the GPU must no longer sample them.
+        AZStd::span<const StreamingImageTile> m_evictedTiles;
+
+        /// Whether the function need to wait until the upload is finished.
+        bool m_waitForUpload = false;
+
+        /// A function to call when the upload is complete. It will be called instantly if m_waitForUpload was set to true.
+        CompleteCallback m_completeCallback;
+    };
+
     using StreamingImageInitRequest = StreamingImageInitRequestTemplate<Image>;
     using StreamingImageExpandRequest = StreamingImageExpandRequestTemplate<Image>;
+    using StreamingImageTileRequest = StreamingImageTileRequestTemplate<Image>;
 
     class StreamingImagePool
         : public ImagePoolBase
@@ -113,6 +182,16 @@ namespace AZ::RHI
         //! and the contents are considered undefined.
         ResultCode TrimImage(Image& image, uint32_t targetMipLevel);
 
+        //! Returns the tile grid of an image initialized with tile streaming enabled. The tiled mip count
+        //! is 0 if the image couldn't be tile streamed, in which case it streams whole mips as usual.
+        ResultCode GetImageTileLayout(const Image& image, StreamingImageTileLayout& tileLayout) const;
+
+        //! Evicts and makes resident tiles of the tiled mips of a tile streamed image. Evictions occur immediately;
+        //! the uploads of the resident tiles are performed asynchronously or synchronously depending on
+        //! @m_waitForUpload in @StreamingImageTileRequest. Tiles which aren't resident can't be sampled, the
+        //! shaders are responsible for clamping their sampling to the resident mips of each tile.
+        ResultCode UpdateImageTiles(const StreamingImageTileRequest& request);
+
         const StreamingImagePoolDescriptor& GetDescriptor() const override final;
 
         //! Set a callback function that is called when the pool is out of memory for new allocations
@@ -140,6 +219,7 @@ namespace AZ::RHI
 
         bool ValidateInitRequest(const StreamingImageInitRequest& initRequest) const;
         bool ValidateExpandRequest(const StreamingImageExpandRequest& expandRequest) const;
+        bool ValidateTileRequest(const StreamingImageTileRequest& tileRequest) const;
 
         //////////////////////////////////////////////////////////////////////////
         // Platform API
@@ -155,6 +235,12 @@ namespace AZ::RHI
 
         // Called when an image mips are being trimmed.
         virtual ResultCode TrimImageInternal(Image& image, uint32_t targetMipLevel);
+
+        // Called to query the tile grid of a tile streamed image.
+        virtual ResultCode GetImageTileLayoutInternal(const Image& image, StreamingImageTileLayout& tileLayout) const;
+
+        // Called when tiles of a tile streamed image are being evicted or made resident.
+        virtual ResultCode UpdateImageTilesInternal(const StreamingImageTileRequest& request);
             
         // Called when set a new memory budget.
         virtual ResultCode SetMemoryBudgetInternal(size_t newBudget);
@@ -7,6 +7,7 @@
  */
 #include <Atom/RHI/DrawList.h>
 
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ::RHI
@@ -24,57 +25,184 @@ namespace AZ::RHI
         return DrawListView(&drawList[itemOffset], itemCount);
     }
 
-    void SortDrawList(DrawList& drawList, DrawListSortType sortType)
+    namespace
     {
-        switch (sortType)
+        // Lists shorter than this are sorted with a comparison sort, which beats the fixed cost of the radix passes
+        constexpr size_t RadixSortMinItemCount = 128;
+
+        struct DrawItemRadixSortEntry
         {
-        case DrawListSortType::KeyThenDepth:
-            AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
-                {
-                    if (a.m_sortKey != b.m_sortKey)
+            // The sort keys are cached as unsigned integers with the same ordering as the original sort,
+            // m_highKey is compared first and m_lowKey breaks ties.
+            uint64_t m_lowKey = 0;
+            uint64_t m_highKey = 0;
+            uint32_t m_itemIndex = 0;
+        };
+
+        uint64_t GetOrderedSortKey(DrawItemSortKey sortKey)
+        {
+            // Flipping the sign bit orders signed keys as unsigned
+            return static_cast<uint64_t>(sortKey) ^ (uint64_t{ 1 } << 63);
+        }
+
+        uint64_t GetOrderedDepth(float depth)
+        {
+            // Flip every bit of negative floats and only the sign bit of positive floats to order them as unsigned
+            uint32_t bits;
+            memcpy(&bits, &depth, sizeof(bits));
+            return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+        }
+
+        void SortDrawListByComparison(DrawList& drawList, DrawListSortType sortType)
+        {
+            switch (sortType)
+            {
+            case DrawListSortType::KeyThenDepth:
+                AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
                     {
+                        if (a.m_sortKey != b.m_sortKey)
+                        {
+                            return a.m_sortKey < b.m_sortKey;
+                        }
+                        return a.m_depth < b.m_depth;
+                    }
+                );
+                break;
+
+            case DrawListSortType::KeyThenReverseDepth:
+                AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
+                    {
+                        if (a.m_sortKey != b.m_sortKey)
+                        {
+                            return a.m_sortKey < b.m_sortKey;
+                        }
+                        return a.m_depth > b.m_depth;
+                    }
+                );
+                break;
+
+            case DrawListSortType::DepthThenKey:
+                AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
+                    {
+                        if (a.m_depth != b.m_depth)
+                        {
+                            return a.m_depth < b.m_depth;
+                        }
                         return a.m_sortKey < b.m_sortKey;
                     }
-                    return a.m_depth < b.m_depth;
-                }
-            );
-            break;
+                );
+                break;
 
-        case DrawListSortType::KeyThenReverseDepth:
-            AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
-                {
-                    if (a.m_sortKey != b.m_sortKey)
+            case DrawListSortType::ReverseDepthThenKey:
+                AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
                     {
+                        if (a.m_depth != b.m_depth)
+                        {
+                            return a.m_depth > b.m_depth;
+                        }
                         return a.m_sortKey < b.m_sortKey;
                     }
-                    return a.m_depth > b.m_depth;
+                );
+                break;
+            }
+        }
+
+        void SortDrawListByRadix(DrawList& drawList, DrawListSortType sortType)
+        {
+            constexpr size_t DigitCount = 2 * sizeof(uint64_t);
+            constexpr size_t BucketCount = 256;
+
+            const size_t itemCount = drawList.size();
+            AZStd::vector<DrawItemRadixSortEntry> entries(itemCount);
+            AZStd::vector<DrawItemRadixSortEntry> scratch(itemCount);
+
+            // Cache the keys once, and build every digit histogram in the same pass
+            AZStd::array<AZStd::array<uint32_t, BucketCount>, DigitCount> histograms = {};
+            for (size_t i = 0; i < itemCount; ++i)
+            {
+                const DrawItemProperties& item = drawList[i];
+                const uint64_t sortKey = GetOrderedSortKey(item.m_sortKey);
+                uint64_t depth = GetOrderedDepth(item.m_depth);
+
+                DrawItemRadixSortEntry& entry = entries[i];
+                switch (sortType)
+                {
+                case DrawListSortType::KeyThenDepth:
+                    entry.m_highKey = sortKey;
+                    entry.m_lowKey = depth;
+                    break;
+                case DrawListSortType::KeyThenReverseDepth:
+                    entry.m_highKey = sortKey;
+                    entry.m_lowKey = ~depth & 0xFFFFFFFFu;
+                    break;
+                case DrawListSortType::DepthThenKey:
+                    entry.m_highKey = depth;
+                    entry.m_lowKey = sortKey;
+                    break;
+                case DrawListSortType::ReverseDepthThenKey:
+                    entry.m_highKey = ~depth & 0xFFFFFFFFu;
+                    entry.m_lowKey = sortKey;
+                    break;
                 }
-            );
-            break;
+                entry.m_itemIndex = static_cast<uint32_t>(i);
 
-        case DrawListSortType::DepthThenKey:
-            AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
+                for (size_t digit = 0; digit < DigitCount; ++digit)
                 {
-                    if (a.m_depth != b.m_depth)
-                    {
-                        return a.m_depth < b.m_depth;
-                    }
-                    return a.m_sortKey < b.m_sortKey;
+                    const uint64_t key = digit < sizeof(uint64_t) ? entry.m_lowKey : entry.m_highKey;
+                    ++histograms[digit][(key >> ((digit % sizeof(uint64_t)) * 8)) & 0xFF];
                 }
-            );
-            break;
+            }
+
+            // Least significant digit first, each pass is stable so the earlier passes break ties of the later ones
+            for (size_t digit = 0; digit < DigitCount; ++digit)
+            {
+                AZStd::array<uint32_t, BucketCount>& histogram = histograms[digit];
 
-        case DrawListSortType::ReverseDepthThenKey:
-            AZStd::sort(drawList.begin(), drawList.end(), [](const DrawItemProperties& a, const DrawItemProperties& b)
+                // Skip digits that are the same for every item, such as the unused upper bytes of the depth
+                // or sort keys that only use their lower bits
+                const uint8_t firstBucket = static_cast<uint8_t>(
+                    ((digit < sizeof(uint64_t) ? entries[0].m_lowKey : entries[0].m_highKey) >> ((digit % sizeof(uint64_t)) * 8)) & 0xFF);
+                if (histogram[firstBucket] == itemCount)
                 {
-                    if (a.m_depth != b.m_depth)
-                    {
-                        return a.m_depth > b.m_depth;
-                    }
-                    return a.m_sortKey < b.m_sortKey;
+                    continue;
+                }
+
+                uint32_t offset = 0;
+                for (uint32_t& bucket : histogram)
+                {
+                    const uint32_t count = bucket;
+                    bucket = offset;
+                    offset += count;
                 }
-            );
-            break;
+
+                const size_t shift = (digit % sizeof(uint64_t)) * 8;
+                for (const DrawItemRadixSortEntry& entry : entries)
+                {
+                    const uint64_t key = digit < sizeof(uint64_t) ? entry.m_lowKey : entry.m_highKey;
+                    scratch[histogram[(key >> shift) & 0xFF]++] = entry;
+                }
+                entries.swap(scratch);
+            }
+
+            DrawList sortedList;
+            sortedList.reserve(drawList.capacity());
+            for (const DrawItemRadixSortEntry& entry : entries)
+            {
+                sortedList.push_back(drawList[entry.m_itemIndex]);
+            }
+            drawList.swap(sortedList);
+        }
+    }
+
+    void SortDrawList(DrawList& drawList, DrawListSortType sortType)
+    {
+        if (drawList.size() < RadixSortMinItemCount)
+        {
+            SortDrawListByComparison(drawList, sortType);
+        }
+        else
+        {
+            SortDrawListByRadix(drawList, sortType);
         }
     }
 }
@@ -13,16 +13,31 @@
 #include <Atom/RHI/FrameGraph.h>
 #include <Atom/RHI/ImageFrameAttachment.h>
 #include <Atom/RHI/ImageScopeAttachment.h>
+#include <Atom/RHI/QueryPool.h>
 #include <Atom/RHI/RHIUtils.h>
 #include <Atom/RHI/Scope.h>
 #include <Atom/RHI/SwapChainFrameAttachment.h>
 #include <Atom/RHI/TransientAttachmentPool.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Utils/TypeHash.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/optional.h>
 
 namespace AZ::RHI
 {
+    AZ_CVAR(bool, r_frameGraphCacheTransientMemoryUsage, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Reuse the transient attachment memory usage of the previous frame while the transient attachment layout is unchanged, "
+        "instead of computing it with an extra compile pass every frame.");
+
+    AZ_CVAR(bool, r_frameGraphAutoAsyncCompute, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Automatically move graphics queue scopes that only need compute and copy functionality to the async compute queue.");
+
+    AZ_CVAR(uint32_t, r_frameGraphAutoAsyncComputeMinOverlap, 2, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The minimum number of graphics queue scopes that must run between a scope moved to the async compute queue and the first "
+        "graphics queue scope consuming its results. Scopes consumed sooner stay on the graphics queue, since the graphics queue "
+        "would only wait for them.");
+
     ResultCode FrameGraphCompiler::Init(Device& device)
     {
         if (Validation::IsEnabled())
@@ -60,6 +75,8 @@ namespace AZ::RHI
             m_bufferViewCache.Clear();
             m_imageReverseLookupHash.clear();
             m_bufferReverseLookupHash.clear();
+            m_transientAttachmentLayoutHash = HashValue64{ 0 };
+            m_transientAttachmentMemoryUsage.reset();
                
             ShutdownInternal();
             DeviceObject::Shutdown();
@@ -154,6 +171,85 @@ namespace AZ::RHI
         return CompileInternal(request);
     }
 
+    void FrameGraphCompiler::AssignAsyncComputeQueues(FrameGraph& frameGraph)
+    {
+        AZ_PROFILE_SCOPE(RHI, "FrameGraphCompiler: AssignAsyncComputeQueues");
+
+        const ScopeAttachmentUsageMask graphicsOnlyUsages = ScopeAttachmentUsageMask::RenderTarget | ScopeAttachmentUsageMask::DepthStencil |
+            ScopeAttachmentUsageMask::Resolve | ScopeAttachmentUsageMask::Predication | ScopeAttachmentUsageMask::SubpassInput |
+            ScopeAttachmentUsageMask::InputAssembly | ScopeAttachmentUsageMask::ShadingRate;
+
+        const auto isComputeQueueCompatible = [graphicsOnlyUsages](const Scope& scope)
+        {
+            // Scopes without attachments are left alone, since nothing tells what they record.
+            if (scope.GetAttachments().empty() || !scope.GetResolveAttachments().empty() || !scope.GetSwapChainsToPresent().empty())
+            {
+                return false;
+            }
+
+            for (const ScopeAttachment* scopeAttachment : scope.GetAttachments())
+            {
+                if (!CheckBitsAny(scopeAttachment->GetFrameAttachment().GetSupportedQueueMask(), HardwareQueueClassMask::Compute))
+                {
+                    return false;
+                }
+
+                for (const ScopeAttachmentUsageAndAccess& usageAndAccess : scopeAttachment->GetUsageAndAccess())
+                {
+                    if (CheckBitsAny(graphicsOnlyUsages, static_cast<ScopeAttachmentUsageMask>(AZ_BIT(static_cast<uint32_t>(usageAndAccess.m_usage)))))
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            // Occlusion and pipeline statistics queries are only available on the graphics queue.
+            for (const Ptr<QueryPool>& queryPool : scope.m_queryPools)
+            {
+                if (queryPool->GetDescriptor().m_type != QueryType::Timestamp)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        };
+
+        // Scopes are visited from last to first, so the queues of all consumers are known when a scope is visited. Moving a scope
+        // only pays off if the graphics queue has other work to overlap it with, so a scope is only moved if enough graphics scopes
+        // run before the first graphics scope that consumes it. Consumers that were moved as well stay on the same queue, which lets
+        // chains of compute scopes (e.g. SSAO or light culling) move as a whole with a single cross-queue wait at the end.
+        const AZStd::vector<Scope*>& scopes = frameGraph.GetScopes();
+        const uint32_t scopeCount = static_cast<uint32_t>(scopes.size());
+
+        // The number of graphics scopes with an index greater than or equal to the array index.
+        AZStd::vector<uint32_t> graphicsScopeCountFrom(scopeCount + 1, 0);
+        for (uint32_t scopeIndex = scopeCount; scopeIndex-- > 0;)
+        {
+            Scope* scope = scopes[scopeIndex];
+            if (scope->GetHardwareQueueClass() == HardwareQueueClass::Graphics && isComputeQueueCompatible(*scope))
+            {
+                uint32_t overlappedScopeCount = graphicsScopeCountFrom[scopeIndex + 1];
+                for (const Scope* consumer : frameGraph.GetConsumers(*scope))
+                {
+                    if (consumer->GetHardwareQueueClass() == HardwareQueueClass::Graphics)
+                    {
+                        const uint32_t consumerIndex = consumer->GetIndex();
+                        overlappedScopeCount = AZStd::min(overlappedScopeCount, graphicsScopeCountFrom[scopeIndex + 1] - graphicsScopeCountFrom[consumerIndex]);
+                    }
+                }
+
+                if (overlappedScopeCount >= r_frameGraphAutoAsyncComputeMinOverlap)
+                {
+                    scope->m_hardwareQueueClass = HardwareQueueClass::Compute;
+                }
+            }
+
+            graphicsScopeCountFrom[scopeIndex] =
+                graphicsScopeCountFrom[scopeIndex + 1] + (scope->GetHardwareQueueClass() == HardwareQueueClass::Graphics ? 1 : 0);
+        }
+    }
+
     void FrameGraphCompiler::CompileQueueCentricScopeGraph(
         FrameGraph& frameGraph,
         FrameSchedulerCompileFlags compileFlags)
@@ -168,6 +264,10 @@ namespace AZ::RHI
                 scope->m_hardwareQueueClass = HardwareQueueClass::Graphics;
             }
         }
+        else if (r_frameGraphAutoAsyncCompute)
+        {
+            AssignAsyncComputeQueues(frameGraph);
+        }
 
         // Build the per-queue graph by first linking scopes on the same queue
         // with their neighbors. This is because the queue is going to execute serially.
@@ -698,9 +798,37 @@ namespace AZ::RHI
         // Check if we need to do two passes (one for calculating the size and the second one for allocating the resources)
         if (transientAttachmentPool.GetDescriptor().m_heapParameters.m_type == HeapAllocationStrategy::MemoryHint)
         {
-            // First pass to calculate size needed.
-            processCommands(TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
-            memoryUsage = transientAttachmentPool.GetStatistics().m_reservedMemory;
+            // The size needed only depends on the order of the commands and the attachments they activate,
+            // so the size computed for a previous frame with the same layout can be reused.
+            HashValue64 layoutHash = TypeHash64(reinterpret_cast<uintptr_t>(&transientAttachmentPool));
+            layoutHash = TypeHash64(static_cast<uint64_t>(scopes.size()), layoutHash);
+            layoutHash = TypeHash64(reinterpret_cast<const uint8_t*>(commands.data()), commands.size() * sizeof(Command), layoutHash);
+            for (const BufferFrameAttachment* bufferFrameAttachment : transientBufferGraphAttachments)
+            {
+                layoutHash = TypeHash64(bufferFrameAttachment->GetId().GetHash(), layoutHash);
+                layoutHash = bufferFrameAttachment->GetBufferDescriptor().GetHash(layoutHash);
+            }
+            for (const ImageFrameAttachment* imageFrameAttachment : transientImageGraphAttachments)
+            {
+                layoutHash = TypeHash64(imageFrameAttachment->GetId().GetHash(), layoutHash);
+                layoutHash = imageFrameAttachment->GetImageDescriptor().GetHash(layoutHash);
+                layoutHash = TypeHash64(imageFrameAttachment->GetSupportedQueueMask(), layoutHash);
+                layoutHash = imageFrameAttachment->GetOptimizedClearValue().GetHash(layoutHash);
+            }
+
+            if (r_frameGraphCacheTransientMemoryUsage && m_transientAttachmentMemoryUsage && layoutHash == m_transientAttachmentLayoutHash)
+            {
+                memoryUsage = m_transientAttachmentMemoryUsage;
+            }
+            else
+            {
+                // First pass to calculate size needed.
+                processCommands(TransientAttachmentPoolCompileFlags::GatherStatistics | TransientAttachmentPoolCompileFlags::DontAllocateResources);
+                memoryUsage = transientAttachmentPool.GetStatistics().m_reservedMemory;
+
+                m_transientAttachmentLayoutHash = layoutHash;
+                m_transientAttachmentMemoryUsage = memoryUsage;
+            }
         }
 
         // Second pass uses the information about memory usage
@@ -28,6 +28,9 @@ namespace AZ::RHI
             descriptor.m_submitRange = { 0, request.m_scopeEntries[i].m_submitCount };
             m_contexts.emplace_back(descriptor);
         }
+
+        m_contextBeginTimes.resize(m_contexts.size());
+        m_contextRecordingTimes.resize(m_contexts.size());
     }
 
     void FrameGraphExecuteGroup::Init(const InitRequest& request)
@@ -51,6 +54,9 @@ namespace AZ::RHI
             descriptor.m_submitRange = { (i * submitCount) / commandListCount, ((i + 1) * submitCount) / commandListCount };
             m_contexts.emplace_back(descriptor);
         }
+
+        m_contextBeginTimes.resize(m_contexts.size());
+        m_contextRecordingTimes.resize(m_contexts.size());
     }
 
     uint32_t FrameGraphExecuteGroup::GetContextCount() const
@@ -67,6 +73,7 @@ namespace AZ::RHI
                 m_jobPolicy == JobPolicy::Parallel,
                 "Multiple FrameSchedulerExecuteContexts in this batch are being recorded simultaneously, but the job policy forbids it.");
         }
+        m_contextBeginTimes[contextIndex] = AZStd::chrono::steady_clock::now();
         BeginContextInternal(m_contexts[contextIndex], contextIndex);
         return &m_contexts[contextIndex];
     }
@@ -74,6 +81,8 @@ namespace AZ::RHI
     void FrameGraphExecuteGroup::EndContext(uint32_t contextIndex)
     {
         EndContextInternal(m_contexts[contextIndex], contextIndex);
+        m_contextRecordingTimes[contextIndex] = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+            AZStd::chrono::steady_clock::now() - m_contextBeginTimes[contextIndex]);
 
         [[maybe_unused]] const int32_t activeCount = --m_contextCountActive;
         AZ_Assert(activeCount >= 0, "Asymmetric calls to FrameSchedulerExecuteContext:: Begin / End.");
@@ -85,6 +94,11 @@ namespace AZ::RHI
         return m_jobPolicy;
     }
 
+    AZStd::chrono::microseconds FrameGraphExecuteGroup::GetContextRecordingTime(uint32_t contextIndex) const
+    {
+        return m_contextRecordingTimes[contextIndex];
+    }
+
     bool FrameGraphExecuteGroup::IsComplete() const
     {
         return m_contextCountCompleted == static_cast<int32_t>(m_contexts.size());
@@ -10,9 +10,17 @@
 #include <Atom/RHI/FrameGraphExecuter.h>
 #include <Atom/RHI/FrameGraph.h>
 #include <Atom/RHI/Image.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/MathUtils.h>
 
 namespace AZ::RHI
 {
+    AZ_CVAR(bool, r_frameGraphTimedScopeCosts, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Partition scopes into execute groups using the CPU time previous frames spent recording them, instead of only their item and attachment counts.");
+
+    // Weight of the latest frame in the running average of scope recording times
+    static constexpr float ScopeRecordingTimeBlend = 0.25f;
+
     void FrameGraphExecuter::SetJobPolicy(JobPolicy jobPolicy)
     {
         m_jobPolicy = jobPolicy;
@@ -75,6 +83,7 @@ namespace AZ::RHI
     {
         AZ_PROFILE_SCOPE(RHI, "FrameGraphExecuter: End");
         AZ_Assert(m_pendingGroups.empty(), "Pending contexts in queue.");
+        UpdateScopeRecordingTimes();
         m_groups.clear();
         EndInternal();
     }
@@ -101,4 +110,66 @@ namespace AZ::RHI
             m_pendingGroups.pop();
         }
     }
+
+    uint32_t FrameGraphExecuter::GetScopeCost(const ScopeId& scopeId, uint32_t estimatedScopeCost)
+    {
+        ScopeCost& scopeCost = m_scopeCosts[scopeId];
+        scopeCost.m_estimatedCost = estimatedScopeCost;
+
+        if (!r_frameGraphTimedScopeCosts || scopeCost.m_recordingTimeUs <= 0.0f || m_costPerRecordingUs <= 0.0f)
+        {
+            return estimatedScopeCost;
+        }
+
+        // The estimates are calibrated against the recording times of all scopes, so scopes that are more expensive to record
+        // than their item count suggests (and vice versa) are split across more (or fewer) command lists with the same thresholds.
+        return AZStd::max(static_cast<uint32_t>(scopeCost.m_recordingTimeUs * m_costPerRecordingUs), 1u);
+    }
+
+    void FrameGraphExecuter::UpdateScopeRecordingTimes()
+    {
+        AZ_PROFILE_SCOPE(RHI, "FrameGraphExecuter: UpdateScopeRecordingTimes");
+
+        // A scope can be split across several contexts, so sum the contexts of each scope first
+        AZStd::unordered_map<ScopeId, AZStd::chrono::microseconds> frameRecordingTimes;
+        for (const AZStd::unique_ptr<FrameGraphExecuteGroup>& group : m_groups)
+        {
+            for (uint32_t contextIndex = 0; contextIndex < group->GetContextCount(); ++contextIndex)
+            {
+                frameRecordingTimes[group->m_contexts[contextIndex].GetScopeId()] += group->GetContextRecordingTime(contextIndex);
+            }
+        }
+
+        uint64_t totalEstimatedCost = 0;
+        float totalRecordingTimeUs = 0.0f;
+        for (auto scopeCostIter = m_scopeCosts.begin(); scopeCostIter != m_scopeCosts.end();)
+        {
+            auto frameRecordingTimeIter = frameRecordingTimes.find(scopeCostIter->first);
+            if (frameRecordingTimeIter == frameRecordingTimes.end())
+            {
+                // The scope wasn't part of this frame's graph
+                scopeCostIter = m_scopeCosts.erase(scopeCostIter);
+                continue;
+            }
+
+            ScopeCost& scopeCost = scopeCostIter->second;
+            // Recording times under a microsecond still count, so the scope is considered measured
+            const float frameRecordingTimeUs = AZStd::max(static_cast<float>(frameRecordingTimeIter->second.count()), 1.0f);
+            scopeCost.m_recordingTimeUs = scopeCost.m_recordingTimeUs > 0.0f
+                ? AZ::Lerp(scopeCost.m_recordingTimeUs, frameRecordingTimeUs, ScopeRecordingTimeBlend)
+                : frameRecordingTimeUs;
+
+            totalEstimatedCost += scopeCost.m_estimatedCost;
+            totalRecordingTimeUs += frameRecordingTimeUs;
+            ++scopeCostIter;
+        }
+
+        if (totalEstimatedCost > 0 && totalRecordingTimeUs > 0.0f)
+        {
+            const float frameCostPerRecordingUs = static_cast<float>(totalEstimatedCost) / totalRecordingTimeUs;
+            m_costPerRecordingUs = m_costPerRecordingUs > 0.0f
+                ? AZ::Lerp(m_costPerRecordingUs, frameCostPerRecordingUs, ScopeRecordingTimeBlend)
+                : frameCostPerRecordingUs;
+        }
+    }
 }
@@ -45,6 +45,11 @@ namespace AZ::RHI
         return m_residentMipLevel;
     }
 
+    uint32_t Image::GetTiledMipCount() const
+    {
+        return m_tiledMipCount;
+    }
+
     const ImageFrameAttachment* Image::GetFrameAttachment() const
     {
         return static_cast<const ImageFrameAttachment*>(Resource::GetFrameAttachment());
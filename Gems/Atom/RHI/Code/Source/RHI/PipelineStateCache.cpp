@@ -10,6 +10,7 @@
 #include <Atom/RHI/Factory.h>
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/exponential_backoff.h>
 
@@ -24,6 +25,12 @@ namespace AZ::RHI
         : m_device{&device}
     {}
 
+    PipelineStateCache::~PipelineStateCache()
+    {
+        // Compile jobs reference the cache and its device.
+        WaitForAsyncCompiles();
+    }
+
     void PipelineStateCache::ValidateCacheIntegrity() const
     {
 #if defined(AZ_ENABLE_TRACING)
@@ -69,6 +76,7 @@ namespace AZ::RHI
     void PipelineStateCache::Reset()
     {
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        WaitForAsyncCompiles();
 
         for (size_t i = 0; i < m_globalLibrarySet.size(); ++i)
         {
@@ -121,6 +129,7 @@ namespace AZ::RHI
         {
             AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
             AZ_Assert(m_globalLibraryActiveBits[handle.GetIndex()], "Releasing a library that is no longer valid.");
+            WaitForAsyncCompiles();
 
             ResetLibraryImpl(handle);
 
@@ -139,6 +148,7 @@ namespace AZ::RHI
         if (handle.IsValid())
         {
             AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+            WaitForAsyncCompiles();
             ResetLibraryImpl(handle);
         }
     }
@@ -169,6 +179,7 @@ namespace AZ::RHI
         }
 
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
+        WaitForAsyncCompiles();
         const GlobalLibraryEntry& entry = m_globalLibrarySet[handle.GetIndex()];
 
         //! Each thread has its own PipelineLibrary instance. To produce the final serialized data, we
@@ -291,9 +302,10 @@ namespace AZ::RHI
         GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
         PipelineStateHash pipelineStateHash = descriptor.GetHash();
 
-        // Search the read-only cache first.
+        // Search the read-only cache first. Compact may have merged a pipeline state whose asynchronous compile is still running.
         if (const PipelineState* pipelineState = FindPipelineState(globalLibraryEntry.m_readOnlyCache, descriptor))
         {
+            WaitForAsyncCompile(handle, pipelineState, descriptor);
             return pipelineState;
         }
 
@@ -305,29 +317,20 @@ namespace AZ::RHI
 
             if (const PipelineState* pipelineState = FindPipelineState(threadLocalCache, descriptor))
             {
+                WaitForAsyncCompile(handle, pipelineState, descriptor);
                 return pipelineState;
             }
 
             // No entry in the thread-local set. Request a pipeline state from the pending cache and add
             // it to the thread-local cache to reduce contention on the pending cache.
             {
-                // Lazy-init the library on first access.
-                if (!threadLibraryEntry.m_library)
-                {
-                    Ptr<PipelineLibrary> pipelineLibrary = Factory::Get().CreatePipelineLibrary();
-                    RHI::ResultCode resultCode = pipelineLibrary->Init(*m_device, globalLibraryEntry.m_pipelineLibraryDescriptor);
-                    if (resultCode != RHI::ResultCode::Success)
-                    {
-                        AZ_Warning("PipelineStateCache", false, "Failed to initialize pipeline library. PipelineLibrary usage is disabled.");
-                    }
-
-                    // We store a valid pointer even if initialization failed, to avoid attempting
-                    // to re-create it with every access.
-                    threadLibraryEntry.m_library = AZStd::move(pipelineLibrary);
-                }
+                InitThreadLibrary(globalLibraryEntry, threadLibraryEntry);
 
                 ConstPtr<PipelineState> pipelineState = CompilePipelineState(globalLibraryEntry, threadLibraryEntry, descriptor, pipelineStateHash);
 
+                // The pending cache entry may have been allocated by AcquirePipelineStateAsync.
+                WaitForAsyncCompile(handle, pipelineState.get(), descriptor);
+
                 [[maybe_unused]] bool success = InsertPipelineState(threadLocalCache, PipelineStateEntry(pipelineStateHash, pipelineState, descriptor));
                 AZ_Assert(success, "PipelineStateEntry already exists in the thread cache.");
 
@@ -336,6 +339,234 @@ namespace AZ::RHI
         }
     }
 
+    const PipelineState* PipelineStateCache::AcquirePipelineStateAsync(
+        PipelineLibraryHandle handle,
+        const PipelineStateDescriptor& descriptor,
+        const PipelineState* fallbackPipelineState,
+        ConstPtr<PipelineState>* compilingPipelineState)
+    {
+        if (handle.IsNull())
+        {
+            return nullptr;
+        }
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+
+        GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
+
+        const PipelineState* pipelineState = FindPipelineState(globalLibraryEntry.m_readOnlyCache, descriptor);
+        if (!pipelineState)
+        {
+            ThreadLibrarySet& threadLibrarySet = m_threadLibrarySet.GetStorage();
+            pipelineState = FindPipelineState(threadLibrarySet[handle.GetIndex()].m_threadLocalCache, descriptor);
+        }
+
+        if (!pipelineState)
+        {
+            AZStd::lock_guard<AZStd::mutex> pendingLock(globalLibraryEntry.m_pendingCacheMutex);
+
+            pipelineState = FindPipelineState(globalLibraryEntry.m_pendingCache, descriptor);
+            if (!pipelineState)
+            {
+                // Allocate the 'empty' instance in the pending cache so other threads find it, and queue its compilation.
+                // It is marked as compiling before the pending cache is unlocked so no thread can mistake it for a
+                // compiled pipeline state.
+                const PipelineStateHash pipelineStateHash = descriptor.GetHash();
+                Ptr<PipelineState> newPipelineState = Factory::Get().CreatePipelineState();
+                PipelineStateEntry pipelineStateEntry(pipelineStateHash, newPipelineState, descriptor);
+
+                [[maybe_unused]] bool success = InsertPipelineState(globalLibraryEntry.m_pendingCache, pipelineStateEntry);
+                AZ_Assert(success, "PipelineStateEntry already exists in the pending cache.");
+
+                {
+                    AZStd::lock_guard<AZStd::mutex> asyncCompileLock(m_asyncCompileMutex);
+                    m_asyncCompilingPipelineStates.emplace(newPipelineState.get(), AsyncCompileEntry{ newPipelineState });
+                    ++m_asyncCompilePendingCount;
+                    ++m_asyncCompileJobCount;
+                }
+
+                AZ::Job* compileJob = AZ::CreateJobFunction(
+                    [this, handle, pipelineStateEntry = AZStd::move(pipelineStateEntry)]()
+                    {
+                        CompilePipelineStateAsync(handle, pipelineStateEntry);
+                    },
+                    true, nullptr);
+                compileJob->Start();
+
+                if (compilingPipelineState)
+                {
+                    *compilingPipelineState = AZStd::move(newPipelineState);
+                }
+                return fallbackPipelineState;
+            }
+        }
+
+        if (IsPipelineStateCompiling(pipelineState))
+        {
+            if (compilingPipelineState)
+            {
+                *compilingPipelineState = pipelineState;
+            }
+            return fallbackPipelineState;
+        }
+        return pipelineState;
+    }
+
+    bool PipelineStateCache::IsPipelineStateCompiling(const PipelineState* pipelineState) const
+    {
+        // Fast path for when nothing is compiling, which is the common case once the cache is warm.
+        if (m_asyncCompilePendingCount == 0)
+        {
+            return false;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> asyncCompileLock(m_asyncCompileMutex);
+        return m_asyncCompilingPipelineStates.find(pipelineState) != m_asyncCompilingPipelineStates.end();
+    }
+
+    void PipelineStateCache::CompilePipelineStateAsync(PipelineLibraryHandle handle, const PipelineStateEntry& pipelineStateEntry)
+    {
+        AZ_PROFILE_SCOPE(RHI, "PipelineStateCache: CompilePipelineStateAsync");
+
+        // A thread acquiring the pipeline state synchronously may have compiled it before the job started.
+        if (Ptr<PipelineState> pipelineState = ClaimAsyncCompile(pipelineStateEntry.m_pipelineState.get()))
+        {
+            // Libraries are only reset or released after all compile jobs have completed, so the entries are stable without
+            // taking m_mutex. Not taking it keeps Compact from stalling the frame on a long compilation.
+            const GlobalLibraryEntry& globalLibraryEntry = m_globalLibrarySet[handle.GetIndex()];
+            ThreadLibraryEntry& threadLibraryEntry = m_threadLibrarySet.GetStorage()[handle.GetIndex()];
+            InitThreadLibrary(globalLibraryEntry, threadLibraryEntry);
+
+            [[maybe_unused]] ResultCode resultCode = ResultCode::InvalidArgument;
+            AZStd::visit(
+                [&](const auto& descriptor)
+                {
+                    resultCode = InitPipelineState(*pipelineState, descriptor, threadLibraryEntry.m_library.get());
+                },
+                pipelineStateEntry.m_pipelineStateDescriptorVariant);
+
+            AZ_Error("PipelineStateCache", resultCode == ResultCode::Success, "Failed to compile pipeline state. It will remain in an initialized state.");
+            CompleteAsyncCompile(pipelineState.get());
+        }
+
+        {
+            AZStd::lock_guard<AZStd::mutex> asyncCompileLock(m_asyncCompileMutex);
+            --m_asyncCompileJobCount;
+        }
+        m_asyncCompileCondition.notify_all();
+    }
+
+    Ptr<PipelineState> PipelineStateCache::ClaimAsyncCompile(const PipelineState* pipelineState)
+    {
+        AZStd::lock_guard<AZStd::mutex> asyncCompileLock(m_asyncCompileMutex);
+        auto asyncCompileIt = m_asyncCompilingPipelineStates.find(pipelineState);
+        if (asyncCompileIt == m_asyncCompilingPipelineStates.end() || asyncCompileIt->second.m_isCompiling)
+        {
+            return nullptr;
+        }
+
+        asyncCompileIt->second.m_isCompiling = true;
+        return asyncCompileIt->second.m_pipelineState;
+    }
+
+    void PipelineStateCache::CompleteAsyncCompile(const PipelineState* pipelineState)
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> asyncCompileLock(m_asyncCompileMutex);
+            m_asyncCompilingPipelineStates.erase(pipelineState);
+            --m_asyncCompilePendingCount;
+        }
+        m_asyncCompileCondition.notify_all();
+    }
+
+    void PipelineStateCache::WaitForAsyncCompile(
+        PipelineLibraryHandle handle, const PipelineState* pipelineState, const PipelineStateDescriptor& descriptor)
+    {
+        if (!IsPipelineStateCompiling(pipelineState))
+        {
+            return;
+        }
+
+        // Compile on this thread if the job hasn't started. Waiting for it instead could deadlock when every worker
+        // thread is blocked here.
+        if (Ptr<PipelineState> claimedPipelineState = ClaimAsyncCompile(pipelineState))
+        {
+            AZ_PROFILE_SCOPE(RHI, "PipelineStateCache: WaitForAsyncCompile");
+            ThreadLibraryEntry& threadLibraryEntry = m_threadLibrarySet.GetStorage()[handle.GetIndex()];
+            InitThreadLibrary(m_globalLibrarySet[handle.GetIndex()], threadLibraryEntry);
+
+            [[maybe_unused]] ResultCode resultCode = InitPipelineState(*claimedPipelineState, descriptor, threadLibraryEntry.m_library.get());
+            AZ_Error("PipelineStateCache", resultCode == ResultCode::Success, "Failed to compile pipeline state. It will remain in an initialized state.");
+            CompleteAsyncCompile(pipelineState);
+            return;
+        }
+
+        AZStd::unique_lock<AZStd::mutex> asyncCompileLock(m_asyncCompileMutex);
+        m_asyncCompileCondition.wait(
+            asyncCompileLock,
+            [this, pipelineState]()
+            {
+                return m_asyncCompilingPipelineStates.find(pipelineState) == m_asyncCompilingPipelineStates.end();
+            });
+    }
+
+    void PipelineStateCache::WaitForAsyncCompiles() const
+    {
+        // Compile jobs reference the cache even when a synchronous acquire compiled their pipeline state, so wait for the
+        // jobs themselves as well.
+        AZStd::unique_lock<AZStd::mutex> asyncCompileLock(m_asyncCompileMutex);
+        m_asyncCompileCondition.wait(
+            asyncCompileLock,
+            [this]()
+            {
+                return m_asyncCompilingPipelineStates.empty() && m_asyncCompileJobCount == 0;
+            });
+    }
+
+    void PipelineStateCache::InitThreadLibrary(const GlobalLibraryEntry& globalLibraryEntry, ThreadLibraryEntry& threadLibraryEntry)
+    {
+        // Lazy-init the library on first access.
+        if (!threadLibraryEntry.m_library)
+        {
+            Ptr<PipelineLibrary> pipelineLibrary = Factory::Get().CreatePipelineLibrary();
+            RHI::ResultCode resultCode = pipelineLibrary->Init(*m_device, globalLibraryEntry.m_pipelineLibraryDescriptor);
+            if (resultCode != RHI::ResultCode::Success)
+            {
+                AZ_Warning("PipelineStateCache", false, "Failed to initialize pipeline library. PipelineLibrary usage is disabled.");
+            }
+
+            // We store a valid pointer even if initialization failed, to avoid attempting
+            // to re-create it with every access.
+            threadLibraryEntry.m_library = AZStd::move(pipelineLibrary);
+        }
+    }
+
+    ResultCode PipelineStateCache::InitPipelineState(
+        PipelineState& pipelineState, const PipelineStateDescriptor& descriptor, PipelineLibrary* pipelineLibrary)
+    {
+        // If the pipeline library failed to initialize, then we don't use it.
+        if (pipelineLibrary && !pipelineLibrary->IsInitialized())
+        {
+            pipelineLibrary = nullptr;
+        }
+
+        switch (descriptor.GetType())
+        {
+        case PipelineStateType::Draw:
+            return pipelineState.Init(*m_device, static_cast<const PipelineStateDescriptorForDraw&>(descriptor), pipelineLibrary);
+
+        case PipelineStateType::Dispatch:
+            return pipelineState.Init(*m_device, static_cast<const PipelineStateDescriptorForDispatch&>(descriptor), pipelineLibrary);
+
+        case PipelineStateType::RayTracing:
+            return pipelineState.Init(*m_device, static_cast<const PipelineStateDescriptorForRayTracing&>(descriptor), pipelineLibrary);
+
+        default:
+            AZ_Assert(false, "Invalid pipeline state descriptor type specified.");
+            return ResultCode::InvalidArgument;
+        }
+    }
+
     ConstPtr<PipelineState> PipelineStateCache::CompilePipelineState(
         GlobalLibraryEntry& globalLibraryEntry,
         ThreadLibraryEntry& threadLibraryEntry,
@@ -363,8 +594,6 @@ namespace AZ::RHI
             AZ_Assert(success, "PipelineStateEntry already exists in the pending cache.");
         }
 
-        [[maybe_unused]] ResultCode resultCode = ResultCode::InvalidArgument;
-
         // Increment the pending compile count on the global entry, which tracks how many pipeline states
         // are currently being compiled across all threads.
         if (Validation::IsEnabled())
@@ -372,32 +601,9 @@ namespace AZ::RHI
             ++globalLibraryEntry.m_pendingCompileCount;
         }
 
-        // If the pipeline library failed to initialize, then we don't use it.
-        PipelineLibrary* pipelineLibrary = threadLibraryEntry.m_library.get();
-        if (!pipelineLibrary->IsInitialized())
-        {
-            pipelineLibrary = nullptr;
-        }
-
         // We no longer have the lock, but we own compilation of the pipeline state. Use the
         // thread-local library to perform compilation without blocking other threads.
-        switch (descriptor.GetType())
-        {
-        case PipelineStateType::Draw:
-            resultCode = pipelineState->Init(*m_device, static_cast<const PipelineStateDescriptorForDraw&>(descriptor), pipelineLibrary);
-            break;
-
-        case PipelineStateType::Dispatch:
-            resultCode = pipelineState->Init(*m_device, static_cast<const PipelineStateDescriptorForDispatch&>(descriptor), pipelineLibrary);
-            break;
-
-        case PipelineStateType::RayTracing:
-            resultCode = pipelineState->Init(*m_device, static_cast<const PipelineStateDescriptorForRayTracing&>(descriptor), pipelineLibrary);
-            break;
-
-        default:
-            AZ_Assert(false, "Invalid pipeline state descriptor type specified.");
-        }
+        [[maybe_unused]] ResultCode resultCode = InitPipelineState(*pipelineState, descriptor, threadLibraryEntry.m_library.get());
 
         if (Validation::IsEnabled())
         {
@@ -129,6 +129,13 @@ namespace AZ::RHI
         return this;
     }
 
+    RayTracingTlasDescriptor* RayTracingTlasDescriptor::BuildFlags(const RHI::RayTracingAccelerationStructureBuildFlags& buildFlags)
+    {
+        AZ_Assert(!m_buildContext, "BuildFlags property can only be added to the top level");
+        m_buildFlags = buildFlags;
+        return this;
+    }
+
     RHI::Ptr<RHI::RayTracingBlas> RayTracingBlas::CreateRHIRayTracingBlas()
     {
         RHI::Ptr<RHI::RayTracingBlas> rayTracingBlas = RHI::Factory::Get().CreateRayTracingBlas();
@@ -147,6 +154,13 @@ namespace AZ::RHI
         return resultCode;
     }
 
+    ResultCode RayTracingBlas::CreateCompactedBuffers(Device& device, uint64_t compactedSizeInBytes, const RayTracingBufferPools& rayTracingBufferPools)
+    {
+        AZ_Assert(IsInitialized(), "CreateCompactedBuffers requires the BLAS buffers to be created first");
+        AZ_Assert(compactedSizeInBytes > 0, "Invalid compacted BLAS size");
+        return CreateCompactedBuffersInternal(device, compactedSizeInBytes, rayTracingBufferPools);
+    }
+
     RHI::Ptr<RHI::RayTracingTlas> RayTracingTlas::CreateRHIRayTracingTlas()
     {
         RHI::Ptr<RHI::RayTracingTlas> rayTracingTlas = RHI::Factory::Get().CreateRayTracingTlas();
@@ -163,4 +177,13 @@ namespace AZ::RHI
         }
         return resultCode;
     }
+
+    ResultCode RayTracingTlas::UpdateBuffers(Device& device, const RayTracingTlasDescriptor* descriptor, const RayTracingBufferPools& rayTracingBufferPools)
+    {
+        if (!IsInitialized())
+        {
+            return ResultCode::InvalidOperation;
+        }
+        return UpdateBuffersInternal(device, descriptor, rayTracingBufferPools);
+    }
 }
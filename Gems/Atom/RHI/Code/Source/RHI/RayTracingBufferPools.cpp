@@ -49,6 +49,12 @@ namespace AZ::RHI
         return m_tlasBufferPool;
     }
 
+    const RHI::Ptr<RHI::BufferPool>& RayTracingBufferPools::GetCompactionSizeReadbackBufferPool() const
+    {
+        AZ_Assert(m_initialized, "RayTracingBufferPools was not initialized");
+        return m_compactionSizeReadbackBufferPool;
+    }
+
     void RayTracingBufferPools::Init(RHI::Ptr<RHI::Device>& device)
     {
         if (m_initialized)
@@ -116,6 +122,19 @@ namespace AZ::RHI
             AZ_Assert(resultCode == RHI::ResultCode::Success, "Failed to initialize ray tracing TLAS buffer pool");
         }
 
+        // create BLAS compaction size readback buffer pool
+        {
+            RHI::BufferPoolDescriptor bufferPoolDesc;
+            bufferPoolDesc.m_heapMemoryLevel = RHI::HeapMemoryLevel::Host;
+            bufferPoolDesc.m_hostMemoryAccess = RHI::HostMemoryAccess::Read;
+            bufferPoolDesc.m_bindFlags = GetCompactionSizeReadbackBufferBindFlags();
+
+            m_compactionSizeReadbackBufferPool = RHI::Factory::Get().CreateBufferPool();
+            m_compactionSizeReadbackBufferPool->SetName(Name("RayTracingCompactionSizeReadbackBufferPool"));
+            [[maybe_unused]] RHI::ResultCode resultCode = m_compactionSizeReadbackBufferPool->Init(*device, bufferPoolDesc);
+            AZ_Assert(resultCode == RHI::ResultCode::Success, "Failed to initialize ray tracing compaction size readback buffer pool");
+        }
+
         m_initialized = true;
     }
 }
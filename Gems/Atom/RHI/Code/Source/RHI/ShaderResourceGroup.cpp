@@ -57,6 +57,7 @@ namespace AZ::RHI
     {
         m_data = data;
         uint32_t sourceUpdateMask = data.GetUpdateMask();
+        AddCompiledDataUpdate(sourceUpdateMask, data.GetConstantDataUpdateInterval());
             
         //RHI has it's own copy of update mask that is reset after Compile is called m_updateMaskResetLatency times.
         m_rhiUpdateMask |= sourceUpdateMask;
@@ -99,6 +100,47 @@ namespace AZ::RHI
     void ShaderResourceGroup::EnableRhiResourceTypeCompilation(const ShaderResourceGroupData::ResourceTypeMask resourceTypeMask)
     {
         m_rhiUpdateMask = AZ::RHI::SetBits(m_rhiUpdateMask, static_cast<uint32_t>(resourceTypeMask));
+        AddCompiledDataUpdate(static_cast<uint32_t>(resourceTypeMask), Interval());
+    }
+
+    void ShaderResourceGroup::AddCompiledDataUpdate(uint32_t resourceTypeMask, Interval constantDataInterval)
+    {
+        if (resourceTypeMask == 0)
+        {
+            return;
+        }
+
+        // Constant data modified without a known interval is uploaded entirely.
+        const bool constantDataModified = RHI::CheckBitsAny(resourceTypeMask, static_cast<uint32_t>(ShaderResourceGroupData::ResourceTypeMask::ConstantDataMask));
+        if (constantDataModified && constantDataInterval.m_min == constantDataInterval.m_max)
+        {
+            constantDataInterval = Interval(0, aznumeric_cast<uint32_t>(m_data.GetConstantData().size()));
+        }
+
+        for (CompiledDataUpdate& update : m_pendingCompiledDataUpdates)
+        {
+            update.m_resourceTypeMask |= resourceTypeMask;
+            if (constantDataInterval.m_min == constantDataInterval.m_max)
+            {
+                continue;
+            }
+
+            if (update.m_constantDataInterval.m_min == update.m_constantDataInterval.m_max)
+            {
+                update.m_constantDataInterval = constantDataInterval;
+            }
+            else
+            {
+                update.m_constantDataInterval.m_min = AZStd::min(update.m_constantDataInterval.m_min, constantDataInterval.m_min);
+                update.m_constantDataInterval.m_max = AZStd::max(update.m_constantDataInterval.m_max, constantDataInterval.m_max);
+            }
+        }
+    }
+
+    ShaderResourceGroup::CompiledDataUpdate ShaderResourceGroup::AcquireCompiledDataUpdate(uint32_t compiledDataIndex)
+    {
+        AZ_Assert(compiledDataIndex < m_pendingCompiledDataUpdates.size(), "Compiled data index %u is out of range", compiledDataIndex);
+        return AZStd::exchange(m_pendingCompiledDataUpdates[compiledDataIndex], CompiledDataUpdate());
     }
 
     void ShaderResourceGroup::ResetResourceTypeIteration(const ShaderResourceGroupData::ResourceType resourceType)
@@ -249,20 +249,53 @@ namespace AZ::RHI
 
     bool ShaderResourceGroupData::SetConstantRaw(ShaderInputConstantIndex inputIndex, const void* bytes, uint32_t byteOffset, uint32_t byteCount)
     {
-        EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
-        return m_constantsData.SetConstantRaw(inputIndex, bytes, byteOffset, byteCount);
+        if (m_constantsData.SetConstantRaw(inputIndex, bytes, byteOffset, byteCount))
+        {
+            const Interval interval = GetLayout()->GetConstantsLayout()->GetInterval(inputIndex);
+            EnableConstantDataCompilation(interval.m_min + byteOffset, byteCount);
+            return true;
+        }
+        return false;
     }
 
     bool ShaderResourceGroupData::SetConstantData(const void* bytes, uint32_t byteCount)
     {
-        EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
-        return m_constantsData.SetConstantData(bytes, byteCount);
+        return SetConstantData(bytes, 0, byteCount);
     }
 
     bool ShaderResourceGroupData::SetConstantData(const void* bytes, uint32_t byteOffset, uint32_t byteCount)
+    {
+        if (m_constantsData.SetConstantData(bytes, byteOffset, byteCount))
+        {
+            EnableConstantDataCompilation(byteOffset, byteCount);
+            return true;
+        }
+        return false;
+    }
+
+    void ShaderResourceGroupData::EnableConstantDataCompilation(ShaderInputConstantIndex inputIndex)
+    {
+        const Interval interval = GetLayout()->GetConstantsLayout()->GetInterval(inputIndex);
+        EnableConstantDataCompilation(interval.m_min, interval.m_max - interval.m_min);
+    }
+
+    void ShaderResourceGroupData::EnableConstantDataCompilation(uint32_t byteOffset, uint32_t byteCount)
     {
         EnableResourceTypeCompilation(ResourceTypeMask::ConstantDataMask);
-        return m_constantsData.SetConstantData(bytes, byteOffset, byteCount);
+        if (byteCount == 0)
+        {
+            return;
+        }
+
+        if (m_constantDataUpdateInterval.m_min == m_constantDataUpdateInterval.m_max)
+        {
+            m_constantDataUpdateInterval = Interval(byteOffset, byteOffset + byteCount);
+        }
+        else
+        {
+            m_constantDataUpdateInterval.m_min = AZStd::min(m_constantDataUpdateInterval.m_min, byteOffset);
+            m_constantDataUpdateInterval.m_max = AZStd::max(m_constantDataUpdateInterval.m_max, byteOffset + byteCount);
+        }
     }
 
     const RHI::ConstPtr<RHI::ImageView>& ShaderResourceGroupData::GetImageView(RHI::ShaderInputImageIndex inputIndex, uint32_t arrayIndex) const
@@ -365,6 +398,11 @@ namespace AZ::RHI
         m_bufferViews.assign(m_bufferViews.size(), nullptr);
         m_imageViewsUnboundedArray.assign(m_imageViewsUnboundedArray.size(), nullptr);
         m_bufferViewsUnboundedArray.assign(m_bufferViewsUnboundedArray.size(), nullptr);
+
+        EnableResourceTypeCompilation(ResourceTypeMask::ImageViewMask);
+        EnableResourceTypeCompilation(ResourceTypeMask::BufferViewMask);
+        EnableResourceTypeCompilation(ResourceTypeMask::ImageViewUnboundedArrayMask);
+        EnableResourceTypeCompilation(ResourceTypeMask::BufferViewUnboundedArrayMask);
     }
 
     AZStd::span<const uint8_t> ShaderResourceGroupData::GetConstantData() const
@@ -387,9 +425,15 @@ namespace AZ::RHI
         m_updateMask = RHI::SetBits(m_updateMask, static_cast<uint32_t>(resourceTypeMask));
     }
 
+    Interval ShaderResourceGroupData::GetConstantDataUpdateInterval() const
+    {
+        return m_constantDataUpdateInterval;
+    }
+
     void ShaderResourceGroupData::ResetUpdateMask()
     {
         m_updateMask = 0;
+        m_constantDataUpdateInterval = Interval();
     }
     
     void ShaderResourceGroupData::SetBindlessViews(
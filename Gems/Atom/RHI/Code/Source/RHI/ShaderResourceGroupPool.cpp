@@ -71,6 +71,10 @@ namespace AZ::RHI
             // Pre-initialize the data so that we can build view diffs later.
             group.m_data = ShaderResourceGroupData(layout);
 
+            // Nothing was written to the compiled data yet.
+            group.m_pendingCompiledDataUpdates = {};
+            group.AddCompiledDataUpdate(AZ_BIT(static_cast<uint32_t>(ShaderResourceGroupData::ResourceType::Count)) - 1, Interval());
+
             // Cache off the binding slot for one less indirection.
             group.m_bindingSlot = layout->GetBindingSlot();
         }
@@ -110,9 +114,9 @@ namespace AZ::RHI
 
     void ShaderResourceGroupPool::QueueForCompile(ShaderResourceGroup& shaderResourceGroup, const ShaderResourceGroupData& groupData)
     {
-        AZStd::lock_guard<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
-
-        bool isQueuedForCompile = shaderResourceGroup.IsQueuedForCompile();
+        // A group is only compiled from one thread at a time, so only the queue shared by all the groups of the pool needs
+        // the lock. Building the diffs and copying the data outside of it lets many threads queue groups of the same pool.
+        const bool isQueuedForCompile = shaderResourceGroup.IsQueuedForCompile();
         AZ_Warning(
             "ShaderResourceGroupPool", !isQueuedForCompile,
             "Attempting to compile SRG '%s' that's already been queued for compile. Only compile an SRG once per frame.",
@@ -124,6 +128,7 @@ namespace AZ::RHI
 
             shaderResourceGroup.SetData(groupData);
 
+            AZStd::lock_guard<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
             QueueForCompileNoLock(shaderResourceGroup);
         }
     }
@@ -170,9 +175,9 @@ namespace AZ::RHI
             // case, the SRG will need to be re-compiled.
             //
             // To facilitate this, we compare the new data with the previous data and compare views. When views are attached
-            // and detached from SRG's, we store those associations in an SRG-pool local registry. The system currently takes a
-            // lock in order to build the diffs. This means compiling multiple SRG's on the same pool across several jobs is not
-            // going to be performant if the SRG's have buffers / images embedded.
+            // and detached from SRG's, we store those associations in an SRG-pool local registry. The system takes a lock in
+            // order to build the diffs, but only when views changed, so compiling SRG's which only update their constants
+            // (e.g. moving objects) across several jobs doesn't contend on it.
             //
             // FUTURE CONSIDERATIONS:
             //
@@ -198,29 +203,48 @@ namespace AZ::RHI
                 }
             };
 
+            const auto AreViewsModified = [](auto viewGroupOld, auto viewGroupNew)
+            {
+                AZ_Assert(viewGroupOld.size() == viewGroupNew.size(), "ShaderResourceGroupData layouts do not match.");
+                for (size_t i = 0; i < viewGroupOld.size(); ++i)
+                {
+                    if (viewGroupOld[i] != viewGroupNew[i])
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            };
+
+            AZStd::span<const ConstPtr<ImageView>> imageGroupOld = shaderResourceGroup.GetData().GetImageGroup();
+            AZStd::span<const ConstPtr<ImageView>> imageGroupNew = groupData.GetImageGroup();
+            AZStd::span<const ConstPtr<BufferView>> bufferGroupOld = shaderResourceGroup.GetData().GetBufferGroup();
+            AZStd::span<const ConstPtr<BufferView>> bufferGroupNew = groupData.GetBufferGroup();
+
+            const bool imageViewsModified = HasImageGroup() && AreViewsModified(imageGroupOld, imageGroupNew);
+            const bool bufferViewsModified = HasBufferGroup() && AreViewsModified(bufferGroupOld, bufferGroupNew);
+            if (!imageViewsModified && !bufferViewsModified)
+            {
+                return;
+            }
+
             AZStd::lock_guard<AZStd::mutex> registryLock(m_invalidateRegistryMutex);
 
             // Generate diffs for image views.
-            if (HasImageGroup())
+            if (imageViewsModified)
             {
-                AZStd::span<const ConstPtr<ImageView>> viewGroupOld = shaderResourceGroup.GetData().GetImageGroup();
-                AZStd::span<const ConstPtr<ImageView>> viewGroupNew = groupData.GetImageGroup();
-                AZ_Assert(viewGroupOld.size() == viewGroupNew.size(), "ShaderResourceGroupData layouts do not match.");
-                for (size_t i = 0; i < viewGroupOld.size(); ++i)
+                for (size_t i = 0; i < imageGroupOld.size(); ++i)
                 {
-                    ComputeDiffs(viewGroupOld[i].get(), viewGroupNew[i].get());
+                    ComputeDiffs(imageGroupOld[i].get(), imageGroupNew[i].get());
                 }
             }
 
             // Generate diffs for buffer views.
-            if (HasBufferGroup())
+            if (bufferViewsModified)
             {
-                AZStd::span<const ConstPtr<BufferView>> viewGroupOld = shaderResourceGroup.GetData().GetBufferGroup();
-                AZStd::span<const ConstPtr<BufferView>> viewGroupNew = groupData.GetBufferGroup();
-                AZ_Assert(viewGroupOld.size() == viewGroupNew.size(), "ShaderResourceGroupData layouts do not match.");
-                for (size_t i = 0; i < viewGroupOld.size(); ++i)
+                for (size_t i = 0; i < bufferGroupOld.size(); ++i)
                 {
-                    ComputeDiffs(viewGroupOld[i].get(), viewGroupNew[i].get());
+                    ComputeDiffs(bufferGroupOld[i].get(), bufferGroupNew[i].get());
                 }
             }
         }
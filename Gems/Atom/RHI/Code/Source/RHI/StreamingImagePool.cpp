@@ -33,6 +33,13 @@ namespace AZ::RHI
                 AZ_Error("StreamingImagePool", false, "Streaming images may only contain read-only bind flags.");
                 return false;
             }
+
+            if (initRequest.m_enableTileStreaming &&
+                (initRequest.m_descriptor.m_dimension != ImageDimension::Image2D || initRequest.m_descriptor.m_arraySize != 1))
+            {
+                AZ_Error("StreamingImagePool", false, "Tile streaming is only supported for 2D images with a single array slice.");
+                return false;
+            }
         }
 
         AZ_UNUSED(initRequest);
@@ -53,12 +60,51 @@ namespace AZ::RHI
                 AZ_Error("StreamingImagePool", false, "Attempted to expand image more than the number of mips available.");
                 return false;
             }
+
+            if (expandRequest.m_image->GetResidentMipLevel() - expandRequest.m_mipSlices.size() < expandRequest.m_image->GetTiledMipCount())
+            {
+                AZ_Error("StreamingImagePool", false, "Attempted to expand image into its tiled mips. Use UpdateImageTiles instead.");
+                return false;
+            }
         }
 
         AZ_UNUSED(expandRequest);
         return true;
     }
 
+    bool StreamingImagePool::ValidateTileRequest(const StreamingImageTileRequest& tileRequest) const
+    {
+        if (Validation::IsEnabled())
+        {
+            if (!ValidateIsRegistered(tileRequest.m_image))
+            {
+                return false;
+            }
+
+            const uint32_t tiledMipCount = tileRequest.m_image->GetTiledMipCount();
+            for (const StreamingImageTileData& tileData : tileRequest.m_residentTiles)
+            {
+                if (tileData.m_tile.m_mipLevel >= tiledMipCount || !tileData.m_mipData)
+                {
+                    AZ_Error("StreamingImagePool", false, "Attempted to make resident a tile of mip %u, which isn't tiled or has no data.", tileData.m_tile.m_mipLevel);
+                    return false;
+                }
+            }
+
+            for (const StreamingImageTile& tile : tileRequest.m_evictedTiles)
+            {
+                if (tile.m_mipLevel >= tiledMipCount)
+                {
+                    AZ_Error("StreamingImagePool", false, "Attempted to evict a tile of mip %u, which isn't tiled.", tile.m_mipLevel);
+                    return false;
+                }
+            }
+        }
+
+        AZ_UNUSED(tileRequest);
+        return true;
+    }
+
     ResultCode StreamingImagePool::Init(Device& device, const StreamingImagePoolDescriptor& descriptor)
     {
         AZ_PROFILE_FUNCTION(RHI);
@@ -104,6 +150,15 @@ namespace AZ::RHI
         {
             // If initialization succeeded, assign the new resident mip level.
             initRequest.m_image->m_residentMipLevel = static_cast<uint32_t>(initRequest.m_descriptor.m_mipLevels - initRequest.m_tailMipSlices.size());
+
+            initRequest.m_image->m_tiledMipCount = 0;
+            StreamingImageTileLayout tileLayout;
+            if (initRequest.m_enableTileStreaming && GetImageTileLayoutInternal(*initRequest.m_image, tileLayout) == ResultCode::Success)
+            {
+                AZ_Assert(tileLayout.m_tiledMipCount == 0 || tileLayout.m_tiledMipCount == initRequest.m_image->m_residentMipLevel,
+                    "Either all the mips more detailed than the tail mip slices are tiled, or none.");
+                initRequest.m_image->m_tiledMipCount = tileLayout.m_tiledMipCount;
+            }
         }
 
         AZ_Warning("StreamingImagePool", resultCode == ResultCode::Success, "Failed to initialize image.");
@@ -158,6 +213,52 @@ namespace AZ::RHI
         return RHI::ResultCode::Success;
     }
 
+    ResultCode StreamingImagePool::GetImageTileLayout(const Image& image, StreamingImageTileLayout& tileLayout) const
+    {
+        tileLayout = {};
+
+        if (!ValidateIsInitialized())
+        {
+            return ResultCode::InvalidOperation;
+        }
+
+        if (!ValidateIsRegistered(&image))
+        {
+            return ResultCode::InvalidArgument;
+        }
+
+        if (image.GetTiledMipCount() == 0)
+        {
+            return ResultCode::Success;
+        }
+
+        return GetImageTileLayoutInternal(image, tileLayout);
+    }
+
+    ResultCode StreamingImagePool::UpdateImageTiles(const StreamingImageTileRequest& request)
+    {
+        if (!ValidateIsInitialized())
+        {
+            return ResultCode::InvalidOperation;
+        }
+
+        if (!ValidateTileRequest(request))
+        {
+            return ResultCode::InvalidArgument;
+        }
+
+        if (request.m_residentTiles.empty() && request.m_evictedTiles.empty())
+        {
+            if (request.m_completeCallback)
+            {
+                request.m_completeCallback();
+            }
+            return ResultCode::Success;
+        }
+
+        return UpdateImageTilesInternal(request);
+    }
+
     const StreamingImagePoolDescriptor& StreamingImagePool::GetDescriptor() const
     {
         return m_descriptor;
@@ -203,6 +304,16 @@ namespace AZ::RHI
         return ResultCode::Unimplemented;
     }
         
+    ResultCode StreamingImagePool::GetImageTileLayoutInternal(const Image&, StreamingImageTileLayout&) const
+    {
+        return ResultCode::Unimplemented;
+    }
+
+    ResultCode StreamingImagePool::UpdateImageTilesInternal(const StreamingImageTileRequest&)
+    {
+        return ResultCode::Unimplemented;
+    }
+
     ResultCode StreamingImagePool::SetMemoryBudgetInternal([[maybe_unused]] size_t newBudget)
     {
         return ResultCode::Unimplemented;
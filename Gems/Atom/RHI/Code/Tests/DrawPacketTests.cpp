@@ -426,6 +426,51 @@ namespace UnitTest
             delete drawPacket;
         }
 
+        void DrawListSortLargeList()
+        {
+            AZ::SimpleLcgRandom random(s_randomSeed);
+
+            // Enough items to take the radix sort path, with few enough distinct keys and depths to produce ties
+            RHI::DrawList drawList;
+            for (size_t i = 0; i < 1000; ++i)
+            {
+                RHI::DrawItemProperties drawItemProperties;
+                drawItemProperties.m_sortKey = static_cast<RHI::DrawItemSortKey>(random.GetRandom() % 16) - 8;
+                drawItemProperties.m_depth = static_cast<float>(random.GetRandom() % 64) - 32.0f;
+                drawList.push_back(drawItemProperties);
+            }
+
+            auto keyThenDepth = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+            {
+                return a.m_sortKey != b.m_sortKey ? a.m_sortKey < b.m_sortKey : a.m_depth < b.m_depth;
+            };
+            auto keyThenReverseDepth = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+            {
+                return a.m_sortKey != b.m_sortKey ? a.m_sortKey < b.m_sortKey : a.m_depth > b.m_depth;
+            };
+            auto depthThenKey = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+            {
+                return a.m_depth != b.m_depth ? a.m_depth < b.m_depth : a.m_sortKey < b.m_sortKey;
+            };
+            auto reverseDepthThenKey = [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+            {
+                return a.m_depth != b.m_depth ? a.m_depth > b.m_depth : a.m_sortKey < b.m_sortKey;
+            };
+
+            auto validateSort = [&drawList](RHI::DrawListSortType sortType, const auto& compare)
+            {
+                RHI::DrawList sortedList = drawList;
+                RHI::SortDrawList(sortedList, sortType);
+                ASSERT_EQ(sortedList.size(), drawList.size());
+                EXPECT_TRUE(AZStd::is_sorted(sortedList.begin(), sortedList.end(), compare));
+            };
+
+            validateSort(RHI::DrawListSortType::KeyThenDepth, keyThenDepth);
+            validateSort(RHI::DrawListSortType::KeyThenReverseDepth, keyThenReverseDepth);
+            validateSort(RHI::DrawListSortType::DepthThenKey, depthThenKey);
+            validateSort(RHI::DrawListSortType::ReverseDepthThenKey, reverseDepthThenKey);
+        }
+
         void DrawPacketClone()
         {
             AZ::SimpleLcgRandom random(s_randomSeed);
@@ -698,6 +743,11 @@ namespace UnitTest
         DrawListContextNullFilter();
     }
 
+    TEST_F(DrawPacketTest, DrawListSortLargeList)
+    {
+        DrawListSortLargeList();
+    }
+
     TEST_F(DrawPacketTest, DrawPacketClone)
     {
         DrawPacketClone();
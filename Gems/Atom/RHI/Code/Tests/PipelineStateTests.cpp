@@ -15,6 +15,8 @@
 
 #include <Atom/RHI.Reflect/PipelineLayoutDescriptor.h>
 
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Math/Random.h>
 
 namespace UnitTest
@@ -364,4 +366,59 @@ namespace UnitTest
             }
         }
     }
+
+    TEST_F(PipelineStateTests, PipelineStateCache_AcquireWhileAsyncCompilePending_ReturnsCompiledPipelineState)
+    {
+        static const size_t PipelineStateCountMax = 64;
+
+        // Compile jobs need a job manager.
+        JobManagerDesc jobManagerDesc;
+        jobManagerDesc.m_workerThreads.resize(2);
+        JobManager jobManager(jobManagerDesc);
+        JobContext jobContext(jobManager);
+        JobContext::SetGlobalContext(&jobContext);
+
+        {
+            RHI::Ptr<RHI::Device> device = MakeTestDevice();
+            RHI::Ptr<RHI::PipelineStateCache> pipelineStateCache = RHI::PipelineStateCache::Create(*device);
+            RHI::PipelineLibraryHandle libraryHandle = pipelineStateCache->CreateLibrary(nullptr);
+
+            // The first half is acquired from the pending cache, the second half from the read-only cache after a Compact.
+            AZStd::vector<RHI::PipelineStateDescriptorForDraw> descriptors;
+            AZStd::vector<RHI::ConstPtr<RHI::PipelineState>> compilingPipelineStates;
+            for (size_t i = 0; i < PipelineStateCountMax; ++i)
+            {
+                descriptors.push_back(CreatePipelineStateDescriptor(static_cast<uint32_t>(i)));
+
+                RHI::ConstPtr<RHI::PipelineState> compilingPipelineState;
+                EXPECT_EQ(pipelineStateCache->AcquirePipelineStateAsync(libraryHandle, descriptors[i], nullptr, &compilingPipelineState), nullptr);
+                EXPECT_NE(compilingPipelineState, nullptr);
+                compilingPipelineStates.push_back(compilingPipelineState);
+            }
+
+            for (size_t i = 0; i < PipelineStateCountMax; ++i)
+            {
+                if (i == PipelineStateCountMax / 2)
+                {
+                    pipelineStateCache->Compact();
+                }
+
+                // Synchronous acquires must never return a pipeline state whose compile is still pending.
+                const RHI::PipelineState* pipelineState = pipelineStateCache->AcquirePipelineState(libraryHandle, descriptors[i]);
+                EXPECT_EQ(pipelineState, compilingPipelineStates[i].get());
+                EXPECT_TRUE(pipelineState->IsInitialized());
+                EXPECT_FALSE(pipelineStateCache->IsPipelineStateCompiling(pipelineState));
+
+                // Once compiled, the asynchronous acquire returns the pipeline state itself.
+                EXPECT_EQ(pipelineStateCache->AcquirePipelineStateAsync(libraryHandle, descriptors[i], nullptr), pipelineState);
+            }
+
+            pipelineStateCache->Compact();
+            ValidateCacheIntegrity(pipelineStateCache);
+
+            pipelineStateCache->ReleaseLibrary(libraryHandle);
+        }
+
+        JobContext::SetGlobalContext(nullptr);
+    }
 }
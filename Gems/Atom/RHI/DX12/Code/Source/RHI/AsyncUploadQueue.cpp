@@ -484,6 +484,127 @@ namespace AZ
             return fenceValue;
         }
 
+        uint64_t AsyncUploadQueue::QueueUpload(const RHI::StreamingImageTileRequest& request, const RHI::Size& tileSize)
+        {
+            AZ_PROFILE_SCOPE(RHI, "AsyncUploadQueue: QueueUpload");
+            uint64_t fenceValue = m_uploadFence.Increment();
+
+            Image* image = static_cast<Image*>(request.m_image);
+            image->SetUploadFenceValue(fenceValue);
+
+            Memory* imageMemory = image->GetMemoryView().GetMemory();
+
+            // The tile list may not outlive this call, only the mip data does.
+            AZStd::vector<RHI::StreamingImageTileData> tiles(request.m_residentTiles.begin(), request.m_residentTiles.end());
+            RHI::CompleteCallback completeCallback = request.m_completeCallback;
+            const bool waitForUpload = request.m_waitForUpload;
+
+            m_copyQueue->QueueCommand([=](void* commandQueue)
+            {
+                AZ_PROFILE_SCOPE(RHI, "Upload Image Tiles");
+                ID3D12CommandQueue* dx12CommandQueue = static_cast<ID3D12CommandQueue*>(commandQueue);
+                FramePacket* framePacket = BeginFramePacket();
+
+                const RHI::ImageDescriptor& imageDescriptor = image->GetDescriptor();
+                const DXGI_FORMAT imageFormat = GetBaseFormat(ConvertFormat(imageDescriptor.m_format));
+
+                for (const RHI::StreamingImageTileData& tileData : tiles)
+                {
+                    const RHI::ImageSubresourceLayout& mipLayout = tileData.m_mipLayout;
+                    const uint32_t blockWidth = mipLayout.m_blockElementWidth;
+                    const uint32_t blockHeight = mipLayout.m_blockElementHeight;
+                    const uint32_t bytesPerBlock = mipLayout.m_bytesPerRow / AZ::DivideAndRoundUp(mipLayout.m_size.m_width, blockWidth);
+
+                    // The region of the tile, clamped to the mip size on the edges.
+                    const uint32_t left = tileData.m_tile.m_x * tileSize.m_width;
+                    const uint32_t top = tileData.m_tile.m_y * tileSize.m_height;
+                    const uint32_t width = AZStd::min(tileSize.m_width, mipLayout.m_size.m_width - left);
+                    const uint32_t height = AZStd::min(tileSize.m_height, mipLayout.m_size.m_height - top);
+
+                    const uint32_t firstRow = top / blockHeight;
+                    const uint32_t rowCount = AZ::DivideAndRoundUp(height, blockHeight);
+                    const uint32_t rowOffset = (left / blockWidth) * bytesPerBlock;
+                    const uint32_t bytesPerRow = AZ::DivideAndRoundUp(width, blockWidth) * bytesPerBlock;
+                    const uint32_t stagingRowPitch = RHI::AlignUp(bytesPerRow, DX12_TEXTURE_DATA_PITCH_ALIGNMENT);
+                    const uint32_t stagingSize = RHI::AlignUp(rowCount * stagingRowPitch, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+
+                    if (stagingSize > m_descriptor.m_stagingSizeInBytes)
+                    {
+                        AZ_Warning("RHI::DX12", false, "AsyncUploadQueue staging buffer (%dK) is not big enough"
+                            "for the size of one image tile (%dK). Please increase staging buffer size.",
+                            m_descriptor.m_stagingSizeInBytes / 1024.0f, stagingSize / 1024.f);
+                        continue;
+                    }
+
+                    // If the current framePacket is not big enough, switch to next one.
+                    if (stagingSize > m_descriptor.m_stagingSizeInBytes - framePacket->m_dataOffset)
+                    {
+                        EndFramePacket(dx12CommandQueue);
+                        framePacket = BeginFramePacket();
+                    }
+
+                    // Copy the tile rows to staging memory.
+                    {
+                        AZ_PROFILE_SCOPE(RHI, "Copy CPU image tile");
+                        uint8_t* stagingDataStart = framePacket->m_stagingResourceData + framePacket->m_dataOffset;
+                        const uint8_t* tileDataStart = static_cast<const uint8_t*>(tileData.m_mipData) + firstRow * mipLayout.m_bytesPerRow + rowOffset;
+                        for (uint32_t row = 0; row < rowCount; row++)
+                        {
+                            memcpy(stagingDataStart + row * stagingRowPitch, tileDataStart + row * mipLayout.m_bytesPerRow, bytesPerRow);
+                        }
+                    }
+
+                    // Source location
+                    D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprint;
+                    footprint.Footprint.Width = width;
+                    footprint.Footprint.Height = height;
+                    footprint.Footprint.Depth = 1;
+                    footprint.Footprint.Format = imageFormat;
+                    footprint.Footprint.RowPitch = stagingRowPitch;
+                    footprint.Offset = framePacket->m_dataOffset;
+                    CD3DX12_TEXTURE_COPY_LOCATION sourceLocation(framePacket->m_stagingResource.get(), footprint);
+
+                    // Dest location. Tile streamed images have a single array slice.
+                    const uint32_t subresourceIdx = D3D12CalcSubresource(tileData.m_tile.m_mipLevel, 0, 0, imageDescriptor.m_mipLevels, 1);
+                    CD3DX12_TEXTURE_COPY_LOCATION destLocation(imageMemory, subresourceIdx);
+
+                    framePacket->m_commandList->CopyTextureRegion(
+                        &destLocation,
+                        left, top, 0,
+                        &sourceLocation,
+                        nullptr);
+
+                    framePacket->m_dataOffset += stagingSize;
+                }
+
+                EndFramePacket(dx12CommandQueue);
+
+                dx12CommandQueue->Signal(m_uploadFence.Get(), fenceValue);
+
+                if (completeCallback && !waitForUpload)
+                {
+                    {
+                        AZStd::lock_guard<AZStd::mutex> lock(m_callbackMutex);
+                        AZ_Assert(m_callbacks.empty() || m_callbacks.back().second < fenceValue, "Callbacks should be added with increasing order of fenceValue");
+                        m_callbacks.push({ completeCallback, fenceValue });
+                    }
+                    AZ::SystemTickBus::QueueFunction([this] { ProcessCallbacks(uint64_t(-1)); });
+                }
+
+                return 0;
+            });
+
+            if (waitForUpload)
+            {
+                m_uploadFence.Wait(m_uploadFenceEvent, fenceValue);
+                if (completeCallback)
+                {
+                    completeCallback();
+                }
+            }
+            return fenceValue;
+        }
+
         bool AsyncUploadQueue::IsUploadFinished(uint64_t fenceValue)
         {
             return m_uploadFence.GetCompletedValue() >= fenceValue;
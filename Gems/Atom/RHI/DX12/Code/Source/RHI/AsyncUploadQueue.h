@@ -52,6 +52,12 @@ namespace AZ
             // @param residentMip is the resident mip level the expand request starts from. 
             // @return queue id which can be use to check whether upload finished or wait for upload finish
             uint64_t QueueUpload(const RHI::StreamingImageExpandRequest& request, uint32_t residentMip);
+
+            // Queue copy commands to upload the regions of the resident tiles of a tile streamed image.
+            // The tiles must already be mapped to heap memory.
+            // @param tileSize is the size of a tile in texels.
+            // @return queue id which can be use to check whether upload finished or wait for upload finish
+            uint64_t QueueUpload(const RHI::StreamingImageTileRequest& request, const RHI::Size& tileSize);
             
             // Queue tile mapping to map tiles from allocate heap for reserved resource. This is usually required before upload data to 
             // reserved resource in this copy queue
@@ -675,7 +675,19 @@ namespace AZ
             blasDesc.ScratchAccelerationStructureData = static_cast<Buffer*>(blasBuffers.m_scratchBuffer.get())->GetMemoryView().GetGpuAddress();
             blasDesc.DestAccelerationStructureData = static_cast<Buffer*>(blasBuffers.m_blasBuffer.get())->GetMemoryView().GetGpuAddress();
             ID3D12GraphicsCommandList4* commandList = static_cast<ID3D12GraphicsCommandList4*>(GetCommandList());
-            commandList->BuildRaytracingAccelerationStructure(&blasDesc, 0, nullptr);
+
+            // emit the compacted size of the BLAS if compaction is enabled
+            if (blasBuffers.m_compactionSizeBuffer)
+            {
+                D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_DESC postbuildInfoDesc = {};
+                postbuildInfoDesc.InfoType = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE;
+                postbuildInfoDesc.DestBuffer = static_cast<Buffer*>(blasBuffers.m_compactionSizeBuffer.get())->GetMemoryView().GetGpuAddress();
+                commandList->BuildRaytracingAccelerationStructure(&blasDesc, 1, &postbuildInfoDesc);
+            }
+            else
+            {
+                commandList->BuildRaytracingAccelerationStructure(&blasDesc, 0, nullptr);
+            }
 
             // create an immediate barrier for BLAS completion
             // this is required since the buffer must be built prior to using it in the TLAS
@@ -684,6 +696,33 @@ namespace AZ
             barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
             barrier.UAV.pResource = static_cast<Buffer*>(blasBuffers.m_blasBuffer.get())->GetMemoryView().GetMemory();
             commandList->ResourceBarrier(1, &barrier);        
+
+            if (blasBuffers.m_compactionSizeBuffer)
+            {
+                // copy the compacted size to the readback buffer, it is read on the CPU once the frame has completed
+                const MemoryView& compactionSizeMemoryView = static_cast<Buffer*>(blasBuffers.m_compactionSizeBuffer.get())->GetMemoryView();
+                const MemoryView& readbackMemoryView = static_cast<Buffer*>(blasBuffers.m_compactionSizeReadbackBuffer.get())->GetMemoryView();
+
+                D3D12_RESOURCE_BARRIER transitionBarrier;
+                transitionBarrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+                transitionBarrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+                transitionBarrier.Transition.pResource = compactionSizeMemoryView.GetMemory();
+                transitionBarrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+                transitionBarrier.Transition.StateBefore = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+                transitionBarrier.Transition.StateAfter = D3D12_RESOURCE_STATE_COPY_SOURCE;
+                commandList->ResourceBarrier(1, &transitionBarrier);
+
+                commandList->CopyBufferRegion(
+                    readbackMemoryView.GetMemory(),
+                    readbackMemoryView.GetOffset(),
+                    compactionSizeMemoryView.GetMemory(),
+                    compactionSizeMemoryView.GetOffset(),
+                    sizeof(D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE_DESC));
+
+                // the scratch memory may be shared with other BLAS builds, return it to the unordered access state
+                AZStd::swap(transitionBarrier.Transition.StateBefore, transitionBarrier.Transition.StateAfter);
+                commandList->ResourceBarrier(1, &transitionBarrier);
+            }
 #endif
         }
 
@@ -742,6 +781,49 @@ namespace AZ
 #endif
         }
 
+        void CommandList::UpdateTopLevelAccelerationStructure([[maybe_unused]] const RHI::RayTracingTlas& rayTracingTlas)
+        {
+#ifdef AZ_DX12_DXR_SUPPORT
+            const RayTracingTlas& dx12RayTracingTlas = static_cast<const RayTracingTlas&>(rayTracingTlas);
+            const RayTracingTlas::TlasBuffers& tlasBuffers = dx12RayTracingTlas.GetBuffers();
+            const RayTracingTlas::TlasBuffers& sourceTlasBuffers = dx12RayTracingTlas.GetUpdateSourceBuffers();
+
+            // refit the TLAS from the previous TLAS
+            D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC tlasDesc = {};
+            tlasDesc.Inputs = dx12RayTracingTlas.GetInputs();
+            tlasDesc.Inputs.Flags |= D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PERFORM_UPDATE;
+            tlasDesc.ScratchAccelerationStructureData = static_cast<Buffer*>(tlasBuffers.m_scratchBuffer.get())->GetMemoryView().GetGpuAddress();
+            tlasDesc.SourceAccelerationStructureData = static_cast<Buffer*>(sourceTlasBuffers.m_tlasBuffer.get())->GetMemoryView().GetGpuAddress();
+            tlasDesc.DestAccelerationStructureData = static_cast<Buffer*>(tlasBuffers.m_tlasBuffer.get())->GetMemoryView().GetGpuAddress();
+
+            ID3D12GraphicsCommandList4* commandList = static_cast<ID3D12GraphicsCommandList4*>(GetCommandList());
+            commandList->BuildRaytracingAccelerationStructure(&tlasDesc, 0, nullptr);
+#endif
+        }
+
+        void CommandList::CompactBottomLevelAccelerationStructure([[maybe_unused]] const RHI::RayTracingBlas& rayTracingBlas)
+        {
+#ifdef AZ_DX12_DXR_SUPPORT
+            const RayTracingBlas& dx12RayTracingBlas = static_cast<const RayTracingBlas&>(rayTracingBlas);
+            const RayTracingBlas::BlasBuffers& blasBuffers = dx12RayTracingBlas.GetBuffers();
+            const RayTracingBlas::BlasBuffers& sourceBlasBuffers = dx12RayTracingBlas.GetCompactionSourceBuffers();
+
+            // copy the BLAS into the compacted buffer
+            ID3D12GraphicsCommandList4* commandList = static_cast<ID3D12GraphicsCommandList4*>(GetCommandList());
+            commandList->CopyRaytracingAccelerationStructure(
+                static_cast<Buffer*>(blasBuffers.m_blasBuffer.get())->GetMemoryView().GetGpuAddress(),
+                static_cast<Buffer*>(sourceBlasBuffers.m_blasBuffer.get())->GetMemoryView().GetGpuAddress(),
+                D3D12_RAYTRACING_ACCELERATION_STRUCTURE_COPY_MODE_COMPACT);
+
+            // create an immediate barrier for the compaction copy, the BLAS is used by the TLAS build
+            D3D12_RESOURCE_BARRIER barrier;
+            barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
+            barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+            barrier.UAV.pResource = static_cast<Buffer*>(blasBuffers.m_blasBuffer.get())->GetMemoryView().GetMemory();
+            commandList->ResourceBarrier(1, &barrier);
+#endif
+        }
+
         void CommandList::SetStencilRef(uint8_t stencilRef)
         {
             if (m_state.m_stencilRef != stencilRef)
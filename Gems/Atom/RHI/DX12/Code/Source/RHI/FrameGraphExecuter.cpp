@@ -97,9 +97,10 @@ namespace AZ
 
                 // Computes a cost heuristic based on the number of items and number of attachments in
                 // the scope. This cost is used to partition command list generation.
-                const uint32_t totalScopeCost =
+                const uint32_t totalScopeCost = GetScopeCost(
+                    scope.GetId(),
                     estimatedItemCount * m_frameGraphExecuterData.m_itemCost +
-                    static_cast<uint32_t>(scope.GetAttachments().size()) * m_frameGraphExecuterData.m_attachmentCost;
+                        static_cast<uint32_t>(scope.GetAttachments().size()) * m_frameGraphExecuterData.m_attachmentCost);
 
                 const uint32_t swapchainCount = static_cast<uint32_t>(scope.GetSwapChainsToPresent().size());
 
@@ -34,6 +34,11 @@ namespace AZ
             return m_tileLayout.m_tileCount > 0;
         }
 
+        bool Image::IsTileStreamed() const
+        {
+            return m_tileStreamedMipCount > 0;
+        }
+
         void Image::SetNameInternal(const AZStd::string_view& name)
         {
             m_memoryView.SetName(name);
@@ -63,6 +68,11 @@ namespace AZ
                     }
                 }
 
+                for (const auto& streamedTile : m_streamedTiles)
+                {
+                    tileCount += streamedTile.second.m_totalTileCount;
+                }
+
                 m_residentSizeInBytes = tileCount * sizePerTile;
             }
             else
@@ -204,6 +214,12 @@ namespace AZ
 
         void Image::FinalizeAsyncUpload(uint32_t newStreamedMipLevels)
         {
+            // The tile streamed mips are always visible to the image views
+            if (IsTileStreamed())
+            {
+                return;
+            }
+
             AZ_Assert(newStreamedMipLevels <= m_streamedMipLevel, "Expanded mip levels can't be more than streamed mip level");
 
             if (newStreamedMipLevels < m_streamedMipLevel)
@@ -338,6 +354,13 @@ namespace AZ
             return tileOffset != D3D12_PACKED_TILE ? tileOffset : m_tileCountStandard;
         }
 
+        uint32_t ImageTileLayout::GetTileIndex(uint32_t subresourceIndex, uint32_t tileX, uint32_t tileY) const
+        {
+            AZ_Assert(!IsPacked(subresourceIndex), "Tiles of packed subresources can't be indexed individually.");
+            const D3D12_SUBRESOURCE_TILING& tiling = m_subresourceTiling[subresourceIndex];
+            return tiling.StartTileIndexInOverallResource + tileY * tiling.WidthInTiles + tileX;
+        }
+
         void ImageTileLayout::GetSubresourceTileInfo(uint32_t subresourceIndex, uint32_t& imageTileOffset, D3D12_TILED_RESOURCE_COORDINATE& coordinate, D3D12_TILE_REGION_SIZE& regionSize) const
         {
             if (IsPacked(subresourceIndex))
@@ -38,6 +38,9 @@ namespace AZ
             // Returns the tile offset relative to the image.
             uint32_t GetTileOffset(uint32_t subresourceIndex) const;
 
+            // Returns the index, relative to the image, of a tile of a standard subresource.
+            uint32_t GetTileIndex(uint32_t subresourceIndex, uint32_t tileX, uint32_t tileY) const;
+
             /**
              * Given a subresource index, returns the tile offset of the subresource from the total
              * image tile set. The coordinate and region size are used to describe how the tiles map
@@ -84,6 +87,9 @@ namespace AZ
 
             // Returns whether the image is using a tiled resource.
             bool IsTiled() const;
+
+            // Returns whether the most detailed mips of the image are streamed per tile.
+            bool IsTileStreamed() const;
             
             void SetUploadFenceValue(uint64_t fenceValue);
             uint64_t GetUploadFenceValue() const;
@@ -170,6 +176,12 @@ namespace AZ
             // Note: the tiles allocated for each subresource may come from multiple heap pages 
             AZStd::unordered_map<uint32_t, AZStd::vector<HeapTiles>> m_heapTiles;
 
+            // The number of most detailed mips which are streamed per tile.
+            uint32_t m_tileStreamedMipCount = 0;
+
+            // The heap tile allocated for each resident tile of the tile streamed mips, by tile index (see ImageTileLayout::GetTileIndex).
+            AZStd::unordered_map<uint32_t, HeapTiles> m_streamedTiles;
+
             // Tracking the actual mip level data uploaded. It's also used for invalidate image view. 
             uint32_t m_streamedMipLevel = 0;
 
@@ -100,10 +100,109 @@ namespace AZ
 
             MemoryView& blasMemoryView = static_cast<Buffer*>(buffers.m_blasBuffer.get())->GetMemoryView();
             blasMemoryView.SetName(L"BLAS");
+
+            buffers.m_compactionSizeBuffer = nullptr;
+            buffers.m_compactionSizeReadbackBuffer = nullptr;
+            if (m_inputs.Flags & D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_COMPACTION)
+            {
+                // create the buffer receiving the compacted size as post-build info, this must be a UAV
+                buffers.m_compactionSizeBuffer = RHI::Factory::Get().CreateBuffer();
+                AZ::RHI::BufferDescriptor compactionSizeBufferDescriptor;
+                compactionSizeBufferDescriptor.m_bindFlags = RHI::BufferBindFlags::ShaderReadWrite | RHI::BufferBindFlags::RayTracingScratchBuffer;
+                compactionSizeBufferDescriptor.m_byteCount = sizeof(D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE_DESC);
+
+                AZ::RHI::BufferInitRequest compactionSizeBufferRequest;
+                compactionSizeBufferRequest.m_buffer = buffers.m_compactionSizeBuffer.get();
+                compactionSizeBufferRequest.m_descriptor = compactionSizeBufferDescriptor;
+                resultCode = bufferPools.GetScratchBufferPool()->InitBuffer(compactionSizeBufferRequest);
+                AZ_Assert(resultCode == RHI::ResultCode::Success, "failed to create BLAS compaction size buffer");
+
+                // create the readback buffer for the compacted size, cleared so a size of 0 is read until the GPU copy completed
+                buffers.m_compactionSizeReadbackBuffer = RHI::Factory::Get().CreateBuffer();
+                AZ::RHI::BufferDescriptor readbackBufferDescriptor;
+                readbackBufferDescriptor.m_bindFlags = RHI::BufferBindFlags::CopyWrite;
+                readbackBufferDescriptor.m_byteCount = compactionSizeBufferDescriptor.m_byteCount;
+
+                AZ::RHI::BufferInitRequest readbackBufferRequest;
+                readbackBufferRequest.m_buffer = buffers.m_compactionSizeReadbackBuffer.get();
+                readbackBufferRequest.m_descriptor = readbackBufferDescriptor;
+                resultCode = bufferPools.GetCompactionSizeReadbackBufferPool()->InitBuffer(readbackBufferRequest);
+                AZ_Assert(resultCode == RHI::ResultCode::Success, "failed to create BLAS compaction size readback buffer");
+
+                MemoryView& readbackMemoryView = static_cast<Buffer*>(buffers.m_compactionSizeReadbackBuffer.get())->GetMemoryView();
+                CpuVirtualAddress readbackData = readbackMemoryView.Map(RHI::HostMemoryAccess::Write);
+                memset(readbackData, 0, readbackBufferDescriptor.m_byteCount);
+                readbackMemoryView.Unmap(RHI::HostMemoryAccess::Write);
+            }
+#endif
+            return RHI::ResultCode::Success;
+        }
+
+        RHI::ResultCode RayTracingBlas::CreateCompactedBuffersInternal([[maybe_unused]] RHI::Device& deviceBase, [[maybe_unused]] uint64_t compactedSizeInBytes, [[maybe_unused]] const RHI::RayTracingBufferPools& bufferPools)
+        {
+#ifdef AZ_DX12_DXR_SUPPORT
+            // advance to the next buffer, the current buffers are the source of the compaction copy
+            m_compactionSourceBufferIndex = m_currentBufferIndex;
+            m_currentBufferIndex = (m_currentBufferIndex + 1) % BufferCount;
+            const BlasBuffers& sourceBuffers = m_buffers[m_compactionSourceBufferIndex];
+            BlasBuffers& buffers = m_buffers[m_currentBufferIndex];
+
+            // the compacted BLAS has no post-build info, the scratch buffer is kept for rebuilds
+            buffers.m_scratchBuffer = sourceBuffers.m_scratchBuffer;
+            buffers.m_compactionSizeBuffer = nullptr;
+            buffers.m_compactionSizeReadbackBuffer = nullptr;
+            m_inputs.Flags &= ~D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_COMPACTION;
+
+            // create compacted BLAS buffer
+            buffers.m_blasBuffer = RHI::Factory::Get().CreateBuffer();
+            AZ::RHI::BufferDescriptor blasBufferDescriptor;
+            blasBufferDescriptor.m_bindFlags = RHI::BufferBindFlags::ShaderReadWrite | RHI::BufferBindFlags::RayTracingAccelerationStructure;
+            blasBufferDescriptor.m_byteCount = RHI::AlignUp(compactedSizeInBytes, D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT);
+
+            AZ::RHI::BufferInitRequest blasBufferRequest;
+            blasBufferRequest.m_buffer = buffers.m_blasBuffer.get();
+            blasBufferRequest.m_descriptor = blasBufferDescriptor;
+            RHI::ResultCode resultCode = bufferPools.GetBlasBufferPool()->InitBuffer(blasBufferRequest);
+            if (resultCode != RHI::ResultCode::Success)
+            {
+                AZ_Error("RayTracingBlas", false, "failed to create compacted BLAS buffer");
+                m_currentBufferIndex = m_compactionSourceBufferIndex;
+                return resultCode;
+            }
+
+            MemoryView& blasMemoryView = static_cast<Buffer*>(buffers.m_blasBuffer.get())->GetMemoryView();
+            blasMemoryView.SetName(L"BLAS Compacted");
 #endif
             return RHI::ResultCode::Success;
         }
 
+        uint64_t RayTracingBlas::GetCompactedSizeInBytes() const
+        {
+#ifdef AZ_DX12_DXR_SUPPORT
+            const BlasBuffers& buffers = m_buffers[m_currentBufferIndex];
+            if (!buffers.m_compactionSizeReadbackBuffer)
+            {
+                return 0;
+            }
+
+            // the readback buffer contains 0 until the BLAS build and the copy of its post-build info have completed on the GPU
+            const MemoryView& readbackMemoryView = static_cast<const Buffer*>(buffers.m_compactionSizeReadbackBuffer.get())->GetMemoryView();
+            D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_COMPACTED_SIZE_DESC compactedSizeDesc = {};
+            CpuVirtualAddress readbackData = readbackMemoryView.Map(RHI::HostMemoryAccess::Read);
+            memcpy(&compactedSizeDesc, readbackData, sizeof(compactedSizeDesc));
+            readbackMemoryView.Unmap(RHI::HostMemoryAccess::Read);
+            return compactedSizeDesc.CompactedSizeInBytes;
+#else
+            return 0;
+#endif
+        }
+
+        uint64_t RayTracingBlas::GetSizeInBytes() const
+        {
+            const BlasBuffers& buffers = m_buffers[m_currentBufferIndex];
+            return buffers.m_blasBuffer ? buffers.m_blasBuffer->GetDescriptor().m_byteCount : 0;
+        }
+
 #ifdef AZ_DX12_DXR_SUPPORT
         D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS RayTracingBlas::GetAccelerationStructureBuildFlags(const RHI::RayTracingAccelerationStructureBuildFlags &buildFlags)
         {
@@ -123,6 +222,11 @@ namespace AZ
                 dxBuildFlags |= D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_UPDATE;
             }
 
+            if (RHI::CheckBitsAny(buildFlags, RHI::RayTracingAccelerationStructureBuildFlags::ENABLE_COMPACTION))
+            {
+                dxBuildFlags |= D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_COMPACTION;
+            }
+
             return dxBuildFlags;
         }
 #endif
@@ -31,33 +31,44 @@ namespace AZ
             {
                 RHI::Ptr<RHI::Buffer> m_blasBuffer;
                 RHI::Ptr<RHI::Buffer> m_scratchBuffer;
+
+                // buffers receiving the compacted size of the BLAS, only created if compaction is enabled
+                RHI::Ptr<RHI::Buffer> m_compactionSizeBuffer;
+                RHI::Ptr<RHI::Buffer> m_compactionSizeReadbackBuffer;
             };
 
 #ifdef AZ_DX12_DXR_SUPPORT
             const D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS& GetInputs() const { return m_inputs; }
+
+            static D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS GetAccelerationStructureBuildFlags(const RHI::RayTracingAccelerationStructureBuildFlags &buildFlags);
 #endif
             const BlasBuffers& GetBuffers() const { return m_buffers[m_currentBufferIndex]; }
 
+            //! Returns the buffers of the uncompacted BLAS, which are the source of the compaction copy into the current buffers
+            const BlasBuffers& GetCompactionSourceBuffers() const { return m_buffers[m_compactionSourceBufferIndex]; }
+
             // RHI::RayTracingBlas overrides...
             virtual bool IsValid() const override { return m_buffers[m_currentBufferIndex].m_blasBuffer != nullptr; }
+            uint64_t GetCompactedSizeInBytes() const override;
+            uint64_t GetSizeInBytes() const override;
 
         private:
             RayTracingBlas() = default;
 
             // RHI::RayTracingBlas overrides...
             RHI::ResultCode CreateBuffersInternal(RHI::Device& deviceBase, const RHI::RayTracingBlasDescriptor* descriptor, const RHI::RayTracingBufferPools& rayTracingBufferPools) override;
+            RHI::ResultCode CreateCompactedBuffersInternal(RHI::Device& deviceBase, uint64_t compactedSizeInBytes, const RHI::RayTracingBufferPools& rayTracingBufferPools) override;
 
 #ifdef AZ_DX12_DXR_SUPPORT
             AZStd::vector<D3D12_RAYTRACING_GEOMETRY_DESC> m_geometryDescs;
             D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS m_inputs;
-
-            static D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS GetAccelerationStructureBuildFlags(const RHI::RayTracingAccelerationStructureBuildFlags &buildFlags);
 #endif
 
             // buffer list to keep buffers alive for several frames
             static const uint32_t BufferCount = AZ::RHI::Limits::Device::FrameCountMax;
             BlasBuffers m_buffers[BufferCount];
             uint32_t m_currentBufferIndex = 0;
+            uint32_t m_compactionSourceBufferIndex = 0;
         };
     }
 }
@@ -28,12 +28,62 @@ namespace AZ
         {
 #ifdef AZ_DX12_DXR_SUPPORT
             Device& device = static_cast<Device&>(deviceBase);
-            ID3D12DeviceX* dx12Device = device.GetDevice();
 
             // advance to the next buffer
             m_currentBufferIndex = (m_currentBufferIndex + 1) % BufferCount;
+            m_updateSourceBufferIndex = m_currentBufferIndex;
+
+            return CreateTlasBuffers(device, m_buffers[m_currentBufferIndex], descriptor, bufferPools);
+#else
+            return RHI::ResultCode::Success;
+#endif
+        }
+
+        RHI::ResultCode RayTracingTlas::UpdateBuffersInternal([[maybe_unused]] RHI::Device& deviceBase, [[maybe_unused]] const RHI::RayTracingTlasDescriptor* descriptor, [[maybe_unused]] const RHI::RayTracingBufferPools& bufferPools)
+        {
+#ifdef AZ_DX12_DXR_SUPPORT
+            Device& device = static_cast<Device&>(deviceBase);
+
+            // an update requires the same instance list layout as the current TLAS, which must allow updates
+            const RHI::RayTracingTlasInstanceVector& instances = descriptor->GetInstances();
+            const TlasBuffers& sourceBuffers = m_buffers[m_currentBufferIndex];
+            if (descriptor->GetInstancesBuffer() != nullptr ||
+                instances.empty() ||
+                sourceBuffers.m_tlasBuffer == nullptr ||
+                sourceBuffers.m_instanceCount != instances.size() ||
+                sourceBuffers.m_buildFlags != RayTracingBlas::GetAccelerationStructureBuildFlags(descriptor->GetBuildFlags()) ||
+                (sourceBuffers.m_buildFlags & D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_UPDATE) == 0)
+            {
+                return RHI::ResultCode::InvalidOperation;
+            }
+
+            // advance to the next buffer, the previous TLAS is the source of the update
+            m_updateSourceBufferIndex = m_currentBufferIndex;
+            m_currentBufferIndex = (m_currentBufferIndex + 1) % BufferCount;
             TlasBuffers& buffers = m_buffers[m_currentBufferIndex];
 
+            if (buffers.m_tlasBuffer == nullptr ||
+                buffers.m_instanceCount != sourceBuffers.m_instanceCount ||
+                buffers.m_buildFlags != sourceBuffers.m_buildFlags)
+            {
+                // the buffers of this set were created for a different TLAS, recreate them with the layout of the source
+                return CreateTlasBuffers(device, buffers, descriptor, bufferPools);
+            }
+
+            // re-use the buffers, only the changed instances are written
+            WriteInstances(buffers, instances, bufferPools);
+            m_inputs.InstanceDescs = static_cast<Buffer*>(buffers.m_tlasInstancesBuffer.get())->GetMemoryView().GetGpuAddress();
+#endif
+            return RHI::ResultCode::Success;
+        }
+
+#ifdef AZ_DX12_DXR_SUPPORT
+        RHI::ResultCode RayTracingTlas::CreateTlasBuffers(Device& device, TlasBuffers& buffers, const RHI::RayTracingTlasDescriptor* descriptor, const RHI::RayTracingBufferPools& bufferPools)
+        {
+            ID3D12DeviceX* dx12Device = device.GetDevice();
+
+            buffers.m_instanceDescs.clear();
+
             const RHI::RayTracingTlasInstanceVector& instances = descriptor->GetInstances();
             if (instances.empty())
             {
@@ -41,6 +91,7 @@ namespace AZ
                 buffers.m_tlasBuffer = nullptr;
                 buffers.m_tlasInstancesBuffer = nullptr;
                 buffers.m_scratchBuffer = nullptr;
+                buffers.m_instanceCount = 0;
                 return RHI::ResultCode::Success;
             }
             
@@ -67,31 +118,7 @@ namespace AZ
                 MemoryView& tlasInstancesMemoryView = static_cast<Buffer*>(buffers.m_tlasInstancesBuffer.get())->GetMemoryView();
                 tlasInstancesMemoryView.SetName(L"TLAS Instance");
             
-                RHI::BufferMapResponse mapResponse;
-                resultCode = bufferPools.GetTlasInstancesBufferPool()->MapBuffer(RHI::BufferMapRequest(*buffers.m_tlasInstancesBuffer, 0, instanceDescsSizeInBytes), mapResponse);
-                AZ_Assert(resultCode == RHI::ResultCode::Success, "failed to map TLAS instances buffer");
-                D3D12_RAYTRACING_INSTANCE_DESC* mappedData = reinterpret_cast<D3D12_RAYTRACING_INSTANCE_DESC*>(mapResponse.m_data);
-            
-                ZeroMemory(mappedData, instanceDescsSizeInBytes);
-            
-                // create each D3D12_RAYTRACING_INSTANCE_DESC structure
-                for (uint32_t i = 0; i < instances.size(); ++i)
-                {
-                    const RHI::RayTracingTlasInstance& instance = instances[i];
-                    RayTracingBlas* blas = static_cast<RayTracingBlas*>(instance.m_blas.get());
-            
-                    mappedData[i].InstanceID = instance.m_instanceID;
-                    mappedData[i].InstanceContributionToHitGroupIndex = instance.m_hitGroupIndex;
-                    // convert transform to row-major 3x4
-                    AZ::Matrix3x4 matrix3x4 = AZ::Matrix3x4::CreateFromTransform(instance.m_transform);
-                    matrix3x4.MultiplyByScale(instance.m_nonUniformScale);
-                    matrix3x4.StoreToRowMajorFloat12(&mappedData[i].Transform[0][0]);
-                    mappedData[i].AccelerationStructure = static_cast<DX12::Buffer*>(blas->GetBuffers().m_blasBuffer.get())->GetMemoryView().GetGpuAddress();
-                    mappedData[i].InstanceMask = instance.m_instanceMask;
-                    mappedData[i].Flags = instance.m_transparent ? D3D12_RAYTRACING_INSTANCE_FLAG_FORCE_NON_OPAQUE : D3D12_RAYTRACING_INSTANCE_FLAG_NONE;
-                }
-            
-                bufferPools.GetTlasInstancesBufferPool()->UnmapBuffer(*buffers.m_tlasInstancesBuffer);
+                WriteInstances(buffers, instances, bufferPools);
                 tlasInstancesGpuAddress = tlasInstancesMemoryView.GetGpuAddress();
             }
             else
@@ -108,10 +135,18 @@ namespace AZ
             m_inputs.InstanceDescs = tlasInstancesGpuAddress;
             m_inputs.DescsLayout = D3D12_ELEMENTS_LAYOUT_ARRAY;
             m_inputs.NumDescs = static_cast<UINT>(numInstances);
-            m_inputs.Flags = D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_PREFER_FAST_TRACE;
+            m_inputs.Flags = RayTracingBlas::GetAccelerationStructureBuildFlags(descriptor->GetBuildFlags());
+            buffers.m_instanceCount = numInstances;
+            buffers.m_buildFlags = m_inputs.Flags;
             
             D3D12_RAYTRACING_ACCELERATION_STRUCTURE_PREBUILD_INFO prebuildInfo = {};
             dx12Device->GetRaytracingAccelerationStructurePrebuildInfo(&m_inputs, &prebuildInfo);
+
+            // the scratch buffer is also used for updates if the TLAS allows them
+            if (m_inputs.Flags & D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAG_ALLOW_UPDATE)
+            {
+                prebuildInfo.ScratchDataSizeInBytes = AZStd::max(prebuildInfo.ScratchDataSizeInBytes, prebuildInfo.UpdateScratchDataSizeInBytes);
+            }
             
             prebuildInfo.ScratchDataSizeInBytes = RHI::AlignUp(prebuildInfo.ScratchDataSizeInBytes, D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT);
             prebuildInfo.ResultDataMaxSizeInBytes = RHI::AlignUp(prebuildInfo.ResultDataMaxSizeInBytes, D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BYTE_ALIGNMENT);
@@ -145,8 +180,69 @@ namespace AZ
             
             MemoryView& tlasMemoryView = static_cast<Buffer*>(buffers.m_tlasBuffer.get())->GetMemoryView();
             tlasMemoryView.SetName(L"TLAS");
-#endif
             return RHI::ResultCode::Success;
         }
+
+        void RayTracingTlas::WriteInstances(TlasBuffers& buffers, const RHI::RayTracingTlasInstanceVector& instances, const RHI::RayTracingBufferPools& bufferPools)
+        {
+            // all instances are written if the instance count changed since the last write
+            const bool writeAllInstances = buffers.m_instanceDescs.size() != instances.size();
+            buffers.m_instanceDescs.resize(instances.size());
+
+            // writes a contiguous range of changed instances to the instances buffer
+            auto writeInstanceRange = [&](uint32_t firstInstance, uint32_t instanceCount)
+            {
+                const uint64_t byteOffset = sizeof(D3D12_RAYTRACING_INSTANCE_DESC) * firstInstance;
+                const uint64_t byteCount = sizeof(D3D12_RAYTRACING_INSTANCE_DESC) * instanceCount;
+
+                RHI::BufferMapResponse mapResponse;
+                [[maybe_unused]] RHI::ResultCode resultCode = bufferPools.GetTlasInstancesBufferPool()->MapBuffer(RHI::BufferMapRequest(*buffers.m_tlasInstancesBuffer, byteOffset, byteCount), mapResponse);
+                AZ_Assert(resultCode == RHI::ResultCode::Success, "failed to map TLAS instances buffer");
+                memcpy(mapResponse.m_data, &buffers.m_instanceDescs[firstInstance], byteCount);
+                bufferPools.GetTlasInstancesBufferPool()->UnmapBuffer(*buffers.m_tlasInstancesBuffer);
+            };
+
+            uint32_t firstChangedInstance = 0;
+            uint32_t changedInstanceCount = 0;
+            for (uint32_t i = 0; i < instances.size(); ++i)
+            {
+                const RHI::RayTracingTlasInstance& instance = instances[i];
+                RayTracingBlas* blas = static_cast<RayTracingBlas*>(instance.m_blas.get());
+
+                // create the D3D12_RAYTRACING_INSTANCE_DESC structure
+                D3D12_RAYTRACING_INSTANCE_DESC instanceDesc = {};
+                instanceDesc.InstanceID = instance.m_instanceID;
+                instanceDesc.InstanceContributionToHitGroupIndex = instance.m_hitGroupIndex;
+                // convert transform to row-major 3x4
+                AZ::Matrix3x4 matrix3x4 = AZ::Matrix3x4::CreateFromTransform(instance.m_transform);
+                matrix3x4.MultiplyByScale(instance.m_nonUniformScale);
+                matrix3x4.StoreToRowMajorFloat12(&instanceDesc.Transform[0][0]);
+                instanceDesc.AccelerationStructure = static_cast<DX12::Buffer*>(blas->GetBuffers().m_blasBuffer.get())->GetMemoryView().GetGpuAddress();
+                instanceDesc.InstanceMask = instance.m_instanceMask;
+                instanceDesc.Flags = instance.m_transparent ? D3D12_RAYTRACING_INSTANCE_FLAG_FORCE_NON_OPAQUE : D3D12_RAYTRACING_INSTANCE_FLAG_NONE;
+
+                const bool instanceChanged = writeAllInstances || memcmp(&instanceDesc, &buffers.m_instanceDescs[i], sizeof(D3D12_RAYTRACING_INSTANCE_DESC)) != 0;
+                if (instanceChanged)
+                {
+                    buffers.m_instanceDescs[i] = instanceDesc;
+                    if (changedInstanceCount == 0)
+                    {
+                        firstChangedInstance = i;
+                    }
+                    ++changedInstanceCount;
+                }
+                else if (changedInstanceCount > 0)
+                {
+                    writeInstanceRange(firstChangedInstance, changedInstanceCount);
+                    changedInstanceCount = 0;
+                }
+            }
+
+            if (changedInstanceCount > 0)
+            {
+                writeInstanceRange(firstChangedInstance, changedInstanceCount);
+            }
+        }
+#endif
     }
 }
@@ -17,6 +17,7 @@ namespace AZ
     namespace DX12
     {
         class Buffer;
+        class Device;
 
         //! This class builds and contains the DX12 RayTracing TLAS buffers.
         class RayTracingTlas final
@@ -32,6 +33,14 @@ namespace AZ
                 RHI::Ptr<RHI::Buffer> m_tlasBuffer;
                 RHI::Ptr<RHI::Buffer> m_scratchBuffer;
                 RHI::Ptr<RHI::Buffer> m_tlasInstancesBuffer;
+                uint32_t m_instanceCount = 0;
+
+#ifdef AZ_DX12_DXR_SUPPORT
+                D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS m_buildFlags = {};
+
+                // copy of the instance data last written to the instances buffer, used to only rewrite changed instances
+                AZStd::vector<D3D12_RAYTRACING_INSTANCE_DESC> m_instanceDescs;
+#endif
             };
 
 #ifdef AZ_DX12_DXR_SUPPORT
@@ -39,6 +48,9 @@ namespace AZ
 #endif
             const TlasBuffers& GetBuffers() const { return m_buffers[m_currentBufferIndex]; }
 
+            //! Returns the buffers of the previous TLAS, which are the source of an update (refit) of the current TLAS
+            const TlasBuffers& GetUpdateSourceBuffers() const { return m_buffers[m_updateSourceBufferIndex]; }
+
             // RHI::RayTracingTlas overrides...
             const RHI::Ptr<RHI::Buffer> GetTlasBuffer() const override { return m_buffers[m_currentBufferIndex].m_tlasBuffer; }
             const RHI::Ptr<RHI::Buffer> GetTlasInstancesBuffer() const override { return m_buffers[m_currentBufferIndex].m_tlasInstancesBuffer; }
@@ -48,8 +60,15 @@ namespace AZ
 
             // RHI::RayTracingTlas overrides
             RHI::ResultCode CreateBuffersInternal(RHI::Device& deviceBase, const RHI::RayTracingTlasDescriptor* descriptor, const RHI::RayTracingBufferPools& rayTracingBufferPools) override;
+            RHI::ResultCode UpdateBuffersInternal(RHI::Device& deviceBase, const RHI::RayTracingTlasDescriptor* descriptor, const RHI::RayTracingBufferPools& rayTracingBufferPools) override;
 
 #ifdef AZ_DX12_DXR_SUPPORT
+            //! Creates the TLAS buffers in the buffer set from the descriptor
+            RHI::ResultCode CreateTlasBuffers(Device& device, TlasBuffers& buffers, const RHI::RayTracingTlasDescriptor* descriptor, const RHI::RayTracingBufferPools& bufferPools);
+
+            //! Writes the instances that differ from the data last written to the instances buffer of the buffer set
+            void WriteInstances(TlasBuffers& buffers, const RHI::RayTracingTlasInstanceVector& instances, const RHI::RayTracingBufferPools& bufferPools);
+
             D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS m_inputs;
 #endif
 
@@ -57,6 +76,7 @@ namespace AZ
             static const uint32_t BufferCount = AZ::RHI::Limits::Device::FrameCountMax;
             TlasBuffers m_buffers[BufferCount];
             uint32_t m_currentBufferIndex = 0;
+            uint32_t m_updateSourceBufferIndex = 0;
         };
     }
 }
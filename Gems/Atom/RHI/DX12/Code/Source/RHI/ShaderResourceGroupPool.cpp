@@ -199,14 +199,18 @@ namespace AZ
             RHI::ShaderResourceGroup& groupBase,
             const RHI::ShaderResourceGroupData& groupData)
         {
-            typedef AZ::RHI::ShaderResourceGroupData::ResourceTypeMask ResourceMask;
             ShaderResourceGroup& group = static_cast<ShaderResourceGroup&>(groupBase);
 
             group.m_compiledDataIndex = (group.m_compiledDataIndex + 1) % RHI::Limits::Device::FrameCountMax;
-            
-            if (m_constantBufferSize && groupBase.IsResourceTypeEnabledForCompilation(static_cast<uint32_t>(ResourceMask::ConstantDataMask)))
+
+            // Only upload the constants modified since this copy of the constant buffer was last written.
+            const RHI::Interval constantDataInterval = groupBase.AcquireCompiledDataUpdate(group.m_compiledDataIndex).m_constantDataInterval;
+            if (m_constantBufferSize && constantDataInterval.m_max > constantDataInterval.m_min)
             {
-                memcpy(group.GetCompiledData().m_cpuConstantAddress, groupData.GetConstantData().data(), groupData.GetConstantData().size());
+                memcpy(
+                    group.GetCompiledData().m_cpuConstantAddress + constantDataInterval.m_min,
+                    groupData.GetConstantData().data() + constantDataInterval.m_min,
+                    constantDataInterval.m_max - constantDataInterval.m_min);
             }
 
             if (m_viewsDescriptorTableSize)
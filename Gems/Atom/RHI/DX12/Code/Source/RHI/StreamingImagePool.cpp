@@ -405,11 +405,7 @@ namespace AZ
             if (mipInterval.m_min < mipInterval.m_max)
             {
                 // add wait frame fence to async upload queue before queue tile mapping
-                auto& device = static_cast<Device&>(GetDevice());
-                CommandQueueContext& context = device.GetCommandQueueContext();
-                const FenceSet &compiledFences = context.GetFrameFences(context.GetLastFrameIndex());
-                const Fence& fence = compiledFences.GetFence(RHI::HardwareQueueClass::Graphics);
-                GetDevice().GetAsyncUploadQueue().QueueWaitFence(fence, fence.GetPendingValue());
+                QueueWaitForLastFrame();
 
                 AZStd::lock_guard<AZStd::mutex> lock(m_tileMutex);
                 for (uint32_t arrayIndex = 0; arrayIndex < descriptor.m_arraySize; ++arrayIndex)
@@ -423,6 +419,71 @@ namespace AZ
             }
         }
 
+        void StreamingImagePool::QueueWaitForLastFrame()
+        {
+            auto& device = static_cast<Device&>(GetDevice());
+            CommandQueueContext& context = device.GetCommandQueueContext();
+            const FenceSet &compiledFences = context.GetFrameFences(context.GetLastFrameIndex());
+            const Fence& fence = compiledFences.GetFence(RHI::HardwareQueueClass::Graphics);
+            GetDevice().GetAsyncUploadQueue().QueueWaitFence(fence, fence.GetPendingValue());
+        }
+
+        bool StreamingImagePool::AllocateStreamedImageTile(Image& image, const RHI::StreamingImageTile& tile)
+        {
+            const uint32_t subresourceIndex = RHI::GetImageSubresourceIndex(tile.m_mipLevel, 0, image.GetDescriptor().m_mipLevels);
+            const uint32_t tileIndex = image.m_tileLayout.GetTileIndex(subresourceIndex, tile.m_x, tile.m_y);
+            if (image.m_streamedTiles.find(tileIndex) != image.m_streamedTiles.end())
+            {
+                return true;
+            }
+
+            // The streaming controller decides which tiles to evict, so fail instead of releasing memory when over budget
+            if (!GetDeviceHeapMemoryUsage().CanAllocate(m_tileAllocator.EvaluateMemoryAllocation(1)))
+            {
+                return false;
+            }
+
+            AZStd::vector<HeapTiles> heapTilesList = m_tileAllocator.Allocate(1);
+            if (heapTilesList.empty())
+            {
+                return false;
+            }
+
+            const HeapTiles& heapTiles = heapTilesList[0];
+            CommandList::TileMapRequest request;
+            request.m_sourceMemory = image.GetMemoryView().GetMemory();
+            request.m_sourceCoordinate = CD3DX12_TILED_RESOURCE_COORDINATE(tile.m_x, tile.m_y, 0, subresourceIndex);
+            request.m_sourceRegionSize = CD3DX12_TILE_REGION_SIZE(1, FALSE, 0, 0, 0);
+            request.m_destinationHeap = heapTiles.m_heap.get();
+            request.m_rangeFlags = { D3D12_TILE_RANGE_FLAG_NONE };
+            request.m_rangeStartOffsets = { heapTiles.m_tileSpanList.front().m_offset };
+            request.m_rangeTileCounts = { 1 };
+            GetDevice().GetAsyncUploadQueue().QueueTileMapping(request);
+
+            image.m_streamedTiles.emplace(tileIndex, heapTiles);
+            return true;
+        }
+
+        void StreamingImagePool::DeAllocateStreamedImageTile(Image& image, const RHI::StreamingImageTile& tile)
+        {
+            const uint32_t subresourceIndex = RHI::GetImageSubresourceIndex(tile.m_mipLevel, 0, image.GetDescriptor().m_mipLevels);
+            auto tileIt = image.m_streamedTiles.find(image.m_tileLayout.GetTileIndex(subresourceIndex, tile.m_x, tile.m_y));
+            if (tileIt == image.m_streamedTiles.end())
+            {
+                return;
+            }
+
+            // map the tile to NULL
+            CommandList::TileMapRequest request;
+            request.m_sourceMemory = image.GetMemoryView().GetMemory();
+            request.m_sourceCoordinate = CD3DX12_TILED_RESOURCE_COORDINATE(tile.m_x, tile.m_y, 0, subresourceIndex);
+            request.m_sourceRegionSize = CD3DX12_TILE_REGION_SIZE(1, FALSE, 0, 0, 0);
+            GetDevice().GetAsyncUploadQueue().QueueTileMapping(request);
+
+            m_tileAllocator.DeAllocate(AZStd::vector<HeapTiles>{ tileIt->second });
+            image.m_streamedTiles.erase(tileIt);
+        }
+
         bool StreamingImagePool::ShouldUseTileHeap(const RHI::ImageDescriptor& imageDescriptor) const
         {
             if (m_enableTileResource)
@@ -507,6 +568,14 @@ namespace AZ
             image.GenerateSubresourceLayouts();
             image.m_streamedMipLevel = request.m_descriptor.m_mipLevels - static_cast<uint32_t>(request.m_tailMipSlices.size());
 
+            // The mips more detailed than the tail mip slices are streamed per tile if requested and if they are all standard mips.
+            // Their tiles are only mapped while they are resident.
+            image.m_tileStreamedMipCount = 0;
+            if (useTileHeap && request.m_enableTileStreaming && image.m_tileLayout.m_mipCountStandard >= image.m_streamedMipLevel)
+            {
+                image.m_tileStreamedMipCount = image.m_streamedMipLevel;
+            }
+
             // allocate tiles from heaps for reserved images
             if (useTileHeap)
             {
@@ -533,6 +602,13 @@ namespace AZ
 
             GetResolver()->AddImageTransitionBarrier(image, request.m_descriptor.m_mipLevels, image.m_streamedMipLevel);
 
+            // The tile streamed mips stay in the common state, so they can be sampled through implicit state promotion while the
+            // async upload queue writes their tiles. They are visible to the image views right away.
+            if (image.IsTileStreamed())
+            {
+                image.m_streamedMipLevel = 0;
+            }
+
             return RHI::ResultCode::Success;
         }
 
@@ -556,9 +632,15 @@ namespace AZ
                 {
                     m_tileAllocator.DeAllocate(heapTiles.second);
                 }
+                for (const auto& streamedTile : image.m_streamedTiles)
+                {
+                    m_tileAllocator.DeAllocate(AZStd::vector<HeapTiles>{ streamedTile.second });
+                }
                 m_tileAllocator.GarbageCollect();
                 m_tileMutex.unlock();
                 image.m_heapTiles.clear();
+                image.m_streamedTiles.clear();
+                image.m_tileStreamedMipCount = 0;
                 image.m_tileLayout = ImageTileLayout();
             }
             else
@@ -612,8 +694,8 @@ namespace AZ
             // Wait for any upload of this image done. 
             GetDevice().GetAsyncUploadQueue().WaitForUpload(imageImpl.GetUploadFenceValue());
 
-            // Set streamed mip level to target mip level
-            if (imageImpl.GetStreamedMipLevel() < targetMipLevel)
+            // Set streamed mip level to target mip level. The tile streamed mips are always visible to the image views.
+            if (!imageImpl.IsTileStreamed() && imageImpl.GetStreamedMipLevel() < targetMipLevel)
             {
                 imageImpl.SetStreamedMipLevel(targetMipLevel);
             }
@@ -634,6 +716,85 @@ namespace AZ
             return RHI::ResultCode::Success;
         }
 
+        RHI::ResultCode StreamingImagePool::GetImageTileLayoutInternal(const RHI::Image& imageBase, RHI::StreamingImageTileLayout& tileLayout) const
+        {
+            const Image& image = static_cast<const Image&>(imageBase);
+            tileLayout = {};
+            if (!image.IsTileStreamed())
+            {
+                return RHI::ResultCode::Success;
+            }
+
+            tileLayout.m_tileSize = image.m_tileLayout.m_tileSize;
+            tileLayout.m_tileSizeInBytes = TileSizeInBytes;
+            tileLayout.m_tiledMipCount = image.m_tileStreamedMipCount;
+            for (uint32_t mipLevel = 0; mipLevel < image.m_tileStreamedMipCount; ++mipLevel)
+            {
+                const D3D12_SUBRESOURCE_TILING& tiling = image.m_tileLayout.m_subresourceTiling[mipLevel];
+                tileLayout.m_mipTileCounts.push_back(RHI::Size(tiling.WidthInTiles, tiling.HeightInTiles, 1));
+            }
+            return RHI::ResultCode::Success;
+        }
+
+        RHI::ResultCode StreamingImagePool::UpdateImageTilesInternal(const RHI::StreamingImageTileRequest& request)
+        {
+            AZ_PROFILE_FUNCTION(RHI);
+
+            Image& image = static_cast<Image&>(*request.m_image);
+            if (!image.IsTileStreamed())
+            {
+                AZ_Error("DX12::StreamingImagePool", false, "Image [%s] isn't tile streamed", image.GetName().GetCStr());
+                return RHI::ResultCode::InvalidOperation;
+            }
+
+            // Wait for any upload of this image done, it may write the evicted tiles.
+            GetDevice().GetAsyncUploadQueue().WaitForUpload(image.GetUploadFenceValue());
+
+            // Only upload the tiles which could be mapped.
+            AZStd::vector<RHI::StreamingImageTileData> uploadedTiles;
+            uploadedTiles.reserve(request.m_residentTiles.size());
+            {
+                if (!request.m_evictedTiles.empty())
+                {
+                    QueueWaitForLastFrame();
+                }
+
+                AZStd::lock_guard<AZStd::mutex> lock(m_tileMutex);
+                for (const RHI::StreamingImageTile& tile : request.m_evictedTiles)
+                {
+                    DeAllocateStreamedImageTile(image, tile);
+                }
+                m_tileAllocator.GarbageCollect();
+
+                for (const RHI::StreamingImageTileData& tileData : request.m_residentTiles)
+                {
+                    if (!AllocateStreamedImageTile(image, tileData.m_tile))
+                    {
+                        AZ_Warning("DX12::StreamingImagePool", false, "There isn't enough memory to make %zu tiles of image [%s] resident. "
+                            "Try increase the StreamingImagePool memory budget", request.m_residentTiles.size() - uploadedTiles.size(), image.GetName().GetCStr());
+                        break;
+                    }
+                    uploadedTiles.push_back(tileData);
+                }
+                image.UpdateResidentTilesSizeInBytes(TileSizeInBytes);
+            }
+
+            if (uploadedTiles.empty())
+            {
+                if (request.m_completeCallback)
+                {
+                    request.m_completeCallback();
+                }
+                return RHI::ResultCode::Success;
+            }
+
+            RHI::StreamingImageTileRequest uploadRequest = request;
+            uploadRequest.m_residentTiles = uploadedTiles;
+            GetDevice().GetAsyncUploadQueue().QueueUpload(uploadRequest, image.m_tileLayout.m_tileSize);
+
+            return RHI::ResultCode::Success;
+        }
+
         RHI::ResultCode StreamingImagePool::SetMemoryBudgetInternal(size_t newBudget)
         {
             RHI::HeapMemoryUsage& heapMemoryUsage = m_memoryUsage.GetHeapMemoryUsage(RHI::HeapMemoryLevel::Device);
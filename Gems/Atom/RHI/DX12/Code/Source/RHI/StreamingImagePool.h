@@ -44,6 +44,8 @@ namespace AZ
             RHI::ResultCode InitImageInternal(const RHI::StreamingImageInitRequest& request) override;
             RHI::ResultCode ExpandImageInternal(const RHI::StreamingImageExpandRequest& request) override;
             RHI::ResultCode TrimImageInternal(RHI::Image& image, uint32_t targetMipLevel) override;
+            RHI::ResultCode GetImageTileLayoutInternal(const RHI::Image& image, RHI::StreamingImageTileLayout& tileLayout) const override;
+            RHI::ResultCode UpdateImageTilesInternal(const RHI::StreamingImageTileRequest& request) override;
             RHI::ResultCode SetMemoryBudgetInternal(size_t newBudget) override;
             bool SupportTiledImageInternal() const override;
             //////////////////////////////////////////////////////////////////////////
@@ -74,6 +76,14 @@ namespace AZ
             // Packed mips occupy a dedicated set of tiles.
             void AllocatePackedImageTiles(Image& image);
 
+            // Tiles of tile streamed mips each have their own heap tile, which is only allocated while the tile is resident.
+            // Returns false if there isn't enough memory for the tile.
+            bool AllocateStreamedImageTile(Image& image, const RHI::StreamingImageTile& tile);
+            void DeAllocateStreamedImageTile(Image& image, const RHI::StreamingImageTile& tile);
+
+            // Adds a wait for the last frame to the async upload queue, so tiles can be unmapped once no frame uses them.
+            void QueueWaitForLastFrame();
+
             // Get the data reference of device heap memory usage 
             RHI::HeapMemoryUsage& GetDeviceHeapMemoryUsage();
 
@@ -99,9 +99,10 @@ namespace AZ
                  * Computes a cost heuristic based on the number of items and number of attachments in
                  * the scope. This cost is used to partition command list generation.
                  */
-                const AZ::u32 totalScopeCost =
+                const AZ::u32 totalScopeCost = GetScopeCost(
+                    scope.GetId(),
                     estimatedItemCount * m_frameGraphExecuterData.m_itemCost +
-                    static_cast<AZ::u32>(scope.GetAttachments().size()) * m_frameGraphExecuterData.m_attachmentCost;
+                        static_cast<AZ::u32>(scope.GetAttachments().size()) * m_frameGraphExecuterData.m_attachmentCost);
 
                 const AZ::u32 swapchainCount = static_cast<AZ::u32>(scope.GetSwapChainsToPresent().size());
 
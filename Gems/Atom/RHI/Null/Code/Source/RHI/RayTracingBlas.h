@@ -28,12 +28,15 @@ namespace AZ
 
             // RHI::RayTracingBlas overrides...
             virtual bool IsValid() const override { return true; }
+            uint64_t GetCompactedSizeInBytes() const override { return 0; }
+            uint64_t GetSizeInBytes() const override { return 0; }
 
         private:
             RayTracingBlas() = default;
 
             // RHI::RayTracingBlas overrides...
             RHI::ResultCode CreateBuffersInternal([[maybe_unused]] RHI::Device& deviceBase, [[maybe_unused]] const RHI::RayTracingBlasDescriptor* descriptor, [[maybe_unused]] const RHI::RayTracingBufferPools& rayTracingBufferPools) override {return RHI::ResultCode::Success;}
+            RHI::ResultCode CreateCompactedBuffersInternal([[maybe_unused]] RHI::Device& deviceBase, [[maybe_unused]] uint64_t compactedSizeInBytes, [[maybe_unused]] const RHI::RayTracingBufferPools& rayTracingBufferPools) override {return RHI::ResultCode::Success;}
         };
     }
 }
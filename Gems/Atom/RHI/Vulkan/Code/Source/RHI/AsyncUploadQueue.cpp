@@ -390,7 +390,7 @@ namespace AZ
             auto waitEvent = [this, request, image, range]()
             {
                 RHI::AsyncWorkHandle uploadHandle = image->GetUploadHandle();
-                image->SetLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, &range);
+                image->SetLayout(image->GetShaderReadLayout(), &range);
                 if (request.m_completeCallback)
                 {
                     if (request.m_waitForUpload)
@@ -429,6 +429,181 @@ namespace AZ
             return RHI::AsyncWorkHandle::Null;
         }
 
+        RHI::AsyncWorkHandle AsyncUploadQueue::QueueUpload(const RHI::StreamingImageTileRequest& request, const RHI::Size& tileSize)
+        {
+            auto* image = static_cast<Image*>(request.m_image);
+            auto& device = static_cast<Device&>(GetDevice());
+
+            // The tile list may not outlive this call, only the mip data does.
+            AZStd::vector<RHI::StreamingImageTileData> tiles(request.m_residentTiles.begin(), request.m_residentTiles.end());
+
+            uint32_t baseMip = RHI::Limits::Image::MipCountMax;
+            uint32_t lastMip = 0;
+            for (const RHI::StreamingImageTileData& tileData : tiles)
+            {
+                baseMip = AZStd::min(baseMip, tileData.m_tile.m_mipLevel);
+                lastMip = AZStd::max(lastMip, tileData.m_tile.m_mipLevel);
+            }
+            const uint32_t mipCount = lastMip - baseMip + 1;
+
+            RHI::Ptr<Fence> uploadFence = Fence::Create();
+            uploadFence->Init(device, RHI::FenceState::Reset);
+
+            CommandQueue::Command command = [=](void* queue)
+            {
+                AZ_PROFILE_SCOPE(RHI, "Upload Image Tiles");
+
+                Queue* vulkanQueue = static_cast<Queue*>(queue);
+                FramePacket* framePacket = BeginFramePacket(vulkanQueue);
+
+                // The other tiles of the mips may be sampled during the upload, so the mips stay in the general layout.
+                EmmitTiledMipsMemoryBarrier(
+                    *m_commandList, *image, baseMip, mipCount, VK_IMAGE_LAYOUT_GENERAL,
+                    0, VK_ACCESS_TRANSFER_WRITE_BIT, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+
+                const static uint32_t bufferOffsetAlign = 4; // refer VkBufferImageCopy in the spec.
+
+                for (const RHI::StreamingImageTileData& tileData : tiles)
+                {
+                    const RHI::ImageSubresourceLayout& mipLayout = tileData.m_mipLayout;
+                    const uint32_t blockWidth = mipLayout.m_blockElementWidth;
+                    const uint32_t blockHeight = mipLayout.m_blockElementHeight;
+                    const uint32_t bytesPerBlock = mipLayout.m_bytesPerRow / AZ::DivideAndRoundUp(mipLayout.m_size.m_width, blockWidth);
+
+                    // The region of the tile, clamped to the mip size on the edges.
+                    RHI::Origin origin(tileData.m_tile.m_x * tileSize.m_width, tileData.m_tile.m_y * tileSize.m_height, 0);
+                    RHI::Size extent(
+                        AZStd::min(tileSize.m_width, mipLayout.m_size.m_width - origin.m_left),
+                        AZStd::min(tileSize.m_height, mipLayout.m_size.m_height - origin.m_top),
+                        1);
+
+                    const uint32_t firstRow = origin.m_top / blockHeight;
+                    const uint32_t rowCount = AZ::DivideAndRoundUp(extent.m_height, blockHeight);
+                    const uint32_t rowOffset = (origin.m_left / blockWidth) * bytesPerBlock;
+                    const uint32_t bytesPerRow = AZ::DivideAndRoundUp(extent.m_width, blockWidth) * bytesPerBlock;
+                    const uint32_t stagingRowPitch = RHI::AlignUp(bytesPerRow, bufferOffsetAlign);
+                    const uint32_t stagingSize = rowCount * stagingRowPitch;
+
+                    if (stagingSize > m_descriptor.m_stagingSizeInBytes)
+                    {
+                        AZ_Warning("Vulkan", false, "AsyncUploadQueue staging buffer (%dK) is not big enough"
+                            "for the size of one image tile (%dK). Please increase staging buffer size.",
+                            m_descriptor.m_stagingSizeInBytes / 1024.0f, stagingSize / 1024.f);
+                        continue;
+                    }
+
+                    // If the current framePacket is not big enough, switch to next one.
+                    if (stagingSize > m_descriptor.m_stagingSizeInBytes - framePacket->m_dataOffset)
+                    {
+                        EndFramePacket(vulkanQueue);
+                        framePacket = BeginFramePacket(vulkanQueue);
+                    }
+
+                    // Copy the tile rows to staging memory.
+                    {
+                        AZ_PROFILE_SCOPE(RHI, "Copy CPU image tile");
+                        uint8_t* stagingDataStart = reinterpret_cast<uint8_t*>(framePacket->m_stagingBuffer->GetBufferMemoryView()->Map(RHI::HostMemoryAccess::Write)) + framePacket->m_dataOffset;
+                        const uint8_t* tileDataStart = reinterpret_cast<const uint8_t*>(tileData.m_mipData) + firstRow * mipLayout.m_bytesPerRow + rowOffset;
+                        for (uint32_t row = 0; row < rowCount; ++row)
+                        {
+                            memcpy(stagingDataStart + row * stagingRowPitch, tileDataStart + row * mipLayout.m_bytesPerRow, bytesPerRow);
+                        }
+                        framePacket->m_stagingBuffer->GetBufferMemoryView()->Unmap(RHI::HostMemoryAccess::Write);
+                    }
+
+                    RHI::CopyBufferToImageDescriptor copyDescriptor;
+                    copyDescriptor.m_sourceBuffer = framePacket->m_stagingBuffer.get();
+                    copyDescriptor.m_sourceOffset = framePacket->m_dataOffset;
+                    copyDescriptor.m_sourceBytesPerRow = stagingRowPitch;
+                    copyDescriptor.m_sourceBytesPerImage = stagingSize;
+                    copyDescriptor.m_sourceSize = extent;
+                    copyDescriptor.m_destinationImage = image;
+                    copyDescriptor.m_destinationSubresource.m_mipSlice = static_cast<uint16_t>(tileData.m_tile.m_mipLevel);
+                    copyDescriptor.m_destinationSubresource.m_arraySlice = 0;
+                    copyDescriptor.m_destinationOrigin = origin;
+
+                    m_commandList->Submit(RHI::CopyItem(copyDescriptor));
+
+                    framePacket->m_dataOffset += stagingSize;
+                }
+
+                EndFramePacket(vulkanQueue);
+                ProcessEndOfUpload(
+                    vulkanQueue,
+                    VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                    AZStd::vector<Fence*>{uploadFence.get()},
+                    *image,
+                    baseMip,
+                    mipCount);
+            };
+
+            RHI::ImageSubresourceRange range;
+            range.m_mipSliceMin = static_cast<uint16_t>(baseMip);
+            range.m_mipSliceMax = static_cast<uint16_t>(lastMip);
+            range.m_arraySliceMin = 0;
+            range.m_arraySliceMax = 0;
+            image->SetOwnerQueue(m_queue->GetId(), &range);
+            m_queue->QueueCommand(AZStd::move(command));
+
+            auto waitEvent = [this, request, image]()
+            {
+                RHI::AsyncWorkHandle uploadHandle = image->GetUploadHandle();
+                if (request.m_completeCallback)
+                {
+                    if (request.m_waitForUpload)
+                    {
+                        request.m_completeCallback();
+                    }
+                    else
+                    {
+                        // Processed from the main thread, see QueueUpload for mip slices.
+                        {
+                            AZStd::unique_lock<AZStd::mutex> lock(m_callbackListMutex);
+                            m_callbackList.insert(AZStd::make_pair(uploadHandle, [request, image]() { image->SetUploadHandle(RHI::AsyncWorkHandle::Null); request.m_completeCallback(); }));
+                        }
+                        AZ::TickBus::QueueFunction([this, uploadHandle]() { ProcessCallback(uploadHandle); });
+                    }
+                }
+            };
+
+            if (request.m_waitForUpload)
+            {
+                uploadFence->WaitOnCpu();
+                waitEvent();
+            }
+            else
+            {
+                auto uploadHandle = CreateAsyncWork(uploadFence, waitEvent);
+                image->SetUploadHandle(uploadHandle);
+                m_asyncWaitQueue.UnlockAsyncWorkQueue();
+                return uploadHandle;
+            }
+
+            return RHI::AsyncWorkHandle::Null;
+        }
+
+        void AsyncUploadQueue::QueueInitializeTiledMips(Image& image, uint32_t tiledMipCount)
+        {
+            CommandQueue::Command command = [=, &image](void* queue)
+            {
+                Queue* vulkanQueue = static_cast<Queue*>(queue);
+                BeginFramePacket(vulkanQueue);
+                EmmitTiledMipsMemoryBarrier(
+                    *m_commandList, image, 0, tiledMipCount, VK_IMAGE_LAYOUT_UNDEFINED,
+                    0, 0, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
+                EndFramePacket(vulkanQueue);
+            };
+
+            RHI::ImageSubresourceRange range;
+            range.m_mipSliceMin = 0;
+            range.m_mipSliceMax = static_cast<uint16_t>(tiledMipCount - 1);
+            range.m_arraySliceMin = 0;
+            range.m_arraySliceMax = 0;
+            image.SetOwnerQueue(m_queue->GetId(), &range);
+            image.SetLayout(VK_IMAGE_LAYOUT_GENERAL, &range);
+            m_queue->QueueCommand(AZStd::move(command));
+        }
+
         void AsyncUploadQueue::WaitForUpload(const RHI::AsyncWorkHandle& workHandle)
         {
             m_asyncWaitQueue.WaitToFinish(workHandle);
@@ -450,6 +625,29 @@ namespace AZ
             m_queue->QueueCommand(AZStd::move(command));
         }
 
+        void AsyncUploadQueue::QueueBindSparse(VkImage image, AZStd::vector<VkSparseImageMemoryBind>&& memoryBinds)
+        {
+            auto& device = static_cast<Device&>(GetDevice());
+
+            CommandQueue::Command command = [=, &device, memoryBinds = AZStd::move(memoryBinds)](void* queue)
+            {
+                VkSparseImageMemoryBindInfo imageBindInfo;
+                imageBindInfo.image = image;
+                imageBindInfo.bindCount = aznumeric_cast<uint32_t>(memoryBinds.size());
+                imageBindInfo.pBinds = memoryBinds.data();
+
+                VkBindSparseInfo bindInfo{};
+                bindInfo.sType = VkStructureType::VK_STRUCTURE_TYPE_BIND_SPARSE_INFO;
+                bindInfo.imageBindCount = 1;
+                bindInfo.pImageBinds = &imageBindInfo;
+
+                Queue* vulkanQueue = static_cast<Queue*>(queue);
+                device.GetContext().QueueBindSparse(vulkanQueue->GetNativeQueue(), 1, &bindInfo, VK_NULL_HANDLE);
+            };
+
+            m_queue->QueueCommand(AZStd::move(command));
+        }
+
         RHI::ResultCode AsyncUploadQueue::BuildFramePackets()
         {
             auto& device = static_cast<Device&>(GetDevice());
@@ -618,7 +816,7 @@ namespace AZ
             uint32_t residentMip)
         {
             const auto& image = static_cast<const Image&>(*request.m_image);
-            const VkImageLayout layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            const VkImageLayout layout = image.GetShaderReadLayout();
             const uint32_t beforeMip = residentMip;
             const uint32_t afterMip = beforeMip - static_cast<uint32_t>(request.m_mipSlices.size());
 
@@ -653,6 +851,59 @@ namespace AZ
                 &barrier);
         }
 
+        void AsyncUploadQueue::EmmitEpilogueMemoryBarrier(
+            CommandList& commandList,
+            const Image& image,
+            uint32_t baseMip,
+            uint32_t mipCount)
+        {
+            EmmitTiledMipsMemoryBarrier(
+                commandList, image, baseMip, mipCount, VK_IMAGE_LAYOUT_GENERAL,
+                VK_ACCESS_TRANSFER_WRITE_BIT, 0, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT);
+        }
+
+        void AsyncUploadQueue::EmmitTiledMipsMemoryBarrier(
+            CommandList& commandList,
+            const Image& image,
+            uint32_t baseMip,
+            uint32_t mipCount,
+            VkImageLayout oldLayout,
+            VkAccessFlags srcAccessMask,
+            VkAccessFlags dstAccessMask,
+            VkPipelineStageFlags srcStageMask,
+            VkPipelineStageFlags dstStageMask)
+        {
+            VkImageMemoryBarrier barrier{};
+            barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+            barrier.pNext = nullptr;
+            barrier.srcAccessMask = srcAccessMask;
+            barrier.dstAccessMask = dstAccessMask;
+            barrier.oldLayout = oldLayout;
+            barrier.newLayout = VK_IMAGE_LAYOUT_GENERAL;
+            barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image = image.GetNativeImage();
+            barrier.subresourceRange.aspectMask = image.GetImageAspectFlags();
+            barrier.subresourceRange.baseMipLevel = baseMip;
+            barrier.subresourceRange.levelCount = mipCount;
+            barrier.subresourceRange.baseArrayLayer = 0;
+            barrier.subresourceRange.layerCount = 1;
+
+            auto& device = static_cast<Device&>(GetDevice());
+
+            device.GetContext().CmdPipelineBarrier(
+                commandList.GetNativeCommandBuffer(),
+                srcStageMask,
+                dstStageMask,
+                VK_DEPENDENCY_BY_REGION_BIT,
+                0,
+                nullptr,
+                0,
+                nullptr,
+                1,
+                &barrier);
+        }
+
         RHI::AsyncWorkHandle AsyncUploadQueue::CreateAsyncWork(RHI::Ptr<Fence> fence, RHI::Fence::SignalCallback callback /* = nullptr */)
         {
             return m_asyncWaitQueue.CreateAsyncWork([fence, callback]()
@@ -25,6 +25,7 @@ namespace AZ
     {
         class Buffer;
         class CommandList;
+        class Image;
         class Queue;
         class Fence;
         struct QueueId;
@@ -61,11 +62,20 @@ namespace AZ
             RHI::AsyncWorkHandle QueueUpload(const RHI::BufferStreamRequest& request);
             RHI::AsyncWorkHandle QueueUpload(const RHI::StreamingImageExpandRequest& request, uint32_t residentMip);
 
+            // Upload the region of each resident tile of the request. The tile size is in texels.
+            RHI::AsyncWorkHandle QueueUpload(const RHI::StreamingImageTileRequest& request, const RHI::Size& tileSize);
+
+            // Transition the tiled mips of a tile streamed image to the general layout they stay in.
+            void QueueInitializeTiledMips(Image& image, uint32_t tiledMipCount);
+
             void WaitForUpload(const RHI::AsyncWorkHandle& workHandle);
 
             // queue sparse bindings
             void QueueBindSparse(const VkBindSparseInfo& bindSparseInfo);
 
+            // queue sparse bindings of image regions
+            void QueueBindSparse(VkImage image, AZStd::vector<VkSparseImageMemoryBind>&& memoryBinds);
+
         private:
             RHI::Ptr<CommandQueue> m_queue;
             RHI::Ptr<CommandList> m_commandList;
@@ -98,6 +108,24 @@ namespace AZ
                 const RHI::StreamingImageExpandRequest& request,
                 uint32_t residentMip);
 
+            void EmmitEpilogueMemoryBarrier(
+                CommandList& commandList,
+                const Image& image,
+                uint32_t baseMip,
+                uint32_t mipCount);
+
+            // Barrier for the tiled mips of tile streamed images, which are always in the general layout once initialized.
+            void EmmitTiledMipsMemoryBarrier(
+                CommandList& commandList,
+                const Image& image,
+                uint32_t baseMip,
+                uint32_t mipCount,
+                VkImageLayout oldLayout,
+                VkAccessFlags srcAccessMask,
+                VkAccessFlags dstAccessMask,
+                VkPipelineStageFlags srcStageMask,
+                VkPipelineStageFlags dstStageMask);
+
             // Handles the end of the upload. This includes emitting the epilogue barriers and doing any
             // necessary cross queue synchronization and ownership transfer (if needed).
             template<typename ...Args>
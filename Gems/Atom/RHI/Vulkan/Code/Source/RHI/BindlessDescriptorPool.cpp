@@ -10,6 +10,7 @@
 #include <RHI/BindlessDescriptorPool.h>
 #include <RHI/BufferView.h>
 #include <RHI/Device.h>
+#include <RHI/Image.h>
 #include <RHI/ImageView.h>
 #include <Atom/RHI.Reflect/VkAllocator.h>
 #include <Atom/RHI.Reflect/Vulkan/Conversion.h>
@@ -160,9 +161,10 @@ namespace AZ::Vulkan
 
         VkWriteDescriptorSet write = PrepareWrite(heapIndex, m_bindlessSrgDesc.m_roTextureIndex, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE);
         VkDescriptorImageInfo imageInfo{};
-        imageInfo.imageLayout = RHI::CheckBitsAny(view->GetImage().GetAspectFlags(), RHI::ImageAspectFlags::DepthStencil)
+        const auto& image = static_cast<const Image&>(view->GetImage());
+        imageInfo.imageLayout = RHI::CheckBitsAny(image.GetAspectFlags(), RHI::ImageAspectFlags::DepthStencil)
             ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL
-            : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+            : image.GetShaderReadLayout();
 
         imageInfo.imageView = view->GetNativeImageView();
         write.pImageInfo = &imageInfo;
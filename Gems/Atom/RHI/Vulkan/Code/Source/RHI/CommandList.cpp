@@ -1144,6 +1144,11 @@ namespace AZ
 
             const auto& context = static_cast<Device&>(GetDevice()).GetContext();
 
+            if (blasBuffers.m_compactionSizeQueryPool != VK_NULL_HANDLE)
+            {
+                context.CmdResetQueryPool(GetNativeCommandBuffer(), blasBuffers.m_compactionSizeQueryPool, 0, 1);
+            }
+
             // submit the command to build the BLAS
             const VkAccelerationStructureBuildRangeInfoKHR* rangeInfos = blasBuffers.m_rangeInfos.data();
             context.CmdBuildAccelerationStructuresKHR(GetNativeCommandBuffer(), 1, &blasBuffers.m_buildInfo, &rangeInfos);
@@ -1167,6 +1172,18 @@ namespace AZ
                 nullptr,
                 0,
                 nullptr);
+
+            // write the compacted size of the BLAS, it's read back with RayTracingBlas::GetCompactedSizeInBytes() once the build has completed
+            if (blasBuffers.m_compactionSizeQueryPool != VK_NULL_HANDLE)
+            {
+                context.CmdWriteAccelerationStructuresPropertiesKHR(
+                    GetNativeCommandBuffer(),
+                    1,
+                    &blasBuffers.m_accelerationStructure,
+                    VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR,
+                    blasBuffers.m_compactionSizeQueryPool,
+                    0);
+            }
         }
 
         void CommandList::UpdateBottomLevelAccelerationStructure([[maybe_unused]] const RHI::RayTracingBlas& rayTracingBlas)
@@ -1239,6 +1256,79 @@ namespace AZ
                 nullptr);
         }
 
+        void CommandList::UpdateTopLevelAccelerationStructure(const RHI::RayTracingTlas& rayTracingTlas)
+        {
+            const RayTracingTlas& vulkanRayTracingTlas = static_cast<const RayTracingTlas&>(rayTracingTlas);
+            const RayTracingTlas::TlasBuffers& tlasBuffers = vulkanRayTracingTlas.GetBuffers();
+
+            // set the build mode to update the acceleration structure from the previous TLAS
+            VkAccelerationStructureBuildGeometryInfoKHR tempBuildInfo = tlasBuffers.m_buildInfo;
+            tempBuildInfo.mode = VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
+            tempBuildInfo.srcAccelerationStructure = vulkanRayTracingTlas.GetUpdateSourceBuffers().m_accelerationStructure;
+
+            const auto& context = static_cast<Device&>(GetDevice()).GetContext();
+
+            // submit the command to update the TLAS
+            const VkAccelerationStructureBuildRangeInfoKHR& offsetInfo = tlasBuffers.m_offsetInfo;
+            const VkAccelerationStructureBuildRangeInfoKHR* pOffsetInfo = &offsetInfo;
+            context.CmdBuildAccelerationStructuresKHR(GetNativeCommandBuffer(), 1, &tempBuildInfo, &pOffsetInfo);
+
+            // we need a pipeline barrier on VK_ACCESS_ACCELERATION_STRUCTURE (both read and write) in case we are building
+            // multiple TLAS objects in a command list
+            VkMemoryBarrier memoryBarrier = {};
+            memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            memoryBarrier.pNext = nullptr;
+            memoryBarrier.srcAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR | VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR;
+            memoryBarrier.dstAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR | VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR;
+
+            context.CmdPipelineBarrier(
+                GetNativeCommandBuffer(),
+                VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
+                VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
+                0,
+                1,
+                &memoryBarrier,
+                0,
+                nullptr,
+                0,
+                nullptr);
+        }
+
+        void CommandList::CompactBottomLevelAccelerationStructure(const RHI::RayTracingBlas& rayTracingBlas)
+        {
+            const RayTracingBlas& vulkanRayTracingBlas = static_cast<const RayTracingBlas&>(rayTracingBlas);
+
+            const auto& context = static_cast<Device&>(GetDevice()).GetContext();
+
+            // submit the command to copy the BLAS into the compacted acceleration structure
+            VkCopyAccelerationStructureInfoKHR copyInfo = {};
+            copyInfo.sType = VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_INFO_KHR;
+            copyInfo.pNext = nullptr;
+            copyInfo.src = vulkanRayTracingBlas.GetCompactionSourceBuffers().m_accelerationStructure;
+            copyInfo.dst = vulkanRayTracingBlas.GetBuffers().m_accelerationStructure;
+            copyInfo.mode = VK_COPY_ACCELERATION_STRUCTURE_MODE_COMPACT_KHR;
+            context.CmdCopyAccelerationStructureKHR(GetNativeCommandBuffer(), &copyInfo);
+
+            // the compacted BLAS must be complete before it's referenced by a TLAS build
+            VkMemoryBarrier memoryBarrier = {};
+            memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+            memoryBarrier.pNext = nullptr;
+            memoryBarrier.srcAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR | VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR;
+            memoryBarrier.dstAccessMask = VK_ACCESS_ACCELERATION_STRUCTURE_WRITE_BIT_KHR | VK_ACCESS_ACCELERATION_STRUCTURE_READ_BIT_KHR;
+
+            context.CmdPipelineBarrier(
+                GetNativeCommandBuffer(),
+                VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
+                VK_PIPELINE_STAGE_ACCELERATION_STRUCTURE_BUILD_BIT_KHR,
+                0,
+                1,
+                &memoryBarrier,
+                0,
+                nullptr,
+                0,
+                nullptr);
+        }
+
         void CommandList::SetFragmentShadingRate(RHI::ShadingRate rate, const RHI::ShadingRateCombinators& combinators)
         {
             auto& device = static_cast<Device&>(GetDevice());
@@ -88,6 +88,8 @@ namespace AZ
             void BuildBottomLevelAccelerationStructure(const RHI::RayTracingBlas& rayTracingBlas) override;
             void UpdateBottomLevelAccelerationStructure(const RHI::RayTracingBlas& rayTracingBlas) override;
             void BuildTopLevelAccelerationStructure(const RHI::RayTracingTlas& rayTracingTlas) override;
+            void UpdateTopLevelAccelerationStructure(const RHI::RayTracingTlas& rayTracingTlas) override;
+            void CompactBottomLevelAccelerationStructure(const RHI::RayTracingBlas& rayTracingBlas) override;
             void SetFragmentShadingRate(
                 RHI::ShadingRate rate,
                 const RHI::ShadingRateCombinators& combinators = DefaultShadingRateCombinators) override;
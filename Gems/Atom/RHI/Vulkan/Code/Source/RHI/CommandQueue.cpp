@@ -10,6 +10,7 @@
 #include <RHI/CommandQueue.h>
 #include <RHI/Conversion.h>
 #include <RHI/Device.h>
+#include <RHI/PhysicalDevice.h>
 #include <RHI/SwapChain.h>
 
 #include <AzCore/Debug/Timer.h>
@@ -38,6 +39,14 @@ namespace AZ
             RETURN_RESULT_IF_UNSUCCESSFUL(result);
 
             m_supportedStagesMask = CalculateSupportedPipelineStages();
+
+            auto& device = static_cast<Device&>(deviceBase);
+            if (static_cast<const PhysicalDevice&>(device.GetPhysicalDevice()).IsFeatureSupported(DeviceFeature::TimelineSemaphore))
+            {
+                m_timelineSemaphore = Semaphore::Create();
+                RETURN_RESULT_IF_UNSUCCESSFUL(m_timelineSemaphore->Init(device, SemaphoreType::Timeline));
+                m_timelineSemaphore->SetName(Name(AZStd::string::format("%s Timeline", GetName().GetCStr())));
+            }
             return result;
         }
 
@@ -72,7 +81,13 @@ namespace AZ
                 }
 
                 // Submit commands to queue for the current frame.
-                vulkanQueue->SubmitCommandBuffers({request.m_commandList}, request.m_semaphoresToWait, request.m_semaphoresToSignal, fenceToSignal);
+                vulkanQueue->SubmitCommandBuffers(
+                    { request.m_commandList },
+                    request.m_semaphoresToWait,
+                    request.m_semaphoresToSignal,
+                    fenceToSignal,
+                    request.m_timelineSemaphoresToWait,
+                    request.m_timelineSemaphoresToSignal);
                 // Need to signal all the other fences (other than the first one)
                 for (size_t i = 1; i < request.m_fencesToSignal.size(); ++ i)
                 {
@@ -119,6 +134,7 @@ namespace AZ
 
         void CommandQueue::ShutdownInternal()
         {
+            m_timelineSemaphore = nullptr;
             if (m_queue)
             {
                 m_queue = nullptr;
@@ -135,6 +151,16 @@ namespace AZ
             return m_supportedStagesMask;
         }
 
+        Semaphore* CommandQueue::GetTimelineSemaphore() const
+        {
+            return m_timelineSemaphore.get();
+        }
+
+        uint64_t CommandQueue::AllocateTimelineValue()
+        {
+            return ++m_lastTimelineValue;
+        }
+
         QueueId CommandQueue::GetId() const
         {
             return m_queue->GetId();
@@ -32,6 +32,12 @@ namespace AZ
             /// Set of semaphores to signal after execution of commands
             AZStd::vector<RHI::Ptr<Semaphore>> m_semaphoresToSignal;
 
+            /// Set of timeline semaphore values to wait before execution of commands
+            AZStd::vector<Semaphore::WaitTimelineSemaphore> m_timelineSemaphoresToWait;
+
+            /// Set of timeline semaphore values to signal after execution of commands
+            AZStd::vector<Semaphore::TimelineValue> m_timelineSemaphoresToSignal;
+
             /// Fence to signal after execution of commands
             AZStd::vector<RHI::Ptr<Fence>> m_fencesToSignal;
 
@@ -69,6 +75,14 @@ namespace AZ
 
             QueueId GetId() const;
 
+            /// Returns the timeline semaphore other queues wait on to synchronize with this queue,
+            /// or null if the device doesn't support timeline semaphores.
+            Semaphore* GetTimelineSemaphore() const;
+
+            /// Returns a new value for the timeline semaphore to signal. Values must be signaled in the order they are
+            /// allocated, so this is only called while compiling the frame graph, which submits work in scope order.
+            uint64_t AllocateTimelineValue();
+
             void ClearTimers();
 
             AZStd::sys_time_t GetLastExecuteDuration() const;
@@ -92,6 +106,9 @@ namespace AZ
 
             VkPipelineStageFlags m_supportedStagesMask = 0;
 
+            RHI::Ptr<Semaphore> m_timelineSemaphore;
+            uint64_t m_lastTimelineValue = 0;
+
             AZStd::sys_time_t m_lastExecuteDuration{};
             AZStd::sys_time_t m_lastPresentDuration{};
         };
@@ -13,6 +13,7 @@
 #include <RHI/DescriptorSetLayout.h>
 #include <RHI/DescriptorSet.h>
 #include <RHI/Device.h>
+#include <RHI/Image.h>
 #include <RHI/ImageView.h>
 #include <RHI/MemoryView.h>
 #include <RHI/NullDescriptorManager.h>
@@ -160,8 +161,9 @@ namespace AZ
                     else
                     {
                         // if we are reading from a depth/stencil texture, then we use the depth/stencil read optimal layout instead of the generic shader read one
-                        imageInfo.imageLayout = RHI::CheckBitsAny(imageView->GetImage().GetAspectFlags(), RHI::ImageAspectFlags::DepthStencil) ?
-                            VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+                        const auto& image = static_cast<const Image&>(imageView->GetImage());
+                        imageInfo.imageLayout = RHI::CheckBitsAny(image.GetAspectFlags(), RHI::ImageAspectFlags::DepthStencil) ?
+                            VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL : image.GetShaderReadLayout();
                     }
                 }
                 
@@ -191,15 +193,28 @@ namespace AZ
             m_updateData.push_back(AZStd::move(data));
         }
 
-        void DescriptorSet::UpdateConstantData(AZStd::span<const uint8_t> rawData)
+        void DescriptorSet::UpdateConstantData(AZStd::span<const uint8_t> rawData, const RHI::Interval& modifiedInterval)
         {
             AZ_Assert(m_constantDataBuffer, "Null constant buffer");
             const DescriptorSetLayout& layout = *m_descriptor.m_descriptorSetLayout;
 
             BufferMemoryView* memoryView = m_constantDataBuffer->GetBufferMemoryView();
-            uint8_t* mappedData = static_cast<uint8_t*>(memoryView->Map(RHI::HostMemoryAccess::Write));
-            memcpy(mappedData, rawData.data(), rawData.size());
-            memoryView->Unmap(RHI::HostMemoryAccess::Write);
+            const size_t begin = AZStd::min<size_t>(modifiedInterval.m_min, rawData.size());
+            const size_t end = AZStd::min<size_t>(modifiedInterval.m_max, rawData.size());
+            if (begin < end)
+            {
+                uint8_t* mappedData = static_cast<uint8_t*>(memoryView->Map(RHI::HostMemoryAccess::Write));
+                memcpy(mappedData + begin, rawData.data() + begin, end - begin);
+                memoryView->Unmap(RHI::HostMemoryAccess::Write);
+            }
+
+            // The constant buffer never changes, so its descriptor only needs to be written once. Descriptor sets with
+            // unbounded arrays may be reallocated when committing the updates, so they always write it.
+            if (m_isConstantDataDescriptorWritten && !layout.GetHasUnboundedArray())
+            {
+                return;
+            }
+            m_isConstantDataDescriptorWritten = true;
 
             WriteDescriptorData data;
             data.m_layoutIndex = layout.GetLayoutIndexFromGroupIndex(0, DescriptorSetLayout::ResourceType::ConstantData);
@@ -220,6 +235,7 @@ namespace AZ
         VkResult DescriptorSet::Init(const Descriptor& descriptor)
         {
             m_descriptor = descriptor;
+            m_isConstantDataDescriptorWritten = false;
             AZ_Assert(descriptor.m_device, "Device is null.");
             AZ_Assert(descriptor.m_descriptorPool, "DescriptorPool is null.");
             AZ_Assert(descriptor.m_descriptorSetLayout, "DescriptorSetLayout is null.");
@@ -302,6 +318,7 @@ namespace AZ
             }
             m_constantDataBufferView = nullptr;
             m_constantDataBuffer = nullptr;
+            m_isConstantDataDescriptorWritten = false;
             Base::Shutdown();
         }
 
@@ -63,7 +63,8 @@ namespace AZ
             void UpdateBufferViews(uint32_t index, const AZStd::span<const RHI::ConstPtr<RHI::BufferView>>& bufViews);
             void UpdateImageViews(uint32_t index, const AZStd::span<const RHI::ConstPtr<RHI::ImageView>>& imageViews, RHI::ShaderInputImageType imageType);
             void UpdateSamplers(uint32_t index, const AZStd::span<const RHI::SamplerState>& samplers);
-            void UpdateConstantData(AZStd::span<const uint8_t> data);
+            //! Copies the modified byte interval of the constant data to the constant buffer.
+            void UpdateConstantData(AZStd::span<const uint8_t> data, const RHI::Interval& modifiedInterval);
 
             RHI::Ptr<BufferView> GetConstantDataBufferView() const;
 
@@ -106,6 +107,7 @@ namespace AZ
             RHI::Ptr<Buffer> m_constantDataBuffer;
             RHI::Ptr<BufferView> m_constantDataBufferView;
             bool m_nullDescriptorSupported = false;
+            bool m_isConstantDataDescriptorWritten = false;
             uint32_t m_currentUnboundedArrayAllocation = 0;
         };
 
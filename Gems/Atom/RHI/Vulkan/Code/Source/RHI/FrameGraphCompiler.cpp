@@ -372,6 +372,12 @@ namespace AZ
         void FrameGraphCompiler::CompileAsyncQueueSemaphores(const RHI::FrameGraph& frameGraph)
         {
             auto& device = static_cast<Device&>(GetDevice());
+            if (static_cast<const PhysicalDevice&>(device.GetPhysicalDevice()).IsFeatureSupported(DeviceFeature::TimelineSemaphore))
+            {
+                CompileAsyncQueueTimelineSemaphores(frameGraph);
+                return;
+            }
+
             for (RHI::Scope* scopeBase : frameGraph.GetScopes())
             {
                 Scope* scope = static_cast<Scope*>(scopeBase);
@@ -394,6 +400,61 @@ namespace AZ
             }
         }
 
+        void FrameGraphCompiler::CompileAsyncQueueTimelineSemaphores(const RHI::FrameGraph& frameGraph)
+        {
+            auto& queueContext = static_cast<Device&>(GetDevice()).GetCommandQueueContext();
+
+            // Values are allocated in scope order, so each queue signals its timeline in increasing order.
+            // Every consumer of a producer waits for the same value.
+            for (RHI::Scope* scopeBase : frameGraph.GetScopes())
+            {
+                Scope* scope = static_cast<Scope*>(scopeBase);
+                for (uint32_t hardwareQueueClassIdx = 0; hardwareQueueClassIdx < RHI::HardwareQueueClassCount; ++hardwareQueueClassIdx)
+                {
+                    const RHI::HardwareQueueClass hardwareQueueClass = static_cast<RHI::HardwareQueueClass>(hardwareQueueClassIdx);
+                    if (scope->GetHardwareQueueClass() != hardwareQueueClass && scope->GetConsumerByQueue(hardwareQueueClass))
+                    {
+                        CommandQueue& commandQueue = queueContext.GetCommandQueue(scope->GetHardwareQueueClass());
+                        scope->AddSignalSemaphore(Semaphore::TimelineValue{ commandQueue.GetTimelineSemaphore(), commandQueue.AllocateTimelineValue() });
+                        break;
+                    }
+                }
+            }
+
+            // The highest value each queue class waited for on the timeline of each other queue class. A semaphore wait also orders
+            // all later submissions to the queue, so waiting for the same or a lower value again is redundant.
+            AZStd::array<AZStd::array<uint64_t, RHI::HardwareQueueClassCount>, RHI::HardwareQueueClassCount> waitedValues = {};
+
+            for (RHI::Scope* scopeBase : frameGraph.GetScopes())
+            {
+                Scope* scope = static_cast<Scope*>(scopeBase);
+                const uint32_t consumerQueueClassIdx = static_cast<uint32_t>(scope->GetHardwareQueueClass());
+                for (uint32_t hardwareQueueClassIdx = 0; hardwareQueueClassIdx < RHI::HardwareQueueClassCount; ++hardwareQueueClassIdx)
+                {
+                    const RHI::HardwareQueueClass hardwareQueueClass = static_cast<RHI::HardwareQueueClass>(hardwareQueueClassIdx);
+                    if (hardwareQueueClassIdx == consumerQueueClassIdx)
+                    {
+                        continue;
+                    }
+
+                    const Scope* producer = static_cast<const Scope*>(scope->GetProducerByQueue(hardwareQueueClass));
+                    if (!producer)
+                    {
+                        continue;
+                    }
+
+                    AZ_Assert(producer->GetSignalTimelineSemaphores().size() == 1, "Producer scope doesn't signal its queue timeline.");
+                    const Semaphore::TimelineValue& timelineValue = producer->GetSignalTimelineSemaphores().front();
+                    uint64_t& waitedValue = waitedValues[consumerQueueClassIdx][hardwareQueueClassIdx];
+                    if (timelineValue.m_value > waitedValue)
+                    {
+                        waitedValue = timelineValue.m_value;
+                        scope->AddWaitSemaphore(Semaphore::WaitTimelineSemaphore(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, timelineValue));
+                    }
+                }
+            }
+        }
+
         RHI::ImageSubresourceRange FrameGraphCompiler::GetSubresourceRange(const RHI::ImageScopeAttachment& scopeAttachment) const
         {
             auto &physicalDevice = static_cast<const PhysicalDevice&>(GetDevice().GetPhysicalDevice());
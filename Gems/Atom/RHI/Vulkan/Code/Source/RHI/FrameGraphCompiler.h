@@ -87,6 +87,9 @@ namespace AZ
             RHI::BufferSubresourceRange GetSubresourceRange(const RHI::BufferScopeAttachment& scopeAttachment) const;
 
             void CompileAsyncQueueSemaphores(const RHI::FrameGraph& frameGraph);
+
+            /// Synchronizes queues with one timeline semaphore per queue instead of one binary semaphore per cross-queue edge.
+            void CompileAsyncQueueTimelineSemaphores(const RHI::FrameGraph& frameGraph);
         };
 
         template<class ResourceScopeAttachment, class ResourceType>
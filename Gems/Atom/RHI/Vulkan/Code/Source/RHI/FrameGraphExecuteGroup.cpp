@@ -36,6 +36,8 @@ namespace AZ
 
             m_workRequest.m_semaphoresToWait = scope.GetWaitSemaphores();
             m_workRequest.m_semaphoresToSignal = scope.GetSignalSemaphores();
+            m_workRequest.m_timelineSemaphoresToWait = scope.GetWaitTimelineSemaphores();
+            m_workRequest.m_timelineSemaphoresToSignal = scope.GetSignalTimelineSemaphores();
             m_workRequest.m_fencesToSignal = scope.GetSignalFences();
             
             InitRequest request;
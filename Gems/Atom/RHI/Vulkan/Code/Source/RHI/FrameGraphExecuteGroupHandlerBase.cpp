@@ -66,6 +66,8 @@ namespace AZ
             InsertWorkRequestElements(m_workRequest.m_swapChainsToPresent, workRequest.m_swapChainsToPresent);
             InsertWorkRequestElements(m_workRequest.m_semaphoresToWait, workRequest.m_semaphoresToWait);
             InsertWorkRequestElements(m_workRequest.m_semaphoresToSignal, workRequest.m_semaphoresToSignal);
+            InsertWorkRequestElements(m_workRequest.m_timelineSemaphoresToWait, workRequest.m_timelineSemaphoresToWait);
+            InsertWorkRequestElements(m_workRequest.m_timelineSemaphoresToSignal, workRequest.m_timelineSemaphoresToSignal);
             InsertWorkRequestElements(m_workRequest.m_fencesToSignal, workRequest.m_fencesToSignal);
         }
     }
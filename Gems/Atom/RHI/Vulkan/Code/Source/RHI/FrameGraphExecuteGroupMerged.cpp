@@ -43,10 +43,16 @@ namespace AZ
                 }
                 const auto& waitSemaphores = scope->GetWaitSemaphores();
                 const auto& signalSemaphores = scope->GetSignalSemaphores();
+                const auto& waitTimelineSemaphores = scope->GetWaitTimelineSemaphores();
+                const auto& signalTimelineSemaphores = scope->GetSignalTimelineSemaphores();
                 const auto& signalFences = scope->GetSignalFences();
 
                 m_workRequest.m_semaphoresToWait.insert(m_workRequest.m_semaphoresToWait.end(), waitSemaphores.begin(), waitSemaphores.end());
                 m_workRequest.m_semaphoresToSignal.insert(m_workRequest.m_semaphoresToSignal.end(), signalSemaphores.begin(), signalSemaphores.end());
+                m_workRequest.m_timelineSemaphoresToWait.insert(
+                    m_workRequest.m_timelineSemaphoresToWait.end(), waitTimelineSemaphores.begin(), waitTimelineSemaphores.end());
+                m_workRequest.m_timelineSemaphoresToSignal.insert(
+                    m_workRequest.m_timelineSemaphoresToSignal.end(), signalTimelineSemaphores.begin(), signalTimelineSemaphores.end());
                 m_workRequest.m_fencesToSignal.insert(m_workRequest.m_fencesToSignal.end(), signalFences.begin(), signalFences.end());
             }
 
@@ -119,9 +119,10 @@ namespace AZ
                     * Computes a cost heuristic based on the number of items and number of attachments in
                     * the scope. This cost is used to partition command list generation.
                     */
-                const uint32_t totalScopeCost =
+                const uint32_t totalScopeCost = GetScopeCost(
+                    scope.GetId(),
                     estimatedItemCount * m_frameGraphExecuterData.m_itemCost +
-                    static_cast<uint32_t>(scope.GetAttachments().size()) * m_frameGraphExecuterData.m_attachmentCost;
+                        static_cast<uint32_t>(scope.GetAttachments().size()) * m_frameGraphExecuterData.m_attachmentCost);
 
                 // Check if we are in a middle of a framegraph group.
                 const bool subpassGroup =
@@ -142,7 +143,10 @@ namespace AZ
                     const bool hardwareQueueMismatch = scope.GetHardwareQueueClass() != mergedHardwareQueueClass;
 
                     // Check if we are straddling the boundary of a fence/semaphore.
-                    const bool onSyncBoundaries = !scope.GetWaitSemaphores().empty() || (scopePrev && (!scopePrev->GetSignalSemaphores().empty() || !scopePrev->GetSignalFences().empty()));
+                    const bool onSyncBoundaries = !scope.GetWaitSemaphores().empty() || !scope.GetWaitTimelineSemaphores().empty() ||
+                        (scopePrev &&
+                         (!scopePrev->GetSignalSemaphores().empty() || !scopePrev->GetSignalTimelineSemaphores().empty() ||
+                          !scopePrev->GetSignalFences().empty()));
 
                     // If we exceeded limits, then flush the group.
                     const bool flushMergedScopes = exceededCommandCost || exceededSwapChainLimit || hardwareQueueMismatch || onSyncBoundaries || subpassGroup;
@@ -141,9 +141,57 @@ namespace AZ
                 memorySize += m_nonTailMipInfos[mip].m_blockCount * m_blockSizeInBytes;
             }
 
+            // tiles of the tiled mips bound individually
+            memorySize += m_residentTileCount * m_blockSizeInBytes;
+
             return memorySize; 
         }
 
+        void SparseImageInfo::InitTiledMips(uint16_t tiledMipCount)
+        {
+            AZ_Assert(tiledMipCount <= m_tailStartMip, "Only non-tail mips can be tiled");
+            m_tiledMipCount = tiledMipCount;
+            m_residentTileCount = 0;
+            m_tileAllocations.resize(tiledMipCount);
+            for (uint16_t mip = 0; mip < tiledMipCount; mip++)
+            {
+                const RHI::Size tileCount = GetTileCount(mip);
+                m_tileAllocations[mip].resize(tileCount.m_width * tileCount.m_height * tileCount.m_depth);
+            }
+        }
+
+        RHI::Size SparseImageInfo::GetTileCount(uint16_t mipLevel) const
+        {
+            const VkExtent3D imageGranularity = m_sparseImageMemoryRequirements.formatProperties.imageGranularity;
+            const RHI::Size& mipSize = m_nonTailMipInfos[mipLevel].m_size;
+            return RHI::Size(
+                AZ::DivideAndRoundUp(mipSize.m_width, imageGranularity.width),
+                AZ::DivideAndRoundUp(mipSize.m_height, imageGranularity.height),
+                AZ::DivideAndRoundUp(mipSize.m_depth, imageGranularity.depth));
+        }
+
+        VkSparseImageMemoryBind SparseImageInfo::GetTileMemoryBind(const RHI::StreamingImageTile& tile, VkDeviceMemory memory, VkDeviceSize memoryOffset) const
+        {
+            const VkExtent3D imageGranularity = m_sparseImageMemoryRequirements.formatProperties.imageGranularity;
+            const RHI::Size& mipSize = m_nonTailMipInfos[tile.m_mipLevel].m_size;
+
+            VkSparseImageMemoryBind memoryBind;
+            memoryBind.subresource.mipLevel = tile.m_mipLevel;
+            memoryBind.subresource.aspectMask = VkImageAspectFlagBits::VK_IMAGE_ASPECT_COLOR_BIT;
+            memoryBind.subresource.arrayLayer = 0;
+            memoryBind.offset.x = tile.m_x * imageGranularity.width;
+            memoryBind.offset.y = tile.m_y * imageGranularity.height;
+            memoryBind.offset.z = 0;
+            // tiles on the edges of the mip are clamped to the mip size
+            memoryBind.extent.width = AZStd::min(imageGranularity.width, mipSize.m_width - memoryBind.offset.x);
+            memoryBind.extent.height = AZStd::min(imageGranularity.height, mipSize.m_height - memoryBind.offset.y);
+            memoryBind.extent.depth = AZStd::min(imageGranularity.depth, mipSize.m_depth);
+            memoryBind.memory = memory;
+            memoryBind.memoryOffset = memoryOffset;
+            memoryBind.flags = 0;
+            return memoryBind;
+        }
+
         void SparseImageInfo::UpdateMipMemoryBindInfo(uint16_t mipLevel)
         {
             AZ_Assert(mipLevel < m_tailStartMip, "Invalid mip level. Mip level should be smaller than m_tailStartMip");
@@ -428,6 +476,16 @@ namespace AZ
             return m_isSparse;
         }
 
+        bool Image::IsTileStreamed() const
+        {
+            return m_isSparse && m_sparseImageInfo->m_tiledMipCount > 0;
+        }
+
+        VkImageLayout Image::GetShaderReadLayout() const
+        {
+            return IsTileStreamed() ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        }
+
         VkMemoryRequirements Image::GetMemoryRequirements(uint16_t residentMipLevel) const
         {
             if (m_isSparse)
@@ -469,6 +527,12 @@ namespace AZ
 
         void Image::FinalizeAsyncUpload(uint16_t newStreamedMipLevels)
         {
+            // The views of tile streamed images always include all the mips
+            if (IsTileStreamed())
+            {
+                return;
+            }
+
             AZ_Assert(newStreamedMipLevels <= m_streamedMipLevel, "Expand mip levels can't be more than streamed mip level.");
 
             if (newStreamedMipLevels < m_streamedMipLevel)
@@ -597,7 +661,8 @@ namespace AZ
         RHI::ResultCode Image::TrimImage(StreamingImagePool& pool, uint16_t targetMipLevel, bool updateMemoryBind)
         {
             // Set streamed mip level to target mip level if there are more mips
-            if (m_streamedMipLevel < targetMipLevel)
+            // The views of tile streamed images always include all the mips
+            if (m_streamedMipLevel < targetMipLevel && !IsTileStreamed())
             {
                 m_streamedMipLevel = targetMipLevel;
                 InvalidateViews();
@@ -719,6 +784,86 @@ namespace AZ
             return RHI::ResultCode::Success;
         }
 
+        RHI::ResultCode Image::UpdateTileMemory(
+            StreamingImagePool& imagePool,
+            AZStd::span<const RHI::StreamingImageTileData> residentTiles,
+            AZStd::span<const RHI::StreamingImageTile> evictedTiles)
+        {
+            AZ_Assert(IsTileStreamed(), "Image isn't tile streamed");
+            auto& device = static_cast<Device&>(GetDevice());
+            SparseImageInfo& sparseInfo = *m_sparseImageInfo;
+
+            auto getTileBlock = [&sparseInfo](const RHI::StreamingImageTile& tile) -> RHI::Ptr<VulkanMemoryAllocation>&
+            {
+                const RHI::Size tileCount = sparseInfo.GetTileCount(aznumeric_caster(tile.m_mipLevel));
+                AZ_Assert(tile.m_x < tileCount.m_width && tile.m_y < tileCount.m_height, "Tile is out of the mip");
+                return sparseInfo.m_tileAllocations[tile.m_mipLevel][tile.m_y * tileCount.m_width + tile.m_x];
+            };
+
+            AZStd::vector<VkSparseImageMemoryBind> memoryBinds;
+            memoryBinds.reserve(residentTiles.size() + evictedTiles.size());
+
+            // unbind the evicted tiles first, their blocks are released once the GPU is done with them
+            SparseImageInfo::MultiHeapTiles evictedBlocks;
+            for (const RHI::StreamingImageTile& tile : evictedTiles)
+            {
+                RHI::Ptr<VulkanMemoryAllocation>& tileBlock = getTileBlock(tile);
+                if (tileBlock)
+                {
+                    memoryBinds.push_back(sparseInfo.GetTileMemoryBind(tile, VK_NULL_HANDLE, 0));
+                    evictedBlocks.push_back(AZStd::move(tileBlock));
+                }
+            }
+            if (!evictedBlocks.empty())
+            {
+                sparseInfo.m_residentTileCount -= aznumeric_cast<uint32_t>(evictedBlocks.size());
+                imagePool.DeAllocateMemoryBlocks(evictedBlocks);
+            }
+
+            // allocate one block for each tile which isn't resident yet
+            uint32_t newTileCount = 0;
+            for (const RHI::StreamingImageTileData& tileData : residentTiles)
+            {
+                if (!getTileBlock(tileData.m_tile))
+                {
+                    ++newTileCount;
+                }
+            }
+
+            RHI::ResultCode result = RHI::ResultCode::Success;
+            if (newTileCount > 0)
+            {
+                VkMemoryRequirements memReq = m_memoryRequirements;
+                memReq.size = sparseInfo.m_blockSizeInBytes;
+
+                SparseImageInfo::MultiHeapTiles newBlocks;
+                result = imagePool.AllocateMemoryBlocks(newTileCount, memReq, newBlocks);
+                if (result == RHI::ResultCode::Success)
+                {
+                    size_t blockIndex = 0;
+                    for (const RHI::StreamingImageTileData& tileData : residentTiles)
+                    {
+                        RHI::Ptr<VulkanMemoryAllocation>& tileBlock = getTileBlock(tileData.m_tile);
+                        if (!tileBlock)
+                        {
+                            tileBlock = AZStd::move(newBlocks[blockIndex++]);
+                            const MemoryView memoryView(tileBlock);
+                            memoryBinds.push_back(sparseInfo.GetTileMemoryBind(
+                                tileData.m_tile, tileBlock->GetNativeDeviceMemory(), memoryView.GetVKMemoryOffset()));
+                        }
+                    }
+                    sparseInfo.m_residentTileCount += newTileCount;
+                }
+            }
+
+            if (!memoryBinds.empty())
+            {
+                device.GetAsyncUploadQueue().QueueBindSparse(m_vkImage, AZStd::move(memoryBinds));
+            }
+            m_residentSizeInBytes = sparseInfo.GetRequiredMemorySize(m_highestMipLevel);
+            return result;
+        }
+
         RHI::ResultCode Image::BuildSparseImage()
         {
             AZ_Assert(m_vkImage == VK_NULL_HANDLE, "Vulkan's native image has already been initialized.");
@@ -840,6 +985,23 @@ namespace AZ
                 {
                     imagePool.DeAllocateMemoryBlocks(mipInfo.m_heapTiles);
                 }
+
+                SparseImageInfo::MultiHeapTiles tileBlocks;
+                for (SparseImageInfo::MultiHeapTiles& mipTiles : m_sparseImageInfo->m_tileAllocations)
+                {
+                    for (RHI::Ptr<VulkanMemoryAllocation>& tileBlock : mipTiles)
+                    {
+                        if (tileBlock)
+                        {
+                            tileBlocks.push_back(AZStd::move(tileBlock));
+                        }
+                    }
+                }
+                if (!tileBlocks.empty())
+                {
+                    imagePool.DeAllocateMemoryBlocks(tileBlocks);
+                }
+                m_sparseImageInfo->m_residentTileCount = 0;
             }
             else
             {
@@ -9,6 +9,7 @@
 
 #include <Atom/RHI/Image.h>
 #include <Atom/RHI/ImageProperty.h>
+#include <Atom/RHI/StreamingImagePool.h>
 #include <Atom/RHI.Reflect/AttachmentEnums.h>
 #include <Atom/RHI.Reflect/ImageDescriptor.h>
 #include <Atom/RHI.Reflect/ImageSubresource.h>
@@ -107,6 +108,25 @@ namespace AZ
 
             // Update the sparse image memory bind info for specified mip range ( startMipLevel >= endMipLevel)
             void UpdateMemoryBindInfo(uint16_t startMipLevel, uint16_t endMipLevel);
+
+            // Number of most detailed mips whose memory is bound per tile (see RHI::StreamingImageInitRequest::m_enableTileStreaming).
+            // These are always non-tail mips. A tile is one sparse block of the image granularity.
+            uint16_t m_tiledMipCount = 0;
+
+            // Memory block bound to each tile of each tiled mip, in row major order. Null for tiles which aren't resident.
+            AZStd::vector<MultiHeapTiles> m_tileAllocations;
+
+            // Number of tiles of the tiled mips which currently have memory bound.
+            uint32_t m_residentTileCount = 0;
+
+            // Set the number of tiled mips of the image
+            void InitTiledMips(uint16_t tiledMipCount);
+
+            // Get the number of tiles in each dimension of a tiled mip
+            RHI::Size GetTileCount(uint16_t mipLevel) const;
+
+            // Get the sparse memory bind of a tile. A null memory unbinds the tile.
+            VkSparseImageMemoryBind GetTileMemoryBind(const RHI::StreamingImageTile& tile, VkDeviceMemory memory, VkDeviceSize memoryOffset) const;
         };
 
         class Image final
@@ -134,6 +154,13 @@ namespace AZ
             bool IsOwnerOfNativeImage() const;
             bool IsSparse() const;
 
+            // Returns whether the most detailed mips of the image are streamed per tile.
+            bool IsTileStreamed() const;
+
+            // Returns the layout in which shaders read the image. Tile streamed images always stay in the general layout,
+            // so tiles can be uploaded while the other tiles of their mip are being sampled.
+            VkImageLayout GetShaderReadLayout() const;
+
             // get required memory size with minimum resident mip level
             VkMemoryRequirements GetMemoryRequirements(uint16_t residentMipLevel) const;
 
@@ -199,6 +226,12 @@ namespace AZ
             // Trim image to specified mip level. Release unused bound memory if updateMemoryBind is true
             RHI::ResultCode TrimImage(StreamingImagePool& imagePool, uint16_t targetMipLevel, bool updateMemoryBind);
 
+            // Unbind and release the memory of the evicted tiles, then allocate and bind memory for the resident tiles
+            RHI::ResultCode UpdateTileMemory(
+                StreamingImagePool& imagePool,
+                AZStd::span<const RHI::StreamingImageTileData> residentTiles,
+                AZStd::span<const RHI::StreamingImageTile> evictedTiles);
+
             //////////////////////////////////////////////////////////////////////////
             // RHI::Image
             void SetDescriptor(const RHI::ImageDescriptor& descriptor) override;
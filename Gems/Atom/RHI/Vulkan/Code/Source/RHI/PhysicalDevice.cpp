@@ -294,6 +294,7 @@ namespace AZ
                 static_cast<size_t>(DeviceFeature::MemoryBudget),
                 VK_DEVICE_EXTENSION_SUPPORTED(context, EXT_memory_budget) && m_deviceProperties.vendorID != VendorID_Intel);
             m_features.set(static_cast<size_t>(DeviceFeature::SubgroupOperation), (majorVersion >= 1 && minorVersion >= 1));
+            m_features.set(static_cast<size_t>(DeviceFeature::TimelineSemaphore), (majorVersion >= 1 && minorVersion >= 2 && m_vulkan12Features.timelineSemaphore));
         }
 
         RawStringList PhysicalDevice::FilterSupportedOptionalExtensions()
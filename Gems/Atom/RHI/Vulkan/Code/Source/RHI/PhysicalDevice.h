@@ -35,6 +35,7 @@ namespace AZ
             BufferDeviceAddress,
             SubgroupOperation,
             MemoryBudget,
+            TimelineSemaphore,
             Count // Must be last
         };
 
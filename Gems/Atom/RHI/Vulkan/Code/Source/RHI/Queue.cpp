@@ -39,17 +39,24 @@ namespace AZ
             const AZStd::vector<RHI::Ptr<CommandList>>& commandBuffers, 
             const AZStd::vector<Semaphore::WaitSemaphore>& waitSemaphoresInfo,
             const AZStd::vector< RHI::Ptr<Semaphore>>& semaphoresToSignal,
-            Fence* fenceToSignal)
+            Fence* fenceToSignal,
+            const AZStd::vector<Semaphore::WaitTimelineSemaphore>& timelineSemaphoresToWait,
+            const AZStd::vector<Semaphore::TimelineValue>& timelineSemaphoresToSignal)
         {
             AZStd::vector<VkCommandBuffer> vkCommandBuffers;
             AZStd::vector<VkSemaphore> vkWaitSemaphoreVector; // vulkan.h has a #define called vkWaitSemaphores, so we name this differently
             AZStd::vector<VkPipelineStageFlags> vkWaitPipelineStages;
             AZStd::vector<VkSemaphore> vkSignalSemaphores;
+            AZStd::vector<uint64_t> vkWaitValues;
+            AZStd::vector<uint64_t> vkSignalValues;
             VkSubmitInfo submitInfo;
+            VkTimelineSemaphoreSubmitInfo timelineSubmitInfo;
             uint32_t submitCount = 0;
             if (!commandBuffers.empty() ||
                 !waitSemaphoresInfo.empty() ||
-                !semaphoresToSignal.empty())
+                !semaphoresToSignal.empty() ||
+                !timelineSemaphoresToWait.empty() ||
+                !timelineSemaphoresToSignal.empty())
             {
                 vkCommandBuffers.reserve(commandBuffers.size());
                 AZStd::transform(commandBuffers.begin(), commandBuffers.end(), AZStd::back_inserter(vkCommandBuffers), [&](const auto& item)
@@ -71,9 +78,49 @@ namespace AZ
                     item.second->WaitEvent();
                 });
 
+                const bool useTimelineSemaphores = !timelineSemaphoresToWait.empty() || !timelineSemaphoresToSignal.empty();
+                if (useTimelineSemaphores)
+                {
+                    // The values of binary semaphores are ignored, but every semaphore needs one.
+                    vkWaitValues.resize(vkWaitSemaphoreVector.size(), 0);
+                    for (const Semaphore::WaitTimelineSemaphore& item : timelineSemaphoresToWait)
+                    {
+                        vkWaitPipelineStages.push_back(item.first);
+                        vkWaitSemaphoreVector.push_back(item.second.m_semaphore->GetNativeSemaphore());
+                        vkWaitValues.push_back(item.second.m_value);
+                    }
+
+                    // A semaphore can only be signaled once per batch, so merged work only signals the highest value of each semaphore.
+                    vkSignalValues.resize(vkSignalSemaphores.size(), 0);
+                    const size_t binarySignalCount = vkSignalSemaphores.size();
+                    for (const Semaphore::TimelineValue& item : timelineSemaphoresToSignal)
+                    {
+                        const VkSemaphore nativeSemaphore = item.m_semaphore->GetNativeSemaphore();
+                        auto findIt = AZStd::find(vkSignalSemaphores.begin() + binarySignalCount, vkSignalSemaphores.end(), nativeSemaphore);
+                        if (findIt != vkSignalSemaphores.end())
+                        {
+                            uint64_t& signalValue = vkSignalValues[AZStd::distance(vkSignalSemaphores.begin(), findIt)];
+                            signalValue = AZStd::max(signalValue, item.m_value);
+                        }
+                        else
+                        {
+                            vkSignalSemaphores.push_back(nativeSemaphore);
+                            vkSignalValues.push_back(item.m_value);
+                        }
+                    }
+
+                    timelineSubmitInfo = {};
+                    timelineSubmitInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+                    timelineSubmitInfo.pNext = nullptr;
+                    timelineSubmitInfo.waitSemaphoreValueCount = static_cast<uint32_t>(vkWaitValues.size());
+                    timelineSubmitInfo.pWaitSemaphoreValues = vkWaitValues.empty() ? nullptr : vkWaitValues.data();
+                    timelineSubmitInfo.signalSemaphoreValueCount = static_cast<uint32_t>(vkSignalValues.size());
+                    timelineSubmitInfo.pSignalSemaphoreValues = vkSignalValues.empty() ? nullptr : vkSignalValues.data();
+                }
+
                 submitInfo = {};
                 submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-                submitInfo.pNext = nullptr;
+                submitInfo.pNext = useTimelineSemaphores ? &timelineSubmitInfo : nullptr;
                 submitInfo.waitSemaphoreCount = static_cast<uint32_t>(vkWaitSemaphoreVector.size());
                 submitInfo.pWaitSemaphores = vkWaitSemaphoreVector.empty() ? nullptr : vkWaitSemaphoreVector.data();
                 submitInfo.pWaitDstStageMask = vkWaitPipelineStages.empty() ? nullptr : vkWaitPipelineStages.data();
@@ -56,11 +56,14 @@ namespace AZ
             VkQueue GetNativeQueue() const;
 
             /// Submit commandBuffers to this queue.
+            /// Unlike binary semaphores, timeline semaphore values may be waited for before their signal is submitted.
             RHI::ResultCode SubmitCommandBuffers(
                 const AZStd::vector<RHI::Ptr<CommandList>>& commandBuffers,
                 const AZStd::vector<Semaphore::WaitSemaphore>& waitSemaphoresInfo,
                 const AZStd::vector< RHI::Ptr<Semaphore>>& semaphoresToSignal,
-                Fence* fenceToSignal);
+                Fence* fenceToSignal,
+                const AZStd::vector<Semaphore::WaitTimelineSemaphore>& timelineSemaphoresToWait = {},
+                const AZStd::vector<Semaphore::TimelineValue>& timelineSemaphoresToSignal = {});
 
             /// Waits (blocks) until all fences are signaled in the fence-list.
             void WaitForIdle();
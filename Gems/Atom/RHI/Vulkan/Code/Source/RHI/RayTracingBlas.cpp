@@ -34,12 +34,7 @@ namespace AZ
             m_currentBufferIndex = (m_currentBufferIndex + 1) % BufferCount;
             BlasBuffers& buffers = m_buffers[m_currentBufferIndex];
 
-            if (buffers.m_accelerationStructure)
-            {
-                device.GetContext().DestroyAccelerationStructureKHR(
-                    device.GetNativeDevice(), buffers.m_accelerationStructure, VkSystemAllocator::Get());
-                buffers.m_accelerationStructure = nullptr;
-            }
+            ReleaseNativeObjects(device, buffers);
 
             const RHI::RayTracingGeometryVector& geometries = descriptor->GetGeometries();
 
@@ -173,9 +168,126 @@ namespace AZ
             buffers.m_buildInfo.scratchData.deviceAddress =
                 device.GetContext().GetBufferDeviceAddress(device.GetNativeDevice(), &addressInfo);
 
+            // create the query pool for the compacted size, which is written after the BLAS is built
+            if (buffers.m_buildInfo.flags & VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR)
+            {
+                VkQueryPoolCreateInfo queryPoolCreateInfo = {};
+                queryPoolCreateInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+                queryPoolCreateInfo.queryType = VK_QUERY_TYPE_ACCELERATION_STRUCTURE_COMPACTED_SIZE_KHR;
+                queryPoolCreateInfo.queryCount = 1;
+
+                vkResult = device.GetContext().CreateQueryPool(
+                    device.GetNativeDevice(), &queryPoolCreateInfo, VkSystemAllocator::Get(), &buffers.m_compactionSizeQueryPool);
+                AssertSuccess(vkResult);
+            }
+
             return RHI::ResultCode::Success;
         }
 
+        RHI::ResultCode RayTracingBlas::CreateCompactedBuffersInternal(RHI::Device& deviceBase, uint64_t compactedSizeInBytes, const RHI::RayTracingBufferPools& bufferPools)
+        {
+            auto& device = static_cast<Device&>(deviceBase);
+
+            // advance to the next buffer, the current buffers are the source of the compaction copy
+            m_compactionSourceBufferIndex = m_currentBufferIndex;
+            m_currentBufferIndex = (m_currentBufferIndex + 1) % BufferCount;
+            const BlasBuffers& sourceBuffers = m_buffers[m_compactionSourceBufferIndex];
+            BlasBuffers& buffers = m_buffers[m_currentBufferIndex];
+
+            ReleaseNativeObjects(device, buffers);
+
+            // the compacted BLAS keeps the build information of the source, without the compaction flag
+            buffers.m_geometryDescs = sourceBuffers.m_geometryDescs;
+            buffers.m_rangeInfos = sourceBuffers.m_rangeInfos;
+            buffers.m_scratchBuffer = sourceBuffers.m_scratchBuffer;
+            buffers.m_buildInfo = sourceBuffers.m_buildInfo;
+            buffers.m_buildInfo.pGeometries = buffers.m_geometryDescs.data();
+            buffers.m_buildInfo.flags &= ~VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR;
+
+            // create compacted BLAS buffer
+            buffers.m_blasBuffer = RHI::Factory::Get().CreateBuffer();
+            AZ::RHI::BufferDescriptor blasBufferDescriptor;
+            blasBufferDescriptor.m_bindFlags = RHI::BufferBindFlags::ShaderReadWrite | RHI::BufferBindFlags::RayTracingAccelerationStructure;
+            blasBufferDescriptor.m_byteCount = RHI::AlignUp(compactedSizeInBytes, 256);
+
+            AZ::RHI::BufferInitRequest blasBufferRequest;
+            blasBufferRequest.m_buffer = buffers.m_blasBuffer.get();
+            blasBufferRequest.m_descriptor = blasBufferDescriptor;
+            RHI::ResultCode resultCode = bufferPools.GetBlasBufferPool()->InitBuffer(blasBufferRequest);
+            if (resultCode != RHI::ResultCode::Success)
+            {
+                AZ_Error("RayTracingBlas", false, "failed to create compacted BLAS buffer");
+                m_currentBufferIndex = m_compactionSourceBufferIndex;
+                return resultCode;
+            }
+
+            BufferMemoryView* blasMemoryView = static_cast<Buffer*>(buffers.m_blasBuffer.get())->GetBufferMemoryView();
+            blasMemoryView->SetName("BLAS Compacted");
+
+            // create compacted BLAS
+            VkAccelerationStructureCreateInfoKHR createInfo = {};
+            createInfo.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR;
+            createInfo.pNext = nullptr;
+            createInfo.type = VK_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL_KHR;
+            createInfo.size = blasBufferDescriptor.m_byteCount;
+            createInfo.offset = 0;
+            createInfo.buffer = blasMemoryView->GetNativeBuffer();
+
+            VkResult vkResult = device.GetContext().CreateAccelerationStructureKHR(
+                device.GetNativeDevice(), &createInfo, VkSystemAllocator::Get(), &buffers.m_accelerationStructure);
+            AssertSuccess(vkResult);
+
+            buffers.m_buildInfo.dstAccelerationStructure = buffers.m_accelerationStructure;
+
+            return RHI::ResultCode::Success;
+        }
+
+        uint64_t RayTracingBlas::GetCompactedSizeInBytes() const
+        {
+            const BlasBuffers& buffers = m_buffers[m_currentBufferIndex];
+            if (buffers.m_compactionSizeQueryPool == VK_NULL_HANDLE)
+            {
+                return 0;
+            }
+
+            auto& device = static_cast<Device&>(GetDevice());
+            uint64_t compactedSize = 0;
+            VkResult vkResult = device.GetContext().GetQueryPoolResults(
+                device.GetNativeDevice(),
+                buffers.m_compactionSizeQueryPool,
+                0,
+                1,
+                sizeof(compactedSize),
+                &compactedSize,
+                sizeof(compactedSize),
+                VK_QUERY_RESULT_64_BIT);
+
+            // VK_NOT_READY is returned until the BLAS build has completed on the GPU
+            return vkResult == VK_SUCCESS ? compactedSize : 0;
+        }
+
+        uint64_t RayTracingBlas::GetSizeInBytes() const
+        {
+            const BlasBuffers& buffers = m_buffers[m_currentBufferIndex];
+            return buffers.m_blasBuffer ? buffers.m_blasBuffer->GetDescriptor().m_byteCount : 0;
+        }
+
+        void RayTracingBlas::ReleaseNativeObjects(Device& device, BlasBuffers& buffers)
+        {
+            if (buffers.m_accelerationStructure)
+            {
+                device.GetContext().DestroyAccelerationStructureKHR(
+                    device.GetNativeDevice(), buffers.m_accelerationStructure, VkSystemAllocator::Get());
+                buffers.m_accelerationStructure = nullptr;
+            }
+
+            if (buffers.m_compactionSizeQueryPool)
+            {
+                device.GetContext().DestroyQueryPool(device.GetNativeDevice(), buffers.m_compactionSizeQueryPool, VkSystemAllocator::Get());
+                buffers.m_compactionSizeQueryPool = VK_NULL_HANDLE;
+            }
+        }
+
         VkBuildAccelerationStructureFlagsKHR RayTracingBlas::GetAccelerationStructureBuildFlags(const RHI::RayTracingAccelerationStructureBuildFlags &buildFlags)
         {
             VkBuildAccelerationStructureFlagsKHR vkBuildFlags = { 0 };
@@ -194,6 +306,11 @@ namespace AZ
                 vkBuildFlags |= VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR;
             }
 
+            if (RHI::CheckBitsAny(buildFlags, RHI::RayTracingAccelerationStructureBuildFlags::ENABLE_COMPACTION))
+            {
+                vkBuildFlags |= VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_COMPACTION_BIT_KHR;
+            }
+
             return vkBuildFlags;
         }
     }
@@ -17,6 +17,7 @@ namespace AZ
     namespace Vulkan
     {
         class Buffer;
+        class Device;
 
         //! This class builds and contains the Vulkan RayTracing BLAS buffers.
         class RayTracingBlas final
@@ -36,25 +37,38 @@ namespace AZ
                 AZStd::vector<VkAccelerationStructureGeometryKHR> m_geometryDescs;
                 AZStd::vector<VkAccelerationStructureBuildRangeInfoKHR> m_rangeInfos;
                 VkAccelerationStructureBuildGeometryInfoKHR m_buildInfo = {};
+
+                // query pool receiving the compacted size of the BLAS, only created if compaction is enabled
+                VkQueryPool m_compactionSizeQueryPool = VK_NULL_HANDLE;
             };
 
             const BlasBuffers& GetBuffers() const { return m_buffers[m_currentBufferIndex]; }
 
+            //! Returns the buffers of the uncompacted BLAS, which are the source of the compaction copy into the current buffers
+            const BlasBuffers& GetCompactionSourceBuffers() const { return m_buffers[m_compactionSourceBufferIndex]; }
+
             // RHI::RayTracingBlas overrides...
             virtual bool IsValid() const override { return m_buffers[m_currentBufferIndex].m_accelerationStructure != VK_NULL_HANDLE; }
+            uint64_t GetCompactedSizeInBytes() const override;
+            uint64_t GetSizeInBytes() const override;
+
+            static VkBuildAccelerationStructureFlagsKHR GetAccelerationStructureBuildFlags(const RHI::RayTracingAccelerationStructureBuildFlags &buildFlags);
 
         private:
             RayTracingBlas() = default;
 
             // RHI::RayTracingBlas overrides...
             RHI::ResultCode CreateBuffersInternal(RHI::Device& deviceBase, const RHI::RayTracingBlasDescriptor* descriptor, const RHI::RayTracingBufferPools& rayTracingBufferPools) override;
+            RHI::ResultCode CreateCompactedBuffersInternal(RHI::Device& deviceBase, uint64_t compactedSizeInBytes, const RHI::RayTracingBufferPools& rayTracingBufferPools) override;
 
-            static VkBuildAccelerationStructureFlagsKHR GetAccelerationStructureBuildFlags(const RHI::RayTracingAccelerationStructureBuildFlags &buildFlags);
+            //! Releases the acceleration structure and query pool of a buffer set before it is reused
+            void ReleaseNativeObjects(Device& device, BlasBuffers& buffers);
 
             // buffer list to keep buffers alive for several frames
             static const uint32_t BufferCount = 3;
             BlasBuffers m_buffers[BufferCount];
             uint32_t m_currentBufferIndex = 0;
+            uint32_t m_compactionSourceBufferIndex = 0;
         };
     }
 }
@@ -29,19 +29,61 @@ namespace AZ
         RHI::ResultCode RayTracingTlas::CreateBuffersInternal(RHI::Device& deviceBase, const RHI::RayTracingTlasDescriptor* descriptor, const RHI::RayTracingBufferPools& bufferPools)
         {
             auto& device = static_cast<Device&>(deviceBase);
-            auto& physicalDevice = static_cast<const PhysicalDevice&>(device.GetPhysicalDevice());
-            const VkPhysicalDeviceAccelerationStructurePropertiesKHR& accelerationStructureProperties = physicalDevice.GetPhysicalDeviceAccelerationStructureProperties();
-                        
+
             // advance to the next buffer
             m_currentBufferIndex = (m_currentBufferIndex + 1) % BufferCount;
+            m_updateSourceBufferIndex = m_currentBufferIndex;
+
+            return CreateTlasBuffers(device, m_buffers[m_currentBufferIndex], descriptor, bufferPools);
+        }
+
+        RHI::ResultCode RayTracingTlas::UpdateBuffersInternal(RHI::Device& deviceBase, const RHI::RayTracingTlasDescriptor* descriptor, const RHI::RayTracingBufferPools& bufferPools)
+        {
+            auto& device = static_cast<Device&>(deviceBase);
+
+            // an update requires the same instance list layout as the current TLAS, which must allow updates
+            const RHI::RayTracingTlasInstanceVector& instances = descriptor->GetInstances();
+            const TlasBuffers& sourceBuffers = m_buffers[m_currentBufferIndex];
+            if (descriptor->GetInstancesBuffer() != nullptr ||
+                instances.empty() ||
+                sourceBuffers.m_accelerationStructure == VK_NULL_HANDLE ||
+                sourceBuffers.m_instanceCount != instances.size() ||
+                sourceBuffers.m_buildInfo.flags != RayTracingBlas::GetAccelerationStructureBuildFlags(descriptor->GetBuildFlags()) ||
+                (sourceBuffers.m_buildInfo.flags & VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR) == 0)
+            {
+                return RHI::ResultCode::InvalidOperation;
+            }
+
+            // advance to the next buffer, the previous TLAS is the source of the update
+            m_updateSourceBufferIndex = m_currentBufferIndex;
+            m_currentBufferIndex = (m_currentBufferIndex + 1) % BufferCount;
             TlasBuffers& buffers = m_buffers[m_currentBufferIndex];
 
+            if (buffers.m_accelerationStructure == VK_NULL_HANDLE ||
+                buffers.m_instanceCount != sourceBuffers.m_instanceCount ||
+                buffers.m_buildInfo.flags != sourceBuffers.m_buildInfo.flags)
+            {
+                // the buffers of this set were created for a different TLAS, recreate them with the layout of the source
+                return CreateTlasBuffers(device, buffers, descriptor, bufferPools);
+            }
+
+            // re-use the buffers, only the changed instances are written
+            WriteInstances(device, buffers, instances, bufferPools);
+            return RHI::ResultCode::Success;
+        }
+
+        RHI::ResultCode RayTracingTlas::CreateTlasBuffers(Device& device, TlasBuffers& buffers, const RHI::RayTracingTlasDescriptor* descriptor, const RHI::RayTracingBufferPools& bufferPools)
+        {
+            auto& physicalDevice = static_cast<const PhysicalDevice&>(device.GetPhysicalDevice());
+            const VkPhysicalDeviceAccelerationStructurePropertiesKHR& accelerationStructureProperties = physicalDevice.GetPhysicalDeviceAccelerationStructureProperties();
+
             if (buffers.m_accelerationStructure)
             {
                 device.GetContext().DestroyAccelerationStructureKHR(
                     device.GetNativeDevice(), buffers.m_accelerationStructure, VkSystemAllocator::Get());
                 buffers.m_accelerationStructure = nullptr;
             }
+            buffers.m_instanceDescs.clear();
 
             const RHI::RayTracingTlasInstanceVector& instances = descriptor->GetInstances();
             if (instances.empty())
@@ -50,6 +92,7 @@ namespace AZ
                 buffers.m_tlasBuffer = nullptr;
                 buffers.m_tlasInstancesBuffer = nullptr;
                 buffers.m_scratchBuffer = nullptr;
+                buffers.m_instanceCount = 0;
                 return RHI::ResultCode::Success;
             }
             
@@ -74,37 +117,7 @@ namespace AZ
                 BufferMemoryView* tlasInstancesMemoryView = static_cast<Buffer*>(buffers.m_tlasInstancesBuffer.get())->GetBufferMemoryView();
                 tlasInstancesMemoryView->SetName("TLAS Instance");
                 
-                RHI::BufferMapResponse mapResponse;
-                resultCode = bufferPools.GetTlasInstancesBufferPool()->MapBuffer(RHI::BufferMapRequest(*buffers.m_tlasInstancesBuffer, 0, instanceDescsSizeInBytes), mapResponse);
-                AZ_Assert(resultCode == RHI::ResultCode::Success, "failed to map TLAS instances buffer");
-                VkAccelerationStructureInstanceKHR* mappedData = reinterpret_cast<VkAccelerationStructureInstanceKHR*>(mapResponse.m_data);
-
-                memset(mappedData, 0, instanceDescsSizeInBytes);
-            
-                // create each VkAccelerationStructureInstanceKHR structure
-                for (uint32_t i = 0; i < instances.size(); ++i)
-                {
-                    const RHI::RayTracingTlasInstance& instance = instances[i];
-            
-                    mappedData[i].instanceCustomIndex = instance.m_instanceID;
-                    mappedData[i].instanceShaderBindingTableRecordOffset = instance.m_hitGroupIndex;
-                    AZ::Matrix3x4 matrix3x4 = AZ::Matrix3x4::CreateFromTransform(instance.m_transform);
-                    matrix3x4.MultiplyByScale(instance.m_nonUniformScale);
-                    matrix3x4.StoreToRowMajorFloat12(&mappedData[i].transform.matrix[0][0]);
-            
-                    RayTracingBlas* blas = static_cast<RayTracingBlas*>(instance.m_blas.get());
-                    VkAccelerationStructureDeviceAddressInfoKHR addressInfo = {};
-                    addressInfo.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR;
-                    addressInfo.pNext = nullptr;
-                    addressInfo.accelerationStructure = blas->GetBuffers().m_accelerationStructure;
-                    mappedData[i].accelerationStructureReference =
-                        device.GetContext().GetAccelerationStructureDeviceAddressKHR(device.GetNativeDevice(), &addressInfo);
-
-                    mappedData[i].mask = instance.m_instanceMask;
-                    mappedData[i].flags = instance.m_transparent ? VK_GEOMETRY_INSTANCE_FORCE_NO_OPAQUE_BIT_KHR : 0;
-                }
-            
-                bufferPools.GetTlasInstancesBufferPool()->UnmapBuffer(*buffers.m_tlasInstancesBuffer);
+                WriteInstances(device, buffers, instances, bufferPools);
             
                 VkBufferDeviceAddressInfo addressInfo = {};
                 addressInfo.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO;
@@ -134,7 +147,7 @@ namespace AZ
             
             buffers.m_buildInfo = {};
             buffers.m_buildInfo.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_GEOMETRY_INFO_KHR;
-            buffers.m_buildInfo.flags = VK_BUILD_ACCELERATION_STRUCTURE_PREFER_FAST_TRACE_BIT_KHR;
+            buffers.m_buildInfo.flags = RayTracingBlas::GetAccelerationStructureBuildFlags(descriptor->GetBuildFlags());
             buffers.m_buildInfo.geometryCount = 1;
             buffers.m_buildInfo.pGeometries = &buffers.m_geometry;
             buffers.m_buildInfo.mode = VK_BUILD_ACCELERATION_STRUCTURE_MODE_BUILD_KHR;
@@ -151,6 +164,12 @@ namespace AZ
                 &buffers.m_instanceCount,
                 &buildSizesInfo);
 
+            // the scratch buffer is also used for updates if the TLAS allows them
+            if (buffers.m_buildInfo.flags & VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR)
+            {
+                buildSizesInfo.buildScratchSize = AZStd::max(buildSizesInfo.buildScratchSize, buildSizesInfo.updateScratchSize);
+            }
+
             buildSizesInfo.accelerationStructureSize = RHI::AlignUp(buildSizesInfo.accelerationStructureSize, 256);
             buildSizesInfo.buildScratchSize = RHI::AlignUp(buildSizesInfo.buildScratchSize, accelerationStructureProperties.minAccelerationStructureScratchOffsetAlignment);
 
@@ -216,5 +235,72 @@ namespace AZ
 
             return RHI::ResultCode::Success;
         }
+
+        void RayTracingTlas::WriteInstances(Device& device, TlasBuffers& buffers, const RHI::RayTracingTlasInstanceVector& instances, const RHI::RayTracingBufferPools& bufferPools)
+        {
+            // all instances are written if the instance count changed since the last write
+            const bool writeAllInstances = buffers.m_instanceDescs.size() != instances.size();
+            buffers.m_instanceDescs.resize(instances.size());
+
+            // writes a contiguous range of changed instances to the instances buffer
+            auto writeInstanceRange = [&](uint32_t firstInstance, uint32_t instanceCount)
+            {
+                const uint64_t byteOffset = sizeof(VkAccelerationStructureInstanceKHR) * firstInstance;
+                const uint64_t byteCount = sizeof(VkAccelerationStructureInstanceKHR) * instanceCount;
+
+                RHI::BufferMapResponse mapResponse;
+                [[maybe_unused]] RHI::ResultCode resultCode = bufferPools.GetTlasInstancesBufferPool()->MapBuffer(RHI::BufferMapRequest(*buffers.m_tlasInstancesBuffer, byteOffset, byteCount), mapResponse);
+                AZ_Assert(resultCode == RHI::ResultCode::Success, "failed to map TLAS instances buffer");
+                memcpy(mapResponse.m_data, &buffers.m_instanceDescs[firstInstance], byteCount);
+                bufferPools.GetTlasInstancesBufferPool()->UnmapBuffer(*buffers.m_tlasInstancesBuffer);
+            };
+
+            uint32_t firstChangedInstance = 0;
+            uint32_t changedInstanceCount = 0;
+            for (uint32_t i = 0; i < instances.size(); ++i)
+            {
+                const RHI::RayTracingTlasInstance& instance = instances[i];
+
+                // create the VkAccelerationStructureInstanceKHR structure
+                VkAccelerationStructureInstanceKHR instanceDesc = {};
+                instanceDesc.instanceCustomIndex = instance.m_instanceID;
+                instanceDesc.instanceShaderBindingTableRecordOffset = instance.m_hitGroupIndex;
+                AZ::Matrix3x4 matrix3x4 = AZ::Matrix3x4::CreateFromTransform(instance.m_transform);
+                matrix3x4.MultiplyByScale(instance.m_nonUniformScale);
+                matrix3x4.StoreToRowMajorFloat12(&instanceDesc.transform.matrix[0][0]);
+
+                RayTracingBlas* blas = static_cast<RayTracingBlas*>(instance.m_blas.get());
+                VkAccelerationStructureDeviceAddressInfoKHR addressInfo = {};
+                addressInfo.sType = VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR;
+                addressInfo.pNext = nullptr;
+                addressInfo.accelerationStructure = blas->GetBuffers().m_accelerationStructure;
+                instanceDesc.accelerationStructureReference =
+                    device.GetContext().GetAccelerationStructureDeviceAddressKHR(device.GetNativeDevice(), &addressInfo);
+
+                instanceDesc.mask = instance.m_instanceMask;
+                instanceDesc.flags = instance.m_transparent ? VK_GEOMETRY_INSTANCE_FORCE_NO_OPAQUE_BIT_KHR : 0;
+
+                const bool instanceChanged = writeAllInstances || memcmp(&instanceDesc, &buffers.m_instanceDescs[i], sizeof(VkAccelerationStructureInstanceKHR)) != 0;
+                if (instanceChanged)
+                {
+                    buffers.m_instanceDescs[i] = instanceDesc;
+                    if (changedInstanceCount == 0)
+                    {
+                        firstChangedInstance = i;
+                    }
+                    ++changedInstanceCount;
+                }
+                else if (changedInstanceCount > 0)
+                {
+                    writeInstanceRange(firstChangedInstance, changedInstanceCount);
+                    changedInstanceCount = 0;
+                }
+            }
+
+            if (changedInstanceCount > 0)
+            {
+                writeInstanceRange(firstChangedInstance, changedInstanceCount);
+            }
+        }
     }
 }
@@ -17,6 +17,7 @@ namespace AZ
     namespace Vulkan
     {
         class Buffer;
+        class Device;
 
         //! This class builds and contains the Vulkan RayTracing TLAS buffers.
         class RayTracingTlas final
@@ -38,10 +39,16 @@ namespace AZ
                 VkAccelerationStructureBuildRangeInfoKHR m_offsetInfo = {};
                 VkAccelerationStructureBuildGeometryInfoKHR m_buildInfo = {};
                 uint32_t m_instanceCount = 0;
+
+                // copy of the instance data last written to the instances buffer, used to only rewrite changed instances
+                AZStd::vector<VkAccelerationStructureInstanceKHR> m_instanceDescs;
             };
 
             const TlasBuffers& GetBuffers() const { return m_buffers[m_currentBufferIndex]; }
 
+            //! Returns the buffers of the previous TLAS, which are the source of an update (refit) of the current TLAS
+            const TlasBuffers& GetUpdateSourceBuffers() const { return m_buffers[m_updateSourceBufferIndex]; }
+
             // RHI::RayTracingTlas overrides...
             const RHI::Ptr<RHI::Buffer> GetTlasBuffer() const override { return m_buffers[m_currentBufferIndex].m_tlasBuffer; }
             const RHI::Ptr<RHI::Buffer> GetTlasInstancesBuffer() const override { return m_buffers[m_currentBufferIndex].m_tlasInstancesBuffer; }
@@ -51,11 +58,19 @@ namespace AZ
 
             // RHI::RayTracingTlas overrides
             RHI::ResultCode CreateBuffersInternal(RHI::Device& deviceBase, const RHI::RayTracingTlasDescriptor* descriptor, const RHI::RayTracingBufferPools& rayTracingBufferPools) override;
+            RHI::ResultCode UpdateBuffersInternal(RHI::Device& deviceBase, const RHI::RayTracingTlasDescriptor* descriptor, const RHI::RayTracingBufferPools& rayTracingBufferPools) override;
+
+            //! Creates the TLAS buffers in the buffer set from the descriptor
+            RHI::ResultCode CreateTlasBuffers(Device& device, TlasBuffers& buffers, const RHI::RayTracingTlasDescriptor* descriptor, const RHI::RayTracingBufferPools& bufferPools);
+
+            //! Writes the instances that differ from the data last written to the instances buffer of the buffer set
+            void WriteInstances(Device& device, TlasBuffers& buffers, const RHI::RayTracingTlasInstanceVector& instances, const RHI::RayTracingBufferPools& bufferPools);
 
             // buffer list to keep buffers alive for several frames
             static const uint32_t BufferCount = 3;
             TlasBuffers m_buffers[BufferCount];
             uint32_t m_currentBufferIndex = 0;
+            uint32_t m_updateSourceBufferIndex = 0;
         };
     }
 }
@@ -213,6 +213,16 @@ namespace AZ
             m_signalSemaphores.push_back(semaphore);
         }
 
+        void Scope::AddWaitSemaphore(const Semaphore::WaitTimelineSemaphore& timelineSemaphoreInfo)
+        {
+            m_waitTimelineSemaphores.push_back(timelineSemaphoreInfo);
+        }
+
+        void Scope::AddSignalSemaphore(const Semaphore::TimelineValue& timelineValue)
+        {
+            m_signalTimelineSemaphores.push_back(timelineValue);
+        }
+
         void Scope::AddSignalFence(RHI::Ptr<Fence> fence)
         {
             m_signalFences.push_back(fence);
@@ -233,6 +243,16 @@ namespace AZ
             return m_waitSemaphores;
         }
 
+        const AZStd::vector<Semaphore::WaitTimelineSemaphore>& Scope::GetWaitTimelineSemaphores() const
+        {
+            return m_waitTimelineSemaphores;
+        }
+
+        const AZStd::vector<Semaphore::TimelineValue>& Scope::GetSignalTimelineSemaphores() const
+        {
+            return m_signalTimelineSemaphores;
+        }
+
         bool Scope::UsesRenderpass() const
         {
             return m_usesRenderpass;
@@ -285,6 +305,8 @@ namespace AZ
 
             m_waitSemaphores.clear();
             m_signalSemaphores.clear();
+            m_waitTimelineSemaphores.clear();
+            m_signalTimelineSemaphores.clear();
             m_signalFences.clear();
             for (size_t i = 0; i < BarrierSlotCount; ++i)
             {
@@ -97,10 +97,14 @@ namespace AZ
 
             void AddWaitSemaphore(const Semaphore::WaitSemaphore& semaphoreInfo);
             void AddSignalSemaphore(RHI::Ptr<Semaphore> semaphore);
+            void AddWaitSemaphore(const Semaphore::WaitTimelineSemaphore& timelineSemaphoreInfo);
+            void AddSignalSemaphore(const Semaphore::TimelineValue& timelineValue);
             void AddSignalFence(RHI::Ptr<Fence> fence);
 
             const AZStd::vector<Semaphore::WaitSemaphore>& GetWaitSemaphores() const;
             const AZStd::vector<RHI::Ptr<Semaphore>>& GetSignalSemaphores() const;
+            const AZStd::vector<Semaphore::WaitTimelineSemaphore>& GetWaitTimelineSemaphores() const;
+            const AZStd::vector<Semaphore::TimelineValue>& GetSignalTimelineSemaphores() const;
             const AZStd::vector<RHI::Ptr<Fence>>& GetSignalFences() const;
 
             //! Graphics scopes that draw items use a renderpass.
@@ -193,6 +197,8 @@ namespace AZ
 
             AZStd::vector<Semaphore::WaitSemaphore> m_waitSemaphores;
             AZStd::vector<RHI::Ptr<Semaphore>> m_signalSemaphores;
+            AZStd::vector<Semaphore::WaitTimelineSemaphore> m_waitTimelineSemaphores;
+            AZStd::vector<Semaphore::TimelineValue> m_signalTimelineSemaphores;
             AZStd::vector<RHI::Ptr<Fence>> m_signalFences;
             AZStd::vector<QueryPoolAttachment> m_queryPoolAttachments;
             bool m_usesRenderpass = false;
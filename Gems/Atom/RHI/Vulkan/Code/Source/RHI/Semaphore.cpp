@@ -19,13 +19,20 @@ namespace AZ
             return aznew Semaphore();
         }
 
-        RHI::ResultCode Semaphore::Init(Device& device)
+        RHI::ResultCode Semaphore::Init(Device& device, SemaphoreType type)
         {
             Base::Init(device);
+            m_type = type;
+
+            VkSemaphoreTypeCreateInfo typeCreateInfo{};
+            typeCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+            typeCreateInfo.pNext = nullptr;
+            typeCreateInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+            typeCreateInfo.initialValue = 0;
 
             VkSemaphoreCreateInfo createInfo{};
             createInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
-            createInfo.pNext = 0;
+            createInfo.pNext = type == SemaphoreType::Timeline ? &typeCreateInfo : nullptr;
             createInfo.flags = 0;
 
             const VkResult result =
@@ -68,6 +75,11 @@ namespace AZ
             return m_nativeSemaphore;
         }
 
+        SemaphoreType Semaphore::GetType() const
+        {
+            return m_type;
+        }
+
         void Semaphore::SetNameInternal(const AZStd::string_view& name)
         {
             if (IsInitialized() && !name.empty())
@@ -18,6 +18,15 @@ namespace AZ
     {
         class Device;
 
+        enum class SemaphoreType : uint32_t
+        {
+            //! Signaled and waited once per use.
+            Binary = 0,
+            //! Holds a monotonically increasing value. Any number of waits can wait for a value, and waits may be
+            //! submitted before the signal of the value.
+            Timeline
+        };
+
         class Semaphore final
             : public RHI::DeviceObject
         {
@@ -28,8 +37,16 @@ namespace AZ
 
             using WaitSemaphore = AZStd::pair<VkPipelineStageFlags, RHI::Ptr<Semaphore>>;
 
+            //! A value of a timeline semaphore to signal or wait for.
+            struct TimelineValue
+            {
+                RHI::Ptr<Semaphore> m_semaphore;
+                uint64_t m_value = 0;
+            };
+            using WaitTimelineSemaphore = AZStd::pair<VkPipelineStageFlags, TimelineValue>;
+
             static RHI::Ptr<Semaphore> Create();
-            RHI::ResultCode Init(Device& device);
+            RHI::ResultCode Init(Device& device, SemaphoreType type = SemaphoreType::Binary);
             ~Semaphore() = default;
 
             void SignalEvent();
@@ -38,6 +55,7 @@ namespace AZ
             void SetRecycleValue(bool canRecycle);
             bool GetRecycleValue() const;
             VkSemaphore GetNativeSemaphore() const;
+            SemaphoreType GetType() const;
 
         private:
             Semaphore() = default;
@@ -55,6 +73,7 @@ namespace AZ
             VkSemaphore m_nativeSemaphore = VK_NULL_HANDLE;
             AZ::Vulkan::SignalEvent m_signalEvent;
             bool m_recyclable = true;
+            SemaphoreType m_type = SemaphoreType::Binary;
         };
     }
 }
@@ -109,8 +109,23 @@ namespace AZ
             DescriptorSet& descriptorSet = *group.m_compiledData[group.GetCompileDataIndex()];
 
             const RHI::ShaderResourceGroupLayout* layout = groupData.GetLayout();
+            auto constantData = groupData.GetConstantData();
+
+            // Each descriptor set only needs the parts of the group modified since it was last written. Descriptor sets with
+            // unbounded arrays may be reallocated when committing the updates, so they are always written entirely.
+            RHI::ShaderResourceGroup::CompiledDataUpdate update = group.AcquireCompiledDataUpdate(group.GetCompileDataIndex());
+            if (m_descriptorSetLayout->GetHasUnboundedArray())
+            {
+                update.m_resourceTypeMask = AZ_BIT(static_cast<uint32_t>(RHI::ShaderResourceGroupData::ResourceType::Count)) - 1;
+                update.m_constantDataInterval = RHI::Interval(0, aznumeric_cast<uint32_t>(constantData.size()));
+            }
+            auto isModified = [&update](RHI::ShaderResourceGroupData::ResourceTypeMask mask)
+            {
+                return RHI::CheckBitsAny(update.m_resourceTypeMask, static_cast<uint32_t>(mask));
+            };
 
-            for (uint32_t groupIndex = 0; groupIndex < static_cast<uint32_t>(layout->GetShaderInputListForBuffers().size()); ++groupIndex)
+            for (uint32_t groupIndex = 0; isModified(RHI::ShaderResourceGroupData::ResourceTypeMask::BufferViewMask) &&
+                 groupIndex < static_cast<uint32_t>(layout->GetShaderInputListForBuffers().size()); ++groupIndex)
             {
                 const RHI::ShaderInputBufferIndex index(groupIndex);
                 auto bufViews = groupData.GetBufferViewArray(index);
@@ -119,7 +134,8 @@ namespace AZ
             }
             
             auto const& shaderImageList = layout->GetShaderInputListForImages();
-            for (uint32_t groupIndex = 0; groupIndex < static_cast<uint32_t>(shaderImageList.size()); ++groupIndex)
+            for (uint32_t groupIndex = 0; isModified(RHI::ShaderResourceGroupData::ResourceTypeMask::ImageViewMask) &&
+                 groupIndex < static_cast<uint32_t>(shaderImageList.size()); ++groupIndex)
             {
                 const RHI::ShaderInputImageIndex index(groupIndex);
                 auto imgViews = groupData.GetImageViewArray(index);
@@ -129,7 +145,8 @@ namespace AZ
             }
             
 
-            for (uint32_t groupIndex = 0; groupIndex < static_cast<uint32_t>(layout->GetShaderInputListForBufferUnboundedArrays().size()); ++groupIndex)
+            for (uint32_t groupIndex = 0; isModified(RHI::ShaderResourceGroupData::ResourceTypeMask::BufferViewUnboundedArrayMask) &&
+                 groupIndex < static_cast<uint32_t>(layout->GetShaderInputListForBufferUnboundedArrays().size()); ++groupIndex)
             {
                 const RHI::ShaderInputBufferUnboundedArrayIndex index(groupIndex);
                 auto bufViews = groupData.GetBufferViewUnboundedArray(index);
@@ -144,7 +161,8 @@ namespace AZ
             }
             
             auto const& shaderImageUnboundeArrayList = layout->GetShaderInputListForImageUnboundedArrays();
-            for (uint32_t groupIndex = 0; groupIndex < static_cast<uint32_t>(shaderImageUnboundeArrayList.size()); ++groupIndex)
+            for (uint32_t groupIndex = 0; isModified(RHI::ShaderResourceGroupData::ResourceTypeMask::ImageViewUnboundedArrayMask) &&
+                 groupIndex < static_cast<uint32_t>(shaderImageUnboundeArrayList.size()); ++groupIndex)
             {
                 const RHI::ShaderInputImageUnboundedArrayIndex index(groupIndex);
                 auto imgViews = groupData.GetImageViewUnboundedArray(index);
@@ -158,7 +176,8 @@ namespace AZ
                 descriptorSet.UpdateImageViews(layoutIndex, imgViews, shaderImageUnboundeArrayList[groupIndex].m_type);
             }
             
-            for (uint32_t groupIndex = 0; groupIndex < static_cast<uint32_t>(layout->GetShaderInputListForSamplers().size()); ++groupIndex)
+            for (uint32_t groupIndex = 0; isModified(RHI::ShaderResourceGroupData::ResourceTypeMask::SamplerMask) &&
+                 groupIndex < static_cast<uint32_t>(layout->GetShaderInputListForSamplers().size()); ++groupIndex)
             {
                 const RHI::ShaderInputSamplerIndex index(groupIndex);
                 auto samplerArray = groupData.GetSamplerArray(index);
@@ -167,10 +186,9 @@ namespace AZ
                 descriptorSet.UpdateSamplers(layoutIndex, samplerArray);
             }
 
-            auto constantData = groupData.GetConstantData();
-            if (!constantData.empty())
+            if (!constantData.empty() && isModified(RHI::ShaderResourceGroupData::ResourceTypeMask::ConstantDataMask))
             {
-                descriptorSet.UpdateConstantData(constantData);
+                descriptorSet.UpdateConstantData(constantData, update.m_constantDataInterval);
             }
             descriptorSet.CommitUpdates();
 
@@ -149,6 +149,15 @@ namespace AZ
                 return result;
             }
 
+            // The mips more detailed than the tail mip slices are bound per tile. Sparse mip tails can only be bound as a whole,
+            // so images whose sparse mip tail starts before the tail mip slices stream whole mips.
+            if (request.m_enableTileStreaming && image.IsSparse() && expectedResidentMipLevel > 0 &&
+                image.m_sparseImageInfo->m_tailStartMip >= expectedResidentMipLevel)
+            {
+                image.m_sparseImageInfo->InitTiledMips(expectedResidentMipLevel);
+                device.GetAsyncUploadQueue().QueueInitializeTiledMips(image, expectedResidentMipLevel);
+            }
+
             if (image.m_memoryView.IsValid())
             {
                 RHI::HeapMemoryLevel heapMemoryLevel = RHI::HeapMemoryLevel::Device;
@@ -164,8 +173,8 @@ namespace AZ
             uploadMipRequest.m_waitForUpload = true;
             device.GetAsyncUploadQueue().QueueUpload(uploadMipRequest, request.m_descriptor.m_mipLevels);
 
-            // update resident mip level
-            image.SetStreamedMipLevel(expectedResidentMipLevel);
+            // update resident mip level. The views of tile streamed images include the tiled mips.
+            image.SetStreamedMipLevel(image.IsTileStreamed() ? 0 : expectedResidentMipLevel);
 
             return RHI::ResultCode::Success;
         }
@@ -212,6 +221,61 @@ namespace AZ
             return result;
         }
 
+        RHI::ResultCode StreamingImagePool::GetImageTileLayoutInternal(const RHI::Image& imageBase, RHI::StreamingImageTileLayout& tileLayout) const
+        {
+            const auto& image = static_cast<const Image&>(imageBase);
+            tileLayout = {};
+            if (!image.IsTileStreamed())
+            {
+                return RHI::ResultCode::Success;
+            }
+
+            const SparseImageInfo& sparseInfo = *image.m_sparseImageInfo;
+            const VkExtent3D imageGranularity = sparseInfo.m_sparseImageMemoryRequirements.formatProperties.imageGranularity;
+            tileLayout.m_tileSize = RHI::Size(imageGranularity.width, imageGranularity.height, imageGranularity.depth);
+            tileLayout.m_tileSizeInBytes = aznumeric_cast<uint32_t>(sparseInfo.m_blockSizeInBytes);
+            tileLayout.m_tiledMipCount = sparseInfo.m_tiledMipCount;
+            for (uint16_t mip = 0; mip < sparseInfo.m_tiledMipCount; mip++)
+            {
+                tileLayout.m_mipTileCounts.push_back(sparseInfo.GetTileCount(mip));
+            }
+            return RHI::ResultCode::Success;
+        }
+
+        RHI::ResultCode StreamingImagePool::UpdateImageTilesInternal(const RHI::StreamingImageTileRequest& request)
+        {
+            auto& image = static_cast<Image&>(*request.m_image);
+            auto& device = static_cast<Device&>(GetDevice());
+
+            if (!image.IsTileStreamed())
+            {
+                return RHI::ResultCode::InvalidOperation;
+            }
+
+            // Tiles may be evicted and made resident again while their previous upload is in flight
+            WaitFinishUploading(image);
+
+            RHI::ResultCode result = image.UpdateTileMemory(*this, request.m_residentTiles, request.m_evictedTiles);
+            if (result != RHI::ResultCode::Success)
+            {
+                AZ_Warning("Vulkan:StreamingImagePool", false, "Failed to allocate memory for image tiles");
+                return result;
+            }
+
+            if (request.m_residentTiles.empty())
+            {
+                if (request.m_completeCallback)
+                {
+                    request.m_completeCallback();
+                }
+                return RHI::ResultCode::Success;
+            }
+
+            const VkExtent3D imageGranularity = image.m_sparseImageInfo->m_sparseImageMemoryRequirements.formatProperties.imageGranularity;
+            device.GetAsyncUploadQueue().QueueUpload(request, RHI::Size(imageGranularity.width, imageGranularity.height, imageGranularity.depth));
+            return RHI::ResultCode::Success;
+        }
+
         void StreamingImagePool::ShutdownInternal()
         {
         }
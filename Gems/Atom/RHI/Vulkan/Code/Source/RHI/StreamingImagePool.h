@@ -49,6 +49,8 @@ namespace AZ
             RHI::ResultCode InitImageInternal(const RHI::StreamingImageInitRequest& request) override;
             RHI::ResultCode ExpandImageInternal(const RHI::StreamingImageExpandRequest& request) override;
             RHI::ResultCode TrimImageInternal(RHI::Image& image, uint32_t targetMipLevel) override;
+            RHI::ResultCode GetImageTileLayoutInternal(const RHI::Image& image, RHI::StreamingImageTileLayout& tileLayout) const override;
+            RHI::ResultCode UpdateImageTilesInternal(const RHI::StreamingImageTileRequest& request) override;
             RHI::ResultCode SetMemoryBudgetInternal(size_t newBudget) override;
             bool SupportTiledImageInternal() const override;
             //////////////////////////////////////////////////////////////////////////
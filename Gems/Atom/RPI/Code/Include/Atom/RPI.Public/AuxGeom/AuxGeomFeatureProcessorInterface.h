@@ -9,8 +9,13 @@
 
 #include <AzCore/RTTI/RTTI.h>
 
+#include <AzCore/Math/Color.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/vector.h>
+
 #include <Atom/RPI.Public/Base.h>
 #include <Atom/RPI.Public/FeatureProcessor.h>
+#include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
 
 namespace AZ
 {
@@ -18,8 +23,6 @@ namespace AZ
     {
         // forward declares
         class Scene;
-        class AuxGeomDraw;
-        using AuxGeomDrawPtr = AZStd::shared_ptr<AuxGeomDraw>;
 
         //! Interface of AuxGeom system, which is used for drawing Auxiliary Geometry, both for debug and things like editor manipulators.
         class AuxGeomFeatureProcessorInterface
@@ -28,6 +31,34 @@ namespace AZ
         public:
             AZ_RTTI(AZ::RPI::AuxGeomFeatureProcessorInterface, "{2750EE44-5AE6-4379-BA3B-EDCD1507C997}", AZ::RPI::FeatureProcessor);
 
+            //! Identifies geometry added with AddPersistentGeometry.
+            using PersistentGeometryHandle = uint32_t;
+            static constexpr PersistentGeometryHandle InvalidPersistentGeometryHandle = 0;
+
+            enum class PersistentPrimitiveType : uint8_t
+            {
+                PointList,
+                LineList,
+                TriangleList
+            };
+
+            //! Describes geometry that is uploaded to the GPU once and drawn every frame until it's removed.
+            //! This suits debug geometry that rarely changes (navigation meshes, colliders, terrain debug views),
+            //! which would otherwise be rebuilt and uploaded through the immediate mode draw queue every frame.
+            struct PersistentGeometryDescriptor
+            {
+                PersistentPrimitiveType m_primitiveType = PersistentPrimitiveType::LineList;
+                AZStd::vector<AZ::Vector3> m_vertices;
+                AZStd::vector<AZ::Color> m_colors; //!< Either one color per vertex or a single color for all of them.
+                AZStd::vector<uint32_t> m_indices; //!< Indices into m_vertices, the vertices are drawn in order if empty.
+                //! The geometry is drawn once with each of these transforms applied, or once untransformed if empty.
+                AZStd::vector<AZ::Transform> m_instanceTransforms;
+                AuxGeomDraw::OpacityType m_opacityType = AuxGeomDraw::OpacityType::Opaque;
+                AuxGeomDraw::DepthTest m_depthTest = AuxGeomDraw::DepthTest::On;
+                AuxGeomDraw::DepthWrite m_depthWrite = AuxGeomDraw::DepthWrite::On;
+                AuxGeomDraw::FaceCullMode m_faceCullMode = AuxGeomDraw::FaceCullMode::Back;
+            };
+
             AuxGeomFeatureProcessorInterface() = default;
             virtual ~AuxGeomFeatureProcessorInterface() = default;
 
@@ -61,6 +92,16 @@ namespace AZ
 
             //! Feature processor releases the AuxGeomDrawQueue for the supplied view. DrawQueue is deleted when references fall to zero.
             virtual void ReleaseDrawQueueForView(const View* view) = 0;
+
+            //! Uploads the geometry and draws it in every view of the scene each frame until it's removed.
+            //! Returns InvalidPersistentGeometryHandle if the descriptor is invalid or the buffers couldn't be created.
+            virtual PersistentGeometryHandle AddPersistentGeometry(const PersistentGeometryDescriptor& descriptor) = 0;
+
+            //! Stops drawing the geometry and releases its buffers.
+            virtual void RemovePersistentGeometry(PersistentGeometryHandle handle) = 0;
+
+            //! Hides or shows the geometry without releasing its buffers.
+            virtual void SetPersistentGeometryVisible(PersistentGeometryHandle handle, bool visible) = 0;
         };
     } // namespace RPI
 } // namespace AZ
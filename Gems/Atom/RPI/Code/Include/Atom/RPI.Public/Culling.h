@@ -48,6 +48,7 @@ namespace AZ
 
     namespace RPI
     {
+        class Model;
         class Scene;
 
         struct Cullable
@@ -109,6 +110,11 @@ namespace AZ
                 float m_lodSelectionRadius = 1.0f;
 
                 LodConfiguration m_lodConfiguration;
+
+                //! Set for models streaming their lods (see ModelLodStreamingController). The selected lods are requested from
+                //! the model, and lods more detailed than m_mostDetailedResidentLod are replaced by it until they are resident.
+                Model* m_lodStreamingModel = nullptr;
+                uint32_t m_mostDetailedResidentLod = 0;
             };
             LodData m_lodData;
 
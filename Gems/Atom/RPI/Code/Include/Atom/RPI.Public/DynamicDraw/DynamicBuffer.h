@@ -32,7 +32,11 @@ namespace AZ
         //!         buffer->Write(data, size);
         //!         // Use the buffer view for DrawItem or etc.
         //!     }
-        //! Note: DynamicBuffer should only be used for DynamicInputAssembly buffer or Constant buffer (not supported yet).
+        //! DynamicBuffers acquired with DynamicDrawInterface::GetDynamicConstantBuffer hold per-draw constant data, which
+        //! shaders read from the raw view of the whole ring buffer at GetBufferOffset(), e.g.
+        //!     Bindless::GetByteAddressBuffer(bindlessReadIndex).Load4(offset)
+        //! so draws only need to receive the bindless read index and the offset (usually as root constants).
+        //! Note: DynamicBuffer should only be used for DynamicInputAssembly buffer or per-draw constant data.
         class DynamicBuffer
             : public AZStd::intrusive_base
         {
@@ -57,6 +61,13 @@ namespace AZ
             //! @param strideByteCount the byte count of the element
             RHI::StreamBufferView GetStreamBufferView(uint32_t strideByteCount);
 
+            //! Get the byte offset of this buffer within the ring buffer it was allocated from
+            uint32_t GetBufferOffset() const;
+
+            //! Get the bindless read index of the raw view of the ring buffer this buffer was allocated from,
+            //! or RHI::BufferView::InvalidBindlessIndex if it isn't available
+            uint32_t GetBindlessReadIndex() const;
+
         private:
             // Only DynamicBufferAllocator can allocate a DynamicBuffer
             DynamicBuffer() = default;
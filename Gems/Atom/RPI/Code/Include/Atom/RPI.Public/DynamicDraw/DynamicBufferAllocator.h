@@ -10,6 +10,7 @@
 
 #include <AtomCore/Instance/Instance.h>
 
+#include <Atom/RHI/BufferView.h>
 #include <Atom/RHI/IndexBufferView.h>
 #include <Atom/RHI/StreamBufferView.h>
 
@@ -29,6 +30,8 @@ namespace AZ
         //! Limitation: the allocation may fail if the request buffer size is larger than the ring buffer size or
         //!     there isn't enough unused memory available within the ring buffer. User may increase the input of Init(ringBufferSize)
         //!     to increase the ring buffer's size. 
+        //! The ring buffer is persistently mapped, so writing to a DynamicBuffer is a plain memory write. The whole ring can also
+        //! be read by shaders through a raw view, which allows per-draw data to be passed as offsets into a single buffer.
         class DynamicBufferAllocator
         {
         public:
@@ -39,7 +42,7 @@ namespace AZ
 
             //! One time initialization
             //! This operation may be slow since it will allocate large size gpu resource. 
-            void Init(uint32_t ringBufferSize);
+            void Init(uint32_t ringBufferSize, const char* bufferName = "DyanmicBufferRing");
 
             void Shutdown();
 
@@ -53,6 +56,12 @@ namespace AZ
             //! Get an StreamBufferView for a DynamicBuffer used as a vertex buffer
             RHI::StreamBufferView GetStreamBufferView(RHI::Ptr<DynamicBuffer> dynamicBuffer, uint32_t strideByteCount);
 
+            //! Get the byte offset of a DynamicBuffer within the ring buffer
+            uint32_t GetBufferOffset(const DynamicBuffer& dynamicBuffer) const;
+
+            //! Get the raw view of the whole ring buffer, or nullptr if it couldn't be created.
+            const RHI::Ptr<RHI::BufferView>& GetRingBufferView() const;
+
             //! Submit allocated dynamic buffer to gpu for current frame
             void FrameEnd();
 
@@ -60,9 +69,6 @@ namespace AZ
             void SetEnableAllocationWarning(bool enable);
 
         private:
-            // Get buffer's offset;
-            uint32_t GetBufferAddressOffset(RHI::Ptr<DynamicBuffer> dynamicBuffer);
-
             // The position where the buffer is available.
             uint32_t m_currentPosition = 0;
             // The upper bound limit of the allocation of current frame 
@@ -73,6 +79,7 @@ namespace AZ
             uint32_t m_ringBufferSize = 0;
             void* m_ringBufferStartAddress = 0;
             Data::Instance<Buffer> m_ringBuffer;
+            RHI::Ptr<RHI::BufferView> m_ringBufferView;
 
             // Allocation history which are in use by GPU. 
             uint32_t m_frameStartPositions[AZ::RHI::Limits::Device::FrameCountMax];
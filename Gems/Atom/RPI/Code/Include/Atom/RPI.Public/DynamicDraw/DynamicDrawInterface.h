@@ -56,6 +56,15 @@ namespace AZ
             //! The returned buffer will be invalidated every time the RPISystem's RenderTick is called
             virtual RHI::Ptr<DynamicBuffer> GetDynamicBuffer(uint32_t size, uint32_t alignment) = 0;
 
+            //! Get a DynamicBuffer for per-draw constant data, aligned to DynamicConstantDataAlignment.
+            //! The buffers are allocated from a separate ring so constants don't compete with geometry, and are written with
+            //! plain memory writes. See DynamicBuffer for how shaders read them.
+            //! The returned buffer will be invalidated every time the RPISystem's RenderTick is called
+            virtual RHI::Ptr<DynamicBuffer> GetDynamicConstantBuffer(uint32_t size) = 0;
+
+            //! Alignment of the buffers returned by GetDynamicConstantBuffer, so shaders can load them with Load4
+            static constexpr uint32_t DynamicConstantDataAlignment = 16;
+
             //! Draw a geometry to a scene with a given material
             virtual void DrawGeometry(Data::Instance<Material> material, const GeometryData& geometry, ScenePtr scene) = 0;
 
@@ -33,6 +33,7 @@ namespace AZ
             // DynamicDrawInterface overrides...
             RHI::Ptr<DynamicDrawContext> CreateDynamicDrawContext() override;
             RHI::Ptr<DynamicBuffer> GetDynamicBuffer(uint32_t size, uint32_t alignment) override;
+            RHI::Ptr<DynamicBuffer> GetDynamicConstantBuffer(uint32_t size) override;
             void DrawGeometry(Data::Instance<Material> material, const GeometryData& geometry, ScenePtr scene) override;
             void AddDrawPacket(Scene* scene, AZStd::unique_ptr<const RHI::DrawPacket> drawPacket) override;
             void AddDrawPacket(Scene* scene, ConstPtr<RHI::DrawPacket> drawPacket) override;
@@ -49,6 +50,9 @@ namespace AZ
             AZStd::mutex m_mutexBufferAlloc;
             AZStd::unique_ptr<DynamicBufferAllocator> m_bufferAlloc;
 
+            AZStd::mutex m_mutexConstantBufferAlloc;
+            AZStd::unique_ptr<DynamicBufferAllocator> m_constantBufferAlloc;
+
             AZStd::mutex m_mutexDrawContext;
             AZStd::list<RHI::Ptr<DynamicDrawContext>> m_dynamicDrawContexts;
 
@@ -22,6 +22,8 @@
 #include <AzCore/base.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Component/EntityId.h>
+#include <AzCore/Name/Name.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AZ
 {
@@ -74,6 +76,16 @@ namespace AZ
                 class CullingScene* m_cullingScene;
             };            
 
+            //! The shared scene data a feature processor reads and writes in Simulate() and Render(), such as
+            //! the data owned by another feature processor. The Scene runs feature processors whose accesses
+            //! conflict (a write with a read or a write of the same data) in the order they were added to the
+            //! scene, and runs all other feature processors concurrently.
+            struct SceneDataAccess
+            {
+                AZStd::vector<AZ::Name> m_reads;
+                AZStd::vector<AZ::Name> m_writes;
+            };
+
             AZ_RTTI(FeatureProcessor, "{B8027170-C65C-4237-964D-B557FC9D7575}");
             AZ_CLASS_ALLOCATOR(FeatureProcessor, AZ::SystemAllocator);
 
@@ -115,6 +127,12 @@ namespace AZ
             //!  - This may be called in parallel with other feature processors.
             virtual void Simulate(const SimulatePacket&) {}
 
+            //! Declares the shared scene data accessed by Simulate() and Render(), which the Scene uses to decide
+            //! which feature processors can run concurrently. Feature processors that don't declare any access are
+            //! assumed to only touch their own data.
+            //!  - This is called after the feature processor is activated, and when the feature processors of the scene change.
+            virtual void GetSceneDataAccess([[maybe_unused]] SceneDataAccess& access) const {}
+
             //! The feature processor should enqueue draw packets to relevant draw lists.
             //! 
             //!  - This is called every frame.
@@ -22,6 +22,7 @@
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
 #include <Atom/RPI.Public/Image/AttachmentImagePool.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
+#include <Atom/RPI.Public/Image/StreamingImageMipFeedback.h>
 #include <Atom/RPI.Public/Image/StreamingImagePool.h>
 
 #include <AtomCore/Instance/Instance.h>
@@ -51,6 +52,9 @@ namespace AZ
             //! performed during this call.
             void Update() override;
 
+            //! Adds the scopes reading back the GPU mip feedback of streaming images. Must be called after the passes added their scopes.
+            void FrameUpdate(RHI::FrameGraphBuilder& frameGraphBuilder);
+
             //////////////////////////////////////////////////////////////////////////
             // ImageSystemInterface
             const Data::Instance<Image>& GetSystemImage(SystemImage systemImage) const override;
@@ -81,6 +85,8 @@ namespace AZ
             AZStd::shared_mutex m_systemAttachmentImagesUpdateMutex;
             AZStd::unordered_map<RHI::Format, Data::Instance<AttachmentImage>> m_systemAttachmentImages;
 
+            StreamingImageMipFeedback m_mipFeedback;
+
             bool m_initialized = false;
 
             // a collections of registered attachment images
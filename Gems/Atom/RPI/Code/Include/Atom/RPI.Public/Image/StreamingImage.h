@@ -10,12 +10,18 @@
 
 #include <Atom/RPI.Reflect/Image/Image.h>
 #include <Atom/RPI.Public/Image/StreamingImageContext.h>
+#include <Atom/RPI.Public/Image/StreamingImageTiles.h>
 
 #include <Atom/RPI.Reflect/Image/StreamingImageAsset.h>
 
 // Enable streaming image hot reloading
 #define AZ_RPI_STREAMING_IMAGE_HOT_RELOADING
 
+namespace UnitTest
+{
+    class StreamingImageTests;
+}
+
 namespace AZ
 {
     namespace RPI
@@ -52,6 +58,7 @@ namespace AZ
             friend class ImageSystem;
             friend class StreamingImageController;
             friend class StreamingImageContext;
+            friend class UnitTest::StreamingImageTests;
         public:
             AZ_INSTANCE_DATA(StreamingImage, "{E48A7FF0-3065-42C6-9673-4FE7C8905629}", Image);
             AZ_CLASS_ALLOCATOR(StreamingImage, SystemAllocator);
@@ -132,6 +139,14 @@ namespace AZ
             //! For streamable image, its target mip should be resident. (The target mip can be affected by streaming image controller's mip bias)
             bool IsStreamed() const;
 
+            //! Returns whether the most detailed mips of the image are streamed per tile (see StreamingImageTiles).
+            //! Tile streamed images don't expand or evict their tiled mips as a whole, the controller streams their tiles instead.
+            bool IsTileStreamed() const;
+
+            //! Returns the tiles of a tile streamed image, or nullptr if the image isn't tile streamed.
+            //! Features sampling the image use it to bind the residency buffer and to apply their GPU feedback.
+            StreamingImageTiles* GetTiles();
+
         private:
             StreamingImage() = default;
 
@@ -164,6 +179,11 @@ namespace AZ
             // Uploads the mip chain content from the asset to the GPU
             RHI::ResultCode UploadMipChain(size_t mipChainIndex);
 
+            // Makes the requested tiles resident and evicts the unused ones, making at most maxUploadCount tiles resident.
+            // Loads the mip chains of the requested tiles and releases the ones without any tile in use.
+            // Returns the number of tiles queued for upload.
+            uint32_t UpdateTiles(uint32_t maxUploadCount);
+
             struct MipChainState
             {
                 static const uint16_t InvalidMipChain = (uint16_t)-1;
@@ -216,6 +236,9 @@ namespace AZ
 
             // The image's streaming priority
             Priority m_streamingPriority = 0; // value 0 means lowest priority
+
+            // The tiles of the tiled mips, only valid if the image is tile streamed.
+            AZStd::unique_ptr<StreamingImageTiles> m_tiles;
         };
     }
 }
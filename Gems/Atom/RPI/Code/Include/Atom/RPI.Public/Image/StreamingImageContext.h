@@ -73,6 +73,11 @@ namespace AZ
 
             // Tracks the last timestamp the image was requested.
             AZStd::atomic_size_t m_lastAccessTimestamp = {0};
+
+            // Tracks the last timestamp the image was sampled according to the GPU mip feedback (see StreamingImageMipFeedback).
+            // Images are only driven by the feedback once they were sampled by a shader writing it.
+            size_t m_lastSampledTimestamp = 0;
+            bool m_hasMipFeedback = false;
                         
             // The target mip level which applied global mip bias
             uint16_t m_mipLevelTargetAdjusted = 0;
@@ -113,6 +113,14 @@ namespace AZ
             // Reset the cached variables related to last memory value when the controller receives low memory notification
             void ResetLowMemoryState();
 
+            // Streams the tiles of the tile streamed images, within the per frame tile upload budget
+            void UpdateTileStreamedImages();
+
+            // Sets the target mips of the images from the GPU mip feedback when new feedback was read back.
+            // Setting the target also refreshes the access timestamp of the sampled images, which raises their expand priority
+            // and delays their eviction.
+            void ApplyMipFeedback();
+
         private:
 
             // Called when an image asset is being attached to the controller. The user is expected to return
@@ -163,6 +171,9 @@ namespace AZ
             // Once their expansion is finished, they would be removed from this list and added back to m_evictableImages or/and m_expandableImages list
             AZStd::unordered_set<StreamingImage*> m_expandingImages;
 
+            // The tile streamed images, which stream their tiles every update instead of being expanded or evicted.
+            AZStd::unordered_set<StreamingImage*> m_tileStreamedImages;
+
             // A monotonically increasing counter used to track image mip requests. Useful for sorting contexts by LRU.
             size_t m_timestamp = 0;
 
@@ -171,6 +182,9 @@ namespace AZ
 
             // a global option to add a bias to all the streaming images' target mip level
             int16_t m_globalMipBias = 0;
+
+            // The version of the last GPU mip feedback applied
+            uint32_t m_mipFeedbackVersion = 0;
         };
     }
 }
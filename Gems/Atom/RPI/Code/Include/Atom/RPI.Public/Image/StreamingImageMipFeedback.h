@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI/BufferView.h>
+#include <Atom/RHI/CopyItem.h>
+#include <Atom/RHI/Fence.h>
+#include <Atom/RHI/FrameGraphBuilder.h>
+#include <Atom/RHI/FrameGraphInterface.h>
+#include <Atom/RHI/ScopeProducer.h>
+#include <Atom/RHI.Reflect/Limits.h>
+
+#include <AtomCore/Instance/Instance.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class Buffer;
+
+        //! Records the mips of streaming images which are actually sampled on the GPU, to drive the StreamingImageController
+        //! instead of CPU estimates (see r_streamingImageMipFeedback).
+        //! Passes rendering streaming images write the feedback (see StreamingImageMipFeedbackPass): a buffer holding one uint per
+        //! bindless image read index, the most detailed mip sampled from the image this frame. The writers declare the buffer
+        //! as a shader write attachment, and the scopes copying it to a readback buffer and clearing it run after them. The
+        //! readback signals a fence, and is resolved into per image mip requests once the fence is signaled, without waiting on it.
+        class StreamingImageMipFeedback final
+        {
+        public:
+            AZ_RTTI(StreamingImageMipFeedback, "{8B5C4A8E-2F57-4F8C-9D3A-6E1A7C0B5D42}");
+            AZ_DISABLE_COPY_MOVE(StreamingImageMipFeedback);
+
+            //! The feedback value of images which weren't sampled.
+            static constexpr uint32_t NoMipSampled = 0xFFFFFFFF;
+
+            //! The mips requested by the last feedback resolved.
+            struct MipRequests
+            {
+                //! Incremented every time feedback is resolved.
+                uint32_t m_version = 0;
+
+                //! The most detailed mip sampled from each image, indexed by bindless image read index.
+                AZStd::vector<uint32_t> m_sampledMips;
+
+                //! Returns whether the feedback tracks the image with a bindless read index.
+                bool IsTracked(uint32_t bindlessReadIndex) const;
+
+                //! Returns the most detailed mip sampled from the image with a bindless read index, or NoMipSampled if the image
+                //! wasn't sampled or isn't tracked.
+                uint32_t GetSampledMip(uint32_t bindlessReadIndex) const;
+            };
+
+            //! Returns the feedback owned by the ImageSystem, or nullptr before the RPI is initialized.
+            static StreamingImageMipFeedback* Get();
+
+            //! Returns whether the GPU feedback is enabled.
+            static bool IsEnabled();
+
+            //! Returns the number of controller updates after which an image which stopped being sampled is trimmed to its last mip.
+            static uint32_t GetEvictionUpdateCount();
+
+            StreamingImageMipFeedback();
+            ~StreamingImageMipFeedback();
+
+            void Init();
+            void Shutdown();
+
+            //! Called by the passes writing the feedback while they add their scopes. The feedback buffer is only imported, read
+            //! back and cleared in frames with at least one writer.
+            void AddWriter();
+
+            //! Resolves the readbacks the GPU completed, then imports the feedback buffer and adds the scopes reading it back and
+            //! clearing it if a pass writes it this frame. Must be called after the passes added their scopes.
+            void FrameUpdate(RHI::FrameGraphBuilder& frameGraphBuilder);
+
+            //! Declares the feedback buffer as a shader write attachment of the calling scope.
+            //! Returns false, without declaring anything, if the buffer isn't part of the frame graph this frame.
+            bool UseShaderAttachment(RHI::FrameGraphInterface frameGraph) const;
+
+            //! Returns the bindless read write index of the feedback buffer for shaders, or RHI::InvalidIndex if the buffer isn't
+            //! part of the frame graph this frame.
+            uint32_t GetFeedbackBindlessIndex() const;
+
+            //! Resolves feedback read back from the GPU, one value per bindless image read index, into the mip requests.
+            void ResolveFeedback(AZStd::span<const uint32_t> sampledMips);
+
+            //! Returns the mips requested by the last feedback resolved. The requests are immutable, a new instance is created
+            //! every time feedback is resolved.
+            AZStd::shared_ptr<const MipRequests> GetMipRequests() const;
+
+        private:
+            bool CreateBuffers();
+            void ReleaseBuffers();
+
+            //! Resolves the readback buffers whose fence was signaled.
+            void ResolveCompletedReadbacks();
+
+            Data::Instance<Buffer> m_feedbackBuffer;
+            // Holds the cleared feedback values, copied over the feedback buffer after every readback.
+            Data::Instance<Buffer> m_clearBuffer;
+
+            struct Readback
+            {
+                Data::Instance<Buffer> m_buffer;
+                RHI::Ptr<RHI::Fence> m_fence;
+                bool m_isPending = false;
+            };
+            AZStd::array<Readback, RHI::Limits::Device::FrameCountMax> m_readbacks;
+            uint32_t m_readbackIndex = 0;
+
+            RHI::BufferViewDescriptor m_feedbackViewDescriptor;
+            RHI::Ptr<RHI::BufferView> m_feedbackBufferView;
+            uint32_t m_feedbackBindlessIndex = RHI::InvalidIndex;
+
+            AZStd::unique_ptr<RHI::ScopeProducer> m_readbackScopeProducer;
+            AZStd::unique_ptr<RHI::ScopeProducer> m_clearScopeProducer;
+            RHI::CopyBufferDescriptor m_readbackCopy;
+            RHI::CopyBufferDescriptor m_clearCopy;
+
+            // The number of passes writing the feedback this frame, and whether the feedback buffer is imported this frame.
+            AZStd::atomic_uint32_t m_writerCount = 0;
+            bool m_isImported = false;
+
+            // The controllers read the requests from their update, m_mipRequestsMutex only guards swapping them.
+            mutable AZStd::mutex m_mipRequestsMutex;
+            AZStd::shared_ptr<const MipRequests> m_mipRequests;
+
+            bool m_isInitialized = false;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RHI/BufferView.h>
+#include <Atom/RHI/StreamingImagePool.h>
+
+#include <AtomCore/Instance/Instance.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Name/Name.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class Buffer;
+
+        //! Tracks the tiles of the tile streamed mips of a StreamingImage (see r_streamingImageTileStreaming).
+        //! The tiles requested through GPU feedback (see ApplyFeedback), or from the target mip of the image while there's no
+        //! feedback (see RequestMipIfNoFeedback), are made resident by the StreamingImageController, at most
+        //! r_streamingImageTileUploadsPerFrame tiles per frame, less detailed mips first. Tiles which weren't requested for
+        //! r_streamingImageTileEvictionFrameCount frames are evicted. A tile is only made resident once the tile containing it in
+        //! the next less detailed mip is, so the resident tiles of any region form a contiguous mip range ending with the non tiled mips.
+        //!
+        //! The residency is published to shaders in a buffer read through its bindless index (see TileStreaming.azsli): a header
+        //! followed by one uint per tile of mip 0, holding the most detailed mip resident over the region of the tile. Shaders clamp
+        //! their sampling to that mip, and write the mip they wanted into a feedback buffer with the same layout as the residency
+        //! values, which the feature rendering the image reads back and passes to ApplyFeedback.
+        class StreamingImageTiles final
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(StreamingImageTiles, SystemAllocator);
+            AZ_DISABLE_COPY_MOVE(StreamingImageTiles);
+
+            //! The feedback value of tiles which weren't sampled.
+            static constexpr uint32_t NoMipRequested = 0xFFFFFFFF;
+
+            //! The size of the header of the residency buffer: the number of tiles of mip 0 in x and y, followed by the
+            //! factors (as floats) converting a uv coordinate to a tile coordinate of mip 0.
+            static constexpr uint32_t ResidencyHeaderSize = 16;
+
+            //! Returns whether an image should be initialized with tile streaming.
+            static bool IsTileStreamingRequested(const RHI::ImageDescriptor& imageDescriptor, const RHI::StreamingImagePool& pool);
+
+            //! Returns the maximum number of tiles the StreamingImageController makes resident per frame, over all images.
+            static uint32_t GetMaxUploadCountPerFrame();
+
+            //! The tiles to evict and make resident for the image, see CollectUpdate.
+            struct Update
+            {
+                AZStd::vector<RHI::StreamingImageTile> m_residentTiles;
+                AZStd::vector<RHI::StreamingImageTile> m_evictedTiles;
+
+                //! Identifies the upload of the resident tiles, see OnUploadComplete.
+                uint32_t m_uploadId = 0;
+
+                //! The tiled mips which have resident or requested tiles, one bit per mip. The CPU data of the other tiled mips may be released.
+                uint32_t m_mipsInUseMask = 0;
+            };
+
+            StreamingImageTiles(const RHI::StreamingImageTileLayout& tileLayout, const RHI::ImageDescriptor& imageDescriptor, const Name& imageName);
+            ~StreamingImageTiles();
+
+            uint32_t GetTiledMipCount() const;
+
+            //! Returns the number of tiles in each dimension of a tiled mip.
+            RHI::Size GetTileCount(uint32_t mipLevel) const;
+
+            //! Returns the bindless read index of the residency buffer, or RHI::InvalidIndex if it couldn't be created.
+            uint32_t GetResidencyBindlessReadIndex() const;
+
+            //! Requests tiles from GPU feedback: one value per tile of mip 0, holding the most detailed mip sampled over the region
+            //! of the tile (NoMipRequested if it wasn't sampled). May be called from any thread.
+            void ApplyFeedback(AZStd::span<const uint32_t> requestedMips);
+
+            //! Requests every tile of the given mip and of the less detailed tiled mips, unless GPU feedback was applied within the last
+            //! r_streamingImageTileEvictionFrameCount frames. The StreamingImageController calls it every frame with the target mip of
+            //! the image, so images sampled by shaders which don't write the feedback still stream their tiles.
+            void RequestMipIfNoFeedback(uint32_t mipLevel);
+
+            //! Called by the StreamingImageController once per frame. Collects the tiles to make resident and to evict, and updates
+            //! the residency buffer. The tiles to make resident are only picked among tiles whose mip data is ready.
+            //! @param maxUploadCount The maximum number of tiles to make resident.
+            //! @param isMipDataReady Returns whether the CPU data of a mip is loaded, it may start loading it.
+            void CollectUpdate(uint32_t maxUploadCount, const AZStd::function<bool(uint32_t mipLevel)>& isMipDataReady, Update& update);
+
+            //! Called when the tiles of an update are uploaded, or failed to be made resident. May be called from any thread.
+            void OnUploadComplete(uint32_t uploadId, bool succeeded);
+
+        private:
+            enum class TileState : uint8_t
+            {
+                NonResident,
+                Uploading,
+                Resident,
+                // Not sampled anymore, waiting for the frames in flight to complete before being evicted.
+                Evicting
+            };
+
+            struct Tile
+            {
+                uint64_t m_lastRequestedFrame = 0;
+                uint32_t m_uploadId = 0;
+                TileState m_state = TileState::NonResident;
+            };
+
+            Tile& GetTile(uint32_t mipLevel, uint32_t tileX, uint32_t tileY);
+            const Tile& GetTile(uint32_t mipLevel, uint32_t tileX, uint32_t tileY) const;
+
+            //! Returns whether the tiles of the next more detailed mip covering a tile are all non resident or being evicted.
+            bool CanEvictTile(uint32_t mipLevel, uint32_t tileX, uint32_t tileY) const;
+
+            bool IsRequested(const Tile& tile, uint64_t evictionFrameCount) const;
+
+            void UpdateResidencyBuffer();
+
+            RHI::StreamingImageTileLayout m_tileLayout;
+
+            // The tiles of all the tiled mips, mip by mip, row by row.
+            AZStd::vector<Tile> m_tiles;
+            AZStd::fixed_vector<uint32_t, RHI::Limits::Image::MipCountMax> m_mipTileOffsets;
+
+            // The header and per tile values of the residency buffer.
+            AZStd::vector<uint32_t> m_residencyData;
+            bool m_isResidencyDirty = true;
+
+            Data::Instance<Buffer> m_residencyBuffer;
+            RHI::Ptr<RHI::BufferView> m_residencyBufferView;
+            uint32_t m_residencyBindlessReadIndex = RHI::InvalidIndex;
+
+            // Tiles waiting for the frames which may sample them to complete, with the frame they stopped being sampled.
+            AZStd::deque<AZStd::pair<uint64_t, RHI::StreamingImageTile>> m_pendingEvictions;
+
+            // Protects the tiles from feedback applied on other threads, and the uploads completed on other threads.
+            AZStd::mutex m_mutex;
+            AZStd::vector<AZStd::pair<uint32_t, bool>> m_completedUploads;
+
+            uint64_t m_frameIndex = 1;
+            // The frame of the last ApplyFeedback, 0 if feedback was never applied.
+            uint64_t m_lastFeedbackFrame = 0;
+            uint32_t m_nextUploadId = 1;
+        };
+    } // namespace RPI
+} // namespace AZ
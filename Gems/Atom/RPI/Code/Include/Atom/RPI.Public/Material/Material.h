@@ -14,6 +14,8 @@
 #include <Atom/RPI.Reflect/Material/MaterialPipelineState.h>
 #include <Atom/RPI.Public/Shader/ShaderReloadNotificationBus.h>
 
+#include <Atom/RHI/Allocator.h>
+
 #include <AtomCore/Instance/InstanceData.h>
 
 namespace AZ
@@ -133,6 +135,14 @@ namespace AZ
 
             const RHI::ShaderResourceGroup* GetRHIShaderResourceGroup() const;
 
+            //! Returns the byte offset of the material's slot in the bindless material data buffer (see MaterialDataBuffer),
+            //! or RHI::InvalidIndex if the material isn't rendered in bindless mode (see r_bindlessMaterials).
+            uint32_t GetMaterialDataOffset() const;
+
+            //! Returns whether every shader of the material reads its data from the bindless material data buffer. Draws of
+            //! such materials don't bind the material ShaderResourceGroup, and the ShaderResourceGroup is never compiled.
+            bool UsesBindlessMaterialDataOnly() const;
+
             const Data::Asset<MaterialAsset>& GetAsset() const;
 
             //! Returns whether the material is ready to compile pending changes. (Materials can only be compiled once per frame because SRGs can only be compiled once per frame).
@@ -186,6 +196,14 @@ namespace AZ
             // version of the function when a private overload is present, just based on a lambda signature.
             void ForAllShaderItemsWriteable(AZStd::function<bool(ShaderCollection::Item& shaderItem)> callback);
 
+            //! Allocates the material's slot in the bindless material data buffer, when bindless materials are enabled.
+            void InitMaterialData();
+            void ReleaseMaterialData();
+
+            //! Copies the material SRG constants and image bindless indices to a new slot of the material, as frames in flight may
+            //! still read the previous one. Releases the material data and returns false if the buffer is out of space.
+            bool WriteMaterialData();
+
             static const char* s_debugTraceName;
 
             //! The corresponding material asset that provides material type data and initial property values.
@@ -212,6 +230,14 @@ namespace AZ
             //! Records the m_currentChangeId when the material was last compiled.
             ChangeId m_compiledChangeId = DEFAULT_CHANGE_ID;
 
+            //! The material's slot in the bindless material data buffer, null if the material isn't rendered in bindless mode.
+            RHI::VirtualAddress m_materialDataSlot;
+
+            //! Whether m_materialDataSlot was written, after which changes go to a new slot.
+            bool m_isMaterialDataSlotWritten = false;
+
+            bool m_usesBindlessMaterialDataOnly = false;
+
             bool m_isInitializing = false;
 
             MaterialPropertyPsoHandling m_psoHandling = MaterialPropertyPsoHandling::Warning;
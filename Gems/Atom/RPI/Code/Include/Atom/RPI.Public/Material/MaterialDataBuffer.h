@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI/FreeListAllocator.h>
+#include <Atom/RHI/BufferView.h>
+
+#include <AtomCore/Instance/Instance.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class Buffer;
+
+        //! A global GPU buffer holding the data of every material rendered in bindless mode (see r_bindlessMaterials).
+        //! Each material owns a slot in the buffer, which holds a small header, the material SRG constant data in its
+        //! cbuffer layout, and the bindless read indices of the material SRG images. Shaders read the slot through
+        //! Bindless::GetByteAddressBuffer() using the buffer's bindless index and the slot offset, which the draw items
+        //! receive as root constants, so draws don't need to bind a per-material ShaderResourceGroup.
+        //!
+        //! Slots are written on the CPU and the modified range is uploaded once per frame in FrameUpdate().
+        //! Released slots are only reused after RHI::Limits::Device::FrameCountMax frames, as in-flight frames may still read them.
+        //! Written slots must not be written again for the same reason, materials write their changes to a new slot instead.
+        class MaterialDataBuffer final
+        {
+        public:
+            AZ_RTTI(MaterialDataBuffer, "{602B89D4-9644-4A80-AD39-1FFDCA7F5C53}");
+            AZ_DISABLE_COPY_MOVE(MaterialDataBuffer);
+
+            //! The layout of the header at the start of each material slot.
+            struct SlotHeader
+            {
+                //! Byte offset, relative to the start of the slot, of the bindless image read indices.
+                uint32_t m_imageIndicesOffset = 0;
+                //! Number of image read indices.
+                uint32_t m_imageCount = 0;
+                uint32_t m_reserved[2] = {};
+            };
+
+            static constexpr size_t SlotAlignment = 16;
+
+            //! Root constants through which draw items receive the location of their material data, see BindlessMaterial.azsli.
+            static constexpr const char* BufferIndexRootConstantName = "m_rootConstantMaterialDataBufferIndex";
+            static constexpr const char* OffsetRootConstantName = "m_rootConstantMaterialDataOffset";
+
+            //! Returns the buffer owned by the MaterialSystem, or nullptr before the RPI is initialized.
+            static MaterialDataBuffer* Get();
+
+            MaterialDataBuffer() = default;
+            virtual ~MaterialDataBuffer();
+
+            void Init();
+            void Shutdown();
+
+            //! Returns whether bindless materials are supported by the device.
+            //! The GPU buffer is created the first time this returns true.
+            bool IsAvailable();
+
+            //! Allocates a slot able to hold the header, the constant data and the image indices.
+            //! Returns a null address if the buffer is full.
+            RHI::VirtualAddress AllocateSlot(uint32_t constantDataSize, uint32_t imageCount);
+
+            //! Releases a slot. Its memory is reused once the GPU can no longer read it.
+            void ReleaseSlot(RHI::VirtualAddress slot);
+
+            //! Writes a material slot. The slot must have been allocated with matching sizes.
+            void WriteSlot(RHI::VirtualAddress slot, AZStd::span<const uint8_t> constantData, AZStd::span<const uint32_t> imageIndices);
+
+            //! Returns the bindless read index of the raw view of the buffer.
+            uint32_t GetBindlessReadIndex() const;
+
+            //! Uploads slots written since the last frame, and recycles released slots.
+            void FrameUpdate();
+
+        private:
+            bool CreateBuffer();
+
+            static uint32_t GetSlotSize(uint32_t constantDataSize, uint32_t imageCount);
+
+            //! Materials are compiled from several threads.
+            AZStd::mutex m_mutex;
+
+            RHI::FreeListAllocator m_allocator;
+            Data::Instance<Buffer> m_buffer;
+            RHI::Ptr<RHI::BufferView> m_bufferView;
+            uint32_t m_bindlessReadIndex = RHI::InvalidIndex;
+
+            //! CPU copy of the buffer, uploaded over the dirty range each frame.
+            AZStd::vector<uint8_t> m_shadowData;
+            size_t m_dirtyBegin = 0;
+            size_t m_dirtyEnd = 0;
+
+            bool m_isInitialized = false;
+            bool m_isAvailable = false;
+            bool m_isBufferCreated = false;
+        };
+    } // namespace RPI
+} // namespace AZ
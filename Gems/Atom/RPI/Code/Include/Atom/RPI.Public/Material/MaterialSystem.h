@@ -8,6 +8,7 @@
 #pragma once
 
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
+#include <Atom/RPI.Public/Material/MaterialDataBuffer.h>
 
 namespace AZ
 {
@@ -24,6 +25,12 @@ namespace AZ
 
             void Init();
             void Shutdown();
+
+            //! Uploads the bindless material data modified during the frame.
+            void FrameUpdate();
+
+        private:
+            MaterialDataBuffer m_materialDataBuffer;
         };
 
     } // namespace RPI
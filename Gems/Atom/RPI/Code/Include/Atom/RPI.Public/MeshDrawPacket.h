@@ -133,6 +133,10 @@ namespace AZ
 
             //! A flag to indicate if the DrawPacket need to be rebuild when updating
             bool m_needUpdate = true;
+
+            //! The pipeline states compiled in the background while their draw items use a fallback pipeline state.
+            //! The DrawPacket is rebuilt once any of them has finished compiling.
+            AZStd::vector<RHI::ConstPtr<RHI::PipelineState>> m_compilingPipelineStates;
         };
         
         using MeshDrawPacketList = AZStd::vector<RPI::MeshDrawPacket>;
@@ -19,6 +19,7 @@
 
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/atomic.h>
 
 namespace AZ
 {
@@ -30,6 +31,7 @@ namespace AZ
             : public Data::InstanceData
         {
             friend class ModelSystem;
+            friend class ModelLodStreamingController;
 
         public:
             AZ_INSTANCE_DATA(Model, "{C30F5522-B381-4B38-BBAF-6E0B1885C8B9}");
@@ -37,11 +39,16 @@ namespace AZ
 
             static Data::Instance<Model> FindOrCreate(const Data::Asset<ModelAsset>& modelAsset);
 
+            //! Same as FindOrCreate(modelAsset), but the created model streams its lods when r_modelLodStreaming is enabled,
+            //! see ModelLodStreamingController. Only users which handle non-resident lods in GetLods() should allow it.
+            //! The allowLodStreaming parameter has no effect if the model already exists.
+            static Data::Instance<Model> FindOrCreate(const Data::Asset<ModelAsset>& modelAsset, bool allowLodStreaming);
+
             //! Orphan the model, its lods, and all their buffers so that they can be replaced in the instance database
             //! This is a temporary function, that will be removed once the Model/ModelAsset classes no longer need it
             static void TEMPOrphanFromDatabase(const Data::Asset<ModelAsset>& modelAsset);
 
-            ~Model() = default;
+            ~Model();
 
             //! Blocks the CPU until the streaming upload is complete. Returns immediately if no
             //! streaming upload is currently pending.
@@ -51,8 +58,24 @@ namespace AZ
             size_t GetLodCount() const;
 
             //! Returns the full list of Lods, where index 0 is the most detailed, and N-1 is the least.
+            //! If the model streams its lods, the lods more detailed than GetMostDetailedResidentLodIndex() are null.
             AZStd::span<const Data::Instance<ModelLod>> GetLods() const;
 
+            //! Returns whether the lods of this model are streamed in and out, see ModelLodStreamingController.
+            bool IsLodStreamingEnabled() const;
+
+            //! Returns the index of the most detailed lod which is resident. Always 0 if the model doesn't stream its lods.
+            //! Resident lods only change in ModelLodStreamingController::FrameUpdate().
+            ModelLodIndex GetMostDetailedResidentLodIndex() const;
+
+            //! Requests a lod to be resident, as it was selected for rendering. Requests must be made every frame the lod is needed,
+            //! or it will eventually be evicted. Can be called from any thread.
+            void RequestLod(ModelLodIndex lodIndex);
+
+            //! Makes every lod resident and stops streaming them, for users which need all the lods of a model which may
+            //! be shared with users allowing lod streaming. Must be called on the main thread, outside of rendering.
+            void MakeAllLodsResident();
+
             //! Returns whether a buffer upload is pending.
             bool IsUploadPending() const;
 
@@ -96,8 +119,10 @@ namespace AZ
         private:
             Model() = default;
 
-            static Data::Instance<Model> CreateInternal(const Data::Asset<ModelAsset>& modelAsset);
-            RHI::ResultCode Init(const Data::Asset<ModelAsset>& modelAsset);
+            static Data::Instance<Model> CreateInternal(const Data::Asset<ModelAsset>& modelAsset, const AZStd::any* allowLodStreaming);
+            RHI::ResultCode Init(const Data::Asset<ModelAsset>& modelAsset, bool allowLodStreaming);
+
+            void AddUvName(const RHI::ShaderSemantic& semantic, const AZ::Name& customName);
 
             AZStd::fixed_vector<Data::Instance<ModelLod>, ModelLodAsset::LodCountMax> m_lods;
             Data::Asset<ModelAsset> m_modelAsset;
@@ -106,6 +131,22 @@ namespace AZ
 
             // Tracks whether buffers have all been streamed up to the GPU.
             bool m_isUploadPending = false;
+
+            // Lod streaming state, managed by the ModelLodStreamingController.
+            static constexpr uint32_t NoLodRequested = ModelLodAsset::LodCountMax;
+            bool m_isLodStreamingEnabled = false;
+            uint32_t m_mostDetailedResidentLod = 0;
+            // Lods from this index are always resident.
+            uint32_t m_firstAlwaysResidentLod = 0;
+            // The most detailed lod requested since the last controller update.
+            AZStd::atomic<uint32_t> m_requestedLod = NoLodRequested;
+            // The last frame the most detailed resident lod was requested.
+            uint64_t m_lastUsedFrame = 0;
+            AZStd::fixed_vector<size_t, ModelLodAsset::LodCountMax> m_lodByteCounts;
+            // The lod being created on a worker thread, if any. The worker sets m_streamedLod then m_isStreamedLodReady.
+            uint32_t m_streamingLod = NoLodRequested;
+            Data::Instance<ModelLod> m_streamedLod;
+            AZStd::atomic_bool m_isStreamedLodReady = false;
         };
     } // namespace RPI
 } // namespace AZ
@@ -79,6 +79,11 @@ namespace AZ
                 
                 //! The default material assigned to the mesh by the asset.
                 Data::Instance<Material> m_material;
+
+                //! The meshlet clusters of the mesh generated by the model builder (see MeshletCluster.h), read as a structured
+                //! buffer by GPU cluster culling (see MeshletClusterCulling.azsli). Null if the model was built without them.
+                RHI::Ptr<RHI::BufferView> m_meshletClusterBufferView;
+                uint32_t m_meshletClusterCount = 0;
             };
 
             using StreamBufferViewList = AZStd::fixed_vector<RHI::StreamBufferView, RHI::Limits::Pipeline::StreamCountMax>;
@@ -133,6 +138,10 @@ namespace AZ
                 const ModelLodAsset::Mesh::StreamBufferInfo& streamBufferInfo,
                 Mesh& meshInstance);
 
+            bool SetMeshletClusterData(
+                const ModelLodAsset::Mesh::StreamBufferInfo& streamBufferInfo,
+                Mesh& meshInstance);
+
             StreamInfoList::const_iterator FindFirstUvStreamFromMesh(size_t meshIndex) const;
 
             StreamInfoList::const_iterator FindDefaultUvStream(size_t meshIndex, const MaterialUvNameMap& materialUvNameMap) const;
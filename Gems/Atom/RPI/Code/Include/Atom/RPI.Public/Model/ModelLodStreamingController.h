@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class Model;
+        class ModelLodAsset;
+
+        //! Streams the lods of models in and out of GPU memory, similar to what the StreamingImageController does for image mips.
+        //! When r_modelLodStreaming is enabled, models created with lod streaming allowed only keep their
+        //! r_modelLodStreamingResidentLodCount least detailed lods resident. More detailed lods are requested by the culling
+        //! system based on screen coverage (see Model::RequestLod), created on worker threads, and evicted once they haven't been
+        //! requested for r_modelLodStreamingEvictionFrameCount frames, or when the streamed lods exceed r_modelLodStreamingBudgetMB.
+        //! Lods are made resident in order, so the resident lods of a model are always a contiguous range ending with its last lod.
+        class ModelLodStreamingController final
+        {
+            friend class Model;
+
+        public:
+            AZ_RTTI(ModelLodStreamingController, "{3C1D3C36-5B57-4A21-A1B4-10F2C3B5E3C8}");
+            AZ_DISABLE_COPY_MOVE(ModelLodStreamingController);
+
+            //! Returns the controller owned by the ModelSystem, or nullptr before the RPI is initialized.
+            static ModelLodStreamingController* Get();
+
+            //! Returns whether models created from now on may stream their lods.
+            static bool IsLodStreamingEnabled();
+
+            //! Returns the index of the first lod which is always resident for a model with lodCount lods.
+            //! Returns 0 if every lod is always resident.
+            static uint32_t GetFirstAlwaysResidentLod(uint32_t lodCount);
+
+            //! Returns the size in bytes of the GPU buffers of a model lod.
+            static size_t GetLodByteCount(const ModelLodAsset& lodAsset);
+
+            ModelLodStreamingController() = default;
+            virtual ~ModelLodStreamingController() = default;
+
+            void Init();
+            void Shutdown();
+
+            //! Applies the lod requests of the last frame, makes the lods streamed in since resident and evicts unused lods.
+            //! Must be called on the main thread before the scenes are simulated.
+            void FrameUpdate();
+
+            //! Returns a counter incremented every time a lod of any model is made resident or evicted, so users of
+            //! Model::GetLods() can tell when to check the resident lods of their models again.
+            uint32_t GetResidencyChangeCount() const;
+
+            //! Returns the size in bytes of the lods currently streamed in, not including the lods which are always resident.
+            size_t GetStreamedByteCount() const;
+
+        private:
+            void RegisterModel(Model* model);
+            void UnregisterModel(Model* model);
+
+            //! Makes the most detailed resident lod of a model non-resident.
+            void EvictLod(Model& model);
+
+            //! Evicts the least recently used lod which wasn't requested this frame. Returns false if there isn't any.
+            bool EvictLeastRecentlyUsedLod(const Model* excludedModel);
+
+            //! Creates the lod more detailed than the most detailed resident lod of a model on a worker thread.
+            void StreamLod(Model& model);
+
+            static bool CanEvictLod(const Model& model);
+
+            AZStd::mutex m_mutex;
+            AZStd::vector<Model*> m_models;
+
+            size_t m_streamedByteCount = 0;
+            uint64_t m_frameIndex = 0;
+
+            AZStd::atomic<uint32_t> m_residencyChangeCount = 0;
+
+            //! Number of lods being created on worker threads.
+            AZStd::atomic<uint32_t> m_pendingLodCount = 0;
+
+            bool m_isInitialized = false;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
+#include <Atom/RPI.Public/Model/ModelLodStreamingController.h>
 
 namespace AZ
 {
@@ -24,6 +25,12 @@ namespace AZ
 
             void Init();
             void Shutdown();
+
+            //! Updates the streamed model lods, see ModelLodStreamingController.
+            void FrameUpdate();
+
+        private:
+            ModelLodStreamingController m_lodStreamingController;
         };
     } // namespace RPI
 } // namespace AZ
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI.Reflect/ShaderResourceGroupLayoutDescriptor.h>
+#include <Atom/RPI.Public/Pass/RasterPass.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! A raster pass whose draws record the mips they sample from streaming images into the GPU mip feedback
+        //! (see StreamingImageMipFeedback and StreamingImageMipFeedback.azsli).
+        //! While the feedback is enabled, the pass declares the feedback buffer as a shader write attachment of its scope, and
+        //! sets the bindless index of the buffer to the "m_streamingImageMipFeedbackIndex" constant of its pass srg, if the
+        //! srg has it. The constant holds RHI::InvalidIndex in frames without feedback.
+        class StreamingImageMipFeedbackPass final
+            : public RasterPass
+        {
+            AZ_RPI_PASS(StreamingImageMipFeedbackPass);
+
+        public:
+            AZ_RTTI(StreamingImageMipFeedbackPass, "{3C1F7B2E-9A4D-4E65-8B0C-5D2A6F9E1C47}", RasterPass);
+            AZ_CLASS_ALLOCATOR(StreamingImageMipFeedbackPass, SystemAllocator);
+            virtual ~StreamingImageMipFeedbackPass() = default;
+
+            //! Creates a StreamingImageMipFeedbackPass
+            static Ptr<StreamingImageMipFeedbackPass> Create(const PassDescriptor& descriptor);
+
+        private:
+            explicit StreamingImageMipFeedbackPass(const PassDescriptor& descriptor);
+
+            // Pass behavior overrides
+            void InitializeInternal() override;
+            void FrameBeginInternal(FramePrepareParams params) override;
+
+            // Scope producer functions...
+            void SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph) override;
+            void CompileResources(const RHI::FrameGraphCompileContext& context) override;
+
+            RHI::ShaderInputConstantIndex m_feedbackIndexInput;
+        };
+    }   // namespace RPI
+}   // namespace AZ
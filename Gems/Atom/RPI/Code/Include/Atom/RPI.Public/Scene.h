@@ -41,6 +41,11 @@ namespace AzFramework
     class IVisibilityScene;
 }
 
+namespace UnitTest
+{
+    class SceneTests;
+}
+
 namespace AZ
 {
     namespace RPI
@@ -59,6 +64,7 @@ namespace AZ
         {
             friend class FeatureProcessorFactory;
             friend class RPISystem;
+            friend class UnitTest::SceneTests;
         public:
             AZ_CLASS_ALLOCATOR(Scene, AZ::SystemAllocator);
             AZ_RTTI(Scene, "{29860D3E-D57E-41D9-8624-C39604EF2973}");
@@ -233,6 +239,9 @@ namespace AZ
             // This happens in UpdateSrgs()
             void PrepareSceneSrg();
 
+            // Rebuild the dependencies between feature processors from their declared scene data access
+            void UpdateFeatureProcessorDependencies();
+
             // Implementation functions that allow scene to switch between using Jobs or TaskGraphs
             void SimulateTaskGraph();
             void SimulateJobs();
@@ -246,6 +255,13 @@ namespace AZ
             // List of feature processors that are active for this scene
             AZStd::vector<FeatureProcessorPtr> m_featureProcessors;
 
+            // For each feature processor, the indices of the earlier feature processors it has to run after
+            AZStd::vector<AZStd::vector<uint32_t>> m_featureProcessorDependencies;
+            // Feature processors split into groups with no dependencies between groups, each group in the order the
+            // feature processors were added. Used by the job path, which runs each group in a single job.
+            AZStd::vector<AZStd::vector<FeatureProcessor*>> m_featureProcessorGroups;
+            bool m_featureProcessorDependenciesDirty = true;
+
             // List of pipelines of this scene. Each pipeline has an unique pipeline Id.
             AZStd::vector<RenderPipelinePtr> m_pipelines;
 
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI.Reflect/InputStreamLayout.h>
+#include <Atom/RHI.Reflect/RenderAttachmentLayout.h>
+#include <Atom/RHI.Reflect/RenderStates.h>
+#include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
+#include <Atom/RPI.Reflect/Shader/ShaderVariantKey.h>
+
+#include <AtomCore/Instance/Instance.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    class ReflectContext;
+
+    namespace RHI
+    {
+        class PipelineStateDescriptor;
+    }
+
+    namespace RPI
+    {
+        class Shader;
+
+        //! A pipeline state acquired from a Shader, with everything needed to acquire it again in a later session.
+        //! The render states, input stream layout and render attachment configuration are only used for draw pipeline states.
+        struct PipelineStateUsage
+        {
+            AZ_TYPE_INFO(PipelineStateUsage, "{BFA90AAE-B0A9-472A-90D3-2056AF08E1A7}");
+            static void Reflect(ReflectContext* context);
+
+            Data::AssetId m_shaderAssetId;
+            uint32_t m_supervariantIndex = 0;
+            ShaderVariantId m_shaderVariantId;
+            RHI::RenderStates m_renderStates;
+            RHI::InputStreamLayout m_inputStreamLayout;
+            RHI::RenderAttachmentConfiguration m_renderAttachmentConfiguration;
+        };
+
+        //! The pipeline states recorded by PipelineStateUsageRecorder, as saved to and loaded from file.
+        struct PipelineStateUsageList
+        {
+            AZ_TYPE_INFO(PipelineStateUsageList, "{1D9DCAD8-341A-4990-B872-246AD680F9D2}");
+            AZ_CLASS_ALLOCATOR(PipelineStateUsageList, SystemAllocator);
+            static void Reflect(ReflectContext* context);
+
+            AZStd::vector<PipelineStateUsage> m_pipelineStates;
+        };
+
+        //! A helper class used by ShaderSystem to record which pipeline states a project needs, and to compile them ahead of use.
+        //! While r_pipelineStateUsageRecording is enabled, every pipeline state acquired from a Shader is recorded, and the list is
+        //! saved to r_pipelineStateUsageFile on shutdown (or with r_savePipelineStateUsage). Lists recorded during QA playthroughs
+        //! are replayed with r_prewarmPipelineStates, or at startup through r_pipelineStatePrewarmFile, which compiles their
+        //! pipeline states on worker threads as soon as their shader variants are loaded. The compiled pipeline states land in the
+        //! shaders' pipeline libraries, so on platforms with driver caches later sessions start warm as well.
+        //! Prewarming doesn't depend on r_meshAsyncPipelineStateCompile: a synchronous acquire of a pipeline state that is still
+        //! being prewarmed compiles it on the calling thread, or waits for it, instead of returning it uncompiled.
+        class PipelineStateUsageRecorder final
+            : public AZ::TickBus::Handler
+        {
+        public:
+            PipelineStateUsageRecorder() = default;
+            ~PipelineStateUsageRecorder();
+
+            static void Reflect(ReflectContext* context);
+
+            void Init();
+            void Shutdown();
+
+            //! Returns whether pipeline states acquired from shaders should be recorded.
+            static bool IsRecording();
+
+            //! Records a pipeline state acquired from the shader. Pipeline states are only recorded once.
+            void RecordPipelineState(const Shader& shader, const RHI::PipelineStateDescriptor& descriptor);
+
+            //! Saves the pipeline states recorded so far. The path may contain file aliases.
+            bool SaveRecordedPipelineStates(const AZStd::string& filePath) const;
+
+            //! Queues the pipeline states of a recorded list for compilation. The list is loaded on the next tick,
+            //! so this can be called before the asset catalog is ready. The path may contain file aliases.
+            void Prewarm(const AZStd::string& filePath);
+
+        private:
+            // TickBus overrides...
+            void OnTick(float deltaTime, ScriptTimePoint time) override;
+
+            struct PendingPipelineState
+            {
+                PipelineStateUsage m_usage;
+                Data::Asset<ShaderAsset> m_shaderAsset;
+                uint32_t m_attemptCount = 0;
+            };
+
+            void LoadPrewarmList(const AZStd::string& filePath);
+
+            //! Acquires the pipeline state once its shader variant is loaded. Returns false if it should be retried on the next tick.
+            bool PrewarmPipelineState(PendingPipelineState& pendingPipelineState);
+
+            //! Pipeline states are acquired from many threads.
+            mutable AZStd::mutex m_recordMutex;
+            AZStd::unordered_set<HashValue64> m_recordedPipelineStateHashes;
+            PipelineStateUsageList m_recordedPipelineStates;
+
+            AZStd::vector<AZStd::string> m_queuedPrewarmFiles;
+            AZStd::vector<PendingPipelineState> m_pendingPipelineStates;
+
+            //! Keeps the prewarmed shaders, and so their pipeline libraries, resident until the pipeline states are needed.
+            AZStd::vector<Data::Instance<Shader>> m_prewarmedShaders;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -56,6 +56,7 @@ namespace AZ
             , public ShaderVariantFinderNotificationBus::Handler
         {
             friend class ShaderSystem;
+            friend class PipelineStateUsageRecorder;
         public:
             AZ_INSTANCE_DATA(Shader, "{232D8BD6-3BD4-4842-ABD2-F380BD5B0863}");
             AZ_CLASS_ALLOCATOR(Shader, SystemAllocator);
@@ -124,6 +125,14 @@ namespace AZ
             //! Acquires a pipeline state directly from a descriptor.
             const RHI::PipelineState* AcquirePipelineState(const RHI::PipelineStateDescriptor& descriptor) const;
 
+            //! Acquires a pipeline state directly from a descriptor without compiling it on the calling thread.
+            //! Returns the fallback pipeline state while the requested one is being compiled in the background.
+            //! See RHI::PipelineStateCache::AcquirePipelineStateAsync.
+            const RHI::PipelineState* AcquirePipelineStateAsync(
+                const RHI::PipelineStateDescriptor& descriptor,
+                const RHI::PipelineState* fallbackPipelineState,
+                RHI::ConstPtr<RHI::PipelineState>* compilingPipelineState = nullptr) const;
+
             //! Finds and returns the shader resource group asset with the requested name. Returns an empty handle if no matching group was found.
             const RHI::Ptr<RHI::ShaderResourceGroupLayout>& FindShaderResourceGroupLayout(const Name& shaderResourceGroupName) const;
 
@@ -173,6 +182,12 @@ namespace AZ
             
             const ShaderVariant& GetVariantInternal(ShaderVariantStableId shaderVariantStableId);
 
+            //! Finds the id of the variant the pipeline state descriptor was configured with, by matching its shader stage functions.
+            bool FindVariantIdForPipelineState(const RHI::PipelineStateDescriptor& descriptor, ShaderVariantId& shaderVariantId) const;
+
+            //! Records the pipeline state with the PipelineStateUsageRecorder if recording is enabled.
+            void RecordPipelineStateUsage(const RHI::PipelineStateDescriptor& descriptor) const;
+
             // AssetBus overrides...
             void OnAssetReloaded(Data::Asset<Data::AssetData> asset) override;
 
@@ -197,7 +212,7 @@ namespace AZ
             RHI::PipelineLibraryHandle m_pipelineLibraryHandle;
 
             //! Used for thread safety for FindVariantStableId() and GetVariant().
-            AZStd::shared_mutex m_variantCacheMutex;
+            mutable AZStd::shared_mutex m_variantCacheMutex;
 
             //! The root variant always exist.
             ShaderVariant m_rootVariant;
@@ -11,6 +11,7 @@
 #include <Atom/RHI.Reflect/Base.h>
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
+#include <Atom/RPI.Public/Shader/PipelineStateUsageRecorder.h>
 #include <Atom/RPI.Public/Shader/ShaderVariantAsyncLoader.h>
 
 
@@ -43,12 +44,15 @@ namespace AZ
             void Connect(GlobalShaderOptionUpdatedEvent::Handler& handler) override;
             void SetSupervariantName(const AZ::Name& supervariantName) override;
             const AZ::Name& GetSupervariantName() const override;
+            PipelineStateUsageRecorder& GetPipelineStateUsageRecorder() override;
+            ShaderVariantAsyncLoader& GetShaderVariantAsyncLoader() override;
             ///////////////////////////////////////////////////////////////////
 
         private:
             AZStd::unordered_map<Name, ShaderOptionValue> m_globalShaderOptionValues;
             GlobalShaderOptionUpdatedEvent m_globalShaderOptionUpdatedEvent;
             ShaderVariantAsyncLoader m_shaderVariantAsyncLoader;
+            PipelineStateUsageRecorder m_pipelineStateUsageRecorder;
 
             //! The ShaderSystem supervariantName is used by the ShaderAsset to search for an additional supervariant permutation.
             //! This is done by appending the supervariantName set here to the user-specified supervariant name.
@@ -16,6 +16,9 @@ namespace AZ
 {
     namespace RPI
     {
+        class PipelineStateUsageRecorder;
+        class ShaderVariantAsyncLoader;
+
         class ShaderSystemInterface
         {
         public:
@@ -49,6 +52,12 @@ namespace AZ
             //! Currently this is used for NoMSAA supervariant support.
             virtual void SetSupervariantName(const AZ::Name& supervariantName) = 0;
             virtual const AZ::Name& GetSupervariantName() const = 0;
+
+            //! Returns the recorder used to record and prewarm the pipeline states acquired from shaders.
+            virtual PipelineStateUsageRecorder& GetPipelineStateUsageRecorder() = 0;
+
+            //! Returns the loader that finds and streams in the shader variants requested by shaders.
+            virtual ShaderVariantAsyncLoader& GetShaderVariantAsyncLoader() = 0;
         };
 
     }   // namespace RPI
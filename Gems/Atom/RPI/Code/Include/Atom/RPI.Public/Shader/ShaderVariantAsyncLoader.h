@@ -13,6 +13,7 @@
 #include <Atom/RPI.Reflect/Shader/IShaderVariantFinder.h>
 
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/set.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/condition_variable.h>
@@ -27,6 +28,8 @@ namespace AZ
          * A helper class used by ShaderSystem to manage asynchronous loading of ShaderVariantTreeAssets
          * and ShaderVariantAssets.
          * The notifications of assets being loaded & ready are dispatched via ShaderVariantFinderNotificationBus.
+         * While r_shaderVariantMissRecording is enabled, requested variants that are not baked in the shader variant tree
+         * are recorded, and saved as .shadervariantlist files so they can be compiled by the Asset Processor for later sessions.
          */
         class ShaderVariantAsyncLoader final
             : public AZ::Interface<IShaderVariantFinder>::Registrar
@@ -74,6 +77,11 @@ namespace AZ
             void Reset() override;
             ///////////////////////////////////////////////////////////////////
 
+            //! Saves the variants recorded while r_shaderVariantMissRecording is enabled, as one .shadervariantlist file per shader.
+            //! The files are laid out like the product folders of the shaders, the same way as the ShaderVariants folder of a
+            //! project, so they can be merged into the project's lists. The path may contain file aliases.
+            bool SaveMissingShaderVariants(const AZStd::string& folderPath) const;
+
         private:
 
             ///////////////////////////////////////////////////////////////////////
@@ -101,6 +109,8 @@ namespace AZ
 
             bool TryToLoadShaderVariantAsset(const Data::AssetId& shaderVariantAssetId, const Data::AssetId& shaderVariantTreeAssetId);
 
+            //! Records the requested variant if the variant found in the tree leaves options dynamic that the request specifies.
+            void RecordShaderVariantMiss(const TupleShaderAssetAndShaderVariantId& request, const ShaderVariantSearchResult& searchResult);
 
             //! A thread that runs forever servicing shader variant and trees load requests.
             AZStd::thread m_serviceThread;
@@ -147,6 +157,10 @@ namespace AZ
             //! calls OnAssetReady(), OnAssetReloaded(), etc.
             AZStd::unordered_map<Data::AssetId, Data::AssetId> m_shaderVariantAssetIdToShaderVariantTreeAssetId;
 
+            //! Key: AssetId of a ShaderAsset; Value: the requested variants that were not baked.
+            //! Kept across Reset(), so a session records everything it missed. Ordered, so saved lists are stable across sessions.
+            mutable AZStd::mutex m_missedVariantsMutex;
+            AZStd::unordered_map<Data::AssetId, AZStd::set<ShaderVariantId>> m_missedVariants;
         };
 
 
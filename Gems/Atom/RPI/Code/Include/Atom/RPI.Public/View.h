@@ -55,7 +55,11 @@ namespace AZ
                 UsageCamera = (1u << 0),
                 UsageShadow = (1u << 1),
                 UsageReflectiveCubeMap = (1u << 2),
-                UsageXR = (1u << 3)
+                UsageXR = (1u << 3),
+                //! Shadow view that only draws static casters, used to fill a cached shadowmap.
+                UsageShadowStaticCasters = (1u << 4),
+                //! Shadow view that only draws dynamic casters, which are composited on top of a cached shadowmap.
+                UsageShadowDynamicCasters = (1u << 5)
             };
             //! Only use this function to create a new view object. And force using smart pointer to manage view's life time
             static ViewPtr CreateView(const AZ::Name& name, UsageFlags usage);
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ::RPI
+{
+    namespace MeshletClusterConstants
+    {
+        // Limits matching the common mesh shader output limits, so the same clusters can be used by mesh shaders and compute culling
+        constexpr uint32_t s_maxVertexCount = 64;
+        constexpr uint32_t s_maxTriangleCount = 124;
+
+        // The cone cutoff of clusters whose triangles face too many directions to ever be culled as backfacing
+        constexpr float s_coneCutoffDisabled = 1.0f;
+    }
+
+    //! A cluster of adjacent triangles of a mesh, with the bounds used to cull it on the GPU.
+    //! The clusters of a mesh are generated by the model builder and stored in a structured stream of the mesh (see ShaderSemanticName_MeshletClusters).
+    //! See MeshletClusterCulling.azsli for the corresponding shader struct
+    //! It is 16-byte aligned to work with structured buffers
+    struct MeshletCluster
+    {
+        // The first index of the cluster in the index buffer view of the mesh
+        uint32_t m_indexOffset = 0;
+        uint32_t m_triangleCount = 0;
+        // Explicit padding so the center starts on a 16 byte boundary
+        uint32_t m_pad[2] = {};
+
+        // The bounding sphere of the cluster, in model space
+        float m_center[3] = {};
+        float m_radius = 0.0f;
+
+        // The cone containing the normals of the triangles of the cluster. The cluster is backfacing for a camera if
+        //   dot(center - cameraPosition, coneAxis) >= coneCutoff * length(center - cameraPosition) + radius
+        float m_coneAxis[3] = {};
+        float m_coneCutoff = MeshletClusterConstants::s_coneCutoffDisabled;
+    };
+
+    //! Splits the triangles of a mesh into clusters of at most MeshletClusterConstants::s_maxVertexCount vertices and
+    //! s_maxTriangleCount triangles. Triangles are clustered in index order, so index buffers optimized for the vertex cache
+    //! produce compact clusters.
+    //! @param indices The triangle list of the mesh, indexing positions.
+    //! @param positions The 3 floats per vertex positions of the mesh.
+    AZStd::vector<MeshletCluster> BuildMeshletClusters(AZStd::span<const uint32_t> indices, AZStd::span<const float> positions);
+} // namespace AZ::RPI
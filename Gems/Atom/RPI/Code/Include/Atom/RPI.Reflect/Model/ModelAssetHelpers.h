@@ -45,6 +45,9 @@ namespace AZ
             static constexpr uint32_t ClothDataFloatsPerVert = 4;
             static const AZ::RHI::Format ClothDataFormat = AZ::RHI::Format::R32G32B32A32_FLOAT;
 
+            // Meshlet clusters, see MeshletCluster.h
+            static const char* ShaderSemanticName_MeshletClusters = "MESHLET_CLUSTERS";
+
             // We align all the skinned mesh related stream buffers to 192 bytes for various reasons.
             // Metal has a restriction where each typed buffer needs to start at 64 byte boundary.
             // At the same time a lot of our stream buffer views are RGB or RGBA so they need to be 12 and
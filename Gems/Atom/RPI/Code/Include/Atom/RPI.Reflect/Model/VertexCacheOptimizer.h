@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/span.h>
+
+namespace AZ::RPI
+{
+    namespace VertexCacheOptimizerConstants
+    {
+        // The size of the simulated post-transform vertex cache. Orders optimized for a larger cache than the GPU has
+        // degrade gracefully, unlike orders optimized for a smaller one.
+        constexpr uint32_t s_cacheSize = 32;
+    }
+
+    //! Reorders the triangles of a mesh so that triangles sharing vertices are drawn close together, which lets the GPU
+    //! reuse transformed vertices from its post-transform cache. This uses Tom Forsyth's linear-speed vertex cache optimization.
+    //! Only the order of the triangles changes, the winding of each triangle and the vertices are preserved.
+    //! @param indices The triangle list of the mesh, reordered in place.
+    //! @param vertexCount The number of vertices indexed by the mesh.
+    //! @return False, and the indices are left untouched, if an index is out of range.
+    bool OptimizeVertexCache(AZStd::span<uint32_t> indices, size_t vertexCount);
+
+    //! Returns the average number of vertices transformed per triangle with a FIFO cache of the given size.
+    //! 3 is the worst case, and well optimized meshes are typically below 1.
+    float CalculateAverageCacheMissRatio(AZStd::span<const uint32_t> indices, size_t vertexCount, uint32_t cacheSize = VertexCacheOptimizerConstants::s_cacheSize);
+} // namespace AZ::RPI
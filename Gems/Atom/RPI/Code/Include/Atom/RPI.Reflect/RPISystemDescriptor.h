@@ -23,6 +23,9 @@ namespace AZ
 
             //! The maxinum size of pool which is used to allocate dynamic buffers for dynamic draw system
             uint32_t m_dynamicBufferPoolSize = 3 * 16 * 1024 * 1024;
+
+            //! The maxinum size of pool which is used to allocate per-draw constant data for dynamic draw system
+            uint32_t m_dynamicConstantBufferPoolSize = 3 * 4 * 1024 * 1024;
         };
 
         struct RPISystemDescriptor final
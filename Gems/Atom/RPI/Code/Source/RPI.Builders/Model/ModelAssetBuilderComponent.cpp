@@ -21,6 +21,7 @@
 #include <Atom/RPI.Reflect/Buffer/BufferAssetCreator.h>
 #include <Atom/RPI.Reflect/Material/MaterialAsset.h>
 #include <Atom/RPI.Reflect/Model/ModelAssetCreator.h>
+#include <Atom/RPI.Reflect/Model/VertexCacheOptimizer.h>
 #include <Atom/RPI.Reflect/Model/ModelLodAssetCreator.h>
 #include <Atom/RPI.Reflect/Model/MorphTargetDelta.h>
 #include <Atom/RPI.Reflect/Model/SkinJointIdPadding.h>
@@ -48,6 +49,8 @@
 #include <SceneAPI/SceneCore/Containers/Utilities/Filters.h>
 
 static constexpr AZStd::string_view MismatchedVertexLayoutsAreErrorsKey{ "/O3DE/SceneAPI/ModelBuilder/MismatchedVertexLayoutsAreErrors" };
+static constexpr AZStd::string_view GenerateMeshletClustersKey{ "/O3DE/SceneAPI/ModelBuilder/GenerateMeshletClusters" };
+static constexpr AZStd::string_view OptimizeVertexCacheKey{ "/O3DE/SceneAPI/ModelBuilder/OptimizeVertexCache" };
  /**
   * DEBUG DEFINES!
   * These are useful for debugging bad behavior from the builder.
@@ -81,12 +84,32 @@ namespace AZ
             return mismatchedVertexStreamsAreErrors;
         }
 
+        static bool ShouldGenerateMeshletClusters()
+        {
+            bool generateMeshletClusters = false;
+            if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+            {
+                settingsRegistry->Get(generateMeshletClusters, GenerateMeshletClustersKey);
+            }
+            return generateMeshletClusters;
+        }
+
+        static bool ShouldOptimizeVertexCache()
+        {
+            bool optimizeVertexCache = true;
+            if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
+            {
+                settingsRegistry->Get(optimizeVertexCache, OptimizeVertexCacheKey);
+            }
+            return optimizeVertexCache;
+        }
+
         void ModelAssetBuilderComponent::Reflect(ReflectContext* context)
         {
             if (auto* serialize = azrtti_cast<SerializeContext*>(context))
             {
                 serialize->Class<ModelAssetBuilderComponent, SceneAPI::SceneCore::ExportingComponent>()
-                    ->Version(38);  // Pad Skinning mesh buffers to respect appropriate alignment
+                    ->Version(39);  // Reorder the triangles of meshes for the post-transform vertex cache
             }
         }
 
@@ -421,6 +444,10 @@ namespace AZ
                         lodMeshes = productMeshListOutcome.GetValue();
                     }
 
+                    // Before the clusters are generated, as they are built in index order and get more compact
+                    OptimizeVertexCache(lodMeshes);
+                    GenerateMeshletClusters(lodMeshes);
+
 #if defined(AZ_RPI_MESHES_SHARE_COMMON_BUFFERS)
                     // We shouldn't need a mesh name for the buffer names since meshed are sharing common buffers
                     m_meshName = "";
@@ -1095,6 +1122,43 @@ namespace AZ
             }
         }
 
+        void ModelAssetBuilderComponent::OptimizeVertexCache(ProductMeshContentList& productMeshList)
+        {
+            if (!ShouldOptimizeVertexCache())
+            {
+                return;
+            }
+
+            for (ProductMeshContent& mesh : productMeshList)
+            {
+                const size_t vertexCount = mesh.m_positions.size() / PositionFloatsPerVert;
+                if (!RPI::OptimizeVertexCache(mesh.m_indices, vertexCount))
+                {
+                    AZ_Warning(s_builderName, false, "Failed to optimize the vertex cache usage of mesh '%s', keeping its original triangle order.",
+                        mesh.m_name.GetCStr());
+                }
+            }
+        }
+
+        void ModelAssetBuilderComponent::GenerateMeshletClusters(ProductMeshContentList& productMeshList)
+        {
+            if (!ShouldGenerateMeshletClusters())
+            {
+                return;
+            }
+
+            for (ProductMeshContent& mesh : productMeshList)
+            {
+                // The bounds of the clusters are in model space, they don't hold for meshes deformed on the GPU
+                if (!mesh.m_skinJointIndices.empty() || !mesh.m_morphTargetVertexData.empty() || !mesh.m_clothData.empty())
+                {
+                    continue;
+                }
+
+                mesh.m_meshletClusters = BuildMeshletClusters(mesh.m_indices, mesh.m_positions);
+            }
+        }
+
         AZ::Outcome<ModelAssetBuilderComponent::ProductMeshContentList> ModelAssetBuilderComponent::MergeMeshesByMaterialUid(
             const ProductMeshContentList& productMeshList)
         {
@@ -1453,6 +1517,11 @@ namespace AZ
                 meshView.m_clothDataView = RHI::BufferViewDescriptor::CreateTyped(0, meshClothDataCount, ClothDataFormat);
             }
 
+            if (!mesh.m_meshletClusters.empty())
+            {
+                meshView.m_meshletClusterView = RHI::BufferViewDescriptor::CreateStructured(0, static_cast<uint32_t>(mesh.m_meshletClusters.size()), sizeof(MeshletCluster));
+            }
+
             meshView.m_materialUid = mesh.m_materialUid;
 
             return meshView;
@@ -1642,6 +1711,16 @@ namespace AZ
                     lodBufferInfo.m_morphTargetVertexDeltaCount += numNewVertexDeltas;
                 }
 
+                if (!mesh.m_meshletClusters.empty())
+                {
+                    const size_t numPrevClusters = lodBufferInfo.m_meshletClusterCount;
+                    const size_t numNewClusters = mesh.m_meshletClusters.size();
+
+                    meshView.m_meshletClusterView = RHI::BufferViewDescriptor::CreateStructured(/*elementOffset=*/ static_cast<uint32_t>(numPrevClusters), static_cast<uint32_t>(numNewClusters), sizeof(MeshletCluster));
+
+                    lodBufferInfo.m_meshletClusterCount += numNewClusters;
+                }
+
                 meshViews.emplace_back(AZStd::move(meshView));
                 isFirstMesh = false;
             }
@@ -1664,6 +1743,7 @@ namespace AZ
                 size_t tangentCount = 0;
                 size_t bitangentCount = 0;
                 size_t clothDataCount = 0;
+                size_t meshletClusterCount = 0;
                 AZStd::vector<size_t> uvSetCounts;
                 AZStd::vector<size_t> colorSetCounts;
 
@@ -1675,6 +1755,7 @@ namespace AZ
                     tangentCount += mesh.m_tangents.size();
                     bitangentCount += mesh.m_bitangents.size();
                     clothDataCount += mesh.m_clothData.size();
+                    meshletClusterCount += mesh.m_meshletClusters.size();
 
                     if (mesh.m_uvSets.size() > uvSetCounts.size())
                     {
@@ -1704,6 +1785,7 @@ namespace AZ
                 mergedMesh.m_tangents.reserve(tangentCount);
                 mergedMesh.m_bitangents.reserve(bitangentCount);
                 mergedMesh.m_clothData.reserve(clothDataCount);
+                mergedMesh.m_meshletClusters.reserve(meshletClusterCount);
 
                 mergedMesh.m_uvCustomNames.resize(uvSetCounts.size());
                 for (auto& mesh : productMeshList)
@@ -1779,6 +1861,17 @@ namespace AZ
                     tailIndex = largestIndex + 1;
                 }
 
+                if (!mesh.m_meshletClusters.empty())
+                {
+                    // The clusters of a remapped mesh index the merged indices, the preserved meshes keep their own index views
+                    const uint32_t clusterIndexOffset = indicesOp == RemapIndices ? static_cast<uint32_t>(mergedMesh.m_indices.size()) : 0;
+                    for (MeshletCluster cluster : mesh.m_meshletClusters)
+                    {
+                        cluster.m_indexOffset += clusterIndexOffset;
+                        mergedMesh.m_meshletClusters.push_back(cluster);
+                    }
+                }
+
                 mergedMesh.m_indices.insert(
                     mergedMesh.m_indices.end(), indices.begin(), indices.end());
 
@@ -2047,6 +2140,15 @@ namespace AZ
                     return false;
                 }
             }
+
+            const AZStd::vector<MeshletCluster>& meshletClusters = lodBufferContent.m_meshletClusters;
+            if (!meshletClusters.empty())
+            {
+                if (!BuildStructuredStreamBuffer<MeshletCluster>(outStreamBuffers, meshletClusters, RHI::ShaderSemantic{ ShaderSemanticName_MeshletClusters }))
+                {
+                    return false;
+                }
+            }
             
             lodAssetCreator.SetLodIndexBuffer(outIndexBuffer.GetBufferAsset());
 
@@ -2196,6 +2298,15 @@ namespace AZ
                 }
             }
 
+            // Set meshlet cluster buffer
+            if (meshView.m_meshletClusterView.m_elementCount > 0)
+            {
+                if (!SetMeshStreamBufferById(RHI::ShaderSemantic{ ShaderSemanticName_MeshletClusters }, AZ::Name(), meshView.m_meshletClusterView, lodStreamBuffers, lodAssetCreator))
+                {
+                    return false;
+                }
+            }
+
             lodAssetCreator.EndMesh();
 
             return true;
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <Atom/RPI.Reflect/Base.h>
+#include <Atom/RPI.Reflect/Model/MeshletCluster.h>
 #include <Atom/RPI.Reflect/Model/MorphTargetMetaAssetCreator.h>
 
 #include <SceneAPI/SceneCore/Components/ExportingComponent.h>
@@ -120,6 +121,9 @@ namespace AZ
                 // Morph targets
                 AZStd::vector<RPI::PackedCompressedMorphTargetDelta> m_morphTargetVertexData;
 
+                //! Clusters of the triangles of the mesh, see GenerateMeshletClusters.
+                AZStd::vector<RPI::MeshletCluster> m_meshletClusters;
+
                 MaterialUid m_materialUid;
                 uint32_t m_influencesPerVertex = 0;
                 size_t m_vertexCount = 0;
@@ -159,6 +163,7 @@ namespace AZ
                 size_t m_jointIdsCount = 0;
                 size_t m_jointWeightsCount = 0;
                 size_t m_morphTargetVertexDeltaCount = 0;
+                size_t m_meshletClusterCount = 0;
             };
 
             //! Describes a view into data described in a ProductMeshContent structure.
@@ -187,6 +192,8 @@ namespace AZ
 
                 RHI::BufferViewDescriptor m_clothDataView;
 
+                RHI::BufferViewDescriptor m_meshletClusterView;
+
                 MaterialUid m_materialUid;
             };
             using ProductMeshViewList = AZStd::vector<ProductMeshView>;
@@ -212,6 +219,14 @@ namespace AZ
             //! Each vertex stream that is modified by skinning is the same length
             void PadVerticesForSkinning(ProductMeshContentList& productMeshList);
 
+            //! Reorders the triangles of each mesh for the post-transform vertex cache, unless disabled in the settings registry
+            //! (see OptimizeVertexCacheKey). The vertices, and so the skinning and morph target data, are left as they are.
+            void OptimizeVertexCache(ProductMeshContentList& productMeshList);
+
+            //! Splits the triangles of each mesh into meshlet clusters for GPU cluster culling, when enabled in the settings registry
+            //! (see GenerateMeshletClustersKey). The index offsets of the clusters are relative to the indices of their mesh.
+            void GenerateMeshletClusters(ProductMeshContentList& productMeshList);
+
             //! Takes in a ProductMeshContentList and merges all elements that share the same MaterialUid.
             AZ::Outcome<ModelAssetBuilderComponent::ProductMeshContentList> MergeMeshesByMaterialUid(
                 const ProductMeshContentList& productMeshList);
@@ -9,6 +9,7 @@
 #include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
 #include <Atom/RPI.Public/AuxGeom/AuxGeomFeatureProcessorInterface.h>
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Model/Model.h>
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
@@ -53,6 +54,9 @@ namespace AZ
         // Node work lists using node count
         AZ_CVAR(uint32_t, r_numNodesPerCullingJob, 25, nullptr, AZ::ConsoleFunctorFlags::Null, "Controls amount of nodes to collect for jobs when not using the entry count");
 
+        // Occlusion culling of octree nodes
+        AZ_CVAR(bool, r_useNodeOcclusionCulling, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Test the bounds of each octree node against the occlusion buffer during enumeration, and skip all entries of occluded nodes");
+
         // This value dictates the amount to extrude the octree node OBB when doing a frustum intersection test against the camera frustum to help cut draw calls for shadow cascade passes.
         // Default is set to -1 as this is optimization needs to be triggered by the content developer by setting a reasonable non-negative value applicable for their content. 
         AZ_CVAR(int, r_shadowCascadeExtrusionAmount, -1, nullptr, AZ::ConsoleFunctorFlags::Null, "The amount of meters to extrude the Obb towards light direction when doing frustum overlap test against camera frustum");
@@ -216,6 +220,7 @@ namespace AZ
             AZ::TaskGraphEvent* m_taskGraphEvent = nullptr;
             bool m_hasExcludeFrustum = false;
             bool m_applyCameraFrustumIntersectionTest = false;
+            bool m_testNodeOcclusion = false;
 #ifdef AZ_CULL_DEBUG_ENABLED
 
             AuxGeomDrawPtr GetAuxGeomPtr()
@@ -268,8 +273,7 @@ namespace AZ
             AZStd::vector<AzFramework::VisibilityEntry*> m_entries;
         };
 
-        static bool TestOcclusionCulling(
-            const AZStd::shared_ptr<WorklistData>& worklistData, const AzFramework::VisibilityEntry* visibleEntry);
+        static bool TestOcclusionCulling(const AZStd::shared_ptr<WorklistData>& worklistData, const Aabb& boundingVolume);
 
         static void ProcessEntrylist(
             const AZStd::shared_ptr<WorklistData>& worklistData,
@@ -318,7 +322,7 @@ namespace AZ
                         continue;
                     }
 
-                    if (TestOcclusionCulling(worklistData, visibleEntry))
+                    if (TestOcclusionCulling(worklistData, visibleEntry->m_boundingVolume))
                     {
                         // There are ways to write this without [[maybe_unused]], but they are brittle.
                         // For example, using #else could cause a bug where the function's parameter
@@ -467,14 +471,13 @@ namespace AZ
             }
         }
 
-        static bool TestOcclusionCulling(
-            const AZStd::shared_ptr<WorklistData>& worklistData, const AzFramework::VisibilityEntry* visibleEntry)
+        static bool TestOcclusionCulling(const AZStd::shared_ptr<WorklistData>& worklistData, const Aabb& boundingVolume)
         {
 #ifdef AZ_CULL_PROFILE_VERBOSE
             AZ_PROFILE_SCOPE(RPI, "TestOcclusionCulling");
 #endif
 
-            if (visibleEntry->m_boundingVolume.Contains(worklistData->m_view->GetCameraTransform().GetTranslation()))
+            if (boundingVolume.Contains(worklistData->m_view->GetCameraTransform().GetTranslation()))
             {
                 // camera is inside bounding volume
                 return true;
@@ -489,7 +492,7 @@ namespace AZ
                     worklistData->m_sceneEntityContextId,
                     &AzFramework::OcclusionRequestBus::Events::IsAabbVisibleInOcclusionView,
                     worklistData->m_view->GetName(),
-                    visibleEntry->m_boundingVolume);
+                    boundingVolume);
 
                 // Return immediately to bypass MaskedOcclusionCulling
                 return result;
@@ -502,8 +505,8 @@ namespace AZ
                 return true;
             }
 
-            const Vector3& minBound = visibleEntry->m_boundingVolume.GetMin();
-            const Vector3& maxBound = visibleEntry->m_boundingVolume.GetMax();
+            const Vector3& minBound = boundingVolume.GetMin();
+            const Vector3& maxBound = boundingVolume.GetMax();
 
             // compute bounding volume corners
             Vector4 corners[8];
@@ -661,6 +664,8 @@ namespace AZ
             AZStd::shared_ptr<WorkListType> worklist = AZStd::make_shared<WorkListType>();
             worklist->Init();
             AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, scene, view, frustum, parentJob, taskGraphEvent);
+            worklistData->m_testNodeOcclusion =
+                r_useNodeOcclusionCulling && (!worklistData->m_sceneEntityContextId.IsNull() || !m_occlusionPlanes.empty());
             static const AZ::TaskDescriptor descriptor{ "AZ::RPI::ProcessWorklist", "Graphics" };
 
             if (const Matrix4x4* worldToClipExclude = view.GetWorldToClipExcludeMatrix())
@@ -712,6 +717,13 @@ namespace AZ
                     }
                 }
 
+                // Reject the whole node, and with it all of its entries, when its bounds are hidden behind the occluders of the view.
+                // The occlusion buffer is fully rasterized before enumeration starts, so the node test doesn't have to wait for jobs.
+                if (worklistData->m_testNodeOcclusion && !TestOcclusionCulling(worklistData, nodeData.m_bounds))
+                {
+                    return;
+                }
+
                 auto entriesInNode = nodeData.m_entries.size();
                 AZ_Assert(entriesInNode > 0, "should not get called with 0 entries");
 
@@ -808,6 +820,8 @@ namespace AZ
             AZStd::shared_ptr<EntryListType> entryList = AZStd::make_shared<EntryListType>();
             entryList->m_entries.reserve(r_numEntriesPerCullingJob);
             AZStd::shared_ptr<WorklistData> worklistData = MakeWorklistData(m_debugCtx, scene, view, frustum, parentJob, nullptr);
+            worklistData->m_testNodeOcclusion =
+                r_useNodeOcclusionCulling && (!worklistData->m_sceneEntityContextId.IsNull() || !m_occlusionPlanes.empty());
 
             if (const Matrix4x4* worldToClipExclude = view.GetWorldToClipExcludeMatrix())
             {
@@ -820,6 +834,11 @@ namespace AZ
                 AZ_Assert(nodeData.m_entries.size() > 0, "should not get called with 0 entries");
                 AZ_Assert(entryList->m_entries.size() < entryList->m_entries.capacity(), "we should always have room to push a node on the queue");
 
+                if (worklistData->m_testNodeOcclusion && !TestOcclusionCulling(worklistData, nodeData.m_bounds))
+                {
+                    return;
+                }
+
                 u32 remainingCount = u32(nodeData.m_entries.size());
                 u32 current = 0;
                 while (remainingCount > 0)
@@ -921,13 +940,24 @@ namespace AZ
                 }
             };
 
+            // Requests a lod from a model streaming its lods, and returns the most detailed resident lod to use instead
+            auto requestStreamingLod = [&lodData](uint32_t lodIndex)
+            {
+                if (lodData.m_lodStreamingModel)
+                {
+                    lodData.m_lodStreamingModel->RequestLod(ModelLodIndex(lodIndex));
+                    return AZStd::max(lodIndex, lodData.m_mostDetailedResidentLod);
+                }
+                return lodIndex;
+            };
+
             switch (lodData.m_lodConfiguration.m_lodType)
             {
                 case Cullable::LodType::SpecificLod:
                     if (lodData.m_lodConfiguration.m_lodOverride < lodData.m_lods.size())
                     {
                     addLodToDrawPacket(
-                        lodData.m_lods.at(lodData.m_lodConfiguration.m_lodOverride));
+                        lodData.m_lods.at(requestStreamingLod(lodData.m_lodConfiguration.m_lodOverride)));
                     }
                     break;
                 case Cullable::LodType::ScreenCoverage:
@@ -943,13 +973,27 @@ namespace AZ
                     const float approxScreenPercentage =
                         ModelLodUtils::ApproxScreenPercentage(pos, lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
 
+                    bool isResidentLodAdded = false;
                     for (uint32_t lodIndex = 0; lodIndex < static_cast<uint32_t>(lodData.m_lods.size()); ++lodIndex)
                     {
                         const Cullable::LodData::Lod& lod = lodData.m_lods[lodIndex];
                         // Note that this supports overlapping lod ranges (to support cross-fading lods, for example)
                         if (approxScreenPercentage >= lod.m_screenCoverageMin && approxScreenPercentage <= lod.m_screenCoverageMax)
                         {
-                            addLodToDrawPacket(lod);
+                            const uint32_t residentLodIndex = requestStreamingLod(lodIndex);
+                            if (lodData.m_lodStreamingModel && residentLodIndex == lodData.m_mostDetailedResidentLod)
+                            {
+                                // Several lods may be replaced by the most detailed resident lod, only add it once
+                                if (!isResidentLodAdded)
+                                {
+                                    isResidentLodAdded = true;
+                                    addLodToDrawPacket(lodData.m_lods[residentLodIndex]);
+                                }
+                            }
+                            else
+                            {
+                                addLodToDrawPacket(lod);
+                            }
                         }
                     }
                     break;
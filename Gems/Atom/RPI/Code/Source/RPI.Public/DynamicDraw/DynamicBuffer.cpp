@@ -44,6 +44,17 @@ namespace AZ
             return m_allocator->GetStreamBufferView(this, strideByteCount);
         }
 
+        uint32_t DynamicBuffer::GetBufferOffset() const
+        {
+            return m_allocator->GetBufferOffset(*this);
+        }
+
+        uint32_t DynamicBuffer::GetBindlessReadIndex() const
+        {
+            const RHI::Ptr<RHI::BufferView>& ringBufferView = m_allocator->GetRingBufferView();
+            return ringBufferView ? ringBufferView->GetBindlessReadIndex() : RHI::BufferView::InvalidBindlessIndex;
+        }
+
         void DynamicBuffer::Initialize(void* address, uint32_t size)
         {
             m_address = address;
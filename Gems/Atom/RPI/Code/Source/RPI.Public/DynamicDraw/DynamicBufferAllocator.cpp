@@ -15,7 +15,7 @@ namespace AZ
 {
     namespace RPI
     {
-        void DynamicBufferAllocator::Init(uint32_t ringBufferSize)
+        void DynamicBufferAllocator::Init(uint32_t ringBufferSize, const char* bufferName)
         {
             if (m_ringBuffer)
             {
@@ -26,7 +26,7 @@ namespace AZ
             // Create the ring buffer from common pool
             RPI::CommonBufferDescriptor desc;
             desc.m_poolType = RPI::CommonBufferPoolType::DynamicInputAssembly;
-            desc.m_bufferName = "DyanmicBufferRing";
+            desc.m_bufferName = bufferName;
             desc.m_elementSize = 1;
             desc.m_byteCount = ringBufferSize;
             m_ringBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
@@ -39,6 +39,12 @@ namespace AZ
             
             m_ringBufferSize = ringBufferSize;
             m_ringBufferStartAddress = m_ringBuffer->Map(m_ringBufferSize, 0);
+
+            // Raw views require a size aligned to 4 bytes
+            if (m_ringBufferSize % sizeof(uint32_t) == 0)
+            {
+                m_ringBufferView = m_ringBuffer->GetRHIBuffer()->GetBufferView(RHI::BufferViewDescriptor::CreateRaw(0, m_ringBufferSize));
+            }
             
             m_currentPosition = 0;
             m_endPositionLimit = 0;
@@ -51,6 +57,7 @@ namespace AZ
 
         void DynamicBufferAllocator::Shutdown()
         {
+            m_ringBufferView = nullptr;
             m_ringBuffer->Unmap();
             m_ringBuffer = nullptr;
             m_ringBufferStartAddress = nullptr;
@@ -133,7 +140,7 @@ namespace AZ
         {
             return RHI::IndexBufferView(
                 *m_ringBuffer->GetRHIBuffer(),
-                GetBufferAddressOffset(dynamicBuffer),
+                GetBufferOffset(*dynamicBuffer),
                 dynamicBuffer->m_size,
                 format
             );
@@ -143,15 +150,20 @@ namespace AZ
         {
             return RHI::StreamBufferView(
                 *m_ringBuffer->GetRHIBuffer(),
-                GetBufferAddressOffset(dynamicBuffer),
+                GetBufferOffset(*dynamicBuffer),
                 dynamicBuffer->m_size,
                 strideByteCount
             );
         }
 
-        uint32_t DynamicBufferAllocator::GetBufferAddressOffset(RHI::Ptr<DynamicBuffer> dynamicBuffer)
+        uint32_t DynamicBufferAllocator::GetBufferOffset(const DynamicBuffer& dynamicBuffer) const
+        {
+            return aznumeric_cast<uint32_t>((uint8_t*)dynamicBuffer.m_address - (uint8_t*)m_ringBufferStartAddress);
+        }
+
+        const RHI::Ptr<RHI::BufferView>& DynamicBufferAllocator::GetRingBufferView() const
         {
-            return aznumeric_cast<uint32_t>((uint8_t*)dynamicBuffer->m_address - (uint8_t*)m_ringBufferStartAddress);
+            return m_ringBufferView;
         }
 
         void DynamicBufferAllocator::SetEnableAllocationWarning(bool enable)
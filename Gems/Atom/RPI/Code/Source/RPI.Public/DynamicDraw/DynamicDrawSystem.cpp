@@ -32,6 +32,10 @@ namespace AZ
             if (m_bufferAlloc)
             {
                 m_bufferAlloc->Init(descriptor.m_dynamicBufferPoolSize);
+
+                m_constantBufferAlloc = AZStd::make_unique<DynamicBufferAllocator>();
+                m_constantBufferAlloc->Init(descriptor.m_dynamicConstantBufferPoolSize, "DynamicConstantBufferRing");
+
                 Interface<DynamicDrawInterface>::Register(this);
             }
         }
@@ -43,6 +47,8 @@ namespace AZ
                 Interface<DynamicDrawInterface>::Unregister(this);
                 m_bufferAlloc->Shutdown();
                 m_bufferAlloc = nullptr;
+                m_constantBufferAlloc->Shutdown();
+                m_constantBufferAlloc = nullptr;
             }
             m_dynamicDrawContexts.clear();
         }
@@ -53,6 +59,12 @@ namespace AZ
             return m_bufferAlloc->Allocate(size, alignment);
         }
 
+        RHI::Ptr<DynamicBuffer> DynamicDrawSystem::GetDynamicConstantBuffer(uint32_t size)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutexConstantBufferAlloc);
+            return m_constantBufferAlloc->Allocate(size, DynamicConstantDataAlignment);
+        }
+
         RHI::Ptr<DynamicDrawContext> DynamicDrawSystem::CreateDynamicDrawContext()
         {
             RHI::Ptr<DynamicDrawContext> drawContext = aznew DynamicDrawContext();
@@ -137,6 +149,12 @@ namespace AZ
                 m_bufferAlloc->FrameEnd();
             }
 
+            if (m_constantBufferAlloc != nullptr)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutexConstantBufferAlloc);
+                m_constantBufferAlloc->FrameEnd();
+            }
+
             // Clean up released dynamic draw contexts (which use count is 1)
             {
                 AZStd::lock_guard<AZStd::mutex> lock(m_mutexDrawContext);
@@ -194,6 +194,8 @@ namespace AZ
 
             CreateDefaultResources(desc);
 
+            m_mipFeedback.Init();
+
             Interface<ImageSystemInterface>::Register(this);
 
             m_initialized = true;
@@ -207,6 +209,8 @@ namespace AZ
             }
             Interface<ImageSystemInterface>::Unregister(this);
 
+            m_mipFeedback.Shutdown();
+
             m_systemImages.clear();
             m_systemAttachmentImages.clear();
             m_systemStreamingPool = nullptr;
@@ -232,6 +236,11 @@ namespace AZ
             }
         }
 
+        void ImageSystem::FrameUpdate(RHI::FrameGraphBuilder& frameGraphBuilder)
+        {
+            m_mipFeedback.FrameUpdate(frameGraphBuilder);
+        }
+
         const Data::Instance<StreamingImagePool>& ImageSystem::GetSystemStreamingPool() const
         {
             return m_systemStreamingPool;
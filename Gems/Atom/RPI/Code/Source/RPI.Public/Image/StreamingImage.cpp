@@ -148,6 +148,8 @@ namespace AZ
                 initRequest.m_image = GetRHIImage();
                 initRequest.m_descriptor = imageAsset.GetImageDescriptor();
                 initRequest.m_tailMipSlices = mipChainTailAsset.GetMipSlices();
+                initRequest.m_enableTileStreaming = !RHI::CheckBitsAny(imageAsset.GetFlags(), StreamingImageFlags::NotStreamable) &&
+                    StreamingImageTiles::IsTileStreamingRequested(initRequest.m_descriptor, *rhiPool);
 
                 // NOTE: Initialization can fail due to out-of-memory errors. Need to handle it at runtime.
                 resultCode = rhiPool->InitImage(initRequest);
@@ -186,6 +188,14 @@ namespace AZ
                 m_imageAsset = { &imageAsset, AZ::Data::AssetLoadBehavior::PreLoad };
                 m_rhiPool = rhiPool;
                 m_pool = pool;
+
+                // The backend may not be able to tile the image even if it was requested
+                RHI::StreamingImageTileLayout tileLayout;
+                if (m_rhiPool->GetImageTileLayout(*GetRHIImage(), tileLayout) == RHI::ResultCode::Success && tileLayout.m_tiledMipCount > 0)
+                {
+                    m_tiles = AZStd::make_unique<StreamingImageTiles>(tileLayout, imageAsset.GetImageDescriptor(), Name(m_imageAsset.GetHint()));
+                }
+
                 m_pool->AttachImage(this);
 
                 // Set rhi image name
@@ -228,6 +238,7 @@ namespace AZ
                 m_rhiPool = nullptr;
 
                 GetRHIImage()->Shutdown();
+                m_tiles = nullptr;
 
                 // Evict all active mip chains
                 for (size_t mipChainIndex = 0; mipChainIndex < m_mipChains.size(); ++mipChainIndex)
@@ -476,6 +487,12 @@ namespace AZ
 
             m_mipChainState.m_maskReady |= mipChainBit;
 
+            // The tiles of tile streamed images are made resident by the controller update once their mip chain is ready
+            if (m_tiles)
+            {
+                return;
+            }
+
             if (m_streamingController)
             {
                 m_streamingController->OnMipChainAssetReady(this);
@@ -514,6 +531,86 @@ namespace AZ
             return RHI::ResultCode::InvalidOperation;
         }
 
+        uint32_t StreamingImage::UpdateTiles(uint32_t maxUploadCount)
+        {
+            AZ_PROFILE_FUNCTION(RPI);
+
+            if (!m_tiles)
+            {
+                return 0;
+            }
+
+            auto isMipDataReady = [this](uint32_t mipLevel)
+            {
+                const size_t mipChainIndex = m_imageAsset->GetMipChainIndex(mipLevel);
+                if (!RHI::CheckBitsAll(m_mipChainState.m_maskActive, static_cast<uint16_t>(1 << mipChainIndex)))
+                {
+                    FetchMipChainAsset(mipChainIndex);
+                }
+                return IsMipChainAssetReady(mipChainIndex);
+            };
+
+            StreamingImageTiles::Update update;
+            m_tiles->CollectUpdate(maxUploadCount, isMipDataReady, update);
+
+            if (!update.m_residentTiles.empty() || !update.m_evictedTiles.empty())
+            {
+                AZStd::vector<RHI::StreamingImageTileData> residentTiles;
+                residentTiles.reserve(update.m_residentTiles.size());
+                for (const RHI::StreamingImageTile& tile : update.m_residentTiles)
+                {
+                    const size_t mipChainIndex = m_imageAsset->GetMipChainIndex(tile.m_mipLevel);
+                    const size_t mipSliceIndex = tile.m_mipLevel - m_imageAsset->GetMipLevel(mipChainIndex);
+                    const RHI::StreamingImageMipSlice& mipSlice = m_mipChains[mipChainIndex]->GetMipSlices()[mipSliceIndex];
+
+                    RHI::StreamingImageTileData& tileData = residentTiles.emplace_back();
+                    tileData.m_tile = tile;
+                    tileData.m_mipData = mipSlice.m_subresources[0].m_data;
+                    tileData.m_mipLayout = mipSlice.m_subresourceLayout;
+                }
+
+                // The mip chains of the uploaded tiles stay loaded until the upload is complete since their mip is in use
+                RHI::StreamingImageTileRequest request;
+                request.m_image = GetRHIImage();
+                request.m_residentTiles = residentTiles;
+                request.m_evictedTiles = update.m_evictedTiles;
+                request.m_completeCallback = [tiles = m_tiles.get(), uploadId = update.m_uploadId]()
+                {
+                    tiles->OnUploadComplete(uploadId, true);
+                };
+
+                if (m_rhiPool->UpdateImageTiles(request) != RHI::ResultCode::Success)
+                {
+                    AZ_Warning("StreamingImage", false, "Failed to update the tiles of image [%s]", m_image->GetName().GetCStr());
+                    m_tiles->OnUploadComplete(update.m_uploadId, false);
+                }
+            }
+
+            // Release the CPU data of the tiled mips without any tile in use. The tail mip chain is never evicted.
+            for (size_t mipChainIndex = 0; mipChainIndex + 1 < m_mipChains.size(); ++mipChainIndex)
+            {
+                const uint32_t mipBegin = static_cast<uint32_t>(m_imageAsset->GetMipLevel(mipChainIndex));
+                const uint32_t mipEnd = mipBegin + static_cast<uint32_t>(m_imageAsset->GetMipCount(mipChainIndex));
+                const uint32_t mipChainMask = ((1u << mipEnd) - 1) & ~((1u << mipBegin) - 1);
+                if ((update.m_mipsInUseMask & mipChainMask) == 0)
+                {
+                    EvictMipChainAsset(mipChainIndex);
+                }
+            }
+
+            return static_cast<uint32_t>(update.m_residentTiles.size());
+        }
+
+        bool StreamingImage::IsTileStreamed() const
+        {
+            return m_tiles != nullptr;
+        }
+
+        StreamingImageTiles* StreamingImage::GetTiles()
+        {
+            return m_tiles.get();
+        }
+
         void StreamingImage::OnAssetReady(Data::Asset<Data::AssetData> asset)
         {
             size_t mipChainIndex = 0;
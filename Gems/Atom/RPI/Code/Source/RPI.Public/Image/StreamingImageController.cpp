@@ -9,6 +9,7 @@
 #include <Atom/RPI.Public/Image/StreamingImageController.h>
 #include <Atom/RPI.Public/Image/StreamingImageContext.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
+#include <Atom/RPI.Public/Image/StreamingImageMipFeedback.h>
 
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/Time/ITime.h>
@@ -55,6 +56,10 @@ namespace AZ
             {
                 AZStd::lock_guard<AZStd::recursive_mutex> lock(m_imageListAccessMutex);
                 m_streamableImages.insert(image);
+                if (image->IsTileStreamed())
+                {
+                    m_tileStreamedImages.insert(image);
+                }
             }
 
             ReinsertImageToLists(image);
@@ -72,6 +77,7 @@ namespace AZ
                 m_expandingImages.erase(image);
                 m_expandableImages.erase(image);
                 m_evictableImages.erase(image);
+                m_tileStreamedImages.erase(image);
             }
 
             const StreamingImageContextPtr& context = image->m_streamingContext;
@@ -127,6 +133,8 @@ namespace AZ
             const uint32_t c_jobCount = 30;
             uint32_t jobCount = 0;
 
+            ApplyMipFeedback();
+
             // if the memory was low, cancel all expanding images
             if (m_lastLowMemory)
             {
@@ -205,9 +213,74 @@ namespace AZ
                 }
             }
 
+            UpdateTileStreamedImages();
+
             ++m_timestamp;
         }
 
+        void StreamingImageController::UpdateTileStreamedImages()
+        {
+            AZ_PROFILE_FUNCTION(RPI);
+
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_imageListAccessMutex);
+
+            // Only evict tiles while memory is low
+            uint32_t uploadBudget = m_lastLowMemory == 0 ? StreamingImageTiles::GetMaxUploadCountPerFrame() : 0;
+            for (StreamingImage* image : m_tileStreamedImages)
+            {
+                image->GetTiles()->RequestMipIfNoFeedback(GetImageTargetMip(image));
+                uploadBudget -= image->UpdateTiles(uploadBudget);
+            }
+        }
+
+        void StreamingImageController::ApplyMipFeedback()
+        {
+            StreamingImageMipFeedback* feedback = StreamingImageMipFeedback::Get();
+            if (!feedback || !StreamingImageMipFeedback::IsEnabled())
+            {
+                return;
+            }
+
+            // The requests are immutable, so they can be used without holding the feedback while updating the images
+            const AZStd::shared_ptr<const StreamingImageMipFeedback::MipRequests> mipRequests = feedback->GetMipRequests();
+            if (!mipRequests || mipRequests->m_version == m_mipFeedbackVersion)
+            {
+                return;
+            }
+            m_mipFeedbackVersion = mipRequests->m_version;
+
+            AZ_PROFILE_FUNCTION(RPI);
+
+            const size_t evictionUpdateCount = StreamingImageMipFeedback::GetEvictionUpdateCount();
+
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_imageListAccessMutex);
+            for (StreamingImage* image : m_streamableImages)
+            {
+                const RHI::ImageView* imageView = image->GetImageView();
+                if (image->IsTileStreamed() || !imageView || !mipRequests->IsTracked(imageView->GetBindlessReadIndex()))
+                {
+                    continue;
+                }
+
+                StreamingImageContext* context = image->m_streamingContext.get();
+                const uint16_t lastMip = aznumeric_cast<uint16_t>(image->GetRHIImage()->GetDescriptor().m_mipLevels - 1);
+                const uint32_t sampledMip = mipRequests->GetSampledMip(imageView->GetBindlessReadIndex());
+                if (sampledMip != StreamingImageMipFeedback::NoMipSampled)
+                {
+                    // Also refreshes the access timestamp, which keeps the sampled images at a higher priority
+                    context->m_hasMipFeedback = true;
+                    context->m_lastSampledTimestamp = m_timestamp;
+                    OnSetTargetMip(image, aznumeric_cast<uint16_t>(AZStd::min<uint32_t>(sampledMip, lastMip)));
+                }
+                else if (context->m_hasMipFeedback && context->m_mipLevelTarget != lastMip &&
+                    m_timestamp - context->m_lastSampledTimestamp > evictionUpdateCount)
+                {
+                    // Occluded or out of view for a while
+                    OnSetTargetMip(image, lastMip);
+                }
+            }
+        }
+
         size_t StreamingImageController::GetTimestamp() const
         {
             return m_timestamp;
@@ -390,6 +463,12 @@ namespace AZ
 
         bool StreamingImageController::NeedExpand(const StreamingImage* image) const
         {
+            // The tiled mips are streamed per tile
+            if (image->IsTileStreamed())
+            {
+                return false;
+            }
+
             uint16_t targetMip = GetImageTargetMip(image);
             // only need expand if the current expanding target is smaller than final target
             return image->m_mipChainState.m_streamingTarget > image->m_imageAsset->GetMipChainIndex(targetMip);
@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Image/StreamingImageMipFeedback.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+
+#include <Atom/RHI/CommandList.h>
+#include <Atom/RHI/Factory.h>
+#include <Atom/RHI/FrameGraphInterface.h>
+#include <Atom/RHI/RHISystemInterface.h>
+#include <Atom/RHI/RHIUtils.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+AZ_DECLARE_BUDGET(RPI);
+
+namespace AZ
+{
+    namespace RPI
+    {
+        AZ_CVAR(bool, r_streamingImageMipFeedback, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Drive the streaming of image mips with the mips sampled on the GPU, written into the mip feedback buffer by the shaders "
+            "of StreamingImageMipFeedbackPass passes, instead of the target mips set on the images.");
+
+        AZ_CVAR(uint32_t, r_streamingImageMipFeedbackImageCount, 65536, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Number of bindless image read indices tracked by the mip feedback buffer. Images with greater indices aren't tracked. "
+            "Only applied when the feedback is enabled.");
+
+        AZ_CVAR(uint32_t, r_streamingImageMipFeedbackEvictionUpdateCount, 300, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Number of streaming updates after which an image which stopped being sampled is trimmed to its last mip.");
+
+        namespace
+        {
+            // Builds the scopes of the feedback, which only use the feedback buffer attachment and submit a single copy
+            class MipFeedbackScopeProducer final
+                : public RHI::ScopeProducer
+            {
+            public:
+                AZ_CLASS_ALLOCATOR(MipFeedbackScopeProducer, SystemAllocator);
+
+                MipFeedbackScopeProducer(
+                    const RHI::ScopeId& scopeId,
+                    AZStd::function<void(RHI::FrameGraphInterface)> prepareFunction,
+                    AZStd::function<void(const RHI::FrameGraphExecuteContext&)> executeFunction)
+                    : ScopeProducer(scopeId)
+                    , m_prepareFunction(AZStd::move(prepareFunction))
+                    , m_executeFunction(AZStd::move(executeFunction))
+                {
+                }
+
+            private:
+                void SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph) override
+                {
+                    m_prepareFunction(frameGraph);
+                }
+
+                void CompileResources([[maybe_unused]] const RHI::FrameGraphCompileContext& context) override
+                {
+                }
+
+                void BuildCommandList(const RHI::FrameGraphExecuteContext& context) override
+                {
+                    m_executeFunction(context);
+                }
+
+                AZStd::function<void(RHI::FrameGraphInterface)> m_prepareFunction;
+                AZStd::function<void(const RHI::FrameGraphExecuteContext&)> m_executeFunction;
+            };
+        } // namespace
+
+        StreamingImageMipFeedback* StreamingImageMipFeedback::Get()
+        {
+            return Interface<StreamingImageMipFeedback>::Get();
+        }
+
+        bool StreamingImageMipFeedback::IsEnabled()
+        {
+            return r_streamingImageMipFeedback;
+        }
+
+        uint32_t StreamingImageMipFeedback::GetEvictionUpdateCount()
+        {
+            return AZStd::max<uint32_t>(r_streamingImageMipFeedbackEvictionUpdateCount, 1);
+        }
+
+        StreamingImageMipFeedback::StreamingImageMipFeedback() = default;
+        StreamingImageMipFeedback::~StreamingImageMipFeedback() = default;
+
+        void StreamingImageMipFeedback::Init()
+        {
+            m_readbackScopeProducer = AZStd::make_unique<MipFeedbackScopeProducer>(
+                RHI::ScopeId("StreamingImageMipFeedbackReadback"),
+                [this](RHI::FrameGraphInterface frameGraph)
+                {
+                    frameGraph.UseCopyAttachment(
+                        RHI::BufferScopeAttachmentDescriptor(m_feedbackBuffer->GetAttachmentId(), m_feedbackViewDescriptor),
+                        RHI::ScopeAttachmentAccess::Read);
+                    frameGraph.SetEstimatedItemCount(1);
+                    frameGraph.SignalFence(*m_readbacks[m_readbackIndex].m_fence);
+                },
+                [this](const RHI::FrameGraphExecuteContext& context)
+                {
+                    context.GetCommandList()->Submit(m_readbackCopy);
+                });
+
+            m_clearScopeProducer = AZStd::make_unique<MipFeedbackScopeProducer>(
+                RHI::ScopeId("StreamingImageMipFeedbackClear"),
+                [this](RHI::FrameGraphInterface frameGraph)
+                {
+                    frameGraph.UseCopyAttachment(
+                        RHI::BufferScopeAttachmentDescriptor(m_feedbackBuffer->GetAttachmentId(), m_feedbackViewDescriptor),
+                        RHI::ScopeAttachmentAccess::Write);
+                    frameGraph.SetEstimatedItemCount(1);
+                },
+                [this](const RHI::FrameGraphExecuteContext& context)
+                {
+                    context.GetCommandList()->Submit(m_clearCopy);
+                });
+
+            m_mipRequests = AZStd::make_shared<MipRequests>();
+
+            Interface<StreamingImageMipFeedback>::Register(this);
+            m_isInitialized = true;
+        }
+
+        void StreamingImageMipFeedback::Shutdown()
+        {
+            if (!m_isInitialized)
+            {
+                return;
+            }
+
+            Interface<StreamingImageMipFeedback>::Unregister(this);
+            ReleaseBuffers();
+            m_readbackScopeProducer = nullptr;
+            m_clearScopeProducer = nullptr;
+            m_mipRequests = nullptr;
+            m_isInitialized = false;
+        }
+
+        bool StreamingImageMipFeedback::CreateBuffers()
+        {
+            BufferSystemInterface* bufferSystem = BufferSystemInterface::Get();
+            const uint32_t imageCount = AZStd::max<uint32_t>(r_streamingImageMipFeedbackImageCount, 1);
+            const uint64_t bufferSize = static_cast<uint64_t>(imageCount) * sizeof(uint32_t);
+            const AZStd::vector<uint32_t> clearedFeedback(imageCount, NoMipSampled);
+
+            CommonBufferDescriptor descriptor;
+            descriptor.m_elementSize = sizeof(uint32_t);
+            descriptor.m_byteCount = bufferSize;
+
+            descriptor.m_bufferName = "StreamingImageMipFeedback";
+            descriptor.m_poolType = CommonBufferPoolType::ReadWrite;
+            descriptor.m_bufferData = clearedFeedback.data();
+            m_feedbackBuffer = bufferSystem->CreateBufferFromCommonPool(descriptor);
+
+            descriptor.m_bufferName = "StreamingImageMipFeedback_Clear";
+            descriptor.m_poolType = CommonBufferPoolType::ReadOnly;
+            m_clearBuffer = bufferSystem->CreateBufferFromCommonPool(descriptor);
+
+            descriptor.m_poolType = CommonBufferPoolType::ReadBack;
+            descriptor.m_bufferData = nullptr;
+            RHI::Device* device = RHI::RHISystemInterface::Get()->GetDevice();
+            bool isReadbackCreated = true;
+            for (size_t readbackIndex = 0; readbackIndex < m_readbacks.size(); ++readbackIndex)
+            {
+                Readback& readback = m_readbacks[readbackIndex];
+                descriptor.m_bufferName = AZStd::string::format("StreamingImageMipFeedback_Readback%zu", readbackIndex);
+                readback.m_buffer = bufferSystem->CreateBufferFromCommonPool(descriptor);
+                readback.m_fence = RHI::Factory::Get().CreateFence();
+                isReadbackCreated &= readback.m_buffer && readback.m_fence &&
+                    readback.m_fence->Init(*device, RHI::FenceState::Reset) == RHI::ResultCode::Success;
+            }
+
+            if (!m_feedbackBuffer || !m_clearBuffer || !isReadbackCreated)
+            {
+                AZ_Error("StreamingImageMipFeedback", false, "Failed to create the streaming image mip feedback buffers");
+                ReleaseBuffers();
+                return false;
+            }
+
+            m_feedbackViewDescriptor = RHI::BufferViewDescriptor::CreateRaw(0, aznumeric_cast<uint32_t>(bufferSize));
+            m_feedbackBufferView = m_feedbackBuffer->GetRHIBuffer()->GetBufferView(m_feedbackViewDescriptor);
+            m_feedbackBindlessIndex = m_feedbackBufferView ? m_feedbackBufferView->GetBindlessReadWriteIndex() : RHI::InvalidIndex;
+
+            m_readbackCopy.m_sourceBuffer = m_feedbackBuffer->GetRHIBuffer();
+            m_readbackCopy.m_size = aznumeric_cast<uint32_t>(bufferSize);
+
+            m_clearCopy.m_sourceBuffer = m_clearBuffer->GetRHIBuffer();
+            m_clearCopy.m_destinationBuffer = m_feedbackBuffer->GetRHIBuffer();
+            m_clearCopy.m_size = aznumeric_cast<uint32_t>(bufferSize);
+            return true;
+        }
+
+        void StreamingImageMipFeedback::ReleaseBuffers()
+        {
+            m_feedbackBindlessIndex = RHI::InvalidIndex;
+            m_feedbackBufferView = nullptr;
+            m_feedbackBuffer = nullptr;
+            m_clearBuffer = nullptr;
+            for (Readback& readback : m_readbacks)
+            {
+                readback = {};
+            }
+            m_readbackIndex = 0;
+            m_readbackCopy = {};
+            m_clearCopy = {};
+            m_isImported = false;
+
+            ResolveFeedback({});
+        }
+
+        void StreamingImageMipFeedback::AddWriter()
+        {
+            if (IsEnabled())
+            {
+                ++m_writerCount;
+            }
+        }
+
+        void StreamingImageMipFeedback::FrameUpdate(RHI::FrameGraphBuilder& frameGraphBuilder)
+        {
+            AZ_PROFILE_FUNCTION(RPI);
+
+            m_isImported = false;
+            const uint32_t writerCount = m_writerCount.exchange(0);
+
+            if (!IsEnabled() || RHI::IsNullRHI())
+            {
+                if (m_feedbackBuffer)
+                {
+                    ReleaseBuffers();
+                }
+                return;
+            }
+
+            if (!m_feedbackBuffer && !CreateBuffers())
+            {
+                return;
+            }
+
+            ResolveCompletedReadbacks();
+
+            // Without a writer the buffer only holds cleared values. If the GPU is still reading back into the next readback
+            // buffer the frame isn't recorded either, the writers skip the feedback while the buffer isn't imported.
+            const uint32_t readbackIndex = (m_readbackIndex + 1) % RHI::Limits::Device::FrameCountMax;
+            Readback& readback = m_readbacks[readbackIndex];
+            if (writerCount == 0 || readback.m_isPending)
+            {
+                return;
+            }
+
+            if (frameGraphBuilder.GetAttachmentDatabase().ImportBuffer(m_feedbackBuffer->GetAttachmentId(), m_feedbackBuffer->GetRHIBuffer()) !=
+                RHI::ResultCode::Success)
+            {
+                AZ_Error("StreamingImageMipFeedback", false, "Failed to import the streaming image mip feedback buffer");
+                return;
+            }
+
+            // The scopes of the writers were imported by the passes, so the frame graph orders the readback and the clear after
+            // their shader writes
+            m_readbackCopy.m_destinationBuffer = readback.m_buffer->GetRHIBuffer();
+            frameGraphBuilder.ImportScopeProducer(*m_readbackScopeProducer);
+            frameGraphBuilder.ImportScopeProducer(*m_clearScopeProducer);
+            readback.m_isPending = true;
+            m_readbackIndex = readbackIndex;
+            m_isImported = true;
+        }
+
+        void StreamingImageMipFeedback::ResolveCompletedReadbacks()
+        {
+            // The readback buffers are used in turn and the GPU completes the readbacks in order, so resolve the oldest one first
+            const uint32_t oldestReadbackIndex = (m_readbackIndex + 1) % RHI::Limits::Device::FrameCountMax;
+            for (uint32_t readbackOffset = 0; readbackOffset < RHI::Limits::Device::FrameCountMax; ++readbackOffset)
+            {
+                const uint32_t readbackIndex = (oldestReadbackIndex + readbackOffset) % RHI::Limits::Device::FrameCountMax;
+                Readback& readback = m_readbacks[readbackIndex];
+                if (!readback.m_isPending || readback.m_fence->GetFenceState() != RHI::FenceState::Signaled)
+                {
+                    continue;
+                }
+
+                const uint64_t bufferSize = readback.m_buffer->GetBufferSize();
+                if (const void* data = readback.m_buffer->Map(bufferSize, 0))
+                {
+                    ResolveFeedback(AZStd::span<const uint32_t>(static_cast<const uint32_t*>(data), bufferSize / sizeof(uint32_t)));
+                    readback.m_buffer->Unmap();
+                }
+                readback.m_fence->Reset();
+                readback.m_isPending = false;
+            }
+        }
+
+        bool StreamingImageMipFeedback::UseShaderAttachment(RHI::FrameGraphInterface frameGraph) const
+        {
+            if (!m_isImported)
+            {
+                return false;
+            }
+
+            // Shaders read the recorded mip before writing it, see StreamingImageMipFeedback.azsli
+            frameGraph.UseShaderAttachment(
+                RHI::BufferScopeAttachmentDescriptor(m_feedbackBuffer->GetAttachmentId(), m_feedbackViewDescriptor),
+                RHI::ScopeAttachmentAccess::ReadWrite);
+            return true;
+        }
+
+        uint32_t StreamingImageMipFeedback::GetFeedbackBindlessIndex() const
+        {
+            return m_isImported ? m_feedbackBindlessIndex : RHI::InvalidIndex;
+        }
+
+        void StreamingImageMipFeedback::ResolveFeedback(AZStd::span<const uint32_t> sampledMips)
+        {
+            AZStd::shared_ptr<MipRequests> mipRequests = AZStd::make_shared<MipRequests>();
+            mipRequests->m_sampledMips.assign(sampledMips.begin(), sampledMips.end());
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mipRequestsMutex);
+            mipRequests->m_version = m_mipRequests ? m_mipRequests->m_version + 1 : 1;
+            m_mipRequests = AZStd::move(mipRequests);
+        }
+
+        AZStd::shared_ptr<const StreamingImageMipFeedback::MipRequests> StreamingImageMipFeedback::GetMipRequests() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mipRequestsMutex);
+            return m_mipRequests;
+        }
+
+        bool StreamingImageMipFeedback::MipRequests::IsTracked(uint32_t bindlessReadIndex) const
+        {
+            return bindlessReadIndex < m_sampledMips.size();
+        }
+
+        uint32_t StreamingImageMipFeedback::MipRequests::GetSampledMip(uint32_t bindlessReadIndex) const
+        {
+            return IsTracked(bindlessReadIndex) ? m_sampledMips[bindlessReadIndex] : NoMipSampled;
+        }
+    } // namespace RPI
+} // namespace AZ
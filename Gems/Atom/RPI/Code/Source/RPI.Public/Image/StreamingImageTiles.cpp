@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Image/StreamingImageTiles.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+
+#include <Atom/RHI.Reflect/Limits.h>
+
+#include <AzCore/Console/IConsole.h>
+
+AZ_DECLARE_BUDGET(RPI);
+
+namespace AZ
+{
+    namespace RPI
+    {
+        AZ_CVAR(bool, r_streamingImageTileStreaming, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Stream the most detailed mips of large streaming images per tile, driven by GPU feedback. Requires tiled image support. "
+            "Only affects images created after it is changed.");
+
+        AZ_CVAR(uint32_t, r_streamingImageTileStreamingMinSize, 2048, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Minimum width or height of the streaming images which are streamed per tile.");
+
+        AZ_CVAR(uint32_t, r_streamingImageTileUploadsPerFrame, 64, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Maximum number of image tiles made resident per frame.");
+
+        AZ_CVAR(uint32_t, r_streamingImageTileEvictionFrameCount, 120, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Number of frames an image tile stays resident after it was last requested.");
+
+        bool StreamingImageTiles::IsTileStreamingRequested(const RHI::ImageDescriptor& imageDescriptor, const RHI::StreamingImagePool& pool)
+        {
+            const uint32_t minSize = r_streamingImageTileStreamingMinSize;
+            return r_streamingImageTileStreaming && pool.SupportTiledImage() &&
+                imageDescriptor.m_dimension == RHI::ImageDimension::Image2D && imageDescriptor.m_arraySize == 1 && imageDescriptor.m_mipLevels > 1 &&
+                AZStd::max(imageDescriptor.m_size.m_width, imageDescriptor.m_size.m_height) >= minSize;
+        }
+
+        uint32_t StreamingImageTiles::GetMaxUploadCountPerFrame()
+        {
+            return r_streamingImageTileUploadsPerFrame;
+        }
+
+        StreamingImageTiles::StreamingImageTiles(
+            const RHI::StreamingImageTileLayout& tileLayout, const RHI::ImageDescriptor& imageDescriptor, const Name& imageName)
+            : m_tileLayout(tileLayout)
+        {
+            AZ_Assert(tileLayout.m_tiledMipCount > 0 && tileLayout.m_mipTileCounts.size() == tileLayout.m_tiledMipCount, "Invalid tile layout");
+
+            uint32_t tileCount = 0;
+            for (const RHI::Size& mipTileCount : m_tileLayout.m_mipTileCounts)
+            {
+                m_mipTileOffsets.push_back(tileCount);
+                tileCount += mipTileCount.m_width * mipTileCount.m_height;
+            }
+            m_tiles.resize(tileCount);
+
+            // No tile is resident, only the non tiled mips are.
+            const RHI::Size& mip0TileCount = GetTileCount(0);
+            const uint32_t headerCount = ResidencyHeaderSize / sizeof(uint32_t);
+            m_residencyData.resize(headerCount + mip0TileCount.m_width * mip0TileCount.m_height, m_tileLayout.m_tiledMipCount);
+            const float uvToTile[2] = {
+                static_cast<float>(imageDescriptor.m_size.m_width) / m_tileLayout.m_tileSize.m_width,
+                static_cast<float>(imageDescriptor.m_size.m_height) / m_tileLayout.m_tileSize.m_height };
+            m_residencyData[0] = mip0TileCount.m_width;
+            m_residencyData[1] = mip0TileCount.m_height;
+            ::memcpy(&m_residencyData[2], uvToTile, sizeof(uvToTile));
+
+            BufferSystemInterface* bufferSystem = BufferSystemInterface::Get();
+            if (!bufferSystem)
+            {
+                return;
+            }
+
+            const uint32_t bufferSize = static_cast<uint32_t>(m_residencyData.size() * sizeof(uint32_t));
+
+            CommonBufferDescriptor descriptor;
+            descriptor.m_bufferName = AZStd::string::format("%s_TileResidency", imageName.GetCStr());
+            descriptor.m_poolType = CommonBufferPoolType::ReadOnly;
+            descriptor.m_elementSize = sizeof(uint32_t);
+            descriptor.m_byteCount = bufferSize;
+            descriptor.m_bufferData = m_residencyData.data();
+            m_residencyBuffer = bufferSystem->CreateBufferFromCommonPool(descriptor);
+            if (!m_residencyBuffer)
+            {
+                AZ_Error("StreamingImageTiles", false, "Failed to create the tile residency buffer of image [%s]", imageName.GetCStr());
+                return;
+            }
+
+            m_residencyBufferView = m_residencyBuffer->GetRHIBuffer()->GetBufferView(RHI::BufferViewDescriptor::CreateRaw(0, bufferSize));
+            if (m_residencyBufferView)
+            {
+                m_residencyBindlessReadIndex = m_residencyBufferView->GetBindlessReadIndex();
+            }
+            m_isResidencyDirty = false;
+        }
+
+        StreamingImageTiles::~StreamingImageTiles() = default;
+
+        uint32_t StreamingImageTiles::GetTiledMipCount() const
+        {
+            return m_tileLayout.m_tiledMipCount;
+        }
+
+        RHI::Size StreamingImageTiles::GetTileCount(uint32_t mipLevel) const
+        {
+            return m_tileLayout.m_mipTileCounts[mipLevel];
+        }
+
+        uint32_t StreamingImageTiles::GetResidencyBindlessReadIndex() const
+        {
+            return m_residencyBindlessReadIndex;
+        }
+
+        StreamingImageTiles::Tile& StreamingImageTiles::GetTile(uint32_t mipLevel, uint32_t tileX, uint32_t tileY)
+        {
+            return m_tiles[m_mipTileOffsets[mipLevel] + tileY * m_tileLayout.m_mipTileCounts[mipLevel].m_width + tileX];
+        }
+
+        const StreamingImageTiles::Tile& StreamingImageTiles::GetTile(uint32_t mipLevel, uint32_t tileX, uint32_t tileY) const
+        {
+            return m_tiles[m_mipTileOffsets[mipLevel] + tileY * m_tileLayout.m_mipTileCounts[mipLevel].m_width + tileX];
+        }
+
+        bool StreamingImageTiles::CanEvictTile(uint32_t mipLevel, uint32_t tileX, uint32_t tileY) const
+        {
+            if (mipLevel == 0)
+            {
+                return true;
+            }
+
+            // A tile covers up to 2x2 tiles of the next more detailed mip.
+            const RHI::Size& childTileCount = m_tileLayout.m_mipTileCounts[mipLevel - 1];
+            for (uint32_t childY = tileY * 2; childY < AZStd::min(tileY * 2 + 2, childTileCount.m_height); ++childY)
+            {
+                for (uint32_t childX = tileX * 2; childX < AZStd::min(tileX * 2 + 2, childTileCount.m_width); ++childX)
+                {
+                    const TileState childState = GetTile(mipLevel - 1, childX, childY).m_state;
+                    if (childState != TileState::NonResident && childState != TileState::Evicting)
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        bool StreamingImageTiles::IsRequested(const Tile& tile, uint64_t evictionFrameCount) const
+        {
+            return tile.m_lastRequestedFrame > 0 && m_frameIndex - tile.m_lastRequestedFrame <= evictionFrameCount;
+        }
+
+        void StreamingImageTiles::ApplyFeedback(AZStd::span<const uint32_t> requestedMips)
+        {
+            const RHI::Size& mip0TileCount = GetTileCount(0);
+            if (requestedMips.size() != mip0TileCount.m_width * mip0TileCount.m_height)
+            {
+                AZ_Warning("StreamingImageTiles", false, "The tile feedback has %zu values, expected %u", requestedMips.size(), mip0TileCount.m_width * mip0TileCount.m_height);
+                return;
+            }
+
+            const uint32_t tiledMipCount = GetTiledMipCount();
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_lastFeedbackFrame = m_frameIndex;
+            for (uint32_t tileY = 0; tileY < mip0TileCount.m_height; ++tileY)
+            {
+                for (uint32_t tileX = 0; tileX < mip0TileCount.m_width; ++tileX)
+                {
+                    // Request the tile of the requested mip and the tiles containing it in the less detailed mips
+                    for (uint32_t mipLevel = requestedMips[tileY * mip0TileCount.m_width + tileX]; mipLevel < tiledMipCount; ++mipLevel)
+                    {
+                        const RHI::Size& mipTileCount = m_tileLayout.m_mipTileCounts[mipLevel];
+                        Tile& tile = GetTile(mipLevel, AZStd::min(tileX >> mipLevel, mipTileCount.m_width - 1), AZStd::min(tileY >> mipLevel, mipTileCount.m_height - 1));
+                        if (tile.m_lastRequestedFrame == m_frameIndex)
+                        {
+                            // The less detailed tiles were requested along with it
+                            break;
+                        }
+                        tile.m_lastRequestedFrame = m_frameIndex;
+                    }
+                }
+            }
+        }
+
+        void StreamingImageTiles::RequestMipIfNoFeedback(uint32_t mipLevel)
+        {
+            const uint32_t tiledMipCount = GetTiledMipCount();
+            if (mipLevel >= tiledMipCount)
+            {
+                return;
+            }
+
+            const uint64_t evictionFrameCount = AZStd::max<uint32_t>(r_streamingImageTileEvictionFrameCount, 1);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (m_lastFeedbackFrame > 0 && m_frameIndex - m_lastFeedbackFrame <= evictionFrameCount)
+            {
+                return;
+            }
+
+            // The tiles are stored mip by mip, so the tiles of the requested mip and all less detailed tiled mips are contiguous
+            for (auto tileIt = m_tiles.begin() + m_mipTileOffsets[mipLevel]; tileIt != m_tiles.end(); ++tileIt)
+            {
+                tileIt->m_lastRequestedFrame = m_frameIndex;
+            }
+        }
+
+        void StreamingImageTiles::OnUploadComplete(uint32_t uploadId, bool succeeded)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_completedUploads.emplace_back(uploadId, succeeded);
+        }
+
+        void StreamingImageTiles::CollectUpdate(uint32_t maxUploadCount, const AZStd::function<bool(uint32_t mipLevel)>& isMipDataReady, Update& update)
+        {
+            AZ_PROFILE_FUNCTION(RPI);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+
+            const uint64_t evictionFrameCount = AZStd::max<uint32_t>(r_streamingImageTileEvictionFrameCount, 1);
+            const uint32_t tiledMipCount = GetTiledMipCount();
+
+            // Make the uploaded tiles resident
+            if (!m_completedUploads.empty())
+            {
+                for (Tile& tile : m_tiles)
+                {
+                    if (tile.m_state != TileState::Uploading)
+                    {
+                        continue;
+                    }
+
+                    for (const auto& [uploadId, succeeded] : m_completedUploads)
+                    {
+                        if (tile.m_uploadId == uploadId)
+                        {
+                            tile.m_state = succeeded ? TileState::Resident : TileState::NonResident;
+                            m_isResidencyDirty |= succeeded;
+                            break;
+                        }
+                    }
+                }
+                m_completedUploads.clear();
+            }
+
+            // Stop sampling the tiles which weren't requested for a while, the most detailed mips first so no tile is evicted
+            // before the tiles it contains. The tiles requested again while waiting to be evicted remain resident.
+            update.m_mipsInUseMask = 0;
+            for (uint32_t mipLevel = 0; mipLevel < tiledMipCount; ++mipLevel)
+            {
+                const RHI::Size& mipTileCount = m_tileLayout.m_mipTileCounts[mipLevel];
+                for (uint32_t tileY = 0; tileY < mipTileCount.m_height; ++tileY)
+                {
+                    for (uint32_t tileX = 0; tileX < mipTileCount.m_width; ++tileX)
+                    {
+                        Tile& tile = GetTile(mipLevel, tileX, tileY);
+                        const bool isRequested = IsRequested(tile, evictionFrameCount);
+                        if (tile.m_state == TileState::Evicting && isRequested)
+                        {
+                            tile.m_state = TileState::Resident;
+                            m_isResidencyDirty = true;
+                        }
+                        else if (tile.m_state == TileState::Resident && !isRequested && CanEvictTile(mipLevel, tileX, tileY))
+                        {
+                            tile.m_state = TileState::Evicting;
+                            m_pendingEvictions.emplace_back(m_frameIndex, RHI::StreamingImageTile{ mipLevel, tileX, tileY });
+                            m_isResidencyDirty = true;
+                        }
+
+                        if (isRequested || tile.m_state == TileState::Uploading)
+                        {
+                            update.m_mipsInUseMask |= 1u << mipLevel;
+                        }
+                    }
+                }
+            }
+
+            // Evict the tiles once the frames which may have sampled them are complete
+            while (!m_pendingEvictions.empty() && m_frameIndex - m_pendingEvictions.front().first > RHI::Limits::Device::FrameCountMax)
+            {
+                const RHI::StreamingImageTile& evictedTile = m_pendingEvictions.front().second;
+                Tile& tile = GetTile(evictedTile.m_mipLevel, evictedTile.m_x, evictedTile.m_y);
+                if (tile.m_state == TileState::Evicting)
+                {
+                    tile.m_state = TileState::NonResident;
+                    update.m_evictedTiles.push_back(evictedTile);
+                }
+                m_pendingEvictions.pop_front();
+            }
+
+            // Make the requested tiles resident, from the least detailed mip, once the tile containing them is resident
+            const uint32_t uploadId = m_nextUploadId;
+            for (uint32_t mipLevel = tiledMipCount; mipLevel-- > 0 && update.m_residentTiles.size() < maxUploadCount;)
+            {
+                const RHI::Size& mipTileCount = m_tileLayout.m_mipTileCounts[mipLevel];
+                bool checkedMipData = false;
+                for (uint32_t tileY = 0; tileY < mipTileCount.m_height && update.m_residentTiles.size() < maxUploadCount; ++tileY)
+                {
+                    for (uint32_t tileX = 0; tileX < mipTileCount.m_width && update.m_residentTiles.size() < maxUploadCount; ++tileX)
+                    {
+                        Tile& tile = GetTile(mipLevel, tileX, tileY);
+                        if (tile.m_state != TileState::NonResident || !IsRequested(tile, evictionFrameCount))
+                        {
+                            continue;
+                        }
+
+                        if (mipLevel + 1 < tiledMipCount)
+                        {
+                            const RHI::Size& parentTileCount = m_tileLayout.m_mipTileCounts[mipLevel + 1];
+                            const Tile& parentTile = GetTile(mipLevel + 1, AZStd::min(tileX / 2, parentTileCount.m_width - 1), AZStd::min(tileY / 2, parentTileCount.m_height - 1));
+                            if (parentTile.m_state != TileState::Resident)
+                            {
+                                continue;
+                            }
+                        }
+
+                        if (!checkedMipData)
+                        {
+                            checkedMipData = true;
+                            if (!isMipDataReady(mipLevel))
+                            {
+                                // Try again once the mip data is loaded
+                                tileY = mipTileCount.m_height;
+                                break;
+                            }
+                        }
+
+                        tile.m_state = TileState::Uploading;
+                        tile.m_uploadId = uploadId;
+                        update.m_residentTiles.push_back(RHI::StreamingImageTile{ mipLevel, tileX, tileY });
+                    }
+                }
+            }
+
+            if (!update.m_residentTiles.empty())
+            {
+                update.m_uploadId = uploadId;
+                m_nextUploadId++;
+            }
+
+            if (m_isResidencyDirty)
+            {
+                UpdateResidencyBuffer();
+            }
+
+            ++m_frameIndex;
+        }
+
+        void StreamingImageTiles::UpdateResidencyBuffer()
+        {
+            const uint32_t tiledMipCount = GetTiledMipCount();
+            const RHI::Size& mip0TileCount = GetTileCount(0);
+            uint32_t* residentMips = m_residencyData.data() + ResidencyHeaderSize / sizeof(uint32_t);
+
+            for (uint32_t tileY = 0; tileY < mip0TileCount.m_height; ++tileY)
+            {
+                for (uint32_t tileX = 0; tileX < mip0TileCount.m_width; ++tileX)
+                {
+                    uint32_t residentMip = tiledMipCount;
+                    while (residentMip > 0)
+                    {
+                        const uint32_t mipLevel = residentMip - 1;
+                        const RHI::Size& mipTileCount = m_tileLayout.m_mipTileCounts[mipLevel];
+                        const Tile& tile = GetTile(mipLevel, AZStd::min(tileX >> mipLevel, mipTileCount.m_width - 1), AZStd::min(tileY >> mipLevel, mipTileCount.m_height - 1));
+                        if (tile.m_state != TileState::Resident)
+                        {
+                            break;
+                        }
+                        residentMip = mipLevel;
+                    }
+                    residentMips[tileY * mip0TileCount.m_width + tileX] = residentMip;
+                }
+            }
+
+            if (m_residencyBuffer)
+            {
+                m_residencyBuffer->UpdateData(m_residencyData.data(), m_residencyData.size() * sizeof(uint32_t), 0);
+            }
+            m_isResidencyDirty = false;
+        }
+    } // namespace RPI
+} // namespace AZ
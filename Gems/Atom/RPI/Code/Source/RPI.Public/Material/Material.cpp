@@ -8,6 +8,7 @@
 
 #include <Atom/RPI.Public/ColorManagement/TransformColor.h>
 #include <Atom/RPI.Public/Material/Material.h>
+#include <Atom/RPI.Public/Material/MaterialDataBuffer.h>
 #include <Atom/RPI.Reflect/Image/AttachmentImageAsset.h>
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
@@ -24,10 +25,17 @@
 #include <AtomCore/Instance/InstanceDatabase.h>
 #include <AtomCore/Utils/ScopedValue.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Name/NameDictionary.h>
+
 namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(bool, r_bindlessMaterials, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Write material data to the bindless material data buffer, so shaders can read materials without binding their ShaderResourceGroups. "
+            "Read when materials are initialized.");
+
         const char* Material::s_debugTraceName = "Material";
 
         Data::Instance<Material> Material::FindOrCreate(const Data::Asset<MaterialAsset>& materialAsset)
@@ -60,6 +68,7 @@ namespace AZ
             ScopedValue isInitializing(&m_isInitializing, true, false);
 
             // All of these members must be reset if the material can be reinitialized because of the shader reload notification bus
+            ReleaseMaterialData();
             m_shaderResourceGroup = {};
             m_rhiShaderResourceGroup = {};
             m_materialProperties = {};
@@ -131,6 +140,8 @@ namespace AZ
                     return true;
                 });
 
+            InitMaterialData();
+
             // Usually SetProperties called above will increment this change ID to invalidate
             // the material, but some materials might not have any properties, and we need
             // the material to be invalidated particularly when hot-reloading.
@@ -144,6 +155,103 @@ namespace AZ
         Material::~Material()
         {
             ShaderReloadNotificationBus::MultiHandler::BusDisconnect();
+            ReleaseMaterialData();
+        }
+
+        void Material::InitMaterialData()
+        {
+            if (!r_bindlessMaterials || !m_shaderResourceGroup)
+            {
+                return;
+            }
+
+            MaterialDataBuffer* materialDataBuffer = MaterialDataBuffer::Get();
+            if (!materialDataBuffer)
+            {
+                return;
+            }
+
+            const RHI::ShaderResourceGroupLayout* srgLayout = m_shaderResourceGroup->GetLayout();
+            m_materialDataSlot = materialDataBuffer->AllocateSlot(srgLayout->GetConstantDataSize(), srgLayout->GetGroupSizeForImages());
+            if (m_materialDataSlot.IsNull())
+            {
+                return;
+            }
+
+            // The SRG can be skipped only if no shader binds it, and every shader can locate the material data instead.
+            static const Name materialDataOffsetName = Name::FromStringLiteral(MaterialDataBuffer::OffsetRootConstantName, Interface<NameDictionary>::Get());
+            const uint32_t materialSrgBindingSlot = srgLayout->GetBindingSlot();
+            bool usesBindlessMaterialDataOnly = true;
+            ForAllShaderItems(
+                [&](const Name&, const ShaderCollection::Item& shaderItem)
+                {
+                    const Data::Asset<ShaderAsset>& shaderAsset = shaderItem.GetShaderAsset();
+                    const RHI::PipelineLayoutDescriptor* pipelineLayout = shaderAsset->GetPipelineLayoutDescriptor();
+                    const RHI::ConstantsLayout* rootConstantsLayout = pipelineLayout ? pipelineLayout->GetRootConstantsLayout() : nullptr;
+                    usesBindlessMaterialDataOnly = !shaderAsset->FindShaderResourceGroupLayout(materialSrgBindingSlot) &&
+                        rootConstantsLayout && rootConstantsLayout->FindShaderInputIndex(materialDataOffsetName).IsValid();
+                    return usesBindlessMaterialDataOnly;
+                });
+            m_usesBindlessMaterialDataOnly = usesBindlessMaterialDataOnly;
+        }
+
+        void Material::ReleaseMaterialData()
+        {
+            if (MaterialDataBuffer* materialDataBuffer = MaterialDataBuffer::Get())
+            {
+                materialDataBuffer->ReleaseSlot(m_materialDataSlot);
+            }
+            m_materialDataSlot = RHI::VirtualAddress::CreateNull();
+            m_isMaterialDataSlotWritten = false;
+            m_usesBindlessMaterialDataOnly = false;
+        }
+
+        bool Material::WriteMaterialData()
+        {
+            MaterialDataBuffer* materialDataBuffer = MaterialDataBuffer::Get();
+            if (m_materialDataSlot.IsNull() || !materialDataBuffer)
+            {
+                return false;
+            }
+
+            // Frames in flight may still read the written slot, so the new data goes to a new slot. The released slot is only
+            // reused once those frames are done, and the draw packets pick up the new slot offset as the change id was bumped.
+            if (m_isMaterialDataSlotWritten)
+            {
+                const RHI::ShaderResourceGroupLayout* srgLayout = m_shaderResourceGroup->GetLayout();
+                const RHI::VirtualAddress newSlot = materialDataBuffer->AllocateSlot(srgLayout->GetConstantDataSize(), srgLayout->GetGroupSizeForImages());
+                materialDataBuffer->ReleaseSlot(m_materialDataSlot);
+                m_materialDataSlot = newSlot;
+                if (m_materialDataSlot.IsNull())
+                {
+                    ReleaseMaterialData();
+                    return false;
+                }
+            }
+
+            const RHI::ShaderResourceGroupData& srgData = m_shaderResourceGroup->GetData();
+            const AZStd::span<const RHI::ConstPtr<RHI::ImageView>> imageViews = srgData.GetImageGroup();
+
+            AZStd::vector<uint32_t> imageIndices;
+            imageIndices.reserve(imageViews.size());
+            for (const RHI::ConstPtr<RHI::ImageView>& imageView : imageViews)
+            {
+                imageIndices.push_back(imageView ? imageView->GetBindlessReadIndex() : RHI::InvalidIndex);
+            }
+
+            materialDataBuffer->WriteSlot(m_materialDataSlot, srgData.GetConstantData(), imageIndices);
+            m_isMaterialDataSlotWritten = true;
+            return true;
+        }
+
+        uint32_t Material::GetMaterialDataOffset() const
+        {
+            return m_materialDataSlot.IsValid() ? aznumeric_cast<uint32_t>(m_materialDataSlot.m_ptr) : RHI::InvalidIndex;
+        }
+
+        bool Material::UsesBindlessMaterialDataOnly() const
+        {
+            return m_usesBindlessMaterialDataOnly;
         }
 
         const ShaderCollection& Material::GetGeneralShaderCollection() const
@@ -295,7 +403,8 @@ namespace AZ
 
         bool Material::CanCompile() const
         {
-            return m_materialAsset.IsReady() && (!m_shaderResourceGroup || !m_shaderResourceGroup->IsQueuedForCompile());
+            return m_materialAsset.IsReady() &&
+                (!m_shaderResourceGroup || m_usesBindlessMaterialDataOnly || !m_shaderResourceGroup->IsQueuedForCompile());
         }
 
         ///////////////////////////////////////////////////////////////////
@@ -622,7 +731,10 @@ namespace AZ
                     materialPipelinePair.second.m_materialProperties.ClearAllPropertyDirtyFlags();
                 }
 
-                if (m_shaderResourceGroup)
+                // Without a material data slot the draws bind the material SRG, so it must be compiled.
+                WriteMaterialData();
+
+                if (m_shaderResourceGroup && !m_usesBindlessMaterialDataOnly)
                 {
                     m_shaderResourceGroup->Compile();
                 }
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Material/MaterialDataBuffer.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+
+#include <Atom/RHI/Device.h>
+#include <Atom/RHI/RHISystemInterface.h>
+#include <Atom/RHI.Reflect/Limits.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        AZ_CVAR(uint32_t, r_bindlessMaterialBufferSize, 16 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Size in bytes of the global buffer holding the data of bindless materials. Read when the buffer is first created.");
+
+        MaterialDataBuffer* MaterialDataBuffer::Get()
+        {
+            return Interface<MaterialDataBuffer>::Get();
+        }
+
+        MaterialDataBuffer::~MaterialDataBuffer()
+        {
+            AZ_Assert(!m_isInitialized, "MaterialDataBuffer was not shut down");
+        }
+
+        void MaterialDataBuffer::Init()
+        {
+            Interface<MaterialDataBuffer>::Register(this);
+            m_isInitialized = true;
+        }
+
+        void MaterialDataBuffer::Shutdown()
+        {
+            if (!m_isInitialized)
+            {
+                return;
+            }
+
+            Interface<MaterialDataBuffer>::Unregister(this);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            AZ_Warning("MaterialDataBuffer", m_allocator.GetAllocationCount() == 0 || !m_isBufferCreated,
+                "%zu material slots are still allocated at shutdown", m_allocator.GetAllocationCount());
+            if (m_isBufferCreated)
+            {
+                m_allocator.Shutdown();
+            }
+            m_bufferView = nullptr;
+            m_buffer = nullptr;
+            m_bindlessReadIndex = RHI::InvalidIndex;
+            m_shadowData = {};
+            m_dirtyBegin = m_dirtyEnd = 0;
+            m_isAvailable = false;
+            m_isBufferCreated = false;
+            m_isInitialized = false;
+        }
+
+        bool MaterialDataBuffer::IsAvailable()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (!m_isBufferCreated && m_isInitialized)
+            {
+                m_isAvailable = CreateBuffer();
+                m_isBufferCreated = true;
+            }
+            return m_isAvailable;
+        }
+
+        bool MaterialDataBuffer::CreateBuffer()
+        {
+            RHI::RHISystemInterface* rhiSystem = RHI::RHISystemInterface::Get();
+            if (!rhiSystem || !rhiSystem->GetDevice() || !rhiSystem->GetDevice()->GetFeatures().m_unboundedArrays)
+            {
+                AZ_Warning("MaterialDataBuffer", false, "Bindless materials require unbounded array support. Materials will use their ShaderResourceGroups.");
+                return false;
+            }
+
+            BufferSystemInterface* bufferSystem = BufferSystemInterface::Get();
+            if (!bufferSystem)
+            {
+                return false;
+            }
+
+            const uint32_t bufferSize = AZ::SizeAlignUp(static_cast<uint32_t>(r_bindlessMaterialBufferSize), SlotAlignment);
+
+            CommonBufferDescriptor descriptor;
+            descriptor.m_bufferName = "BindlessMaterialData";
+            descriptor.m_poolType = CommonBufferPoolType::ReadOnly;
+            descriptor.m_elementSize = sizeof(uint32_t);
+            descriptor.m_byteCount = bufferSize;
+            m_buffer = bufferSystem->CreateBufferFromCommonPool(descriptor);
+            if (!m_buffer)
+            {
+                AZ_Error("MaterialDataBuffer", false, "Failed to create the bindless material data buffer");
+                return false;
+            }
+
+            m_bufferView = m_buffer->GetRHIBuffer()->GetBufferView(RHI::BufferViewDescriptor::CreateRaw(0, bufferSize));
+            if (!m_bufferView)
+            {
+                m_buffer = nullptr;
+                return false;
+            }
+            m_bindlessReadIndex = m_bufferView->GetBindlessReadIndex();
+
+            RHI::FreeListAllocator::Descriptor allocatorDescriptor;
+            allocatorDescriptor.m_addressBase = RHI::VirtualAddress::CreateZero();
+            allocatorDescriptor.m_capacityInBytes = bufferSize;
+            allocatorDescriptor.m_alignmentInBytes = SlotAlignment;
+            allocatorDescriptor.m_garbageCollectLatency = RHI::Limits::Device::FrameCountMax;
+            m_allocator.Init(allocatorDescriptor);
+
+            m_shadowData.resize(bufferSize, 0);
+            return true;
+        }
+
+        uint32_t MaterialDataBuffer::GetSlotSize(uint32_t constantDataSize, uint32_t imageCount)
+        {
+            return static_cast<uint32_t>(sizeof(SlotHeader) + AZ::SizeAlignUp(constantDataSize, sizeof(uint32_t)) + imageCount * sizeof(uint32_t));
+        }
+
+        RHI::VirtualAddress MaterialDataBuffer::AllocateSlot(uint32_t constantDataSize, uint32_t imageCount)
+        {
+            if (!IsAvailable())
+            {
+                return RHI::VirtualAddress::CreateNull();
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            RHI::VirtualAddress slot = m_allocator.Allocate(GetSlotSize(constantDataSize, imageCount), SlotAlignment);
+            AZ_Warning("MaterialDataBuffer", slot.IsValid(),
+                "The bindless material data buffer is full. Increase r_bindlessMaterialBufferSize, the material will use its ShaderResourceGroup.");
+            return slot;
+        }
+
+        void MaterialDataBuffer::ReleaseSlot(RHI::VirtualAddress slot)
+        {
+            if (slot.IsValid())
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                m_allocator.DeAllocate(slot);
+            }
+        }
+
+        void MaterialDataBuffer::WriteSlot(RHI::VirtualAddress slot, AZStd::span<const uint8_t> constantData, AZStd::span<const uint32_t> imageIndices)
+        {
+            if (!slot.IsValid())
+            {
+                return;
+            }
+
+            SlotHeader header;
+            header.m_imageIndicesOffset = static_cast<uint32_t>(sizeof(SlotHeader)) + AZ::SizeAlignUp(static_cast<uint32_t>(constantData.size()), sizeof(uint32_t));
+            header.m_imageCount = static_cast<uint32_t>(imageIndices.size());
+
+            const size_t slotBegin = slot.m_ptr;
+            const size_t slotEnd = slotBegin + header.m_imageIndicesOffset + imageIndices.size() * sizeof(uint32_t);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            AZ_Assert(slotEnd <= m_shadowData.size(), "Material slot is out of the bindless material data buffer");
+
+            uint8_t* slotData = m_shadowData.data() + slotBegin;
+            ::memcpy(slotData, &header, sizeof(SlotHeader));
+            if (!constantData.empty())
+            {
+                ::memcpy(slotData + sizeof(SlotHeader), constantData.data(), constantData.size());
+            }
+            if (!imageIndices.empty())
+            {
+                ::memcpy(slotData + header.m_imageIndicesOffset, imageIndices.data(), imageIndices.size() * sizeof(uint32_t));
+            }
+
+            if (m_dirtyBegin == m_dirtyEnd)
+            {
+                m_dirtyBegin = slotBegin;
+                m_dirtyEnd = slotEnd;
+            }
+            else
+            {
+                m_dirtyBegin = AZStd::min(m_dirtyBegin, slotBegin);
+                m_dirtyEnd = AZStd::max(m_dirtyEnd, slotEnd);
+            }
+        }
+
+        uint32_t MaterialDataBuffer::GetBindlessReadIndex() const
+        {
+            return m_bindlessReadIndex;
+        }
+
+        void MaterialDataBuffer::FrameUpdate()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (!m_isAvailable)
+            {
+                return;
+            }
+
+            if (m_dirtyBegin != m_dirtyEnd)
+            {
+                // Buffer updates must be 4 byte aligned.
+                const size_t begin = AZ::SizeAlignDown(m_dirtyBegin, sizeof(uint32_t));
+                const size_t end = AZ::SizeAlignUp(m_dirtyEnd, sizeof(uint32_t));
+                m_buffer->UpdateData(m_shadowData.data() + begin, end - begin, begin);
+                m_dirtyBegin = m_dirtyEnd = 0;
+            }
+
+            m_allocator.GarbageCollect();
+        }
+    } // namespace RPI
+} // namespace AZ
@@ -46,11 +46,19 @@ namespace AZ
                 return Material::CreateInternal(*(azrtti_cast<MaterialAsset*>(materialAsset)));
             };
             Data::InstanceDatabase<Material>::Create(azrtti_typeid<MaterialAsset>(), handler);
+
+            m_materialDataBuffer.Init();
         }
 
         void MaterialSystem::Shutdown()
         {
             Data::InstanceDatabase<Material>::Destroy();
+            m_materialDataBuffer.Shutdown();
+        }
+
+        void MaterialSystem::FrameUpdate()
+        {
+            m_materialDataBuffer.FrameUpdate();
         }
 
     } // namespace RPI
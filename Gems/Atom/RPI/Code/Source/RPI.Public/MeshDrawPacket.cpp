@@ -8,13 +8,16 @@
 
 #include <Atom/RPI.Public/MeshDrawPacket.h>
 #include <Atom/RPI.Public/RPIUtils.h>
+#include <Atom/RPI.Public/Material/MaterialDataBuffer.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
 #include <Atom/RPI.Public/Scene.h>
 #include <Atom/RPI.Reflect/Material/MaterialFunctor.h>
 #include <Atom/RHI/DrawPacketBuilder.h>
+#include <Atom/RHI/PipelineStateCache.h>
 #include <Atom/RHI/RHISystemInterface.h>
 #include <AzCore/Console/Console.h>
+#include <AzCore/Name/NameDictionary.h>
 #include <Atom/RPI.Public/Shader/ShaderReloadDebugTracker.h>
 
 namespace AZ
@@ -29,6 +32,14 @@ namespace AZ
             "(For Testing) Forces usage of root shader variant in the mesh draw packet level, ignoring any other shader variants that may exist."
         );
 
+        AZ_CVAR(bool,
+            r_meshAsyncPipelineStateCompile,
+            false,
+            [](const bool&) { AZ::Interface<AZ::IConsole>::Get()->PerformCommand("MeshFeatureProcessor.ForceRebuildDrawPackets"); },
+            ConsoleFunctorFlags::Null,
+            "Compiles the pipeline states of shader variants on worker threads, drawing with the root shader variant until they are ready."
+        );
+
         MeshDrawPacket::MeshDrawPacket(
             ModelLod& modelLod,
             size_t modelLodMeshIndex,
@@ -196,8 +207,22 @@ namespace AZ
             //      - MeshDrawPacket::Update() is called. But since the GetCurrentChangeId() hasn't changed since last time, DoUpdate() is not called.
             //      - The mesh continues rendering with only the "foo" change applied, indefinitely.
 
+            // Draw packets built with fallback pipeline states are rebuilt whenever one of the pipeline states they stand in
+            // for has finished compiling, until all of their own pipeline states are ready.
+            bool fallbackPipelineStatesCompiled = false;
+            if (!m_compilingPipelineStates.empty())
+            {
+                const RHI::PipelineStateCache* pipelineStateCache = RHI::RHISystemInterface::Get()->GetPipelineStateCache();
+                fallbackPipelineStatesCompiled = AZStd::any_of(
+                    m_compilingPipelineStates.begin(), m_compilingPipelineStates.end(),
+                    [pipelineStateCache](const RHI::ConstPtr<RHI::PipelineState>& pipelineState)
+                    {
+                        return !pipelineStateCache->IsPipelineStateCompiling(pipelineState.get());
+                    });
+            }
+
             if (forceUpdate || (!m_material->NeedsCompile() && m_materialChangeId != m_material->GetCurrentChangeId())
-                || m_needUpdate)
+                || m_needUpdate || fallbackPipelineStatesCompiled)
             {
                 DoUpdate(parentScene);
                 m_materialChangeId = m_material->GetCurrentChangeId();
@@ -213,6 +238,30 @@ namespace AZ
             return rootConstantsLayout && rootConstantsLayout->GetDataSize() > 0;
         }
 
+        // Writes the location of the material's bindless data to the root constants declared by BindlessMaterial.azsli, if present
+        static void WriteMaterialDataRootConstants(const Material& material, const RHI::ConstantsLayout& rootConstantsLayout, AZStd::vector<uint8_t>& rootConstants)
+        {
+            static const Name bufferIndexName = Name::FromStringLiteral(MaterialDataBuffer::BufferIndexRootConstantName, Interface<NameDictionary>::Get());
+            static const Name offsetName = Name::FromStringLiteral(MaterialDataBuffer::OffsetRootConstantName, Interface<NameDictionary>::Get());
+
+            MaterialDataBuffer* materialDataBuffer = MaterialDataBuffer::Get();
+            const uint32_t offset = material.GetMaterialDataOffset();
+            const uint32_t bufferIndex = (materialDataBuffer && offset != RHI::InvalidIndex) ? materialDataBuffer->GetBindlessReadIndex() : RHI::InvalidIndex;
+
+            auto writeConstant = [&](const Name& name, uint32_t value)
+            {
+                const RHI::ShaderInputConstantIndex inputIndex = rootConstantsLayout.FindShaderInputIndex(name);
+                if (inputIndex.IsValid())
+                {
+                    const RHI::Interval interval = rootConstantsLayout.GetInterval(inputIndex);
+                    AZ_Assert(interval.m_max - interval.m_min == sizeof(uint32_t), "Root constant %s must be a uint", name.GetCStr());
+                    ::memcpy(rootConstants.data() + interval.m_min, &value, sizeof(uint32_t));
+                }
+            };
+            writeConstant(bufferIndexName, bufferIndex);
+            writeConstant(offsetName, offset);
+        }
+
         bool MeshDrawPacket::DoUpdate(const Scene& parentScene)
         {
             const auto meshes = m_modelLod->GetMeshes();
@@ -232,7 +281,10 @@ namespace AZ
             drawPacketBuilder.SetDrawArguments(mesh.m_drawArguments);
             drawPacketBuilder.SetIndexBufferView(mesh.m_indexBufferView);
             drawPacketBuilder.AddShaderResourceGroup(m_objectSrg->GetRHIShaderResourceGroup());
-            drawPacketBuilder.AddShaderResourceGroup(m_material->GetRHIShaderResourceGroup());
+            if (!m_material->UsesBindlessMaterialDataOnly())
+            {
+                drawPacketBuilder.AddShaderResourceGroup(m_material->GetRHIShaderResourceGroup());
+            }
 
             // We build the list of used shaders in a local list rather than m_activeShaders so that
             // if DoUpdate() fails it won't modify any member data.
@@ -252,6 +304,8 @@ namespace AZ
 
             m_perDrawSrgs.clear();
 
+            AZStd::vector<RHI::ConstPtr<RHI::PipelineState>> compilingPipelineStates;
+
             auto appendShader = [&](const ShaderCollection::Item& shaderItem, const Name& materialPipelineName)
             {
                 // Skip the shader item without creating the shader instance
@@ -377,7 +431,28 @@ namespace AZ
 
                 parentScene.ConfigurePipelineState(drawListTag, pipelineStateDescriptor);
 
-                const RHI::PipelineState* pipelineState = shader->AcquirePipelineState(pipelineStateDescriptor);
+                const RHI::PipelineState* pipelineState = nullptr;
+                if (r_meshAsyncPipelineStateCompile && !variant.IsRootVariant())
+                {
+                    // The root variant supports every shader option value, so its pipeline state can stand in until the
+                    // specialized one has compiled. Only the shader stages differ, the render states are the same.
+                    RHI::PipelineStateDescriptorForDraw fallbackPipelineStateDescriptor = pipelineStateDescriptor;
+                    shader->GetRootVariant().ConfigurePipelineState(fallbackPipelineStateDescriptor);
+                    fallbackPipelineStateDescriptor.m_renderStates = pipelineStateDescriptor.m_renderStates;
+
+                    const RHI::PipelineState* fallbackPipelineState = shader->AcquirePipelineState(fallbackPipelineStateDescriptor);
+                    RHI::ConstPtr<RHI::PipelineState> compilingPipelineState;
+                    pipelineState = shader->AcquirePipelineStateAsync(pipelineStateDescriptor, fallbackPipelineState, &compilingPipelineState);
+                    if (compilingPipelineState)
+                    {
+                        compilingPipelineStates.push_back(AZStd::move(compilingPipelineState));
+                    }
+                }
+                else
+                {
+                    pipelineState = shader->AcquirePipelineState(pipelineStateDescriptor);
+                }
+
                 if (!pipelineState)
                 {
                     AZ_Error("MeshDrawPacket", false, "Shader '%s'. Failed to acquire default pipeline state", shaderItem.GetShaderAsset()->GetName().GetCStr());
@@ -392,6 +467,7 @@ namespace AZ
                     {
                         m_rootConstantsLayout = rootConstantsLayout;
                         rootConstants.resize(m_rootConstantsLayout->GetDataSize());
+                        WriteMaterialDataRootConstants(*m_material, *m_rootConstantsLayout, rootConstants);
                         drawPacketBuilder.SetRootConstants(rootConstants);
                     }
 
@@ -470,6 +546,7 @@ namespace AZ
             {
                 m_activeShaders = shaderList;
                 m_materialSrg = m_material->GetRHIShaderResourceGroup();
+                m_compilingPipelineStates = AZStd::move(compilingPipelineStates);
                 return true;
             }
             else
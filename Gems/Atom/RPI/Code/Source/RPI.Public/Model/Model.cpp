@@ -7,6 +7,7 @@
  */
 
 #include <Atom/RPI.Public/Model/Model.h>
+#include <Atom/RPI.Public/Model/ModelLodStreamingController.h>
 #include <Atom/RPI.Reflect/Model/ModelAsset.h>
 
 #include <Atom/RHI/Factory.h>
@@ -15,6 +16,7 @@
 #include <AzCore/Debug/Timer.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/std/parallel/thread.h>
 
 // Enable to show profile logs of how long it takes to raycast against models in the Editor
 //#define AZ_RPI_PROFILE_RAYCASTING_AGAINST_MODELS
@@ -30,6 +32,32 @@ namespace AZ
                 modelAsset);
         }
 
+        Data::Instance<Model> Model::FindOrCreate(const Data::Asset<ModelAsset>& modelAsset, bool allowLodStreaming)
+        {
+            const AZStd::any allowLodStreamingParam(allowLodStreaming);
+            return Data::InstanceDatabase<Model>::Instance().FindOrCreate(
+                Data::InstanceId::CreateFromAsset(modelAsset),
+                modelAsset,
+                &allowLodStreamingParam);
+        }
+
+        Model::~Model()
+        {
+            if (m_isLodStreamingEnabled)
+            {
+                if (ModelLodStreamingController* streamingController = ModelLodStreamingController::Get())
+                {
+                    streamingController->UnregisterModel(this);
+                }
+            }
+
+            // A worker thread may still be creating a lod for this model
+            while (m_streamingLod != NoLodRequested && !m_isStreamedLodReady)
+            {
+                AZStd::this_thread::yield();
+            }
+        }
+
 
         void Model::TEMPOrphanFromDatabase(const Data::Asset<ModelAsset>& modelAsset)
         {
@@ -61,11 +89,96 @@ namespace AZ
             return m_lods;
         }
 
-        Data::Instance<Model> Model::CreateInternal(const Data::Asset<ModelAsset>& modelAsset)
+        bool Model::IsLodStreamingEnabled() const
+        {
+            return m_isLodStreamingEnabled;
+        }
+
+        ModelLodIndex Model::GetMostDetailedResidentLodIndex() const
+        {
+            return ModelLodIndex(m_mostDetailedResidentLod);
+        }
+
+        void Model::RequestLod(ModelLodIndex lodIndex)
+        {
+            if (!m_isLodStreamingEnabled)
+            {
+                return;
+            }
+
+            uint32_t requestedLod = m_requestedLod.load(AZStd::memory_order_relaxed);
+            while (lodIndex.GetIndex() < requestedLod &&
+                   !m_requestedLod.compare_exchange_weak(requestedLod, lodIndex.GetIndex(), AZStd::memory_order_relaxed))
+            {
+            }
+        }
+
+        void Model::MakeAllLodsResident()
+        {
+            if (!m_isLodStreamingEnabled)
+            {
+                return;
+            }
+
+            AZ_PROFILE_SCOPE(RPI, "Model::MakeAllLodsResident - %s", GetDatabaseName());
+            ModelLodStreamingController* streamingController = ModelLodStreamingController::Get();
+            if (streamingController)
+            {
+                streamingController->UnregisterModel(this);
+            }
+            m_isLodStreamingEnabled = false;
+
+            // Let a pending lod finish streaming, it will be used below
+            while (m_streamingLod != NoLodRequested && !m_isStreamedLodReady)
+            {
+                AZStd::this_thread::yield();
+            }
+            if (m_streamingLod != NoLodRequested && m_streamedLod)
+            {
+                m_lods[m_streamingLod] = AZStd::move(m_streamedLod);
+            }
+            m_streamingLod = NoLodRequested;
+            m_streamedLod = nullptr;
+
+            const auto lodAssets = m_modelAsset->GetLodAssets();
+            for (size_t lodIndex = 0; lodIndex < m_lods.size(); ++lodIndex)
+            {
+                if (!m_lods[lodIndex])
+                {
+                    m_lods[lodIndex] = ModelLod::FindOrCreate(lodAssets[lodIndex], m_modelAsset);
+                    AZ_Error("Model", m_lods[lodIndex], "Failed to create lod %zu of model '%s'", lodIndex, m_modelAsset.GetHint().c_str());
+                }
+            }
+            m_mostDetailedResidentLod = 0;
+            m_isUploadPending = true;
+
+            if (streamingController)
+            {
+                streamingController->m_residencyChangeCount++;
+            }
+        }
+
+        void Model::AddUvName(const RHI::ShaderSemantic& semantic, const AZ::Name& customName)
+        {
+            if (semantic.m_name.GetStringView().starts_with(RHI::ShaderSemantic::UvStreamSemantic))
+            {
+                // For unnamed UVs, use the semantic instead.
+                if (customName.IsEmpty())
+                {
+                    m_uvNames.insert(AZ::Name(semantic.ToString()));
+                }
+                else
+                {
+                    m_uvNames.insert(customName);
+                }
+            }
+        }
+
+        Data::Instance<Model> Model::CreateInternal(const Data::Asset<ModelAsset>& modelAsset, const AZStd::any* allowLodStreaming)
         {
             AZ_PROFILE_SCOPE(RPI, "Model: CreateInternal");
             Data::Instance<Model> model = aznew Model();
-            const RHI::ResultCode resultCode = model->Init(modelAsset);
+            const RHI::ResultCode resultCode = model->Init(modelAsset, allowLodStreaming && AZStd::any_cast<bool>(*allowLodStreaming));
 
             if (resultCode == RHI::ResultCode::Success)
             {
@@ -75,12 +188,21 @@ namespace AZ
             return nullptr;
         }
 
-        RHI::ResultCode Model::Init(const Data::Asset<ModelAsset>& modelAsset)
+        RHI::ResultCode Model::Init(const Data::Asset<ModelAsset>& modelAsset, bool allowLodStreaming)
         {
             AZ_PROFILE_SCOPE(RPI, "Model: Init");
 
             m_lods.resize(modelAsset->GetLodAssets().size());
 
+            // Only the least detailed lods are created up front when streaming lods, see ModelLodStreamingController
+            ModelLodStreamingController* streamingController = ModelLodStreamingController::Get();
+            if (allowLodStreaming && streamingController && ModelLodStreamingController::IsLodStreamingEnabled())
+            {
+                m_firstAlwaysResidentLod = ModelLodStreamingController::GetFirstAlwaysResidentLod(aznumeric_cast<uint32_t>(m_lods.size()));
+            }
+            m_isLodStreamingEnabled = m_firstAlwaysResidentLod > 0;
+            m_mostDetailedResidentLod = m_firstAlwaysResidentLod;
+
             for (size_t lodIndex = 0; lodIndex < m_lods.size(); ++lodIndex)
             {
                 const auto lodAssets = modelAsset->GetLodAssets();
@@ -92,6 +214,24 @@ namespace AZ
                     return RHI::ResultCode::Fail;
                 }
 
+                if (m_isLodStreamingEnabled)
+                {
+                    m_lodByteCounts.push_back(ModelLodStreamingController::GetLodByteCount(*lodAsset));
+                }
+
+                if (lodIndex < m_mostDetailedResidentLod)
+                {
+                    // The lod is streamed in later, get the UV names from the asset.
+                    for (const ModelLodAsset::Mesh& mesh : lodAsset->GetMeshes())
+                    {
+                        for (const ModelLodAsset::Mesh::StreamBufferInfo& stream : mesh.GetStreamBufferInfoList())
+                        {
+                            AddUvName(stream.m_semantic, stream.m_customName);
+                        }
+                    }
+                    continue;
+                }
+
                 Data::Instance<ModelLod> lodInstance = ModelLod::FindOrCreate(lodAsset, modelAsset);
                 if (lodInstance == nullptr)
                 {
@@ -102,18 +242,7 @@ namespace AZ
                 {
                     for (const AZ::RPI::ModelLod::StreamBufferInfo& stream : mesh.m_streamInfo)
                     {
-                        if (stream.m_semantic.m_name.GetStringView().starts_with(RHI::ShaderSemantic::UvStreamSemantic))
-                        {
-                            // For unnamed UVs, use the semantic instead.
-                            if (stream.m_customName.IsEmpty())
-                            {
-                                m_uvNames.insert(AZ::Name(stream.m_semantic.ToString()));
-                            }
-                            else
-                            {
-                                m_uvNames.insert(stream.m_customName);
-                            }
-                        }
+                        AddUvName(stream.m_semantic, stream.m_customName);
                     }
                 }
 
@@ -122,6 +251,11 @@ namespace AZ
 
             m_modelAsset = modelAsset;
             m_isUploadPending = true;
+
+            if (m_isLodStreamingEnabled)
+            {
+                streamingController->RegisterModel(this);
+            }
             return RHI::ResultCode::Success;
         }
 
@@ -132,7 +266,11 @@ namespace AZ
                 AZ_PROFILE_SCOPE(RPI, "Model::WaitForUpload - %s", GetDatabaseName());
                 for (const Data::Instance<ModelLod>& lod : m_lods)
                 {
-                    lod->WaitForUpload();
+                    // Streamed lods are only made resident once their upload is complete
+                    if (lod)
+                    {
+                        lod->WaitForUpload();
+                    }
                 }
                 m_isUploadPending = false;
             }
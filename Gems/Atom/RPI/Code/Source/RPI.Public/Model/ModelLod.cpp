@@ -8,6 +8,8 @@
 
 #include <Atom/RPI.Public/Model/ModelLod.h>
 #include <Atom/RPI.Public/Material/Material.h>
+#include <Atom/RPI.Reflect/Model/MeshletCluster.h>
+#include <Atom/RPI.Reflect/Model/ModelAssetHelpers.h>
 
 #include <Atom/RHI/Factory.h>
 #include <Atom/RHI.Reflect/InputStreamLayoutBuilder.h>
@@ -99,6 +101,16 @@ namespace AZ
                 // [GFX TODO][ATOM-838]: We need to figure out how to load only the required streams from disk rather than all available streams.
                 for (const auto& streamBufferInfo : mesh.GetStreamBufferInfoList())
                 {
+                    // The meshlet clusters are never bound as a vertex stream
+                    if (streamBufferInfo.m_semantic.m_name.GetStringView() == ShaderSemanticName_MeshletClusters)
+                    {
+                        if (!SetMeshletClusterData(streamBufferInfo, meshInstance))
+                        {
+                            return RHI::ResultCode::InvalidOperation;
+                        }
+                        continue;
+                    }
+
                     if (!SetMeshInstanceData(streamBufferInfo, meshInstance))
                     {
                         return RHI::ResultCode::InvalidOperation;
@@ -402,6 +414,31 @@ namespace AZ
             return true;
         }
 
+        bool ModelLod::SetMeshletClusterData(
+            const ModelLodAsset::Mesh::StreamBufferInfo& streamBufferInfo,
+            Mesh& meshInstance)
+        {
+            const Data::Instance<Buffer>& clusterBuffer = Buffer::FindOrCreate(streamBufferInfo.m_bufferAssetView.GetBufferAsset());
+            if (clusterBuffer == nullptr)
+            {
+                AZ_Error("ModelLod", false, "Failed to create meshlet cluster buffer! Possibly out of memory!");
+                return false;
+            }
+
+            const RHI::BufferViewDescriptor& bufferViewDescriptor = streamBufferInfo.m_bufferAssetView.GetBufferViewDescriptor();
+            if (bufferViewDescriptor.m_elementSize != sizeof(MeshletCluster))
+            {
+                AZ_Error("ModelLod", false, "Meshlet cluster buffer has an element size of %u, expected %zu.", bufferViewDescriptor.m_elementSize, sizeof(MeshletCluster));
+                return false;
+            }
+
+            meshInstance.m_meshletClusterBufferView = clusterBuffer->GetRHIBuffer()->GetBufferView(bufferViewDescriptor);
+            meshInstance.m_meshletClusterCount = bufferViewDescriptor.m_elementCount;
+            TrackBuffer(clusterBuffer);
+
+            return true;
+        }
+
         void ModelLod::WaitForUpload()
         {
             if (m_isUploadPending)
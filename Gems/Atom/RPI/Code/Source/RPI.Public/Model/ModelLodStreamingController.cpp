@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Model/ModelLodStreamingController.h>
+#include <Atom/RPI.Public/Model/Model.h>
+#include <Atom/RPI.Public/Model/ModelLod.h>
+#include <Atom/RPI.Reflect/Model/ModelLodAsset.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        AZ_CVAR(bool, r_modelLodStreaming, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Enable streaming the lods of models in and out of GPU memory. Only affects models created after it is changed.");
+
+        AZ_CVAR(uint32_t, r_modelLodStreamingResidentLodCount, 1, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Number of least detailed lods of streaming models which are always resident. Only affects models created after it is changed.");
+
+        AZ_CVAR(uint32_t, r_modelLodStreamingBudgetMB, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "GPU memory budget in MB for the streamed model lods, not including the always resident lods. 0 means no budget.");
+
+        AZ_CVAR(uint32_t, r_modelLodStreamingEvictionFrameCount, 300, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Number of frames a streamed model lod stays resident after it was last requested.");
+
+        AZ_CVAR(uint32_t, r_modelLodStreamingMaxPendingLodCount, 8, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Maximum number of model lods created on worker threads at the same time.");
+
+        ModelLodStreamingController* ModelLodStreamingController::Get()
+        {
+            return Interface<ModelLodStreamingController>::Get();
+        }
+
+        bool ModelLodStreamingController::IsLodStreamingEnabled()
+        {
+            return r_modelLodStreaming;
+        }
+
+        uint32_t ModelLodStreamingController::GetFirstAlwaysResidentLod(uint32_t lodCount)
+        {
+            // At least the last lod is always resident
+            const uint32_t residentLodCount = AZStd::max<uint32_t>(r_modelLodStreamingResidentLodCount, 1);
+            return lodCount > residentLodCount ? lodCount - residentLodCount : 0;
+        }
+
+        size_t ModelLodStreamingController::GetLodByteCount(const ModelLodAsset& lodAsset)
+        {
+            // Meshes usually share their buffers, only count each buffer once
+            AZStd::unordered_set<Data::AssetId> bufferAssetIds;
+            size_t byteCount = 0;
+            auto addBuffer = [&bufferAssetIds, &byteCount](const BufferAssetView& bufferAssetView)
+            {
+                const Data::Asset<BufferAsset>& bufferAsset = bufferAssetView.GetBufferAsset();
+                if (bufferAsset.IsReady() && bufferAssetIds.insert(bufferAsset.GetId()).second)
+                {
+                    byteCount += bufferAsset->GetBuffer().size();
+                }
+            };
+
+            for (const ModelLodAsset::Mesh& mesh : lodAsset.GetMeshes())
+            {
+                addBuffer(mesh.GetIndexBufferAssetView());
+                for (const ModelLodAsset::Mesh::StreamBufferInfo& stream : mesh.GetStreamBufferInfoList())
+                {
+                    addBuffer(stream.m_bufferAssetView);
+                }
+            }
+            return byteCount;
+        }
+
+        void ModelLodStreamingController::Init()
+        {
+            Interface<ModelLodStreamingController>::Register(this);
+            m_isInitialized = true;
+        }
+
+        void ModelLodStreamingController::Shutdown()
+        {
+            if (!m_isInitialized)
+            {
+                return;
+            }
+
+            Interface<ModelLodStreamingController>::Unregister(this);
+
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+                for (Model* model : m_models)
+                {
+                    model->m_isLodStreamingEnabled = false;
+                }
+                m_models.clear();
+                m_streamedByteCount = 0;
+            }
+
+            // The lods being created hold references to instances which must be released before the instance databases are destroyed
+            while (m_pendingLodCount > 0)
+            {
+                AZStd::this_thread::yield();
+            }
+            m_isInitialized = false;
+        }
+
+        uint32_t ModelLodStreamingController::GetResidencyChangeCount() const
+        {
+            return m_residencyChangeCount;
+        }
+
+        size_t ModelLodStreamingController::GetStreamedByteCount() const
+        {
+            return m_streamedByteCount;
+        }
+
+        void ModelLodStreamingController::RegisterModel(Model* model)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            model->m_lastUsedFrame = m_frameIndex;
+            m_models.push_back(model);
+        }
+
+        void ModelLodStreamingController::UnregisterModel(Model* model)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            auto modelIter = AZStd::find(m_models.begin(), m_models.end(), model);
+            if (modelIter == m_models.end())
+            {
+                return;
+            }
+
+            for (uint32_t lodIndex = model->m_mostDetailedResidentLod; lodIndex < model->m_firstAlwaysResidentLod; ++lodIndex)
+            {
+                m_streamedByteCount -= model->m_lodByteCounts[lodIndex];
+            }
+            *modelIter = m_models.back();
+            m_models.pop_back();
+        }
+
+        bool ModelLodStreamingController::CanEvictLod(const Model& model)
+        {
+            return model.m_mostDetailedResidentLod < model.m_firstAlwaysResidentLod && model.m_streamingLod == Model::NoLodRequested;
+        }
+
+        void ModelLodStreamingController::EvictLod(Model& model)
+        {
+            AZ_Assert(CanEvictLod(model), "The lod can't be evicted");
+            const uint32_t lodIndex = model.m_mostDetailedResidentLod;
+            model.m_lods[lodIndex] = nullptr;
+            model.m_mostDetailedResidentLod = lodIndex + 1;
+            // Give the next lod a full eviction period
+            model.m_lastUsedFrame = m_frameIndex;
+            m_streamedByteCount -= model.m_lodByteCounts[lodIndex];
+            m_residencyChangeCount++;
+        }
+
+        bool ModelLodStreamingController::EvictLeastRecentlyUsedLod(const Model* excludedModel)
+        {
+            Model* leastRecentlyUsedModel = nullptr;
+            for (Model* model : m_models)
+            {
+                if (model != excludedModel && model->m_lastUsedFrame < m_frameIndex && CanEvictLod(*model) &&
+                    (!leastRecentlyUsedModel || model->m_lastUsedFrame < leastRecentlyUsedModel->m_lastUsedFrame))
+                {
+                    leastRecentlyUsedModel = model;
+                }
+            }
+
+            if (leastRecentlyUsedModel)
+            {
+                EvictLod(*leastRecentlyUsedModel);
+                return true;
+            }
+            return false;
+        }
+
+        void ModelLodStreamingController::StreamLod(Model& model)
+        {
+            const uint32_t lodIndex = model.m_mostDetailedResidentLod - 1;
+            model.m_streamingLod = lodIndex;
+            model.m_isStreamedLodReady = false;
+            m_pendingLodCount++;
+
+            // The model waits for the job to complete before it is destroyed, so it's safe to capture it
+            const auto streamLod = [this, modelPtr = &model, lodAsset = model.m_modelAsset->GetLodAssets()[lodIndex], modelAsset = model.m_modelAsset]()
+            {
+                AZ_PROFILE_SCOPE(RPI, "ModelLodStreamingController: StreamLod");
+                Data::Instance<ModelLod> lod = ModelLod::FindOrCreate(lodAsset, modelAsset);
+                if (lod)
+                {
+                    // Only make the lod resident once its buffers are uploaded, so it can be rendered right away
+                    lod->WaitForUpload();
+                }
+                modelPtr->m_streamedLod = AZStd::move(lod);
+                modelPtr->m_isStreamedLodReady = true;
+                m_pendingLodCount--;
+            };
+            AZ::Job* job = AZ::CreateJobFunction(streamLod, true);
+            job->Start();
+        }
+
+        void ModelLodStreamingController::FrameUpdate()
+        {
+            AZ_PROFILE_SCOPE(RPI, "ModelLodStreamingController: FrameUpdate");
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (m_models.empty())
+            {
+                return;
+            }
+
+            ++m_frameIndex;
+
+            // Make the lods streamed in since the last update resident, and apply the lod requests
+            uint32_t pendingLodCount = 0;
+            for (Model* model : m_models)
+            {
+                if (model->m_streamingLod != Model::NoLodRequested)
+                {
+                    if (model->m_isStreamedLodReady)
+                    {
+                        if (model->m_streamedLod)
+                        {
+                            model->m_lods[model->m_streamingLod] = AZStd::move(model->m_streamedLod);
+                            model->m_mostDetailedResidentLod = model->m_streamingLod;
+                            m_streamedByteCount += model->m_lodByteCounts[model->m_streamingLod];
+                            m_residencyChangeCount++;
+                        }
+                        else
+                        {
+                            AZ_Error("ModelLodStreamingController", false, "Failed to stream lod %u of model '%s'",
+                                model->m_streamingLod, model->m_modelAsset.GetHint().c_str());
+                        }
+                        model->m_streamingLod = Model::NoLodRequested;
+                        model->m_lastUsedFrame = m_frameIndex;
+                    }
+                    else
+                    {
+                        ++pendingLodCount;
+                    }
+                }
+
+                if (model->m_requestedLod.load(AZStd::memory_order_relaxed) <= model->m_mostDetailedResidentLod)
+                {
+                    model->m_lastUsedFrame = m_frameIndex;
+                }
+            }
+
+            // Evict the lods which weren't requested for a while
+            const uint64_t evictionFrameCount = AZStd::max<uint32_t>(r_modelLodStreamingEvictionFrameCount, 1);
+            for (Model* model : m_models)
+            {
+                if (CanEvictLod(*model) && m_frameIndex - model->m_lastUsedFrame > evictionFrameCount)
+                {
+                    EvictLod(*model);
+                }
+            }
+
+            // Stream in the next lod of models which requested more detailed lods
+            const size_t budgetByteCount = static_cast<size_t>(static_cast<uint32_t>(r_modelLodStreamingBudgetMB)) * 1024 * 1024;
+            const uint32_t maxPendingLodCount = AZStd::max<uint32_t>(r_modelLodStreamingMaxPendingLodCount, 1);
+            for (Model* model : m_models)
+            {
+                const uint32_t requestedLod = model->m_requestedLod.exchange(Model::NoLodRequested, AZStd::memory_order_relaxed);
+                if (pendingLodCount >= maxPendingLodCount || model->m_streamingLod != Model::NoLodRequested ||
+                    requestedLod >= model->m_mostDetailedResidentLod)
+                {
+                    continue;
+                }
+
+                if (budgetByteCount > 0)
+                {
+                    const size_t lodByteCount = model->m_lodByteCounts[model->m_mostDetailedResidentLod - 1];
+                    bool isWithinBudget = true;
+                    while (isWithinBudget && m_streamedByteCount + lodByteCount > budgetByteCount)
+                    {
+                        isWithinBudget = EvictLeastRecentlyUsedLod(model);
+                    }
+
+                    if (!isWithinBudget)
+                    {
+                        continue;
+                    }
+                }
+
+                StreamLod(*model);
+                ++pendingLodCount;
+            }
+        }
+    } // namespace RPI
+} // namespace AZ
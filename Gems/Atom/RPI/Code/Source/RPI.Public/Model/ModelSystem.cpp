@@ -53,15 +53,27 @@ namespace AZ
             AZ::Data::InstanceHandler<Model> modelInstanceHandler;
             modelInstanceHandler.m_createFunction = [](Data::AssetData* modelAsset)
             {
-                return Model::CreateInternal(Data::Asset<ModelAsset>{modelAsset, AZ::Data::AssetLoadBehavior::PreLoad});
+                return Model::CreateInternal(Data::Asset<ModelAsset>{modelAsset, AZ::Data::AssetLoadBehavior::PreLoad}, nullptr);
+            };
+            modelInstanceHandler.m_createFunctionWithParam = [](Data::AssetData* modelAsset, const AZStd::any* allowLodStreaming)
+            {
+                return Model::CreateInternal(Data::Asset<ModelAsset>{modelAsset, AZ::Data::AssetLoadBehavior::PreLoad}, allowLodStreaming);
             };
             Data::InstanceDatabase<Model>::Create(azrtti_typeid<ModelAsset>(), modelInstanceHandler);
+
+            m_lodStreamingController.Init();
         }
 
         void ModelSystem::Shutdown()
         {
+            m_lodStreamingController.Shutdown();
             Data::InstanceDatabase<Model>::Destroy();
             Data::InstanceDatabase<ModelLod>::Destroy();
         }
+
+        void ModelSystem::FrameUpdate()
+        {
+            m_lodStreamingController.FrameUpdate();
+        }
     } // namespace RPI
 } // namespace AZ
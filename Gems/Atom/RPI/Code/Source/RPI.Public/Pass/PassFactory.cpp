@@ -25,6 +25,7 @@
 #include <Atom/RPI.Public/Pass/Specific/EnvironmentCubeMapPass.h>
 #include <Atom/RPI.Public/Pass/Specific/RenderToTexturePass.h>
 #include <Atom/RPI.Public/Pass/Specific/SelectorPass.h>
+#include <Atom/RPI.Public/Pass/Specific/StreamingImageMipFeedbackPass.h>
 
 #include <Atom/RPI.Reflect/Pass/PassAsset.h>
 #include <Atom/RPI.Reflect/Pass/PassTemplate.h>
@@ -73,6 +74,7 @@ namespace AZ
             AddPassCreator(Name("EnvironmentCubeMapPass"), &EnvironmentCubeMapPass::Create);
             AddPassCreator(Name("RenderToTexturePass"), &RenderToTexturePass::Create);
             AddPassCreator(Name("SelectorPass"), &SelectorPass::Create);
+            AddPassCreator(Name("StreamingImageMipFeedbackPass"), &StreamingImageMipFeedbackPass::Create);
         }
 
         PassFactory::CreatorIndex PassFactory::FindCreatorIndex(Name passClassName)
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Pass/Specific/StreamingImageMipFeedbackPass.h>
+#include <Atom/RPI.Public/Image/StreamingImageMipFeedback.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        Ptr<StreamingImageMipFeedbackPass> StreamingImageMipFeedbackPass::Create(const PassDescriptor& descriptor)
+        {
+            Ptr<StreamingImageMipFeedbackPass> pass = aznew StreamingImageMipFeedbackPass(descriptor);
+            return pass;
+        }
+
+        StreamingImageMipFeedbackPass::StreamingImageMipFeedbackPass(const PassDescriptor& descriptor)
+            : RasterPass(descriptor)
+        {
+        }
+
+        void StreamingImageMipFeedbackPass::InitializeInternal()
+        {
+            RasterPass::InitializeInternal();
+
+            m_feedbackIndexInput = m_shaderResourceGroup
+                ? m_shaderResourceGroup->FindShaderInputConstantIndex(Name("m_streamingImageMipFeedbackIndex"))
+                : RHI::ShaderInputConstantIndex{};
+        }
+
+        void StreamingImageMipFeedbackPass::FrameBeginInternal(FramePrepareParams params)
+        {
+            // The feedback buffer is imported after the passes added their scopes, so it's declared once the frame graph is built
+            if (StreamingImageMipFeedback* feedback = StreamingImageMipFeedback::Get())
+            {
+                feedback->AddWriter();
+            }
+
+            RasterPass::FrameBeginInternal(params);
+        }
+
+        void StreamingImageMipFeedbackPass::SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph)
+        {
+            RasterPass::SetupFrameGraphDependencies(frameGraph);
+
+            if (StreamingImageMipFeedback* feedback = StreamingImageMipFeedback::Get())
+            {
+                feedback->UseShaderAttachment(frameGraph);
+            }
+        }
+
+        void StreamingImageMipFeedbackPass::CompileResources(const RHI::FrameGraphCompileContext& context)
+        {
+            if (m_shaderResourceGroup != nullptr && m_feedbackIndexInput.IsValid())
+            {
+                const StreamingImageMipFeedback* feedback = StreamingImageMipFeedback::Get();
+                const uint32_t feedbackIndex = feedback ? feedback->GetFeedbackBindlessIndex() : RHI::InvalidIndex;
+                m_shaderResourceGroup->SetConstant(m_feedbackIndexInput, feedbackIndex);
+            }
+
+            RasterPass::CompileResources(context);
+        }
+    }   // namespace RPI
+}   // namespace AZ
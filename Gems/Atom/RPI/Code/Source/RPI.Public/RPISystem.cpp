@@ -128,8 +128,9 @@ namespace AZ
             m_featureProcessorFactory.Shutdown();
             m_passSystem.Shutdown();
             m_dynamicDraw.Shutdown();
-            m_bufferSystem.Shutdown();
+            // The material system owns the bindless material data buffer, which must be released before the buffer pools.
             m_materialSystem.Shutdown();
+            m_bufferSystem.Shutdown();
             m_modelSystem.Shutdown();
             m_shaderSystem.Shutdown();
             m_imageSystem.Shutdown();
@@ -271,6 +272,9 @@ namespace AZ
 
             m_currentSimulationTime = GetCurrentTime();
 
+            // Model lods streamed in or evicted must be applied before the feature processors build their draw packets
+            m_modelSystem.FrameUpdate();
+
             for (auto& scene : m_scenes)
             {
                 scene->Simulate(m_simulationJobPolicy, m_currentSimulationTime);
@@ -334,6 +338,9 @@ namespace AZ
             }
             m_rhiSystem.SetNumActiveRenderPipelines(numActiveRenderPipelines);
 
+            // Materials compiled while preparing the scenes have written their bindless data
+            m_materialSystem.FrameUpdate();
+
             m_rhiSystem.FrameUpdate(
                 [this](RHI::FrameGraphBuilder& frameGraphBuilder)
                 {
@@ -341,6 +348,9 @@ namespace AZ
                     // scope producers only can be added to the frame when frame started which cleans up previous scope producers.
                     m_passSystem.FrameUpdate(frameGraphBuilder);
 
+                    // Reads back the mips sampled by the scopes of the passes
+                    m_imageSystem.FrameUpdate(frameGraphBuilder);
+
                     // Update Scene and View Srgs
                     for (auto& scenePtr : m_scenes)
                     {
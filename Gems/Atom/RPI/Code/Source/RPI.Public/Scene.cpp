@@ -155,6 +155,7 @@ namespace AZ
             {
                 fp->Activate();
             }
+            m_featureProcessorDependenciesDirty = true;
 
             m_dynamicDrawSystem = static_cast<DynamicDrawSystem*>(RPI::DynamicDrawInterface::Get());
         }
@@ -242,6 +243,7 @@ namespace AZ
             }
 
             m_featureProcessors.emplace_back(AZStd::move(fp));
+            m_featureProcessorDependenciesDirty = true;
         }
 
         void Scene::EnableAllFeatureProcessors()
@@ -266,6 +268,7 @@ namespace AZ
                 }
 
                 m_featureProcessors.erase(foundFeatureProcessor);
+                m_featureProcessorDependenciesDirty = true;
             }
             else
             {
@@ -437,22 +440,117 @@ namespace AZ
             return nullptr;
         }
 
+        void Scene::UpdateFeatureProcessorDependencies()
+        {
+            if (!m_featureProcessorDependenciesDirty)
+            {
+                return;
+            }
+            m_featureProcessorDependenciesDirty = false;
+
+            const uint32_t featureProcessorCount = aznumeric_cast<uint32_t>(m_featureProcessors.size());
+            AZStd::vector<FeatureProcessor::SceneDataAccess> accesses(featureProcessorCount);
+            for (uint32_t featureProcessorIndex = 0; featureProcessorIndex < featureProcessorCount; ++featureProcessorIndex)
+            {
+                m_featureProcessors[featureProcessorIndex]->GetSceneDataAccess(accesses[featureProcessorIndex]);
+            }
+
+            auto contains = [](const AZStd::vector<Name>& names, const Name& name)
+            {
+                return AZStd::find(names.begin(), names.end(), name) != names.end();
+            };
+
+            // two feature processors conflict if either of them writes data the other one reads or writes
+            auto conflicts = [&contains](const FeatureProcessor::SceneDataAccess& first, const FeatureProcessor::SceneDataAccess& second)
+            {
+                for (const Name& write : first.m_writes)
+                {
+                    if (contains(second.m_reads, write) || contains(second.m_writes, write))
+                    {
+                        return true;
+                    }
+                }
+                for (const Name& write : second.m_writes)
+                {
+                    if (contains(first.m_reads, write))
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            };
+
+            // the group of a feature processor is tracked with a union-find over the conflicting feature processors
+            AZStd::vector<uint32_t> groupRoots(featureProcessorCount);
+            for (uint32_t featureProcessorIndex = 0; featureProcessorIndex < featureProcessorCount; ++featureProcessorIndex)
+            {
+                groupRoots[featureProcessorIndex] = featureProcessorIndex;
+            }
+            auto findGroupRoot = [&groupRoots](uint32_t index)
+            {
+                while (groupRoots[index] != index)
+                {
+                    groupRoots[index] = groupRoots[groupRoots[index]];
+                    index = groupRoots[index];
+                }
+                return index;
+            };
+
+            m_featureProcessorDependencies.clear();
+            m_featureProcessorDependencies.resize(featureProcessorCount);
+            for (uint32_t featureProcessorIndex = 0; featureProcessorIndex < featureProcessorCount; ++featureProcessorIndex)
+            {
+                // feature processors run after the earlier feature processors they conflict with, which keeps the order they were added in
+                for (uint32_t earlierIndex = 0; earlierIndex < featureProcessorIndex; ++earlierIndex)
+                {
+                    if (conflicts(accesses[earlierIndex], accesses[featureProcessorIndex]))
+                    {
+                        m_featureProcessorDependencies[featureProcessorIndex].push_back(earlierIndex);
+
+                        uint32_t earlierRoot = findGroupRoot(earlierIndex);
+                        uint32_t root = findGroupRoot(featureProcessorIndex);
+                        groupRoots[AZStd::max(earlierRoot, root)] = AZStd::min(earlierRoot, root);
+                    }
+                }
+            }
+
+            m_featureProcessorGroups.clear();
+            AZStd::vector<uint32_t> groupIndices(featureProcessorCount, aznumeric_cast<uint32_t>(-1));
+            for (uint32_t featureProcessorIndex = 0; featureProcessorIndex < featureProcessorCount; ++featureProcessorIndex)
+            {
+                uint32_t root = findGroupRoot(featureProcessorIndex);
+                if (groupIndices[root] == aznumeric_cast<uint32_t>(-1))
+                {
+                    groupIndices[root] = aznumeric_cast<uint32_t>(m_featureProcessorGroups.size());
+                    m_featureProcessorGroups.emplace_back();
+                }
+                m_featureProcessorGroups[groupIndices[root]].push_back(m_featureProcessors[featureProcessorIndex].get());
+            }
+        }
+
         void Scene::SimulateTaskGraph()
         {
             static const AZ::TaskDescriptor simulationTGDesc{"RPI::Scene::Simulate", "Graphics"};
             AZ::TaskGraph simulationTG{ "RPI::Scene::Simulate" };
 
-            for (FeatureProcessorPtr& fp : m_featureProcessors)
+            AZStd::vector<AZ::TaskToken> simulationTokens;
+            simulationTokens.reserve(m_featureProcessors.size());
+            for (size_t featureProcessorIndex = 0; featureProcessorIndex < m_featureProcessors.size(); ++featureProcessorIndex)
             {
-                FeatureProcessor* featureProcessor = fp.get();
-                simulationTG.AddTask(
+                FeatureProcessor* featureProcessor = m_featureProcessors[featureProcessorIndex].get();
+                simulationTokens.push_back(simulationTG.AddTask(
                     simulationTGDesc,
                     [this, featureProcessor]()
                     {
                         FeatureProcessor::SimulatePacket jobPacket = m_simulatePacket;
                         jobPacket.m_parentJob = nullptr;
                         featureProcessor->Simulate(jobPacket);
-                    });
+                    }));
+
+                for (uint32_t dependencyIndex : m_featureProcessorDependencies[featureProcessorIndex])
+                {
+                    simulationTokens[dependencyIndex].Precedes(simulationTokens[featureProcessorIndex]);
+                }
             }
             simulationTG.Detach();
             m_simulationFinishedTGEvent = AZStd::make_unique<TaskGraphEvent>("RPI::Scene::Simulate Wait");
@@ -464,14 +562,17 @@ namespace AZ
             // Create a new job to track completion.
             m_simulationCompletion = aznew AZ::JobCompletion();
 
-            for (FeatureProcessorPtr& fp : m_featureProcessors)
+            // Each group of dependent feature processors runs in one job, in the order the feature processors were added
+            for (const AZStd::vector<FeatureProcessor*>& featureProcessorGroup : m_featureProcessorGroups)
             {
-                FeatureProcessor* featureProcessor = fp.get();
-                const auto jobLambda = [this, featureProcessor](AZ::Job& owner)
+                const auto jobLambda = [this, featureProcessorGroup](AZ::Job& owner)
                 {
                     FeatureProcessor::SimulatePacket jobPacket = m_simulatePacket;
                     jobPacket.m_parentJob = &owner;
-                    featureProcessor->Simulate(jobPacket);
+                    for (FeatureProcessor* featureProcessor : featureProcessorGroup)
+                    {
+                        featureProcessor->Simulate(jobPacket);
+                    }
                 };
 
                 AZ::Job* simulationJob = AZ::CreateJobFunction(AZStd::move(jobLambda), true, nullptr);  //auto-deletes
@@ -515,6 +616,7 @@ namespace AZ
             }
             else
             {
+                UpdateFeatureProcessorDependencies();
                 if (m_taskGraphActive)
                 {
                     SimulateTaskGraph();
@@ -575,15 +677,22 @@ namespace AZ
             AZ::TaskGraph collectDrawPacketsTG{ "CollectDrawPackets" };
 
             // Launch FeatureProcessor::Render() taskgraphs
-            for (auto& fp : m_featureProcessors)
+            AZStd::vector<AZ::TaskToken> renderTokens;
+            renderTokens.reserve(m_featureProcessors.size());
+            for (size_t featureProcessorIndex = 0; featureProcessorIndex < m_featureProcessors.size(); ++featureProcessorIndex)
             {
-                collectDrawPacketsTG.AddTask( 
+                FeatureProcessor* featureProcessor = m_featureProcessors[featureProcessorIndex].get();
+                renderTokens.push_back(collectDrawPacketsTG.AddTask(
                     collectDrawPacketsTGDesc,
-                    [this, &fp]()
+                    [this, featureProcessor]()
                     {
-                        fp->Render(m_renderPacket);
-                    });
+                        featureProcessor->Render(m_renderPacket);
+                    }));
 
+                for (uint32_t dependencyIndex : m_featureProcessorDependencies[featureProcessorIndex])
+                {
+                    renderTokens[dependencyIndex].Precedes(renderTokens[featureProcessorIndex]);
+                }
             }
             collectDrawPacketsTG.Submit(&collectDrawPacketsTGEvent);
 
@@ -634,12 +743,15 @@ namespace AZ
             AZ_PROFILE_SCOPE(RPI, "CollectDrawPacketsJobs");
             AZ::JobCompletion* collectDrawPacketsCompletion = aznew AZ::JobCompletion();
 
-            // Launch FeatureProcessor::Render() jobs
-            for (auto& fp : m_featureProcessors)
+            // Launch FeatureProcessor::Render() jobs, one per group of dependent feature processors
+            for (const AZStd::vector<FeatureProcessor*>& featureProcessorGroup : m_featureProcessorGroups)
             {
-                const auto renderLambda = [this, &fp]()
+                const auto renderLambda = [this, &featureProcessorGroup]()
                 {
-                    fp->Render(m_renderPacket);
+                    for (FeatureProcessor* featureProcessor : featureProcessorGroup)
+                    {
+                        featureProcessor->Render(m_renderPacket);
+                    }
                 };
 
                 AZ::Job* renderJob = AZ::CreateJobFunction(AZStd::move(renderLambda), true, nullptr);    //auto-deletes
@@ -805,6 +917,7 @@ namespace AZ
             }
 
             {
+                UpdateFeatureProcessorDependencies();
 
                 if (m_taskGraphActive)
                 {
@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Shader/PipelineStateUsageRecorder.h>
+#include <Atom/RPI.Public/Shader/Shader.h>
+#include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
+
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        AZ_CVAR(bool, r_pipelineStateUsageRecording, false, nullptr, ConsoleFunctorFlags::DontReplicate,
+            "Records every pipeline state acquired from a shader, so the list can be used to prewarm pipeline states in later sessions.");
+        AZ_CVAR(AZ::CVarFixedString, r_pipelineStateUsageFile, "@user@/Atom/PipelineStateUsage.xml", nullptr, ConsoleFunctorFlags::DontReplicate,
+            "File the recorded pipeline state usage is saved to on shutdown when r_pipelineStateUsageRecording is enabled.");
+        AZ_CVAR(AZ::CVarFixedString, r_pipelineStatePrewarmFile, "", nullptr, ConsoleFunctorFlags::DontReplicate,
+            "Recorded pipeline state usage list whose pipeline states are compiled in the background at startup.");
+
+        static void r_savePipelineStateUsage(const AZ::ConsoleCommandContainer& arguments)
+        {
+            const AZStd::string filePath = arguments.empty() ? AZStd::string(static_cast<AZ::CVarFixedString>(r_pipelineStateUsageFile).c_str())
+                                                             : AZStd::string(arguments.front());
+            ShaderSystemInterface::Get()->GetPipelineStateUsageRecorder().SaveRecordedPipelineStates(filePath);
+        }
+        AZ_CONSOLEFREEFUNC(r_savePipelineStateUsage, ConsoleFunctorFlags::DontReplicate,
+            "Saves the recorded pipeline state usage to the given file, or to r_pipelineStateUsageFile if no file is given.");
+
+        static void r_prewarmPipelineStates(const AZ::ConsoleCommandContainer& arguments)
+        {
+            if (arguments.empty())
+            {
+                AZ_Warning("PipelineStateUsageRecorder", false, "r_prewarmPipelineStates requires the path of a recorded pipeline state usage list.");
+                return;
+            }
+            ShaderSystemInterface::Get()->GetPipelineStateUsageRecorder().Prewarm(AZStd::string(arguments.front()));
+        }
+        AZ_CONSOLEFREEFUNC(r_prewarmPipelineStates, ConsoleFunctorFlags::DontReplicate,
+            "Compiles the pipeline states of a recorded pipeline state usage list in the background, e.g. when loading a level.");
+
+        namespace
+        {
+            // Shader variants are streamed in asynchronously. Give up on a variant after this many ticks and compile
+            // the best match available instead, which is what would be drawn with until the variant loads anyway.
+            constexpr uint32_t PrewarmAttemptCountMax = 600;
+
+            AZ::IO::FixedMaxPath ResolvePipelineStateUsagePath(const AZStd::string& filePath)
+            {
+                AZ::IO::FixedMaxPath resolvedPath(filePath);
+                if (AZ::IO::FileIOBase* fileIOBase = AZ::IO::FileIOBase::GetInstance())
+                {
+                    fileIOBase->ResolvePath(resolvedPath, AZ::IO::PathView(filePath));
+                }
+                return resolvedPath;
+            }
+        }
+
+        void PipelineStateUsage::Reflect(ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<PipelineStateUsage>()
+                    ->Version(0)
+                    ->Field("ShaderAssetId", &PipelineStateUsage::m_shaderAssetId)
+                    ->Field("SupervariantIndex", &PipelineStateUsage::m_supervariantIndex)
+                    ->Field("ShaderVariantId", &PipelineStateUsage::m_shaderVariantId)
+                    ->Field("RenderStates", &PipelineStateUsage::m_renderStates)
+                    ->Field("InputStreamLayout", &PipelineStateUsage::m_inputStreamLayout)
+                    ->Field("RenderAttachmentConfiguration", &PipelineStateUsage::m_renderAttachmentConfiguration)
+                    ;
+            }
+        }
+
+        void PipelineStateUsageList::Reflect(ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<PipelineStateUsageList>()
+                    ->Version(0)
+                    ->Field("PipelineStates", &PipelineStateUsageList::m_pipelineStates)
+                    ;
+            }
+        }
+
+        void PipelineStateUsageRecorder::Reflect(ReflectContext* context)
+        {
+            PipelineStateUsage::Reflect(context);
+            PipelineStateUsageList::Reflect(context);
+        }
+
+        PipelineStateUsageRecorder::~PipelineStateUsageRecorder()
+        {
+            Shutdown();
+        }
+
+        void PipelineStateUsageRecorder::Init()
+        {
+            const AZ::CVarFixedString prewarmFile = r_pipelineStatePrewarmFile;
+            if (!prewarmFile.empty())
+            {
+                Prewarm(AZStd::string(prewarmFile.c_str()));
+            }
+        }
+
+        void PipelineStateUsageRecorder::Shutdown()
+        {
+            AZ::TickBus::Handler::BusDisconnect();
+
+            if (IsRecording())
+            {
+                const AZ::CVarFixedString usageFile = r_pipelineStateUsageFile;
+                SaveRecordedPipelineStates(AZStd::string(usageFile.c_str()));
+            }
+
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
+                m_recordedPipelineStateHashes.clear();
+                m_recordedPipelineStates.m_pipelineStates.clear();
+            }
+
+            m_queuedPrewarmFiles.clear();
+            m_pendingPipelineStates.clear();
+            m_prewarmedShaders.clear();
+        }
+
+        bool PipelineStateUsageRecorder::IsRecording()
+        {
+            return r_pipelineStateUsageRecording;
+        }
+
+        void PipelineStateUsageRecorder::RecordPipelineState(const Shader& shader, const RHI::PipelineStateDescriptor& descriptor)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
+
+            if (!m_recordedPipelineStateHashes.insert(descriptor.GetHash()).second)
+            {
+                return;
+            }
+
+            PipelineStateUsage usage;
+            if (!shader.FindVariantIdForPipelineState(descriptor, usage.m_shaderVariantId))
+            {
+                // Pipeline states configured from variants the shader no longer holds can't be replayed.
+                return;
+            }
+
+            usage.m_shaderAssetId = shader.GetAsset().GetId();
+            usage.m_supervariantIndex = shader.GetSupervariantIndex().GetIndex();
+
+            if (descriptor.GetType() == RHI::PipelineStateType::Draw)
+            {
+                const auto& descriptorForDraw = static_cast<const RHI::PipelineStateDescriptorForDraw&>(descriptor);
+                usage.m_renderStates = descriptorForDraw.m_renderStates;
+                usage.m_inputStreamLayout = descriptorForDraw.m_inputStreamLayout;
+                usage.m_renderAttachmentConfiguration = descriptorForDraw.m_renderAttachmentConfiguration;
+            }
+
+            m_recordedPipelineStates.m_pipelineStates.emplace_back(AZStd::move(usage));
+        }
+
+        bool PipelineStateUsageRecorder::SaveRecordedPipelineStates(const AZStd::string& filePath) const
+        {
+            const AZ::IO::FixedMaxPath resolvedPath = ResolvePipelineStateUsagePath(filePath);
+
+            // XML, so that lists recorded by different playthroughs can be diffed and merged before they are checked in.
+            AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
+            const bool saved = AZ::Utils::SaveObjectToFile(resolvedPath.String(), DataStream::ST_XML, &m_recordedPipelineStates);
+            AZ_Error("PipelineStateUsageRecorder", saved, "Failed to save pipeline state usage to '%s'.", resolvedPath.c_str());
+            AZ_TracePrintf("PipelineStateUsageRecorder", "Saved %zu pipeline states to '%s'.\n",
+                m_recordedPipelineStates.m_pipelineStates.size(), resolvedPath.c_str());
+            return saved;
+        }
+
+        void PipelineStateUsageRecorder::Prewarm(const AZStd::string& filePath)
+        {
+            m_queuedPrewarmFiles.push_back(filePath);
+            AZ::TickBus::Handler::BusConnect();
+        }
+
+        void PipelineStateUsageRecorder::LoadPrewarmList(const AZStd::string& filePath)
+        {
+            const AZ::IO::FixedMaxPath resolvedPath = ResolvePipelineStateUsagePath(filePath);
+
+            AZStd::unique_ptr<PipelineStateUsageList> usageList(AZ::Utils::LoadObjectFromFile<PipelineStateUsageList>(resolvedPath.String()));
+            if (!usageList)
+            {
+                AZ_Error("PipelineStateUsageRecorder", false, "Failed to load pipeline state usage from '%s'.", resolvedPath.c_str());
+                return;
+            }
+
+            m_pendingPipelineStates.reserve(m_pendingPipelineStates.size() + usageList->m_pipelineStates.size());
+            for (PipelineStateUsage& usage : usageList->m_pipelineStates)
+            {
+                PendingPipelineState& pendingPipelineState = m_pendingPipelineStates.emplace_back();
+                pendingPipelineState.m_shaderAsset =
+                    Data::AssetManager::Instance().GetAsset<ShaderAsset>(usage.m_shaderAssetId, Data::AssetLoadBehavior::PreLoad);
+                pendingPipelineState.m_usage = AZStd::move(usage);
+            }
+
+            AZ_TracePrintf("PipelineStateUsageRecorder", "Prewarming %zu pipeline states from '%s'.\n",
+                usageList->m_pipelineStates.size(), resolvedPath.c_str());
+        }
+
+        bool PipelineStateUsageRecorder::PrewarmPipelineState(PendingPipelineState& pendingPipelineState)
+        {
+            Data::Asset<ShaderAsset>& shaderAsset = pendingPipelineState.m_shaderAsset;
+            if (!shaderAsset.IsReady())
+            {
+                // Drop pipeline states of shaders that were removed since the list was recorded.
+                return shaderAsset.IsError() || !shaderAsset.GetId().IsValid();
+            }
+
+            const PipelineStateUsage& usage = pendingPipelineState.m_usage;
+            const SupervariantIndex supervariantIndex(usage.m_supervariantIndex);
+            Data::Instance<Shader> shader = Shader::FindOrCreate(shaderAsset, shaderAsset->GetSupervariantName(supervariantIndex));
+            if (!shader)
+            {
+                return true;
+            }
+
+            // The root variant is returned until the requested variant has been loaded.
+            const ShaderVariant& variant = shader->GetVariant(usage.m_shaderVariantId);
+            if (variant.GetShaderVariantId() != usage.m_shaderVariantId && ++pendingPipelineState.m_attemptCount < PrewarmAttemptCountMax)
+            {
+                return false;
+            }
+
+            // No fallback is needed since nothing draws with the result. Code acquiring the same pipeline state synchronously
+            // before the compile job has run gets it compiled, see RHI::PipelineStateCache::AcquirePipelineState.
+            switch (shader->GetPipelineStateType())
+            {
+            case RHI::PipelineStateType::Draw:
+            {
+                RHI::PipelineStateDescriptorForDraw descriptor;
+                variant.ConfigurePipelineState(descriptor);
+                descriptor.m_renderStates = usage.m_renderStates;
+                descriptor.m_inputStreamLayout = usage.m_inputStreamLayout;
+                descriptor.m_renderAttachmentConfiguration = usage.m_renderAttachmentConfiguration;
+                shader->AcquirePipelineStateAsync(descriptor, nullptr);
+                break;
+            }
+
+            case RHI::PipelineStateType::Dispatch:
+            {
+                RHI::PipelineStateDescriptorForDispatch descriptor;
+                variant.ConfigurePipelineState(descriptor);
+                shader->AcquirePipelineStateAsync(descriptor, nullptr);
+                break;
+            }
+
+            default:
+                break;
+            }
+
+            if (AZStd::find(m_prewarmedShaders.begin(), m_prewarmedShaders.end(), shader) == m_prewarmedShaders.end())
+            {
+                m_prewarmedShaders.emplace_back(AZStd::move(shader));
+            }
+            return true;
+        }
+
+        void PipelineStateUsageRecorder::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] ScriptTimePoint time)
+        {
+            AZ_PROFILE_SCOPE(RPI, "PipelineStateUsageRecorder: OnTick");
+
+            for (const AZStd::string& filePath : m_queuedPrewarmFiles)
+            {
+                LoadPrewarmList(filePath);
+            }
+            m_queuedPrewarmFiles.clear();
+
+            for (size_t i = 0; i < m_pendingPipelineStates.size();)
+            {
+                if (PrewarmPipelineState(m_pendingPipelineStates[i]))
+                {
+                    m_pendingPipelineStates[i] = AZStd::move(m_pendingPipelineStates.back());
+                    m_pendingPipelineStates.pop_back();
+                }
+                else
+                {
+                    ++i;
+                }
+            }
+
+            if (m_pendingPipelineStates.empty())
+            {
+                AZ::TickBus::Handler::BusDisconnect();
+            }
+        }
+    } // namespace RPI
+} // namespace AZ
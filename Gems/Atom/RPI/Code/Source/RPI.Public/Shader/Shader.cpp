@@ -11,6 +11,7 @@
 #include <Atom/RHI/PipelineStateCache.h>
 #include <Atom/RHI/RHISystemInterface.h>
 #include <AtomCore/Instance/InstanceDatabase.h>
+#include <Atom/RPI.Public/Shader/PipelineStateUsageRecorder.h>
 #include <Atom/RPI.Public/Shader/ShaderReloadDebugTracker.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
@@ -439,9 +440,73 @@ namespace AZ
 
         const RHI::PipelineState* Shader::AcquirePipelineState(const RHI::PipelineStateDescriptor& descriptor) const
         {
+            RecordPipelineStateUsage(descriptor);
             return m_pipelineStateCache->AcquirePipelineState(m_pipelineLibraryHandle, descriptor);
         }
 
+        const RHI::PipelineState* Shader::AcquirePipelineStateAsync(
+            const RHI::PipelineStateDescriptor& descriptor,
+            const RHI::PipelineState* fallbackPipelineState,
+            RHI::ConstPtr<RHI::PipelineState>* compilingPipelineState) const
+        {
+            RecordPipelineStateUsage(descriptor);
+            return m_pipelineStateCache->AcquirePipelineStateAsync(
+                m_pipelineLibraryHandle, descriptor, fallbackPipelineState, compilingPipelineState);
+        }
+
+        void Shader::RecordPipelineStateUsage(const RHI::PipelineStateDescriptor& descriptor) const
+        {
+            if (PipelineStateUsageRecorder::IsRecording())
+            {
+                ShaderSystemInterface::Get()->GetPipelineStateUsageRecorder().RecordPipelineState(*this, descriptor);
+            }
+        }
+
+        bool Shader::FindVariantIdForPipelineState(const RHI::PipelineStateDescriptor& descriptor, ShaderVariantId& shaderVariantId) const
+        {
+            // The descriptor doesn't reference the variant, but every variant has its own shader stage functions.
+            RHI::ShaderStage shaderStage = RHI::ShaderStage::Unknown;
+            const RHI::ShaderStageFunction* shaderStageFunction = nullptr;
+            switch (descriptor.GetType())
+            {
+            case RHI::PipelineStateType::Draw:
+                shaderStage = RHI::ShaderStage::Vertex;
+                shaderStageFunction = static_cast<const RHI::PipelineStateDescriptorForDraw&>(descriptor).m_vertexFunction.get();
+                break;
+
+            case RHI::PipelineStateType::Dispatch:
+                shaderStage = RHI::ShaderStage::Compute;
+                shaderStageFunction = static_cast<const RHI::PipelineStateDescriptorForDispatch&>(descriptor).m_computeFunction.get();
+                break;
+
+            default:
+                return false;
+            }
+
+            auto usesShaderStageFunction = [shaderStage, shaderStageFunction](const ShaderVariant& shaderVariant)
+            {
+                return shaderVariant.GetShaderVariantAsset() &&
+                    shaderVariant.GetShaderVariantAsset()->GetShaderStageFunction(shaderStage) == shaderStageFunction;
+            };
+
+            if (usesShaderStageFunction(m_rootVariant))
+            {
+                shaderVariantId = m_rootVariant.GetShaderVariantId();
+                return true;
+            }
+
+            AZStd::shared_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+            for (const auto& stableIdAndVariant : m_shaderVariants)
+            {
+                if (usesShaderStageFunction(stableIdAndVariant.second))
+                {
+                    shaderVariantId = stableIdAndVariant.second.GetShaderVariantId();
+                    return true;
+                }
+            }
+            return false;
+        }
+
         const RHI::Ptr<RHI::ShaderResourceGroupLayout>& Shader::FindShaderResourceGroupLayout(const Name& shaderResourceGroupName) const
         {
             return m_asset->FindShaderResourceGroupLayout(shaderResourceGroupName, m_supervariantIndex);
@@ -180,6 +180,11 @@ namespace AZ
             return m_shaderResourceGroup.get();
         }
 
+        const RHI::ShaderResourceGroupData& ShaderResourceGroup::GetData() const
+        {
+            return m_data;
+        }
+
         bool ShaderResourceGroup::SetShaderVariantKeyFallbackValue(const ShaderVariantKey& shaderKey)
         {
             uint32_t keySize = GetLayout()->GetShaderVariantKeyFallbackSize();
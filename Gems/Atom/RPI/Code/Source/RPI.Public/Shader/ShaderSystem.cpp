@@ -41,6 +41,7 @@ namespace AZ
             ShaderVariantTreeAsset::Reflect(context);
             ReflectShaderStageType(context);
             PrecompiledShaderAssetSourceData::Reflect(context);
+            PipelineStateUsageRecorder::Reflect(context);
         }
 
         ShaderSystemInterface* ShaderSystemInterface::Get()
@@ -89,10 +90,15 @@ namespace AZ
             }
 
             ShaderReloadDebugTracker::Init();
+
+            m_pipelineStateUsageRecorder.Init();
         }
 
         void ShaderSystem::Shutdown()
         {
+            // Releases the prewarmed shaders, so must happen before the shader instance database is destroyed.
+            m_pipelineStateUsageRecorder.Shutdown();
+
             ShaderReloadDebugTracker::Shutdown();
             Data::InstanceDatabase<Shader>::Destroy();
             Data::InstanceDatabase<ShaderResourceGroup>::Destroy();
@@ -156,6 +162,16 @@ namespace AZ
         {
             return m_supervariantName;
         }
+
+        PipelineStateUsageRecorder& ShaderSystem::GetPipelineStateUsageRecorder()
+        {
+            return m_pipelineStateUsageRecorder;
+        }
+
+        ShaderVariantAsyncLoader& ShaderSystem::GetShaderVariantAsyncLoader()
+        {
+            return m_shaderVariantAsyncLoader;
+        }
         ///////////////////////////////////////////////////////////////////
 
     } // namespace RPI
@@ -7,8 +7,14 @@
  */
 #include <Atom/RPI.Public/Shader/ShaderVariantAsyncLoader.h>
 
+#include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
+#include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
+
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
 
 #include <Atom/RHI/Factory.h>
 
@@ -18,6 +24,21 @@ namespace AZ
     {
         AZ_CVAR(uint32_t, r_ShaderVariantAsyncLoader_ServiceLoopDelayOverride_ms, 0, nullptr, ConsoleFunctorFlags::Null,
             "Override the delay between iterations of checking for shader variant assets. 0 means use the default value (1000ms).");
+        AZ_CVAR(bool, r_shaderVariantMissRecording, false, nullptr, ConsoleFunctorFlags::DontReplicate,
+            "Records the requested shader variants that are not baked, so they can be added to the .shadervariantlist files of the project.");
+        AZ_CVAR(AZ::CVarFixedString, r_shaderVariantMissFolder, "@user@/Atom/MissingShaderVariants", nullptr, ConsoleFunctorFlags::DontReplicate,
+            "Folder the recorded shader variants are saved to on shutdown when r_shaderVariantMissRecording is enabled.");
+
+        static void r_saveMissingShaderVariants(const AZ::ConsoleCommandContainer& arguments)
+        {
+            const AZStd::string folderPath = arguments.empty() ? AZStd::string(static_cast<AZ::CVarFixedString>(r_shaderVariantMissFolder).c_str())
+                                                               : AZStd::string(arguments.front());
+            ShaderSystemInterface::Get()->GetShaderVariantAsyncLoader().SaveMissingShaderVariants(folderPath);
+        }
+        AZ_CONSOLEFREEFUNC(r_saveMissingShaderVariants, ConsoleFunctorFlags::DontReplicate,
+            "Saves the recorded shader variants to the given folder, or to r_shaderVariantMissFolder if no folder is given.");
+
+        static constexpr const char* ShaderVariantListSourceExtension = "shadervariantlist";
 
         static Data::AssetId GetShaderVariantAssetUuidFromShaderVariantTreeId(const Data::AssetId& shaderVariantTreeAssetId, const AZ::Name& supervariantName, ShaderVariantStableId stableId)
         {
@@ -146,6 +167,10 @@ namespace AZ
                         // Get the stableId from the variant tree.
                         auto searchResult = shaderVariantTreeAsset->FindVariantStableId(
                             tupleItor->m_shaderAsset->GetShaderOptionGroupLayout(), tupleItor->m_shaderVariantId);
+                        if (r_shaderVariantMissRecording)
+                        {
+                            RecordShaderVariantMiss(*tupleItor, searchResult);
+                        }
                         if (searchResult.IsRoot())
                         {
                             tupleItor = newShaderVariantPendingRequests.erase(tupleItor);
@@ -220,6 +245,12 @@ namespace AZ
             m_serviceThread.join();
             Data::AssetBus::MultiHandler::BusDisconnect();
 
+            if (r_shaderVariantMissRecording)
+            {
+                const AZ::CVarFixedString missFolder = r_shaderVariantMissFolder;
+                SaveMissingShaderVariants(AZStd::string(missFolder.c_str()));
+            }
+
             m_newShaderVariantPendingRequests.clear();
             m_shaderVariantTreePendingRequests.clear();
             m_shaderVariantPendingRequests.clear();
@@ -387,6 +418,102 @@ namespace AZ
             Init();
         }
 
+        void ShaderVariantAsyncLoader::RecordShaderVariantMiss(
+            const TupleShaderAssetAndShaderVariantId& request, const ShaderVariantSearchResult& searchResult)
+        {
+            // The options left unspecified by the request stay dynamic in any variant, so only the options the request
+            // specifies but the tree doesn't bake make it a miss.
+            uint32_t unspecifiedOptionCount = 0;
+            for (const ShaderOptionDescriptor& option : request.m_shaderAsset->GetShaderOptionGroupLayout()->GetShaderOptions())
+            {
+                if ((request.m_shaderVariantId.m_mask & option.GetBitMask()).none())
+                {
+                    ++unspecifiedOptionCount;
+                }
+            }
+
+            if (searchResult.GetDynamicOptionCount() <= unspecifiedOptionCount)
+            {
+                return;
+            }
+
+            AZStd::lock_guard<decltype(m_missedVariantsMutex)> lock(m_missedVariantsMutex);
+            m_missedVariants[request.m_shaderAsset.GetId()].insert(request.m_shaderVariantId);
+        }
+
+        bool ShaderVariantAsyncLoader::SaveMissingShaderVariants(const AZStd::string& folderPath) const
+        {
+            AZ::IO::FixedMaxPath resolvedFolder(folderPath);
+            if (AZ::IO::FileIOBase* fileIOBase = AZ::IO::FileIOBase::GetInstance())
+            {
+                fileIOBase->ResolvePath(resolvedFolder, AZ::IO::PathView(folderPath));
+            }
+
+            AZStd::lock_guard<decltype(m_missedVariantsMutex)> lock(m_missedVariantsMutex);
+
+            bool saved = true;
+            size_t variantCount = 0;
+            for (const auto& [shaderAssetId, variantIds] : m_missedVariants)
+            {
+                Data::Asset<ShaderAsset> shaderAsset = Data::AssetManager::Instance().FindAsset<ShaderAsset>(shaderAssetId, Data::AssetLoadBehavior::Default);
+                AZStd::string shaderProductPath;
+                AZ::Data::AssetCatalogRequestBus::BroadcastResult(shaderProductPath, &AZ::Data::AssetCatalogRequests::GetAssetPathById, shaderAssetId);
+                if (!shaderAsset.IsReady() || shaderProductPath.empty())
+                {
+                    // The shader was released or removed, and its options can't be named anymore.
+                    continue;
+                }
+
+                // The product folder of a shader mirrors the scan folder subpath of its .shader file, which the
+                // ShaderVariantListBuilder resolves as is.
+                AZ::IO::Path shaderPath(shaderProductPath, AZ::IO::PosixPathSeparator);
+                shaderPath.ReplaceExtension("shader");
+                AZ::IO::FixedMaxPath listPath = resolvedFolder / shaderPath.ParentPath() / shaderPath.Stem();
+                listPath.ReplaceExtension(ShaderVariantListSourceExtension);
+
+                rapidjson::Document document(rapidjson::kObjectType);
+                auto& allocator = document.GetAllocator();
+                document.AddMember("Shader", rapidjson::Value(shaderPath.c_str(), allocator), allocator);
+
+                // Stable ids only need to be unique within the list. They must be renumbered when merged into an existing list.
+                rapidjson::Value variants(rapidjson::kArrayType);
+                uint32_t stableId = 1;
+                const ShaderOptionGroupLayout* layout = shaderAsset->GetShaderOptionGroupLayout();
+                for (const ShaderVariantId& variantId : variantIds)
+                {
+                    const ShaderOptionGroup optionGroup(layout, variantId);
+                    rapidjson::Value options(rapidjson::kObjectType);
+                    for (const ShaderOptionDescriptor& option : layout->GetShaderOptions())
+                    {
+                        const ShaderOptionValue value = option.Get(optionGroup);
+                        if (!value.IsValid())
+                        {
+                            continue;
+                        }
+                        const Name valueName = option.GetValueName(value);
+                        options.AddMember(
+                            rapidjson::Value(option.GetName().GetCStr(), allocator), rapidjson::Value(valueName.GetCStr(), allocator), allocator);
+                    }
+
+                    rapidjson::Value variant(rapidjson::kObjectType);
+                    variant.AddMember("StableId", stableId++, allocator);
+                    variant.AddMember("Options", AZStd::move(options), allocator);
+                    variants.PushBack(AZStd::move(variant), allocator);
+                }
+                document.AddMember("Variants", AZStd::move(variants), allocator);
+
+                auto writeOutcome = JsonSerializationUtils::WriteJsonFile(document, listPath.Native());
+                AZ_Error(LogName, writeOutcome.IsSuccess(), "Failed to save missing shader variants to '%s': %s",
+                    listPath.c_str(), writeOutcome.IsSuccess() ? "" : writeOutcome.GetError().c_str());
+                saved = saved && writeOutcome.IsSuccess();
+                variantCount += variantIds.size();
+            }
+
+            AZ_TracePrintf(LogName, "Saved %zu missing shader variants of %zu shaders to '%s'.\n",
+                variantCount, m_missedVariants.size(), resolvedFolder.c_str());
+            return saved;
+        }
+
         ///////////////////////////////////////////////////////////////////
 
 
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Reflect/Model/MeshletCluster.h>
+
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+
+namespace AZ::RPI
+{
+    namespace
+    {
+        constexpr uint32_t InvalidClusterIndex = 0xFFFFFFFF;
+
+        Vector3 GetPosition(AZStd::span<const float> positions, uint32_t vertexIndex)
+        {
+            return Vector3::CreateFromFloat3(&positions[vertexIndex * 3]);
+        }
+
+        //! Returns the unnormalized face normal of a triangle from its winding.
+        Vector3 GetTriangleNormal(AZStd::span<const float> positions, const uint32_t* triangle)
+        {
+            const Vector3 p0 = GetPosition(positions, triangle[0]);
+            return (GetPosition(positions, triangle[1]) - p0).Cross(GetPosition(positions, triangle[2]) - p0);
+        }
+
+        void CalculateClusterBounds(MeshletCluster& cluster, AZStd::span<const uint32_t> indices, AZStd::span<const float> positions)
+        {
+            const AZStd::span<const uint32_t> clusterIndices = indices.subspan(cluster.m_indexOffset, cluster.m_triangleCount * 3);
+
+            Aabb aabb = Aabb::CreateNull();
+            for (const uint32_t vertexIndex : clusterIndices)
+            {
+                aabb.AddPoint(GetPosition(positions, vertexIndex));
+            }
+
+            const Vector3 center = aabb.GetCenter();
+            float radiusSq = 0.0f;
+            for (const uint32_t vertexIndex : clusterIndices)
+            {
+                radiusSq = AZStd::max(radiusSq, GetPosition(positions, vertexIndex).GetDistanceSq(center));
+            }
+
+            center.StoreToFloat3(cluster.m_center);
+            cluster.m_radius = AZStd::sqrt(radiusSq);
+
+            // The cone axis is the average of the triangle normals, and its angle covers all of them.
+            // Degenerate triangles are never rasterized so they don't constrain the cone.
+            Vector3 coneAxis = Vector3::CreateZero();
+            for (size_t index = 0; index < clusterIndices.size(); index += 3)
+            {
+                const Vector3 normal = GetTriangleNormal(positions, &clusterIndices[index]);
+                if (normal.GetLengthSq() > Constants::FloatEpsilon)
+                {
+                    coneAxis += normal.GetNormalized();
+                }
+            }
+
+            cluster.m_coneCutoff = MeshletClusterConstants::s_coneCutoffDisabled;
+            if (coneAxis.GetLengthSq() <= Constants::FloatEpsilon)
+            {
+                return;
+            }
+
+            coneAxis.Normalize();
+            float minNormalDot = 1.0f;
+            for (size_t index = 0; index < clusterIndices.size(); index += 3)
+            {
+                const Vector3 normal = GetTriangleNormal(positions, &clusterIndices[index]);
+                if (normal.GetLengthSq() > Constants::FloatEpsilon)
+                {
+                    minNormalDot = AZStd::min(minNormalDot, normal.GetNormalized().Dot(coneAxis));
+                }
+            }
+
+            coneAxis.StoreToFloat3(cluster.m_coneAxis);
+
+            // A cone wider than a hemisphere always has front facing triangles
+            if (minNormalDot > 0.0f)
+            {
+                // The view direction must be within 90 degrees minus the cone angle of the axis, the sine of the cone angle.
+                cluster.m_coneCutoff = AZStd::sqrt(1.0f - minNormalDot * minNormalDot);
+            }
+        }
+    } // namespace
+
+    AZStd::vector<MeshletCluster> BuildMeshletClusters(AZStd::span<const uint32_t> indices, AZStd::span<const float> positions)
+    {
+        AZStd::vector<MeshletCluster> clusters;
+
+        const size_t vertexCount = positions.size() / 3;
+        const size_t triangleCount = indices.size() / 3;
+        if (triangleCount == 0)
+        {
+            return clusters;
+        }
+
+        // The cluster which last used each vertex, to count the unique vertices of the cluster being built
+        AZStd::vector<uint32_t> vertexClusterIndices(vertexCount, InvalidClusterIndex);
+
+        MeshletCluster cluster;
+        uint32_t clusterVertexCount = 0;
+
+        for (size_t triangleIndex = 0; triangleIndex < triangleCount; ++triangleIndex)
+        {
+            const uint32_t* triangle = &indices[triangleIndex * 3];
+            if (triangle[0] >= vertexCount || triangle[1] >= vertexCount || triangle[2] >= vertexCount)
+            {
+                AZ_Error("MeshletCluster", false, "Index of triangle %zu is out of the %zu vertices of the mesh.", triangleIndex, vertexCount);
+                return {};
+            }
+
+            auto countNewVertices = [&](uint32_t clusterIndex)
+            {
+                uint32_t newVertexCount = 0;
+                for (uint32_t corner = 0; corner < 3; ++corner)
+                {
+                    if (vertexClusterIndices[triangle[corner]] != clusterIndex && AZStd::find(triangle, triangle + corner, triangle[corner]) == triangle + corner)
+                    {
+                        ++newVertexCount;
+                    }
+                }
+                return newVertexCount;
+            };
+
+            uint32_t clusterIndex = aznumeric_cast<uint32_t>(clusters.size());
+            uint32_t newVertexCount = countNewVertices(clusterIndex);
+            if (cluster.m_triangleCount == MeshletClusterConstants::s_maxTriangleCount ||
+                clusterVertexCount + newVertexCount > MeshletClusterConstants::s_maxVertexCount)
+            {
+                CalculateClusterBounds(cluster, indices, positions);
+                clusters.push_back(cluster);
+
+                cluster = {};
+                cluster.m_indexOffset = aznumeric_cast<uint32_t>(triangleIndex * 3);
+                clusterVertexCount = 0;
+                ++clusterIndex;
+                newVertexCount = countNewVertices(clusterIndex);
+            }
+
+            for (uint32_t corner = 0; corner < 3; ++corner)
+            {
+                vertexClusterIndices[triangle[corner]] = clusterIndex;
+            }
+            clusterVertexCount += newVertexCount;
+            ++cluster.m_triangleCount;
+        }
+
+        CalculateClusterBounds(cluster, indices, positions);
+        clusters.push_back(cluster);
+
+        return clusters;
+    }
+} // namespace AZ::RPI
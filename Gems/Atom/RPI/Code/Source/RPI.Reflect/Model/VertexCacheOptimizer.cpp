@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Reflect/Model/VertexCacheOptimizer.h>
+
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/math.h>
+
+namespace AZ::RPI
+{
+    namespace
+    {
+        constexpr uint32_t InvalidTriangleIndex = 0xFFFFFFFF;
+        constexpr int32_t NotInCache = -1;
+        constexpr uint32_t CacheSize = VertexCacheOptimizerConstants::s_cacheSize;
+
+        // The scoring parameters of the original description of the algorithm
+        constexpr float CacheDecayPower = 1.5f;
+        constexpr float LastTriangleScore = 0.75f;
+        constexpr float ValenceBoostScale = 2.0f;
+        constexpr float ValenceBoostPower = 0.5f;
+
+        // Vertices with more remaining triangles than this all get the score of this many
+        constexpr uint32_t MaxScoredValence = 32;
+
+        struct ScoreTables
+        {
+            ScoreTables()
+            {
+                for (uint32_t cachePosition = 0; cachePosition < CacheSize; ++cachePosition)
+                {
+                    if (cachePosition < 3)
+                    {
+                        // The vertices of the last triangle get a fixed score, so the next triangle doesn't just reuse
+                        // its edge, which would turn the order into strips.
+                        m_cacheScores[cachePosition] = LastTriangleScore;
+                    }
+                    else
+                    {
+                        const float scaler = 1.0f / (CacheSize - 3);
+                        m_cacheScores[cachePosition] = AZStd::pow(1.0f - (cachePosition - 3) * scaler, CacheDecayPower);
+                    }
+                }
+
+                // Vertices with few remaining triangles are preferred, to finish them off before they leave the cache
+                m_valenceScores[0] = 0.0f;
+                for (uint32_t valence = 1; valence <= MaxScoredValence; ++valence)
+                {
+                    m_valenceScores[valence] = ValenceBoostScale * AZStd::pow(aznumeric_cast<float>(valence), -ValenceBoostPower);
+                }
+            }
+
+            float GetVertexScore(int32_t cachePosition, uint32_t remainingTriangleCount) const
+            {
+                if (remainingTriangleCount == 0)
+                {
+                    // No triangle needs the vertex anymore
+                    return -1.0f;
+                }
+
+                float score = m_valenceScores[AZStd::min(remainingTriangleCount, MaxScoredValence)];
+                if (cachePosition != NotInCache)
+                {
+                    score += m_cacheScores[cachePosition];
+                }
+                return score;
+            }
+
+            AZStd::array<float, CacheSize> m_cacheScores;
+            AZStd::array<float, MaxScoredValence + 1> m_valenceScores;
+        };
+    } // namespace
+
+    bool OptimizeVertexCache(AZStd::span<uint32_t> indices, size_t vertexCount)
+    {
+        const size_t triangleCount = indices.size() / 3;
+        if (triangleCount == 0)
+        {
+            return true;
+        }
+
+        for (size_t index = 0; index < triangleCount * 3; ++index)
+        {
+            if (indices[index] >= vertexCount)
+            {
+                AZ_Error("VertexCacheOptimizer", false, "Index %zu is out of the %zu vertices of the mesh.", index, vertexCount);
+                return false;
+            }
+        }
+
+        static const ScoreTables scoreTables;
+
+        // The triangles using each vertex. The first remainingTriangleCounts[v] entries of a vertex are the triangles not emitted yet.
+        AZStd::vector<uint32_t> remainingTriangleCounts(vertexCount, 0);
+        for (size_t index = 0; index < triangleCount * 3; ++index)
+        {
+            ++remainingTriangleCounts[indices[index]];
+        }
+
+        AZStd::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+        for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+        {
+            adjacencyOffsets[vertex + 1] = adjacencyOffsets[vertex] + remainingTriangleCounts[vertex];
+        }
+
+        AZStd::vector<uint32_t> adjacentTriangles(triangleCount * 3);
+        {
+            AZStd::vector<uint32_t> fillCounts(vertexCount, 0);
+            for (size_t index = 0; index < triangleCount * 3; ++index)
+            {
+                const uint32_t vertex = indices[index];
+                adjacentTriangles[adjacencyOffsets[vertex] + fillCounts[vertex]++] = aznumeric_cast<uint32_t>(index / 3);
+            }
+        }
+
+        AZStd::vector<int32_t> cachePositions(vertexCount, NotInCache);
+        AZStd::vector<float> vertexScores(vertexCount);
+        for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+        {
+            vertexScores[vertex] = scoreTables.GetVertexScore(NotInCache, remainingTriangleCounts[vertex]);
+        }
+
+        AZStd::vector<float> triangleScores(triangleCount);
+        AZStd::vector<bool> triangleEmitted(triangleCount, false);
+        uint32_t bestTriangle = InvalidTriangleIndex;
+        float bestScore = -1.0f;
+        for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+        {
+            const uint32_t* corners = &indices[triangle * 3];
+            triangleScores[triangle] = vertexScores[corners[0]] + vertexScores[corners[1]] + vertexScores[corners[2]];
+            if (triangleScores[triangle] > bestScore)
+            {
+                bestScore = triangleScores[triangle];
+                bestTriangle = aznumeric_cast<uint32_t>(triangle);
+            }
+        }
+
+        AZStd::vector<uint32_t> optimizedIndices;
+        optimizedIndices.reserve(triangleCount * 3);
+
+        // The vertices of the new triangle are pushed to the front, so the cache briefly holds up to 3 more entries
+        AZStd::array<uint32_t, CacheSize + 3> cache;
+        AZStd::array<uint32_t, CacheSize + 3> newCache;
+        uint32_t cacheEntryCount = 0;
+
+        size_t nextUnemittedTriangle = 0;
+        for (size_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount)
+        {
+            if (bestTriangle == InvalidTriangleIndex)
+            {
+                // None of the cached vertices has triangles left, continue with the next triangle in the original order
+                while (triangleEmitted[nextUnemittedTriangle])
+                {
+                    ++nextUnemittedTriangle;
+                }
+                bestTriangle = aznumeric_cast<uint32_t>(nextUnemittedTriangle);
+            }
+
+            const uint32_t* corners = &indices[bestTriangle * 3];
+            optimizedIndices.insert(optimizedIndices.end(), corners, corners + 3);
+            triangleEmitted[bestTriangle] = true;
+
+            uint32_t newCacheEntryCount = 0;
+            for (uint32_t corner = 0; corner < 3; ++corner)
+            {
+                const uint32_t vertex = corners[corner];
+
+                // Move the triangle out of the remaining triangles of the vertex
+                const uint32_t begin = adjacencyOffsets[vertex];
+                const uint32_t end = begin + remainingTriangleCounts[vertex];
+                for (uint32_t adjacency = begin; adjacency < end; ++adjacency)
+                {
+                    if (adjacentTriangles[adjacency] == bestTriangle)
+                    {
+                        AZStd::swap(adjacentTriangles[adjacency], adjacentTriangles[end - 1]);
+                        --remainingTriangleCounts[vertex];
+                        break;
+                    }
+                }
+
+                if (AZStd::find(newCache.begin(), newCache.begin() + newCacheEntryCount, vertex) == newCache.begin() + newCacheEntryCount)
+                {
+                    newCache[newCacheEntryCount++] = vertex;
+                }
+            }
+
+            for (uint32_t entry = 0; entry < cacheEntryCount; ++entry)
+            {
+                const uint32_t vertex = cache[entry];
+                if (AZStd::find(corners, corners + 3, vertex) == corners + 3)
+                {
+                    newCache[newCacheEntryCount++] = vertex;
+                }
+            }
+
+            // Rescore the vertices of the cache, including the ones that just fell out of it, and the triangles using them
+            for (uint32_t entry = 0; entry < newCacheEntryCount; ++entry)
+            {
+                const uint32_t vertex = newCache[entry];
+                cachePositions[vertex] = entry < CacheSize ? aznumeric_cast<int32_t>(entry) : NotInCache;
+
+                const float newScore = scoreTables.GetVertexScore(cachePositions[vertex], remainingTriangleCounts[vertex]);
+                const float scoreDelta = newScore - vertexScores[vertex];
+                vertexScores[vertex] = newScore;
+
+                const uint32_t begin = adjacencyOffsets[vertex];
+                const uint32_t end = begin + remainingTriangleCounts[vertex];
+                for (uint32_t adjacency = begin; adjacency < end; ++adjacency)
+                {
+                    triangleScores[adjacentTriangles[adjacency]] += scoreDelta;
+                }
+            }
+
+            // The next triangle is the best one using a cached vertex. Triangles outside the cache only lost score since they were last compared.
+            bestTriangle = InvalidTriangleIndex;
+            bestScore = -1.0f;
+            for (uint32_t entry = 0; entry < AZStd::min(newCacheEntryCount, CacheSize); ++entry)
+            {
+                const uint32_t vertex = newCache[entry];
+                const uint32_t begin = adjacencyOffsets[vertex];
+                const uint32_t end = begin + remainingTriangleCounts[vertex];
+                for (uint32_t adjacency = begin; adjacency < end; ++adjacency)
+                {
+                    const uint32_t triangle = adjacentTriangles[adjacency];
+                    if (triangleScores[triangle] > bestScore)
+                    {
+                        bestScore = triangleScores[triangle];
+                        bestTriangle = triangle;
+                    }
+                }
+            }
+
+            cacheEntryCount = AZStd::min(newCacheEntryCount, CacheSize);
+            AZStd::copy(newCache.begin(), newCache.begin() + cacheEntryCount, cache.begin());
+        }
+
+        AZStd::copy(optimizedIndices.begin(), optimizedIndices.end(), indices.begin());
+        return true;
+    }
+
+    float CalculateAverageCacheMissRatio(AZStd::span<const uint32_t> indices, size_t vertexCount, uint32_t cacheSize)
+    {
+        const size_t triangleCount = indices.size() / 3;
+        if (triangleCount == 0 || cacheSize == 0)
+        {
+            return 0.0f;
+        }
+
+        // A FIFO cache, where a vertex is cached if it entered the cache less than cacheSize misses ago
+        AZStd::vector<size_t> cacheEntryTimes(vertexCount, 0);
+        size_t missCount = 0;
+        for (size_t index = 0; index < triangleCount * 3; ++index)
+        {
+            const uint32_t vertex = indices[index];
+            if (vertex >= vertexCount)
+            {
+                continue;
+            }
+
+            if (cacheEntryTimes[vertex] == 0 || missCount - cacheEntryTimes[vertex] >= cacheSize)
+            {
+                ++missCount;
+                cacheEntryTimes[vertex] = missCount;
+            }
+        }
+
+        return aznumeric_cast<float>(missCount) / aznumeric_cast<float>(triangleCount);
+    }
+} // namespace AZ::RPI
@@ -85,10 +85,20 @@ namespace UnitTest
         public:
             AZ_CLASS_ALLOCATOR(ImageView, AZ::SystemAllocator);
 
+            uint32_t GetBindlessReadIndex() const override { return m_bindlessReadIndex; }
+
         private:
-            AZ::RHI::ResultCode InitInternal(AZ::RHI::Device&, const AZ::RHI::Resource&) override { return AZ::RHI::ResultCode::Success; }
+            AZ::RHI::ResultCode InitInternal(AZ::RHI::Device&, const AZ::RHI::Resource&) override
+            {
+                // Unique per view, like the bindless indices of a device
+                static uint32_t s_nextBindlessReadIndex = 0;
+                m_bindlessReadIndex = s_nextBindlessReadIndex++;
+                return AZ::RHI::ResultCode::Success;
+            }
             AZ::RHI::ResultCode InvalidateInternal() override { return AZ::RHI::ResultCode::Success; }
             void ShutdownInternal() override {}
+
+            uint32_t m_bindlessReadIndex = InvalidBindlessIndex;
         };
 
         class Image
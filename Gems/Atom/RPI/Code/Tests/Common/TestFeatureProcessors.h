@@ -7,6 +7,10 @@
  */
 #pragma once
 
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+
 namespace UnitTest
 {
     // A feature processor which has scene notification enabled
@@ -146,4 +150,86 @@ namespace UnitTest
     private:
         int m_value = 0;
     };
+
+    // A feature processor which records when its Simulate() runs
+    class TestSceneDataFeatureProcessor
+        : public AZ::RPI::FeatureProcessor
+    {
+    public:
+        AZ_RTTI(TestSceneDataFeatureProcessor, "{CAB1C2E2-7A9C-4353-A326-12257227F51D}", AZ::RPI::FeatureProcessor);
+
+        static constexpr const char* SceneDataName = "TestSceneData";
+
+        void Render(const RenderPacket&)  override {};
+
+        // The order the feature processors' Simulate() ran in, shared between them
+        AZStd::mutex* m_simulateOrderMutex = nullptr;
+        AZStd::vector<AZ::TypeId>* m_simulateOrder = nullptr;
+
+    protected:
+        void RecordSimulate()
+        {
+            AZStd::scoped_lock lock(*m_simulateOrderMutex);
+            m_simulateOrder->push_back(RTTI_GetType());
+        }
+    };
+
+    // A feature processor which writes the test scene data, and takes long enough for a concurrent reader to finish first
+    class TestSceneDataWriterFeatureProcessor final
+        : public TestSceneDataFeatureProcessor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TestSceneDataWriterFeatureProcessor, AZ::SystemAllocator)
+        AZ_RTTI(TestSceneDataWriterFeatureProcessor, "{74BC5030-EA41-44C0-885A-9B39148791CF}", TestSceneDataFeatureProcessor);
+
+        static void Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<TestSceneDataWriterFeatureProcessor, TestSceneDataFeatureProcessor>()
+                    ->Version(1)
+                    ;
+            }
+        }
+
+        void Simulate(const SimulatePacket&) override
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(50));
+            RecordSimulate();
+        }
+
+        void GetSceneDataAccess(SceneDataAccess& access) const override
+        {
+            access.m_writes.push_back(AZ::Name(SceneDataName));
+        }
+    };
+
+    // A feature processor which reads the test scene data
+    class TestSceneDataReaderFeatureProcessor final
+        : public TestSceneDataFeatureProcessor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TestSceneDataReaderFeatureProcessor, AZ::SystemAllocator)
+        AZ_RTTI(TestSceneDataReaderFeatureProcessor, "{6BBBEF84-6879-406E-BB2D-F908836E525D}", TestSceneDataFeatureProcessor);
+
+        static void Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<TestSceneDataReaderFeatureProcessor, TestSceneDataFeatureProcessor>()
+                    ->Version(1)
+                    ;
+            }
+        }
+
+        void Simulate(const SimulatePacket&) override
+        {
+            RecordSimulate();
+        }
+
+        void GetSceneDataAccess(SceneDataAccess& access) const override
+        {
+            access.m_reads.push_back(AZ::Name(SceneDataName));
+        }
+    };
 }  // namespace UnitTest
@@ -19,11 +19,13 @@
 
 #include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
+#include <Atom/RPI.Public/Image/StreamingImageMipFeedback.h>
 #include <Atom/RPI.Public/Image/StreamingImagePool.h>
 #include <Atom/RPI.Public/RPIUtils.h>
 
 #include <AtomCore/Instance/InstanceDatabase.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/std/containers/intrusive_list.h>
 
@@ -35,6 +37,8 @@ namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR_EXTERNED(bool, r_streamingImageMipFeedback);
+
         class StreamingImageAssetTester
             : public UnitTest::AssetTester<StreamingImageAsset>
         {
@@ -427,6 +431,11 @@ namespace UnitTest
             EXPECT_NE(imageAsset.Get(), nullptr);
             return imageAsset;
         }
+
+        static const AZ::RPI::StreamingImageContext* GetStreamingContext(const AZ::RPI::StreamingImage* image)
+        {
+            return image->m_streamingContext.get();
+        }
     };
 
     TEST_F(StreamingImageTests, MipChainCreate)
@@ -723,4 +732,51 @@ namespace UnitTest
             EXPECT_NEAR(pixelDataValue, pixelExpectedValue, Constants::Tolerance);
         }
     }
+
+    TEST_F(StreamingImageTests, MipFeedbackUpdatesTargetMipAndPriority)
+    {
+        using namespace AZ;
+
+        RPI::r_streamingImageMipFeedback = true;
+
+        RPI::StreamingImageMipFeedback* feedback = RPI::StreamingImageMipFeedback::Get();
+        ASSERT_NE(feedback, nullptr);
+
+        Data::Instance<RPI::StreamingImage> sampledImage = RPI::StreamingImage::FindOrCreate(BuildTestImage());
+        Data::Instance<RPI::StreamingImage> idleImage = RPI::StreamingImage::FindOrCreate(BuildTestImage());
+        ASSERT_NE(sampledImage, nullptr);
+        ASSERT_NE(idleImage, nullptr);
+
+        const uint32_t sampledIndex = sampledImage->GetImageView()->GetBindlessReadIndex();
+        const uint32_t idleIndex = idleImage->GetImageView()->GetBindlessReadIndex();
+        ASSERT_NE(sampledIndex, idleIndex);
+
+        // Advance the controller timestamp so the access timestamps set by the feedback differ from the initial ones
+        auto imageSystem = RPI::ImageSystemInterface::Get();
+        imageSystem->Update();
+
+        const size_t idleAccessTimestamp = GetStreamingContext(idleImage.get())->GetLastAccessTimestamp();
+
+        // Only the first image was sampled, at its second mip
+        const uint32_t sampledMip = 1;
+        AZStd::vector<uint32_t> sampledMips(AZStd::max(sampledIndex, idleIndex) + 1, RPI::StreamingImageMipFeedback::NoMipSampled);
+        sampledMips[sampledIndex] = sampledMip;
+        feedback->ResolveFeedback(sampledMips);
+        imageSystem->Update();
+
+        const RPI::StreamingImageContext* sampledContext = GetStreamingContext(sampledImage.get());
+        const RPI::StreamingImageContext* idleContext = GetStreamingContext(idleImage.get());
+        EXPECT_EQ(sampledContext->GetTargetMip(), sampledMip);
+        EXPECT_EQ(idleContext->GetTargetMip(), 0);
+        EXPECT_EQ(idleContext->GetLastAccessTimestamp(), idleAccessTimestamp);
+        EXPECT_GT(sampledContext->GetLastAccessTimestamp(), idleContext->GetLastAccessTimestamp());
+
+        // The same feedback isn't applied twice
+        const size_t sampledAccessTimestamp = sampledContext->GetLastAccessTimestamp();
+        imageSystem->Update();
+        EXPECT_EQ(sampledContext->GetLastAccessTimestamp(), sampledAccessTimestamp);
+
+        feedback->ResolveFeedback({});
+        RPI::r_streamingImageMipFeedback = false;
+    }
 }
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <Atom/RPI.Reflect/Model/MeshletCluster.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <Common/RPITestFixture.h>
+
+namespace UnitTest
+{
+    using namespace AZ::RPI;
+
+    class MeshletClusterTests
+        : public RPITestFixture
+    {
+    protected:
+        // Builds a flat grid of quads in the xy plane facing +z, with (gridSize + 1)^2 vertices
+        void BuildGrid(uint32_t gridSize)
+        {
+            for (uint32_t y = 0; y <= gridSize; ++y)
+            {
+                for (uint32_t x = 0; x <= gridSize; ++x)
+                {
+                    m_positions.push_back(aznumeric_cast<float>(x));
+                    m_positions.push_back(aznumeric_cast<float>(y));
+                    m_positions.push_back(0.0f);
+                }
+            }
+
+            for (uint32_t y = 0; y < gridSize; ++y)
+            {
+                for (uint32_t x = 0; x < gridSize; ++x)
+                {
+                    const uint32_t v0 = y * (gridSize + 1) + x;
+                    const uint32_t v1 = v0 + 1;
+                    const uint32_t v2 = v0 + gridSize + 1;
+                    const uint32_t v3 = v2 + 1;
+                    m_indices.insert(m_indices.end(), { v0, v1, v2, v2, v1, v3 });
+                }
+            }
+        }
+
+        AZStd::vector<float> m_positions;
+        AZStd::vector<uint32_t> m_indices;
+    };
+
+    TEST_F(MeshletClusterTests, BuildMeshletClusters_EmptyMesh_NoClusters)
+    {
+        EXPECT_TRUE(BuildMeshletClusters(m_indices, m_positions).empty());
+    }
+
+    TEST_F(MeshletClusterTests, BuildMeshletClusters_CoversAllTrianglesWithinLimits)
+    {
+        BuildGrid(32);
+
+        const AZStd::vector<MeshletCluster> clusters = BuildMeshletClusters(m_indices, m_positions);
+        ASSERT_GT(clusters.size(), 1u);
+
+        uint32_t nextIndexOffset = 0;
+        for (const MeshletCluster& cluster : clusters)
+        {
+            EXPECT_EQ(cluster.m_indexOffset, nextIndexOffset);
+            EXPECT_GT(cluster.m_triangleCount, 0u);
+            EXPECT_LE(cluster.m_triangleCount, MeshletClusterConstants::s_maxTriangleCount);
+
+            AZStd::unordered_set<uint32_t> vertices(
+                m_indices.begin() + cluster.m_indexOffset, m_indices.begin() + cluster.m_indexOffset + cluster.m_triangleCount * 3);
+            EXPECT_LE(vertices.size(), MeshletClusterConstants::s_maxVertexCount);
+
+            // Every vertex of the cluster is inside its bounding sphere
+            const AZ::Vector3 center = AZ::Vector3::CreateFromFloat3(cluster.m_center);
+            for (const uint32_t vertexIndex : vertices)
+            {
+                const AZ::Vector3 position = AZ::Vector3::CreateFromFloat3(&m_positions[vertexIndex * 3]);
+                EXPECT_LE(position.GetDistance(center), cluster.m_radius + 0.001f);
+            }
+
+            nextIndexOffset += cluster.m_triangleCount * 3;
+        }
+        EXPECT_EQ(nextIndexOffset, m_indices.size());
+    }
+
+    TEST_F(MeshletClusterTests, BuildMeshletClusters_FlatMesh_ConeFacesNormal)
+    {
+        BuildGrid(4);
+
+        const AZStd::vector<MeshletCluster> clusters = BuildMeshletClusters(m_indices, m_positions);
+        ASSERT_EQ(clusters.size(), 1u);
+
+        const MeshletCluster& cluster = clusters[0];
+        EXPECT_TRUE(AZ::Vector3::CreateFromFloat3(cluster.m_coneAxis).IsClose(AZ::Vector3::CreateAxisZ()));
+        EXPECT_NEAR(cluster.m_coneCutoff, 0.0f, 0.001f);
+    }
+
+    TEST_F(MeshletClusterTests, BuildMeshletClusters_OpposingTriangles_ConeDisabled)
+    {
+        m_positions = { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+        m_indices = { 0, 1, 2, 0, 2, 1 };
+
+        const AZStd::vector<MeshletCluster> clusters = BuildMeshletClusters(m_indices, m_positions);
+        ASSERT_EQ(clusters.size(), 1u);
+        EXPECT_EQ(clusters[0].m_coneCutoff, MeshletClusterConstants::s_coneCutoffDisabled);
+    }
+
+    TEST_F(MeshletClusterTests, BuildMeshletClusters_IndexOutOfRange_Fails)
+    {
+        BuildGrid(1);
+        m_indices.push_back(0);
+        m_indices.push_back(1);
+        m_indices.push_back(100);
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_TRUE(BuildMeshletClusters(m_indices, m_positions).empty());
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+    }
+} // namespace UnitTest
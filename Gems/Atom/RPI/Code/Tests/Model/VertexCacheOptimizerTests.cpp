@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <Atom/RPI.Reflect/Model/VertexCacheOptimizer.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <Common/RPITestFixture.h>
+
+namespace UnitTest
+{
+    using namespace AZ::RPI;
+
+    class VertexCacheOptimizerTests
+        : public RPITestFixture
+    {
+    protected:
+        // Builds a grid of quads with (gridSize + 1)^2 vertices, with the triangles in column major order,
+        // which reuses few vertices from a small cache for large grids
+        void BuildColumnMajorGrid(uint32_t gridSize)
+        {
+            m_vertexCount = (gridSize + 1) * (gridSize + 1);
+            for (uint32_t x = 0; x < gridSize; ++x)
+            {
+                for (uint32_t y = 0; y < gridSize; ++y)
+                {
+                    const uint32_t v0 = y * (gridSize + 1) + x;
+                    const uint32_t v1 = v0 + 1;
+                    const uint32_t v2 = v0 + gridSize + 1;
+                    const uint32_t v3 = v2 + 1;
+                    m_indices.insert(m_indices.end(), { v0, v1, v2, v2, v1, v3 });
+                }
+            }
+        }
+
+        //! Returns the triangles with their corners rotated so the smallest index comes first, sorted, to compare triangle sets.
+        static AZStd::vector<AZStd::array<uint32_t, 3>> GetSortedTriangles(const AZStd::vector<uint32_t>& indices)
+        {
+            AZStd::vector<AZStd::array<uint32_t, 3>> triangles;
+            for (size_t index = 0; index < indices.size(); index += 3)
+            {
+                AZStd::array<uint32_t, 3> triangle = { indices[index], indices[index + 1], indices[index + 2] };
+                AZStd::rotate(triangle.begin(), AZStd::min_element(triangle.begin(), triangle.end()), triangle.end());
+                triangles.push_back(triangle);
+            }
+            AZStd::sort(triangles.begin(), triangles.end());
+            return triangles;
+        }
+
+        AZStd::vector<uint32_t> m_indices;
+        size_t m_vertexCount = 0;
+    };
+
+    TEST_F(VertexCacheOptimizerTests, OptimizeVertexCache_EmptyMesh_Succeeds)
+    {
+        EXPECT_TRUE(OptimizeVertexCache(m_indices, 0));
+        EXPECT_TRUE(m_indices.empty());
+    }
+
+    TEST_F(VertexCacheOptimizerTests, OptimizeVertexCache_PreservesTrianglesAndWinding)
+    {
+        BuildColumnMajorGrid(16);
+        const AZStd::vector<uint32_t> originalIndices = m_indices;
+
+        EXPECT_TRUE(OptimizeVertexCache(m_indices, m_vertexCount));
+        ASSERT_EQ(m_indices.size(), originalIndices.size());
+        EXPECT_EQ(GetSortedTriangles(m_indices), GetSortedTriangles(originalIndices));
+    }
+
+    TEST_F(VertexCacheOptimizerTests, OptimizeVertexCache_LargeGrid_ReducesCacheMisses)
+    {
+        BuildColumnMajorGrid(64);
+        const float originalRatio = CalculateAverageCacheMissRatio(m_indices, m_vertexCount, 16);
+
+        EXPECT_TRUE(OptimizeVertexCache(m_indices, m_vertexCount));
+        const float optimizedRatio = CalculateAverageCacheMissRatio(m_indices, m_vertexCount, 16);
+
+        EXPECT_LT(optimizedRatio, originalRatio);
+        EXPECT_LT(optimizedRatio, 0.8f);
+    }
+
+    TEST_F(VertexCacheOptimizerTests, OptimizeVertexCache_IndexOutOfRange_Fails)
+    {
+        BuildColumnMajorGrid(1);
+        m_indices.insert(m_indices.end(), { 0, 1, 100 });
+        const AZStd::vector<uint32_t> originalIndices = m_indices;
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(OptimizeVertexCache(m_indices, m_vertexCount));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_EQ(m_indices, originalIndices);
+    }
+
+    TEST_F(VertexCacheOptimizerTests, CalculateAverageCacheMissRatio_SeparateTriangles_ThreeMissesPerTriangle)
+    {
+        m_indices = { 0, 1, 2, 3, 4, 5, 6, 7, 8 };
+        EXPECT_FLOAT_EQ(CalculateAverageCacheMissRatio(m_indices, 9), 3.0f);
+    }
+} // namespace UnitTest
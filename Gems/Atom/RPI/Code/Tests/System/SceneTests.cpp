@@ -46,11 +46,15 @@ namespace UnitTest
             TestFeatureProcessor2::Reflect(GetSerializeContext());
             TestFeatureProcessorImplementation::Reflect(GetSerializeContext());
             TestFeatureProcessorImplementation2::Reflect(GetSerializeContext());
+            TestSceneDataWriterFeatureProcessor::Reflect(GetSerializeContext());
+            TestSceneDataReaderFeatureProcessor::Reflect(GetSerializeContext());
 
             AZ::RPI::FeatureProcessorFactory::Get()->RegisterFeatureProcessor<TestFeatureProcessor1>();
             AZ::RPI::FeatureProcessorFactory::Get()->RegisterFeatureProcessor<TestFeatureProcessor2>();
             AZ::RPI::FeatureProcessorFactory::Get()->RegisterFeatureProcessorWithInterface<TestFeatureProcessorImplementation, TestFeatureProcessorInterface>();
             AZ::RPI::FeatureProcessorFactory::Get()->RegisterFeatureProcessorWithInterface<TestFeatureProcessorImplementation2, TestFeatureProcessorInterface>();
+            AZ::RPI::FeatureProcessorFactory::Get()->RegisterFeatureProcessor<TestSceneDataWriterFeatureProcessor>();
+            AZ::RPI::FeatureProcessorFactory::Get()->RegisterFeatureProcessor<TestSceneDataReaderFeatureProcessor>();
         }
 
         void TearDown() override
@@ -59,6 +63,8 @@ namespace UnitTest
             AZ::RPI::FeatureProcessorFactory::Get()->UnregisterFeatureProcessor<TestFeatureProcessor2>();
             AZ::RPI::FeatureProcessorFactory::Get()->UnregisterFeatureProcessor<TestFeatureProcessorImplementation>();
             AZ::RPI::FeatureProcessorFactory::Get()->UnregisterFeatureProcessor<TestFeatureProcessorImplementation2>();
+            AZ::RPI::FeatureProcessorFactory::Get()->UnregisterFeatureProcessor<TestSceneDataWriterFeatureProcessor>();
+            AZ::RPI::FeatureProcessorFactory::Get()->UnregisterFeatureProcessor<TestSceneDataReaderFeatureProcessor>();
 
             delete m_octreeSystemComponent;
 
@@ -434,4 +440,40 @@ namespace UnitTest
         testScene->Deactivate();
     }
 
+    TEST_F(SceneTests, Simulate_FeatureProcessorsAccessSameSceneData_RunInOrderTheyWereAdded)
+    {
+        SceneDescriptor sceneDesc;
+        ScenePtr testScene = Scene::CreateScene(sceneDesc);
+        testScene->Activate();
+
+        AZStd::mutex simulateOrderMutex;
+        AZStd::vector<AZ::TypeId> simulateOrder;
+        TestSceneDataFeatureProcessor* writer = testScene->EnableFeatureProcessor<TestSceneDataWriterFeatureProcessor>();
+        TestSceneDataFeatureProcessor* reader = testScene->EnableFeatureProcessor<TestSceneDataReaderFeatureProcessor>();
+        for (TestSceneDataFeatureProcessor* featureProcessor : { writer, reader })
+        {
+            featureProcessor->m_simulateOrderMutex = &simulateOrderMutex;
+            featureProcessor->m_simulateOrder = &simulateOrder;
+        }
+
+        // The reader would finish before the writer if they ran concurrently
+        testScene->Simulate(RHI::JobPolicy::Parallel, 0.0f);
+        testScene->WaitAndCleanCompletionJob(testScene->m_simulationCompletion);
+
+        ASSERT_EQ(simulateOrder.size(), 2);
+        EXPECT_EQ(simulateOrder[0], azrtti_typeid<TestSceneDataWriterFeatureProcessor>());
+        EXPECT_EQ(simulateOrder[1], azrtti_typeid<TestSceneDataReaderFeatureProcessor>());
+
+        // Disabling the writer leaves the reader without a dependency
+        testScene->DisableFeatureProcessor<TestSceneDataWriterFeatureProcessor>();
+        simulateOrder.clear();
+        testScene->Simulate(RHI::JobPolicy::Parallel, 0.0f);
+        testScene->WaitAndCleanCompletionJob(testScene->m_simulationCompletion);
+
+        ASSERT_EQ(simulateOrder.size(), 1);
+        EXPECT_EQ(simulateOrder[0], azrtti_typeid<TestSceneDataReaderFeatureProcessor>());
+
+        testScene->Deactivate();
+    }
+
 }  // namespace UnitTest
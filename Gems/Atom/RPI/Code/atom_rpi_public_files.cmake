@@ -53,11 +53,15 @@ set(FILES
     Include/Atom/RPI.Public/Image/StreamingImage.h
     Include/Atom/RPI.Public/Image/StreamingImageContext.h
     Include/Atom/RPI.Public/Image/StreamingImageController.h
+    Include/Atom/RPI.Public/Image/StreamingImageMipFeedback.h
     Include/Atom/RPI.Public/Image/StreamingImagePool.h
+    Include/Atom/RPI.Public/Image/StreamingImageTiles.h
     Include/Atom/RPI.Public/Material/Material.h
+    Include/Atom/RPI.Public/Material/MaterialDataBuffer.h
     Include/Atom/RPI.Public/Material/MaterialSystem.h
     Include/Atom/RPI.Public/Model/Model.h
     Include/Atom/RPI.Public/Model/ModelLod.h
+    Include/Atom/RPI.Public/Model/ModelLodStreamingController.h
     Include/Atom/RPI.Public/Model/ModelLodUtils.h
     Include/Atom/RPI.Public/Model/ModelSystem.h
     Include/Atom/RPI.Public/Model/ModelTagSystemComponent.h
@@ -89,7 +93,9 @@ set(FILES
     Include/Atom/RPI.Public/Pass/Specific/MSAAResolveFullScreenPass.h
     Include/Atom/RPI.Public/Pass/Specific/RenderToTexturePass.h
     Include/Atom/RPI.Public/Pass/Specific/SelectorPass.h
+    Include/Atom/RPI.Public/Pass/Specific/StreamingImageMipFeedbackPass.h
     Include/Atom/RPI.Public/Pass/Specific/SwapChainPass.h
+    Include/Atom/RPI.Public/Shader/PipelineStateUsageRecorder.h
     Include/Atom/RPI.Public/Shader/Shader.h
     Include/Atom/RPI.Public/Shader/ShaderReloadNotificationBus.h
     Include/Atom/RPI.Public/Shader/ShaderVariant.h
@@ -138,11 +144,15 @@ set(FILES
     Source/RPI.Public/Image/StreamingImage.cpp
     Source/RPI.Public/Image/StreamingImageContext.cpp
     Source/RPI.Public/Image/StreamingImageController.cpp
+    Source/RPI.Public/Image/StreamingImageMipFeedback.cpp
     Source/RPI.Public/Image/StreamingImagePool.cpp
+    Source/RPI.Public/Image/StreamingImageTiles.cpp
     Source/RPI.Public/Material/Material.cpp
+    Source/RPI.Public/Material/MaterialDataBuffer.cpp
     Source/RPI.Public/Material/MaterialSystem.cpp
     Source/RPI.Public/Model/Model.cpp
     Source/RPI.Public/Model/ModelLod.cpp
+    Source/RPI.Public/Model/ModelLodStreamingController.cpp
     Source/RPI.Public/Model/ModelLodUtils.cpp
     Source/RPI.Public/Model/ModelSystem.cpp
     Source/RPI.Public/Model/ModelTagSystemComponent.cpp
@@ -171,7 +181,9 @@ set(FILES
     Source/RPI.Public/Pass/Specific/MSAAResolveFullScreenPass.cpp
     Source/RPI.Public/Pass/Specific/RenderToTexturePass.cpp
     Source/RPI.Public/Pass/Specific/SelectorPass.cpp
+    Source/RPI.Public/Pass/Specific/StreamingImageMipFeedbackPass.cpp
     Source/RPI.Public/Pass/Specific/SwapChainPass.cpp
+    Source/RPI.Public/Shader/PipelineStateUsageRecorder.cpp
     Source/RPI.Public/Shader/Shader.cpp
     Source/RPI.Public/Shader/ShaderVariant.cpp
     Source/RPI.Public/Shader/ShaderReloadDebugTracker.cpp
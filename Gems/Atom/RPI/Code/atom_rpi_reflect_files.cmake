@@ -18,6 +18,7 @@ set(FILES
     Include/Atom/RPI.Reflect/Buffer/BufferAsset.h
     Include/Atom/RPI.Reflect/Buffer/BufferAssetCreator.h
     Include/Atom/RPI.Reflect/Buffer/BufferAssetView.h
+    Include/Atom/RPI.Reflect/Model/MeshletCluster.h
     Include/Atom/RPI.Reflect/Model/ModelAsset.h
     Include/Atom/RPI.Reflect/Model/ModelAssetHelpers.h
     Include/Atom/RPI.Reflect/Model/ModelKdTree.h
@@ -32,6 +33,7 @@ set(FILES
     Include/Atom/RPI.Reflect/Model/SkinJointIdPadding.h
     Include/Atom/RPI.Reflect/Model/SkinMetaAsset.h
     Include/Atom/RPI.Reflect/Model/SkinMetaAssetCreator.h
+    Include/Atom/RPI.Reflect/Model/VertexCacheOptimizer.h
     Include/Atom/RPI.Reflect/Asset/AssetHandler.h
     Include/Atom/RPI.Reflect/Asset/AssetUtils.h
     Include/Atom/RPI.Reflect/Asset/AssetUtils.inl
@@ -108,6 +110,7 @@ set(FILES
     Source/RPI.Reflect/Buffer/BufferAsset.cpp
     Source/RPI.Reflect/Buffer/BufferAssetCreator.cpp
     Source/RPI.Reflect/Buffer/BufferAssetView.cpp
+    Source/RPI.Reflect/Model/MeshletCluster.cpp
     Source/RPI.Reflect/Model/ModelAsset.cpp
     Source/RPI.Reflect/Model/ModelAssetHelpers.cpp
     Source/RPI.Reflect/Model/ModelKdTree.cpp
@@ -121,6 +124,7 @@ set(FILES
     Source/RPI.Reflect/Model/SkinJointIdPadding.cpp
     Source/RPI.Reflect/Model/SkinMetaAsset.cpp
     Source/RPI.Reflect/Model/SkinMetaAssetCreator.cpp
+    Source/RPI.Reflect/Model/VertexCacheOptimizer.cpp
     Source/RPI.Reflect/ResourcePoolAsset.cpp
     Source/RPI.Reflect/ResourcePoolAssetCreator.cpp
     Source/RPI.Reflect/Image/AttachmentImageAsset.cpp
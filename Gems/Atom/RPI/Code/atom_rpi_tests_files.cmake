@@ -37,8 +37,10 @@ set(FILES
     Tests/Material/MaterialPropertyIdTests.cpp
     Tests/Material/MaterialPropertyValueSourceDataTests.cpp
     Tests/Material/MaterialTests.cpp
+    Tests/Model/MeshletClusterTests.cpp
     Tests/Model/ModelTests.cpp
     Tests/Model/SkinJointIdPaddingTests.cpp
+    Tests/Model/VertexCacheOptimizerTests.cpp
     Tests/Pass/PassTests.cpp
     Tests/Shader/ShaderTests.cpp
     Tests/ShaderResourceGroup/ShaderResourceGroupBufferTests.cpp
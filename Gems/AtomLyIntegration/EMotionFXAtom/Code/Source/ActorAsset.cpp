@@ -14,6 +14,7 @@
 #include <EMotionFX/Source/Mesh.h>
 #include <EMotionFX/Source/MorphSetup.h>
 #include <EMotionFX/Source/MorphTargetStandard.h>
+#include <EMotionFX/Source/MotionInstance.h>
 #include <EMotionFX/Source/SubMesh.h>
 #include <EMotionFX/Source/SkinningInfoVertexAttributeLayer.h>
 #include <MCore/Source/DualQuaternion.h>
@@ -365,5 +366,40 @@ namespace AZ
             return RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(descriptor);
         }
 
+        Data::Instance<RPI::Buffer> CreateBakedMotionBufferFromActorInstance(
+            EMotionFX::ActorInstance* actorInstance,
+            EMotionFX::MotionInstance* motionInstance,
+            uint32_t frameCount,
+            EMotionFX::Integration::SkinningMethod skinningMethod)
+        {
+            AZ_Assert(frameCount > 0, "Cannot bake a motion without frames.");
+
+            const uint32_t floatsPerBone = skinningMethod == EMotionFX::Integration::SkinningMethod::DualQuat
+                ? DualQuaternionSkinningFloatsPerBone
+                : LinearSkinningFloatsPerBone;
+
+            // Sample the motion at evenly spaced times. The last frame blends back into the first one, since the motion loops.
+            AZStd::vector<float> bakedBoneTransforms;
+            AZStd::vector<float> frameBoneTransforms;
+            const float duration = motionInstance->GetDuration();
+            for (uint32_t frame = 0; frame < frameCount; ++frame)
+            {
+                motionInstance->SetCurrentTime(duration * frame / frameCount);
+                actorInstance->UpdateTransformations(0.0f);
+                actorInstance->UpdateSkinningMatrices();
+
+                GetBoneTransformsFromActorInstance(actorInstance, frameBoneTransforms, skinningMethod);
+                bakedBoneTransforms.insert(bakedBoneTransforms.end(), frameBoneTransforms.begin(), frameBoneTransforms.end());
+            }
+
+            RPI::CommonBufferDescriptor descriptor;
+            descriptor.m_bufferData = bakedBoneTransforms.data();
+            descriptor.m_bufferName = AZStd::string::format("BakedMotionBuffer_%s", actorInstance->GetActor()->GetName());
+            descriptor.m_byteCount = bakedBoneTransforms.size() * sizeof(float);
+            descriptor.m_elementSize = static_cast<uint32_t>(floatsPerBone * sizeof(float));
+            descriptor.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
+            return RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(descriptor);
+        }
+
     } //namespace Render
 } // namespace AZ
@@ -19,6 +19,7 @@ namespace EMotionFX
 {
     class Actor;
     class ActorInstance;
+    class MotionInstance;
 }
 
 namespace AZ
@@ -42,5 +43,13 @@ namespace AZ
         //! Create a buffer for bone transforms that can be used as input to the skinning shader
         Data::Instance<RPI::Buffer> CreateBoneTransformBufferFromActorInstance(const EMotionFX::ActorInstance* actorInstance, EMotionFX::Integration::SkinningMethod skinningMethod);
 
+        //! Bake a looping motion into a buffer of bone transforms for GPU pose evaluation.
+        //! The motion instance is sampled frameCount times over its duration. The actor instance is left in the pose of the last sample.
+        Data::Instance<RPI::Buffer> CreateBakedMotionBufferFromActorInstance(
+            EMotionFX::ActorInstance* actorInstance,
+            EMotionFX::MotionInstance* motionInstance,
+            uint32_t frameCount,
+            EMotionFX::Integration::SkinningMethod skinningMethod);
+
     } // namespace Render
 } // namespace AZ
@@ -483,6 +483,9 @@ namespace Audio
         virtual void PushRequests(AudioRequestsQueue& requests) = 0;
         virtual void PushRequestBlocking(AudioRequestVariant&& request) = 0;
         virtual void PushCallback(AudioRequestVariant&& callback) = 0;
+        //! Batched alternative to pushing an ObjectRequest::SetPosition. The positions written during a frame are handed
+        //! to the audio thread in one buffer swap and applied in bulk, before the pending requests are processed.
+        virtual void PushPositionUpdate(TAudioObjectID audioObjectId, const SATLWorldPosition& position) = 0;
 
         virtual TAudioControlID GetAudioTriggerID(const char* sAudioTriggerName) const = 0;
         virtual TAudioControlID GetAudioRtpcID(const char* sAudioRtpcName) const = 0;
@@ -61,6 +61,7 @@ namespace Audio
         void PushRequests(AudioRequestsQueue&) override {}
         void PushRequestBlocking(AudioRequestVariant&&) override {}
         void PushCallback(AudioRequestVariant&&) override {}
+        void PushPositionUpdate(TAudioObjectID, const SATLWorldPosition&) override {}
 
         TAudioControlID GetAudioTriggerID(const char*) const override { return INVALID_AUDIO_CONTROL_ID; }
         TAudioControlID GetAudioRtpcID(const char*) const override { return INVALID_AUDIO_CONTROL_ID; }
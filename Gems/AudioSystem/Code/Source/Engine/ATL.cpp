@@ -340,15 +340,7 @@ namespace Audio
                     }
                     else if (audioObject->HasPosition())
                     {
-                        auto const positionalObject = static_cast<CATLAudioObject*>(audioObject);
-                        AudioSystemImplementationRequestBus::BroadcastResult(
-                            result, &AudioSystemImplementationRequestBus::Events::SetPosition, positionalObject->GetImplDataPtr(),
-                            request.m_position);
-
-                        if (result == EAudioRequestStatus::Success)
-                        {
-                            positionalObject->SetPosition(request.m_position);
-                        }
+                        result = SetPosition(static_cast<CATLAudioObject*>(audioObject), request.m_position);
                     }
                     else
                     {
@@ -1183,6 +1175,43 @@ namespace Audio
         return eResult;
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CAudioTranslationLayer::ApplyPositionUpdates(const SATLPositionUpdates& positionUpdates)
+    {
+        AZ_PROFILE_FUNCTION(Audio);
+
+        for (size_t index = 0; index < positionUpdates.Size(); ++index)
+        {
+            // Objects released since the position was written are no longer found and are skipped.
+            if (CATLAudioObject* const audioObject = m_oAudioObjectMgr.LookupID(positionUpdates.m_audioObjectIds[index]);
+                audioObject != nullptr)
+            {
+                SetPosition(audioObject, positionUpdates.m_positions[index]);
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    EAudioRequestStatus CAudioTranslationLayer::SetPosition(CATLAudioObject* const pAudioObject, const SATLWorldPosition& rPosition)
+    {
+        if (pAudioObject->IsVirtual())
+        {
+            pAudioObject->DeferPosition(rPosition);
+            return EAudioRequestStatus::Success;
+        }
+
+        EAudioRequestStatus eResult = EAudioRequestStatus::Failure;
+        AudioSystemImplementationRequestBus::BroadcastResult(
+            eResult, &AudioSystemImplementationRequestBus::Events::SetPosition, pAudioObject->GetImplDataPtr(), rPosition);
+
+        if (eResult == EAudioRequestStatus::Success)
+        {
+            pAudioObject->SetPosition(rPosition);
+        }
+
+        return eResult;
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     EAudioRequestStatus CAudioTranslationLayer::SetRtpc(
         CATLAudioObjectBase* const pAudioObject,
@@ -1191,6 +1220,11 @@ namespace Audio
     {
         EAudioRequestStatus eResult = EAudioRequestStatus::Failure;
 
+        // Virtual objects only store the value, it is sent to the audio implementation when the object becomes real.
+        auto const virtualObject = (pAudioObject->HasPosition() && static_cast<CATLAudioObject*>(pAudioObject)->IsVirtual())
+            ? static_cast<CATLAudioObject*>(pAudioObject)
+            : nullptr;
+
         for (auto rtpcImpl : pRtpc->m_cImplPtrs)
         {
             const EATLSubsystem eReceiver = rtpcImpl->GetReceiver();
@@ -1200,6 +1234,13 @@ namespace Audio
             {
                 case eAS_AUDIO_SYSTEM_IMPLEMENTATION:
                 {
+                    if (virtualObject)
+                    {
+                        virtualObject->DeferRtpc(pRtpc->GetID());
+                        eSetRtpcResult = EAudioRequestStatus::Success;
+                        break;
+                    }
+
                     AudioSystemImplementationRequestBus::BroadcastResult(eSetRtpcResult, &AudioSystemImplementationRequestBus::Events::SetRtpc,
                         pAudioObject->GetImplDataPtr(),
                         rtpcImpl->m_pImplData,
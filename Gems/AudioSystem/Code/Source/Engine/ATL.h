@@ -44,6 +44,8 @@ namespace Audio
         void Update();
 
         void ProcessRequest(AudioRequestVariant&& request);
+        //! Sets the positions of the audio objects in one pass, the latest position wins when an object is listed twice
+        void ApplyPositionUpdates(const SATLPositionUpdates& positionUpdates);
 
         TAudioControlID GetAudioTriggerID(const char* const sAudioTriggerName) const;
         TAudioControlID GetAudioRtpcID(const char* const sAudioRtpcName) const;
@@ -86,6 +88,7 @@ namespace Audio
             CATLAudioObjectBase* const pAudioObject,
             const CATLTrigger* const pTrigger);
         EAudioRequestStatus StopAllTriggers(CATLAudioObjectBase* const pAudioObject, void* const pOwner = nullptr);
+        EAudioRequestStatus SetPosition(CATLAudioObject* const pAudioObject, const SATLWorldPosition& rPosition);
         EAudioRequestStatus SetSwitchState(
             CATLAudioObjectBase* const pAudioObject,
             const CATLSwitchState* const pState);
@@ -231,6 +231,8 @@ namespace Audio
         CATLAudioObjectBase::Clear();
         m_oPosition = SATLWorldPosition();
         m_raycastProcessor.Reset();
+        m_nFlags &= ~(eAOF_VIRTUAL | eAOF_POSITION_DEFERRED);
+        m_cDeferredRtpcs.clear();
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -285,6 +287,61 @@ namespace Audio
         m_oPreviousPosition = m_oPosition;
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CATLAudioObject::SetVirtual(const bool bVirtual)
+    {
+        if (bVirtual == IsVirtual())
+        {
+            return;
+        }
+
+        if (bVirtual)
+        {
+            m_nFlags |= eAOF_VIRTUAL;
+            return;
+        }
+
+        m_nFlags &= ~eAOF_VIRTUAL;
+
+        // Re-send the values that were held back while virtual, they are processed as the object is real again.
+        auto audioSystem = AZ::Interface<IAudioSystem>::Get();
+        if ((m_nFlags & eAOF_POSITION_DEFERRED) != 0)
+        {
+            m_nFlags &= ~eAOF_POSITION_DEFERRED;
+
+            Audio::ObjectRequest::SetPosition setPosition;
+            setPosition.m_audioObjectId = GetID();
+            setPosition.m_position = m_oPosition;
+            audioSystem->PushRequest(AZStd::move(setPosition));
+        }
+
+        for (const TAudioControlID rtpcId : m_cDeferredRtpcs)
+        {
+            if (auto it = m_cRtpcs.find(rtpcId); it != m_cRtpcs.end())
+            {
+                Audio::ObjectRequest::SetParameterValue setParameter;
+                setParameter.m_audioObjectId = GetID();
+                setParameter.m_parameterId = rtpcId;
+                setParameter.m_value = it->second;
+                audioSystem->PushRequest(AZStd::move(setParameter));
+            }
+        }
+        m_cDeferredRtpcs.clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CATLAudioObject::DeferPosition(const SATLWorldPosition& oNewPosition)
+    {
+        m_oPosition = oNewPosition;
+        m_nFlags |= eAOF_POSITION_DEFERRED;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CATLAudioObject::DeferRtpc(const TAudioControlID nRtpcID)
+    {
+        m_cDeferredRtpcs.insert(nRtpcID);
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CATLAudioObject::SetRaycastCalcType(const ObstructionType calcType)
     {
@@ -781,8 +838,8 @@ namespace Audio
                 SATLSoundPropagationData obstOccData;
                 GetObstOccData(obstOccData);
                 str = AZStd::string::format(
-                    "%s  ID: %llu  RefCnt: %2zu  Dist: %4.1f m", pDebugNameStore->LookupAudioObjectName(GetID()), GetID(), GetRefCount(),
-                    distance);
+                    "%s  ID: %llu  RefCnt: %2zu  Dist: %4.1f m%s", pDebugNameStore->LookupAudioObjectName(GetID()), GetID(), GetRefCount(),
+                    distance, IsVirtual() ? "  (Virtual)" : "");
                 debugDisplay.SetColor(brightColor);
                 debugDisplay.Draw2dTextLabel(posX, posY, fontSize, str.c_str());
 
@@ -353,6 +353,10 @@ namespace Audio
         // ~CATLAudioObjectBase
 
         void SetPosition(const SATLWorldPosition& oNewPosition);
+        const SATLWorldPosition& GetPosition() const
+        {
+            return m_oPosition;
+        }
 
         void SetRaycastCalcType(const ObstructionType type);
         void RunRaycasts(const SATLWorldPosition& listenerPos);
@@ -369,11 +373,24 @@ namespace Audio
         }
         void UpdateVelocity(const float fUpdateIntervalMS);
 
+        //! A virtual object keeps playing its events, but its position, Rtpc and obstruction updates are held back from
+        //! the audio implementation. When it becomes real again the latest position and Rtpc values are re-sent.
+        void SetVirtual(const bool bVirtual);
+        bool IsVirtual() const
+        {
+            return (m_nFlags & eAOF_VIRTUAL) != 0;
+        }
+        //! Stores a position that is sent to the audio implementation once the object becomes real
+        void DeferPosition(const SATLWorldPosition& oNewPosition);
+        //! Marks an Rtpc whose value is sent to the audio implementation once the object becomes real
+        void DeferRtpc(const TAudioControlID nRtpcID);
+
     private:
         TATLEnumFlagsType m_nFlags;
         float m_fPreviousVelocity;
         SATLWorldPosition m_oPosition;
         SATLWorldPosition m_oPreviousPosition;
+        ATLSetLookupType<TAudioControlID> m_cDeferredRtpcs;
 
         RaycastProcessor m_raycastProcessor;
 
@@ -383,10 +400,6 @@ namespace Audio
             AzFramework::DebugDisplayRequests& debugDisplay,
             const AZ::Vector3& listenerPos,
             const CATLDebugNameStore* const debugNameStore) const;
-        const SATLWorldPosition& GetPosition() const
-        {
-            return m_oPosition;
-        }
 #endif // !AUDIO_RELEASE
     };
 
@@ -12,6 +12,7 @@
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzCore/StringFunc/StringFunc.h>
@@ -294,11 +295,13 @@ namespace Audio
 
         m_raycastManager.ProcessRaycastResults(fUpdateIntervalMS);
 
+        UpdateVirtualization(rListenerPosition);
+
         for (auto& audioObjectPair : m_cAudioObjects)
         {
             CATLAudioObject* const pObject = audioObjectPair.second;
 
-            if (pObject->HasActiveEvents())
+            if (pObject->HasActiveEvents() && !pObject->IsVirtual())
             {
                 AZ_PROFILE_SCOPE(Audio, "Inner Per-Object CAudioObjectManager::Update");
 
@@ -330,6 +333,62 @@ namespace Audio
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CAudioObjectManager::UpdateVirtualization(const SATLWorldPosition& rListenerPosition)
+    {
+        AZ_PROFILE_FUNCTION(Audio);
+
+        const float virtualizationDistance = Audio::CVars::s_VirtualizationDistance;
+        const float virtualizationDistanceSq = virtualizationDistance * virtualizationDistance;
+        const size_t maxRealObjects = static_cast<AZ::u32>(Audio::CVars::s_MaxRealAudioObjects);
+        const AZ::Vector3 listenerPosition = rListenerPosition.GetPositionVec();
+
+        m_virtualizationCandidates.clear();
+
+        for (auto& audioObjectPair : m_cAudioObjects)
+        {
+            CATLAudioObject* const pObject = audioObjectPair.second;
+
+            // Objects that aren't playing are kept real, so that new triggers start with their latest position and Rtpcs.
+            bool bVirtual = false;
+            if (pObject->HasActiveEvents())
+            {
+                const float distanceSq = pObject->GetPosition().GetPositionVec().GetDistanceSq(listenerPosition);
+                if (virtualizationDistance > 0.f && distanceSq > virtualizationDistanceSq)
+                {
+                    bVirtual = true;
+                }
+                else if (maxRealObjects > 0)
+                {
+                    // Decided below, once the closest objects are known.
+                    m_virtualizationCandidates.emplace_back(distanceSq, pObject);
+                    continue;
+                }
+            }
+
+            pObject->SetVirtual(bVirtual);
+        }
+
+        // The objects have no priority of their own, the closest ones to the listener are the most audible.
+        const size_t numRealObjects = AZStd::min(maxRealObjects, m_virtualizationCandidates.size());
+        if (numRealObjects < m_virtualizationCandidates.size())
+        {
+            AZStd::nth_element(
+                m_virtualizationCandidates.begin(),
+                m_virtualizationCandidates.begin() + numRealObjects,
+                m_virtualizationCandidates.end(),
+                [](const auto& lhs, const auto& rhs)
+                {
+                    return lhs.first < rhs.first;
+                });
+        }
+
+        for (size_t index = 0; index < m_virtualizationCandidates.size(); ++index)
+        {
+            m_virtualizationCandidates[index].second->SetVirtual(index >= numRealObjects);
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     bool CAudioObjectManager::ReserveID(TAudioObjectID& rAudioObjectID, const char* const sAudioObjectName)
     {
@@ -1694,6 +1753,22 @@ namespace Audio
         return nNumActiveAudioObjects;
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t CAudioObjectManager::GetNumVirtualAudioObjects() const
+    {
+        size_t numVirtualAudioObjects = 0;
+
+        for (auto& audioObjectPair : m_cAudioObjects)
+        {
+            if (audioObjectPair.second->IsVirtual())
+            {
+                ++numVirtualAudioObjects;
+            }
+        }
+
+        return numVirtualAudioObjects;
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CAudioObjectManager::DrawPerObjectDebugInfo(AzFramework::DebugDisplayRequests& debugDisplay, const AZ::Vector3& rListenerPos) const
     {
@@ -1771,9 +1846,9 @@ namespace Audio
             }
         }
 
-        static const char* headerFormat = "Audio Objects [Active : %3zu | Alive: %3zu | Pool: %3zu | Remaining: %3zu]";
+        static const char* headerFormat = "Audio Objects [Active : %3zu | Virtual: %3zu | Alive: %3zu | Pool: %3zu | Remaining: %3zu]";
         const bool overloaded = (m_cAudioObjects.size() > m_cObjectPool.m_nReserveSize);
-        str = AZStd::string::format(headerFormat, activeObjects, aliveObjects,
+        str = AZStd::string::format(headerFormat, activeObjects, GetNumVirtualAudioObjects(), aliveObjects,
             m_cObjectPool.m_nReserveSize, remainingObjects);
         debugDisplay.SetColor(overloaded ? overloadColor : headerColor);
         debugDisplay.Draw2dTextLabel(fPosX, fHeaderPosY, textSize, str.c_str());
@@ -139,10 +139,16 @@ namespace Audio
         CATLAudioObject* GetInstance();
         bool ReleaseInstance(CATLAudioObject* const pOldObject);
 
+        //! Virtualizes the playing objects that are out of range of the listener, or beyond the budget of real objects
+        void UpdateVirtualization(const SATLWorldPosition& rListenerPosition);
+
         TActiveObjectMap m_cAudioObjects;
         CInstanceManager<CATLAudioObject, TAudioObjectID> m_cObjectPool;
         float m_fTimeSinceLastVelocityUpdateMS;
 
+        using TVirtualizationCandidates = AZStd::vector<AZStd::pair<float, CATLAudioObject*>, AudioSystemStdAllocator>;
+        TVirtualizationCandidates m_virtualizationCandidates;
+
         AudioRaycastManager m_raycastManager;
 
 #if !defined(AUDIO_RELEASE)
@@ -150,6 +156,7 @@ namespace Audio
         void SetDebugNameStore(CATLDebugNameStore* const pDebugNameStore);
         size_t GetNumAudioObjects() const;
         size_t GetNumActiveAudioObjects() const;
+        size_t GetNumVirtualAudioObjects() const;
         const TActiveObjectMap& GetActiveAudioObjects() const
         {
             return m_cAudioObjects;
@@ -12,6 +12,7 @@
 #include <AzCore/IO/IStreamer.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #if !defined(AUDIO_RELEASE)
@@ -33,11 +34,39 @@ namespace Audio
     template <typename KeyType>
     using ATLSetLookupType = AZStd::unordered_set<KeyType, AZStd::hash<KeyType>, AZStd::equal_to<KeyType>, AudioSystemStdAllocator>;
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Positions of the audio objects written during a frame. The ids and positions are kept in separate arrays so the
+    //! buffer can be swapped between the threads and applied by the ATL in bulk.
+    struct SATLPositionUpdates
+    {
+        void Add(const TAudioObjectID nAudioObjectID, const SATLWorldPosition& rPosition)
+        {
+            m_audioObjectIds.push_back(nAudioObjectID);
+            m_positions.push_back(rPosition);
+        }
+
+        void Clear()
+        {
+            m_audioObjectIds.clear();
+            m_positions.clear();
+        }
+
+        size_t Size() const
+        {
+            return m_audioObjectIds.size();
+        }
+
+        AZStd::vector<TAudioObjectID, AudioSystemStdAllocator> m_audioObjectIds;
+        AZStd::vector<SATLWorldPosition, AudioSystemStdAllocator> m_positions;
+    };
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     enum EATLObjectFlags : TATLEnumFlagsType
     {
         eAOF_NONE = 0,
         eAOF_TRACK_VELOCITY = AUDIO_BIT(0),
+        eAOF_VIRTUAL = AUDIO_BIT(1),
+        eAOF_POSITION_DEFERRED = AUDIO_BIT(2),
     };
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
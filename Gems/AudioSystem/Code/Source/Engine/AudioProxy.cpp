@@ -182,8 +182,6 @@ namespace Audio
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CAudioProxy::SetPosition(const SATLWorldPosition& refPosition)
     {
-        Audio::ObjectRequest::SetPosition setPosition;
-
         if (HasId())
         {
             // Update position only if the delta exceeds a given value.
@@ -196,9 +194,7 @@ namespace Audio
                 m_oPosition.NormalizeForwardVec();
                 m_oPosition.NormalizeUpVec();
 
-                setPosition.m_audioObjectId = m_nAudioObjectID;
-                setPosition.m_position = m_oPosition;
-                AZ::Interface<IAudioSystem>::Get()->PushRequest(AZStd::move(setPosition));
+                AZ::Interface<IAudioSystem>::Get()->PushPositionUpdate(m_nAudioObjectID, m_oPosition);
             }
         }
         else
@@ -210,6 +206,7 @@ namespace Audio
             m_oPosition.NormalizeForwardVec();
             m_oPosition.NormalizeUpVec();
 
+            Audio::ObjectRequest::SetPosition setPosition;
             setPosition.m_position = refPosition;
             TryEnqueueRequest(AZStd::move(setPosition));
         }
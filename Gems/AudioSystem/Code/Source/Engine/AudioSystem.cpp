@@ -142,6 +142,13 @@ namespace Audio
         m_pendingCallbacksQueue.push_back(AZStd::move(callback));
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CAudioSystem::PushPositionUpdate(TAudioObjectID audioObjectId, const SATLWorldPosition& position)
+    {
+        AZStd::scoped_lock lock(m_pendingPositionUpdatesMutex);
+        m_pendingPositionUpdates.Add(audioObjectId, position);
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CAudioSystem::ExternalUpdate()
     {
@@ -217,6 +224,16 @@ namespace Audio
 
         if (!handleBlockingRequest)
         {
+            // Positions are applied first, while the objects they were written for haven't been released yet by the
+            // pending requests.
+            {
+                AZStd::scoped_lock lock(m_pendingPositionUpdatesMutex);
+                AZStd::swap(m_pendingPositionUpdates, m_processingPositionUpdates);
+            }
+
+            m_oATL.ApplyPositionUpdates(m_processingPositionUpdates);
+            m_processingPositionUpdates.Clear();
+
             // Normal request processing: lock and swap the pending requests queue
             // so that the queue can be opened for new requests while the current set
             // of requests can be processed.
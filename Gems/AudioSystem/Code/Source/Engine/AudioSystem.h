@@ -78,6 +78,7 @@ namespace Audio
         void PushRequests(AudioRequestsQueue& requests) override;
         void PushRequestBlocking(AudioRequestVariant&& request) override;
         void PushCallback(AudioRequestVariant&& callback) override;
+        void PushPositionUpdate(TAudioObjectID audioObjectId, const SATLWorldPosition& position) override;
 
         TAudioControlID GetAudioTriggerID(const char* const sAudioTriggerName) const override;
         TAudioControlID GetAudioRtpcID(const char* const sAudioRtpcName) const override;
@@ -120,6 +121,12 @@ namespace Audio
         AZStd::mutex m_pendingRequestsMutex;
         AZStd::mutex m_pendingCallbacksMutex;
 
+        // Positions are written into the pending buffer, which is swapped with the processing buffer once per update so
+        // both keep their capacity and the audio thread reads without holding the lock.
+        SATLPositionUpdates m_pendingPositionUpdates;
+        SATLPositionUpdates m_processingPositionUpdates;
+        AZStd::mutex m_pendingPositionUpdatesMutex;
+
         // Synchronization objects
         AZStd::binary_semaphore m_mainEvent;
         AZStd::binary_semaphore m_processingEvent;
@@ -157,6 +157,18 @@ namespace Audio::CVars
         "2: All AudioProxy's initialize asynchronously.\n"
         "Usage: s_AudioProxiesInitType=2\n");
 
+    AZ_CVAR(float, s_VirtualizationDistance, 0.f,
+        nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Audio objects farther than this distance from the listener are virtualized: their position, Rtpc and obstruction\n"
+        "updates are held back from the audio middleware until they come back in range. 0 disables distance virtualization.\n"
+        "Usage: s_VirtualizationDistance=150.0\n");
+
+    AZ_CVAR(AZ::u32, s_MaxRealAudioObjects, 0,
+        nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The maximum number of playing audio objects that are updated on the audio middleware. The objects closest to the\n"
+        "listener are kept real and the remaining ones are virtualized. 0 means no limit.\n"
+        "Usage: s_MaxRealAudioObjects=256\n");
+
     auto OnChangeAudioLanguage = []([[maybe_unused]] const AZ::CVarFixedString& language) -> void
     {
         if (auto audioSystem = AZ::Interface<IAudioSystem>::Get();
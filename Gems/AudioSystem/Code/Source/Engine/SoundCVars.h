@@ -31,6 +31,9 @@ namespace Audio::CVars
     AZ_CVAR_EXTERNED(float, s_VelocityTrackingThreshold);
     AZ_CVAR_EXTERNED(AZ::u32, s_AudioProxiesInitType);
 
+    AZ_CVAR_EXTERNED(float, s_VirtualizationDistance);
+    AZ_CVAR_EXTERNED(AZ::u32, s_MaxRealAudioObjects);
+
     AZ_CVAR_EXTERNED(AZ::CVarFixedString, g_languageAudio);
 
 #if !defined(AUDIO_RELEASE)
@@ -150,6 +150,23 @@ TEST_F(ATLAudioObjectTest, SetRaycastCalcType_SetAllTypes_AffectsCanRunRaycasts)
 }
 
 
+TEST_F(ATLAudioObjectTest, DeferPosition_VirtualObject_StoresPositionUntilCleared)
+{
+    CATLAudioObject audioObject(testAudioObjectId, nullptr);
+    EXPECT_FALSE(audioObject.IsVirtual());
+
+    audioObject.SetVirtual(true);
+    EXPECT_TRUE(audioObject.IsVirtual());
+
+    const AZ::Vector3 position(1.f, 2.f, 3.f);
+    audioObject.DeferPosition(SATLWorldPosition(position));
+    EXPECT_TRUE(audioObject.GetPosition().GetPositionVec().IsClose(position));
+
+    audioObject.Clear();
+    EXPECT_FALSE(audioObject.IsVirtual());
+}
+
+
 TEST_F(ATLAudioObjectTest, OnAudioRaycastResults_MultiRaycastZeroDistanceHits_ZeroObstructionAndOcclusion)
 {
     RaycastProcessor::s_raycastsEnabled = true;
@@ -26,6 +26,7 @@ namespace Audio
         MOCK_METHOD1(PushRequests, void(AudioRequestsQueue&));
         MOCK_METHOD1(PushRequestBlocking, void(AudioRequestVariant&&));
         MOCK_METHOD1(PushCallback, void(AudioRequestVariant&&));
+        MOCK_METHOD2(PushPositionUpdate, void(TAudioObjectID, const SATLWorldPosition&));
         MOCK_CONST_METHOD1(GetAudioTriggerID, TAudioControlID(const char*));
         MOCK_CONST_METHOD1(GetAudioRtpcID, TAudioControlID(const char*));
         MOCK_CONST_METHOD1(GetAudioSwitchID, TAudioControlID(const char*));
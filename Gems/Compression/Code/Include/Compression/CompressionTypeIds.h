@@ -34,4 +34,7 @@ namespace Compression
     inline constexpr const char* CompressionOptionsTypeId = "{037B2A25-E195-4C5D-B402-6108CE978280}";
 
     inline constexpr const char* DecompressionOptionsTypeId = "{EA85CCE4-B630-47B8-892F-3A5B1C9ECD99}";
+
+    inline constexpr const char* CompressionZstdOptionsTypeId = "{5B8D1C0E-2E77-4C59-9B5F-3A41E6C2D7F4}";
+    inline constexpr const char* DecompressionZstdOptionsTypeId = "{C3A6F2B1-8D4E-4F0A-A7C9-6E15B9D3F820}";
 } // namespace Compression
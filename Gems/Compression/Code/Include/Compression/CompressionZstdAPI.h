@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/string/string_view.h>
+#include <Compression/CompressionInterfaceAPI.h>
+#include <Compression/DecompressionInterfaceAPI.h>
+
+namespace CompressionZstd
+{
+    //! Human readable name associated with the compression algorithm
+    constexpr AZStd::string_view GetZstdCompressionAlgorithmName()
+    {
+        return "Zstd";
+    }
+
+    //! Returns the CompressionAlgorithmId associated with the Zstd Compressor
+    //! @return Zstd Compression AlgorithmId
+    constexpr Compression::CompressionAlgorithmId GetZstdCompressionAlgorithmId()
+    {
+        constexpr Compression::CompressionAlgorithmId AlgorithmId{ AZ::u32(AZStd::hash<AZStd::string_view>{}(GetZstdCompressionAlgorithmName())) };
+        return AlgorithmId;
+    }
+
+    //! Options that can be supplied to the Zstd compressor CompressBlock function
+    struct CompressionZstdOptions
+        : Compression::CompressionOptions
+    {
+        AZ_TYPE_INFO_WITH_NAME_DECL(CompressionZstdOptions);
+        AZ_RTTI_NO_TYPE_INFO_DECL();
+
+        //! Zstd compression level, higher levels trade compression speed for a smaller size.
+        //! Decompression speed is about the same for all levels
+        int m_compressionLevel{ 3 };
+        //! Finds matches far back in the input, which shrinks large blocks with repeated content such as texture mips or meshes
+        //! NOTE: Data compressed with a window larger than 2^27 bytes requires DecompressionZstdOptions::m_maxWindowLog to be raised
+        bool m_enableLongDistanceMatching{};
+        //! Log2 of the maximum distance a match can reference, 0 lets zstd pick it based on the compression level
+        AZ::u32 m_windowLog{};
+        //! Number of threads to compress a single block with. 0 compresses on the calling thread.
+        //! This is ignored if the zstd library was built without multithreading support
+        AZ::u32 m_workerCount{};
+        //! Dictionary trained on similar content(i.e files of the same asset type) which improves the ratio of small blocks.
+        //! The same dictionary must be supplied when decompressing
+        AZStd::span<const AZStd::byte> m_dictionary;
+    };
+
+    //! Options that can be supplied to the Zstd decompressor DecompressBlock function
+    struct DecompressionZstdOptions
+        : Compression::DecompressionOptions
+    {
+        AZ_TYPE_INFO_WITH_NAME_DECL(DecompressionZstdOptions);
+        AZ_RTTI_NO_TYPE_INFO_DECL();
+
+        //! Log2 of the largest window the decompressor accepts, 0 uses the zstd default of 2^27 bytes
+        AZ::u32 m_maxWindowLog{};
+        //! The dictionary the data was compressed with
+        AZStd::span<const AZStd::byte> m_dictionary;
+    };
+
+    AZ_TYPE_INFO_WITH_NAME_IMPL_INLINE(CompressionZstdOptions, "CompressionZstdOptions", Compression::CompressionZstdOptionsTypeId);
+    AZ_RTTI_NO_TYPE_INFO_IMPL_INLINE(CompressionZstdOptions, Compression::CompressionOptions);
+    AZ_TYPE_INFO_WITH_NAME_IMPL_INLINE(DecompressionZstdOptions, "DecompressionZstdOptions", Compression::DecompressionZstdOptionsTypeId);
+    AZ_RTTI_NO_TYPE_INFO_IMPL_INLINE(DecompressionZstdOptions, Compression::DecompressionOptions);
+} // namespace CompressionZstd
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "DecompressorZstdImpl.h"
+
+#include <Compression/CompressionZstdAPI.h>
+
+#include <zstd.h>
+
+namespace CompressionZstd
+{
+    // Definitions for Zstd Decompressor
+    DecompressorZstd::DecompressorZstd() = default;
+
+    Compression::CompressionAlgorithmId DecompressorZstd::GetCompressionAlgorithmId() const
+    {
+        return GetZstdCompressionAlgorithmId();
+    }
+
+    AZStd::string_view DecompressorZstd::GetCompressionAlgorithmName() const
+    {
+        return GetZstdCompressionAlgorithmName();
+    }
+
+    Compression::DecompressionResultData DecompressorZstd::DecompressBlock(
+        AZStd::span<AZStd::byte> decompressionBuffer, const AZStd::span<const AZStd::byte>& compressedData,
+        const Compression::DecompressionOptions& decompressionOptions) const
+    {
+        Compression::DecompressionResultData resultData;
+
+        if (decompressionBuffer.empty())
+        {
+            resultData.m_decompressionOutcome.m_resultString = Compression::DecompressionResultString(
+                "Decompression buffer is empty, uncompressed content cannot be stored in it\n");
+            // Do not return, but hold on to result string in case an error occurs in decompression
+        }
+
+        // A decompression context is created per call as blocks are decompressed on multiple threads at the same time
+        AZStd::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> decompressionContext(ZSTD_createDCtx(), &ZSTD_freeDCtx);
+        if (decompressionContext == nullptr)
+        {
+            resultData.m_decompressionOutcome.m_resultString += "Failed to create a zstd decompression context";
+            resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Failed;
+            return resultData;
+        }
+
+        size_t zstdResult = 0;
+        if (auto zstdOptions = azrtti_cast<const DecompressionZstdOptions*>(&decompressionOptions); zstdOptions != nullptr)
+        {
+            if (zstdOptions->m_maxWindowLog != 0)
+            {
+                zstdResult = ZSTD_DCtx_setParameter(
+                    decompressionContext.get(), ZSTD_d_windowLogMax, static_cast<int>(zstdOptions->m_maxWindowLog));
+            }
+            if (!ZSTD_isError(zstdResult) && !zstdOptions->m_dictionary.empty())
+            {
+                zstdResult = ZSTD_DCtx_loadDictionary(
+                    decompressionContext.get(), zstdOptions->m_dictionary.data(), zstdOptions->m_dictionary.size());
+            }
+            if (ZSTD_isError(zstdResult))
+            {
+                resultData.m_decompressionOutcome.m_resultString += Compression::DecompressionResultString::format(
+                    "Failed to apply the zstd decompression options: %s", ZSTD_getErrorName(zstdResult));
+                resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Failed;
+                return resultData;
+            }
+        }
+
+        const size_t decompressedSize = ZSTD_decompressDCtx(
+            decompressionContext.get(),
+            decompressionBuffer.data(),
+            decompressionBuffer.size(),
+            compressedData.data(),
+            compressedData.size());
+
+        if (ZSTD_isError(decompressedSize))
+        {
+            resultData.m_decompressionOutcome.m_resultString += Compression::DecompressionResultString::format(
+                "ZSTD_decompressDCtx call has failed with error \"%s\". Dest buffer capacity: %zu, source stream size: %zu",
+                ZSTD_getErrorName(decompressedSize), decompressionBuffer.size(), compressedData.size());
+            resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Failed;
+            return resultData;
+        }
+
+        // Update the result buffer span to point at the beginning of the decompressed data and
+        // the correct decompressed size
+        resultData.m_uncompressedBuffer = decompressionBuffer.subspan(0, decompressedSize);
+        resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Complete;
+        return resultData;
+    }
+
+} // namespace CompressionZstd
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <Compression/DecompressionInterfaceAPI.h>
+
+namespace CompressionZstd
+{
+    class DecompressorZstd
+        : public Compression::IDecompressionInterface
+    {
+    public:
+        DecompressorZstd();
+        //! Retrieves the 32-bit compression algorithm ID associated with this interface
+        Compression::CompressionAlgorithmId GetCompressionAlgorithmId() const override;
+        //! Retrieves the human readable associated with the Zstd compressor
+        AZStd::string_view GetCompressionAlgorithmName() const override;
+        //! Decompresses the compressed data into the decompression buffer
+        //! A DecompressionZstdOptions instance can be supplied to decompress data that was compressed with a dictionary
+        //! or a large window
+        //! @return a DecompressionResultData instance to indicate if decompression operation has succeeded
+        [[nodiscard]] Compression::DecompressionResultData DecompressBlock(
+            AZStd::span<AZStd::byte> decompressionBuffer, const AZStd::span<const AZStd::byte>& compressedData,
+            const Compression::DecompressionOptions& decompressionOptions = {}) const override;
+    };
+} // namespace CompressionZstd
@@ -12,7 +12,9 @@
 
 #include <Compression/CompressionLZ4API.h>
 #include <Compression/CompressionTypeIds.h>
+#include <Compression/CompressionZstdAPI.h>
 #include "CompressorLZ4Impl.h"
+#include "CompressorZstdImpl.h"
 
 #include <Compression/CompressionInterfaceAPI.h>
 
@@ -50,6 +52,40 @@ namespace CompressionLZ4
     }
 }
 
+namespace CompressionZstd
+{
+    void RegisterCompressorZstdInterface()
+    {
+        // Register the zstd compressor with the compression registrar
+        if (auto compressionRegistrar = Compression::CompressionRegistrar::Get();
+            compressionRegistrar != nullptr)
+        {
+            auto compressionAlgorithmId = GetZstdCompressionAlgorithmId();
+            auto compressorZstd = AZStd::make_unique<CompressorZstd>();
+            [[maybe_unused]] auto registerOutcome = compressionRegistrar->RegisterCompressionInterface(
+                compressionAlgorithmId,
+                AZStd::move(compressorZstd));
+
+            AZ_Error("Compression Zstd", bool{ registerOutcome }, "Registration of Zstd Compressor with the CompressionRegistrar"
+                " has failed with Id %u", compressionAlgorithmId);
+        }
+    }
+    void UnregisterCompressorZstdInterface()
+    {
+        // Unregister the zstd compressor using the zstd compression algorithm Id
+        if (auto compressionRegistrar = Compression::CompressionRegistrar::Get();
+            compressionRegistrar != nullptr)
+        {
+            auto compressionAlgorithmId = GetZstdCompressionAlgorithmId();
+            [[maybe_unused]] bool unregisterOutcome = compressionRegistrar->UnregisterCompressionInterface(
+                compressionAlgorithmId);
+
+            AZ_Error("Compression Zstd", unregisterOutcome, "Zstd Compressor with Id %u is not registered with"
+                " with CompressionRegistrar", static_cast<AZ::u32>(compressionAlgorithmId));
+        }
+    }
+}
+
 namespace Compression
 {
     AZ_COMPONENT_IMPL(CompressionEditorSystemComponent, "CompressionEditorSystemComponent",
@@ -95,10 +131,12 @@ namespace Compression
     {
         CompressionSystemComponent::Activate();
         CompressionLZ4::RegisterCompressorLZ4Interface();
+        CompressionZstd::RegisterCompressorZstdInterface();
     }
 
     void CompressionEditorSystemComponent::Deactivate()
     {
+        CompressionZstd::UnregisterCompressorZstdInterface();
         CompressionLZ4::UnregisterCompressorLZ4Interface();
         CompressionSystemComponent::Deactivate();
     }
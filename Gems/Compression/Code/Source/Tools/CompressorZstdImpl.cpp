@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "CompressorZstdImpl.h"
+
+#include <Compression/CompressionZstdAPI.h>
+
+#include <zstd.h>
+
+namespace CompressionZstd
+{
+    // Definitions for Zstd Compressor
+    CompressorZstd::CompressorZstd() = default;
+
+    Compression::CompressionAlgorithmId CompressorZstd::GetCompressionAlgorithmId() const
+    {
+        return GetZstdCompressionAlgorithmId();
+    }
+
+    AZStd::string_view CompressorZstd::GetCompressionAlgorithmName() const
+    {
+        return GetZstdCompressionAlgorithmName();
+    }
+
+    [[nodiscard]] size_t CompressorZstd::CompressBound(size_t uncompressedBufferSize) const
+    {
+        return ZSTD_compressBound(uncompressedBufferSize);
+    }
+
+    Compression::CompressionResultData CompressorZstd::CompressBlock(
+        AZStd::span<AZStd::byte> compressionBuffer, const AZStd::span<const AZStd::byte>& uncompressedData,
+        const Compression::CompressionOptions& compressionOptions) const
+    {
+        Compression::CompressionResultData resultData;
+
+        if (const size_t worstCaseCompressedSize = ZSTD_compressBound(uncompressedData.size());
+            compressionBuffer.size() < worstCaseCompressedSize)
+        {
+            resultData.m_compressionOutcome.m_resultString = Compression::CompressionResultString::format(
+                "Output buffer capacity is less than the upper bound for worst case."
+                " Worst case size is %zu; output buffer capacity is %zu\n",
+                worstCaseCompressedSize, compressionBuffer.size());
+        }
+
+        // A compression context is created per call as blocks are compressed on multiple threads at the same time
+        AZStd::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> compressionContext(ZSTD_createCCtx(), &ZSTD_freeCCtx);
+        if (compressionContext == nullptr)
+        {
+            resultData.m_compressionOutcome.m_resultString += "Failed to create a zstd compression context";
+            resultData.m_compressionOutcome.m_result = Compression::CompressionResult::Failed;
+            return resultData;
+        }
+
+        const CompressionZstdOptions defaultOptions;
+        auto zstdOptions = azrtti_cast<const CompressionZstdOptions*>(&compressionOptions);
+        if (zstdOptions == nullptr)
+        {
+            zstdOptions = &defaultOptions;
+        }
+
+        size_t zstdResult = ZSTD_CCtx_setParameter(compressionContext.get(), ZSTD_c_compressionLevel, zstdOptions->m_compressionLevel);
+        if (!ZSTD_isError(zstdResult) && zstdOptions->m_enableLongDistanceMatching)
+        {
+            zstdResult = ZSTD_CCtx_setParameter(compressionContext.get(), ZSTD_c_enableLongDistanceMatching, 1);
+        }
+        if (!ZSTD_isError(zstdResult) && zstdOptions->m_windowLog != 0)
+        {
+            zstdResult = ZSTD_CCtx_setParameter(compressionContext.get(), ZSTD_c_windowLog, static_cast<int>(zstdOptions->m_windowLog));
+        }
+        if (!ZSTD_isError(zstdResult) && !zstdOptions->m_dictionary.empty())
+        {
+            zstdResult = ZSTD_CCtx_loadDictionary(compressionContext.get(), zstdOptions->m_dictionary.data(), zstdOptions->m_dictionary.size());
+        }
+        if (ZSTD_isError(zstdResult))
+        {
+            resultData.m_compressionOutcome.m_resultString += Compression::CompressionResultString::format(
+                "Failed to apply the zstd compression options: %s", ZSTD_getErrorName(zstdResult));
+            resultData.m_compressionOutcome.m_result = Compression::CompressionResult::Failed;
+            return resultData;
+        }
+        if (zstdOptions->m_workerCount != 0)
+        {
+            // Setting workers fails when zstd is built without multithreading support, in which case the block is compressed on this thread
+            ZSTD_CCtx_setParameter(compressionContext.get(), ZSTD_c_nbWorkers, static_cast<int>(zstdOptions->m_workerCount));
+        }
+
+        const size_t compressedSize = ZSTD_compress2(
+            compressionContext.get(),
+            compressionBuffer.data(),
+            compressionBuffer.size(),
+            uncompressedData.data(),
+            uncompressedData.size());
+
+        if (ZSTD_isError(compressedSize))
+        {
+            resultData.m_compressionOutcome.m_resultString += Compression::CompressionResultString::format(
+                "ZSTD_compress2 call has failed with error \"%s\". The source buffer size is %zu and the output buffer"
+                " has capacity of %zu", ZSTD_getErrorName(compressedSize), uncompressedData.size(), compressionBuffer.size());
+            resultData.m_compressionOutcome.m_result = Compression::CompressionResult::Failed;
+            return resultData;
+        }
+
+        // Update the result buffer span to point at the beginning of the compressed data and
+        // the correct compressed size
+        resultData.m_compressedBuffer = compressionBuffer.subspan(0, compressedSize);
+        resultData.m_compressionOutcome.m_result = Compression::CompressionResult::Complete;
+        return resultData;
+    }
+
+} // namespace CompressionZstd
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <Compression/CompressionInterfaceAPI.h>
+
+namespace CompressionZstd
+{
+    class CompressorZstd
+        : public Compression::ICompressionInterface
+    {
+    public:
+        CompressorZstd();
+        //! Retrieves the 32-bit compression algorithm ID associated with this interface
+        Compression::CompressionAlgorithmId GetCompressionAlgorithmId() const override;
+        //! Retrieves the human readable associated with the Zstd compressor
+        AZStd::string_view GetCompressionAlgorithmName() const override;
+        //! Compresses the uncompressed data into the compressed buffer
+        //! A CompressionZstdOptions instance can be supplied to select the level, long distance matching,
+        //! a dictionary and the number of compression threads
+        //! @return a CompressionResultData instance to indicate if compression operation has succeeded
+        [[nodiscard]] Compression::CompressionResultData CompressBlock(
+            AZStd::span<AZStd::byte> compressionBuffer, const AZStd::span<const AZStd::byte>& uncompressedData,
+            const Compression::CompressionOptions& compressionOptions = {}) const override;
+
+        [[nodiscard]] size_t CompressBound(size_t uncompressedBufferSize) const override;
+    };
+} // namespace CompressionZstd
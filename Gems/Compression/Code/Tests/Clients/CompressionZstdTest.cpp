@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Compression/CompressionZstdAPI.h>
+#include <Clients/DecompressorZstdImpl.h>
+
+#include <zstd.h>
+
+namespace CompressionZstdTest
+{
+    class DecompressionZstdFixture
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        DecompressionZstdFixture() = default;
+
+        ~DecompressionZstdFixture() = default;
+
+    protected:
+        // The decompressor doesn't have a compressor in client builds, so the data is compressed with zstd directly
+        AZStd::vector<AZStd::byte> CompressWithZstd(AZStd::string_view dataToCompress)
+        {
+            AZStd::vector<AZStd::byte> compressedData;
+            compressedData.resize_no_construct(ZSTD_compressBound(dataToCompress.size()));
+            const size_t compressedSize = ZSTD_compress(compressedData.data(), compressedData.size(),
+                dataToCompress.data(), dataToCompress.size(), ZSTD_CLEVEL_DEFAULT);
+            EXPECT_FALSE(ZSTD_isError(compressedSize));
+            compressedData.resize_no_construct(ZSTD_isError(compressedSize) ? 0 : compressedSize);
+            return compressedData;
+        }
+    };
+
+    TEST_F(DecompressionZstdFixture, ZstdDecompressor_DecompressBlock_Succeeds)
+    {
+        auto compressionAlgorithmId = CompressionZstd::GetZstdCompressionAlgorithmId();
+        auto decompressorZstd = AZStd::make_unique<CompressionZstd::DecompressorZstd>();
+
+        EXPECT_EQ(compressionAlgorithmId, decompressorZstd->GetCompressionAlgorithmId());
+
+        constexpr AZStd::string_view expectedData = R"(Hello World)";
+        AZStd::vector<AZStd::byte> compressedData = CompressWithZstd(expectedData);
+
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        decompressionBuffer.resize_no_construct(expectedData.size());
+
+        Compression::DecompressionResultData decompressionResultData = decompressorZstd->DecompressBlock(
+            decompressionBuffer, compressedData);
+
+        EXPECT_TRUE(static_cast<bool>(decompressionResultData));
+        EXPECT_TRUE(static_cast<bool>(decompressionResultData.m_decompressionOutcome));
+        ASSERT_EQ(expectedData.size(), decompressionResultData.GetUncompressedByteCount());
+
+        AZStd::string_view uncompressedString(reinterpret_cast<char*>(decompressionResultData.GetUncompressedByteData()),
+            decompressionResultData.GetUncompressedByteCount());
+        EXPECT_EQ(expectedData, uncompressedString);
+    }
+
+    TEST_F(DecompressionZstdFixture, ZstdDecompressor_DecompressBlock_WithBufferTooSmall_Fails)
+    {
+        auto decompressorZstd = AZStd::make_unique<CompressionZstd::DecompressorZstd>();
+
+        AZStd::vector<AZStd::byte> compressedData = CompressWithZstd(R"(Hello World)");
+
+        // The decompression output buffer has a size of zero, so decompression should fail
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+
+        Compression::DecompressionResultData decompressionResultData = decompressorZstd->DecompressBlock(
+            decompressionBuffer, compressedData);
+
+        EXPECT_FALSE(static_cast<bool>(decompressionResultData));
+        EXPECT_FALSE(static_cast<bool>(decompressionResultData.m_decompressionOutcome));
+        EXPECT_EQ(0, decompressionResultData.GetUncompressedByteCount());
+        EXPECT_EQ(nullptr, decompressionResultData.GetUncompressedByteData());
+    }
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Compression/CompressionZstdAPI.h>
+#include <Clients/DecompressorZstdImpl.h>
+#include <Tools/CompressorZstdImpl.h>
+
+namespace CompressionZstdTest
+{
+    class CompressionZstdFixture
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        CompressionZstdFixture() = default;
+
+        ~CompressionZstdFixture() = default;
+
+    protected:
+        // Compresses and decompresses the data with the supplied options and checks the round trip is lossless
+        void ValidateRoundTrip(AZStd::span<const AZStd::byte> uncompressedData,
+            const Compression::CompressionOptions& compressionOptions,
+            const Compression::DecompressionOptions& decompressionOptions)
+        {
+            CompressionZstd::CompressorZstd compressorZstd;
+            CompressionZstd::DecompressorZstd decompressorZstd;
+
+            AZStd::vector<AZStd::byte> compressionBuffer;
+            compressionBuffer.resize_no_construct(compressorZstd.CompressBound(uncompressedData.size()));
+
+            Compression::CompressionResultData compressionResultData = compressorZstd.CompressBlock(
+                compressionBuffer, uncompressedData, compressionOptions);
+            ASSERT_TRUE(static_cast<bool>(compressionResultData));
+
+            AZStd::vector<AZStd::byte> decompressionBuffer;
+            decompressionBuffer.resize_no_construct(uncompressedData.size());
+
+            Compression::DecompressionResultData decompressionResultData = decompressorZstd.DecompressBlock(
+                decompressionBuffer, compressionResultData.m_compressedBuffer, decompressionOptions);
+            ASSERT_TRUE(static_cast<bool>(decompressionResultData));
+            ASSERT_EQ(uncompressedData.size(), decompressionResultData.GetUncompressedByteCount());
+            EXPECT_EQ(0, memcmp(uncompressedData.data(), decompressionBuffer.data(), uncompressedData.size()));
+        }
+    };
+
+    TEST_F(CompressionZstdFixture, ZstdCompressor_CompressBlock_Succeeds)
+    {
+        auto compressionAlgorithmId = CompressionZstd::GetZstdCompressionAlgorithmId();
+        auto compressorZstd = AZStd::make_unique<CompressionZstd::CompressorZstd>();
+
+        EXPECT_EQ(compressionAlgorithmId, compressorZstd->GetCompressionAlgorithmId());
+
+        constexpr AZStd::string_view dataToCompress = R"(Hello World)";
+        size_t compressBufferUpperBound = compressorZstd->CompressBound(dataToCompress.size());
+        EXPECT_GT(compressBufferUpperBound, 0);
+
+        AZStd::vector<AZStd::byte> compressionBuffer;
+        compressionBuffer.resize_no_construct(compressBufferUpperBound);
+
+        AZStd::span uncompressedData(reinterpret_cast<const AZStd::byte*>(dataToCompress.data()), dataToCompress.size());
+
+        Compression::CompressionResultData compressionResultData = compressorZstd->CompressBlock(
+            compressionBuffer, uncompressedData);
+
+        EXPECT_TRUE(static_cast<bool>(compressionResultData));
+        EXPECT_TRUE(static_cast<bool>(compressionResultData.m_compressionOutcome));
+        EXPECT_GT(compressionResultData.GetCompressedByteCount(), 0);
+        EXPECT_NE(nullptr, compressionResultData.GetCompressedByteData());
+    }
+
+    TEST_F(CompressionZstdFixture, ZstdCompressor_CompressBlock_WithBufferTooSmall_Fails)
+    {
+        auto compressorZstd = AZStd::make_unique<CompressionZstd::CompressorZstd>();
+
+        constexpr AZStd::string_view dataToCompress = R"(Hello World)";
+        AZStd::span uncompressedData(reinterpret_cast<const AZStd::byte*>(dataToCompress.data()), dataToCompress.size());
+
+        // The compression output buffer has a size of zero, so compression should fail
+        AZStd::vector<AZStd::byte> compressionBuffer;
+
+        Compression::CompressionResultData compressionResultData = compressorZstd->CompressBlock(
+            compressionBuffer, uncompressedData);
+
+        EXPECT_FALSE(static_cast<bool>(compressionResultData));
+        EXPECT_FALSE(static_cast<bool>(compressionResultData.m_compressionOutcome));
+        EXPECT_EQ(0, compressionResultData.GetCompressedByteCount());
+        EXPECT_EQ(nullptr, compressionResultData.GetCompressedByteData());
+    }
+
+    TEST_F(CompressionZstdFixture, ZstdCompressor_RoundTrip_WithLongDistanceMatching_Succeeds)
+    {
+        // Repeat a pattern far apart, so long distance matching has something to find
+        AZStd::vector<AZStd::byte> uncompressedData(4 * 1024 * 1024);
+        for (size_t index = 0; index < uncompressedData.size(); ++index)
+        {
+            uncompressedData[index] = static_cast<AZStd::byte>((index * 2654435761u) >> 13);
+        }
+
+        CompressionZstd::CompressionZstdOptions compressionOptions;
+        compressionOptions.m_enableLongDistanceMatching = true;
+        compressionOptions.m_windowLog = 23;
+        ValidateRoundTrip(uncompressedData, compressionOptions, CompressionZstd::DecompressionZstdOptions{});
+    }
+
+    TEST_F(CompressionZstdFixture, ZstdCompressor_RoundTrip_WithDictionary_Succeeds)
+    {
+        // A raw content dictionary, which zstd accepts in place of a trained dictionary
+        constexpr AZStd::string_view dictionary = R"({"materialType": "StandardPBR", "propertyValues": {"baseColor.color": [1.0, 1.0, 1.0]}})";
+        constexpr AZStd::string_view dataToCompress = R"({"materialType": "StandardPBR", "propertyValues": {"baseColor.color": [0.5, 1.0, 1.0]}})";
+        AZStd::span dictionarySpan(reinterpret_cast<const AZStd::byte*>(dictionary.data()), dictionary.size());
+        AZStd::span uncompressedData(reinterpret_cast<const AZStd::byte*>(dataToCompress.data()), dataToCompress.size());
+
+        CompressionZstd::CompressionZstdOptions compressionOptions;
+        compressionOptions.m_dictionary = dictionarySpan;
+        CompressionZstd::DecompressionZstdOptions decompressionOptions;
+        decompressionOptions.m_dictionary = dictionarySpan;
+        ValidateRoundTrip(uncompressedData, compressionOptions, decompressionOptions);
+    }
+}
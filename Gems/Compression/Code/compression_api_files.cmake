@@ -10,6 +10,7 @@ set(FILES
     Include/Compression/CompressionInterfaceAPI.inl
     Include/Compression/CompressionInterfaceStructs.h
     Include/Compression/CompressionLZ4API.h
+    Include/Compression/CompressionZstdAPI.h
     Include/Compression/DecompressionInterfaceAPI.h
     Include/Compression/DecompressionInterfaceAPI.inl
 )
@@ -7,4 +7,5 @@
 set(FILES
     Tests/Tools/CompressionEditorTest.cpp
     Tests/Tools/CompressionLZ4EditorTest.cpp
+    Tests/Tools/CompressionZstdEditorTest.cpp
 )
@@ -35,7 +35,7 @@ namespace AZ
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
             {
                 serializeContext->Class<DiffuseProbeGridComponentConfig>()
-                    ->Version(6) // Added EmissiveMultiplier
+                    ->Version(7) // Added CameraRelative
                     ->Field("ProbeSpacing", &DiffuseProbeGridComponentConfig::m_probeSpacing)
                     ->Field("Extents", &DiffuseProbeGridComponentConfig::m_extents)
                     ->Field("AmbientMultiplier", &DiffuseProbeGridComponentConfig::m_ambientMultiplier)
@@ -43,6 +43,7 @@ namespace AZ
                     ->Field("NormalBias", &DiffuseProbeGridComponentConfig::m_normalBias)
                     ->Field("NumRaysPerProbe", &DiffuseProbeGridComponentConfig::m_numRaysPerProbe)
                     ->Field("Scrolling", &DiffuseProbeGridComponentConfig::m_scrolling)
+                    ->Field("CameraRelative", &DiffuseProbeGridComponentConfig::m_cameraRelative)
                     ->Field("EdgeBlendIbl", &DiffuseProbeGridComponentConfig::m_edgeBlendIbl)
                     ->Field("FrameUpdateCount", &DiffuseProbeGridComponentConfig::m_frameUpdateCount)
                     ->Field("TransparencyMode", &DiffuseProbeGridComponentConfig::m_transparencyMode)
@@ -156,6 +157,7 @@ namespace AZ
             m_featureProcessor->SetNormalBias(m_handle, m_configuration.m_normalBias);
             m_featureProcessor->SetNumRaysPerProbe(m_handle, m_configuration.m_numRaysPerProbe);
             m_featureProcessor->SetScrolling(m_handle, m_configuration.m_scrolling);
+            m_featureProcessor->SetCameraRelative(m_handle, m_configuration.m_cameraRelative);
             m_featureProcessor->SetEdgeBlendIbl(m_handle, m_configuration.m_edgeBlendIbl);
             m_featureProcessor->SetFrameUpdateCount(m_handle, m_configuration.m_frameUpdateCount);
             m_featureProcessor->SetTransparencyMode(m_handle, m_configuration.m_transparencyMode);
@@ -382,6 +384,17 @@ namespace AZ
             m_featureProcessor->SetScrolling(m_handle, m_configuration.m_scrolling);
         }
 
+        void DiffuseProbeGridComponentController::SetCameraRelative(bool cameraRelative)
+        {
+            if (!m_featureProcessor)
+            {
+                return;
+            }
+
+            m_configuration.m_cameraRelative = cameraRelative;
+            m_featureProcessor->SetCameraRelative(m_handle, m_configuration.m_cameraRelative);
+        }
+
         void DiffuseProbeGridComponentController::SetEdgeBlendIbl(bool edgeBlendIbl)
         {
             if (!m_featureProcessor)
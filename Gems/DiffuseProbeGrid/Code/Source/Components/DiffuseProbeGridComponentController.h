@@ -37,6 +37,7 @@ namespace AZ
             float m_normalBias = DefaultDiffuseProbeGridNormalBias;
             DiffuseProbeGridNumRaysPerProbe m_numRaysPerProbe = DefaultDiffuseProbeGridNumRaysPerProbe;
             bool m_scrolling = false;
+            bool m_cameraRelative = false;
             bool m_edgeBlendIbl = true;
             uint32_t m_frameUpdateCount = 1;
             DiffuseProbeGridTransparencyMode m_transparencyMode = DefaultDiffuseProbeGridTransparencyMode;
@@ -112,6 +113,7 @@ namespace AZ
             void SetNormalBias(float normalBias);
             void SetNumRaysPerProbe(const DiffuseProbeGridNumRaysPerProbe& numRaysPerProbe);
             void SetScrolling(bool scrolling);
+            void SetCameraRelative(bool cameraRelative);
             void SetEdgeBlendIbl(bool edgeBlendIbl);
             void SetFrameUpdateCount(uint32_t frameUpdateCount);
             void SetTransparencyMode(DiffuseProbeGridTransparencyMode transparencyMode);
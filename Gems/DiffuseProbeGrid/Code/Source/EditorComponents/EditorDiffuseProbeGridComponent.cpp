@@ -34,7 +34,7 @@ namespace AZ
             if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
             {
                 serializeContext->Class<EditorDiffuseProbeGridComponent, BaseClass>()
-                    ->Version(3, ConvertToEditorRenderComponentAdapter<1>) // added emissive multiplier
+                    ->Version(4, ConvertToEditorRenderComponentAdapter<1>) // added camera relative
                     ->Field("probeSpacingX", &EditorDiffuseProbeGridComponent::m_probeSpacingX)
                     ->Field("probeSpacingY", &EditorDiffuseProbeGridComponent::m_probeSpacingY)
                     ->Field("probeSpacingZ", &EditorDiffuseProbeGridComponent::m_probeSpacingZ)
@@ -43,6 +43,7 @@ namespace AZ
                     ->Field("normalBias", &EditorDiffuseProbeGridComponent::m_normalBias)
                     ->Field("numRaysPerProbe", &EditorDiffuseProbeGridComponent::m_numRaysPerProbe)
                     ->Field("scrolling", &EditorDiffuseProbeGridComponent::m_scrolling)
+                    ->Field("cameraRelative", &EditorDiffuseProbeGridComponent::m_cameraRelative)
                     ->Field("edgeBlendIbl", &EditorDiffuseProbeGridComponent::m_edgeBlendIbl)
                     ->Field("frameUpdateCount", &EditorDiffuseProbeGridComponent::m_frameUpdateCount)
                     ->Field("transparencyMode", &EditorDiffuseProbeGridComponent::m_transparencyMode)
@@ -109,6 +110,9 @@ namespace AZ
                             ->DataElement(AZ::Edit::UIHandlers::CheckBox, &EditorDiffuseProbeGridComponent::m_scrolling, "Scrolling", "Scrolling causes the grid to move probes on the edges of the volume when it is translated, instead of moving all of the probes.  Use scrolling when the DiffuseProbeGrid is attached to a camera or moving entity.")
                                 ->Attribute(AZ::Edit::Attributes::ChangeValidate, &EditorDiffuseProbeGridComponent::OnScrollingChangeValidate)
                                 ->Attribute(AZ::Edit::Attributes::ChangeNotify, &EditorDiffuseProbeGridComponent::OnScrollingChanged)
+                            ->DataElement(AZ::Edit::UIHandlers::CheckBox, &EditorDiffuseProbeGridComponent::m_cameraRelative, "Camera Relative", "Moves the scrolling DiffuseProbeGrid with the camera, in steps of the probe spacing, so that only the probes that scroll into the volume need to be updated from scratch.")
+                                ->Attribute(AZ::Edit::Attributes::ChangeNotify, &EditorDiffuseProbeGridComponent::OnCameraRelativeChanged)
+                                ->Attribute(AZ::Edit::Attributes::Visibility, &EditorDiffuseProbeGridComponent::m_scrolling)
                             ->DataElement(AZ::Edit::UIHandlers::CheckBox, &EditorDiffuseProbeGridComponent::m_edgeBlendIbl, "Edge Blend IBL", "Blend the edges of the DiffuseProbeGrid with the Diffuse IBL cubemap.")
                                 ->Attribute(AZ::Edit::Attributes::ChangeNotify, &EditorDiffuseProbeGridComponent::OnEdgeBlendIblChanged)
                             ->DataElement(AZ::Edit::UIHandlers::SpinBox, &EditorDiffuseProbeGridComponent::m_frameUpdateCount, "Number of Update Frames", "The number of frames to update the complete DiffuseProbeGrid, by updating a subset of the probes each frame.  This will improve the performance of the Real-Time DiffuseProbeGrid update.")
@@ -404,6 +408,12 @@ namespace AZ
         AZ::u32 EditorDiffuseProbeGridComponent::OnScrollingChanged()
         {
             m_controller.SetScrolling(m_scrolling);
+            return AZ::Edit::PropertyRefreshLevels::AttributesAndValues;
+        }
+
+        AZ::u32 EditorDiffuseProbeGridComponent::OnCameraRelativeChanged()
+        {
+            m_controller.SetCameraRelative(m_cameraRelative);
             return AZ::Edit::PropertyRefreshLevels::None;
         }
 
@@ -111,7 +111,8 @@ namespace AZ
             }
 
             m_probeRayRotation = AZ::Quaternion::CreateIdentity();
-            m_frameUpdateIndex = (m_frameUpdateIndex + 1) % m_frameUpdateCount;
+            m_frameUpdateIndex = (m_frameUpdateIndex + 1) % GetFrameUpdateCount();
+            m_priorityUpdateFrames = (m_priorityUpdateFrames > 0) ? m_priorityUpdateFrames - 1 : 0;
         }
 
         bool DiffuseProbeGrid::ValidateProbeSpacing(const AZ::Vector3& newSpacing)
@@ -165,6 +166,12 @@ namespace AZ
             // probes need to be relocated since the grid position changed
             m_remainingRelocationIterations = DefaultNumRelocationIterations;
 
+            // all of the probes moved unless the grid is scrolling, in which case only the probes that scrolled in need to converge
+            if (!m_scrolling)
+            {
+                m_priorityUpdateFrames = DefaultNumPriorityUpdateFrames;
+            }
+
             m_updateRenderObjectSrg = true;
         }
 
@@ -231,6 +238,29 @@ namespace AZ
             m_gridDataInitialized = false;
         }
 
+        void DiffuseProbeGrid::UpdateCameraRelativePosition(const AZ::Vector3& cameraPosition)
+        {
+            if (!m_cameraRelative || !m_scrolling || !m_probeSpacing.IsGreaterThan(AZ::Vector3::CreateZero()))
+            {
+                return;
+            }
+
+            // snap the camera position to the probe spacing in the space of the grid
+            const AZ::Quaternion& rotation = m_transform.GetRotation();
+            AZ::Vector3 gridSpacePosition = rotation.GetInverseFull().TransformVector(cameraPosition);
+            gridSpacePosition = (gridSpacePosition / m_probeSpacing).GetFloor() * m_probeSpacing;
+            AZ::Vector3 snappedPosition = rotation.TransformVector(gridSpacePosition);
+
+            if (snappedPosition.IsClose(m_transform.GetTranslation()))
+            {
+                return;
+            }
+
+            AZ::Transform transform = m_transform;
+            transform.SetTranslation(snappedPosition);
+            SetTransform(transform);
+        }
+
         void DiffuseProbeGrid::SetEdgeBlendIbl(bool edgeBlendIbl)
         {
             if (m_edgeBlendIbl == edgeBlendIbl)
@@ -407,6 +437,9 @@ namespace AZ
 
             m_updateTextures = false;
 
+            // the probes are starting over, so update them at the full rate until they converge
+            m_priorityUpdateFrames = DefaultNumPriorityUpdateFrames;
+
             // textures have changed so we need to update the render Srg to bind the new ones
             m_updateRenderObjectSrg = true;
 
@@ -524,7 +557,7 @@ namespace AZ
             m_rayTraceSrg->SetConstant(m_renderData->m_rayTraceSrgAmbientMultiplierNameIndex, m_ambientMultiplier);
             m_rayTraceSrg->SetConstant(m_renderData->m_rayTraceSrgGiShadowsNameIndex, m_giShadows);
             m_rayTraceSrg->SetConstant(m_renderData->m_rayTraceSrgUseDiffuseIblNameIndex, m_useDiffuseIbl);
-            m_rayTraceSrg->SetConstant(m_renderData->m_rayTraceSrgFrameUpdateCountNameIndex, m_frameUpdateCount);
+            m_rayTraceSrg->SetConstant(m_renderData->m_rayTraceSrgFrameUpdateCountNameIndex, GetFrameUpdateCount());
             m_rayTraceSrg->SetConstant(m_renderData->m_rayTraceSrgFrameUpdateIndexNameIndex, m_frameUpdateIndex);
             m_rayTraceSrg->SetConstant(m_renderData->m_rayTraceSrgTransparencyModeNameIndex, aznumeric_cast<uint32_t>(m_transparencyMode));
             m_rayTraceSrg->SetConstant(m_renderData->m_rayTraceSrgEmissiveMultiplierNameIndex, m_emissiveMultiplier);
@@ -542,7 +575,7 @@ namespace AZ
             m_blendIrradianceSrg->SetImageView(m_renderData->m_blendIrradianceSrgProbeRayTraceNameIndex, m_rayTraceImage[m_currentImageIndex]->GetImageView(m_renderData->m_probeRayTraceImageViewDescriptor).get());
             m_blendIrradianceSrg->SetImageView(m_renderData->m_blendIrradianceSrgProbeIrradianceNameIndex, m_irradianceImage[m_currentImageIndex]->GetImageView(m_renderData->m_probeIrradianceImageViewDescriptor).get());
             m_blendIrradianceSrg->SetImageView(m_renderData->m_blendIrradianceSrgProbeDataNameIndex, m_probeDataImage[m_currentImageIndex]->GetImageView(m_renderData->m_probeDataImageViewDescriptor).get());
-            m_blendIrradianceSrg->SetConstant(m_renderData->m_blendIrradianceSrgFrameUpdateCountNameIndex, m_frameUpdateCount);
+            m_blendIrradianceSrg->SetConstant(m_renderData->m_blendIrradianceSrgFrameUpdateCountNameIndex, GetFrameUpdateCount());
             m_blendIrradianceSrg->SetConstant(m_renderData->m_blendIrradianceSrgFrameUpdateIndexNameIndex, m_frameUpdateIndex);
         }
 
@@ -558,7 +591,7 @@ namespace AZ
             m_blendDistanceSrg->SetImageView(m_renderData->m_blendDistanceSrgProbeRayTraceNameIndex, m_rayTraceImage[m_currentImageIndex]->GetImageView(m_renderData->m_probeRayTraceImageViewDescriptor).get());
             m_blendDistanceSrg->SetImageView(m_renderData->m_blendDistanceSrgProbeDistanceNameIndex, m_distanceImage[m_currentImageIndex]->GetImageView(m_renderData->m_probeDistanceImageViewDescriptor).get());
             m_blendDistanceSrg->SetImageView(m_renderData->m_blendDistanceSrgProbeDataNameIndex, m_probeDataImage[m_currentImageIndex]->GetImageView(m_renderData->m_probeDataImageViewDescriptor).get());
-            m_blendDistanceSrg->SetConstant(m_renderData->m_blendDistanceSrgFrameUpdateCountNameIndex, m_frameUpdateCount);
+            m_blendDistanceSrg->SetConstant(m_renderData->m_blendDistanceSrgFrameUpdateCountNameIndex, GetFrameUpdateCount());
             m_blendDistanceSrg->SetConstant(m_renderData->m_blendDistanceSrgFrameUpdateIndexNameIndex, m_frameUpdateIndex);
         }
 
@@ -626,7 +659,7 @@ namespace AZ
             m_relocationSrg->SetBufferView(m_renderData->m_relocationSrgGridDataNameIndex, m_gridDataBuffer->GetBufferView(m_renderData->m_gridDataBufferViewDescriptor).get());
             m_relocationSrg->SetImageView(m_renderData->m_relocationSrgProbeRayTraceNameIndex, m_rayTraceImage[m_currentImageIndex]->GetImageView(m_renderData->m_probeRayTraceImageViewDescriptor).get());
             m_relocationSrg->SetImageView(m_renderData->m_relocationSrgProbeDataNameIndex, m_probeDataImage[m_currentImageIndex]->GetImageView(m_renderData->m_probeDataImageViewDescriptor).get());
-            m_relocationSrg->SetConstant(m_renderData->m_relocationSrgFrameUpdateCountNameIndex, m_frameUpdateCount);
+            m_relocationSrg->SetConstant(m_renderData->m_relocationSrgFrameUpdateCountNameIndex, GetFrameUpdateCount());
             m_relocationSrg->SetConstant(m_renderData->m_relocationSrgFrameUpdateIndexNameIndex, m_frameUpdateIndex);
         }
 
@@ -641,7 +674,7 @@ namespace AZ
             m_classificationSrg->SetBufferView(m_renderData->m_classificationSrgGridDataNameIndex, m_gridDataBuffer->GetBufferView(m_renderData->m_gridDataBufferViewDescriptor).get());
             m_classificationSrg->SetImageView(m_renderData->m_classificationSrgProbeRayTraceNameIndex, m_rayTraceImage[m_currentImageIndex]->GetImageView(m_renderData->m_probeRayTraceImageViewDescriptor).get());
             m_classificationSrg->SetImageView(m_renderData->m_classificationSrgProbeDataNameIndex, m_probeDataImage[m_currentImageIndex]->GetImageView(m_renderData->m_probeDataImageViewDescriptor).get());
-            m_classificationSrg->SetConstant(m_renderData->m_classificationSrgFrameUpdateCountNameIndex, m_frameUpdateCount);
+            m_classificationSrg->SetConstant(m_renderData->m_classificationSrgFrameUpdateCountNameIndex, GetFrameUpdateCount());
             m_classificationSrg->SetConstant(m_renderData->m_classificationSrgFrameUpdateIndexNameIndex, m_frameUpdateIndex);
         }
 
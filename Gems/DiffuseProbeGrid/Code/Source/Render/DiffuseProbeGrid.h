@@ -206,12 +206,25 @@ namespace AZ
             bool GetScrolling() const { return m_scrolling; }
             void SetScrolling(bool scrolling);
 
+            //! Camera-relative grids follow the camera, snapped to the probe spacing so that a scrolling grid
+            //! only shifts by whole probes and only the probes that scroll in need to be traced from scratch
+            bool GetCameraRelative() const { return m_cameraRelative; }
+            void SetCameraRelative(bool cameraRelative) { m_cameraRelative = cameraRelative; }
+            void UpdateCameraRelativePosition(const AZ::Vector3& cameraPosition);
+
             bool GetEdgeBlendIbl() const { return m_edgeBlendIbl; }
             void SetEdgeBlendIbl(bool edgeBlendIbl);
 
-            uint32_t GetFrameUpdateCount() const { return m_frameUpdateCount; }
+            // the number of frames used to update all of the probes, which is the larger of the grid setting and the probe update budget
+            uint32_t GetFrameUpdateCount() const { return AZStd::max(m_frameUpdateCount, m_budgetFrameUpdateCount); }
             void SetFrameUpdateCount(uint32_t frameUpdateCount) { m_frameUpdateCount = frameUpdateCount; }
 
+            // the number of frames the probe update budget spreads the probe updates over, 0 if the grid is not limited by the budget
+            void SetBudgetFrameUpdateCount(uint32_t budgetFrameUpdateCount) { m_budgetFrameUpdateCount = budgetFrameUpdateCount; }
+
+            // returns true if the grid changed recently and needs to update at its full rate until the probes converge
+            bool GetUpdatePriority() const { return m_priorityUpdateFrames > 0; }
+
             uint32_t GetFrameUpdateIndex() const { return m_frameUpdateIndex; }
 
             DiffuseProbeGridTransparencyMode GetTransparencyMode() const { return m_transparencyMode; }
@@ -307,6 +320,7 @@ namespace AZ
             static constexpr uint32_t DefaultNumIrradianceTexels = 6;
             static constexpr uint32_t DefaultNumDistanceTexels = 14;
             static constexpr int32_t DefaultNumRelocationIterations = 100;
+            static constexpr uint32_t DefaultNumPriorityUpdateFrames = 60;
 
             // visualization TLAS
             const RHI::Ptr<RHI::RayTracingTlas>& GetVisualizationTlas() const { return m_visualizationTlas; }
@@ -367,6 +381,7 @@ namespace AZ
             bool  m_giShadows = true;
             bool  m_useDiffuseIbl = true;
             bool  m_scrolling = false;
+            bool  m_cameraRelative = false;
             bool  m_edgeBlendIbl = true;
             float m_emissiveMultiplier = DefaultDiffuseProbeGridEmissiveMultiplier;
 
@@ -377,6 +392,12 @@ namespace AZ
             uint32_t m_frameUpdateCount = 1;
             uint32_t m_frameUpdateIndex = 0;
 
+            // frame count assigned by the probe update budget of the feature processor
+            uint32_t m_budgetFrameUpdateCount = 0;
+
+            // remaining frames this grid is updated at its full rate after a change
+            uint32_t m_priorityUpdateFrames = DefaultNumPriorityUpdateFrames;
+
             // rotation transform applied to probe rays
             AZ::Quaternion m_probeRayRotation;
             AZ::SimpleLcgRandom m_random;
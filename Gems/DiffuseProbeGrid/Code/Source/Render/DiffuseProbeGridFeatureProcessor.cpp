@@ -22,6 +22,8 @@
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RHI/PipelineState.h>
 #include <Atom/RHI.Reflect/InputStreamLayoutBuilder.h>
+#include <AzCore/Console/Console.h>
+#include <AzCore/Math/MathUtils.h>
 
 // This component invokes shaders based on Nvidia's RTX-GI SDK.
 // Please refer to "Shaders/DiffuseGlobalIllumination/Nvidia RTX-GI License.txt" for license information.
@@ -30,6 +32,13 @@ namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(uint32_t, r_diffuseProbeGridProbeUpdateBudget, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Maximum number of probes updated per frame across all visible real-time DiffuseProbeGrids, 0 to disable the budget. "
+            "Grids closer to the camera get a larger share of the budget, and grids that recently changed are always updated at their full rate.");
+
+        AZ_CVAR(uint32_t, r_diffuseProbeGridMaxBudgetFrameUpdateCount, 32, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Maximum number of frames the probe update budget can spread the update of a DiffuseProbeGrid over.");
+
         void DiffuseProbeGridFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -246,6 +255,10 @@ namespace AZ
                 m_probeGridSortRequired = false;
             }
 
+            // move the camera-relative grids and distribute the probe update budget before the grids advance their frame update index
+            UpdateCameraRelativeProbeGrids();
+            UpdateProbeUpdateBudget();
+
             // call Simulate on all diffuse probe grids
             for (uint32_t probeGridIndex = 0; probeGridIndex < m_diffuseProbeGrids.size(); ++probeGridIndex)
             {
@@ -273,6 +286,83 @@ namespace AZ
             }
         }
 
+        bool DiffuseProbeGridFeatureProcessor::GetCameraPosition(AZ::Vector3& cameraPosition) const
+        {
+            RPI::RenderPipelinePtr renderPipeline = GetParentScene()->GetDefaultRenderPipeline();
+            if (!renderPipeline || !renderPipeline->GetDefaultView())
+            {
+                return false;
+            }
+
+            cameraPosition = renderPipeline->GetDefaultView()->GetCameraTransform().GetTranslation();
+            return true;
+        }
+
+        void DiffuseProbeGridFeatureProcessor::UpdateCameraRelativeProbeGrids()
+        {
+            AZ::Vector3 cameraPosition;
+            if (!GetCameraPosition(cameraPosition))
+            {
+                return;
+            }
+
+            for (auto& diffuseProbeGrid : m_realTimeDiffuseProbeGrids)
+            {
+                if (diffuseProbeGrid->GetCameraRelative())
+                {
+                    diffuseProbeGrid->UpdateCameraRelativePosition(cameraPosition);
+                }
+            }
+        }
+
+        void DiffuseProbeGridFeatureProcessor::UpdateProbeUpdateBudget()
+        {
+            const uint32_t probeUpdateBudget = r_diffuseProbeGridProbeUpdateBudget;
+            AZ::Vector3 cameraPosition = AZ::Vector3::CreateZero();
+            if (probeUpdateBudget == 0 || !GetCameraPosition(cameraPosition))
+            {
+                for (auto& diffuseProbeGrid : m_realTimeDiffuseProbeGrids)
+                {
+                    diffuseProbeGrid->SetBudgetFrameUpdateCount(0);
+                }
+                return;
+            }
+
+            // grids that recently changed are updated at their full rate and are charged to the budget first,
+            // the remaining budget is shared by the other visible grids in inverse proportion to their distance from the camera
+            static const float MinProbeGridDistance = 1.0f;
+            uint32_t remainingBudget = probeUpdateBudget;
+            float totalWeight = 0.0f;
+            for (auto& diffuseProbeGrid : m_visibleRealTimeDiffuseProbeGrids)
+            {
+                diffuseProbeGrid->SetBudgetFrameUpdateCount(0);
+                if (diffuseProbeGrid->GetUpdatePriority())
+                {
+                    uint32_t probeCount = AZ::DivideAndRoundUp(diffuseProbeGrid->GetTotalProbeCount(), diffuseProbeGrid->GetFrameUpdateCount());
+                    remainingBudget -= AZStd::min(remainingBudget, probeCount);
+                }
+                else
+                {
+                    totalWeight += 1.0f / AZStd::max(diffuseProbeGrid->GetObbWs().GetDistance(cameraPosition), MinProbeGridDistance);
+                }
+            }
+
+            // every grid updates at least one probe per frame, and spreads its update over a bounded number of frames
+            const uint32_t maxBudgetFrameUpdateCount = AZStd::max<uint32_t>(r_diffuseProbeGridMaxBudgetFrameUpdateCount, 1);
+            for (auto& diffuseProbeGrid : m_visibleRealTimeDiffuseProbeGrids)
+            {
+                if (diffuseProbeGrid->GetUpdatePriority())
+                {
+                    continue;
+                }
+
+                float weight = 1.0f / AZStd::max(diffuseProbeGrid->GetObbWs().GetDistance(cameraPosition), MinProbeGridDistance);
+                uint32_t probeCount = AZStd::max(aznumeric_cast<uint32_t>(remainingBudget * (weight / totalWeight)), 1u);
+                uint32_t frameUpdateCount = AZ::DivideAndRoundUp(diffuseProbeGrid->GetTotalProbeCount(), probeCount);
+                diffuseProbeGrid->SetBudgetFrameUpdateCount(AZStd::min(frameUpdateCount, maxBudgetFrameUpdateCount));
+            }
+        }
+
         void DiffuseProbeGridFeatureProcessor::OnBeginPrepareRender()
         {
             for (auto& diffuseProbeGrid : m_realTimeDiffuseProbeGrids)
@@ -594,6 +684,12 @@ namespace AZ
             probeGrid->SetScrolling(scrolling);
         }
 
+        void DiffuseProbeGridFeatureProcessor::SetCameraRelative(const DiffuseProbeGridHandle& probeGrid, bool cameraRelative)
+        {
+            AZ_Assert(probeGrid.get(), "SetCameraRelative called with an invalid handle");
+            probeGrid->SetCameraRelative(cameraRelative);
+        }
+
         void DiffuseProbeGridFeatureProcessor::SetEdgeBlendIbl(const DiffuseProbeGridHandle& probeGrid, bool edgeBlendIbl)
         {
             AZ_Assert(probeGrid.get(), "SetEdgeBlendIbl called with an invalid handle");
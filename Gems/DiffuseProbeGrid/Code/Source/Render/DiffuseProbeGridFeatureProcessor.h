@@ -52,6 +52,7 @@ namespace AZ
             void SetUseDiffuseIbl(const DiffuseProbeGridHandle& probeGrid, bool useDiffuseIbl) override;
             void SetMode(const DiffuseProbeGridHandle& probeGrid, DiffuseProbeGridMode mode) override;
             void SetScrolling(const DiffuseProbeGridHandle& probeGrid, bool scrolling) override;
+            void SetCameraRelative(const DiffuseProbeGridHandle& probeGrid, bool cameraRelative) override;
             void SetEdgeBlendIbl(const DiffuseProbeGridHandle& probeGrid, bool edgeBlendIbl) override;
             void SetFrameUpdateCount(const DiffuseProbeGridHandle& probeGrid, uint32_t frameUpdateCount) override;
             void SetTransparencyMode(const DiffuseProbeGridHandle& probeGrid, DiffuseProbeGridTransparencyMode transparencyMode) override;
@@ -129,6 +130,15 @@ namespace AZ
             // updates the real-time list for a specific probe grid
             void UpdateRealTimeList(const DiffuseProbeGridHandle& diffuseProbeGrid);
 
+            // retrieves the camera position of the default view, returns false if there is no default view
+            bool GetCameraPosition(AZ::Vector3& cameraPosition) const;
+
+            // moves the camera-relative probe grids to the camera position
+            void UpdateCameraRelativeProbeGrids();
+
+            // distributes the per-frame probe update budget across the visible real-time probe grids
+            void UpdateProbeUpdateBudget();
+
             // adds a notification entry for a new asset
             void AddNotificationEntry(const AZStd::string& relativePath);
 
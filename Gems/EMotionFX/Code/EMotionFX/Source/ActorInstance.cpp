@@ -313,6 +313,11 @@ namespace EMotionFX
                 return;
             }
 
+            if (m_motionSamplingInterpolationEnabled)
+            {
+                InterpolateSampledPoses(sampleMotions);
+            }
+
             m_transformData->GetCurrentPose()->ApplyMorphWeightsToActorInstance();
             ApplyMorphSetup();
 
@@ -1196,6 +1201,10 @@ namespace EMotionFX
 
             // Make sure the LOD level is valid and update it.
             m_lodLevel = MCore::Clamp<size_t>(m_requestedLODLevel, 0, m_actor->GetNumLODLevels() - 1);
+
+            // The sampled poses don't hold valid transforms for the newly enabled joints, so restart the interpolation.
+            m_previousSampledPose.reset();
+            m_lastSampledPose.reset();
         }
     }
 
@@ -1705,6 +1714,53 @@ namespace EMotionFX
         return m_motionSamplingRate;
     }
 
+    void ActorInstance::SetMotionSamplingInterpolationEnabled(bool enabled)
+    {
+        m_motionSamplingInterpolationEnabled = enabled;
+        if (!enabled)
+        {
+            m_previousSampledPose.reset();
+            m_lastSampledPose.reset();
+        }
+    }
+
+    bool ActorInstance::GetMotionSamplingInterpolationEnabled() const
+    {
+        return m_motionSamplingInterpolationEnabled;
+    }
+
+    void ActorInstance::InterpolateSampledPoses(bool sampledMotions)
+    {
+        // the current pose holds the last sample when motions aren't sampled every update
+        if (m_motionSamplingRate <= 0.0f)
+        {
+            m_previousSampledPose.reset();
+            m_lastSampledPose.reset();
+            return;
+        }
+
+        Pose* currentPose = m_transformData->GetCurrentPose();
+        if (!m_lastSampledPose)
+        {
+            m_previousSampledPose = AZStd::make_unique<Pose>();
+            m_previousSampledPose->LinkToActorInstance(this);
+            m_previousSampledPose->InitFromPose(currentPose);
+            m_lastSampledPose = AZStd::make_unique<Pose>();
+            m_lastSampledPose->LinkToActorInstance(this);
+            m_lastSampledPose->InitFromPose(currentPose);
+        }
+        else if (sampledMotions)
+        {
+            AZStd::swap(m_previousSampledPose, m_lastSampledPose);
+            m_lastSampledPose->InitFromPose(currentPose);
+        }
+
+        // the timer got reset when sampling, so this goes from the previous to the last sample within one sample interval
+        const float weight = AZ::GetClamp(m_motionSamplingTimer / m_motionSamplingRate, 0.0f, 1.0f);
+        currentPose->InitFromPose(m_previousSampledPose.get());
+        currentPose->Blend(m_lastSampledPose.get(), weight);
+    }
+
     void ActorInstance::IncreaseNumAttachmentRefs(uint8 numToIncreaseWith)
     {
         m_numAttachmentRefs += numToIncreaseWith;
@@ -864,6 +864,16 @@ namespace EMotionFX
         float GetMotionSamplingTimer() const;
         float GetMotionSamplingRate() const;
 
+        /**
+         * Enable or disable interpolation between motion samples.
+         * When the motion sampling rate is throttled, the pose is held between two samples. With interpolation enabled, the pose is
+         * blended from the previous to the last sampled pose instead, which smooths out the lower update rate at the cost of showing
+         * the animation one sample interval late.
+         * @param enabled Set to true to interpolate between the sampled poses.
+         */
+        void SetMotionSamplingInterpolationEnabled(bool enabled);
+        bool GetMotionSamplingInterpolationEnabled() const;
+
         MCORE_INLINE size_t GetNumNodes() const         { return m_actor->GetSkeleton()->GetNumNodes(); }
 
         void UpdateVisualizeScale();                    // not automatically called on creation for performance reasons (this method relatively is slow as it updates all meshes)
@@ -899,6 +909,9 @@ namespace EMotionFX
         float                   m_boundsUpdatePassedTime;/**< The time passed since the last bounds update. */
         float                   m_motionSamplingRate;    /**< The motion sampling rate in seconds, where 0.1 would mean to update 10 times per second. A value of 0 or lower means to update every frame. */
         float                   m_motionSamplingTimer;   /**< The time passed since the last time we sampled motions/anim graphs. */
+        AZStd::unique_ptr<Pose> m_previousSampledPose;   /**< The pose of the sample before the last one, when interpolating between motion samples. */
+        AZStd::unique_ptr<Pose> m_lastSampledPose;       /**< The pose of the last sample, when interpolating between motion samples. */
+        bool                    m_motionSamplingInterpolationEnabled = false; /**< Interpolate between the sampled poses when the motion sampling rate is throttled? */
         float                   m_visualizeScale;        /**< Some visualization scale factor when rendering for example normals, to be at a nice size, relative to the character. */
         size_t                  m_lodLevel;              /**< The current LOD level, where 0 is the highest detail. */
         size_t                  m_requestedLODLevel;    /**< Requested LOD level. The actual LOD level will be updated as soon as all transforms for the requested LOD level are ready. */
@@ -1019,5 +1032,12 @@ namespace EMotionFX
          * newly enabled joints (the ones that were not present and thus also not updated in the lower LOD level)will contain incorrect data.
          */
         void UpdateLODLevel();
+
+        /*
+         * Replace the current pose by the interpolation between the previous and the last sampled poses, based on the motion sampling timer.
+         * This function should only be called from within UpdateTransformations(), after the anim graph or motion system output the current pose.
+         * @param sampledMotions True when the motions got sampled this update, in which case the current pose is the new last sampled pose.
+         */
+        void InterpolateSampledPoses(bool sampledMotions);
     };
 }   // namespace EMotionFX
@@ -188,6 +188,7 @@ namespace EMotionFX
 
         // reserve some memory
         m_nodes.reserve(1024);
+        m_nodeObjectIndices.reserve(1024);
 
         // automatically register the anim graph
         GetAnimGraphManager().AddAnimGraph(this);
@@ -856,6 +857,7 @@ namespace EMotionFX
             AnimGraphNode* node = static_cast<AnimGraphNode*>(object);
             node->SetNodeIndex(m_nodes.size());
             m_nodes.emplace_back(node);
+            m_nodeObjectIndices.emplace_back(object->GetObjectIndex());
         }
 
         // create a unique data for this added object in the animgraph instances as well
@@ -905,6 +907,13 @@ namespace EMotionFX
             // remove the object from the array
             m_nodes.erase(AZStd::next(begin(m_nodes), nodeIndex));
         }
+
+        // the object indices of the nodes after the removed object shifted, so rebuild them
+        m_nodeObjectIndices.resize(m_nodes.size());
+        for (size_t i = 0; i < m_nodes.size(); ++i)
+        {
+            m_nodeObjectIndices[i] = m_nodes[i]->GetObjectIndex();
+        }
     }
 
 
@@ -919,6 +928,7 @@ namespace EMotionFX
     void AnimGraph::ReserveNumNodes(size_t numNodes)
     {
         m_nodes.reserve(numNodes);
+        m_nodeObjectIndices.reserve(numNodes);
     }
 
 
@@ -388,6 +388,7 @@ namespace EMotionFX
 
         size_t GetNumNodes() const                                                            { return m_nodes.size(); }
         AnimGraphNode* GetNode(size_t index) const                                            { return m_nodes[index]; }
+        const AZStd::vector<size_t>& GetNodeObjectIndices() const                             { return m_nodeObjectIndices; }
         void ReserveNumNodes(size_t numNodes);
         size_t CalcNumMotionNodes() const;
 
@@ -423,6 +424,7 @@ namespace EMotionFX
         AZStd::vector<AnimGraphNodeGroup*>              m_nodeGroups;
         AZStd::vector<AnimGraphObject*>                 m_objects;
         AZStd::vector<AnimGraphNode*>                    m_nodes;
+        AZStd::vector<size_t>                           m_nodeObjectIndices;    /**< The object index of each node, so that per frame passes over all nodes can index the unique datas of an instance directly. */
         AZStd::vector<AnimGraphInstance*>               m_animGraphInstances;
         AZStd::string                                   m_fileName;
         AnimGraphStateMachine*                          m_rootStateMachine;
@@ -884,8 +884,7 @@ namespace EMotionFX
 
         // reset all node pose ref counts
         const uint32 threadIndex = m_actorInstance->GetThreadIndex();
-        ResetPoseRefCountsForAllNodes();
-        ResetRefDataRefCountsForAllNodes();
+        ResetRefCountsForAllNodes();
         GetEMotionFX().GetThreadData(threadIndex)->GetRefCountedDataPool().ResetMaxUsedItems();
 
         // perform a bottom-up update, which updates the nodes, and sets their sync tracks, and play time etc
@@ -970,6 +969,23 @@ namespace EMotionFX
     }
 
 
+    // reset the pose and ref data ref counts of all nodes, walking the flat node object index table of the anim graph
+    void AnimGraphInstance::ResetRefCountsForAllNodes()
+    {
+        AZ_PROFILE_SCOPE(Animation, "AnimGraphInstance::ResetRefCountsForAllNodes");
+
+        for (const size_t objectIndex : m_animGraph->GetNodeObjectIndices())
+        {
+            AnimGraphNodeData* uniqueData = static_cast<AnimGraphNodeData*>(m_uniqueDatas[objectIndex]);
+            if (uniqueData)
+            {
+                uniqueData->SetPoseRefCount(0);
+                uniqueData->SetRefDataRefCount(0);
+            }
+        }
+    }
+
+
     // reset all node flags
     void AnimGraphInstance::ResetFlagsForAllObjects()
     {
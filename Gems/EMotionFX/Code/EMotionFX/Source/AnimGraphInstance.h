@@ -152,6 +152,7 @@ namespace EMotionFX
         void ResetFlagsForAllObjects();
         void ResetPoseRefCountsForAllNodes();
         void ResetRefDataRefCountsForAllNodes();
+        void ResetRefCountsForAllNodes();   // resets both the pose and ref data ref counts in a single pass
 
         void InitInternalAttributes();
         size_t GetNumInternalAttributes() const;
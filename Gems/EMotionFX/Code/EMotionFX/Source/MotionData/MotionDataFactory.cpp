@@ -9,6 +9,7 @@
 #include <EMotionFX/Source/MotionData/MotionDataFactory.h>
 #include <EMotionFX/Source/MotionData/MotionData.h>
 #include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionData/QuantizedMotionData.h>
 #include <EMotionFX/Source/MotionData/UniformMotionData.h>
 
 namespace EMotionFX
@@ -22,6 +23,7 @@ namespace EMotionFX
     {
         Register(aznew UniformMotionData());
         Register(aznew NonUniformMotionData());
+        Register(aznew QuantizedMotionData());
     }
 
     void MotionDataFactory::Clear()
@@ -0,0 +1,1197 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/limits.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/MorphSetup.h>
+#include <EMotionFX/Source/MorphSetupInstance.h>
+#include <EMotionFX/Source/MotionData/QuantizedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/TransformData.h>
+
+#include <EMotionFX/Source/Importer/SharedFileFormatStructs.h>
+#include <EMotionFX/Exporters/ExporterLib/Exporter/Exporter.h>
+#include <MCore/Source/CompressedQuaternion.h>
+#include <MCore/Source/LogManager.h>
+
+namespace EMotionFX
+{
+    namespace
+    {
+        constexpr float MaxQuantizedValue = 65535.0f;
+    }
+
+    QuantizedMotionData::~QuantizedMotionData()
+    {
+        ClearAllData();
+    }
+
+    MotionData* QuantizedMotionData::CreateNew() const
+    {
+        return aznew QuantizedMotionData();
+    }
+
+    const char* QuantizedMotionData::GetSceneSettingsName() const
+    {
+        return "Quantized Keyframe Blocks (fast, smallest)";
+    }
+
+    void QuantizedMotionData::InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate, float newSampleRate, [[maybe_unused]] bool updateDuration)
+    {
+        AZ_Assert(newSampleRate > 0.0f, "Expected the sample rate to be larger than zero.");
+        float sampleRate = keepSameSampleRate ? motionData->GetSampleRate() : newSampleRate;
+
+        // Calculate the sample spacing and number of samples required.
+        float sampleSpacing = 0.0f;
+        size_t numSamples = 0;
+        MotionData::CalculateSampleInformation(motionData->GetDuration(), sampleRate, numSamples, sampleSpacing);
+
+        Clear();
+        CopyBaseMotionData(motionData);
+        SetSampleRate(sampleRate);
+        m_numSamples = numSamples;
+
+        AZ_Warning("EMotionFX", AZ::IsClose(m_sampleSpacing, sampleSpacing, AZ::Constants::FloatEpsilon),
+            "Corrected sample spacing should match the set inverse sample rate. Floating point accuracy error.");
+
+        // Sample all animated channels, giving each of them a range of components in the order of joints, morphs and floats.
+        ComponentSamples componentSamples;
+        const auto addComponents = [this, &componentSamples](size_t numComponents)
+        {
+            const AZ::u32 firstComponent = static_cast<AZ::u32>(componentSamples.size());
+            componentSamples.resize(componentSamples.size() + numComponents, AZStd::vector<float>(m_numSamples));
+            return firstComponent;
+        };
+
+        // Joints.
+        const size_t numJoints = GetNumJoints();
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            if (!motionData->IsJointAnimated(i))
+            {
+                continue;
+            }
+
+            JointChannels& channels = m_jointChannels[i];
+            const bool posAnimated = motionData->IsJointPositionAnimated(i);
+            const bool rotAnimated = motionData->IsJointRotationAnimated(i);
+            if (posAnimated) { channels.m_position = addComponents(3); }
+            if (rotAnimated) { channels.m_rotation = addComponents(4); }
+            EMFX_SCALECODE
+            (
+                const bool scaleAnimated = motionData->IsJointScaleAnimated(i);
+                if (scaleAnimated) { channels.m_scale = addComponents(3); }
+            )
+
+            AZ::Quaternion previousRotation = AZ::Quaternion::CreateIdentity();
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                const float keyTime = s * m_sampleSpacing;
+                const Transform transform = motionData->SampleJointTransform(keyTime, i);
+                if (posAnimated)
+                {
+                    componentSamples[channels.m_position + 0][s] = transform.m_position.GetX();
+                    componentSamples[channels.m_position + 1][s] = transform.m_position.GetY();
+                    componentSamples[channels.m_position + 2][s] = transform.m_position.GetZ();
+                }
+
+                if (rotAnimated)
+                {
+                    // Keep the rotations in the same hemisphere, so that interpolating the components takes the shortest path.
+                    AZ::Quaternion rotation = transform.m_rotation.GetNormalized();
+                    if (s > 0 && rotation.Dot(previousRotation) < 0.0f)
+                    {
+                        rotation = -rotation;
+                    }
+                    previousRotation = rotation;
+
+                    componentSamples[channels.m_rotation + 0][s] = rotation.GetX();
+                    componentSamples[channels.m_rotation + 1][s] = rotation.GetY();
+                    componentSamples[channels.m_rotation + 2][s] = rotation.GetZ();
+                    componentSamples[channels.m_rotation + 3][s] = rotation.GetW();
+                }
+
+                EMFX_SCALECODE
+                (
+                    if (scaleAnimated)
+                    {
+                        componentSamples[channels.m_scale + 0][s] = transform.m_scale.GetX();
+                        componentSamples[channels.m_scale + 1][s] = transform.m_scale.GetY();
+                        componentSamples[channels.m_scale + 2][s] = transform.m_scale.GetZ();
+                    }
+                )
+            }
+        }
+
+        // Morphs.
+        const size_t numMorphs = GetNumMorphs();
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            if (!motionData->IsMorphAnimated(i))
+            {
+                continue;
+            }
+
+            m_morphChannels[i] = addComponents(1);
+            AZStd::vector<float>& values = componentSamples[m_morphChannels[i]];
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                values[s] = motionData->SampleMorph(s * m_sampleSpacing, i);
+            }
+        }
+
+        // Floats.
+        const size_t numFloats = GetNumFloats();
+        for (size_t i = 0; i < numFloats; ++i)
+        {
+            if (!motionData->IsFloatAnimated(i))
+            {
+                continue;
+            }
+
+            m_floatChannels[i] = addComponents(1);
+            AZStd::vector<float>& values = componentSamples[m_floatChannels[i]];
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                values[s] = motionData->SampleFloat(s * m_sampleSpacing, i);
+            }
+        }
+
+        EncodeBlocks(componentSamples);
+    }
+
+    void QuantizedMotionData::EncodeBlocks(const ComponentSamples& componentSamples)
+    {
+        m_numComponents = componentSamples.size();
+
+        // Each block covers BlockSize sample intervals, so the last sample of a block is the first sample of the next one.
+        if (m_numSamples > 1)
+        {
+            m_numBlocks = (m_numSamples - 2) / BlockSize + 1;
+        }
+        else
+        {
+            m_numBlocks = m_numSamples;
+        }
+
+        m_blockRanges.resize(m_numBlocks * m_numComponents * 2);
+        m_blockSamples.resize(m_numBlocks * (BlockSize + 1) * m_numComponents);
+
+        for (size_t block = 0; block < m_numBlocks; ++block)
+        {
+            const size_t firstSample = block * BlockSize;
+            float* blockRanges = m_blockRanges.data() + block * m_numComponents * 2;
+            AZ::u16* blockSamples = m_blockSamples.data() + block * (BlockSize + 1) * m_numComponents;
+
+            for (size_t component = 0; component < m_numComponents; ++component)
+            {
+                // Rows past the end of the motion repeat its last sample.
+                const AZStd::vector<float>& samples = componentSamples[component];
+                float minValue = AZStd::numeric_limits<float>::max();
+                float maxValue = -AZStd::numeric_limits<float>::max();
+                for (size_t row = 0; row <= BlockSize; ++row)
+                {
+                    const float value = samples[AZStd::min(firstSample + row, m_numSamples - 1)];
+                    minValue = AZStd::min(minValue, value);
+                    maxValue = AZStd::max(maxValue, value);
+                }
+
+                const float step = (maxValue - minValue) / MaxQuantizedValue;
+                blockRanges[component * 2 + 0] = minValue;
+                blockRanges[component * 2 + 1] = step;
+
+                for (size_t row = 0; row <= BlockSize; ++row)
+                {
+                    const float value = samples[AZStd::min(firstSample + row, m_numSamples - 1)];
+                    const float quantized = (step > 0.0f) ? AZ::GetClamp((value - minValue) / step + 0.5f, 0.0f, MaxQuantizedValue) : 0.0f;
+                    blockSamples[row * m_numComponents + component] = static_cast<AZ::u16>(quantized);
+                }
+            }
+        }
+    }
+
+    void QuantizedMotionData::RemoveComponents(AZ::u32 firstComponent, AZ::u32 numComponents)
+    {
+        const size_t endComponent = firstComponent + numComponents;
+        AZ_Assert(endComponent <= m_numComponents, "Removing components %zu to %zu, while there are only %zu.", static_cast<size_t>(firstComponent), endComponent, m_numComponents);
+        const size_t newNumComponents = m_numComponents - numComponents;
+
+        // Repack the ranges and the rows without the removed components, keeping the order of the others.
+        AZStd::vector<float> blockRanges;
+        blockRanges.reserve(m_numBlocks * newNumComponents * 2);
+        for (size_t block = 0; block < m_numBlocks; ++block)
+        {
+            const float* ranges = m_blockRanges.data() + block * m_numComponents * 2;
+            blockRanges.insert(blockRanges.end(), ranges, ranges + firstComponent * 2);
+            blockRanges.insert(blockRanges.end(), ranges + endComponent * 2, ranges + m_numComponents * 2);
+        }
+
+        AZStd::vector<AZ::u16> blockSamples;
+        const size_t numRows = m_numBlocks * (BlockSize + 1);
+        blockSamples.reserve(numRows * newNumComponents);
+        for (size_t row = 0; row < numRows; ++row)
+        {
+            const AZ::u16* samples = m_blockSamples.data() + row * m_numComponents;
+            blockSamples.insert(blockSamples.end(), samples, samples + firstComponent);
+            blockSamples.insert(blockSamples.end(), samples + endComponent, samples + m_numComponents);
+        }
+
+        m_blockRanges = AZStd::move(blockRanges);
+        m_blockSamples = AZStd::move(blockSamples);
+        m_numComponents = newNumComponents;
+
+        // Shift the channels that came after the removed components.
+        const auto shiftChannel = [firstComponent, numComponents](AZ::u32& channel)
+        {
+            if (channel != InvalidIndex32 && channel > firstComponent)
+            {
+                channel -= numComponents;
+            }
+        };
+        for (JointChannels& channels : m_jointChannels)
+        {
+            shiftChannel(channels.m_position);
+            shiftChannel(channels.m_rotation);
+            shiftChannel(channels.m_scale);
+        }
+        for (AZ::u32& channel : m_morphChannels)
+        {
+            shiftChannel(channel);
+        }
+        for (AZ::u32& channel : m_floatChannels)
+        {
+            shiftChannel(channel);
+        }
+    }
+
+    void QuantizedMotionData::RemoveChannel(AZ::u32& inOutFirstComponent, AZ::u32 numComponents)
+    {
+        if (inOutFirstComponent == InvalidIndex32)
+        {
+            return;
+        }
+
+        const AZ::u32 firstComponent = inOutFirstComponent;
+        inOutFirstComponent = InvalidIndex32;
+        RemoveComponents(firstComponent, numComponents);
+    }
+
+    QuantizedMotionData::SampleLocation QuantizedMotionData::CalculateSampleLocation(float sampleTime) const
+    {
+        SampleLocation location;
+        if (m_numSamples == 0 || m_numComponents == 0)
+        {
+            return location;
+        }
+
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, location.m_t);
+        indexA = AZStd::min(indexA, m_numSamples - 1);
+        indexB = AZStd::min(indexB, m_numSamples - 1);
+
+        // The block holds both samples, as each block also stores the first sample of the next block.
+        const size_t block = AZStd::min(indexA / BlockSize, m_numBlocks - 1);
+        const AZ::u16* blockSamples = m_blockSamples.data() + block * (BlockSize + 1) * m_numComponents;
+        location.m_rowA = blockSamples + (indexA - block * BlockSize) * m_numComponents;
+        location.m_rowB = blockSamples + (indexB - block * BlockSize) * m_numComponents;
+        location.m_ranges = m_blockRanges.data() + block * m_numComponents * 2;
+        return location;
+    }
+
+    float QuantizedMotionData::DecodeComponent(const SampleLocation& location, AZ::u32 component)
+    {
+        // Interpolating the quantized values is the same as interpolating the decoded ones, as decoding is linear.
+        const float quantized = AZ::Lerp(static_cast<float>(location.m_rowA[component]), static_cast<float>(location.m_rowB[component]), location.m_t);
+        return location.m_ranges[component * 2] + quantized * location.m_ranges[component * 2 + 1];
+    }
+
+    AZ::Vector3 QuantizedMotionData::DecodeVector3(const SampleLocation& location, AZ::u32 firstComponent)
+    {
+        return AZ::Vector3(
+            DecodeComponent(location, firstComponent),
+            DecodeComponent(location, firstComponent + 1),
+            DecodeComponent(location, firstComponent + 2));
+    }
+
+    AZ::Quaternion QuantizedMotionData::DecodeQuaternion(const SampleLocation& location, AZ::u32 firstComponent)
+    {
+        // The encoded rotations are in the same hemisphere, so this matches a normalized lerp.
+        return AZ::Quaternion(
+            DecodeComponent(location, firstComponent),
+            DecodeComponent(location, firstComponent + 1),
+            DecodeComponent(location, firstComponent + 2),
+            DecodeComponent(location, firstComponent + 3)).GetNormalized();
+    }
+
+    Transform QuantizedMotionData::DecodeJointTransform(const SampleLocation& location, size_t jointDataIndex) const
+    {
+        const JointChannels& channels = m_jointChannels[jointDataIndex];
+        const Transform& staticTransform = m_staticJointData[jointDataIndex].m_staticTransform;
+
+        Transform result;
+        result.m_position = (channels.m_position != InvalidIndex32) ? DecodeVector3(location, channels.m_position) : staticTransform.m_position;
+        result.m_rotation = (channels.m_rotation != InvalidIndex32) ? DecodeQuaternion(location, channels.m_rotation) : staticTransform.m_rotation;
+#ifndef EMFX_SCALE_DISABLED
+        result.m_scale = (channels.m_scale != InvalidIndex32) ? DecodeVector3(location, channels.m_scale) : staticTransform.m_scale;
+#endif
+        return result;
+    }
+
+    Transform QuantizedMotionData::SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const
+    {
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        const size_t transformDataIndex = motionLinkData->GetJointDataLinks()[jointSkeletonIndex];
+        if (m_additive && transformDataIndex == InvalidIndex)
+        {
+            return Transform::CreateIdentity();
+        }
+
+        const bool inPlace = (settings.m_inPlace && jointSkeletonIndex == actor->GetMotionExtractionNodeIndex());
+
+        // Sample the interpolated data.
+        Transform result;
+        if (transformDataIndex != InvalidIndex && !inPlace)
+        {
+            result = DecodeJointTransform(CalculateSampleLocation(settings.m_sampleTime), transformDataIndex);
+        }
+        else
+        {
+            if (settings.m_inputPose && !inPlace)
+            {
+                result = settings.m_inputPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+            else
+            {
+                result = settings.m_actorInstance->GetTransformData()->GetBindPose()->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+        }
+
+        // Apply retargeting.
+        if (settings.m_retarget)
+        {
+            BasicRetarget(settings.m_actorInstance, motionLinkData, jointSkeletonIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            const Pose* bindPose = settings.m_actorInstance->GetTransformData()->GetBindPose();
+            const Actor::NodeMirrorInfo& mirrorInfo = actor->GetNodeMirrorInfo(jointSkeletonIndex);
+            Transform mirrored = bindPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            AZ::Vector3 mirrorAxis = AZ::Vector3::CreateZero();
+            mirrorAxis.SetElement(mirrorInfo.m_axis, 1.0f);
+            const AZ::u16 motionSource = actor->GetNodeMirrorInfo(jointSkeletonIndex).m_sourceNode;
+            mirrored.ApplyDeltaMirrored(bindPose->GetLocalSpaceTransform(motionSource), result, mirrorAxis, mirrorInfo.m_flags);
+            result = mirrored;
+        }
+
+        return result;
+    }
+
+    void QuantizedMotionData::SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const
+    {
+        AZ_Assert(settings.m_actorInstance, "Expecting a valid actor instance.");
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        // All joints read the same two rows of the same block.
+        const SampleLocation location = CalculateSampleLocation(settings.m_sampleTime);
+
+        const AZStd::vector<size_t>& jointLinks = motionLinkData->GetJointDataLinks();
+        const ActorInstance* actorInstance = settings.m_actorInstance;
+        const Pose* bindPose = actorInstance->GetTransformData()->GetBindPose();
+        const size_t numNodes = actorInstance->GetNumEnabledNodes();
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            const size_t skeletonJointIndex = actorInstance->GetEnabledNode(i);
+            const bool inPlace = (settings.m_inPlace && skeletonJointIndex == actor->GetMotionExtractionNodeIndex());
+
+            // Sample the interpolated data.
+            Transform result;
+            const size_t jointDataIndex = jointLinks[skeletonJointIndex];
+            if (jointDataIndex != InvalidIndex && !inPlace)
+            {
+                result = DecodeJointTransform(location, jointDataIndex);
+            }
+            else
+            {
+                if (m_additive && jointDataIndex == InvalidIndex)
+                {
+                    result = Transform::CreateIdentity();
+                }
+                else
+                {
+                    if (settings.m_inputPose && !inPlace)
+                    {
+                        result = settings.m_inputPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                    else
+                    {
+                        result = bindPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                }
+            }
+
+            // Apply retargeting.
+            if (settings.m_retarget)
+            {
+                BasicRetarget(settings.m_actorInstance, motionLinkData, skeletonJointIndex, result);
+            }
+
+            outputPose->SetLocalSpaceTransformDirect(skeletonJointIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            outputPose->Mirror(motionLinkData);
+        }
+
+        // Output morph target weights.
+        const MorphSetupInstance* morphSetup = actorInstance->GetMorphSetupInstance();
+        const size_t numMorphTargets = morphSetup->GetNumMorphTargets();
+        for (size_t i = 0; i < numMorphTargets; ++i)
+        {
+            const AZ::u32 morphTargetId = morphSetup->GetMorphTarget(i)->GetID();
+            const AZ::Outcome<size_t> morphIndex = FindMorphIndexByNameId(morphTargetId);
+            if (morphIndex.IsSuccess())
+            {
+                const size_t realIndex = morphIndex.GetValue();
+                const AZ::u32 channel = m_morphChannels[realIndex];
+                if (channel != InvalidIndex32)
+                {
+                    outputPose->SetMorphWeight(i, DecodeComponent(location, channel));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, m_staticMorphData[realIndex].m_staticValue);
+                }
+            }
+            else
+            {
+                if (settings.m_inputPose)
+                {
+                    outputPose->SetMorphWeight(i, settings.m_inputPose->GetMorphWeight(i));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, bindPose->GetMorphWeight(i));
+                }
+            }
+        }
+
+        // Since we used the SetLocalTransformDirect, make sure we manually invalidate all model space transforms.
+        outputPose->InvalidateAllModelSpaceTransforms();
+    }
+
+    float QuantizedMotionData::SampleMorph(float sampleTime, size_t morphDataIndex) const
+    {
+        const AZ::u32 channel = m_morphChannels[morphDataIndex];
+        return (channel != InvalidIndex32) ? DecodeComponent(CalculateSampleLocation(sampleTime), channel) : m_staticMorphData[morphDataIndex].m_staticValue;
+    }
+
+    float QuantizedMotionData::SampleFloat(float sampleTime, size_t floatDataIndex) const
+    {
+        const AZ::u32 channel = m_floatChannels[floatDataIndex];
+        return (channel != InvalidIndex32) ? DecodeComponent(CalculateSampleLocation(sampleTime), channel) : m_staticFloatData[floatDataIndex].m_staticValue;
+    }
+
+    Transform QuantizedMotionData::SampleJointTransform(float sampleTime, size_t jointDataIndex) const
+    {
+        return DecodeJointTransform(CalculateSampleLocation(sampleTime), jointDataIndex);
+    }
+
+    AZ::Vector3 QuantizedMotionData::SampleJointPosition(float sampleTime, size_t jointDataIndex) const
+    {
+        const AZ::u32 channel = m_jointChannels[jointDataIndex].m_position;
+        return (channel != InvalidIndex32) ? DecodeVector3(CalculateSampleLocation(sampleTime), channel) : m_staticJointData[jointDataIndex].m_staticTransform.m_position;
+    }
+
+    AZ::Quaternion QuantizedMotionData::SampleJointRotation(float sampleTime, size_t jointDataIndex) const
+    {
+        const AZ::u32 channel = m_jointChannels[jointDataIndex].m_rotation;
+        return (channel != InvalidIndex32) ? DecodeQuaternion(CalculateSampleLocation(sampleTime), channel) : m_staticJointData[jointDataIndex].m_staticTransform.m_rotation;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    AZ::Vector3 QuantizedMotionData::SampleJointScale(float sampleTime, size_t jointDataIndex) const
+    {
+        const AZ::u32 channel = m_jointChannels[jointDataIndex].m_scale;
+        return (channel != InvalidIndex32) ? DecodeVector3(CalculateSampleLocation(sampleTime), channel) : m_staticJointData[jointDataIndex].m_staticTransform.m_scale;
+    }
+#endif
+
+    void QuantizedMotionData::ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats)
+    {
+        m_jointChannels.resize(numJoints);
+        m_morphChannels.resize(numMorphs, InvalidIndex32);
+        m_floatChannels.resize(numFloats, InvalidIndex32);
+    }
+
+    void QuantizedMotionData::AddJointSampleData([[maybe_unused]] size_t jointDataIndex)
+    {
+        AZ_Assert(jointDataIndex == m_jointChannels.size(), "Expected the size of the jointChannels vector to be a different size. Is it in sync with the m_staticJointData vector?");
+        m_jointChannels.emplace_back();
+    }
+
+    void QuantizedMotionData::AddMorphSampleData([[maybe_unused]] size_t morphDataIndex)
+    {
+        AZ_Assert(morphDataIndex == m_morphChannels.size(), "Expected the size of the morphChannels vector to be a different size. Is it in sync with the m_staticMorphData vector?");
+        m_morphChannels.emplace_back(InvalidIndex32);
+    }
+
+    void QuantizedMotionData::AddFloatSampleData([[maybe_unused]] size_t floatDataIndex)
+    {
+        AZ_Assert(floatDataIndex == m_floatChannels.size(), "Expected the size of the floatChannels vector to be a different size. Is it in sync with the m_staticFloatData vector?");
+        m_floatChannels.emplace_back(InvalidIndex32);
+    }
+
+    void QuantizedMotionData::RemoveJointSampleData(size_t jointDataIndex)
+    {
+        ClearJointTransformSamples(jointDataIndex);
+        m_jointChannels.erase(m_jointChannels.begin() + jointDataIndex);
+    }
+
+    void QuantizedMotionData::RemoveMorphSampleData(size_t morphDataIndex)
+    {
+        ClearMorphSamples(morphDataIndex);
+        m_morphChannels.erase(m_morphChannels.begin() + morphDataIndex);
+    }
+
+    void QuantizedMotionData::RemoveFloatSampleData(size_t floatDataIndex)
+    {
+        ClearFloatSamples(floatDataIndex);
+        m_floatChannels.erase(m_floatChannels.begin() + floatDataIndex);
+    }
+
+    void QuantizedMotionData::ClearAllData()
+    {
+        m_jointChannels.clear();
+        m_jointChannels.shrink_to_fit();
+        m_morphChannels.clear();
+        m_morphChannels.shrink_to_fit();
+        m_floatChannels.clear();
+        m_floatChannels.shrink_to_fit();
+        m_blockRanges.clear();
+        m_blockRanges.shrink_to_fit();
+        m_blockSamples.clear();
+        m_blockSamples.shrink_to_fit();
+
+        m_numComponents = 0;
+        m_numBlocks = 0;
+        m_numSamples = 0;
+    }
+
+    void QuantizedMotionData::ClearAllJointTransformSamples()
+    {
+        for (size_t i = 0; i < m_jointChannels.size(); ++i)
+        {
+            ClearJointTransformSamples(i);
+        }
+    }
+
+    void QuantizedMotionData::ClearAllMorphSamples()
+    {
+        for (AZ::u32& channel : m_morphChannels)
+        {
+            RemoveChannel(channel, 1);
+        }
+    }
+
+    void QuantizedMotionData::ClearAllFloatSamples()
+    {
+        for (AZ::u32& channel : m_floatChannels)
+        {
+            RemoveChannel(channel, 1);
+        }
+    }
+
+    void QuantizedMotionData::ClearJointPositionSamples(size_t jointDataIndex)
+    {
+        RemoveChannel(m_jointChannels[jointDataIndex].m_position, 3);
+    }
+
+    void QuantizedMotionData::ClearJointRotationSamples(size_t jointDataIndex)
+    {
+        RemoveChannel(m_jointChannels[jointDataIndex].m_rotation, 4);
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    void QuantizedMotionData::ClearJointScaleSamples(size_t jointDataIndex)
+    {
+        RemoveChannel(m_jointChannels[jointDataIndex].m_scale, 3);
+    }
+#endif
+
+    void QuantizedMotionData::ClearJointTransformSamples(size_t jointDataIndex)
+    {
+        // Scale channels are also removed when scale is disabled, as loaded motions can still contain them.
+        JointChannels& channels = m_jointChannels[jointDataIndex];
+        RemoveChannel(channels.m_position, 3);
+        RemoveChannel(channels.m_rotation, 4);
+        RemoveChannel(channels.m_scale, 3);
+    }
+
+    void QuantizedMotionData::ClearMorphSamples(size_t morphDataIndex)
+    {
+        RemoveChannel(m_morphChannels[morphDataIndex], 1);
+    }
+
+    void QuantizedMotionData::ClearFloatSamples(size_t floatDataIndex)
+    {
+        RemoveChannel(m_floatChannels[floatDataIndex], 1);
+    }
+
+    bool QuantizedMotionData::IsJointPositionAnimated(size_t jointDataIndex) const
+    {
+        return m_jointChannels[jointDataIndex].m_position != InvalidIndex32;
+    }
+
+    bool QuantizedMotionData::IsJointRotationAnimated(size_t jointDataIndex) const
+    {
+        return m_jointChannels[jointDataIndex].m_rotation != InvalidIndex32;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    bool QuantizedMotionData::IsJointScaleAnimated(size_t jointDataIndex) const
+    {
+        return m_jointChannels[jointDataIndex].m_scale != InvalidIndex32;
+    }
+#endif
+
+    bool QuantizedMotionData::IsJointAnimated(size_t jointDataIndex) const
+    {
+        const JointChannels& channels = m_jointChannels[jointDataIndex];
+
+#ifndef EMFX_SCALE_DISABLED
+        return (channels.m_position != InvalidIndex32 || channels.m_rotation != InvalidIndex32 || channels.m_scale != InvalidIndex32);
+#else
+        return (channels.m_position != InvalidIndex32 || channels.m_rotation != InvalidIndex32);
+#endif
+    }
+
+    bool QuantizedMotionData::IsMorphAnimated(size_t morphDataIndex) const
+    {
+        return m_morphChannels[morphDataIndex] != InvalidIndex32;
+    }
+
+    bool QuantizedMotionData::IsFloatAnimated(size_t floatDataIndex) const
+    {
+        return m_floatChannels[floatDataIndex] != InvalidIndex32;
+    }
+
+    void QuantizedMotionData::ScaleData(float scaleFactor)
+    {
+        // Decoding is linear, so scaling the range of a position component scales all of its samples.
+        for (const JointChannels& channels : m_jointChannels)
+        {
+            if (channels.m_position == InvalidIndex32)
+            {
+                continue;
+            }
+
+            for (size_t block = 0; block < m_numBlocks; ++block)
+            {
+                float* ranges = m_blockRanges.data() + (block * m_numComponents + channels.m_position) * 2;
+                for (size_t i = 0; i < 3 * 2; ++i)
+                {
+                    ranges[i] *= scaleFactor;
+                }
+            }
+        }
+    }
+
+    size_t QuantizedMotionData::GetNumSamples() const
+    {
+        return m_numSamples;
+    }
+
+    size_t QuantizedMotionData::GetNumBlocks() const
+    {
+        return m_numBlocks;
+    }
+
+    size_t QuantizedMotionData::GetNumComponents() const
+    {
+        return m_numComponents;
+    }
+
+    float QuantizedMotionData::GetSampleSpacing() const
+    {
+        return m_sampleSpacing;
+    }
+
+    void QuantizedMotionData::UpdateSampleSpacing()
+    {
+        if (m_sampleRate > 0.0f)
+        {
+            m_sampleSpacing = 1.0f / m_sampleRate;
+        }
+        else
+        {
+            m_sampleSpacing = 0.0f;
+        }
+    }
+
+    void QuantizedMotionData::SetSampleRate(float sampleRate)
+    {
+        MotionData::SetSampleRate(sampleRate);
+        UpdateSampleSpacing();
+    }
+
+    void QuantizedMotionData::UpdateDuration()
+    {
+        m_duration = (m_numSamples > 0) ? (m_numSamples - 1) * m_sampleSpacing : 0.0f;
+    }
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SERIALIZATION
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    namespace
+    {
+        struct File_QuantizedMotionData_Info
+        {
+            AZ::u32 m_numJoints = 0;
+            AZ::u32 m_numMorphs = 0;
+            AZ::u32 m_numFloats = 0;
+            AZ::u32 m_numSamples = 0;
+            AZ::u32 m_numComponents = 0;
+            AZ::u32 m_numBlocks = 0;
+            float m_sampleRate = 30.0f;
+
+            // Followed by:
+            // File_QuantizedMotionData_Joint[m_numJoints]
+            // File_QuantizedMotionData_Float[m_numMorphs]
+            // File_QuantizedMotionData_Float[m_numFloats]
+            // float[m_numBlocks * m_numComponents * 2]                                 : The minimum and step size of each component per block.
+            // AZ::u16[m_numBlocks * (QuantizedMotionData::BlockSize + 1) * m_numComponents] : The quantized sample rows of each block.
+        };
+
+        enum File_QuantizedMotionData_Flags : AZ::u8
+        {
+            IsAnimated = 1 << 0,
+            IsPositionAnimated = 1 << 1,
+            IsRotationAnimated = 1 << 2,
+            IsScaleAnimated = 1 << 3
+        };
+
+        // The components of the animated channels are assigned in file order: position (3), rotation (4) and scale (3) of each joint,
+        // followed by the morphs (1) and floats (1).
+        struct File_QuantizedMotionData_Joint
+        {
+            FileFormat::File16BitQuaternion m_staticRot { 0, 0, 0, (1 << 15) - 1 };  // First frames rotation.
+            FileFormat::File16BitQuaternion m_bindPoseRot { 0, 0, 0, (1 << 15) - 1 };// Bind pose rotation.
+            FileFormat::FileVector3         m_staticPos { 0.0f, 0.0f, 0.0f };        // First frame position.
+            FileFormat::FileVector3         m_staticScale { 1.0f, 1.0f, 1.0f };      // First frame scale.
+            FileFormat::FileVector3         m_bindPosePos { 0.0f, 0.0f, 0.0f };      // Bind pose position.
+            FileFormat::FileVector3         m_bindPoseScale { 1.0f, 1.0f, 1.0f };    // Bind pose scale.
+            AZ::u8                          m_flags = 0; // The flags (see File_QuantizedMotionData_Flags).
+
+            // Followed by:
+            // string : The name of the joint.
+        };
+
+        struct File_QuantizedMotionData_Float
+        {
+            float m_staticValue = 0.0f; // The static (first frame) value.
+            AZ::u8 m_flags = 0;         // The flags (see File_QuantizedMotionData_Flags).
+
+            // Followed by:
+            // String: The name of the channel.
+        };
+
+        bool SaveQuantizedJoint(MCore::Stream* stream, const QuantizedMotionData* motionData, size_t jointDataIndex, AZ::u8 flags, const MotionData::SaveSettings& saveSettings)
+        {
+            AZ::PackedVector3f posePosition = AZ::PackedVector3f(motionData->GetJointStaticPosition(jointDataIndex));
+            AZ::PackedVector3f bindPosePosition = AZ::PackedVector3f(motionData->GetJointBindPosePosition(jointDataIndex));
+            MCore::Compressed16BitQuaternion poseRotation(motionData->GetJointStaticRotation(jointDataIndex));
+            MCore::Compressed16BitQuaternion bindPoseRotation(motionData->GetJointBindPoseRotation(jointDataIndex));
+            #ifndef EMFX_SCALE_DISABLED
+                AZ::PackedVector3f poseScale = AZ::PackedVector3f(motionData->GetJointStaticScale(jointDataIndex));
+                AZ::PackedVector3f bindPoseScale = AZ::PackedVector3f(motionData->GetJointBindPoseScale(jointDataIndex));
+            #else
+                AZ::PackedVector3f bindPoseScale(1.0f, 1.0f, 1.0f);
+                AZ::PackedVector3f poseScale(1.0f, 1.0f, 1.0f);
+            #endif
+
+            File_QuantizedMotionData_Joint jointChunk;
+            ExporterLib::CopyVector(jointChunk.m_staticPos, posePosition);
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_staticRot, poseRotation);
+            ExporterLib::CopyVector(jointChunk.m_staticScale, poseScale);
+            ExporterLib::CopyVector(jointChunk.m_bindPosePos, bindPosePosition);
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_bindPoseRot, bindPoseRotation);
+            ExporterLib::CopyVector(jointChunk.m_bindPoseScale, bindPoseScale);
+            jointChunk.m_flags = flags;
+
+            if (saveSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("- Motion Joint: %s", motionData->GetJointName(jointDataIndex).c_str());
+                MCore::LogDetailedInfo("   + Position Animated:     %s", (flags & File_QuantizedMotionData_Flags::IsPositionAnimated) ? "Yes" : "No");
+                MCore::LogDetailedInfo("   + Rotation Animated:     %s", (flags & File_QuantizedMotionData_Flags::IsRotationAnimated) ? "Yes" : "No");
+                MCore::LogDetailedInfo("   + Scale Animated:        %s", (flags & File_QuantizedMotionData_Flags::IsScaleAnimated) ? "Yes" : "No");
+            }
+
+            // Convert endian.
+            const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticPos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_staticRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticScale, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPosePos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_bindPoseRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPoseScale, targetEndianType);
+
+            if (stream->Write(&jointChunk, sizeof(File_QuantizedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+
+            ExporterLib::SaveString(motionData->GetJointName(jointDataIndex), stream, targetEndianType);
+            return true;
+        }
+
+        bool SaveQuantizedFloat(MCore::Stream* stream, const AZStd::string& channelName, float staticValue, bool isAnimated, const MotionData::SaveSettings& saveSettings)
+        {
+            if (channelName.empty())
+            {
+                MCore::LogError("Cannot save morph or float channel with empty name.");
+                return false;
+            }
+
+            File_QuantizedMotionData_Float floatChunk;
+            floatChunk.m_staticValue = staticValue;
+            floatChunk.m_flags = isAnimated ? File_QuantizedMotionData_Flags::IsAnimated : 0;
+
+            if (saveSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("    - Channel: '%s'", channelName.c_str());
+                MCore::LogDetailedInfo("       + Static Value = %f", floatChunk.m_staticValue);
+                MCore::LogDetailedInfo("       + IsAnimated   = %s", isAnimated ? "Yes" : "No");
+            }
+
+            const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+            ExporterLib::ConvertFloat(&floatChunk.m_staticValue, targetEndianType);
+            if (stream->Write(&floatChunk, sizeof(File_QuantizedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+
+            ExporterLib::SaveString(channelName, stream, targetEndianType);
+            return true;
+        }
+    } // namespace
+
+    size_t QuantizedMotionData::CalcStreamSaveSizeInBytes([[maybe_unused]] const SaveSettings& saveSettings) const
+    {
+        size_t numBytes = sizeof(File_QuantizedMotionData_Info);
+
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            numBytes += sizeof(File_QuantizedMotionData_Joint);
+            numBytes += ExporterLib::GetStringChunkSize(GetJointName(i));
+        }
+
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            numBytes += sizeof(File_QuantizedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetMorphName(i));
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            numBytes += sizeof(File_QuantizedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetFloatName(i));
+        }
+
+        numBytes += m_blockRanges.size() * sizeof(float);
+        numBytes += m_blockSamples.size() * sizeof(AZ::u16);
+        return numBytes;
+    }
+
+    AZ::u32 QuantizedMotionData::GetStreamSaveVersion() const
+    {
+        return 1;
+    }
+
+    bool QuantizedMotionData::Save(MCore::Stream* stream, const SaveSettings& saveSettings) const
+    {
+        // Write the info chunk.
+        File_QuantizedMotionData_Info info;
+        info.m_numJoints = static_cast<AZ::u32>(GetNumJoints());
+        info.m_numMorphs = static_cast<AZ::u32>(GetNumMorphs());
+        info.m_numFloats = static_cast<AZ::u32>(GetNumFloats());
+        info.m_numSamples = static_cast<AZ::u32>(m_numSamples);
+        info.m_numComponents = static_cast<AZ::u32>(m_numComponents);
+        info.m_numBlocks = static_cast<AZ::u32>(m_numBlocks);
+        info.m_sampleRate = GetSampleRate();
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+        ExporterLib::ConvertUnsignedInt(&info.m_numJoints, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numMorphs, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numFloats, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numSamples, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numComponents, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numBlocks, targetEndianType);
+        ExporterLib::ConvertFloat(&info.m_sampleRate, targetEndianType);
+        if (stream->Write(&info, sizeof(File_QuantizedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+
+        // Write the joints. The components are always stored in the order of the channels, which is the order the flags get read in.
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            const JointChannels& channels = m_jointChannels[i];
+            AZ::u8 flags = 0;
+            if (channels.m_position != InvalidIndex32) { flags |= File_QuantizedMotionData_Flags::IsPositionAnimated; }
+            if (channels.m_rotation != InvalidIndex32) { flags |= File_QuantizedMotionData_Flags::IsRotationAnimated; }
+            if (channels.m_scale != InvalidIndex32) { flags |= File_QuantizedMotionData_Flags::IsScaleAnimated; }
+            if (flags != 0) { flags |= File_QuantizedMotionData_Flags::IsAnimated; }
+
+            if (!SaveQuantizedJoint(stream, this, i, flags, saveSettings))
+            {
+                return false;
+            }
+        }
+
+        // Write the morph and float channels.
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            if (!SaveQuantizedFloat(stream, GetMorphName(i), GetMorphStaticValue(i), IsMorphAnimated(i), saveSettings))
+            {
+                return false;
+            }
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            if (!SaveQuantizedFloat(stream, GetFloatName(i), GetFloatStaticValue(i), IsFloatAnimated(i), saveSettings))
+            {
+                return false;
+            }
+        }
+
+        // Write the blocks in one go each.
+        if (!m_blockRanges.empty())
+        {
+            AZStd::vector<float> blockRanges = m_blockRanges;
+            MCore::Endian::ConvertFloatTo(blockRanges.data(), targetEndianType, static_cast<AZ::u32>(blockRanges.size()));
+            if (stream->Write(blockRanges.data(), blockRanges.size() * sizeof(float)) == 0)
+            {
+                return false;
+            }
+        }
+
+        if (!m_blockSamples.empty())
+        {
+            AZStd::vector<AZ::u16> blockSamples = m_blockSamples;
+            MCore::Endian::ConvertUnsignedInt16To(blockSamples.data(), targetEndianType, static_cast<AZ::u32>(blockSamples.size()));
+            if (stream->Write(blockSamples.data(), blockSamples.size() * sizeof(AZ::u16)) == 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool QuantizedMotionData::ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        // Read the info header.
+        File_QuantizedMotionData_Info info;
+        if (stream->Read(&info, sizeof(File_QuantizedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+        const MCore::Endian::EEndianType sourceEndianType = readSettings.m_sourceEndianType;
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numJoints, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numMorphs, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numFloats, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numSamples, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numComponents, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numBlocks, sourceEndianType);
+        MCore::Endian::ConvertFloat(&info.m_sampleRate, sourceEndianType);
+
+        if (readSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- QuantizedMotionData:");
+            MCore::LogDetailedInfo("  + NumJoints     = %d", info.m_numJoints);
+            MCore::LogDetailedInfo("  + NumMorphs     = %d", info.m_numMorphs);
+            MCore::LogDetailedInfo("  + NumFloats     = %d", info.m_numFloats);
+            MCore::LogDetailedInfo("  + NumComponents = %d", info.m_numComponents);
+            MCore::LogDetailedInfo("  + NumBlocks     = %d", info.m_numBlocks);
+            MCore::LogDetailedInfo("  + SampleRate    = %f", info.m_sampleRate);
+        }
+
+        // Initialize the motion data.
+        Clear();
+        Resize(info.m_numJoints, info.m_numMorphs, info.m_numFloats);
+        m_numSamples = info.m_numSamples;
+        SetSampleRate(info.m_sampleRate);
+        UpdateDuration();
+
+        // Read all joints, assigning the components to the animated channels in file order.
+        AZ::u32 numComponents = 0;
+        AZStd::string name;
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            File_QuantizedMotionData_Joint jointInfo;
+            if (stream->Read(&jointInfo, sizeof(File_QuantizedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+
+            // Convert endian.
+            AZ::Vector3 staticPos(jointInfo.m_staticPos.m_x, jointInfo.m_staticPos.m_y, jointInfo.m_staticPos.m_z);
+            AZ::Vector3 staticScale(jointInfo.m_staticScale.m_x, jointInfo.m_staticScale.m_y, jointInfo.m_staticScale.m_z);
+            MCore::Compressed16BitQuaternion staticRot(jointInfo.m_staticRot.m_x, jointInfo.m_staticRot.m_y, jointInfo.m_staticRot.m_z, jointInfo.m_staticRot.m_w);
+            AZ::Vector3 bindPosePos(jointInfo.m_bindPosePos.m_x, jointInfo.m_bindPosePos.m_y, jointInfo.m_bindPosePos.m_z);
+            AZ::Vector3 bindPoseScale(jointInfo.m_bindPoseScale.m_x, jointInfo.m_bindPoseScale.m_y, jointInfo.m_bindPoseScale.m_z);
+            MCore::Compressed16BitQuaternion bindPoseRot(jointInfo.m_bindPoseRot.m_x, jointInfo.m_bindPoseRot.m_y, jointInfo.m_bindPoseRot.m_z, jointInfo.m_bindPoseRot.m_w);
+            MCore::Endian::ConvertVector3(&staticPos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&staticRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&staticScale, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPosePos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&bindPoseRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPoseScale, sourceEndianType);
+
+            SetJointStaticPosition(i, staticPos);
+            SetJointStaticRotation(i, staticRot.ToQuaternion().GetNormalized());
+            SetJointBindPosePosition(i, bindPosePos);
+            SetJointBindPoseRotation(i, bindPoseRot.ToQuaternion().GetNormalized());
+            EMFX_SCALECODE
+            (
+                SetJointStaticScale(i, staticScale);
+                SetJointBindPoseScale(i, bindPoseScale);
+            )
+
+            name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+            SetJointName(i, name);
+
+            JointChannels& channels = m_jointChannels[i];
+            if (jointInfo.m_flags & File_QuantizedMotionData_Flags::IsPositionAnimated) { channels.m_position = numComponents; numComponents += 3; }
+            if (jointInfo.m_flags & File_QuantizedMotionData_Flags::IsRotationAnimated) { channels.m_rotation = numComponents; numComponents += 4; }
+            if (jointInfo.m_flags & File_QuantizedMotionData_Flags::IsScaleAnimated) { channels.m_scale = numComponents; numComponents += 3; }
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + [%zu] Joint = '%s'", i, name.c_str());
+                MCore::LogDetailedInfo("    - IsPosAnimated   = %s", (jointInfo.m_flags & File_QuantizedMotionData_Flags::IsPositionAnimated) ? "Yes" : "No");
+                MCore::LogDetailedInfo("    - IsRotAnimated   = %s", (jointInfo.m_flags & File_QuantizedMotionData_Flags::IsRotationAnimated) ? "Yes" : "No");
+                MCore::LogDetailedInfo("    - IsScaleAnimated = %s", (jointInfo.m_flags & File_QuantizedMotionData_Flags::IsScaleAnimated) ? "Yes" : "No");
+            }
+        }
+
+        // Read the morphs and floats.
+        const auto readFloatChannel = [this, stream, sourceEndianType, &readSettings, &numComponents, &name](float& outStaticValue, AZ::u32& outChannel)
+        {
+            File_QuantizedMotionData_Float floatInfo;
+            if (stream->Read(&floatInfo, sizeof(File_QuantizedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(&floatInfo.m_staticValue, sourceEndianType);
+            name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + Channel: '%s'", name.c_str());
+                MCore::LogDetailedInfo("       + IsAnimated   = %s", (floatInfo.m_flags & File_QuantizedMotionData_Flags::IsAnimated) ? "Yes" : "No");
+                MCore::LogDetailedInfo("       + Static value = %f", floatInfo.m_staticValue);
+            }
+
+            outStaticValue = floatInfo.m_staticValue;
+            if (floatInfo.m_flags & File_QuantizedMotionData_Flags::IsAnimated)
+            {
+                outChannel = numComponents;
+                numComponents++;
+            }
+            return true;
+        };
+
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            float staticValue = 0.0f;
+            if (!readFloatChannel(staticValue, m_morphChannels[i]))
+            {
+                return false;
+            }
+            SetMorphName(i, name);
+            SetMorphStaticValue(i, staticValue);
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            float staticValue = 0.0f;
+            if (!readFloatChannel(staticValue, m_floatChannels[i]))
+            {
+                return false;
+            }
+            SetFloatName(i, name);
+            SetFloatStaticValue(i, staticValue);
+        }
+
+        if (numComponents != info.m_numComponents)
+        {
+            AZ_Error("EMotionFX", false, "QuantizedMotionData has %u components, while its channels need %u.", info.m_numComponents, numComponents);
+            return false;
+        }
+
+        // Read the blocks.
+        m_numComponents = numComponents;
+        m_numBlocks = info.m_numBlocks;
+        m_blockRanges.resize(m_numBlocks * m_numComponents * 2);
+        m_blockSamples.resize(m_numBlocks * (BlockSize + 1) * m_numComponents);
+        if (!m_blockRanges.empty())
+        {
+            if (stream->Read(m_blockRanges.data(), m_blockRanges.size() * sizeof(float)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(m_blockRanges.data(), sourceEndianType, static_cast<AZ::u32>(m_blockRanges.size()));
+        }
+
+        if (!m_blockSamples.empty())
+        {
+            if (stream->Read(m_blockSamples.data(), m_blockSamples.size() * sizeof(AZ::u16)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertUnsignedInt16(m_blockSamples.data(), sourceEndianType, static_cast<AZ::u32>(m_blockSamples.size()));
+        }
+
+        return true;
+    }
+
+    bool QuantizedMotionData::Read(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        switch (readSettings.m_version)
+        {
+            case 1:
+            {
+                return ReadVersion1(stream, readSettings);
+            }
+            break;
+
+            default:
+            {
+                AZ_Error("EMotionFX", false, "Unsupported QuantizedMotionData version (version=%d), cannot load motion data.", readSettings.m_version);
+            }
+        }
+
+        return false;
+    }
+} // namespace EMotionFX
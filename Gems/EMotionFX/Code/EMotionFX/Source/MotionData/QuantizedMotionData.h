@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/MotionData/MotionData.h>
+#include <EMotionFX/Source/Transform.h>
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace EMotionFX
+{
+    class Pose;
+
+    //! Motion data with evenly spaced samples, which are quantized to 16 bits and stored in blocks of time.
+    //! Every animated channel (a joint position, rotation or scale, a morph or a float) is split into float components, which
+    //! are quantized within the value range they cover inside each block. A block stores all components of all of its samples
+    //! next to each other, so sampling a full pose at a given time only reads two neighbouring rows of one block.
+    //! Each block also stores the first sample of the next block, so that interpolation never needs to cross blocks.
+    class EMFX_API QuantizedMotionData
+        : public MotionData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(QuantizedMotionData, MotionAllocator)
+        AZ_RTTI(QuantizedMotionData, "{6C1B3F2E-5D0A-4E8B-9C47-2A8F1D3B7E60}", MotionData)
+
+        //! The number of sample intervals covered by each block.
+        static constexpr size_t BlockSize = 16;
+
+        QuantizedMotionData() = default;
+        ~QuantizedMotionData() override;
+
+        void InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate=true, float newSampleRate=30.0f, bool updateDuration=false) override;
+        bool Read(MCore::Stream* stream, const ReadSettings& readSettings) override;
+        bool Save(MCore::Stream* stream, const SaveSettings& saveSettings) const override;
+        size_t CalcStreamSaveSizeInBytes(const SaveSettings& saveSettings) const override;
+        AZ::u32 GetStreamSaveVersion() const override;
+        bool GetSupportsOptimizeSettings() const override { return false; }
+        const char* GetSceneSettingsName() const override;
+
+        // Overloaded.
+        Transform SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const override;
+        void SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const override;
+        float SampleMorph(float sampleTime, size_t morphDataIndex) const override;
+        float SampleFloat(float sampleTime, size_t floatDataIndex) const override;
+        Transform SampleJointTransform(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointPosition(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Quaternion SampleJointRotation(float sampleTime, size_t jointDataIndex) const override;
+
+        void ClearAllJointTransformSamples() override;
+        void ClearAllMorphSamples() override;
+        void ClearAllFloatSamples() override;
+        void ClearJointPositionSamples(size_t jointDataIndex) override;
+        void ClearJointRotationSamples(size_t jointDataIndex) override;
+        void ClearJointTransformSamples(size_t jointDataIndex) override;
+        void ClearMorphSamples(size_t morphDataIndex) override;
+        void ClearFloatSamples(size_t floatDataIndex) override;
+
+        bool IsJointPositionAnimated(size_t jointDataIndex) const override;
+        bool IsJointRotationAnimated(size_t jointDataIndex) const override;
+        bool IsJointAnimated(size_t jointDataIndex) const override;
+        bool IsMorphAnimated(size_t morphDataIndex) const override;
+        bool IsFloatAnimated(size_t floatDataIndex) const override;
+
+#ifndef EMFX_SCALE_DISABLED
+        void ClearJointScaleSamples(size_t jointDataIndex) override;
+        bool IsJointScaleAnimated(size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointScale(float sampleTime, size_t jointDataIndex) const override;
+#endif
+
+        size_t GetNumSamples() const;
+        size_t GetNumBlocks() const;
+        size_t GetNumComponents() const;
+        float GetSampleSpacing() const;
+        void SetSampleRate(float sampleRate) override;
+        void UpdateDuration() override;
+
+    private:
+        //! The first component of the animated channels of a joint, or InvalidIndex32 when the channel isn't animated.
+        struct EMFX_API JointChannels
+        {
+            AZ::u32 m_position = InvalidIndex32;
+            AZ::u32 m_rotation = InvalidIndex32;
+            AZ::u32 m_scale = InvalidIndex32;
+        };
+
+        //! The location of an interpolated sample inside the blocks.
+        struct EMFX_API SampleLocation
+        {
+            const AZ::u16* m_rowA = nullptr;
+            const AZ::u16* m_rowB = nullptr;
+            const float* m_ranges = nullptr;
+            float m_t = 0.0f;
+        };
+
+        //! The component samples of the channels to encode, in the order of their components.
+        using ComponentSamples = AZStd::vector<AZStd::vector<float>>;
+
+        MotionData* CreateNew() const override;
+        void ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats) override;
+        void ClearAllData() override;
+        void AddJointSampleData(size_t jointDataIndex) override;
+        void AddMorphSampleData(size_t morphDataIndex) override;
+        void AddFloatSampleData(size_t floatDataIndex) override;
+        void RemoveJointSampleData(size_t jointDataIndex) override;
+        void RemoveMorphSampleData(size_t morphDataIndex) override;
+        void RemoveFloatSampleData(size_t floatDataIndex) override;
+        void ScaleData(float scaleFactor) override;
+
+        void UpdateSampleSpacing();
+        void EncodeBlocks(const ComponentSamples& componentSamples);
+        void RemoveComponents(AZ::u32 firstComponent, AZ::u32 numComponents);
+        void RemoveChannel(AZ::u32& inOutFirstComponent, AZ::u32 numComponents);
+        SampleLocation CalculateSampleLocation(float sampleTime) const;
+        Transform DecodeJointTransform(const SampleLocation& location, size_t jointDataIndex) const;
+        bool ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings);
+
+        static float DecodeComponent(const SampleLocation& location, AZ::u32 component);
+        static AZ::Vector3 DecodeVector3(const SampleLocation& location, AZ::u32 firstComponent);
+        static AZ::Quaternion DecodeQuaternion(const SampleLocation& location, AZ::u32 firstComponent);
+
+        AZStd::vector<JointChannels> m_jointChannels;
+        AZStd::vector<AZ::u32> m_morphChannels;     //!< The component of each morph, or InvalidIndex32 when it isn't animated.
+        AZStd::vector<AZ::u32> m_floatChannels;     //!< The component of each float, or InvalidIndex32 when it isn't animated.
+        AZStd::vector<float> m_blockRanges;         //!< Per block and component, the minimum value and the value of one quantization step.
+        AZStd::vector<AZ::u16> m_blockSamples;      //!< Per block, (BlockSize + 1) rows of quantized samples with all components each.
+        size_t m_numComponents = 0;
+        size_t m_numBlocks = 0;
+        size_t m_numSamples = 0;
+        float m_sampleSpacing = 1.0f / 30.0f;
+    };
+} // namespace EMotionFX
@@ -19,7 +19,11 @@
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobManagerBus.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 
 
 namespace EMotionFX
@@ -53,6 +57,7 @@ namespace EMotionFX
     {
         Lock();
         m_steps.clear();
+        m_taskGraphDirty = true;
         Unlock();
     }
 
@@ -146,6 +151,51 @@ namespace EMotionFX
         m_numVisible.SetValue(0);
         m_numSampled.SetValue(0);
 
+        AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive())
+        {
+            ExecuteTaskGraph(timePassedInSeconds);
+        }
+        else
+        {
+            ExecuteJobs(timePassedInSeconds);
+        }
+    }
+
+
+    // update a single actor instance
+    void MultiThreadScheduler::UpdateActorInstance(ActorInstance* actorInstance, float timePassedInSeconds, uint32 threadIndex)
+    {
+        actorInstance->SetThreadIndex(threadIndex);
+
+        const bool isVisible = actorInstance->GetIsVisible();
+        if (isVisible)
+        {
+            m_numVisible.Increment();
+        }
+
+        // check if we want to sample motions
+        bool sampleMotions = false;
+        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
+        if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+        {
+            sampleMotions = true;
+            actorInstance->SetMotionSamplingTimer(0.0f);
+
+            if (isVisible)
+            {
+                m_numSampled.Increment();
+            }
+        }
+
+        // update the actor instance
+        actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+    }
+
+
+    // execute the schedule step by step using jobs
+    void MultiThreadScheduler::ExecuteJobs(float timePassedInSeconds)
+    {
         for (const ScheduleStep& currentStep : m_steps)
         {
             if (currentStep.m_actorInstances.empty())
@@ -167,41 +217,108 @@ namespace EMotionFX
                 {
                     AZ_PROFILE_SCOPE(Animation, "MultiThreadScheduler::Execute::ActorInstanceUpdateJob");
 
-                    const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();                    
-                    actorInstance->SetThreadIndex(threadIndex);
+                    const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();
+                    UpdateActorInstance(actorInstance, timePassedInSeconds, threadIndex);
+                }, true, jobContext);
+
+                job->SetDependent(&jobCompletion);
+                job->Start();
+
+                m_numUpdated.Increment();
+            }
+
+            jobCompletion.StartAndWaitForCompletion();
+        } // for all steps
+    }
+
+
+    // execute the schedule as a task graph
+    void MultiThreadScheduler::ExecuteTaskGraph(float timePassedInSeconds)
+    {
+        // the task workers index the thread datas, so make sure there is one for each of them
+        const uint32 numTaskWorkers = AZ::TaskExecutor::Instance().GetWorkerCount();
+        if (numTaskWorkers > GetEMotionFX().GetNumThreads())
+        {
+            GetEMotionFX().SetNumThreads(numTaskWorkers);
+        }
 
-                    const bool isVisible = actorInstance->GetIsVisible();
-                    if (isVisible)
+        if (m_taskGraphDirty)
+        {
+            BuildTaskGraph();
+        }
+
+        if (m_taskGraph.IsEmpty())
+        {
+            return;
+        }
+
+        // the retained tasks read the time passed from here, as their lambdas can't change between submissions
+        m_taskGraphTimePassed = timePassedInSeconds;
+
+        AZ::TaskGraphEvent finishedEvent{ "EMotionFX::MultiThreadScheduler Wait" };
+        m_taskGraph.Submit(&finishedEvent);
+        finishedEvent.Wait();
+    }
+
+
+    // rebuild the task graph from the schedule
+    void MultiThreadScheduler::BuildTaskGraph()
+    {
+        static const AZ::TaskDescriptor actorInstanceUpdateTaskDescriptor{ "EMotionFX::MultiThreadScheduler::ActorInstanceUpdateTask", "Animation" };
+
+        m_taskGraph.Reset();
+
+        AZStd::vector<AZ::TaskToken> taskTokens;
+        AZStd::unordered_map<const ActorInstance*, size_t> taskTokenIndices;
+        for (const ScheduleStep& step : m_steps)
+        {
+            for (ActorInstance* actorInstance : step.m_actorInstances)
+            {
+                taskTokens.emplace_back(m_taskGraph.AddTask(actorInstanceUpdateTaskDescriptor, [this, actorInstance]()
+                {
+                    AZ_PROFILE_SCOPE(Animation, "MultiThreadScheduler::Execute::ActorInstanceUpdateTask");
+
+                    // enabling and disabling actor instances doesn't change the schedule, so check it when the task runs
+                    if (actorInstance->GetIsEnabled() == false)
                     {
-                        m_numVisible.Increment();
+                        return;
                     }
 
-                    // check if we want to sample motions
-                    bool sampleMotions = false;
-                    actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
-                    if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
-                    {
-                        sampleMotions = true;
-                        actorInstance->SetMotionSamplingTimer(0.0f);
+                    m_numUpdated.Increment();
+                    UpdateActorInstance(actorInstance, m_taskGraphTimePassed, GetTaskThreadIndex());
+                }));
+                taskTokenIndices.emplace(actorInstance, taskTokens.size() - 1);
 
-                        if (isVisible)
-                        {
-                            m_numSampled.Increment();
-                        }
+                // an attachment uses the transforms of the actor instance it is attached to, which is always in an earlier step
+                const ActorInstance* attachedTo = actorInstance->GetAttachedTo();
+                if (attachedTo)
+                {
+                    const auto attachedToTokenIndex = taskTokenIndices.find(attachedTo);
+                    if (attachedToTokenIndex != taskTokenIndices.end())
+                    {
+                        taskTokens[attachedToTokenIndex->second].Precedes(taskTokens.back());
                     }
+                }
+            }
+        }
 
-                    // update the actor instance
-                    actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
-                }, true, jobContext);
+        m_taskGraphDirty = false;
+    }
 
-                job->SetDependent(&jobCompletion);               
-                job->Start();
 
-                m_numUpdated.Increment();
-            }
+    // get the thread data index for the calling task
+    uint32 MultiThreadScheduler::GetTaskThreadIndex()
+    {
+        // the task executor either runs the tasks as jobs, or on its own workers
+        const AZ::u32 jobThreadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();
+        if (jobThreadIndex != AZ::JobManager::InvalidWorkerThreadId)
+        {
+            return jobThreadIndex;
+        }
 
-            jobCompletion.StartAndWaitForCompletion();
-        } // for all steps
+        const uint32_t taskWorkerIndex = AZ::TaskExecutor::Instance().GetCurrentWorkerIndex();
+        AZ_Assert(taskWorkerIndex != AZ::TaskExecutor::InvalidWorkerIndex, "Expected the actor instance update task to run on a task worker.");
+        return (taskWorkerIndex != AZ::TaskExecutor::InvalidWorkerIndex) ? taskWorkerIndex : 0;
     }
 
 
@@ -267,6 +384,8 @@ namespace EMotionFX
             m_steps[outStep].m_dependencies.reserve(m_steps[outStep].m_dependencies.size() + 5);
         }
 
+        m_taskGraphDirty = true;
+
         // add the actor instance and its dependencies
         m_steps[ outStep ].m_actorInstances.reserve(GetEMotionFX().GetNumThreads());
         m_steps[ outStep ].m_actorInstances.emplace_back(instance);
@@ -304,6 +423,8 @@ namespace EMotionFX
             // and if so, reconstruct the dependencies of this step
             if (step.m_actorInstances.size() < numActorInstancesPreRemove)
             {
+                m_taskGraphDirty = true;
+
                 // clear the dependencies (but don't delete the memory)
                 step.m_dependencies.clear();
 
@@ -13,6 +13,7 @@
 #include "ActorUpdateScheduler.h"
 #include "Actor.h"
 #include <MCore/Source/MultiThreadManager.h>
+#include <AzCore/Task/TaskGraph.h>
 
 namespace EMotionFX
 {
@@ -129,6 +130,43 @@ namespace EMotionFX
 
         bool HasActorInstanceInSteps(const ActorInstance* actorInstance) const;
 
+        /**
+         * Update a single actor instance. This is what the job or task of each actor instance in the schedule executes.
+         * @param actorInstance The actor instance to update.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         * @param threadIndex The index of the thread data to use for the update.
+         */
+        void UpdateActorInstance(ActorInstance* actorInstance, float timePassedInSeconds, uint32 threadIndex);
+
+        /**
+         * Execute the schedule step by step, using one job per actor instance and waiting for every step to complete.
+         * This is used when the task graph system isn't active.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void ExecuteJobs(float timePassedInSeconds);
+
+        /**
+         * Execute the schedule as a task graph with one task per actor instance. Instead of waiting for the whole previous
+         * step, the task of an attachment only waits for the task of the actor instance it is attached to.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void ExecuteTaskGraph(float timePassedInSeconds);
+
+        /**
+         * Rebuild the retained task graph from the schedule steps.
+         */
+        void BuildTaskGraph();
+
+        /**
+         * Get the thread data index of the task worker (or job worker) running on the calling thread.
+         * @result The thread data index to use for actor instances updated on this thread.
+         */
+        static uint32 GetTaskThreadIndex();
+
+        AZ::TaskGraph                   m_taskGraph{ "EMotionFX::MultiThreadScheduler" }; /**< The retained task graph, rebuilt whenever the schedule changes. */
+        float                           m_taskGraphTimePassed = 0.0f;   /**< The time passed that the tasks of the retained task graph update with. */
+        bool                            m_taskGraphDirty = true;        /**< True when the schedule changed since the task graph was built. */
+
         /**
          * The constructor.
          */
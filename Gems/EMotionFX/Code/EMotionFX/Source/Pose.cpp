@@ -18,6 +18,50 @@
 
 namespace EMotionFX
 {
+    namespace
+    {
+        // The blend kernels below work on the local space transform arrays directly, for the joints returned by jointIndex.
+        // Inlining the per joint math keeps the vector and quaternion math in SIMD registers, instead of going through the
+        // ready flag checks and out of line Transform calls for every joint.
+        template <typename JointIndexFunction>
+        void BlendLocalSpaceTransforms(Transform* transforms, const Transform* destTransforms, size_t numJoints, const JointIndexFunction& jointIndex, float weight)
+        {
+            for (size_t i = 0; i < numJoints; ++i)
+            {
+                const size_t joint = jointIndex(i);
+                Transform& transform = transforms[joint];
+                const Transform& destTransform = destTransforms[joint];
+                transform.m_position = transform.m_position.Lerp(destTransform.m_position, weight);
+                transform.m_rotation = MCore::NLerp(transform.m_rotation, destTransform.m_rotation, weight);
+                EMFX_SCALECODE
+                (
+                    transform.m_scale = transform.m_scale.Lerp(destTransform.m_scale, weight);
+                )
+            }
+        }
+
+        // Matches Transform::BlendAdditive, using the base transforms as the original transforms.
+        template <typename JointIndexFunction>
+        void BlendAdditiveLocalSpaceTransforms(Transform* transforms, const Transform* destTransforms, const Transform* baseTransforms, size_t numJoints, const JointIndexFunction& jointIndex, float weight)
+        {
+            for (size_t i = 0; i < numJoints; ++i)
+            {
+                const size_t joint = jointIndex(i);
+                Transform& transform = transforms[joint];
+                const Transform& destTransform = destTransforms[joint];
+                const Transform& baseTransform = baseTransforms[joint];
+
+                const AZ::Quaternion rotation = MCore::NLerp(baseTransform.m_rotation, destTransform.m_rotation, weight);
+                transform.m_rotation = (transform.m_rotation * (baseTransform.m_rotation.GetConjugate() * rotation)).GetNormalized();
+                transform.m_position += (destTransform.m_position - baseTransform.m_position) * weight;
+                EMFX_SCALECODE
+                (
+                    transform.m_scale += (destTransform.m_scale - baseTransform.m_scale) * weight;
+                )
+            }
+        }
+    } // namespace
+
     // default constructor
     Pose::Pose()
     {
@@ -453,11 +497,33 @@ namespace EMotionFX
 
     void Pose::UpdateAllModelSpaceTranforms()
     {
+        // Parents come before their children in the skeleton, so a single pass in joint order has every parent ready when its
+        // children get updated, without recursing for every joint.
         Skeleton* skeleton = m_actor->GetSkeleton();
         const size_t numNodes = skeleton->GetNumNodes();
         for (size_t i = 0; i < numNodes; ++i)
         {
-            UpdateModelSpaceTransform(i);
+            if (m_flags[i] & FLAG_MODELTRANSFORMREADY)
+            {
+                continue;
+            }
+
+            const size_t parentIndex = skeleton->GetNode(i)->GetParentIndex();
+            if (parentIndex == InvalidIndex)
+            {
+                m_modelSpaceTransforms[i] = m_localSpaceTransforms[i];
+            }
+            else if (m_flags[parentIndex] & FLAG_MODELTRANSFORMREADY)
+            {
+                m_modelSpaceTransforms[parentIndex].PreMultiply(m_localSpaceTransforms[i], &m_modelSpaceTransforms[i]);
+            }
+            else
+            {
+                UpdateModelSpaceTransform(i);
+                continue;
+            }
+
+            m_flags[i] |= FLAG_MODELTRANSFORMREADY;
         }
     }
 
@@ -833,13 +899,9 @@ namespace EMotionFX
     {
         if (m_actorInstance)
         {
-            const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
-            for (size_t i = 0; i < numNodes; ++i)
-            {
-                const uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(nodeNr), weight);
-            }
+            const AZStd::vector<uint16>& enabledNodes = m_actorInstance->GetEnabledNodes();
+            BlendLocalSpaceTransforms(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), enabledNodes.size(),
+                [&enabledNodes](size_t i) { return enabledNodes[i]; }, weight);
 
             // blend the morph weights
             const size_t numMorphs = m_morphWeights.size();
@@ -858,12 +920,8 @@ namespace EMotionFX
         }
         else
         {
-            const size_t numNodes = m_actor->GetSkeleton()->GetNumNodes();
-            for (size_t i = 0; i < numNodes; ++i)
-            {
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(i));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(i), weight);
-            }
+            BlendLocalSpaceTransforms(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), m_actor->GetSkeleton()->GetNumNodes(),
+                [](size_t i) { return i; }, weight);
 
             // blend the morph weights
             const size_t numMorphs = m_morphWeights.size();
@@ -1090,15 +1148,14 @@ namespace EMotionFX
         if (m_actorInstance)
         {
             const TransformData* transformData = m_actorInstance->GetTransformData();
-            Pose* bindPose = transformData->GetBindPose();
-            Transform result;
+            const Pose* bindPose = transformData->GetBindPose();
 
-            const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
-            for (size_t i = 0; i < numNodes; ++i)
+            const AZStd::vector<uint16>& enabledNodes = m_actorInstance->GetEnabledNodes();
+            BlendAdditiveLocalSpaceTransforms(m_localSpaceTransforms.data(), destPose->m_localSpaceTransforms.data(), bindPose->m_localSpaceTransforms.data(),
+                enabledNodes.size(), [&enabledNodes](size_t i) { return enabledNodes[i]; }, weight);
+            for (const uint16 nodeNr : enabledNodes)
             {
-                const uint16 nodeNr = m_actorInstance->GetEnabledNode(i);
-                BlendTransformAdditiveUsingBindPose(bindPose->GetLocalSpaceTransform(nodeNr), GetLocalSpaceTransform(nodeNr), destPose->GetLocalSpaceTransform(nodeNr), weight, &result);
-                SetLocalSpaceTransform(nodeNr, result, false);
+                m_flags[nodeNr] |= FLAG_LOCALTRANSFORMREADY;
             }
 
             // blend the morph weights
@@ -1402,9 +1459,10 @@ namespace EMotionFX
         const Pose* bindPose = transformData->GetBindPose();
         const AZStd::vector<size_t>& jointLinks = motionLinkData->GetJointDataLinks();
 
+        // Only the local space transforms are read from the unmirrored pose, so don't copy the model space transforms and pose datas.
         AnimGraphPose* tempPose = GetEMotionFX().GetThreadData(m_actorInstance->GetThreadIndex())->GetPosePool().RequestPose(m_actorInstance);
         Pose& unmirroredPose = tempPose->GetPose();
-        unmirroredPose = *this;
+        unmirroredPose.m_localSpaceTransforms = m_localSpaceTransforms;
 
         const size_t numNodes = m_actorInstance->GetNumEnabledNodes();
         for (size_t i = 0; i < numNodes; ++i)
@@ -1421,7 +1479,7 @@ namespace EMotionFX
             Transform mirrored = bindPose->GetLocalSpaceTransform(nodeNumber);
             AZ::Vector3 mirrorAxis = AZ::Vector3::CreateZero();
             mirrorAxis.SetElement(mirrorInfo.m_axis, 1.0f);
-            mirrored.ApplyDeltaMirrored(bindPose->GetLocalSpaceTransform(mirrorInfo.m_sourceNode), unmirroredPose.GetLocalSpaceTransform(mirrorInfo.m_sourceNode), mirrorAxis, mirrorInfo.m_flags);
+            mirrored.ApplyDeltaMirrored(bindPose->GetLocalSpaceTransform(mirrorInfo.m_sourceNode), unmirroredPose.GetLocalSpaceTransformDirect(mirrorInfo.m_sourceNode), mirrorAxis, mirrorInfo.m_flags);
 
             SetLocalSpaceTransformDirect(nodeNumber, mirrored);
         }
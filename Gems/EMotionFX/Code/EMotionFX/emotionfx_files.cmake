@@ -352,6 +352,8 @@ set(FILES
     Source/MotionData/MotionDataSampleSettings.h
     Source/MotionData/NonUniformMotionData.cpp
     Source/MotionData/NonUniformMotionData.h
+    Source/MotionData/QuantizedMotionData.cpp
+    Source/MotionData/QuantizedMotionData.h
     Source/MotionData/UniformMotionData.cpp
     Source/MotionData/UniformMotionData.h
     Source/MotionData/RootMotionExtractionData.h
@@ -38,6 +38,7 @@ namespace EMotionFX
                     ->Field("LODDistances", &Configuration::m_lodDistances)
                     ->Field("EnableLODSampling", &Configuration::m_enableLodSampling)
                     ->Field("LODSampleRates", &Configuration::m_lodSampleRates)
+                    ->Field("EnableLODSampleInterpolation", &Configuration::m_enableLodSampleInterpolation)
                     ;
 
                 AZ::EditContext* editContext = serializeContext->GetEditContext();
@@ -63,7 +64,10 @@ namespace EMotionFX
                             ->Attribute(AZ::Edit::Attributes::ContainerCanBeModified, false)
                             ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
                             ->ElementAttribute(AZ::Edit::Attributes::Step, 1.0f)
-                            ->ElementAttribute(AZ::Edit::Attributes::Min, 0.0f);
+                            ->ElementAttribute(AZ::Edit::Attributes::Min, 0.0f)
+                        ->DataElement(0, &SimpleLODComponent::Configuration::m_enableLodSampleInterpolation,
+                            "Interpolate between samples", "Blend between the last two anim graph samples on frames that don't sample, instead of holding the pose. This smooths out low sample rates at the cost of one sample of latency.")
+                            ->Attribute(AZ::Edit::Attributes::Visibility, &SimpleLODComponent::Configuration::GetEnableLodSampling);
                 }
             }
         }
@@ -233,10 +237,15 @@ namespace EMotionFX
                     const float animGraphSampleRate = configuration.m_lodSampleRates[requestedLod];
                     const float updateRateInSeconds = animGraphSampleRate > 0.0f ? 1.0f / animGraphSampleRate : 0.0f;
                     actorInstance->SetMotionSamplingRate(updateRateInSeconds);
+                    if (actorInstance->GetMotionSamplingInterpolationEnabled() != configuration.m_enableLodSampleInterpolation)
+                    {
+                        actorInstance->SetMotionSamplingInterpolationEnabled(configuration.m_enableLodSampleInterpolation);
+                    }
                 }
                 else if (actorInstance->GetMotionSamplingRate() != 0)
                 {
                     actorInstance->SetMotionSamplingRate(0);
+                    actorInstance->SetMotionSamplingInterpolationEnabled(false);
                 }
 
                 // Disable the automatic mesh LOD level adjustment based on screen space in case a simple LOD component is present.
@@ -52,6 +52,7 @@ namespace EMotionFX
                 AZStd::vector<float> m_lodDistances;         // LOD distances that decide which lod the actor should choose.
                 AZStd::vector<float> m_lodSampleRates;       // Per LOD sample rate.
                 bool m_enableLodSampling = false;            // Enable per LOD sampling rate. This will allow animation to sample at a lower rate for performance improvement.
+                bool m_enableLodSampleInterpolation = false; // Interpolate between the samples of LODs with a lower sample rate, instead of holding the pose.
             };
 
             SimpleLODComponent(const Configuration* config = nullptr);
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/UnitTest.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Quaternion.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionData/QuantizedMotionData.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <MCore/Source/MemoryFile.h>
+#include <Tests/ActorFixture.h>
+#include <Tests/Matchers.h>
+
+namespace EMotionFX
+{
+    class QuantizedMotionDataTests
+        : public ActorFixture
+        , public UnitTest::TraceBusRedirector
+    {
+    public:
+        void SetUp()
+        {
+            UnitTest::TraceBusRedirector::BusConnect();
+            ActorFixture::SetUp();
+        }
+
+        void TearDown()
+        {
+            ActorFixture::TearDown();
+            UnitTest::TraceBusRedirector::BusDisconnect();
+        }
+
+    protected:
+        // Two seconds of animation at 30 fps, so that the data spans multiple blocks.
+        // Joint 0 has animated position and rotation, joint 1 is static. Morph 0 and float 0 are animated, morph 1 and float 1 are static.
+        static void FillSourceData(NonUniformMotionData& motionData)
+        {
+            const size_t numKeys = 61;
+            const float keySpacing = 1.0f / 30.0f;
+
+            motionData.Resize(2, 2, 2);
+            motionData.SetJointName(0, "Joint1");
+            motionData.SetJointName(1, "Joint2");
+            motionData.SetMorphName(0, "Morph1");
+            motionData.SetMorphName(1, "Morph2");
+            motionData.SetFloatName(0, "Float1");
+            motionData.SetFloatName(1, "Float2");
+
+            motionData.SetJointStaticPosition(1, AZ::Vector3(1.0f, 2.0f, 3.0f));
+            motionData.SetJointStaticRotation(1, AZ::Quaternion::CreateRotationX(0.5f));
+            motionData.SetMorphStaticValue(1, 0.25f);
+            motionData.SetFloatStaticValue(1, 4.0f);
+
+            motionData.AllocateJointPositionSamples(0, numKeys);
+            motionData.AllocateJointRotationSamples(0, numKeys);
+            motionData.AllocateMorphSamples(0, numKeys);
+            motionData.AllocateFloatSamples(0, numKeys);
+            for (size_t i = 0; i < numKeys; ++i)
+            {
+                const float time = static_cast<float>(i) * keySpacing;
+                motionData.SetJointPositionSample(0, i, { time, AZ::Vector3(time * 2.0f, AZ::Sin(time * 3.0f), -time) });
+                motionData.SetJointRotationSample(0, i, { time, AZ::Quaternion::CreateRotationZ(time * AZ::Constants::HalfPi * 0.5f) });
+                motionData.SetMorphSample(0, i, { time, time * 0.5f });
+                motionData.SetFloatSample(0, i, { time, AZ::Cos(time) * 10.0f });
+            }
+            motionData.UpdateDuration();
+        }
+
+        static void ExpectSamplesNear(const MotionData& actual, const MotionData& expected, float tolerance)
+        {
+            ASSERT_EQ(actual.GetNumJoints(), expected.GetNumJoints());
+            ASSERT_EQ(actual.GetNumMorphs(), expected.GetNumMorphs());
+            ASSERT_EQ(actual.GetNumFloats(), expected.GetNumFloats());
+
+            // Sample both on and in between the sample points.
+            const float timeStep = 1.0f / 75.0f;
+            for (float time = 0.0f; time <= expected.GetDuration(); time += timeStep)
+            {
+                for (size_t i = 0; i < expected.GetNumJoints(); ++i)
+                {
+                    EXPECT_TRUE(actual.SampleJointPosition(time, i).IsClose(expected.SampleJointPosition(time, i), tolerance));
+
+                    // The quantized rotations can end up in the other hemisphere, which represents the same rotation.
+                    const AZ::Quaternion actualRotation = actual.SampleJointRotation(time, i);
+                    const AZ::Quaternion expectedRotation = expected.SampleJointRotation(time, i);
+                    EXPECT_NEAR(AZ::GetAbs(actualRotation.Dot(expectedRotation)), 1.0f, tolerance);
+                }
+
+                for (size_t i = 0; i < expected.GetNumMorphs(); ++i)
+                {
+                    EXPECT_NEAR(actual.SampleMorph(time, i), expected.SampleMorph(time, i), tolerance);
+                }
+
+                for (size_t i = 0; i < expected.GetNumFloats(); ++i)
+                {
+                    EXPECT_NEAR(actual.SampleFloat(time, i), expected.SampleFloat(time, i), tolerance);
+                }
+            }
+        }
+    };
+
+    TEST_F(QuantizedMotionDataTests, InitFromNonUniformData)
+    {
+        NonUniformMotionData sourceData;
+        FillSourceData(sourceData);
+
+        QuantizedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData);
+        EXPECT_FLOAT_EQ(motionData.GetDuration(), 2.0f);
+        EXPECT_FLOAT_EQ(motionData.GetSampleSpacing(), 1.0f / 30.0f);
+        EXPECT_EQ(motionData.GetNumSamples(), 61);
+        EXPECT_EQ(motionData.GetNumBlocks(), 4);
+
+        // Position (3) and rotation (4) of joint 0, plus one morph and one float.
+        EXPECT_EQ(motionData.GetNumComponents(), 9);
+        EXPECT_TRUE(motionData.IsJointPositionAnimated(0));
+        EXPECT_TRUE(motionData.IsJointRotationAnimated(0));
+        EXPECT_FALSE(motionData.IsJointAnimated(1));
+        EXPECT_TRUE(motionData.IsMorphAnimated(0));
+        EXPECT_FALSE(motionData.IsMorphAnimated(1));
+        EXPECT_TRUE(motionData.IsFloatAnimated(0));
+        EXPECT_FALSE(motionData.IsFloatAnimated(1));
+    }
+
+    TEST_F(QuantizedMotionDataTests, SampleMatchesUniformMotionData)
+    {
+        NonUniformMotionData sourceData;
+        FillSourceData(sourceData);
+
+        UniformMotionData uniformData;
+        uniformData.InitFromNonUniformData(&sourceData);
+
+        QuantizedMotionData quantizedData;
+        quantizedData.InitFromNonUniformData(&sourceData);
+
+        ExpectSamplesNear(quantizedData, uniformData, 0.001f);
+        EXPECT_THAT(quantizedData.SampleJointPosition(0.5f, 1), IsClose(AZ::Vector3(1.0f, 2.0f, 3.0f)));
+        EXPECT_FLOAT_EQ(quantizedData.SampleMorph(0.5f, 1), 0.25f);
+        EXPECT_FLOAT_EQ(quantizedData.SampleFloat(0.5f, 1), 4.0f);
+    }
+
+    TEST_F(QuantizedMotionDataTests, SaveAndReadRoundTrip)
+    {
+        NonUniformMotionData sourceData;
+        FillSourceData(sourceData);
+
+        QuantizedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData);
+
+        const MotionData::SaveSettings saveSettings;
+        MCore::MemoryFile file;
+        file.Open();
+        ASSERT_TRUE(motionData.Save(&file, saveSettings));
+        EXPECT_EQ(file.GetFileSize(), motionData.CalcStreamSaveSizeInBytes(saveSettings));
+
+        MotionData::ReadSettings readSettings;
+        readSettings.m_version = motionData.GetStreamSaveVersion();
+        EXPECT_EQ(readSettings.m_version, 1);
+        file.Seek(0);
+        QuantizedMotionData loadedData;
+        ASSERT_TRUE(loadedData.Read(&file, readSettings));
+        file.Close();
+
+        EXPECT_EQ(loadedData.GetNumSamples(), motionData.GetNumSamples());
+        EXPECT_EQ(loadedData.GetNumBlocks(), motionData.GetNumBlocks());
+        EXPECT_EQ(loadedData.GetNumComponents(), motionData.GetNumComponents());
+        EXPECT_FLOAT_EQ(loadedData.GetSampleSpacing(), motionData.GetSampleSpacing());
+        EXPECT_FLOAT_EQ(loadedData.GetDuration(), motionData.GetDuration());
+        for (size_t i = 0; i < motionData.GetNumJoints(); ++i)
+        {
+            EXPECT_STREQ(loadedData.GetJointName(i).c_str(), motionData.GetJointName(i).c_str());
+            EXPECT_EQ(loadedData.IsJointPositionAnimated(i), motionData.IsJointPositionAnimated(i));
+            EXPECT_EQ(loadedData.IsJointRotationAnimated(i), motionData.IsJointRotationAnimated(i));
+        }
+        for (size_t i = 0; i < motionData.GetNumMorphs(); ++i)
+        {
+            EXPECT_STREQ(loadedData.GetMorphName(i).c_str(), motionData.GetMorphName(i).c_str());
+            EXPECT_EQ(loadedData.IsMorphAnimated(i), motionData.IsMorphAnimated(i));
+        }
+        for (size_t i = 0; i < motionData.GetNumFloats(); ++i)
+        {
+            EXPECT_STREQ(loadedData.GetFloatName(i).c_str(), motionData.GetFloatName(i).c_str());
+            EXPECT_EQ(loadedData.IsFloatAnimated(i), motionData.IsFloatAnimated(i));
+        }
+
+        // The quantized blocks are stored as is, so only the static rotations lose precision through their 16 bit compression.
+        ExpectSamplesNear(loadedData, motionData, 0.001f);
+    }
+
+    TEST_F(QuantizedMotionDataTests, ReadUnsupportedVersionFails)
+    {
+        NonUniformMotionData sourceData;
+        FillSourceData(sourceData);
+
+        QuantizedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData);
+
+        MCore::MemoryFile file;
+        file.Open();
+        ASSERT_TRUE(motionData.Save(&file, MotionData::SaveSettings()));
+        file.Seek(0);
+
+        MotionData::ReadSettings readSettings;
+        readSettings.m_version = 2;
+        QuantizedMotionData loadedData;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(loadedData.Read(&file, readSettings));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        file.Close();
+    }
+} // namespace EMotionFX
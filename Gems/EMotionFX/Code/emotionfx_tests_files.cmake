@@ -99,6 +99,7 @@ set(FILES
     Tests/MultiThreadSchedulerTests.cpp
     Tests/PoseTests.cpp
     Tests/Printers.cpp
+    Tests/QuantizedMotionDataTests.cpp
     Tests/QuaternionParameterTests.cpp
     Tests/RagdollCommandTests.cpp
     Tests/RandomMotionSelectionTests.cpp
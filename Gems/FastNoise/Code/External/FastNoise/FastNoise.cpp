@@ -30,6 +30,8 @@
 
 #include "FastNoise.h"
 
+#include <AzCore/Math/SimdMath.h>
+
 #include <math.h>
 #include <assert.h>
 
@@ -408,6 +410,170 @@ FN_DECIMAL FastNoise::GetNoise(FN_DECIMAL x, FN_DECIMAL y, FN_DECIMAL z) const
     }
 }
 
+#ifndef FN_USE_DOUBLES
+// Generates Perlin noise for 4 positions at a time with AZ::Simd::Vec4 (SSE or NEON depending on the platform).
+// The arithmetic matches the scalar functions operation for operation, so the results are the same as GetNoise().
+// Only the hashing of the lattice coordinates is done per position.
+struct FastNoiseSimd
+{
+    using Vec4 = AZ::Simd::Vec4;
+
+    // Matches FastFloor(), which subtracts 1 from the truncated value of every negative number, including whole numbers
+    static Vec4::FloatType FastFloor(Vec4::FloatArgType f, Vec4::Int32Type& outFloor)
+    {
+        const Vec4::FloatType negativeMask = Vec4::CmpLt(f, Vec4::ZeroFloat());
+        outFloor = Vec4::Add(Vec4::ConvertToInt(f), Vec4::CastToInt(negativeMask));
+        return Vec4::ConvertToFloat(outFloor);
+    }
+
+    static Vec4::FloatType Lerp(Vec4::FloatArgType a, Vec4::FloatArgType b, Vec4::FloatArgType t)
+    {
+        return Vec4::Add(a, Vec4::Mul(t, Vec4::Sub(b, a)));
+    }
+
+    static Vec4::FloatType Interp(FastNoise::Interp interp, Vec4::FloatArgType t)
+    {
+        switch (interp)
+        {
+        case FastNoise::Hermite:
+            return Vec4::Mul(Vec4::Mul(t, t), Vec4::Sub(Vec4::Splat(3.0f), Vec4::Mul(Vec4::Splat(2.0f), t)));
+        case FastNoise::Quintic:
+            return Vec4::Mul(
+                Vec4::Mul(Vec4::Mul(t, t), t),
+                Vec4::Add(Vec4::Mul(t, Vec4::Sub(Vec4::Mul(t, Vec4::Splat(6.0f)), Vec4::Splat(15.0f))), Vec4::Splat(10.0f)));
+        default:
+            return t;
+        }
+    }
+
+    static Vec4::FloatType SinglePerlin(const FastNoise& noise, unsigned char offset, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+    {
+        Vec4::Int32Type x0, y0, z0;
+        const Vec4::FloatType xd0 = Vec4::Sub(x, FastFloor(x, x0));
+        const Vec4::FloatType yd0 = Vec4::Sub(y, FastFloor(y, y0));
+        const Vec4::FloatType zd0 = Vec4::Sub(z, FastFloor(z, z0));
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType xd1 = Vec4::Sub(xd0, one);
+        const Vec4::FloatType yd1 = Vec4::Sub(yd0, one);
+        const Vec4::FloatType zd1 = Vec4::Sub(zd0, one);
+
+        const Vec4::FloatType xs = Interp(noise.m_interp, xd0);
+        const Vec4::FloatType ys = Interp(noise.m_interp, yd0);
+        const Vec4::FloatType zs = Interp(noise.m_interp, zd0);
+
+        alignas(16) int32_t latticeX[4];
+        alignas(16) int32_t latticeY[4];
+        alignas(16) int32_t latticeZ[4];
+        Vec4::StoreAligned(latticeX, x0);
+        Vec4::StoreAligned(latticeY, y0);
+        Vec4::StoreAligned(latticeZ, z0);
+
+        // Gradients of the 8 lattice corners around each position, indexed by corner (x + 2y + 4z) and then by position
+        alignas(16) float gradX[8][4];
+        alignas(16) float gradY[8][4];
+        alignas(16) float gradZ[8][4];
+        for (int lane = 0; lane < 4; lane++)
+        {
+            for (int corner = 0; corner < 8; corner++)
+            {
+                const unsigned char lutPos = noise.Index3D_12(
+                    offset, latticeX[lane] + (corner & 1), latticeY[lane] + ((corner >> 1) & 1), latticeZ[lane] + ((corner >> 2) & 1));
+                gradX[corner][lane] = GRAD_X[lutPos];
+                gradY[corner][lane] = GRAD_Y[lutPos];
+                gradZ[corner][lane] = GRAD_Z[lutPos];
+            }
+        }
+
+        auto gradCoord = [&](int corner, Vec4::FloatArgType xd, Vec4::FloatArgType yd, Vec4::FloatArgType zd)
+        {
+            return Vec4::Add(
+                Vec4::Add(Vec4::Mul(xd, Vec4::LoadAligned(gradX[corner])), Vec4::Mul(yd, Vec4::LoadAligned(gradY[corner]))),
+                Vec4::Mul(zd, Vec4::LoadAligned(gradZ[corner])));
+        };
+
+        const Vec4::FloatType xf00 = Lerp(gradCoord(0, xd0, yd0, zd0), gradCoord(1, xd1, yd0, zd0), xs);
+        const Vec4::FloatType xf10 = Lerp(gradCoord(2, xd0, yd1, zd0), gradCoord(3, xd1, yd1, zd0), xs);
+        const Vec4::FloatType xf01 = Lerp(gradCoord(4, xd0, yd0, zd1), gradCoord(5, xd1, yd0, zd1), xs);
+        const Vec4::FloatType xf11 = Lerp(gradCoord(6, xd0, yd1, zd1), gradCoord(7, xd1, yd1, zd1), xs);
+
+        const Vec4::FloatType yf0 = Lerp(xf00, xf10, ys);
+        const Vec4::FloatType yf1 = Lerp(xf01, xf11, ys);
+
+        return Lerp(yf0, yf1, zs);
+    }
+
+    static Vec4::FloatType SinglePerlinFractal(const FastNoise& noise, Vec4::FloatType x, Vec4::FloatType y, Vec4::FloatType z)
+    {
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType two = Vec4::Splat(2.0f);
+        const Vec4::FloatType lacunarity = Vec4::Splat(noise.m_lacunarity);
+
+        // Maps the noise of each octave the same way as SinglePerlinFractalFBM/Billow/RigidMulti
+        auto octaveValue = [&](Vec4::FloatArgType value)
+        {
+            switch (noise.m_fractalType)
+            {
+            case FastNoise::Billow:
+                return Vec4::Sub(Vec4::Mul(Vec4::Abs(value), two), one);
+            case FastNoise::RigidMulti:
+                return Vec4::Sub(one, Vec4::Abs(value));
+            default:
+                return value;
+            }
+        };
+
+        Vec4::FloatType sum = octaveValue(SinglePerlin(noise, noise.m_perm[0], x, y, z));
+        FN_DECIMAL amp = 1;
+        int i = 0;
+
+        while (++i < noise.m_octaves)
+        {
+            x = Vec4::Mul(x, lacunarity);
+            y = Vec4::Mul(y, lacunarity);
+            z = Vec4::Mul(z, lacunarity);
+
+            amp *= noise.m_gain;
+            const Vec4::FloatType octave = Vec4::Mul(octaveValue(SinglePerlin(noise, noise.m_perm[i], x, y, z)), Vec4::Splat(amp));
+            sum = (noise.m_fractalType == FastNoise::RigidMulti) ? Vec4::Sub(sum, octave) : Vec4::Add(sum, octave);
+        }
+
+        return (noise.m_fractalType == FastNoise::RigidMulti) ? sum : Vec4::Mul(sum, Vec4::Splat(noise.m_fractalBounding));
+    }
+};
+#endif
+
+void FastNoise::GetNoiseSet(const FN_DECIMAL* x, const FN_DECIMAL* y, const FN_DECIMAL* z, FN_DECIMAL* outValues, int count) const
+{
+    int index = 0;
+
+#ifndef FN_USE_DOUBLES
+    const bool perlin = (m_noiseType == Perlin);
+    const bool perlinFractal = (m_noiseType == PerlinFractal) && (m_fractalType == FBM || m_fractalType == Billow || m_fractalType == RigidMulti);
+    if (perlin || perlinFractal)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        const Vec4::FloatType frequency = Vec4::Splat(m_frequency);
+
+        for (; index + 4 <= count; index += 4)
+        {
+            const Vec4::FloatType xf = Vec4::Mul(Vec4::LoadUnaligned(x + index), frequency);
+            const Vec4::FloatType yf = Vec4::Mul(Vec4::LoadUnaligned(y + index), frequency);
+            const Vec4::FloatType zf = Vec4::Mul(Vec4::LoadUnaligned(z + index), frequency);
+
+            Vec4::StoreUnaligned(
+                outValues + index,
+                perlin ? FastNoiseSimd::SinglePerlin(*this, 0, xf, yf, zf) : FastNoiseSimd::SinglePerlinFractal(*this, xf, yf, zf));
+        }
+    }
+#endif
+
+    // Remaining positions, and the noise types that don't have a SIMD version
+    for (; index < count; index++)
+    {
+        outValues[index] = GetNoise(x[index], y[index], z[index]);
+    }
+}
+
 FN_DECIMAL FastNoise::GetNoise(FN_DECIMAL x, FN_DECIMAL y) const
 {
     x *= m_frequency;
@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/containers/array.h>
 #include <External/FastNoise/FastNoise.h>
 #include <LmbrCentral/Dependency/DependencyNotificationBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
@@ -347,19 +348,41 @@ namespace FastNoiseGem
             return;
         }
 
+        // Transform the positions in fixed-size chunks so that the generator can produce the noise for each chunk in bulk.
+        constexpr size_t ChunkSize = 256;
+        AZStd::array<float, ChunkSize> uvwX;
+        AZStd::array<float, ChunkSize> uvwY;
+        AZStd::array<float, ChunkSize> uvwZ;
+        AZStd::array<float, ChunkSize> noiseValues;
+        AZStd::array<bool, ChunkSize> pointRejected;
+
         AZStd::shared_lock lock(m_queryMutex);
         AZ::Vector3 uvw;
 
-        for (size_t index = 0; index < positions.size(); index++)
+        for (size_t chunkStart = 0; chunkStart < positions.size(); chunkStart += ChunkSize)
         {
-            bool wasPointRejected = false;
+            const size_t chunkCount = AZStd::min(ChunkSize, positions.size() - chunkStart);
+
+            for (size_t index = 0; index < chunkCount; index++)
+            {
+                bool wasPointRejected = false;
+                m_gradientTransform.TransformPositionToUVW(positions[chunkStart + index], uvw, wasPointRejected);
 
-            m_gradientTransform.TransformPositionToUVW(positions[index], uvw, wasPointRejected);
+                uvwX[index] = uvw.GetX();
+                uvwY[index] = uvw.GetY();
+                uvwZ[index] = uvw.GetZ();
+                pointRejected[index] = wasPointRejected;
+            }
 
-            // Generator returns a range between [-1, 1], map that to [0, 1]
-            outValues[index] = wasPointRejected ?
-                0.0f :
-                AZ::GetClamp((m_generator.GetNoise(uvw.GetX(), uvw.GetY(), uvw.GetZ()) + 1.0f) / 2.0f, 0.0f, 1.0f);
+            m_generator.GetNoiseSet(uvwX.data(), uvwY.data(), uvwZ.data(), noiseValues.data(), aznumeric_cast<int>(chunkCount));
+
+            for (size_t index = 0; index < chunkCount; index++)
+            {
+                // Generator returns a range between [-1, 1], map that to [0, 1]
+                outValues[chunkStart + index] = pointRejected[index] ?
+                    0.0f :
+                    AZ::GetClamp((noiseValues[index] + 1.0f) / 2.0f, 0.0f, 1.0f);
+            }
         }
     }
 
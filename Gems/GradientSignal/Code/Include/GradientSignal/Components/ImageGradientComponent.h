@@ -117,7 +117,7 @@ namespace GradientSignal
     */
     class ImageGradientComponent
         : public AZ::Component
-        , private AZ::Data::AssetBus::Handler
+        , private AZ::Data::AssetBus::MultiHandler
         , private GradientRequestBus::Handler
         , private ImageGradientRequestBus::Handler
         , private ImageGradientModificationBus::Handler
@@ -192,6 +192,10 @@ namespace GradientSignal
         void UpdateCachedImageBufferData(const AZ::RHI::ImageDescriptor& imageDescriptor, AZStd::span<const uint8_t> imageData);
 
         void GetSubImageData();
+        //! Cache the image data of the current mip level if it's resident, or else of the best resident fallback mip level.
+        void UpdateCachedImageBufferDataFromResidentMip();
+        //! Start streaming in the mip chain that the current mip level needs, if there is one.
+        void StreamPendingMipChain();
         void GetValuesInternal(SamplingType samplingType, AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
         float GetValueFromImageData(SamplingType samplingType, const AZ::Vector3& uvw, float defaultValue) const;
 
@@ -258,6 +262,11 @@ namespace GradientSignal
         AZ::RHI::ImageDescriptor m_imageDescriptor;
         AZStd::span<const uint8_t> m_imageData;
 
+        //! The mip chain that was streamed in for the current mip level, when mip chain streaming is enabled.
+        AZ::Data::Asset<AZ::RPI::ImageMipChainAsset> m_streamedMipChain;
+        //! The mip chain that the current mip level needs but that isn't resident yet.
+        AZ::Data::AssetId m_pendingMipChainId;
+
         //! Temporary buffer for runtime modifications of the image data.
         AZStd::vector<float> m_modifiedImageData;
 
@@ -64,9 +64,19 @@ namespace GradientSignal
         const float max = m_falloffMidpoint + m_falloffRange / 2.0f;
         const float valueFalloffStrength = AZ::GetClamp(m_falloffStrength, 0.0f, 1.0f);
 
-        for (auto& inOutValue : inOutValues)
+        using AZ::Simd::Vec4;
+
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+
+        TransformValues(inOutValues, [&](Vec4::FloatArgType inputValue)
         {
-            inOutValue = CalculateSmoothedValue(min, max, valueFalloffStrength, inOutValue);
-        }
+            const Vec4::FloatType value = Vec4::Clamp(inputValue, zero, one);
+
+            const Vec4::FloatType result1 = GetSmoothStep(GetRatio(min, min + valueFalloffStrength, value));
+            const Vec4::FloatType result2 = GetSmoothStep(GetRatio(max - valueFalloffStrength, max, value));
+
+            return Vec4::Mul(result1, Vec4::Sub(one, result2));
+        });
     }
 } // namespace GradientSignal
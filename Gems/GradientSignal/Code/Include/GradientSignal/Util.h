@@ -11,7 +11,9 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/span.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 #include <GradientSignal/GradientTransform.h>
@@ -79,36 +81,131 @@ namespace GradientSignal
         return AZ::Lerp(outputMin, outputMax, inputCorrected);
     }
 
+    //! Applies a SIMD operation to all the values in blocks of 4. The last partial block is padded with zeros, so the operation
+    //! needs to be safe to run on values that get discarded.
+    template<typename Operation>
+    inline void TransformValues(AZStd::span<float> inOutValues, Operation&& operation)
+    {
+        using AZ::Simd::Vec4;
+
+        const size_t blockEnd = inOutValues.size() & ~static_cast<size_t>(3);
+        for (size_t index = 0; index < blockEnd; index += 4)
+        {
+            Vec4::StoreUnaligned(&inOutValues[index], operation(Vec4::LoadUnaligned(&inOutValues[index])));
+        }
+
+        if (blockEnd < inOutValues.size())
+        {
+            float block[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            AZStd::copy(inOutValues.begin() + blockEnd, inOutValues.end(), block);
+            Vec4::StoreUnaligned(block, operation(Vec4::LoadUnaligned(block)));
+            AZStd::copy(block, block + (inOutValues.size() - blockEnd), inOutValues.begin() + blockEnd);
+        }
+    }
+
+    //! Combines the values with a second list of values using a SIMD operation in blocks of 4.
+    //! The last partial block is padded with zeros in the same way as TransformValues.
+    template<typename Operation>
+    inline void TransformValues(AZStd::span<float> inOutValues, AZStd::span<const float> otherValues, Operation&& operation)
+    {
+        using AZ::Simd::Vec4;
+
+        AZ_Assert(inOutValues.size() == otherValues.size(), "value lists are different sizes (%zu vs %zu).",
+            inOutValues.size(), otherValues.size());
+
+        const size_t blockEnd = inOutValues.size() & ~static_cast<size_t>(3);
+        for (size_t index = 0; index < blockEnd; index += 4)
+        {
+            Vec4::StoreUnaligned(
+                &inOutValues[index], operation(Vec4::LoadUnaligned(&inOutValues[index]), Vec4::LoadUnaligned(&otherValues[index])));
+        }
+
+        if (blockEnd < inOutValues.size())
+        {
+            float block[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            float otherBlock[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            AZStd::copy(inOutValues.begin() + blockEnd, inOutValues.end(), block);
+            AZStd::copy(otherValues.begin() + blockEnd, otherValues.end(), otherBlock);
+            Vec4::StoreUnaligned(block, operation(Vec4::LoadUnaligned(block), Vec4::LoadUnaligned(otherBlock)));
+            AZStd::copy(block, block + (inOutValues.size() - blockEnd), inOutValues.begin() + blockEnd);
+        }
+    }
+
+    //! SIMD version of GetRatio().
+    inline AZ::Simd::Vec4::FloatType GetRatio(float a, float b, AZ::Simd::Vec4::FloatArgType t)
+    {
+        using AZ::Simd::Vec4;
+
+        if (a == b)
+        {
+            return Vec4::Select(Vec4::ZeroFloat(), Vec4::Splat(1.0f), Vec4::CmpLtEq(t, Vec4::Splat(a)));
+        }
+
+        return Vec4::Clamp(Vec4::Div(Vec4::Sub(t, Vec4::Splat(a)), Vec4::Splat(b - a)), Vec4::ZeroFloat(), Vec4::Splat(1.0f));
+    }
+
+    //! SIMD version of GetSmoothStep().
+    inline AZ::Simd::Vec4::FloatType GetSmoothStep(AZ::Simd::Vec4::FloatArgType t)
+    {
+        using AZ::Simd::Vec4;
+        return Vec4::Mul(Vec4::Mul(t, t), Vec4::Sub(Vec4::Splat(3.0f), Vec4::Mul(Vec4::Splat(2.0f), t)));
+    }
+
     inline void GetLevels(AZStd::span<float> inOutValues, float inputMid, float inputMin, float inputMax, float outputMin, float outputMax)
     {
+        using AZ::Simd::Vec4;
+
         inputMid = AZ::GetClamp(inputMid, 0.01f, 10.0f); // Clamp the midpoint to a non-zero value so that it's always safe to divide by it.
         inputMin = AZ::GetClamp(inputMin, 0.0f, 1.0f);
         inputMax = AZ::GetClamp(inputMax, 0.0f, 1.0f);
         outputMin = AZ::GetClamp(outputMin, 0.0f, 1.0f);
         outputMax = AZ::GetClamp(outputMax, 0.0f, 1.0f);
 
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType outputMinV = Vec4::Splat(outputMin);
+        const Vec4::FloatType outputMaxV = Vec4::Splat(outputMax);
+
         if (inputMin == inputMax)
         {
-            for (auto& inOutValue : inOutValues)
+            const Vec4::FloatType inputMinV = Vec4::Splat(inputMin);
+            TransformValues(inOutValues, [&](Vec4::FloatArgType value)
             {
-                inOutValue = (AZ::GetClamp(inOutValue, 0.0f, 1.0f) <= inputMin) ? outputMin : outputMax;
-            }
+                return Vec4::Select(outputMinV, outputMaxV, Vec4::CmpLtEq(Vec4::Clamp(value, zero, one), inputMinV));
+            });
+            return;
         }
 
         const float inputMidReciprocal = 1.0f / inputMid;
         const float inputExtentsReciprocal = 1.0f / (inputMax - inputMin);
 
-        for (auto& inOutValue : inOutValues)
+        const Vec4::FloatType inputMinV = Vec4::Splat(inputMin);
+        const Vec4::FloatType inputExtentsReciprocalV = Vec4::Splat(inputExtentsReciprocal);
+        const Vec4::FloatType outputExtentsV = Vec4::Splat(outputMax - outputMin);
+
+        // The midpoint correction is the only part without a SIMD equivalent, so skip it in the common case where it's an identity.
+        const bool applyMidpoint = (inputMidReciprocal != 1.0f);
+
+        TransformValues(inOutValues, [&](Vec4::FloatArgType value)
         {
-            const float inputRemapped =
-                AZ::GetMin(AZ::GetMax(AZ::GetClamp(inOutValue, 0.0f, 1.0f) - inputMin, 0.0f) * inputExtentsReciprocal, 1.0f);
+            Vec4::FloatType inputRemapped = Vec4::Min(
+                Vec4::Mul(Vec4::Max(Vec4::Sub(Vec4::Clamp(value, zero, one), inputMinV), zero), inputExtentsReciprocalV), one);
 
-            // Note:  Some paint programs map the midpoint using 1/mid where low values are dark and high values are light,
-            // others do the reverse and use mid directly, so low values are light and high values are dark.  We've chosen to
-            // align with 1/mid since it appears to be the more prevalent of the two approaches.
-            const float inputCorrected = powf(inputRemapped, inputMidReciprocal);
+            if (applyMidpoint)
+            {
+                // Note:  Some paint programs map the midpoint using 1/mid where low values are dark and high values are light,
+                // others do the reverse and use mid directly, so low values are light and high values are dark.  We've chosen to
+                // align with 1/mid since it appears to be the more prevalent of the two approaches.
+                float lanes[4];
+                Vec4::StoreUnaligned(lanes, inputRemapped);
+                for (float& lane : lanes)
+                {
+                    lane = powf(lane, inputMidReciprocal);
+                }
+                inputRemapped = Vec4::LoadUnaligned(lanes);
+            }
 
-            inOutValue = AZ::Lerp(outputMin, outputMax, inputCorrected);
-        }
+            return Vec4::Madd(inputRemapped, outputExtentsV, outputMinV);
+        });
     }
 } // namespace GradientSignal
@@ -11,6 +11,7 @@
 #include <Atom/RPI.Public/RPIUtils.h>
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Asset/AssetSerializer.h>
+#include <AzCore/Console/Console.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -21,6 +22,37 @@
 
 namespace GradientSignal
 {
+    AZ_CVAR(
+        bool,
+        gs_imageGradientStreamMipChains,
+        false,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "When enabled, image gradients only load the tail mip chain of their image with the image itself, and stream in the mip "
+        "chain they sample from afterwards. Until it's resident, queries fall back to the highest resolution mip of the tail.");
+
+    AZ_CVAR(
+        uint32_t,
+        gs_imageGradientMaxResidentSize,
+        0,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "The largest width or height of the image gradient mip levels that get streamed in when gs_imageGradientStreamMipChains "
+        "is enabled. Larger images sample a lower resolution mip instead, which caps the memory used per image. 0 means no limit.");
+
+    namespace
+    {
+        AZ::Data::AssetLoadParameters GetImageAssetLoadParameters()
+        {
+            // The mip chains of a streaming image are referenced with NoLoad, so using their load behavior only loads the
+            // image and its tail mip chain.
+            return AZ::Data::AssetLoadParameters(
+                nullptr,
+                gs_imageGradientStreamMipChains ? AZ::Data::AssetDependencyLoadRules::UseLoadBehavior
+                                                : AZ::Data::AssetDependencyLoadRules::LoadAll);
+        }
+    }
+
     AZ::JsonSerializationResult::Result JsonImageGradientConfigSerializer::Load(
         void* outputValue, [[maybe_unused]] const AZ::Uuid& outputValueTypeId,
         const rapidjson::Value& inputValue, AZ::JsonDeserializerContext& context)
@@ -327,9 +359,16 @@ namespace GradientSignal
         }
 
         // Update our cached image data
-        UpdateCachedImageBufferData(
-            m_configuration.m_imageAsset->GetImageDescriptorForMipLevel(m_currentMipIndex),
-            m_configuration.m_imageAsset->GetSubImageData(m_currentMipIndex, 0));
+        if (gs_imageGradientStreamMipChains)
+        {
+            UpdateCachedImageBufferDataFromResidentMip();
+        }
+        else
+        {
+            UpdateCachedImageBufferData(
+                m_configuration.m_imageAsset->GetImageDescriptorForMipLevel(m_currentMipIndex),
+                m_configuration.m_imageAsset->GetSubImageData(m_currentMipIndex, 0));
+        }
 
         // Calculate the multiplier and offset based on our scale type
         // Make sure we do this last, because the calculation might
@@ -640,9 +679,9 @@ namespace GradientSignal
         // Invoke the QueueLoad before connecting to the AssetBus, so that
         // if the asset is already ready, then OnAssetReady will be triggered immediately
         UpdateCachedImageBufferData({}, {});
-        m_configuration.m_imageAsset.QueueLoad(AZ::Data::AssetLoadParameters(nullptr, AZ::Data::AssetDependencyLoadRules::LoadAll));
+        m_configuration.m_imageAsset.QueueLoad(GetImageAssetLoadParameters());
 
-        AZ::Data::AssetBus::Handler::BusConnect(m_configuration.m_imageAsset.GetId());
+        AZ::Data::AssetBus::MultiHandler::BusConnect(m_configuration.m_imageAsset.GetId());
 
         // Connect to GradientRequestBus last so that everything is initialized before listening for gradient queries.
         GradientRequestBus::Handler::BusConnect(GetEntityId());
@@ -653,7 +692,7 @@ namespace GradientSignal
         // Disconnect from GradientRequestBus first to ensure no queries are in process when deactivating.
         GradientRequestBus::Handler::BusDisconnect();
 
-        AZ::Data::AssetBus::Handler::BusDisconnect();
+        AZ::Data::AssetBus::MultiHandler::BusDisconnect();
         ImageGradientModificationBus::Handler::BusDisconnect();
         AzFramework::PaintBrushNotificationBus::Handler::BusDisconnect();
         ImageGradientRequestBus::Handler::BusDisconnect();
@@ -662,6 +701,8 @@ namespace GradientSignal
         // Make sure we don't keep any cached references to the image asset data or the image modification buffer.
         UpdateCachedImageBufferData({}, {});
 
+        m_streamedMipChain.Reset();
+        m_pendingMipChainId = {};
         m_configuration.m_imageAsset.Release();
     }
 
@@ -713,13 +754,97 @@ namespace GradientSignal
         }
     }
 
+    void ImageGradientComponent::UpdateCachedImageBufferDataFromResidentMip()
+    {
+        const auto& imageAsset = m_configuration.m_imageAsset;
+
+        // Pick the first mip level at or below the configured one that fits within the max resident size.
+        const AZ::u32 mipLevelCount = imageAsset->GetImageDescriptor().m_mipLevels;
+        const AZ::u32 maxResidentSize = gs_imageGradientMaxResidentSize;
+        if (maxResidentSize > 0)
+        {
+            while ((m_currentMipIndex + 1) < mipLevelCount)
+            {
+                const AZ::RHI::Size mipSize = imageAsset->GetImageDescriptor().m_size.GetReducedMip(m_currentMipIndex);
+                if (AZStd::max(mipSize.m_width, mipSize.m_height) <= maxResidentSize)
+                {
+                    break;
+                }
+                ++m_currentMipIndex;
+            }
+        }
+
+        const size_t tailMipChainIndex = imageAsset->GetMipChainCount() - 1;
+        const size_t mipChainIndex = imageAsset->GetMipChainIndex(m_currentMipIndex);
+
+        // The tail mip chain is always resident, and other mip chains might have been loaded by other users of the image.
+        if ((mipChainIndex == tailMipChainIndex) || imageAsset->GetMipChainAsset(mipChainIndex).IsReady())
+        {
+            m_pendingMipChainId = {};
+            UpdateCachedImageBufferData(
+                imageAsset->GetImageDescriptorForMipLevel(m_currentMipIndex), imageAsset->GetSubImageData(m_currentMipIndex, 0));
+            return;
+        }
+
+        const AZ::Data::AssetId mipChainId = imageAsset->GetMipChainAsset(mipChainIndex).GetId();
+        if ((m_streamedMipChain.GetId() == mipChainId) && m_streamedMipChain.IsReady())
+        {
+            m_pendingMipChainId = {};
+
+            const uint32_t mipInChain = m_currentMipIndex - aznumeric_cast<uint32_t>(imageAsset->GetMipLevel(mipChainIndex));
+            AZ::RHI::ImageDescriptor imageDescriptor = imageAsset->GetImageDescriptor();
+            imageDescriptor.m_size = m_streamedMipChain->GetSubImageLayout(mipInChain).m_size;
+            UpdateCachedImageBufferData(imageDescriptor, m_streamedMipChain->GetSubImageData(mipInChain, 0));
+            return;
+        }
+
+        // The mip chain needs to be streamed in, which gets started once the query lock is released.
+        // Until then, fall back to the highest resolution mip level in the tail mip chain.
+        m_pendingMipChainId = mipChainId;
+        m_currentMipIndex = aznumeric_cast<AZ::u32>(imageAsset->GetMipLevel(tailMipChainIndex));
+        UpdateCachedImageBufferData(
+            imageAsset->GetImageDescriptorForMipLevel(m_currentMipIndex), imageAsset->GetSubImageData(m_currentMipIndex, 0));
+    }
+
+    void ImageGradientComponent::StreamPendingMipChain()
+    {
+        AZ::Data::AssetId mipChainId;
+        {
+            AZStd::unique_lock lock(m_queryMutex);
+            if (!m_pendingMipChainId.IsValid() || (m_pendingMipChainId == m_streamedMipChain.GetId()))
+            {
+                return;
+            }
+
+            mipChainId = m_pendingMipChainId;
+            if (m_streamedMipChain.GetId().IsValid())
+            {
+                AZ::Data::AssetBus::MultiHandler::BusDisconnect(m_streamedMipChain.GetId());
+            }
+            m_streamedMipChain = AZ::Data::AssetManager::Instance().GetAsset<AZ::RPI::ImageMipChainAsset>(
+                mipChainId, AZ::Data::AssetLoadBehavior::QueueLoad);
+        }
+
+        // Connecting after releasing the lock, because this will immediately call OnAssetReady if the mip chain is already loaded.
+        AZ::Data::AssetBus::MultiHandler::BusConnect(mipChainId);
+    }
+
     void ImageGradientComponent::OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset)
     {
         {
             AZStd::unique_lock lock(m_queryMutex);
-            m_configuration.m_imageAsset = asset;
+            if (asset.GetId() == m_streamedMipChain.GetId())
+            {
+                m_streamedMipChain = asset;
+            }
+            else
+            {
+                m_configuration.m_imageAsset = asset;
+            }
             GetSubImageData();
         }
+
+        StreamPendingMipChain();
         LmbrCentral::DependencyNotificationBus::Event(GetEntityId(), &LmbrCentral::DependencyNotificationBus::Events::OnCompositionChanged);
     }
 
@@ -994,8 +1119,8 @@ namespace GradientSignal
             return;
         }
 
-        // Stop listening for the current image asset.
-        AZ::Data::AssetBus::Handler::BusDisconnect(m_configuration.m_imageAsset.GetId());
+        // Stop listening for the current image asset and any mip chain that was streamed in for it.
+        AZ::Data::AssetBus::MultiHandler::BusDisconnect();
 
         {
             // Only hold the lock during the actual data changes, to ensure that we aren't mid-query when changing it, but also to
@@ -1011,6 +1136,8 @@ namespace GradientSignal
             }
 
             m_configuration.m_imageAsset = asset;
+            m_streamedMipChain.Reset();
+            m_pendingMipChainId = {};
         }
 
         if (m_configuration.m_imageAsset.GetId().IsValid())
@@ -1024,11 +1151,11 @@ namespace GradientSignal
             // Only queue the load if it appears in the Asset Catalog. If it doesn't, we'll get notified when it shows up.
             if (assetInfo.m_assetId.IsValid())
             {
-                m_configuration.m_imageAsset.QueueLoad(AZ::Data::AssetLoadParameters(nullptr, AZ::Data::AssetDependencyLoadRules::LoadAll));
+                m_configuration.m_imageAsset.QueueLoad(GetImageAssetLoadParameters());
             }
 
             // Start listening for all events for this asset.
-            AZ::Data::AssetBus::Handler::BusConnect(m_configuration.m_imageAsset.GetId());
+            AZ::Data::AssetBus::MultiHandler::BusConnect(m_configuration.m_imageAsset.GetId());
         }
 
         LmbrCentral::DependencyNotificationBus::Event(GetEntityId(), &LmbrCentral::DependencyNotificationBus::Events::OnCompositionChanged);
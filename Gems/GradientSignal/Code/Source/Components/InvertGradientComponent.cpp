@@ -150,10 +150,14 @@ namespace GradientSignal
         }
 
         m_configuration.m_gradientSampler.GetValues(positions, outValues);
-        for (auto& outValue : outValues)
+
+        using AZ::Simd::Vec4;
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        TransformValues(outValues, [&](Vec4::FloatArgType value)
         {
-            outValue = 1.0f - AZ::GetClamp(outValue, 0.0f, 1.0f);
-        }
+            return Vec4::Sub(one, Vec4::Clamp(value, zero, one));
+        });
     }
 
     bool InvertGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
@@ -14,6 +14,104 @@
 
 namespace GradientSignal
 {
+    namespace
+    {
+        using AZ::Simd::Vec4;
+
+        //! Blends the values of one layer into the accumulated values, 4 values at a time. The mixing operation is selected
+        //! once per layer by the caller, so the inner loop doesn't need to branch on it.
+        template<typename Operation>
+        void BlendLayer(
+            AZStd::span<float> inOutValues, AZStd::span<const float> layerValues, float opacity, float inverseOpacity, Operation&& operation)
+        {
+            const Vec4::FloatType opacityV = Vec4::Splat(opacity);
+            const Vec4::FloatType inverseOpacityV = Vec4::Splat(inverseOpacity);
+
+            TransformValues(inOutValues, layerValues, [&](Vec4::FloatArgType prevValue, Vec4::FloatArgType layerValue)
+            {
+                // unpremultiplied alpha (we clamp the end result)
+                const Vec4::FloatType currentUnpremultiplied = Vec4::Div(layerValue, opacityV);
+                const Vec4::FloatType operationResult = operation(prevValue, currentUnpremultiplied);
+                // blend layers (re-applying opacity, which is why we needed to use unpremultiplied)
+                return Vec4::Madd(operationResult, opacityV, Vec4::Mul(prevValue, inverseOpacityV));
+            });
+        }
+
+        void BlendLayer(
+            MixedGradientLayer::MixingOperation mixingOperation,
+            AZStd::span<float> inOutValues,
+            AZStd::span<const float> layerValues,
+            float opacity,
+            float inverseOpacity)
+        {
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType two = Vec4::Splat(2.0f);
+            const Vec4::FloatType half = Vec4::Splat(0.5f);
+
+            switch (mixingOperation)
+            {
+            case MixedGradientLayer::MixingOperation::Multiply:
+                BlendLayer(inOutValues, layerValues, opacity, inverseOpacity, [](Vec4::FloatArgType prev, Vec4::FloatArgType current)
+                {
+                    return Vec4::Mul(prev, current);
+                });
+                break;
+            case MixedGradientLayer::MixingOperation::Screen:
+                BlendLayer(inOutValues, layerValues, opacity, inverseOpacity, [&](Vec4::FloatArgType prev, Vec4::FloatArgType current)
+                {
+                    return Vec4::Sub(one, Vec4::Mul(Vec4::Sub(one, prev), Vec4::Sub(one, current)));
+                });
+                break;
+            case MixedGradientLayer::MixingOperation::Add:
+                BlendLayer(inOutValues, layerValues, opacity, inverseOpacity, [](Vec4::FloatArgType prev, Vec4::FloatArgType current)
+                {
+                    return Vec4::Add(prev, current);
+                });
+                break;
+            case MixedGradientLayer::MixingOperation::Subtract:
+                BlendLayer(inOutValues, layerValues, opacity, inverseOpacity, [](Vec4::FloatArgType prev, Vec4::FloatArgType current)
+                {
+                    return Vec4::Sub(prev, current);
+                });
+                break;
+            case MixedGradientLayer::MixingOperation::Min:
+                BlendLayer(inOutValues, layerValues, opacity, inverseOpacity, [](Vec4::FloatArgType prev, Vec4::FloatArgType current)
+                {
+                    return Vec4::Min(prev, current);
+                });
+                break;
+            case MixedGradientLayer::MixingOperation::Max:
+                BlendLayer(inOutValues, layerValues, opacity, inverseOpacity, [](Vec4::FloatArgType prev, Vec4::FloatArgType current)
+                {
+                    return Vec4::Max(prev, current);
+                });
+                break;
+            case MixedGradientLayer::MixingOperation::Average:
+                BlendLayer(inOutValues, layerValues, opacity, inverseOpacity, [&](Vec4::FloatArgType prev, Vec4::FloatArgType current)
+                {
+                    return Vec4::Div(Vec4::Add(prev, current), two);
+                });
+                break;
+            case MixedGradientLayer::MixingOperation::Overlay:
+                BlendLayer(inOutValues, layerValues, opacity, inverseOpacity, [&](Vec4::FloatArgType prev, Vec4::FloatArgType current)
+                {
+                    const Vec4::FloatType screened = Vec4::Sub(one, Vec4::Mul(two, Vec4::Mul(Vec4::Sub(one, prev), Vec4::Sub(one, current))));
+                    const Vec4::FloatType multiplied = Vec4::Mul(two, Vec4::Mul(prev, current));
+                    return Vec4::Select(screened, multiplied, Vec4::CmpGtEq(prev, half));
+                });
+                break;
+            case MixedGradientLayer::MixingOperation::Initialize:
+            case MixedGradientLayer::MixingOperation::Normal:
+            default:
+                BlendLayer(inOutValues, layerValues, opacity, inverseOpacity, [](Vec4::FloatArgType, Vec4::FloatArgType current)
+                {
+                    return current;
+                });
+                break;
+            }
+        }
+    } // namespace
+
     void MixedGradientLayer::Reflect(AZ::ReflectContext* context)
     {
         AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context);
@@ -353,21 +451,16 @@ namespace GradientSignal
                 // this includes leveling and opacity result, we need unpremultiplied opacity to combine properly
                 layer.m_gradientSampler.GetValues(positions, layerValues);
 
-                for (size_t index = 0; index < outValues.size(); index++)
-                {
-                    // unpremultiplied alpha (we clamp the end result)
-                    const float currentUnpremultiplied = layerValues[index] / layer.m_gradientSampler.m_opacity;
-                    const float operationResult = PerformMixingOperation(layer.m_operation, outValues[index], currentUnpremultiplied);
-                    // blend layers (re-applying opacity, which is why we needed to use unpremultiplied)
-                    outValues[index] = (outValues[index] * inverseOpacity) + (operationResult * layer.m_gradientSampler.m_opacity);
-                }
+                BlendLayer(layer.m_operation, outValues, layerValues, layer.m_gradientSampler.m_opacity, inverseOpacity);
             }
         }
 
-        for (auto& outValue : outValues)
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        TransformValues(outValues, [&](Vec4::FloatArgType value)
         {
-            outValue = AZ::GetClamp(outValue, 0.0f, 1.0f);
-        }
+            return Vec4::Clamp(value, zero, one);
+        });
     }
 
 
@@ -15,6 +15,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/array.h>
 #include <LmbrCentral/Dependency/DependencyNotificationBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
 
@@ -215,24 +216,48 @@ namespace GradientSignal
             return;
         }
 
+        // Transform the positions in fixed-size chunks so that the noise for each chunk can be generated in bulk.
+        constexpr size_t ChunkSize = 256;
+        AZStd::array<float, ChunkSize> uvwX;
+        AZStd::array<float, ChunkSize> uvwY;
+        AZStd::array<float, ChunkSize> uvwZ;
+        AZStd::array<bool, ChunkSize> pointRejected;
+
         AZ::Vector3 uvw;
-        bool wasPointRejected = false;
 
         AZStd::shared_lock lock(m_queryMutex);
 
-        for (size_t index = 0; index < positions.size(); index++)
+        for (size_t chunkStart = 0; chunkStart < positions.size(); chunkStart += ChunkSize)
         {
-            m_gradientTransform.TransformPositionToUVW(positions[index], uvw, wasPointRejected);
+            const size_t chunkCount = AZStd::min(ChunkSize, positions.size() - chunkStart);
 
-            if (!wasPointRejected)
+            for (size_t index = 0; index < chunkCount; index++)
             {
-                outValues[index] = m_perlinImprovedNoise->GenerateOctaveNoise(
-                    uvw.GetX(), uvw.GetY(), uvw.GetZ(), m_configuration.m_octave, m_configuration.m_amplitude,
-                    m_configuration.m_frequency);
+                bool wasPointRejected = false;
+                m_gradientTransform.TransformPositionToUVW(positions[chunkStart + index], uvw, wasPointRejected);
+
+                uvwX[index] = uvw.GetX();
+                uvwY[index] = uvw.GetY();
+                uvwZ[index] = uvw.GetZ();
+                pointRejected[index] = wasPointRejected;
             }
-            else
+
+            AZStd::span<float> chunkValues = outValues.subspan(chunkStart, chunkCount);
+            m_perlinImprovedNoise->GenerateOctaveNoiseSet(
+                AZStd::span<const float>(uvwX.data(), chunkCount),
+                AZStd::span<const float>(uvwY.data(), chunkCount),
+                AZStd::span<const float>(uvwZ.data(), chunkCount),
+                chunkValues,
+                m_configuration.m_octave,
+                m_configuration.m_amplitude,
+                m_configuration.m_frequency);
+
+            for (size_t index = 0; index < chunkCount; index++)
             {
-                outValues[index] = 0.0f;
+                if (pointRejected[index])
+                {
+                    chunkValues[index] = 0.0f;
+                }
             }
         }
     }
@@ -197,9 +197,10 @@ namespace GradientSignal
 
         if (!m_configuration.m_surfaceTagList.empty())
         {
-            SurfaceData::SurfacePointList points;
-            AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->GetSurfacePointsFromList(
-                positions, m_configuration.m_surfaceTagList, points);
+            auto* surfaceDataSystem = AZ::Interface<SurfaceData::SurfaceDataSystem>::Get();
+            SurfaceData::SurfacePointListPool::ListPtr pointList = surfaceDataSystem->AcquireSurfacePointList();
+            SurfaceData::SurfacePointList& points = *pointList;
+            surfaceDataSystem->GetSurfacePointsFromList(positions, m_configuration.m_surfaceTagList, points);
 
             // For each position, get the max surface weight that matches our filter and that appears at that position.
             points.EnumeratePoints(
@@ -158,10 +158,15 @@ namespace GradientSignal
         AZStd::shared_lock lock(m_queryMutex);
 
         m_configuration.m_gradientSampler.GetValues(positions, outValues);
-        for (auto& outValue : outValues)
+
+        using AZ::Simd::Vec4;
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType threshold = Vec4::Splat(m_configuration.m_threshold);
+        TransformValues(outValues, [&](Vec4::FloatArgType value)
         {
-            outValue = (outValue <= m_configuration.m_threshold) ? 0.0f : 1.0f;
-        }
+            return Vec4::Select(zero, one, Vec4::CmpLtEq(value, threshold));
+        });
     }
 
     bool ThresholdGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
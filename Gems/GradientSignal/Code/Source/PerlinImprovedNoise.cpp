@@ -8,6 +8,7 @@
 
 
 #include <GradientSignal/PerlinImprovedNoise.h>
+#include <AzCore/Math/SimdMath.h>
 
 #include <numeric>
 #include <random> // std::mt19937 std::random_device
@@ -60,6 +61,86 @@ namespace GradientSignal
         {
             return a + x * (b - a);
         }
+
+        // The Gradient() cases above as {x, y, z} multipliers, so that the gradients of 4 positions can be computed with SIMD instructions.
+        static constexpr float GradientX[16] = { 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, -1.0f, 0.0f };
+        static constexpr float GradientY[16] = { 1.0f, 1.0f, -1.0f, -1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f };
+        static constexpr float GradientZ[16] = { 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f, -1.0f, -1.0f, 0.0f, 1.0f, 0.0f, -1.0f };
+
+        using Vec4 = AZ::Simd::Vec4;
+
+        AZ_FORCE_INLINE Vec4::FloatType Fade(Vec4::FloatArgType t)
+        {
+            return Vec4::Mul(
+                Vec4::Mul(Vec4::Mul(t, t), t),
+                Vec4::Add(Vec4::Mul(t, Vec4::Sub(Vec4::Mul(t, Vec4::Splat(6.0f)), Vec4::Splat(15.0f))), Vec4::Splat(10.0f)));
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Lerp(Vec4::FloatArgType a, Vec4::FloatArgType b, Vec4::FloatArgType x)
+        {
+            return Vec4::Add(a, Vec4::Mul(x, Vec4::Sub(b, a)));
+        }
+
+        // SIMD version of PerlinImprovedNoise::GenerateNoise for 4 positions. The arithmetic matches the scalar version
+        // operation for operation, only the permutation table lookups are done per position.
+        Vec4::FloatType GenerateNoise(const AZStd::array<int, 512>& p, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+        {
+            const Vec4::FloatType floorX = Vec4::Floor(x);
+            const Vec4::FloatType floorY = Vec4::Floor(y);
+            const Vec4::FloatType floorZ = Vec4::Floor(z);
+            const Vec4::FloatType xf = Vec4::Sub(x, floorX);
+            const Vec4::FloatType yf = Vec4::Sub(y, floorY);
+            const Vec4::FloatType zf = Vec4::Sub(z, floorZ);
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType xf1 = Vec4::Sub(xf, one);
+            const Vec4::FloatType yf1 = Vec4::Sub(yf, one);
+            const Vec4::FloatType zf1 = Vec4::Sub(zf, one);
+            const Vec4::FloatType u = Fade(xf);
+            const Vec4::FloatType v = Fade(yf);
+            const Vec4::FloatType w = Fade(zf);
+
+            alignas(16) int32_t fx[4];
+            alignas(16) int32_t fy[4];
+            alignas(16) int32_t fz[4];
+            Vec4::StoreAligned(fx, Vec4::ConvertToInt(floorX));
+            Vec4::StoreAligned(fy, Vec4::ConvertToInt(floorY));
+            Vec4::StoreAligned(fz, Vec4::ConvertToInt(floorZ));
+
+            // Gradient multipliers of the 8 corners of the unit cube around each position, indexed by corner (x + 2y + 4z)
+            // and then by position.
+            alignas(16) float gradX[8][4];
+            alignas(16) float gradY[8][4];
+            alignas(16) float gradZ[8][4];
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                const int xi0 = fx[lane] & 255;
+                const int yi0 = fy[lane] & 255;
+                const int zi0 = fz[lane] & 255;
+                for (int corner = 0; corner < 8; ++corner)
+                {
+                    const int hash = p[p[p[xi0 + (corner & 1)] + yi0 + ((corner >> 1) & 1)] + zi0 + ((corner >> 2) & 1)] & 0xF;
+                    gradX[corner][lane] = GradientX[hash];
+                    gradY[corner][lane] = GradientY[hash];
+                    gradZ[corner][lane] = GradientZ[hash];
+                }
+            }
+
+            auto gradient = [&](int corner, Vec4::FloatArgType gx, Vec4::FloatArgType gy, Vec4::FloatArgType gz)
+            {
+                return Vec4::Add(
+                    Vec4::Add(Vec4::Mul(gx, Vec4::LoadAligned(gradX[corner])), Vec4::Mul(gy, Vec4::LoadAligned(gradY[corner]))),
+                    Vec4::Mul(gz, Vec4::LoadAligned(gradZ[corner])));
+            };
+
+            Vec4::FloatType x1 = Lerp(gradient(0, xf, yf, zf), gradient(1, xf1, yf, zf), u);
+            Vec4::FloatType x2 = Lerp(gradient(2, xf, yf1, zf), gradient(3, xf1, yf1, zf), u);
+            const Vec4::FloatType y1 = Lerp(x1, x2, v);
+            x1 = Lerp(gradient(4, xf, yf, zf1), gradient(5, xf1, yf, zf1), u);
+            x2 = Lerp(gradient(6, xf, yf1, zf1), gradient(7, xf1, yf1, zf1), u);
+            const Vec4::FloatType y2 = Lerp(x1, x2, v);
+
+            return Vec4::Div(Vec4::Add(Lerp(y1, y2, w), one), Vec4::Splat(2.0f));
+        }
     }
 
     PerlinImprovedNoise::PerlinImprovedNoise(int seed)
@@ -92,6 +173,52 @@ namespace GradientSignal
         return total / maxValue;
     }
 
+    void PerlinImprovedNoise::GenerateOctaveNoiseSet(
+        AZStd::span<const float> x, AZStd::span<const float> y, AZStd::span<const float> z, AZStd::span<float> outValues,
+        int octaves, float persistence, float initialFrequency)
+    {
+        using Vec4 = PerlinImprovedNoiseDetails::Vec4;
+
+        AZ_Assert(
+            (x.size() == outValues.size()) && (y.size() == outValues.size()) && (z.size() == outValues.size()),
+            "Input and output spans are different sizes.");
+        const size_t count = AZStd::min(AZStd::min(x.size(), y.size()), AZStd::min(z.size(), outValues.size()));
+
+        size_t index = 0;
+        for (; index + 4 <= count; index += 4)
+        {
+            const Vec4::FloatType posX = Vec4::LoadUnaligned(&x[index]);
+            const Vec4::FloatType posY = Vec4::LoadUnaligned(&y[index]);
+            const Vec4::FloatType posZ = Vec4::LoadUnaligned(&z[index]);
+
+            Vec4::FloatType total = Vec4::ZeroFloat();
+            float frequency = initialFrequency;
+            float amplitude = 1.0f;
+            float maxValue = 0.0f;
+            for (int i = 0; i < octaves; ++i)
+            {
+                const Vec4::FloatType octaveFrequency = Vec4::Splat(frequency);
+                const Vec4::FloatType noise = PerlinImprovedNoiseDetails::GenerateNoise(
+                    m_permutationTable,
+                    Vec4::Mul(posX, octaveFrequency),
+                    Vec4::Mul(posY, octaveFrequency),
+                    Vec4::Mul(posZ, octaveFrequency));
+                total = Vec4::Add(total, Vec4::Mul(noise, Vec4::Splat(amplitude)));
+                maxValue += amplitude;
+                amplitude *= persistence;
+                frequency *= 2.0f;
+            }
+
+            Vec4::StoreUnaligned(
+                &outValues[index], (maxValue <= 0.0f) ? Vec4::ZeroFloat() : Vec4::Div(total, Vec4::Splat(maxValue)));
+        }
+
+        for (; index < count; ++index)
+        {
+            outValues[index] = GenerateOctaveNoise(x[index], y[index], z[index], octaves, persistence, initialFrequency);
+        }
+    }
+
     float PerlinImprovedNoise::GenerateNoise(float x, float y, float z)
     {
         const int fx = (int)std::floor(x);
@@ -8,7 +8,9 @@
 #pragma once
 
 #include <AzCore/EBus/EBus.h>
+#include <AzCore/std/containers/vector.h>
 #include "HttpTypes.h"
+#include "HttpRequestParameters.h"
 
 namespace HttpRequestor
 {
@@ -75,6 +77,13 @@ namespace HttpRequestor
             const AZStd::string& body,
             const TextCallback& callback) = 0;
 
+        //! Make several RESTful calls at once, for example the backend calls needed to set up a match.
+        //! Each request's callback receives its response as JSON. The requests are sent concurrently when http_requestorConnectionCount
+        //! is larger than 1, in which case the callbacks are called in the order the requests complete.
+        //! @param requests The parameters of the requests to make.
+        //! @param callback Called once all the requests have completed and their callbacks have returned.
+        virtual void AddRequestBatch(AZStd::vector<Parameters>&& requests, const BatchCallback& callback) = 0;
+
         //! Receive the round trip time of the last RESTful call made to a HTTP(s) endpoint.
         //! Call this method from inside the supplied callback to get the round trip time of the original request.
         //! @return The round trip time in milliseconds.
@@ -35,4 +35,7 @@ namespace HttpRequestor
     // A map of REST headers.
     using Headers = AZStd::map<AZStd::string, AZStd::string>;
 
+    // A callback function called once every request of a batch has completed, after the callbacks of the requests themselves.
+    using BatchCallback = AZStd::function<void()>;
+
 } // namespace HttpRequestor
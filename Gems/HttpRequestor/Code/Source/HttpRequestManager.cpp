@@ -22,6 +22,7 @@ AZ_PUSH_DISABLE_WARNING(4251 4996, "-Wunknown-warning-option")
 AZ_POP_DISABLE_WARNING
 
 #include <AWSNativeSDKInit/AWSNativeSDKInit.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/string/conversions.h>
 #include "HttpRequestManager.h"
 
@@ -29,7 +30,12 @@ namespace HttpRequestor
 {
     const char* Manager::s_loggingName = "GemHttpRequestManager";
 
-    Manager::Manager()
+    // Set by the worker threads, so a callback asking for the round trip time gets the one of its own request
+    // even when other workers completed requests in the meantime.
+    static thread_local bool s_isWorkerThread = false;
+    static thread_local AZStd::chrono::milliseconds s_workerRoundTripTime{};
+
+    Manager::Manager(AZ::u32 connectionCount)
     {
         AZStd::thread_desc desc;
         desc.m_name = s_loggingName;
@@ -43,23 +49,42 @@ namespace HttpRequestor
         {
             AWSNativeSDKInit::InitializationManager::InitAwsApi();
         }
+
+        // One client for all requests, it pools a connection per worker and keeps them alive between requests
+        // so consecutive calls to the same endpoint skip the TCP and TLS handshakes.
+        connectionCount = AZStd::max(connectionCount, 1u);
+        Aws::Client::ClientConfiguration config;
+        config.enableTcpKeepAlive = AZ_TRAIT_AZFRAMEWORK_AWS_ENABLE_TCP_KEEP_ALIVE_SUPPORTED;
+        config.maxConnections = connectionCount;
+        m_httpClient = Aws::Http::CreateHttpClient(config);
+
         auto function = [this]
         {
             ThreadFunction();
         };
-        m_thread = AZStd::thread(desc, function);
+        m_threads.reserve(connectionCount);
+        for (AZ::u32 threadIndex = 0; threadIndex < connectionCount; ++threadIndex)
+        {
+            m_threads.emplace_back(desc, function);
+        }
     }
 
     Manager::~Manager()
     {
         m_runThread = false;
         m_requestConditionVar.notify_all();
-        if (m_thread.joinable())
+        for (AZStd::thread& thread : m_threads)
         {
-            m_thread.join();
+            if (thread.joinable())
+            {
+                thread.join();
+            }
         }
 
-        // Shutdown after background thread has closed.
+        // The client has to be destroyed before the native SDK is shut down.
+        m_httpClient.reset();
+
+        // Shutdown after background threads have closed.
         if (m_ownsAwsNativeInitialization)
         {
             AWSNativeSDKInit::InitializationManager::Shutdown();
@@ -70,35 +95,65 @@ namespace HttpRequestor
     {
         {
             AZStd::lock_guard<AZStd::mutex> lock(m_requestMutex);
-            m_requestsToHandle.push(AZStd::move(httpRequestParameters));
+            m_requestsToHandle.push({ AZStd::move(httpRequestParameters), nullptr });
         }
-        m_requestConditionVar.notify_all();
+        m_requestConditionVar.notify_one();
     }
 
     void Manager::AddTextRequest(TextParameters&& httpTextRequestParameters)
     {
         {
             AZStd::lock_guard<AZStd::mutex> lock(m_requestMutex);
-            m_textRequestsToHandle.push(AZStd::move(httpTextRequestParameters));
+            m_requestsToHandle.push({ AZStd::move(httpTextRequestParameters), nullptr });
+        }
+        m_requestConditionVar.notify_one();
+    }
+
+    void Manager::AddRequestBatch(AZStd::vector<Parameters>&& httpRequestParameters, const BatchCallback& callback)
+    {
+        if (httpRequestParameters.empty())
+        {
+            if (callback)
+            {
+                callback();
+            }
+            return;
+        }
+
+        auto batch = AZStd::make_shared<BatchState>();
+        batch->m_remainingRequests = httpRequestParameters.size();
+        batch->m_callback = callback;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_requestMutex);
+            for (Parameters& parameters : httpRequestParameters)
+            {
+                m_requestsToHandle.push({ AZStd::move(parameters), batch });
+            }
         }
         m_requestConditionVar.notify_all();
     }
 
     AZStd::chrono::milliseconds Manager::GetLastRoundTripTime() const
     {
+        if (s_isWorkerThread)
+        {
+            return s_workerRoundTripTime;
+        }
         return m_lastRoundTripTime.load(AZStd::memory_order_relaxed);
     }
 
     void Manager::ThreadFunction()
     {
+        s_isWorkerThread = true;
+
         // Run the thread as long as directed
         while (m_runThread)
         {
-            HandleRequestBatch();
+            HandleNextRequest();
         }
     }
 
-    void Manager::HandleRequestBatch()
+    void Manager::HandleNextRequest()
     {
         // Lock mutex and wait for work to be signaled via the condition variable
         AZStd::unique_lock<AZStd::mutex> lock(m_requestMutex);
@@ -106,39 +161,36 @@ namespace HttpRequestor
             lock,
             [&]
             {
-                return !m_runThread || !m_requestsToHandle.empty() || !m_textRequestsToHandle.empty();
+                return !m_runThread || !m_requestsToHandle.empty();
             });
 
-        // Swap queues
-        AZStd::queue<Parameters> requestsToHandle;
-        requestsToHandle.swap(m_requestsToHandle);
-
-        AZStd::queue<TextParameters> textRequestsToHandle;
-        textRequestsToHandle.swap(m_textRequestsToHandle);
+        if (m_requestsToHandle.empty())
+        {
+            return;
+        }
 
-        // Release lock
+        // Take a single request so the other workers can pick up the next ones while this one is in flight
+        QueuedRequest request = AZStd::move(m_requestsToHandle.front());
+        m_requestsToHandle.pop();
         lock.unlock();
 
-        // Handle requests
-        while (!requestsToHandle.empty())
+        if (const Parameters* parameters = AZStd::get_if<Parameters>(&request.m_parameters))
         {
-            HandleRequest(requestsToHandle.front());
-            requestsToHandle.pop();
+            HandleRequest(*parameters);
+        }
+        else
+        {
+            HandleTextRequest(AZStd::get<TextParameters>(request.m_parameters));
         }
 
-        while (!textRequestsToHandle.empty())
+        if (request.m_batch && --request.m_batch->m_remainingRequests == 0 && request.m_batch->m_callback)
         {
-            HandleTextRequest(textRequestsToHandle.front());
-            textRequestsToHandle.pop();
+            request.m_batch->m_callback();
         }
     }
 
     void Manager::HandleRequest(const Parameters& httpRequestParameters)
     {
-        Aws::Client::ClientConfiguration config;
-        config.enableTcpKeepAlive = AZ_TRAIT_AZFRAMEWORK_AWS_ENABLE_TCP_KEEP_ALIVE_SUPPORTED;
-        std::shared_ptr<Aws::Http::HttpClient> httpClient = Aws::Http::CreateHttpClient(config);
-
         auto httpRequest = Aws::Http::CreateHttpRequest(
             httpRequestParameters.GetURI(), httpRequestParameters.GetMethod(), Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
 
@@ -156,10 +208,9 @@ namespace HttpRequestor
         }
 
         AZStd::chrono::steady_clock::time_point start = AZStd::chrono::steady_clock::now();
-        const auto httpResponse = httpClient->MakeRequest(httpRequest);
-        m_lastRoundTripTime.store(
-            AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(AZStd::chrono::steady_clock::now() - start),
-            AZStd::memory_order_relaxed);
+        const auto httpResponse = m_httpClient->MakeRequest(httpRequest);
+        s_workerRoundTripTime = AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(AZStd::chrono::steady_clock::now() - start);
+        m_lastRoundTripTime.store(s_workerRoundTripTime, AZStd::memory_order_relaxed);
 
         if (!httpResponse)
         {
@@ -186,10 +237,6 @@ namespace HttpRequestor
 
     void Manager::HandleTextRequest(const TextParameters& httpRequestParameters)
     {
-        Aws::Client::ClientConfiguration config;
-        config.enableTcpKeepAlive = AZ_TRAIT_AZFRAMEWORK_AWS_ENABLE_TCP_KEEP_ALIVE_SUPPORTED;
-        std::shared_ptr<Aws::Http::HttpClient> httpClient = Aws::Http::CreateHttpClient(config);
-
         auto httpRequest = Aws::Http::CreateHttpRequest(
             httpRequestParameters.GetURI(), httpRequestParameters.GetMethod(), Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
 
@@ -204,10 +251,9 @@ namespace HttpRequestor
         }
 
         AZStd::chrono::steady_clock::time_point start = AZStd::chrono::steady_clock::now();
-        const auto httpResponse = httpClient->MakeRequest(httpRequest);
-        m_lastRoundTripTime.store(
-            AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(AZStd::chrono::steady_clock::now() - start),
-            AZStd::memory_order_relaxed);
+        const auto httpResponse = m_httpClient->MakeRequest(httpRequest);
+        s_workerRoundTripTime = AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(AZStd::chrono::steady_clock::now() - start);
+        m_lastRoundTripTime.store(s_workerRoundTripTime, AZStd::memory_order_relaxed);
 
         if (!httpResponse)
         {
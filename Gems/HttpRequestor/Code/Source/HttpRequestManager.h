@@ -9,6 +9,8 @@
 #pragma once
 
 #include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/variant.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
@@ -18,29 +20,59 @@
 #include <HttpRequestor/HttpRequestParameters.h>
 #include <HttpRequestor/HttpTextRequestParameters.h>
 
+AZ_PUSH_DISABLE_WARNING(4251 4996, "-Wunknown-warning-option")
+#include <aws/core/http/HttpClient.h>
+AZ_POP_DISABLE_WARNING
+
 namespace HttpRequestor
 {
+    // Sends the queued requests on a pool of worker threads that share one HTTP client, so connections to an endpoint
+    // are kept alive and reused instead of being opened for every request. JSON and TEXT requests share one queue.
+    // With the default single connection, requests are sent one at a time and complete in the order they were queued in.
+    // Concurrency is opt-in: with more than one connection, requests are sent concurrently and may complete in a
+    // different order than they were queued in.
     class Manager
     {
     public:
-        Manager();
+        static constexpr AZ::u32 DefaultConnectionCount = 1;
+
+        // @param connectionCount The number of requests that can be in flight at once, each has its own worker thread and connection
+        explicit Manager(AZ::u32 connectionCount = DefaultConnectionCount);
         virtual ~Manager();
 
-        // Add these parameters to a queue of request parameters to send off as an HTTP request as soon as they reach the head of the queue
+        // Add these parameters to the queue of request parameters to send off as an HTTP request as soon as they reach the head of the queue
         void AddRequest(Parameters && httpRequestParameters);
 
-        // Add these parameters to a queue of request parameters to send off as an HTTP TEXT request as soon as they reach the head of the queue
+        // Add these parameters to the queue of request parameters to send off as an HTTP TEXT request as soon as they reach the head of the queue
         void AddTextRequest(TextParameters && httpTextRequestParameters);
 
+        // Queue all the requests at once, the callback is called once every request has completed and its callback has returned.
+        // The callback is called on the calling thread if there are no requests.
+        void AddRequestBatch(AZStd::vector<Parameters>&& httpRequestParameters, const BatchCallback& callback);
+
         // The last round trip time taken to make the http request and get a response.
+        // When called from a request's callback this is the round trip time of that request.
         AZStd::chrono::milliseconds GetLastRoundTripTime() const;
 
     private:
-        // RequestManager thread loop.
+        // The requests of a batch share this to tell when the last of them has completed
+        struct BatchState
+        {
+            AZStd::atomic<size_t> m_remainingRequests;
+            BatchCallback m_callback;
+        };
+
+        struct QueuedRequest
+        {
+            AZStd::variant<Parameters, TextParameters> m_parameters;
+            AZStd::shared_ptr<BatchState> m_batch; // Only set for requests added by AddRequestBatch
+        };
+
+        // Worker thread loop.
         void ThreadFunction();
 
-        // Called by ThreadFunction. Waits for timeout or until notified and processes any requests queued up.
-        void HandleRequestBatch();
+        // Called by ThreadFunction. Waits until notified and processes the request at the head of the queue.
+        void HandleNextRequest();
 
         // Perform an HTTP request, block until a response is received, then give the returned JSON to the callback to parse. Returns the HTTPResponseCode to the callback to handle any errors.
         void HandleRequest(const Parameters & httpRequestParameters);
@@ -49,12 +81,12 @@ namespace HttpRequestor
         void HandleTextRequest(const TextParameters & httpTextRequestParameters);
 
     private:
-        AZStd::queue<Parameters>                m_requestsToHandle;                 // Queue of requests that will be made in order of time received
-        AZStd::queue<TextParameters>            m_textRequestsToHandle;             // Queue of requests for TEXT blobs that will be made in order of time received
+        AZStd::queue<QueuedRequest>             m_requestsToHandle;                 // Queue of JSON and TEXT requests that will be made in order of time received
         AZStd::mutex                            m_requestMutex;                     // Member variables for synchronization
         AZStd::condition_variable               m_requestConditionVar;
-        AZStd::atomic<bool>                     m_runThread;                        // Run flag used to signal the worker thread
-        AZStd::thread                           m_thread;                           // This is the thread that will be used for all async operations
+        AZStd::atomic<bool>                     m_runThread;                        // Run flag used to signal the worker threads
+        AZStd::vector<AZStd::thread>            m_threads;                          // The worker threads that make the requests, one per connection
+        std::shared_ptr<Aws::Http::HttpClient>  m_httpClient;                       // Shared by the worker threads, it keeps a pool of connections to reuse
         static const char*                      s_loggingName;                      // Name to use for log messages etc...
         bool                                    m_ownsAwsNativeInitialization = false; // Whether or not this module initialized the native layer
         AZStd::atomic<AZStd::chrono::milliseconds> m_lastRoundTripTime; // The last round trip time taken to make the http request and get a response.
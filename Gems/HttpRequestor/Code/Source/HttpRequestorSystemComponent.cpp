@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 
@@ -13,6 +14,11 @@
 
 namespace HttpRequestor
 {
+    AZ_CVAR(uint32_t, http_requestorConnectionCount, Manager::DefaultConnectionCount, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The number of HTTP requests the HttpRequestor sends concurrently, each over its own kept-alive connection."
+        " With more than one connection, requests may complete in a different order than they were made in."
+        " Applied when the HttpRequestor system component is activated.");
+
     void HttpRequestorSystemComponent::AddRequest(const AZStd::string& URI, Aws::Http::HttpMethod method, const Callback& callback)
     {
         if(m_httpManager != nullptr)
@@ -61,6 +67,14 @@ namespace HttpRequestor
         }
     }
 
+    void HttpRequestorSystemComponent::AddRequestBatch(AZStd::vector<Parameters>&& requests, const BatchCallback& callback)
+    {
+        if (m_httpManager != nullptr)
+        {
+            m_httpManager->AddRequestBatch(AZStd::move(requests), callback);
+        }
+    }
+
     AZStd::chrono::milliseconds HttpRequestorSystemComponent::GetLastRoundTripTime() const
     {
         if (m_httpManager != nullptr)
@@ -113,7 +127,7 @@ namespace HttpRequestor
 
     void HttpRequestorSystemComponent::Activate()
     {
-        m_httpManager = AZStd::make_shared<Manager>();
+        m_httpManager = AZStd::make_shared<Manager>(static_cast<AZ::u32>(http_requestorConnectionCount));
         
         HttpRequestorRequestBus::Handler::BusConnect();
     }
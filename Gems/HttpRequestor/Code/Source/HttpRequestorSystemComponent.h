@@ -40,6 +40,8 @@ namespace HttpRequestor
         void AddTextRequestWithHeaders(const AZStd::string& URI, Aws::Http::HttpMethod method, const Headers & headers, const TextCallback& callback) override;
         void AddTextRequestWithHeadersAndBody(const AZStd::string& URI, Aws::Http::HttpMethod method, const Headers & headers, const AZStd::string& body, const TextCallback& callback) override;
 
+        void AddRequestBatch(AZStd::vector<Parameters>&& requests, const BatchCallback& callback) override;
+
         AZStd::chrono::milliseconds GetLastRoundTripTime() const override;
 
         ////////////////////////////////////////////////////////////////////////
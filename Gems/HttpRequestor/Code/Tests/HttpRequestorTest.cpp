@@ -52,4 +52,113 @@ TEST_F(HttpTest, HttpRequesterTest)
     EXPECT_NE(Aws::Http::HttpResponseCode::REQUEST_NOT_MADE, resultCode);
 }
 
+TEST_F(HttpTest, AddRequestBatch_NoRequests_CallsBatchCallbackImmediately)
+{
+    HttpRequestor::Manager httpRequestManager(2);
+
+    bool batchCompleted = false;
+    httpRequestManager.AddRequestBatch({}, [&batchCompleted]()
+        {
+            batchCompleted = true;
+        });
+
+    EXPECT_TRUE(batchCompleted);
+}
+
+// Nothing listens on this port, so requests fail quickly without needing a network connection.
+static constexpr const char* UnreachableURI = "http://127.0.0.1:1/";
+
+TEST_F(HttpTest, AddRequest_SingleConnection_CallbacksAreCalledInQueueOrder)
+{
+    constexpr int RequestCount = 8;
+
+    AZStd::mutex completionMutex;
+    AZStd::condition_variable completionConditionVar;
+    AZStd::vector<int> completionOrder;
+    auto onCompleted = [&](int requestIndex)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(completionMutex);
+        completionOrder.push_back(requestIndex);
+        completionConditionVar.notify_all();
+    };
+
+    // Declared after the state its callbacks use, so its worker threads are joined before that state is destroyed.
+    HttpRequestor::Manager httpRequestManager(1);
+
+    // Alternate JSON and TEXT requests, which used to be kept in separate queues.
+    for (int requestIndex = 0; requestIndex < RequestCount; ++requestIndex)
+    {
+        if (requestIndex % 2 == 0)
+        {
+            httpRequestManager.AddRequest(HttpRequestor::Parameters(
+                UnreachableURI, Aws::Http::HttpMethod::HTTP_GET,
+                [&onCompleted, requestIndex](const Aws::Utils::Json::JsonView&, Aws::Http::HttpResponseCode)
+                {
+                    onCompleted(requestIndex);
+                }));
+        }
+        else
+        {
+            httpRequestManager.AddTextRequest(HttpRequestor::TextParameters(
+                UnreachableURI, Aws::Http::HttpMethod::HTTP_GET,
+                [&onCompleted, requestIndex](const AZStd::string&, Aws::Http::HttpResponseCode)
+                {
+                    onCompleted(requestIndex);
+                }));
+        }
+    }
+
+    AZStd::unique_lock<AZStd::mutex> lock(completionMutex);
+    completionConditionVar.wait_for(lock, AZStd::chrono::seconds(30), [&completionOrder]()
+        {
+            return completionOrder.size() == RequestCount;
+        });
+
+    ASSERT_EQ(RequestCount, completionOrder.size());
+    for (int requestIndex = 0; requestIndex < RequestCount; ++requestIndex)
+    {
+        EXPECT_EQ(requestIndex, completionOrder[requestIndex]);
+    }
+}
+
+TEST_F(HttpTest, AddRequest_MultipleConnections_RequestsAreHandledConcurrently)
+{
+    constexpr int ConnectionCount = 2;
+
+    // Each callback waits until the callbacks of all requests are running at the same time, which can only happen
+    // if every connection has a request in flight.
+    AZStd::mutex callbackMutex;
+    AZStd::condition_variable callbackConditionVar;
+    int runningCallbacks = 0;
+    int completedCallbacks = 0;
+    bool allRanConcurrently = true;
+    HttpRequestor::Manager httpRequestManager(ConnectionCount);
+    for (int requestIndex = 0; requestIndex < ConnectionCount; ++requestIndex)
+    {
+        httpRequestManager.AddTextRequest(HttpRequestor::TextParameters(
+            UnreachableURI, Aws::Http::HttpMethod::HTTP_GET,
+            [&](const AZStd::string&, Aws::Http::HttpResponseCode)
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(callbackMutex);
+                ++runningCallbacks;
+                callbackConditionVar.notify_all();
+                allRanConcurrently &= callbackConditionVar.wait_for(lock, AZStd::chrono::seconds(30), [&runningCallbacks]()
+                    {
+                        return runningCallbacks == ConnectionCount;
+                    });
+                ++completedCallbacks;
+                callbackConditionVar.notify_all();
+            }));
+    }
+
+    AZStd::unique_lock<AZStd::mutex> lock(callbackMutex);
+    callbackConditionVar.wait_for(lock, AZStd::chrono::seconds(60), [&completedCallbacks]()
+        {
+            return completedCallbacks == ConnectionCount;
+        });
+
+    EXPECT_EQ(ConnectionCount, completedCallbacks);
+    EXPECT_TRUE(allRanConcurrently);
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
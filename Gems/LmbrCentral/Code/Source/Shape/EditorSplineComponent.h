@@ -64,6 +64,7 @@ namespace LmbrCentral
             const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) override;
         bool SupportsEditorRayIntersect() override;
         bool SupportsEditorRayIntersectViewport(const AzFramework::ViewportInfo& viewportInfo) override;
+        bool EditorSelectionBoundsDependOnCamera() override { return true; }
 
         // EditorComponentSelectionNotificationsBus overrides ...
         void OnAccentTypeChanged(AzToolsFramework::EntityAccentType accent) override { m_accentType = accent; }
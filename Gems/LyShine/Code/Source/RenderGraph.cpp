@@ -149,14 +149,17 @@ namespace LyShine
 
         drawSrg->Compile();
 
-        // Add the indexed primitives to the dynamic draw context for drawing
-        //
-        // [LYSHINE_ATOM_TODO][ATOM-15073] Combine into a single DrawIndexed call to take advantage of the draw call
-        // optimization done by this RenderGraph. This option will be added to DynamicDrawContext. For
-        // now we could combine the vertices ourselves
-        for (const LyShine::UiPrimitive& primitive : m_primitives)
+        // Add the combined primitives to the dynamic draw context with a single draw call. The primitives of a node
+        // don't change until the graph is rebuilt, so they are only combined the first time the node is rendered.
+        if (m_combinedIndices.empty())
+        {
+            CombinePrimitives();
+        }
+
+        if (!m_combinedIndices.empty())
         {
-            dynamicDraw->DrawIndexed(primitive.m_vertices, primitive.m_numVertices, primitive.m_indices, primitive.m_numIndices, AZ::RHI::IndexFormat::Uint16, drawSrg);
+            dynamicDraw->DrawIndexed(m_combinedVertices.data(), static_cast<uint32_t>(m_combinedVertices.size()),
+                m_combinedIndices.data(), static_cast<uint32_t>(m_combinedIndices.size()), AZ::RHI::IndexFormat::Uint16, drawSrg);
         }
 
         uiRenderer->SetBaseState(prevBaseState);
@@ -173,6 +176,26 @@ namespace LyShine
         m_totalNumIndices += primitive->m_numIndices;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void PrimitiveListRenderNode::CombinePrimitives()
+    {
+        m_combinedVertices.clear();
+        m_combinedIndices.clear();
+        m_combinedVertices.reserve(m_totalNumVertices);
+        m_combinedIndices.reserve(m_totalNumIndices);
+
+        // HasSpaceToAddPrimitive guarantees that the offset indices still fit in 16 bits
+        for (const LyShine::UiPrimitive& primitive : m_primitives)
+        {
+            const uint16 vertexOffset = static_cast<uint16>(m_combinedVertices.size());
+            m_combinedVertices.insert(m_combinedVertices.end(), primitive.m_vertices, primitive.m_vertices + primitive.m_numVertices);
+            for (int i = 0; i < primitive.m_numIndices; ++i)
+            {
+                m_combinedIndices.push_back(static_cast<uint16>(primitive.m_indices[i] + vertexOffset));
+            }
+        }
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     LyShine::UiPrimitiveList& PrimitiveListRenderNode::GetPrimitives() const
     {
@@ -13,6 +13,7 @@
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/Math/Color.h>
 
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
@@ -103,6 +104,10 @@ namespace LyShine
 
         bool HasSpaceToAddPrimitive(LyShine::UiPrimitive* primitive) const;
 
+        //! Copy the vertices and indices of all primitives into one vertex and index buffer, so the node is drawn
+        //! with a single draw call. This is done once after the graph is built and reused until the graph is reset.
+        void CombinePrimitives();
+
         // Search to see if this texture is already used by this texture unit, returns -1 if not used
         int FindTexture(const AZ::Data::Instance<AZ::RPI::Image>& texture, bool isClampTextureMode) const;
 
@@ -132,6 +137,9 @@ namespace LyShine
         int             m_totalNumIndices;
 
         LyShine::UiPrimitiveList   m_primitives;
+
+        AZStd::vector<LyShine::UiPrimitiveVertex> m_combinedVertices;
+        AZStd::vector<uint16> m_combinedIndices;
     };
 
     // A mask render node handles using one set of render nodes to mask another set of render nodes
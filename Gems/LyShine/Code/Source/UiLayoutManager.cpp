@@ -75,11 +75,15 @@ void UiLayoutManager::MarkToRecomputeLayoutsAffectedByLayoutCellChange(AZ::Entit
 void UiLayoutManager::UnmarkAllLayouts()
 {
     m_elementsToRecomputeLayout.clear();
+    m_markedElements.clear();
+    m_mayContainMarkedDescendants = false;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiLayoutManager::RecomputeMarkedLayouts()
 {
+    RemoveMarkedDescendants();
+
     for (auto element : m_elementsToRecomputeLayout)
     {
         ComputeLayoutForElementAndDescendants(element);
@@ -120,58 +124,30 @@ void UiLayoutManager::ComputeLayoutForElementAndDescendants(AZ::EntityId entityI
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiLayoutManager::AddToRecomputeLayoutList(AZ::EntityId entityId)
 {
-    // Check if element is already in the list
-    auto iter = AZStd::find(m_elementsToRecomputeLayout.begin(), m_elementsToRecomputeLayout.end(), entityId);
-    if (iter == m_elementsToRecomputeLayout.end())
+    // Check if element or one of its ancestors is already in the list. Only the chain of parents is visited,
+    // which keeps marking cheap when many elements in a large hierarchy change in the same frame
+    if (m_markedElements.find(entityId) != m_markedElements.end() || HasMarkedAncestor(entityId))
     {
-        // Check if element's parent is already in the list
-        for (iter = m_elementsToRecomputeLayout.begin(); iter != m_elementsToRecomputeLayout.end(); ++iter)
-        {
-            if (IsParentOfElement(*iter, entityId))
-            {
-                // Don't need to add this element
-                return;
-            }
-        }
-
-        // Remove element's children from the list
-        LyShine::EntityArray descendants;
-        UiElementBus::Event(
-            entityId,
-            &UiElementBus::Events::FindDescendantElements,
-            []([[maybe_unused]] const AZ::Entity* entity)
-            {
-                return true;
-            },
-            descendants);
+        // Don't need to add this element
+        return;
+    }
 
-        m_elementsToRecomputeLayout.remove_if(
-            [descendants](const AZ::EntityId& e)
-            {
-                for (auto descendant : descendants)
-                {
-                    if (descendant->GetId() == e)
-                    {
-                        return true;
-                    }
-                }
-                return false;
-            }
-            );
+    // Descendants of the element that are already in the list are removed once, before the layouts are recomputed
+    m_mayContainMarkedDescendants |= !m_elementsToRecomputeLayout.empty();
 
-        // Add element to list
-        m_elementsToRecomputeLayout.push_back(entityId);
-    }
+    // Add element to list
+    m_elementsToRecomputeLayout.push_back(entityId);
+    m_markedElements.insert(entityId);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-bool UiLayoutManager::IsParentOfElement(AZ::EntityId checkParentEntity, AZ::EntityId checkChildEntity)
+bool UiLayoutManager::HasMarkedAncestor(AZ::EntityId entityId)
 {
     AZ::EntityId parent;
-    UiElementBus::EventResult(parent, checkChildEntity, &UiElementBus::Events::GetParentEntityId);
+    UiElementBus::EventResult(parent, entityId, &UiElementBus::Events::GetParentEntityId);
     while (parent.IsValid())
     {
-        if (parent == checkParentEntity)
+        if (m_markedElements.find(parent) != m_markedElements.end())
         {
             return true;
         }
@@ -184,3 +160,28 @@ bool UiLayoutManager::IsParentOfElement(AZ::EntityId checkParentEntity, AZ::Enti
     return false;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiLayoutManager::RemoveMarkedDescendants()
+{
+    if (!m_mayContainMarkedDescendants)
+    {
+        return;
+    }
+
+    // Elements are recomputed along with their marked ancestor. The ancestor stays in the set, so removing an element
+    // from the set doesn't affect the check of the other elements
+    m_elementsToRecomputeLayout.remove_if(
+        [this](const AZ::EntityId& e)
+        {
+            if (HasMarkedAncestor(e))
+            {
+                m_markedElements.erase(e);
+                return true;
+            }
+            return false;
+        }
+        );
+
+    m_mayContainMarkedDescendants = false;
+}
+
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <LyShine/Bus/UiLayoutManagerBus.h>
+#include <AzCore/std/containers/unordered_set.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class UiLayoutManager
@@ -33,10 +34,18 @@ private: // member functions
     AZ_DISABLE_COPY_MOVE(UiLayoutManager);
 
     void AddToRecomputeLayoutList(AZ::EntityId entityId);
-    bool IsParentOfElement(AZ::EntityId checkParentEntity, AZ::EntityId checkChildEntity);
+    bool HasMarkedAncestor(AZ::EntityId entityId);
+    void RemoveMarkedDescendants();
 
 private: // data
 
-    //! Elements that need to recompute their layouts. Parents should be ahead of their children
+    //! Elements that need to recompute their layouts. Elements marked after one of their descendants was marked
+    //! leave the descendant in the list until RemoveMarkedDescendants
     AZStd::list<AZ::EntityId> m_elementsToRecomputeLayout;
+
+    //! The same elements as m_elementsToRecomputeLayout, for fast lookups when marking an element
+    AZStd::unordered_set<AZ::EntityId> m_markedElements;
+
+    //! Whether an element was added while others were marked, so the list may hold descendants of marked elements
+    bool m_mayContainMarkedDescendants = false;
 };
@@ -4076,16 +4076,13 @@ void UiTextComponent::RenderDrawBatchLines(
                 uint32 numQuads = drawBatch.font->GetNumQuadsForText(drawBatch.text.c_str(), true, fontContext);
                 if (numQuads > 0)
                 {
-                    RenderCacheBatch* cacheBatch = new RenderCacheBatch;
+                    RenderCacheBatch* cacheBatch = AcquireRenderCacheBatch(numQuads);
                     cacheBatch->m_position = alignedPosition;
                     cacheBatch->m_position.SetY(cacheBatch->m_position.GetY() + drawBatch.yOffset);
                     cacheBatch->m_text = drawBatch.text;
                     cacheBatch->m_font = drawBatch.font;
                     cacheBatch->m_color = batchColor;
 
-                    cacheBatch->m_cachedPrimitive.m_vertices = new LyShine::UiPrimitiveVertex[numQuads * 4];
-                    cacheBatch->m_cachedPrimitive.m_indices = new uint16[numQuads * 6];
-
                     AZStd::vector<SVF_P2F_C4B_T2F_F4B> vertices(numQuads * 4);
                     uint32 numQuadsWritten = cacheBatch->m_font->WriteTextQuadsToBuffers(
                         vertices.data(), cacheBatch->m_cachedPrimitive.m_indices, numQuads,
@@ -4095,7 +4092,7 @@ void UiTextComponent::RenderDrawBatchLines(
 
                     if (numQuadsWritten == 0)
                     {
-                        delete cacheBatch;
+                        m_renderCache.m_freeBatches.push_back(cacheBatch);
                         continue;
                     }
 
@@ -4200,19 +4197,18 @@ void UiTextComponent::UpdateTextRenderBatchesForFontTextureChange()
     {
         if (cacheBatch->m_fontTextureVersion != cacheBatch->m_font->GetFontTextureVersion())
         {
-            uint32 numExistingQuads = cacheBatch->m_cachedPrimitive.m_numVertices / 4;
-
             fontContext.m_colorOverride = cacheBatch->m_color;
 
             uint32 numQuads = cacheBatch->m_font->GetNumQuadsForText(cacheBatch->m_text.c_str(), true, fontContext);
 
-            if (numExistingQuads < numQuads)
+            if (cacheBatch->m_numAllocatedQuads < numQuads)
             {
                 delete [] cacheBatch->m_cachedPrimitive.m_vertices;
                 delete [] cacheBatch->m_cachedPrimitive.m_indices;
 
                 cacheBatch->m_cachedPrimitive.m_vertices = new LyShine::UiPrimitiveVertex[numQuads * 4];
                 cacheBatch->m_cachedPrimitive.m_indices = new uint16[numQuads * 6];
+                cacheBatch->m_numAllocatedQuads = numQuads;
             }
 
             AZStd::vector<SVF_P2F_C4B_T2F_F4B> vertices(numQuads * 4);
@@ -5193,28 +5189,68 @@ void UiTextComponent::ClearRenderCache()
 
     // As mentioned above it is ONLY valid to clear this and delete the image batches when the render graph
     // has been cleared. Otherwise the graph intrusive lists will have pointers to deleted structures.
-    FreeRenderCacheMemory();
+    RecycleRenderCacheMemory();
 
     m_renderCache.m_isDirty = true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiTextComponent::FreeRenderCacheMemory()
+{
+    RecycleRenderCacheMemory();
+
+    for (RenderCacheBatch* textBatch : m_renderCache.m_freeBatches)
+    {
+        delete [] textBatch->m_cachedPrimitive.m_vertices;
+        delete [] textBatch->m_cachedPrimitive.m_indices;
+        delete textBatch;
+    }
+    m_renderCache.m_freeBatches.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiTextComponent::RecycleRenderCacheMemory()
 {
     for (RenderCacheImageBatch* imageBatch : m_renderCache.m_imageBatches)
     {
         delete [] imageBatch->m_cachedPrimitive.m_vertices;
         delete imageBatch;
     }
-    for (RenderCacheBatch* textBatch : m_renderCache.m_batches)
+    m_renderCache.m_imageBatches.clear();
+
+    // Text batches keep their buffers, so text that changes often (like a timer) doesn't reallocate them
+    // each time the cache is regenerated
+    m_renderCache.m_freeBatches.insert(m_renderCache.m_freeBatches.end(), m_renderCache.m_batches.begin(), m_renderCache.m_batches.end());
+    m_renderCache.m_batches.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UiTextComponent::RenderCacheBatch* UiTextComponent::AcquireRenderCacheBatch(uint32 numQuads)
+{
+    RenderCacheBatch* cacheBatch = nullptr;
+    if (m_renderCache.m_freeBatches.empty())
+    {
+        cacheBatch = new RenderCacheBatch;
+        cacheBatch->m_cachedPrimitive.m_vertices = nullptr;
+        cacheBatch->m_cachedPrimitive.m_indices = nullptr;
+    }
+    else
     {
-        delete [] textBatch->m_cachedPrimitive.m_vertices;
-        delete [] textBatch->m_cachedPrimitive.m_indices;
-        delete textBatch;
+        cacheBatch = m_renderCache.m_freeBatches.back();
+        m_renderCache.m_freeBatches.pop_back();
     }
 
-    m_renderCache.m_batches.clear();
-    m_renderCache.m_imageBatches.clear();
+    if (cacheBatch->m_numAllocatedQuads < numQuads)
+    {
+        delete [] cacheBatch->m_cachedPrimitive.m_vertices;
+        delete [] cacheBatch->m_cachedPrimitive.m_indices;
+
+        cacheBatch->m_cachedPrimitive.m_vertices = new LyShine::UiPrimitiveVertex[numQuads * 4];
+        cacheBatch->m_cachedPrimitive.m_indices = new uint16[numQuads * 6];
+        cacheBatch->m_numAllocatedQuads = numQuads;
+    }
+
+    return cacheBatch;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
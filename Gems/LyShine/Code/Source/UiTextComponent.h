@@ -569,6 +569,8 @@ private: // static member functions
 
 private: // member functions
 
+    struct RenderCacheBatch;
+
     //! Given an index into the displayed string, returns the line number that the character is displayed on.
     int GetLineNumberFromCharIndex(const DrawBatchLines& drawBatchLines, const int soughtIndex) const;
 
@@ -590,6 +592,12 @@ private: // member functions
     //! Clear the render cache memory allocations
     void FreeRenderCacheMemory();
 
+    //! Empty the render cache but keep the text batches and their buffers to reuse when the cache is regenerated
+    void RecycleRenderCacheMemory();
+
+    //! Get a text batch with buffers for at least the given number of quads, reusing a recycled batch if there is one
+    RenderCacheBatch* AcquireRenderCacheBatch(uint32 numQuads);
+
     //! Checks if clipping is enabled for handling overflow, or if specific conditions are met when using ellipsis.
     //!
     //! When ellipsis overflow handling is enabled, content will become clipped when the text
@@ -608,6 +616,7 @@ private: // types
         ColorB              m_color;
         IFFont*             m_font;
         uint32              m_fontTextureVersion;
+        uint32              m_numAllocatedQuads = 0;
         LyShine::UiPrimitive      m_cachedPrimitive;
     };
 
@@ -623,6 +632,7 @@ private: // types
         STextDrawContext                        m_fontContext;
         AZStd::vector<RenderCacheBatch*>        m_batches;
         AZStd::vector<RenderCacheImageBatch*>   m_imageBatches;
+        AZStd::vector<RenderCacheBatch*>        m_freeBatches;  //!< Recycled text batches, text that changes often reuses their buffers
     };
 
 private: // data
@@ -133,6 +133,8 @@ namespace EMotionFX::MotionMatching
         settings.m_importMirrored = animGraphNode->m_mirror;
         settings.m_maxKdTreeDepth = animGraphNode->m_maxKdTreeDepth;
         settings.m_minFramesPerKdTreeNode = animGraphNode->m_minFramesPerKdTreeNode;
+        settings.m_broadPhaseType = animGraphNode->m_broadPhaseType;
+        settings.m_maxNumBroadPhaseFrames = animGraphNode->m_maxNumBroadPhaseFrames;
         settings.m_motionList.reserve(animGraphNode->m_motionIds.size());
         settings.m_normalizeData = animGraphNode->m_normalizeData;
         settings.m_featureScalerType = animGraphNode->m_featureScalerType;
@@ -345,6 +347,16 @@ namespace EMotionFX::MotionMatching
         return AZ::Edit::PropertyVisibility::Hide;
     }
 
+    AZ::Crc32 BlendTreeMotionMatchNode::GetKdTreeSettingsVisibility() const
+    {
+        return m_broadPhaseType == MotionMatchingData::KdTreeBroadPhase ? AZ::Edit::PropertyVisibility::Show : AZ::Edit::PropertyVisibility::Hide;
+    }
+
+    AZ::Crc32 BlendTreeMotionMatchNode::GetQuantizedSearchSettingsVisibility() const
+    {
+        return m_broadPhaseType == MotionMatchingData::QuantizedLinearBroadPhase ? AZ::Edit::PropertyVisibility::Show : AZ::Edit::PropertyVisibility::Hide;
+    }
+
     AZ::Crc32 BlendTreeMotionMatchNode::OnVisualizeSchemaButtonClicked()
     {
         FeatureSchema* usedSchema = nullptr;
@@ -382,7 +394,7 @@ namespace EMotionFX::MotionMatching
         }
 
         serializeContext->Class<BlendTreeMotionMatchNode, AnimGraphNode>()
-            ->Version(11)
+            ->Version(12)
             ->Field("lowestCostSearchFrequency", &BlendTreeMotionMatchNode::m_lowestCostSearchFrequency)
             ->Field("sampleRate", &BlendTreeMotionMatchNode::m_sampleRate)
             ->Field("controlSplineMode", &BlendTreeMotionMatchNode::m_trajectoryQueryMode)
@@ -398,6 +410,8 @@ namespace EMotionFX::MotionMatching
             ->Field("featureSchema", &BlendTreeMotionMatchNode::m_featureSchema)
             ->Field("motionIds", &BlendTreeMotionMatchNode::m_motionIds)
             ->Field("featureScalerType", &BlendTreeMotionMatchNode::m_featureScalerType)
+            ->Field("broadPhaseType", &BlendTreeMotionMatchNode::m_broadPhaseType)
+            ->Field("maxNumBroadPhaseFrames", &BlendTreeMotionMatchNode::m_maxNumBroadPhaseFrames)
             ;
 
         AZ::EditContext* editContext = serializeContext->GetEditContext();
@@ -454,14 +468,26 @@ namespace EMotionFX::MotionMatching
                 ->Attribute(AZ::Edit::Attributes::Visibility, &BlendTreeMotionMatchNode::GetMinMaxSettingsVisibility)
             ->ClassElement(AZ::Edit::ClassElements::Group, "Acceleration Structure")
                 ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+            ->DataElement(AZ::Edit::UIHandlers::ComboBox, &BlendTreeMotionMatchNode::m_broadPhaseType, "Broad-phase search", "The acceleration structure used to find the candidate frames before evaluating their costs.")
+                ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+                ->Attribute(AZ::Edit::Attributes::ChangeNotify, AZ::Edit::PropertyRefreshLevels::EntireTree)
+                ->EnumAttribute(MotionMatchingData::KdTreeBroadPhase, "Kd-tree")
+                ->EnumAttribute(MotionMatchingData::QuantizedLinearBroadPhase, "Quantized linear search")
             ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_maxKdTreeDepth, "Max kd-tree depth", "The maximum number of hierarchy levels in the kdTree.")
                 ->Attribute(AZ::Edit::Attributes::Min, 1)
                 ->Attribute(AZ::Edit::Attributes::Max, 20)
                 ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+                ->Attribute(AZ::Edit::Attributes::Visibility, &BlendTreeMotionMatchNode::GetKdTreeSettingsVisibility)
             ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_minFramesPerKdTreeNode, "Min kd-tree node size", "The minimum number of frames to store per kdTree node.")
                 ->Attribute(AZ::Edit::Attributes::Min, 1)
                 ->Attribute(AZ::Edit::Attributes::Max, 100000)
                 ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+                ->Attribute(AZ::Edit::Attributes::Visibility, &BlendTreeMotionMatchNode::GetKdTreeSettingsVisibility)
+            ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_maxNumBroadPhaseFrames, "Candidate frames", "The number of nearest frames the quantized linear search passes on to the cost evaluation.")
+                ->Attribute(AZ::Edit::Attributes::Min, 1)
+                ->Attribute(AZ::Edit::Attributes::Max, 100000)
+                ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+                ->Attribute(AZ::Edit::Attributes::Visibility, &BlendTreeMotionMatchNode::GetQuantizedSearchSettingsVisibility)
             ->EndGroup()
             ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_featureSchema, "FeatureSchema", "")
                 ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
@@ -28,6 +28,7 @@
 #include <FrameDatabase.h>
 #include <KdTree.h>
 #include <MotionMatchingData.h>
+#include <QuantizedFeatureSearch.h>
 
 namespace EMotionFX::MotionMatching
 {
@@ -39,6 +40,7 @@ namespace EMotionFX::MotionMatching
         : m_featureSchema(featureSchema)
     {
         m_kdTree = AZStd::make_unique<KdTree>();
+        m_quantizedFeatureSearch = AZStd::make_unique<QuantizedFeatureSearch>();
     }
 
     MotionMatchingData::~MotionMatchingData()
@@ -271,7 +273,16 @@ namespace EMotionFX::MotionMatching
                 }
             }
 
-            if (!m_kdTree->Init(m_frameDatabase, m_featureMatrix, m_featuresInKdTree, settings.m_maxKdTreeDepth, settings.m_minFramesPerKdTreeNode)) // Internally automatically clears any existing contents.
+            m_broadPhaseType = settings.m_broadPhaseType;
+            if (m_broadPhaseType == QuantizedLinearBroadPhase)
+            {
+                if (!m_quantizedFeatureSearch->Init(m_frameDatabase, m_featureMatrix, m_featuresInKdTree, settings.m_maxNumBroadPhaseFrames)) // Internally automatically clears any existing contents.
+                {
+                    AZ_Error("EMotionFX", false, "Failed to initialize the quantized feature search acceleration structure.");
+                    return false;
+                }
+            }
+            else if (!m_kdTree->Init(m_frameDatabase, m_featureMatrix, m_featuresInKdTree, settings.m_maxKdTreeDepth, settings.m_minFramesPerKdTreeNode)) // Internally automatically clears any existing contents.
             {
                 AZ_Error("EMotionFX", false, "Failed to initialize KdTree acceleration structure.");
                 return false;
@@ -293,6 +304,19 @@ namespace EMotionFX::MotionMatching
         m_frameDatabase.Clear();
         m_featureMatrix.Clear();
         m_kdTree->Clear();
+        m_quantizedFeatureSearch->Clear();
         m_featuresInKdTree.clear();
     }
+
+    void MotionMatchingData::FindBroadPhaseFrames(const AZStd::vector<float>& frameFloats, AZStd::vector<float>& tempDistances, AZStd::vector<size_t>& resultFrameIndices) const
+    {
+        if (m_broadPhaseType == QuantizedLinearBroadPhase)
+        {
+            m_quantizedFeatureSearch->FindNearestNeighbors(frameFloats, tempDistances, resultFrameIndices);
+        }
+        else
+        {
+            m_kdTree->FindNearestNeighbors(frameFloats, resultFrameIndices);
+        }
+    }
 } // namespace EMotionFX::MotionMatching
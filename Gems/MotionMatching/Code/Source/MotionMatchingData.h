@@ -19,6 +19,7 @@
 #include <FrameDatabase.h>
 #include <FeatureMatrixTransformer.h>
 #include <KdTree.h>
+#include <QuantizedFeatureSearch.h>
 
 namespace AZ
 {
@@ -47,6 +48,13 @@ namespace EMotionFX::MotionMatching
             MinMaxScalerType = 1
         };
 
+        //! The acceleration structure used by the broad-phase search, which finds the candidate frames for the narrow-phase cost evaluation.
+        enum BroadPhaseType
+        {
+            KdTreeBroadPhase = 0,
+            QuantizedLinearBroadPhase = 1
+        };
+
         struct EMFX_API InitSettings
         {
             ActorInstance* m_actorInstance = nullptr;
@@ -54,6 +62,8 @@ namespace EMotionFX::MotionMatching
             FrameDatabase::FrameImportSettings m_frameImportSettings;
             size_t m_maxKdTreeDepth = 20;
             size_t m_minFramesPerKdTreeNode = 1000;
+            BroadPhaseType m_broadPhaseType = KdTreeBroadPhase;
+            size_t m_maxNumBroadPhaseFrames = 1000; //!< The number of nearest frames found by the quantized linear broad-phase.
             bool m_importMirrored = false;
 
             bool m_normalizeData = false;
@@ -70,7 +80,13 @@ namespace EMotionFX::MotionMatching
         const FeatureMatrix& GetFeatureMatrix() const { return m_featureMatrix; }
         FeatureMatrixTransformer* GetFeatureTransformer() { return m_featureTransformer.get(); }
         const KdTree& GetKdTree() const { return *m_kdTree.get(); }
+        const QuantizedFeatureSearch& GetQuantizedFeatureSearch() const { return *m_quantizedFeatureSearch.get(); }
         const AZStd::vector<Feature*>& GetFeaturesInKdTree() const { return m_featuresInKdTree; }
+        BroadPhaseType GetBroadPhaseType() const { return m_broadPhaseType; }
+
+        //! Find the candidate frames for the given query values of the broad-phase features, using the selected broad-phase type.
+        //! @param tempDistances Buffer used by the quantized linear broad-phase, to avoid allocations when searching repeatedly.
+        void FindBroadPhaseFrames(const AZStd::vector<float>& frameFloats, AZStd::vector<float>& tempDistances, AZStd::vector<size_t>& resultFrameIndices) const;
 
     protected:
         //! Extract features from the motion database (multi-threaded).
@@ -88,6 +104,8 @@ namespace EMotionFX::MotionMatching
         AZStd::unique_ptr<FeatureMatrixTransformer> m_featureTransformer;
 
         AZStd::unique_ptr<KdTree> m_kdTree; //< The acceleration structure to speed up the search for lowest cost frames.
+        AZStd::unique_ptr<QuantizedFeatureSearch> m_quantizedFeatureSearch; //< The alternative linear broad-phase search over quantized features.
+        BroadPhaseType m_broadPhaseType = KdTreeBroadPhase;
         AZStd::vector<Feature*> m_featuresInKdTree;
     };
 } // namespace EMotionFX::MotionMatching
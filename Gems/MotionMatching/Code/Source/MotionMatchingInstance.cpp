@@ -107,8 +107,8 @@ namespace EMotionFX::MotionMatching
         m_queryPose.LinkToActorInstance(m_actorInstance);
         m_queryPose.InitFromBindPose(m_actorInstance);
 
-        // Make sure we have enough space inside the frame floats array, which is used to search the kdTree.
-        const size_t numValuesInKdTree = m_data->GetKdTree().GetNumDimensions();
+        // Make sure we have enough space inside the frame floats array, which is used for the broad-phase search.
+        const size_t numValuesInKdTree = KdTree::CalcNumDimensions(m_data->GetFeaturesInKdTree());
         m_kdTreeQueryVector.Resize(numValuesInKdTree);
         m_queryVector.Resize(m_data->GetFeatureMatrix().cols());
 
@@ -507,10 +507,10 @@ namespace EMotionFX::MotionMatching
             }
         }
 
-        // 2. Broad-phase search using KD-tree
+        // 2. Broad-phase search using the KD-tree or the quantized linear search
         if (mm_useKdTree)
         {
-            AZ_PROFILE_SCOPE(Animation, "MM::BroadPhaseKDTree");
+            AZ_PROFILE_SCOPE(Animation, "MM::BroadPhase");
 
             AZStd::vector<float>& kdTreeQueryVector = m_kdTreeQueryVector.GetData();
             const AZStd::vector<float>& queryVectorData = m_queryVector.GetData();
@@ -525,7 +525,7 @@ namespace EMotionFX::MotionMatching
             AZ_Assert(startOffset == kdTreeQueryVector.size(), "Frame float vector is not the expected size.");
 
             // Find our nearest frames.
-            m_data->GetKdTree().FindNearestNeighbors(kdTreeQueryVector, m_nearestFrames);
+            m_data->FindBroadPhaseFrames(kdTreeQueryVector, m_broadPhaseDistances, m_nearestFrames);
         }
 
         // 2. Narrow-phase, brute force find the actual best matching frame (frame with the minimal cost).
@@ -105,6 +105,7 @@ namespace EMotionFX::MotionMatching
         /// Buffers used for the broad-phase KD-tree search.
         QueryVector m_kdTreeQueryVector; //!< The input query for only the features that are present in the KD-tree.
         AZStd::vector<size_t> m_nearestFrames; //!< Stores the nearest matching frames / search result from the KD-tree.
+        AZStd::vector<float> m_broadPhaseDistances; //!< The frame distances calculated by the quantized linear broad-phase.
 
         FeatureTrajectory* m_cachedTrajectoryFeature = nullptr; //< Cached pointer to the trajectory feature in the feature schema.
         TrajectoryQuery m_trajectoryQuery;
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Timer.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+
+#include <Allocators.h>
+#include <KdTree.h>
+#include <QuantizedFeatureSearch.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZ_CLASS_ALLOCATOR_IMPL(QuantizedFeatureSearch, MotionMatchAllocator);
+
+    bool QuantizedFeatureSearch::Init(const FrameDatabase& frameDatabase,
+        const FeatureMatrix& featureMatrix,
+        const AZStd::vector<Feature*>& features,
+        size_t maxNumResultFrames)
+    {
+        AZ_PROFILE_SCOPE(Animation, "QuantizedFeatureSearch::Init");
+
+#if !defined(_RELEASE)
+        AZ::Debug::Timer timer;
+        timer.Stamp();
+#endif
+
+        Clear();
+
+        m_numDimensions = KdTree::CalcNumDimensions(features);
+        if (m_numDimensions == 0 || m_numDimensions > MaxNumDimensions)
+        {
+            AZ_Error("Motion Matching", false, "Cannot initialize the quantized feature search. The number of dimensions (%zu) has to be between 1 and %zu.", m_numDimensions, MaxNumDimensions);
+            m_numDimensions = 0;
+            return false;
+        }
+
+        if (maxNumResultFrames == 0)
+        {
+            AZ_Error("Motion Matching", false, "The number of frames returned by the quantized feature search cannot be zero.");
+            return false;
+        }
+
+        m_maxNumResultFrames = maxNumResultFrames;
+        m_numFrames = frameDatabase.GetNumFrames();
+        if (m_numFrames == 0)
+        {
+            AZ_Error("Motion Matching", false, "Skipping to initialize the quantized feature search. No frames in the motion database.");
+            return true;
+        }
+
+        // Map the dimensions to the feature matrix columns, as not all features take part in the broad-phase search.
+        AZStd::vector<size_t> featureColumns;
+        featureColumns.reserve(m_numDimensions);
+        for (const Feature* feature : features)
+        {
+            for (size_t i = 0; i < feature->GetNumDimensions(); ++i)
+            {
+                featureColumns.emplace_back(feature->GetColumnOffset() + i);
+            }
+        }
+        AZ_Assert(featureColumns.size() == m_numDimensions, "There should be a feature matrix column for each of the dimensions.");
+
+        // Calculate the value range of each dimension.
+        m_minValues.resize(m_numDimensions, AZStd::numeric_limits<float>::max());
+        AZStd::vector<float> maxValues(m_numDimensions, -AZStd::numeric_limits<float>::max());
+        for (size_t frameIndex = 0; frameIndex < m_numFrames; ++frameIndex)
+        {
+            for (size_t d = 0; d < m_numDimensions; ++d)
+            {
+                const float value = featureMatrix(frameIndex, featureColumns[d]);
+                m_minValues[d] = AZ::GetMin(m_minValues[d], value);
+                maxValues[d] = AZ::GetMax(maxValues[d], value);
+            }
+        }
+
+        constexpr float maxQuantizedValue = static_cast<float>(AZStd::numeric_limits<AZ::u16>::max());
+        m_stepSizes.resize(m_numDimensions);
+        m_squaredStepSizes.resize(m_numDimensions);
+        for (size_t d = 0; d < m_numDimensions; ++d)
+        {
+            m_stepSizes[d] = (maxValues[d] - m_minValues[d]) / maxQuantizedValue;
+            m_squaredStepSizes[d] = m_stepSizes[d] * m_stepSizes[d];
+        }
+
+        // Quantize the values.
+        m_quantizedValues.resize(m_numFrames * m_numDimensions);
+        for (size_t frameIndex = 0; frameIndex < m_numFrames; ++frameIndex)
+        {
+            AZ::u16* quantizedFrameValues = &m_quantizedValues[frameIndex * m_numDimensions];
+            for (size_t d = 0; d < m_numDimensions; ++d)
+            {
+                float quantizedValue = 0.0f;
+                if (m_stepSizes[d] > 0.0f)
+                {
+                    const float value = featureMatrix(frameIndex, featureColumns[d]);
+                    quantizedValue = AZ::GetClamp((value - m_minValues[d]) / m_stepSizes[d] + 0.5f, 0.0f, maxQuantizedValue);
+                }
+                quantizedFrameValues[d] = static_cast<AZ::u16>(quantizedValue);
+            }
+        }
+
+#if !defined(_RELEASE)
+        const float initTime = timer.GetDeltaTimeInSeconds();
+        AZ_TracePrintf("Motion Matching", "Quantized feature search initialized in %.2f ms (numFrames = %zu  numDims = %zu  Memory used = %.2f MB).",
+            initTime * 1000.0f,
+            m_numFrames,
+            m_numDimensions,
+            static_cast<float>(CalcMemoryUsageInBytes()) / 1024.0f / 1024.0f);
+#endif
+        return true;
+    }
+
+    void QuantizedFeatureSearch::Clear()
+    {
+        m_quantizedValues.clear();
+        m_quantizedValues.shrink_to_fit();
+        m_minValues.clear();
+        m_stepSizes.clear();
+        m_squaredStepSizes.clear();
+        m_numDimensions = 0;
+        m_numFrames = 0;
+    }
+
+    size_t QuantizedFeatureSearch::GetNumDimensions() const
+    {
+        return m_numDimensions;
+    }
+
+    size_t QuantizedFeatureSearch::GetNumFrames() const
+    {
+        return m_numFrames;
+    }
+
+    size_t QuantizedFeatureSearch::CalcMemoryUsageInBytes() const
+    {
+        size_t totalBytes = sizeof(QuantizedFeatureSearch);
+        totalBytes += m_quantizedValues.capacity() * sizeof(AZ::u16);
+        totalBytes += (m_minValues.capacity() + m_stepSizes.capacity() + m_squaredStepSizes.capacity()) * sizeof(float);
+        return totalBytes;
+    }
+
+    bool QuantizedFeatureSearch::IsInitialized() const
+    {
+        return (m_numDimensions != 0);
+    }
+
+    void QuantizedFeatureSearch::FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<float>& tempDistances, AZStd::vector<size_t>& resultFrameIndices) const
+    {
+        AZ_PROFILE_SCOPE(Animation, "QuantizedFeatureSearch::FindNearestNeighbors");
+        AZ_Assert(IsInitialized(), "Expecting an initialized quantized feature search. Did you forget to call QuantizedFeatureSearch::Init()?");
+        AZ_Assert(frameFloats.size() == m_numDimensions, "The number of query values (%zu) does not match the number of dimensions (%zu).", frameFloats.size(), m_numDimensions);
+
+        // Move the query into the quantized space, so that the distance of a frame is the sum of (quantizedValue - query)^2 * stepSize^2
+        // and no value has to be dequantized inside the loop over all frames.
+        float quantizedQuery[MaxNumDimensions];
+        const size_t numDimensions = m_numDimensions;
+        for (size_t d = 0; d < numDimensions; ++d)
+        {
+            quantizedQuery[d] = (m_stepSizes[d] > 0.0f) ? (frameFloats[d] - m_minValues[d]) / m_stepSizes[d] : 0.0f;
+        }
+
+        tempDistances.resize(m_numFrames);
+        const float* squaredStepSizes = m_squaredStepSizes.data();
+        for (size_t frameIndex = 0; frameIndex < m_numFrames; ++frameIndex)
+        {
+            const AZ::u16* quantizedFrameValues = &m_quantizedValues[frameIndex * m_numDimensions];
+
+            float distance = 0.0f;
+            for (size_t d = 0; d < numDimensions; ++d)
+            {
+                const float delta = static_cast<float>(quantizedFrameValues[d]) - quantizedQuery[d];
+                distance += delta * delta * squaredStepSizes[d];
+            }
+            tempDistances[frameIndex] = distance;
+        }
+
+        // Partition the frames so that the nearest ones are at the front.
+        resultFrameIndices.resize(m_numFrames);
+        for (size_t frameIndex = 0; frameIndex < m_numFrames; ++frameIndex)
+        {
+            resultFrameIndices[frameIndex] = frameIndex;
+        }
+
+        if (m_numFrames > m_maxNumResultFrames)
+        {
+            AZStd::nth_element(resultFrameIndices.begin(), resultFrameIndices.begin() + m_maxNumResultFrames, resultFrameIndices.end(),
+                [&tempDistances](size_t frameA, size_t frameB)
+                {
+                    return tempDistances[frameA] < tempDistances[frameB];
+                });
+            resultFrameIndices.resize(m_maxNumResultFrames);
+        }
+    }
+} // namespace EMotionFX::MotionMatching
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <Feature.h>
+#include <FeatureMatrix.h>
+#include <FrameDatabase.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Broad-phase search alternative to the KD-tree, which scans all frames linearly.
+    //! The feature values of the broad-phase features are quantized to 16 bits per value and stored in a compact,
+    //! row-major array, so that a search streams through a quarter of the memory of the feature matrix and
+    //! its inner loop is free of branches. Unlike the KD-tree, the search returns the frames that are actually closest
+    //! to the query instead of the frames within a single leaf.
+    class QuantizedFeatureSearch
+    {
+    public:
+        AZ_RTTI(QuantizedFeatureSearch, "{3D7E1C52-8A4F-4B6E-9F21-5C0B8D6A2E47}");
+        AZ_CLASS_ALLOCATOR_DECL;
+
+        //! The maximum number of dimensions, which keeps the quantized query on the stack.
+        static constexpr size_t MaxNumDimensions = 64;
+
+        QuantizedFeatureSearch() = default;
+        virtual ~QuantizedFeatureSearch() = default;
+
+        //! Quantize the values of the given features for all frames.
+        //! @param maxNumResultFrames The number of nearest frames returned by FindNearestNeighbors().
+        bool Init(const FrameDatabase& frameDatabase,
+            const FeatureMatrix& featureMatrix,
+            const AZStd::vector<Feature*>& features,
+            size_t maxNumResultFrames);
+
+        void Clear();
+
+        size_t GetNumDimensions() const;
+        size_t GetNumFrames() const;
+        size_t CalcMemoryUsageInBytes() const;
+        bool IsInitialized() const;
+
+        //! Find the frames that are closest to the given query values of the broad-phase features.
+        //! @param frameFloats The query values, in the order of the features passed to Init().
+        //! @param tempDistances Buffer that is used to store the distances for all frames, to avoid allocations when searching repeatedly.
+        //! @param resultFrameIndices The indices of the nearest frames, in no particular order.
+        void FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<float>& tempDistances, AZStd::vector<size_t>& resultFrameIndices) const;
+
+    private:
+        AZStd::vector<AZ::u16> m_quantizedValues; //!< The quantized values of all frames, with the values of a frame next to each other.
+        AZStd::vector<float> m_minValues; //!< The minimum value of each dimension.
+        AZStd::vector<float> m_stepSizes; //!< The value of a single quantization step of each dimension.
+        AZStd::vector<float> m_squaredStepSizes; //!< The squared step sizes, used to calculate distances in feature space.
+        size_t m_numDimensions = 0;
+        size_t m_numFrames = 0;
+        size_t m_maxNumResultFrames = 1000;
+    };
+} // namespace EMotionFX::MotionMatching
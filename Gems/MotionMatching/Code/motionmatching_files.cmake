@@ -43,6 +43,8 @@ set(FILES
     Source/FeatureVelocity.h
     Source/PoseDataJointVelocities.cpp
     Source/PoseDataJointVelocities.h
+    Source/QuantizedFeatureSearch.cpp
+    Source/QuantizedFeatureSearch.h
     Source/QueryVector.cpp
     Source/QueryVector.h
     Source/TrajectoryHistory.cpp
@@ -14,6 +14,7 @@
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/MultiplayerStats.h>
 #include <Multiplayer/MultiplayerTypes.h>
+#include <Multiplayer/NetworkTime/RewindableObject.h>
 #include <Multiplayer/IMultiplayer.h>
 
 //! Macro to declare bindings for a multiplayer component inheriting from MultiplayerComponent
@@ -162,6 +163,49 @@ namespace Multiplayer
         }
     }
 
+    //! Serializes a network property value through a quantized representation of it, see AzNetworking::SerializeQuantized.
+    template <typename QUANTIZED_TYPE, typename TYPE>
+    inline bool SerializeQuantizedNetworkPropertyValue(AzNetworking::ISerializer& serializer, TYPE& value, const char* name)
+    {
+        return AzNetworking::SerializeQuantized<QUANTIZED_TYPE>(serializer, value, name);
+    }
+
+    //! Serializes the current value of a rewindable network property through a quantized representation of it.
+    template <typename QUANTIZED_TYPE, typename TYPE, AZStd::size_t REWIND_SIZE>
+    inline bool SerializeQuantizedNetworkPropertyValue(AzNetworking::ISerializer& serializer, RewindableObject<TYPE, REWIND_SIZE>& value, const char* name)
+    {
+        return serializer.BeginObject(name) && value.template SerializeQuantized<QUANTIZED_TYPE>(serializer) && serializer.EndObject(name);
+    }
+
+    template <typename QUANTIZED_TYPE, typename TYPE>
+    inline void SerializeQuantizedNetworkPropertyHelper
+    (
+        AzNetworking::ISerializer& serializer,
+        AzNetworking::FixedSizeBitsetView& bitset,
+        int32_t bitIndex,
+        TYPE& value,
+        const char* name,
+        NetComponentId componentId,
+        PropertyIndex propertyIndex,
+        MultiplayerStats& stats
+    )
+    {
+        if (bitset.GetBit(bitIndex))
+        {
+            const bool modifyRecord = serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject;
+            const uint32_t prevUpdateSize = serializer.GetSize();
+            serializer.ClearTrackedChangesFlag();
+            SerializeQuantizedNetworkPropertyValue<QUANTIZED_TYPE>(serializer, value, name);
+            if (modifyRecord && !serializer.GetTrackedChangesFlag())
+            {
+                // If the serializer didn't change any values, then lower the flag so we don't unnecessarily notify
+                bitset.SetBit(bitIndex, false);
+            }
+            const uint32_t postUpdateSize = serializer.GetSize();
+            UpdateComponentMetrics(modifyRecord, prevUpdateSize, postUpdateSize, componentId, propertyIndex, stats);
+        }
+    }
+
     template <typename TYPE, AZStd::size_t SIZE>
     inline void SerializeNetworkPropertyHelperArray
     (
@@ -14,6 +14,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
@@ -196,6 +197,16 @@ namespace Multiplayer
         bool SerializeEntityCorrection(AzNetworking::ISerializer& serializer);
 
         bool SerializeStateDeltaMessage(ReplicationRecord& replicationRecord, AzNetworking::ISerializer& serializer);
+
+        //! Writes the replication record followed by the state delta it describes into the provided buffer.
+        //! The serialized bytes are shared for the current host frame, so any other connection requesting the same changes during the
+        //! same host frame receives a copy instead of serializing the entity again. Safe to call from concurrent connection updates.
+        //! @param replicationRecord the record describing which network properties to serialize
+        //! @param buffer            the buffer to write the serialized record and state delta to
+        //! @param bufferCapacity    the capacity of the provided buffer in bytes
+        //! @param outSize           the number of bytes written to the buffer
+        //! @return boolean true on success, false if serialization failed or the buffer is too small
+        bool SerializeSharedEntityRecord(const ReplicationRecord& replicationRecord, uint8_t* buffer, uint32_t bufferCapacity, uint32_t& outSize);
         void NotifyStateDeltaChanges(ReplicationRecord& replicationRecord);
 
         void FillReplicationRecord(ReplicationRecord& replicationRecord) const;
@@ -230,6 +241,16 @@ namespace Multiplayer
         ReplicationRecord m_totalRecord = NetEntityRole::InvalidRole;
         ReplicationRecord m_predictableRecord = NetEntityRole::Autonomous;
         ReplicationRecord m_localNotificationRecord = NetEntityRole::InvalidRole;
+
+        struct SharedEntityRecord
+        {
+            ReplicationRecord m_record;
+            AZStd::vector<uint8_t> m_data;
+        };
+        // Entity records serialized during m_sharedEntityRecordFrameId, reused by connections sending the same changes
+        AZStd::vector<SharedEntityRecord> m_sharedEntityRecords;
+        HostFrameId m_sharedEntityRecordFrameId = InvalidHostFrameId;
+        AZStd::mutex m_sharedEntityRecordMutex;
         PrefabEntityId    m_prefabEntityId;
         AZ::Data::AssetId m_prefabAssetId;
         // It is important that this component map be ordered, as we walk it to generate serialization ordering
@@ -14,6 +14,7 @@
 #include <AzCore/Component/TransformBus.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
 #include <AzFramework/Physics/CharacterBus.h>
+#include <Multiplayer/NetworkTime/NetworkRewindHistory.h>
 
 namespace Physics
 {
@@ -33,7 +34,6 @@ namespace Multiplayer
         {
             AnimatedHitVolume
             (
-                AzNetworking::ConnectionId connectionId,
                 Physics::CharacterRequests* character,
                 const char* hitVolumeName,
                 const Physics::ColliderConfiguration* colliderConfig,
@@ -44,9 +44,10 @@ namespace Multiplayer
             ~AnimatedHitVolume() = default;
 
             void UpdateTransform(const AZ::Transform& transform);
-            void SyncToCurrentTransform();
+            void SyncToTransform(const AZ::Transform& rewoundTransform);
 
-            Multiplayer::RewindableObject<AZ::Transform, Multiplayer::RewindHistorySize> m_transform;
+            //! Slot in the centralized rewind history, released by the owning component when its hit volumes are destroyed
+            RewindSlot m_rewindSlot = InvalidRewindSlot;
             AZStd::shared_ptr<Physics::Shape> m_physicsShape;
 
             // Cached so we don't have to do subsequent lookups by name
@@ -94,6 +95,10 @@ namespace Multiplayer
 
         AZStd::vector<AnimatedHitVolume> m_animatedHitVolumes;
 
+        // Rewind slots of all hit volumes, so the whole character can be rewound with a single read of the rewind history
+        AZStd::vector<RewindSlot> m_rewindSlots;
+        AZStd::vector<AZ::Transform> m_rewoundTransforms;
+
         Multiplayer::EntitySyncRewindEvent::Handler m_syncRewindHandler;
         Multiplayer::EntityPreRenderEvent::Handler m_preRenderHandler;
         AZ::TransformChangedEvent::Handler m_transformChangedHandler;
@@ -11,6 +11,7 @@
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/Time/ITime.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <Multiplayer/MultiplayerTypes.h>
 
 namespace AzNetworking
@@ -94,5 +95,21 @@ namespace Multiplayer
         };
 
         void ConnectHandlers(EventHandlers& handlers);
+
+        //! Attributes all stats recorded on the calling thread to a connection for the lifetime of the scope.
+        //! Recorded events don't carry the connection themselves, listeners that attribute per connection query GetRecordConnectionId.
+        class ScopedRecordConnection
+        {
+        public:
+            explicit ScopedRecordConnection(AzNetworking::ConnectionId connectionId);
+            ~ScopedRecordConnection();
+
+        private:
+            AzNetworking::ConnectionId m_previousConnectionId;
+        };
+
+        //! Returns the connection stats recorded on the calling thread are currently attributed to.
+        //! @return the attributed connection, or InvalidConnectionId if no ScopedRecordConnection is active on this thread
+        static AzNetworking::ConnectionId GetRecordConnectionId();
     };
 }
@@ -20,6 +20,7 @@
 #include <AzNetworking/DataStructures/TimeoutQueue.h>
 #include <AzNetworking/PacketLayer/IPacketHeader.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/limits.h>
@@ -87,6 +88,15 @@ namespace Multiplayer
         bool HandleEntityMigration(AzNetworking::IConnection* invokingConnection, EntityMigrationMessage& message);
         bool HandleEntityDeleteMessage(EntityReplicator* entityReplicator, const AzNetworking::IPacketHeader& packetHeader, const NetworkEntityUpdateMessage& updateMessage);
         bool HandleEntityUpdateMessage(AzNetworking::IConnection* invokingConnection, const AzNetworking::IPacketHeader& packetHeader, const NetworkEntityUpdateMessage& updateMessage);
+
+        //! Handles a batch of entity update messages received in a single packet.
+        //! When receiving from a server, snapshot deltas may be decoded on job threads before the messages are applied in order on the calling thread.
+        //! Only snapshot updates (see sv_snapshotDeltaReplication) are decoded in parallel, regular updates are always deserialized on the calling thread.
+        //! @param invokingConnection the connection the messages were received on
+        //! @param packetHeader       the header of the packet containing the messages
+        //! @param updateMessages     the entity update messages to handle
+        //! @return false if any message failed to be handled
+        bool HandleEntityUpdateMessages(AzNetworking::IConnection* invokingConnection, const AzNetworking::IPacketHeader& packetHeader, const NetworkEntityUpdateVector& updateMessages);
         bool HandleEntityRpcMessages(AzNetworking::IConnection* invokingConnection, NetworkEntityRpcVector& rpcVector);
         bool HandleEntityResetMessages(AzNetworking::IConnection* invokingConnection, const NetEntityIdsForReset& resetIds);
 
@@ -116,6 +126,27 @@ namespace Multiplayer
 
         UpdateValidationResult ValidateUpdate(const NetworkEntityUpdateMessage& updateMessage, AzNetworking::PacketId packetId, EntityReplicator* entityReplicator);
 
+        //! The result of decoding a snapshot ahead of handling its update message.
+        struct DecodedSnapshot
+        {
+            const AZStd::vector<uint8_t>* m_snapshot = nullptr;
+            bool m_isDecoded = false;
+        };
+
+        //! Decodes the snapshot deltas of a batch of update messages on job threads, each replicator only ever being decoded by a single job.
+        //! @param packetHeader     the header of the packet containing the messages
+        //! @param updateMessages   the entity update messages to decode snapshots for
+        //! @param outDecoded       the decoded snapshots, one per update message
+        void DecodeSnapshotsInParallel(const AzNetworking::IPacketHeader& packetHeader, const NetworkEntityUpdateVector& updateMessages, AZStd::vector<DecodedSnapshot>& outDecoded);
+
+        bool HandleEntityUpdateMessage
+        (
+            AzNetworking::IConnection* invokingConnection,
+            const AzNetworking::IPacketHeader& packetHeader,
+            const NetworkEntityUpdateMessage& updateMessage,
+            const DecodedSnapshot& decodedSnapshot
+        );
+
         using RpcMessages = AZStd::list<NetworkEntityRpcMessage>;
         bool DispatchOrphanedRpc(NetworkEntityRpcMessage& message, EntityReplicator* entityReplicator);
 
@@ -123,6 +154,18 @@ namespace Multiplayer
         EntityReplicatorList GenerateEntityUpdateList();
 
         void SendEntityUpdateMessages(EntityReplicatorList& replicatorList);
+
+        //! Accumulates priority for each proxy replicator and appends those with the highest accumulated priority to the send list.
+        void PrioritizeProxyReplicators(AZStd::vector<EntityReplicator*>& proxyReplicators, EntityReplicatorList& toSendList);
+
+        //! Refills the bandwidth token bucket based on the time elapsed since the last update.
+        void RefillBandwidthBudget();
+        bool HasBandwidthBudget() const;
+
+        //! Returns the rate entity updates may be sent at, the lower of sv_MaxReplicationBytesPerSecond and the connection's congestion limit.
+        //! @return the entity update rate in bytes per second, 0 if the rate is not limited
+        int64_t GetReplicationBytesPerSecond() const;
+
         void SendEntityRpcs(RpcMessages& rpcMessages, bool reliable);
         void SendEntityResets();
 
@@ -191,6 +234,9 @@ namespace Multiplayer
         NetEntityIdSet m_replicatorsPendingSend;
         NetEntityIdSet m_replicatorsPendingReset;
 
+        //! Priority accumulated by proxy replicators that have changes but were not sent, reset once they are sent
+        AZStd::unordered_map<NetEntityId, float> m_priorityAccumulators;
+
         // Deferred RPC Sends
         RpcMessages m_deferredRpcMessagesReliable;
         RpcMessages m_deferredRpcMessagesUnreliable;
@@ -213,6 +259,8 @@ namespace Multiplayer
         AZ::TimeMs m_entityActivationTimeSliceMs = AZ::Time::ZeroTimeMs;
         AZ::TimeMs m_entityPendingRemovalMs = AZ::Time::ZeroTimeMs;
         AZ::TimeMs m_frameTimeMs = AZ::Time::ZeroTimeMs;
+        AZ::TimeMs m_bandwidthRefillTimeMs = AZ::Time::ZeroTimeMs;
+        int64_t m_bandwidthTokens = 0; // Bytes we may send before exceeding the bandwidth budget, negative when in debt
         HostId m_remoteHostId = InvalidHostId;
         uint32_t m_maxRemoteEntitiesPendingCreationCount = AZStd::numeric_limits<uint32_t>::max();
         uint32_t m_maxPayloadSize = 0;
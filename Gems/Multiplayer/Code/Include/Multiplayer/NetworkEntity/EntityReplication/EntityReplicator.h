@@ -14,6 +14,7 @@
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/containers/ring_buffer.h>
+#include <AzCore/std/containers/vector.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
 
@@ -87,11 +88,14 @@ namespace Multiplayer
         EntityMigrationMessage GenerateMigrationPacket();
         //! After sending a generated packet, record the sent packet id for tracking acknowledgements.
         void RecordSentPacketId(AzNetworking::PacketId sentId);
+        //! Discard a prepared update packet that was not sent, its changes remain pending and are prepared again on the next update.
+        void CancelPreparedUpdatePacket();
 
         // Interface for ReplicationManager to manage receiving entity changes
         bool HandlePropertyChangeMessage(AzNetworking::PacketId packetId, AzNetworking::ISerializer* serializer, bool notifyChanges);
         bool IsPacketIdValid(AzNetworking::PacketId packetId) const;
         AzNetworking::PacketId GetLastReceivedPacketId() const;
+        const AZStd::vector<uint8_t>* DecodeSnapshot(AzNetworking::PacketId packetId, AzNetworking::PacketId baselinePacketId, const AzNetworking::PacketEncodingBuffer& delta);
 
         AZ::TimeMs GetResendTimeoutTimeMs() const;
 
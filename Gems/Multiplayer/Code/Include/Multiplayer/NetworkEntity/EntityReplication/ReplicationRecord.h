@@ -55,6 +55,12 @@ namespace Multiplayer
         void Subtract(const ReplicationRecord &rhs);
         bool HasChanges() const;
 
+        //! Returns true if both records have the same remote role and the same bits set, consumed bits and sent packet ids are ignored.
+        //! Records that have the same changes produce identical serialized entity updates.
+        //! @param rhs the record to compare against
+        //! @return boolean true if both records describe the same changes
+        bool HasSameChanges(const ReplicationRecord& rhs) const;
+
         bool Serialize(AzNetworking::ISerializer& serializer);
 
         void ConsumeAuthorityToClientBits(uint32_t consumedBits);
@@ -19,6 +19,7 @@ namespace Multiplayer
 {
     class NetworkEntityTracker;
     class NetworkEntityAuthorityTracker;
+    class NetworkRelevancyGrid;
     class NetworkEntityRpcMessage;
     class MultiplayerComponentRegistry;
     class IEntityDomain;
@@ -60,6 +61,10 @@ namespace Multiplayer
         //! @return the NetworkEntityAuthorityTracker for this INetworkEntityManager instance
         virtual NetworkEntityAuthorityTracker* GetNetworkEntityAuthorityTracker() = 0;
 
+        //! Returns the NetworkRelevancyGrid for this INetworkEntityManager instance.
+        //! @return the NetworkRelevancyGrid for this INetworkEntityManager instance
+        virtual NetworkRelevancyGrid* GetNetworkRelevancyGrid() = 0;
+
         //! Returns the MultiplayerComponentRegistry for this INetworkEntityManager instance.
         //! @return the MultiplayerComponentRegistry for this INetworkEntityManager instance
         virtual MultiplayerComponentRegistry* GetMultiplayerComponentRegistry() = 0;
@@ -214,6 +219,12 @@ namespace Multiplayer
         //! @return the set of network entities that should always be relevant to server connections
         virtual const NetEntityHandleSet& GetAlwaysRelevantToServersSet() const = 0;
 
+        //! Overrides the distance within which the provided entity is relevant to client connections, instead of the client awareness radius.
+        //! Only used when client replication windows gather entities through the network relevancy grid.
+        //! @param entityHandle      const network entity handle to the entity to override the relevancy distance for
+        //! @param relevancyDistance the relevancy distance to use, a value of zero or less restores the client awareness radius
+        virtual void SetRelevancyDistance(const ConstNetworkEntityHandle& entityHandle, float relevancyDistance) = 0;
+
         //! Overrides the default timeout time used during entity migrations.
         //! @param timeoutTimeMs the timeout time to use in milliseconds
         virtual void SetMigrateTimeoutTimeMs(AZ::TimeMs timeoutTimeMs) = 0;
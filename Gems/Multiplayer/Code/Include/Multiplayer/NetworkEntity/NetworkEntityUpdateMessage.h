@@ -10,6 +10,7 @@
 
 #include <AzNetworking/Serialization/ISerializer.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Name/Name.h>
 #include <Multiplayer/MultiplayerTypes.h>
 
@@ -73,6 +74,18 @@ namespace Multiplayer
         //! @return the current value of PrefabEntityId
         const PrefabEntityId& GetPrefabEntityId() const;
 
+        //! Marks the data as a snapshot of the entity's replicated state, delta encoded against a previously sent snapshot.
+        //! @param baselinePacketId the packet id of the snapshot the data is delta encoded against, or InvalidPacketId if there is no baseline
+        void SetSnapshotBaseline(AzNetworking::PacketId baselinePacketId);
+
+        //! Gets whether the data is a delta encoded snapshot rather than a set of changed properties.
+        //! @return true if the data is a delta encoded snapshot
+        bool GetIsSnapshot() const;
+
+        //! Gets the packet id of the snapshot the data is delta encoded against.
+        //! @return the packet id of the baseline snapshot, or InvalidPacketId if there is no baseline
+        AzNetworking::PacketId GetSnapshotBaseline() const;
+
         //! Sets the current value for Data
         //! @param value the value to set Data to
         void SetData(const AzNetworking::PacketEncodingBuffer& value);
@@ -97,7 +110,9 @@ namespace Multiplayer
         bool           m_isDelete = false;
         bool           m_wasMigrated = false;
         bool           m_hasValidPrefabId = false;
+        bool           m_isSnapshot = false;
         PrefabEntityId m_prefabEntityId;
+        AzNetworking::PacketId m_snapshotBaseline = AzNetworking::InvalidPacketId;
 
         // Only allocated if we actually have data
         // This is to prevent blowing out stack memory if we declare an array of these EntityUpdateMessages
@@ -14,6 +14,8 @@
 
 namespace Multiplayer
 {
+    class NetworkRewindHistory;
+
     //! @class INetworkTime
     //! @brief This is an AZ::Interface<> for managing multiplayer specific time related operations.
     class INetworkTime
@@ -71,6 +73,10 @@ namespace Multiplayer
         //! Restores all rewound entities to the current application time.
         virtual void ClearRewoundEntities() = 0;
 
+        //! Returns the centralized rewind history used for lag compensated hit detection.
+        //! @return the centralized rewind history
+        virtual NetworkRewindHistory& GetRewindHistory() = 0;
+
         AZ_DISABLE_COPY_MOVE(INetworkTime);
     };
 
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <Multiplayer/MultiplayerTypes.h>
+
+namespace Multiplayer
+{
+    using RewindSlot = uint32_t;
+    static constexpr RewindSlot InvalidRewindSlot = AZStd::numeric_limits<RewindSlot>::max();
+
+    //! @class NetworkRewindHistory
+    //! @brief Centralized rewind history of transforms, used for lag compensated hit detection.
+    //! Unlike RewindableObject, which stores the history of each value inline with its owner, the history of every slot is stored
+    //! together in structure of arrays form, one row of translations, rotations and scales per host frame.
+    //! Rewinding many hit volumes to the same frame therefore reads one or two contiguous rows, rather than touching the history
+    //! buffer of every hit volume.
+    class NetworkRewindHistory
+    {
+    public:
+
+        NetworkRewindHistory() = default;
+
+        //! Allocates a slot, initializing its entire history to the provided transform.
+        //! @param transform the initial transform of the slot
+        //! @return the allocated slot
+        RewindSlot AddSlot(const AZ::Transform& transform);
+
+        //! Releases a slot, the slot may be reused by a subsequent call to AddSlot.
+        //! @param slot the slot to release
+        void RemoveSlot(RewindSlot slot);
+
+        //! Sets the transform of a slot for the provided host frame.
+        //! As with RewindableObject, history older than the most recently recorded frame cannot be modified and such sets are ignored.
+        //! @param slot      the slot to set the transform of
+        //! @param transform the transform to set
+        //! @param frameId   the host frame the transform applies to
+        void SetTransform(RewindSlot slot, const AZ::Transform& transform, HostFrameId frameId);
+
+        //! Sets the transform of a slot for the current host frame.
+        //! @param slot      the slot to set the transform of
+        //! @param transform the transform to set
+        void SetTransform(RewindSlot slot, const AZ::Transform& transform);
+
+        //! Returns the transform of a slot at the provided host frame.
+        //! Frames newer than the most recently recorded frame return the most recent transform, frames older than the history return the oldest.
+        //! @param slot    the slot to retrieve the transform of
+        //! @param frameId the host frame to retrieve the transform for
+        //! @return the transform of the slot at the provided host frame
+        AZ::Transform GetTransform(RewindSlot slot, HostFrameId frameId) const;
+
+        //! Retrieves the transforms of many slots at the provided host frame, blending from the preceding frame.
+        //! @param slots         the slots to retrieve the transforms of
+        //! @param frameId       the host frame to retrieve the transforms for
+        //! @param blendFactor   the factor used to blend between the transforms at the preceding and provided host frames
+        //! @param outTransforms the retrieved transforms, must have at least as many elements as slots
+        void GetTransforms(AZStd::span<const RewindSlot> slots, HostFrameId frameId, float blendFactor, AZ::Transform* outTransforms) const;
+
+        //! Retrieves the transforms of many slots at the current, possibly rewound, host frame.
+        //! Slots owned by the connection requesting the rewind are not rewound, matching RewindableObject's 'don't rewind the shooter' semantics.
+        //! @param slots              the slots to retrieve the transforms of
+        //! @param owningConnectionId the connection that owns the slots
+        //! @param outTransforms      the retrieved transforms, must have at least as many elements as slots
+        void GetRewoundTransforms(AZStd::span<const RewindSlot> slots, AzNetworking::ConnectionId owningConnectionId, AZ::Transform* outTransforms) const;
+
+        //! Returns the number of allocated slots.
+        //! @return the number of allocated slots
+        uint32_t GetSlotCount() const;
+
+    private:
+
+        uint32_t GetRowIndex(HostFrameId frameId) const;
+        HostFrameId ClampFrameId(HostFrameId frameId) const;
+
+        //! Advances the most recently recorded frame, carrying the most recent transform of every slot forward.
+        void AdvanceToFrame(HostFrameId frameId);
+
+        //! Grows the number of slots each row can hold, preserving the history of all allocated slots.
+        void GrowSlotCapacity();
+
+        AZStd::vector<AZ::Vector3> m_translations;
+        AZStd::vector<AZ::Quaternion> m_rotations;
+        AZStd::vector<float> m_scales;
+        AZStd::vector<RewindSlot> m_freeSlots;
+
+        HostFrameId m_headFrameId = HostFrameId{ 0 };
+        uint32_t m_slotCapacity = 0;
+        uint32_t m_slotHighWaterMark = 0;
+    };
+}
@@ -10,6 +10,7 @@
 
 #include <Multiplayer/NetworkTime/INetworkTime.h>
 #include <AzNetworking/Serialization/ISerializer.h>
+#include <AzNetworking/Serialization/QuantizedSerializer.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/std/containers/array.h>
@@ -87,6 +88,12 @@ namespace Multiplayer
         //! @return boolean true for success, false for serialization failure
         bool Serialize(AzNetworking::ISerializer& serializer);
 
+        //! Serializes the current value through a quantized representation of it, see AzNetworking::SerializeQuantized.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        template <typename QUANTIZED_TYPE>
+        bool SerializeQuantized(AzNetworking::ISerializer& serializer);
+
     private:
 
         //! Returns what the appropriate current time is for this rewindable property.
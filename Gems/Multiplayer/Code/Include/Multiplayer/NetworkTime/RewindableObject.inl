@@ -124,6 +124,23 @@ namespace Multiplayer
         return serializer.IsValid();
     }
 
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    template <typename QUANTIZED_TYPE>
+    inline bool RewindableObject<BASE_TYPE, REWIND_SIZE>::SerializeQuantized(AzNetworking::ISerializer& serializer)
+    {
+        const HostFrameId frameTime = GetCurrentTimeForProperty();
+        BASE_TYPE value = GetValueForTime(frameTime);
+        if (AzNetworking::SerializeQuantized<QUANTIZED_TYPE>(serializer, value, "Element") && (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject))
+        {
+            SetValueForTime(value, frameTime);
+            if (m_headTime == frameTime && m_headTime > m_lastSerializedTime)
+            {
+                m_lastSerializedTime = m_headTime;
+            }
+        }
+        return serializer.IsValid();
+    }
+
     template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
     inline HostFrameId RewindableObject<BASE_TYPE, REWIND_SIZE>::GetCurrentTimeForProperty() const
     {
@@ -9,6 +9,7 @@
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/MultiplayerComponent.h>
 #include <Multiplayer/Components/MultiplayerController.h>
+#include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/INetworkSpawnableLibrary.h>
 #include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityRpcMessage.h>
@@ -656,6 +657,50 @@ namespace Multiplayer
         return success;
     }
 
+    bool NetBindComponent::SerializeSharedEntityRecord(const ReplicationRecord& replicationRecord, uint8_t* buffer, uint32_t bufferCapacity, uint32_t& outSize)
+    {
+        outSize = 0;
+        const HostFrameId hostFrameId = GetNetworkTime()->GetUnalteredHostFrameId();
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_sharedEntityRecordMutex);
+        if (m_sharedEntityRecordFrameId != hostFrameId)
+        {
+            // Network properties may have changed since the cached records were serialized
+            m_sharedEntityRecords.clear();
+            m_sharedEntityRecordFrameId = hostFrameId;
+        }
+
+        for (const SharedEntityRecord& sharedRecord : m_sharedEntityRecords)
+        {
+            if (sharedRecord.m_record.HasSameChanges(replicationRecord))
+            {
+                if (sharedRecord.m_data.size() > bufferCapacity)
+                {
+                    return false;
+                }
+                outSize = aznumeric_cast<uint32_t>(sharedRecord.m_data.size());
+                memcpy(buffer, sharedRecord.m_data.data(), outSize);
+                return true;
+            }
+        }
+
+        ReplicationRecord record = replicationRecord;
+        record.ResetConsumedBits();
+        InputSerializer inputSerializer(buffer, bufferCapacity);
+        record.Serialize(inputSerializer);
+        SerializeStateDeltaMessage(record, inputSerializer);
+        if (!inputSerializer.IsValid())
+        {
+            return false;
+        }
+
+        outSize = inputSerializer.GetSize();
+        SharedEntityRecord& sharedRecord = m_sharedEntityRecords.emplace_back();
+        sharedRecord.m_record = replicationRecord;
+        sharedRecord.m_data.assign(buffer, buffer + outSize);
+        return true;
+    }
+
     void NetBindComponent::NotifyStateDeltaChanges(ReplicationRecord& replicationRecord)
     {
         for (auto iter = m_multiplayerSerializationComponentVector.begin(); iter != m_multiplayerSerializationComponentVector.end(); ++iter)
@@ -25,7 +25,6 @@ namespace Multiplayer
 
     NetworkHitVolumesComponent::AnimatedHitVolume::AnimatedHitVolume
     (
-        AzNetworking::ConnectionId connectionId,
         Physics::CharacterRequests* character,
         const char* hitVolumeName,
         const Physics::ColliderConfiguration* colliderConfig,
@@ -36,7 +35,7 @@ namespace Multiplayer
         , m_shapeConfig(shapeConfig)
         , m_jointIndex(jointIndex)
     {
-        m_transform.SetOwningConnectionId(connectionId);
+        m_rewindSlot = GetNetworkTime()->GetRewindHistory().AddSlot(AZ::Transform::CreateIdentity());
 
         m_colliderOffSetTransform = AZ::Transform::CreateFromQuaternionAndTranslation(m_colliderConfig->m_rotation, m_colliderConfig->m_position);
 
@@ -62,28 +61,12 @@ namespace Multiplayer
 
     void NetworkHitVolumesComponent::AnimatedHitVolume::UpdateTransform(const AZ::Transform& transform)
     {
-        m_transform = transform;
+        GetNetworkTime()->GetRewindHistory().SetTransform(m_rewindSlot, transform);
         m_physicsShape->SetLocalPose(transform.GetTranslation(), transform.GetRotation());
     }
 
-    void NetworkHitVolumesComponent::AnimatedHitVolume::SyncToCurrentTransform()
+    void NetworkHitVolumesComponent::AnimatedHitVolume::SyncToTransform(const AZ::Transform& rewoundTransform)
     {
-        AZ::Transform rewoundTransform;
-        const AZ::Transform& targetTransform = m_transform.Get();
-        const float blendFactor = Multiplayer::GetNetworkTime()->GetHostBlendFactor();
-        if (blendFactor < 1.f)
-        {
-            // If a blend factor was supplied, interpolate the transform appropriately
-            const AZ::Transform& previousTransform = m_transform.GetPrevious();
-            rewoundTransform.SetRotation(previousTransform.GetRotation().Slerp(targetTransform.GetRotation(), blendFactor));
-            rewoundTransform.SetTranslation(previousTransform.GetTranslation().Lerp(targetTransform.GetTranslation(), blendFactor));
-            rewoundTransform.SetUniformScale(AZ::Lerp(previousTransform.GetUniformScale(), targetTransform.GetUniformScale(), blendFactor));
-        }
-        else
-        {
-            rewoundTransform = m_transform.Get();
-        }
-
         const AZ::Transform  physicsTransform = AZ::Transform::CreateFromQuaternionAndTranslation(m_physicsShape->GetLocalPose().second, m_physicsShape->GetLocalPose().first);
 
         // Don't call SetLocalPose unless the transforms are actually different
@@ -189,9 +172,17 @@ namespace Multiplayer
             m_physicsCharacter->GetCharacter()->SetFrameId(frameId);
         }
 
-        for (AnimatedHitVolume& hitVolume : m_animatedHitVolumes)
+        if (m_animatedHitVolumes.empty())
         {
-            hitVolume.SyncToCurrentTransform();
+            return;
+        }
+
+        // Blending and the 'don't rewind the shooter' rule are handled by the rewind history for all hit volumes at once
+        const AzNetworking::ConnectionId owningConnectionId = GetNetBindComponent()->GetOwningConnectionId();
+        GetNetworkTime()->GetRewindHistory().GetRewoundTransforms(m_rewindSlots, owningConnectionId, m_rewoundTransforms.data());
+        for (size_t i = 0; i < m_animatedHitVolumes.size(); ++i)
+        {
+            m_animatedHitVolumes[i].SyncToTransform(m_rewoundTransforms[i]);
         }
     }
 
@@ -209,7 +200,6 @@ namespace Multiplayer
         }
 
         m_hitDetectionConfig = &physicsConfig->m_hitDetectionConfig;
-        const AzNetworking::ConnectionId owningConnectionId = GetNetBindComponent()->GetOwningConnectionId();
 
         m_animatedHitVolumes.reserve(m_hitDetectionConfig->m_nodes.size());
         for (const Physics::CharacterColliderNodeConfiguration& nodeConfig : m_hitDetectionConfig->m_nodes)
@@ -224,13 +214,28 @@ namespace Multiplayer
             {
                 const Physics::ColliderConfiguration* colliderConfig = coliderPair.first.get();
                 Physics::ShapeConfiguration* shapeConfig = coliderPair.second.get();
-                m_animatedHitVolumes.emplace_back(owningConnectionId, m_physicsCharacter, nodeConfig.m_name.c_str(), colliderConfig, shapeConfig, aznumeric_cast<uint32_t>(jointIndex));
+                m_animatedHitVolumes.emplace_back(m_physicsCharacter, nodeConfig.m_name.c_str(), colliderConfig, shapeConfig, aznumeric_cast<uint32_t>(jointIndex));
             }
         }
+
+        m_rewindSlots.reserve(m_animatedHitVolumes.size());
+        for (const AnimatedHitVolume& hitVolume : m_animatedHitVolumes)
+        {
+            m_rewindSlots.push_back(hitVolume.m_rewindSlot);
+        }
+        m_rewoundTransforms.resize(m_animatedHitVolumes.size());
     }
 
     void NetworkHitVolumesComponent::DestroyHitVolumes()
     {
+        // Hit volumes are moved around inside m_animatedHitVolumes, so their rewind slots are released here rather than on destruction
+        NetworkRewindHistory& rewindHistory = GetNetworkTime()->GetRewindHistory();
+        for (RewindSlot rewindSlot : m_rewindSlots)
+        {
+            rewindHistory.RemoveSlot(rewindSlot);
+        }
+        m_rewindSlots.clear();
+        m_rewoundTransforms.clear();
         m_animatedHitVolumes.clear();
     }
 
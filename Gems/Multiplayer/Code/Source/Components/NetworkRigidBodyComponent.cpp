@@ -16,6 +16,12 @@ namespace Multiplayer
     AZ_CVAR_EXTERNED(float, bg_RewindPositionTolerance);
     AZ_CVAR_EXTERNED(float, bg_RewindOrientationTolerance);
 
+#if AZ_TRAIT_SERVER
+    AZ_CVAR(float, sv_RigidBodySleepThresholdScale, 1.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Scales the sleep threshold of authoritative network rigid bodies when physics is enabled. "
+        "Values above 1 let resting bodies and their simulation islands fall asleep sooner, so that they stop costing server simulation time.");
+#endif
+
     void NetworkRigidBodyComponent::NetworkRigidBodyComponent::Reflect(AZ::ReflectContext* context)
     {
         AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context);
@@ -155,6 +161,10 @@ namespace Multiplayer
             {
                 rigidBody->SetLinearVelocity(GetLinearVelocity());
                 rigidBody->SetAngularVelocity(GetAngularVelocity());
+                if (sv_RigidBodySleepThresholdScale != 1.0f)
+                {
+                    rigidBody->SetSleepThreshold(rigidBody->GetSleepThreshold() * AZ::GetMax(0.0f, static_cast<float>(sv_RigidBodySleepThresholdScale)));
+                }
                 GetEntity()->GetTransform()->BindTransformChangedEventHandler(m_transformChangedHandler);
             }
         }
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/EntityDomains/SpatialEntityDomain.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzFramework/Entity/EntityDebugDisplayBus.h>
+
+namespace Multiplayer
+{
+    SpatialEntityDomain::SpatialEntityDomain(const AZ::Aabb& aabb)
+        : m_aabb(aabb)
+    {
+        ;
+    }
+
+    void SpatialEntityDomain::SetAabb(const AZ::Aabb& aabb)
+    {
+        m_aabb = aabb;
+    }
+
+    const AZ::Aabb& SpatialEntityDomain::GetAabb() const
+    {
+        return m_aabb;
+    }
+
+    bool SpatialEntityDomain::IsInDomain(const ConstNetworkEntityHandle& entityHandle) const
+    {
+        const AZ::Entity* entity = entityHandle.GetEntity();
+        AZ::TransformInterface* transformInterface = entity ? entity->GetTransform() : nullptr;
+        if (transformInterface == nullptr)
+        {
+            return false;
+        }
+        return ContainsPosition(transformInterface->GetWorldTranslation());
+    }
+
+    void SpatialEntityDomain::HandleLossOfAuthoritativeReplicator(const ConstNetworkEntityHandle& entityHandle)
+    {
+        // If the previous authority went away while the entity was inside our region, we're the host best placed to simulate it
+        // Otherwise we leave it for the host whose region contains it, and if no such host exists the migrate timeout will clean it up
+        if (IsInDomain(entityHandle))
+        {
+            AZLOG_WARN("Lost authoritative replicator for entity id %llu, assuming authority", aznumeric_cast<AZ::u64>(entityHandle.GetNetEntityId()));
+            GetNetworkEntityManager()->ForceAssumeAuthority(entityHandle);
+        }
+    }
+
+    void SpatialEntityDomain::DebugDraw() const
+    {
+        if (!m_aabb.IsValid())
+        {
+            return;
+        }
+
+        AzFramework::DebugDisplayRequestBus::BusPtr debugDisplayBus;
+        AzFramework::DebugDisplayRequestBus::Bind(debugDisplayBus, AzFramework::g_defaultSceneEntityDebugDisplayId);
+        AzFramework::DebugDisplayRequests* debugDisplay = AzFramework::DebugDisplayRequestBus::FindFirstHandler(debugDisplayBus);
+        if (debugDisplay != nullptr)
+        {
+            debugDisplay->SetColor(AZ::Colors::Orange);
+            debugDisplay->SetAlpha(0.5f);
+            debugDisplay->DrawWireBox(m_aabb.GetMin(), m_aabb.GetMax());
+        }
+    }
+
+    bool SpatialEntityDomain::ContainsPosition(const AZ::Vector3& position) const
+    {
+        if (!m_aabb.IsValid())
+        {
+            return false;
+        }
+        return position.IsGreaterEqualThan(m_aabb.GetMin()) && position.IsLessThan(m_aabb.GetMax());
+    }
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/EntityDomains/IEntityDomain.h>
+#include <AzCore/Math/Aabb.h>
+
+namespace Multiplayer
+{
+    //! @class SpatialEntityDomain
+    //! @brief An entity domain that owns all entities whose world position lies within a region of space.
+    //! Adjacent hosts are expected to be assigned non-overlapping regions that share faces. The region is treated as half-open,
+    //! inclusive of its minimum and exclusive of its maximum, so an entity on a shared face belongs to exactly one host.
+    class SpatialEntityDomain
+        : public IEntityDomain
+    {
+    public:
+        SpatialEntityDomain() = default;
+        explicit SpatialEntityDomain(const AZ::Aabb& aabb);
+        SpatialEntityDomain(const SpatialEntityDomain& rhs) = default;
+
+        //! IEntityDomain overrides.
+        //! @{
+        void SetAabb(const AZ::Aabb& aabb) override;
+        const AZ::Aabb& GetAabb() const override;
+        bool IsInDomain(const ConstNetworkEntityHandle& entityHandle) const override;
+        void HandleLossOfAuthoritativeReplicator(const ConstNetworkEntityHandle& entityHandle) override;
+        void DebugDraw() const override;
+        //! @}
+
+        //! Returns whether or not a world position lies within this domain.
+        //! @param position the world position to check
+        //! @return true if the position lies within this domain, false otherwise
+        bool ContainsPosition(const AZ::Vector3& position) const;
+
+    private:
+        AZ::Aabb m_aabb = AZ::Aabb::CreateNull();
+    };
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/MultiplayerPacketCapture.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Utils/Utils.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(bool, bg_packetCapture, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Whether to capture every packet dispatched to the multiplayer system so the session can be replayed with sv_packetReplay");
+    AZ_CVAR(AZ::CVarFixedString, bg_packetCaptureFile, "packet_capture.mpcap", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "File the packet capture is written to, placed under <ProjectFolder>/user/metrics");
+
+    MultiplayerPacketCapture::~MultiplayerPacketCapture()
+    {
+        StopCapture();
+    }
+
+    void MultiplayerPacketCapture::TickCapture(float deltaTime, HostFrameId hostFrameId)
+    {
+        if (bg_packetCapture != IsCapturing())
+        {
+            if (bg_packetCapture)
+            {
+                const AZ::CVarFixedString fileName = bg_packetCaptureFile;
+                if (!StartCapture(fileName.c_str()))
+                {
+                    // Don't retry every tick
+                    bg_packetCapture = false;
+                }
+            }
+            else
+            {
+                StopCapture();
+            }
+        }
+
+        if (!IsCapturing())
+        {
+            return;
+        }
+
+        PacketCaptureTick tick;
+        tick.m_deltaTime = deltaTime;
+        tick.m_hostFrameId = static_cast<uint32_t>(hostFrameId);
+
+        PacketCaptureRecordHeader recordHeader;
+        recordHeader.m_recordType = PacketCaptureRecordType::Tick;
+        recordHeader.m_payloadSize = sizeof(tick);
+
+        AZStd::vector<uint8_t> records;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
+            AppendRecord(recordHeader, &tick);
+            records.swap(m_records);
+        }
+        m_stream->Write(records.size(), records.data());
+    }
+
+    bool MultiplayerPacketCapture::IsCapturing() const
+    {
+        return m_stream != nullptr;
+    }
+
+    void MultiplayerPacketCapture::RecordConnect(const AzNetworking::IConnection* connection)
+    {
+        if (!IsCapturing())
+        {
+            return;
+        }
+
+        PacketCaptureConnect connect;
+        connect.m_address = connection->GetRemoteAddress().GetAddress(AzNetworking::ByteOrder::Host);
+        connect.m_port = connection->GetRemoteAddress().GetPort(AzNetworking::ByteOrder::Host);
+        connect.m_connectionRole = static_cast<uint8_t>(connection->GetConnectionRole());
+
+        PacketCaptureRecordHeader recordHeader;
+        recordHeader.m_recordType = PacketCaptureRecordType::Connect;
+        recordHeader.m_connectionId = static_cast<uint32_t>(connection->GetConnectionId());
+        recordHeader.m_payloadSize = sizeof(connect);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
+        AppendRecord(recordHeader, &connect);
+    }
+
+    void MultiplayerPacketCapture::RecordDisconnect
+    (
+        const AzNetworking::IConnection* connection,
+        AzNetworking::DisconnectReason reason,
+        AzNetworking::TerminationEndpoint endpoint
+    )
+    {
+        if (!IsCapturing())
+        {
+            return;
+        }
+
+        PacketCaptureDisconnect disconnect;
+        disconnect.m_reason = static_cast<uint8_t>(reason);
+        disconnect.m_endpoint = static_cast<uint8_t>(endpoint);
+
+        PacketCaptureRecordHeader recordHeader;
+        recordHeader.m_recordType = PacketCaptureRecordType::Disconnect;
+        recordHeader.m_connectionId = static_cast<uint32_t>(connection->GetConnectionId());
+        recordHeader.m_payloadSize = sizeof(disconnect);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
+        AppendRecord(recordHeader, &disconnect);
+    }
+
+    void MultiplayerPacketCapture::RecordPacketReceived
+    (
+        const AzNetworking::IConnection* connection,
+        const AzNetworking::IPacketHeader& packetHeader,
+        const AzNetworking::ISerializer& serializer
+    )
+    {
+        if (!IsCapturing())
+        {
+            return;
+        }
+
+        // The packet header has already been read from the serializer, so the remainder is the packet itself
+        PacketCaptureRecordHeader recordHeader;
+        recordHeader.m_recordType = PacketCaptureRecordType::PacketReceived;
+        recordHeader.m_packetFlags = packetHeader.IsPacketFlagSet(AzNetworking::PacketFlag::Compressed) ? 1 : 0;
+        recordHeader.m_packetType = static_cast<uint16_t>(packetHeader.GetPacketType());
+        recordHeader.m_connectionId = static_cast<uint32_t>(connection->GetConnectionId());
+        recordHeader.m_packetId = static_cast<uint32_t>(packetHeader.GetPacketId());
+        recordHeader.m_payloadSize = serializer.GetCapacity() - serializer.GetSize();
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
+        AppendRecord(recordHeader, serializer.GetBuffer() + serializer.GetSize());
+    }
+
+    bool MultiplayerPacketCapture::StartCapture(const char* fileName)
+    {
+        const AZ::IO::FixedMaxPath captureFilepath = AZ::IO::FixedMaxPath(AZ::Utils::GetProjectPath()) / "user/Metrics" / fileName;
+        constexpr AZ::IO::OpenMode openMode = AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary | AZ::IO::OpenMode::ModeCreatePath;
+
+        auto stream = AZStd::make_unique<AZ::IO::SystemFileStream>(captureFilepath.c_str(), openMode);
+        if (!stream->IsOpen())
+        {
+            AZLOG_WARN("Failed to open packet capture file %s", captureFilepath.c_str());
+            return false;
+        }
+
+        const uint32_t fileHeader[] = { PacketCaptureMagic, PacketCaptureVersion };
+        stream->Write(sizeof(fileHeader), fileHeader);
+        m_stream = AZStd::move(stream);
+        AZLOG_INFO("Started packet capture to %s", captureFilepath.c_str());
+        return true;
+    }
+
+    void MultiplayerPacketCapture::StopCapture()
+    {
+        if (!IsCapturing())
+        {
+            return;
+        }
+
+        // Records gathered after the last tick are dropped so that the capture always ends on a tick boundary
+        m_stream->Close();
+        m_stream.reset();
+        m_records.clear();
+        AZLOG_INFO("Stopped packet capture");
+    }
+
+    void MultiplayerPacketCapture::AppendRecord(const PacketCaptureRecordHeader& recordHeader, const void* payload)
+    {
+        const size_t offset = m_records.size();
+        m_records.resize_no_construct(offset + sizeof(recordHeader) + recordHeader.m_payloadSize);
+        memcpy(m_records.data() + offset, &recordHeader, sizeof(recordHeader));
+        if (recordHeader.m_payloadSize > 0)
+        {
+            memcpy(m_records.data() + offset + sizeof(recordHeader), payload, recordHeader.m_payloadSize);
+        }
+    }
+}
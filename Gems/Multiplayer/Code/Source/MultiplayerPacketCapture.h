@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzNetworking/ConnectionLayer/ConnectionEnums.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/PacketLayer/IPacketHeader.h>
+#include <AzNetworking/Serialization/ISerializer.h>
+#include <Multiplayer/MultiplayerTypes.h>
+
+namespace Multiplayer
+{
+    //! Identifies packet capture files, and the version of the record layout they were written with.
+    static constexpr uint32_t PacketCaptureMagic = 0x5043504D; // 'MPCP'
+    static constexpr uint32_t PacketCaptureVersion = 1;
+
+    //! The type of each record in a packet capture file.
+    enum class PacketCaptureRecordType : uint8_t
+    {
+        Tick,           // End of a multiplayer tick, payload is a PacketCaptureTick
+        Connect,        // A connection was established, payload is a PacketCaptureConnect
+        Disconnect,     // A connection was closed, payload is a PacketCaptureDisconnect
+        PacketReceived  // A packet was dispatched to the multiplayer system, payload is the unread packet data
+    };
+
+    //! The fixed size header preceding each record in a packet capture file.
+    struct PacketCaptureRecordHeader
+    {
+        PacketCaptureRecordType m_recordType = PacketCaptureRecordType::Tick;
+        uint8_t m_packetFlags = 0;
+        uint16_t m_packetType = 0;
+        uint32_t m_connectionId = 0;
+        uint32_t m_packetId = 0;
+        uint32_t m_payloadSize = 0;
+    };
+
+    struct PacketCaptureTick
+    {
+        float m_deltaTime = 0.0f;
+        uint32_t m_hostFrameId = 0;
+    };
+
+    struct PacketCaptureConnect
+    {
+        uint32_t m_address = 0;
+        uint16_t m_port = 0;
+        uint8_t m_connectionRole = 0;
+    };
+
+    struct PacketCaptureDisconnect
+    {
+        uint8_t m_reason = 0;
+        uint8_t m_endpoint = 0;
+    };
+
+    //! @class MultiplayerPacketCapture
+    //! @brief Records every packet dispatched to the multiplayer system, along with connects, disconnects and tick boundaries, to a capture file.
+    //! Player input reaches a server as packets, so a capture contains everything required to re-run the server simulation with
+    //! MultiplayerPacketReplay. Capturing is controlled by the bg_packetCapture and bg_packetCaptureFile cvars.
+    class MultiplayerPacketCapture
+    {
+    public:
+        MultiplayerPacketCapture() = default;
+        ~MultiplayerPacketCapture();
+
+        //! Starts or stops capturing to match the capture cvars, then writes the records gathered during the tick.
+        //! @param deltaTime   the delta time of the multiplayer tick that just completed
+        //! @param hostFrameId the host frame at the end of the tick
+        void TickCapture(float deltaTime, HostFrameId hostFrameId);
+
+        //! Returns whether or not a capture is in progress.
+        //! @return true if a capture is in progress
+        bool IsCapturing() const;
+
+        //! Records a newly established connection.
+        //! @param connection the connection that was established
+        void RecordConnect(const AzNetworking::IConnection* connection);
+
+        //! Records a closed connection.
+        //! @param connection the connection that was closed
+        //! @param reason     the reason for the disconnect
+        //! @param endpoint   which endpoint initiated the disconnect
+        void RecordDisconnect(const AzNetworking::IConnection* connection, AzNetworking::DisconnectReason reason, AzNetworking::TerminationEndpoint endpoint);
+
+        //! Records a received packet, the unread contents of the serializer are captured as the packet payload.
+        //! @param connection   the connection the packet was received on
+        //! @param packetHeader the header of the received packet
+        //! @param serializer   the serializer positioned at the start of the packet payload
+        void RecordPacketReceived(const AzNetworking::IConnection* connection, const AzNetworking::IPacketHeader& packetHeader, const AzNetworking::ISerializer& serializer);
+
+    private:
+        bool StartCapture(const char* fileName);
+        void StopCapture();
+        void AppendRecord(const PacketCaptureRecordHeader& recordHeader, const void* payload);
+
+        AZStd::unique_ptr<AZ::IO::SystemFileStream> m_stream;
+        AZStd::vector<uint8_t> m_records;
+
+        // Packets may be received outside of the main thread by some network interfaces
+        AZStd::mutex m_recordMutex;
+    };
+}
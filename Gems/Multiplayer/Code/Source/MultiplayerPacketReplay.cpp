@@ -0,0 +1,459 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/MultiplayerPacketReplay.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzFramework/API/ApplicationAPI.h>
+#include <AzNetworking/PacketLayer/IPacket.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(bool, sv_packetReplay, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Whether to re-run the server simulation against the packet capture in sv_packetReplayFile, requires a host without connections");
+    AZ_CVAR(AZ::CVarFixedString, sv_packetReplayFile, "packet_capture.mpcap", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "File the packet capture is replayed from, placed under <ProjectFolder>/user/metrics");
+    AZ_CVAR(bool, sv_packetReplayExitOnComplete, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Whether to exit the application once a packet replay completes, for headless benchmark runs");
+
+    //! Describes a captured packet to the connection listener.
+    class ReplayPacketHeader final
+        : public AzNetworking::IPacketHeader
+    {
+    public:
+        explicit ReplayPacketHeader(const PacketCaptureRecordHeader& recordHeader)
+            : m_packetType(static_cast<AzNetworking::PacketType>(recordHeader.m_packetType))
+            , m_packetId(static_cast<AzNetworking::PacketId>(recordHeader.m_packetId))
+        {
+            m_packetFlags.SetBit(static_cast<uint32_t>(AzNetworking::PacketFlag::Compressed), recordHeader.m_packetFlags != 0);
+        }
+
+        AzNetworking::PacketType GetPacketType() const override
+        {
+            return m_packetType;
+        }
+
+        AzNetworking::PacketId GetPacketId() const override
+        {
+            return m_packetId;
+        }
+
+        bool IsPacketFlagSet(AzNetworking::PacketFlag flag) const override
+        {
+            return m_packetFlags.GetBit(static_cast<uint32_t>(flag));
+        }
+
+        void SetPacketFlag(AzNetworking::PacketFlag flag, bool value) override
+        {
+            m_packetFlags.SetBit(static_cast<uint32_t>(flag), value);
+        }
+
+    private:
+        AzNetworking::PacketType m_packetType;
+        AzNetworking::PacketId m_packetId;
+        AzNetworking::PacketFlagBitset m_packetFlags;
+    };
+
+    MultiplayerReplayConnection::MultiplayerReplayConnection
+    (
+        AzNetworking::ConnectionId connectionId,
+        const AzNetworking::IpAddress& address,
+        AzNetworking::ConnectionRole connectionRole,
+        MultiplayerReplayConnectionSet& connectionSet
+    )
+        : IConnection(connectionId, address)
+        , m_connectionSet(connectionSet)
+        , m_connectionRole(connectionRole)
+    {
+        ;
+    }
+
+    bool MultiplayerReplayConnection::SendReliablePacket(const AzNetworking::IPacket& packet)
+    {
+        return SendPacket(packet);
+    }
+
+    AzNetworking::PacketId MultiplayerReplayConnection::SendUnreliablePacket(const AzNetworking::IPacket& packet)
+    {
+        return SendPacket(packet) ? m_nextPacketId++ : AzNetworking::InvalidPacketId;
+    }
+
+    bool MultiplayerReplayConnection::WasPacketAcked(AzNetworking::PacketId packetId) const
+    {
+        // Replay models a perfect network, so everything sent has been received
+        return packetId < m_nextPacketId;
+    }
+
+    AzNetworking::ConnectionState MultiplayerReplayConnection::GetConnectionState() const
+    {
+        return m_state;
+    }
+
+    AzNetworking::ConnectionRole MultiplayerReplayConnection::GetConnectionRole() const
+    {
+        return m_connectionRole;
+    }
+
+    bool MultiplayerReplayConnection::Disconnect(AzNetworking::DisconnectReason reason, AzNetworking::TerminationEndpoint endpoint)
+    {
+        if (m_state != AzNetworking::ConnectionState::Connected)
+        {
+            return false;
+        }
+
+        // Like the network interfaces, notify the listener immediately but defer deleting the connection, we may be mid visit
+        m_state = AzNetworking::ConnectionState::Disconnecting;
+        m_connectionSet.GetConnectionListener().OnDisconnect(this, reason, endpoint);
+        m_state = AzNetworking::ConnectionState::Disconnected;
+        m_connectionSet.m_queuedRemoves.push_back(GetConnectionId());
+        return true;
+    }
+
+    void MultiplayerReplayConnection::SetConnectionMtu(uint32_t connectionMtu)
+    {
+        m_connectionMtu = connectionMtu;
+    }
+
+    uint32_t MultiplayerReplayConnection::GetConnectionMtu() const
+    {
+        return m_connectionMtu;
+    }
+
+    uint64_t MultiplayerReplayConnection::GetSentBytes() const
+    {
+        return m_sentBytes;
+    }
+
+    bool MultiplayerReplayConnection::SendPacket(const AzNetworking::IPacket& packet)
+    {
+        if (m_state != AzNetworking::ConnectionState::Connected)
+        {
+            return false;
+        }
+
+        // Serialize the packet so replays measure the same serialization cost and bandwidth as a real connection
+        AzNetworking::PacketEncodingBuffer buffer;
+        AzNetworking::NetworkInputSerializer serializer(buffer.GetBuffer(), static_cast<uint32_t>(buffer.GetCapacity()));
+        if (!const_cast<AzNetworking::IPacket&>(packet).Serialize(serializer))
+        {
+            AZ_Assert(false, "SendPacket: Unable to serialize packet [Type: %d]", packet.GetPacketType());
+            return false;
+        }
+
+        m_sentBytes += serializer.GetSize();
+        GetMetrics().LogPacketSent(serializer.GetSize(), AZ::GetElapsedTimeMs());
+        return true;
+    }
+
+    MultiplayerReplayConnectionSet::MultiplayerReplayConnectionSet(AzNetworking::IConnectionListener& connectionListener)
+        : m_connectionListener(connectionListener)
+    {
+        ;
+    }
+
+    MultiplayerReplayConnection* MultiplayerReplayConnectionSet::AddConnection
+    (
+        AzNetworking::ConnectionId connectionId,
+        const AzNetworking::IpAddress& address,
+        AzNetworking::ConnectionRole connectionRole
+    )
+    {
+        if (m_connections.find(connectionId) != m_connections.end())
+        {
+            return nullptr;
+        }
+
+        auto connection = AZStd::make_unique<MultiplayerReplayConnection>(connectionId, address, connectionRole, *this);
+        MultiplayerReplayConnection* result = connection.get();
+        m_connections.emplace(connectionId, AZStd::move(connection));
+        m_nextConnectionId = AZStd::max(m_nextConnectionId, connectionId + AzNetworking::ConnectionId{ 1 });
+        return result;
+    }
+
+    void MultiplayerReplayConnectionSet::FlushQueuedRemoves()
+    {
+        for (AzNetworking::ConnectionId connectionId : m_queuedRemoves)
+        {
+            DeleteConnection(connectionId);
+        }
+        m_queuedRemoves.clear();
+    }
+
+    uint64_t MultiplayerReplayConnectionSet::GetSentBytes() const
+    {
+        uint64_t sentBytes = m_removedSentBytes;
+        for (const auto& connection : m_connections)
+        {
+            sentBytes += connection.second->GetSentBytes();
+        }
+        return sentBytes;
+    }
+
+    AzNetworking::IConnectionListener& MultiplayerReplayConnectionSet::GetConnectionListener()
+    {
+        return m_connectionListener;
+    }
+
+    void MultiplayerReplayConnectionSet::VisitConnections(const ConnectionVisitor& visitor)
+    {
+        for (auto& connection : m_connections)
+        {
+            visitor(*connection.second);
+        }
+    }
+
+    bool MultiplayerReplayConnectionSet::DeleteConnection(AzNetworking::ConnectionId connectionId)
+    {
+        auto connection = m_connections.find(connectionId);
+        if (connection == m_connections.end())
+        {
+            return false;
+        }
+        m_removedSentBytes += connection->second->GetSentBytes();
+        m_connections.erase(connection);
+        return true;
+    }
+
+    AzNetworking::IConnection* MultiplayerReplayConnectionSet::GetConnection(AzNetworking::ConnectionId connectionId) const
+    {
+        auto connection = m_connections.find(connectionId);
+        return (connection != m_connections.end()) ? connection->second.get() : nullptr;
+    }
+
+    AzNetworking::ConnectionId MultiplayerReplayConnectionSet::GetNextConnectionId()
+    {
+        return m_nextConnectionId;
+    }
+
+    uint32_t MultiplayerReplayConnectionSet::GetConnectionCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_connections.size());
+    }
+
+    uint32_t MultiplayerReplayConnectionSet::GetActiveConnectionCount() const
+    {
+        uint32_t activeConnectionCount = 0;
+        for (const auto& connection : m_connections)
+        {
+            if (connection.second->GetConnectionState() == AzNetworking::ConnectionState::Connected)
+            {
+                ++activeConnectionCount;
+            }
+        }
+        return activeConnectionCount;
+    }
+
+    MultiplayerPacketReplay::MultiplayerPacketReplay(AzNetworking::IConnectionListener& connectionListener)
+        : m_connectionListener(connectionListener)
+        , m_connectionSet(connectionListener)
+    {
+        ;
+    }
+
+    MultiplayerPacketReplay::~MultiplayerPacketReplay()
+    {
+        StopReplay();
+    }
+
+    bool MultiplayerPacketReplay::TickReplay(float& deltaTime)
+    {
+        if (sv_packetReplay != IsReplaying())
+        {
+            if (sv_packetReplay)
+            {
+                const AZ::CVarFixedString fileName = sv_packetReplayFile;
+                if (!StartReplay(fileName.c_str()))
+                {
+                    // Don't retry every tick
+                    sv_packetReplay = false;
+                }
+            }
+            else
+            {
+                StopReplay();
+            }
+        }
+
+        if (!IsReplaying())
+        {
+            return false;
+        }
+
+        m_connectionSet.FlushQueuedRemoves();
+
+        // Dispatch every record up to and including the end of the next captured tick
+        while (m_captureOffset + sizeof(PacketCaptureRecordHeader) <= m_capture.size())
+        {
+            PacketCaptureRecordHeader recordHeader;
+            memcpy(&recordHeader, m_capture.data() + m_captureOffset, sizeof(recordHeader));
+
+            const size_t payloadOffset = m_captureOffset + sizeof(recordHeader);
+            if (payloadOffset + recordHeader.m_payloadSize > m_capture.size())
+            {
+                AZLOG_WARN("Packet capture is truncated, ending replay");
+                break;
+            }
+            m_captureOffset = payloadOffset + recordHeader.m_payloadSize;
+
+            if (ReplayRecord(recordHeader, m_capture.data() + payloadOffset, deltaTime))
+            {
+                ++m_replayedTicks;
+                return true;
+            }
+        }
+
+        const double replaySeconds = AZStd::chrono::duration<double>(AZStd::chrono::steady_clock::now() - m_startTime).count();
+        AZLOG_INFO
+        (
+            "Completed packet replay of %u ticks and %u packets in %.3f seconds, %llu bytes sent",
+            m_replayedTicks,
+            m_replayedPackets,
+            replaySeconds,
+            aznumeric_cast<AZ::u64>(m_connectionSet.GetSentBytes())
+        );
+        StopReplay();
+        sv_packetReplay = false;
+
+        if (sv_packetReplayExitOnComplete)
+        {
+            AzFramework::ApplicationRequests::Bus::Broadcast(&AzFramework::ApplicationRequests::ExitMainLoop);
+        }
+        return false;
+    }
+
+    bool MultiplayerPacketReplay::IsReplaying() const
+    {
+        return !m_capture.empty();
+    }
+
+    AzNetworking::IConnectionSet& MultiplayerPacketReplay::GetConnectionSet()
+    {
+        return m_connectionSet;
+    }
+
+    bool MultiplayerPacketReplay::StartReplay(const char* fileName)
+    {
+        const AZ::IO::FixedMaxPath captureFilepath = AZ::IO::FixedMaxPath(AZ::Utils::GetProjectPath()) / "user/Metrics" / fileName;
+        AZ::IO::SystemFileStream stream(captureFilepath.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+        if (!stream.IsOpen())
+        {
+            AZLOG_WARN("Failed to open packet capture file %s", captureFilepath.c_str());
+            return false;
+        }
+
+        uint32_t fileHeader[2] = { 0, 0 };
+        const size_t captureSize = aznumeric_cast<size_t>(stream.GetLength());
+        if ((captureSize <= sizeof(fileHeader)) || (stream.Read(sizeof(fileHeader), fileHeader) != sizeof(fileHeader))
+            || (fileHeader[0] != PacketCaptureMagic) || (fileHeader[1] != PacketCaptureVersion))
+        {
+            AZLOG_WARN("File %s is not a supported packet capture", captureFilepath.c_str());
+            return false;
+        }
+
+        m_capture.resize_no_construct(captureSize - sizeof(fileHeader));
+        if (stream.Read(m_capture.size(), m_capture.data()) != m_capture.size())
+        {
+            AZLOG_WARN("Failed to read packet capture file %s", captureFilepath.c_str());
+            m_capture.clear();
+            return false;
+        }
+
+        m_captureOffset = 0;
+        m_replayedTicks = 0;
+        m_replayedPackets = 0;
+        m_startTime = AZStd::chrono::steady_clock::now();
+        AZLOG_INFO("Started packet replay from %s", captureFilepath.c_str());
+        return true;
+    }
+
+    void MultiplayerPacketReplay::StopReplay()
+    {
+        if (!IsReplaying())
+        {
+            return;
+        }
+
+        auto visitor = [](AzNetworking::IConnection& connection)
+        {
+            connection.Disconnect(AzNetworking::DisconnectReason::TerminatedByServer, AzNetworking::TerminationEndpoint::Local);
+        };
+        m_connectionSet.VisitConnections(visitor);
+        m_connectionSet.FlushQueuedRemoves();
+
+        m_capture.clear();
+        m_captureOffset = 0;
+        AZLOG_INFO("Stopped packet replay");
+    }
+
+    bool MultiplayerPacketReplay::ReplayRecord(const PacketCaptureRecordHeader& recordHeader, const uint8_t* payload, float& outDeltaTime)
+    {
+        const AzNetworking::ConnectionId connectionId = static_cast<AzNetworking::ConnectionId>(recordHeader.m_connectionId);
+        switch (recordHeader.m_recordType)
+        {
+        case PacketCaptureRecordType::Tick:
+            {
+                PacketCaptureTick tick;
+                memcpy(&tick, payload, AZStd::min<size_t>(sizeof(tick), recordHeader.m_payloadSize));
+                outDeltaTime = tick.m_deltaTime;
+            }
+            return true;
+        case PacketCaptureRecordType::Connect:
+            {
+                PacketCaptureConnect connect;
+                memcpy(&connect, payload, AZStd::min<size_t>(sizeof(connect), recordHeader.m_payloadSize));
+                const AzNetworking::IpAddress address(AzNetworking::ByteOrder::Host, connect.m_address, connect.m_port);
+                MultiplayerReplayConnection* connection = m_connectionSet.AddConnection(
+                    connectionId, address, static_cast<AzNetworking::ConnectionRole>(connect.m_connectionRole));
+                if (connection != nullptr)
+                {
+                    m_connectionListener.OnConnect(connection);
+                }
+            }
+            break;
+        case PacketCaptureRecordType::Disconnect:
+            {
+                PacketCaptureDisconnect disconnect;
+                memcpy(&disconnect, payload, AZStd::min<size_t>(sizeof(disconnect), recordHeader.m_payloadSize));
+                if (AzNetworking::IConnection* connection = m_connectionSet.GetConnection(connectionId))
+                {
+                    // Disconnects the replayed simulation already initiated are ignored by the connection
+                    connection->Disconnect(
+                        static_cast<AzNetworking::DisconnectReason>(disconnect.m_reason),
+                        static_cast<AzNetworking::TerminationEndpoint>(disconnect.m_endpoint));
+                }
+            }
+            break;
+        case PacketCaptureRecordType::PacketReceived:
+            {
+                AzNetworking::IConnection* connection = m_connectionSet.GetConnection(connectionId);
+                if ((connection == nullptr) || (connection->GetConnectionState() != AzNetworking::ConnectionState::Connected))
+                {
+                    break;
+                }
+
+                ReplayPacketHeader packetHeader(recordHeader);
+                AzNetworking::NetworkOutputSerializer serializer(payload, recordHeader.m_payloadSize);
+                if (m_connectionListener.OnPacketReceived(connection, packetHeader, serializer) == AzNetworking::PacketDispatchResult::Failure)
+                {
+                    AZLOG_WARN("Replayed packet of type %u failed to dispatch on connection %u",
+                        aznumeric_cast<uint32_t>(recordHeader.m_packetType), aznumeric_cast<uint32_t>(connectionId));
+                }
+                ++m_replayedPackets;
+            }
+            break;
+        default:
+            AZLOG_WARN("Unknown packet capture record type %u, skipping", aznumeric_cast<uint32_t>(recordHeader.m_recordType));
+            break;
+        }
+        return false;
+    }
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/ConnectionLayer/IConnectionListener.h>
+#include <AzNetworking/ConnectionLayer/IConnectionSet.h>
+#include <AzNetworking/DataStructures/ByteBuffer.h>
+#include <Source/MultiplayerPacketCapture.h>
+
+namespace Multiplayer
+{
+    class MultiplayerReplayConnectionSet;
+
+    //! @class MultiplayerReplayConnection
+    //! @brief A connection to a captured remote endpoint, used to replay a packet capture without a network.
+    //! Sent packets are serialized and counted but go nowhere, and every sent packet is immediately considered acknowledged.
+    class MultiplayerReplayConnection final
+        : public AzNetworking::IConnection
+    {
+    public:
+        MultiplayerReplayConnection
+        (
+            AzNetworking::ConnectionId connectionId,
+            const AzNetworking::IpAddress& address,
+            AzNetworking::ConnectionRole connectionRole,
+            MultiplayerReplayConnectionSet& connectionSet
+        );
+        ~MultiplayerReplayConnection() override = default;
+
+        //! IConnection interface
+        //! @{
+        bool SendReliablePacket(const AzNetworking::IPacket& packet) override;
+        AzNetworking::PacketId SendUnreliablePacket(const AzNetworking::IPacket& packet) override;
+        bool WasPacketAcked(AzNetworking::PacketId packetId) const override;
+        AzNetworking::ConnectionState GetConnectionState() const override;
+        AzNetworking::ConnectionRole GetConnectionRole() const override;
+        bool Disconnect(AzNetworking::DisconnectReason reason, AzNetworking::TerminationEndpoint endpoint) override;
+        void SetConnectionMtu(uint32_t connectionMtu) override;
+        uint32_t GetConnectionMtu() const override;
+        //! @}
+
+        //! Returns the total number of bytes sent on this connection.
+        //! @return the total number of bytes sent on this connection
+        uint64_t GetSentBytes() const;
+
+    private:
+        bool SendPacket(const AzNetworking::IPacket& packet);
+
+        MultiplayerReplayConnectionSet& m_connectionSet;
+        AzNetworking::ConnectionRole m_connectionRole = AzNetworking::ConnectionRole::Acceptor;
+        AzNetworking::ConnectionState m_state = AzNetworking::ConnectionState::Connected;
+        AzNetworking::PacketId m_nextPacketId = AzNetworking::PacketId{ 1 };
+        uint32_t m_connectionMtu = AzNetworking::MaxUdpTransmissionUnit;
+        uint64_t m_sentBytes = 0;
+    };
+
+    //! @class MultiplayerReplayConnectionSet
+    //! @brief The set of connections re-created while replaying a packet capture.
+    class MultiplayerReplayConnectionSet final
+        : public AzNetworking::IConnectionSet
+    {
+    public:
+        explicit MultiplayerReplayConnectionSet(AzNetworking::IConnectionListener& connectionListener);
+        ~MultiplayerReplayConnectionSet() override = default;
+
+        //! Adds a connection with the provided captured connection identifier.
+        //! @param connectionId   the captured connection identifier
+        //! @param address        the captured remote address
+        //! @param connectionRole the captured connection role
+        //! @return pointer to the added connection, or nullptr if the connection identifier is already in use
+        MultiplayerReplayConnection* AddConnection(AzNetworking::ConnectionId connectionId, const AzNetworking::IpAddress& address, AzNetworking::ConnectionRole connectionRole);
+
+        //! Deletes connections that were disconnected since the last call.
+        void FlushQueuedRemoves();
+
+        //! Returns the total number of bytes sent on all connections, including connections that have since been deleted.
+        //! @return the total number of bytes sent on all connections
+        uint64_t GetSentBytes() const;
+
+        AzNetworking::IConnectionListener& GetConnectionListener();
+
+        //! IConnectionSet interface
+        //! @{
+        void VisitConnections(const ConnectionVisitor& visitor) override;
+        bool DeleteConnection(AzNetworking::ConnectionId connectionId) override;
+        AzNetworking::IConnection* GetConnection(AzNetworking::ConnectionId connectionId) const override;
+        AzNetworking::ConnectionId GetNextConnectionId() override;
+        uint32_t GetConnectionCount() const override;
+        uint32_t GetActiveConnectionCount() const override;
+        //! @}
+
+    private:
+        friend class MultiplayerReplayConnection;
+
+        AzNetworking::IConnectionListener& m_connectionListener;
+        AZStd::unordered_map<AzNetworking::ConnectionId, AZStd::unique_ptr<MultiplayerReplayConnection>> m_connections;
+        AZStd::vector<AzNetworking::ConnectionId> m_queuedRemoves;
+        AzNetworking::ConnectionId m_nextConnectionId = AzNetworking::ConnectionId{ 0 };
+        uint64_t m_removedSentBytes = 0;
+    };
+
+    //! @class MultiplayerPacketReplay
+    //! @brief Re-runs a server simulation against a capture written by MultiplayerPacketCapture.
+    //! Each multiplayer tick dispatches the records of the next captured tick to the connection listener and substitutes the captured
+    //! delta time, so the simulation advances identically to the captured session however fast the replaying host ticks.
+    //! Replay is controlled by the sv_packetReplay and sv_packetReplayFile cvars, and only runs on hosts without real connections.
+    class MultiplayerPacketReplay
+    {
+    public:
+        explicit MultiplayerPacketReplay(AzNetworking::IConnectionListener& connectionListener);
+        ~MultiplayerPacketReplay();
+
+        //! Starts or stops replay to match the replay cvars, then dispatches the records of the next captured tick.
+        //! @param deltaTime the delta time of the current tick, replaced with the captured delta time while replaying
+        //! @return true if a captured tick was replayed
+        bool TickReplay(float& deltaTime);
+
+        //! Returns whether or not a replay is in progress.
+        //! @return true if a replay is in progress
+        bool IsReplaying() const;
+
+        //! Returns the connections re-created by the replay.
+        //! @return the connections re-created by the replay
+        AzNetworking::IConnectionSet& GetConnectionSet();
+
+    private:
+        bool StartReplay(const char* fileName);
+        void StopReplay();
+        bool ReplayRecord(const PacketCaptureRecordHeader& recordHeader, const uint8_t* payload, float& outDeltaTime);
+
+        AzNetworking::IConnectionListener& m_connectionListener;
+        MultiplayerReplayConnectionSet m_connectionSet;
+        AZStd::vector<uint8_t> m_capture;
+        size_t m_captureOffset = 0;
+
+        uint32_t m_replayedTicks = 0;
+        uint32_t m_replayedPackets = 0;
+        AZStd::chrono::steady_clock::time_point m_startTime;
+    };
+}
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/MultiplayerReplicationCapture.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/Utils/Utils.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/MultiplayerComponentRegistry.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(bool, bg_replicationCapture, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Whether to capture per tick replication bytes and serialization time for each connection, component, property and RPC");
+    AZ_CVAR(AZ::CVarFixedString, bg_replicationCaptureFile, "replication_capture.csv", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "File the replication capture is written to, placed under <ProjectFolder>/user/metrics");
+
+    // Used to attribute serialization time to individual components, serialization may occur on connection update jobs
+    static thread_local AZStd::chrono::steady_clock::time_point s_serializeMarkTime;
+
+    static const char* GetRecordTypeString(uint8_t recordType)
+    {
+        static const char* RecordTypeStrings[] =
+        {
+            "PropertySent",
+            "PropertyReceived",
+            "RpcSent",
+            "RpcReceived",
+            "SerializeSend",
+            "SerializeReceive"
+        };
+        return (recordType < AZ_ARRAY_SIZE(RecordTypeStrings)) ? RecordTypeStrings[recordType] : "Unknown";
+    }
+
+    bool MultiplayerReplicationCapture::RecordKey::operator==(const RecordKey& rhs) const
+    {
+        return (m_connectionId == rhs.m_connectionId)
+            && (m_netComponentId == rhs.m_netComponentId)
+            && (m_index == rhs.m_index)
+            && (m_recordType == rhs.m_recordType);
+    }
+
+    size_t MultiplayerReplicationCapture::RecordKeyHasher::operator()(const RecordKey& key) const
+    {
+        size_t result = 0;
+        AZStd::hash_combine(result, static_cast<uint32_t>(key.m_connectionId));
+        AZStd::hash_combine(result, static_cast<uint16_t>(key.m_netComponentId));
+        AZStd::hash_combine(result, key.m_index);
+        AZStd::hash_combine(result, static_cast<uint8_t>(key.m_recordType));
+        return result;
+    }
+
+    MultiplayerReplicationCapture::MultiplayerReplicationCapture()
+    {
+        m_eventHandlers.m_entitySerializeStart = decltype(m_eventHandlers.m_entitySerializeStart)(
+            [this](AzNetworking::SerializerMode, AZ::EntityId, const char*)
+            {
+                RecordEntitySerializeStart();
+            });
+        m_eventHandlers.m_componentSerializeEnd = decltype(m_eventHandlers.m_componentSerializeEnd)(
+            [this](AzNetworking::SerializerMode mode, NetComponentId netComponentId)
+            {
+                RecordComponentSerializeEnd(mode, netComponentId);
+            });
+        m_eventHandlers.m_entitySerializeStop = decltype(m_eventHandlers.m_entitySerializeStop)(
+            [](AzNetworking::SerializerMode, AZ::EntityId, const char*)
+            {
+                ;
+            });
+        m_eventHandlers.m_propertySent = decltype(m_eventHandlers.m_propertySent)(
+            [this](NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
+            {
+                Record(RecordType::PropertySent, netComponentId, aznumeric_cast<uint16_t>(propertyId), totalBytes, 0);
+            });
+        m_eventHandlers.m_propertyReceived = decltype(m_eventHandlers.m_propertyReceived)(
+            [this](NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
+            {
+                Record(RecordType::PropertyReceived, netComponentId, aznumeric_cast<uint16_t>(propertyId), totalBytes, 0);
+            });
+        m_eventHandlers.m_rpcSent = decltype(m_eventHandlers.m_rpcSent)(
+            [this](AZ::EntityId, const char*, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes)
+            {
+                Record(RecordType::RpcSent, netComponentId, aznumeric_cast<uint16_t>(rpcId), totalBytes, 0);
+            });
+        m_eventHandlers.m_rpcReceived = decltype(m_eventHandlers.m_rpcReceived)(
+            [this](AZ::EntityId, const char*, NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes)
+            {
+                Record(RecordType::RpcReceived, netComponentId, aznumeric_cast<uint16_t>(rpcId), totalBytes, 0);
+            });
+    }
+
+    MultiplayerReplicationCapture::~MultiplayerReplicationCapture()
+    {
+        StopCapture();
+    }
+
+    void MultiplayerReplicationCapture::TickCapture(HostFrameId hostFrameId)
+    {
+        if (bg_replicationCapture != IsCapturing())
+        {
+            if (bg_replicationCapture)
+            {
+                const AZ::CVarFixedString fileName = bg_replicationCaptureFile;
+                if (!StartCapture(fileName.c_str()))
+                {
+                    // Don't retry every tick
+                    bg_replicationCapture = false;
+                }
+            }
+            else
+            {
+                StopCapture();
+            }
+        }
+
+        if (!IsCapturing())
+        {
+            return;
+        }
+
+        AZStd::unordered_map<RecordKey, RecordValue, RecordKeyHasher> records;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
+            records.swap(m_records);
+        }
+
+        if (records.empty())
+        {
+            return;
+        }
+
+        const MultiplayerComponentRegistry* componentRegistry = GetMultiplayerComponentRegistry();
+        AZStd::string output;
+        for (const auto& [key, value] : records)
+        {
+            const char* componentName = componentRegistry ? componentRegistry->GetComponentName(key.m_netComponentId) : "";
+            const char* memberName = "";
+            switch (key.m_recordType)
+            {
+            case RecordType::PropertySent:
+            case RecordType::PropertyReceived:
+                memberName = componentRegistry ? componentRegistry->GetComponentPropertyName(key.m_netComponentId, aznumeric_cast<PropertyIndex>(key.m_index)) : "";
+                break;
+            case RecordType::RpcSent:
+            case RecordType::RpcReceived:
+                memberName = componentRegistry ? componentRegistry->GetComponentRpcName(key.m_netComponentId, aznumeric_cast<RpcIndex>(key.m_index)) : "";
+                break;
+            default:
+                break;
+            }
+
+            output += AZStd::string::format("%u,%u,%s,%s,%s,%llu,%llu,%.3f\n",
+                static_cast<uint32_t>(hostFrameId),
+                static_cast<uint32_t>(key.m_connectionId),
+                GetRecordTypeString(static_cast<uint8_t>(key.m_recordType)),
+                componentName,
+                memberName,
+                aznumeric_cast<AZ::u64>(value.m_calls),
+                aznumeric_cast<AZ::u64>(value.m_bytes),
+                static_cast<double>(value.m_serializeTimeNs) / 1000.0);
+        }
+        m_stream->Write(output.size(), output.data());
+    }
+
+    bool MultiplayerReplicationCapture::IsCapturing() const
+    {
+        return m_stream != nullptr;
+    }
+
+    bool MultiplayerReplicationCapture::StartCapture(const char* fileName)
+    {
+        const AZ::IO::FixedMaxPath captureFilepath = AZ::IO::FixedMaxPath(AZ::Utils::GetProjectPath()) / "user/Metrics" / fileName;
+        constexpr AZ::IO::OpenMode openMode = AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeCreatePath;
+
+        auto stream = AZStd::make_unique<AZ::IO::SystemFileStream>(captureFilepath.c_str(), openMode);
+        if (!stream->IsOpen())
+        {
+            AZLOG_WARN("Failed to open replication capture file %s", captureFilepath.c_str());
+            return false;
+        }
+
+        static const char CaptureHeader[] = "HostFrameId,ConnectionId,Type,Component,Member,Calls,Bytes,SerializeTimeUs\n";
+        stream->Write(sizeof(CaptureHeader) - 1, CaptureHeader);
+        m_stream = AZStd::move(stream);
+
+        // Only listen to stats events while capturing, so captures cost nothing when disabled
+        GetMultiplayer()->GetStats().ConnectHandlers(m_eventHandlers);
+        AZLOG_INFO("Started replication capture to %s", captureFilepath.c_str());
+        return true;
+    }
+
+    void MultiplayerReplicationCapture::StopCapture()
+    {
+        if (!IsCapturing())
+        {
+            return;
+        }
+
+        m_eventHandlers.m_entitySerializeStart.Disconnect();
+        m_eventHandlers.m_componentSerializeEnd.Disconnect();
+        m_eventHandlers.m_entitySerializeStop.Disconnect();
+        m_eventHandlers.m_propertySent.Disconnect();
+        m_eventHandlers.m_propertyReceived.Disconnect();
+        m_eventHandlers.m_rpcSent.Disconnect();
+        m_eventHandlers.m_rpcReceived.Disconnect();
+
+        m_stream->Close();
+        m_stream.reset();
+        m_records.clear();
+        AZLOG_INFO("Stopped replication capture");
+    }
+
+    void MultiplayerReplicationCapture::Record
+    (
+        RecordType recordType,
+        NetComponentId netComponentId,
+        uint16_t index,
+        uint32_t bytes,
+        uint64_t serializeTimeNs
+    )
+    {
+        RecordKey key;
+        key.m_connectionId = MultiplayerStats::GetRecordConnectionId();
+        key.m_netComponentId = netComponentId;
+        key.m_index = index;
+        key.m_recordType = recordType;
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
+        RecordValue& value = m_records[key];
+        ++value.m_calls;
+        value.m_bytes += bytes;
+        value.m_serializeTimeNs += serializeTimeNs;
+    }
+
+    void MultiplayerReplicationCapture::RecordEntitySerializeStart()
+    {
+        s_serializeMarkTime = AZStd::chrono::steady_clock::now();
+    }
+
+    void MultiplayerReplicationCapture::RecordComponentSerializeEnd(AzNetworking::SerializerMode mode, NetComponentId netComponentId)
+    {
+        // Components are serialized back to back, so each component's time runs from the end of the previous one
+        const AZStd::chrono::steady_clock::time_point now = AZStd::chrono::steady_clock::now();
+        const uint64_t serializeTimeNs = aznumeric_cast<uint64_t>(AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(now - s_serializeMarkTime).count());
+        s_serializeMarkTime = now;
+
+        const RecordType recordType = (mode == AzNetworking::SerializerMode::ReadFromObject) ? RecordType::SerializeSend : RecordType::SerializeReceive;
+        Record(recordType, netComponentId, 0, 0, serializeTimeNs);
+    }
+}
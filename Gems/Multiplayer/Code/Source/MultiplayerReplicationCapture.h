@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <Multiplayer/MultiplayerStats.h>
+
+namespace Multiplayer
+{
+    //! @class MultiplayerReplicationCapture
+    //! @brief Records per tick replication bytes and serialization time to a file for offline analysis.
+    //! Unlike the reporters in the debug module this has no UI, so it can be used on headless servers. While capturing, one CSV row
+    //! is written each tick for every connection, component and property or RPC that sent or received data during the tick.
+    //! Capturing is controlled by the bg_replicationCapture and bg_replicationCaptureFile cvars.
+    class MultiplayerReplicationCapture
+    {
+    public:
+        MultiplayerReplicationCapture();
+        ~MultiplayerReplicationCapture();
+
+        //! Starts or stops capturing to match the capture cvars, then writes and clears the records gathered since the last tick.
+        //! @param hostFrameId the host frame the records are written for
+        void TickCapture(HostFrameId hostFrameId);
+
+        //! Returns whether or not a capture is in progress.
+        //! @return true if a capture is in progress
+        bool IsCapturing() const;
+
+    private:
+        enum class RecordType : uint8_t
+        {
+            PropertySent,
+            PropertyReceived,
+            RpcSent,
+            RpcReceived,
+            SerializeSend,
+            SerializeReceive
+        };
+
+        struct RecordKey
+        {
+            AzNetworking::ConnectionId m_connectionId = AzNetworking::InvalidConnectionId;
+            NetComponentId m_netComponentId = InvalidNetComponentId;
+            uint16_t m_index = 0;
+            RecordType m_recordType = RecordType::PropertySent;
+
+            bool operator==(const RecordKey& rhs) const;
+        };
+
+        struct RecordKeyHasher
+        {
+            size_t operator()(const RecordKey& key) const;
+        };
+
+        struct RecordValue
+        {
+            uint64_t m_calls = 0;
+            uint64_t m_bytes = 0;
+            uint64_t m_serializeTimeNs = 0;
+        };
+
+        bool StartCapture(const char* fileName);
+        void StopCapture();
+        void Record(RecordType recordType, NetComponentId netComponentId, uint16_t index, uint32_t bytes, uint64_t serializeTimeNs);
+        void RecordEntitySerializeStart();
+        void RecordComponentSerializeEnd(AzNetworking::SerializerMode mode, NetComponentId netComponentId);
+
+        AZStd::unique_ptr<AZ::IO::SystemFileStream> m_stream;
+        AZStd::unordered_map<RecordKey, RecordValue, RecordKeyHasher> m_records;
+
+        // Records may arrive from connection update jobs when sv_multithreadedConnectionUpdates is enabled
+        AZStd::mutex m_recordMutex;
+
+        MultiplayerStats::EventHandlers m_eventHandlers;
+    };
+}
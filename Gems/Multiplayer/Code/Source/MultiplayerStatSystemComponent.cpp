@@ -46,6 +46,27 @@ namespace Multiplayer
         AZ::ConsoleFunctorFlags::DontReplicate,
         "File of the server metrics file if enabled, placed under <ProjectFolder>/user/metrics");
 
+    // Converts the names of the stats to the snake case of the Prometheus metric names, "NumEntities" to "num_entities"
+    void AppendMetricName(AZStd::string& metricName, AZStd::string_view name)
+    {
+        for (size_t index = 0; index < name.size(); ++index)
+        {
+            const char element = name[index];
+            if (isupper(element))
+            {
+                if (index > 0 && (islower(name[index - 1]) || isdigit(name[index - 1])))
+                {
+                    metricName += '_';
+                }
+                metricName += static_cast<char>(tolower(element));
+            }
+            else
+            {
+                metricName += isalnum(element) ? element : '_';
+            }
+        }
+    }
+
     void ConfigureEventLoggerHelper(const AZ::CVarFixedString& filename)
     {
         if (auto eventLoggerFactory = AZ::Interface<AZ::Metrics::IEventLoggerFactory>::Get())
@@ -108,6 +129,7 @@ namespace Multiplayer
 
     MultiplayerStatSystemComponent::~MultiplayerStatSystemComponent()
     {
+        UnregisterMetrics();
         AZ::Interface<IMultiplayerStatSystem>::Unregister(this);
     }
 
@@ -172,6 +194,10 @@ namespace Multiplayer
         {
             auto* newStat = group->m_stats.AddNew(uniqueStatId);
             newStat->m_name = statName;
+            newStat->m_metricName = "multiplayer_";
+            AppendMetricName(newStat->m_metricName, group->m_name);
+            newStat->m_metricName += '_';
+            AppendMetricName(newStat->m_metricName, statName);
 
             const auto statIterator = m_statIdToGroupId.find(uniqueStatId);
             if (statIterator == m_statIdToGroupId.end())
@@ -201,6 +227,18 @@ namespace Multiplayer
                 {
                     stat->m_lastValue = value;
                     stat->m_average.PushEntry(value);
+
+                    if (stat->m_gauge == nullptr)
+                    {
+                        if (auto* metricsRegistry = AZ::Metrics::MetricsRegistry::Get())
+                        {
+                            stat->m_gauge = metricsRegistry->RegisterGauge(stat->m_metricName, stat->m_name);
+                        }
+                    }
+                    if (stat->m_gauge)
+                    {
+                        stat->m_gauge->Set(value);
+                    }
                     return;
                 }
             }
@@ -220,6 +258,18 @@ namespace Multiplayer
                 if (CumulativeAverage* stat = group->m_stats.Find(uniqueStatId))
                 {
                     stat->m_counterValue++;
+
+                    if (stat->m_counter == nullptr)
+                    {
+                        if (auto* metricsRegistry = AZ::Metrics::MetricsRegistry::Get())
+                        {
+                            stat->m_counter = metricsRegistry->RegisterCounter(stat->m_metricName + "_total", stat->m_name);
+                        }
+                    }
+                    if (stat->m_counter)
+                    {
+                        stat->m_counter->Increment();
+                    }
                     return;
                 }
             }
@@ -273,4 +323,26 @@ namespace Multiplayer
             }
         }
     }
+
+    void MultiplayerStatSystemComponent::UnregisterMetrics()
+    {
+        auto* metricsRegistry = AZ::Metrics::MetricsRegistry::Get();
+        AZStd::lock_guard lock(m_access);
+        for (StatGroup& group : m_statGroups.m_items)
+        {
+            for (CumulativeAverage& stat : group.m_stats.m_items)
+            {
+                if (metricsRegistry && stat.m_gauge)
+                {
+                    metricsRegistry->UnregisterMetric(stat.m_gauge->GetName());
+                }
+                if (metricsRegistry && stat.m_counter)
+                {
+                    metricsRegistry->UnregisterMetric(stat.m_counter->GetName());
+                }
+                stat.m_gauge = nullptr;
+                stat.m_counter = nullptr;
+            }
+        }
+    }
 } // namespace Multiplayer
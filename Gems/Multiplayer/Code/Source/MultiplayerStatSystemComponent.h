@@ -12,12 +12,15 @@
 #include <AzCore/EBus/ScheduledEvent.h>
 #include <AzCore/IO/Streamer/Statistics.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/Metrics/IMetricsRegistry.h>
 #include <Multiplayer/MultiplayerStatSystemInterface.h>
 
 namespace Multiplayer
 {
     //! @class MultiplayerStatSystemComponent
     //! Periodically writes the metrics to AZ::EventLogger. See MultiplayerStatSystem.h for documentation.
+    //! The stats are also published to the AZ::Metrics::MetricsRegistry, as multiplayer_<group>_<stat> gauges for the set stats
+    //! and multiplayer_<group>_<stat>_total counters for the incremented stats, so dedicated servers can export them.
     class MultiplayerStatSystemComponent final
         : public AZ::Component
         , public IMultiplayerStatSystem
@@ -51,6 +54,7 @@ namespace Multiplayer
 
     private:
         void RecordMetrics();
+        void UnregisterMetrics();
         AZ::ScheduledEvent m_metricsEvent{ [this]()
                                            {
                                                RecordMetrics();
@@ -65,6 +69,11 @@ namespace Multiplayer
             AverageWindowType m_average;
             double m_lastValue = 0;
             AZ::u64 m_counterValue = 0; // Used by counters.
+
+            // Metrics of the MetricsRegistry, registered when the stat is first set or incremented
+            AZStd::string m_metricName;
+            AZ::Metrics::Gauge* m_gauge = nullptr;
+            AZ::Metrics::Counter* m_counter = nullptr;
         };
 
         //! A custom combined data structure for fast iteration and fast insertion.
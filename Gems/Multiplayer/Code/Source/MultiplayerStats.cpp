@@ -12,6 +12,9 @@
 
 namespace Multiplayer
 {
+    // Connection updates may run on job threads, so the attributed connection is tracked per thread
+    static thread_local AzNetworking::ConnectionId s_recordConnectionId = AzNetworking::InvalidConnectionId;
+
     MultiplayerStats::Metric::Metric()
     {
         AZStd::uninitialized_fill_n(m_callHistory.data(), RingbufferSamples, 0);
@@ -263,4 +266,20 @@ namespace Multiplayer
     {
         SET_PERFORMANCE_STAT(MultiplayerStat_FrameTimeUs, networkFrameTime);
     }
+
+    MultiplayerStats::ScopedRecordConnection::ScopedRecordConnection(AzNetworking::ConnectionId connectionId)
+        : m_previousConnectionId(s_recordConnectionId)
+    {
+        s_recordConnectionId = connectionId;
+    }
+
+    MultiplayerStats::ScopedRecordConnection::~ScopedRecordConnection()
+    {
+        s_recordConnectionId = m_previousConnectionId;
+    }
+
+    AzNetworking::ConnectionId MultiplayerStats::GetRecordConnectionId()
+    {
+        return s_recordConnectionId;
+    }
 } // namespace Multiplayer
@@ -15,6 +15,7 @@
 #include <ConnectionData/ServerToClientConnectionData.h>
 #include <EntityDomains/FullOwnershipEntityDomain.h>
 #include <EntityDomains/NullEntityDomain.h>
+#include <EntityDomains/SpatialEntityDomain.h>
 #include <ReplicationWindows/NullReplicationWindow.h>
 #include <ReplicationWindows/ServerToClientReplicationWindow.h>
 #include <Source/AutoGen/AutoComponentTypes.h>
@@ -98,6 +99,12 @@ namespace Multiplayer
     AZ_CVAR(bool, sv_isDedicated, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether the host command creates an independent or client hosted server");
     AZ_CVAR(bool, sv_isTransient, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "[DEPRECATED: use sv_terminateOnPlayerExit instead] Whether a dedicated server shuts down if all existing connections disconnect.");
     AZ_CVAR(bool, sv_terminateOnPlayerExit, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether a dedicated server shuts down if all existing connections disconnect.");
+    AZ_CVAR(bool, sv_useSpatialEntityDomain, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Whether the host only owns entities within the region bounded by sv_entityDomainMin and sv_entityDomainMax, migrating entities that leave it to neighbouring hosts");
+    AZ_CVAR(AZ::Vector3, sv_entityDomainMin, AZ::Vector3::CreateZero(), nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The minimum corner of the region owned by this host when sv_useSpatialEntityDomain is enabled, inclusive");
+    AZ_CVAR(AZ::Vector3, sv_entityDomainMax, AZ::Vector3::CreateZero(), nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The maximum corner of the region owned by this host when sv_useSpatialEntityDomain is enabled, exclusive");
     AZ_CVAR(AZ::TimeMs, sv_serverSendRateMs, AZ::TimeMs{ 50 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of milliseconds between each network update");
     AZ_CVAR(float, cl_renderTickBlendBase, 0.15f, nullptr, AZ::ConsoleFunctorFlags::Null,
         "The base used for blending between network updates, 0.1 will be quite linear, 0.2 or 0.3 will "
@@ -427,7 +434,7 @@ namespace Multiplayer
     {
         // Cleanup connections, fire events and uninitialize state
         auto visitor = [reason](IConnection& connection) { connection.Disconnect(reason, TerminationEndpoint::Local); };
-        m_networkInterface->GetConnectionSet().VisitConnections(visitor);
+        GetConnectionSet().VisitConnections(visitor);
         MultiplayerAgentType agentType = GetAgentType();
         if (agentType == MultiplayerAgentType::DedicatedServer || agentType == MultiplayerAgentType::ClientServer)
         {
@@ -476,6 +483,12 @@ namespace Multiplayer
         return (GetAgentType() == MultiplayerAgentType::ClientServer) || (GetAgentType() == MultiplayerAgentType::DedicatedServer);
     }
 
+    AzNetworking::IConnectionSet& MultiplayerSystemComponent::GetConnectionSet()
+    {
+        // While replaying a packet capture, the replayed connections stand in for the network interface's connections
+        return m_packetReplay.IsReplaying() ? m_packetReplay.GetConnectionSet() : m_networkInterface->GetConnectionSet();
+    }
+
 
     bool MultiplayerSystemComponent::OnCreateSessionBegin(const SessionConfig& sessionConfig)
     {
@@ -516,7 +529,7 @@ namespace Multiplayer
         }
 
         auto visitor = [](IConnection& connection) { connection.Disconnect(DisconnectReason::TerminatedByServer, TerminationEndpoint::Local); };
-        m_networkInterface->GetConnectionSet().VisitConnections(visitor);
+        GetConnectionSet().VisitConnections(visitor);
         if (GetAgentType() == MultiplayerAgentType::DedicatedServer || GetAgentType() == MultiplayerAgentType::ClientServer)
         {
             m_networkInterface->StopListening();
@@ -543,6 +556,24 @@ namespace Multiplayer
     void MultiplayerSystemComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
         AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: OnTick");
+
+        if (GetAgentType() == MultiplayerAgentType::ClientServer
+         || GetAgentType() == MultiplayerAgentType::DedicatedServer)
+        {
+            // Packet replays stand in for real connections, so they can only run while nothing is connected to this host
+            if (m_packetReplay.IsReplaying() || (m_networkInterface->GetConnectionSet().GetConnectionCount() == 0))
+            {
+                // Dispatches the packets the captured host received ahead of this tick, and substitutes the captured delta time
+                m_packetReplay.TickReplay(deltaTime);
+            }
+        }
+
+        if (!m_packetReplay.IsReplaying())
+        {
+            // Packets dispatched since the last tick are written out ahead of this tick's delta time
+            m_packetCapture.TickCapture(deltaTime, GetNetworkTime()->GetHostFrameId());
+        }
+
         SET_PERFORMANCE_STAT(MultiplayerStat_ApplicationFrameTimeUs, AZ::SecondsToTimeUs(deltaTime));
 
         const AZStd::chrono::steady_clock::time_point startMultiplayerTickTime = AZStd::chrono::steady_clock::now();
@@ -593,6 +624,9 @@ namespace Multiplayer
         // Send out the game state update to all connections
         UpdateConnections();
 
+        // Write out this tick's replication capture records, if capturing, now that both received and sent updates are recorded
+        m_replicationCapture.TickCapture(GetNetworkTime()->GetHostFrameId());
+
         MultiplayerPackets::SyncConsole packet;
         AZ::ThreadSafeDeque<AZStd::string>::DequeType cvarUpdates;
         m_cvarCommands.Swap(cvarUpdates);
@@ -610,7 +644,7 @@ namespace Multiplayer
             packet.ModifyCommandSet().emplace_back(cvarUpdates.front());
             if (packet.GetCommandSet().full())
             {
-                m_networkInterface->GetConnectionSet().VisitConnections(visitor);
+                GetConnectionSet().VisitConnections(visitor);
                 packet.ModifyCommandSet().clear();
             }
             cvarUpdates.pop_front();
@@ -619,7 +653,7 @@ namespace Multiplayer
         if (!packet.GetCommandSet().empty())
         {
             AZ_PROFILE_SCOPE(MULTIPLAYER, "MultiplayerSystemComponent: OnTick - SendReliablePackets");
-            m_networkInterface->GetConnectionSet().VisitConnections(visitor);
+            GetConnectionSet().VisitConnections(visitor);
         }
 
         const auto duration =
@@ -645,7 +679,7 @@ namespace Multiplayer
                 }
             }
         };
-        m_networkInterface->GetConnectionSet().VisitConnections(updateMetrics);
+        GetConnectionSet().VisitConnections(updateMetrics);
     }
 
     void MultiplayerSystemComponent::UpdateConnections()
@@ -664,6 +698,7 @@ namespace Multiplayer
                     {
                         if (connection.GetUserData() != nullptr)
                         {
+                            MultiplayerStats::ScopedRecordConnection recordConnection(connection.GetConnectionId());
                             IConnectionData* connectionData = static_cast<IConnectionData*>(connection.GetUserData());
                             connectionData->Update();
                         }
@@ -673,7 +708,7 @@ namespace Multiplayer
                 job->Start();
             };
 
-            m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
+            GetConnectionSet().VisitConnections(sendNetworkUpdates);
             jobCompletion.StartAndWaitForCompletion();
         }
         else // On clients (including the Editor) run in a single threaded mode to avoid issues in UI asset loading
@@ -684,12 +719,13 @@ namespace Multiplayer
             {
                 if (connection.GetUserData() != nullptr)
                 {
+                    MultiplayerStats::ScopedRecordConnection recordConnection(connection.GetConnectionId());
                     IConnectionData* connectionData = reinterpret_cast<IConnectionData*>(connection.GetUserData());
                     connectionData->Update();
                 }
             };
 
-            m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
+            GetConnectionSet().VisitConnections(sendNetworkUpdates);
         }
     }
 
@@ -831,7 +867,7 @@ namespace Multiplayer
             if (!sessionRequests->ValidatePlayerJoinSession(config))
             {
                 auto visitor = [](IConnection& connection) { connection.Disconnect(DisconnectReason::TerminatedByUser, TerminationEndpoint::Local); };
-                m_networkInterface->GetConnectionSet().VisitConnections(visitor);
+                GetConnectionSet().VisitConnections(visitor);
                 return true;
             }
         }
@@ -962,13 +998,7 @@ namespace Multiplayer
             m_networkTime.ForceSetTime(m_lastReplicatedHostFrameId, m_lastReplicatedHostTimeMs);
         }
 
-        for (AZStd::size_t i = 0; i < packet.GetEntityMessages().size(); ++i)
-        {
-            const NetworkEntityUpdateMessage& updateMessage = packet.GetEntityMessages()[i];
-            handledAll &= replicationManager.HandleEntityUpdateMessage(connection, packetHeader, updateMessage);
-            AZ_Assert(handledAll, "EntityUpdates did not handle all update messages");
-        }
-
+        handledAll &= replicationManager.HandleEntityUpdateMessages(connection, packetHeader, packet.GetEntityMessages());
         return handledAll;
     }
 
@@ -1025,7 +1055,7 @@ namespace Multiplayer
 
         // Disconnect our existing server connection
         auto visitor = [](IConnection& connection) { connection.Disconnect(DisconnectReason::ClientMigrated, TerminationEndpoint::Local); };
-        m_networkInterface->GetConnectionSet().VisitConnections(visitor);
+        GetConnectionSet().VisitConnections(visitor);
         AZLOG_INFO("Migrating to new server shard");
         m_clientMigrationStartEvent.Signal(packet.GetLastClientInputId());
         if (m_networkInterface->Connect(packet.GetRemoteServerAddress()) == AzNetworking::InvalidConnectionId)
@@ -1144,6 +1174,8 @@ namespace Multiplayer
 
     void MultiplayerSystemComponent::OnConnect(AzNetworking::IConnection* connection)
     {
+        m_packetCapture.RecordConnect(connection);
+
         AZStd::string providerTicket;
         if (connection->GetConnectionRole() == ConnectionRole::Connector)
         {
@@ -1186,6 +1218,8 @@ namespace Multiplayer
 
     AzNetworking::PacketDispatchResult MultiplayerSystemComponent::OnPacketReceived(AzNetworking::IConnection* connection, const IPacketHeader& packetHeader, ISerializer& serializer)
     {
+        MultiplayerStats::ScopedRecordConnection recordConnection(connection->GetConnectionId());
+        m_packetCapture.RecordPacketReceived(connection, packetHeader, serializer);
         return MultiplayerPackets::DispatchPacket(connection, packetHeader, serializer, *this);
     }
 
@@ -1196,6 +1230,8 @@ namespace Multiplayer
 
     void MultiplayerSystemComponent::OnDisconnect(AzNetworking::IConnection* connection, DisconnectReason reason, TerminationEndpoint endpoint)
     {
+        m_packetCapture.RecordDisconnect(connection, reason, endpoint);
+
         const char* endpointString = (endpoint == TerminationEndpoint::Local) ? "Disconnecting" : "Remotely disconnected";
         const AZStd::string reasonString = ToString(reason);
         AZLOG_INFO("%s from remote address %s due to %s", endpointString, connection->GetRemoteAddress().GetString().c_str(), reasonString.c_str());
@@ -1282,7 +1318,7 @@ namespace Multiplayer
         // We avoid this for client server as the host itself is a user and dedicated servers that do not terminate when all players have exited
         if (sv_terminateOnPlayerExit && m_agentType == MultiplayerAgentType::DedicatedServer && connection->GetConnectionRole() == ConnectionRole::Acceptor)
         {   
-            if (m_networkInterface->GetConnectionSet().GetActiveConnectionCount() == 0)
+            if (GetConnectionSet().GetActiveConnectionCount() == 0)
             {
                 AZLOG_INFO("Server exiting due to zero active connections (sv_terminateOnPlayerExit=true)");
                 Terminate(DisconnectReason::TerminatedByServer);
@@ -1338,8 +1374,16 @@ namespace Multiplayer
                     const uint16_t serverPort = cl_serverport;
                     const AzNetworking::ProtocolType serverProtocol = sv_protocol;
                     const AzNetworking::IpAddress hostId = AzNetworking::IpAddress(serverAddr.c_str(), serverPort, serverProtocol);
-                    // Set up a full ownership domain if we didn't construct a domain during the initialize event
-                    m_networkEntityManager.Initialize(hostId, AZStd::make_unique<FullOwnershipEntityDomain>());
+                    // Set up a spatial or full ownership domain if we didn't construct a domain during the initialize event
+                    if (sv_useSpatialEntityDomain)
+                    {
+                        const AZ::Aabb domainAabb = AZ::Aabb::CreateFromMinMax(sv_entityDomainMin, sv_entityDomainMax);
+                        m_networkEntityManager.Initialize(hostId, AZStd::make_unique<SpatialEntityDomain>(domainAabb));
+                    }
+                    else
+                    {
+                        m_networkEntityManager.Initialize(hostId, AZStd::make_unique<FullOwnershipEntityDomain>());
+                    }
                 }
             }
             else if (multiplayerType == MultiplayerAgentType::Client)
@@ -1457,7 +1501,7 @@ namespace Multiplayer
 
     void MultiplayerSystemComponent::SendReadyForEntityUpdates(bool readyForEntityUpdates)
     {
-        IConnectionSet& connectionSet = m_networkInterface->GetConnectionSet();
+        IConnectionSet& connectionSet = GetConnectionSet();
         connectionSet.VisitConnections([readyForEntityUpdates](IConnection& connection)
         {
             connection.SendReliablePacket(MultiplayerPackets::ReadyForEntityUpdates(readyForEntityUpdates));
@@ -1498,7 +1542,7 @@ namespace Multiplayer
 
     void MultiplayerSystemComponent::CompleteClientMigration(uint64_t temporaryUserIdentifier, AzNetworking::ConnectionId connectionId, const HostId& publicHostId, ClientInputId migratedClientInputId)
     {
-        IConnection* connection = m_networkInterface->GetConnectionSet().GetConnection(connectionId);
+        IConnection* connection = GetConnectionSet().GetConnection(connectionId);
         if (connection != nullptr) // Make sure the player has not disconnected since the start of migration
         {
             // Tell the client who to join
@@ -1793,7 +1837,7 @@ namespace Multiplayer
             }
             break;
         case MultiplayerAgentType::DedicatedServer:
-            if (m_networkInterface->GetConnectionSet().GetConnectionCount() > 0)
+            if (GetConnectionSet().GetConnectionCount() > 0)
             {
                 AZLOG_WARN("MultiplayerSystemComponent blocked this host from loading a new level because clients are connected. Loading a new level would destroy the existing clients' network player entity.")
                 blockLevelLoad = true;
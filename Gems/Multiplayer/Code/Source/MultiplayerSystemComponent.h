@@ -14,6 +14,9 @@
 #include <Editor/MultiplayerEditorConnection.h>
 #include <NetworkTime/NetworkTime.h>
 #include <NetworkEntity/NetworkEntityManager.h>
+#include <Source/MultiplayerPacketCapture.h>
+#include <Source/MultiplayerPacketReplay.h>
+#include <Source/MultiplayerReplicationCapture.h>
 #include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
 
 #include <AzCore/Component/Component.h>
@@ -175,6 +178,7 @@ namespace Multiplayer
 
     private:
         bool IsHosting() const;
+        AzNetworking::IConnectionSet& GetConnectionSet();
 
         bool AttemptPlayerConnect(AzNetworking::IConnection* connection, MultiplayerPackets::Connect& packet);
         void TickVisibleNetworkEntities(float deltaTime, float serverRateSeconds);
@@ -198,6 +202,9 @@ namespace Multiplayer
 
         NetworkEntityManager m_networkEntityManager;
         NetworkTime m_networkTime;
+        MultiplayerReplicationCapture m_replicationCapture;
+        MultiplayerPacketCapture m_packetCapture;
+        MultiplayerPacketReplay m_packetReplay{ *this };
         MultiplayerAgentType m_agentType = MultiplayerAgentType::Uninitialized;
         
         IFilterEntityManager* m_filterEntityManager = nullptr; // non-owning pointer
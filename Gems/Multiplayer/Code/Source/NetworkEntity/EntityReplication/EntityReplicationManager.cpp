@@ -22,7 +22,11 @@
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
 
 AZ_DECLARE_BUDGET(MULTIPLAYER);
 
@@ -35,6 +39,18 @@ namespace Multiplayer
 
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
     AZ_CVAR(AZ::TimeMs, sv_ReplicationWindowUpdateMs, AZ::TimeMs{ 300 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Rate for replication window updates.");
+    AZ_CVAR(bool, sv_AccumulateReplicationPriority, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, proxy entities that are not sent accumulate their replication priority, and the highest accumulated priorities are sent first");
+    AZ_CVAR(uint32_t, sv_MaxReplicationBytesPerSecond, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The maximum rate in bytes per second of entity updates sent to a single connection, 0 disables the limit");
+    AZ_CVAR(AZ::TimeMs, sv_ReplicationBurstMs, AZ::TimeMs{ 100 }, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The amount of unused bandwidth, in milliseconds at the maximum replication rate, a connection may save up to send in a burst");
+    AZ_CVAR(bool, cl_ParallelSnapshotDecode, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, clients decode entity snapshot deltas on job threads before applying entity updates on the main thread. "
+        "Only snapshot updates are decoded in parallel, which servers only send with sv_snapshotDeltaReplication enabled. "
+        "Regular entity updates are always deserialized on the main thread.");
+    AZ_CVAR(uint32_t, cl_ParallelSnapshotDecodeMinMessages, 32, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The minimum number of snapshot updates in a packet before snapshot deltas are decoded on job threads");
     
     EntityReplicationManager::EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode updateMode)
         : m_updateMode(updateMode)
@@ -145,10 +161,17 @@ namespace Multiplayer
             {
                 AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: SendUpdates - SendEntityUpdateMessages");
                 // While our to send list is not empty, build up another packet to send
-                do
+                RefillBandwidthBudget();
+                while (!toSendList.empty() && HasBandwidthBudget())
                 {
                     SendEntityUpdateMessages(toSendList);
-                } while (!toSendList.empty());
+                }
+
+                // Anything the bandwidth budget didn't allow us to send stays pending for the next update
+                for (EntityReplicator* replicator : toSendList)
+                {
+                    replicator->CancelPreparedUpdatePacket();
+                }
             }
         }
 
@@ -183,6 +206,7 @@ namespace Multiplayer
 
         // Generate a list of all our entities that need updates
         EntityReplicatorList toSendList;
+        AZStd::vector<EntityReplicator*> proxyReplicators;
 
         uint32_t proxySendCount = 0;
         for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end();)
@@ -222,6 +246,10 @@ namespace Multiplayer
                         {
                             toSendList.push_back(replicator);
                         }
+                        else if (sv_AccumulateReplicationPriority)
+                        {
+                            proxyReplicators.push_back(replicator);
+                        }
                         else if (proxySendCount < m_replicationWindow->GetMaxProxyEntityReplicatorSendCount())
                         {
                             toSendList.push_back(replicator);
@@ -234,6 +262,7 @@ namespace Multiplayer
             if (clearPendingSend)
             {
                 m_remoteEntitiesPendingCreation.erase(*iter);
+                m_priorityAccumulators.erase(*iter);
                 iter = m_replicatorsPendingSend.erase(iter);
             }
             else
@@ -242,9 +271,76 @@ namespace Multiplayer
             }
         }
 
+        if (!proxyReplicators.empty())
+        {
+            PrioritizeProxyReplicators(proxyReplicators, toSendList);
+        }
+
         return toSendList;
     }
 
+    void EntityReplicationManager::PrioritizeProxyReplicators(AZStd::vector<EntityReplicator*>& proxyReplicators, EntityReplicatorList& toSendList)
+    {
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: PrioritizeProxyReplicators");
+
+        // Every update an entity waits adds its window priority, so low priority entities are eventually sent instead of starving
+        const ReplicationSet& replicationSet = m_replicationWindow->GetReplicationSet();
+        for (EntityReplicator* replicator : proxyReplicators)
+        {
+            const auto windowIter = replicationSet.find(replicator->GetEntityHandle());
+            const float priority = ((windowIter != replicationSet.end()) && (windowIter->second.m_priority > 0.0f)) ? windowIter->second.m_priority : 1.0f;
+            m_priorityAccumulators[replicator->GetEntityHandle().GetNetEntityId()] += priority;
+        }
+
+        const uint32_t maxProxySendCount = m_replicationWindow->GetMaxProxyEntityReplicatorSendCount();
+        const auto higherAccumulatedPriority = [this](EntityReplicator* lhs, EntityReplicator* rhs)
+        {
+            return m_priorityAccumulators[lhs->GetEntityHandle().GetNetEntityId()] > m_priorityAccumulators[rhs->GetEntityHandle().GetNetEntityId()];
+        };
+        if (proxyReplicators.size() > maxProxySendCount)
+        {
+            AZStd::partial_sort(proxyReplicators.begin(), proxyReplicators.begin() + maxProxySendCount, proxyReplicators.end(), higherAccumulatedPriority);
+            proxyReplicators.resize(maxProxySendCount);
+        }
+        else
+        {
+            AZStd::sort(proxyReplicators.begin(), proxyReplicators.end(), higherAccumulatedPriority);
+        }
+
+        toSendList.insert(toSendList.end(), proxyReplicators.begin(), proxyReplicators.end());
+    }
+
+    void EntityReplicationManager::RefillBandwidthBudget()
+    {
+        const int64_t bytesPerSecond = GetReplicationBytesPerSecond();
+        if (bytesPerSecond == 0)
+        {
+            return;
+        }
+
+        // Always allow at least a full packet to be saved up, otherwise a low rate could never send a large update
+        const int64_t burstBytes = AZStd::max<int64_t>(bytesPerSecond * static_cast<int64_t>(static_cast<AZ::TimeMs>(sv_ReplicationBurstMs)) / 1000, m_maxPayloadSize);
+        const int64_t elapsedMs = (m_bandwidthRefillTimeMs == AZ::Time::ZeroTimeMs) ? 0 : static_cast<int64_t>(m_frameTimeMs - m_bandwidthRefillTimeMs);
+        m_bandwidthTokens = (m_bandwidthRefillTimeMs == AZ::Time::ZeroTimeMs) ? burstBytes : AZStd::min(m_bandwidthTokens + bytesPerSecond * elapsedMs / 1000, burstBytes);
+        m_bandwidthRefillTimeMs = m_frameTimeMs;
+    }
+
+    bool EntityReplicationManager::HasBandwidthBudget() const
+    {
+        return (GetReplicationBytesPerSecond() == 0) || (m_bandwidthTokens > 0);
+    }
+
+    int64_t EntityReplicationManager::GetReplicationBytesPerSecond() const
+    {
+        const int64_t maxBytesPerSecond = static_cast<int64_t>(static_cast<uint32_t>(sv_MaxReplicationBytesPerSecond));
+        const int64_t congestionBytesPerSecond = static_cast<int64_t>(m_connection.GetMetrics().m_sendRateLimitBytesPerSecond);
+        if ((maxBytesPerSecond == 0) || (congestionBytesPerSecond == 0))
+        {
+            return AZStd::max(maxBytesPerSecond, congestionBytesPerSecond);
+        }
+        return AZStd::min(maxBytesPerSecond, congestionBytesPerSecond);
+    }
+
     void EntityReplicationManager::SendEntityUpdateMessages(EntityReplicatorList& replicatorList)
     {
         uint32_t pendingPacketSize = 0;
@@ -293,7 +389,11 @@ namespace Multiplayer
             for (EntityReplicator* replicator : replicatorUpdatedList)
             {
                 replicator->RecordSentPacketId(sentId);
+                m_priorityAccumulators.erase(replicator->GetEntityHandle().GetNetEntityId());
             }
+
+            // The budget may go into debt by the final packet, which is paid back before sending again
+            m_bandwidthTokens -= static_cast<int64_t>(pendingPacketSize + UdpPacketHeaderSerializeSize + ReplicationManagerPacketOverhead);
         }
         else
         {
@@ -886,12 +986,108 @@ namespace Multiplayer
         return result;
     }
 
+    bool EntityReplicationManager::HandleEntityUpdateMessages
+    (
+        AzNetworking::IConnection* invokingConnection,
+        const AzNetworking::IPacketHeader& packetHeader,
+        const NetworkEntityUpdateVector& updateMessages
+    )
+    {
+        AZStd::vector<DecodedSnapshot> decodedSnapshots;
+        if (cl_ParallelSnapshotDecode && (m_updateMode == Mode::LocalClientToRemoteServer))
+        {
+            DecodeSnapshotsInParallel(packetHeader, updateMessages, decodedSnapshots);
+        }
+
+        bool handledAll = true;
+        for (AZStd::size_t i = 0; i < updateMessages.size(); ++i)
+        {
+            const DecodedSnapshot decodedSnapshot = decodedSnapshots.empty() ? DecodedSnapshot() : decodedSnapshots[i];
+            handledAll &= HandleEntityUpdateMessage(invokingConnection, packetHeader, updateMessages[i], decodedSnapshot);
+            AZ_Assert(handledAll, "EntityUpdates did not handle all update messages");
+        }
+        return handledAll;
+    }
+
+    void EntityReplicationManager::DecodeSnapshotsInParallel
+    (
+        const AzNetworking::IPacketHeader& packetHeader,
+        const NetworkEntityUpdateVector& updateMessages,
+        AZStd::vector<DecodedSnapshot>& outDecoded
+    )
+    {
+        // Gather the replicators on this thread, a replicator may only be decoded by one job since decoding appends to its snapshot history
+        // Entities that appear more than once in a batch are left to be decoded in order while the messages are handled
+        AZStd::vector<AZStd::pair<uint32_t, EntityReplicator*>> decodeList;
+        AZStd::unordered_map<NetEntityId, uint32_t> entityMessageCounts;
+        for (uint32_t i = 0; i < updateMessages.size(); ++i)
+        {
+            ++entityMessageCounts[updateMessages[i].GetEntityId()];
+        }
+        for (uint32_t i = 0; i < updateMessages.size(); ++i)
+        {
+            const NetworkEntityUpdateMessage& updateMessage = updateMessages[i];
+            if (updateMessage.GetIsSnapshot() && (entityMessageCounts[updateMessage.GetEntityId()] == 1))
+            {
+                EntityReplicator* entityReplicator = GetEntityReplicator(updateMessage.GetEntityId());
+                if (entityReplicator != nullptr)
+                {
+                    decodeList.emplace_back(i, entityReplicator);
+                }
+            }
+        }
+
+        if (decodeList.size() < cl_ParallelSnapshotDecodeMinMessages)
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(MULTIPLAYER, "EntityReplicationManager: DecodeSnapshotsInParallel");
+        outDecoded.resize(updateMessages.size());
+
+        const uint32_t jobCount = AZStd::min(aznumeric_cast<uint32_t>(decodeList.size()), AZStd::max(AZStd::thread::hardware_concurrency(), 1u));
+        const uint32_t decodesPerJob = aznumeric_cast<uint32_t>(decodeList.size() + jobCount - 1) / jobCount;
+        const AzNetworking::PacketId packetId = packetHeader.GetPacketId();
+
+        AZ::JobCompletion jobCompletion;
+        for (uint32_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+        {
+            const uint32_t startIndex = jobIndex * decodesPerJob;
+            const uint32_t endIndex = AZStd::min(startIndex + decodesPerJob, aznumeric_cast<uint32_t>(decodeList.size()));
+            AZ::Job* job = AZ::CreateJobFunction([&decodeList, &updateMessages, &outDecoded, packetId, startIndex, endIndex]()
+            {
+                for (uint32_t index = startIndex; index < endIndex; ++index)
+                {
+                    const uint32_t messageIndex = decodeList[index].first;
+                    const NetworkEntityUpdateMessage& updateMessage = updateMessages[messageIndex];
+                    DecodedSnapshot& decoded = outDecoded[messageIndex];
+                    decoded.m_snapshot = decodeList[index].second->DecodeSnapshot(packetId, updateMessage.GetSnapshotBaseline(), *updateMessage.GetData());
+                    decoded.m_isDecoded = true;
+                }
+            }, true, nullptr);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
     bool EntityReplicationManager::HandleEntityUpdateMessage
     (
         AzNetworking::IConnection* invokingConnection,
         const AzNetworking::IPacketHeader& packetHeader,
         const NetworkEntityUpdateMessage& updateMessage
     )
+    {
+        return HandleEntityUpdateMessage(invokingConnection, packetHeader, updateMessage, DecodedSnapshot());
+    }
+
+    bool EntityReplicationManager::HandleEntityUpdateMessage
+    (
+        AzNetworking::IConnection* invokingConnection,
+        const AzNetworking::IPacketHeader& packetHeader,
+        const NetworkEntityUpdateMessage& updateMessage,
+        const DecodedSnapshot& decodedSnapshot
+    )
     {
         if (updateMessage.GetIsDelete())
         {
@@ -900,6 +1096,29 @@ namespace Multiplayer
 
         // May still be nullptr
         EntityReplicator* entityReplicator = GetEntityReplicator(updateMessage.GetEntityId());
+
+        // Snapshots are decoded before validation, a snapshot dropped as out of date may still be used as a baseline once acknowledged
+        const AZStd::vector<uint8_t>* snapshot = decodedSnapshot.m_snapshot;
+        if (updateMessage.GetIsSnapshot() && !decodedSnapshot.m_isDecoded)
+        {
+            if (entityReplicator != nullptr)
+            {
+                snapshot = entityReplicator->DecodeSnapshot(packetHeader.GetPacketId(), updateMessage.GetSnapshotBaseline(), *updateMessage.GetData());
+            }
+
+            if (snapshot == nullptr)
+            {
+                AZLOG_WARN
+                (
+                    "Unable to decode snapshot for entity id %llu against baseline %u, requesting a reset",
+                    aznumeric_cast<AZ::u64>(updateMessage.GetEntityId()),
+                    aznumeric_cast<uint32_t>(updateMessage.GetSnapshotBaseline())
+                );
+                m_replicatorsPendingReset.emplace(updateMessage.GetEntityId());
+                return true;
+            }
+        }
+
         UpdateValidationResult result = ValidateUpdate(updateMessage, packetHeader.GetPacketId(), entityReplicator);
         switch (result)
         {
@@ -913,7 +1132,9 @@ namespace Multiplayer
             AZ_Assert(false, "Unhandled case");
         }
 
-        OutputSerializer outputSerializer(updateMessage.GetData()->GetBuffer(), static_cast<uint32_t>(updateMessage.GetData()->GetSize()));
+        const uint8_t* updateData = (snapshot != nullptr) ? snapshot->data() : updateMessage.GetData()->GetBuffer();
+        const uint32_t updateSize = static_cast<uint32_t>((snapshot != nullptr) ? snapshot->size() : updateMessage.GetData()->GetSize());
+        OutputSerializer outputSerializer(updateData, updateSize);
 
         PrefabEntityId prefabEntityId;
         if (updateMessage.GetHasValidPrefabId())
@@ -941,7 +1162,7 @@ namespace Multiplayer
         bool handled = true;
 
         // This may implicitly create a replicator for us
-        if (updateMessage.GetData()->GetSize() != 0)
+        if (updateSize != 0)
         {
             handled = HandlePropertyChangeMessage(
                           invokingConnection,
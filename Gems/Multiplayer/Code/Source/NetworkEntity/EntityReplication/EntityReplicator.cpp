@@ -597,6 +597,13 @@ namespace Multiplayer
         return m_propertySubscriber ? m_propertySubscriber->GetLastReceivedPacketId() : AzNetworking::InvalidPacketId;
     }
 
+    const AZStd::vector<uint8_t>* EntityReplicator::DecodeSnapshot(
+        AzNetworking::PacketId packetId, AzNetworking::PacketId baselinePacketId, const AzNetworking::PacketEncodingBuffer& delta)
+    {
+        // Snapshots are received from the network, so a replicator in the wrong configuration is reported to the caller rather than asserted
+        return m_propertySubscriber ? m_propertySubscriber->DecodeSnapshot(packetId, baselinePacketId, delta) : nullptr;
+    }
+
     bool EntityReplicator::HandlePropertyChangeMessage(
         AzNetworking::PacketId packetId, AzNetworking::ISerializer* serializer, bool notifyChanges)
     {
@@ -627,9 +634,20 @@ namespace Multiplayer
         }
     }
 
+    void EntityReplicator::CancelPreparedUpdatePacket()
+    {
+        AZ_Assert(m_propertyPublisher, "Expected to have a property publisher");
+        if (m_propertyPublisher)
+        {
+            m_propertyPublisher->CancelSerialization();
+        }
+    }
+
     void EntityReplicator::DeferRpcMessage(NetworkEntityRpcMessage& entityRpcMessage)
     {
         // Received rpc metrics, log rpc sent, number of bytes, and the componentId/rpcId for bandwidth metrics
+        // RPCs are usually deferred from gameplay code rather than during a connection update, so attribute the connection here
+        MultiplayerStats::ScopedRecordConnection recordConnection(m_replicationManager.GetConnection().GetConnectionId());
         MultiplayerStats& stats = GetMultiplayer()->GetStats();
         stats.RecordRpcSent(GetEntityHandle().GetEntity()->GetId(), GetEntityHandle().GetEntity()->GetName().c_str(),
             entityRpcMessage.GetComponentId(), entityRpcMessage.GetRpcIndex(), entityRpcMessage.GetEstimatedSerializeSize());
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/EntitySnapshotDelta.h>
+
+namespace Multiplayer
+{
+    // Each run is prefixed by a single byte count, so runs longer than this are split
+    static constexpr uint32_t MaxSnapshotDeltaRunLength = 0xFF;
+
+    static inline uint8_t GetDeltaByte(const uint8_t* baseline, uint32_t baselineSize, const uint8_t* snapshot, uint32_t index)
+    {
+        return (index < baselineSize) ? static_cast<uint8_t>(snapshot[index] ^ baseline[index]) : snapshot[index];
+    }
+
+    bool EncodeEntitySnapshotDelta
+    (
+        const uint8_t* baseline,
+        uint32_t baselineSize,
+        const uint8_t* snapshot,
+        uint32_t snapshotSize,
+        uint8_t* outBuffer,
+        uint32_t outBufferCapacity,
+        uint32_t& outSize
+    )
+    {
+        outSize = 0;
+        uint32_t index = 0;
+        while (index < snapshotSize)
+        {
+            uint32_t zeroCount = 0;
+            while ((index + zeroCount < snapshotSize) && (zeroCount < MaxSnapshotDeltaRunLength)
+                && (GetDeltaByte(baseline, baselineSize, snapshot, index + zeroCount) == 0))
+            {
+                ++zeroCount;
+            }
+            index += zeroCount;
+
+            uint32_t literalCount = 0;
+            while ((index + literalCount < snapshotSize) && (literalCount < MaxSnapshotDeltaRunLength)
+                && (GetDeltaByte(baseline, baselineSize, snapshot, index + literalCount) != 0))
+            {
+                ++literalCount;
+            }
+
+            if (outSize + 2 + literalCount > outBufferCapacity)
+            {
+                return false;
+            }
+
+            outBuffer[outSize++] = static_cast<uint8_t>(zeroCount);
+            outBuffer[outSize++] = static_cast<uint8_t>(literalCount);
+            for (uint32_t i = 0; i < literalCount; ++i)
+            {
+                outBuffer[outSize++] = GetDeltaByte(baseline, baselineSize, snapshot, index + i);
+            }
+            index += literalCount;
+        }
+        return true;
+    }
+
+    bool DecodeEntitySnapshotDelta
+    (
+        const uint8_t* baseline,
+        uint32_t baselineSize,
+        const uint8_t* delta,
+        uint32_t deltaSize,
+        uint8_t* outSnapshot,
+        uint32_t outSnapshotCapacity,
+        uint32_t& outSize
+    )
+    {
+        outSize = 0;
+        uint32_t index = 0;
+        while (index < deltaSize)
+        {
+            if (index + 2 > deltaSize)
+            {
+                return false;
+            }
+
+            const uint32_t zeroCount = delta[index++];
+            const uint32_t literalCount = delta[index++];
+            if ((index + literalCount > deltaSize) || (outSize + zeroCount + literalCount > outSnapshotCapacity))
+            {
+                return false;
+            }
+
+            for (uint32_t i = 0; i < zeroCount; ++i, ++outSize)
+            {
+                outSnapshot[outSize] = (outSize < baselineSize) ? baseline[outSize] : 0;
+            }
+            for (uint32_t i = 0; i < literalCount; ++i, ++outSize)
+            {
+                const uint8_t deltaByte = delta[index++];
+                outSnapshot[outSize] = (outSize < baselineSize) ? static_cast<uint8_t>(deltaByte ^ baseline[outSize]) : deltaByte;
+            }
+        }
+        return true;
+    }
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace Multiplayer
+{
+    //! The number of entity snapshots retained by both the sender and the receiver for use as delta baselines.
+    //! The receiver must retain at least as many snapshots as the sender, otherwise acknowledged baselines may be unavailable.
+    static constexpr uint32_t MaxEntitySnapshotHistory = 32;
+
+    //! Encodes a serialized entity snapshot as a delta against a baseline snapshot.
+    //! The snapshot is XOR'd against the baseline, and the result is stored as alternating runs of zero bytes and literal bytes.
+    //! Values that are unchanged from the baseline produce zero runs, so an update that changes few values encodes to very few bytes.
+    //! @param baseline          the baseline snapshot the receiver is known to have, may be nullptr if baselineSize is zero
+    //! @param baselineSize      the size of the baseline snapshot in bytes
+    //! @param snapshot          the snapshot to encode
+    //! @param snapshotSize      the size of the snapshot in bytes
+    //! @param outBuffer         the buffer to write the encoded delta to
+    //! @param outBufferCapacity the capacity of outBuffer in bytes
+    //! @param outSize           the size of the encoded delta in bytes
+    //! @return true if the encoded delta fit within outBuffer, false otherwise
+    bool EncodeEntitySnapshotDelta
+    (
+        const uint8_t* baseline,
+        uint32_t baselineSize,
+        const uint8_t* snapshot,
+        uint32_t snapshotSize,
+        uint8_t* outBuffer,
+        uint32_t outBufferCapacity,
+        uint32_t& outSize
+    );
+
+    //! Decodes a delta produced by EncodeEntitySnapshotDelta against the same baseline snapshot.
+    //! @param baseline            the baseline snapshot the delta was encoded against, may be nullptr if baselineSize is zero
+    //! @param baselineSize        the size of the baseline snapshot in bytes
+    //! @param delta               the encoded delta
+    //! @param deltaSize           the size of the encoded delta in bytes
+    //! @param outSnapshot         the buffer to write the decoded snapshot to
+    //! @param outSnapshotCapacity the capacity of outSnapshot in bytes
+    //! @param outSize             the size of the decoded snapshot in bytes
+    //! @return true if the delta was well formed and the decoded snapshot fit within outSnapshot, false otherwise
+    bool DecodeEntitySnapshotDelta
+    (
+        const uint8_t* baseline,
+        uint32_t baselineSize,
+        const uint8_t* delta,
+        uint32_t deltaSize,
+        uint8_t* outSnapshot,
+        uint32_t outSnapshotCapacity,
+        uint32_t& outSize
+    );
+}
@@ -7,6 +7,7 @@
  */
 
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
+#include <Source/NetworkEntity/EntityReplication/EntitySnapshotDelta.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
@@ -15,12 +16,17 @@
 namespace Multiplayer
 {
     AZ_CVAR(uint32_t, net_EntityReplicatorRecordsMax, 45, nullptr, AZ::ConsoleFunctorFlags::Null, "Number of allowed outstanding entity records");
+    AZ_CVAR(bool, sv_shareEntityUpdateSerialization, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, entity updates are serialized once per host frame and shared by all connections that need the same set of changes");
+    AZ_CVAR(bool, sv_snapshotDeltaReplication, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If true, entity updates send the entity's full replicated state delta encoded against the remote's last acknowledged snapshot");
 
     PropertyPublisher::PropertyPublisher(NetEntityRole remoteNetworkRole, OwnsLifetime ownsLifetime, AzNetworking::IConnection& connection)
         : m_ownsLifetime(ownsLifetime)
         , m_connection(connection)
         , m_pendingRecord(remoteNetworkRole)
         , m_sentRecords(net_EntityReplicatorRecordsMax)
+        , m_sentSnapshots(MaxEntitySnapshotHistory)
     {
         if ( ownsLifetime == OwnsLifetime::False )
         {
@@ -203,6 +209,64 @@ namespace Multiplayer
         return serializer.IsValid();
     }
 
+    bool PropertyPublisher::SerializeEntitySnapshot(NetworkEntityUpdateMessage& updateMessage, NetBindComponent* netBindComponent)
+    {
+        AZ_Assert(netBindComponent, "NetBindComponent is nullptr");
+
+        // The snapshot contains every property that has ever changed, the same set a full replication record would send
+        ReplicationRecord snapshotRecord(m_pendingRecord.GetRemoteNetworkRole());
+        netBindComponent->FillTotalReplicationRecord(snapshotRecord);
+        if (snapshotRecord.GetRemoteNetworkRole() == NetEntityRole::Autonomous)
+        {
+            snapshotRecord.Subtract(netBindComponent->GetPredictableRecord());
+        }
+
+        AzNetworking::PacketEncodingBuffer& data = updateMessage.ModifyData();
+        m_pendingSnapshot.resize_no_construct(data.GetCapacity());
+        InputSerializer inputSerializer(m_pendingSnapshot.data(), static_cast<uint32_t>(m_pendingSnapshot.size()));
+        snapshotRecord.Serialize(inputSerializer);
+        netBindComponent->SerializeStateDeltaMessage(snapshotRecord, inputSerializer);
+        if (!inputSerializer.IsValid())
+        {
+            return false;
+        }
+        m_pendingSnapshot.resize(inputSerializer.GetSize());
+
+        // Snapshots older than the most recently acknowledged one will never be used as a baseline again
+        auto baselineIter = m_sentSnapshots.begin();
+        for (; baselineIter != m_sentSnapshots.end(); ++baselineIter)
+        {
+            if (m_connection.WasPacketAcked(baselineIter->m_sentPacketId))
+            {
+                break;
+            }
+        }
+
+        const uint8_t* baselineData = nullptr;
+        uint32_t baselineSize = 0;
+        AzNetworking::PacketId baselinePacketId = AzNetworking::InvalidPacketId;
+        if (baselineIter != m_sentSnapshots.end())
+        {
+            m_sentSnapshots.erase(baselineIter + 1, m_sentSnapshots.end());
+            const SentSnapshot& baseline = m_sentSnapshots.back();
+            baselineData = baseline.m_data.data();
+            baselineSize = static_cast<uint32_t>(baseline.m_data.size());
+            baselinePacketId = baseline.m_sentPacketId;
+        }
+
+        uint32_t dataSize = 0;
+        if (!EncodeEntitySnapshotDelta(baselineData, baselineSize, m_pendingSnapshot.data(), static_cast<uint32_t>(m_pendingSnapshot.size()),
+            data.GetBuffer(), static_cast<uint32_t>(data.GetCapacity()), dataSize))
+        {
+            return false;
+        }
+
+        data.Resize(dataSize);
+        updateMessage.SetSnapshotBaseline(baselinePacketId);
+        m_hasPendingSnapshot = true;
+        return true;
+    }
+
     void PropertyPublisher::FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId)
     {
         // Fill in the packet id for the last sent update
@@ -214,9 +278,17 @@ namespace Multiplayer
         {
             // The packet failed to be generated, pop off the failed sent record
             m_sentRecords.pop_front();
+            m_hasPendingSnapshot = false;
             return;
         }
         m_pendingRecord.Clear();
+
+        if (m_hasPendingSnapshot)
+        {
+            m_sentSnapshots.push_front({ packetId, AZStd::move(m_pendingSnapshot) });
+            m_pendingSnapshot = {};
+            m_hasPendingSnapshot = false;
+        }
     }
 
     void PropertyPublisher::FinalizeDeleteEntityRecord(AzNetworking::PacketId packetId)
@@ -372,6 +444,33 @@ namespace Multiplayer
             updateMessage.SetPrefabEntityId(netBindComponent->GetPrefabEntityId());
         }
 
+        // The snapshot is regenerated each time a packet is generated, only the one that is actually sent is kept as a baseline
+        m_hasPendingSnapshot = false;
+        if (sv_snapshotDeltaReplication && !isDeleted && !sendPrefabId && (m_replicatorState == PropertyPublisher::EntityReplicatorState::Updating))
+        {
+            if (SerializeEntitySnapshot(updateMessage, netBindComponent))
+            {
+                return updateMessage;
+            }
+            updateMessage = NetworkEntityUpdateMessage(
+                m_pendingRecord.GetRemoteNetworkRole(), netBindComponent->GetNetEntityId(), isDeleted, wasMigrated);
+        }
+
+        if (sv_shareEntityUpdateSerialization && !isDeleted)
+        {
+            // Connections with the same pending changes this host frame produce identical bytes, so share a single serialization
+            uint32_t dataSize = 0;
+            const bool success = netBindComponent->SerializeSharedEntityRecord(
+                m_pendingRecord, updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()), dataSize);
+            if (!success)
+            {
+                AZLOG_ERROR("EntityReplicator: Serialization failed");
+                AZ_Assert(false, "EntityReplicator: Serialization failed");
+            }
+            updateMessage.ModifyData().Resize(dataSize);
+            return updateMessage;
+        }
+
         InputSerializer inputSerializer(
             updateMessage.ModifyData().GetBuffer(), static_cast<uint32_t>(updateMessage.ModifyData().GetCapacity()));
         SerializeEntityRecord(inputSerializer, netBindComponent);
@@ -434,4 +533,21 @@ namespace Multiplayer
         // Reset our state for the next frame
         m_serializationPhase = PropertyPublisher::EntityReplicatorSerializationPhase::Ready;
     }
+
+    void PropertyPublisher::CancelSerialization()
+    {
+        if (m_serializationPhase != PropertyPublisher::EntityReplicatorSerializationPhase::Prepared)
+        {
+            return;
+        }
+
+        // Pop the record pushed by PrepareSerialization, it was never sent so it can never be acknowledged
+        if ((m_replicatorState == PropertyPublisher::EntityReplicatorState::Updating) && !m_sentRecords.empty()
+            && (m_sentRecords.front().m_sentPacketId == AzNetworking::InvalidPacketId))
+        {
+            m_sentRecords.pop_front();
+        }
+        m_hasPendingSnapshot = false;
+        m_serializationPhase = PropertyPublisher::EntityReplicatorSerializationPhase::Ready;
+    }
 }
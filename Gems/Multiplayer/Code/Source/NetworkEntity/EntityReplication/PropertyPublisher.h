@@ -85,6 +85,10 @@ namespace Multiplayer
         //! (or later) has been acknowledged.
         void FinalizeSerialization(AzNetworking::PacketId sentId);
 
+        //! Discard a prepared record that was never sent, so that PrepareSerialization can be called again on the next update.
+        //! The changes in the discarded record remain in the pending record.
+        void CancelSerialization();
+
     private:
         enum class EntityReplicatorState
         {
@@ -117,6 +121,11 @@ namespace Multiplayer
         //! Add/update/delete all use the same serialization path.
         bool SerializeEntityRecord(AzNetworking::ISerializer& serializer, NetBindComponent* netBindComponent);
 
+        //! Alternative to phase 2 for updates once the remote replicator is established.
+        //! Serializes the entity's total replicated state and delta encodes it against the most recently acknowledged snapshot.
+        //! @return true if the snapshot was encoded into the update message, false if a regular update should be sent instead
+        bool SerializeEntitySnapshot(NetworkEntityUpdateMessage& updateMessage, NetBindComponent* netBindComponent);
+
         //! Phase 3, finalize with the packet id
         void FinalizeUpdateEntityRecord(AzNetworking::PacketId packetId);
         void FinalizeDeleteEntityRecord(AzNetworking::PacketId packetId);
@@ -135,6 +144,18 @@ namespace Multiplayer
 
         //! List of sent records
         AZStd::ring_buffer<ReplicationRecord> m_sentRecords;
+
+        struct SentSnapshot
+        {
+            AzNetworking::PacketId m_sentPacketId = AzNetworking::InvalidPacketId;
+            AZStd::vector<uint8_t> m_data;
+        };
+
+        //! List of sent snapshots, sorted from the most to the least recently sent, used as baselines once acknowledged
+        AZStd::ring_buffer<SentSnapshot> m_sentSnapshots;
+        //! The snapshot serialized for the update currently being sent, moved to m_sentSnapshots once a packet id is assigned
+        AZStd::vector<uint8_t> m_pendingSnapshot;
+        bool m_hasPendingSnapshot = false;
         //! List of sent delete packets, tracked separately as a way to look for acknowledged deletes.
         //! (This could potentially get merged into m_sentRecords as an optimization)
         AZStd::vector<AzNetworking::PacketId> m_deletePacketIds;
@@ -7,6 +7,7 @@
  */
 
 #include <Source/NetworkEntity/EntityReplication/PropertySubscriber.h>
+#include <Source/NetworkEntity/EntityReplication/EntitySnapshotDelta.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicationManager.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 
@@ -15,6 +16,7 @@ namespace Multiplayer
     PropertySubscriber::PropertySubscriber(EntityReplicationManager& replicationManager, NetBindComponent* netBindComponent)
         : m_replicationManager(replicationManager)
         , m_netBindComponent(netBindComponent)
+        , m_receivedSnapshots(MaxEntitySnapshotHistory)
     {
         ;
     }
@@ -50,4 +52,45 @@ namespace Multiplayer
         m_lastReceivedPacketId = packetId;
         return m_netBindComponent->HandlePropertyChangeMessage(*serializer, notifyChanges);
     }
+
+    const AZStd::vector<uint8_t>* PropertySubscriber::DecodeSnapshot
+    (
+        AzNetworking::PacketId packetId,
+        AzNetworking::PacketId baselinePacketId,
+        const AzNetworking::PacketEncodingBuffer& delta
+    )
+    {
+        const uint8_t* baselineData = nullptr;
+        uint32_t baselineSize = 0;
+        if (baselinePacketId != AzNetworking::InvalidPacketId)
+        {
+            auto baselineIter = m_receivedSnapshots.begin();
+            while ((baselineIter != m_receivedSnapshots.end()) && (baselineIter->m_packetId != baselinePacketId))
+            {
+                ++baselineIter;
+            }
+
+            if (baselineIter == m_receivedSnapshots.end())
+            {
+                return nullptr;
+            }
+            baselineData = baselineIter->m_data.data();
+            baselineSize = static_cast<uint32_t>(baselineIter->m_data.size());
+        }
+
+        // A snapshot is serialized into a packet encoding buffer on the sender, so it always fits within one when decoded
+        ReceivedSnapshot snapshot;
+        snapshot.m_packetId = packetId;
+        snapshot.m_data.resize_no_construct(delta.GetCapacity());
+        uint32_t snapshotSize = 0;
+        if (!DecodeEntitySnapshotDelta(baselineData, baselineSize, delta.GetBuffer(), static_cast<uint32_t>(delta.GetSize()),
+            snapshot.m_data.data(), static_cast<uint32_t>(snapshot.m_data.size()), snapshotSize))
+        {
+            return nullptr;
+        }
+        snapshot.m_data.resize(snapshotSize);
+
+        m_receivedSnapshots.push_front(AZStd::move(snapshot));
+        return &m_receivedSnapshots.front().m_data;
+    }
 }
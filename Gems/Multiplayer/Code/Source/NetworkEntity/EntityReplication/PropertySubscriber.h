@@ -8,7 +8,10 @@
 
 #pragma once
 
+#include <AzNetworking/DataStructures/ByteBuffer.h>
 #include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/std/containers/ring_buffer.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AzNetworking
 {
@@ -36,6 +39,13 @@ namespace Multiplayer
 
         bool HandlePropertyChangeMessage(AzNetworking::PacketId packetId, AzNetworking::ISerializer* serializer, bool notifyChanges = true);
 
+        //! Decodes a delta encoded snapshot against a previously received snapshot, and retains the result as a baseline for later snapshots.
+        //! @param packetId         the id of the packet the snapshot was received in
+        //! @param baselinePacketId the id of the packet containing the baseline snapshot, or InvalidPacketId if there is no baseline
+        //! @param delta            the delta encoded snapshot
+        //! @return the decoded snapshot, or nullptr if the baseline is unavailable or the delta is malformed
+        const AZStd::vector<uint8_t>* DecodeSnapshot(AzNetworking::PacketId packetId, AzNetworking::PacketId baselinePacketId, const AzNetworking::PacketEncodingBuffer& delta);
+
     private:
         EntityReplicationManager& m_replicationManager;
         NetBindComponent* m_netBindComponent;
@@ -43,5 +53,14 @@ namespace Multiplayer
         // The last packet to have been received about this entity
         AzNetworking::PacketId m_lastReceivedPacketId = AzNetworking::InvalidPacketId;
         AZ::TimeMs m_markForRemovalTimeMs = AZ::Time::ZeroTimeMs;
+
+        struct ReceivedSnapshot
+        {
+            AzNetworking::PacketId m_packetId = AzNetworking::InvalidPacketId;
+            AZStd::vector<uint8_t> m_data;
+        };
+
+        // Snapshots the sender may reference as a baseline once it sees them acknowledged, sorted from the most to the least recent
+        AZStd::ring_buffer<ReceivedSnapshot> m_receivedSnapshots;
     };
 }
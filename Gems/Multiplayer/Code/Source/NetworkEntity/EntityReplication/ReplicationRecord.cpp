@@ -137,6 +137,15 @@ namespace Multiplayer
         return hasChanges;
     }
 
+    bool ReplicationRecord::HasSameChanges(const ReplicationRecord& rhs) const
+    {
+        return (m_remoteNetEntityRole == rhs.m_remoteNetEntityRole)
+            && (m_authorityToClient == rhs.m_authorityToClient)
+            && (m_authorityToServer == rhs.m_authorityToServer)
+            && (m_authorityToAutonomous == rhs.m_authorityToAutonomous)
+            && (m_autonomousToAuthority == rhs.m_autonomousToAuthority);
+    }
+
     bool ReplicationRecord::Serialize(AzNetworking::ISerializer& serializer)
     {
         if (ContainsAuthorityToClientBits())
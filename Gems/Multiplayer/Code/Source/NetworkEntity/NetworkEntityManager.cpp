@@ -29,10 +29,13 @@ AZ_DECLARE_BUDGET(MULTIPLAYER);
 namespace Multiplayer
 {
     AZ_CVAR(bool, net_DebugCheckNetworkEntityManager, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Enables extra debug checks inside the NetworkEntityManager");
+    AZ_CVAR(AZ::TimeMs, sv_EntityDomainUpdateIntervalMs, AZ::TimeMs{ 100 }, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "How often authoritative entities are checked against a spatial entity domain, entities found outside the domain are migrated to a neighbouring host");
 
     NetworkEntityManager::NetworkEntityManager()
         : m_networkEntityAuthorityTracker(*this)
         , m_removeEntitiesEvent([this] { RemoveEntities(); }, AZ::Name("NetworkEntityManager remove entities event"))
+        , m_updateEntityDomainEvent([this] { UpdateEntityDomain(); }, AZ::Name("NetworkEntityManager update entity domain event"))
     {
         AZ::Interface<INetworkEntityManager>::Register(this);
         AzFramework::RootSpawnableNotificationBus::Handler::BusConnect();
@@ -64,6 +67,11 @@ namespace Multiplayer
         }
 
         m_entityDomain = AZStd::move(entityDomain);
+
+        if (!m_updateEntityDomainEvent.IsScheduled())
+        {
+            m_updateEntityDomainEvent.Enqueue(sv_EntityDomainUpdateIntervalMs, true);
+        }
     }
 
     bool NetworkEntityManager::IsInitialized() const
@@ -86,6 +94,11 @@ namespace Multiplayer
         return &m_networkEntityAuthorityTracker;
     }
 
+    NetworkRelevancyGrid* NetworkEntityManager::GetNetworkRelevancyGrid()
+    {
+        return &m_networkRelevancyGrid;
+    }
+
     MultiplayerComponentRegistry* NetworkEntityManager::GetMultiplayerComponentRegistry()
     {
         return &m_multiplayerComponentRegistry;
@@ -114,11 +127,14 @@ namespace Multiplayer
     NetworkEntityHandle NetworkEntityManager::AddEntityToEntityMap(NetEntityId netEntityId, AZ::Entity* entity)
     {
         m_networkEntityTracker.Add(netEntityId, entity);
-        return NetworkEntityHandle(entity, &m_networkEntityTracker);
+        NetworkEntityHandle entityHandle(entity, &m_networkEntityTracker);
+        m_networkRelevancyGrid.AddEntity(entityHandle);
+        return entityHandle;
     }
 
     void NetworkEntityManager::RemoveEntityFromEntityMap(NetEntityId netEntityId)
     {
+        m_networkRelevancyGrid.RemoveEntity(netEntityId);
         m_networkEntityTracker.erase(netEntityId);
     }
 
@@ -185,6 +201,7 @@ namespace Multiplayer
         //    rootSlice->RemoveEntity(entity);
         //}
         m_networkEntityTracker.clear();
+        m_networkRelevancyGrid.Clear();
     }
 
     void NetworkEntityManager::AddEntityMarkedDirtyHandler(AZ::Event<>::Handler& entityMarkedDirtyHandler)
@@ -250,9 +267,9 @@ namespace Multiplayer
             // Validate that we aren't already planning to remove this entity
             if (safeToExit)
             {
-                for (auto remoteEntityId : m_removeList)
+                for (auto removeEntityId : m_removeList)
                 {
-                    if (remoteEntityId == remoteEntityId)
+                    if (removeEntityId == exitingId)
                     {
                         safeToExit = false;
                     }
@@ -312,6 +329,11 @@ namespace Multiplayer
         return m_alwaysRelevantToServers;
     }
 
+    void NetworkEntityManager::SetRelevancyDistance(const ConstNetworkEntityHandle& entityHandle, float relevancyDistance)
+    {
+        m_networkRelevancyGrid.SetRelevancyDistance(entityHandle.GetNetEntityId(), relevancyDistance);
+    }
+
     void NetworkEntityManager::SetMigrateTimeoutTimeMs(AZ::TimeMs timeoutTimeMs)
     {
         m_networkEntityAuthorityTracker.SetTimeoutTimeMs(timeoutTimeMs);
@@ -392,6 +414,7 @@ namespace Multiplayer
     {
         m_multiplayerComponentRegistry.Reset();
         m_removeList.clear();
+        m_updateEntityDomainEvent.RemoveFromQueue();
         m_entityDomain = nullptr;
         m_entityExitDomainEvent.DisconnectAllHandlers();
         m_onEntityMarkedDirty.DisconnectAllHandlers();
@@ -423,6 +446,37 @@ namespace Multiplayer
         }
     }
 
+    void NetworkEntityManager::UpdateEntityDomain()
+    {
+        // Only spatial domains can have authoritative entities wander outside of them
+        if ((m_entityDomain == nullptr) || !m_entityDomain->GetAabb().IsValid())
+        {
+            return;
+        }
+
+        NetEntityIdSet entitiesNotInDomain;
+        for (NetworkEntityTracker::const_iterator it = m_networkEntityTracker.begin(); it != m_networkEntityTracker.end(); ++it)
+        {
+            AZ::Entity* entity = it->second;
+            NetBindComponent* netBindComponent = m_networkEntityTracker.GetNetBindComponent(entity);
+            if ((netBindComponent == nullptr) || (netBindComponent->GetNetEntityRole() != NetEntityRole::Authority))
+            {
+                continue;
+            }
+
+            const ConstNetworkEntityHandle entityHandle(entity, &m_networkEntityTracker);
+            if (!m_entityDomain->IsInDomain(entityHandle))
+            {
+                entitiesNotInDomain.emplace(it->first);
+            }
+        }
+
+        if (!entitiesNotInDomain.empty())
+        {
+            HandleEntitiesExitDomain(entitiesNotInDomain);
+        }
+    }
+
     INetworkEntityManager::EntityList NetworkEntityManager::CreateEntitiesImmediate(
         const AzFramework::Spawnable& spawnable, NetEntityRole netEntityRole, const AZ::Transform& transform, AutoActivate autoActivate)
     {
@@ -14,6 +14,7 @@
 #include <AzFramework/Spawnable/SpawnableAssetBus.h>
 #include <Source/NetworkEntity/NetworkEntityAuthorityTracker.h>
 #include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <Source/NetworkEntity/NetworkRelevancyGrid.h>
 #include <Source/NetworkEntity/NetworkSpawnableLibrary.h>
 #include <Multiplayer/Components/MultiplayerComponentRegistry.h>
 #include <Multiplayer/EntityDomains/IEntityDomain.h>
@@ -42,6 +43,7 @@ namespace Multiplayer
         IEntityDomain* GetEntityDomain() const override;
         NetworkEntityTracker* GetNetworkEntityTracker() override;
         NetworkEntityAuthorityTracker* GetNetworkEntityAuthorityTracker() override;
+        NetworkRelevancyGrid* GetNetworkRelevancyGrid() override;
         MultiplayerComponentRegistry* GetMultiplayerComponentRegistry() override;
         const HostId& GetHostId() const override;
         ConstNetworkEntityHandle GetEntity(NetEntityId netEntityId) const override;
@@ -96,6 +98,7 @@ namespace Multiplayer
         void MarkAlwaysRelevantToServers(const ConstNetworkEntityHandle& entityHandle, bool alwaysRelevant) override;
         const NetEntityHandleSet& GetAlwaysRelevantToClientsSet() const override;
         const NetEntityHandleSet& GetAlwaysRelevantToServersSet() const override;
+        void SetRelevancyDistance(const ConstNetworkEntityHandle& entityHandle, float relevancyDistance) override;
         void SetMigrateTimeoutTimeMs(AZ::TimeMs timeoutTimeMs) override;
         void DebugDraw() const override;
         //! @}
@@ -121,17 +124,20 @@ namespace Multiplayer
 
     private:
         void RemoveEntities();
+        void UpdateEntityDomain();
         NetEntityId NextId();
         bool IsHierarchySafeToExit(NetworkEntityHandle& entityHandle, const NetEntityIdSet& entitiesNotInDomain);
 
         NetworkEntityTracker m_networkEntityTracker;
         NetworkEntityAuthorityTracker m_networkEntityAuthorityTracker;
+        NetworkRelevancyGrid m_networkRelevancyGrid;
         MultiplayerComponentRegistry m_multiplayerComponentRegistry;
 
         AZStd::unordered_set<ConstNetworkEntityHandle> m_alwaysRelevantToClients;
         AZStd::unordered_set<ConstNetworkEntityHandle> m_alwaysRelevantToServers;
 
         AZ::ScheduledEvent m_removeEntitiesEvent;
+        AZ::ScheduledEvent m_updateEntityDomainEvent;
         AZStd::vector<NetEntityId> m_removeList;
         AZStd::unique_ptr<IEntityDomain> m_entityDomain;
 
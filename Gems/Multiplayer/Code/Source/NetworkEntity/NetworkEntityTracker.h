@@ -10,7 +10,7 @@
 
 #include <Multiplayer/MultiplayerTypes.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
-#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/flat_hash_map.h>
 #include <AzCore/Component/Entity.h>
 
 namespace Multiplayer
@@ -23,9 +23,11 @@ namespace Multiplayer
     {
     public:
 
-        using EntityMap = AZStd::unordered_map<NetEntityId, AZ::Entity*>;
-        using NetEntityIdMap = AZStd::unordered_map<AZ::EntityId, NetEntityId>;
-        using NetBindingMap = AZStd::unordered_map<AZ::Entity*, NetBindComponent*>;
+        //! These maps are looked up for every replicated entity every tick, so they store their elements in flat hash tables.
+        //! Adding an entity can move the elements, so iterators of the tracker are invalidated by Add.
+        using EntityMap = AZStd::flat_hash_map<NetEntityId, AZ::Entity*>;
+        using NetEntityIdMap = AZStd::flat_hash_map<AZ::EntityId, NetEntityId>;
+        using NetBindingMap = AZStd::flat_hash_map<AZ::Entity*, NetBindComponent*>;
         using iterator = EntityMap::iterator;
         using const_iterator = EntityMap::const_iterator;
 
@@ -17,7 +17,9 @@ namespace Multiplayer
         , m_isDelete(rhs.m_isDelete)
         , m_wasMigrated(rhs.m_wasMigrated)
         , m_hasValidPrefabId(rhs.m_hasValidPrefabId)
+        , m_isSnapshot(rhs.m_isSnapshot)
         , m_prefabEntityId(rhs.m_prefabEntityId)
+        , m_snapshotBaseline(rhs.m_snapshotBaseline)
         , m_data(AZStd::move(rhs.m_data))
     {
         ;
@@ -29,7 +31,9 @@ namespace Multiplayer
         , m_isDelete(rhs.m_isDelete)
         , m_wasMigrated(rhs.m_wasMigrated)
         , m_hasValidPrefabId(rhs.m_hasValidPrefabId)
+        , m_isSnapshot(rhs.m_isSnapshot)
         , m_prefabEntityId(rhs.m_prefabEntityId)
+        , m_snapshotBaseline(rhs.m_snapshotBaseline)
     {
         if (rhs.m_data != nullptr)
         {
@@ -54,7 +58,9 @@ namespace Multiplayer
         m_isDelete = rhs.m_isDelete;
         m_wasMigrated = rhs.m_wasMigrated;
         m_hasValidPrefabId = rhs.m_hasValidPrefabId;
+        m_isSnapshot = rhs.m_isSnapshot;
         m_prefabEntityId = rhs.m_prefabEntityId;
+        m_snapshotBaseline = rhs.m_snapshotBaseline;
         m_data = AZStd::move(rhs.m_data);
         return *this;
     }
@@ -66,7 +72,9 @@ namespace Multiplayer
         m_isDelete = rhs.m_isDelete;
         m_wasMigrated = rhs.m_wasMigrated;
         m_hasValidPrefabId = rhs.m_hasValidPrefabId;
+        m_isSnapshot = rhs.m_isSnapshot;
         m_prefabEntityId = rhs.m_prefabEntityId;
+        m_snapshotBaseline = rhs.m_snapshotBaseline;
         if (rhs.m_data != nullptr)
         {
             m_data = AZStd::make_unique<AzNetworking::PacketEncodingBuffer>();
@@ -83,7 +91,9 @@ namespace Multiplayer
              && (m_isDelete == rhs.m_isDelete)
              && (m_wasMigrated == rhs.m_wasMigrated)
              && (m_hasValidPrefabId == rhs.m_hasValidPrefabId)
-             && (m_prefabEntityId == rhs.m_prefabEntityId));
+             && (m_isSnapshot == rhs.m_isSnapshot)
+             && (m_prefabEntityId == rhs.m_prefabEntityId)
+             && (m_snapshotBaseline == rhs.m_snapshotBaseline));
     }
 
     bool NetworkEntityUpdateMessage::operator !=(const NetworkEntityUpdateMessage& rhs) const
@@ -99,8 +109,9 @@ namespace Multiplayer
         static const uint32_t sizeOfEntityId = sizeof(NetEntityId);
         static const uint32_t sizeOfSliceId = 6;
 
-        // 2-byte size header + the actual blob payload itself
-        const uint32_t sizeOfBlob = static_cast<uint32_t>((m_data != nullptr) ? sizeof(PropertyIndex) + m_data->GetSize() : 0);
+        // 2-byte size header + the actual blob payload itself, plus the baseline packet id for snapshots
+        const uint32_t sizeOfBlob = static_cast<uint32_t>((m_data != nullptr) ? sizeof(PropertyIndex) + m_data->GetSize() : 0)
+                                  + (m_isSnapshot ? static_cast<uint32_t>(sizeof(AzNetworking::PacketId)) : 0);
 
         if (m_hasValidPrefabId)
         {
@@ -148,6 +159,22 @@ namespace Multiplayer
         return m_prefabEntityId;
     }
 
+    void NetworkEntityUpdateMessage::SetSnapshotBaseline(AzNetworking::PacketId baselinePacketId)
+    {
+        m_isSnapshot = true;
+        m_snapshotBaseline = baselinePacketId;
+    }
+
+    bool NetworkEntityUpdateMessage::GetIsSnapshot() const
+    {
+        return m_isSnapshot;
+    }
+
+    AzNetworking::PacketId NetworkEntityUpdateMessage::GetSnapshotBaseline() const
+    {
+        return m_snapshotBaseline;
+    }
+
     void NetworkEntityUpdateMessage::SetData(const AzNetworking::PacketEncodingBuffer& value)
     {
         if (m_data == nullptr)
@@ -177,13 +204,15 @@ namespace Multiplayer
         serializer.Serialize(m_entityId, "EntityId");
 
         // Use the upper 4 bits for boolean flags, and the lower 4 bits for the network role
-        uint8_t networkTypeAndFlags = (m_isDelete ? 0x40 : 0x00)
+        uint8_t networkTypeAndFlags = (m_isSnapshot ? 0x80 : 0x00)
+                                    | (m_isDelete ? 0x40 : 0x00)
                                     | (m_wasMigrated ? 0x20 : 0x00)
                                     | (m_hasValidPrefabId ? 0x10 : 0x00)
                                     | static_cast<uint8_t>(m_networkRole);
 
         if (serializer.Serialize(networkTypeAndFlags, "TypeAndFlags"))
         {
+            m_isSnapshot = (networkTypeAndFlags & 0x80) == 0x80;
             m_isDelete = (networkTypeAndFlags & 0x40) == 0x40;
             m_wasMigrated = (networkTypeAndFlags & 0x20) == 0x20;
             m_hasValidPrefabId = (networkTypeAndFlags & 0x10) == 0x10;
@@ -201,6 +230,11 @@ namespace Multiplayer
             serializer.Serialize(m_prefabEntityId, "PrefabEntityId");
         }
 
+        if (m_isSnapshot)
+        {
+            serializer.Serialize(m_snapshotBaseline, "SnapshotBaseline");
+        }
+
         // m_data should never be nullptr
         if (m_data == nullptr)
         {
@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/NetworkRelevancyGrid.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(float, sv_RelevancyGridCellSize, 250.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The size of a network relevancy grid cell, ideally about half the client awareness radius");
+
+    // Each cell coordinate is packed into 21 bits of the cell key, offset so that negative coordinates are representable
+    static constexpr uint32_t CellCoordinateBits = 21;
+    static constexpr int64_t CellCoordinateOffset = int64_t(1) << (CellCoordinateBits - 1);
+    static constexpr uint64_t CellCoordinateMask = (uint64_t(1) << CellCoordinateBits) - 1;
+
+    void NetworkRelevancyGrid::AddEntity(ConstNetworkEntityHandle entityHandle)
+    {
+        AZ::Entity* entity = entityHandle.GetEntity();
+        if (entity == nullptr)
+        {
+            return;
+        }
+
+        UpdateCellSize();
+
+        const NetEntityId netEntityId = entityHandle.GetNetEntityId();
+        RemoveEntity(netEntityId);
+
+        GridEntry& entry = m_entries[netEntityId];
+        entry.m_entityHandle = entityHandle;
+        if (entity->GetState() == AZ::Entity::State::Active)
+        {
+            if (AZ::TransformInterface* transformInterface = entity->GetTransform())
+            {
+                PlaceEntity(netEntityId, entry, *transformInterface);
+            }
+            return;
+        }
+
+        // Entities are registered before they're activated, the transform is only available once the entity is active
+        entry.m_entityStateHandler = AZ::Entity::EntityStateEvent::Handler(
+            [this, netEntityId, entity]([[maybe_unused]] AZ::Entity::State oldState, AZ::Entity::State newState)
+            {
+                auto entryIter = m_entries.find(netEntityId);
+                if (newState != AZ::Entity::State::Active || entryIter == m_entries.end() || entryIter->second.m_isPlaced)
+                {
+                    return;
+                }
+
+                if (AZ::TransformInterface* transformInterface = entity->GetTransform())
+                {
+                    PlaceEntity(netEntityId, entryIter->second, *transformInterface);
+                }
+            });
+        entity->AddStateEventHandler(entry.m_entityStateHandler);
+    }
+
+    void NetworkRelevancyGrid::RemoveEntity(NetEntityId netEntityId)
+    {
+        auto entryIter = m_entries.find(netEntityId);
+        if (entryIter == m_entries.end())
+        {
+            return;
+        }
+
+        const GridEntry& entry = entryIter->second;
+        if (entry.m_isPlaced && entry.m_relevancyDistance > 0.0f)
+        {
+            m_overriddenEntities.erase(netEntityId);
+        }
+        else if (entry.m_isPlaced)
+        {
+            RemoveFromCell(netEntityId, entry);
+        }
+        m_entries.erase(entryIter);
+    }
+
+    void NetworkRelevancyGrid::SetRelevancyDistance(NetEntityId netEntityId, float relevancyDistance)
+    {
+        auto entryIter = m_entries.find(netEntityId);
+        if (entryIter == m_entries.end())
+        {
+            return;
+        }
+
+        GridEntry& entry = entryIter->second;
+        const bool wasOverridden = (entry.m_relevancyDistance > 0.0f);
+        const bool isOverridden = (relevancyDistance > 0.0f);
+        entry.m_relevancyDistance = isOverridden ? relevancyDistance : 0.0f;
+        if (wasOverridden == isOverridden || !entry.m_isPlaced)
+        {
+            // Entities that aren't placed yet are placed according to their relevancy distance once they are
+            return;
+        }
+
+        if (isOverridden)
+        {
+            RemoveFromCell(netEntityId, entry);
+            m_overriddenEntities.emplace(netEntityId);
+        }
+        else
+        {
+            m_overriddenEntities.erase(netEntityId);
+            AddToCell(netEntityId, entry);
+        }
+    }
+
+    float NetworkRelevancyGrid::GetRelevancyDistance(NetEntityId netEntityId) const
+    {
+        auto entryIter = m_entries.find(netEntityId);
+        return (entryIter != m_entries.end()) ? entryIter->second.m_relevancyDistance : 0.0f;
+    }
+
+    void NetworkRelevancyGrid::GatherRelevantEntities(const AZ::Vector3& position, float radius, RelevantEntityList& outEntities)
+    {
+        outEntities.clear();
+        UpdateCellSize();
+
+        const int32_t minX = GetCellCoordinate(position.GetX() - radius);
+        const int32_t minY = GetCellCoordinate(position.GetY() - radius);
+        const int32_t minZ = GetCellCoordinate(position.GetZ() - radius);
+        const int32_t maxX = GetCellCoordinate(position.GetX() + radius);
+        const int32_t maxY = GetCellCoordinate(position.GetY() + radius);
+        const int32_t maxZ = GetCellCoordinate(position.GetZ() + radius);
+        const float radiusSquared = radius * radius;
+
+        // Large radii can overlap far more cells than are occupied, in which case walking the occupied cells is cheaper
+        const uint64_t overlappedCellCount = uint64_t(maxX - minX + 1) * uint64_t(maxY - minY + 1) * uint64_t(maxZ - minZ + 1);
+        if (overlappedCellCount <= m_cells.size())
+        {
+            for (int32_t x = minX; x <= maxX; ++x)
+            {
+                for (int32_t y = minY; y <= maxY; ++y)
+                {
+                    for (int32_t z = minZ; z <= maxZ; ++z)
+                    {
+                        auto cellIter = m_cells.find(GetCellKey(x, y, z));
+                        if (cellIter != m_cells.end())
+                        {
+                            GatherFromCell(cellIter->second, position, radiusSquared, outEntities);
+                        }
+                    }
+                }
+            }
+        }
+        else
+        {
+            for (const auto& cell : m_cells)
+            {
+                const int32_t x = static_cast<int32_t>(static_cast<int64_t>((cell.first >> (2 * CellCoordinateBits)) & CellCoordinateMask) - CellCoordinateOffset);
+                const int32_t y = static_cast<int32_t>(static_cast<int64_t>((cell.first >> CellCoordinateBits) & CellCoordinateMask) - CellCoordinateOffset);
+                const int32_t z = static_cast<int32_t>(static_cast<int64_t>(cell.first & CellCoordinateMask) - CellCoordinateOffset);
+                if ((x >= minX) && (x <= maxX) && (y >= minY) && (y <= maxY) && (z >= minZ) && (z <= maxZ))
+                {
+                    GatherFromCell(cell.second, position, radiusSquared, outEntities);
+                }
+            }
+        }
+
+        for (NetEntityId netEntityId : m_overriddenEntities)
+        {
+            const GridEntry& entry = m_entries.find(netEntityId)->second;
+            const float distanceSquared = position.GetDistanceSq(entry.m_position);
+            if (distanceSquared <= entry.m_relevancyDistance * entry.m_relevancyDistance)
+            {
+                outEntities.push_back({ entry.m_entityHandle, distanceSquared });
+            }
+        }
+    }
+
+    uint32_t NetworkRelevancyGrid::GetEntityCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_entries.size());
+    }
+
+    void NetworkRelevancyGrid::Clear()
+    {
+        m_entries.clear();
+        m_cells.clear();
+        m_overriddenEntities.clear();
+    }
+
+    int32_t NetworkRelevancyGrid::GetCellCoordinate(float value) const
+    {
+        const float cellCoordinate = AZStd::clamp(
+            AZStd::floor(value / m_cellSize), -static_cast<float>(CellCoordinateOffset), static_cast<float>(CellCoordinateOffset - 1));
+        return static_cast<int32_t>(cellCoordinate);
+    }
+
+    NetworkRelevancyGrid::CellKey NetworkRelevancyGrid::GetCellKey(int32_t x, int32_t y, int32_t z) const
+    {
+        return ((static_cast<uint64_t>(x + CellCoordinateOffset) & CellCoordinateMask) << (2 * CellCoordinateBits))
+            | ((static_cast<uint64_t>(y + CellCoordinateOffset) & CellCoordinateMask) << CellCoordinateBits)
+            | (static_cast<uint64_t>(z + CellCoordinateOffset) & CellCoordinateMask);
+    }
+
+    NetworkRelevancyGrid::CellKey NetworkRelevancyGrid::GetCellKey(const AZ::Vector3& position) const
+    {
+        return GetCellKey(GetCellCoordinate(position.GetX()), GetCellCoordinate(position.GetY()), GetCellCoordinate(position.GetZ()));
+    }
+
+    void NetworkRelevancyGrid::PlaceEntity(NetEntityId netEntityId, GridEntry& entry, AZ::TransformInterface& transformInterface)
+    {
+        entry.m_position = transformInterface.GetWorldTranslation();
+        entry.m_isPlaced = true;
+        if (entry.m_relevancyDistance > 0.0f)
+        {
+            m_overriddenEntities.emplace(netEntityId);
+        }
+        else
+        {
+            AddToCell(netEntityId, entry);
+        }
+
+        entry.m_transformChangedHandler = AZ::TransformChangedEvent::Handler(
+            [this, netEntityId]([[maybe_unused]] const AZ::Transform& localTm, const AZ::Transform& worldTm)
+            {
+                UpdateEntityPosition(netEntityId, worldTm.GetTranslation());
+            });
+        transformInterface.BindTransformChangedEventHandler(entry.m_transformChangedHandler);
+    }
+
+    void NetworkRelevancyGrid::UpdateEntityPosition(NetEntityId netEntityId, const AZ::Vector3& position)
+    {
+        auto entryIter = m_entries.find(netEntityId);
+        if (entryIter == m_entries.end())
+        {
+            return;
+        }
+
+        GridEntry& entry = entryIter->second;
+        entry.m_position = position;
+        if (entry.m_relevancyDistance > 0.0f)
+        {
+            return;
+        }
+
+        const CellKey cellKey = GetCellKey(position);
+        if (cellKey != entry.m_cellKey)
+        {
+            RemoveFromCell(netEntityId, entry);
+            AddToCell(netEntityId, entry);
+        }
+    }
+
+    void NetworkRelevancyGrid::AddToCell(NetEntityId netEntityId, GridEntry& entry)
+    {
+        entry.m_cellKey = GetCellKey(entry.m_position);
+        m_cells[entry.m_cellKey].push_back(netEntityId);
+    }
+
+    void NetworkRelevancyGrid::RemoveFromCell(NetEntityId netEntityId, const GridEntry& entry)
+    {
+        auto cellIter = m_cells.find(entry.m_cellKey);
+        if (cellIter == m_cells.end())
+        {
+            return;
+        }
+
+        AZStd::vector<NetEntityId>& cell = cellIter->second;
+        auto iter = AZStd::find(cell.begin(), cell.end(), netEntityId);
+        if (iter != cell.end())
+        {
+            // Order within a cell does not matter, so swap with the back to avoid shifting the remaining entities
+            *iter = cell.back();
+            cell.pop_back();
+        }
+        if (cell.empty())
+        {
+            m_cells.erase(cellIter);
+        }
+    }
+
+    void NetworkRelevancyGrid::GatherFromCell(const AZStd::vector<NetEntityId>& cell, const AZ::Vector3& position, float radiusSquared, RelevantEntityList& outEntities) const
+    {
+        for (NetEntityId netEntityId : cell)
+        {
+            const GridEntry& entry = m_entries.find(netEntityId)->second;
+            const float distanceSquared = position.GetDistanceSq(entry.m_position);
+            if (distanceSquared <= radiusSquared)
+            {
+                outEntities.push_back({ entry.m_entityHandle, distanceSquared });
+            }
+        }
+    }
+
+    void NetworkRelevancyGrid::UpdateCellSize()
+    {
+        const float cellSize = AZStd::max(static_cast<float>(sv_RelevancyGridCellSize), 1.0f);
+        if (cellSize == m_cellSize)
+        {
+            return;
+        }
+
+        m_cellSize = cellSize;
+        m_cells.clear();
+        for (auto& entry : m_entries)
+        {
+            if (entry.second.m_isPlaced && entry.second.m_relevancyDistance <= 0.0f)
+            {
+                AddToCell(entry.first, entry.second);
+            }
+        }
+    }
+}
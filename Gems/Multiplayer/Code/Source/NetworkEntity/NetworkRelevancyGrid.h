@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    //! @class NetworkRelevancyGrid
+    //! @brief A spatial hash of networked entities used to gather the entities relevant to a replication window.
+    //! Entities are bucketed into uniform cells by their world translation and moved between cells as their transforms change,
+    //! so a query only visits the entities in the cells overlapping the query radius.
+    //! Entities with a relevancy distance override are kept out of the cells and tested against their own distance on every query.
+    //! Entities are usually added when they're registered, before they're activated, so an entity only gets a position once
+    //! its transform is available, which is when it's added for entities that are already active, or else when it activates.
+    class NetworkRelevancyGrid
+    {
+    public:
+
+        struct RelevantEntity
+        {
+            ConstNetworkEntityHandle m_entityHandle;
+            float m_distanceSquared = 0.0f;
+        };
+        using RelevantEntityList = AZStd::vector<RelevantEntity>;
+
+        NetworkRelevancyGrid() = default;
+
+        //! Adds a networked entity to the grid. Entities that aren't active yet are placed in the grid once they activate,
+        //! and entities without a transform are tracked but never gathered.
+        //! @param entityHandle handle to the entity to add
+        void AddEntity(ConstNetworkEntityHandle entityHandle);
+
+        //! Removes a networked entity from the grid.
+        //! @param netEntityId the id of the entity to remove
+        void RemoveEntity(NetEntityId netEntityId);
+
+        //! Overrides the distance within which an entity is relevant, regardless of the radius used to query the grid.
+        //! @param netEntityId       the id of the entity to override the relevancy distance of
+        //! @param relevancyDistance the relevancy distance to use, a value of zero or less restores the default query radius
+        void SetRelevancyDistance(NetEntityId netEntityId, float relevancyDistance);
+
+        //! Returns the relevancy distance override of an entity.
+        //! @param netEntityId the id of the entity to retrieve the relevancy distance override of
+        //! @return the relevancy distance override, or zero if the entity uses the default query radius
+        float GetRelevancyDistance(NetEntityId netEntityId) const;
+
+        //! Gathers the entities within radius of position, plus any entity within its own relevancy distance override.
+        //! @param position    the position to gather relevant entities around
+        //! @param radius      the radius to gather entities without a relevancy distance override within
+        //! @param outEntities the gathered entities and their squared distance to position, the list is cleared first
+        void GatherRelevantEntities(const AZ::Vector3& position, float radius, RelevantEntityList& outEntities);
+
+        //! Returns the number of entities tracked by the grid.
+        //! @return the number of entities tracked by the grid
+        uint32_t GetEntityCount() const;
+
+        //! Removes all entities from the grid.
+        void Clear();
+
+    private:
+
+        using CellKey = uint64_t;
+
+        struct GridEntry
+        {
+            ConstNetworkEntityHandle m_entityHandle;
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+            CellKey m_cellKey = 0;
+            float m_relevancyDistance = 0.0f;
+            bool m_isPlaced = false; //!< Whether the entity has a position, and is in a cell or the overridden entities
+            AZ::TransformChangedEvent::Handler m_transformChangedHandler;
+            AZ::Entity::EntityStateEvent::Handler m_entityStateHandler;
+        };
+
+        int32_t GetCellCoordinate(float value) const;
+        CellKey GetCellKey(int32_t x, int32_t y, int32_t z) const;
+        CellKey GetCellKey(const AZ::Vector3& position) const;
+
+        //! Places the entity at its transform's translation and follows its transform changes.
+        void PlaceEntity(NetEntityId netEntityId, GridEntry& entry, AZ::TransformInterface& transformInterface);
+        void UpdateEntityPosition(NetEntityId netEntityId, const AZ::Vector3& position);
+        void AddToCell(NetEntityId netEntityId, GridEntry& entry);
+        void RemoveFromCell(NetEntityId netEntityId, const GridEntry& entry);
+        void GatherFromCell(const AZStd::vector<NetEntityId>& cell, const AZ::Vector3& position, float radiusSquared, RelevantEntityList& outEntities) const;
+
+        //! Re-buckets all entities if the configured cell size has changed.
+        void UpdateCellSize();
+
+        AZStd::unordered_map<NetEntityId, GridEntry> m_entries;
+        AZStd::unordered_map<CellKey, AZStd::vector<NetEntityId>> m_cells;
+        AZStd::unordered_set<NetEntityId> m_overriddenEntities;
+        float m_cellSize = 0.0f;
+    };
+}
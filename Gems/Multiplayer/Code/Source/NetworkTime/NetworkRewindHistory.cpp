@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkTime/NetworkRewindHistory.h>
+#include <Multiplayer/NetworkTime/INetworkTime.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+
+namespace Multiplayer
+{
+    static constexpr uint32_t MinRewindSlotCapacity = 64;
+
+    RewindSlot NetworkRewindHistory::AddSlot(const AZ::Transform& transform)
+    {
+        RewindSlot slot = InvalidRewindSlot;
+        if (!m_freeSlots.empty())
+        {
+            slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        else
+        {
+            if (m_slotHighWaterMark >= m_slotCapacity)
+            {
+                GrowSlotCapacity();
+            }
+            slot = m_slotHighWaterMark++;
+        }
+
+        // Like RewindableObject, a new value has no history, so rewinding to any frame returns the initial value
+        const AZ::Vector3 translation = transform.GetTranslation();
+        const AZ::Quaternion rotation = transform.GetRotation();
+        const float scale = transform.GetUniformScale();
+        for (uint32_t row = 0; row < RewindHistorySize; ++row)
+        {
+            const uint32_t index = row * m_slotCapacity + slot;
+            m_translations[index] = translation;
+            m_rotations[index] = rotation;
+            m_scales[index] = scale;
+        }
+        return slot;
+    }
+
+    void NetworkRewindHistory::RemoveSlot(RewindSlot slot)
+    {
+        AZ_Assert(slot < m_slotHighWaterMark, "Removing an invalid rewind slot");
+        if (slot == m_slotHighWaterMark - 1)
+        {
+            // Avoid carrying the released slot forward when advancing frames
+            --m_slotHighWaterMark;
+        }
+        else
+        {
+            m_freeSlots.push_back(slot);
+        }
+    }
+
+    void NetworkRewindHistory::SetTransform(RewindSlot slot, const AZ::Transform& transform, HostFrameId frameId)
+    {
+        AZ_Assert(slot < m_slotHighWaterMark, "Setting the transform of an invalid rewind slot");
+        if (frameId < m_headFrameId)
+        {
+            // Don't try and set values older than our current head frame
+            return;
+        }
+
+        AdvanceToFrame(frameId);
+        const uint32_t index = GetRowIndex(frameId) * m_slotCapacity + slot;
+        m_translations[index] = transform.GetTranslation();
+        m_rotations[index] = transform.GetRotation();
+        m_scales[index] = transform.GetUniformScale();
+    }
+
+    void NetworkRewindHistory::SetTransform(RewindSlot slot, const AZ::Transform& transform)
+    {
+        SetTransform(slot, transform, GetNetworkTime()->GetHostFrameId());
+    }
+
+    AZ::Transform NetworkRewindHistory::GetTransform(RewindSlot slot, HostFrameId frameId) const
+    {
+        AZ_Assert(slot < m_slotHighWaterMark, "Getting the transform of an invalid rewind slot");
+        const uint32_t index = GetRowIndex(ClampFrameId(frameId)) * m_slotCapacity + slot;
+        AZ::Transform transform = AZ::Transform::CreateFromQuaternionAndTranslation(m_rotations[index], m_translations[index]);
+        transform.SetUniformScale(m_scales[index]);
+        return transform;
+    }
+
+    void NetworkRewindHistory::GetTransforms(AZStd::span<const RewindSlot> slots, HostFrameId frameId, float blendFactor, AZ::Transform* outTransforms) const
+    {
+        const uint32_t currentRow = GetRowIndex(ClampFrameId(frameId)) * m_slotCapacity;
+        if (blendFactor >= 1.0f)
+        {
+            for (size_t i = 0; i < slots.size(); ++i)
+            {
+                const uint32_t index = currentRow + slots[i];
+                outTransforms[i] = AZ::Transform::CreateFromQuaternionAndTranslation(m_rotations[index], m_translations[index]);
+                outTransforms[i].SetUniformScale(m_scales[index]);
+            }
+            return;
+        }
+
+        // If a blend factor was supplied, interpolate from the preceding frame
+        const HostFrameId previousFrameId = (frameId > HostFrameId(0)) ? frameId - HostFrameId(1) : frameId;
+        const uint32_t previousRow = GetRowIndex(ClampFrameId(previousFrameId)) * m_slotCapacity;
+        for (size_t i = 0; i < slots.size(); ++i)
+        {
+            const uint32_t index = currentRow + slots[i];
+            const uint32_t previousIndex = previousRow + slots[i];
+            outTransforms[i] = AZ::Transform::CreateFromQuaternionAndTranslation(
+                m_rotations[previousIndex].Slerp(m_rotations[index], blendFactor),
+                m_translations[previousIndex].Lerp(m_translations[index], blendFactor));
+            outTransforms[i].SetUniformScale(AZ::Lerp(m_scales[previousIndex], m_scales[index], blendFactor));
+        }
+    }
+
+    void NetworkRewindHistory::GetRewoundTransforms(
+        AZStd::span<const RewindSlot> slots, AzNetworking::ConnectionId owningConnectionId, AZ::Transform* outTransforms) const
+    {
+        const INetworkTime* networkTime = GetNetworkTime();
+        if (networkTime->IsTimeRewound() && (owningConnectionId == networkTime->GetRewindingConnectionId()))
+        {
+            GetTransforms(slots, networkTime->GetUnalteredHostFrameId(), 1.0f, outTransforms);
+        }
+        else
+        {
+            GetTransforms(slots, networkTime->GetHostFrameId(), networkTime->GetHostBlendFactor(), outTransforms);
+        }
+    }
+
+    uint32_t NetworkRewindHistory::GetSlotCount() const
+    {
+        return m_slotHighWaterMark - aznumeric_cast<uint32_t>(m_freeSlots.size());
+    }
+
+    uint32_t NetworkRewindHistory::GetRowIndex(HostFrameId frameId) const
+    {
+        return static_cast<uint32_t>(frameId) % RewindHistorySize;
+    }
+
+    HostFrameId NetworkRewindHistory::ClampFrameId(HostFrameId frameId) const
+    {
+        if (frameId > m_headFrameId)
+        {
+            return m_headFrameId;
+        }
+
+        const HostFrameId oldestFrameId = (m_headFrameId >= HostFrameId(RewindHistorySize - 1))
+            ? m_headFrameId - HostFrameId(RewindHistorySize - 1)
+            : HostFrameId(0);
+        return AZStd::max(frameId, oldestFrameId);
+    }
+
+    void NetworkRewindHistory::AdvanceToFrame(HostFrameId frameId)
+    {
+        if (frameId <= m_headFrameId)
+        {
+            return;
+        }
+
+        // Each new row starts as a copy of the head row, so slots that aren't set on a frame keep their most recent transform
+        // If more frames were skipped than the history holds, every other row gets overwritten and only the row index matters
+        const uint32_t headRow = GetRowIndex(m_headFrameId) * m_slotCapacity;
+        const uint32_t framesToAdvance = AZStd::min(static_cast<uint32_t>(frameId - m_headFrameId), RewindHistorySize - 1);
+        for (uint32_t frame = 1; frame <= framesToAdvance; ++frame)
+        {
+            const uint32_t row = GetRowIndex(m_headFrameId + HostFrameId(frame)) * m_slotCapacity;
+            AZStd::copy(m_translations.begin() + headRow, m_translations.begin() + headRow + m_slotHighWaterMark, m_translations.begin() + row);
+            AZStd::copy(m_rotations.begin() + headRow, m_rotations.begin() + headRow + m_slotHighWaterMark, m_rotations.begin() + row);
+            AZStd::copy(m_scales.begin() + headRow, m_scales.begin() + headRow + m_slotHighWaterMark, m_scales.begin() + row);
+        }
+
+        m_headFrameId = frameId;
+    }
+
+    void NetworkRewindHistory::GrowSlotCapacity()
+    {
+        const uint32_t newCapacity = AZStd::max(m_slotCapacity * 2, MinRewindSlotCapacity);
+        AZStd::vector<AZ::Vector3> translations(RewindHistorySize * newCapacity, AZ::Vector3::CreateZero());
+        AZStd::vector<AZ::Quaternion> rotations(RewindHistorySize * newCapacity, AZ::Quaternion::CreateIdentity());
+        AZStd::vector<float> scales(RewindHistorySize * newCapacity, 1.0f);
+        for (uint32_t row = 0; row < RewindHistorySize; ++row)
+        {
+            const uint32_t oldRow = row * m_slotCapacity;
+            const uint32_t newRow = row * newCapacity;
+            AZStd::copy(m_translations.begin() + oldRow, m_translations.begin() + oldRow + m_slotHighWaterMark, translations.begin() + newRow);
+            AZStd::copy(m_rotations.begin() + oldRow, m_rotations.begin() + oldRow + m_slotHighWaterMark, rotations.begin() + newRow);
+            AZStd::copy(m_scales.begin() + oldRow, m_scales.begin() + oldRow + m_slotHighWaterMark, scales.begin() + newRow);
+        }
+        m_translations = AZStd::move(translations);
+        m_rotations = AZStd::move(rotations);
+        m_scales = AZStd::move(scales);
+        m_slotCapacity = newCapacity;
+    }
+}
@@ -178,4 +178,9 @@ namespace Multiplayer
         }
         m_rewoundEntities.clear();
     }
+
+    NetworkRewindHistory& NetworkTime::GetRewindHistory()
+    {
+        return m_rewindHistory;
+    }
 }
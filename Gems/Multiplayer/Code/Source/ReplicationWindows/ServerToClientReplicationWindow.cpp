@@ -24,6 +24,7 @@ namespace Multiplayer
     AZ_CVAR(uint32_t, sv_PacketsToIntegrateQos, 1000, nullptr, AZ::ConsoleFunctorFlags::Null, "The number of packets to accumulate before updating connection quality of service metrics");
     AZ_CVAR(float, sv_BadConnectionThreshold, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null, "The loss percentage beyond which we consider our network bad");
     AZ_CVAR(float, sv_ClientAwarenessRadius, 500.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The maximum distance entities can be from the client and still be relevant");
+    AZ_CVAR(bool, sv_UseNetworkRelevancyGrid, false, nullptr, AZ::ConsoleFunctorFlags::Null, "Gather relevant entities from the network relevancy grid instead of the visibility system");
 
     const char* GetConnectionStateString(bool isPoor)
     {
@@ -112,6 +113,40 @@ namespace Multiplayer
         AZ::TransformInterface* transformInterface = m_controlledEntity.GetEntity()->GetTransform();
         const AZ::Vector3 controlledEntityPosition = transformInterface->GetWorldTranslation();
 
+        NetworkRelevancyGrid* relevancyGrid = GetNetworkEntityManager()->GetNetworkRelevancyGrid();
+        if (sv_UseNetworkRelevancyGrid && relevancyGrid)
+        {
+            GatherFromRelevancyGrid(*relevancyGrid, controlledEntityPosition);
+        }
+        else
+        {
+            GatherFromVisibilitySystem(controlledEntityPosition);
+        }
+
+        // Add in all entities that have forced relevancy
+        const Multiplayer::NetEntityHandleSet& alwaysRelevantToClients = GetNetworkEntityManager()->GetAlwaysRelevantToClientsSet();
+        for (const ConstNetworkEntityHandle& entityHandle : alwaysRelevantToClients)
+        {
+            if (entityHandle.Exists())
+            {
+                AZ_Assert(entityHandle.GetNetBindComponent()->IsNetEntityRoleAuthority(), "Encountered forced relevant entity that is not in an authority role");
+                m_replicationSet[entityHandle] = { NetEntityRole::Client, 1.0f }; // Always replicate entities with forced relevancy
+            }
+        }
+
+        // Add in Autonomous Entities
+        // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
+        m_replicationSet[m_controlledEntity] = { NetEntityRole::Autonomous, 1.0f }; // Always replicate autonomous entities
+
+        auto* hierarchyComponent = m_controlledEntity.FindComponent<NetworkHierarchyRootComponent>();
+        if (hierarchyComponent != nullptr)
+        {
+            UpdateHierarchyReplicationSet(m_replicationSet, *hierarchyComponent);
+        }
+    }
+
+    void ServerToClientReplicationWindow::GatherFromVisibilitySystem(const AZ::Vector3& controlledEntityPosition)
+    {
         AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
         AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
         AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
@@ -159,26 +194,29 @@ namespace Multiplayer
                 
             AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
         }
+    }
 
-        // Add in all entities that have forced relevancy
-        const Multiplayer::NetEntityHandleSet& alwaysRelevantToClients = GetNetworkEntityManager()->GetAlwaysRelevantToClientsSet();
-        for (const ConstNetworkEntityHandle& entityHandle : alwaysRelevantToClients)
+    void ServerToClientReplicationWindow::GatherFromRelevancyGrid(NetworkRelevancyGrid& relevancyGrid, const AZ::Vector3& controlledEntityPosition)
+    {
+        relevancyGrid.GatherRelevantEntities(controlledEntityPosition, sv_ClientAwarenessRadius, m_relevantEntities);
+
+        IFilterEntityManager* filterEntityManager = AZ::Interface<IFilterEntityManager>::Get();
+        for (const NetworkRelevancyGrid::RelevantEntity& relevantEntity : m_relevantEntities)
         {
-            if (entityHandle.Exists())
+            ConstNetworkEntityHandle entityHandle = relevantEntity.m_entityHandle;
+            if (!entityHandle.Exists())
             {
-                AZ_Assert(entityHandle.GetNetBindComponent()->IsNetEntityRoleAuthority(), "Encountered forced relevant entity that is not in an authority role");
-                m_replicationSet[entityHandle] = { NetEntityRole::Client, 1.0f }; // Always replicate entities with forced relevancy
+                continue;
             }
-        }
 
-        // Add in Autonomous Entities
-        // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
-        m_replicationSet[m_controlledEntity] = { NetEntityRole::Autonomous, 1.0f }; // Always replicate autonomous entities
+            if (filterEntityManager && filterEntityManager->IsEntityFiltered(entityHandle.GetEntity(), m_controlledEntity, m_connection->GetConnectionId()))
+            {
+                continue;
+            }
 
-        auto* hierarchyComponent = m_controlledEntity.FindComponent<NetworkHierarchyRootComponent>();
-        if (hierarchyComponent != nullptr)
-        {
-            UpdateHierarchyReplicationSet(m_replicationSet, *hierarchyComponent);
+            // The grid tracks entity translations, so prioritize by the distance to the entity origin
+            const float priority = (relevantEntity.m_distanceSquared > 0.0f) ? 1.0f / relevantEntity.m_distanceSquared : 0.0f;
+            AddEntityToReplicationSet(entityHandle, priority, relevantEntity.m_distanceSquared);
         }
     }
 
@@ -21,6 +21,7 @@
 #include <Multiplayer/Components/NetworkHierarchyChildComponent.h>
 #include <Multiplayer/Components/NetworkHierarchyRootComponent.h>
 #include <Multiplayer/NetworkEntity/EntityReplication/EntityReplicator.h>
+#include <Multiplayer/NetworkTime/NetworkRewindHistory.h>
 
 namespace Multiplayer
 {
@@ -145,6 +146,13 @@ namespace Multiplayer
         void AlterTime([[maybe_unused]] HostFrameId frameId, [[maybe_unused]] AZ::TimeMs timeMs, [[maybe_unused]] float blendFactor, [[maybe_unused]] AzNetworking::ConnectionId rewindConnectionId) override
         {
         }
+
+        NetworkRewindHistory& GetRewindHistory() override
+        {
+            return m_rewindHistory;
+        }
+
+        NetworkRewindHistory m_rewindHistory;
     };
 
     class BenchmarkMultiplayerConnection : public IConnection
@@ -205,6 +213,7 @@ namespace Multiplayer
 
         NetworkEntityTracker* GetNetworkEntityTracker() override { return &m_tracker; }
         NetworkEntityAuthorityTracker* GetNetworkEntityAuthorityTracker() override { return &m_authorityTracker; }
+        NetworkRelevancyGrid* GetNetworkRelevancyGrid() override { return nullptr; }
         MultiplayerComponentRegistry* GetMultiplayerComponentRegistry() override { return &m_multiplayerComponentRegistry; }
         const HostId& GetHostId() const override { return m_hostId; }
 
@@ -287,6 +296,7 @@ namespace Multiplayer
         void ForceAssumeAuthority([[maybe_unused]] const ConstNetworkEntityHandle& entityHandle) override {}
         void MarkAlwaysRelevantToClients(const ConstNetworkEntityHandle&, bool) override {}
         void MarkAlwaysRelevantToServers(const ConstNetworkEntityHandle&, bool) override {}
+        void SetRelevancyDistance(const ConstNetworkEntityHandle&, float) override {}
         const NetEntityHandleSet& GetAlwaysRelevantToClientsSet() const override { static NetEntityHandleSet value; return value; }
         const NetEntityHandleSet& GetAlwaysRelevantToServersSet() const override { static NetEntityHandleSet value; return value; }
         void SetMigrateTimeoutTimeMs([[maybe_unused]] AZ::TimeMs timeoutTimeMs) override {}
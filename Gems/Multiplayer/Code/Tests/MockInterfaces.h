@@ -14,6 +14,7 @@
 #include <AzTest/AzTest.h>
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityRpcMessage.h>
+#include <Multiplayer/NetworkTime/NetworkRewindHistory.h>
 
 namespace UnitTest
 {
@@ -59,6 +60,7 @@ namespace UnitTest
         MOCK_CONST_METHOD0(GetEntityDomain, Multiplayer::IEntityDomain*());
         MOCK_METHOD0(GetNetworkEntityTracker, Multiplayer::NetworkEntityTracker* ());
         MOCK_METHOD0(GetNetworkEntityAuthorityTracker, Multiplayer::NetworkEntityAuthorityTracker* ());
+        MOCK_METHOD0(GetNetworkRelevancyGrid, Multiplayer::NetworkRelevancyGrid* ());
         MOCK_METHOD0(GetMultiplayerComponentRegistry, Multiplayer::MultiplayerComponentRegistry* ());
         MOCK_CONST_METHOD0(GetHostId, const Multiplayer::HostId&());
         MOCK_CONST_METHOD1(GetEntity, Multiplayer::ConstNetworkEntityHandle(Multiplayer::NetEntityId));
@@ -97,6 +99,7 @@ namespace UnitTest
         MOCK_METHOD2(MarkAlwaysRelevantToServers, void(const Multiplayer::ConstNetworkEntityHandle&, bool));
         const Multiplayer::NetEntityHandleSet& GetAlwaysRelevantToClientsSet() const override { static Multiplayer::NetEntityHandleSet value; return value; }
         const Multiplayer::NetEntityHandleSet& GetAlwaysRelevantToServersSet() const override { static Multiplayer::NetEntityHandleSet value; return value; }
+        MOCK_METHOD2(SetRelevancyDistance, void(const Multiplayer::ConstNetworkEntityHandle&, float));
         MOCK_METHOD1(SetMigrateTimeoutTimeMs, void(AZ::TimeMs));
         MOCK_CONST_METHOD0(DebugDraw, void());
     };
@@ -127,6 +130,7 @@ namespace UnitTest
         MOCK_METHOD4(AlterTime, void (Multiplayer::HostFrameId, AZ::TimeMs, float, AzNetworking::ConnectionId));
         MOCK_METHOD1(SyncEntitiesToRewindState, void(const AZ::Aabb&));
         MOCK_METHOD0(ClearRewoundEntities, void());
+        MOCK_METHOD0(GetRewindHistory, Multiplayer::NetworkRewindHistory&());
     };
 
     class MockComponentApplicationRequests : public AZ::ComponentApplicationRequests
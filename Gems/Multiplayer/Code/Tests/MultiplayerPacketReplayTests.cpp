@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <MockInterfaces.h>
+#include <Source/MultiplayerPacketReplay.h>
+#include <Source/AutoGen/Multiplayer.AutoPackets.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Time/TimeSystem.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace testing;
+
+    class MultiplayerPacketReplayTests
+        : public LeakDetectionFixture
+    {
+    public:
+        AZ::LoggerSystemComponent m_loggerComponent;
+        AZ::TimeSystem m_timeSystem;
+    };
+
+    TEST_F(MultiplayerPacketReplayTests, ConnectionsKeepCapturedIds)
+    {
+        NiceMock<MockConnectionListener> connectionListener;
+        Multiplayer::MultiplayerReplayConnectionSet connectionSet(connectionListener);
+
+        const AzNetworking::IpAddress address(127, 0, 0, 1, 12345);
+        EXPECT_NE(connectionSet.AddConnection(AzNetworking::ConnectionId{ 7 }, address, AzNetworking::ConnectionRole::Acceptor), nullptr);
+        EXPECT_EQ(connectionSet.AddConnection(AzNetworking::ConnectionId{ 7 }, address, AzNetworking::ConnectionRole::Acceptor), nullptr);
+
+        AzNetworking::IConnection* connection = connectionSet.GetConnection(AzNetworking::ConnectionId{ 7 });
+        ASSERT_NE(connection, nullptr);
+        EXPECT_EQ(connection->GetRemoteAddress(), address);
+        EXPECT_EQ(connectionSet.GetConnectionCount(), 1);
+        EXPECT_EQ(connectionSet.GetActiveConnectionCount(), 1);
+        EXPECT_EQ(connectionSet.GetNextConnectionId(), AzNetworking::ConnectionId{ 8 });
+    }
+
+    TEST_F(MultiplayerPacketReplayTests, SentPacketsAreCountedAndAcked)
+    {
+        NiceMock<MockConnectionListener> connectionListener;
+        Multiplayer::MultiplayerReplayConnectionSet connectionSet(connectionListener);
+        AzNetworking::IConnection* connection = connectionSet.AddConnection(
+            AzNetworking::ConnectionId{ 1 }, AzNetworking::IpAddress(127, 0, 0, 1, 12345), AzNetworking::ConnectionRole::Acceptor);
+
+        MultiplayerPackets::SyncConsole packet;
+        packet.ModifyCommandSet().emplace_back("sv_test 1");
+
+        EXPECT_TRUE(connection->SendReliablePacket(packet));
+        const AzNetworking::PacketId packetId = connection->SendUnreliablePacket(packet);
+        EXPECT_NE(packetId, AzNetworking::InvalidPacketId);
+        EXPECT_TRUE(connection->WasPacketAcked(packetId));
+        EXPECT_FALSE(connection->WasPacketAcked(packetId + AzNetworking::PacketId{ 1 }));
+        EXPECT_GT(connectionSet.GetSentBytes(), 0);
+        EXPECT_EQ(connection->GetMetrics().m_packetsSent, 2);
+    }
+
+    TEST_F(MultiplayerPacketReplayTests, DisconnectNotifiesListenerAndDefersRemoval)
+    {
+        MockConnectionListener connectionListener;
+        Multiplayer::MultiplayerReplayConnectionSet connectionSet(connectionListener);
+        AzNetworking::IConnection* connection = connectionSet.AddConnection(
+            AzNetworking::ConnectionId{ 1 }, AzNetworking::IpAddress(127, 0, 0, 1, 12345), AzNetworking::ConnectionRole::Acceptor);
+
+        MultiplayerPackets::SyncConsole packet;
+        packet.ModifyCommandSet().emplace_back("sv_test 1");
+        EXPECT_TRUE(connection->SendReliablePacket(packet));
+        const uint64_t sentBytes = connectionSet.GetSentBytes();
+
+        EXPECT_CALL(connectionListener, OnDisconnect(connection, DisconnectReason::TerminatedByClient, TerminationEndpoint::Remote)).Times(1);
+        EXPECT_TRUE(connection->Disconnect(DisconnectReason::TerminatedByClient, TerminationEndpoint::Remote));
+        EXPECT_FALSE(connection->Disconnect(DisconnectReason::TerminatedByClient, TerminationEndpoint::Remote));
+        EXPECT_FALSE(connection->SendReliablePacket(packet));
+
+        // The connection survives until the next flush, so disconnects are safe while visiting connections
+        EXPECT_EQ(connectionSet.GetConnectionCount(), 1);
+        EXPECT_EQ(connectionSet.GetActiveConnectionCount(), 0);
+        connectionSet.FlushQueuedRemoves();
+        EXPECT_EQ(connectionSet.GetConnectionCount(), 0);
+        EXPECT_EQ(connectionSet.GetSentBytes(), sentBytes);
+    }
+}
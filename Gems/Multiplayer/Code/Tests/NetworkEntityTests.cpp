@@ -9,9 +9,11 @@
 #include <MockInterfaces.h>
 #include <TestMultiplayerComponent.h>
 #include <Source/NetworkEntity/NetworkEntityManager.h>
+#include <Source/NetworkEntity/EntityReplication/EntitySnapshotDelta.h>
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
 #include <Source/EntityDomains/FullOwnershipEntityDomain.h>
 #include <Source/EntityDomains/NullEntityDomain.h>
+#include <Source/EntityDomains/SpatialEntityDomain.h>
 #include <Source/ReplicationWindows/NullReplicationWindow.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Console/Console.h>
@@ -19,6 +21,8 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UnitTest/UnitTest.h>
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzNetworking/Serialization/StringifySerializer.h>
 #include <AzNetworking/UdpTransport/UdpPacketHeader.h>
 #include <AzTest/AzTest.h>
@@ -162,6 +166,98 @@ namespace Multiplayer
         domain->DebugDraw();
     }
 
+    TEST_F(MultiplayerNetworkEntityTests, TestSpatialEntityDomain)
+    {
+        ConstNetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
+        const HostId localhost = HostId("127.0.0.1", 6777, ProtocolType::Udp);
+        const AZ::Aabb domainAabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-10.0f), AZ::Vector3(10.0f));
+
+        m_networkEntityManager->Initialize(localhost, AZStd::make_unique<SpatialEntityDomain>(domainAabb));
+        EXPECT_TRUE(m_networkEntityManager->IsInitialized());
+        SpatialEntityDomain* domain = static_cast<SpatialEntityDomain*>(m_networkEntityManager->GetEntityDomain());
+        EXPECT_EQ(domain->GetAabb(), domainAabb);
+
+        // The domain is inclusive of its minimum and exclusive of its maximum, so neighbouring domains never share ownership
+        EXPECT_TRUE(domain->ContainsPosition(AZ::Vector3(-10.0f)));
+        EXPECT_FALSE(domain->ContainsPosition(AZ::Vector3(10.0f)));
+        EXPECT_FALSE(domain->ContainsPosition(AZ::Vector3(0.0f, 0.0f, 10.0f)));
+
+        m_root->m_entity->GetTransform()->SetWorldTranslation(AZ::Vector3::CreateZero());
+        EXPECT_TRUE(domain->IsInDomain(handle));
+
+        m_root->m_entity->GetTransform()->SetWorldTranslation(AZ::Vector3(20.0f, 0.0f, 0.0f));
+        EXPECT_FALSE(domain->IsInDomain(handle));
+
+        // Entities outside of the domain are left for the host whose domain contains them
+        domain->HandleLossOfAuthoritativeReplicator(handle);
+
+        // A spatial domain without a region owns nothing
+        domain->SetAabb(AZ::Aabb::CreateNull());
+        EXPECT_FALSE(domain->ContainsPosition(AZ::Vector3::CreateZero()));
+        domain->DebugDraw();
+    }
+
+    TEST_F(MultiplayerNetworkEntityTests, TestSpatialEntityDomainExit)
+    {
+        ConstNetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
+        const HostId localhost = HostId("127.0.0.1", 6777, ProtocolType::Udp);
+        const AZ::Aabb domainAabb = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-10.0f), AZ::Vector3(10.0f));
+
+        AZ::TimeMs elapsedTime = AZ::TimeMs{ 0 };
+        ON_CALL(*m_mockTime, GetElapsedTimeMs()).WillByDefault([&elapsedTime]() { return elapsedTime; });
+        auto advanceTime = [this, &elapsedTime](AZ::TimeMs deltaTime)
+        {
+            elapsedTime += deltaTime;
+            m_eventScheduler->OnTick(0.0f, AZ::ScriptTimePoint());
+        };
+
+        AZStd::vector<NetEntityId> exitedEntities;
+        EntityExitDomainEvent::Handler exitDomainHandler([&exitedEntities](const ConstNetworkEntityHandle& entityHandle)
+        {
+            exitedEntities.push_back(entityHandle.GetNetEntityId());
+        });
+        m_networkEntityManager->AddEntityExitDomainHandler(exitDomainHandler);
+
+        // Initializing the network entity manager schedules the periodic domain check
+        const AZ::TimeMs updateInterval = AZ::TimeMs{ 100 };
+        AZ::Interface<AZ::IConsole>::Get()->PerformCommand("sv_EntityDomainUpdateIntervalMs", { "100" });
+        m_root->m_entity->GetTransform()->SetWorldTranslation(AZ::Vector3::CreateZero());
+        m_networkEntityManager->Initialize(localhost, AZStd::make_unique<SpatialEntityDomain>(domainAabb));
+
+        // An entity inside the domain never exits
+        advanceTime(updateInterval);
+        EXPECT_TRUE(exitedEntities.empty());
+
+        // Crossing the boundary isn't noticed until the next domain check
+        m_root->m_entity->GetTransform()->SetWorldTranslation(AZ::Vector3(20.0f, 0.0f, 0.0f));
+        advanceTime(updateInterval / 2);
+        EXPECT_TRUE(exitedEntities.empty());
+        advanceTime(updateInterval / 2);
+        ASSERT_EQ(exitedEntities.size(), 1u);
+        EXPECT_EQ(exitedEntities[0], m_root->m_netId);
+
+        // The maximum face belongs to the neighbouring domain, so an entity resting on it has left this one
+        exitedEntities.clear();
+        m_root->m_entity->GetTransform()->SetWorldTranslation(AZ::Vector3(10.0f, 0.0f, 0.0f));
+        advanceTime(updateInterval);
+        EXPECT_EQ(exitedEntities.size(), 1u);
+
+        // Returning to the domain stops further exits
+        exitedEntities.clear();
+        m_root->m_entity->GetTransform()->SetWorldTranslation(AZ::Vector3(-10.0f, 0.0f, 0.0f));
+        advanceTime(updateInterval);
+        EXPECT_TRUE(exitedEntities.empty());
+
+        // Entities already marked for removal don't exit the domain
+        m_root->m_entity->GetTransform()->SetWorldTranslation(AZ::Vector3(20.0f, 0.0f, 0.0f));
+        m_networkEntityManager->MarkForRemoval(handle);
+        m_networkEntityManager->HandleEntitiesExitDomain(NetEntityIdSet{ m_root->m_netId });
+        EXPECT_TRUE(exitedEntities.empty());
+
+        // The elapsed time goes out of scope before the fixture tears down the event scheduler
+        ::testing::Mock::VerifyAndClear(m_mockTime.get());
+    }
+
     TEST_F(MultiplayerNetworkEntityTests, TestNetworkEntityTracker)
     {
         const NetworkEntityTracker* constNetEntityTracker = m_networkEntityManager->GetNetworkEntityTracker();
@@ -365,6 +461,72 @@ namespace Multiplayer
         EXPECT_TRUE(m_entityReplicationManager->HandleEntityUpdateMessage(m_mockConnection.get(), header, constMessage));
     }
 
+    TEST_F(MultiplayerNetworkEntityTests, TestNetworkEntityUpdateMessageSnapshot)
+    {
+        NetworkEntityUpdateMessage message(NetEntityRole::Client, m_root->m_netId, false, false);
+        EXPECT_FALSE(message.GetIsSnapshot());
+        const uint32_t updateSize = message.GetEstimatedSerializeSize();
+
+        message.SetSnapshotBaseline(AzNetworking::PacketId{ 42 });
+        EXPECT_TRUE(message.GetIsSnapshot());
+        EXPECT_EQ(message.GetEstimatedSerializeSize(), updateSize + sizeof(AzNetworking::PacketId));
+
+        AZStd::array<uint8_t, 1024> buffer;
+        AzNetworking::NetworkInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        EXPECT_TRUE(message.Serialize(inputSerializer));
+
+        NetworkEntityUpdateMessage received;
+        AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), inputSerializer.GetSize());
+        EXPECT_TRUE(received.Serialize(outputSerializer));
+        EXPECT_EQ(received, message);
+        EXPECT_TRUE(received.GetIsSnapshot());
+        EXPECT_EQ(received.GetSnapshotBaseline(), AzNetworking::PacketId{ 42 });
+        EXPECT_EQ(received.GetNetworkRole(), NetEntityRole::Client);
+    }
+
+    TEST_F(MultiplayerNetworkEntityTests, TestEntitySnapshotDelta)
+    {
+        AZStd::vector<uint8_t> baseline(600);
+        for (uint32_t i = 0; i < baseline.size(); ++i)
+        {
+            baseline[i] = static_cast<uint8_t>(i * 7 + 1);
+        }
+
+        // Change a couple of values and grow the snapshot past the end of the baseline
+        AZStd::vector<uint8_t> snapshot = baseline;
+        snapshot[10] ^= 0x5A;
+        snapshot[500] = 0;
+        snapshot.push_back(0);
+        snapshot.push_back(3);
+
+        AZStd::array<uint8_t, 1024> delta;
+        uint32_t deltaSize = 0;
+        EXPECT_TRUE(EncodeEntitySnapshotDelta(baseline.data(), static_cast<uint32_t>(baseline.size()),
+            snapshot.data(), static_cast<uint32_t>(snapshot.size()), delta.data(), static_cast<uint32_t>(delta.size()), deltaSize));
+        EXPECT_LT(deltaSize, 16u);
+
+        AZStd::vector<uint8_t> decoded(1024);
+        uint32_t decodedSize = 0;
+        EXPECT_TRUE(DecodeEntitySnapshotDelta(baseline.data(), static_cast<uint32_t>(baseline.size()),
+            delta.data(), deltaSize, decoded.data(), static_cast<uint32_t>(decoded.size()), decodedSize));
+        decoded.resize(decodedSize);
+        EXPECT_EQ(decoded, snapshot);
+
+        // Without a baseline the delta is the snapshot itself, and a shrinking snapshot must not read past its own end
+        snapshot.resize(100);
+        EXPECT_TRUE(EncodeEntitySnapshotDelta(nullptr, 0, snapshot.data(), static_cast<uint32_t>(snapshot.size()),
+            delta.data(), static_cast<uint32_t>(delta.size()), deltaSize));
+        decoded.resize(1024);
+        EXPECT_TRUE(DecodeEntitySnapshotDelta(nullptr, 0, delta.data(), deltaSize, decoded.data(), static_cast<uint32_t>(decoded.size()), decodedSize));
+        decoded.resize(decodedSize);
+        EXPECT_EQ(decoded, snapshot);
+
+        // Truncated or oversized deltas are rejected
+        EXPECT_FALSE(DecodeEntitySnapshotDelta(nullptr, 0, delta.data(), deltaSize - 1, decoded.data(), 1024, decodedSize));
+        EXPECT_FALSE(DecodeEntitySnapshotDelta(nullptr, 0, delta.data(), deltaSize, decoded.data(), 10, decodedSize));
+        EXPECT_FALSE(EncodeEntitySnapshotDelta(nullptr, 0, snapshot.data(), static_cast<uint32_t>(snapshot.size()), delta.data(), 10, deltaSize));
+    }
+
     TEST_F(MultiplayerNetworkEntityTests, EntityReplicatorNoDeleteSentIfCreateWasNotSent)
     {
         // Don't send an entity delete message if no create messages have been sent yet either.
@@ -503,6 +665,73 @@ namespace Multiplayer
         m_networkEntityManager->SetMigrateTimeoutTimeMs(AZ::TimeMs(0));
     }
 
+    TEST_F(MultiplayerNetworkEntityTests, TestNetworkRelevancyGrid)
+    {
+        ConstNetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
+        NetworkRelevancyGrid* relevancyGrid = m_networkEntityManager->GetNetworkRelevancyGrid();
+        ASSERT_NE(relevancyGrid, nullptr);
+        EXPECT_EQ(relevancyGrid->GetEntityCount(), 1);
+
+        NetworkRelevancyGrid::RelevantEntityList relevantEntities;
+        relevancyGrid->GatherRelevantEntities(AZ::Vector3::CreateZero(), 10.0f, relevantEntities);
+        ASSERT_EQ(relevantEntities.size(), 1);
+        EXPECT_EQ(relevantEntities[0].m_entityHandle, handle);
+
+        // Moving the entity must move it between grid cells
+        AZ::TransformBus::Event(m_root->m_entity->GetId(), &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3(1000.0f, 0.0f, 0.0f));
+        relevancyGrid->GatherRelevantEntities(AZ::Vector3::CreateZero(), 10.0f, relevantEntities);
+        EXPECT_TRUE(relevantEntities.empty());
+        relevancyGrid->GatherRelevantEntities(AZ::Vector3(995.0f, 0.0f, 0.0f), 10.0f, relevantEntities);
+        ASSERT_EQ(relevantEntities.size(), 1);
+        EXPECT_FLOAT_EQ(relevantEntities[0].m_distanceSquared, 25.0f);
+
+        // A relevancy distance override is used instead of the query radius
+        m_networkEntityManager->SetRelevancyDistance(handle, 2000.0f);
+        EXPECT_FLOAT_EQ(relevancyGrid->GetRelevancyDistance(handle.GetNetEntityId()), 2000.0f);
+        relevancyGrid->GatherRelevantEntities(AZ::Vector3::CreateZero(), 10.0f, relevantEntities);
+        EXPECT_EQ(relevantEntities.size(), 1);
+
+        m_networkEntityManager->SetRelevancyDistance(handle, 0.0f);
+        relevancyGrid->GatherRelevantEntities(AZ::Vector3::CreateZero(), 10.0f, relevantEntities);
+        EXPECT_TRUE(relevantEntities.empty());
+
+        relevancyGrid->RemoveEntity(handle.GetNetEntityId());
+        EXPECT_EQ(relevancyGrid->GetEntityCount(), 0);
+    }
+
+    TEST_F(MultiplayerNetworkEntityTests, TestNetworkRelevancyGridAddsEntityOnActivation)
+    {
+        NetworkRelevancyGrid* relevancyGrid = m_networkEntityManager->GetNetworkRelevancyGrid();
+        ASSERT_NE(relevancyGrid, nullptr);
+        const uint32_t entityCount = relevancyGrid->GetEntityCount();
+
+        // Networked entities register with the network entity manager before they're activated
+        AZStd::unique_ptr<EntityInfo> testEntity = AZStd::make_unique<EntityInfo>(7, "relevant", NetEntityId{ 7 }, EntityInfo::Role::None);
+        PopulateNetworkEntity(*testEntity);
+        SetupEntity(testEntity->m_entity, testEntity->m_netId, NetEntityRole::Authority);
+        EXPECT_EQ(relevancyGrid->GetEntityCount(), entityCount + 1);
+
+        // Entities aren't gathered until they're active, their transform isn't available before
+        const AZ::Vector3 queryPosition(500.0f, 0.0f, 0.0f);
+        NetworkRelevancyGrid::RelevantEntityList relevantEntities;
+        relevancyGrid->GatherRelevantEntities(queryPosition, 10.0f, relevantEntities);
+        EXPECT_TRUE(relevantEntities.empty());
+
+        testEntity->m_entity->Activate();
+        AZ::TransformBus::Event(testEntity->m_entity->GetId(), &AZ::TransformBus::Events::SetWorldTranslation, queryPosition);
+
+        ConstNetworkEntityHandle handle(testEntity->m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
+        relevancyGrid->GatherRelevantEntities(queryPosition, 10.0f, relevantEntities);
+        ASSERT_EQ(relevantEntities.size(), 1);
+        EXPECT_EQ(relevantEntities[0].m_entityHandle, handle);
+
+        // Deactivating the entity unregisters it, which removes it from the grid
+        StopAndDeactivateEntity(testEntity->m_entity);
+        EXPECT_EQ(relevancyGrid->GetEntityCount(), entityCount);
+        relevancyGrid->GatherRelevantEntities(queryPosition, 10.0f, relevantEntities);
+        EXPECT_TRUE(relevantEntities.empty());
+    }
+
     TEST_F(MultiplayerNetworkEntityTests, TestNetworkEntityManagerHandleExit)
     {
         ConstNetworkEntityHandle handle(m_root->m_entity.get(), m_networkEntityManager->GetNetworkEntityTracker());
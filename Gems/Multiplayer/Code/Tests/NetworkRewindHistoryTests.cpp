@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/NetworkTime/NetworkRewindHistory.h>
+#include <Source/NetworkTime/NetworkTime.h>
+#include <AzCore/Console/LoggerSystemComponent.h>
+#include <AzCore/Time/TimeSystem.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class NetworkRewindHistoryTests
+        : public LeakDetectionFixture
+    {
+    public:
+        static AZ::Transform CreateTranslation(float x)
+        {
+            return AZ::Transform::CreateTranslation(AZ::Vector3(x, 0.0f, 0.0f));
+        }
+
+        Multiplayer::NetworkTime m_networkTime;
+        AZ::LoggerSystemComponent m_loggerComponent;
+        AZ::TimeSystem m_timeSystem;
+    };
+
+    TEST_F(NetworkRewindHistoryTests, SlotAllocation)
+    {
+        Multiplayer::NetworkRewindHistory history;
+        AZStd::vector<Multiplayer::RewindSlot> slots;
+
+        // Allocate enough slots to force the rows to be re-laid out
+        for (uint32_t i = 0; i < 100; ++i)
+        {
+            slots.push_back(history.AddSlot(CreateTranslation(static_cast<float>(i))));
+        }
+        EXPECT_EQ(history.GetSlotCount(), 100);
+
+        for (uint32_t i = 0; i < 100; ++i)
+        {
+            EXPECT_EQ(history.GetTransform(slots[i], Multiplayer::HostFrameId(0)).GetTranslation().GetX(), static_cast<float>(i));
+        }
+
+        history.RemoveSlot(slots[10]);
+        EXPECT_EQ(history.GetSlotCount(), 99);
+
+        // Released slots are reused, and are initialized to the new transform
+        const Multiplayer::RewindSlot reusedSlot = history.AddSlot(CreateTranslation(1000.0f));
+        EXPECT_EQ(reusedSlot, slots[10]);
+        EXPECT_EQ(history.GetTransform(reusedSlot, Multiplayer::HostFrameId(0)).GetTranslation().GetX(), 1000.0f);
+        EXPECT_EQ(history.GetSlotCount(), 100);
+    }
+
+    TEST_F(NetworkRewindHistoryTests, BasicTests)
+    {
+        Multiplayer::NetworkRewindHistory history;
+        const Multiplayer::RewindSlot first = history.AddSlot(CreateTranslation(0.0f));
+        const Multiplayer::RewindSlot second = history.AddSlot(CreateTranslation(0.0f));
+
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            history.SetTransform(first, CreateTranslation(static_cast<float>(i)));
+            Multiplayer::GetNetworkTime()->IncrementHostFrameId();
+        }
+
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            EXPECT_EQ(history.GetTransform(first, Multiplayer::HostFrameId(i)).GetTranslation().GetX(), static_cast<float>(i));
+
+            // Slots that are never set keep their most recent transform
+            EXPECT_EQ(history.GetTransform(second, Multiplayer::HostFrameId(i)).GetTranslation().GetX(), 0.0f);
+        }
+
+        // Frames newer than the head return the most recent transform
+        EXPECT_EQ(history.GetTransform(first, Multiplayer::HostFrameId(100)).GetTranslation().GetX(), 15.0f);
+
+        // Sets older than the head are ignored
+        history.SetTransform(first, CreateTranslation(1000.0f), Multiplayer::HostFrameId(2));
+        EXPECT_EQ(history.GetTransform(first, Multiplayer::HostFrameId(2)).GetTranslation().GetX(), 2.0f);
+    }
+
+    TEST_F(NetworkRewindHistoryTests, OverflowTests)
+    {
+        Multiplayer::NetworkRewindHistory history;
+        const Multiplayer::RewindSlot slot = history.AddSlot(CreateTranslation(0.0f));
+
+        for (uint32_t i = 0; i < Multiplayer::RewindHistorySize * 2; ++i)
+        {
+            history.SetTransform(slot, CreateTranslation(static_cast<float>(i)), Multiplayer::HostFrameId(i));
+        }
+
+        // Frames older than the history return the oldest retained transform
+        const uint32_t oldestFrame = Multiplayer::RewindHistorySize;
+        EXPECT_EQ(history.GetTransform(slot, Multiplayer::HostFrameId(0)).GetTranslation().GetX(), static_cast<float>(oldestFrame));
+        EXPECT_EQ(history.GetTransform(slot, Multiplayer::HostFrameId(oldestFrame)).GetTranslation().GetX(), static_cast<float>(oldestFrame));
+
+        // Skipping more frames than the history holds carries the most recent transform across every row
+        const uint32_t skippedFrame = Multiplayer::RewindHistorySize * 4;
+        history.SetTransform(slot, CreateTranslation(-1.0f), Multiplayer::HostFrameId(skippedFrame));
+        EXPECT_EQ(history.GetTransform(slot, Multiplayer::HostFrameId(skippedFrame - 1)).GetTranslation().GetX(), static_cast<float>(Multiplayer::RewindHistorySize * 2 - 1));
+        EXPECT_EQ(history.GetTransform(slot, Multiplayer::HostFrameId(skippedFrame)).GetTranslation().GetX(), -1.0f);
+    }
+
+    TEST_F(NetworkRewindHistoryTests, RewoundTransformsTests)
+    {
+        Multiplayer::NetworkRewindHistory history;
+        AZStd::vector<Multiplayer::RewindSlot> slots;
+        slots.push_back(history.AddSlot(CreateTranslation(0.0f)));
+        slots.push_back(history.AddSlot(CreateTranslation(0.0f)));
+
+        for (uint32_t i = 0; i < 16; ++i)
+        {
+            history.SetTransform(slots[0], CreateTranslation(static_cast<float>(i)));
+            history.SetTransform(slots[1], CreateTranslation(static_cast<float>(i * 2)));
+            Multiplayer::GetNetworkTime()->IncrementHostFrameId();
+        }
+
+        AZStd::vector<AZ::Transform> transforms(slots.size());
+        {
+            Multiplayer::ScopedAlterTime time(Multiplayer::HostFrameId(4), AZ::Time::ZeroTimeMs, 1.f, AzNetworking::InvalidConnectionId);
+            history.GetRewoundTransforms(slots, AzNetworking::ConnectionId(0), transforms.data());
+            EXPECT_EQ(transforms[0].GetTranslation().GetX(), 4.0f);
+            EXPECT_EQ(transforms[1].GetTranslation().GetX(), 8.0f);
+        }
+
+        {
+            // A blend factor interpolates from the preceding frame
+            Multiplayer::ScopedAlterTime time(Multiplayer::HostFrameId(4), AZ::Time::ZeroTimeMs, 0.5f, AzNetworking::InvalidConnectionId);
+            history.GetRewoundTransforms(slots, AzNetworking::ConnectionId(0), transforms.data());
+            EXPECT_NEAR(transforms[0].GetTranslation().GetX(), 3.5f, 0.001f);
+            EXPECT_NEAR(transforms[1].GetTranslation().GetX(), 7.0f, 0.001f);
+        }
+
+        {
+            // Slots owned by the rewinding connection are not rewound
+            Multiplayer::ScopedAlterTime time(Multiplayer::HostFrameId(4), AZ::Time::ZeroTimeMs, 1.f, AzNetworking::ConnectionId(0));
+            history.GetRewoundTransforms(slots, AzNetworking::ConnectionId(0), transforms.data());
+            EXPECT_EQ(transforms[0].GetTranslation().GetX(), 15.0f);
+            EXPECT_EQ(transforms[1].GetTranslation().GetX(), 30.0f);
+        }
+    }
+}
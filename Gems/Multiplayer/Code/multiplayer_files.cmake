@@ -49,6 +49,7 @@ set(FILES
     Include/Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h
     Include/Multiplayer/NetworkInput/IMultiplayerComponentInput.h
     Include/Multiplayer/NetworkTime/INetworkTime.h
+    Include/Multiplayer/NetworkTime/NetworkRewindHistory.h
     Include/Multiplayer/NetworkTime/RewindableArray.h
     Include/Multiplayer/NetworkTime/RewindableArray.inl
     Include/Multiplayer/NetworkTime/RewindableFixedVector.h
@@ -73,6 +74,14 @@ set(FILES
     Source/EntityDomains/FullOwnershipEntityDomain.h
     Source/EntityDomains/NullEntityDomain.cpp
     Source/EntityDomains/NullEntityDomain.h
+    Source/EntityDomains/SpatialEntityDomain.cpp
+    Source/EntityDomains/SpatialEntityDomain.h
+    Source/MultiplayerPacketCapture.cpp
+    Source/MultiplayerPacketCapture.h
+    Source/MultiplayerPacketReplay.cpp
+    Source/MultiplayerPacketReplay.h
+    Source/MultiplayerReplicationCapture.cpp
+    Source/MultiplayerReplicationCapture.h
     Source/MultiplayerStatSystemComponent.cpp
     Source/MultiplayerStatSystemComponent.h
     Source/MultiplayerStats.cpp
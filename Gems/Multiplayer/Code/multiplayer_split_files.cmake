@@ -54,14 +54,19 @@ set(FILES
     Source/NetworkEntity/NetworkEntityAuthorityTracker.h
     Source/NetworkEntity/NetworkEntityManager.cpp
     Source/NetworkEntity/NetworkEntityManager.h
+    Source/NetworkEntity/NetworkRelevancyGrid.cpp
+    Source/NetworkEntity/NetworkRelevancyGrid.h
     Source/NetworkEntity/NetworkSpawnableLibrary.cpp
     Source/NetworkEntity/NetworkSpawnableLibrary.h
     Source/NetworkEntity/EntityReplication/EntityReplicationManager.cpp
     Source/NetworkEntity/EntityReplication/EntityReplicator.cpp
+    Source/NetworkEntity/EntityReplication/EntitySnapshotDelta.cpp
+    Source/NetworkEntity/EntityReplication/EntitySnapshotDelta.h
     Source/NetworkEntity/EntityReplication/PropertyPublisher.cpp
     Source/NetworkEntity/EntityReplication/PropertyPublisher.h
     Source/NetworkEntity/EntityReplication/PropertySubscriber.cpp
     Source/NetworkEntity/EntityReplication/PropertySubscriber.h
+    Source/NetworkTime/NetworkRewindHistory.cpp
     Source/NetworkTime/NetworkTime.cpp
     Source/NetworkTime/NetworkTime.h
     Source/ReplicationWindows/NullReplicationWindow.cpp
@@ -24,10 +24,12 @@ set(FILES
     Tests/MockInterfaces.h
     Tests/LocalPredictionPlayerInputTests.cpp
     Tests/MultiplayerComponentTests.cpp
+    Tests/MultiplayerPacketReplayTests.cpp
     Tests/MultiplayerSystemTests.cpp
     Tests/NetworkCharacterTests.cpp
     Tests/NetworkEntityTests.cpp
     Tests/NetworkInputTests.cpp
+    Tests/NetworkRewindHistoryTests.cpp
     Tests/NetworkRigidBodyTests.cpp
     Tests/NetworkTransformTests.cpp
     Tests/RewindableContainerTests.cpp
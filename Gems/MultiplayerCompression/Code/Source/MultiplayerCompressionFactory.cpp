@@ -8,11 +8,24 @@
 
 #include "MultiplayerCompressionFactory.h"
 #include "LZ4Compressor.h"
+#include "ZstdCompressor.h"
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Utils/Utils.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace MultiplayerCompression
 {
+    AZ_CVAR(AZ::CVarFixedString, net_ZstdDictionaryPath, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Path of the zstd dictionary that packets are compressed with, trained from captured packets with 'zstd --train'");
+    AZ_CVAR(AZ::CVarFixedString, net_ZstdPreviousDictionaryPath, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Path of a previous zstd dictionary version, used to decompress packets of remotes that haven't updated their dictionary yet");
+    AZ_CVAR(int32_t, net_ZstdCompressionLevel, ZstdCompressor::DefaultCompressionLevel, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The zstd compression level used by zstd compressors");
+
+    // Dictionaries are far smaller than this, anything larger is not a dictionary
+    static constexpr size_t MaxZstdDictionarySize = 1024 * 1024;
+
     AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerCompressionFactory::Create()
     {
         return AZStd::make_unique<LZ4Compressor>();
@@ -22,4 +35,46 @@ namespace MultiplayerCompression
     {
         return s_compressorName;
     }
+
+    AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerZstdCompressionFactory::Create()
+    {
+        AZStd::unique_ptr<ZstdCompressor> compressor = AZStd::make_unique<ZstdCompressor>();
+        const int32_t compressionLevel = net_ZstdCompressionLevel;
+        compressor->SetDictionary(nullptr, 0, compressionLevel);
+
+        const AZ::CVarFixedString dictionaryPath = net_ZstdDictionaryPath;
+        if (!dictionaryPath.empty())
+        {
+            auto dictionary = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(dictionaryPath, MaxZstdDictionarySize);
+            if (!dictionary.IsSuccess())
+            {
+                AZ_Error("Multiplayer Compressor", false, "Failed to read zstd dictionary %s: %s", dictionaryPath.c_str(), dictionary.GetError().c_str());
+            }
+            else if (compressor->SetDictionary(dictionary.GetValue().data(), dictionary.GetValue().size(), compressionLevel))
+            {
+                AZ_TracePrintf("Multiplayer Compressor", "Compressing with zstd dictionary %u from %s\n", compressor->GetDictionaryId(), dictionaryPath.c_str());
+            }
+        }
+
+        const AZ::CVarFixedString previousDictionaryPath = net_ZstdPreviousDictionaryPath;
+        if (!previousDictionaryPath.empty())
+        {
+            auto dictionary = AZ::Utils::ReadFile<AZStd::vector<uint8_t>>(previousDictionaryPath, MaxZstdDictionarySize);
+            if (!dictionary.IsSuccess())
+            {
+                AZ_Error("Multiplayer Compressor", false, "Failed to read zstd dictionary %s: %s", previousDictionaryPath.c_str(), dictionary.GetError().c_str());
+            }
+            else
+            {
+                compressor->AddDecompressionDictionary(dictionary.GetValue().data(), dictionary.GetValue().size());
+            }
+        }
+
+        return compressor;
+    }
+
+    const AZStd::string_view MultiplayerZstdCompressionFactory::GetFactoryName() const
+    {
+        return s_compressorName;
+    }
 }
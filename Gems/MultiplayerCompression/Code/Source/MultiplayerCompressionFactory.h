@@ -29,4 +29,22 @@ namespace MultiplayerCompression
     private:
         static constexpr AZStd::string_view s_compressorName = "MultiplayerCompressor";
     };
+
+    //! Creates zstd compressors that use the dictionaries set by the net_ZstdDictionaryPath and
+    //! net_ZstdPreviousDictionaryPath cvars. Selected by setting net_UdpCompressor to "MultiplayerZstdCompressor".
+    class MultiplayerZstdCompressionFactory
+        : public AzNetworking::ICompressorFactory
+    {
+    public:
+        //! Instantiate a new compressor
+        //! @return A unique_ptr to a new Compressor
+        AZStd::unique_ptr<AzNetworking::ICompressor> Create() override;
+
+        //! Gets the string name of this compressor factory
+        //! @return the string name of this compressor factory
+        const AZStd::string_view GetFactoryName() const override;
+
+    private:
+        static constexpr AZStd::string_view s_compressorName = "MultiplayerZstdCompressor";
+    };
 }
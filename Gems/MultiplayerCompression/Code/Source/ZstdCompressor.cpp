@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZstdCompressor.h"
+
+#include <AzCore/std/parallel/scoped_lock.h>
+
+#include <zstd.h>
+#include <zstd_errors.h>
+
+namespace MultiplayerCompression
+{
+    ZstdCompressor::ZstdCompressor()
+    {
+        // Contexts for the first caller, more are created when calls run on several threads at once
+        ReleaseCompressionContext(ZSTD_createCCtx());
+        ReleaseDecompressionContext(ZSTD_createDCtx());
+    }
+
+    ZstdCompressor::~ZstdCompressor()
+    {
+        for (DecompressionDictionary& dictionary : m_decompressionDictionaries)
+        {
+            ZSTD_freeDDict(dictionary.m_dictionary);
+        }
+        ZSTD_freeCDict(m_compressionDictionary);
+        for (ZSTD_DCtx_s* context : m_decompressionContexts)
+        {
+            ZSTD_freeDCtx(context);
+        }
+        for (ZSTD_CCtx_s* context : m_compressionContexts)
+        {
+            ZSTD_freeCCtx(context);
+        }
+    }
+
+    bool ZstdCompressor::SetDictionary(const void* dictionary, size_t size, int compressionLevel)
+    {
+        ZSTD_freeCDict(m_compressionDictionary);
+        m_compressionDictionary = nullptr;
+        m_compressionDictionaryId = 0;
+        m_compressionLevel = compressionLevel;
+
+        if (dictionary == nullptr || size == 0)
+        {
+            return true;
+        }
+
+        if (!AddDecompressionDictionary(dictionary, size))
+        {
+            return false;
+        }
+
+        m_compressionDictionary = ZSTD_createCDict(dictionary, size, compressionLevel);
+        if (m_compressionDictionary == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to create a compression dictionary from %zu bytes", size);
+            return false;
+        }
+        m_compressionDictionaryId = ZSTD_getDictID_fromDict(dictionary, size);
+        return true;
+    }
+
+    bool ZstdCompressor::AddDecompressionDictionary(const void* dictionary, size_t size)
+    {
+        const AZ::u32 dictionaryId = ZSTD_getDictID_fromDict(dictionary, size);
+        if (dictionaryId == 0)
+        {
+            // Raw content dictionaries don't have an id, so packets compressed with them can't be matched to their dictionary
+            AZ_Warning("Multiplayer Compressor", false, "Dictionary of %zu bytes has no id, use a dictionary trained by zstd", size);
+            return false;
+        }
+
+        if (FindDecompressionDictionary(dictionaryId) != nullptr)
+        {
+            return true;
+        }
+
+        ZSTD_DDict_s* decompressionDictionary = ZSTD_createDDict(dictionary, size);
+        if (decompressionDictionary == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to create a decompression dictionary from %zu bytes", size);
+            return false;
+        }
+        m_decompressionDictionaries.push_back(DecompressionDictionary{ dictionaryId, decompressionDictionary });
+        return true;
+    }
+
+    AZ::u32 ZstdCompressor::GetDictionaryId() const
+    {
+        return m_compressionDictionaryId;
+    }
+
+    bool ZstdCompressor::Init()
+    {
+        AZStd::scoped_lock lock(m_contextMutex);
+        return !m_compressionContexts.empty() && !m_decompressionContexts.empty();
+    }
+
+    size_t ZstdCompressor::GetMaxChunkSize(size_t maxCompSize) const
+    {
+        return maxCompSize;
+    }
+
+    size_t ZstdCompressor::GetMaxCompressedBufferSize(size_t uncompSize) const
+    {
+        return ZSTD_compressBound(uncompSize);
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::Compress
+    (
+        const void* uncompData,
+        size_t uncompSize,
+        void* compData,
+        size_t compDataSize,
+        size_t& compSize
+    )
+    {
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        ZSTD_CCtx_s* context = AcquireCompressionContext();
+        if (context == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to create a compression context");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        const size_t result = (m_compressionDictionary != nullptr)
+            ? ZSTD_compress_usingCDict(context, compData, compDataSize, uncompData, uncompSize, m_compressionDictionary)
+            : ZSTD_compressCCtx(context, compData, compDataSize, uncompData, uncompSize, m_compressionLevel);
+        ReleaseCompressionContext(context);
+
+        if (ZSTD_isError(result))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compression failed for uncompSize:(%zu B) compDataSize:(%zu B): %s", uncompSize, compDataSize, ZSTD_getErrorName(result));
+            return (ZSTD_getErrorCode(result) == ZSTD_error_dstSize_tooSmall)
+                ? AzNetworking::CompressorError::InsufficientBuffer
+                : AzNetworking::CompressorError::CorruptData;
+        }
+        compSize = result;
+
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSizeOut, size_t& uncompSizeOut)
+    {
+        if (compData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Input buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (uncompData == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Output buffer is uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        // The frame names the dictionary it was compressed with, so remotes on an older dictionary version can still be read
+        const AZ::u32 dictionaryId = ZSTD_getDictID_fromFrame(compData, compDataSize);
+        ZSTD_DDict_s* decompressionDictionary = FindDecompressionDictionary(dictionaryId);
+        if (dictionaryId != 0 && decompressionDictionary == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Packet was compressed with dictionary %u, which isn't loaded (compressing with dictionary %u). "
+                "Both endpoints need to share a dictionary version", dictionaryId, m_compressionDictionaryId);
+            return AzNetworking::CompressorError::CorruptData;
+        }
+
+        ZSTD_DCtx_s* context = AcquireDecompressionContext();
+        if (context == nullptr)
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to create a decompression context");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        const size_t result = (decompressionDictionary != nullptr)
+            ? ZSTD_decompress_usingDDict(context, uncompData, uncompDataSize, compData, compDataSize, decompressionDictionary)
+            : ZSTD_decompressDCtx(context, uncompData, uncompDataSize, compData, compDataSize);
+        ReleaseDecompressionContext(context);
+        consumedSizeOut = compDataSize;
+
+        if (ZSTD_isError(result))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Decompression failed for compDataSize:(%zu B) uncompDataSize:(%zu B): %s", compDataSize, uncompDataSize, ZSTD_getErrorName(result));
+            return (ZSTD_getErrorCode(result) == ZSTD_error_dstSize_tooSmall)
+                ? AzNetworking::CompressorError::InsufficientBuffer
+                : AzNetworking::CompressorError::CorruptData;
+        }
+        uncompSizeOut = result;
+
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    ZSTD_DDict_s* ZstdCompressor::FindDecompressionDictionary(AZ::u32 dictionaryId) const
+    {
+        for (const DecompressionDictionary& dictionary : m_decompressionDictionaries)
+        {
+            if (dictionary.m_id == dictionaryId)
+            {
+                return dictionary.m_dictionary;
+            }
+        }
+        return nullptr;
+    }
+
+    ZSTD_CCtx_s* ZstdCompressor::AcquireCompressionContext()
+    {
+        {
+            AZStd::scoped_lock lock(m_contextMutex);
+            if (!m_compressionContexts.empty())
+            {
+                ZSTD_CCtx_s* context = m_compressionContexts.back();
+                m_compressionContexts.pop_back();
+                return context;
+            }
+        }
+        return ZSTD_createCCtx();
+    }
+
+    void ZstdCompressor::ReleaseCompressionContext(ZSTD_CCtx_s* context)
+    {
+        if (context != nullptr)
+        {
+            AZStd::scoped_lock lock(m_contextMutex);
+            m_compressionContexts.push_back(context);
+        }
+    }
+
+    ZSTD_DCtx_s* ZstdCompressor::AcquireDecompressionContext()
+    {
+        {
+            AZStd::scoped_lock lock(m_contextMutex);
+            if (!m_decompressionContexts.empty())
+            {
+                ZSTD_DCtx_s* context = m_decompressionContexts.back();
+                m_decompressionContexts.pop_back();
+                return context;
+            }
+        }
+        return ZSTD_createDCtx();
+    }
+
+    void ZstdCompressor::ReleaseDecompressionContext(ZSTD_DCtx_s* context)
+    {
+        if (context != nullptr)
+        {
+            AZStd::scoped_lock lock(m_contextMutex);
+            m_decompressionContexts.push_back(context);
+        }
+    }
+}
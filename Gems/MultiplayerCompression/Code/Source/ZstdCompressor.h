@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzNetworking/Framework/ICompressor.h>
+#include <AzCore/Casting/numeric_cast.h>
+
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace MultiplayerCompression
+{
+    static const char* ZstdCompressorName = "Zstd";
+    static const AzNetworking::CompressorType ZstdCompressorType = aznumeric_cast<AzNetworking::CompressorType>(static_cast<AZ::u32>(AZ::Crc32(ZstdCompressorName)));
+
+    /**
+    * Implements a zstd Compressor against Multiplayer's Compressor interface for use with AzNetworking.
+    * Packets are usually too small for a compressor to find much redundancy within a single packet, so the compressor can be
+    * given a dictionary trained offline on captured packets (for example with `zstd --train`), which both endpoints need to share.
+    * Every compressed packet carries the id of the dictionary it was compressed with, which lets the receiver decompress packets
+    * from remotes that still use an older dictionary version and report remotes using an unknown dictionary.
+    * Compress and Decompress can be called from several threads at once, such as the threads of multithreaded connection updates.
+    * Each call takes a zstd context from a pool, since zstd contexts can only be used by one thread at a time.
+    * The dictionaries are shared, so they need to be set before the compressor is used.
+    */
+    class ZstdCompressor
+        : public AzNetworking::ICompressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdCompressor, AZ::SystemAllocator);
+
+        //! The compression level used when no other level is provided.
+        static constexpr int DefaultCompressionLevel = 3;
+
+        ZstdCompressor();
+        ~ZstdCompressor() override;
+
+        //! Sets the dictionary packets are compressed with, replacing the previous one. The dictionary can also be used for
+        //! decompression. Passing no data makes the compressor compress without a dictionary.
+        //! @param dictionary       the contents of a zstd dictionary
+        //! @param size             the size of the dictionary in bytes
+        //! @param compressionLevel the zstd compression level to compress with
+        //! @return boolean true on success, false if the dictionary couldn't be loaded
+        bool SetDictionary(const void* dictionary, size_t size, int compressionLevel = DefaultCompressionLevel);
+
+        //! Adds a dictionary that's only used to decompress packets, such as the dictionary of a previous version of the traffic.
+        //! @param dictionary the contents of a zstd dictionary
+        //! @param size       the size of the dictionary in bytes
+        //! @return boolean true on success, false if the dictionary couldn't be loaded
+        bool AddDecompressionDictionary(const void* dictionary, size_t size);
+
+        //! Returns the id of the dictionary packets are compressed with, 0 if packets are compressed without a dictionary.
+        AZ::u32 GetDictionaryId() const;
+
+        const char* GetName() const { return ZstdCompressorName; }
+        AzNetworking::CompressorType GetType() const override { return ZstdCompressorType; };
+
+        bool Init() override;
+        size_t GetMaxChunkSize(size_t maxCompSize) const override;
+        size_t GetMaxCompressedBufferSize(size_t uncompSize) const override;
+
+        AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize) override;
+        AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize) override;
+
+    private:
+        struct DecompressionDictionary
+        {
+            AZ::u32 m_id = 0;
+            ZSTD_DDict_s* m_dictionary = nullptr;
+        };
+
+        //! Returns the decompression dictionary with the provided id, nullptr if it isn't loaded.
+        ZSTD_DDict_s* FindDecompressionDictionary(AZ::u32 dictionaryId) const;
+
+        //! Takes an idle context from the pool, creating a new one if all are in use. Returns nullptr if zstd fails to create it.
+        ZSTD_CCtx_s* AcquireCompressionContext();
+        void ReleaseCompressionContext(ZSTD_CCtx_s* context);
+        ZSTD_DCtx_s* AcquireDecompressionContext();
+        void ReleaseDecompressionContext(ZSTD_DCtx_s* context);
+
+        //! Contexts that no thread is using, there are as many as the most calls that ran at once.
+        AZStd::mutex m_contextMutex;
+        AZStd::vector<ZSTD_CCtx_s*> m_compressionContexts;
+        AZStd::vector<ZSTD_DCtx_s*> m_decompressionContexts;
+
+        ZSTD_CDict_s* m_compressionDictionary = nullptr;
+        AZ::u32 m_compressionDictionaryId = 0;
+        int m_compressionLevel = DefaultCompressionLevel;
+        AZStd::vector<DecompressionDictionary> m_decompressionDictionaries;
+    };
+}
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <zdict.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <ZstdCompressor.h>
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzTest/AzTest.h>
+
+class ZstdCompressorTest
+    : public UnitTest::LeakDetectionFixture
+{
+protected:
+    static constexpr size_t MaxPacketSize = 256;
+
+    //! Writes a packet that resembles an entity update, a fixed layout with a few fields that change between packets.
+    static size_t WritePacket(uint32_t seed, uint8_t* outPacket)
+    {
+        static constexpr const char ComponentName[] = "NetworkTransformComponent";
+        size_t size = 0;
+        for (uint32_t entity = 0; entity < 4; ++entity)
+        {
+            const uint32_t entityId = 1000 + (seed * 7 + entity) % 64;
+            memcpy(outPacket + size, &entityId, sizeof(entityId));
+            size += sizeof(entityId);
+            memcpy(outPacket + size, ComponentName, sizeof(ComponentName));
+            size += sizeof(ComponentName);
+            const float position[3] = { static_cast<float>(seed % 100), 1.5f, static_cast<float>(entity) };
+            memcpy(outPacket + size, position, sizeof(position));
+            size += sizeof(position);
+        }
+        return size;
+    }
+
+    //! Trains a dictionary from generated packets, different first seeds give dictionaries with different ids.
+    static AZStd::vector<uint8_t> TrainDictionary(uint32_t firstSeed)
+    {
+        constexpr uint32_t SampleCount = 1000;
+        AZStd::vector<uint8_t> samples(SampleCount * MaxPacketSize);
+        AZStd::vector<size_t> sampleSizes(SampleCount);
+        size_t offset = 0;
+        for (uint32_t i = 0; i < SampleCount; ++i)
+        {
+            sampleSizes[i] = WritePacket(firstSeed + i, samples.data() + offset);
+            offset += sampleSizes[i];
+        }
+
+        AZStd::vector<uint8_t> dictionary(4096);
+        const size_t dictionarySize = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(), samples.data(), sampleSizes.data(), SampleCount);
+        EXPECT_FALSE(ZDICT_isError(dictionarySize));
+        dictionary.resize(ZDICT_isError(dictionarySize) ? 0 : dictionarySize);
+        return dictionary;
+    }
+};
+
+TEST_F(ZstdCompressorTest, ZstdCompressor_CompressWithoutDictionary_RoundTrips)
+{
+    uint8_t packet[MaxPacketSize];
+    const size_t packetSize = WritePacket(5000, packet);
+
+    MultiplayerCompression::ZstdCompressor compressor;
+    ASSERT_TRUE(compressor.Init());
+    EXPECT_EQ(compressor.GetDictionaryId(), 0);
+
+    AZStd::vector<uint8_t> compressed(compressor.GetMaxCompressedBufferSize(packetSize));
+    size_t compressedSize = 0;
+    ASSERT_EQ(compressor.Compress(packet, packetSize, compressed.data(), compressed.size(), compressedSize), AzNetworking::CompressorError::Ok);
+
+    uint8_t decompressed[MaxPacketSize];
+    size_t consumedSize = 0;
+    size_t decompressedSize = 0;
+    ASSERT_EQ(compressor.Decompress(compressed.data(), compressedSize, decompressed, sizeof(decompressed), consumedSize, decompressedSize), AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(consumedSize, compressedSize);
+    ASSERT_EQ(decompressedSize, packetSize);
+    EXPECT_EQ(memcmp(decompressed, packet, packetSize), 0);
+}
+
+TEST_F(ZstdCompressorTest, ZstdCompressor_CompressWithDictionary_IsSmallerAndRoundTrips)
+{
+    const AZStd::vector<uint8_t> dictionary = TrainDictionary(0);
+    ASSERT_FALSE(dictionary.empty());
+
+    uint8_t packet[MaxPacketSize];
+    const size_t packetSize = WritePacket(5000, packet);
+
+    MultiplayerCompression::ZstdCompressor plainCompressor;
+    MultiplayerCompression::ZstdCompressor dictionaryCompressor;
+    ASSERT_TRUE(dictionaryCompressor.SetDictionary(dictionary.data(), dictionary.size()));
+    EXPECT_NE(dictionaryCompressor.GetDictionaryId(), 0);
+
+    AZStd::vector<uint8_t> compressed(plainCompressor.GetMaxCompressedBufferSize(packetSize));
+    size_t plainSize = 0;
+    size_t dictionarySize = 0;
+    ASSERT_EQ(plainCompressor.Compress(packet, packetSize, compressed.data(), compressed.size(), plainSize), AzNetworking::CompressorError::Ok);
+    ASSERT_EQ(dictionaryCompressor.Compress(packet, packetSize, compressed.data(), compressed.size(), dictionarySize), AzNetworking::CompressorError::Ok);
+    EXPECT_LT(dictionarySize, plainSize);
+
+    // A separate compressor with the same dictionary stands in for the remote endpoint
+    MultiplayerCompression::ZstdCompressor remoteCompressor;
+    ASSERT_TRUE(remoteCompressor.SetDictionary(dictionary.data(), dictionary.size()));
+
+    uint8_t decompressed[MaxPacketSize];
+    size_t consumedSize = 0;
+    size_t decompressedSize = 0;
+    ASSERT_EQ(remoteCompressor.Decompress(compressed.data(), dictionarySize, decompressed, sizeof(decompressed), consumedSize, decompressedSize), AzNetworking::CompressorError::Ok);
+    ASSERT_EQ(decompressedSize, packetSize);
+    EXPECT_EQ(memcmp(decompressed, packet, packetSize), 0);
+}
+
+TEST_F(ZstdCompressorTest, ZstdCompressor_DecompressWithOtherDictionary_FailsUnlessPreviousDictionaryIsLoaded)
+{
+    const AZStd::vector<uint8_t> previousDictionary = TrainDictionary(0);
+    const AZStd::vector<uint8_t> currentDictionary = TrainDictionary(100000);
+    ASSERT_FALSE(previousDictionary.empty());
+    ASSERT_FALSE(currentDictionary.empty());
+
+    uint8_t packet[MaxPacketSize];
+    const size_t packetSize = WritePacket(5000, packet);
+
+    MultiplayerCompression::ZstdCompressor outdatedCompressor;
+    ASSERT_TRUE(outdatedCompressor.SetDictionary(previousDictionary.data(), previousDictionary.size()));
+    MultiplayerCompression::ZstdCompressor currentCompressor;
+    ASSERT_TRUE(currentCompressor.SetDictionary(currentDictionary.data(), currentDictionary.size()));
+    ASSERT_NE(outdatedCompressor.GetDictionaryId(), currentCompressor.GetDictionaryId());
+
+    AZStd::vector<uint8_t> compressed(outdatedCompressor.GetMaxCompressedBufferSize(packetSize));
+    size_t compressedSize = 0;
+    ASSERT_EQ(outdatedCompressor.Compress(packet, packetSize, compressed.data(), compressed.size(), compressedSize), AzNetworking::CompressorError::Ok);
+
+    uint8_t decompressed[MaxPacketSize];
+    size_t consumedSize = 0;
+    size_t decompressedSize = 0;
+    EXPECT_EQ(currentCompressor.Decompress(compressed.data(), compressedSize, decompressed, sizeof(decompressed), consumedSize, decompressedSize), AzNetworking::CompressorError::CorruptData);
+
+    ASSERT_TRUE(currentCompressor.AddDecompressionDictionary(previousDictionary.data(), previousDictionary.size()));
+    ASSERT_EQ(currentCompressor.Decompress(compressed.data(), compressedSize, decompressed, sizeof(decompressed), consumedSize, decompressedSize), AzNetworking::CompressorError::Ok);
+    ASSERT_EQ(decompressedSize, packetSize);
+    EXPECT_EQ(memcmp(decompressed, packet, packetSize), 0);
+
+    // The current dictionary is still the one packets are compressed with
+    EXPECT_NE(currentCompressor.GetDictionaryId(), outdatedCompressor.GetDictionaryId());
+}
+
+TEST_F(ZstdCompressorTest, ZstdCompressor_CompressOnSeveralThreads_RoundTrips)
+{
+    const AZStd::vector<uint8_t> dictionary = TrainDictionary(0);
+    ASSERT_FALSE(dictionary.empty());
+
+    // One compressor is shared by all threads, the same way connections updated on several threads share the network interface's compressor
+    MultiplayerCompression::ZstdCompressor compressor;
+    ASSERT_TRUE(compressor.SetDictionary(dictionary.data(), dictionary.size()));
+
+    constexpr uint32_t ThreadCount = 8;
+    constexpr uint32_t PacketsPerThread = 500;
+    AZStd::atomic<uint32_t> failureCount{ 0 };
+    AZStd::vector<AZStd::thread> threads;
+    for (uint32_t threadIndex = 0; threadIndex < ThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([&compressor, &failureCount, threadIndex]()
+        {
+            uint8_t packet[MaxPacketSize];
+            uint8_t compressed[MaxPacketSize * 2];
+            uint8_t decompressed[MaxPacketSize];
+            for (uint32_t i = 0; i < PacketsPerThread; ++i)
+            {
+                const size_t packetSize = WritePacket(threadIndex * PacketsPerThread + i, packet);
+                size_t compressedSize = 0;
+                size_t consumedSize = 0;
+                size_t decompressedSize = 0;
+                if (compressor.Compress(packet, packetSize, compressed, sizeof(compressed), compressedSize) != AzNetworking::CompressorError::Ok
+                    || compressor.Decompress(compressed, compressedSize, decompressed, sizeof(decompressed), consumedSize, decompressedSize) != AzNetworking::CompressorError::Ok
+                    || decompressedSize != packetSize
+                    || memcmp(decompressed, packet, packetSize) != 0)
+                {
+                    ++failureCount;
+                }
+            }
+        });
+    }
+    for (AZStd::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(failureCount, 0);
+}
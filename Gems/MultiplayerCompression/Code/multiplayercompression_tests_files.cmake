@@ -8,4 +8,5 @@
 
 set(FILES
     Tests/MultiplayerCompressionTest.cpp
+    Tests/ZstdCompressorTest.cpp
 )
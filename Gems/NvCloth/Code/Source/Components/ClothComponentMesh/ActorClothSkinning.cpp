@@ -535,6 +535,7 @@ namespace NvCloth
     void ActorClothSkinning::UpdateActorVisibility()
     {
         bool isVisible = true;
+        size_t lodLevel = 0;
 
         EMotionFX::ActorInstance* actorInstance = nullptr;
         EMotionFX::Integration::ActorComponentRequestBus::EventResult(actorInstance, m_entityId,
@@ -542,8 +543,11 @@ namespace NvCloth
         if (actorInstance)
         {
             isVisible = actorInstance->GetIsVisible();
+            lodLevel = actorInstance->GetLODLevel();
         }
 
+        m_actorLodLevel = lodLevel;
+
         m_wasActorVisible = m_isActorVisible;
         m_isActorVisible = isVisible;
     }
@@ -557,5 +561,10 @@ namespace NvCloth
     {
         return m_wasActorVisible;
     }
+
+    size_t ActorClothSkinning::GetActorLodLevel() const
+    {
+        return m_actorLodLevel;
+    }
 } // namespace NvCloth
 
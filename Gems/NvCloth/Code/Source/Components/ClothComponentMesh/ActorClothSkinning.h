@@ -69,6 +69,9 @@ namespace NvCloth
         //! Returns true if actor was visible on screen in previous update.
         bool WasActorVisible() const;
 
+        //! Returns the LOD level of the actor at the last visibility update.
+        size_t GetActorLodLevel() const;
+
     protected:
         AZ::EntityId m_entityId;
 
@@ -107,5 +110,6 @@ namespace NvCloth
         // Visibility variables
         bool m_wasActorVisible = false;
         bool m_isActorVisible = false;
+        size_t m_actorLodLevel = 0;
     };
 }// namespace NvCloth
@@ -9,6 +9,7 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/PackedVector3.h>
+#include <AzCore/std/math.h>
 
 #include <AtomLyIntegration/CommonFeatures/Mesh/MeshComponentBus.h>
 #include <AtomLyIntegration/CommonFeatures/SkinnedMesh/SkinnedMeshOverrideBus.h>
@@ -40,6 +41,15 @@ namespace NvCloth
     AZ_CVAR(float, cloth_SecondsToDelaySimulationOnActorSpawned, 0.25f, nullptr, AZ::ConsoleFunctorFlags::Null,
         "The amount of time in seconds the cloth simulation will be delayed to avoid sudden impulses when actors are spawned.");
 
+    AZ_CVAR(bool, cloth_FreezeWhenNotVisible, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When enabled, the cloth of an actor is not simulated while the actor is not visible.");
+
+    AZ_CVAR(float, cloth_LodSolverFrequencyScale, 0.5f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Scale applied to the cloth solver frequency for each LOD level of the actor. For example, at LOD level 2 the frequency is scaled by this value squared.");
+
+    AZ_CVAR(float, cloth_LodMinSolverFrequency, 60.0f, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The solver frequency that cloth LOD will not scale below. Cloths configured with a lower frequency keep their frequency.");
+
     // Helper class to map an RPI buffer from a buffer asset view.
     template<typename T>
     class MappedBuffer
@@ -250,6 +260,8 @@ namespace NvCloth
         m_meshClothInfo = {};
         m_actorClothColliders.reset();
         m_actorClothSkinning.reset();
+        m_isSimulationFrozen = false;
+        m_simulationLodLevel = 0;
         m_clothConstraints.reset();
         m_motionConstraints.clear();
         m_separationConstraints.clear();
@@ -303,7 +315,13 @@ namespace NvCloth
 
     void ClothComponentMesh::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
-        CopyRenderDataToModel();
+        UpdateSimulationLod();
+
+        // There are no new simulation results while the cloth is frozen.
+        if (!m_isSimulationFrozen)
+        {
+            CopyRenderDataToModel();
+        }
     }
 
     int ClothComponentMesh::GetTickOrder()
@@ -404,6 +422,60 @@ namespace NvCloth
         }
     }
 
+    void ClothComponentMesh::UpdateSimulationLod()
+    {
+        if (!m_actorClothSkinning)
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(Cloth);
+
+        if (m_isSimulationFrozen)
+        {
+            // The actor visibility is updated before each simulation, which doesn't happen while frozen.
+            m_actorClothSkinning->UpdateActorVisibility();
+        }
+
+        const bool freezeSimulation = cloth_FreezeWhenNotVisible && !m_actorClothSkinning->IsActorVisible();
+        if (freezeSimulation && !m_isSimulationFrozen)
+        {
+            AZ::Interface<IClothSystem>::Get()->RemoveCloth(m_cloth);
+            m_isSimulationFrozen = true;
+        }
+        else if (!freezeSimulation && m_isSimulationFrozen)
+        {
+            // The actor might have moved and animated while frozen, teleport the cloth and
+            // override the simulation with the skinned positions for a short time to avoid sudden impulses.
+            AZ::Transform transform = AZ::Transform::CreateIdentity();
+            AZ::TransformBus::EventResult(transform, m_entityId, &AZ::TransformInterface::GetWorldTM);
+            TeleportCloth(transform);
+            m_timeClothSkinningUpdates = 0.0f;
+
+            AZ::Interface<IClothSystem>::Get()->AddCloth(m_cloth);
+            m_isSimulationFrozen = false;
+        }
+
+        const size_t lodLevel = m_actorClothSkinning->GetActorLodLevel();
+        if (lodLevel != m_simulationLodLevel)
+        {
+            m_simulationLodLevel = lodLevel;
+            m_cloth->GetClothConfigurator()->SetSolverFrequency(CalculateSolverFrequency());
+        }
+    }
+
+    float ClothComponentMesh::CalculateSolverFrequency() const
+    {
+        if (m_simulationLodLevel == 0)
+        {
+            return m_config.m_solverFrequency;
+        }
+
+        const float lodFrequency = m_config.m_solverFrequency *
+            AZStd::pow(static_cast<float>(cloth_LodSolverFrequencyScale), static_cast<float>(m_simulationLodLevel));
+        return AZ::GetMax(lodFrequency, AZ::GetMin(static_cast<float>(cloth_LodMinSolverFrequency), m_config.m_solverFrequency));
+    }
+
     void ClothComponentMesh::UpdateRenderData(const AZStd::vector<SimParticleFormat>& particles)
     {
         AZ_PROFILE_FUNCTION(Cloth);
@@ -736,7 +808,7 @@ namespace NvCloth
         clothConfig->SetTetherConstraintScale(m_config.m_tetherConstraintScale);
 
         // Quality parameters
-        clothConfig->SetSolverFrequency(m_config.m_solverFrequency);
+        clothConfig->SetSolverFrequency(CalculateSolverFrequency());
         clothConfig->SetAcceleationFilterWidth(m_config.m_accelerationFilterIterations);
 
         // Fabric Phases
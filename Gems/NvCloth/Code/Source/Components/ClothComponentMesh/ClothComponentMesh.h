@@ -84,6 +84,8 @@ namespace NvCloth
         void UpdateSimulationSkinning(float deltaTime);
         void UpdateSimulationConstraints();
         void UpdateRenderData(const AZStd::vector<SimParticleFormat>& particles);
+        void UpdateSimulationLod();
+        float CalculateSolverFrequency() const;
 
         bool CreateCloth();
         void ApplyConfigurationToCloth();
@@ -134,6 +136,10 @@ namespace NvCloth
         AZStd::unique_ptr<ActorClothSkinning> m_actorClothSkinning;
         float m_timeClothSkinningUpdates = 0.0f;
 
+        // Cloth simulation level of detail, driven by the visibility and LOD level of the character
+        bool m_isSimulationFrozen = false;
+        size_t m_simulationLodLevel = 0;
+
         // Cloth Constraints
         AZStd::unique_ptr<ClothConstraints> m_clothConstraints;
         AZStd::vector<AZ::Vector4> m_motionConstraints;
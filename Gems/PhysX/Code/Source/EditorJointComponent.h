@@ -54,6 +54,7 @@ namespace PhysX
             const AzFramework::ViewportInfo& viewportInfo,
             const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) override;
         bool SupportsEditorRayIntersect() override { return true; };
+        bool EditorSelectionBoundsDependOnCamera() override { return true; }
 
         // EditorJointRequestBus overrides ...
         bool GetBoolValue(const AZStd::string& parameterName) override;
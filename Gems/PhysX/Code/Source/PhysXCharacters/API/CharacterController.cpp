@@ -632,32 +632,41 @@ namespace PhysX
     }
 
     void CharacterController::Move(const AZ::Vector3& requestedMovement, float deltaTime)
+    {
+        if (m_pxController)
+        {
+            PHYSX_SCENE_WRITE_LOCK(m_pxController->getScene());
+            MoveUnlocked(requestedMovement, deltaTime);
+        }
+    }
+
+    void CharacterController::MoveUnlocked(const AZ::Vector3& requestedMovement, float deltaTime)
     {
         if (m_pxController)
         {
             const AZ::Vector3 oldPosition = GetBasePosition();
+            m_pxController->move(PxMathConvert(requestedMovement), m_minimumMovementDistance, deltaTime, m_pxControllerFilters);
+            if (m_shadowBody)
             {
-                PHYSX_SCENE_WRITE_LOCK(m_pxController->getScene());
-                m_pxController->move(PxMathConvert(requestedMovement), m_minimumMovementDistance, deltaTime, m_pxControllerFilters);
-                if (m_shadowBody)
-                {
-                    m_shadowBody->SetKinematicTarget(GetTransform());
-                }
+                m_shadowBody->SetKinematicTarget(GetTransform());
             }
             const AZ::Vector3 newPosition = GetBasePosition();
             m_observedVelocity = deltaTime > 0.0f ? (newPosition - oldPosition) / deltaTime : AZ::Vector3::CreateZero();
         }
     }
 
-    void CharacterController::ApplyRequestedVelocity(float deltaTime)
+    AZ::Vector3 CharacterController::CalculateRequestedMovement(float deltaTime) const
     {
         const AZ::Vector3 totalRequestedVelocity = m_requestedVelocityForTick + m_requestedVelocityForPhysicsTimestep;
         const AZ::Vector3 clampedVelocity = totalRequestedVelocity.GetLength() > m_maximumSpeed
             ? m_maximumSpeed * totalRequestedVelocity.GetNormalized()
             : totalRequestedVelocity;
-        const AZ::Vector3 deltaPosition = clampedVelocity * deltaTime;
+        return clampedVelocity * deltaTime;
+    }
 
-        Move(deltaPosition, deltaTime);
+    void CharacterController::ApplyRequestedVelocity(float deltaTime)
+    {
+        Move(CalculateRequestedMovement(deltaTime), deltaTime);
     }
 
     void CharacterController::SetRotation(const AZ::Quaternion& rotation)
@@ -222,6 +222,11 @@ namespace PhysX
         void* GetNativePointer() const override;
 
         // CharacterController specific
+        //! Moves the controller like Move(), without locking the scene.
+        //! The caller has to hold the scene write lock, which allows moving many controllers with a single lock.
+        void MoveUnlocked(const AZ::Vector3& requestedMovement, float deltaTime);
+        //! Returns the movement for the given time step, based on the requested velocities clamped to the maximum speed.
+        AZ::Vector3 CalculateRequestedMovement(float deltaTime) const;
         void Resize(float height);
         float GetHeight() const;
         void SetHeight(float height);
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -25,6 +26,10 @@
 
 namespace PhysX
 {
+    AZ_CVAR(bool, physx_batchCharacterControllerMoves, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Queue the per time step moves of character controllers and execute them together right before the scene is simulated, "
+        "locking the scene once for all characters instead of once per character.");
+
     void CharacterControllerComponent::Reflect(AZ::ReflectContext* context)
     {
         CharacterControllerConfiguration::Reflect(context);
@@ -480,6 +485,17 @@ namespace PhysX
     {
         if (auto* controller = GetController())
         {
+            if (physx_batchCharacterControllerMoves)
+            {
+                if (auto* scene = azdynamic_cast<PhysXScene*>(controller->GetScene()))
+                {
+                    scene->QueueCharacterControllerMove(
+                        m_controllerBodyHandle, controller->CalculateRequestedMovement(physicsTimestep), physicsTimestep);
+                    controller->ResetRequestedVelocityForPhysicsTimestep();
+                    return;
+                }
+            }
+
             controller->ApplyRequestedVelocity(physicsTimestep);
             controller->ResetRequestedVelocityForPhysicsTimestep();
         }
@@ -30,6 +30,7 @@
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
 #include <AzFramework/Physics/Character.h>
 #include <AzFramework/Physics/Collision/CollisionEvents.h>
@@ -50,6 +51,15 @@ namespace PhysX
 
     AZ_CLASS_ALLOCATOR_IMPL(PhysXScene, AZ::SystemAllocator);
 
+    AZ_CVAR(bool, physx_parallelSceneQueryBatch, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Execute the requests of a scene query batch in parallel. "
+        "Filter callbacks of the requests in a batch are called from task worker threads when enabled, so they must be thread safe. "
+        "Batches queried from a task are always executed on the calling thread.");
+
+    AZ_CVAR(size_t, physx_parallelSceneQueryBatchSize, 32, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The number of scene query requests executed per task when a scene query batch is executed in parallel. "
+        "Batches with fewer requests are executed on the calling thread.");
+
     AZ_CVAR(bool, physx_profileSimulationDatapoints, true, nullptr, AZ::ConsoleFunctorFlags::Null,
         "Expose PhysX simulation statistics to profiler. "
         "True: Simulation statistics will be collected for the profiler. "
@@ -567,9 +577,37 @@ namespace PhysX
         m_currentDeltaTime = deltatime;
 
         PHYSX_SCENE_WRITE_LOCK(m_pxScene);
+        ExecuteQueuedCharacterControllerMoves();
         m_pxScene->simulate(deltatime);
     }
 
+    void PhysXScene::QueueCharacterControllerMove(
+        AzPhysics::SimulatedBodyHandle controllerHandle, const AZ::Vector3& requestedMovement, float deltaTime)
+    {
+        m_queuedCharacterControllerMoves.push_back({ controllerHandle, requestedMovement, deltaTime });
+    }
+
+    void PhysXScene::ExecuteQueuedCharacterControllerMoves()
+    {
+        if (m_queuedCharacterControllerMoves.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::ExecuteQueuedCharacterControllerMoves");
+
+        // The scene write lock is held by the caller.
+        for (const QueuedCharacterControllerMove& move : m_queuedCharacterControllerMoves)
+        {
+            // The controller might have been removed after its move was queued.
+            if (auto* controller = azdynamic_cast<CharacterController*>(GetSimulatedBodyFromHandle(move.m_controllerHandle)))
+            {
+                controller->MoveUnlocked(move.m_requestedMovement, move.m_deltaTime);
+            }
+        }
+        m_queuedCharacterControllerMoves.clear();
+    }
+
     void PhysXScene::FinishSimulation()
     {
         AZ_PROFILE_SCOPE(Physics, "PhysXScene::FinishSimulation");
@@ -1014,12 +1052,50 @@ namespace PhysX
 
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
+        AZ_PROFILE_FUNCTION(Physics);
+
         AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        const size_t batchSize = AZ::GetMax(size_t{ 1 }, static_cast<size_t>(physx_parallelSceneQueryBatchSize));
+        const size_t numRequests = requests.size();
+        // Waiting for the task graph from within a task isn't supported, so batches queried from a task run on the calling thread.
+        const bool isParallel = physx_parallelSceneQueryBatch && numRequests > batchSize &&
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Get() && !AZ::TaskExecutor::Instance().IsRunningTask();
+        if (!isParallel)
+        {
+            results.reserve(numRequests);
+            for (auto& request : requests)
+            {
+                results.emplace_back(QueryScene(request.get()));
+            }
+            return results;
+        }
+
+        // Every task writes the hits of its own range of requests, so the results are in the same order as the requests.
+        results.resize(numRequests);
+
+        AZ::TaskGraph taskGraph("Scene Query Batch");
+        AZ::TaskGraphEvent finishEvent("Scene query batch event");
+        for (size_t i = 0; i < numRequests; i += batchSize)
         {
-            results.emplace_back(QueryScene(request.get()));
+            AZ::TaskDescriptor taskDescriptor{ "SceneQueryTask", "Physics" };
+            taskGraph.AddTask(
+                taskDescriptor,
+                [start = i, end = AZStd::min(i + batchSize, numRequests), &requests, &results, this]()
+                {
+                    AZ_PROFILE_SCOPE(Physics, "Scene Query Task");
+
+                    // Keep the scene locked for read for the entire task instead of locking it per query.
+                    PHYSX_SCENE_READ_LOCK(m_pxScene);
+
+                    for (size_t requestIndex = start; requestIndex < end; ++requestIndex)
+                    {
+                        QueryScene(requests[requestIndex].get(), results[requestIndex]);
+                    }
+                });
         }
+
+        taskGraph.Submit(&finishEvent);
+        finishEvent.Wait();
         return results;
     }
 
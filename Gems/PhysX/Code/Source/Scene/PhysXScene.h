@@ -81,6 +81,10 @@ namespace PhysX
 
         physx::PxControllerManager* GetOrCreateControllerManager();
 
+        //! Queue a character controller move, which is executed right before the next simulation step.
+        //! All queued moves are executed while holding the scene write lock once, instead of locking the scene for each move.
+        void QueueCharacterControllerMove(AzPhysics::SimulatedBodyHandle controllerHandle, const AZ::Vector3& requestedMovement, float deltaTime);
+
         //! Apply batched transform sync events for the current simulation pass. 
         //! This will clear the batched data for the next simulation pass.
         void FlushTransformSync();
@@ -114,6 +118,7 @@ namespace PhysX
         void UpdateAzProfilerDataPoints();
 
         void SyncActiveBodyTransform(const AzPhysics::SimulatedBodyHandleList& activeBodyHandles);
+        void ExecuteQueuedCharacterControllerMoves();
 
         bool m_isEnabled = true;
 
@@ -137,6 +142,15 @@ namespace PhysX
         AZStd::vector<AzPhysics::SimulatedBody*> m_deferredDeletions;
         AZStd::queue<AzPhysics::SimulatedBodyIndex> m_freeSceneSlots;
 
+        //! A character controller move, queued with QueueCharacterControllerMove().
+        struct QueuedCharacterControllerMove
+        {
+            AzPhysics::SimulatedBodyHandle m_controllerHandle;
+            AZ::Vector3 m_requestedMovement;
+            float m_deltaTime;
+        };
+        AZStd::vector<QueuedCharacterControllerMove> m_queuedCharacterControllerMoves;
+
         AZStd::vector<AZStd::pair<AZ::Crc32, AzPhysics::Joint*>> m_joints;
         AZStd::vector<AzPhysics::Joint*> m_deferredDeletionsJoints;
         AZStd::queue<AzPhysics::JointIndex> m_freeJointSlots;
@@ -9,8 +9,21 @@
 #include <System/PhysXCpuDispatcher.h>
 #include <System/PhysXJob.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+
 namespace PhysX
 {
+    AZ_CVAR(bool, physx_cpuDispatcherUseTaskGraph, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Run the tasks submitted by PhysX on the task executor instead of as jobs.");
+
+    AZ_CVAR(AZ::u32, physx_cpuDispatcherTaskPriority, static_cast<AZ::u32>(AZ::TaskPriority::MEDIUM), nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The priority of the tasks submitted by PhysX when they run on the task executor. "
+        "0 = critical, 1 = high, 2 = medium, 3 = low.");
+
     PhysXCpuDispatcher* PhysXCpuDispatcherCreate()
     {
         return aznew PhysXCpuDispatcher();
@@ -18,13 +31,53 @@ namespace PhysX
 
     void PhysXCpuDispatcher::submitTask(physx::PxBaseTask& task)
     {
-        auto azJob = aznew PhysXJob(task);
-        azJob->Start();
+        if (physx_cpuDispatcherUseTaskGraph)
+        {
+            SubmitTaskGraph(task);
+        }
+        else
+        {
+            SubmitJob(task);
+        }
     }
 
     physx::PxU32 PhysXCpuDispatcher::getWorkerCount() const
     {
+        if (physx_cpuDispatcherUseTaskGraph)
+        {
+            // Executors that run on the job manager don't have workers of their own.
+            if (const AZ::u32 workerCount = AZ::TaskExecutor::Instance().GetWorkerCount(); workerCount > 0)
+            {
+                return workerCount;
+            }
+        }
+
         return AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
     }
+
+    void PhysXCpuDispatcher::SubmitJob(physx::PxBaseTask& task)
+    {
+        auto azJob = aznew PhysXJob(task);
+        azJob->Start();
+    }
+
+    void PhysXCpuDispatcher::SubmitTaskGraph(physx::PxBaseTask& task)
+    {
+        AZ::TaskDescriptor taskDescriptor{ "PhysX Task", "Physics" };
+        taskDescriptor.priority = static_cast<AZ::TaskPriority>(
+            AZ::GetMin(static_cast<AZ::u32>(physx_cpuDispatcherTaskPriority), static_cast<AZ::u32>(AZ::TaskPriority::LOW)));
+
+        // PhysX tracks the dependencies between its tasks itself and only submits tasks that are ready to run,
+        // so each task is submitted as a detached single task graph which is released once the task completed.
+        AZ::TaskGraph taskGraph{ "PhysX" };
+        taskGraph.AddTask(taskDescriptor, [&task]()
+            {
+                AZ_PROFILE_SCOPE(Physics, task.getName());
+                task.run();
+                task.release();
+            });
+        taskGraph.Detach();
+        taskGraph.Submit();
+    }
 } // namespace PhysX
 
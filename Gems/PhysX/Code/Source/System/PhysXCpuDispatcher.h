@@ -13,6 +13,8 @@
 namespace PhysX
 {
     //! CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
+    //! Tasks run as jobs on the global job manager, or on the task executor when physx_cpuDispatcherUseTaskGraph is enabled,
+    //! so that PhysX shares its worker threads with the rest of the engine instead of competing with them.
     class PhysXCpuDispatcher
         : public physx::PxCpuDispatcher
     {
@@ -26,6 +28,9 @@ namespace PhysX
         // PxCpuDispatcher implementation
         void submitTask(physx::PxBaseTask& task) override;
         physx::PxU32 getWorkerCount() const override;
+
+        void SubmitJob(physx::PxBaseTask& task);
+        void SubmitTaskGraph(physx::PxBaseTask& task);
     };
 
     //! Creates a CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
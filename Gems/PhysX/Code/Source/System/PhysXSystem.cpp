@@ -36,6 +36,15 @@ namespace PhysX
         "True: Sync entity transform once per Simulate call. "
         "False: Sync entity transform for every simulation sub-step.");
 
+    AZ_CVAR(bool, physx_simulateScenesConcurrently, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Step all enabled scenes at the same time, starting the simulation of every scene before waiting for any of them. "
+        "Only enable this when the scenes are independent, as the simulation start events of a scene are signaled while other scenes are simulating.");
+
+    AZ_CVAR(AZ::u32, physx_maxSubstepsPerTick, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Maximum number of fixed timestep sub-steps simulated per tick, 0 for no limit. "
+        "When a tick falls behind by more sub-steps, the remaining time is dropped and the simulation runs slower than real time, "
+        "which keeps an overloaded server from spending ever more time catching up.");
+
     AZ_CLASS_ALLOCATOR_IMPL(PhysXSystem, AZ::SystemAllocator);
 
 #ifdef ENABLE_PHYSX_TIMESTEP_WARNING
@@ -187,6 +196,26 @@ namespace PhysX
 
         auto simulateScenes = [this](float timeStep)
         {
+            if (physx_simulateScenesConcurrently)
+            {
+                AZ::Debug::ScopeDuration performanceScopeDuration(m_performanceCollector.get(), PerformanceSpecPhysXSimulationTime);
+                for (auto& scenePtr : m_sceneList)
+                {
+                    if (scenePtr != nullptr && scenePtr->IsEnabled())
+                    {
+                        scenePtr->StartSimulation(timeStep);
+                    }
+                }
+                for (auto& scenePtr : m_sceneList)
+                {
+                    if (scenePtr != nullptr && scenePtr->IsEnabled())
+                    {
+                        scenePtr->FinishSimulation();
+                    }
+                }
+                return;
+            }
+
             for (auto& scenePtr : m_sceneList)
             {
                 if (scenePtr != nullptr && scenePtr->IsEnabled())
@@ -226,13 +255,27 @@ namespace PhysX
         {
             m_accumulatedTime += tickTime;
             //divide accumulated time by the fixed step and floor it to get the number of steps that would occur. Then multiply by fixedTimeStep to get the total executed time.
-            tickTime = AZStd::floorf(m_accumulatedTime / m_systemConfig.m_fixedTimestep) * m_systemConfig.m_fixedTimestep;
+            float numSteps = AZStd::floorf(m_accumulatedTime / m_systemConfig.m_fixedTimestep);
+            if (physx_maxSubstepsPerTick > 0)
+            {
+                numSteps = AZ::GetMin(numSteps, static_cast<float>(physx_maxSubstepsPerTick));
+            }
+            tickTime = numSteps * m_systemConfig.m_fixedTimestep;
             m_preSimulateEvent.Signal(tickTime);
 
+            AZ::u32 numSubsteps = 0;
             while (m_accumulatedTime >= m_systemConfig.m_fixedTimestep)
             {
+                if (physx_maxSubstepsPerTick > 0 && numSubsteps >= physx_maxSubstepsPerTick)
+                {
+                    // Over budget, drop the time that is left instead of carrying it over to the next tick.
+                    m_accumulatedTime = AZStd::fmod(m_accumulatedTime, m_systemConfig.m_fixedTimestep);
+                    break;
+                }
+
                 simulateScenes(m_systemConfig.m_fixedTimestep);
                 m_accumulatedTime -= m_systemConfig.m_fixedTimestep;
+                ++numSubsteps;
             }
         }
         else
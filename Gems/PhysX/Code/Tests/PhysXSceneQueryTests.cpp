@@ -7,6 +7,8 @@
  */
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/MathUtils.h>
 
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
@@ -1007,4 +1009,48 @@ namespace PhysX
             }
         }
     }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_ParallelBatchLargerThanTaskSize_ResultsAreInRequestOrder)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        auto* console = AZ::Interface<AZ::IConsole>::Get();
+        ASSERT_NE(console, nullptr);
+
+        // Split the batch over many tasks.
+        bool wasParallel = false;
+        size_t previousBatchSize = 0;
+        console->GetCvarValue("physx_parallelSceneQueryBatch", wasParallel);
+        console->GetCvarValue("physx_parallelSceneQueryBatchSize", previousBatchSize);
+        console->PerformCommand("physx_parallelSceneQueryBatch true");
+        console->PerformCommand("physx_parallelSceneQueryBatchSize 4");
+
+        // Place one sphere per request on a circle around the origin, with a ray from the origin towards each of them.
+        constexpr size_t NumRequests = 64;
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        AzPhysics::SceneQueryRequests requests;
+        for (size_t i = 0; i < NumRequests; ++i)
+        {
+            const float angle = AZ::Constants::TwoPi * static_cast<float>(i) / static_cast<float>(NumRequests);
+            const AZ::Vector3 direction(AZ::Cos(angle), AZ::Sin(angle), 0.0f);
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, direction * 10.0f, 0.3f));
+
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = direction;
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+        console->PerformCommand(AZStd::string::format("physx_parallelSceneQueryBatch %s", wasParallel ? "true" : "false").c_str());
+        console->PerformCommand(AZStd::string::format("physx_parallelSceneQueryBatchSize %zu", previousBatchSize).c_str());
+
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            ASSERT_EQ(results[i].m_hits.size(), 1);
+            EXPECT_EQ(results[i].m_hits[0].m_bodyHandle, simBodies[i]);
+        }
+    }
 }
@@ -8,12 +8,19 @@
 
 #include <CpuProfiler.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Metrics/IEventLogger.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Statistics/StatisticalProfilerProxy.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/time.h>
 
+AZ_CVAR(bool, profiler_flightRecorder, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+    "Keeps the profiling regions of the last profiler_flightRecorderSeconds of every thread in lock-free per-thread rings, to dump them on demand or in hitch captures.");
+AZ_CVAR(float, profiler_flightRecorderSeconds, 10.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+    "The number of seconds of profiling data dumped by the flight recorder. Busy threads may fill their ring sooner.");
+
 namespace Profiler
 {
     thread_local CpuTimingLocalStorage* CpuProfiler::ms_threadLocalStorage = nullptr;
@@ -94,15 +101,30 @@ namespace Profiler
         // Try to lock here, the shutdownMutex will only be contested when the CpuProfiler is shutting down.
         if (m_shutdownMutex.try_lock_shared())
         {
-            if (m_enabled)
+            const bool flightRecorderEnabled = profiler_flightRecorder;
+            if (m_enabled || flightRecorderEnabled)
             {
                 // Lazy initialization, creates an instance of the Thread local data if it's not created, and registers it
-                RegisterThreadStorage();
-                va_list args;
-                va_start(args, eventNameArgCount);
-                // Push it to the stack
-                CachedTimeRegion timeRegion({ budget->Name(), AZStd::fixed_string<512>::format_arg(eventName, args).c_str() });
-                ms_threadLocalStorage->RegionStackPushBack(timeRegion);
+                if (!ms_threadLocalStorage)
+                {
+                    RegisterThreadStorage();
+                }
+
+                if (m_enabled)
+                {
+                    va_list args;
+                    va_start(args, eventNameArgCount);
+                    // Push it to the stack
+                    CachedTimeRegion timeRegion({ budget->Name(), AZStd::fixed_string<512>::format_arg(eventName, args).c_str() });
+                    ms_threadLocalStorage->RegionStackPushBack(timeRegion);
+                    va_end(args);
+                }
+
+                // The flight recorder is last so its start time doesn't include the formatting of the name above
+                if (flightRecorderEnabled)
+                {
+                    ms_threadLocalStorage->FlightRecorderPushBack(budget, eventName);
+                }
             }
 
             m_shutdownMutex.unlock_shared();
@@ -114,10 +136,16 @@ namespace Profiler
         // Try to lock here, the shutdownMutex will only be contested when the CpuProfiler is shutting down.
         if (m_shutdownMutex.try_lock_shared())
         {
-            // guard against enabling mid-marker
-            if (m_enabled && ms_threadLocalStorage != nullptr)
+            if (ms_threadLocalStorage != nullptr)
             {
-                ms_threadLocalStorage->RegionStackPopBack();
+                // The flight recorder ends its regions even when it was disabled mid-marker, it ignores the ends of regions it didn't begin
+                ms_threadLocalStorage->FlightRecorderPopBack();
+
+                // guard against enabling mid-marker
+                if (m_enabled)
+                {
+                    ms_threadLocalStorage->RegionStackPopBack();
+                }
             }
 
             m_shutdownMutex.unlock_shared();
@@ -203,6 +231,30 @@ namespace Profiler
         return m_enabled;
     }
 
+    bool CpuProfiler::IsFlightRecorderEnabled() const
+    {
+        return profiler_flightRecorder;
+    }
+
+    void CpuProfiler::CollectFlightRecorderData(AZStd::ring_buffer<TimeRegionMap>& flushTarget)
+    {
+        const float seconds = profiler_flightRecorderSeconds;
+        const AZStd::sys_time_t windowTicks = aznumeric_cast<AZStd::sys_time_t>(seconds * AZStd::GetTimeTicksPerSecond());
+        const AZStd::sys_time_t sinceTick = AZStd::GetTimeNowTicks() - windowTicks;
+
+        TimeRegionMap flightRecorderMap;
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
+            for (auto& threadLocal : m_registeredThreads)
+            {
+                threadLocal->CollectFlightRecorderEvents(flightRecorderMap[threadLocal->m_executingThreadId], sinceTick);
+            }
+        }
+
+        flushTarget.set_capacity(1);
+        flushTarget.push_back(AZStd::move(flightRecorderMap));
+    }
+
     void CpuProfiler::OnSystemTick()
     {
         if (!m_enabled)
@@ -263,6 +315,7 @@ namespace Profiler
     CpuTimingLocalStorage::~CpuTimingLocalStorage()
     {
         m_deleteFlag = true;
+        delete[] m_flightRecorderEvents.load();
     }
 
     void CpuTimingLocalStorage::RegionStackPushBack(CachedTimeRegion& timeRegion)
@@ -389,6 +442,90 @@ namespace Profiler
         m_cachedDataLimitReached = false;
     }
 
+    void CpuTimingLocalStorage::FlightRecorderPushBack(const AZ::Debug::Budget* budget, const char* eventName)
+    {
+        if (m_flightRecorderEvents.load(AZStd::memory_order_relaxed) == nullptr)
+        {
+            m_flightRecorderEvents.store(new FlightRecorderEvent[FlightRecorderEventCount], AZStd::memory_order_release);
+        }
+
+        // Regions nested deeper than the stack are only counted, so the ends of the regions keep matching their beginnings
+        const uint32_t stackLevel = m_flightRecorderStackLevel++;
+        if (stackLevel < FlightRecorderStackSize)
+        {
+            FlightRecorderEvent& event = m_flightRecorderStack[stackLevel];
+            event.m_budget = budget;
+            event.m_eventName = eventName;
+            event.m_stackDepth = aznumeric_cast<uint16_t>(stackLevel);
+
+            // Set the starting time at the end, to avoid recording the minor overhead
+            event.m_startTick = AZStd::GetTimeNowTicks();
+        }
+    }
+
+    void CpuTimingLocalStorage::FlightRecorderPopBack()
+    {
+        // Early out when the stack is empty, this happens when the flight recorder was enabled mid-marker
+        if (m_flightRecorderStackLevel == 0)
+        {
+            return;
+        }
+
+        // Get the end timestamp here, to avoid the minor overhead
+        const AZStd::sys_time_t endTick = AZStd::GetTimeNowTicks();
+
+        const uint32_t stackLevel = --m_flightRecorderStackLevel;
+        if (stackLevel >= FlightRecorderStackSize)
+        {
+            return;
+        }
+
+        FlightRecorderEvent& event = m_flightRecorderStack[stackLevel];
+        event.m_endTick = endTick;
+
+        // Only this thread writes the ring, publishing the event with the write count is enough for the readers
+        FlightRecorderEvent* events = m_flightRecorderEvents.load(AZStd::memory_order_relaxed);
+        const uint64_t writeCount = m_flightRecorderWriteCount.load(AZStd::memory_order_relaxed);
+        events[writeCount & (FlightRecorderEventCount - 1)] = event;
+        m_flightRecorderWriteCount.store(writeCount + 1, AZStd::memory_order_release);
+    }
+
+    void CpuTimingLocalStorage::CollectFlightRecorderEvents(ThreadTimeRegionMap& threadRegionMap, AZStd::sys_time_t sinceTick) const
+    {
+        const FlightRecorderEvent* events = m_flightRecorderEvents.load(AZStd::memory_order_acquire);
+        if (events == nullptr)
+        {
+            return;
+        }
+
+        const uint64_t writeCount = m_flightRecorderWriteCount.load(AZStd::memory_order_acquire);
+        const uint64_t firstIndex = writeCount > FlightRecorderEventCount ? writeCount - FlightRecorderEventCount : 0;
+
+        AZStd::vector<FlightRecorderEvent> copiedEvents;
+        copiedEvents.reserve(writeCount - firstIndex);
+        for (uint64_t index = firstIndex; index < writeCount; ++index)
+        {
+            copiedEvents.push_back(events[index & (FlightRecorderEventCount - 1)]);
+        }
+
+        // The thread kept recording during the copy. Drop the events it may have overwritten, including the one it may be writing.
+        AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+        const uint64_t writeCountAfterCopy = m_flightRecorderWriteCount.load(AZStd::memory_order_relaxed) + 1;
+        const uint64_t firstValidIndex = writeCountAfterCopy > FlightRecorderEventCount ? writeCountAfterCopy - FlightRecorderEventCount : 0;
+
+        for (uint64_t index = AZStd::max(firstIndex, firstValidIndex); index < writeCount; ++index)
+        {
+            const FlightRecorderEvent& event = copiedEvents[index - firstIndex];
+            if (event.m_endTick < sinceTick)
+            {
+                continue;
+            }
+
+            CachedTimeRegion timeRegion({ event.m_budget->Name(), event.m_eventName }, event.m_stackDepth, event.m_startTick, event.m_endTick);
+            threadRegionMap[timeRegion.m_groupRegionName.m_regionName.GetStringView()].push_back(timeRegion);
+        }
+    }
+
     // --- CpuProfilingStatisticsSerializer ---
 
     CpuProfilingStatisticsSerializer::CpuProfilingStatisticsSerializer(const AZStd::ring_buffer<TimeRegionMap>& continuousData)
@@ -450,4 +587,40 @@ namespace Profiler
                 ->Field("threadId", &CpuProfilingStatisticsSerializerEntry::m_threadId);
         }
     }
+
+    // --- RecordCpuProfilingData ---
+
+    void RecordCpuProfilingData(AZ::Metrics::IEventLogger& eventLogger, const AZStd::ring_buffer<TimeRegionMap>& data)
+    {
+        using namespace AZStd::chrono;
+
+        // Trace events use UTC timestamps
+        const AZStd::sys_time_t nowTicks = AZStd::GetTimeNowTicks();
+        const microseconds utcNow = duration_cast<microseconds>(utc_clock::now().time_since_epoch());
+        const double microsecondsPerTick = 1000000.0 / aznumeric_cast<double>(AZStd::GetTimeTicksPerSecond());
+        auto toMicroseconds = [microsecondsPerTick](AZStd::sys_time_t ticks)
+        {
+            return microseconds(aznumeric_cast<int64_t>(aznumeric_cast<double>(ticks) * microsecondsPerTick));
+        };
+
+        for (const TimeRegionMap& timeRegionMap : data)
+        {
+            for (const auto& [threadId, regionMap] : timeRegionMap)
+            {
+                for (const auto& [regionName, regions] : regionMap)
+                {
+                    for (const CachedTimeRegion& region : regions)
+                    {
+                        AZ::Metrics::CompleteArgs completeArgs;
+                        completeArgs.m_name = region.m_groupRegionName.m_regionName.GetStringView();
+                        completeArgs.m_cat = region.m_groupRegionName.m_groupName;
+                        completeArgs.m_ts = utcNow - toMicroseconds(nowTicks - region.m_startTick);
+                        completeArgs.m_tid = threadId;
+                        completeArgs.m_dur = toMicroseconds(region.m_endTick - region.m_startTick);
+                        eventLogger.RecordCompleteEvent(completeArgs);
+                    }
+                }
+            }
+        }
+    }
 } // namespace Profiler
@@ -13,6 +13,7 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Name/Name.h>
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/ring_buffer.h>
 #include <AzCore/std/containers/unordered_map.h>
@@ -21,6 +22,10 @@
 #include <AzCore/std/smart_ptr/intrusive_refcount.h>
 #include <AzCore/std/string/string.h>
 
+namespace AZ::Metrics
+{
+    class IEventLogger;
+}
 namespace Profiler
 {
     //! Structure that is used to cache a timed region into the thread's local storage.
@@ -54,6 +59,17 @@ namespace Profiler
         AZStd::sys_time_t m_endTick = 0;
     };
 
+    //! A completed region recorded by the flight recorder. The names are the unformatted pointers passed to the profiler macros,
+    //! so recording never formats or allocates, and the names are only resolved when the recorder is dumped.
+    struct FlightRecorderEvent
+    {
+        const AZ::Debug::Budget* m_budget = nullptr;
+        const char* m_eventName = nullptr;
+        AZStd::sys_time_t m_startTick = 0;
+        AZStd::sys_time_t m_endTick = 0;
+        uint16_t m_stackDepth = 0u;
+    };
+
     using ThreadTimeRegionMap = AZStd::unordered_map<AZStd::string, AZStd::vector<CachedTimeRegion>>;
     using TimeRegionMap = AZStd::unordered_map<AZStd::thread_id, ThreadTimeRegionMap>;
 
@@ -90,6 +106,15 @@ namespace Profiler
         // Clears m_cachedTimeRegions and resets m_cachedDataLimitReached flag.
         void ResetCachedData();
 
+        // Opens a region in the flight recorder, gets called each time a region begins while the flight recorder is enabled
+        void FlightRecorderPushBack(const AZ::Debug::Budget* budget, const char* eventName);
+
+        // Closes the innermost open region and writes it to the flight recorder ring
+        void FlightRecorderPopBack();
+
+        // Copies the events of the ring that ended at or after sinceTick to the map, without blocking the recording thread
+        void CollectFlightRecorderEvents(ThreadTimeRegionMap& threadRegionMap, AZStd::sys_time_t sinceTick) const;
+
         AZStd::thread_id m_executingThreadId;
         // Keeps track of the current thread's stack depth
         uint32_t m_stackLevel = 0u;
@@ -118,6 +143,21 @@ namespace Profiler
 
         // Keeps track of the first time cached data limit was reached.
         bool m_cachedDataLimitReached = false;
+
+        // Number of events of the flight recorder ring of each thread, must be a power of 2
+        static constexpr uint64_t FlightRecorderEventCount = 8192u;
+        static constexpr uint32_t FlightRecorderStackSize = 256u;
+
+        // Ring of completed regions, only written by the owning thread. It's allocated the first time the thread records
+        // an event, so threads never profiled while the flight recorder is enabled don't pay for it.
+        AZStd::atomic<FlightRecorderEvent*> m_flightRecorderEvents = nullptr;
+
+        // Total number of events written to the ring. Readers use it to detect the events overwritten while they copied the ring.
+        AZStd::atomic<uint64_t> m_flightRecorderWriteCount = 0u;
+
+        // Regions that began but haven't ended yet. Regions nested deeper than the stack are counted but not recorded.
+        AZStd::array<FlightRecorderEvent, FlightRecorderStackSize> m_flightRecorderStack;
+        uint32_t m_flightRecorderStackLevel = 0u;
     };
 
     //! CpuProfiler will keep track of the registered threads, and
@@ -159,6 +199,15 @@ namespace Profiler
         void SetProfilerEnabled(bool enabled);
         bool IsProfilerEnabled() const;
 
+        //! Copies the regions recorded by the flight recorder of all threads in the last profiler_flightRecorderSeconds to the
+        //! flush target. The threads keep recording while the data is collected, they are never blocked.
+        //! NOTE: The recorder keeps the unformatted event names, so the format arguments of the regions aren't part of the data,
+        //! and the names (like the group names of CachedTimeRegion) must stay valid until they are collected.
+        void CollectFlightRecorderData(AZStd::ring_buffer<TimeRegionMap>& flushTarget);
+
+        //! Check to see if the flight recorder is enabled with the profiler_flightRecorder cvar.
+        bool IsFlightRecorderEnabled() const;
+
         //! AZ::SystemTickBus::Handler overrides
         //! When fired, the profiler collects all profiling data from registered threads and updates
         //! m_timeRegionMap so that the next frame has up-to-date profiling data.
@@ -229,4 +278,7 @@ namespace Profiler
         AZStd::vector<CpuProfilingStatisticsSerializerEntry> m_cpuProfilingStatisticsSerializerEntries;
         AZStd::sys_time_t m_timeTicksPerSecond = 0;
     };
+
+    //! Records the time regions as complete events of the event logger, with their ticks converted to the UTC timestamps of trace events.
+    void RecordCpuProfilingData(AZ::Metrics::IEventLogger& eventLogger, const AZStd::ring_buffer<TimeRegionMap>& data);
 } // namespace Profiler
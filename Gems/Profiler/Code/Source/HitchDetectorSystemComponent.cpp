@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <HitchDetectorSystemComponent.h>
+
+#include <CpuProfiler.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/IO/IStreamer.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Metrics/JsonTraceEventLogger.h>
+#include <AzCore/Metrics/PerfettoTraceEventLogger.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/time.h>
+
+AZ_CVAR(bool, profiler_hitchDetector, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+    "Write a capture with the context of the frame to the profiler capture location when a frame is a hitch. "
+    "Enable profiler_flightRecorder to include the profiling regions of the frames before the hitch.");
+AZ_CVAR(float, profiler_hitchThresholdMs, 100.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+    "A frame is a hitch when it takes longer than this many milliseconds, and longer than profiler_hitchAverageMultiplier times the average frame.");
+AZ_CVAR(float, profiler_hitchAverageMultiplier, 3.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+    "A frame is a hitch when it takes longer than this many times the average frame, and longer than profiler_hitchThresholdMs. 0 only uses the threshold.");
+AZ_CVAR(bool, profiler_hitchCapturePerfetto, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+    "Write the hitch captures in the binary Perfetto trace format (.pftrace), which is smaller and faster to write than json trace events.");
+AZ_CVAR(float, profiler_hitchCooldownSeconds, 60.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+    "The minimum number of seconds between two hitch captures.");
+
+namespace Profiler
+{
+    namespace
+    {
+        // Weight of a new frame in the average frame time
+        constexpr float AverageFrameWeight = 0.05f;
+
+        // Settles the average after the loading frames before detecting hitches
+        constexpr uint32_t WarmUpFrameCount = 60;
+
+        double GetStatisticValue(const AZ::IO::Statistic::Value& value)
+        {
+            return AZStd::visit(
+                [](auto&& statistic) -> double
+                {
+                    using T = AZStd::decay_t<decltype(statistic)>;
+                    if constexpr (AZStd::is_same_v<T, bool>)
+                    {
+                        return statistic ? 1.0 : 0.0;
+                    }
+                    else if constexpr (AZStd::is_same_v<T, double> || AZStd::is_same_v<T, AZ::s64>)
+                    {
+                        return aznumeric_cast<double>(statistic);
+                    }
+                    else if constexpr (
+                        AZStd::is_same_v<T, AZ::IO::Statistic::Time> || AZStd::is_same_v<T, AZ::IO::Statistic::TimeRange>)
+                    {
+                        return aznumeric_cast<double>(statistic.m_value.count());
+                    }
+                    else if constexpr (
+                        AZStd::is_same_v<T, AZStd::monostate> || AZStd::is_same_v<T, AZStd::string> ||
+                        AZStd::is_same_v<T, AZStd::string_view>)
+                    {
+                        return 0.0;
+                    }
+                    else
+                    {
+                        return aznumeric_cast<double>(statistic.m_value);
+                    }
+                },
+                value);
+        }
+
+        bool IsNumericStatistic(const AZ::IO::Statistic::Value& value)
+        {
+            return !AZStd::holds_alternative<AZStd::monostate>(value) && !AZStd::holds_alternative<AZStd::string>(value) &&
+                !AZStd::holds_alternative<AZStd::string_view>(value);
+        }
+    } // namespace
+
+    void HitchDetectorSystemComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serialize->Class<HitchDetectorSystemComponent, AZ::Component>()
+                ->Version(0);
+
+            if (AZ::EditContext* ec = serialize->GetEditContext())
+            {
+                ec->Class<HitchDetectorSystemComponent>("Hitch Detector", "Writes a capture with the context of the frame when a frame is a hitch")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                        ->Attribute(AZ::Edit::Attributes::AutoExpand, true);
+            }
+        }
+    }
+
+    void HitchDetectorSystemComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("HitchDetectorService"));
+    }
+
+    void HitchDetectorSystemComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("HitchDetectorService"));
+    }
+
+    void HitchDetectorSystemComponent::GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent)
+    {
+        dependent.push_back(AZ_CRC_CE("ProfilerService"));
+    }
+
+    void HitchDetectorSystemComponent::Activate()
+    {
+        m_hasLastTick = false;
+        m_hasHitched = false;
+        m_frameCount = 0;
+        m_averageFrameMs = 0.0f;
+        AZ::SystemTickBus::Handler::BusConnect();
+    }
+
+    void HitchDetectorSystemComponent::Deactivate()
+    {
+        AZ::SystemTickBus::Handler::BusDisconnect();
+
+        // Block deactivation until the last capture has been written
+        if (m_captureThread.joinable())
+        {
+            m_captureThread.join();
+        }
+    }
+
+    void HitchDetectorSystemComponent::OnSystemTick()
+    {
+        using namespace AZStd::chrono;
+
+        const steady_clock::time_point now = steady_clock::now();
+        if (!m_hasLastTick)
+        {
+            m_lastTickTime = now;
+            m_hasLastTick = true;
+            return;
+        }
+
+        const float frameMs = duration<float, milli>(now - m_lastTickTime).count();
+        m_lastTickTime = now;
+
+        const bool warmingUp = m_frameCount < WarmUpFrameCount;
+        m_frameCount += warmingUp ? 1 : 0;
+
+        const float averageMultiplier = profiler_hitchAverageMultiplier;
+        const bool isHitch = !warmingUp && frameMs > static_cast<float>(profiler_hitchThresholdMs) &&
+            (averageMultiplier <= 0.0f || frameMs > m_averageFrameMs * averageMultiplier);
+
+        if (!isHitch)
+        {
+            // Hitches are kept out of the average, so a series of them doesn't raise the bar for the next ones
+            m_averageFrameMs = m_averageFrameMs > 0.0f ? m_averageFrameMs + (frameMs - m_averageFrameMs) * AverageFrameWeight : frameMs;
+            return;
+        }
+
+        if (!profiler_hitchDetector)
+        {
+            return;
+        }
+
+        const float cooldownSeconds = profiler_hitchCooldownSeconds;
+        if (m_hasHitched && duration<float>(now - m_lastHitchTime).count() < cooldownSeconds)
+        {
+            return;
+        }
+
+        m_lastHitchTime = now;
+        m_hasHitched = true;
+        CaptureHitch(frameMs, m_averageFrameMs);
+    }
+
+    void HitchDetectorSystemComponent::CaptureHitch(float frameMs, float averageFrameMs)
+    {
+        bool expected = false;
+        if (!m_captureInProgress.compare_exchange_strong(expected, true))
+        {
+            AZ_TracePrintf("HitchDetector", "Skipping the capture of a %.2f ms frame, the previous capture is still being written\n", frameMs);
+            return;
+        }
+
+        const AZ::IO::FixedMaxPathString captureOutput = AZ::Debug::GetProfilerCaptureLocation();
+        const AZ::IO::FixedMaxPathString captureFilePath =
+            AZ::IO::FixedMaxPathString::format("%s/hitch_%lld.%s", captureOutput.c_str(), AZStd::GetTimeNowSecond(),
+                profiler_hitchCapturePerfetto ? "pftrace" : "json");
+        AZ::IO::FixedMaxPath resolvedPath;
+        if (!AZ::IO::FileIOBase::GetInstance() || !AZ::IO::FileIOBase::GetInstance()->ResolvePath(resolvedPath, captureFilePath))
+        {
+            resolvedPath = captureFilePath;
+        }
+
+        AZ_TracePrintf("HitchDetector", "Frame took %.2f ms (average %.2f ms), writing a capture to '%s'\n", frameMs, averageFrameMs, resolvedPath.c_str());
+
+        // If the thread object already exists, join. This will not block since m_captureInProgress was false,
+        // meaning the thread has already completed execution.
+        if (m_captureThread.joinable())
+        {
+            m_captureThread.join();
+        }
+
+        m_captureThread = AZStd::thread(
+            [filePath = AZStd::string(resolvedPath.c_str()), frameMs, averageFrameMs, &flag = m_captureInProgress]()
+            {
+                WriteHitchCapture(filePath, frameMs, averageFrameMs);
+                flag.store(false);
+            });
+    }
+
+    void HitchDetectorSystemComponent::WriteHitchCapture(const AZStd::string& filePath, float frameMs, float averageFrameMs)
+    {
+        auto stream = AZStd::make_unique<AZ::IO::SystemFileStream>(
+            filePath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeCreatePath);
+        if (!stream->IsOpen())
+        {
+            const AZStd::string error = AZStd::string::format("Unable to open '%s' to write the hitch capture to.", filePath.c_str());
+            AZ_Warning("HitchDetector", false, "%s", error.c_str());
+            AZ::Debug::ProfilerNotificationBus::Broadcast(&AZ::Debug::ProfilerNotificationBus::Events::OnCaptureFinished, false, error);
+            return;
+        }
+
+        {
+            AZStd::unique_ptr<AZ::Metrics::IEventLogger> eventLogger;
+            if (AZ::IO::PathView(filePath).Extension() == ".pftrace")
+            {
+                eventLogger = AZStd::make_unique<AZ::Metrics::PerfettoTraceEventLogger>(AZStd::move(stream), "HitchCapture");
+            }
+            else
+            {
+                // The logger can be activated in release builds through the "/O3DE/Metrics/HitchCapture/Active" setting.
+                eventLogger = AZStd::make_unique<AZ::Metrics::JsonTraceEventLogger>(
+                    AZStd::move(stream), AZ::Metrics::JsonTraceEventLoggerConfig{ "HitchCapture" });
+            }
+
+            AZ::Metrics::EventField hitchArgs[] = {
+                { "frameMs", AZ::Metrics::EventValue{ AZStd::in_place_type<double>, frameMs } },
+                { "averageFrameMs", AZ::Metrics::EventValue{ AZStd::in_place_type<double>, averageFrameMs } },
+            };
+            AZ::Metrics::InstantArgs instantArgs;
+            instantArgs.m_name = "Hitch";
+            instantArgs.m_cat = "HitchDetector";
+            instantArgs.m_args = hitchArgs;
+            instantArgs.m_scope = AZ::Metrics::InstantEventScope::Global;
+            eventLogger->RecordInstantEvent(instantArgs);
+
+            if (auto* cpuProfiler = azrtti_cast<CpuProfiler*>(AZ::Interface<AZ::Debug::Profiler>::Get());
+                cpuProfiler && cpuProfiler->IsFlightRecorderEnabled())
+            {
+                RecordFlightRecorderRegions(*eventLogger, *cpuProfiler);
+            }
+            RecordStreamerStatistics(*eventLogger);
+            RecordAllocatorStatistics(*eventLogger);
+            RecordTaskOccupancy(*eventLogger);
+
+            eventLogger->Flush();
+        }
+
+        AZ_Printf("HitchDetector", "Hitch capture was saved to file [%s]\n", filePath.c_str());
+        AZ::Debug::ProfilerNotificationBus::Broadcast(&AZ::Debug::ProfilerNotificationBus::Events::OnCaptureFinished, true, filePath);
+    }
+
+    void HitchDetectorSystemComponent::RecordFlightRecorderRegions(AZ::Metrics::IEventLogger& eventLogger, CpuProfiler& cpuProfiler)
+    {
+        AZStd::ring_buffer<TimeRegionMap> flightRecorderData;
+        cpuProfiler.CollectFlightRecorderData(flightRecorderData);
+        RecordCpuProfilingData(eventLogger, flightRecorderData);
+    }
+
+    void HitchDetectorSystemComponent::RecordStreamerStatistics(AZ::Metrics::IEventLogger& eventLogger)
+    {
+        auto* streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
+        if (!streamer)
+        {
+            return;
+        }
+
+        AZStd::vector<AZ::IO::Statistic> statistics;
+        streamer->CollectStatistics(statistics);
+        for (const AZ::IO::Statistic& statistic : statistics)
+        {
+            if (!IsNumericStatistic(statistic.GetValue()))
+            {
+                continue;
+            }
+
+            AZ::Metrics::EventField counterArgs[] = {
+                { statistic.GetName(), AZ::Metrics::EventValue{ AZStd::in_place_type<double>, GetStatisticValue(statistic.GetValue()) } },
+            };
+            AZ::Metrics::CounterArgs args;
+            args.m_name = statistic.GetOwner();
+            args.m_cat = "Streamer";
+            args.m_args = counterArgs;
+            eventLogger.RecordCounterEvent(args);
+        }
+    }
+
+    void HitchDetectorSystemComponent::RecordAllocatorStatistics(AZ::Metrics::IEventLogger& eventLogger)
+    {
+        size_t usedBytes = 0;
+        size_t reservedBytes = 0;
+        AZStd::vector<AZ::AllocatorManager::AllocatorStats> allocatorStats;
+        AZ::AllocatorManager::Instance().GetAllocatorStats(usedBytes, reservedBytes, &allocatorStats);
+
+        for (const AZ::AllocatorManager::AllocatorStats& stats : allocatorStats)
+        {
+            AZ::Metrics::EventField counterArgs[] = {
+                { "allocatedBytes", AZ::Metrics::EventValue{ AZStd::in_place_type<AZ::u64>, stats.m_allocatedBytes } },
+                { "capacityBytes", AZ::Metrics::EventValue{ AZStd::in_place_type<AZ::u64>, stats.m_capacityBytes } },
+            };
+            AZ::Metrics::CounterArgs args;
+            args.m_name = stats.m_name;
+            args.m_cat = "Memory";
+            args.m_args = counterArgs;
+            eventLogger.RecordCounterEvent(args);
+        }
+
+        AZ::Metrics::EventField totalArgs[] = {
+            { "usedBytes", AZ::Metrics::EventValue{ AZStd::in_place_type<AZ::u64>, usedBytes } },
+            { "reservedBytes", AZ::Metrics::EventValue{ AZStd::in_place_type<AZ::u64>, reservedBytes } },
+        };
+        AZ::Metrics::CounterArgs args;
+        args.m_name = "Total";
+        args.m_cat = "Memory";
+        args.m_args = totalArgs;
+        eventLogger.RecordCounterEvent(args);
+    }
+
+    void HitchDetectorSystemComponent::RecordTaskOccupancy(AZ::Metrics::IEventLogger& eventLogger)
+    {
+        if (!AZ::Interface<AZ::TaskGraphActiveInterface>::Get())
+        {
+            return;
+        }
+
+        AZ::TaskExecutor& taskExecutor = AZ::TaskExecutor::Instance();
+        if (!taskExecutor.IsRecordingTimeline())
+        {
+            return;
+        }
+
+        // Exporting stops the recording, restart it so the next hitch capture has a timeline too
+        taskExecutor.ExportTimeline(eventLogger);
+        taskExecutor.StartTimelineRecording();
+    }
+} // namespace Profiler
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::Metrics
+{
+    class IEventLogger;
+}
+
+namespace Profiler
+{
+    class CpuProfiler;
+
+    //! Watches the time between system ticks, and when a frame is a hitch writes a capture with the context of the hitch to a
+    //! json trace event file, or a Perfetto trace file when profiler_hitchCapturePerfetto is enabled, through an IEventLogger:
+    //! - The profiling regions kept by the flight recorder of the CpuProfiler, when profiler_flightRecorder is enabled.
+    //! - The statistics of the Streamer.
+    //! - The usage of the allocators.
+    //! - The timeline and occupancy of the task workers, when the TaskGraph timeline is being recorded.
+    //! Listeners of AZ::Debug::ProfilerNotificationBus are notified of every capture, for example to upload it.
+    class HitchDetectorSystemComponent
+        : public AZ::Component
+        , protected AZ::SystemTickBus::Handler
+    {
+    public:
+        AZ_COMPONENT(HitchDetectorSystemComponent, "{6C0B6C1E-4D0A-4E8C-9C52-3A4F7F1E2B91}");
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+        static void GetDependentServices(AZ::ComponentDescriptor::DependencyArrayType& dependent);
+
+        HitchDetectorSystemComponent() = default;
+        ~HitchDetectorSystemComponent() override = default;
+
+    protected:
+        // AZ::Component interface implementation
+        void Activate() override;
+        void Deactivate() override;
+
+        // AZ::SystemTickBus::Handler interface implementation
+        void OnSystemTick() override;
+
+    private:
+        // Writes the capture of a hitch on m_captureThread, so the frames following the hitch aren't slowed down by it
+        void CaptureHitch(float frameMs, float averageFrameMs);
+
+        static void WriteHitchCapture(const AZStd::string& filePath, float frameMs, float averageFrameMs);
+        static void RecordFlightRecorderRegions(AZ::Metrics::IEventLogger& eventLogger, CpuProfiler& cpuProfiler);
+        static void RecordStreamerStatistics(AZ::Metrics::IEventLogger& eventLogger);
+        static void RecordAllocatorStatistics(AZ::Metrics::IEventLogger& eventLogger);
+        static void RecordTaskOccupancy(AZ::Metrics::IEventLogger& eventLogger);
+
+        AZStd::chrono::steady_clock::time_point m_lastTickTime;
+        AZStd::chrono::steady_clock::time_point m_lastHitchTime;
+        bool m_hasLastTick = false;
+        bool m_hasHitched = false;
+        uint32_t m_frameCount = 0;
+
+        // Exponential moving average of the frame times that weren't hitches
+        float m_averageFrameMs = 0.0f;
+
+        AZStd::thread m_captureThread;
+        AZStd::atomic_bool m_captureInProgress{ false };
+    };
+} // namespace Profiler
@@ -6,6 +6,7 @@
  *
  */
 
+#include <HitchDetectorSystemComponent.h>
 #include <ProfilerImGuiSystemComponent.h>
 #include <ProfilerSystemComponent.h>
 
@@ -30,6 +31,7 @@ namespace Profiler
             m_descriptors.insert(m_descriptors.end(), {
                 ProfilerSystemComponent::CreateDescriptor(),
                 ProfilerImGuiSystemComponent::CreateDescriptor(),
+                HitchDetectorSystemComponent::CreateDescriptor(),
             });
         }
 
@@ -41,6 +43,7 @@ namespace Profiler
             return AZ::ComponentTypeList{
                 azrtti_typeid<ProfilerSystemComponent>(),
                 azrtti_typeid<ProfilerImGuiSystemComponent>(),
+                azrtti_typeid<HitchDetectorSystemComponent>(),
             };
         }
     };
@@ -6,6 +6,7 @@
  *
  */
 
+#include <HitchDetectorSystemComponent.h>
 #include <ProfilerSystemComponent.h>
 
 #include <AzCore/Memory/SystemAllocator.h>
@@ -28,6 +29,7 @@ namespace Profiler
             // This happens through the [MyComponent]::Reflect() function.
             m_descriptors.insert(m_descriptors.end(), {
                 ProfilerSystemComponent::CreateDescriptor(),
+                HitchDetectorSystemComponent::CreateDescriptor(),
             });
         }
 
@@ -38,6 +40,7 @@ namespace Profiler
         {
             return AZ::ComponentTypeList{
                 azrtti_typeid<ProfilerSystemComponent>(),
+                azrtti_typeid<HitchDetectorSystemComponent>(),
             };
         }
     };
@@ -8,12 +8,17 @@
 
 #include <ProfilerSystemComponent.h>
 
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Metrics/PerfettoTraceEventLogger.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <AzCore/Serialization/Json/JsonSerializationSettings.h>
 #include <AzCore/Serialization/Json/JsonUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/time.h>
 
 namespace Profiler
 {
@@ -51,16 +56,40 @@ namespace Profiler
         int m_framesLeft{ 0 };
     };
 
-    bool SerializeCpuProfilingData(const AZStd::ring_buffer<TimeRegionMap>& data, AZStd::string outputFilePath, bool wasEnabled)
+    AZ::Outcome<void, AZStd::string> SaveCpuProfilingStatistics(const AZStd::ring_buffer<TimeRegionMap>& data, const AZStd::string& outputFilePath)
     {
-        AZ_TracePrintf("ProfilerSystemComponent", "Beginning serialization of %zu frames of profiling data\n", data.size());
         AZ::JsonSerializerSettings serializationSettings;
         serializationSettings.m_keepDefaults = true;
 
         CpuProfilingStatisticsSerializer serializer(data);
 
-        const auto saveResult = AZ::JsonSerializationUtils::SaveObjectToFile(&serializer,
+        return AZ::JsonSerializationUtils::SaveObjectToFile(&serializer,
             outputFilePath, (CpuProfilingStatisticsSerializer*)nullptr, &serializationSettings);
+    }
+
+    AZ::Outcome<void, AZStd::string> SavePerfettoTrace(const AZStd::ring_buffer<TimeRegionMap>& data, const AZStd::string& outputFilePath)
+    {
+        auto stream = AZStd::make_unique<AZ::IO::SystemFileStream>(
+            outputFilePath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeCreatePath);
+        if (!stream->IsOpen())
+        {
+            return AZ::Failure(AZStd::string("Unable to open the file for writing"));
+        }
+
+        AZ::Metrics::PerfettoTraceEventLogger eventLogger(AZStd::move(stream), "CpuProfiler");
+        RecordCpuProfilingData(eventLogger, data);
+        eventLogger.Flush();
+        return AZ::Success();
+    }
+
+    bool SerializeCpuProfilingData(const AZStd::ring_buffer<TimeRegionMap>& data, AZStd::string outputFilePath, bool wasEnabled)
+    {
+        AZ_TracePrintf("ProfilerSystemComponent", "Beginning serialization of %zu frames of profiling data\n", data.size());
+        // Captures with the .pftrace extension are written in the binary Perfetto trace format, the others in the json format
+        // of the CpuProfilingStatisticsSerializer
+        const auto saveResult = AZ::IO::PathView(outputFilePath).Extension() == ".pftrace"
+            ? SavePerfettoTrace(data, outputFilePath)
+            : SaveCpuProfilingStatistics(data, outputFilePath);
 
         AZStd::string captureInfo = outputFilePath;
         if (!saveResult.IsSuccess())
@@ -224,9 +253,64 @@ namespace Profiler
             return false;
         }
 
+        SerializeOnIoThread(AZStd::move(captureResult), m_captureFile);
+        return true;
+    }
+
+    bool ProfilerSystemComponent::IsCaptureInProgress() const
+    {
+        return m_cpuProfiler.IsContinuousCaptureInProgress();
+    }
+
+    void ProfilerSystemComponent::DumpFlightRecorder(const AZ::ConsoleCommandContainer& arguments)
+    {
+        SaveFlightRecorderData(arguments.empty() ? AZStd::string() : AZStd::string(arguments.front()));
+    }
+
+    bool ProfilerSystemComponent::SaveFlightRecorderData(const AZStd::string& outputFilePath)
+    {
+        if (!m_cpuProfiler.IsFlightRecorderEnabled())
+        {
+            AZ_Warning("ProfilerSystemComponent", false, "Cannot dump the flight recorder, it's disabled. Enable it with profiler_flightRecorder.");
+            return false;
+        }
+
+        bool expected = false;
+        if (!m_cpuDataSerializationInProgress.compare_exchange_strong(expected, true))
+        {
+            AZ_TracePrintf(
+                "ProfilerSystemComponent",
+                "Cannot dump the flight recorder - another serialization is currently in progress\n");
+            return false;
+        }
+
+        AZStd::string filePath = outputFilePath;
+        if (filePath.empty())
+        {
+            const AZ::IO::FixedMaxPathString captureOutput = AZ::Debug::GetProfilerCaptureLocation();
+            filePath = AZStd::string::format("%s/cpu_flightrecorder_%lld.json", captureOutput.c_str(), AZStd::GetTimeNowSecond());
+        }
+
+        if (AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance())
+        {
+            AZ::IO::FixedMaxPath resolvedPath;
+            if (fileIO->ResolvePath(resolvedPath, filePath))
+            {
+                filePath = resolvedPath.c_str();
+            }
+        }
+
+        AZStd::ring_buffer<TimeRegionMap> flightRecorderData;
+        m_cpuProfiler.CollectFlightRecorderData(flightRecorderData);
+        SerializeOnIoThread(AZStd::move(flightRecorderData), AZStd::move(filePath));
+        return true;
+    }
+
+    void ProfilerSystemComponent::SerializeOnIoThread(AZStd::ring_buffer<TimeRegionMap>&& data, AZStd::string outputFilePath)
+    {
         // cpuProfilingData could be 1GB+ once saved, so use an IO thread to write it to disk.
         auto threadIoFunction =
-            [data = AZStd::move(captureResult), filePath = m_captureFile, &flag = m_cpuDataSerializationInProgress]()
+            [data = AZStd::move(data), filePath = AZStd::move(outputFilePath), &flag = m_cpuDataSerializationInProgress]()
             {
                 SerializeCpuProfilingData(data, filePath, true);
                 flag.store(false);
@@ -241,12 +325,5 @@ namespace Profiler
 
         auto thread = AZStd::thread(threadIoFunction);
         m_cpuDataSerializationThread = AZStd::move(thread);
-
-        return true;
-    }
-
-    bool ProfilerSystemComponent::IsCaptureInProgress() const
-    {
-        return m_cpuProfiler.IsContinuousCaptureInProgress();
     }
 } // namespace Profiler
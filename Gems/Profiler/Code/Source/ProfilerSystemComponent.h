@@ -11,6 +11,7 @@
 #include <CpuProfiler.h>
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/ProfilerBus.h>
 #include <AzCore/std/parallel/thread.h>
 
@@ -46,6 +47,15 @@ namespace Profiler
         bool EndCapture() override;
         bool IsCaptureInProgress() const override;
 
+        //! Saves the regions kept by the flight recorder, to the path given as argument or to a new file in the capture location.
+        void DumpFlightRecorder(const AZ::ConsoleCommandContainer& arguments);
+        AZ_CONSOLEFUNC(ProfilerSystemComponent, DumpFlightRecorder, AZ::ConsoleFunctorFlags::DontReplicate,
+            "Saves the profiling data of the last profiler_flightRecorderSeconds kept by the flight recorder. Takes an optional output file path.");
+
+        bool SaveFlightRecorderData(const AZStd::string& outputFilePath);
+
+        // Serializes the data on m_cpuDataSerializationThread, the caller must have set m_cpuDataSerializationInProgress
+        void SerializeOnIoThread(AZStd::ring_buffer<TimeRegionMap>&& data, AZStd::string outputFilePath);
 
         AZStd::thread m_cpuDataSerializationThread;
         AZStd::atomic_bool m_cpuDataSerializationInProgress{ false };
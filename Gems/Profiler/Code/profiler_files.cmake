@@ -10,6 +10,8 @@ set(FILES
     Include/Profiler/ProfilerImGuiBus.h
     Source/CpuProfiler.h
     Source/CpuProfiler.cpp
+    Source/HitchDetectorSystemComponent.cpp
+    Source/HitchDetectorSystemComponent.h
     Source/ProfilerSystemComponent.cpp
     Source/ProfilerSystemComponent.h
 )
@@ -38,6 +38,15 @@ namespace RecastNavigation
         //! @param toWorldPosition The end point of the path to find.
         //! @return If a path is found, returns a vector of waypoints. An empty vector is returned if a path was not found.
         virtual AZStd::vector<AZ::Vector3> FindPathBetweenPositions(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) = 0;
+
+        //! Blocking call that finds walkable paths for a batch of start and end positions.
+        //! Large batches are split over tasks that run in parallel, each with its own navigation query object,
+        //! while the navigation mesh is locked once for the whole batch.
+        //! @param fromWorldPositions The starting points of the paths.
+        //! @param toWorldPositions The end points of the paths, one for each starting point.
+        //! @return A path for each pair of positions, in the same order. A path is empty if it was not found.
+        virtual AZStd::vector<AZStd::vector<AZ::Vector3>> FindPathsBetweenPositions(
+            const AZStd::vector<AZ::Vector3>& fromWorldPositions, const AZStd::vector<AZ::Vector3>& toWorldPositions) = 0;
     };
 
     //! Request EBus for a path finding component.
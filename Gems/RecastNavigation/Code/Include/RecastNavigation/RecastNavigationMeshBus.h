@@ -10,6 +10,7 @@
 
 #include <DetourNavMesh.h>
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/Math/Aabb.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <RecastNavigation/NavMeshQuery.h>
 #include <RecastNavigation/RecastSmartPointer.h>
@@ -29,6 +30,12 @@ namespace RecastNavigation
         //! @returns false if another update operation is already in progress
         virtual bool UpdateNavigationMeshAsync() = 0;
 
+        //! Re-calculates only the tiles of the navigation mesh that overlap the given volume. Notifies when completed using @RecastNavigationMeshNotificationBus.
+        //! If another update operation is in progress, the volume is remembered and its tiles are re-calculated once that update has finished.
+        //! @param dirtyVolume the world space volume that has changed, for example the bounds of a collider that was added, moved or removed.
+        //! @returns false if the update could not be scheduled
+        virtual bool UpdateNavigationMeshWithinVolumeAsync(const AZ::Aabb& dirtyVolume) = 0;
+
         //! @returns the underlying navigation objects with the associated synchronization object.
         virtual AZStd::shared_ptr<NavMeshQuery> GetNavigationObject() = 0;
     };
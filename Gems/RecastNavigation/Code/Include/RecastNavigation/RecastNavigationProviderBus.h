@@ -34,6 +34,16 @@ namespace RecastNavigation
         virtual bool CollectGeometryAsync(float tileSize, float borderSize,
             AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) = 0;
 
+        //! Variant of @CollectGeometryAsync that only collects the geometry of the tiles that overlap @updateVolume.
+        //! The tiles keep the coordinates they have when collecting the whole area, so that they can replace the existing tiles.
+        //! @param tileSize A navigation mesh is made up of tiles. Each tile is a square of the same size.
+        //! @param borderSize An additional extent in each dimension around each tile. A tile is collected if this border overlaps @updateVolume.
+        //! @param updateVolume The world space volume that has changed, for example the bounds of a collider that was added, moved or removed.
+        //! @param tileCallback will be called once for each tile with geometry data and one last time to indicate the end of the operation with an empty shared_ptr
+        //! @returns true if an async operation was scheduled, false otherwise
+        virtual bool CollectGeometryWithinVolumeAsync(float tileSize, float borderSize, const AZ::Aabb& updateVolume,
+            AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback) = 0;
+
         //! A navigation mesh is made up of tiles. Each tile is a square of the same size.
         //! @param tileSize size of square tiles that make up a navigation mesh.
         //! @returns number of tiles that would be necessary to the cover the required area provided by @GetWorldBounds.
@@ -7,14 +7,20 @@
  */
 
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <Components/DetourNavigationComponent.h>
 #include <RecastNavigation/RecastHelpers.h>
 #include <RecastNavigation/RecastNavigationMeshBus.h>
 
 AZ_DECLARE_BUDGET(Navigation);
 
+AZ_CVAR(
+    AZ::u32, bg_navmesh_pathBatchSize, 16, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Number of paths each task finds when finding a batch of paths. Smaller batches are found on the calling thread.");
+
 namespace RecastNavigation
 {
     DetourNavigationComponent::DetourNavigationComponent(AZ::EntityId navQueryEntityId, float nearestDistance)
@@ -62,6 +68,78 @@ namespace RecastNavigation
         return {};
     }
 
+    namespace
+    {
+        //! The size of the node pool of the navigation query objects used by the path finding tasks.
+        constexpr int MaxQueryNodes = 2048;
+
+        AZStd::vector<AZ::Vector3> FindPath(dtNavMeshQuery* navQuery,
+            const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition, float nearestDistance)
+        {
+            RecastVector3 startRecast = RecastVector3::CreateFromVector3SwapYZ(fromWorldPosition);
+            RecastVector3 endRecast = RecastVector3::CreateFromVector3SwapYZ(toWorldPosition);
+            const float halfExtents[3] = { nearestDistance, nearestDistance, nearestDistance };
+
+            dtPolyRef startPoly = 0, endPoly = 0;
+
+            RecastVector3 nearestStartPoint, nearestEndPoint;
+
+            const dtQueryFilter filter;
+
+            // Find nearest points on the navigation mesh given the positions provided.
+            // We are allowing some flexibility where looking for a point just a bit outside of the navigation mesh would still work.
+            dtStatus result = navQuery->findNearestPoly(startRecast.GetData(), halfExtents, &filter, &startPoly, nearestStartPoint.GetData());
+            if (dtStatusFailed(result) || startPoly == 0)
+            {
+                return {};
+            }
+
+            result = navQuery->findNearestPoly(endRecast.GetData(), halfExtents, &filter, &endPoly, nearestEndPoint.GetData());
+            if (dtStatusFailed(result) || endPoly == 0)
+            {
+                return {};
+            }
+
+            // Some reasonable amount of waypoints along the path. Recast isn't made to calculate very long paths.
+            constexpr int MaxPathLength = 100;
+
+            AZStd::array<dtPolyRef, MaxPathLength> path;
+            int pathLength = 0;
+
+            // Find an approximate path first. In Recast, an approximate path is a collection of polygons, where a polygon covers an area.
+            result = navQuery->findPath(startPoly, endPoly, nearestStartPoint.GetData(), nearestEndPoint.GetData(),
+                &filter, path.data(), &pathLength, MaxPathLength);
+            if (dtStatusFailed(result))
+            {
+                return {};
+            }
+
+            AZStd::array<RecastVector3, MaxPathLength> detailedPath;
+            AZStd::array<AZ::u8, MaxPathLength> detailedPathFlags;
+            AZStd::array<dtPolyRef, MaxPathLength> detailedPolyPathRefs;
+            int detailedPathCount = 0;
+
+            // Then the detailed path. This gives us actual specific waypoints along the path over the polygons found earlier.
+            result = navQuery->findStraightPath(startRecast.GetData(), endRecast.GetData(), path.data(), pathLength,
+                detailedPath[0].GetData(), detailedPathFlags.data(), detailedPolyPathRefs.data(),
+                &detailedPathCount, MaxPathLength, DT_STRAIGHTPATH_ALL_CROSSINGS);
+            if (dtStatusFailed(result))
+            {
+                return {};
+            }
+
+            AZStd::vector<AZ::Vector3> pathPoints;
+            pathPoints.reserve(detailedPathCount);
+            // Note: Recast uses +Y, O3DE used +Z as up vectors.
+            for (int i = 0; i < detailedPathCount; ++i)
+            {
+                pathPoints.push_back(detailedPath[i].AsVector3WithZup());
+            }
+
+            return pathPoints;
+        }
+    } // namespace
+
     AZStd::vector<AZ::Vector3> DetourNavigationComponent::FindPathBetweenPositions(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition)
     {
         AZ_PROFILE_SCOPE(Navigation, "Navigation: FindPathBetweenPositions");
@@ -79,67 +157,92 @@ namespace RecastNavigation
             return {};
         }
 
-        RecastVector3 startRecast = RecastVector3::CreateFromVector3SwapYZ(fromWorldPosition);
-        RecastVector3 endRecast = RecastVector3::CreateFromVector3SwapYZ(toWorldPosition);
-        const float halfExtents[3] = { m_nearestDistance, m_nearestDistance, m_nearestDistance };
-
-        dtPolyRef startPoly = 0, endPoly = 0;
-
-        RecastVector3 nearestStartPoint, nearestEndPoint;
+        return FindPath(lock.GetNavQuery(), fromWorldPosition, toWorldPosition, m_nearestDistance);
+    }
 
-        const dtQueryFilter filter;
+    AZStd::vector<AZStd::vector<AZ::Vector3>> DetourNavigationComponent::FindPathsBetweenPositions(
+        const AZStd::vector<AZ::Vector3>& fromWorldPositions, const AZStd::vector<AZ::Vector3>& toWorldPositions)
+    {
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: FindPathsBetweenPositions");
 
-        // Find nearest points on the navigation mesh given the positions provided.
-        // We are allowing some flexibility where looking for a point just a bit outside of the navigation mesh would still work.
-        dtStatus result = lock.GetNavQuery()->findNearestPoly(startRecast.GetData(), halfExtents, &filter, &startPoly, nearestStartPoint.GetData());
-        if (dtStatusFailed(result) || startPoly == 0)
+        if (fromWorldPositions.size() != toWorldPositions.size())
         {
+            AZ_Error("Navigation", false, "FindPathsBetweenPositions requires an end position (%zu given) for each start position (%zu given).",
+                toWorldPositions.size(), fromWorldPositions.size());
             return {};
         }
 
-        result = lock.GetNavQuery()->findNearestPoly(endRecast.GetData(), halfExtents, &filter, &endPoly, nearestEndPoint.GetData());
-        if (dtStatusFailed(result) || endPoly == 0)
+        const size_t numPaths = fromWorldPositions.size();
+        AZStd::vector<AZStd::vector<AZ::Vector3>> paths(numPaths);
+
+        AZStd::shared_ptr<NavMeshQuery> navMeshQuery;
+        RecastNavigationMeshRequestBus::EventResult(navMeshQuery, m_navQueryEntityId, &RecastNavigationMeshRequests::GetNavigationObject);
+        if (!navMeshQuery)
         {
-            return {};
+            return paths;
         }
 
-        // Some reasonable amount of waypoints along the path. Recast isn't made to calculate very long paths.
-        constexpr int MaxPathLength = 100;
-
-        AZStd::array<dtPolyRef, MaxPathLength> path;
-        int pathLength = 0;
+        // The navigation mesh stays locked for the whole batch, so that it isn't modified while the tasks read from it.
+        NavMeshQuery::LockGuard lock(*navMeshQuery);
+        if (!lock.GetNavMesh() || !lock.GetNavQuery())
+        {
+            return paths;
+        }
 
-        // Find an approximate path first. In Recast, an approximate path is a collection of polygons, where a polygon covers an area.
-        result = lock.GetNavQuery()->findPath(startPoly, endPoly, nearestStartPoint.GetData(), nearestEndPoint.GetData(),
-            &filter, path.data(), &pathLength, MaxPathLength);
-        if (dtStatusFailed(result))
+        const size_t batchSize = AZStd::max<size_t>(bg_navmesh_pathBatchSize, 1);
+        if (numPaths <= batchSize)
         {
-            return {};
+            for (size_t i = 0; i < numPaths; ++i)
+            {
+                paths[i] = FindPath(lock.GetNavQuery(), fromWorldPositions[i], toWorldPositions[i], m_nearestDistance);
+            }
+            return paths;
         }
 
-        AZStd::array<RecastVector3, MaxPathLength> detailedPath;
-        AZStd::array<AZ::u8, MaxPathLength> detailedPathFlags;
-        AZStd::array<dtPolyRef, MaxPathLength> detailedPolyPathRefs;
-        int detailedPathCount = 0;
+        const size_t numTasks = (numPaths + batchSize - 1) / batchSize;
+        if (m_taskQueries.size() < numTasks)
+        {
+            m_taskQueries.resize(numTasks);
+        }
 
-        // Then the detailed path. This gives us actual specific waypoints along the path over the polygons found earlier.
-        result = lock.GetNavQuery()->findStraightPath(startRecast.GetData(), endRecast.GetData(), path.data(), pathLength,
-            detailedPath[0].GetData(), detailedPathFlags.data(), detailedPolyPathRefs.data(),
-            &detailedPathCount, MaxPathLength, DT_STRAIGHTPATH_ALL_CROSSINGS);
-        if (dtStatusFailed(result))
+        for (size_t taskIndex = 0; taskIndex < numTasks; ++taskIndex)
         {
-            return {};
+            RecastPointer<dtNavMeshQuery>& taskQuery = m_taskQueries[taskIndex];
+            if (!taskQuery)
+            {
+                taskQuery.reset(dtAllocNavMeshQuery());
+            }
+
+            // Initializing a query object again only clears its node pool, unless the node pool has to grow.
+            if (!taskQuery || dtStatusFailed(taskQuery->init(lock.GetNavMesh(), MaxQueryNodes)))
+            {
+                AZ_Error("Navigation", false, "Could not init Detour navmesh query for finding paths in parallel");
+                return paths;
+            }
         }
 
-        AZStd::vector<AZ::Vector3> pathPoints;
-        pathPoints.reserve(detailedPathCount);
-        // Note: Recast uses +Y, O3DE used +Z as up vectors.
-        for (int i = 0; i < detailedPathCount; ++i)
+        AZ::TaskGraph taskGraph{ "Navigation FindPaths" };
+        const AZ::TaskDescriptor taskDescriptor{ "Find Paths", "Recast Navigation" };
+        for (size_t taskIndex = 0; taskIndex < numTasks; ++taskIndex)
         {
-            pathPoints.push_back(detailedPath[i].AsVector3WithZup());
+            dtNavMeshQuery* taskQuery = m_taskQueries[taskIndex].get();
+            const size_t begin = taskIndex * batchSize;
+            const size_t end = AZStd::min(begin + batchSize, numPaths);
+            taskGraph.AddTask(taskDescriptor, [this, taskQuery, begin, end, &fromWorldPositions, &toWorldPositions, &paths]()
+                {
+                    AZ_PROFILE_SCOPE(Navigation, "Navigation: task - finding paths");
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        paths[i] = FindPath(taskQuery, fromWorldPositions[i], toWorldPositions[i], m_nearestDistance);
+                    }
+                });
         }
 
-        return pathPoints;
+        AZ::TaskGraphEvent finishedEvent{ "Navigation FindPaths Wait" };
+        taskGraph.Submit(&finishedEvent);
+        finishedEvent.Wait();
+
+        return paths;
     }
 
     void DetourNavigationComponent::SetNavigationMeshEntity(AZ::EntityId navMeshEntity)
@@ -10,6 +10,7 @@
 
 #include <AzCore/Component/Component.h>
 #include <RecastNavigation/DetourNavigationBus.h>
+#include <RecastNavigation/RecastSmartPointer.h>
 
 namespace RecastNavigation
 {
@@ -34,6 +35,8 @@ namespace RecastNavigation
         //! @{
         AZStd::vector<AZ::Vector3> FindPathBetweenEntities(AZ::EntityId fromEntity, AZ::EntityId toEntity) override;
         AZStd::vector<AZ::Vector3> FindPathBetweenPositions(const AZ::Vector3& fromWorldPosition, const AZ::Vector3& toWorldPosition) override;
+        AZStd::vector<AZStd::vector<AZ::Vector3>> FindPathsBetweenPositions(
+            const AZStd::vector<AZ::Vector3>& fromWorldPositions, const AZStd::vector<AZ::Vector3>& toWorldPositions) override;
         void SetNavigationMeshEntity(AZ::EntityId navMeshEntity) override;
         AZ::EntityId GetNavigationMeshEntity() const override;
         //! @}
@@ -49,5 +52,7 @@ namespace RecastNavigation
         AZ::EntityId m_navQueryEntityId;
         //! Distance to use when finding nearest point on the navigation mesh when points provided to FindPath are outside of the navigation mesh.
         float m_nearestDistance = 3.f;
+        //! Navigation query objects for the tasks of @FindPathsBetweenPositions, as each query object keeps the state of its own search.
+        AZStd::vector<RecastPointer<dtNavMeshQuery>> m_taskQueries;
     };
 } // namespace RecastNavigation
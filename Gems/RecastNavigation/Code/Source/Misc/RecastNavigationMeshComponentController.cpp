@@ -141,6 +141,40 @@ namespace RecastNavigation
         return false;
     }
 
+    bool RecastNavigationMeshComponentController::UpdateNavigationMeshWithinVolumeAsync(const AZ::Aabb& dirtyVolume)
+    {
+        if (!dirtyVolume.IsValid())
+        {
+            return false;
+        }
+
+        bool notInProgress = false;
+        if (!m_updateInProgress.compare_exchange_strong(notInProgress, true))
+        {
+            // Re-calculate the tiles of this volume once the ongoing update has finished.
+            m_pendingDirtyVolume.AddAabb(dirtyVolume);
+            return true;
+        }
+
+        AZ_PROFILE_SCOPE(Navigation, "Navigation: UpdateNavigationMeshWithinVolumeAsync");
+
+        bool operationScheduled = false;
+        RecastNavigationProviderRequestBus::EventResult(operationScheduled, m_entityComponentIdPair.GetEntityId(),
+            &RecastNavigationProviderRequests::CollectGeometryWithinVolumeAsync,
+            m_configuration.m_tileSize, aznumeric_cast<float>(m_configuration.m_borderSize) * m_configuration.m_cellSize, dirtyVolume,
+            [this](AZStd::shared_ptr<TileGeometry> tile)
+            {
+                OnTileProcessedEvent(tile);
+            });
+
+        if (!operationScheduled)
+        {
+            m_updateInProgress = false;
+            return false;
+        }
+        return true;
+    }
+
     AZStd::shared_ptr<NavMeshQuery> RecastNavigationMeshComponentController::GetNavigationObject()
     {
         return m_navObject;
@@ -182,6 +216,7 @@ namespace RecastNavigation
         m_navObject.reset();
         m_taskGraphEvent.reset();
         m_updateInProgress = false;
+        m_pendingDirtyVolume = AZ::Aabb::CreateNull();
 
         RecastNavigationMeshRequestBus::Handler::BusDisconnect();
     }
@@ -203,6 +238,13 @@ namespace RecastNavigation
             RecastNavigationMeshNotificationBus::Event(m_entityComponentIdPair.GetEntityId(),
                 &RecastNavigationMeshNotifications::OnNavigationMeshUpdated, m_entityComponentIdPair.GetEntityId());
             m_updateInProgress = false;
+
+            if (m_pendingDirtyVolume.IsValid())
+            {
+                const AZ::Aabb dirtyVolume = m_pendingDirtyVolume;
+                m_pendingDirtyVolume = AZ::Aabb::CreateNull();
+                UpdateNavigationMeshWithinVolumeAsync(dirtyVolume);
+            }
         }
     }
 
@@ -72,6 +72,7 @@ namespace RecastNavigation
         //! @{
         bool UpdateNavigationMeshBlockUntilCompleted() override;
         bool UpdateNavigationMeshAsync() override;
+        bool UpdateNavigationMeshWithinVolumeAsync(const AZ::Aabb& dirtyVolume) override;
         AZStd::shared_ptr<NavMeshQuery> GetNavigationObject() override;
         //! @}
 
@@ -126,5 +127,8 @@ namespace RecastNavigation
 
         //! If true, an update operation is in progress.
         AZStd::atomic<bool> m_updateInProgress{ false };
+
+        //! Volumes that changed while an update operation was in progress. Their tiles are re-calculated once the update has finished.
+        AZ::Aabb m_pendingDirtyVolume = AZ::Aabb::CreateNull();
     };
 } // namespace RecastNavigation
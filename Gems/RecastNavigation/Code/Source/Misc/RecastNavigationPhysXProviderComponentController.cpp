@@ -121,7 +121,17 @@ namespace RecastNavigation
         float borderSize,
         AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
     {
-        return CollectGeometryAsyncImpl(tileSize, borderSize, GetWorldBounds(), AZStd::move(tileCallback));
+        const AZ::Aabb worldBounds = GetWorldBounds();
+        return CollectGeometryAsyncImpl(tileSize, borderSize, worldBounds, worldBounds, AZStd::move(tileCallback));
+    }
+
+    bool RecastNavigationPhysXProviderComponentController::CollectGeometryWithinVolumeAsync(
+        float tileSize,
+        float borderSize,
+        const AZ::Aabb& updateVolume,
+        AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
+    {
+        return CollectGeometryAsyncImpl(tileSize, borderSize, GetWorldBounds(), updateVolume, AZStd::move(tileCallback));
     }
 
     AZ::Aabb RecastNavigationPhysXProviderComponentController::GetWorldBounds() const
@@ -358,6 +368,7 @@ namespace RecastNavigation
         float tileSize,
         float borderSize,
         const AZ::Aabb& worldVolume,
+        const AZ::Aabb& updateVolume,
         AZStd::function<void(AZStd::shared_ptr<TileGeometry>)> tileCallback)
     {
         bool notInProgress = false;
@@ -408,6 +419,12 @@ namespace RecastNavigation
 
                     AZ::Aabb tileVolume = AZ::Aabb::CreateFromMinMax(tileMin, tileMax);
                     AZ::Aabb scanVolume = AZ::Aabb::CreateFromMinMax(tileMin - border, tileMax + border);
+                    if (!scanVolume.Overlaps(updateVolume))
+                    {
+                        // The geometry of this tile, including its border, hasn't changed.
+                        continue;
+                    }
+
                     AZStd::shared_ptr<TileGeometry> geometryData = AZStd::make_unique<TileGeometry>();
                     geometryData->m_tileCallback = tileCallback;
                     geometryData->m_worldBounds = tileVolume;
@@ -531,6 +531,36 @@ namespace RecastNavigationTests
         EXPECT_GT(waypoints.size(), 0);
     }
 
+    /*
+     * Find a batch of paths, where one of the destinations is outside of the navigation mesh.
+     */
+    TEST_F(NavigationTest, FindPathsTest)
+    {
+        Entity e;
+        PopulateEntity(e);
+        e.CreateComponent<DetourNavigationComponent>(e.GetId(), 3.f);
+        ActivateEntity(e);
+        SetupNavigationMesh();
+
+        ON_CALL(*m_mockPhysicsShape.get(), GetGeometry(_, _, _)).WillByDefault(Invoke([this]
+        (AZStd::vector<AZ::Vector3>& vertices, AZStd::vector<AZ::u32>& indices, const AZ::Aabb*)
+            {
+                AddTestGeometry(vertices, indices, true);
+            }));
+
+        RecastNavigationMeshRequestBus::Event(e.GetId(), &RecastNavigationMeshRequests::UpdateNavigationMeshBlockUntilCompleted);
+
+        const AZStd::vector<AZ::Vector3> from = { AZ::Vector3(0.f, 0, 0), AZ::Vector3(2.f, 2, 0) };
+        const AZStd::vector<AZ::Vector3> to = { AZ::Vector3(2.f, 2, 0), AZ::Vector3(2000.f, 2000, 0) };
+
+        AZStd::vector<AZStd::vector<AZ::Vector3>> paths;
+        DetourNavigationRequestBus::EventResult(paths, AZ::EntityId(1), &DetourNavigationRequests::FindPathsBetweenPositions, from, to);
+
+        ASSERT_EQ(paths.size(), 2);
+        EXPECT_GT(paths[0].size(), 0);
+        EXPECT_EQ(paths[1].size(), 0);
+    }
+
     /*
      * Test with one of the point being way outside of the range of the navigation mesh.
      */
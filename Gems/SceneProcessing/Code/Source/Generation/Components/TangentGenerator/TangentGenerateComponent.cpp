@@ -27,6 +27,8 @@
 #include <SceneAPI/SceneData/GraphData/MeshVertexBitangentData.h>
 #include <SceneAPI/SceneData/GraphData/MeshVertexTangentData.h>
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/Vector4.h>
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -116,7 +118,7 @@ namespace AZ::SceneGenerationComponents
         AZ::SceneAPI::Containers::SceneGraph::ContentStorageData graphContent = graph.GetContentStorage();
 
         // Build a list of mesh data nodes.
-        AZStd::vector<AZStd::pair<AZ::SceneAPI::DataTypes::IMeshData*, AZ::SceneAPI::Containers::SceneGraph::NodeIndex> > meshes;
+        AZStd::vector<MeshTangentWork> meshWork;
         for (auto item = graphContent.begin(); item != graphContent.end(); ++item)
         {
             // Skip anything that isn't a mesh.
@@ -125,31 +127,51 @@ namespace AZ::SceneGenerationComponents
                 continue;
             }
 
-            // Get the mesh data and node index and store them in the vector as a pair, so we can iterate over them later.
-            auto* mesh = static_cast<AZ::SceneAPI::DataTypes::IMeshData*>(item->get());
-            AZ::SceneAPI::Containers::SceneGraph::NodeIndex nodeIndex = graph.ConvertToNodeIndex(item);
-            meshes.emplace_back(mesh, nodeIndex);
+            // Get the mesh data and node index and store them, so we can iterate over them later.
+            MeshTangentWork& work = meshWork.emplace_back();
+            work.m_meshData = static_cast<AZ::SceneAPI::DataTypes::IMeshData*>(item->get());
+            work.m_nodeIndex = graph.ConvertToNodeIndex(item);
         }
 
-        // Iterate over them. We had to build the array before as this method can insert new nodes, so using the iterator directly would fail.
-        for (auto& [mesh, nodeIndex] : meshes)
+        // Add the tangent layers first. We had to build the array before as this inserts new nodes, so using the iterator directly would fail.
+        for (MeshTangentWork& work : meshWork)
         {
-            // Generate tangents for the mesh (if this is desired or needed).
-            if (!GenerateTangentsForMesh(context.GetScene(), nodeIndex, mesh, generationMethod))
+            if (!PrepareTangentsForMesh(context.GetScene(), generationMethod, work))
             {
                 return AZ::SceneAPI::Events::ProcessingResult::Failure;
             }
+        }
 
-            // Now that we have the tangents and bitangents, calculate the tangent w values for the ones that we imported from the scene file, as they only have xyz.
-            // But only do this if we are getting tangents from the source scene, because MikkT will provide us with a correct tangent.w already
-            if (generationMethod == SceneAPI::DataTypes::TangentGenerationMethod::FromSourceScene)
+        // The graph isn't modified anymore, so the meshes of large scenes are processed in parallel.
+        AZ::JobCompletion jobCompletion;
+        for (MeshTangentWork& work : meshWork)
+        {
+            AZ::Job* job = AZ::CreateJobFunction([this, &graph, &work, generationMethod, debugBitangentFlip]()
             {
-                if (!UpdateFbxTangentWValues(graph, nodeIndex, mesh, debugBitangentFlip))
+                AZ_PROFILE_SCOPE(Animation, "TangentGenerateComponent::GenerateTangentData::MeshJob");
+
+                // Generate tangents for the mesh (if this is desired or needed).
+                work.m_success = GenerateTangentsForMesh(work);
+
+                // Now that we have the tangents and bitangents, calculate the tangent w values for the ones that we imported from the scene file, as they only have xyz.
+                // But only do this if we are getting tangents from the source scene, because MikkT will provide us with a correct tangent.w already
+                if (work.m_success && generationMethod == SceneAPI::DataTypes::TangentGenerationMethod::FromSourceScene)
                 {
-                    return AZ::SceneAPI::Events::ProcessingResult::Failure;
+                    work.m_success = UpdateFbxTangentWValues(graph, work.m_nodeIndex, work.m_meshData, debugBitangentFlip);
                 }
+            }, true, nullptr);
+
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+
+        for (const MeshTangentWork& work : meshWork)
+        {
+            if (!work.m_success)
+            {
+                return AZ::SceneAPI::Events::ProcessingResult::Failure;
             }
-            
         }
 
         return AZ::SceneAPI::Events::ProcessingResult::Success;
@@ -250,13 +272,14 @@ namespace AZ::SceneGenerationComponents
         }
     }
 
-    bool TangentGenerateComponent::GenerateTangentsForMesh(
+    bool TangentGenerateComponent::PrepareTangentsForMesh(
         AZ::SceneAPI::Containers::Scene& scene,
-        const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
-        AZ::SceneAPI::DataTypes::IMeshData* meshData,
-        AZ::SceneAPI::DataTypes::TangentGenerationMethod ruleGenerationMethod)
+        AZ::SceneAPI::DataTypes::TangentGenerationMethod ruleGenerationMethod,
+        MeshTangentWork& work)
     {
         AZ::SceneAPI::Containers::SceneGraph& graph = scene.GetGraph();
+        const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex = work.m_nodeIndex;
+        AZ::SceneAPI::DataTypes::IMeshData* meshData = work.m_meshData;
 
         // Check if we have any UV data, if not, we cannot possibly generate the tangents.
         const size_t uvSetCount = CalcUvSetCount(graph, nodeIndex);
@@ -269,8 +292,7 @@ namespace AZ::SceneGenerationComponents
         const AZ::SceneAPI::SceneData::TangentsRule* tangentsRule = GetTangentRule(scene);
 
         // Find all blend shape data under the mesh. We need to generate the tangent and bitangent for blend shape as well.
-        AZStd::vector<AZ::SceneData::GraphData::BlendShapeData*> blendShapes;
-        FindBlendShapes(graph, nodeIndex, blendShapes);
+        FindBlendShapes(graph, nodeIndex, work.m_blendShapes);
 
         // Generate tangents/bitangents for all uv sets.
         bool allSuccess = true;
@@ -338,14 +360,13 @@ namespace AZ::SceneGenerationComponents
             // Generate using MikkT space.
             case AZ::SceneAPI::DataTypes::TangentGenerationMethod::MikkT:
             {
-                const AZ::SceneAPI::DataTypes::MikkTSpaceMethod tSpaceMethod = tangentsRule ? tangentsRule->GetMikkTSpaceMethod() : AZ::SceneAPI::DataTypes::MikkTSpaceMethod::TSpace;
-
-                allSuccess &= AZ::TangentGeneration::Mesh::MikkT::GenerateTangents(meshData, uvData, tangentData, bitangentData, tSpaceMethod);
-
-                for (AZ::SceneData::GraphData::BlendShapeData* blendShape : blendShapes)
-                {
-                    allSuccess &= AZ::TangentGeneration::BlendShape::MikkT::GenerateTangents(blendShape, uvSetIndex, tSpaceMethod);
-                }
+                TangentGenerationTask& task = work.m_tasks.emplace_back();
+                task.m_meshData = meshData;
+                task.m_uvData = uvData;
+                task.m_tangentData = tangentData;
+                task.m_bitangentData = bitangentData;
+                task.m_uvSetIndex = uvSetIndex;
+                task.m_tSpaceMethod = tangentsRule ? tangentsRule->GetMikkTSpaceMethod() : AZ::SceneAPI::DataTypes::MikkTSpaceMethod::TSpace;
             }
             break;
 
@@ -360,6 +381,22 @@ namespace AZ::SceneGenerationComponents
         return allSuccess;
     }
 
+    bool TangentGenerateComponent::GenerateTangentsForMesh(const MeshTangentWork& work)
+    {
+        bool allSuccess = true;
+        for (const TangentGenerationTask& task : work.m_tasks)
+        {
+            allSuccess &= AZ::TangentGeneration::Mesh::MikkT::GenerateTangents(
+                task.m_meshData, task.m_uvData, task.m_tangentData, task.m_bitangentData, task.m_tSpaceMethod);
+
+            for (AZ::SceneData::GraphData::BlendShapeData* blendShape : work.m_blendShapes)
+            {
+                allSuccess &= AZ::TangentGeneration::BlendShape::MikkT::GenerateTangents(blendShape, task.m_uvSetIndex, task.m_tSpaceMethod);
+            }
+        }
+        return allSuccess;
+    }
+
     size_t TangentGenerateComponent::CalcUvSetCount(AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex) const
     {
         const auto nameContentView = AZ::SceneAPI::Containers::Views::MakePairView(graph.GetNameStorage(), graph.GetContentStorage());
@@ -12,6 +12,7 @@
 #include <SceneAPI/SceneCore/Containers/Scene.h>
 #include <SceneAPI/SceneData/Rules/TangentsRule.h>
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AZ::SceneAPI::DataTypes { class IMeshData; }
 namespace AZ::SceneAPI::DataTypes { class IMeshVertexUVData; }
@@ -55,14 +56,38 @@ namespace AZ::SceneGenerationComponents
         AZ::SceneAPI::Events::ProcessingResult GenerateTangentData(TangentGenerateContext& context);
 
     private:
+        //! The tangents and bitangents of one uv set of a mesh to generate with MikkT, once their layers are in the graph.
+        struct TangentGenerationTask
+        {
+            AZ::SceneAPI::DataTypes::IMeshData* m_meshData = nullptr;
+            AZ::SceneAPI::DataTypes::IMeshVertexUVData* m_uvData = nullptr;
+            AZ::SceneAPI::DataTypes::IMeshVertexTangentData* m_tangentData = nullptr;
+            AZ::SceneAPI::DataTypes::IMeshVertexBitangentData* m_bitangentData = nullptr;
+            size_t m_uvSetIndex = 0;
+            AZ::SceneAPI::DataTypes::MikkTSpaceMethod m_tSpaceMethod = AZ::SceneAPI::DataTypes::MikkTSpaceMethod::TSpace;
+        };
+
+        //! The tangent work of one mesh. The uv sets of a mesh share its blend shapes, so they are generated one after the other.
+        struct MeshTangentWork
+        {
+            AZ::SceneAPI::Containers::SceneGraph::NodeIndex m_nodeIndex;
+            AZ::SceneAPI::DataTypes::IMeshData* m_meshData = nullptr;
+            AZStd::vector<TangentGenerationTask> m_tasks;
+            AZStd::vector<AZ::SceneData::GraphData::BlendShapeData*> m_blendShapes;
+            bool m_success = true;
+        };
+
         void FindBlendShapes(
             AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
             AZStd::vector<AZ::SceneData::GraphData::BlendShapeData*>& outBlendShapes) const;
-        bool GenerateTangentsForMesh(
+        //! Adds the tangent and bitangent layers the mesh needs to the graph, and the tangents to generate for them to the work.
+        //! The graph isn't safe to modify from multiple threads, so this runs for all meshes before any tangents are generated.
+        bool PrepareTangentsForMesh(
             AZ::SceneAPI::Containers::Scene& scene,
-            const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
-            AZ::SceneAPI::DataTypes::IMeshData* meshData,
-            AZ::SceneAPI::DataTypes::TangentGenerationMethod defaultGenerationMethod);
+            AZ::SceneAPI::DataTypes::TangentGenerationMethod defaultGenerationMethod,
+            MeshTangentWork& work);
+        //! Generates the tangents of the prepared work. Only touches the data of the mesh, so meshes are processed in parallel.
+        static bool GenerateTangentsForMesh(const MeshTangentWork& work);
         bool UpdateFbxTangentWValues(
             AZ::SceneAPI::Containers::SceneGraph& graph,
             const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
@@ -0,0 +1,65 @@
+----------------------------------------------------------------------------------------------------
+--
+-- Copyright (c) Contributors to the Open 3D Engine Project.
+-- For complete copyright and license terms please see the LICENSE at the root of this distribution.
+--
+-- SPDX-License-Identifier: Apache-2.0 OR MIT
+--
+----------------------------------------------------------------------------------------------------
+-- Moves the camera through a level along the entities of the camera path, and writes the frame times,
+-- memory usage and streaming statistics recorded meanwhile to a json report. Run it from a launcher with
+--     --run-automation-suite @gemroot:ScriptAutomation@/Assets/AutomationScripts/GenericPerformanceTest.lua --exit-on-automation-end
+function GetRequiredStringValue(valueKey, prettyName)
+    value = g_SettingsRegistry:GetString(valueKey)
+    if (not value:has_value()) then
+        Print('GenericPerformanceTest script missing ' .. tostring(prettyName) .. ' settings registry entry, ending script early')
+        return false, nil
+    end
+    Print('GenericPerformanceTest script found ' .. prettyName .. ' settings registry entry, ' .. value:value())
+    return true, value:value()
+end
+
+function GetOptionalUIntValue(valueKey, defaultValue)
+    return g_SettingsRegistry:GetUInt(valueKey):value_or(defaultValue)
+end
+function GetOptionalStringValue(valueKey, defaultValue)
+    return g_SettingsRegistry:GetString(valueKey):value_or(defaultValue)
+end
+
+-- required settings
+local LevelPathRegistryKey <const> = "/O3DE/ScriptAutomation/PerformanceTest/LevelPath"
+local TestNameRegistryKey <const> = "/O3DE/ScriptAutomation/PerformanceTest/TestName" -- used as the name of the report file, no whitespace or other invalid characters
+local CameraPathEntitiesRegistryKey <const> = "/O3DE/ScriptAutomation/PerformanceTest/CameraPathEntityNames" -- comma separated names of the waypoint entities
+
+-- optional settings
+local DurationRegistryKey <const> = "/O3DE/ScriptAutomation/PerformanceTest/DurationSeconds"
+local WarmUpRegistryKey <const> = "/O3DE/ScriptAutomation/PerformanceTest/WarmUpSeconds"
+local OutputFolderRegistryKey <const> = "/O3DE/ScriptAutomation/PerformanceTest/OutputFolder"
+
+succeeded, levelPath = GetRequiredStringValue(LevelPathRegistryKey, "Level Path")
+if (not succeeded) then return end
+succeeded, testName = GetRequiredStringValue(TestNameRegistryKey, "Test Name")
+if (not succeeded) then return end
+succeeded, cameraPathEntitiesStr = GetRequiredStringValue(CameraPathEntitiesRegistryKey, "Camera Path Entity Names")
+if (not succeeded) then return end
+
+durationSeconds = GetOptionalUIntValue(DurationRegistryKey, 60)
+warmUpSeconds = GetOptionalUIntValue(WarmUpRegistryKey, 5)
+outputFolder = GetOptionalStringValue(OutputFolderRegistryKey, GetProfilingOutputPath(false))
+
+cameraPathEntities = SplitString(cameraPathEntitiesStr, ",")
+
+IdleFrames(3) -- tick 3 frames to allow tick delta to settle
+
+ExecuteConsoleCommand("r_displayInfo=0")
+LoadLevel(levelPath) -- waits for the engine to say the level is finished loading
+
+IdleSeconds(warmUpSeconds) -- Wait for the initial assets of the level to finish loading.
+
+for index=1, cameraPathEntities:Size() do
+    AddCameraPathWaypointFromEntity(cameraPathEntities[index])
+end
+
+StartPerformanceTest(testName)
+PlayCameraPath(durationSeconds) -- waits until the camera reached the end of the path
+StopPerformanceTest(outputFolder .. "/" .. testName .. "_" .. GetPlatformName() .. ".json")
@@ -16,6 +16,7 @@
 namespace AZ
 {
     class BehaviorContext;
+    class Transform;
     namespace Render
     {
         using FrameCaptureId = uint32_t;
@@ -76,6 +77,17 @@ namespace AZ::ScriptAutomation
 
         virtual void LoadLevel(const char* levelName) = 0;
 
+        //! Start recording the frame times, memory usage and streaming statistics of a performance test
+        virtual void StartPerformanceTest(const char* testName) = 0;
+
+        //! Stop the performance test and write its report as json to the output file
+        virtual void StopPerformanceTest(const char* outputFilePath) = 0;
+
+        //! Add a waypoint to the path the active camera is moved along by PlayCameraPath
+        virtual void AddCameraPathWaypoint(const AZ::Transform& waypoint) = 0;
+
+        //! Move the active camera along the camera path for the duration, and idle the script until the camera reached the end
+        virtual void PlayCameraPath(float durationSeconds) = 0;
     };
 
     class ScriptAutomationRequestsBusTraits
@@ -0,0 +1,364 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <PerformanceTest.h>
+
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/IO/IStreamer.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Process/ProcessInfo.h>
+#include <AzCore/Serialization/Json/JsonUtils.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/variant.h>
+#include <AzCore/std/optional.h>
+#include <AzCore/std/sort.h>
+
+#include <AzFramework/Components/CameraBus.h>
+
+#include <Atom/RPI.Public/Pass/ParentPass.h>
+#include <Atom/RPI.Public/Pass/PassSystemInterface.h>
+
+namespace AZ::ScriptAutomation
+{
+    namespace
+    {
+        double ToMilliseconds(AZStd::chrono::steady_clock::duration duration)
+        {
+            return AZStd::chrono::duration<double>(duration).count() * 1000.0;
+        }
+
+        // Returns the value of numeric statistics, which are the ones that can be compared between runs
+        AZStd::optional<double> GetNumericStatisticValue(const AZ::IO::Statistic::Value& value)
+        {
+            return AZStd::visit(
+                [](auto&& statistic) -> AZStd::optional<double>
+                {
+                    using T = AZStd::decay_t<decltype(statistic)>;
+                    if constexpr (AZStd::is_same_v<T, bool>)
+                    {
+                        return statistic ? 1.0 : 0.0;
+                    }
+                    else if constexpr (AZStd::is_same_v<T, double> || AZStd::is_same_v<T, AZ::s64>)
+                    {
+                        return aznumeric_cast<double>(statistic);
+                    }
+                    else if constexpr (
+                        AZStd::is_same_v<T, AZ::IO::Statistic::Time> || AZStd::is_same_v<T, AZ::IO::Statistic::TimeRange>)
+                    {
+                        return aznumeric_cast<double>(statistic.m_value.count());
+                    }
+                    else if constexpr (
+                        AZStd::is_same_v<T, AZStd::monostate> || AZStd::is_same_v<T, AZStd::string> ||
+                        AZStd::is_same_v<T, AZStd::string_view>)
+                    {
+                        return AZStd::nullopt;
+                    }
+                    else
+                    {
+                        return aznumeric_cast<double>(statistic.m_value);
+                    }
+                },
+                value);
+        }
+    } // namespace
+
+    void FrameTimeStatistics::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<FrameTimeStatistics>()
+                ->Version(0)
+                ->Field("frameCount", &FrameTimeStatistics::m_frameCount)
+                ->Field("averageMs", &FrameTimeStatistics::m_averageMs)
+                ->Field("p50Ms", &FrameTimeStatistics::m_p50Ms)
+                ->Field("p90Ms", &FrameTimeStatistics::m_p90Ms)
+                ->Field("p99Ms", &FrameTimeStatistics::m_p99Ms)
+                ->Field("maxMs", &FrameTimeStatistics::m_maxMs)
+                ;
+        }
+    }
+
+    FrameTimeStatistics CalculateFrameTimeStatistics(AZStd::vector<double> frameTimesMs)
+    {
+        FrameTimeStatistics statistics;
+        if (frameTimesMs.empty())
+        {
+            return statistics;
+        }
+
+        AZStd::sort(frameTimesMs.begin(), frameTimesMs.end());
+        auto percentile = [&frameTimesMs](double percent)
+        {
+            const auto rank = aznumeric_cast<size_t>(AZStd::ceil(percent / 100.0 * aznumeric_cast<double>(frameTimesMs.size())));
+            return frameTimesMs[AZ::GetClamp<size_t>(rank, 1, frameTimesMs.size()) - 1];
+        };
+
+        double totalMs = 0.0;
+        for (double frameTimeMs : frameTimesMs)
+        {
+            totalMs += frameTimeMs;
+        }
+
+        statistics.m_frameCount = frameTimesMs.size();
+        statistics.m_averageMs = totalMs / aznumeric_cast<double>(frameTimesMs.size());
+        statistics.m_p50Ms = percentile(50.0);
+        statistics.m_p90Ms = percentile(90.0);
+        statistics.m_p99Ms = percentile(99.0);
+        statistics.m_maxMs = frameTimesMs.back();
+        return statistics;
+    }
+
+    void PerformanceTestStatistic::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<PerformanceTestStatistic>()
+                ->Version(0)
+                ->Field("owner", &PerformanceTestStatistic::m_owner)
+                ->Field("name", &PerformanceTestStatistic::m_name)
+                ->Field("value", &PerformanceTestStatistic::m_value)
+                ;
+        }
+    }
+
+    void PerformanceTestReport::Reflect(AZ::ReflectContext* context)
+    {
+        FrameTimeStatistics::Reflect(context);
+        PerformanceTestStatistic::Reflect(context);
+
+        if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<PerformanceTestReport>()
+                ->Version(0)
+                ->Field("testName", &PerformanceTestReport::m_testName)
+                ->Field("platform", &PerformanceTestReport::m_platform)
+                ->Field("durationSeconds", &PerformanceTestReport::m_durationSeconds)
+                ->Field("cpuFrameTime", &PerformanceTestReport::m_cpuFrameTime)
+                ->Field("gpuFrameTime", &PerformanceTestReport::m_gpuFrameTime)
+                ->Field("maxWorkingSetBytes", &PerformanceTestReport::m_maxWorkingSetBytes)
+                ->Field("peakWorkingSetBytes", &PerformanceTestReport::m_peakWorkingSetBytes)
+                ->Field("peakPagefileUsageBytes", &PerformanceTestReport::m_peakPagefileUsageBytes)
+                ->Field("maxAllocatedBytes", &PerformanceTestReport::m_maxAllocatedBytes)
+                ->Field("streamerStatistics", &PerformanceTestReport::m_streamerStatistics)
+                ;
+        }
+    }
+
+    void CameraPath::AddWaypoint(const AZ::Transform& waypoint)
+    {
+        m_waypoints.push_back(waypoint);
+    }
+
+    void CameraPath::Clear()
+    {
+        m_waypoints.clear();
+    }
+
+    size_t CameraPath::GetWaypointCount() const
+    {
+        return m_waypoints.size();
+    }
+
+    AZ::Transform CameraPath::Evaluate(float normalizedTime) const
+    {
+        if (m_waypoints.empty())
+        {
+            return AZ::Transform::CreateIdentity();
+        }
+        if (m_waypoints.size() == 1)
+        {
+            return m_waypoints.front();
+        }
+
+        const float segmentTime = AZ::GetClamp(normalizedTime, 0.0f, 1.0f) * aznumeric_cast<float>(m_waypoints.size() - 1);
+        const size_t segment = AZ::GetMin(aznumeric_cast<size_t>(segmentTime), m_waypoints.size() - 2);
+        const float t = segmentTime - aznumeric_cast<float>(segment);
+
+        const AZ::Transform& from = m_waypoints[segment];
+        const AZ::Transform& to = m_waypoints[segment + 1];
+        return AZ::Transform::CreateFromQuaternionAndTranslation(
+            from.GetRotation().Slerp(to.GetRotation(), t), from.GetTranslation().Lerp(to.GetTranslation(), t));
+    }
+
+    void PerformanceTest::Start(AZStd::string_view testName)
+    {
+        AZ_Warning("ScriptAutomation", !m_running, "Performance test '%s' is restarted as '%.*s'.", m_testName.c_str(), AZ_STRING_ARG(testName));
+
+        m_testName = testName;
+        m_startTime = AZStd::chrono::steady_clock::now();
+        m_lastTickTime = m_startTime;
+        m_cpuFrameTimesMs.clear();
+        m_gpuFrameTimesMs.clear();
+        m_tickCount = 0;
+        m_maxWorkingSetBytes = 0;
+        m_maxAllocatedBytes = 0;
+        m_running = true;
+
+        SetTimestampQueryEnabled(true);
+        SampleMemory();
+    }
+
+    bool PerformanceTest::IsRunning() const
+    {
+        return m_running;
+    }
+
+    AZ::Outcome<void, AZStd::string> PerformanceTest::Stop(const AZStd::string& outputFilePath)
+    {
+        if (!m_running)
+        {
+            return AZ::Failure(AZStd::string("No performance test is running."));
+        }
+
+        SampleMemory();
+        SetTimestampQueryEnabled(false);
+        m_running = false;
+        m_playingCameraPath = false;
+
+        PerformanceTestReport report;
+        report.m_testName = m_testName;
+        report.m_platform = AZ_TRAIT_OS_PLATFORM_CODENAME_LOWER;
+        report.m_durationSeconds = ToMilliseconds(AZStd::chrono::steady_clock::now() - m_startTime) / 1000.0;
+        report.m_cpuFrameTime = CalculateFrameTimeStatistics(AZStd::move(m_cpuFrameTimesMs));
+        report.m_gpuFrameTime = CalculateFrameTimeStatistics(AZStd::move(m_gpuFrameTimesMs));
+        report.m_maxWorkingSetBytes = m_maxWorkingSetBytes;
+        report.m_maxAllocatedBytes = m_maxAllocatedBytes;
+
+        AZ::ProcessMemInfo memInfo;
+        if (AZ::QueryMemInfo(memInfo))
+        {
+            report.m_peakWorkingSetBytes = aznumeric_cast<AZ::u64>(memInfo.m_peakWorkingSet);
+            report.m_peakPagefileUsageBytes = aznumeric_cast<AZ::u64>(memInfo.m_peakPagefileUsage);
+        }
+
+        if (auto* streamer = AZ::Interface<AZ::IO::IStreamer>::Get(); streamer)
+        {
+            AZStd::vector<AZ::IO::Statistic> statistics;
+            streamer->CollectStatistics(statistics);
+            for (const AZ::IO::Statistic& statistic : statistics)
+            {
+                if (AZStd::optional<double> value = GetNumericStatisticValue(statistic.GetValue()); value.has_value())
+                {
+                    report.m_streamerStatistics.push_back({ AZStd::string(statistic.GetOwner()), AZStd::string(statistic.GetName()), *value });
+                }
+            }
+        }
+
+        m_cpuFrameTimesMs = {};
+        m_gpuFrameTimesMs = {};
+
+        AZ::JsonSerializerSettings serializationSettings;
+        serializationSettings.m_keepDefaults = true;
+        return AZ::JsonSerializationUtils::SaveObjectToFile(&report, outputFilePath, (PerformanceTestReport*)nullptr, &serializationSettings);
+    }
+
+    CameraPath& PerformanceTest::GetCameraPath()
+    {
+        return m_cameraPath;
+    }
+
+    void PerformanceTest::PlayCameraPath(float durationSeconds)
+    {
+        AZ_Warning("ScriptAutomation", m_cameraPath.GetWaypointCount() > 0, "Playing a camera path without waypoints.");
+        m_playedCameraPath = AZStd::move(m_cameraPath);
+        m_cameraPath.Clear();
+        m_cameraPathStartTime = AZStd::chrono::steady_clock::now();
+        m_cameraPathDurationSeconds = durationSeconds;
+        m_playingCameraPath = m_playedCameraPath.GetWaypointCount() > 0;
+    }
+
+    bool PerformanceTest::IsPlayingCameraPath() const
+    {
+        return m_playingCameraPath;
+    }
+
+    void PerformanceTest::OnTick()
+    {
+        const AZStd::chrono::steady_clock::time_point now = AZStd::chrono::steady_clock::now();
+
+        if (m_playingCameraPath)
+        {
+            const double elapsedSeconds = ToMilliseconds(now - m_cameraPathStartTime) / 1000.0;
+            const float normalizedTime = m_cameraPathDurationSeconds > 0.0f
+                ? aznumeric_cast<float>(elapsedSeconds / m_cameraPathDurationSeconds)
+                : 1.0f;
+
+            AZ::EntityId activeCamera;
+            Camera::CameraSystemRequestBus::BroadcastResult(activeCamera, &Camera::CameraSystemRequestBus::Events::GetActiveCamera);
+            if (activeCamera.IsValid())
+            {
+                AZ::TransformBus::Event(activeCamera, &AZ::TransformBus::Events::SetWorldTM, m_playedCameraPath.Evaluate(normalizedTime));
+            }
+            m_playingCameraPath = normalizedTime < 1.0f;
+        }
+
+        if (!m_running)
+        {
+            return;
+        }
+
+        // The first tick measures the time since the test started, which includes the remainder of the frame it started in
+        if (m_tickCount > 0)
+        {
+            m_cpuFrameTimesMs.push_back(ToMilliseconds(now - m_lastTickTime));
+        }
+        m_lastTickTime = now;
+
+        if (auto* passSystem = AZ::RPI::PassSystemInterface::Get(); passSystem && passSystem->GetRootPass())
+        {
+            const AZ::u64 gpuFrameTimeNs = passSystem->GetRootPass()->GetLatestTimestampResult().GetDurationInNanoseconds();
+            if (gpuFrameTimeNs > 0)
+            {
+                m_gpuFrameTimesMs.push_back(aznumeric_cast<double>(gpuFrameTimeNs) / 1'000'000.0);
+            }
+        }
+
+        if (++m_tickCount % MemorySampleInterval == 0)
+        {
+            SampleMemory();
+        }
+    }
+
+    void PerformanceTest::SampleMemory()
+    {
+        AZ::ProcessMemInfo memInfo;
+        if (AZ::QueryMemInfo(memInfo))
+        {
+            m_maxWorkingSetBytes = AZ::GetMax(m_maxWorkingSetBytes, aznumeric_cast<AZ::u64>(memInfo.m_workingSet));
+        }
+
+        size_t usedBytes = 0;
+        size_t reservedBytes = 0;
+        AZ::AllocatorManager::Instance().GetAllocatorStats(usedBytes, reservedBytes);
+        m_maxAllocatedBytes = AZ::GetMax(m_maxAllocatedBytes, aznumeric_cast<AZ::u64>(usedBytes));
+    }
+
+    void PerformanceTest::SetTimestampQueryEnabled(bool enabled)
+    {
+        auto* passSystem = AZ::RPI::PassSystemInterface::Get();
+        if (!passSystem || !passSystem->GetRootPass())
+        {
+            return;
+        }
+
+        // Restore the state the timestamp queries were in before the test, as the GPU profiler may have enabled them
+        const AZ::RPI::Ptr<AZ::RPI::ParentPass>& rootPass = passSystem->GetRootPass();
+        if (enabled)
+        {
+            m_timestampQueryWasEnabled = rootPass->IsTimestampQueryEnabled();
+            rootPass->SetTimestampQueryEnabled(true);
+        }
+        else
+        {
+            rootPass->SetTimestampQueryEnabled(m_timestampQueryWasEnabled);
+        }
+    }
+} // namespace AZ::ScriptAutomation
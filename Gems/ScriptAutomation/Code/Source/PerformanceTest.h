@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    class ReflectContext;
+}
+
+namespace AZ::ScriptAutomation
+{
+    //! Distribution of the frame times recorded during a performance test
+    struct FrameTimeStatistics
+    {
+        AZ_TYPE_INFO(AZ::ScriptAutomation::FrameTimeStatistics, "{2C8E6F41-7B0D-4A93-8E25-D1F6A3B7C904}")
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        AZ::u64 m_frameCount = 0;
+        double m_averageMs = 0.0;
+        double m_p50Ms = 0.0;
+        double m_p90Ms = 0.0;
+        double m_p99Ms = 0.0;
+        double m_maxMs = 0.0;
+    };
+
+    //! Calculates the statistics of the frame times, using the nearest-rank method for the percentiles
+    FrameTimeStatistics CalculateFrameTimeStatistics(AZStd::vector<double> frameTimesMs);
+
+    struct PerformanceTestStatistic
+    {
+        AZ_TYPE_INFO(AZ::ScriptAutomation::PerformanceTestStatistic, "{94A1D75B-3E6C-4F08-B2D9-58C0E7F1A26D}")
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        AZStd::string m_owner;
+        AZStd::string m_name;
+        double m_value = 0.0;
+    };
+
+    //! Report written at the end of a performance test, which is compared between nightly runs to track regressions
+    struct PerformanceTestReport
+    {
+        AZ_TYPE_INFO(AZ::ScriptAutomation::PerformanceTestReport, "{6B3F0E8A-C15D-4D72-9A4E-2F7B8D61C3E5}")
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        AZStd::string m_testName;
+        AZStd::string m_platform;
+        double m_durationSeconds = 0.0;
+        //! Wall clock time between two ticks of the main loop
+        FrameTimeStatistics m_cpuFrameTime;
+        //! Duration of the root pass on the GPU, which is empty if no render pipeline is active
+        FrameTimeStatistics m_gpuFrameTime;
+        AZ::u64 m_maxWorkingSetBytes = 0;
+        AZ::u64 m_peakWorkingSetBytes = 0;
+        AZ::u64 m_peakPagefileUsageBytes = 0;
+        AZ::u64 m_maxAllocatedBytes = 0;
+        //! Statistics of the Streamer at the end of the test
+        AZStd::vector<PerformanceTestStatistic> m_streamerStatistics;
+    };
+
+    //! Path through a level, made of waypoints which are reached at regular intervals
+    class CameraPath
+    {
+    public:
+        void AddWaypoint(const AZ::Transform& waypoint);
+        void Clear();
+        size_t GetWaypointCount() const;
+
+        //! Returns the transform at the normalized time, interpolated between the two closest waypoints
+        AZ::Transform Evaluate(float normalizedTime) const;
+
+    private:
+        AZStd::vector<AZ::Transform> m_waypoints;
+    };
+
+    //! Records the frame times, memory usage and streaming statistics while a script moves the active camera through a level.
+    //! This is used to run the same scripted scenario every night on every platform, and compare the reports between runs.
+    class PerformanceTest
+    {
+    public:
+        void Start(AZStd::string_view testName);
+        bool IsRunning() const;
+
+        //! Writes the report of the test to the file and stops recording
+        AZ::Outcome<void, AZStd::string> Stop(const AZStd::string& outputFilePath);
+
+        //! Returns the camera path the waypoints are added to, which is played by the next call to PlayCameraPath
+        CameraPath& GetCameraPath();
+        //! Starts moving the active camera along the camera path for the duration, and starts a new camera path
+        void PlayCameraPath(float durationSeconds);
+        bool IsPlayingCameraPath() const;
+
+        //! Records the frame and moves the camera, called once per tick of the main loop
+        void OnTick();
+
+    private:
+        void SampleMemory();
+        void SetTimestampQueryEnabled(bool enabled);
+
+        static constexpr AZ::u64 MemorySampleInterval = 30;
+
+        AZStd::string m_testName;
+        AZStd::chrono::steady_clock::time_point m_startTime;
+        AZStd::chrono::steady_clock::time_point m_lastTickTime;
+        AZStd::vector<double> m_cpuFrameTimesMs;
+        AZStd::vector<double> m_gpuFrameTimesMs;
+        AZ::u64 m_tickCount = 0;
+        AZ::u64 m_maxWorkingSetBytes = 0;
+        AZ::u64 m_maxAllocatedBytes = 0;
+        bool m_running = false;
+        bool m_timestampQueryWasEnabled = false;
+
+        CameraPath m_cameraPath;
+        CameraPath m_playedCameraPath;
+        AZStd::chrono::steady_clock::time_point m_cameraPathStartTime;
+        float m_cameraPathDurationSeconds = 0.0f;
+        bool m_playingCameraPath = false;
+    };
+} // namespace AZ::ScriptAutomation
@@ -12,6 +12,7 @@
 
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/EntityId.h>
+#include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/MathReflection.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -403,6 +404,75 @@ namespace AZ::ScriptAutomation
             ScriptAutomationInterface::Get()->QueueScriptOperation(AZStd::move(operation));
         }
 
+        void StartPerformanceTest(const AZStd::string& testName)
+        {
+            auto operation = [testName]()
+            {
+                ScriptAutomationInterface::Get()->StartPerformanceTest(testName.c_str());
+            };
+
+            ScriptAutomationInterface::Get()->QueueScriptOperation(AZStd::move(operation));
+        }
+
+        void StopPerformanceTest(const AZStd::string& outputFilePath)
+        {
+            auto operation = [outputFilePath]()
+            {
+                ScriptAutomationInterface::Get()->StopPerformanceTest(outputFilePath.c_str());
+            };
+
+            ScriptAutomationInterface::Get()->QueueScriptOperation(AZStd::move(operation));
+        }
+
+        void AddCameraPathWaypoint(const AZ::Transform& waypoint)
+        {
+            auto operation = [waypoint]()
+            {
+                ScriptAutomationInterface::Get()->AddCameraPathWaypoint(waypoint);
+            };
+
+            ScriptAutomationInterface::Get()->QueueScriptOperation(AZStd::move(operation));
+        }
+
+        void AddCameraPathWaypointFromEntity(const AZStd::string& entityName)
+        {
+            // The entity is looked up when the operation runs, as the level is usually loaded by a previous operation
+            auto operation = [entityName]()
+            {
+                AZ::EntityId waypointEntityId;
+                AZ::ComponentApplicationBus::Broadcast(&AZ::ComponentApplicationBus::Events::EnumerateEntities,
+                    [&entityName, &waypointEntityId](AZ::Entity* entity)
+                    {
+                        if (!waypointEntityId.IsValid() && entity->GetName() == entityName)
+                        {
+                            waypointEntityId = entity->GetId();
+                        }
+                    });
+
+                if (!waypointEntityId.IsValid())
+                {
+                    AZ_Error("ScriptAutomation", false, "Script: no entity named '%s' found for the camera path", entityName.c_str());
+                    return;
+                }
+
+                AZ::Transform waypoint = AZ::Transform::CreateIdentity();
+                AZ::TransformBus::EventResult(waypoint, waypointEntityId, &AZ::TransformBus::Events::GetWorldTM);
+                ScriptAutomationInterface::Get()->AddCameraPathWaypoint(waypoint);
+            };
+
+            ScriptAutomationInterface::Get()->QueueScriptOperation(AZStd::move(operation));
+        }
+
+        void PlayCameraPath(float durationSeconds)
+        {
+            auto operation = [durationSeconds]()
+            {
+                ScriptAutomationInterface::Get()->PlayCameraPath(durationSeconds);
+            };
+
+            ScriptAutomationInterface::Get()->QueueScriptOperation(AZStd::move(operation));
+        }
+
         bool PrepareForScreenCapture(const AZStd::string& imageName)
         {
             AZ::Render::FrameCapturePathOutcome pathOutcome;
@@ -866,6 +936,13 @@ namespace AZ::ScriptAutomation
 
         behaviorContext->Method("LoadLevel", &Bindings::LoadLevel);
 
+        // Performance tests...
+        behaviorContext->Method("StartPerformanceTest", &Bindings::StartPerformanceTest);
+        behaviorContext->Method("StopPerformanceTest", &Bindings::StopPerformanceTest);
+        behaviorContext->Method("AddCameraPathWaypoint", &Bindings::AddCameraPathWaypoint);
+        behaviorContext->Method("AddCameraPathWaypointFromEntity", &Bindings::AddCameraPathWaypointFromEntity);
+        behaviorContext->Method("PlayCameraPath", &Bindings::PlayCameraPath);
+
         // Screenshots...
         behaviorContext->Method("SetScreenshotFolder", &Bindings::SetScreenshotFolder);
         behaviorContext->Method("SetTestEnvPath", &Bindings::SetTestEnvPath);
@@ -139,6 +139,7 @@ namespace AZ::ScriptAutomation
         }
 
         ScriptAutomation::ImageComparisonConfig::Reflect(context);
+        ScriptAutomation::PerformanceTestReport::Reflect(context);
     }
 
     void ScriptAutomationSystemComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
@@ -239,6 +240,8 @@ namespace AZ::ScriptAutomation
 
     void ScriptAutomationSystemComponent::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        m_performanceTest.OnTick();
+
         if (!m_isStarted)
         {
             m_isStarted = true;
@@ -417,6 +420,40 @@ namespace AZ::ScriptAutomation
 
     }
 
+    void ScriptAutomationSystemComponent::StartPerformanceTest(const char* testName)
+    {
+        m_performanceTest.Start(testName);
+    }
+
+    void ScriptAutomationSystemComponent::StopPerformanceTest(const char* outputFilePath)
+    {
+        AZ::IO::FixedMaxPath resolvedPath;
+        AZ::IO::FileIOBase::GetInstance()->ResolvePath(resolvedPath, outputFilePath);
+
+        auto saveResult = m_performanceTest.Stop(resolvedPath.String());
+        if (saveResult.IsSuccess())
+        {
+            AZ_Printf("ScriptAutomation", "Performance test report saved to '%s'.\n", resolvedPath.c_str());
+        }
+        else
+        {
+            AZ_Error("ScriptAutomation", false, "Failed to save the performance test report to '%s'. Error: %s",
+                resolvedPath.c_str(), saveResult.GetError().c_str());
+        }
+    }
+
+    void ScriptAutomationSystemComponent::AddCameraPathWaypoint(const AZ::Transform& waypoint)
+    {
+        m_performanceTest.GetCameraPath().AddWaypoint(waypoint);
+    }
+
+    void ScriptAutomationSystemComponent::PlayCameraPath(float durationSeconds)
+    {
+        m_performanceTest.PlayCameraPath(durationSeconds);
+        // Idle the script while the camera moves
+        SetIdleSeconds(durationSeconds);
+    }
+
     void ScriptAutomationSystemComponent::OnLevelNotFound(const char* levelName)
     {
         if (m_levelName == levelName)
@@ -10,6 +10,7 @@
 
 #include <ScriptAutomation/ScriptAutomationBus.h>
 #include <ImageComparisonSettings.h>
+#include <PerformanceTest.h>
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
@@ -84,6 +85,10 @@ namespace AZ::ScriptAutomation
         void ExecuteScript(const char* scriptFilePath) override;
         const ImageComparisonToleranceLevel* FindToleranceLevel(const AZStd::string& name) override;
         void LoadLevel(const char* levelName) override;
+        void StartPerformanceTest(const char* testName) override;
+        void StopPerformanceTest(const char* outputFilePath) override;
+        void AddCameraPathWaypoint(const AZ::Transform& waypoint) override;
+        void PlayCameraPath(float durationSeconds) override;
 
         // FrameCaptureNotificationBus implementation
         void OnFrameCaptureFinished(AZ::Render::FrameCaptureResult result, const AZStd::string& info) override;
@@ -102,6 +107,7 @@ namespace AZ::ScriptAutomation
         AZStd::unique_ptr<AZ::ScriptContext> m_scriptContext; //< Provides the lua scripting system
         AZStd::unique_ptr<AZ::BehaviorContext> m_scriptBehaviorContext; //< Used to bind script callback functions to lua
         ImageComparisonSettings m_imageComparisonSettings;
+        PerformanceTest m_performanceTest;
 
         AZStd::queue<ScriptAutomationRequests::ScriptOperation> m_scriptOperations;
 
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <PerformanceTest.h>
+
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class PerformanceTestTests
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(PerformanceTestTests, CalculateFrameTimeStatistics_HundredFrames_ReturnsNearestRankPercentiles)
+    {
+        AZStd::vector<double> frameTimesMs;
+        for (int frame = 100; frame > 0; --frame)
+        {
+            frameTimesMs.push_back(aznumeric_cast<double>(frame));
+        }
+
+        const AZ::ScriptAutomation::FrameTimeStatistics statistics = AZ::ScriptAutomation::CalculateFrameTimeStatistics(frameTimesMs);
+        EXPECT_EQ(100, statistics.m_frameCount);
+        EXPECT_DOUBLE_EQ(50.5, statistics.m_averageMs);
+        EXPECT_DOUBLE_EQ(50.0, statistics.m_p50Ms);
+        EXPECT_DOUBLE_EQ(90.0, statistics.m_p90Ms);
+        EXPECT_DOUBLE_EQ(99.0, statistics.m_p99Ms);
+        EXPECT_DOUBLE_EQ(100.0, statistics.m_maxMs);
+    }
+
+    TEST_F(PerformanceTestTests, CalculateFrameTimeStatistics_NoFrames_ReturnsZeroes)
+    {
+        const AZ::ScriptAutomation::FrameTimeStatistics statistics = AZ::ScriptAutomation::CalculateFrameTimeStatistics({});
+        EXPECT_EQ(0, statistics.m_frameCount);
+        EXPECT_DOUBLE_EQ(0.0, statistics.m_maxMs);
+    }
+
+    TEST_F(PerformanceTestTests, CameraPathEvaluate_BetweenWaypoints_InterpolatesTranslation)
+    {
+        AZ::ScriptAutomation::CameraPath cameraPath;
+        cameraPath.AddWaypoint(AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 0.0f, 0.0f)));
+        cameraPath.AddWaypoint(AZ::Transform::CreateTranslation(AZ::Vector3(10.0f, 0.0f, 0.0f)));
+        cameraPath.AddWaypoint(AZ::Transform::CreateTranslation(AZ::Vector3(10.0f, 20.0f, 0.0f)));
+
+        EXPECT_TRUE(cameraPath.Evaluate(0.0f).GetTranslation().IsClose(AZ::Vector3(0.0f, 0.0f, 0.0f)));
+        EXPECT_TRUE(cameraPath.Evaluate(0.25f).GetTranslation().IsClose(AZ::Vector3(5.0f, 0.0f, 0.0f)));
+        EXPECT_TRUE(cameraPath.Evaluate(0.75f).GetTranslation().IsClose(AZ::Vector3(10.0f, 10.0f, 0.0f)));
+        EXPECT_TRUE(cameraPath.Evaluate(2.0f).GetTranslation().IsClose(AZ::Vector3(10.0f, 20.0f, 0.0f)));
+    }
+} // namespace UnitTest
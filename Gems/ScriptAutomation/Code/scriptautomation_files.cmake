@@ -11,6 +11,8 @@ set(FILES
     Source/ImageComparisonConfig.h
     Source/ImageComparisonSettings.cpp
     Source/ImageComparisonSettings.h
+    Source/PerformanceTest.cpp
+    Source/PerformanceTest.h
     Source/ScriptAutomationScriptBindings.cpp
     Source/ScriptAutomationScriptBindings.h
     Source/ScriptAutomationSystemComponent.cpp
@@ -9,6 +9,7 @@
 set(FILES
     Tests/ScriptAutomationApplicationFixture.cpp
     Tests/ScriptAutomationApplicationFixture.h
+    Tests/PerformanceTestTests.cpp
     Tests/ScriptAutomationTests.cpp
 )
 
@@ -8,6 +8,7 @@
 
 #include "EBusHandler.h"
 #include <AzCore/Script/lua/lua.h>
+#include <ScriptCanvas/Execution/ExecutionState.h>
 
 namespace ScriptCanvas
 {
@@ -115,8 +116,10 @@ namespace ScriptCanvas
     void EBusHandler::OnEventGenericHook(void* userData, const char* eventName, int eventIndex, AZ::BehaviorArgument* result, int numParameters, AZ::BehaviorArgument* parameters)
     {
         AZ_UNUSED(eventName);
-        AZ_PROFILE_SCOPE(ScriptCanvas, "EBusEventHandler::OnEvent %s", eventName);
         auto handler = reinterpret_cast<EBusHandler*>(userData);
+        // attribute the time of the event to the graph that handles it, so captures show which graphs are expensive
+        AZ_PROFILE_SCOPE(ScriptCanvas, "EBusEventHandler::OnEvent %s (%s)", eventName,
+            handler->GetExecutionState() ? handler->GetExecutionState()->GetProfileName() : "");
         SCRIPT_CANVAS_PERFORMANCE_SCOPE_LATENT(handler->GetExecutionState());
         handler->OnEvent(nullptr, eventIndex, result, numParameters, parameters);
     }
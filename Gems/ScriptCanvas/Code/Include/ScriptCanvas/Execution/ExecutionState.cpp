@@ -37,7 +37,10 @@ namespace ScriptCanvas
         : m_runtimeData(config.runtimeData)
         , m_overrides(config.overrides)
         , m_userData(AZStd::move(config.userData))
-    {}
+    {
+        const AZStd::string& assetHint = m_overrides.m_runtimeAsset.GetHint();
+        m_profileName = assetHint.empty() ? m_overrides.m_runtimeAsset.GetId().ToString<AZStd::string>() : assetHint;
+    }
 
     AZ::Data::AssetId ExecutionState::GetAssetId() const
     {
@@ -104,6 +107,11 @@ namespace ScriptCanvas
             : nullptr;
     }
 
+    const char* ExecutionState::GetProfileName() const
+    {
+        return m_profileName.c_str();
+    }
+
     const RuntimeDataOverrides& ExecutionState::GetRuntimeDataOverrides() const
     {
         return m_overrides;
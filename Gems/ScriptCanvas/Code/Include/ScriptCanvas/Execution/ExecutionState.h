@@ -12,6 +12,7 @@
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/string/string.h>
 #include <ScriptCanvas/Execution/ExecutionStateDeclarations.h>
 #include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
 #include <ScriptCanvas/Grammar/DebugMap.h>
@@ -80,6 +81,9 @@ namespace ScriptCanvas
 
         virtual ExecutionMode GetExecutionMode() const = 0;
 
+        /// The name of the graph asset that profiler markers attribute the execution of this state to.
+        const char* GetProfileName() const;
+
         const RuntimeDataOverrides& GetRuntimeDataOverrides() const;
 
         const RuntimeData& GetRuntimeData() const;
@@ -108,5 +112,7 @@ namespace ScriptCanvas
         const RuntimeData& m_runtimeData;
         const RuntimeDataOverrides& m_overrides;
         ExecutionUserData m_userData;
+        // built once, so that profiler markers in latent execution don't allocate
+        AZStd::string m_profileName;
     };
 }
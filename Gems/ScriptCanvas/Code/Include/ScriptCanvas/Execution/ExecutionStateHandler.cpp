@@ -43,8 +43,7 @@ namespace ScriptCanvas
 #else
         AZ_Assert(m_executionState, "ExecutionStateHandler::Execute called without an execution state");
 #endif // defined(SC_RUNTIME_CHECKS_ENABLED)
-        AZ_PROFILE_SCOPE(ScriptCanvas, "ExecutionStateHandler::Execute (%s)"
-            , m_executionState->GetRuntimeDataOverrides().m_runtimeAsset.GetId().ToString<AZStd::string>().c_str());
+        AZ_PROFILE_SCOPE(ScriptCanvas, "ExecutionStateHandler::Execute (%s)", m_executionState->GetProfileName());
         SC_EXECUTION_TRACE_GRAPH_ACTIVATED(CreateActivationInfo());
         SCRIPT_CANVAS_PERFORMANCE_SCOPE_EXECUTION(m_executionState);
         m_executionState->Execute();
@@ -74,6 +74,13 @@ namespace ScriptCanvas
         Stdout,
         Stderr
     );
+
+    AZ_ENUM_CLASS(InterpretedBuildConfiguration,
+        Default,
+        Release,
+        Performance,
+        Debug
+    );
 }
 
 namespace ScriptCanvas
@@ -82,6 +89,42 @@ namespace ScriptCanvas
     AZ_CVAR(PerformanceReportFileStream, sc_outputperformancereport, PerformanceReportFileStream::None, {}, AZ::ConsoleFunctorFlags::Null,
         "Determines where the Script Canvas performance report should be output.");
 
+    void ApplyInterpretedBuildConfiguration(const InterpretedBuildConfiguration& configuration)
+    {
+        BuildConfiguration buildConfiguration;
+        switch (configuration)
+        {
+        case InterpretedBuildConfiguration::Release:
+            buildConfiguration = BuildConfiguration::Release;
+            break;
+        case InterpretedBuildConfiguration::Performance:
+            buildConfiguration = BuildConfiguration::Performance;
+            break;
+        case InterpretedBuildConfiguration::Debug:
+            buildConfiguration = BuildConfiguration::Debug;
+            break;
+        default:
+#if defined(_RELEASE)
+            buildConfiguration = BuildConfiguration::Release;
+#else
+            buildConfiguration = BuildConfiguration::Debug;
+#endif
+            break;
+        }
+
+        // Only handled once the system component is active, which applies the variable itself when activating
+        SystemRequestBus::Broadcast(&SystemRequests::SetInterpretedBuildConfiguration, buildConfiguration);
+    }
+
+    // Console Variable to select the configuration interpreted graphs run in. Every graph is translated with a release,
+    // performance and debug body, the release body skips all debug information and tracing checks.
+    // Graphs pick their body when their Lua module is loaded, so a change only affects graphs loaded afterwards.
+    AZ_CVAR(InterpretedBuildConfiguration, sc_interpretedBuildConfiguration, InterpretedBuildConfiguration::Default,
+        &ApplyInterpretedBuildConfiguration, AZ::ConsoleFunctorFlags::Null,
+        "Selects the configuration interpreted Script Canvas graphs run in. Default uses the configuration of the build. "
+        "Release removes the debug overhead from graphs on servers and profile builds. "
+        "Changes only apply to graphs loaded afterwards.");
+
     void SystemComponent::Reflect(AZ::ReflectContext* context)
     {
         ScriptCanvas::AutoGenRegistryManager::Reflect(context);
@@ -168,6 +211,12 @@ namespace ScriptCanvas
         if (IsAnyScriptInterpreted()) // or if is the editor...
         {
             Execution::ActivateInterpreted();
+
+            const InterpretedBuildConfiguration configuration = sc_interpretedBuildConfiguration;
+            if (configuration != InterpretedBuildConfiguration::Default)
+            {
+                ApplyInterpretedBuildConfiguration(configuration);
+            }
         }
 
         SafeRegisterPerformanceTracker();
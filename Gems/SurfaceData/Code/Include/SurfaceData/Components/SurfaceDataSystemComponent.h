@@ -48,6 +48,7 @@ namespace SurfaceData
             AZStd::span<const AZ::Vector3> inPositions,
             const SurfaceTagVector& desiredTags,
             SurfacePointList& surfacePointLists) const override;
+        SurfacePointListPool::ListPtr AcquireSurfacePointList() const override;
 
         void GetSurfacePointsFromListInternal(
             AZStd::span<const AZ::Vector3> inPositions,
@@ -100,7 +101,7 @@ namespace SurfaceData
         SurfaceDataRegistryHandle m_registeredSurfaceDataModifierHandleCounter = InvalidSurfaceDataRegistryHandle;
         AZStd::unordered_set<AZ::u32> m_registeredModifierTags;
 
-        //point vector reserved for reuse
-        mutable SurfacePointList m_targetPointList;
+        // Pool of reusable output lists for surface point queries.
+        mutable SurfacePointListPool m_surfacePointListPool;
     };
 }
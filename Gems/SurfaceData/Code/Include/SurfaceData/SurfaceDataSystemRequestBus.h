@@ -42,6 +42,14 @@ namespace SurfaceData
         virtual void GetSurfacePointsFromList(
             AZStd::span<const AZ::Vector3> inPositions, const SurfaceTagVector& desiredTags, SurfacePointList& surfacePointLists) const = 0;
 
+        // Get an empty SurfacePointList to use as the output of a surface point query. The list is taken from a pool of reusable
+        // lists and goes back to the pool when the returned pointer is destroyed, so repeated queries don't need to reallocate
+        // their output storage. The returned list must be released before the surface data system is destroyed.
+        virtual SurfacePointListPool::ListPtr AcquireSurfacePointList() const
+        {
+            return SurfacePointListPool::ListPtr(aznew SurfacePointList());
+        }
+
         virtual SurfaceDataRegistryHandle RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry) = 0;
         virtual void UnregisterSurfaceDataProvider(const SurfaceDataRegistryHandle& handle) = 0;
         virtual void UpdateSurfaceDataProvider(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry) = 0;
@@ -14,6 +14,9 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzFramework/SurfaceData/SurfaceData.h>
 #include <SurfaceData/SurfaceDataTypes.h>
 #include <SurfaceData/SurfaceTag.h>
@@ -94,6 +97,17 @@ namespace SurfaceData
         void AddSurfacePoint(const AZ::EntityId& entityId, const AZ::Vector3& inPosition,
             const AZ::Vector3& position, const AZ::Vector3& normal, const SurfaceTagWeights& weights);
 
+        //! Add a surface point to the list for a known input position index.
+        //! Providers that generate their points in input position order should prefer this over the position-based version,
+        //! since it skips the search for the input position that produced the point.
+        //! @param entityId - The entity creating the surface point.
+        //! @param inPositionIndex - The index of the input position that produced this surface point.
+        //! @param position - The position of the surface point.
+        //! @param normal - The normal for the surface point.
+        //! @param weights - The surface tags and weights for this surface point.
+        void AddSurfacePoint(const AZ::EntityId& entityId, size_t inPositionIndex,
+            const AZ::Vector3& position, const AZ::Vector3& normal, const SurfaceTagWeights& weights);
+
         //! Modify the surface weights for each surface point in the list.
         //! @param surfaceModifierHandle - The handle to the surface modifier that will modify the surface weights.
         void ModifySurfaceWeights(const SurfaceDataRegistryHandle& surfaceModifierHandle);
@@ -222,4 +236,43 @@ namespace SurfaceData
         AZStd::vector<SurfaceTagWeights> m_surfaceWeightsList;
         AZStd::vector<AZ::EntityId> m_surfaceCreatorIdList;
     };
+
+    //! SurfacePointListPool keeps a set of SurfacePointList instances that can be reused across surface point queries.
+    //! A cleared SurfacePointList keeps the capacity of its storage vectors, so queries that use a pooled list avoid most of the
+    //! per-query allocations once the pool has warmed up. Lists are returned to the pool when the acquired pointer is destroyed.
+    //! The pool is thread-safe, and it must outlive every list that was acquired from it.
+    class SurfacePointListPool
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SurfacePointListPool, AZ::SystemAllocator);
+
+        //! Returns a list to its pool when destroyed. Lists without a pool are deleted instead.
+        struct ListReleaser
+        {
+            void operator()(SurfacePointList* list) const;
+
+            SurfacePointListPool* m_pool = nullptr;
+        };
+
+        using ListPtr = AZStd::unique_ptr<SurfacePointList, ListReleaser>;
+
+        //! The maximum number of idle lists that the pool holds on to. Lists that are released beyond this are deleted.
+        static constexpr size_t MaxPooledLists = 32;
+
+        SurfacePointListPool() = default;
+        ~SurfacePointListPool() = default;
+        AZ_DISABLE_COPY_MOVE(SurfacePointListPool);
+
+        //! Get an empty SurfacePointList from the pool, or a new one if the pool doesn't have any idle lists.
+        ListPtr Acquire();
+
+        //! Free all of the idle lists in the pool.
+        void Clear();
+
+    private:
+        void Release(SurfacePointList* list);
+
+        AZStd::mutex m_poolMutex;
+        AZStd::vector<AZStd::unique_ptr<SurfacePointList>> m_freeLists;
+    };
 }
@@ -108,6 +108,7 @@ namespace SurfaceData
     {
         SurfaceDataSystemRequestBus::Handler::BusDisconnect();
         AZ::Interface<SurfaceDataSystem>::Unregister(this);
+        m_surfacePointListPool.Clear();
     }
 
     SurfaceDataRegistryHandle SurfaceDataSystemComponent::RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry)
@@ -319,6 +320,11 @@ namespace SurfaceData
         GetSurfacePointsFromListInternal(inPositions, inBounds, desiredTags, surfacePointLists);
     }
 
+    SurfacePointListPool::ListPtr SurfaceDataSystemComponent::AcquireSurfacePointList() const
+    {
+        return m_surfacePointListPool.Acquire();
+    }
+
     void SurfaceDataSystemComponent::GetSurfacePointsFromListInternal(
         AZStd::span<const AZ::Vector3> inPositions, const AZ::Aabb& inPositionBounds,
         const SurfaceTagVector& desiredTags, SurfacePointList& surfacePointLists) const
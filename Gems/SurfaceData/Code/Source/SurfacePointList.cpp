@@ -131,7 +131,15 @@ namespace SurfaceData
         AZ_Assert(m_listIsBeingConstructed, "Trying to add surface points to a SurfacePointList that isn't under construction.");
 
         // Find the inPositionIndex that matches the inPosition.
-        size_t inPositionIndex = GetInPositionIndexFromPosition(inPosition);
+        AddSurfacePoint(entityId, GetInPositionIndexFromPosition(inPosition), position, normal, masks);
+    }
+
+    void SurfacePointList::AddSurfacePoint(
+        const AZ::EntityId& entityId, size_t inPositionIndex,
+        const AZ::Vector3& position, const AZ::Vector3& normal, const SurfaceTagWeights& masks)
+    {
+        AZ_Assert(m_listIsBeingConstructed, "Trying to add surface points to a SurfacePointList that isn't under construction.");
+        AZ_Assert(inPositionIndex < m_inputPositionSize, "Input position index %zu is out of range.", inPositionIndex);
 
         // Find the first SurfacePoint that either matches the inPosition, or that starts the range for the next inPosition after this one.
         size_t surfacePointStartIndex = GetSurfacePointStartIndexFromInPositionIndex(inPositionIndex);
@@ -356,4 +364,53 @@ namespace SurfaceData
         return point;
     }
 
+
+    SurfacePointListPool::ListPtr SurfacePointListPool::Acquire()
+    {
+        {
+            AZStd::scoped_lock lock(m_poolMutex);
+            if (!m_freeLists.empty())
+            {
+                SurfacePointList* list = m_freeLists.back().release();
+                m_freeLists.pop_back();
+                return ListPtr(list, ListReleaser{ this });
+            }
+        }
+
+        return ListPtr(aznew SurfacePointList(), ListReleaser{ this });
+    }
+
+    void SurfacePointListPool::Clear()
+    {
+        AZStd::scoped_lock lock(m_poolMutex);
+        m_freeLists.clear();
+    }
+
+    void SurfacePointListPool::Release(SurfacePointList* list)
+    {
+        // Clearing the list keeps the capacity of its storage vectors, so the next query that reuses it won't need to allocate.
+        list->Clear();
+
+        AZStd::scoped_lock lock(m_poolMutex);
+        if (m_freeLists.size() < MaxPooledLists)
+        {
+            m_freeLists.emplace_back(list);
+        }
+        else
+        {
+            delete list;
+        }
+    }
+
+    void SurfacePointListPool::ListReleaser::operator()(SurfacePointList* list) const
+    {
+        if (m_pool)
+        {
+            m_pool->Release(list);
+        }
+        else
+        {
+            delete list;
+        }
+    }
 }
@@ -333,22 +333,49 @@ namespace Terrain
 
 
         heights.clear();
-        heights.reserve(queryRegion.m_numPointsX * queryRegion.m_numPointsY);
+        heights.resize(queryRegion.m_numPointsX * queryRegion.m_numPointsY);
+
+        if (heights.empty())
+        {
+            return;
+        }
 
         AZ::Aabb worldSize = GetHeightfieldAabb();
         const float worldCenterZ = worldSize.GetCenter().GetZ();
+        const size_t numPointsX = queryRegion.m_numPointsX;
+
+        // The heights are written by index because the query jobs can complete their parts of the region in any order.
+        // The output vector is sized up front and we wait for all the jobs below, so it's safe to capture it by reference.
+        auto perPositionHeightCallback = [&heights, worldCenterZ, numPointsX]
+            (size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+        {
+            heights[xIndex + (yIndex * numPointsX)] = surfacePoint.m_position.GetZ() - worldCenterZ;
+        };
+
+        // Generating the heights for a full heightfield can be expensive for large terrains, so spread the query across
+        // multiple threads in the same way as UpdateHeightsAndMaterialsAsync and wait for it to complete.
+        AZStd::binary_semaphore wait;
 
-        auto perPositionHeightCallback = [&heights, worldCenterZ]
-            ([[maybe_unused]] size_t xIndex, [[maybe_unused]] size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+        auto params = AZStd::make_shared<AzFramework::Terrain::QueryAsyncParams>();
+        params->m_desiredNumberOfJobs = cl_terrainPhysicsColliderMaxJobs;
+        params->m_completionCallback = [&wait]([[maybe_unused]] AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> context)
         {
-            heights.emplace_back(surfacePoint.m_position.GetZ() - worldCenterZ);
+            wait.release();
         };
 
         // We can use the "EXACT" sampler here because our query points are guaranteed to be aligned with terrain grid points.
-        AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
-            &AzFramework::Terrain::TerrainDataRequests::QueryRegion, queryRegion,
+        AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> jobContext;
+        AzFramework::Terrain::TerrainDataRequestBus::BroadcastResult(
+            jobContext, &AzFramework::Terrain::TerrainDataRequests::QueryRegionAsync, queryRegion,
             AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights,
-            perPositionHeightCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+            perPositionHeightCallback, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT, params);
+
+        // If the TerrainSystem is shutting down on a different thread, there might not be a listener to run the query,
+        // in which case there aren't any jobs to wait for.
+        if (jobContext)
+        {
+            wait.acquire();
+        }
     }
 
     uint8_t TerrainPhysicsColliderComponent::GetMaterialIndex(
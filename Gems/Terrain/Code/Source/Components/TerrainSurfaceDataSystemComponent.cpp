@@ -157,10 +157,14 @@ namespace Terrain
 
         size_t inPositionIndex = 0;
 
+        // When the query positions are the input positions of the list, the points can be added by index, which avoids searching
+        // the list for the input position of each point.
+        const bool addByIndex = (inPositions.size() == surfacePointList.GetInputPositionSize());
+
         AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
             &AzFramework::Terrain::TerrainDataRequestBus::Events::QueryList, inPositions,
             AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::All,
-            [this, inPositions, &inPositionIndex, &surfacePointList]
+            [this, inPositions, addByIndex, &inPositionIndex, &surfacePointList]
                 (const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
             {
                 AZ_Assert(inPositionIndex < inPositions.size(), "Too many points returned from QueryList");
@@ -171,8 +175,17 @@ namespace Terrain
                 const AZ::Crc32 terrainTag = terrainExists ? Constants::s_terrainTagCrc : Constants::s_terrainHoleTagCrc;
                 weights.AddSurfaceTagWeight(terrainTag, 1.0f);
 
-                surfacePointList.AddSurfacePoint(
-                    GetEntityId(), inPositions[inPositionIndex], surfacePoint.m_position, surfacePoint.m_normal, weights);
+                // QueryList returns exactly one point per query position in query order.
+                if (addByIndex)
+                {
+                    surfacePointList.AddSurfacePoint(
+                        GetEntityId(), inPositionIndex, surfacePoint.m_position, surfacePoint.m_normal, weights);
+                }
+                else
+                {
+                    surfacePointList.AddSurfacePoint(
+                        GetEntityId(), inPositions[inPositionIndex], surfacePoint.m_position, surfacePoint.m_normal, weights);
+                }
 
                 inPositionIndex++;
             },
@@ -11,6 +11,7 @@
 
 #include <AzCore/Math/IntersectSegment.h>
 #include <AzCore/std/sort.h>
+#include <AzFramework/SurfaceData/SurfaceData.h>
 
 using namespace Terrain;
 
@@ -63,6 +64,82 @@ namespace
         }
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Walks through the cells of a grid with the given cell size that the line segment from start to end
+    // passes through, in order from nearest to farthest (see the description of RayIntersect below).
+    // The visitor is called with the integer coordinates of each cell and the range of t (0 - 1 along the
+    // line segment) that lies inside the cell, and returns true to stop the walk.
+    template<typename CellVisitor>
+    static void WalkGridCells(const AZ::Vector2& start, const AZ::Vector2& end, float cellSize, CellVisitor&& visitCell)
+    {
+        const AZ::Vector2 lineSegment = end - start;
+        const AZ::Vector2 cellSize2(cellSize);
+        const AZ::Vector2 startCell = (start / cellSize2).GetFloor();
+
+        // Calculate the total number of cells we'll need to visit to trace the line segment.
+        // We need to visit 1 at the start, 1 for each X cell we need to move, and 1 for each Y cell we need to move,
+        // since we'll always move either horizontally or vertically one cell at a time when traversing the line segment.
+        const AZ::Vector2 numCellsToMove = ((end / cellSize2).GetFloor() - startCell).GetAbs();
+        const int32_t numCells = 1 + aznumeric_cast<int32_t>(numCellsToMove.GetX()) + aznumeric_cast<int32_t>(numCellsToMove.GetY());
+
+        // This tells us how much t distance on the line to move to increment one cell in each direction.
+        // Note that it could be infinity (due to a divide-by-0) if we're not moving in that direction.
+        const AZ::Vector2 tDelta(cellSize2 / lineSegment.GetAbs());
+
+        // tUntilNextBoundary stores how much further we currently need to move along t to get to the next cell boundary
+        // in each direction. We initialize with the fractional amount that we're starting in the cell or max() if we're
+        // not moving in this direction at all (when lineSegment == 0)
+        const AZ::Vector2 tFromMinCorner((start - (startCell * cellSize2)) / lineSegment.GetAbs());
+        AZ::Vector2 tUntilNextBoundary = AZ::Vector2::CreateSelectCmpEqual(
+            lineSegment, AZ::Vector2::CreateZero(), AZ::Vector2(AZStd::numeric_limits<float>::max()), tFromMinCorner);
+
+        // If we're moving in the positive direction in the cell, then the amount till the next boundary is actually
+        // the distance remaining to the max corner, not the distance in from the min corner, so flip our calculation.
+        tUntilNextBoundary = AZ::Vector2::CreateSelectCmpGreater(end, start, tDelta - tUntilNextBoundary, tUntilNextBoundary);
+
+        const AZ::Vector2 tDeltaX(tDelta.GetX(), 0.0f);
+        const AZ::Vector2 tDeltaY(0.0f, tDelta.GetY());
+        const int32_t stepX = (lineSegment.GetX() > 0.0f) ? 1 : ((lineSegment.GetX() < 0.0f) ? -1 : 0);
+        const int32_t stepY = (lineSegment.GetY() > 0.0f) ? 1 : ((lineSegment.GetY() < 0.0f) ? -1 : 0);
+
+        int32_t cellX = aznumeric_cast<int32_t>(startCell.GetX());
+        int32_t cellY = aznumeric_cast<int32_t>(startCell.GetY());
+        float tEnter = 0.0f;
+
+        for (int32_t cell = 0; cell < numCells; cell++)
+        {
+            const float tExit = AZStd::min(1.0f, AZStd::min(tUntilNextBoundary.GetX(), tUntilNextBoundary.GetY()));
+            if (visitCell(cellX, cellY, tEnter, tExit))
+            {
+                return;
+            }
+            tEnter = tExit;
+
+            // Move forward along the line (either horizontally or vertically) to the next cell.
+            if (tUntilNextBoundary.GetY() < tUntilNextBoundary.GetX())
+            {
+                cellY += stepY;
+                tUntilNextBoundary += tDeltaY;
+            }
+            else
+            {
+                cellX += stepX;
+                tUntilNextBoundary += tDeltaX;
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Packs the X and Y indices of a raycast block into a single key.
+    static uint64_t GetBlockKey(int32_t blockX, int32_t blockY)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(blockX)) << 32) | static_cast<uint64_t>(static_cast<uint32_t>(blockY));
+    }
+
+    // The amount to pad the block height bounds by, so that precision errors don't cause a block to be skipped
+    // when the ray only grazes the highest or lowest point in it.
+    static constexpr float BlockHeightBoundsPadding = 0.01f;
+
 } // namespace
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -93,6 +170,11 @@ TerrainRaycastContext::~TerrainRaycastContext()
    that cannot contain terrain. We then walk through the grid one square at a time, either moving horizontally
    or vertically to the next square based on the ray's slope, until we reach the end of the ray or we've found a hit.
 
+   To avoid triangulating every square along long rays, the grid squares are grouped into blocks of
+   BlockSize x BlockSize squares, and the ray first walks through the blocks the same way. The min and max
+   terrain heights of each block are cached, and blocks where the ray stays entirely above or below that
+   height range are skipped without visiting any of their squares.
+
    Visualization:
     - X: Grid square intersection but no triangle hit found
     - T: Grid square intersection with a triangle hit found
@@ -118,7 +200,7 @@ AzFramework::RenderGeometry::RayResult TerrainRaycastContext::RayIntersect(
     const AzFramework::RenderGeometry::RayRequest& ray)
 {
     const AZ::Aabb terrainWorldBounds = m_terrainSystem.GetTerrainAabb();
-    const AZ::Vector2 terrainResolution(m_terrainSystem.GetTerrainHeightQueryResolution());
+    const float terrainResolution = m_terrainSystem.GetTerrainHeightQueryResolution();
 
     // Initialize the result to invalid at the start.
     AzFramework::RenderGeometry::RayResult rayIntersectionResult = AzFramework::RenderGeometry::RayResult();
@@ -145,100 +227,189 @@ AzFramework::RenderGeometry::RayResult TerrainRaycastContext::RayIntersect(
         return rayIntersectionResult;
     }
 
-    // Move our clipped line segment into Vector2s for more convenient use below.
-    const AZ::Vector2 clippedStart(clippedRayStart);
-    const AZ::Vector2 clippedEnd(clippedRayEnd);
-    const AZ::Vector2 clippedLineSegment = clippedEnd - clippedStart;
+    const AZ::Vector3 clippedRaySegment = clippedRayEnd - clippedRayStart;
 
-    // Calculate the total number of terrain squares we'll need to visit to trace the ray segment.
-    // We need to visit 1 at the start, 1 for each X square we need to move, and 1 for each Y square we need to move,
-    // since we'll always move either horizontally or vertically one square at a time when traversing the ray segment.
-    const AZ::Vector2 numSquaresToMove =
-        ((clippedEnd / terrainResolution).GetFloor() - (clippedStart / terrainResolution).GetFloor()).GetAbs();
-    const int32_t numTerrainSquares =
-        1 + aznumeric_cast<int32_t>(numSquaresToMove.GetX()) + aznumeric_cast<int32_t>(numSquaresToMove.GetY());
+    // Initialize our segment/triangle hit tester with the ray that we're using. We use the full ray instead of the clipped one
+    // to make sure we don't run into any precision issues caused from the clipping.
+    AZ::Intersect::SegmentTriangleHitTester hitTester(ray.m_startWorldPosition, ray.m_endWorldPosition);
 
-    // This tells us how much t distance on the line to move to increment one terrain square in each direction.
-    // Note that it could be infinity (due to a divide-by-0) if we're not moving in that direction.
-    const AZ::Vector2 tDelta(terrainResolution / clippedLineSegment.GetAbs());
+    // Walk through each block of terrain squares that intersects the XY coordinates of the line.
+    WalkGridCells(
+        AZ::Vector2(clippedRayStart),
+        AZ::Vector2(clippedRayEnd),
+        terrainResolution * BlockSize,
+        [&](int32_t blockX, int32_t blockY, float tBlockEnter, float tBlockExit)
+        {
+            const AZ::Vector3 blockRayStart = clippedRayStart + (clippedRaySegment * tBlockEnter);
+            const AZ::Vector3 blockRayEnd = clippedRayStart + (clippedRaySegment * tBlockExit);
+
+            // Skip the whole block if the ray stays above or below all the terrain in it.
+            const BlockHeightBounds heightBounds = GetBlockHeightBounds(blockX, blockY, terrainResolution);
+            const float rayMinZ = AZStd::min(blockRayStart.GetZ(), blockRayEnd.GetZ());
+            const float rayMaxZ = AZStd::max(blockRayStart.GetZ(), blockRayEnd.GetZ());
+            if ((rayMinZ > heightBounds.m_max + BlockHeightBoundsPadding) || (rayMaxZ < heightBounds.m_min - BlockHeightBoundsPadding))
+            {
+                return false;
+            }
+
+            // Walk through each grid square in the block that intersects the XY coordinates of the line.
+            // We'll check each square to see if the ray intersections actually intersect the terrain triangles in the square.
+            WalkGridCells(
+                AZ::Vector2(blockRayStart),
+                AZ::Vector2(blockRayEnd),
+                terrainResolution,
+                [&](int32_t squareX, int32_t squareY, [[maybe_unused]] float tSquareEnter, [[maybe_unused]] float tSquareExit)
+                {
+                    // Create a bounding volume for this terrain square. The corners are calculated from the square indices
+                    // so that they match the positions that the block height bounds were queried at.
+                    AZ::Aabb currentVoxel = AZ::Aabb::CreateFromMinMax(
+                        AZ::Vector3(
+                            aznumeric_cast<float>(squareX) * terrainResolution,
+                            aznumeric_cast<float>(squareY) * terrainResolution,
+                            terrainWorldBounds.GetMin().GetZ()),
+                        AZ::Vector3(
+                            aznumeric_cast<float>(squareX + 1) * terrainResolution,
+                            aznumeric_cast<float>(squareY + 1) * terrainResolution,
+                            terrainWorldBounds.GetMax().GetZ()));
+
+                    // Check for a hit against the terrain triangles in this square.
+                    // Note - this could be optimized to be 2x faster by adding some code to keep track of the terrain heights
+                    // from the previous square checked so that we only get the 2 new corners instead of all 4 every time.
+                    TriangulateAndFindNearestIntersection(m_terrainSystem, currentVoxel, hitTester, rayIntersectionResult);
+                    return static_cast<bool>(rayIntersectionResult);
+                });
+
+            return static_cast<bool>(rayIntersectionResult);
+        });
+
+    if (rayIntersectionResult)
+    {
+        // Intersection found. Replace the triangle normal from the hit with a higher-quality normal calculated
+        // by the terrain system.
+        rayIntersectionResult.m_worldNormal = m_terrainSystem.GetNormal(
+            rayIntersectionResult.m_worldPosition, AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
 
-    // Get the min world space corner of the terrain grid square containing (x0, y0)
-    const AZ::Vector2 clippedStartGridCorner = (clippedStart / terrainResolution).GetFloor() * terrainResolution;
+        // Return the distance in world space instead of in ray distance space.
+        rayIntersectionResult.m_distance = rayIntersectionResult.m_worldPosition.GetDistance(ray.m_startWorldPosition);
+    }
 
-    // tUntilNextBoundary stores how much further we currently need to move along t to get to the next terrain grid square boundary
-    // in each direction.
-    // We initialize with the fractional amount that we're starting in the square or max() if we're not moving in this
-    // direction at all (when clippedLineSegment == 0)
-    const AZ::Vector2 tFromMinCorner((clippedStart - clippedStartGridCorner) / clippedLineSegment.GetAbs());
+    // If needed we could call m_terrainSystem.FindBestAreaEntityAtPosition in order to set
+    // rayIntersectionResult.m_entityAndComponent, but I'm not sure whether that is correct.
+    return rayIntersectionResult;
+}
 
-    AZ::Vector2 tUntilNextBoundary = AZ::Vector2::CreateSelectCmpEqual(
-        clippedLineSegment, AZ::Vector2::CreateZero(), AZ::Vector2(AZStd::numeric_limits<float>::max()), tFromMinCorner);
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TerrainRaycastContext::RayIntersect(
+    AZStd::span<const AzFramework::RenderGeometry::RayRequest> rays,
+    AZStd::span<AzFramework::RenderGeometry::RayResult> results)
+{
+    AZ_Assert(rays.size() == results.size(), "The number of ray results (%zu) must match the number of rays (%zu).",
+        results.size(), rays.size());
 
-    // If we're moving in the positive direction in the square, then the amount till the next boundary is actually
-    // the distance remaining to the max corner, not the distance in from the min corner, so flip our calculation.
-    tUntilNextBoundary = AZ::Vector2::CreateSelectCmpGreater(clippedEnd, clippedStart, tDelta - tUntilNextBoundary, tUntilNextBoundary);
+    const size_t numRays = AZStd::min(rays.size(), results.size());
+    for (size_t rayIndex = 0; rayIndex < numRays; rayIndex++)
+    {
+        results[rayIndex] = RayIntersect(rays[rayIndex]);
+    }
+}
 
-    // Initialize our segment/triangle hit tester with the ray that we're using. We use the full ray instead of the clipped one
-    // to make sure we don't run into any precision issues caused from the clipping.
-    AZ::Intersect::SegmentTriangleHitTester hitTester(ray.m_startWorldPosition, ray.m_endWorldPosition);
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TerrainRaycastContext::InvalidateRegion(const AZ::Aabb& region)
+{
+    if (!region.IsValid())
+    {
+        return;
+    }
+
+    AZStd::unique_lock<AZStd::shared_mutex> lock(m_blockMutex);
+    m_blockGeneration++;
 
-    // These will hold our current square coordinates in world space values as we loop through the squares, starting with the
-    // grid square for (x0, y0). These values represent the minimum corner of each terrain square.
-    AZ::Vector2 curGridCorner = clippedStartGridCorner;
-
-    // This is how much we need to increment our x and y by to get to the next grid square along the line.
-    // They will either be +/- terrainResolution or 0 if we're not moving in that direction.
-    const AZ::Vector2 gridIncrement = terrainResolution *
-        AZ::Vector2::CreateSelectCmpEqual(clippedLineSegment,
-                                          AZ::Vector2::CreateZero(),
-                                          AZ::Vector2::CreateZero(),
-                                          AZ::Vector2(AZ::GetSign(clippedLineSegment.GetX()), AZ::GetSign(clippedLineSegment.GetY())));
-
-    // Convenience vectors that we can use in the loop to just increment one direction.
-    const AZ::Vector2 tDeltaX(tDelta.GetX(), 0.0f);
-    const AZ::Vector2 tDeltaY(0.0f, tDelta.GetY());
-    const AZ::Vector2 gridIncrementX(gridIncrement.GetX(), 0.0f);
-    const AZ::Vector2 gridIncrementY(0.0f, gridIncrement.GetY());
-
-    // Walk through each grid square in the terrain that intersects the XY coordinates of the line.
-    // We'll check each square to see if the ray intersections actually intersect the terrain triangles in the square.
-    for (int terrainSquare = 0; terrainSquare < numTerrainSquares; terrainSquare++)
+    if (m_blockHeightBounds.empty())
     {
-        // Create a bounding volume for this terrain square.
-        AZ::Aabb currentVoxel = AZ::Aabb::CreateFromMinMax(
-            AZ::Vector3(curGridCorner, terrainWorldBounds.GetMin().GetZ()),
-            AZ::Vector3(curGridCorner + terrainResolution, terrainWorldBounds.GetMax().GetZ()));
-
-        // Check for a hit against the terrain triangles in this square.
-        // Note - this could be optimized to be 2x faster by adding some code to keep track of the terrain heights
-        // from the previous square checked so that we only get the 2 new corners instead of all 4 every time.
-        TriangulateAndFindNearestIntersection(m_terrainSystem, currentVoxel, hitTester, rayIntersectionResult);
-        if (rayIntersectionResult)
+        return;
+    }
+
+    const AZ::Vector2 blockWorldSize(m_blockTerrainResolution * BlockSize);
+    const AZ::Vector2 minBlock = (AZ::Vector2(region.GetMin()) / blockWorldSize).GetFloor();
+    const AZ::Vector2 maxBlock = (AZ::Vector2(region.GetMax()) / blockWorldSize).GetFloor();
+    const int32_t minBlockX = aznumeric_cast<int32_t>(minBlock.GetX());
+    const int32_t minBlockY = aznumeric_cast<int32_t>(minBlock.GetY());
+    const int32_t maxBlockX = aznumeric_cast<int32_t>(maxBlock.GetX());
+    const int32_t maxBlockY = aznumeric_cast<int32_t>(maxBlock.GetY());
+
+    // The block corners are shared with the neighboring blocks, so also drop the blocks that only touch the region.
+    AZStd::erase_if(
+        m_blockHeightBounds,
+        [=](const auto& item)
         {
-            // Intersection found. Replace the triangle normal from the hit with a higher-quality normal calculated
-            // by the terrain system.
-            rayIntersectionResult.m_worldNormal = m_terrainSystem.GetNormal(
-                rayIntersectionResult.m_worldPosition, AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
-
-            // Return the distance in world space instead of in ray distance space.
-            rayIntersectionResult.m_distance = rayIntersectionResult.m_worldPosition.GetDistance(ray.m_startWorldPosition);
-            break;
-        }
+            const int32_t blockX = static_cast<int32_t>(static_cast<uint32_t>(item.first >> 32));
+            const int32_t blockY = static_cast<int32_t>(static_cast<uint32_t>(item.first));
+            return (blockX >= minBlockX - 1) && (blockX <= maxBlockX) && (blockY >= minBlockY - 1) && (blockY <= maxBlockY);
+        });
+}
 
-        // No hit yet, so move forward along the line (either horizontally or vertically) to the next terrain square.
-        if (tUntilNextBoundary.GetY() < tUntilNextBoundary.GetX())
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TerrainRaycastContext::ClearCachedHeightBounds()
+{
+    AZStd::unique_lock<AZStd::shared_mutex> lock(m_blockMutex);
+    m_blockGeneration++;
+    m_blockHeightBounds.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TerrainRaycastContext::BlockHeightBounds TerrainRaycastContext::GetBlockHeightBounds(
+    int32_t blockX, int32_t blockY, float terrainResolution)
+{
+    // Read the generation before querying the heights, so that heights queried before an invalidation are never stored.
+    const uint32_t generation = m_blockGeneration;
+    const uint64_t blockKey = GetBlockKey(blockX, blockY);
+
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_blockMutex);
+        if (m_blockTerrainResolution == terrainResolution)
         {
-            curGridCorner += gridIncrementY;
-            tUntilNextBoundary += tDeltaY;
+            if (auto cachedBounds = m_blockHeightBounds.find(blockKey); cachedBounds != m_blockHeightBounds.end())
+            {
+                return cachedBounds->second;
+            }
         }
-        else
+    }
+
+    // Query the heights at every grid square corner in the block. The triangles in each square interpolate between
+    // the corner heights, so these bound all the terrain triangles in the block.
+    BlockHeightBounds heightBounds{ AZStd::numeric_limits<float>::max(), AZStd::numeric_limits<float>::lowest() };
+    const AzFramework::Terrain::TerrainQueryRegion queryRegion(
+        AZ::Vector2(
+            aznumeric_cast<float>(blockX) * BlockSize * terrainResolution,
+            aznumeric_cast<float>(blockY) * BlockSize * terrainResolution),
+        BlockSize + 1,
+        BlockSize + 1,
+        AZ::Vector2(terrainResolution));
+
+    m_terrainSystem.QueryRegion(
+        queryRegion,
+        AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights,
+        [&heightBounds](
+            [[maybe_unused]] size_t xIndex, [[maybe_unused]] size_t yIndex,
+            const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
         {
-            curGridCorner += gridIncrementX;
-            tUntilNextBoundary += tDeltaX;
+            heightBounds.m_min = AZStd::min(heightBounds.m_min, surfacePoint.m_position.GetZ());
+            heightBounds.m_max = AZStd::max(heightBounds.m_max, surfacePoint.m_position.GetZ());
+        },
+        AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_blockMutex);
+        if (generation == m_blockGeneration)
+        {
+            if ((m_blockTerrainResolution != terrainResolution) || (m_blockHeightBounds.size() >= MaxCachedBlocks))
+            {
+                m_blockHeightBounds.clear();
+                m_blockTerrainResolution = terrainResolution;
+            }
+            m_blockHeightBounds.emplace(blockKey, heightBounds);
         }
     }
 
-    // If needed we could call m_terrainSystem.FindBestAreaEntityAtPosition in order to set
-    // rayIntersectionResult.m_entityAndComponent, but I'm not sure whether that is correct.
-    return rayIntersectionResult;
+    return heightBounds;
 }
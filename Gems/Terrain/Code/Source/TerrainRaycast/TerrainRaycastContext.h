@@ -8,6 +8,11 @@
 
 #pragma once
 
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <AzFramework/Render/IntersectorInterface.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -41,6 +46,24 @@ namespace Terrain
         //! \ref AzFramework::RenderGeometry::RayIntersect
         AzFramework::RenderGeometry::RayResult RayIntersect(const AzFramework::RenderGeometry::RayRequest& ray) override;
 
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Intersect a batch of rays with the terrain. Rays that pass over the same parts of the
+        //! terrain share the cached height bounds of the raycast blocks.
+        //! \param[in] rays The rays to intersect with the terrain
+        //! \param[out] results The closest intersection for each ray, must be the same size as rays
+        void RayIntersect(
+            AZStd::span<const AzFramework::RenderGeometry::RayRequest> rays,
+            AZStd::span<AzFramework::RenderGeometry::RayResult> results);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Drop the cached height bounds of every raycast block that overlaps the given region in XY
+        //! \param[in] region The region of the terrain whose heights changed
+        void InvalidateRegion(const AZ::Aabb& region);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Drop the cached height bounds of all the raycast blocks
+        void ClearCachedHeightBounds();
+
     protected:
         ////////////////////////////////////////////////////////////////////////////////////////////
         // RenderGeometry::IntersectorBus inherits from RenderGeometry::IntersectionNotifications,
@@ -54,9 +77,37 @@ namespace Terrain
         ///@}
 
     private:
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! The number of terrain grid squares along each side of a raycast block. Rays skip over
+        //! whole blocks when they pass above or below the range of terrain heights in the block.
+        static constexpr int32_t BlockSize = 16;
+
+        //! The maximum number of blocks with cached height bounds before the cache is emptied.
+        static constexpr size_t MaxCachedBlocks = 4096;
+
+        //! The min and max terrain heights at the grid square corners of a raycast block.
+        struct BlockHeightBounds
+        {
+            float m_min;
+            float m_max;
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Get the height bounds of a raycast block, querying the terrain heights if they aren't cached
+        //! \param[in] blockX The X index of the block
+        //! \param[in] blockY The Y index of the block
+        //! \param[in] terrainResolution The size of each terrain grid square
+        //! \return The min and max heights at the grid square corners in the block
+        BlockHeightBounds GetBlockHeightBounds(int32_t blockX, int32_t blockY, float terrainResolution);
+
         ////////////////////////////////////////////////////////////////////////////////////////////
         // Variables
         TerrainSystem& m_terrainSystem; //!< Terrain system that owns this terrain raycast context
         AzFramework::EntityContextId m_entityContextId; //!< This object's entity context id
+
+        AZStd::shared_mutex m_blockMutex; //!< Guards the cached block height bounds
+        AZStd::unordered_map<uint64_t, BlockHeightBounds> m_blockHeightBounds; //!< Cached height bounds keyed by block index
+        float m_blockTerrainResolution = 0.0f; //!< The terrain resolution that the cached height bounds were queried with
+        AZStd::atomic<uint32_t> m_blockGeneration{ 0 }; //!< Changes with every invalidation, so stale bounds are never stored
     };
 } // namespace Terrain
@@ -307,6 +307,31 @@ namespace Terrain
         m_fullRefreshClipmaps = true;
     }
 
+    void TerrainClipmapManager::AddDirtyRegion(const AZ::Aabb& dirtyRegion)
+    {
+        if (dirtyRegion.IsValid())
+        {
+            m_dirtyRegion.AddAabb(dirtyRegion);
+        }
+        else
+        {
+            TriggerFullRefresh();
+        }
+    }
+
+    void TerrainClipmapManager::AddClipmapUpdateRegions(
+        uint32_t clipmapIndex, const ClipmapBoundsRegionList& regionList, AZStd::vector<ClipmapUpdateRegion>& updateRegions)
+    {
+        for (const ClipmapBoundsRegion& region : regionList)
+        {
+            AZStd::array<uint32_t, 4> aabb = { aznumeric_cast<uint32_t>(region.m_localAabb.m_min.m_x),
+                                               aznumeric_cast<uint32_t>(region.m_localAabb.m_min.m_y),
+                                               aznumeric_cast<uint32_t>(region.m_localAabb.m_max.m_x),
+                                               aznumeric_cast<uint32_t>(region.m_localAabb.m_max.m_y) };
+            updateRegions.push_back(ClipmapUpdateRegion(clipmapIndex, aabb));
+        }
+    }
+
     void TerrainClipmapManager::Update(const AZ::Vector3& cameraPosition, const AZ::RPI::Scene* scene, AZ::Data::Instance<AZ::RPI::ShaderResourceGroup>& terrainSrg)
     {
         UpdateClipmapData(cameraPosition, scene, terrainSrg);
@@ -350,7 +375,8 @@ namespace Terrain
         m_macroClipmapUpdateRegionsBuffer = AZ::Render::GpuBufferHandler(desc);
 
         // Reserve the max possible size.
-        m_macroClipmapUpdateRegions.reserve(ClipmapBounds::MaxUpdateRegions * m_macroClipmapStackSize);
+        m_macroClipmapUpdateRegions.reserve(
+            (ClipmapBounds::MaxUpdateRegions + ClipmapBounds::MaxTransformRegions) * m_macroClipmapStackSize);
     }
 
     void TerrainClipmapManager::InitializeDetailClipmapGpuBuffer()
@@ -363,7 +389,8 @@ namespace Terrain
         m_detailClipmapUpdateRegionsBuffer = AZ::Render::GpuBufferHandler(desc);
 
         // Reserve the max possible size.
-        m_detailClipmapUpdateRegions.reserve(ClipmapBounds::MaxUpdateRegions * m_detailClipmapStackSize);
+        m_detailClipmapUpdateRegions.reserve(
+            (ClipmapBounds::MaxUpdateRegions + ClipmapBounds::MaxTransformRegions) * m_detailClipmapStackSize);
     }
 
     void TerrainClipmapManager::ClearMacroClipmapGpuBuffer()
@@ -592,6 +619,7 @@ namespace Terrain
         if (m_fullRefreshClipmaps)
         {
             m_fullRefreshClipmaps = false;
+            m_dirtyRegion = AZ::Aabb::CreateNull();
 
             InitializeMacroClipmapBounds(currentViewPosition);
             InitializeDetailClipmapBounds(currentViewPosition);
@@ -648,7 +676,10 @@ namespace Terrain
         {
             ClipmapBounds& clipmapBounds = m_macroClipmapBounds[clipmapIndex];
 
-            ClipmapBoundsRegionList updateRegionList = clipmapBounds.UpdateCenter(currentViewPosition);
+            // Only the strips that became newly exposed by the camera movement are regenerated. The rest of the clipmap wraps
+            // around toroidally and keeps its data.
+            AZ::Aabb untouchedRegion = AZ::Aabb::CreateNull();
+            ClipmapBoundsRegionList updateRegionList = clipmapBounds.UpdateCenter(currentViewPosition, &untouchedRegion);
 
             // write updated center
             Vector2i center = clipmapBounds.GetModCenter();
@@ -659,13 +690,16 @@ namespace Terrain
             m_clipmapData.m_clipmapWorldCenters[clipmapIndex].m_macro[0] = centerWorld.GetX();
             m_clipmapData.m_clipmapWorldCenters[clipmapIndex].m_macro[1] = centerWorld.GetY();
 
-            for (uint32_t i = 0; i < updateRegionList.size(); ++i)
+            AddClipmapUpdateRegions(clipmapIndex, updateRegionList, m_macroClipmapUpdateRegions);
+
+            // Regenerate the changed data that is still visible in this level and isn't already covered by the new strips.
+            if (m_dirtyRegion.IsValid())
             {
-                AZStd::array<uint32_t, 4> aabb = { aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_min.m_x),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_min.m_y),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_max.m_x),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_max.m_y) };
-                m_macroClipmapUpdateRegions.push_back(ClipmapUpdateRegion(clipmapIndex, aabb));
+                const AZ::Aabb dirtyRegion = m_dirtyRegion.GetClamped(untouchedRegion);
+                if (dirtyRegion.IsValid())
+                {
+                    AddClipmapUpdateRegions(clipmapIndex, clipmapBounds.TransformRegion(dirtyRegion), m_macroClipmapUpdateRegions);
+                }
             }
         }
 
@@ -694,7 +728,10 @@ namespace Terrain
         {
             ClipmapBounds& clipmapBounds = m_detailClipmapBounds[clipmapIndex];
 
-            ClipmapBoundsRegionList updateRegionList = clipmapBounds.UpdateCenter(currentViewPosition);
+            // Only the strips that became newly exposed by the camera movement are regenerated. The rest of the clipmap wraps
+            // around toroidally and keeps its data.
+            AZ::Aabb untouchedRegion = AZ::Aabb::CreateNull();
+            ClipmapBoundsRegionList updateRegionList = clipmapBounds.UpdateCenter(currentViewPosition, &untouchedRegion);
 
             // write updated center
             Vector2i center = clipmapBounds.GetModCenter();
@@ -705,13 +742,16 @@ namespace Terrain
             m_clipmapData.m_clipmapWorldCenters[clipmapIndex].m_detail[0] = centerWorld.GetX();
             m_clipmapData.m_clipmapWorldCenters[clipmapIndex].m_detail[1] = centerWorld.GetY();
 
-            for (uint32_t i = 0; i < updateRegionList.size(); ++i)
+            AddClipmapUpdateRegions(clipmapIndex, updateRegionList, m_detailClipmapUpdateRegions);
+
+            // Regenerate the changed data that is still visible in this level and isn't already covered by the new strips.
+            if (m_dirtyRegion.IsValid())
             {
-                AZStd::array<uint32_t, 4> aabb = { aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_min.m_x),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_min.m_y),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_max.m_x),
-                                                   aznumeric_cast<uint32_t>(updateRegionList[i].m_localAabb.m_max.m_y) };
-                m_detailClipmapUpdateRegions.push_back(ClipmapUpdateRegion(clipmapIndex, aabb));
+                const AZ::Aabb dirtyRegion = m_dirtyRegion.GetClamped(untouchedRegion);
+                if (dirtyRegion.IsValid())
+                {
+                    AddClipmapUpdateRegions(clipmapIndex, clipmapBounds.TransformRegion(dirtyRegion), m_detailClipmapUpdateRegions);
+                }
             }
         }
 
@@ -734,6 +774,8 @@ namespace Terrain
             m_clipmapData.m_detailDispatchGroupCountX = 1;
             m_clipmapData.m_detailDispatchGroupCountY = 1;
         }
+
+        m_dirtyRegion = AZ::Aabb::CreateNull();
     }
 
     AZ::Data::Instance<AZ::RPI::AttachmentImage> TerrainClipmapManager::GetClipmapImage(ClipmapName clipmapName) const
@@ -774,28 +816,29 @@ namespace Terrain
 
     // AzFramework::Terrain::TerrainDataNotificationBus overrides...
     void TerrainClipmapManager::OnTerrainDataChanged(
-        [[maybe_unused]] const AZ::Aabb& dirtyRegion, [[maybe_unused]] TerrainDataChangedMask dataChangedMask)
+        const AZ::Aabb& dirtyRegion, [[maybe_unused]] TerrainDataChangedMask dataChangedMask)
     {
-        TriggerFullRefresh();
+        AddDirtyRegion(dirtyRegion);
     }
 
     // TerrainMacroMaterialNotificationBus overrides...
     void TerrainClipmapManager::OnTerrainMacroMaterialCreated(
-        [[maybe_unused]] AZ::EntityId entityId, [[maybe_unused]] const MacroMaterialData& material)
+        [[maybe_unused]] AZ::EntityId entityId, const MacroMaterialData& material)
     {
-        TriggerFullRefresh();
+        AddDirtyRegion(material.m_bounds);
     }
 
     void TerrainClipmapManager::OnTerrainMacroMaterialChanged(
-        [[maybe_unused]] AZ::EntityId entityId, [[maybe_unused]] const MacroMaterialData& material)
+        [[maybe_unused]] AZ::EntityId entityId, const MacroMaterialData& material)
     {
-        TriggerFullRefresh();
+        AddDirtyRegion(material.m_bounds);
     }
 
     void TerrainClipmapManager::OnTerrainMacroMaterialRegionChanged(
-        [[maybe_unused]] AZ::EntityId entityId, [[maybe_unused]] const AZ::Aabb& oldRegion, [[maybe_unused]] const AZ::Aabb& newRegion)
+        [[maybe_unused]] AZ::EntityId entityId, const AZ::Aabb& oldRegion, const AZ::Aabb& newRegion)
     {
-        TriggerFullRefresh();
+        AddDirtyRegion(oldRegion);
+        AddDirtyRegion(newRegion);
     }
 
     void TerrainClipmapManager::OnTerrainMacroMaterialDestroyed([[maybe_unused]] AZ::EntityId entityId)
@@ -852,20 +895,21 @@ namespace Terrain
     }
 
     void TerrainClipmapManager::OnTerrainSurfaceMaterialMappingRegionCreated(
-        [[maybe_unused]] AZ::EntityId entityId, [[maybe_unused]] const AZ::Aabb& region)
+        [[maybe_unused]] AZ::EntityId entityId, const AZ::Aabb& region)
     {
-        TriggerFullRefresh();
+        AddDirtyRegion(region);
     }
 
     void TerrainClipmapManager::OnTerrainSurfaceMaterialMappingRegionDestroyed(
-        [[maybe_unused]] AZ::EntityId entityId, [[maybe_unused]] const AZ::Aabb& oldRegion)
+        [[maybe_unused]] AZ::EntityId entityId, const AZ::Aabb& oldRegion)
     {
-        TriggerFullRefresh();
+        AddDirtyRegion(oldRegion);
     }
 
     void TerrainClipmapManager::OnTerrainSurfaceMaterialMappingRegionChanged(
-        [[maybe_unused]] AZ::EntityId entityId, [[maybe_unused]] const AZ::Aabb& oldRegion, [[maybe_unused]] const AZ::Aabb& newRegion)
+        [[maybe_unused]] AZ::EntityId entityId, const AZ::Aabb& oldRegion, const AZ::Aabb& newRegion)
     {
-        TriggerFullRefresh();
+        AddDirtyRegion(oldRegion);
+        AddDirtyRegion(newRegion);
     }
 }
@@ -187,6 +187,10 @@ namespace Terrain
         void InitializeDetailClipmapImages();
         void InitializeDetailClipmapGpuBuffer();
 
+        //! Add a world space region whose clipmap data is out of date, to be regenerated on the next update.
+        //! An invalid region means the extent of the change is unknown, so the clipmaps get fully refreshed instead.
+        void AddDirtyRegion(const AZ::Aabb& dirtyRegion);
+
         //! Clear functions.
         void ClearMacroClipmapImages();
         void ClearMacroClipmapGpuBuffer();
@@ -337,6 +341,10 @@ namespace Terrain
         AZStd::vector<ClipmapUpdateRegion> m_macroClipmapUpdateRegions;
         AZStd::vector<ClipmapUpdateRegion> m_detailClipmapUpdateRegions;
 
+        //! Append the clipmap regions that need to be regenerated for a single clipmap level to the list of update regions.
+        static void AddClipmapUpdateRegions(
+            uint32_t clipmapIndex, const ClipmapBoundsRegionList& regionList, AZStd::vector<ClipmapUpdateRegion>& updateRegions);
+
         //! Terrain SRG input.
         AZ::RHI::ShaderInputNameIndex m_terrainSrgClipmapDataIndex = ClipmapDataShaderInput;
         AZ::RHI::ShaderInputNameIndex m_terrainSrgClipmapImageIndex[ClipmapName::Count];
@@ -355,6 +363,9 @@ namespace Terrain
         bool m_isInitialized = false;
         //! Flag to generate the full clipmap in situation such as first frame and material update.
         bool m_fullRefreshClipmaps = true;
+        //! World space region that changed since the last update. Only the parts of it that aren't already regenerated
+        //! because of camera movement get regenerated in each clipmap level.
+        AZ::Aabb m_dirtyRegion = AZ::Aabb::CreateNull();
 
         //! Dispatch threads for the compute pass.
         uint32_t m_macroTotalDispatchThreadX = 0;
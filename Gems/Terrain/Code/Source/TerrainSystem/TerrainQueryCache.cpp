@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TerrainSystem/TerrainQueryCache.h>
+#include <AzCore/Console/Console.h>
+
+namespace Terrain
+{
+    AZ_CVAR(
+        bool,
+        bg_terrainQueryCacheEnabled,
+        true,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "Cache the terrain heights and surface weights queried at terrain grid points, so repeated queries of static terrain don't recompute them.");
+
+    AZ_CVAR(
+        uint32_t,
+        bg_terrainHeightCacheMaxTiles,
+        2048,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "The maximum number of 32x32 grid point tiles of cached terrain heights. The oldest tiles are evicted first.");
+
+    AZ_CVAR(
+        uint32_t,
+        bg_terrainSurfaceCacheMaxTiles,
+        64,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "The maximum number of 32x32 grid point tiles of cached terrain surface weights. The oldest tiles are evicted first.");
+
+    void TerrainQueryCache::SetQueryResolutions(float heightQueryResolution, float surfaceDataQueryResolution)
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_cacheMutex);
+
+        if (heightQueryResolution != m_heightQueryResolution)
+        {
+            m_heightQueryResolution = heightQueryResolution;
+            m_heightTiles.Clear();
+            ++m_generation;
+        }
+
+        if (surfaceDataQueryResolution != m_surfaceDataQueryResolution)
+        {
+            m_surfaceDataQueryResolution = surfaceDataQueryResolution;
+            m_surfaceTiles.Clear();
+            ++m_generation;
+        }
+    }
+
+    void TerrainQueryCache::Clear()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_cacheMutex);
+
+        m_heightTiles.Clear();
+        m_surfaceTiles.Clear();
+        ++m_generation;
+    }
+
+    void TerrainQueryCache::Invalidate(const AZ::Aabb& region, bool invalidateHeights, bool invalidateSurfaceData)
+    {
+        if (!region.IsValid())
+        {
+            return;
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_cacheMutex);
+
+        if (invalidateHeights)
+        {
+            InvalidateTiles(m_heightTiles, region, m_heightQueryResolution);
+        }
+
+        if (invalidateSurfaceData)
+        {
+            InvalidateTiles(m_surfaceTiles, region, m_surfaceDataQueryResolution);
+        }
+
+        ++m_generation;
+    }
+
+    uint32_t TerrainQueryCache::GetGeneration() const
+    {
+        return m_generation;
+    }
+
+    size_t TerrainQueryCache::FindHeights(
+        float queryResolution, AZStd::span<AZ::Vector3> positions, AZStd::span<bool> terrainExists, AZStd::span<bool> found) const
+    {
+        if (!bg_terrainQueryCacheEnabled)
+        {
+            return 0;
+        }
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_cacheMutex);
+
+        if (m_heightTiles.m_tiles.empty() || (queryResolution != m_heightQueryResolution))
+        {
+            return 0;
+        }
+
+        size_t foundCount = 0;
+
+        // Consecutive positions are usually in the same tile, so keep the last tile around to avoid most of the map lookups.
+        uint64_t lastTileKey = 0;
+        const HeightTile* lastTile = nullptr;
+        bool hasLastTile = false;
+
+        for (size_t index = 0; index < positions.size(); index++)
+        {
+            uint64_t tileKey;
+            size_t pointIndex;
+            if (!GetGridLocation(positions[index], queryResolution, tileKey, pointIndex))
+            {
+                continue;
+            }
+
+            if (!hasLastTile || (tileKey != lastTileKey))
+            {
+                auto tileIter = m_heightTiles.m_tiles.find(tileKey);
+                lastTile = (tileIter != m_heightTiles.m_tiles.end()) ? tileIter->second.get() : nullptr;
+                lastTileKey = tileKey;
+                hasLastTile = true;
+            }
+
+            if (lastTile && lastTile->m_cached[pointIndex])
+            {
+                positions[index].SetZ(lastTile->m_heights[pointIndex]);
+                terrainExists[index] = lastTile->m_exists[pointIndex];
+                found[index] = true;
+                foundCount++;
+            }
+        }
+
+        return foundCount;
+    }
+
+    void TerrainQueryCache::StoreHeights(
+        float queryResolution, AZStd::span<const AZ::Vector3> positions, AZStd::span<const bool> terrainExists, uint32_t generation)
+    {
+        const size_t maxTileCount = bg_terrainHeightCacheMaxTiles;
+        if (!bg_terrainQueryCacheEnabled || (maxTileCount == 0))
+        {
+            return;
+        }
+
+        // Only take the lock once a grid point is found, since most exact queries don't contain any.
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_cacheMutex, AZStd::defer_lock);
+
+        uint64_t lastTileKey = 0;
+        HeightTile* lastTile = nullptr;
+
+        for (size_t index = 0; index < positions.size(); index++)
+        {
+            uint64_t tileKey;
+            size_t pointIndex;
+            if (!GetGridLocation(positions[index], queryResolution, tileKey, pointIndex))
+            {
+                continue;
+            }
+
+            if (!lock.owns_lock())
+            {
+                lock.lock();
+
+                // The data is stale if the cache was invalidated since it was queried.
+                if ((generation != m_generation) || (queryResolution != m_heightQueryResolution))
+                {
+                    return;
+                }
+            }
+
+            if (!lastTile || (tileKey != lastTileKey))
+            {
+                lastTile = FindOrCreateTile(m_heightTiles, tileKey, maxTileCount);
+                lastTileKey = tileKey;
+            }
+
+            lastTile->m_heights[pointIndex] = positions[index].GetZ();
+            lastTile->m_exists[pointIndex] = terrainExists[index];
+            lastTile->m_cached[pointIndex] = true;
+        }
+    }
+
+    size_t TerrainQueryCache::FindSurfaceWeights(
+        float queryResolution,
+        AZStd::span<const AZ::Vector3> positions,
+        AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeights,
+        AZStd::span<bool> found) const
+    {
+        if (!bg_terrainQueryCacheEnabled)
+        {
+            return 0;
+        }
+
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_cacheMutex);
+
+        if (m_surfaceTiles.m_tiles.empty() || (queryResolution != m_surfaceDataQueryResolution))
+        {
+            return 0;
+        }
+
+        size_t foundCount = 0;
+
+        uint64_t lastTileKey = 0;
+        const SurfaceTile* lastTile = nullptr;
+        bool hasLastTile = false;
+
+        for (size_t index = 0; index < positions.size(); index++)
+        {
+            uint64_t tileKey;
+            size_t pointIndex;
+            if (!GetGridLocation(positions[index], queryResolution, tileKey, pointIndex))
+            {
+                continue;
+            }
+
+            if (!hasLastTile || (tileKey != lastTileKey))
+            {
+                auto tileIter = m_surfaceTiles.m_tiles.find(tileKey);
+                lastTile = (tileIter != m_surfaceTiles.m_tiles.end()) ? tileIter->second.get() : nullptr;
+                lastTileKey = tileKey;
+                hasLastTile = true;
+            }
+
+            if (lastTile && lastTile->m_cached[pointIndex])
+            {
+                surfaceWeights[index] = lastTile->m_weights[pointIndex];
+                found[index] = true;
+                foundCount++;
+            }
+        }
+
+        return foundCount;
+    }
+
+    void TerrainQueryCache::StoreSurfaceWeights(
+        float queryResolution,
+        AZStd::span<const AZ::Vector3> positions,
+        AZStd::span<const AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeights,
+        uint32_t generation)
+    {
+        const size_t maxTileCount = bg_terrainSurfaceCacheMaxTiles;
+        if (!bg_terrainQueryCacheEnabled || (maxTileCount == 0))
+        {
+            return;
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_cacheMutex, AZStd::defer_lock);
+
+        uint64_t lastTileKey = 0;
+        SurfaceTile* lastTile = nullptr;
+
+        for (size_t index = 0; index < positions.size(); index++)
+        {
+            uint64_t tileKey;
+            size_t pointIndex;
+            if (!GetGridLocation(positions[index], queryResolution, tileKey, pointIndex))
+            {
+                continue;
+            }
+
+            if (!lock.owns_lock())
+            {
+                lock.lock();
+
+                if ((generation != m_generation) || (queryResolution != m_surfaceDataQueryResolution))
+                {
+                    return;
+                }
+            }
+
+            if (!lastTile || (tileKey != lastTileKey))
+            {
+                lastTile = FindOrCreateTile(m_surfaceTiles, tileKey, maxTileCount);
+                lastTileKey = tileKey;
+            }
+
+            lastTile->m_weights[pointIndex] = surfaceWeights[index];
+            lastTile->m_cached[pointIndex] = true;
+        }
+    }
+
+    bool TerrainQueryCache::GetGridLocation(const AZ::Vector3& position, float queryResolution, uint64_t& tileKey, size_t& pointIndex)
+    {
+        // Grid points are generated by TerrainSystem::ClampPosition() and RoundPosition() as integer multiples of the query resolution,
+        // so a position is a grid point when rescaling its nearest grid index reproduces the position exactly.
+        const float gridX = floorf((position.GetX() / queryResolution) + 0.5f);
+        const float gridY = floorf((position.GetY() / queryResolution) + 0.5f);
+        if ((gridX * queryResolution != position.GetX()) || (gridY * queryResolution != position.GetY()))
+        {
+            return false;
+        }
+
+        // Keep the tile coordinates well within the range of an int32.
+        constexpr float MaxGridIndex = 1.0e9f;
+        if (fabsf(gridX) > MaxGridIndex || fabsf(gridY) > MaxGridIndex)
+        {
+            return false;
+        }
+
+        const int32_t x = aznumeric_cast<int32_t>(gridX);
+        const int32_t y = aznumeric_cast<int32_t>(gridY);
+        const int32_t tileX = aznumeric_cast<int32_t>(floorf(gridX / TileSize));
+        const int32_t tileY = aznumeric_cast<int32_t>(floorf(gridY / TileSize));
+
+        tileKey = (static_cast<uint64_t>(static_cast<uint32_t>(tileX)) << 32) | static_cast<uint32_t>(tileY);
+        pointIndex = static_cast<size_t>(((y - (tileY * TileSize)) * TileSize) + (x - (tileX * TileSize)));
+        return true;
+    }
+
+    template<typename TileType>
+    TileType* TerrainQueryCache::FindOrCreateTile(TileMap<TileType>& tileMap, uint64_t tileKey, size_t maxTileCount)
+    {
+        auto tileIter = tileMap.m_tiles.find(tileKey);
+        if (tileIter != tileMap.m_tiles.end())
+        {
+            return tileIter->second.get();
+        }
+
+        // Evict the oldest tiles to stay within the budget.
+        while ((tileMap.m_tiles.size() >= maxTileCount) && !tileMap.m_creationOrder.empty())
+        {
+            tileMap.m_tiles.erase(tileMap.m_creationOrder.front());
+            tileMap.m_creationOrder.pop_front();
+        }
+
+        auto tile = AZStd::make_unique<TileType>();
+        TileType* tilePtr = tile.get();
+        tileMap.m_tiles.emplace(tileKey, AZStd::move(tile));
+        tileMap.m_creationOrder.push_back(tileKey);
+        return tilePtr;
+    }
+
+    template<typename TileType>
+    void TerrainQueryCache::InvalidateTiles(TileMap<TileType>& tileMap, const AZ::Aabb& region, float queryResolution)
+    {
+        if (tileMap.m_tiles.empty())
+        {
+            return;
+        }
+
+        // Get the range of tiles containing every grid point that lies within the region, including the points on its edges.
+        const float minTileX = floorf(floorf(region.GetMin().GetX() / queryResolution) / TileSize);
+        const float minTileY = floorf(floorf(region.GetMin().GetY() / queryResolution) / TileSize);
+        const float maxTileX = floorf(ceilf(region.GetMax().GetX() / queryResolution) / TileSize);
+        const float maxTileY = floorf(ceilf(region.GetMax().GetY() / queryResolution) / TileSize);
+
+        AZStd::erase_if(
+            tileMap.m_tiles,
+            [=](const auto& item)
+            {
+                const float tileX = static_cast<float>(static_cast<int32_t>(static_cast<uint32_t>(item.first >> 32)));
+                const float tileY = static_cast<float>(static_cast<int32_t>(static_cast<uint32_t>(item.first)));
+                return (tileX >= minTileX) && (tileX <= maxTileX) && (tileY >= minTileY) && (tileY <= maxTileY);
+            });
+
+        AZStd::erase_if(
+            tileMap.m_creationOrder,
+            [&tileMap](uint64_t tileKey)
+            {
+                return tileMap.m_tiles.find(tileKey) == tileMap.m_tiles.end();
+            });
+    }
+} // namespace Terrain
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/bitset.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzFramework/SurfaceData/SurfaceData.h>
+
+namespace Terrain
+{
+    //! Caches the terrain heights and surface weights that have been queried at terrain query grid points, so that the
+    //! different consumers of static terrain (physics heightfields, vegetation, the clipmaps, ...) share the results
+    //! instead of each walking the gradient chains of the terrain areas for the same points.
+    //! The data is stored in square tiles of grid points. Only positions that lie exactly on a query grid are cached,
+    //! so a cached result is always identical to the result of querying the terrain areas directly.
+    class TerrainQueryCache
+    {
+    public:
+        //! The number of grid points along each side of a cache tile.
+        static constexpr int32_t TileSize = 32;
+
+        TerrainQueryCache() = default;
+        ~TerrainQueryCache() = default;
+        AZ_DISABLE_COPY_MOVE(TerrainQueryCache);
+
+        //! Sets the grid spacings of the cached data, and clears the cache if either of them changed.
+        void SetQueryResolutions(float heightQueryResolution, float surfaceDataQueryResolution);
+
+        //! Removes all the cached data.
+        void Clear();
+
+        //! Removes the cached data of every tile that overlaps the given region in XY.
+        void Invalidate(const AZ::Aabb& region, bool invalidateHeights, bool invalidateSurfaceData);
+
+        //! Returns the current generation of the cache, which changes with every invalidation.
+        //! The generation must be read before querying the data that gets stored, so that data which was queried before
+        //! an invalidation is never stored after it.
+        uint32_t GetGeneration() const;
+
+        //! Looks up the heights of the given positions. For each position that is found, its Z is set to the cached height,
+        //! and its terrainExists and found flags are set.
+        //! @return The number of positions that were found in the cache.
+        size_t FindHeights(
+            float queryResolution, AZStd::span<AZ::Vector3> positions, AZStd::span<bool> terrainExists, AZStd::span<bool> found) const;
+
+        //! Stores the heights (in Z) and terrainExists flags of the given positions that lie on the height query grid.
+        void StoreHeights(
+            float queryResolution, AZStd::span<const AZ::Vector3> positions, AZStd::span<const bool> terrainExists, uint32_t generation);
+
+        //! Looks up the surface weights of the given positions. For each position that is found, its surface weights and
+        //! found flag are set.
+        //! @return The number of positions that were found in the cache.
+        size_t FindSurfaceWeights(
+            float queryResolution,
+            AZStd::span<const AZ::Vector3> positions,
+            AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeights,
+            AZStd::span<bool> found) const;
+
+        //! Stores the surface weights of the given positions that lie on the surface data query grid.
+        void StoreSurfaceWeights(
+            float queryResolution,
+            AZStd::span<const AZ::Vector3> positions,
+            AZStd::span<const AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeights,
+            uint32_t generation);
+
+    private:
+        static constexpr size_t TilePointCount = TileSize * TileSize;
+
+        struct HeightTile
+        {
+            AZStd::array<float, TilePointCount> m_heights;
+            AZStd::bitset<TilePointCount> m_cached;
+            AZStd::bitset<TilePointCount> m_exists;
+        };
+
+        struct SurfaceTile
+        {
+            AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> m_weights =
+                AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList>(TilePointCount);
+            AZStd::bitset<TilePointCount> m_cached;
+        };
+
+        template<typename TileType>
+        struct TileMap
+        {
+            void Clear()
+            {
+                m_tiles.clear();
+                m_creationOrder.clear();
+            }
+
+            AZStd::unordered_map<uint64_t, AZStd::unique_ptr<TileType>> m_tiles;
+            AZStd::deque<uint64_t> m_creationOrder; //!< Tile keys from oldest to newest, used to evict tiles.
+        };
+
+        //! Gets the tile key and the index within the tile of a position on the query grid.
+        //! @return False if the position doesn't lie exactly on the query grid.
+        static bool GetGridLocation(const AZ::Vector3& position, float queryResolution, uint64_t& tileKey, size_t& pointIndex);
+
+        template<typename TileType>
+        static TileType* FindOrCreateTile(TileMap<TileType>& tileMap, uint64_t tileKey, size_t maxTileCount);
+
+        template<typename TileType>
+        static void InvalidateTiles(TileMap<TileType>& tileMap, const AZ::Aabb& region, float queryResolution);
+
+        mutable AZStd::shared_mutex m_cacheMutex;
+        TileMap<HeightTile> m_heightTiles;
+        TileMap<SurfaceTile> m_surfaceTiles;
+        float m_heightQueryResolution = 1.0f;
+        float m_surfaceDataQueryResolution = 1.0f;
+        AZStd::atomic<uint32_t> m_generation{ 0 };
+    };
+} // namespace Terrain
@@ -88,6 +88,8 @@ void TerrainSystem::Activate()
     m_terrainDirtyMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All;
     m_requestedSettings.m_systemActive = true;
     m_cachedAreaBounds = AZ::Aabb::CreateNull();
+    m_queryCache.Clear();
+    m_terrainRaycastContext.ClearCachedHeightBounds();
 
     {
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_areaMutex);
@@ -138,6 +140,8 @@ void TerrainSystem::Deactivate()
     m_dirtyRegion = AZ::Aabb::CreateNull();
     m_terrainDirtyMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All;
     m_requestedSettings.m_systemActive = false;
+    m_queryCache.Clear();
+    m_terrainRaycastContext.ClearCachedHeightBounds();
 
     AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
         &AzFramework::Terrain::TerrainDataNotificationBus::Events::OnTerrainDataDestroyEnd);
@@ -447,6 +451,12 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
 
     GenerateQueryPositions(inPositions, outPositions, queryResolution, sampler);
 
+    // Fill in the grid points that earlier queries have already computed. The generation needs to be read before querying
+    // the terrain areas, so that results computed before a concurrent invalidation don't get stored in the cache.
+    const uint32_t cacheGeneration = m_queryCache.GetGeneration();
+    AZStd::vector<bool> foundInCache(outPositions.size(), false);
+    const size_t foundCount = m_queryCache.FindHeights(queryResolution, outPositions, outTerrainExists, foundInCache);
+
     auto callback = [this]([[maybe_unused]] const AZStd::span<const AZ::Vector3> inPositions,
                         AZStd::span<AZ::Vector3> outPositions,
                         AZStd::span<bool> outTerrainExists,
@@ -481,7 +491,37 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
 
     // This will be unused for heights. It's fine if it's empty.
     AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights;
-    MakeBulkQueries(outPositions, outPositions, outTerrainExists, outSurfaceWeights, callback);
+    if (foundCount == 0)
+    {
+        MakeBulkQueries(outPositions, outPositions, outTerrainExists, outSurfaceWeights, callback);
+        m_queryCache.StoreHeights(queryResolution, outPositions, outTerrainExists, cacheGeneration);
+    }
+    else if (foundCount < outPositions.size())
+    {
+        // Only query the positions that weren't found in the cache, then copy the results back.
+        AZStd::vector<AZ::Vector3> uncachedPositions;
+        AZStd::vector<size_t> uncachedIndices;
+        uncachedPositions.reserve(outPositions.size() - foundCount);
+        uncachedIndices.reserve(outPositions.size() - foundCount);
+        for (size_t index = 0; index < outPositions.size(); index++)
+        {
+            if (!foundInCache[index])
+            {
+                uncachedPositions.emplace_back(outPositions[index]);
+                uncachedIndices.emplace_back(index);
+            }
+        }
+
+        AZStd::vector<bool> uncachedTerrainExists(uncachedPositions.size(), false);
+        MakeBulkQueries(uncachedPositions, uncachedPositions, uncachedTerrainExists, outSurfaceWeights, callback);
+        m_queryCache.StoreHeights(queryResolution, uncachedPositions, uncachedTerrainExists, cacheGeneration);
+
+        for (size_t index = 0; index < uncachedIndices.size(); index++)
+        {
+            outPositions[uncachedIndices[index]] = uncachedPositions[index];
+            outTerrainExists[uncachedIndices[index]] = uncachedTerrainExists[index];
+        }
+    }
 
     // Compute/store the final result
     for (size_t i = 0, iteratorIndex = 0; i < inPositions.size(); i++, iteratorIndex += indexStepSize)
@@ -1102,6 +1142,13 @@ AzFramework::RenderGeometry::RayResult TerrainSystem::GetClosestIntersection(
     return m_terrainRaycastContext.RayIntersect(ray);
 }
 
+void TerrainSystem::GetClosestIntersections(
+    AZStd::span<const AzFramework::RenderGeometry::RayRequest> rays,
+    AZStd::span<AzFramework::RenderGeometry::RayResult> results) const
+{
+    m_terrainRaycastContext.RayIntersect(rays, results);
+}
+
 AZStd::shared_ptr<AzFramework::Terrain::TerrainJobContext> TerrainSystem::QueryListAsync(
     const AZStd::span<const AZ::Vector3>& inPositions,
     TerrainDataMask requestedData,
@@ -1303,9 +1350,44 @@ void TerrainSystem::GetOrderedSurfaceWeightsFromList(
                             }
                         };
     
+    // Fill in the grid points that earlier queries have already computed.
+    const uint32_t cacheGeneration = m_queryCache.GetGeneration();
+    AZStd::vector<bool> foundInCache(queryPositions.size(), false);
+    const size_t foundCount = m_queryCache.FindSurfaceWeights(queryResolution, queryPositions, outSurfaceWeightsList, foundInCache);
+
     // This will be unused for surface weights. It's fine if it's empty.
     AZStd::vector<AZ::Vector3> outPositions;
-    MakeBulkQueries(queryPositions, outPositions, terrainExists, outSurfaceWeightsList, callback);
+    if (foundCount == 0)
+    {
+        MakeBulkQueries(queryPositions, outPositions, terrainExists, outSurfaceWeightsList, callback);
+        m_queryCache.StoreSurfaceWeights(queryResolution, queryPositions, outSurfaceWeightsList, cacheGeneration);
+    }
+    else if (foundCount < queryPositions.size())
+    {
+        // Only query the positions that weren't found in the cache, then move the results back.
+        AZStd::vector<AZ::Vector3> uncachedPositions;
+        AZStd::vector<size_t> uncachedIndices;
+        uncachedPositions.reserve(queryPositions.size() - foundCount);
+        uncachedIndices.reserve(queryPositions.size() - foundCount);
+        for (size_t index = 0; index < queryPositions.size(); index++)
+        {
+            if (!foundInCache[index])
+            {
+                uncachedPositions.emplace_back(queryPositions[index]);
+                uncachedIndices.emplace_back(index);
+            }
+        }
+
+        AZStd::vector<bool> uncachedTerrainExists;
+        AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> uncachedSurfaceWeights(uncachedPositions.size());
+        MakeBulkQueries(uncachedPositions, outPositions, uncachedTerrainExists, uncachedSurfaceWeights, callback);
+        m_queryCache.StoreSurfaceWeights(queryResolution, uncachedPositions, uncachedSurfaceWeights, cacheGeneration);
+
+        for (size_t index = 0; index < uncachedIndices.size(); index++)
+        {
+            outSurfaceWeightsList[uncachedIndices[index]] = AZStd::move(uncachedSurfaceWeights[index]);
+        }
+    }
 }
 
 void TerrainSystem::GetOrderedSurfaceWeights(
@@ -1686,6 +1768,8 @@ void TerrainSystem::RegisterArea(AZ::EntityId areaId)
 
     m_registeredAreas[areaId] = { aabb, useGroundPlane };
     m_dirtyRegion.AddAabb(aabb);
+    m_queryCache.Invalidate(aabb, true, true);
+    m_terrainRaycastContext.InvalidateRegion(aabb);
     m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
         AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
     m_cachedAreaBounds.AddAabb(aabb);
@@ -1706,6 +1790,8 @@ void TerrainSystem::UnregisterArea(AZ::EntityId areaId)
             if (areaId == entityId)
             {
                 m_dirtyRegion.AddAabb(areaData.m_areaBounds);
+                m_queryCache.Invalidate(areaData.m_areaBounds, true, true);
+                m_terrainRaycastContext.InvalidateRegion(areaData.m_areaBounds);
                 m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
                     AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
 
@@ -1761,6 +1847,20 @@ void TerrainSystem::RefreshRegion(
 {
     m_dirtyRegion.AddAabb(dirtyRegion);
 
+    // Drop the cached data right away instead of on the next tick, so that queries never return data that was already refreshed.
+    m_queryCache.Invalidate(
+        dirtyRegion,
+        (changeMask & AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData) ==
+            AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData,
+        (changeMask & AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData) ==
+            AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData);
+
+    if ((changeMask & AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData) ==
+        AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData)
+    {
+        m_terrainRaycastContext.InvalidateRegion(dirtyRegion);
+    }
+
     // Keep track of which types of data have changed so that we can send out the appropriate notifications later.
     m_terrainDirtyMask |= changeMask;
 }
@@ -1804,6 +1904,11 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
         }
 
         m_currentSettings = m_requestedSettings;
+
+        // The query resolutions and the height range all affect the queried data, so start over with an empty cache.
+        m_queryCache.SetQueryResolutions(m_currentSettings.m_heightQueryResolution, m_currentSettings.m_surfaceDataQueryResolution);
+        m_queryCache.Clear();
+        m_terrainRaycastContext.ClearCachedHeightBounds();
     }
 
     if (terrainSettingsChanged || (m_terrainDirtyMask != AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::None))
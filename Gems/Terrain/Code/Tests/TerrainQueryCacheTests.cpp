@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <gmock/gmock.h>
+
+#include <TerrainSystem/TerrainQueryCache.h>
+
+#include <AzCore/std/containers/array.h>
+
+namespace UnitTest
+{
+    class TerrainQueryCacheTests
+        : public LeakDetectionFixture
+    {
+    protected:
+        static constexpr float QueryResolution = 0.5f;
+
+        void SetUp() override
+        {
+            LeakDetectionFixture::SetUp();
+            m_cache = AZStd::make_unique<Terrain::TerrainQueryCache>();
+            m_cache->SetQueryResolutions(QueryResolution, QueryResolution);
+        }
+
+        void TearDown() override
+        {
+            m_cache.reset();
+            LeakDetectionFixture::TearDown();
+        }
+
+        // Stores the given heights for the grid points (0.5, 1.0) and (40.0, 40.0), which are in different cache tiles.
+        void StoreTestHeights(float height1, float height2, uint32_t generation)
+        {
+            const AZStd::array<AZ::Vector3, 2> positions = { AZ::Vector3(0.5f, 1.0f, height1), AZ::Vector3(40.0f, 40.0f, height2) };
+            const AZStd::array<bool, 2> terrainExists = { true, false };
+            m_cache->StoreHeights(QueryResolution, positions, terrainExists, generation);
+        }
+
+        // Looks up the heights of the grid points stored by StoreTestHeights, returning the number of found points.
+        size_t FindTestHeights(AZStd::array<AZ::Vector3, 2>& positions, AZStd::array<bool, 2>& found)
+        {
+            positions = { AZ::Vector3(0.5f, 1.0f, 0.0f), AZ::Vector3(40.0f, 40.0f, 0.0f) };
+            AZStd::array<bool, 2> terrainExists = { false, false };
+            found = { false, false };
+            return m_cache->FindHeights(QueryResolution, positions, terrainExists, found);
+        }
+
+        AZStd::unique_ptr<Terrain::TerrainQueryCache> m_cache;
+    };
+
+    TEST_F(TerrainQueryCacheTests, FindHeights_StoredGridPoints_ReturnsStoredHeights)
+    {
+        StoreTestHeights(3.0f, 7.0f, m_cache->GetGeneration());
+
+        AZStd::array<AZ::Vector3, 2> positions;
+        AZStd::array<bool, 2> found;
+        AZStd::array<bool, 2> terrainExists = { false, true };
+        positions = { AZ::Vector3(0.5f, 1.0f, 0.0f), AZ::Vector3(40.0f, 40.0f, 0.0f) };
+        found = { false, false };
+        EXPECT_EQ(m_cache->FindHeights(QueryResolution, positions, terrainExists, found), 2);
+        EXPECT_TRUE(found[0]);
+        EXPECT_TRUE(found[1]);
+        EXPECT_FLOAT_EQ(positions[0].GetZ(), 3.0f);
+        EXPECT_FLOAT_EQ(positions[1].GetZ(), 7.0f);
+        EXPECT_TRUE(terrainExists[0]);
+        EXPECT_FALSE(terrainExists[1]);
+    }
+
+    TEST_F(TerrainQueryCacheTests, FindHeights_PositionsOffGridOrAtOtherResolution_AreNotFound)
+    {
+        StoreTestHeights(3.0f, 7.0f, m_cache->GetGeneration());
+
+        // Positions between grid points are never stored or found.
+        AZStd::array<AZ::Vector3, 1> positions = { AZ::Vector3(0.75f, 1.0f, 0.0f) };
+        AZStd::array<bool, 1> terrainExists = { false };
+        AZStd::array<bool, 1> found = { false };
+        EXPECT_EQ(m_cache->FindHeights(QueryResolution, positions, terrainExists, found), 0);
+        EXPECT_FALSE(found[0]);
+
+        // Grid points of a different query resolution aren't found either.
+        positions = { AZ::Vector3(0.5f, 1.0f, 0.0f) };
+        EXPECT_EQ(m_cache->FindHeights(QueryResolution * 0.5f, positions, terrainExists, found), 0);
+        EXPECT_FALSE(found[0]);
+    }
+
+    TEST_F(TerrainQueryCacheTests, Invalidate_RegionOverlapsOneTile_OnlyThatTileIsRemoved)
+    {
+        StoreTestHeights(3.0f, 7.0f, m_cache->GetGeneration());
+
+        // The region only overlaps the tile of the first point.
+        m_cache->Invalidate(AZ::Aabb::CreateFromMinMaxValues(0.0f, 0.0f, -10.0f, 1.0f, 1.0f, 10.0f), true, false);
+
+        AZStd::array<AZ::Vector3, 2> positions;
+        AZStd::array<bool, 2> found;
+        EXPECT_EQ(FindTestHeights(positions, found), 1);
+        EXPECT_FALSE(found[0]);
+        EXPECT_TRUE(found[1]);
+        EXPECT_FLOAT_EQ(positions[1].GetZ(), 7.0f);
+    }
+
+    TEST_F(TerrainQueryCacheTests, Invalidate_SurfaceDataOnly_HeightsStayCached)
+    {
+        StoreTestHeights(3.0f, 7.0f, m_cache->GetGeneration());
+
+        m_cache->Invalidate(AZ::Aabb::CreateFromMinMaxValues(-100.0f, -100.0f, -10.0f, 100.0f, 100.0f, 10.0f), false, true);
+
+        AZStd::array<AZ::Vector3, 2> positions;
+        AZStd::array<bool, 2> found;
+        EXPECT_EQ(FindTestHeights(positions, found), 2);
+    }
+
+    TEST_F(TerrainQueryCacheTests, StoreHeights_InvalidatedAfterGenerationWasRead_StaleHeightsAreDropped)
+    {
+        // A query reads the generation, then the region gets invalidated while the query computes its heights.
+        const uint32_t generation = m_cache->GetGeneration();
+        m_cache->Invalidate(AZ::Aabb::CreateFromMinMaxValues(0.0f, 0.0f, -10.0f, 1.0f, 1.0f, 10.0f), true, true);
+        EXPECT_NE(generation, m_cache->GetGeneration());
+
+        // The heights computed before the invalidation must not be stored, not even the ones outside of the invalidated region.
+        StoreTestHeights(3.0f, 7.0f, generation);
+
+        AZStd::array<AZ::Vector3, 2> positions;
+        AZStd::array<bool, 2> found;
+        EXPECT_EQ(FindTestHeights(positions, found), 0);
+
+        // Heights queried after the invalidation are stored.
+        StoreTestHeights(3.0f, 7.0f, m_cache->GetGeneration());
+        EXPECT_EQ(FindTestHeights(positions, found), 2);
+    }
+
+    TEST_F(TerrainQueryCacheTests, SetQueryResolutions_HeightResolutionChanged_HeightsAreCleared)
+    {
+        StoreTestHeights(3.0f, 7.0f, m_cache->GetGeneration());
+
+        m_cache->SetQueryResolutions(QueryResolution * 2.0f, QueryResolution);
+        m_cache->SetQueryResolutions(QueryResolution, QueryResolution);
+
+        AZStd::array<AZ::Vector3, 2> positions;
+        AZStd::array<bool, 2> found;
+        EXPECT_EQ(FindTestHeights(positions, found), 0);
+    }
+
+    TEST_F(TerrainQueryCacheTests, FindSurfaceWeights_StoredGridPoints_ReturnsStoredWeights)
+    {
+        AzFramework::SurfaceData::SurfaceTagWeight tagWeight;
+        tagWeight.m_surfaceType = AZ::Crc32("tag1");
+        tagWeight.m_weight = 0.75f;
+
+        const AZStd::array<AZ::Vector3, 1> positions = { AZ::Vector3(1.5f, -2.0f, 0.0f) };
+        AZStd::array<AzFramework::SurfaceData::SurfaceTagWeightList, 1> storedWeights;
+        storedWeights[0].push_back(tagWeight);
+        m_cache->StoreSurfaceWeights(QueryResolution, positions, storedWeights, m_cache->GetGeneration());
+
+        AZStd::array<AzFramework::SurfaceData::SurfaceTagWeightList, 1> foundWeights;
+        AZStd::array<bool, 1> found = { false };
+        EXPECT_EQ(m_cache->FindSurfaceWeights(QueryResolution, positions, foundWeights, found), 1);
+        ASSERT_EQ(foundWeights[0].size(), 1);
+        EXPECT_EQ(foundWeights[0][0].m_surfaceType, tagWeight.m_surfaceType);
+        EXPECT_FLOAT_EQ(foundWeights[0][0].m_weight, tagWeight.m_weight);
+
+        // Invalidating the heights leaves the surface weights cached, invalidating the surface data removes them.
+        const AZ::Aabb region = AZ::Aabb::CreateFromMinMaxValues(0.0f, -3.0f, -10.0f, 2.0f, 0.0f, 10.0f);
+        m_cache->Invalidate(region, true, false);
+        EXPECT_EQ(m_cache->FindSurfaceWeights(QueryResolution, positions, foundWeights, found), 1);
+        m_cache->Invalidate(region, false, true);
+        found = { false };
+        EXPECT_EQ(m_cache->FindSurfaceWeights(QueryResolution, positions, foundWeights, found), 0);
+        EXPECT_FALSE(found[0]);
+    }
+} // namespace UnitTest
@@ -461,6 +461,76 @@ namespace UnitTest
         }
     }
 
+    TEST_F(TerrainSystemTest, TerrainHeightQueriesOnQueryGridAreCachedUntilTheRegionIsRefreshed)
+    {
+        // Verify that the heights of grid points are cached between queries, and that refreshing a region or registering an area
+        // drops the cached heights within it.
+
+        float mockHeight = 1.0f;
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-10.0f, -10.0f, -20.0f, 10.0f, 10.0f, 20.0f);
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [&mockHeight](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(mockHeight);
+                terrainExists = true;
+            });
+
+        const float queryResolution = 1.0f;
+        auto terrainSystem = CreateAndActivateTerrainSystem(queryResolution);
+
+        // The single position height queries don't use the cache, so query a list containing the grid point.
+        const AZ::Vector3 gridPoint(2.0f, 3.0f, 0.0f);
+        bool gridPointExists = false;
+        auto queryGridHeight = [&terrainSystem, &gridPoint, &gridPointExists]()
+        {
+            float height = 0.0f;
+            terrainSystem->QueryList(
+                AZStd::span<const AZ::Vector3>(&gridPoint, 1), AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights,
+                [&height, &gridPointExists](const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+                {
+                    height = surfacePoint.m_position.GetZ();
+                    gridPointExists = terrainExists;
+                },
+                AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP);
+            return height;
+        };
+
+        constexpr float epsilon = 0.0001f;
+        EXPECT_NEAR(queryGridHeight(), 1.0f, epsilon);
+
+        // Nothing notified the terrain system of the change, so the grid point comes from the cache, while a position between
+        // grid points queries the terrain area.
+        mockHeight = 5.0f;
+        EXPECT_NEAR(queryGridHeight(), 1.0f, epsilon);
+        EXPECT_NEAR(
+            terrainSystem->GetHeight(AZ::Vector3(2.5f, 3.5f, 0.0f), AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT),
+            5.0f, epsilon);
+
+        // Refreshing the surface data, or the heights of a region far from the grid point, keeps the cached height.
+        terrainSystem->RefreshRegion(spawnerBox, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData);
+        EXPECT_NEAR(queryGridHeight(), 1.0f, epsilon);
+        terrainSystem->RefreshRegion(
+            AZ::Aabb::CreateFromMinMaxValues(100.0f, 100.0f, -20.0f, 110.0f, 110.0f, 20.0f),
+            AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData);
+        EXPECT_NEAR(queryGridHeight(), 1.0f, epsilon);
+
+        // Refreshing the heights of a region containing the grid point drops the cached height right away.
+        terrainSystem->RefreshRegion(
+            AZ::Aabb::CreateFromMinMaxValues(1.0f, 1.0f, -20.0f, 4.0f, 4.0f, 20.0f),
+            AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData);
+        EXPECT_NEAR(queryGridHeight(), 5.0f, epsilon);
+
+        // Registering an area drops the results cached within its bounds while it wasn't registered.
+        terrainSystem->UnregisterArea(entity->GetId());
+        queryGridHeight();
+        EXPECT_FALSE(gridPointExists);
+        mockHeight = 7.0f;
+        terrainSystem->RegisterArea(entity->GetId());
+        EXPECT_NEAR(queryGridHeight(), 7.0f, epsilon);
+        EXPECT_TRUE(gridPointExists);
+    }
+
     TEST_F(TerrainSystemTest, TerrainHeightQueriesWithBilinearSamplersUseQueryGridToInterpolate)
     {
         // Verify that when using the "BILINEAR" height sampler, the heights are interpolated from points sampled from the query grid.
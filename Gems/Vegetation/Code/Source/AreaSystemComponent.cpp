@@ -22,6 +22,8 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Console/Console.h>
+#include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/sort.h>
@@ -39,6 +41,15 @@
 
 namespace Vegetation
 {
+    AZ_CVAR(int32_t, veg_sectorPointPrefetchCount, 8, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The maximum number of vegetation sectors whose surface points are generated in parallel. Values of 1 or less generate "
+        "the surface points of one sector at a time.");
+
+    AZ_CVAR(bool, veg_incrementalSectorFill, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When a vegetation area changes, only claim the sector points within the changed bounds again instead of refilling "
+        "the whole sector. Points outside the changed bounds keep their instances, so filters that depend on nearby instances "
+        "can produce different results than a full refill.");
+
     namespace AreaSystemUtil
     {
         template <typename T>
@@ -97,9 +108,13 @@ namespace Vegetation
 
     //////////////////////////////////////////////////////////////////////////
     // DirtySectors
-    void AreaSystemComponent::DirtySectors::MarkDirty(const SectorId& sector)
+    void AreaSystemComponent::DirtySectors::MarkDirty(const SectorId& sector, const AZ::Aabb& dirtyBounds)
     {
-        m_dirtySet.insert(AZStd::move(sector));
+        auto [dirtyEntry, inserted] = m_dirtySet.emplace(sector, dirtyBounds);
+        if (!inserted)
+        {
+            dirtyEntry->second.AddAabb(dirtyBounds);
+        }
     }
 
     void AreaSystemComponent::DirtySectors::MarkAllDirty()
@@ -119,6 +134,17 @@ namespace Vegetation
             (!m_dirtySet.empty() && (m_dirtySet.find(sector) != m_dirtySet.end()));
     }
 
+    AZ::Aabb AreaSystemComponent::DirtySectors::GetDirtyBounds(const SectorId& sector) const
+    {
+        if (m_allSectorsDirty)
+        {
+            return AZ::Aabb::CreateNull();
+        }
+
+        auto dirtyEntry = m_dirtySet.find(sector);
+        return (dirtyEntry != m_dirtySet.end()) ? dirtyEntry->second : AZ::Aabb::CreateNull();
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // AreaSystemConfig
 
@@ -1082,13 +1108,20 @@ namespace Vegetation
         sectorInfo.m_bounds = GetSectorBounds(sectorId, sectorSizeInMeters);
         UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
 
+        return CreateSector(AZStd::move(sectorInfo));
+    }
+
+    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::CreateSector(SectorInfo&& preparedSectorInfo)
+    {
+        VEGETATION_PROFILE_FUNCTION_VERBOSE
+
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
-        SectorInfo& sectorInfoRef = m_sectorRollingWindow[sectorInfo.m_id] = AZStd::move(sectorInfo);
+        SectorInfo& sectorInfoRef = m_sectorRollingWindow[preparedSectorInfo.m_id] = AZStd::move(preparedSectorInfo);
         UpdateSectorCallbacks(sectorInfoRef);
         return &sectorInfoRef;
     }
 
-    void AreaSystemComponent::VegetationThreadTasks::UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode)
+    void AreaSystemComponent::VegetationThreadTasks::UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode) const
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
         const float vegStep = sectorSizeInMeters / static_cast<float>(sectorDensity);
@@ -1102,7 +1135,9 @@ namespace Vegetation
         // 0 = lower left corner, 0.5 = center
         const float texelOffset = (sectorPointSnapMode == SnapMode::Center) ? 0.5f : 0.0f;
 
-        SurfaceData::SurfacePointList availablePointsPerPosition;
+        auto* surfaceDataSystem = AZ::Interface<SurfaceData::SurfaceDataSystem>::Get();
+        SurfaceData::SurfacePointListPool::ListPtr pointList = surfaceDataSystem->AcquireSurfacePointList();
+        SurfaceData::SurfacePointList& availablePointsPerPosition = *pointList;
         AZ::Vector2 stepSize(vegStep, vegStep);
         AZ::Vector3 regionOffset(texelOffset * vegStep, texelOffset * vegStep, 0.0f);
         AZ::Aabb regionBounds = sectorInfo.m_bounds;
@@ -1116,7 +1151,7 @@ namespace Vegetation
         regionBounds.SetMax(regionBounds.GetMin() + AZ::Vector3(vegStep * (sectorDensity - 0.5f),
             vegStep * (sectorDensity - 0.5f), 0.0f));
 
-        AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->GetSurfacePointsFromRegion(
+        surfaceDataSystem->GetSurfacePointsFromRegion(
             regionBounds,
             stepSize,
             SurfaceData::SurfaceTagVector(),
@@ -1303,7 +1338,7 @@ namespace Vegetation
         }
     }
 
-    void AreaSystemComponent::VegetationThreadTasks::FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas)
+    void AreaSystemComponent::VegetationThreadTasks::FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas, const AZ::Aabb& fillBounds)
     {
         AZ_PROFILE_FUNCTION(Entity);
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillSectorStart, sectorInfo.GetSectorX(), sectorInfo.GetSectorY(), AZStd::chrono::steady_clock::now()));
@@ -1313,9 +1348,50 @@ namespace Vegetation
         //m_availablePoints is a free list initialized with the complete set of points in the sector.
         ClaimContext activeContext = sectorInfo.m_baseContext;
 
-        // Clear out the list of claimed world points before we begin
-        sectorInfo.m_claimedWorldPointsBeforeFill = sectorInfo.m_claimedWorldPoints;
-        sectorInfo.m_claimedWorldPoints.clear();
+        if (fillBounds.IsValid())
+        {
+            // Partial fill: only the points within the changed bounds get claimed again, and all other points keep their
+            // existing claims.  The bounds are only compared in XY because the surface points can be at any height.
+            AZStd::unordered_set<ClaimHandle> refilledHandles;
+            activeContext.m_availablePoints.erase(
+                AZStd::remove_if(
+                    activeContext.m_availablePoints.begin(),
+                    activeContext.m_availablePoints.end(),
+                    [&fillBounds, &refilledHandles](const ClaimPoint& point)
+                    {
+                        const bool inBounds = (point.m_position.GetX() >= fillBounds.GetMin().GetX()) &&
+                            (point.m_position.GetX() <= fillBounds.GetMax().GetX()) &&
+                            (point.m_position.GetY() >= fillBounds.GetMin().GetY()) &&
+                            (point.m_position.GetY() <= fillBounds.GetMax().GetY());
+                        if (inBounds)
+                        {
+                            refilledHandles.insert(point.m_handle);
+                        }
+                        return !inBounds;
+                    }),
+                activeContext.m_availablePoints.end());
+
+            // Move the claims of the points being refilled into the list of claimed world points before the fill
+            sectorInfo.m_claimedWorldPointsBeforeFill.clear();
+            for (auto claimItr = sectorInfo.m_claimedWorldPoints.begin(); claimItr != sectorInfo.m_claimedWorldPoints.end(); )
+            {
+                if (refilledHandles.find(claimItr->first) != refilledHandles.end())
+                {
+                    sectorInfo.m_claimedWorldPointsBeforeFill.emplace(*claimItr);
+                    claimItr = sectorInfo.m_claimedWorldPoints.erase(claimItr);
+                }
+                else
+                {
+                    ++claimItr;
+                }
+            }
+        }
+        else
+        {
+            // Clear out the list of claimed world points before we begin
+            sectorInfo.m_claimedWorldPointsBeforeFill = sectorInfo.m_claimedWorldPoints;
+            sectorInfo.m_claimedWorldPoints.clear();
+        }
 
         //for all active areas attempt to spawn vegetation on sector grid positions
         for (const auto& area : activeAreas)
@@ -1419,7 +1495,7 @@ namespace Vegetation
                 // already marked *all* sectors as dirty.
                 EnumerateSectorsInAabb(bounds, worldToSector, viewRect, [&](SectorId&& sectorId)
                 {
-                    dirtySet.MarkDirty(sectorId);
+                    dirtySet.MarkDirty(sectorId, bounds);
                     return true;
                 });
             }
@@ -1472,6 +1548,13 @@ namespace Vegetation
                 // - Vegetation tasks have been queued for this thread to process
 
                 // Our main thread has potentially updated its state, so cache a new copy of the pieces of state we need.
+                // Any surface points that were generated ahead of time with different sector settings are no longer valid.
+                if ((m_cachedMainThreadData.m_sectorDensity != cachedMainThreadData->m_sectorDensity) ||
+                    (m_cachedMainThreadData.m_sectorSizeInMeters != cachedMainThreadData->m_sectorSizeInMeters) ||
+                    (m_cachedMainThreadData.m_sectorPointSnapMode != cachedMainThreadData->m_sectorPointSnapMode))
+                {
+                    m_preparedSectors.clear();
+                }
                 m_cachedMainThreadData = *cachedMainThreadData;
 
                 // Run through all the queued tasks to update vegetation area active states and lists of dirty sectors
@@ -1594,6 +1677,21 @@ namespace Vegetation
             m_updateWorkList.end());
         AZ_Assert(m_updateWorkList.size() <= m_viewRectSectorCount, "Refreshed RequestedUpdate list should not be larger than the view rectangle.");
 
+        // Remove any partial fill bounds for the entries that were removed above.
+        for (auto partialFill = m_partialFillBounds.begin(); partialFill != m_partialFillBounds.end(); )
+        {
+            partialFill = (deleteAllSectors || !currViewRect.IsInside(partialFill->first)) ? m_partialFillBounds.erase(partialFill)
+                                                                                             : AZStd::next(partialFill);
+        }
+
+        // Remove any surface points that were generated ahead of time but are no longer needed or are out of date.
+        for (auto preparedSector = m_preparedSectors.begin(); preparedSector != m_preparedSectors.end(); )
+        {
+            const bool keepSector = !deleteAllSectors && currViewRect.IsInside(preparedSector->first) &&
+                !threadData->m_dirtySectorSurfacePoints.IsDirty(preparedSector->first);
+            preparedSector = keepSector ? AZStd::next(preparedSector) : m_preparedSectors.erase(preparedSector);
+        }
+
         // Clear our delete work list, we'll recreate it and sort it again below.
         // Note: We do NOT clear m_updateWorkList, because we use it to incrementally determine any new
         // updates to add to the queue.  Without it, we wouldn't know if a previous data change caused
@@ -1675,12 +1773,20 @@ namespace Vegetation
                         m_updateWorkList.emplace_back(sectorId, UpdateMode::RebuildSurfaceCacheAndFill);
                     }
 
+                    // A rebuild always refills the whole sector.
+                    m_partialFillBounds.erase(sectorId);
+
                     // We shouldn't ever have an update list that's larger than the set of sectors in the view rect.
                     AZ_Assert(m_updateWorkList.size() <= m_viewRectSectorCount, "Too many update requests added");
                 }
                 else if (threadData->m_dirtySectorContents.IsDirty(sectorId))
                 {
-                    // Active sector has new veg area information, so refill it.
+                    // Active sector has new veg area information, so refill it.  In incremental mode, only the points
+                    // within the bounds of the changes get refilled.
+                    const AZ::Aabb dirtyBounds = veg_incrementalSectorFill
+                        ? threadData->m_dirtySectorContents.GetDirtyBounds(sectorId)
+                        : AZ::Aabb::CreateNull();
+
                     auto found = AZStd::find_if(m_updateWorkList.begin(), m_updateWorkList.end(), [sectorId](auto& entry)
                     { return (entry.first == sectorId); });
                     if (found == m_updateWorkList.end())
@@ -1689,10 +1795,27 @@ namespace Vegetation
                         // overwrite existing entries because an existing entry might have previously
                         // requested "RebuildSurfaceCacheAndFill", which is more comprehensive than this request.
                         m_updateWorkList.emplace_back(sectorId, UpdateMode::Fill);
+                        if (dirtyBounds.IsValid())
+                        {
+                            m_partialFillBounds[sectorId] = dirtyBounds;
+                        }
 
                         // We shouldn't ever have an update list that's larger than the set of sectors in the view rect.
                         AZ_Assert(m_updateWorkList.size() <= m_viewRectSectorCount, "Too many update requests added");
                     }
+                    else if (auto partialFill = m_partialFillBounds.find(sectorId); partialFill != m_partialFillBounds.end())
+                    {
+                        // A pending partial fill needs to grow to include these changes.  Pending full fills and rebuilds
+                        // already include them.
+                        if (dirtyBounds.IsValid())
+                        {
+                            partialFill->second.AddAabb(dirtyBounds);
+                        }
+                        else
+                        {
+                            m_partialFillBounds.erase(partialFill);
+                        }
+                    }
                 }
             }
         }
@@ -1782,8 +1905,31 @@ namespace Vegetation
             auto& updateEntry = m_updateWorkList.back();
             SectorId sectorId = updateEntry.first;
             UpdateMode mode = updateEntry.second;
+
+            // Generate the surface points for this sector, along with the next few sectors that need them, in parallel.
+            if ((mode != UpdateMode::Fill) && (m_preparedSectors.find(sectorId) == m_preparedSectors.end()))
+            {
+                PrepareSectorPoints(vegTasks);
+            }
+
             m_updateWorkList.pop_back();
 
+            AZ::Aabb fillBounds = AZ::Aabb::CreateNull();
+            if (auto partialFill = m_partialFillBounds.find(sectorId); partialFill != m_partialFillBounds.end())
+            {
+                fillBounds = partialFill->second;
+                m_partialFillBounds.erase(partialFill);
+            }
+
+            SectorInfo preparedSector;
+            bool hasPreparedSector = false;
+            if (auto prepared = m_preparedSectors.find(sectorId); prepared != m_preparedSectors.end())
+            {
+                preparedSector = AZStd::move(prepared->second);
+                hasPreparedSector = true;
+                m_preparedSectors.erase(prepared);
+            }
+
             {
                 AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
 
@@ -1797,7 +1943,16 @@ namespace Vegetation
                     {
                         auto sectorInfo = vegTasks->GetSector(sectorId);
                         AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
-                        vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        if (hasPreparedSector)
+                        {
+                            // Only take the points, the claim callbacks in the base context refer to the existing sector.
+                            sectorInfo->m_baseContext.m_availablePoints = AZStd::move(preparedSector.m_baseContext.m_availablePoints);
+                            sectorInfo->m_baseContext.m_masks = AZStd::move(preparedSector.m_baseContext.m_masks);
+                        }
+                        else
+                        {
+                            vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        }
                         vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
                     }
                     break;
@@ -1806,14 +1961,16 @@ namespace Vegetation
                     {
                         auto sectorInfo = vegTasks->GetSector(sectorId);
                         AZ_Assert(sectorInfo, "Sector update mode is 'Fill' but sector doesn't exist");
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble, fillBounds);
                     }
                     break;
 
                     case UpdateMode::Create:
                     {
                         AZ_Assert(!vegTasks->GetSector(sectorId), "Sector update mode is 'Create' but sector already exists");
-                        auto sectorInfo = vegTasks->CreateSector(sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        auto sectorInfo = hasPreparedSector
+                            ? vegTasks->CreateSector(AZStd::move(preparedSector))
+                            : vegTasks->CreateSector(sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
                         vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
                     }
                     break;
@@ -1827,4 +1984,49 @@ namespace Vegetation
         return false;
     }
 
+    void AreaSystemComponent::UpdateContext::PrepareSectorPoints(VegetationThreadTasks* vegTasks)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        const int sectorDensity = m_cachedMainThreadData.m_sectorDensity;
+        const int sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
+        const SnapMode sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
+        const size_t maxSectors = aznumeric_cast<size_t>(AZStd::max<int32_t>(veg_sectorPointPrefetchCount, 1));
+
+        // Gather the next sectors that need new surface points.  The work list gets processed from the back, so that's
+        // where the search starts.  The sectors are stored in an unordered_map, so the pointers remain valid as more get added.
+        AZStd::vector<SectorInfo*> sectorsToPrepare;
+        sectorsToPrepare.reserve(maxSectors);
+        for (auto entry = m_updateWorkList.rbegin(); (entry != m_updateWorkList.rend()) && (sectorsToPrepare.size() < maxSectors); ++entry)
+        {
+            if ((entry->second != UpdateMode::Fill) && (m_preparedSectors.find(entry->first) == m_preparedSectors.end()))
+            {
+                SectorInfo& sectorInfo = m_preparedSectors[entry->first];
+                sectorInfo.m_id = entry->first;
+                sectorInfo.m_bounds = VegetationThreadTasks::GetSectorBounds(entry->first, sectorSizeInMeters);
+                sectorsToPrepare.push_back(&sectorInfo);
+            }
+        }
+
+        if (sectorsToPrepare.size() == 1)
+        {
+            vegTasks->UpdateSectorPoints(*sectorsToPrepare.front(), sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+            return;
+        }
+
+        AZ::JobCompletion jobCompletion;
+        for (SectorInfo* sectorInfo : sectorsToPrepare)
+        {
+            auto job = AZ::CreateJobFunction(
+                [vegTasks, sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode]()
+                {
+                    vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                },
+                true);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
 }
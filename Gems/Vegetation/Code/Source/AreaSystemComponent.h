@@ -207,15 +207,18 @@ namespace Vegetation
                 DirtySectors() = default;
                 ~DirtySectors() = default;
 
-                void MarkDirty(const SectorId& id);
+                void MarkDirty(const SectorId& id, const AZ::Aabb& dirtyBounds);
                 void MarkAllDirty();
                 bool IsAllDirty() const { return m_allSectorsDirty; }
                 bool IsNoneDirty() const { return (!m_allSectorsDirty) && m_dirtySet.empty(); }
                 bool IsDirty(const SectorId& id) const;
+                //! Gets the combined bounds of the changes within a dirty sector, or a null AABB if the whole sector is dirty.
+                AZ::Aabb GetDirtyBounds(const SectorId& id) const;
                 void Clear();
 
             private:
-                using DirtySectorSet = AZStd::unordered_set<SectorId>;
+                //! Map of dirty sectors to the combined bounds of the changes that made them dirty
+                using DirtySectorSet = AZStd::unordered_map<SectorId, AZ::Aabb>;
                 DirtySectorSet m_dirtySet;
                 //! Flag when *all* existing sectors are dirty
                 bool m_allSectorsDirty = false;
@@ -292,8 +295,14 @@ namespace Vegetation
             SectorInfo* GetSector(const SectorId& sectorId);
 
             SectorInfo* CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
-            void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
-            void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas);
+            //! Adds a sector whose surface points have already been generated with UpdateSectorPoints.
+            SectorInfo* CreateSector(SectorInfo&& preparedSectorInfo);
+            //! Generates the surface points of a sector. This only reads from the sector and the surface data system,
+            //! so it's safe to run for different sectors in parallel.
+            void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode) const;
+            //! Claims the points of a sector for the active areas. If fillBounds is valid, only the points within it are
+            //! claimed again, and all other points keep their existing claims.
+            void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas, const AZ::Aabb& fillBounds = AZ::Aabb::CreateNull());
             void DeleteSector(const SectorId& sectorId);
             void ClearSectors();
 
@@ -430,6 +439,7 @@ namespace Vegetation
         private:
             bool UpdateSectorWorkLists(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
             bool UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
+            void PrepareSectorPoints(VegetationThreadTasks* vegTasks);
 
             enum class UpdateMode
             {
@@ -451,6 +461,15 @@ namespace Vegetation
             // too many sectors active at any one point in time.
             size_t m_viewRectSectorCount = 0;
 
+            // Sectors from the update work list whose surface points have been generated ahead of time, so that the
+            // surface points of several sectors can be generated in parallel.  The sectors are moved into the rolling
+            // window (or their points are copied into it) when their work list entries are processed.
+            AZStd::unordered_map<SectorId, SectorInfo> m_preparedSectors;
+
+            // The bounds of the changes for each Fill entry in the update work list that only needs a partial fill.
+            // Fill entries without bounds in here refill the whole sector.
+            AZStd::unordered_map<SectorId, AZ::Aabb> m_partialFillBounds;
+
             // Thread-local copy of the main thread's m_cachedMainThreadData.  This way we can read from it on the vegetation
             // thread without requiring mutexes.
             CachedMainThreadData m_cachedMainThreadData;
@@ -8,6 +8,7 @@
 #include <VegetationProfiler.h>
 #include "InstanceSystemComponent.h"
 
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -329,18 +330,20 @@ namespace Vegetation
         // clear all instances
         {
             AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
-            for (auto instancePair : m_instanceMap)
+            for (InstanceId instanceId = 0; instanceId < m_instancePtrs.size(); ++instanceId)
             {
-                InstanceId instanceId = instancePair.first;
-                DescriptorPtr descriptor = instancePair.second.first;
-                InstancePtr opaqueInstanceData = instancePair.second.second;
-                if (opaqueInstanceData)
+                if (InstancePtr opaqueInstanceData = m_instancePtrs[instanceId]; opaqueInstanceData)
                 {
-                    descriptor->DestroyInstance(instanceId, opaqueInstanceData);
+                    m_instanceDescriptors[instanceId]->DestroyInstance(instanceId, opaqueInstanceData);
+                    ReleaseInstanceId(instanceId);
                 }
-                ReleaseInstanceId(instanceId);
             }
-            m_instanceMap.clear();
+
+            // Release the storage as well, since this is used to free everything when levels or game modes change.
+            m_instanceDescriptors.clear();
+            m_instanceDescriptors.shrink_to_fit();
+            m_instancePtrs.clear();
+            m_instancePtrs.shrink_to_fit();
             m_instanceCount = 0;
         }
 
@@ -477,9 +480,16 @@ namespace Vegetation
         if (opaqueInstanceData)
         {
             AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
-            AZ_Assert(m_instanceMap.find(instanceData.m_instanceId) == m_instanceMap.end(), "InstanceId %llu is already in use!", instanceData.m_instanceId);
-            m_instanceMap[instanceData.m_instanceId] = AZStd::make_pair(instanceData.m_descriptorPtr, opaqueInstanceData);
-            m_instanceCount = static_cast<int>(m_instanceMap.size());
+            const size_t instanceIndex = aznumeric_cast<size_t>(instanceData.m_instanceId);
+            if (instanceIndex >= m_instancePtrs.size())
+            {
+                m_instanceDescriptors.resize(instanceIndex + 1);
+                m_instancePtrs.resize(instanceIndex + 1, nullptr);
+            }
+            AZ_Assert(!m_instancePtrs[instanceIndex], "InstanceId %llu is already in use!", instanceData.m_instanceId);
+            m_instanceDescriptors[instanceIndex] = instanceData.m_descriptorPtr;
+            m_instancePtrs[instanceIndex] = opaqueInstanceData;
+            m_instanceCount++;
         }
     }
 
@@ -492,14 +502,15 @@ namespace Vegetation
 
         {
             AZStd::lock_guard<decltype(m_instanceMapMutex)> scopedLock(m_instanceMapMutex);
-            auto instanceItr = m_instanceMap.find(instanceId);
-            if (instanceItr != m_instanceMap.end())
+            const size_t instanceIndex = aznumeric_cast<size_t>(instanceId);
+            if ((instanceIndex < m_instancePtrs.size()) && m_instancePtrs[instanceIndex])
             {
-                descriptor = instanceItr->second.first;
-                opaqueInstanceData = instanceItr->second.second;
-                m_instanceMap.erase(instanceItr);
+                descriptor = AZStd::move(m_instanceDescriptors[instanceIndex]);
+                opaqueInstanceData = m_instancePtrs[instanceIndex];
+                m_instanceDescriptors[instanceIndex] = nullptr;
+                m_instancePtrs[instanceIndex] = nullptr;
+                m_instanceCount--;
             }
-            m_instanceCount = static_cast<int>(m_instanceMap.size());
         }
 
         if (opaqueInstanceData)
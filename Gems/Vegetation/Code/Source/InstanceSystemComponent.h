@@ -129,8 +129,12 @@ namespace Vegetation
 
         void ReleaseInstanceNode(InstanceId instanceId);
 
+        //! Instance ids are recycled through m_instanceIdPool, so they stay close to the peak number of live instances.
+        //! That lets the instances be stored in dense arrays indexed by id instead of in a map with a node per instance.
+        //! A slot with a null InstancePtr doesn't have a live instance.
         mutable AZStd::recursive_mutex m_instanceMapMutex;
-        AZStd::unordered_map<InstanceId, AZStd::pair<DescriptorPtr, InstancePtr>> m_instanceMap;
+        AZStd::vector<DescriptorPtr> m_instanceDescriptors;
+        AZStd::vector<InstancePtr> m_instancePtrs;
 
         mutable AZStd::recursive_mutex m_instanceDeletionSetMutex;
         AZStd::unordered_set<InstanceId> m_instanceDeletionSet;
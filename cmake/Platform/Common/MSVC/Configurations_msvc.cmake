@@ -23,6 +23,11 @@ if(CMAKE_VS_PLATFORM_TOOLSET_HOST_ARCHITECTURE AND NOT CMAKE_VS_PLATFORM_TOOLSET
     message(FATAL_ERROR "${CMAKE_VS_PLATFORM_TOOLSET_HOST_ARCHITECTURE} host toolset is not supported, it must be 'x64'")
 endif()
 
+set(LY_ENABLE_AVX2 FALSE CACHE BOOL "Compile for CPUs with AVX2 support, this enables the native 8 wide AZ::Simd::Vec8 backend. The binaries won't run on CPUs without AVX2.")
+if(LY_ENABLE_AVX2)
+    set(LY_AVX2_COMPILE_FLAGS /arch:AVX2)
+endif()
+
 ly_append_configurations_options(
     DEFINES
         _ENABLE_EXTENDED_ALIGNED_STORAGE # Enables support for extended alignment for the MSVC std::aligned_storage class
@@ -67,6 +72,7 @@ ly_append_configurations_options(
         /Zc:lambda      # Use the new lambda processor (See https://developercommunity.visualstudio.com/t/A-lambda-that-binds-the-this-pointer-w/1467873 for more details)
         /favor:AMD64    # Create Code optimized for 64 bit
         /bigobj         # Increase number of sections in obj files. Profiling has shown no meaningful impact in memory nore build times
+        ${LY_AVX2_COMPILE_FLAGS}
     COMPILATION_DEBUG
         /GS             # Enable Buffer security check
         /MDd            # defines _DEBUG, _MT, and _DLL and causes the application to use the debug multithread-specific and DLL-specific version of the run-time library.
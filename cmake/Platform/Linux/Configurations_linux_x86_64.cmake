@@ -6,6 +6,11 @@
 #
 #
 
+set(LY_ENABLE_AVX2 FALSE CACHE BOOL "Compile for CPUs with AVX2 support, this enables the native 8 wide AZ::Simd::Vec8 backend. The binaries won't run on CPUs without AVX2.")
+if(LY_ENABLE_AVX2)
+    set(LY_AVX2_COMPILE_FLAGS -mavx2)
+endif()
+
 if(CMAKE_CXX_COMPILER_ID STREQUAL "Clang")
 
     include(cmake/Platform/Common/Clang/Configurations_clang.cmake)
@@ -24,6 +29,7 @@ if(CMAKE_CXX_COMPILER_ID STREQUAL "Clang")
                 LINUX64
             COMPILATION
                 -msse4.1
+                ${LY_AVX2_COMPILE_FLAGS}
             LINK_NON_STATIC
                 ${SPECIFY_LINKER_FLAG}
                 -Wl,--no-undefined
@@ -48,6 +54,7 @@ if(CMAKE_CXX_COMPILER_ID STREQUAL "Clang")
                 LINUX64
             COMPILATION
                 -msse4.1
+                ${LY_AVX2_COMPILE_FLAGS}
             LINK_NON_STATIC
                 ${SPECIFY_LINKER_FLAG}
                 -Wl,--no-undefined
@@ -81,6 +88,7 @@ elseif(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
             LINUX64
         COMPILATION
             -msse4.1
+            ${LY_AVX2_COMPILE_FLAGS}
         LINK_NON_STATIC
             ${LY_GCC_GCOV_LFLAGS}
             ${LY_GCC_GPROF_LFLAGS}